@@ -45,6 +45,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "functional.h"
 #include "utility.h"
+#include "private/arithmetic_kernels.h"
 
 #if ETL_USING_STL
   #include <algorithm>
@@ -70,6 +71,17 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void pdq_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void pdq_sort(TIterator first, TIterator last, TCompare compare);
+
+#if ETL_CPP11_SUPPORTED
+  template <typename T, const size_t EXTENT>
+  class span;
+#endif
 }
 
 //*****************************************************************************
@@ -360,7 +372,7 @@ namespace etl
     difference_t count = (se - sb);
     TIterator2 db = de - count;
 
-    return TIterator2(memmove(db, sb, sizeof(value_t) * count)) + count;
+    return TIterator2(memmove(db, sb, sizeof(value_t) * count));
   }
 #else
   //***************************************************************************
@@ -420,36 +432,191 @@ namespace etl
   }
 #endif
 
-#if ETL_NOT_USING_STL
-  //***************************************************************************
-  // lower_bound
-  template<typename TIterator, typename TValue, typename TCompare>
-  ETL_NODISCARD
-  TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  namespace private_algorithm
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    //*************************************************************************
+    /// Adapts a comparison to find the lower bound of a value.
+    //*************************************************************************
+    template <typename TValue, typename TCompare>
+    struct lower_bound_predicate
+    {
+      lower_bound_predicate(const TValue& value_, TCompare compare_)
+        : value(value_)
+        , compare(compare_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T& element)
+      {
+        return compare(element, value);
+      }
+
+      const TValue& value;
+      TCompare      compare;
+    };
+
+    //*************************************************************************
+    /// Adapts a comparison to find the upper bound of a value.
+    //*************************************************************************
+    template <typename TValue, typename TCompare>
+    struct upper_bound_predicate
+    {
+      upper_bound_predicate(const TValue& value_, TCompare compare_)
+        : value(value_)
+        , compare(compare_)
+      {
+      }
 
-    difference_t count = etl::distance(first, last);
+      template <typename T>
+      bool operator()(const T& element)
+      {
+        return !compare(value, element);
+      }
 
-    while (count > 0)
+      const TValue& value;
+      TCompare      compare;
+    };
+
+    //*************************************************************************
+    /// Returns the first element in a partitioned range for which 'before'
+    /// is false.
+    /// The range is narrowed with a conditional move rather than a branch,
+    /// so there is no unpredictable branch to mispredict, and every search
+    /// makes ceil(log2(n + 1)) comparisons.
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    TIterator branchless_partition_point(TIterator first, TIterator last, TPredicate before)
     {
-      TIterator    itr = first;
-      difference_t step = count / 2;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-      etl::advance(itr, step);
+      difference_t length = etl::distance(first, last);
 
-      if (compare(*itr, value))
+      if (length == 0)
       {
-        first = ++itr;
-        count -= step + 1;
+        return first;
       }
-      else
+
+      while (length > 1)
       {
-        count = step;
+        const difference_t half = length / 2;
+
+        etl::advance(first, half & -difference_t(before(*etl::next(first, half - 1))));
+        length -= half;
       }
+
+      return before(*first) ? etl::next(first) : first;
     }
 
-    return first;
+    //*************************************************************************
+    /// The pointer version also prefetches both of the next candidates when
+    /// the range is larger than Prefetch_Range_Bytes, so that the memory
+    /// latency of the next step overlaps the current comparison. Smaller
+    /// ranges are likely to be in the cache already.
+    //*************************************************************************
+    template <typename T, typename TPredicate>
+    T* branchless_partition_point(T* first, T* last, TPredicate before)
+    {
+      static ETL_CONSTANT size_t Prefetch_Range_Bytes = 65536U;
+      static ETL_CONSTANT size_t Prefetch_Stop_Bytes  = 1024U;
+      static ETL_CONSTANT size_t Prefetch_Range_Length = (Prefetch_Range_Bytes / sizeof(T)) + 1U;
+      static ETL_CONSTANT size_t Prefetch_Stop_Length  = (Prefetch_Stop_Bytes / sizeof(T)) + 1U;
+
+      size_t length = static_cast<size_t>(last - first);
+
+      if (length == 0U)
+      {
+        return first;
+      }
+
+      if (length > Prefetch_Range_Length)
+      {
+        while (length > Prefetch_Stop_Length)
+        {
+          const size_t half = length / 2U;
+          const size_t next = (length - half) / 2U;
+
+          ETL_PREFETCH(first + (next - 1U));
+          ETL_PREFETCH(first + (half + next - 1U));
+
+          first += half & (size_t(0U) - size_t(before(first[half - 1U])));
+          length -= half;
+        }
+      }
+
+      while (length > 1U)
+      {
+        const size_t half = length / 2U;
+
+        first += half & (size_t(0U) - size_t(before(first[half - 1U])));
+        length -= half;
+      }
+
+      return before(*first) ? first + 1 : first;
+    }
+
+    //*************************************************************************
+    /// The classic search, for iterators that are not random access.
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      partition_point(TIterator first, TIterator last, TPredicate before)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t count = etl::distance(first, last);
+
+      while (count > 0)
+      {
+        TIterator    itr = first;
+        difference_t step = count / 2;
+
+        etl::advance(itr, step);
+
+        if (before(*itr))
+        {
+          first = ++itr;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    template <typename TIterator, typename TPredicate>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      partition_point(TIterator first, TIterator last, TPredicate before)
+    {
+      return private_algorithm::branchless_partition_point(first, last, before);
+    }
+
+    //*************************************************************************
+    /// Contiguous ranges of arithmetic types or pointers, whose comparisons
+    /// are cheap, always use the branchless search.
+    //*************************************************************************
+    template <typename T, typename TValue>
+    struct is_branchless_searchable
+    {
+      typedef typename etl::remove_cv<T>::type value_t;
+
+      static ETL_CONSTANT bool value = etl::is_same<value_t, TValue>::value &&
+                                       (etl::is_arithmetic<value_t>::value || etl::is_pointer<value_t>::value);
+    };
+  }
+
+#if ETL_NOT_USING_STL
+  //***************************************************************************
+  // lower_bound
+  // Random access iterators use the branchless search.
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    return private_algorithm::partition_point(first, last, private_algorithm::lower_bound_predicate<TValue, TCompare>(value, compare));
   }
 
   template<typename TIterator, typename TValue>
@@ -478,36 +645,35 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  // lower_bound
+  // Contiguous ranges of arithmetic types or pointers use the branchless
+  // search, even when the STL is used.
+  template<typename T, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, T*>::type
+    lower_bound(T* first, T* last, const TValue& value, TCompare compare)
+  {
+    return private_algorithm::branchless_partition_point(first, last, private_algorithm::lower_bound_predicate<TValue, TCompare>(value, compare));
+  }
+
+  template<typename T, typename TValue>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, T*>::type
+    lower_bound(T* first, T* last, const TValue& value)
+  {
+    return etl::lower_bound(first, last, value, etl::less<TValue>());
+  }
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
   // upper_bound
+  // Random access iterators use the branchless search.
   template<typename TIterator, typename TValue, typename TCompare>
   ETL_NODISCARD
   TIterator upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
-
-    difference_t count = etl::distance(first, last);
-
-    while (count > 0)
-    {
-      TIterator    itr = first;
-      difference_t step = count / 2;
-
-      etl::advance(itr, step);
-
-      if (!compare(value, *itr))
-      {
-        first = ++itr;
-        count -= step + 1;
-      }
-      else
-      {
-        count = step;
-      }
-    }
-
-    return first;
+    return private_algorithm::partition_point(first, last, private_algorithm::upper_bound_predicate<TValue, TCompare>(value, compare));
   }
 
   template<typename TIterator, typename TValue>
@@ -536,6 +702,26 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  // upper_bound
+  // Contiguous ranges of arithmetic types or pointers use the branchless
+  // search, even when the STL is used.
+  template<typename T, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, T*>::type
+    upper_bound(T* first, T* last, const TValue& value, TCompare compare)
+  {
+    return private_algorithm::branchless_partition_point(first, last, private_algorithm::upper_bound_predicate<TValue, TCompare>(value, compare));
+  }
+
+  template<typename T, typename TValue>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, T*>::type
+    upper_bound(T* first, T* last, const TValue& value)
+  {
+    return etl::upper_bound(first, last, value, etl::less<TValue>());
+  }
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
   // equal_range
@@ -574,6 +760,66 @@ namespace etl
   }
 #endif
 
+#if ETL_NOT_USING_STL
+  //***************************************************************************
+  // binary_search
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  bool binary_search(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    first = etl::lower_bound(first, last, value, compare);
+
+    return (first != last) && !compare(value, *first);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  bool binary_search(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::binary_search(first, last, value, compare());
+  }
+#else
+  //***************************************************************************
+  // binary_search
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  bool binary_search(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    return std::binary_search(first, last, value, compare);
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  bool binary_search(TIterator first, TIterator last, const TValue& value)
+  {
+    return std::binary_search(first, last, value);
+  }
+#endif
+
+  //***************************************************************************
+  // binary_search
+  // Contiguous ranges of arithmetic types or pointers use the branchless
+  // search, even when the STL is used.
+  template<typename T, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, bool>::type
+    binary_search(T* first, T* last, const TValue& value, TCompare compare)
+  {
+    first = etl::lower_bound(first, last, value, compare);
+
+    return (first != last) && !compare(value, *first);
+  }
+
+  template<typename T, typename TValue>
+  ETL_NODISCARD
+  typename etl::enable_if<private_algorithm::is_branchless_searchable<T, TValue>::value, bool>::type
+    binary_search(T* first, T* last, const TValue& value)
+  {
+    return etl::binary_search(first, last, value, etl::less<TValue>());
+  }
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
   // find_if
@@ -634,6 +880,20 @@ namespace etl
   }
 #endif
 
+#if ETL_ARITHMETIC_SIMD
+  //***************************************************************************
+  // find
+  // Contiguous ranges of arithmetic types are searched a vector at a time.
+  template <typename TPointee, typename TValue>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::is_same<typename etl::remove_cv<TPointee>::type, TValue>::value &&
+                          etl::private_arithmetic::has_kernel<TValue>::find, TPointee*>::type
+    find(TPointee* first, TPointee* last, const TValue& value)
+  {
+    return etl::private_arithmetic::find(first, last, value);
+  }
+#endif
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
   // fill
@@ -732,6 +992,22 @@ namespace etl
   }
 #endif
 
+#if ETL_ARITHMETIC_SIMD
+  //***************************************************************************
+  /// count
+  /// Contiguous ranges of arithmetic types are counted a vector at a time.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TPointee, typename TValue>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::is_same<typename etl::remove_cv<TPointee>::type, TValue>::value &&
+                          etl::private_arithmetic::has_kernel<TValue>::find, ptrdiff_t>::type
+    count(TPointee* first, TPointee* last, const TValue& value)
+  {
+    return etl::private_arithmetic::count<TValue>(first, last, value);
+  }
+#endif
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
   // count_if
@@ -1076,6 +1352,26 @@ namespace etl
   }
 #endif
 
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Moves the value under C++11, or copies it under C++03.
+    //*************************************************************************
+#if ETL_CPP11_SUPPORTED
+    template <typename T>
+    typename etl::remove_reference<T>::type&& move_or_copy(T& value)
+    {
+      return etl::move(value);
+    }
+#else
+    template <typename T>
+    T& move_or_copy(T& value)
+    {
+      return value;
+    }
+#endif
+  }
+
   //***************************************************************************
   // Heap
   namespace private_heap
@@ -1088,12 +1384,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = private_algorithm::move_or_copy(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = private_algorithm::move_or_copy(value);
     }
 
     // Adjust Heap Helper
@@ -1110,18 +1406,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = private_algorithm::move_or_copy(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = private_algorithm::move_or_copy(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, private_algorithm::move_or_copy(value), compare);
     }
 
     // Is Heap Helper
@@ -1145,6 +1441,58 @@ namespace etl
 
       return true;
     }
+
+    // Make Heap Helper
+    template <typename TIterator, typename TCompare>
+    void make_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      for (difference_t parent = (length - 2) / 2; parent >= 0; --parent)
+      {
+        private_heap::adjust_heap(first, parent, length, value_t(private_algorithm::move_or_copy(first[parent])), compare);
+      }
+    }
+
+    // Sort Heap Helper
+    template <typename TIterator, typename TCompare>
+    void sort_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      for (difference_t n = (last - first) - 1; n > 0; --n)
+      {
+        value_t value = private_algorithm::move_or_copy(first[n]);
+        first[n] = private_algorithm::move_or_copy(first[0]);
+        private_heap::adjust_heap(first, difference_t(0), n, private_algorithm::move_or_copy(value), compare);
+      }
+    }
+
+    // Select Heap Helper
+    // Swaps each element of [middle, last) that is less than the top of the
+    // heap [first, middle) into the heap, which ends up holding the smallest.
+    template <typename TIterator, typename TCompare>
+    void select(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = middle - first;
+
+      for (TIterator itr = middle; itr != last; ++itr)
+      {
+        if (compare(*itr, *first))
+        {
+          value_t value = private_algorithm::move_or_copy(*itr);
+          *itr = private_algorithm::move_or_copy(*first);
+          private_heap::adjust_heap(first, difference_t(0), length, private_algorithm::move_or_copy(value), compare);
+        }
+      }
+    }
   }
 
   #if ETL_NOT_USING_STL
@@ -1423,6 +1771,10 @@ namespace etl
     template <typename TIterator>
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
+      // The new position of the first item.
+      TIterator result = first;
+      etl::advance(result, etl::distance(middle, last));
+
       TIterator next = middle;
 
       while (first != next)
@@ -1441,7 +1793,7 @@ namespace etl
         }
       }
 
-      return first;
+      return result;
     }
 
     //*********************************
@@ -1451,13 +1803,21 @@ namespace etl
       typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
       // Save the first item.
+#if ETL_CPP11_SUPPORTED
       value_type temp(etl::move(*first));
+#else
+      value_type temp(*first);
+#endif
 
       // Move the rest.
       TIterator result = etl::move(etl::next(first), last, first);
 
       // Restore the first item in its rotated position.
+#if ETL_CPP11_SUPPORTED
       *result = etl::move(temp);
+#else
+      *result = temp;
+#endif
 
       // The new position of the first item.
       return result;
@@ -1471,13 +1831,21 @@ namespace etl
 
       // Save the last item.
       TIterator previous = etl::prev(last);
+#if ETL_CPP11_SUPPORTED
       value_type temp(etl::move(*previous));
+#else
+      value_type temp(*previous);
+#endif
 
       // Move the rest.
       TIterator result = etl::move_backward(first, previous, last);
 
       // Restore the last item in its rotated position.
+#if ETL_CPP11_SUPPORTED
       *first = etl::move(temp);
+#else
+      *first = temp;
+#endif
 
       // The new position of the first item.
       return result;
@@ -1510,2004 +1878,3795 @@ namespace etl
   }
 #endif
 
-#if ETL_NOT_USING_STL
-  //***************************************************************************
-  // find_end
-  // Predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  ETL_NODISCARD
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se,
-                      TPredicate predicate)
+  namespace private_algorithm
   {
-    if (sb == se)
+    //*************************************************************************
+    /// Merges two consecutive sorted ranges in to one sorted range.
+    /// Stable. Uses no buffer. The longer range is split in half, and the
+    /// halves are swapped into place by rotation.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_without_buffer(TIterator first, TIterator middle, TIterator last, TCompare compare)
     {
-      return e;
-    }
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-    TIterator1 result = e;
+      const difference_t length1 = etl::distance(first, middle);
+      const difference_t length2 = etl::distance(middle, last);
 
-    while (true)
-    {
-      TIterator1 new_result = etl::search(b, e, sb, se, predicate);
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
 
-      if (new_result == e)
+      if ((length1 + length2) == 2)
       {
-        break;
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      // Split the longer range in half, and the shorter where its half would go.
+      TIterator cut1 = first;
+      TIterator cut2 = middle;
+
+      if (length1 > length2)
+      {
+        etl::advance(cut1, length1 / 2);
+        cut2 = etl::lower_bound(middle, last, *cut1, compare);
       }
       else
       {
-        result = new_result;
-        b = result;
-        ++b;
+        etl::advance(cut2, length2 / 2);
+        cut1 = etl::upper_bound(first, middle, *cut2, compare);
       }
-    }
-    return result;
-  }
 
-  // Default
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se)
-  {
-    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> predicate;
+      // Swap the middle two quarters.
+      TIterator new_middle = cut1;
 
-    return find_end(b, e, sb, se, predicate());
-  }
-#else
-  //***************************************************************************
-  // find_end
-  // Predicate
-  template <typename TIterator1, typename TIterator2, typename TPredicate>
-  ETL_NODISCARD
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se,
-                      TPredicate predicate)
-  {
-    return std::find_end(b, e, sb, se, predicate);
-  }
+      if (cut1 == middle)
+      {
+        new_middle = cut2;
+      }
+      else if (middle != cut2)
+      {
+        new_middle = etl::rotate(cut1, middle, cut2);
+      }
 
-  // Default
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD
-  TIterator1 find_end(TIterator1 b, TIterator1 e,
-                      TIterator2 sb, TIterator2 se)
-  {
-    return std::find_end(b, e, sb, se);
+      private_algorithm::merge_without_buffer(first, cut1, new_middle, compare);
+      private_algorithm::merge_without_buffer(new_middle, cut2, last, compare);
+    }
   }
-#endif
 
 #if ETL_NOT_USING_STL
   //***************************************************************************
-  /// Finds the iterator to the smallest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
+  /// Merges two consecutive sorted ranges in to one sorted range.
+  /// Stable. Uses no buffer, so is O(NlogN).
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  TIterator min_element(TIterator begin,
-                        TIterator end,
-                        TCompare  compare)
+  void inplace_merge(TIterator first, TIterator middle, TIterator last, TCompare compare)
   {
-    TIterator minimum = begin;
-
-    while (begin != end)
-    {
-      if (compare(*begin, *minimum))
-      {
-        minimum = begin;
-      }
-
-      ++begin;
-    }
-
-    return minimum;
+    private_algorithm::merge_without_buffer(first, middle, last, compare);
   }
 
   //***************************************************************************
-  /// min_element
+  /// Merges two consecutive sorted ranges in to one sorted range.
+  /// Stable. Uses no buffer, so is O(NlogN).
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
   template <typename TIterator>
-  ETL_NODISCARD
-  TIterator min_element(TIterator begin,
-                        TIterator end)
+  void inplace_merge(TIterator first, TIterator middle, TIterator last)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::min_element(begin, end, etl::less<value_t>());
+    etl::inplace_merge(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
-  /// Finds the iterator to the smallest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
+  /// Merges two consecutive sorted ranges in to one sorted range.
+  /// Stable.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  TIterator min_element(TIterator begin,
-                        TIterator end,
-                        TCompare  compare)
+  void inplace_merge(TIterator first, TIterator middle, TIterator last, TCompare compare)
   {
-    return std::min_element(begin, end, compare);
+    std::inplace_merge(first, middle, last, compare);
   }
 
   //***************************************************************************
-  /// min_element
+  /// Merges two consecutive sorted ranges in to one sorted range.
+  /// Stable.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
   template <typename TIterator>
-  ETL_NODISCARD
-  TIterator min_element(TIterator begin,
-                        TIterator end)
+  void inplace_merge(TIterator first, TIterator middle, TIterator last)
   {
-    return std::min_element(begin, end);
+    std::inplace_merge(first, middle, last);
   }
 #endif
 
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Finds the first element not less than value by exponential search
+    /// from first, then a binary search of the last step.
+    /// O(log d), where d is the distance to the result.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    TIterator gallop_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t remaining = etl::distance(first, last);
+      difference_t step      = 1;
+
+      while ((remaining > step) && compare(*etl::next(first, step - 1), value))
+      {
+        etl::advance(first, step);
+        remaining -= step;
+        step *= 2;
+      }
+
+      return etl::lower_bound(first, etl::next(first, (remaining < step) ? remaining : step), value, compare);
+    }
+
+    //*************************************************************************
+    /// Finds the first element greater than value by exponential search
+    /// from first, then a binary search of the last step.
+    /// O(log d), where d is the distance to the result.
+    //*************************************************************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    TIterator gallop_upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t remaining = etl::distance(first, last);
+      difference_t step      = 1;
+
+      while ((remaining > step) && !compare(value, *etl::next(first, step - 1)))
+      {
+        etl::advance(first, step);
+        remaining -= step;
+        step *= 2;
+      }
+
+      return etl::upper_bound(first, etl::next(first, (remaining < step) ? remaining : step), value, compare);
+    }
+  }
+
 #if ETL_NOT_USING_STL
   //***************************************************************************
-  /// Finds the iterator to the largest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
+  /// Merges two sorted ranges in to a third.
+  /// Stable. Equal elements are taken from the first range first.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-    TIterator max_element(TIterator begin,
-                          TIterator end,
-                          TCompare  compare)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out,
+                        TCompare compare)
   {
-    TIterator maximum = begin;
-
-    while (begin != end)
+    while ((first1 != last1) && (first2 != last2))
     {
-      if (!compare(*begin, *maximum))
+      if (compare(*first2, *first1))
       {
-        maximum = begin;
+        *out = *first2;
+        ++first2;
+      }
+      else
+      {
+        *out = *first1;
+        ++first1;
       }
 
-      ++begin;
+      ++out;
     }
 
-    return maximum;
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
   }
 
   //***************************************************************************
-  /// max_element
+  /// Merges two sorted ranges in to a third.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
-  template <typename TIterator>
-  ETL_NODISCARD
-    TIterator max_element(TIterator begin,
-                          TIterator end)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::max_element(begin, end, etl::less<value_t>());
+    return etl::merge(first1, last1, first2, last2, out, etl::less<typename etl::iterator_traits<TIterator1>::value_type>());
   }
-#else
+
   //***************************************************************************
-  /// Finds the iterator to the largest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
+  /// Copies the elements that are in either sorted range.
+  /// An element that is m times in the first range and n times in the
+  /// second is copied max(m, n) times.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-    TIterator max_element(TIterator begin,
-                          TIterator end,
-                          TCompare  compare)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out,
+                            TCompare compare)
   {
-    return std::max_element(begin, end, compare);
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first2, *first1))
+      {
+        *out = *first2;
+        ++first2;
+      }
+      else
+      {
+        if (!compare(*first1, *first2))
+        {
+          ++first2;
+        }
+
+        *out = *first1;
+        ++first1;
+      }
+
+      ++out;
+    }
+
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
   }
 
   //***************************************************************************
-  /// max_element
+  /// Copies the elements that are in either sorted range.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
-  template <typename TIterator>
-  ETL_NODISCARD
-    TIterator max_element(TIterator begin,
-                          TIterator end)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out)
   {
-    return std::max_element(begin, end);
+    return etl::set_union(first1, last1, first2, last2, out, etl::less<typename etl::iterator_traits<TIterator1>::value_type>());
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// Finds the greatest and the smallest element in the range (begin, end).<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
+  /// Copies the elements of the first sorted range that are also in the second.
+  /// An element that is m times in the first range and n times in the
+  /// second is copied min(m, n) times.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                        TIterator end,
-                                                        TCompare  compare)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out,
+                                   TCompare compare)
   {
-    TIterator minimum = begin;
-    TIterator maximum = begin;
-
-    while (begin != end)
+    while ((first1 != last1) && (first2 != last2))
     {
-      if (compare(*begin, *minimum))
+      if (compare(*first1, *first2))
       {
-        minimum = begin;
+        ++first1;
       }
-
-      if (compare(*maximum, *begin))
+      else
       {
-        maximum = begin;
-      }
+        if (!compare(*first2, *first1))
+        {
+          *out = *first1;
+          ++out;
+          ++first1;
+        }
 
-      ++begin;
+        ++first2;
+      }
     }
 
-    return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
+    return out;
   }
 
   //***************************************************************************
-  /// minmax_element
+  /// Copies the elements of the first sorted range that are also in the second.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
-  template <typename TIterator>
-  ETL_NODISCARD
-  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                        TIterator end)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out)
   {
-    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
-
-    return etl::minmax_element(begin, end, etl::less<value_t>());
+    return etl::set_intersection(first1, last1, first2, last2, out, etl::less<typename etl::iterator_traits<TIterator1>::value_type>());
   }
 #else
   //***************************************************************************
-/// Finds the greatest and the smallest element in the range (begin, end).<br>
-///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
-///\ingroup algorithm
-//***************************************************************************
-  template <typename TIterator, typename TCompare>
-  ETL_NODISCARD
-  std::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                 TIterator end,
-                                                 TCompare  compare)
+  /// Merges two sorted ranges in to a third.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out,
+                        TCompare compare)
   {
-    return std::minmax_element(begin, end, compare);
+    return std::merge(first1, last1, first2, last2, out, compare);
   }
 
   //***************************************************************************
-  /// minmax_element
+  /// Merges two sorted ranges in to a third.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
-  template <typename TIterator>
-  ETL_NODISCARD
-  std::pair<TIterator, TIterator> minmax_element(TIterator begin,
-                                                 TIterator end)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out)
   {
-    return std::minmax_element(begin, end);
+    return std::merge(first1, last1, first2, last2, out);
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// minmax
+  /// Copies the elements that are in either sorted range.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename T>
-  ETL_NODISCARD
-  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
-                                              const T& b)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out,
+                            TCompare compare)
   {
-    return (b < a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
+    return std::set_union(first1, last1, first2, last2, out, compare);
   }
 
   //***************************************************************************
-  /// minmax
+  /// Copies the elements that are in either sorted range.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename T, typename TCompare>
-  ETL_NODISCARD
-  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
-                                              const T& b,
-                                              TCompare compare)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out)
   {
-    return compare(b, a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
+    return std::set_union(first1, last1, first2, last2, out);
   }
-#else
+
   //***************************************************************************
-  /// minmax
+  /// Copies the elements of the first sorted range that are also in the second.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename T>
-  ETL_NODISCARD
-  std::pair<const T&, const T&> minmax(const T& a,
-                                       const T& b)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out,
+                                   TCompare compare)
   {
-    return std::minmax(a, b);
+    return std::set_intersection(first1, last1, first2, last2, out, compare);
   }
 
   //***************************************************************************
-  /// minmax
+  /// Copies the elements of the first sorted range that are also in the second.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename T, typename TCompare>
-  ETL_NODISCARD
-  std::pair<const T&, const T&> minmax(const T& a,
-                                       const T& b,
-                                       TCompare compare)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out)
   {
-    return std::minmax(a, b, compare);
+    return std::set_intersection(first1, last1, first2, last2, out);
   }
 #endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// is_sorted_until
+  /// Merges two sorted ranges in to a third, galloping over runs.
+  /// After Min_Gallop consecutive elements from the same range, the end of
+  /// the run is found by exponential search and the run is copied as a block.
+  /// Much faster than merge when the ranges interleave in long runs, such
+  /// as when merging mostly disjoint sets, but around 10% slower when they
+  /// interleave element by element.
+  /// Stable. Equal elements are taken from the first range first.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator>
-  ETL_NODISCARD
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end)
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge_galloping(TIterator1 first1, TIterator1 last1,
+                                  TIterator2 first2, TIterator2 last2,
+                                  TOutputIterator out,
+                                  TCompare compare)
   {
-    if (begin != end)
-    {
-      TIterator next = begin;
+    static const int Min_Gallop = 7;
 
-      while (++next != end)
-      {
-        if (*next < *begin)
-        {
-          return next;
-        }
+    int wins1 = 0;
+    int wins2 = 0;
 
-        ++begin;
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (wins1 >= Min_Gallop)
+      {
+        // Copy the elements of the first range that are not greater than the next of the second.
+        TIterator1 run_end = private_algorithm::gallop_upper_bound(first1, last1, *first2, compare);
+        out   = etl::copy(first1, run_end, out);
+        first1 = run_end;
+        wins1  = 0;
+      }
+      else if (wins2 >= Min_Gallop)
+      {
+        // Copy the elements of the second range that are less than the next of the first.
+        TIterator2 run_end = private_algorithm::gallop_lower_bound(first2, last2, *first1, compare);
+        out    = etl::copy(first2, run_end, out);
+        first2 = run_end;
+        wins2  = 0;
+      }
+      else if (compare(*first2, *first1))
+      {
+        *out = *first2;
+        ++out;
+        ++first2;
+        ++wins2;
+        wins1 = 0;
+      }
+      else
+      {
+        *out = *first1;
+        ++out;
+        ++first1;
+        ++wins1;
+        wins2 = 0;
       }
     }
 
-    return end;
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
   }
 
   //***************************************************************************
-  /// is_sorted_until
+  /// Merges two sorted ranges in to a third, galloping over runs.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  TOutputIterator merge_galloping(TIterator1 first1, TIterator1 last1,
+                                  TIterator2 first2, TIterator2 last2,
+                                  TOutputIterator out)
+  {
+    return etl::merge_galloping(first1, last1, first2, last2, out, etl::less<typename etl::iterator_traits<TIterator1>::value_type>());
+  }
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Copies the integers that are in both sorted spans to the output span.
+  /// Branchless, so it does not suffer mispredictions when the spans
+  /// interleave randomly.
+  /// Stops early if the output is full.
+  ///\return A pointer to the end of the written part of the output.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T1, size_t EXTENT1, typename T2, size_t EXTENT2, typename T, size_t EXTENT>
+  typename etl::enable_if<etl::is_integral<T>::value &&
+                          etl::is_same<typename etl::remove_cv<T1>::type, T>::value &&
+                          etl::is_same<typename etl::remove_cv<T2>::type, T>::value, T*>::type
+    set_intersection(etl::span<T1, EXTENT1> range1, etl::span<T2, EXTENT2> range2, etl::span<T, EXTENT> output)
+  {
+    const T1* data1       = range1.data();
+    const T2* data2       = range2.data();
+    T*        output_data = output.data();
+
+    const size_t size1       = range1.size();
+    const size_t size2       = range2.size();
+    const size_t output_size = output.size();
+
+    // Indexes, rather than pointers, let the compiler use conditional moves.
+    size_t i = 0U;
+    size_t j = 0U;
+    size_t k = 0U;
+
+    while ((i < size1) && (j < size2) && (k < output_size))
+    {
+      const T value1 = data1[i];
+      const T value2 = data2[j];
+
+      // Always written, but only kept when the values match.
+      output_data[k] = value1;
+
+      k += size_t(value1 == value2);
+      i += size_t(value1 <= value2);
+      j += size_t(value2 <= value1);
+    }
+
+    return output_data + k;
+  }
+#endif
+
+#if ETL_NOT_USING_STL
+  //***************************************************************************
+  // find_end
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
   ETL_NODISCARD
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end,
-                            TCompare  compare)
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se,
+                      TPredicate predicate)
   {
-    if (begin != end)
+    if (sb == se)
     {
-      TIterator next = begin;
+      return e;
+    }
 
-      while (++next != end)
-      {
-        if (compare(*next, *begin))
-        {
-          return next;
-        }
+    TIterator1 result = e;
 
-        ++begin;
+    while (true)
+    {
+      TIterator1 new_result = etl::search(b, e, sb, se, predicate);
+
+      if (new_result == e)
+      {
+        break;
+      }
+      else
+      {
+        result = new_result;
+        b = result;
+        ++b;
       }
     }
+    return result;
+  }
 
-    return end;
+  // Default
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se)
+  {
+    typedef etl::equal_to<typename etl::iterator_traits<TIterator1>::value_type> predicate;
+
+    return find_end(b, e, sb, se, predicate());
   }
 #else
   //***************************************************************************
-  /// is_sorted_until
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
-  //***************************************************************************
-  template <typename TIterator>
+  // find_end
+  // Predicate
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
   ETL_NODISCARD
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end)
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se,
+                      TPredicate predicate)
   {
-    return std::is_sorted_until(begin, end);
+    return std::find_end(b, e, sb, se, predicate);
+  }
+
+  // Default
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  TIterator1 find_end(TIterator1 b, TIterator1 e,
+                      TIterator2 sb, TIterator2 se)
+  {
+    return std::find_end(b, e, sb, se);
   }
+#endif
 
+#if ETL_NOT_USING_STL
   //***************************************************************************
-  /// is_sorted_until
+  /// Finds the iterator to the smallest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  TIterator is_sorted_until(TIterator begin,
-                            TIterator end,
-                            TCompare  compare)
+  TIterator min_element(TIterator begin,
+                        TIterator end,
+                        TCompare  compare)
   {
-    return std::is_sorted_until(begin, end, compare);
+    TIterator minimum = begin;
+
+    while (begin != end)
+    {
+      if (compare(*begin, *minimum))
+      {
+        minimum = begin;
+      }
+
+      ++begin;
+    }
+
+    return minimum;
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// is_sorted
+  /// min_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
-  template<typename TIterator>
+  template <typename TIterator>
   ETL_NODISCARD
-  bool is_sorted(TIterator begin,
-                 TIterator end)
+  TIterator min_element(TIterator begin,
+                        TIterator end)
   {
-    return etl::is_sorted_until(begin, end) == end;
-  }
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
+    return etl::min_element(begin, end, etl::less<value_t>());
+  }
+#else
   //***************************************************************************
-  /// is_sorted
+  /// Finds the iterator to the smallest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template<typename TIterator, typename TCompare>
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool is_sorted(TIterator begin,
-                 TIterator end,
-                 TCompare  compare)
+  TIterator min_element(TIterator begin,
+                        TIterator end,
+                        TCompare  compare)
   {
-    return etl::is_sorted_until(begin, end, compare) == end;
+    return std::min_element(begin, end, compare);
   }
-#else
+
   //***************************************************************************
-  /// is_sorted
+  /// min_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
   //***************************************************************************
-  template<typename TIterator>
+  template <typename TIterator>
   ETL_NODISCARD
-  bool is_sorted(TIterator begin,
-                 TIterator end)
+  TIterator min_element(TIterator begin,
+                        TIterator end)
   {
-    return std::is_sorted(begin, end);
+    return std::min_element(begin, end);
   }
+#endif
 
+#if ETL_ARITHMETIC_SIMD
   //***************************************************************************
-  /// is_sorted
+  /// min_element
+  /// Contiguous ranges of arithmetic types find the smallest value a vector
+  /// at a time, then search for its first occurrence.
+  /// Ranges containing NaN use the element by element search.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template<typename TIterator, typename TCompare>
+  template <typename T>
   ETL_NODISCARD
-  bool is_sorted(TIterator begin,
-                 TIterator end,
-                 TCompare  compare)
+  typename etl::enable_if<etl::private_arithmetic::has_kernel<T>::min_max, T*>::type
+    min_element(T* begin, T* end)
   {
-    return std::is_sorted(begin, end, compare);
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    value_t minimum = value_t();
+    value_t maximum = value_t();
+
+    if (begin == end)
+    {
+      return end;
+    }
+    else if (etl::private_arithmetic::min_max_values<true, false, value_t>(begin, end, minimum, maximum))
+    {
+      return etl::private_arithmetic::find(begin, end, minimum);
+    }
+    else
+    {
+      return etl::min_element(begin, end, etl::less<value_t>());
+    }
   }
 #endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
+#if ETL_NOT_USING_STL
   //***************************************************************************
-  /// find_if_not
+  /// Finds the iterator to the largest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  TIterator find_if_not(TIterator       begin,
-                        TIterator       end,
-                        TUnaryPredicate predicate)
+    TIterator max_element(TIterator begin,
+                          TIterator end,
+                          TCompare  compare)
   {
+    TIterator maximum = begin;
+
     while (begin != end)
     {
-      if (!predicate(*begin))
+      if (compare(*maximum, *begin))
       {
-        return begin;
+        maximum = begin;
       }
 
       ++begin;
     }
 
-    return end;
+    return maximum;
   }
-#else
+
   //***************************************************************************
-  /// find_if_not
+  /// max_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename TIterator>
   ETL_NODISCARD
-  TIterator find_if_not(TIterator       begin,
-                        TIterator       end,
-                        TUnaryPredicate predicate)
+    TIterator max_element(TIterator begin,
+                          TIterator end)
   {
-    return std::find_if_not(begin, end, predicate);
-  }
-#endif
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
+    return etl::max_element(begin, end, etl::less<value_t>());
+  }
+#else
   //***************************************************************************
-  /// is_permutation
+  /// Finds the iterator to the largest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2)
+    TIterator max_element(TIterator begin,
+                          TIterator end,
+                          TCompare  compare)
   {
-    if (begin1 != end1)
-    {
-      TIterator2 end2 = begin2;
-
-      etl::advance(end2, etl::distance(begin1, end1));
-
-      for (TIterator1 i = begin1; i != end1; ++i)
-      {
-        if (i == etl::find(begin1, i, *i))
-        {
-          size_t n = etl::count(begin2, end2, *i);
-
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
-      }
-    }
-
-    return true;
+    return std::max_element(begin, end, compare);
   }
 
   //***************************************************************************
-  /// is_permutation
+  /// max_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  template <typename TIterator>
   ETL_NODISCARD
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TBinaryPredicate predicate)
+    TIterator max_element(TIterator begin,
+                          TIterator end)
   {
-    if (begin1 != end1)
-    {
-      TIterator2 end2 = begin2;
+    return std::max_element(begin, end);
+  }
+#endif
 
-      etl::advance(end2, etl::distance(begin1, end1));
+#if ETL_ARITHMETIC_SIMD
+  //***************************************************************************
+  /// max_element
+  /// Contiguous ranges of arithmetic types find the largest value a vector
+  /// at a time, then search for its first occurrence.
+  /// Ranges containing NaN use the element by element search.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  ETL_NODISCARD
+  typename etl::enable_if<etl::private_arithmetic::has_kernel<T>::min_max, T*>::type
+    max_element(T* begin, T* end)
+  {
+    typedef typename etl::remove_cv<T>::type value_t;
 
-      for (TIterator1 i = begin1; i != end1; ++i)
-      {
-        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
-        {
-          size_t n = etl::count(begin2, end2, *i);
+    value_t minimum = value_t();
+    value_t maximum = value_t();
 
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
-      }
+    if (begin == end)
+    {
+      return end;
+    }
+    else if (etl::private_arithmetic::min_max_values<false, true, value_t>(begin, end, minimum, maximum))
+    {
+      return etl::private_arithmetic::find(begin, end, maximum);
+    }
+    else
+    {
+      return etl::max_element(begin, end, etl::less<value_t>());
     }
-
-    return true;
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// is_permutation
+  /// Finds the greatest and the smallest element in the range (begin, end).<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2,
-                      TIterator2 end2)
+  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                        TIterator end,
+                                                        TCompare  compare)
   {
-    if (begin1 != end1)
+    TIterator minimum = begin;
+    TIterator maximum = begin;
+
+    while (begin != end)
     {
-      for (TIterator1 i = begin1; i != end1; ++i)
+      if (compare(*begin, *minimum))
       {
-        if (i == etl::find(begin1, i, *i))
-        {
-          size_t n = etl::count(begin2, end2, *i);
+        minimum = begin;
+      }
 
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
+      if (!compare(*begin, *maximum))
+      {
+        maximum = begin;
       }
+
+      ++begin;
     }
 
-    return true;
+    return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
   }
 
   //***************************************************************************
-  /// is_permutation
+  /// minmax_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  template <typename TIterator>
   ETL_NODISCARD
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TIterator2       end2,
-                      TBinaryPredicate predicate)
+  ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                        TIterator end)
   {
-    if (begin1 != end1)
-    {
-      for (TIterator1 i = begin1; i != end1; ++i)
-      {
-        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
-        {
-          size_t n = etl::count(begin2, end2, *i);
-
-          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
-          {
-            return false;
-          }
-        }
-      }
-    }
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return true;
+    return etl::minmax_element(begin, end, etl::less<value_t>());
   }
 #else
   //***************************************************************************
-  /// is_permutation
-  ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
-  //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
+/// Finds the greatest and the smallest element in the range (begin, end).<br>
+///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
+///\ingroup algorithm
+//***************************************************************************
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2)
+  std::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                 TIterator end,
+                                                 TCompare  compare)
   {
-    return std::is_permutation(begin1, end1, begin2);
+    return std::minmax_element(begin, end, compare);
   }
 
   //***************************************************************************
-  /// is_permutation
+  /// minmax_element
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  template <typename TIterator>
   ETL_NODISCARD
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TBinaryPredicate predicate)
+  std::pair<TIterator, TIterator> minmax_element(TIterator begin,
+                                                 TIterator end)
   {
-    return std::is_permutation(begin1, end1, begin2, predicate);
+    return std::minmax_element(begin, end);
   }
+#endif
 
-  #if ETL_CPP14_SUPPORTED
+#if ETL_ARITHMETIC_SIMD
   //***************************************************************************
-  /// is_permutation
+  /// minmax_element
+  /// Contiguous ranges of arithmetic types find both values in one vector
+  /// pass, then search for the first smallest and the last largest.
+  /// Ranges containing NaN use the element by element search.
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2>
+  template <typename T>
   ETL_NODISCARD
-  bool is_permutation(TIterator1 begin1,
-                      TIterator1 end1,
-                      TIterator2 begin2,
-                      TIterator2 end2)
+  typename etl::enable_if<etl::private_arithmetic::has_kernel<T>::min_max, ETL_OR_STD::pair<T*, T*> >::type
+    minmax_element(T* begin, T* end)
   {
-    return std::is_permutation(begin1, end1, begin2, end2);
+    typedef typename etl::remove_cv<T>::type value_t;
+
+    value_t minimum = value_t();
+    value_t maximum = value_t();
+
+    if (begin == end)
+    {
+      return ETL_OR_STD::pair<T*, T*>(end, end);
+    }
+    else if (etl::private_arithmetic::min_max_values<true, true, value_t>(begin, end, minimum, maximum))
+    {
+      return ETL_OR_STD::pair<T*, T*>(etl::private_arithmetic::find(begin, end, minimum),
+                                      etl::private_arithmetic::find_last(begin, end, maximum));
+    }
+    else
+    {
+      return etl::minmax_element(begin, end, etl::less<value_t>());
+    }
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// is_permutation
+  /// minmax
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  template <typename T>
   ETL_NODISCARD
-  bool is_permutation(TIterator1       begin1,
-                      TIterator1       end1,
-                      TIterator2       begin2,
-                      TIterator2       end2,
-                      TBinaryPredicate predicate)
+  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
+                                              const T& b)
   {
-    return std::is_permutation(begin1, end1, begin2, end2, predicate);
+    return (b < a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
   }
-  #endif
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// is_partitioned
+  /// minmax
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename T, typename TCompare>
   ETL_NODISCARD
-  bool is_partitioned(TIterator       begin,
-                      TIterator       end,
-                      TUnaryPredicate predicate)
+  ETL_OR_STD::pair<const T&, const T&> minmax(const T& a,
+                                              const T& b,
+                                              TCompare compare)
   {
-    while (begin != end)
-    {
-      if (!predicate(*begin++))
-      {
-        break;
-      }
-    }
-
-    while (begin != end)
-    {
-      if (predicate(*begin++))
-      {
-        return false;
-      }
-    }
-
-    return true;
+    return compare(b, a) ? ETL_OR_STD::pair<const T&, const T&>(b, a) : ETL_OR_STD::pair<const T&, const T&>(a, b);
   }
 #else
   //***************************************************************************
-  /// is_partitioned
+  /// minmax
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename T>
   ETL_NODISCARD
-  bool is_partitioned(TIterator       begin,
-                      TIterator       end,
-                      TUnaryPredicate predicate)
+  std::pair<const T&, const T&> minmax(const T& a,
+                                       const T& b)
   {
-    return std::is_partitioned(begin, end, predicate);
+    return std::minmax(a, b);
   }
-#endif
-
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
-  //***************************************************************************
-  /// partition_point
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
-  ETL_NODISCARD
-  TIterator partition_point(TIterator       begin,
-                            TIterator       end,
-                            TUnaryPredicate predicate)
-  {
-    while (begin != end)
-    {
-      if (!predicate(*begin))
-      {
-        return begin;
-      }
 
-      ++begin;
-    }
-
-    return begin;
-  }
-#else
   //***************************************************************************
-  /// partition_point
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
+  /// minmax
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/minmax"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename T, typename TCompare>
   ETL_NODISCARD
-  TIterator partition_point(TIterator       begin,
-                            TIterator       end,
-                            TUnaryPredicate predicate)
+  std::pair<const T&, const T&> minmax(const T& a,
+                                       const T& b,
+                                       TCompare compare)
   {
-    return std::partition_point(begin, end, predicate);
+    return std::minmax(a, b, compare);
   }
 #endif
 
 #if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// Copies the elements from the range (begin, end) to two different ranges
-  /// depending on the value returned by the predicate.<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
+  /// is_sorted_until
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
-                                                                       TSource           end,
-                                                                       TDestinationTrue  destination_true,
-                                                                       TDestinationFalse destination_false,
-                                                                       TUnaryPredicate   predicate)
+  template <typename TIterator>
+  ETL_NODISCARD
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end)
   {
-    while (begin != end)
+    if (begin != end)
     {
-      if (predicate(*begin))
-      {
-        *destination_true++ = *begin++;
-      }
-      else
+      TIterator next = begin;
+
+      while (++next != end)
       {
-        *destination_false++ = *begin++;
+        if (*next < *begin)
+        {
+          return next;
+        }
+
+        ++begin;
       }
     }
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
-  }
-#else
-  //***************************************************************************
-  /// Copies the elements from the range (begin, end) to two different ranges
-  /// depending on the value returned by the predicate.<br>
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
-  std::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
-                                                                TSource           end,
-                                                                TDestinationTrue  destination_true,
-                                                                TDestinationFalse destination_false,
-                                                                TUnaryPredicate   predicate)
-  {
-    return std::partition_copy(begin, end, destination_true, destination_false, predicate);
+    return end;
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// copy_if
+  /// is_sorted_until
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
-  TOutputIterator copy_if(TIterator       begin,
-                          TIterator       end,
-                          TOutputIterator out,
-                          TUnaryPredicate predicate)
+  template <typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end,
+                            TCompare  compare)
   {
-    while (begin != end)
+    if (begin != end)
     {
-      if (predicate(*begin))
+      TIterator next = begin;
+
+      while (++next != end)
       {
-        *out++ = *begin;
-      }
+        if (compare(*next, *begin))
+        {
+          return next;
+        }
 
-      ++begin;
+        ++begin;
+      }
     }
 
-    return out;
+    return end;
   }
 #else
   //***************************************************************************
-  /// copy_if
+  /// is_sorted_until
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
-  TOutputIterator copy_if(TIterator       begin,
-                          TIterator       end,
-                          TOutputIterator out,
-                          TUnaryPredicate predicate)
+  template <typename TIterator>
+  ETL_NODISCARD
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end)
   {
-    return std::copy_if(begin, end, out, predicate);
+    return std::is_sorted_until(begin, end);
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// all_of
+  /// is_sorted_until
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted_until"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template <typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool all_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
+  TIterator is_sorted_until(TIterator begin,
+                            TIterator end,
+                            TCompare  compare)
   {
-    return etl::find_if_not(begin, end, predicate) == end;
+    return std::is_sorted_until(begin, end, compare);
   }
-#else
+#endif
+
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// all_of
+  /// is_sorted
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template<typename TIterator>
   ETL_NODISCARD
-  bool all_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
+  bool is_sorted(TIterator begin,
+                 TIterator end)
   {
-    return std::all_of(begin, end, predicate);
+    return etl::is_sorted_until(begin, end) == end;
   }
-#endif
 
-#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// any_of
+  /// is_sorted
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template<typename TIterator, typename TCompare>
   ETL_NODISCARD
-  bool any_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
+  bool is_sorted(TIterator begin,
+                 TIterator end,
+                 TCompare  compare)
   {
-    return etl::find_if(begin, end, predicate) != end;
+    return etl::is_sorted_until(begin, end, compare) == end;
   }
 #else
   //***************************************************************************
-  /// any_of
+  /// is_sorted
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
   //***************************************************************************
-  template <typename TIterator, typename TUnaryPredicate>
+  template<typename TIterator>
   ETL_NODISCARD
-  bool any_of(TIterator       begin,
-              TIterator       end,
-              TUnaryPredicate predicate)
+  bool is_sorted(TIterator begin,
+                 TIterator end)
   {
-    return std::any_of(begin, end, predicate);
+    return std::is_sorted(begin, end);
+  }
+
+  //***************************************************************************
+  /// is_sorted
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_sorted"></a>
+  //***************************************************************************
+  template<typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  bool is_sorted(TIterator begin,
+                 TIterator end,
+                 TCompare  compare)
+  {
+    return std::is_sorted(begin, end, compare);
   }
 #endif
 
 #if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// none_of
+  /// find_if_not
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
   //***************************************************************************
   template <typename TIterator, typename TUnaryPredicate>
   ETL_NODISCARD
-  bool none_of(TIterator       begin,
-               TIterator       end,
-               TUnaryPredicate predicate)
+  TIterator find_if_not(TIterator       begin,
+                        TIterator       end,
+                        TUnaryPredicate predicate)
   {
-    return etl::find_if(begin, end, predicate) == end;
+    while (begin != end)
+    {
+      if (!predicate(*begin))
+      {
+        return begin;
+      }
+
+      ++begin;
+    }
+
+    return end;
   }
 #else
   //***************************************************************************
-  /// none_of
+  /// find_if_not
   ///\ingroup algorithm
-  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/find"></a>
   //***************************************************************************
   template <typename TIterator, typename TUnaryPredicate>
   ETL_NODISCARD
-  bool none_of(TIterator       begin,
-               TIterator       end,
-               TUnaryPredicate predicate)
+  TIterator find_if_not(TIterator       begin,
+                        TIterator       end,
+                        TUnaryPredicate predicate)
   {
-    return std::none_of(begin, end, predicate);
+    return std::find_if_not(begin, end, predicate);
   }
 #endif
 
-#if ETL_NOT_USING_STL
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// Sorts the elements.
-  /// Uses user defined comparison.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2)
   {
-    etl::shell_sort(first, last, compare);
+    if (begin1 != end1)
+    {
+      TIterator2 end2 = begin2;
+
+      etl::advance(end2, etl::distance(begin1, end1));
+
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find(begin1, i, *i))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
   }
 
   //***************************************************************************
-  /// Sorts the elements.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator>
-  void sort(TIterator first, TIterator last)
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TBinaryPredicate predicate)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    if (begin1 != end1)
+    {
+      TIterator2 end2 = begin2;
+
+      etl::advance(end2, etl::distance(begin1, end1));
+
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
   }
 
   //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  /// Uses user defined comparison.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2,
+                      TIterator2 end2)
   {
-    etl::insertion_sort(first, last, compare);
+    if (begin1 != end1)
+    {
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find(begin1, i, *i))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
   }
 
   //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator>
-  void stable_sort(TIterator first, TIterator last)
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TIterator2       end2,
+                      TBinaryPredicate predicate)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    if (begin1 != end1)
+    {
+      for (TIterator1 i = begin1; i != end1; ++i)
+      {
+        if (i == etl::find_if(begin1, i, etl::bind1st(predicate, *i)))
+        {
+          size_t n = etl::count(begin2, end2, *i);
+
+          if (n == 0 || size_t(etl::count(i, end1, *i)) != n)
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
   }
 #else
   //***************************************************************************
-  /// Sorts the elements.
-  /// Uses user defined comparison.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2)
   {
-    std::sort(first, last, compare);
+    return std::is_permutation(begin1, end1, begin2);
   }
 
   //***************************************************************************
-  /// Sorts the elements.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator>
-  void sort(TIterator first, TIterator last)
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TBinaryPredicate predicate)
   {
-    std::sort(first, last);
+    return std::is_permutation(begin1, end1, begin2, predicate);
   }
 
+  #if ETL_CPP14_SUPPORTED
   //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
-  /// Uses user defined comparison.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1 begin1,
+                      TIterator1 end1,
+                      TIterator2 begin2,
+                      TIterator2 end2)
   {
-    std::stable_sort(first, last, compare);
+    return std::is_permutation(begin1, end1, begin2, end2);
   }
 
   //***************************************************************************
-  /// Sorts the elements.
-  /// Stable.
+  /// is_permutation
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_permutation"></a>
   //***************************************************************************
-  template <typename TIterator>
-  void stable_sort(TIterator first, TIterator last)
+  template <typename TIterator1, typename TIterator2, typename TBinaryPredicate>
+  ETL_NODISCARD
+  bool is_permutation(TIterator1       begin1,
+                      TIterator1       end1,
+                      TIterator2       begin2,
+                      TIterator2       end2,
+                      TBinaryPredicate predicate)
   {
-    std::stable_sort(first, last);
+    return std::is_permutation(begin1, end1, begin2, end2, predicate);
   }
+  #endif
 #endif
 
-#if ETL_NOT_USING_STL
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// Accumulates values.
+  /// is_partitioned
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
   //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool is_partitioned(TIterator       begin,
+                      TIterator       end,
+                      TUnaryPredicate predicate)
   {
-    while (first != last)
+    while (begin != end)
     {
-      sum = etl::move(sum) + *first++;
+      if (!predicate(*begin++))
+      {
+        break;
+      }
     }
-      
-    return sum;
-  }
 
-  //***************************************************************************
-  /// Accumulates values.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename T, typename TBinaryOperation>
-  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
-  {
-    while (first != last)
+    while (begin != end)
     {
-      sum = operation(etl::move(sum), *first++);
+      if (predicate(*begin++))
+      {
+        return false;
+      }
     }
 
-    return sum;
+    return true;
   }
 #else
   //***************************************************************************
-  /// Accumulates values.
+  /// is_partitioned
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/is_partitioned"></a>
   //***************************************************************************
-  template<typename TIterator, typename T>
-  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool is_partitioned(TIterator       begin,
+                      TIterator       end,
+                      TUnaryPredicate predicate)
   {
-    return std::accumulate(first, last, sum);
+    return std::is_partitioned(begin, end, predicate);
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// Accumulates values.
+  /// partition_point
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
   ///\ingroup algorithm
   //***************************************************************************
-  template<typename TIterator, typename T, typename TBinaryOperation>
-  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  TIterator partition_point(TIterator       begin,
+                            TIterator       end,
+                            TUnaryPredicate predicate)
   {
-    return std::accumulate(first, last, sum, operation);
-  }
-#endif
+    while (begin != end)
+    {
+      if (!predicate(*begin))
+      {
+        return begin;
+      }
+
+      ++begin;
+    }
 
+    return begin;
+  }
+#else
   //***************************************************************************
-  /// Clamp values.
+  /// partition_point
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_point"></a>
   ///\ingroup algorithm
   //***************************************************************************
-  template<typename T, typename TCompare>
-  ETL_CONSTEXPR const T& clamp(const T& value, const T& low, const T& high, TCompare compare)
-  {
-    return compare(value, low) ? low : compare(high, value) ? high : value;
-  }
-  
-  template <typename T>
-  ETL_CONSTEXPR const T& clamp(const T& value, const T& low, const T& high )
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  TIterator partition_point(TIterator       begin,
+                            TIterator       end,
+                            TUnaryPredicate predicate)
   {
-    return clamp(value, low, high, etl::less<T>());
+    return std::partition_point(begin, end, predicate);
   }
+#endif
 
-  #if ETL_NOT_USING_STL
-    //***************************************************************************
-    /// Remove
-    ///\ingroup algorithm
-    //***************************************************************************
-    template <typename TIterator, typename T>
-    TIterator remove(TIterator first, TIterator last, const T& value)
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
+  //***************************************************************************
+  /// Copies the elements from the range (begin, end) to two different ranges
+  /// depending on the value returned by the predicate.<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
+                                                                       TSource           end,
+                                                                       TDestinationTrue  destination_true,
+                                                                       TDestinationFalse destination_false,
+                                                                       TUnaryPredicate   predicate)
+  {
+    while (begin != end)
     {
-      first = etl::find(first, last, value);
-      
-      if (first != last)
+      if (predicate(*begin))
       {
-        TIterator itr = first;
-
-        while (itr != last)
-        {
-          if (!(*itr == value))
-          {
-            *first++ = etl::move(*itr);
-          }
-
-          ++itr;
-        }
+        *destination_true++ = *begin++;
       }
-      
-      return first;
-    }
-
-    //***************************************************************************
-    /// Remove If
-    ///\ingroup algorithm
-    //***************************************************************************
-    template <typename TIterator, typename TUnaryPredicate>
-    TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
-    {
-      first = etl::find_if(first, last, predicate);
-
-      if (first != last)
+      else
       {
-        TIterator itr = first;
-
-        while (itr != last)
-        {
-          if (!predicate(*itr))
-          {
-            *first++ = etl::move(*itr);
-          }
-
-          ++itr;
-        }
+        *destination_false++ = *begin++;
       }
-
-      return first;
-    }
-  #else
-    //***************************************************************************
-    /// Remove
-    ///\ingroup algorithm
-    //***************************************************************************
-    template <typename TIterator, typename T>
-    TIterator remove(TIterator first, TIterator last, const T& value)
-    {
-      return std::remove(first, last, value);
     }
 
-    //***************************************************************************
-    /// Remove If
-    ///\ingroup algorithm
-    //***************************************************************************
-    template <typename TIterator, typename TUnaryPredicate>
-    TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
-    {
-      return std::remove_if(first, last, predicate);
-    }
-  #endif
-}
-
-//*****************************************************************************
-// ETL extensions to the STL algorithms.
-//*****************************************************************************
-namespace etl
-{
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+#else
   //***************************************************************************
-  /// copy_s
-  /// A safer form of copy where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Copies the elements from the range (begin, end) to two different ranges
+  /// depending on the value returned by the predicate.<br>
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partition_copy"></a>
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator>
-  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
-                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-   copy_s(TInputIterator  i_begin,
-          TInputIterator  i_end,
-          TOutputIterator o_begin,
-          TOutputIterator o_end)
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse, typename TUnaryPredicate>
+  std::pair<TDestinationTrue, TDestinationFalse> partition_copy(TSource           begin,
+                                                                TSource           end,
+                                                                TDestinationTrue  destination_true,
+                                                                TDestinationFalse destination_false,
+                                                                TUnaryPredicate   predicate)
   {
-      size_t s_size = etl::distance(i_begin, i_end);
-      size_t d_size = etl::distance(o_begin, o_end);
-      size_t size   = (s_size < d_size) ? s_size : d_size;
-
-      return etl::copy(i_begin, i_begin + size, o_begin);
+    return std::partition_copy(begin, end, destination_true, destination_false, predicate);
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// copy
-  /// A safer form of copy where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// copy_if
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator>
-  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
-                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-   copy_s(TInputIterator  i_begin,
-          TInputIterator  i_end,
-          TOutputIterator o_begin,
-          TOutputIterator o_end)
+  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
+  TOutputIterator copy_if(TIterator       begin,
+                          TIterator       end,
+                          TOutputIterator out,
+                          TUnaryPredicate predicate)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    while (begin != end)
     {
-      *o_begin++ = *i_begin++;
+      if (predicate(*begin))
+      {
+        *out++ = *begin;
+      }
+
+      ++begin;
     }
 
-    return o_begin;
+    return out;
   }
-
+#else
   //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
+  /// copy_if
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/copy"></a>
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator>
-  TOutputIterator copy_n_s(TInputIterator  i_begin,
-                           TSize           n,
-                           TOutputIterator o_begin,
-                           TOutputIterator o_end)
+  template <typename TIterator, typename TOutputIterator, typename TUnaryPredicate>
+  TOutputIterator copy_if(TIterator       begin,
+                          TIterator       end,
+                          TOutputIterator out,
+                          TUnaryPredicate predicate)
   {
-    while ((n-- > 0) && (o_begin != o_end))
-    {
-      *o_begin++ = *i_begin++;
-    }
-
-    return o_begin;
+    return std::copy_if(begin, end, out, predicate);
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// copy_n
-  /// A safer form of copy_n where the smallest of the two ranges is used.
+  /// all_of
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize1,
-            typename TOutputIterator,
-            typename TSize2>
-  TOutputIterator copy_n_s(TInputIterator  i_begin,
-                           TSize1          n1,
-                           TOutputIterator o_begin,
-                           TSize2          n2)
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool all_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
   {
-    while ((n1-- > 0) && (n2-- > 0))
-    {
-      *o_begin++ = *i_begin++;
-    }
-
-    return o_begin;
+    return etl::find_if_not(begin, end, predicate) == end;
   }
-
+#else
   //***************************************************************************
-  /// copy_if
-  /// A safer form of copy_if where it terminates when the first end iterator is reached.
-  /// There is currently no STL equivelent.
+  /// all_of
   ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator,
-            typename TUnaryPredicate>
-  TOutputIterator copy_if_s(TInputIterator  i_begin,
-                            TInputIterator  i_end,
-                            TOutputIterator o_begin,
-                            TOutputIterator o_end,
-                            TUnaryPredicate predicate)
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool all_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
-    {
-      if (predicate(*i_begin))
-      {
-        *o_begin++ = *i_begin;
-      }
-
-      ++i_begin;
-    }
+    return std::all_of(begin, end, predicate);
+  }
+#endif
 
-    return o_begin;
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
+  //***************************************************************************
+  /// any_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool any_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
+  {
+    return etl::find_if(begin, end, predicate) != end;
+  }
+#else
+  //***************************************************************************
+  /// any_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool any_of(TIterator       begin,
+              TIterator       end,
+              TUnaryPredicate predicate)
+  {
+    return std::any_of(begin, end, predicate);
   }
+#endif
 
+#if ETL_NOT_USING_STL || ETL_CPP11_NOT_SUPPORTED
   //***************************************************************************
-  /// copy_n_if
-  /// Combination of copy_n and copy_if.
+  /// none_of
   ///\ingroup algorithm
-    //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryPredicate>
-  TOutputIterator copy_n_if(TInputIterator  i_begin,
-                            TSize           n,
-                            TOutputIterator o_begin,
-                            TUnaryPredicate predicate)
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool none_of(TIterator       begin,
+               TIterator       end,
+               TUnaryPredicate predicate)
   {
-    while (n-- > 0)
+    return etl::find_if(begin, end, predicate) == end;
+  }
+#else
+  //***************************************************************************
+  /// none_of
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/all_any_none_of"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TUnaryPredicate>
+  ETL_NODISCARD
+  bool none_of(TIterator       begin,
+               TIterator       end,
+               TUnaryPredicate predicate)
+  {
+    return std::none_of(begin, end, predicate);
+  }
+#endif
+
+  //***************************************************************************
+  namespace private_stable_sort
+  {
+    enum
     {
-      if (predicate(*i_begin))
+      // Ranges up to this size are sorted by insertion.
+      Insertion_Sort_Threshold = 16
+    };
+
+    //*************************************************************************
+    /// Stable insertion sort for random access iterators.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
       {
-        *o_begin++ = *i_begin;
+        return;
       }
 
-      ++i_begin;
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        TIterator sift   = itr;
+        TIterator sift_1 = itr - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_t value = private_algorithm::move_or_copy(*sift);
+
+          do
+          {
+            *sift-- = private_algorithm::move_or_copy(*sift_1);
+          } while ((sift != first) && compare(value, *--sift_1));
+
+          *sift = private_algorithm::move_or_copy(value);
+        }
+      }
     }
 
-    return o_begin;
+    //*************************************************************************
+    /// Merges two consecutive sorted ranges in to one sorted range.
+    /// The first range is moved to the buffer, then merged back with the
+    /// second. Anything left of the second range is already in place.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void merge_with_buffer(TIterator first, TIterator middle, TIterator last, TPointer buffer, TCompare compare)
+    {
+      const TPointer buffer_end = etl::move(first, middle, buffer);
+
+      TIterator output = first;
+
+      while (buffer != buffer_end)
+      {
+        if (middle == last)
+        {
+          etl::move(buffer, buffer_end, output);
+          return;
+        }
+
+        if (compare(*middle, *buffer))
+        {
+          *output++ = private_algorithm::move_or_copy(*middle++);
+        }
+        else
+        {
+          *output++ = private_algorithm::move_or_copy(*buffer++);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merge sort for random access iterators.
+    /// Merges use the buffer when the left half fits in it, otherwise they are
+    /// done in place by rotation.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void sort(TIterator first, TIterator last, TPointer buffer, size_t buffer_size, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      if (length <= difference_t(Insertion_Sort_Threshold))
+      {
+        private_stable_sort::insertion_sort(first, last, compare);
+        return;
+      }
+
+      const TIterator middle = first + (length / 2);
+
+      private_stable_sort::sort(first, middle, buffer, buffer_size, compare);
+      private_stable_sort::sort(middle, last, buffer, buffer_size, compare);
+
+      // The halves may already be in order.
+      if (!compare(*middle, *(middle - 1)))
+      {
+        return;
+      }
+
+      if (size_t(middle - first) <= buffer_size)
+      {
+        private_stable_sort::merge_with_buffer(first, middle, last, buffer, compare);
+      }
+      else
+      {
+        private_algorithm::merge_without_buffer(first, middle, last, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Random access iterators use the merge sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_without_buffer(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      private_stable_sort::sort(first, last, static_cast<value_t*>(0), 0U, compare);
+    }
+
+    //*************************************************************************
+    /// Other iterators are split by stepping through the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort_without_buffer(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = etl::distance(first, last);
+
+      // Short ranges are faster by insertion.
+      if (length <= difference_t(Insertion_Sort_Threshold))
+      {
+        etl::insertion_sort(first, last, compare);
+      }
+      else
+      {
+        TIterator middle = first;
+        etl::advance(middle, length / 2);
+
+        private_stable_sort::sort_without_buffer(first, middle, compare);
+        private_stable_sort::sort_without_buffer(middle, last, compare);
+        private_algorithm::merge_without_buffer(first, middle, last, compare);
+      }
+    }
   }
 
-#if ETL_CPP11_SUPPORTED
+#if ETL_NOT_USING_STL
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Sorts the elements.
+  /// Random access iterators are sorted with pdq_sort, others with shell_sort.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-  typename TOutputIterator>
-  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
-                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-  move_s(TInputIterator  i_begin,
-         TInputIterator  i_end,
-         TOutputIterator o_begin,
-         TOutputIterator o_end)
+  template <typename TIterator, typename TCompare>
+  typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+    sort(TIterator first, TIterator last, TCompare compare)
   {
-    size_t s_size = etl::distance(i_begin, i_end);
-    size_t d_size = etl::distance(o_begin, o_end);
-    size_t size = (s_size < d_size) ? s_size : d_size;
-
-    return etl::move(i_begin, i_begin + size, o_begin);
+    etl::pdq_sort(first, last, compare);
   }
 
   //***************************************************************************
-  /// move_s
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Sorts the elements.
+  /// Random access iterators are sorted with pdq_sort, others with shell_sort.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-  typename TOutputIterator>
-  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
-                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
-  move_s(TInputIterator  i_begin,
-         TInputIterator  i_end,
-         TOutputIterator o_begin,
-         TOutputIterator o_end)
+  template <typename TIterator, typename TCompare>
+  typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+    sort(TIterator first, TIterator last, TCompare compare)
   {
-    while ((i_begin != i_end) && (o_begin != o_end))
-    {
-      *o_begin++ = etl::move(*i_begin++);
-    }
-
-    return o_begin;
+    etl::shell_sort(first, last, compare);
   }
-#else
+
   //***************************************************************************
-  /// move_s
-  /// C++03
-  /// A safer form of move where the smallest of the two ranges is used.
-  /// There is currently no STL equivalent.
-  /// Specialisation for non random access iterators.
-  ///\param i_begin Beginning of the input range.
-  ///\param i_end   End of the input range.
-  ///\param o_begin Beginning of the output range.
-  ///\param o_end   End of the output range.
+  /// Sorts the elements.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator>
-  TOutputIterator move_s(TInputIterator  i_begin,
-                         TInputIterator  i_end,
-                         TOutputIterator o_begin,
-                         TOutputIterator o_end)
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
   {
-    // Move not supported. Defer to copy.
-    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
-#endif
 
   //***************************************************************************
-  /// binary_find
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not found.
   //***************************************************************************
-  template <typename TIterator, typename TValue>
-  ETL_NODISCARD
-  TIterator binary_find(TIterator     begin,
-                        TIterator     end,
-                        const TValue& value)
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    TIterator it = etl::lower_bound(begin, end, value);
-
-    if ((it == end) || (*it != value))
-    {
-      it = end;
-    }
-
-    return it;
+    private_stable_sort::sort_without_buffer(first, last, compare);
   }
 
   //***************************************************************************
-  /// binary_find
+  /// Sorts the elements.
+  /// Stable.
   ///\ingroup algorithm
-  /// Does a binary search and returns an iterator to the value or end if not found.
   //***************************************************************************
-  template <typename TIterator,
-            typename TValue,
-            typename TBinaryPredicate,
-            typename TBinaryEquality>
-  ETL_NODISCARD
-  TIterator binary_find(TIterator        begin,
-                        TIterator        end,
-                        const TValue&    value,
-                        TBinaryPredicate predicate,
-                        TBinaryEquality  equality)
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
   {
-    TIterator it = etl::lower_bound(begin, end, value, predicate);
-
-    if ((it == end) || !equality(*it, value))
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+#else
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    std::sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    std::sort(first, last);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    std::stable_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    std::stable_sort(first, last);
+  }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable. Merge sort using the buffer, without heap allocation.
+  /// A buffer of half the length of the range gives O(NlogN). Merges that do
+  /// not fit in a smaller buffer are done in place.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t EXTENT, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, EXTENT> buffer, TCompare compare)
+  {
+    private_stable_sort::sort(first, last, buffer.data(), buffer.size(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable. Merge sort using the buffer, without heap allocation.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t EXTENT>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, EXTENT> buffer)
+  {
+    etl::stable_sort(first, last, buffer, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+#endif
+
+#if ETL_NOT_USING_STL
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  {
+    while (first != last)
+    {
+      sum = etl::move(sum) + *first++;
+    }
+      
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
+  {
+    while (first != last)
+    {
+      sum = operation(etl::move(sum), *first++);
+    }
+
+    return sum;
+  }
+#else
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template<typename TIterator, typename T>
+  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  {
+    return std::accumulate(first, last, sum);
+  }
+
+  //***************************************************************************
+  /// Accumulates values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template<typename TIterator, typename T, typename TBinaryOperation>
+  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum, TBinaryOperation operation)
+  {
+    return std::accumulate(first, last, sum, operation);
+  }
+#endif
+
+#if ETL_ARITHMETIC_SIMD
+  //***************************************************************************
+  /// Accumulates values.
+  /// Contiguous ranges of integers are summed a vector at a time.
+  /// Floating point ranges are not, as that would change the rounding.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+  typename etl::enable_if<etl::is_integral<T>::value && etl::private_arithmetic::has_kernel<T>::sum, T>::type
+    accumulate(const T* first, const T* last, T sum)
+  {
+  #if ETL_CPP14_SUPPORTED && !defined(ETL_FORCE_NO_ADVANCED_CPP)
+    if (__builtin_is_constant_evaluated())
+    {
+      while (first != last)
+      {
+        sum = T(sum + *first++);
+      }
+
+      return sum;
+    }
+  #endif
+
+    return T(sum + etl::private_arithmetic::sum(first, last));
+  }
+#endif
+
+  //***************************************************************************
+  /// Clamp values.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template<typename T, typename TCompare>
+  ETL_CONSTEXPR const T& clamp(const T& value, const T& low, const T& high, TCompare compare)
+  {
+    return compare(value, low) ? low : compare(high, value) ? high : value;
+  }
+  
+  template <typename T>
+  ETL_CONSTEXPR const T& clamp(const T& value, const T& low, const T& high )
+  {
+    return clamp(value, low, high, etl::less<T>());
+  }
+
+  #if ETL_NOT_USING_STL
+    //***************************************************************************
+    /// Remove
+    ///\ingroup algorithm
+    //***************************************************************************
+    template <typename TIterator, typename T>
+    TIterator remove(TIterator first, TIterator last, const T& value)
+    {
+      first = etl::find(first, last, value);
+      
+      if (first != last)
+      {
+        TIterator itr = first;
+
+        while (itr != last)
+        {
+          if (!(*itr == value))
+          {
+            *first++ = etl::move(*itr);
+          }
+
+          ++itr;
+        }
+      }
+      
+      return first;
+    }
+
+    //***************************************************************************
+    /// Remove If
+    ///\ingroup algorithm
+    //***************************************************************************
+    template <typename TIterator, typename TUnaryPredicate>
+    TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+    {
+      first = etl::find_if(first, last, predicate);
+
+      if (first != last)
+      {
+        TIterator itr = first;
+
+        while (itr != last)
+        {
+          if (!predicate(*itr))
+          {
+            *first++ = etl::move(*itr);
+          }
+
+          ++itr;
+        }
+      }
+
+      return first;
+    }
+  #else
+    //***************************************************************************
+    /// Remove
+    ///\ingroup algorithm
+    //***************************************************************************
+    template <typename TIterator, typename T>
+    TIterator remove(TIterator first, TIterator last, const T& value)
+    {
+      return std::remove(first, last, value);
+    }
+
+    //***************************************************************************
+    /// Remove If
+    ///\ingroup algorithm
+    //***************************************************************************
+    template <typename TIterator, typename TUnaryPredicate>
+    TIterator remove_if(TIterator first, TIterator last, TUnaryPredicate predicate)
+    {
+      return std::remove_if(first, last, predicate);
+    }
+  #endif
+}
+
+//*****************************************************************************
+// ETL extensions to the STL algorithms.
+//*****************************************************************************
+namespace etl
+{
+  //***************************************************************************
+  /// copy_s
+  /// A safer form of copy where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
+                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+   copy_s(TInputIterator  i_begin,
+          TInputIterator  i_end,
+          TOutputIterator o_begin,
+          TOutputIterator o_end)
+  {
+      size_t s_size = etl::distance(i_begin, i_end);
+      size_t d_size = etl::distance(o_begin, o_end);
+      size_t size   = (s_size < d_size) ? s_size : d_size;
+
+      return etl::copy(i_begin, i_begin + size, o_begin);
+  }
+
+  //***************************************************************************
+  /// copy
+  /// A safer form of copy where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
+                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+   copy_s(TInputIterator  i_begin,
+          TInputIterator  i_end,
+          TOutputIterator o_begin,
+          TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin++ = *i_begin++;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator>
+  TOutputIterator copy_n_s(TInputIterator  i_begin,
+                           TSize           n,
+                           TOutputIterator o_begin,
+                           TOutputIterator o_end)
+  {
+    while ((n-- > 0) && (o_begin != o_end))
+    {
+      *o_begin++ = *i_begin++;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n
+  /// A safer form of copy_n where the smallest of the two ranges is used.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize1,
+            typename TOutputIterator,
+            typename TSize2>
+  TOutputIterator copy_n_s(TInputIterator  i_begin,
+                           TSize1          n1,
+                           TOutputIterator o_begin,
+                           TSize2          n2)
+  {
+    while ((n1-- > 0) && (n2-- > 0))
+    {
+      *o_begin++ = *i_begin++;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_if
+  /// A safer form of copy_if where it terminates when the first end iterator is reached.
+  /// There is currently no STL equivelent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator,
+            typename TUnaryPredicate>
+  TOutputIterator copy_if_s(TInputIterator  i_begin,
+                            TInputIterator  i_end,
+                            TOutputIterator o_begin,
+                            TOutputIterator o_end,
+                            TUnaryPredicate predicate)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin++ = *i_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// copy_n_if
+  /// Combination of copy_n and copy_if.
+  ///\ingroup algorithm
+    //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryPredicate>
+  TOutputIterator copy_n_if(TInputIterator  i_begin,
+                            TSize           n,
+                            TOutputIterator o_begin,
+                            TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin++ = *i_begin;
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+  typename TOutputIterator>
+  typename etl::enable_if<etl::is_random_iterator<TInputIterator>::value &&
+                          etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+  move_s(TInputIterator  i_begin,
+         TInputIterator  i_end,
+         TOutputIterator o_begin,
+         TOutputIterator o_end)
+  {
+    size_t s_size = etl::distance(i_begin, i_end);
+    size_t d_size = etl::distance(o_begin, o_end);
+    size_t size = (s_size < d_size) ? s_size : d_size;
+
+    return etl::move(i_begin, i_begin + size, o_begin);
+  }
+
+  //***************************************************************************
+  /// move_s
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+  typename TOutputIterator>
+  typename etl::enable_if<!etl::is_random_iterator<TInputIterator>::value ||
+                          !etl::is_random_iterator<TOutputIterator>::value, TOutputIterator>::type
+  move_s(TInputIterator  i_begin,
+         TInputIterator  i_end,
+         TOutputIterator o_begin,
+         TOutputIterator o_end)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin++ = etl::move(*i_begin++);
+    }
+
+    return o_begin;
+  }
+#else
+  //***************************************************************************
+  /// move_s
+  /// C++03
+  /// A safer form of move where the smallest of the two ranges is used.
+  /// There is currently no STL equivalent.
+  /// Specialisation for non random access iterators.
+  ///\param i_begin Beginning of the input range.
+  ///\param i_end   End of the input range.
+  ///\param o_begin Beginning of the output range.
+  ///\param o_end   End of the output range.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator move_s(TInputIterator  i_begin,
+                         TInputIterator  i_end,
+                         TOutputIterator o_begin,
+                         TOutputIterator o_end)
+  {
+    // Move not supported. Defer to copy.
+    return etl::copy_s(i_begin, i_end, o_begin, o_end);
+  }
+#endif
+
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not found.
+  //***************************************************************************
+  template <typename TIterator, typename TValue>
+  ETL_NODISCARD
+  TIterator binary_find(TIterator     begin,
+                        TIterator     end,
+                        const TValue& value)
+  {
+    TIterator it = etl::lower_bound(begin, end, value);
+
+    if ((it == end) || (*it != value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// binary_find
+  ///\ingroup algorithm
+  /// Does a binary search and returns an iterator to the value or end if not found.
+  //***************************************************************************
+  template <typename TIterator,
+            typename TValue,
+            typename TBinaryPredicate,
+            typename TBinaryEquality>
+  ETL_NODISCARD
+  TIterator binary_find(TIterator        begin,
+                        TIterator        end,
+                        const TValue&    value,
+                        TBinaryPredicate predicate,
+                        TBinaryEquality  equality)
+  {
+    TIterator it = etl::lower_bound(begin, end, value, predicate);
+
+    if ((it == end) || !equality(*it, value))
+    {
+      it = end;
+    }
+
+    return it;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  TUnaryFunction for_each_if(TIterator       begin,
+                             const TIterator end,
+                             TUnaryFunction  function,
+                             TUnaryPredicate predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
+
+    return function;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but for 'n' iterations.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TSize,
+            typename TUnaryFunction>
+  TIterator for_each_n(TIterator       begin,
+                       TSize           n,
+                       TUnaryFunction  function)
+  {
+    while (n-- > 0)
+    {
+      function(*begin++);
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// Like std::for_each but applies a predicate before calling the function, for 'n' iterations
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator,
+            typename TSize,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  TIterator for_each_n_if(TIterator       begin,
+                          TSize           n,
+                          TUnaryFunction  function,
+                          TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*begin))
+      {
+        function(*begin);
+      }
+
+      ++begin;
+    }
+
+    return begin;
+  }
+
+  //***************************************************************************
+  /// A safer form of std::transform where the transform returns when the first
+  /// range end is reached.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
+  TOutputIterator transform_s(TInputIterator  i_begin,
+                              TInputIterator  i_end,
+                              TOutputIterator o_begin,
+                              TOutputIterator o_end,
+                              TUnaryFunction  function)
+  {
+    while ((i_begin != i_end) && (o_begin != o_end))
+    {
+      *o_begin++ = function(*i_begin++);
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Transform 'n' items.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryFunction>
+  void transform_n(TInputIterator  i_begin,
+                   TSize           n,
+                   TOutputIterator o_begin,
+                   TUnaryFunction  function)
+  {
+    TInputIterator i_end(i_begin);
+    etl::advance(i_end, n);
+
+    etl::transform(i_begin, i_end, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Transform 'n' items from two ranges.
+  /// Random iterators.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TSize,
+            typename TOutputIterator,
+            typename TBinaryFunction>
+  void transform_n(TInputIterator1 i_begin1,
+                   TInputIterator2 i_begin2,
+                   TSize           n,
+                   TOutputIterator o_begin,
+                   TBinaryFunction function)
+  {
+    TInputIterator1 i_end1(i_begin1);
+    etl::advance(i_end1, n);
+
+    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
+  }
+
+  //***************************************************************************
+  /// Like std::transform but applies a predicate before calling the function.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  TOutputIterator transform_if(TInputIterator       i_begin,
+                               const TInputIterator i_end,
+                               TOutputIterator      o_begin,
+                               TUnaryFunction       function,
+                               TUnaryPredicate      predicate)
+  {
+    while (i_begin != i_end)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin++ = function(*i_begin);
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like etl::transform_if but inputs from two ranges.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TOutputIterator,
+            typename TBinaryFunction,
+            typename TBinaryPredicate>
+  TOutputIterator transform_if(TInputIterator1       i_begin1,
+                               const TInputIterator1 i_end1,
+                               TInputIterator2       i_begin2,
+                               TOutputIterator       o_begin,
+                               TBinaryFunction       function,
+                               TBinaryPredicate      predicate)
+  {
+    while (i_begin1 != i_end1)
+    {
+      if (predicate(*i_begin1, *i_begin2))
+      {
+        *o_begin++ = function(*i_begin1, *i_begin2);
+      }
+
+      ++i_begin1;
+      ++i_begin2;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like std::transform_if, for 'n' items.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TSize,
+            typename TOutputIterator,
+            typename TUnaryFunction,
+            typename TUnaryPredicate>
+  TOutputIterator transform_n_if(TInputIterator  i_begin,
+                                 TSize           n,
+                                 TOutputIterator o_begin,
+                                 TUnaryFunction  function,
+                                 TUnaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin))
+      {
+        *o_begin++ = function(*i_begin);
+      }
+
+      ++i_begin;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Like etl::transform_if but inputs from two ranges for 'n' items.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator1,
+            typename TInputIterator2,
+            typename TSize,
+            typename TOutputIterator,
+            typename TBinaryFunction,
+            typename TBinaryPredicate>
+  TOutputIterator transform_n_if(TInputIterator1  i_begin1,
+                                 TInputIterator2  i_begin2,
+                                 TSize            n,
+                                 TOutputIterator  o_begin,
+                                 TBinaryFunction  function,
+                                 TBinaryPredicate predicate)
+  {
+    while (n-- > 0)
+    {
+      if (predicate(*i_begin1, *i_begin2))
+      {
+        *o_begin++ = function(*i_begin1, *i_begin2);
+      }
+
+      ++i_begin1;
+      ++i_begin2;
+    }
+
+    return o_begin;
+  }
+
+  //***************************************************************************
+  /// Transforms the elements from the range (begin, end) to two different ranges
+  /// depending on the value returned by the predicate.<br>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse,
+            typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
+            typename TUnaryPredicate>
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource             begin,
+                                                                            TSource             end,
+                                                                            TDestinationTrue    destination_true,
+                                                                            TDestinationFalse   destination_false,
+                                                                            TUnaryFunctionTrue  function_true,
+                                                                            TUnaryFunctionFalse function_false,
+                                                                            TUnaryPredicate     predicate)
+  {
+    while (begin != end)
+    {
+      if (predicate(*begin))
+      {
+        *destination_true++ = function_true(*begin++);
+      }
+      else
+      {
+        *destination_false++ = function_false(*begin++);
+      }
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
+  /// to two different ranges depending on the value returned by the predicate.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TSource1,
+            typename TSource2,
+            typename TDestinationTrue,
+            typename TDestinationFalse,
+            typename TBinaryFunctionTrue,
+            typename TBinaryFunctionFalse,
+            typename TBinaryPredicate>
+  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource1             begin1,
+                                                                            TSource1             end1,
+                                                                            TSource2             begin2,
+                                                                            TDestinationTrue     destination_true,
+                                                                            TDestinationFalse    destination_false,
+                                                                            TBinaryFunctionTrue  function_true,
+                                                                            TBinaryFunctionFalse function_false,
+                                                                            TBinaryPredicate     predicate)
+  {
+    while (begin1 != end1)
+    {
+      if (predicate(*begin1, *begin2))
+      {
+        *destination_true++ = function_true(*begin1++, *begin2++);
+      }
+      else
+      {
+        *destination_false++ = function_false(*begin1++, *begin2++);
+      }
+    }
+
+    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using shell sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void shell_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (first == last)
+    {
+      return;
+    }
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t n = etl::distance(first, last);
+
+    for (difference_t i = n / 2; i > 0; i /= 2)
+    {
+      for (difference_t j = i; j < n; ++j)
+      {
+        for (difference_t k = j - i; k >= 0; k -= i)
+        {
+          TIterator itr1 = first;
+          TIterator itr2 = first;
+
+          etl::advance(itr1, k);
+          etl::advance(itr2, k + i);
+
+          if (compare(*itr2, *itr1))
+          {
+            etl::iter_swap(itr1, itr2);
+          }
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using shell sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void shell_sort(TIterator first, TIterator last)
+  {
+    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using insertion sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void insertion_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using insertion sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void insertion_sort(TIterator first, TIterator last)
+  {
+    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator first_, TIterator last_)
     {
-      it = end;
+      TIterator last      = first_;
+      TIterator lastplus1 = first_;
+      ++lastplus1;
+
+      while (lastplus1 != last_)
+      {
+        ++last;
+        ++lastplus1;
+      }
+
+      return last;
+    }
+
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator /*first_*/, TIterator last_)
+    {
+      TIterator last = last_;
+      --last;
+
+      return last;
+    }
+
+    template <typename TIterator>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
+      get_before_last(TIterator /*first_*/, TIterator last_)
+    {
+      return last_ - 1;
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using selection sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void selection_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    TIterator min;
+    const TIterator ilast = private_algorithm::get_before_last(first, last);
+    const TIterator jlast = last;
+
+    for (TIterator i = first; i != ilast; ++i)
+    {
+      min = i;
+      
+      TIterator j = i;
+      ++j;
+
+      for (; j != jlast; ++j)
+      {
+        if (compare(*j, *min))
+        {
+          min = j;
+        }
+      }
+
+      using ETL_OR_STD::swap; // Allow ADL
+      swap(*i, *min);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using selection sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void selection_sort(TIterator first, TIterator last)
+  {
+    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using heap sort.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare >
+  void heap_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (!etl::is_heap(first, last, compare))
+    {
+      etl::make_heap(first, last, compare);
+    }
+
+    etl::sort_heap(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using heap sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void heap_sort(TIterator first, TIterator last)
+  {
+    if (!etl::is_heap(first, last))
+    {
+      etl::make_heap(first, last);
+    }
+
+    etl::sort_heap(first, last);
+  }
+
+  //***************************************************************************
+  namespace private_pdq_sort
+  {
+    enum
+    {
+      // Partitions below this size are sorted by insertion.
+      Insertion_Sort_Threshold = 24,
+
+      // Partitions above this size use the pseudo median of nine as the pivot.
+      Ninther_Threshold = 128,
+
+      // The number of moves allowed before a partial insertion sort gives up.
+      Partial_Insertion_Sort_Limit = 8
+    };
+
+    //*************************************************************************
+    /// Insertion sort.
+    /// If 'guarded' is false then *(first - 1) must not be greater than any
+    /// element in the range, and it is used as the sentinel.
+    /// If 'limit' is reached the sort gives up and returns false.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool insertion_sort(TIterator first, TIterator last, TCompare compare, bool guarded, size_t limit)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      size_t moves = 0U;
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        TIterator sift   = itr;
+        TIterator sift_1 = itr - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_t value = private_algorithm::move_or_copy(*sift);
+
+          do
+          {
+            *sift-- = private_algorithm::move_or_copy(*sift_1);
+          } while ((!guarded || (sift != first)) && compare(value, *--sift_1));
+
+          *sift = private_algorithm::move_or_copy(value);
+          moves += size_t(itr - sift);
+
+          if (moves > limit)
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sorts three elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+
+      if (compare(*c, *b))
+      {
+        etl::iter_swap(b, c);
+
+        if (compare(*b, *a))
+        {
+          etl::iter_swap(a, b);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at *first, with elements equal to the
+    /// pivot going to the right. Returns the final position of the pivot.
+    /// 'already_partitioned' is set if no elements were swapped.
+    /// The range must contain an element that is not less than the pivot,
+    /// which the median selection guarantees.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_right(TIterator first, TIterator last, TCompare compare, bool& already_partitioned)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = private_algorithm::move_or_copy(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(*++left, pivot))
+      {
+      }
+
+      // If nothing was less than the pivot, there may be nothing to stop the search from the right.
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      already_partitioned = (left >= right);
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(*++left, pivot))
+        {
+        }
+
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = left - 1;
+      *first          = private_algorithm::move_or_copy(*pivot_position);
+      *pivot_position = private_algorithm::move_or_copy(pivot);
+
+      return pivot_position;
+    }
+
+    //*************************************************************************
+    /// Partitions around the pivot at *first, with elements equal to the
+    /// pivot going to the left. Used when the pivot is equal to the element
+    /// before the range, as every element on the left is then equal.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = private_algorithm::move_or_copy(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(pivot, *--right))
+      {
+      }
+
+      if ((right + 1) == last)
+      {
+        while ((left < right) && !compare(pivot, *++left))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(pivot, *--right))
+        {
+        }
+
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      *first = private_algorithm::move_or_copy(*right);
+      *right = private_algorithm::move_or_copy(pivot);
+
+      return right;
+    }
+
+    //*************************************************************************
+    /// The fallback when partitioning keeps going badly.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::private_heap::make_heap(first, last, compare);
+      etl::private_heap::sort_heap(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Swaps some elements into new positions, to break up patterns that
+    /// caused an unbalanced partition.
+    //*************************************************************************
+    template <typename TIterator, typename TDifference>
+    void break_patterns(TIterator first, TIterator last, TDifference size)
+    {
+      if (size >= TDifference(Insertion_Sort_Threshold))
+      {
+        const TDifference quarter = size / 4;
+
+        etl::iter_swap(first, first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (size > TDifference(Ninther_Threshold))
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2,  last - (quarter + 1));
+          etl::iter_swap(last - 3,  last - (quarter + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the range.
+    /// Only the smaller partition is sorted recursively, so the depth of
+    /// recursion is never more than log2 of the size of the range.
+    /// 'bad_allowed' is the number of unbalanced partitions allowed before
+    /// switching to heap sort.
+    /// 'leftmost' is false if *(first - 1) is not greater than any element in
+    /// the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const difference_t size = last - first;
+
+        if (size < difference_t(Insertion_Sort_Threshold))
+        {
+          private_pdq_sort::insertion_sort(first, last, compare, leftmost, ~size_t(0U));
+          return;
+        }
+
+        // Select the pivot and move it to the start.
+        const difference_t half = size / 2;
+
+        if (size > difference_t(Ninther_Threshold))
+        {
+          private_pdq_sort::sort3(first,              first + half,       last - 1, compare);
+          private_pdq_sort::sort3(first + 1,          first + (half - 1), last - 2, compare);
+          private_pdq_sort::sort3(first + 2,          first + (half + 1), last - 3, compare);
+          private_pdq_sort::sort3(first + (half - 1), first + half,       first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          private_pdq_sort::sort3(first + half, first, last - 1, compare);
+        }
+
+        // A pivot equal to the element before the range means that many elements are equal.
+        // Put them all on the left, where they are already sorted.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = private_pdq_sort::partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        bool already_partitioned;
+        TIterator pivot_position = private_pdq_sort::partition_right(first, last, compare, already_partitioned);
+
+        const difference_t left_size  = pivot_position - first;
+        const difference_t right_size = last - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          if (--bad_allowed == 0)
+          {
+            private_pdq_sort::heap_sort(first, last, compare);
+            return;
+          }
+
+          private_pdq_sort::break_patterns(first, pivot_position, left_size);
+          private_pdq_sort::break_patterns(pivot_position + 1, last, right_size);
+        }
+        else if (already_partitioned &&
+                 private_pdq_sort::insertion_sort(first, pivot_position, compare, leftmost, size_t(Partial_Insertion_Sort_Limit)) &&
+                 private_pdq_sort::insertion_sort(pivot_position + 1, last, compare, false, size_t(Partial_Insertion_Sort_Limit)))
+        {
+          // The range was already, or nearly, sorted.
+          return;
+        }
+
+        if (left_size < right_size)
+        {
+          private_pdq_sort::sort(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          private_pdq_sort::sort(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
     }
-
-    return it;
   }
 
   //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function.
+  /// Sorts the elements using pattern-defeating quicksort.
+  /// O(n log n) worst case, and linear for sorted and reverse sorted input.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  TUnaryFunction for_each_if(TIterator       begin,
-                             const TIterator end,
-                             TUnaryFunction  function,
-                             TUnaryPredicate predicate)
+  template <typename TIterator, typename TCompare>
+  void pdq_sort(TIterator first, TIterator last, TCompare compare)
   {
-    while (begin != end)
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t size = last - first;
+
+    if (size < 2)
     {
-      if (predicate(*begin))
-      {
-        function(*begin);
-      }
+      return;
+    }
 
-      ++begin;
+    int bad_allowed = 0;
+
+    while ((size >>= 1) != 0)
+    {
+      ++bad_allowed;
     }
 
-    return function;
+    private_pdq_sort::sort(first, last, compare, bad_allowed, true);
   }
 
   //***************************************************************************
-  /// Like std::for_each but for 'n' iterations.
+  /// Sorts the elements using pattern-defeating quicksort.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator,
-            typename TSize,
-            typename TUnaryFunction>
-  TIterator for_each_n(TIterator       begin,
-                       TSize           n,
-                       TUnaryFunction  function)
+  template <typename TIterator>
+  void pdq_sort(TIterator first, TIterator last)
   {
-    while (n-- > 0)
-    {
-      function(*begin++);
-    }
-
-    return begin;
+    etl::pdq_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Like std::for_each but applies a predicate before calling the function, for 'n' iterations
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator,
-            typename TSize,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  TIterator for_each_n_if(TIterator       begin,
-                          TSize           n,
-                          TUnaryFunction  function,
-                          TUnaryPredicate predicate)
+  namespace private_radix_sort
   {
-    while (n-- > 0)
+    //*************************************************************************
+    /// Uses the value as the key.
+    //*************************************************************************
+    template <typename T>
+    struct value_key
     {
-      if (predicate(*begin))
+      T operator()(const T& value) const
       {
-        function(*begin);
+        return value;
       }
+    };
+
+    //*************************************************************************
+    /// Maps a signed key to an unsigned key with the same order.
+    //*************************************************************************
+    template <typename TKey>
+    typename etl::enable_if<etl::is_signed<TKey>::value, typename etl::make_unsigned<TKey>::type>::type
+      to_unsigned(TKey key)
+    {
+      typedef typename etl::make_unsigned<TKey>::type unsigned_t;
 
-      ++begin;
+      // Flip the sign bit, so that negative keys come first.
+      return unsigned_t(unsigned_t(key) ^ unsigned_t(unsigned_t(1U) << ((sizeof(TKey) * CHAR_BIT) - 1U)));
     }
 
-    return begin;
-  }
-
-  //***************************************************************************
-  /// A safer form of std::transform where the transform returns when the first
-  /// range end is reached.
-  /// There is currently no STL equivalent.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator, typename TOutputIterator, typename TUnaryFunction>
-  TOutputIterator transform_s(TInputIterator  i_begin,
-                              TInputIterator  i_end,
-                              TOutputIterator o_begin,
-                              TOutputIterator o_end,
-                              TUnaryFunction  function)
-  {
-    while ((i_begin != i_end) && (o_begin != o_end))
+    //*************************************************************************
+    /// Unsigned keys are used as they are.
+    //*************************************************************************
+    template <typename TKey>
+    typename etl::enable_if<!etl::is_signed<TKey>::value, TKey>::type
+      to_unsigned(TKey key)
     {
-      *o_begin++ = function(*i_begin++);
+      return key;
     }
 
-    return o_begin;
-  }
+    //*************************************************************************
+    /// Returns one digit of the key of an element.
+    //*************************************************************************
+    template <typename TKeyExtractor, typename TUnsigned>
+    struct radix_digit
+    {
+      radix_digit(TKeyExtractor key_, size_t shift_, TUnsigned mask_)
+        : key(key_)
+        , shift(shift_)
+        , mask(mask_)
+      {
+      }
 
-  //***************************************************************************
-  /// Transform 'n' items.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryFunction>
-  void transform_n(TInputIterator  i_begin,
-                   TSize           n,
-                   TOutputIterator o_begin,
-                   TUnaryFunction  function)
-  {
-    TInputIterator i_end(i_begin);
-    etl::advance(i_end, n);
+      template <typename T>
+      size_t operator()(const T& value) const
+      {
+        return size_t((private_radix_sort::to_unsigned(key(value)) >> shift) & mask);
+      }
 
-    etl::transform(i_begin, i_end, o_begin, function);
-  }
+      TKeyExtractor key;
+      size_t        shift;
+      TUnsigned     mask;
+    };
 
-  //***************************************************************************
-  /// Transform 'n' items from two ranges.
-  /// Random iterators.
-  /// There is currently no STL equivalent.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TSize,
-            typename TOutputIterator,
-            typename TBinaryFunction>
-  void transform_n(TInputIterator1 i_begin1,
-                   TInputIterator2 i_begin2,
-                   TSize           n,
-                   TOutputIterator o_begin,
-                   TBinaryFunction function)
-  {
-    TInputIterator1 i_end1(i_begin1);
-    etl::advance(i_end1, n);
+    //*************************************************************************
+    /// Returns the key of an element, for counting sort.
+    //*************************************************************************
+    template <typename TKeyExtractor>
+    struct counting_digit
+    {
+      explicit counting_digit(TKeyExtractor key_)
+        : key(key_)
+      {
+      }
 
-    etl::transform(i_begin1, i_end1, i_begin2, o_begin, function);
-  }
+      template <typename T>
+      size_t operator()(const T& value) const
+      {
+        return size_t(key(value));
+      }
 
-  //***************************************************************************
-  /// Like std::transform but applies a predicate before calling the function.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator,
-            typename TOutputIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  TOutputIterator transform_if(TInputIterator       i_begin,
-                               const TInputIterator i_end,
-                               TOutputIterator      o_begin,
-                               TUnaryFunction       function,
-                               TUnaryPredicate      predicate)
-  {
-    while (i_begin != i_end)
+      TKeyExtractor key;
+    };
+
+    //*************************************************************************
+    /// Moves the elements to the destination, ordered by digit. Stable.
+    //*************************************************************************
+    template <typename TSource, typename TDestination, typename TDigit>
+    void scatter(TSource first, TSource last, TDestination destination, TDigit digit, size_t* counts, size_t n_buckets)
     {
-      if (predicate(*i_begin))
+      for (size_t i = 0U; i < n_buckets; ++i)
       {
-        *o_begin++ = function(*i_begin);
+        counts[i] = 0U;
       }
 
-      ++i_begin;
-    }
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        ++counts[digit(*itr)];
+      }
 
-    return o_begin;
-  }
+      // Convert the counts to the start index of each bucket.
+      size_t total = 0U;
 
-  //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TOutputIterator,
-            typename TBinaryFunction,
-            typename TBinaryPredicate>
-  TOutputIterator transform_if(TInputIterator1       i_begin1,
-                               const TInputIterator1 i_end1,
-                               TInputIterator2       i_begin2,
-                               TOutputIterator       o_begin,
-                               TBinaryFunction       function,
-                               TBinaryPredicate      predicate)
-  {
-    while (i_begin1 != i_end1)
-    {
-      if (predicate(*i_begin1, *i_begin2))
+      for (size_t i = 0U; i < n_buckets; ++i)
       {
-        *o_begin++ = function(*i_begin1, *i_begin2);
+        const size_t count = counts[i];
+        counts[i] = total;
+        total += count;
       }
 
-      ++i_begin1;
-      ++i_begin2;
+      for (TSource itr = first; itr != last; ++itr)
+      {
+        destination[counts[digit(*itr)]++] = private_algorithm::move_or_copy(*itr);
+      }
     }
 
-    return o_begin;
+    //*************************************************************************
+    /// LSD radix sort. The last parameter is only used to deduce the key type.
+    //*************************************************************************
+    template <size_t DIGIT_BITS, typename TIterator, typename TScratch, typename TKeyExtractor, typename TKey>
+    void sort(TIterator first, TIterator last, TScratch scratch, TKeyExtractor key, TKey)
+    {
+      typedef typename etl::make_unsigned<TKey>::type unsigned_t;
+
+      enum
+      {
+        N_Buckets = 1U << DIGIT_BITS,
+        Key_Bits  = sizeof(unsigned_t) * CHAR_BIT
+      };
+
+      const unsigned_t mask   = unsigned_t(N_Buckets - 1U);
+      const size_t     length = size_t(last - first);
+
+      // Find the bits that differ between the keys. A digit that is the same
+      // in every key needs no pass.
+      const unsigned_t first_key = private_radix_sort::to_unsigned(key(*first));
+      unsigned_t       different = 0U;
+
+      for (TIterator itr = first + 1; itr != last; ++itr)
+      {
+        different = unsigned_t(different | (private_radix_sort::to_unsigned(key(*itr)) ^ first_key));
+      }
+
+      size_t counts[N_Buckets];
+      bool   in_scratch = false;
+
+      for (size_t shift = 0U; shift < size_t(Key_Bits); shift += DIGIT_BITS)
+      {
+        if (((different >> shift) & mask) != 0U)
+        {
+          const radix_digit<TKeyExtractor, unsigned_t> digit(key, shift, mask);
+
+          if (in_scratch)
+          {
+            private_radix_sort::scatter(scratch, scratch + length, first, digit, counts, size_t(N_Buckets));
+          }
+          else
+          {
+            private_radix_sort::scatter(first, last, scratch, digit, counts, size_t(N_Buckets));
+          }
+
+          in_scratch = !in_scratch;
+        }
+      }
+
+      if (in_scratch)
+      {
+        etl::move(scratch, scratch + length, first);
+      }
+    }
   }
 
   //***************************************************************************
-  /// Like std::transform_if, for 'n' items.
+  /// Sorts the elements by an integral key, using LSD radix sort.
+  /// Stable. O(N) for each digit of the key. Digits that are the same in
+  /// every key are skipped.
+  /// 'scratch' must have room for last - first elements.
+  /// 'key' returns the integral key for an element. Signed keys are allowed.
+  /// DIGIT_BITS is the size of a digit. Uses (1 << DIGIT_BITS) counters on
+  /// the stack.
+  /// Requires random access iterators.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator,
-            typename TSize,
-            typename TOutputIterator,
-            typename TUnaryFunction,
-            typename TUnaryPredicate>
-  TOutputIterator transform_n_if(TInputIterator  i_begin,
-                                 TSize           n,
-                                 TOutputIterator o_begin,
-                                 TUnaryFunction  function,
-                                 TUnaryPredicate predicate)
+  template <size_t DIGIT_BITS, typename TIterator, typename TScratch, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch, TKeyExtractor key)
   {
-    while (n-- > 0)
+    if ((last - first) > 1)
     {
-      if (predicate(*i_begin))
-      {
-        *o_begin++ = function(*i_begin);
-      }
-
-      ++i_begin;
+      private_radix_sort::sort<DIGIT_BITS>(first, last, scratch, key, key(*first));
     }
-
-    return o_begin;
   }
 
   //***************************************************************************
-  /// Like etl::transform_if but inputs from two ranges for 'n' items.
+  /// Sorts the elements by an integral key, using LSD radix sort with 8 bit
+  /// digits.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TInputIterator1,
-            typename TInputIterator2,
-            typename TSize,
-            typename TOutputIterator,
-            typename TBinaryFunction,
-            typename TBinaryPredicate>
-  TOutputIterator transform_n_if(TInputIterator1  i_begin1,
-                                 TInputIterator2  i_begin2,
-                                 TSize            n,
-                                 TOutputIterator  o_begin,
-                                 TBinaryFunction  function,
-                                 TBinaryPredicate predicate)
+  template <typename TIterator, typename TScratch, typename TKeyExtractor>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch, TKeyExtractor key)
   {
-    while (n-- > 0)
-    {
-      if (predicate(*i_begin1, *i_begin2))
-      {
-        *o_begin++ = function(*i_begin1, *i_begin2);
-      }
+    etl::radix_sort<8U>(first, last, scratch, key);
+  }
 
-      ++i_begin1;
-      ++i_begin2;
-    }
+  //***************************************************************************
+  /// Sorts integral values, using LSD radix sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t DIGIT_BITS, typename TIterator, typename TScratch>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return o_begin;
+    etl::radix_sort<DIGIT_BITS>(first, last, scratch, private_radix_sort::value_key<value_t>());
   }
 
   //***************************************************************************
-  /// Transforms the elements from the range (begin, end) to two different ranges
-  /// depending on the value returned by the predicate.<br>
+  /// Sorts integral values, using LSD radix sort with 8 bit digits.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TScratch>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch)
+  {
+    etl::radix_sort<8U>(first, last, scratch);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements by an integral key in the range 0 to KEY_RANGE - 1,
+  /// using counting sort.
+  /// Stable. O(N + KEY_RANGE). Uses KEY_RANGE counters on the stack.
+  /// 'scratch' must have room for last - first elements.
+  /// Requires random access iterators.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TSource, typename TDestinationTrue, typename TDestinationFalse,
-            typename TUnaryFunctionTrue, typename TUnaryFunctionFalse,
-            typename TUnaryPredicate>
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource             begin,
-                                                                            TSource             end,
-                                                                            TDestinationTrue    destination_true,
-                                                                            TDestinationFalse   destination_false,
-                                                                            TUnaryFunctionTrue  function_true,
-                                                                            TUnaryFunctionFalse function_false,
-                                                                            TUnaryPredicate     predicate)
+  template <size_t KEY_RANGE, typename TIterator, typename TScratch, typename TKeyExtractor>
+  void counting_sort(TIterator first, TIterator last, TScratch scratch, TKeyExtractor key)
   {
-    while (begin != end)
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    const difference_t length = last - first;
+
+    if (length > 1)
     {
-      if (predicate(*begin))
-      {
-        *destination_true++ = function_true(*begin++);
-      }
-      else
-      {
-        *destination_false++ = function_false(*begin++);
-      }
-    }
+      size_t counts[KEY_RANGE];
 
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
+      private_radix_sort::scatter(first, last, scratch, private_radix_sort::counting_digit<TKeyExtractor>(key), counts, KEY_RANGE);
+      etl::move(scratch, scratch + length, first);
+    }
   }
 
   //***************************************************************************
-  /// Transforms the elements from the ranges (begin1, end1) & (begin2)
-  /// to two different ranges depending on the value returned by the predicate.
+  /// Sorts integral values in the range 0 to KEY_RANGE - 1, using counting
+  /// sort. The values are counted, then written back, so no scratch is needed.
+  /// O(N + KEY_RANGE). Uses KEY_RANGE counters on the stack.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TSource1,
-            typename TSource2,
-            typename TDestinationTrue,
-            typename TDestinationFalse,
-            typename TBinaryFunctionTrue,
-            typename TBinaryFunctionFalse,
-            typename TBinaryPredicate>
-  ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse> partition_transform(TSource1             begin1,
-                                                                            TSource1             end1,
-                                                                            TSource2             begin2,
-                                                                            TDestinationTrue     destination_true,
-                                                                            TDestinationFalse    destination_false,
-                                                                            TBinaryFunctionTrue  function_true,
-                                                                            TBinaryFunctionFalse function_false,
-                                                                            TBinaryPredicate     predicate)
+  template <size_t KEY_RANGE, typename TIterator>
+  void counting_sort(TIterator first, TIterator last)
   {
-    while (begin1 != end1)
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    size_t counts[KEY_RANGE];
+
+    for (size_t i = 0U; i < KEY_RANGE; ++i)
     {
-      if (predicate(*begin1, *begin2))
-      {
-        *destination_true++ = function_true(*begin1++, *begin2++);
-      }
-      else
+      counts[i] = 0U;
+    }
+
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      ++counts[size_t(*itr)];
+    }
+
+    for (size_t i = 0U; i < KEY_RANGE; ++i)
+    {
+      for (size_t count = counts[i]; count != 0U; --count)
       {
-        *destination_false++ = function_false(*begin1++, *begin2++);
+        *first++ = value_t(i);
       }
     }
-
-    return ETL_OR_STD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
 
   //***************************************************************************
-  /// Sorts the elements using shell sort.
-  /// Uses user defined comparison.
-  ///\ingroup algorithm
-  //***************************************************************************
-  template <typename TIterator, typename TCompare>
-  void shell_sort(TIterator first, TIterator last, TCompare compare)
+  namespace private_selection
   {
-    if (first == last)
+    //*************************************************************************
+    /// Puts the element that belongs at 'nth' there, using a heap of the
+    /// smallest nth - first + 1 elements.
+    /// O(n log k). The fallback when partitioning keeps going badly.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_select(TIterator first, TIterator nth, TIterator last, TCompare compare)
     {
-      return;
+      etl::private_heap::make_heap(first, nth + 1, compare);
+      etl::private_heap::select(first, nth + 1, last, compare);
+      etl::iter_swap(first, nth);
     }
 
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    //*************************************************************************
+    /// Introselect.
+    /// Partitions as pdq_sort does, but only carries on into the side that
+    /// holds 'nth'. Falls back to heap_select after too many unbalanced
+    /// partitions.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void introselect(TIterator first, TIterator nth, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
-    difference_t n = etl::distance(first, last);
+      int bad_allowed = 0;
 
-    for (difference_t i = n / 2; i > 0; i /= 2)
-    {
-      for (difference_t j = i; j < n; ++j)
+      for (difference_t size = last - first; size > 1; size >>= 1)
       {
-        for (difference_t k = j - i; k >= 0; k -= i)
+        ++bad_allowed;
+      }
+
+      bool leftmost = true;
+
+      while (true)
+      {
+        const difference_t size = last - first;
+
+        if (size < difference_t(private_pdq_sort::Insertion_Sort_Threshold))
         {
-          TIterator itr1 = first;
-          TIterator itr2 = first;
+          private_pdq_sort::insertion_sort(first, last, compare, leftmost, ~size_t(0U));
+          return;
+        }
 
-          etl::advance(itr1, k);
-          etl::advance(itr2, k + i);
+        // Select the pivot and move it to the start.
+        const difference_t half = size / 2;
 
-          if (compare(*itr2, *itr1))
+        if (size > difference_t(private_pdq_sort::Ninther_Threshold))
+        {
+          private_pdq_sort::sort3(first,              first + half,       last - 1, compare);
+          private_pdq_sort::sort3(first + 1,          first + (half - 1), last - 2, compare);
+          private_pdq_sort::sort3(first + 2,          first + (half + 1), last - 3, compare);
+          private_pdq_sort::sort3(first + (half - 1), first + half,       first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          private_pdq_sort::sort3(first + half, first, last - 1, compare);
+        }
+
+        // A pivot equal to the element before the range means that many elements are equal.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          TIterator equal_last = private_pdq_sort::partition_left(first, last, compare);
+
+          if (nth <= equal_last)
           {
-            etl::iter_swap(itr1, itr2);
+            // Every element in [first, equal_last] is equal to the pivot.
+            return;
+          }
+
+          first = equal_last + 1;
+          continue;
+        }
+
+        bool already_partitioned;
+        TIterator pivot_position = private_pdq_sort::partition_right(first, last, compare, already_partitioned);
+
+        if (pivot_position == nth)
+        {
+          return;
+        }
+
+        const difference_t left_size  = pivot_position - first;
+        const difference_t right_size = last - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          if (--bad_allowed == 0)
+          {
+            private_selection::heap_select(first, nth, last, compare);
+            return;
+          }
+
+          if (nth < pivot_position)
+          {
+            private_pdq_sort::break_patterns(first, pivot_position, left_size);
+          }
+          else
+          {
+            private_pdq_sort::break_patterns(pivot_position + 1, last, right_size);
           }
         }
+
+        if (nth < pivot_position)
+        {
+          last = pivot_position;
+        }
+        else
+        {
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
       }
     }
   }
 
+#if ETL_NOT_USING_STL
   //***************************************************************************
-  /// Sorts the elements using shell sort.
+  /// Rearranges the elements so that *nth is the element that would be there
+  /// if the range were sorted. No element before nth is greater than it, and
+  /// no element after it is less.
+  /// Uses introselect. O(N) on average, O(N log N) worst case.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
+  {
+    if ((first == last) || (nth == last))
+    {
+      return;
+    }
+
+    private_selection::introselect(first, nth, last, compare);
+  }
+
+  //***************************************************************************
+  /// Rearranges the elements so that *nth is the element that would be there
+  /// if the range were sorted.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
-  void shell_sort(TIterator first, TIterator last)
+  void nth_element(TIterator first, TIterator nth, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::nth_element(first, nth, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  /// Sorts the elements using insertion sort.
+  /// Sorts the smallest middle - first elements into [first, middle).
+  /// The order of the rest is unspecified.
+  /// Uses a heap. O(N log M), where M is middle - first.
+  /// Requires random access iterators.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  void insertion_sort(TIterator first, TIterator last, TCompare compare)
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
   {
-    for (TIterator itr = first; itr != last; ++itr)
+    if (first == middle)
     {
-      etl::rotate(etl::upper_bound(first, itr, *itr, compare), itr, etl::next(itr));
+      return;
     }
+
+    private_heap::make_heap(first, middle, compare);
+    private_heap::select(first, middle, last, compare);
+    private_heap::sort_heap(first, middle, compare);
   }
 
   //***************************************************************************
-  /// Sorts the elements using insertion sort.
+  /// Sorts the smallest middle - first elements into [first, middle).
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
-  void insertion_sort(TIterator first, TIterator last)
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::partial_sort(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
-  namespace private_algorithm
+  /// Copies the smallest elements of [first, last) to [d_first, d_last), sorted.
+  /// Copies no more than the smaller of the two range sizes.
+  /// Uses a heap in the destination range. O(N log M), where M is the
+  /// number of elements copied.
+  /// Uses user defined comparison.
+  ///\return An iterator to the end of the copied elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last, TCompare compare)
   {
-    template <typename TIterator>
-    typename etl::enable_if<etl::is_forward_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator first_, TIterator last_)
-    {
-      TIterator last      = first_;
-      TIterator lastplus1 = first_;
-      ++lastplus1;
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
 
-      while (lastplus1 != last_)
-      {
-        ++last;
-        ++lastplus1;
-      }
+    TRandomAccessIterator d_end = d_first;
 
-      return last;
+    while ((first != last) && (d_end != d_last))
+    {
+      *d_end++ = *first++;
     }
 
-    template <typename TIterator>
-    typename etl::enable_if<etl::is_bidirectional_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator /*first_*/, TIterator last_)
+    if (d_end == d_first)
     {
-      TIterator last = last_;
-      --last;
-
-      return last;
+      return d_end;
     }
 
-    template <typename TIterator>
-    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, TIterator>::type
-      get_before_last(TIterator /*first_*/, TIterator last_)
+    private_heap::make_heap(d_first, d_end, compare);
+
+    const difference_t length = d_end - d_first;
+
+    for (; first != last; ++first)
     {
-      return last_ - 1;
+      if (compare(*first, *d_first))
+      {
+        private_heap::adjust_heap(d_first, difference_t(0), length, value_t(*first), compare);
+      }
     }
+
+    private_heap::sort_heap(d_first, d_end, compare);
+
+    return d_end;
   }
 
   //***************************************************************************
-  /// Sorts the elements using selection sort.
+  /// Copies the smallest elements of [first, last) to [d_first, d_last), sorted.
+  ///\return An iterator to the end of the copied elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last)
+  {
+    return etl::partial_sort_copy(first, last, d_first, d_last, etl::less<typename etl::iterator_traits<TRandomAccessIterator>::value_type>());
+  }
+#else
+  //***************************************************************************
+  /// Rearranges the elements so that *nth is the element that would be there
+  /// if the range were sorted.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
-  void selection_sort(TIterator first, TIterator last, TCompare compare)
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
   {
-    TIterator min;
-    const TIterator ilast = private_algorithm::get_before_last(first, last);
-    const TIterator jlast = last;
-
-    for (TIterator i = first; i != ilast; ++i)
-    {
-      min = i;
-      
-      TIterator j = i;
-      ++j;
+    std::nth_element(first, nth, last, compare);
+  }
 
-      for (; j != jlast; ++j)
-      {
-        if (compare(*j, *min))
-        {
-          min = j;
-        }
-      }
+  //***************************************************************************
+  /// Rearranges the elements so that *nth is the element that would be there
+  /// if the range were sorted.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void nth_element(TIterator first, TIterator nth, TIterator last)
+  {
+    std::nth_element(first, nth, last);
+  }
 
-      using ETL_OR_STD::swap; // Allow ADL
-      swap(*i, *min);
-    }
+  //***************************************************************************
+  /// Sorts the smallest middle - first elements into [first, middle).
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    std::partial_sort(first, middle, last, compare);
   }
 
   //***************************************************************************
-  /// Sorts the elements using selection sort.
+  /// Sorts the smallest middle - first elements into [first, middle).
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
-  void selection_sort(TIterator first, TIterator last)
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
   {
-    selection_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    std::partial_sort(first, middle, last);
   }
 
   //***************************************************************************
-  /// Sorts the elements using heap sort.
+  /// Copies the smallest elements of [first, last) to [d_first, d_last), sorted.
   /// Uses user defined comparison.
+  ///\return An iterator to the end of the copied elements.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename TCompare >
-  void heap_sort(TIterator first, TIterator last, TCompare compare)
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last, TCompare compare)
   {
-    if (!etl::is_heap(first, last, compare))
-    {
-      etl::make_heap(first, last, compare);
-    }
+    return std::partial_sort_copy(first, last, d_first, d_last, compare);
+  }
 
-    etl::sort_heap(first, last, compare);
+  //***************************************************************************
+  /// Copies the smallest elements of [first, last) to [d_first, d_last), sorted.
+  ///\return An iterator to the end of the copied elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last, TRandomAccessIterator d_first, TRandomAccessIterator d_last)
+  {
+    return std::partial_sort_copy(first, last, d_first, d_last);
   }
+#endif
 
   //***************************************************************************
-  /// Sorts the elements using heap sort.
+  /// Moves the k smallest elements to the front of the range, in no
+  /// particular order. O(N) on average.
+  /// If k is not less than the size of the range then it is left unchanged.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\return An iterator to the end of the k smallest elements.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator>
-  void heap_sort(TIterator first, TIterator last)
+  template <typename TIterator, typename TCompare>
+  TIterator select_k_smallest(TIterator first, TIterator last, size_t k, TCompare compare)
   {
-    if (!etl::is_heap(first, last))
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if (k >= size_t(last - first))
     {
-      etl::make_heap(first, last);
+      return last;
     }
 
-    etl::sort_heap(first, last);
+    TIterator kth = first + difference_t(k);
+
+    etl::nth_element(first, kth, last, compare);
+
+    return kth;
+  }
+
+  //***************************************************************************
+  /// Moves the k smallest elements to the front of the range, in no
+  /// particular order.
+  ///\return An iterator to the end of the k smallest elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  TIterator select_k_smallest(TIterator first, TIterator last, size_t k)
+  {
+    return etl::select_k_smallest(first, last, k, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
@@ -0,0 +1,329 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARENA_INCLUDED
+#define ETL_ARENA_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "ipool.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+//*****************************************************************************
+///\defgroup arena arena
+/// A monotonic allocator over a caller supplied buffer.
+/// Allocation bumps a pointer; individual blocks are not freed, instead the
+/// whole arena is reset in O(1), typically at the end of a request or frame.
+/// Objects placed in the arena are not destroyed by a reset.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the arena.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_exception : public etl::exception
+  {
+  public:
+
+    arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// No allocation exception for the arena.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_no_allocation : public etl::arena_exception
+  {
+  public:
+
+    arena_no_allocation(string_type file_name_, numeric_type line_number_)
+      : etl::arena_exception(ETL_ERROR_TEXT("arena:allocation", ETL_ARENA_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A monotonic memory block allocator over a caller supplied buffer.
+  /// release() accepts any block from the arena. Only the most recent block
+  /// is actually reclaimed, so that a short lived last allocation costs
+  /// nothing; the rest wait for reset() or rewind().
+  /// If the arena cannot satisfy a request it is passed to the successor,
+  /// if configured.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena : public etl::imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    arena(void* p_buffer_, size_t buffer_size_)
+      : p_buffer(static_cast<char*>(p_buffer_))
+      , buffer_size(buffer_size_)
+      , current(0U)
+      , last(0U)
+      , high_water(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates uninitialised, aligned storage for n objects of type T.
+    /// Suitable as the buffer for an etl::vector_ext.
+    /// Returns a null pointer if there is not enough space.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_array(size_t n)
+    {
+      return static_cast<T*>(allocate(sizeof(T) * n, etl::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Releases every block in O(1).
+    //*************************************************************************
+    void reset()
+    {
+      current = 0U;
+      last    = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets a position that a later rewind() can return to.
+    //*************************************************************************
+    size_t position() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// Releases every block allocated since position() returned the value.
+    //*************************************************************************
+    void rewind(size_t position_)
+    {
+      if (position_ < current)
+      {
+        current = position_;
+        last    = position_;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of bytes in use, including alignment padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// Gets the size of the buffer.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// Gets the number of unused bytes.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - current;
+    }
+
+    //*************************************************************************
+    /// Checks if nothing is allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the largest number of bytes that have been in use.
+    //*************************************************************************
+    size_t max_size_used() const
+    {
+      return high_water;
+    }
+
+    //*************************************************************************
+    /// Checks if the block is in the arena.
+    //*************************************************************************
+    bool is_owner_of(const void* const p) const
+    {
+      const char* p_char = static_cast<const char*>(p);
+
+      return (p_char >= p_buffer) && (p_char < (p_buffer + buffer_size));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment == 0U)
+      {
+        required_alignment = 1U;
+      }
+
+      // Align the address, not the offset, as the buffer may have any alignment.
+      const uintptr_t address = reinterpret_cast<uintptr_t>(p_buffer + current);
+      const size_t    padding = size_t((required_alignment - (address & (required_alignment - 1U))) & (required_alignment - 1U));
+
+      if ((padding > available()) || (required_size > (available() - padding)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      last    = current + padding;
+      current = last + required_size;
+
+      if (current > high_water)
+      {
+        high_water = current;
+      }
+
+      return p_buffer + last;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    /// Reclaims the space if it was the last block allocated.
+    //*************************************************************************
+    virtual bool release_block(const void* const p) ETL_OVERRIDE
+    {
+      if (!is_owner_of(p))
+      {
+        return false;
+      }
+
+      if (static_cast<const char*>(p) == (p_buffer + last))
+      {
+        current = last;
+      }
+
+      return true;
+    }
+
+    char* const  p_buffer;
+    const size_t buffer_size;
+    size_t       current;    ///< The offset of the next free byte.
+    size_t       last;       ///< The offset of the most recent block.
+    size_t       high_water;
+  };
+
+  namespace private_arena
+  {
+    //*************************************************************************
+    /// Takes the buffer for an arena_pool from the arena before the ipool
+    /// base is constructed.
+    //*************************************************************************
+    struct arena_pool_buffer
+    {
+      arena_pool_buffer(etl::arena& arena_, size_t element_size, size_t element_alignment, size_t max_size_)
+        : p_pool_buffer(static_cast<char*>(arena_.allocate(element_size * max_size_, element_alignment)))
+        , pool_max_size((p_pool_buffer != ETL_NULLPTR) ? max_size_ : 0U)
+      {
+        ETL_ASSERT(p_pool_buffer != ETL_NULLPTR, ETL_ERROR(arena_no_allocation));
+      }
+
+      char*  p_pool_buffer;
+      size_t pool_max_size;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of T whose storage is taken from an arena when constructed.
+  /// Can be used as the node pool for list_ext, forward_list_ext and the
+  /// other _ext containers, by using their pool_type as T.
+  /// The storage is only returned by a reset or rewind of the arena, which
+  /// must not happen while the pool is still in use.
+  ///\ingroup arena
+  //***************************************************************************
+  template <typename T>
+  class arena_pool : private etl::private_arena::arena_pool_buffer
+                   , public etl::ipool
+  {
+  private:
+
+    // The pool element, as for etl::generic_pool.
+    union Element
+    {
+      char* next;
+      char  value[sizeof(T)];
+      typename etl::type_with_alignment<etl::alignment_of<T>::value>::type dummy;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    /// If asserts or exceptions are enabled and the arena does not have room
+    /// for max_size_ items then an etl::arena_no_allocation is thrown,
+    /// otherwise the pool has a capacity of zero.
+    //*************************************************************************
+    arena_pool(etl::arena& arena_, size_t max_size_)
+      : etl::private_arena::arena_pool_buffer(arena_, sizeof(Element), etl::alignment_of<Element>::value, max_size_)
+      , etl::ipool(p_pool_buffer, uint32_t(sizeof(Element)), uint32_t(pool_max_size))
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~arena_pool()
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    arena_pool(const arena_pool&) ETL_DELETE;
+    arena_pool& operator =(const arena_pool&) ETL_DELETE;
+  };
+}
+
+#endif
@@ -139,7 +139,7 @@ namespace etl
     /// Returns a reference to the value at index 'i'.
     ///\param i The index of the element to access.
     //*************************************************************************
-    reference operator[](size_t i)
+    ETL_CONSTEXPR14 reference operator[](size_t i)
     {
       return _buffer[i];
     }
@@ -157,7 +157,7 @@ namespace etl
     //*************************************************************************
     /// Returns a reference to the first element.
     //*************************************************************************
-    reference front()
+    ETL_CONSTEXPR14 reference front()
     {
       return _buffer[0];
     }
@@ -173,7 +173,7 @@ namespace etl
     //*************************************************************************
     /// Returns a reference to the last element.
     //*************************************************************************
-    reference back()
+    ETL_CONSTEXPR14 reference back()
     {
       return _buffer[SIZE - 1];
     }
@@ -189,7 +189,7 @@ namespace etl
     //*************************************************************************
     /// Returns a pointer to the first element of the internal buffer.
     //*************************************************************************
-    pointer data() ETL_NOEXCEPT
+    ETL_CONSTEXPR14 pointer data() ETL_NOEXCEPT
     {
       return &_buffer[0];
     }
@@ -209,7 +209,7 @@ namespace etl
     //*************************************************************************
     /// Returns an iterator to the beginning of the array.
     //*************************************************************************
-    iterator begin() ETL_NOEXCEPT
+    ETL_CONSTEXPR14 iterator begin() ETL_NOEXCEPT
     {
       return &_buffer[0];
     }
@@ -233,7 +233,7 @@ namespace etl
     //*************************************************************************
     /// Returns an iterator to the end of the array.
     //*************************************************************************
-    iterator end() ETL_NOEXCEPT
+    ETL_CONSTEXPR14 iterator end() ETL_NOEXCEPT
     {
       return &_buffer[SIZE];
     }
@@ -561,6 +561,12 @@ namespace etl
       -> array<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), T>, 1U + sizeof...(Ts)>;
 #endif  
 
+  //*************************************************************************
+  /// An array is trivially relocatable if its elements are.
+  //*************************************************************************
+  template <typename T, const size_t SIZE>
+  struct is_trivially_relocatable<etl::array<T, SIZE> > : etl::is_trivially_relocatable<T> {};
+
   //*************************************************************************
   /// Overloaded swap for etl::array<T, SIZE>
   ///\param lhs The first array.
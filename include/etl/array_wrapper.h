@@ -395,8 +395,8 @@ namespace etl
   {
     size_t operator()(const etl::array_wrapper<T, SIZE, ARRAY>& aw) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&aw[0]),
-                                                         reinterpret_cast<const uint8_t*>(&aw[aw.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&aw[0]),
+                                                           reinterpret_cast<const uint8_t*>(&aw[aw.size()]));
     }
   };
 #endif
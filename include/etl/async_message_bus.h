@@ -0,0 +1,480 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ASYNC_MESSAGE_BUS_INCLUDED
+#define ETL_ASYNC_MESSAGE_BUS_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "optional.h"
+#include "queue_mpmc_atomic.h"
+#include "shared_message.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for the asynchronous message bus.
+  //***************************************************************************
+  class async_message_bus_exception : public etl::exception
+  {
+  public:
+
+    async_message_bus_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Too many subscribers.
+  //***************************************************************************
+  class async_message_bus_too_many_subscribers : public etl::async_message_bus_exception
+  {
+  public:
+
+    async_message_bus_too_many_subscribers(string_type file_name_, numeric_type line_number_)
+      : async_message_bus_exception(ETL_ERROR_TEXT("async message bus:too many subscribers", ETL_ASYNC_MESSAGE_BUS_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The message is not a shared message, so it cannot be queued.
+  //***************************************************************************
+  class async_message_bus_not_shared : public etl::async_message_bus_exception
+  {
+  public:
+
+    async_message_bus_not_shared(string_type file_name_, numeric_type line_number_)
+      : async_message_bus_exception(ETL_ERROR_TEXT("async message bus:not shared", ETL_ASYNC_MESSAGE_BUS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for the asynchronous message bus.
+  /// Each subscriber has its own queue. Posting a shared message pushes a copy
+  /// to the queue of every subscriber that accepts it; the handlers are only
+  /// run when the queues are processed, in the context of the caller of
+  /// process(). Producers, including interrupts, never run handler code.
+  /// Any number of producers may post concurrently with the processing.
+  /// Subscribing and unsubscribing must not run concurrently with posting or
+  /// processing.
+  //***************************************************************************
+  class iasync_message_bus : public etl::imessage_router
+  {
+  public:
+
+    //*******************************************
+    /// A message waiting in a subscriber's queue.
+    //*******************************************
+    struct queued_message
+    {
+      etl::message_router_id_t           destination_router_id;
+      etl::optional<etl::shared_message> shared_msg;
+    };
+
+    typedef etl::iqueue_mpmc_atomic<queued_message> queue_type;
+
+    using etl::imessage_router::receive;
+    using etl::imessage_router::accepts;
+
+    //*******************************************
+    /// Subscribe to the bus.
+    /// Messages for the router are queued until processed.
+    //*******************************************
+    bool subscribe(etl::imessage_router& router)
+    {
+      bool ok = true;
+
+      // There's no point adding routers that don't consume messages.
+      if (router.is_consumer())
+      {
+        ok = (number_of_routers < Max_Routers);
+
+        ETL_ASSERT(ok, ETL_ERROR(etl::async_message_bus_too_many_subscribers));
+
+        if (ok)
+        {
+          p_routers[number_of_routers] = &router;
+          ++number_of_routers;
+        }
+      }
+
+      return ok;
+    }
+
+    //*******************************************
+    /// Unsubscribe from the bus.
+    /// Any messages still queued for the router are discarded.
+    //*******************************************
+    void unsubscribe(etl::imessage_router& router)
+    {
+      size_t index = find(router);
+
+      if (index != number_of_routers)
+      {
+        // Keep the queues with their routers, and the routers in order.
+        queue_type* p_queue = p_queues[index];
+        p_queue->clear();
+
+        for (size_t i = index; i < (number_of_routers - 1U); ++i)
+        {
+          p_routers[i] = p_routers[i + 1U];
+          p_queues[i]  = p_queues[i + 1U];
+        }
+
+        --number_of_routers;
+        p_queues[number_of_routers] = p_queue;
+      }
+    }
+
+    //*******************************************
+    /// Unsubscribes all routers and discards their queued messages.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < number_of_routers; ++i)
+      {
+        p_queues[i]->clear();
+      }
+
+      number_of_routers = 0U;
+    }
+
+    //*******************************************
+    /// Queues the message for every subscriber that accepts it.
+    /// Returns false if the queue of any of them was full.
+    //*******************************************
+    bool post(etl::shared_message shared_msg)
+    {
+      return post(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    /// Queues the message for the subscribers with the router id that accept
+    /// it, and for any subscribed message buses.
+    /// Returns false if the queue of any of them was full.
+    //*******************************************
+    bool post(etl::message_router_id_t destination_router_id, etl::shared_message shared_msg)
+    {
+      bool ok = true;
+
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+
+      queued_message item;
+      item.destination_router_id = destination_router_id;
+      item.shared_msg            = shared_msg;
+
+      for (size_t i = 0U; i < number_of_routers; ++i)
+      {
+        etl::imessage_router& router = *p_routers[i];
+
+        const etl::message_router_id_t router_id = router.get_message_router_id();
+
+        const bool is_destination = (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS) ||
+                                    (destination_router_id == router_id)                                  ||
+                                    (router_id == etl::imessage_router::MESSAGE_BUS);
+
+        if (is_destination && router.accepts(id))
+        {
+          if (!p_queues[i]->push(item))
+          {
+            ok = false;
+          }
+        }
+      }
+
+      return ok;
+    }
+
+    //*******************************************
+    /// Queues the message for every subscriber that accepts it.
+    //*******************************************
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      post(shared_msg);
+    }
+
+    //*******************************************
+    /// Queues the message for the addressed subscribers.
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         etl::shared_message      shared_msg) ETL_OVERRIDE
+    {
+      post(destination_router_id, shared_msg);
+    }
+
+    //*******************************************
+    /// Only shared messages can be queued.
+    //*******************************************
+    virtual void receive(const etl::imessage&) ETL_OVERRIDE
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::async_message_bus_not_shared));
+    }
+
+    //*******************************************
+    /// Only shared messages can be queued.
+    //*******************************************
+    virtual void receive(etl::message_router_id_t, const etl::imessage&) ETL_OVERRIDE
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::async_message_bus_not_shared));
+    }
+
+    //*******************************************
+    /// Passes queued messages to their routers, visiting each subscriber in
+    /// turn until all of the queues are empty or max_messages have been
+    /// passed on.
+    /// Returns the number of messages passed on.
+    //*******************************************
+    size_t process(size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+      bool   more  = true;
+
+      // Take one message from each queue at a time, so that one busy
+      // subscriber cannot hold back the others.
+      while (more && (count < max_messages))
+      {
+        more = false;
+
+        for (size_t i = 0U; (i < number_of_routers) && (count < max_messages); ++i)
+        {
+          if (process_one(i))
+          {
+            ++count;
+            more = true;
+          }
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Passes the router's queued messages to it, until its queue is empty or
+    /// max_messages have been passed on.
+    /// Allows each router to be served by its own task.
+    /// Returns the number of messages passed on.
+    //*******************************************
+    size_t process(etl::imessage_router& router, size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+      size_t index = find(router);
+
+      if (index != number_of_routers)
+      {
+        while ((count < max_messages) && process_one(index))
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Are all of the queues empty?
+    //*******************************************
+    bool empty() const
+    {
+      for (size_t i = 0U; i < number_of_routers; ++i)
+      {
+        if (!p_queues[i]->empty())
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// The number of messages waiting in all of the queues.
+    /// Only a snapshot if producers or consumers are active.
+    //*******************************************
+    size_t pending() const
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < number_of_routers; ++i)
+      {
+        count += p_queues[i]->size();
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Does this message bus accept the message id?
+    /// Yes!, it accepts everything!
+    //*******************************************
+    bool accepts(etl::message_id_t) const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*******************************************
+    /// The number of subscribers.
+    //*******************************************
+    size_t size() const
+    {
+      return number_of_routers;
+    }
+
+    //*******************************************
+    /// The maximum number of subscribers.
+    //*******************************************
+    size_t max_size() const
+    {
+      return Max_Routers;
+    }
+
+    //********************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    iasync_message_bus(etl::imessage_router** p_routers_, queue_type** p_queues_, size_t max_routers_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        p_routers(p_routers_),
+        p_queues(p_queues_),
+        number_of_routers(0U),
+        Max_Routers(max_routers_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Passes one message from the queue at the index to its router.
+    //*******************************************
+    bool process_one(size_t index)
+    {
+      queued_message item;
+
+      if (p_queues[index]->pop(item))
+      {
+        p_routers[index]->receive(item.destination_router_id, item.shared_msg.value());
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Finds the index of the router.
+    /// Returns the number of routers if not found.
+    //*******************************************
+    size_t find(const etl::imessage_router& router) const
+    {
+      size_t index = 0U;
+
+      while ((index < number_of_routers) && (p_routers[index] != &router))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    etl::imessage_router** p_routers;
+    queue_type**           p_queues;
+    size_t                 number_of_routers;
+    const size_t           Max_Routers;
+  };
+
+  //***************************************************************************
+  /// The asynchronous message bus.
+  ///\tparam MAX_ROUTERS The maximum number of subscribers.
+  ///\tparam QUEUE_SIZE  The capacity of each subscriber's queue. Must be a power of 2.
+  //***************************************************************************
+  template <size_t MAX_ROUTERS, size_t QUEUE_SIZE>
+  class async_message_bus : public etl::iasync_message_bus
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_ROUTERS > 0U), "Zero subscribers");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    async_message_bus()
+      : iasync_message_bus(router_list, queue_list, MAX_ROUTERS)
+    {
+      for (size_t i = 0U; i < MAX_ROUTERS; ++i)
+      {
+        router_list[i] = ETL_NULLPTR;
+        queue_list[i]  = &queues[i];
+      }
+    }
+
+  private:
+
+    typedef etl::queue_mpmc_atomic<queued_message, QUEUE_SIZE> queue_t;
+
+    etl::imessage_router* router_list[MAX_ROUTERS];
+    queue_type*           queue_list[MAX_ROUTERS];
+    queue_t               queues[MAX_ROUTERS];
+  };
+}
+
+#endif
+
+#endif
@@ -37,6 +37,11 @@ SOFTWARE.
 #elif defined(ETL_COMPILER_ARM5)
   #include "atomic/atomic_arm.h"
   #define ETL_HAS_ATOMIC 1
+// The '__atomic' builtins honour the memory order, so are preferred to '__sync'.
+// Define ETL_USE_SYNC_BUILTINS to use '__sync' regardless.
+#elif (defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__ATOMIC_SEQ_CST) && !defined(ETL_USE_SYNC_BUILTINS)
+  #include "atomic/atomic_gcc_atomic.h"
+  #define ETL_HAS_ATOMIC 1
 #elif defined(ETL_COMPILER_ARM6)
   #include "atomic/atomic_arm.h"
   #define ETL_HAS_ATOMIC 1
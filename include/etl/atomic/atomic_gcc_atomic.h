@@ -0,0 +1,805 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_GCC_ATOMIC_INCLUDED
+#define ETL_ATOMIC_GCC_ATOMIC_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../static_assert.h"
+#include "../nullptr.h"
+#include "../char_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  // Atomic type for GCC and Clang compilers that support the builtin
+  // '__atomic' functions.
+  // Unlike the '__sync' functions, these honour the requested memory order,
+  // so relaxed, acquire and release operations need no full barrier.
+  // Only integral and pointer types are supported.
+  //***************************************************************************
+
+  typedef enum memory_order
+  {
+    memory_order_relaxed = __ATOMIC_RELAXED,
+    memory_order_consume = __ATOMIC_CONSUME,
+    memory_order_acquire = __ATOMIC_ACQUIRE,
+    memory_order_release = __ATOMIC_RELEASE,
+    memory_order_acq_rel = __ATOMIC_ACQ_REL,
+    memory_order_seq_cst = __ATOMIC_SEQ_CST
+  } memory_order;
+
+  namespace private_atomic
+  {
+    //*************************************************************************
+    /// The strongest order allowed for a failed compare exchange, given the
+    /// order for success. A failure is a load, so may not have release
+    /// semantics.
+    //*************************************************************************
+    inline ETL_CONSTEXPR etl::memory_order failure_order(etl::memory_order order)
+    {
+      return (order == etl::memory_order_acq_rel) ? etl::memory_order_acquire :
+             (order == etl::memory_order_release) ? etl::memory_order_relaxed : order;
+    }
+  }
+
+  //***************************************************************************
+  /// Establishes memory ordering between plain and atomic accesses.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    __atomic_thread_fence(order);
+  }
+
+  //***************************************************************************
+  /// Establishes memory ordering between a thread and a signal handler in
+  /// the same thread. Only stops the compiler from reordering.
+  //***************************************************************************
+  inline void atomic_signal_fence(etl::memory_order order)
+  {
+    __atomic_signal_fence(order);
+  }
+
+  //***************************************************************************
+  /// For all types except bool and pointers
+  //***************************************************************************
+  template <typename T>
+  class atomic
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral types are supported");
+
+    atomic()
+      : value(0)
+    {
+    }
+
+    atomic(T v)
+      : value(v)
+    {
+    }
+
+    // Assignment
+    T operator =(T v)
+    {
+      store(v);
+
+      return v;
+    }
+
+    T operator =(T v) volatile
+    {
+      store(v);
+
+      return v;
+    }
+
+    // Pre-increment
+    T operator ++()
+    {
+      return __atomic_add_fetch(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    T operator ++() volatile
+    {
+      return __atomic_add_fetch(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    // Post-increment
+    T operator ++(int)
+    {
+      return __atomic_fetch_add(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    T operator ++(int) volatile
+    {
+      return __atomic_fetch_add(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    // Pre-decrement
+    T operator --()
+    {
+      return __atomic_sub_fetch(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    T operator --() volatile
+    {
+      return __atomic_sub_fetch(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    // Post-decrement
+    T operator --(int)
+    {
+      return __atomic_fetch_sub(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    T operator --(int) volatile
+    {
+      return __atomic_fetch_sub(&value, 1, __ATOMIC_SEQ_CST);
+    }
+
+    // Add
+    T operator +=(T v)
+    {
+      return __atomic_add_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    T operator +=(T v) volatile
+    {
+      return __atomic_add_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    // Subtract
+    T operator -=(T v)
+    {
+      return __atomic_sub_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    T operator -=(T v) volatile
+    {
+      return __atomic_sub_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    // And
+    T operator &=(T v)
+    {
+      return __atomic_and_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    T operator &=(T v) volatile
+    {
+      return __atomic_and_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    // Or
+    T operator |=(T v)
+    {
+      return __atomic_or_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    T operator |=(T v) volatile
+    {
+      return __atomic_or_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    // Exclusive or
+    T operator ^=(T v)
+    {
+      return __atomic_xor_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    T operator ^=(T v) volatile
+    {
+      return __atomic_xor_fetch(&value, v, __ATOMIC_SEQ_CST);
+    }
+
+    // Conversion operator
+    operator T () const
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    operator T () const volatile
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    // Is lock free?
+    bool is_lock_free() const
+    {
+      return __atomic_always_lock_free(sizeof(T), 0);
+    }
+
+    bool is_lock_free() const volatile
+    {
+      return __atomic_always_lock_free(sizeof(T), 0);
+    }
+
+    // Store
+    void store(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    void store(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    // Load
+    T load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    T load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    // Fetch add
+    T fetch_add(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_add(&value, v, order);
+    }
+
+    T fetch_add(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_add(&value, v, order);
+    }
+
+    // Fetch subtract
+    T fetch_sub(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_sub(&value, v, order);
+    }
+
+    T fetch_sub(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_sub(&value, v, order);
+    }
+
+    // Fetch or
+    T fetch_or(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_or(&value, v, order);
+    }
+
+    T fetch_or(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_or(&value, v, order);
+    }
+
+    // Fetch and
+    T fetch_and(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_and(&value, v, order);
+    }
+
+    T fetch_and(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_and(&value, v, order);
+    }
+
+    // Fetch exclusive or
+    T fetch_xor(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_xor(&value, v, order);
+    }
+
+    T fetch_xor(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_xor(&value, v, order);
+    }
+
+    // Exchange
+    T exchange(T v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    T exchange(T v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    // Compare exchange weak
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    bool compare_exchange_weak(T& expected, T desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    // Compare exchange strong
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    bool compare_exchange_strong(T& expected, T desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+  private:
+
+    atomic& operator =(const atomic&) ETL_DELETE;
+    atomic& operator =(const atomic&) volatile ETL_DELETE;
+
+    mutable T value;
+  };
+
+  //***************************************************************************
+  /// Specialisation for pointers
+  //***************************************************************************
+  template <typename T>
+  class atomic<T*>
+  {
+  public:
+
+    atomic()
+      : value(ETL_NULLPTR)
+    {
+    }
+
+    atomic(T* v)
+      : value(v)
+    {
+    }
+
+    // Assignment
+    T* operator =(T* v)
+    {
+      store(v);
+
+      return v;
+    }
+
+    T* operator =(T* v) volatile
+    {
+      store(v);
+
+      return v;
+    }
+
+    // Pre-increment
+    T* operator ++()
+    {
+      return __atomic_add_fetch(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator ++() volatile
+    {
+      return __atomic_add_fetch(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Post-increment
+    T* operator ++(int)
+    {
+      return __atomic_fetch_add(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator ++(int) volatile
+    {
+      return __atomic_fetch_add(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Pre-decrement
+    T* operator --()
+    {
+      return __atomic_sub_fetch(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator --() volatile
+    {
+      return __atomic_sub_fetch(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Post-decrement
+    T* operator --(int)
+    {
+      return __atomic_fetch_sub(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator --(int) volatile
+    {
+      return __atomic_fetch_sub(&value, sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Add
+    T* operator +=(ptrdiff_t v)
+    {
+      return __atomic_add_fetch(&value, v * sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator +=(ptrdiff_t v) volatile
+    {
+      return __atomic_add_fetch(&value, v * sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Subtract
+    T* operator -=(ptrdiff_t v)
+    {
+      return __atomic_sub_fetch(&value, v * sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    T* operator -=(ptrdiff_t v) volatile
+    {
+      return __atomic_sub_fetch(&value, v * sizeof(T), __ATOMIC_SEQ_CST);
+    }
+
+    // Conversion operator
+    operator T* () const
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    operator T* () const volatile
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    // Is lock free?
+    bool is_lock_free() const
+    {
+      return __atomic_always_lock_free(sizeof(T*), 0);
+    }
+
+    bool is_lock_free() const volatile
+    {
+      return __atomic_always_lock_free(sizeof(T*), 0);
+    }
+
+    // Store
+    void store(T* v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    void store(T* v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    // Load
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    // Fetch add
+    T* fetch_add(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), order);
+    }
+
+    T* fetch_add(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_add(&value, v * sizeof(T), order);
+    }
+
+    // Fetch subtract
+    T* fetch_sub(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), order);
+    }
+
+    T* fetch_sub(ptrdiff_t v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_fetch_sub(&value, v * sizeof(T), order);
+    }
+
+    // Exchange
+    T* exchange(T* v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    T* exchange(T* v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    // Compare exchange weak
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    bool compare_exchange_weak(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    // Compare exchange strong
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    bool compare_exchange_strong(T*& expected, T* desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+  private:
+
+    atomic& operator =(const atomic&) ETL_DELETE;
+    atomic& operator =(const atomic&) volatile ETL_DELETE;
+
+    mutable T* value;
+  };
+
+  //***************************************************************************
+  /// Specialisation for bool
+  //***************************************************************************
+  template <>
+  class atomic<bool>
+  {
+  public:
+
+    atomic()
+      : value(false)
+    {
+    }
+
+    atomic(bool v)
+      : value(v)
+    {
+    }
+
+    // Assignment
+    bool operator =(bool v)
+    {
+      store(v);
+
+      return v;
+    }
+
+    bool operator =(bool v) volatile
+    {
+      store(v);
+
+      return v;
+    }
+
+    // Conversion operator
+    operator bool () const
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    operator bool () const volatile
+    {
+      return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    }
+
+    // Is lock free?
+    bool is_lock_free() const
+    {
+      return __atomic_always_lock_free(sizeof(bool), 0);
+    }
+
+    bool is_lock_free() const volatile
+    {
+      return __atomic_always_lock_free(sizeof(bool), 0);
+    }
+
+    // Store
+    void store(bool v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    void store(bool v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      __atomic_store_n(&value, v, order);
+    }
+
+    // Load
+    bool load(etl::memory_order order = etl::memory_order_seq_cst) const
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    bool load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
+    {
+      return __atomic_load_n(&value, order);
+    }
+
+    // Exchange
+    bool exchange(bool v, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    bool exchange(bool v, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_exchange_n(&value, v, order);
+    }
+
+    // Compare exchange weak
+    bool compare_exchange_weak(bool& expected, bool desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(bool& expected, bool desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_weak(bool& expected, bool desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    bool compare_exchange_weak(bool& expected, bool desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, true, success, failure);
+    }
+
+    // Compare exchange strong
+    bool compare_exchange_strong(bool& expected, bool desired, etl::memory_order order = etl::memory_order_seq_cst)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(bool& expected, bool desired, etl::memory_order order = etl::memory_order_seq_cst) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, order, private_atomic::failure_order(order));
+    }
+
+    bool compare_exchange_strong(bool& expected, bool desired, etl::memory_order success, etl::memory_order failure)
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+    bool compare_exchange_strong(bool& expected, bool desired, etl::memory_order success, etl::memory_order failure) volatile
+    {
+      return __atomic_compare_exchange_n(&value, &expected, desired, false, success, failure);
+    }
+
+  private:
+
+    atomic& operator =(const atomic&) ETL_DELETE;
+    atomic& operator =(const atomic&) volatile ETL_DELETE;
+
+    mutable bool value;
+  };
+
+  typedef etl::atomic<bool>                atomic_bool;
+  typedef etl::atomic<char>                atomic_char;
+  typedef etl::atomic<signed char>         atomic_schar;
+  typedef etl::atomic<unsigned char>       atomic_uchar;
+  typedef etl::atomic<short>               atomic_short;
+  typedef etl::atomic<unsigned short>      atomic_ushort;
+  typedef etl::atomic<int>                 atomic_int;
+  typedef etl::atomic<unsigned int>        atomic_uint;
+  typedef etl::atomic<long>                atomic_long;
+  typedef etl::atomic<unsigned long>       atomic_ulong;
+  typedef etl::atomic<long long>           atomic_llong;
+  typedef etl::atomic<unsigned long long>  atomic_ullong;
+  typedef etl::atomic<wchar_t>             atomic_wchar_t;
+  typedef etl::atomic<char16_t>            atomic_char16_t;
+  typedef etl::atomic<char32_t>            atomic_char32_t;
+#if ETL_USING_8BIT_TYPES
+  typedef etl::atomic<uint8_t>             atomic_uint8_t;
+  typedef etl::atomic<int8_t>              atomic_int8_t;
+#endif
+  typedef etl::atomic<uint16_t>            atomic_uint16_t;
+  typedef etl::atomic<int16_t>             atomic_int16_t;
+  typedef etl::atomic<uint32_t>            atomic_uint32_t;
+  typedef etl::atomic<int32_t>             atomic_int32_t;
+#if ETL_USING_64BIT_TYPES
+  typedef etl::atomic<uint64_t>            atomic_uint64_t;
+  typedef etl::atomic<int64_t>             atomic_int64_t;
+#endif
+  typedef etl::atomic<int_least8_t>        atomic_int_least8_t;
+  typedef etl::atomic<uint_least8_t>       atomic_uint_least8_t;
+  typedef etl::atomic<int_least16_t>       atomic_int_least16_t;
+  typedef etl::atomic<uint_least16_t>      atomic_uint_least16_t;
+  typedef etl::atomic<int_least32_t>       atomic_int_least32_t;
+  typedef etl::atomic<uint_least32_t>      atomic_uint_least32_t;
+#if ETL_USING_64BIT_TYPES
+  typedef etl::atomic<int_least64_t>       atomic_int_least64_t;
+  typedef etl::atomic<uint_least64_t>      atomic_uint_least64_t;
+#endif
+  typedef etl::atomic<int_fast8_t>         atomic_int_fast8_t;
+  typedef etl::atomic<uint_fast8_t>        atomic_uint_fast8_t;
+  typedef etl::atomic<int_fast16_t>        atomic_int_fast16_t;
+  typedef etl::atomic<uint_fast16_t>       atomic_uint_fast16_t;
+  typedef etl::atomic<int_fast32_t>        atomic_int_fast32_t;
+  typedef etl::atomic<uint_fast32_t>       atomic_uint_fast32_t;
+#if ETL_USING_64BIT_TYPES
+  typedef etl::atomic<int_fast64_t>        atomic_int_fast64_t;
+  typedef etl::atomic<uint_fast64_t>       atomic_uint_fast64_t;
+#endif
+  typedef etl::atomic<intptr_t>            atomic_intptr_t;
+  typedef etl::atomic<uintptr_t>           atomic_uintptr_t;
+  typedef etl::atomic<size_t>              atomic_size_t;
+  typedef etl::atomic<ptrdiff_t>           atomic_ptrdiff_t;
+  typedef etl::atomic<intmax_t>            atomic_intmax_t;
+  typedef etl::atomic<uintmax_t>           atomic_uintmax_t;
+}
+
+#endif
@@ -61,6 +61,15 @@ namespace etl
     memory_order_seq_cst
   } memory_order;
 
+  //***************************************************************************
+  /// Establishes memory ordering between plain and atomic accesses.
+  /// The '__sync' builtins only provide a full barrier.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order)
+  {
+    __sync_synchronize();
+  }
+
   //***************************************************************************
   /// For all types except bool and pointers
   //***************************************************************************
@@ -52,6 +52,14 @@ namespace etl
   static ETL_CONSTANT etl::memory_order memory_order_acq_rel = std::memory_order_acq_rel;
   static ETL_CONSTANT etl::memory_order memory_order_seq_cst = std::memory_order_seq_cst;
 
+  //***************************************************************************
+  /// Establishes memory ordering between plain and atomic accesses.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    std::atomic_thread_fence(order);
+  }
+
   template <typename T>
   class atomic
   {
@@ -463,12 +471,12 @@ namespace etl
     }
 
     // Load
-    T* load(etl::memory_order order = etl::memory_order_seq_cst)
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const
     {
       return value.load(order);
     }
 
-    T* load(etl::memory_order order = etl::memory_order_seq_cst) volatile
+    T* load(etl::memory_order order = etl::memory_order_seq_cst) const volatile
     {
       return value.load(order);
     }
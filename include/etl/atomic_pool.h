@@ -0,0 +1,743 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_POOL_INCLUDED
+#define ETL_ATOMIC_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "ipool.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup atomic_pool atomic_pool
+/// A fixed capacity pool that may be shared between threads, cores and ISRs
+/// without a lock.
+/// The free items are held in a list of indexes. The head of the list holds
+/// a tag that changes on every allocation and release, so that a compare and
+/// swap cannot succeed on a head that was removed and then replaced (ABA).
+/// The index and the tag each take half of a size_t, which limits the number
+/// of items to 65534 when size_t is 32 bits.
+/// Uses the exceptions of etl::pool.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup atomic_pool
+  //***************************************************************************
+  class iatomic_pool
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      char* p = allocate_item();
+
+      if (p == ETL_NULLPTR)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return reinterpret_cast<T*>(p);
+    }
+
+    //*************************************************************************
+    /// Try to allocate storage for an object from the pool.
+    /// Returns a null pointer if there are no more free items or the object
+    /// is too large for the pool. Does not assert or throw.
+    //*************************************************************************
+    template <typename T>
+    T* try_allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        return ETL_NULLPTR;
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to n objects from the pool.
+    /// The items are unlinked from the free list with a single exchange of
+    /// the head, so a batch costs about the same contention as one item.
+    /// Returns the number allocated, which is less than n if the pool runs
+    /// out. Does not assert or throw.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** pp_items, size_t n)
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      size_t head = free_head.load(etl::memory_order_acquire);
+      size_t count;
+
+      while (true)
+      {
+        size_t index = head & Index_Mask;
+        count = 0;
+
+        // The links may be stale if another thread changes the list while
+        // they are read. The tag then makes the exchange fail.
+        while ((count < n) && (index != No_Index))
+        {
+          pp_items[count++] = static_cast<T*>(static_cast<void*>(p_buffer + (index * Item_Size)));
+          index = p_links[index].load(etl::memory_order_relaxed);
+        }
+
+        if (count == 0)
+        {
+          return 0;
+        }
+
+        size_t next_head = ((head + Tag_Increment) & ~Index_Mask) | index;
+
+        if (free_head.compare_exchange_weak(head, next_head, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          break;
+        }
+      }
+
+      items_allocated.fetch_add(count, etl::memory_order_relaxed);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release n objects back to the pool.
+    /// The items are linked together first and then put on the free list with
+    /// a single exchange of the head.
+    /// If asserts or exceptions are enabled and any of the objects does not
+    /// belong to this pool then an etl::pool_object_not_in_pool is thrown and
+    /// none are released.
+    //*************************************************************************
+    template <typename T>
+    void release_n(T* const* pp_items, size_t n)
+    {
+      if (n == 0)
+      {
+        return;
+      }
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        ETL_ASSERT_AND_RETURN(is_in_pool(pp_items[i]), ETL_ERROR(pool_object_not_in_pool));
+      }
+
+      const size_t first = index_of(pp_items[0]);
+      const size_t last  = index_of(pp_items[n - 1]);
+
+      for (size_t i = 0; (i + 1) < n; ++i)
+      {
+        p_links[index_of(pp_items[i])].store(index_of(pp_items[i + 1]), etl::memory_order_relaxed);
+      }
+
+      size_t head = free_head.load(etl::memory_order_relaxed);
+      size_t next_head;
+
+      do
+      {
+        p_links[last].store(head & Index_Mask, etl::memory_order_relaxed);
+        next_head = ((head + Tag_Increment) & ~Index_Mask) | first;
+      } while (!free_head.compare_exchange_weak(head, next_head, etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      return is_item_in_pool((const char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t item_size() const
+    {
+      return Item_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    /// The index and the tag each take half of the head.
+    static ETL_CONSTANT size_t Index_Bits = etl::integral_limits<size_t>::bits / 2;
+    static ETL_CONSTANT size_t Index_Mask = (size_t(1) << Index_Bits) - 1;
+    static ETL_CONSTANT size_t Tag_Increment = size_t(1) << Index_Bits;
+
+    /// The index that marks the end of the free list.
+    static ETL_CONSTANT size_t No_Index = Index_Mask;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    iatomic_pool(char* p_buffer_, etl::atomic<size_t>* p_links_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_),
+        p_links(p_links_),
+        free_head(0),
+        items_allocated(0),
+        Item_Size(item_size_),
+        Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Links all of the items into the free list.
+    /// Called from the derived constructor, once the links have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0; i < Max_Size; ++i)
+      {
+        p_links[i].store(((i + 1) < Max_Size) ? i + 1 : No_Index, etl::memory_order_relaxed);
+      }
+
+      free_head.store((Max_Size != 0) ? 0 : No_Index, etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      size_t head = free_head.load(etl::memory_order_acquire);
+      size_t index;
+
+      while (true)
+      {
+        index = head & Index_Mask;
+
+        if (index == No_Index)
+        {
+          return ETL_NULLPTR;
+        }
+
+        // The link may be stale if another thread takes this item first.
+        // The tag then makes the exchange fail.
+        size_t next      = p_links[index].load(etl::memory_order_relaxed);
+        size_t next_head = ((head + Tag_Increment) & ~Index_Mask) | next;
+
+        if (free_head.compare_exchange_weak(head, next_head, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          break;
+        }
+      }
+
+      items_allocated.fetch_add(1, etl::memory_order_relaxed);
+
+      return p_buffer + (index * Item_Size);
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to us?
+      ETL_ASSERT_AND_RETURN(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
+
+      size_t index = size_t(p_value - p_buffer) / Item_Size;
+      size_t head  = free_head.load(etl::memory_order_relaxed);
+      size_t next_head;
+
+      do
+      {
+        p_links[index].store(head & Index_Mask, etl::memory_order_relaxed);
+        next_head = ((head + Tag_Increment) & ~Index_Mask) | index;
+      } while (!free_head.compare_exchange_weak(head, next_head, etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(1, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Gets the index of an item in the pool.
+    //*************************************************************************
+    size_t index_of(const void* p_item) const
+    {
+      return size_t(static_cast<const char*>(p_item) - p_buffer) / Item_Size;
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if defined(ETL_DEBUG)
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % Item_Size) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    iatomic_pool(const iatomic_pool&);
+    iatomic_pool& operator =(const iatomic_pool&);
+
+    // The free list head, which every allocation and release writes, is kept
+    // on a separate cache line from the read only members when
+    // ETL_CACHE_LINE_SIZE is defined.
+
+    char*                p_buffer;
+    etl::atomic<size_t>* p_links;         ///< The index of the next free item, for each item.
+#if ETL_CACHE_LINE_SIZE > 0
+    char links_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_t>  free_head;       ///< The tag and the index of the first free item.
+    etl::atomic<size_t>  items_allocated; ///< The number of items allocated.
+#if ETL_CACHE_LINE_SIZE > 0
+    char allocated_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    const uint32_t Item_Size;             ///< The size of allocated items.
+    const uint32_t Max_Size;              ///< The maximum number of objects that can be allocated.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iatomic_pool()
+    {
+    }
+#else
+  protected:
+    ~iatomic_pool()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A lock free pool of fixed size items.
+  ///\ingroup atomic_pool
+  //*************************************************************************
+  template <const size_t VTypeSize, const size_t VAlignment, const size_t VSize>
+  class generic_atomic_pool : public etl::iatomic_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VSize < (size_t(1) << (etl::integral_limits<size_t>::bits / 2)) - 1), "Size too large for the free list index");
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_atomic_pool()
+      : etl::iatomic_pool(reinterpret_cast<char*>(&buffer[0]), links, Element_Size, VSize)
+    {
+      iatomic_pool::initialise();
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char      value[VTypeSize]; ///< Storage for value type.
+      typename  etl::type_with_alignment<VAlignment>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    ///< The free list links.
+    etl::atomic<size_t> links[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_atomic_pool(const generic_atomic_pool&);
+    generic_atomic_pool& operator =(const generic_atomic_pool&);
+  };
+
+  template <const size_t VTypeSize, const size_t VAlignment, const size_t VSize>
+  ETL_CONSTANT size_t generic_atomic_pool<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <const size_t VTypeSize, const size_t VAlignment, const size_t VSize>
+  ETL_CONSTANT size_t generic_atomic_pool<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <const size_t VTypeSize, const size_t VAlignment, const size_t VSize>
+  ETL_CONSTANT size_t generic_atomic_pool<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  //*************************************************************************
+  /// A lock free pool of 'T'.
+  ///\ingroup atomic_pool
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class atomic_pool : public etl::generic_atomic_pool<sizeof(T), etl::alignment_of<T>::value, VSize>
+  {
+  private:
+
+    typedef etl::generic_atomic_pool<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+
+  public:
+
+    using base_t::SIZE;
+    using base_t::ALIGNMENT;
+    using base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    atomic_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* allocate()
+    {
+      return base_t::template allocate<T>();
+    }
+
+    //*************************************************************************
+    /// Try to allocate an object from the pool.
+    /// Returns a null pointer if there are no more free items.
+    //*************************************************************************
+    T* try_allocate()
+    {
+      return base_t::template try_allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    //*************************************************************************
+    T* create()
+    {
+      return base_t::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return base_t::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return base_t::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return base_t::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return base_t::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return base_t::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    template <typename U>
+    void release(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::destroy(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    atomic_pool(const atomic_pool&) ETL_DELETE;
+    atomic_pool& operator =(const atomic_pool&) ETL_DELETE;
+  };
+}
+
+#endif
+
+#endif
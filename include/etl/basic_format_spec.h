@@ -121,6 +121,17 @@ namespace etl
       const bool show_base;
     };
 
+    //*********************************
+    struct shortest_spec
+    {
+      ETL_CONSTEXPR shortest_spec(bool shortest_)
+        : shortest(shortest_)
+      {
+      }
+
+      const bool shortest;
+    };
+
     //*********************************
     struct left_spec
     {
@@ -195,6 +206,12 @@ namespace etl
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::showbase_spec noshowbase(false);
 
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::shortest_spec shortest(true);
+
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::shortest_spec noshortest(false);
+
   //***************************************************************************
   /// basic_format_spec
   //***************************************************************************
@@ -214,6 +231,7 @@ namespace etl
       , left_justified_(false)
       , boolalpha_(false)
       , show_base_(false)
+      , shortest_(false)
       , fill_(typename TString::value_type(' '))
     {
     }
@@ -228,7 +246,8 @@ namespace etl
                                     bool left_justified__,
                                     bool boolalpha__,
                                     bool show_base__,
-                                    typename TString::value_type fill__)
+                                    typename TString::value_type fill__,
+                                    bool shortest__ = false)
       : base_(base__)
       , width_(width__)
       , precision_(precision__)
@@ -236,6 +255,7 @@ namespace etl
       , left_justified_(left_justified__)
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
+      , shortest_(shortest__)
       , fill_(fill__)
     {
     }
@@ -252,6 +272,7 @@ namespace etl
       left_justified_ = false;
       boolalpha_      = false;
       show_base_      = false;
+      shortest_       = false;
       fill_           = typename TString::value_type(' ');
     }
 
@@ -457,6 +478,26 @@ namespace etl
       return boolalpha_;
     }
 
+    //***************************************************************************
+    /// Sets the shortest flag.
+    /// Floating point values are formatted with the fewest digits that read
+    /// back as the same value. The precision is ignored.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& shortest(bool s)
+    {
+      shortest_ = s;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the shortest flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_shortest() const
+    {
+      return shortest_;
+    }
+
     //***************************************************************************
     /// Equality operator.
     //***************************************************************************
@@ -469,6 +510,7 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
+             (lhs.shortest_ == rhs.shortest_) &&
              (lhs.fill_ == rhs.fill_);
     }
 
@@ -489,6 +531,7 @@ namespace etl
     bool left_justified_;
     bool boolalpha_;
     bool show_base_;
+    bool shortest_;
     typename TString::value_type fill_;
   };
 }
@@ -53,6 +53,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_kernels.h"
 
 #ifdef ETL_COMPILER_GCC
 #pragma GCC diagnostic push
@@ -1330,21 +1331,7 @@ namespace etl
     //*********************************************************************
     size_type find(const ibasic_string<T>& str, size_type pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find(str.data(), pos, str.size());
     }
 
     //*********************************************************************
@@ -1354,23 +1341,7 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos = 0) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return find(s, pos, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1381,23 +1352,15 @@ namespace etl
     //*********************************************************************
     size_type find(const_pointer s, size_type pos, size_type n) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s) - n) > size())
+      if ((pos > size()) || (n > (size() - pos)))
       {
         return npos;
       }
-#endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
+      const_pointer p_end = p_buffer + size();
+      const_pointer p     = etl::private_string::search(static_cast<const_pointer>(p_buffer + pos), p_end, s, n);
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return (p == p_end) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1407,16 +1370,15 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return etl::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p_end = p_buffer + size();
+      const_pointer p     = etl::private_string::find_char(static_cast<const_pointer>(p_buffer + position), p_end, c);
+
+      return (p == p_end) ? npos : size_type(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1870,15 +1832,12 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
+        const_pointer p_end = p_buffer + size();
+        const_pointer p     = etl::private_string::find_first_of(static_cast<const_pointer>(p_buffer + position), p_end, s, n);
+
+        if (p != p_end)
         {
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
+          return size_type(p - p_buffer);
         }
       }
 
@@ -1892,18 +1851,7 @@ namespace etl
     //*********************************************************************
     size_type find_first_of(value_type c, size_type position = 0) const
     {
-      if (position < size())
-      {
-        for (size_type i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -2020,22 +1968,12 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_type i = position; i < size(); ++i)
-        {
-          bool found = false;
+        const_pointer p_end = p_buffer + size();
+        const_pointer p     = etl::private_string::find_first_not_of(static_cast<const_pointer>(p_buffer + position), p_end, s, n);
 
-          for (size_type j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
+        if (p != p_end)
+        {
+          return size_type(p - p_buffer);
         }
       }
 
@@ -2277,39 +2215,18 @@ namespace etl
     //*************************************************************************
     int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
     {
-      while ((first1 != last1) && (first2 != last2))
-      {
-        if (*first1 < *first2)
-        {
-          // Compared character is lower.
-          return -1;
-        }
-        else if (*first1 > *first2)
-        {
-          // Compared character is higher.
-          return 1;
-        }
+      const size_type length1 = size_type(last1 - first1);
+      const size_type length2 = size_type(last2 - first2);
 
-        ++first1;
-        ++first2;
-      }
+      const int result = etl::private_string::compare(first1, first2, etl::min(length1, length2));
 
-      // We reached the end of one or both of the strings.
-      if ((first1 == last1) && (first2 == last2))
-      {
-        // Same length.
-        return 0;
-      }
-      else if (first1 == last1)
+      if (result != 0)
       {
-        // Compared string is shorter.
-        return -1;
-      }
-      else
-      {
-        // Compared string is longer.
-        return 1;
+        return result;
       }
+
+      // One is a prefix of the other. The shorter compares lower.
+      return (length1 < length2) ? -1 : ((length1 > length2) ? 1 : 0);
     }
 
     //*************************************************************************
@@ -190,6 +190,15 @@ namespace etl
       return ss;
     }
 
+    //*********************************
+    /// etl::shortest_spec from etl::shortest & etl::noshortest stream manipulators
+    //*********************************
+    friend basic_string_stream& operator <<(basic_string_stream& ss, etl::private_basic_format_spec::shortest_spec spec)
+    {
+      ss.spec.shortest(spec.shortest);
+      return ss;
+    }
+
     //*********************************
     /// etl::left_spec from etl::left stream manipulator
     //*********************************
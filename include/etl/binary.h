@@ -1306,6 +1306,63 @@ namespace etl
     return ((static_cast<typename etl::make_unsigned<T>::type>(value) & 1U) == 0U);
   }
 
+  //***************************************************************************
+  /// Gets an nbits wide unsigned value from an array of words, starting at bit
+  /// 'position'. Bit 0 is the LSB of the first word. The value may span two
+  /// words. nbits must be from 1 to the number of bits in TWord.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename TWord>
+  ETL_CONSTEXPR14 TWord get_packed_bits(const TWord* p_words, size_t position, size_t nbits)
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TWord>::value, "Not an unsigned type");
+
+    const size_t Word_Bits = etl::integral_limits<TWord>::bits;
+
+    const TWord  mask   = (nbits == Word_Bits) ? TWord(~TWord(0)) : TWord((TWord(1) << nbits) - 1U);
+    const size_t index  = position / Word_Bits;
+    const size_t offset = position % Word_Bits;
+
+    TWord value = TWord(p_words[index] >> offset);
+
+    if ((offset + nbits) > Word_Bits)
+    {
+      value |= TWord(p_words[index + 1U] << (Word_Bits - offset));
+    }
+
+    return TWord(value & mask);
+  }
+
+  //***************************************************************************
+  /// Sets an nbits wide unsigned value in an array of words, starting at bit
+  /// 'position'. Bit 0 is the LSB of the first word. The value may span two
+  /// words. Bits of the value above nbits are ignored.
+  /// nbits must be from 1 to the number of bits in TWord.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename TWord>
+  ETL_CONSTEXPR14 void set_packed_bits(TWord* p_words, size_t position, size_t nbits, TWord value)
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TWord>::value, "Not an unsigned type");
+
+    const size_t Word_Bits = etl::integral_limits<TWord>::bits;
+
+    const TWord  mask   = (nbits == Word_Bits) ? TWord(~TWord(0)) : TWord((TWord(1) << nbits) - 1U);
+    const size_t index  = position / Word_Bits;
+    const size_t offset = position % Word_Bits;
+
+    value &= mask;
+
+    p_words[index] = TWord((p_words[index] & TWord(~TWord(mask << offset))) | TWord(value << offset));
+
+    if ((offset + nbits) > Word_Bits)
+    {
+      const size_t shift = Word_Bits - offset;
+
+      p_words[index + 1U] = TWord((p_words[index + 1U] & TWord(~TWord(mask >> shift))) | TWord(value >> shift));
+    }
+  }
+
   //***************************************************************************
   /// 8 bit binary byte constants.
   ///\ingroup binary
@@ -0,0 +1,507 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BIP_BUFFER_SPSC_ATOMIC_INCLUDED
+#define ETL_BIP_BUFFER_SPSC_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#if ETL_HAS_ATOMIC && ETL_CPP11_SUPPORTED
+
+//*****************************************************************************
+///\defgroup bip_buffer_spsc_atomic bip_buffer_spsc_atomic
+/// A fixed capacity bipartite ring buffer for one producer and one consumer.
+/// The producer reserves a contiguous block, fills it in place and commits it.
+/// If a block does not fit at the end of the buffer it is placed at the start,
+/// and the unused end is skipped by the consumer, so a block is never split.
+/// The consumer reads the committed data as one contiguous block in place.
+/// Suits variable length records, where each record is reserved and committed
+/// as a block.
+/// The values are not constructed or destroyed, so T must be trivially copyable.
+/// Requires C++11, for etl::span.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the bip_buffer_spsc_atomic.
+  ///\ingroup bip_buffer_spsc_atomic
+  //***************************************************************************
+  class bip_buffer_exception : public etl::exception
+  {
+  public:
+
+    bip_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid reserve exception for the bip_buffer_spsc_atomic.
+  /// Emitted when a commit is not for the block returned by the last reserve.
+  ///\ingroup bip_buffer_spsc_atomic
+  //***************************************************************************
+  class bip_buffer_reserve_invalid : public etl::bip_buffer_exception
+  {
+  public:
+
+    bip_buffer_reserve_invalid(string_type file_name_, numeric_type line_number_)
+      : etl::bip_buffer_exception(ETL_ERROR_TEXT("bip_buffer:reserve", ETL_BIP_BUFFER_SPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base for all bip_buffer_spsc_atomic.
+  ///\ingroup bip_buffer_spsc_atomic
+  //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class bip_buffer_spsc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of the buffer.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the buffer empty?
+    /// Accurate from the 'read' thread.
+    /// 'Not empty' is a guess from the 'write' thread.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the buffer full?
+    /// Accurate from the 'write' thread.
+    /// 'Not full' is a guess from the 'read' thread.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many values are committed and not yet read?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type write_index = write.load(etl::memory_order_acquire);
+      size_type last_index  = last.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+
+      if (write_index >= read_index)
+      {
+        return write_index - read_index;
+      }
+      else
+      {
+        return (last_index - read_index) + write_index;
+      }
+    }
+
+    //*************************************************************************
+    /// How much free space is there in the buffer?
+    /// The largest block that can be reserved may be smaller than this, as
+    /// blocks are never split.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many values can the buffer hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many values can the buffer hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    bip_buffer_spsc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        write(0),
+        last(0),
+        read(0)
+    {
+    }
+
+    // The indexes written by each thread are kept on separate cache lines
+    // when ETL_CACHE_LINE_SIZE is defined.
+
+    const size_type MAX_SIZE;     ///< The maximum number of values in the buffer.
+#if ETL_CACHE_LINE_SIZE > 0
+    char size_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> write; ///< The end of the committed data.
+    etl::atomic<size_type> last;  ///< The end of the data before the write index wrapped.
+#if ETL_CACHE_LINE_SIZE > 0
+    char write_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> read;  ///< The start of the data not yet read.
+#if ETL_CACHE_LINE_SIZE > 0
+    char read_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BIP_BUFFER_SPSC_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~bip_buffer_spsc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~bip_buffer_spsc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup bip_buffer_spsc_atomic
+  ///\brief This is the base for all bip_buffer_spsc_atomic that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived bip_buffer_spsc_atomic.
+  ///\code
+  /// etl::bip_buffer_spsc_atomic<uint8_t, 256> myBuffer;
+  /// etl::ibip_buffer_spsc_atomic<uint8_t>& iBuffer = myBuffer;
+  ///\endcode
+  /// The write_ functions must only be called from the 'write' thread and the
+  /// read_ functions from the 'read' thread.
+  /// \tparam T The type of value that the bip_buffer_spsc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class ibip_buffer_spsc_atomic : public bip_buffer_spsc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef bip_buffer_spsc_atomic_base<MEMORY_MODEL> base_t;
+
+    using base_t::write;
+    using base_t::last;
+    using base_t::read;
+    using base_t::MAX_SIZE;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+    typedef T                          value_type; ///< The type stored in the buffer.
+    typedef etl::span<T>               span_type;  ///< The type of a reserved block.
+    typedef typename base_t::size_type size_type;  ///< The type used for determining the size of the buffer.
+
+    //*************************************************************************
+    /// Reserves a contiguous block of exactly 'size' values to write to.
+    /// A block that does not fit at the end of the buffer is placed at the start.
+    ///\return The block, or an empty span if there is not enough contiguous space.
+    //*************************************************************************
+    span_type write_reserve(size_type size)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+
+      if (write_index >= read_index)
+      {
+        if ((MAX_SIZE - write_index) >= size)
+        {
+          return span_type(p_buffer + write_index, size);
+        }
+
+        // Wrap around. The write index must not catch up with the read index.
+        if (read_index > size)
+        {
+          return span_type(p_buffer, size);
+        }
+      }
+      else if ((read_index - write_index) > size)
+      {
+        return span_type(p_buffer + write_index, size);
+      }
+
+      // Not enough contiguous space.
+      return span_type();
+    }
+
+    //*************************************************************************
+    /// Reserves the largest contiguous block, of up to 'max_reserve_size'
+    /// values, to write to.
+    ///\return The block, or an empty span if the buffer is full.
+    //*************************************************************************
+    span_type write_reserve_max(size_type max_reserve_size)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = read.load(etl::memory_order_acquire);
+
+      size_type start;
+      size_type size;
+
+      if (write_index >= read_index)
+      {
+        size_type end_space   = MAX_SIZE - write_index;
+        size_type start_space = (read_index > 0) ? read_index - 1 : 0;
+
+        if (end_space >= start_space)
+        {
+          start = write_index;
+          size  = end_space;
+        }
+        else
+        {
+          start = 0;
+          size  = start_space;
+        }
+      }
+      else
+      {
+        start = write_index;
+        size  = read_index - write_index - 1;
+      }
+
+      if (size > max_reserve_size)
+      {
+        size = max_reserve_size;
+      }
+
+      if (size == 0)
+      {
+        return span_type();
+      }
+
+      return span_type(p_buffer + start, size);
+    }
+
+    //*************************************************************************
+    /// Makes a block returned by write_reserve or write_reserve_max available
+    /// to the 'read' thread.
+    /// The block may be shortened with first() to commit only the values written.
+    /// If asserts or exceptions are enabled, emits bip_buffer_reserve_invalid
+    /// if the block was not reserved.
+    //*************************************************************************
+    void write_commit(const span_type& reserve)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type start       = size_type(reserve.data() - p_buffer);
+      size_type size        = size_type(reserve.size());
+
+      if (size == 0)
+      {
+        return;
+      }
+
+      bool is_valid = (reserve.data() >= p_buffer) &&
+                      ((start == write_index) || (start == 0)) &&
+                      (size <= (MAX_SIZE - start));
+
+      ETL_ASSERT_AND_RETURN(is_valid, ETL_ERROR(bip_buffer_reserve_invalid));
+
+      if (start < write_index)
+      {
+        // The block wrapped around. The read thread must skip the rest of the end.
+        last.store(write_index, etl::memory_order_relaxed);
+      }
+
+      write.store(start + size, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Gets the oldest committed data, as one contiguous block of up to
+    /// 'max_reserve_size' values, to read in place.
+    ///\return The block, or an empty span if the buffer is empty.
+    //*************************************************************************
+    span_type read_reserve(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = write.load(etl::memory_order_acquire);
+      size_type size;
+
+      if (write_index < read_index)
+      {
+        size_type last_index = last.load(etl::memory_order_relaxed);
+
+        if (read_index == last_index)
+        {
+          // The end has been read. Continue from the start.
+          read_index = 0;
+          read.store(read_index, etl::memory_order_release);
+
+          size = write_index;
+        }
+        else
+        {
+          size = last_index - read_index;
+        }
+      }
+      else
+      {
+        size = write_index - read_index;
+      }
+
+      if (size > max_reserve_size)
+      {
+        size = max_reserve_size;
+      }
+
+      if (size == 0)
+      {
+        return span_type();
+      }
+
+      return span_type(p_buffer + read_index, size);
+    }
+
+    //*************************************************************************
+    /// Frees a block returned by read_reserve for the 'write' thread.
+    /// The block may be shortened with first() to free only the values read.
+    /// If asserts or exceptions are enabled, emits bip_buffer_reserve_invalid
+    /// if the block was not reserved.
+    //*************************************************************************
+    void read_commit(const span_type& reserve)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type size       = size_type(reserve.size());
+
+      if (size == 0)
+      {
+        return;
+      }
+
+      bool is_valid = (reserve.data() == (p_buffer + read_index)) &&
+                      (size <= (MAX_SIZE - read_index));
+
+      ETL_ASSERT_AND_RETURN(is_valid, ETL_ERROR(bip_buffer_reserve_invalid));
+
+      read.store(read_index + size, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Discards all of the committed data.
+    /// Must be called from the 'read' thread or when there is no possibility
+    /// of concurrent access.
+    //*************************************************************************
+    void clear()
+    {
+      read.store(write.load(etl::memory_order_acquire), etl::memory_order_release);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    ibip_buffer_spsc_atomic(T* p_buffer_, size_type max_size_)
+      : base_t(max_size_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    ibip_buffer_spsc_atomic(const ibip_buffer_spsc_atomic&) = delete;
+    ibip_buffer_spsc_atomic& operator =(const ibip_buffer_spsc_atomic&) = delete;
+    ibip_buffer_spsc_atomic(ibip_buffer_spsc_atomic&&) = delete;
+    ibip_buffer_spsc_atomic& operator =(ibip_buffer_spsc_atomic&&) = delete;
+
+    T* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup bip_buffer_spsc_atomic
+  /// A fixed capacity bipartite ring buffer.
+  /// This buffer supports concurrent access by one producer and one consumer.
+  /// \tparam T            The type this buffer should support.
+  /// \tparam SIZE         The maximum capacity of the buffer.
+  /// \tparam MEMORY_MODEL The memory model for the buffer. Determines the type of the internal index variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class bip_buffer_spsc_atomic : public etl::ibip_buffer_spsc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::ibip_buffer_spsc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((SIZE <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    bip_buffer_spsc_atomic()
+      : base_t(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+    }
+
+  private:
+
+    /// The uninitialised buffer of T used in the bip_buffer_spsc_atomic.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -28,6 +28,7 @@ SOFTWARE.
 
 #include <stdint.h>
 #include <limits.h>
+#include <string.h>
 
 #include "platform.h"
 #include "type_traits.h"
@@ -548,6 +549,526 @@ namespace etl
     size_t        byte_index;     ///< The index of the char in the bitstream buffer.
     size_t        bits_remaining; ///< The number of bits still available in the bitstream buffer.
   };
+
+#if ETL_USING_64BIT_TYPES
+  namespace private_bit_stream
+  {
+    //*************************************************************************
+    /// Stores a 64 bit word in network order.
+    //*************************************************************************
+    inline void store_word(unsigned char* p, uint64_t word)
+    {
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        word = etl::reverse_bytes(word);
+      }
+
+      memcpy(p, &word, sizeof(word));
+    }
+
+    //*************************************************************************
+    /// Loads a 64 bit word in network order.
+    //*************************************************************************
+    inline uint64_t load_word(const unsigned char* p)
+    {
+      uint64_t word;
+      memcpy(&word, p, sizeof(word));
+
+      if (etl::endianness::value() == etl::endian::little)
+      {
+        word = etl::reverse_bytes(word);
+      }
+
+      return word;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes a bitstream in the same format as etl::bit_stream.
+  /// Bits are collected in a 64 bit accumulator and stored to the buffer a
+  /// word at a time. Byte aligned runs of bytes are copied with memcpy.
+  /// Call flush() before using the contents of the buffer.
+  //***************************************************************************
+  class bit_stream_writer
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    bit_stream_writer(void* begin_, size_t length_)
+      : pdata(static_cast<unsigned char*>(begin_))
+      , length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    bit_stream_writer(void* begin_, void* end_)
+      : pdata(static_cast<unsigned char*>(begin_))
+      , length(size_t(static_cast<unsigned char*>(end_) - static_cast<unsigned char*>(begin_)))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Sets the stream back to the beginning.
+    //*************************************************************************
+    void restart()
+    {
+      accumulator      = 0U;
+      accumulator_bits = 0U;
+      byte_index       = 0U;
+    }
+
+    //*************************************************************************
+    /// Writes a boolean.
+    //*************************************************************************
+    bool write(bool value)
+    {
+      return write_bits(value ? 1U : 0U, 1U);
+    }
+
+    //*************************************************************************
+    /// Writes the lower 'width' bits of an integral value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (sizeof(T) <= sizeof(uint32_t)), bool>::type
+      write(T value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      return write_bits(static_cast<uint32_t>(value), width);
+    }
+
+    //*************************************************************************
+    /// Writes the lower 'width' bits of a 64 bit integral value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (sizeof(T) > sizeof(uint32_t)), bool>::type
+      write(T value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (width > available_bits())
+      {
+        return false;
+      }
+
+      const uint64_t u = static_cast<uint64_t>(value);
+
+      if (width > 32U)
+      {
+        write_bits(uint32_t(u >> 32U), uint_least8_t(width - 32U));
+        width = 32U;
+      }
+
+      return write_bits(uint32_t(u), width);
+    }
+
+    //*************************************************************************
+    /// Writes a run of bytes.
+    /// If the stream is on a byte boundary the bytes are copied with memcpy.
+    //*************************************************************************
+    bool write_bytes(const void* data, size_t n)
+    {
+      if ((n * CHAR_BIT) > available_bits())
+      {
+        return false;
+      }
+
+      const unsigned char* p = static_cast<const unsigned char*>(data);
+
+      if ((accumulator_bits % CHAR_BIT) == 0U)
+      {
+        store_whole_bytes();
+        memcpy(pdata + byte_index, p, n);
+        byte_index += n;
+      }
+      else
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          write_bits(p[i], CHAR_BIT);
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Stores the bits held in the accumulator to the buffer.
+    /// A partly written byte is stored padded with zeros, and later writes
+    /// carry on from the same bit.
+    //*************************************************************************
+    void flush()
+    {
+      store_whole_bytes();
+
+      if (accumulator_bits != 0U)
+      {
+        pdata[byte_index] = static_cast<unsigned char>(accumulator >> 56U);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of bits written.
+    //*************************************************************************
+    size_t size_bits() const
+    {
+      return (byte_index * CHAR_BIT) + accumulator_bits;
+    }
+
+    //*************************************************************************
+    /// The number of bytes used, including a partly written byte.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return (size_bits() + CHAR_BIT - 1U) / CHAR_BIT;
+    }
+
+    //*************************************************************************
+    /// The number of bits that can still be written.
+    //*************************************************************************
+    size_t available_bits() const
+    {
+      return (length * CHAR_BIT) - size_bits();
+    }
+
+    //*************************************************************************
+    /// The start of the buffer.
+    //*************************************************************************
+    const unsigned char* data() const
+    {
+      return pdata;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Writes up to 32 bits.
+    //*************************************************************************
+    bool write_bits(uint32_t value, uint_least8_t width)
+    {
+      if (width > available_bits())
+      {
+        return false;
+      }
+
+      if (width == 0U)
+      {
+        return true;
+      }
+
+      uint64_t bits = uint64_t(value) & (~uint64_t(0U) >> (64U - width));
+
+      const size_t total = accumulator_bits + width;
+
+      if (total < 64U)
+      {
+        accumulator      |= bits << (64U - total);
+        accumulator_bits  = total;
+      }
+      else
+      {
+        // Fill the accumulator, store it, and keep the bits that did not fit.
+        const size_t spill = total - 64U;
+
+        accumulator |= bits >> spill;
+        private_bit_stream::store_word(pdata + byte_index, accumulator);
+        byte_index += sizeof(uint64_t);
+
+        accumulator      = (spill == 0U) ? 0U : (bits << (64U - spill));
+        accumulator_bits = spill;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Stores the whole bytes in the accumulator.
+    //*************************************************************************
+    void store_whole_bytes()
+    {
+      while (accumulator_bits >= CHAR_BIT)
+      {
+        pdata[byte_index++] = static_cast<unsigned char>(accumulator >> 56U);
+        accumulator      <<= CHAR_BIT;
+        accumulator_bits  -= CHAR_BIT;
+      }
+    }
+
+    unsigned char* pdata;            ///< The start of the buffer.
+    size_t         length;           ///< The length of the buffer, in bytes.
+    uint64_t       accumulator;      ///< Bits not yet stored, most significant first.
+    size_t         accumulator_bits; ///< The number of bits in the accumulator.
+    size_t         byte_index;       ///< The index of the next byte to store.
+  };
+
+  //***************************************************************************
+  /// Reads a bitstream in the same format as etl::bit_stream.
+  /// Bits are loaded into a 64 bit accumulator a word at a time. Byte aligned
+  /// runs of bytes are copied with memcpy.
+  //***************************************************************************
+  class bit_stream_reader
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    bit_stream_reader(const void* begin_, size_t length_)
+      : pdata(static_cast<const unsigned char*>(begin_))
+      , length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    bit_stream_reader(const void* begin_, const void* end_)
+      : pdata(static_cast<const unsigned char*>(begin_))
+      , length(size_t(static_cast<const unsigned char*>(end_) - static_cast<const unsigned char*>(begin_)))
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Sets the stream back to the beginning.
+    //*************************************************************************
+    void restart()
+    {
+      accumulator      = 0U;
+      accumulator_bits = 0U;
+      byte_index       = 0U;
+    }
+
+    //*************************************************************************
+    /// Reads a boolean.
+    //*************************************************************************
+    bool read(bool& value)
+    {
+      uint32_t bit;
+
+      if (!read_bits(bit, 1U))
+      {
+        return false;
+      }
+
+      value = (bit != 0U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads 'width' bits into an integral value.
+    /// Signed values are sign extended.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      read(T& value, uint_least8_t width = CHAR_BIT * sizeof(T))
+    {
+      if (width > available_bits())
+      {
+        return false;
+      }
+
+      uint64_t u = 0U;
+      uint32_t bits = 0U;
+
+      if (width > 32U)
+      {
+        read_bits(bits, uint_least8_t(width - 32U));
+        u = uint64_t(bits) << 32U;
+        read_bits(bits, 32U);
+      }
+      else
+      {
+        read_bits(bits, width);
+      }
+
+      u |= bits;
+      value = static_cast<T>(u);
+
+      // Sign extend if signed type and not already full bit width.
+      if (etl::is_signed<T>::value && (width != (CHAR_BIT * sizeof(T))) && (width != 0U))
+      {
+        typedef typename etl::make_signed<T>::type ST;
+        value = etl::sign_extend<ST, ST>(value, width);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads a run of bytes.
+    /// If the stream is on a byte boundary the bytes are copied with memcpy.
+    //*************************************************************************
+    bool read_bytes(void* data, size_t n)
+    {
+      if ((n * CHAR_BIT) > available_bits())
+      {
+        return false;
+      }
+
+      unsigned char* p = static_cast<unsigned char*>(data);
+
+      if ((accumulator_bits % CHAR_BIT) == 0U)
+      {
+        // Use the bytes already in the accumulator first.
+        while ((n != 0U) && (accumulator_bits != 0U))
+        {
+          *p++ = static_cast<unsigned char>(accumulator >> 56U);
+          accumulator      <<= CHAR_BIT;
+          accumulator_bits  -= CHAR_BIT;
+          --n;
+        }
+
+        memcpy(p, pdata + byte_index, n);
+        byte_index += n;
+      }
+      else
+      {
+        uint32_t byte;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          read_bits(byte, CHAR_BIT);
+          p[i] = static_cast<unsigned char>(byte);
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Skips a number of bits.
+    //*************************************************************************
+    bool skip(size_t n)
+    {
+      if (n > available_bits())
+      {
+        return false;
+      }
+
+      uint32_t bits;
+
+      while (n > 32U)
+      {
+        read_bits(bits, 32U);
+        n -= 32U;
+      }
+
+      read_bits(bits, uint_least8_t(n));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The number of bits read.
+    //*************************************************************************
+    size_t position_bits() const
+    {
+      return (byte_index * CHAR_BIT) - accumulator_bits;
+    }
+
+    //*************************************************************************
+    /// The number of bits that can still be read.
+    //*************************************************************************
+    size_t available_bits() const
+    {
+      return (length * CHAR_BIT) - position_bits();
+    }
+
+    //*************************************************************************
+    /// Returns true if every bit has been read.
+    //*************************************************************************
+    bool at_end() const
+    {
+      return available_bits() == 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reads up to 32 bits.
+    //*************************************************************************
+    bool read_bits(uint32_t& value, uint_least8_t width)
+    {
+      if (width == 0U)
+      {
+        value = 0U;
+        return true;
+      }
+
+      if (accumulator_bits < width)
+      {
+        refill();
+
+        if (accumulator_bits < width)
+        {
+          return false;
+        }
+      }
+
+      value = uint32_t(accumulator >> (64U - width));
+      accumulator      <<= width;
+      accumulator_bits  -= width;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Loads as many whole bytes as fit into the accumulator.
+    /// Bits below those in use are kept at zero.
+    //*************************************************************************
+    void refill()
+    {
+      const size_t n_bytes = (64U - accumulator_bits) / CHAR_BIT;
+
+      if ((byte_index + sizeof(uint64_t)) <= length)
+      {
+        const uint64_t word = private_bit_stream::load_word(pdata + byte_index);
+
+        if (accumulator_bits == 0U)
+        {
+          accumulator = word;
+        }
+        else
+        {
+          uint64_t bits = word >> accumulator_bits;
+
+          // Keep only the whole bytes.
+          const size_t used = accumulator_bits + (n_bytes * CHAR_BIT);
+
+          if (used < 64U)
+          {
+            bits &= ~(~uint64_t(0U) >> used);
+          }
+
+          accumulator |= bits;
+        }
+
+        byte_index       += n_bytes;
+        accumulator_bits += n_bytes * CHAR_BIT;
+      }
+      else
+      {
+        // Near the end of the buffer.
+        while ((accumulator_bits <= (64U - CHAR_BIT)) && (byte_index < length))
+        {
+          accumulator      |= uint64_t(pdata[byte_index++]) << (64U - CHAR_BIT - accumulator_bits);
+          accumulator_bits += CHAR_BIT;
+        }
+      }
+    }
+
+    const unsigned char* pdata;            ///< The start of the buffer.
+    size_t               length;           ///< The length of the buffer, in bytes.
+    uint64_t             accumulator;      ///< Bits loaded but not yet read, most significant first.
+    size_t               accumulator_bits; ///< The number of bits in the accumulator.
+    size_t               byte_index;       ///< The index of the next byte to load.
+  };
+#endif
 }
 
 #include "private/minmax_pop.h"
@@ -76,6 +76,17 @@ SOFTWARE.
 ///\ingroup containers
 //*****************************************************************************
 
+//*****************************************************************************
+/// A bitset may be constexpr from C++14, so that one at namespace scope is
+/// constant initialised and can be placed in ROM. A polymorphic bitset has a
+/// virtual destructor, so needs C++20.
+//*****************************************************************************
+#if ETL_CPP14_SUPPORTED && (ETL_CPP20_SUPPORTED || !(defined(ETL_POLYMORPHIC_BITSET) || defined(ETL_POLYMORPHIC_CONTAINERS)))
+  #define ETL_HAS_CONSTEXPR_BITSET 1
+#else
+  #define ETL_HAS_CONSTEXPR_BITSET 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -120,6 +131,70 @@ namespace etl
     }
   };
 
+  namespace private_bitset
+  {
+    //*************************************************************************
+    /// The number of set bits in an element.
+    /// GCC and Clang use the hardware population count where there is one.
+    //*************************************************************************
+    template <typename T>
+    size_t count_bits(T value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      if (sizeof(T) <= sizeof(unsigned int))
+      {
+        return size_t(__builtin_popcount(static_cast<unsigned int>(value)));
+      }
+      else
+      {
+        return size_t(__builtin_popcountll(static_cast<unsigned long long>(value)));
+      }
+#elif ETL_USING_64BIT_TYPES
+      if (sizeof(T) <= sizeof(uint32_t))
+      {
+        return size_t(etl::count_bits(static_cast<uint32_t>(value)));
+      }
+      else
+      {
+        return size_t(etl::count_bits(static_cast<uint64_t>(value)));
+      }
+#else
+      return size_t(etl::count_bits(static_cast<uint32_t>(value)));
+#endif
+    }
+
+    //*************************************************************************
+    /// The index of the lowest set bit in an element. The value must not be zero.
+    /// GCC and Clang use the hardware instructions where there are some,
+    /// such as BSF/TZCNT on x86 and RBIT/CLZ on ARM.
+    //*************************************************************************
+    template <typename T>
+    size_t lowest_bit(T value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      if (sizeof(T) <= sizeof(unsigned int))
+      {
+        return size_t(__builtin_ctz(static_cast<unsigned int>(value)));
+      }
+      else
+      {
+        return size_t(__builtin_ctzll(static_cast<unsigned long long>(value)));
+      }
+#elif ETL_USING_64BIT_TYPES
+      if (sizeof(T) <= sizeof(uint32_t))
+      {
+        return size_t(etl::count_trailing_zeros(static_cast<uint32_t>(value)));
+      }
+      else
+      {
+        return size_t(etl::count_trailing_zeros(static_cast<uint64_t>(value)));
+      }
+#else
+      return size_t(etl::count_trailing_zeros(static_cast<uint32_t>(value)));
+#endif
+    }
+  }
+
   //*************************************************************************
   /// The base class for etl::bitset
   ///\ingroup bitset
@@ -129,8 +204,10 @@ namespace etl
   protected:
 
     // The type used for each element in the array.
+    // Defaults to the native word size, so that the bits are scanned a word at a time.
+    // Define ETL_BITSET_ELEMENT_TYPE as uint8_t for the smallest storage.
 #if !defined(ETL_BITSET_ELEMENT_TYPE)
-    typedef uint_least8_t element_t;
+    typedef size_t element_t;
 #else
     typedef ETL_BITSET_ELEMENT_TYPE element_t;
 #endif
@@ -231,7 +308,7 @@ namespace etl
     //*************************************************************************
     /// The size of the bitset.
     //*************************************************************************
-    size_t size() const
+    ETL_CONSTEXPR14 size_t size() const
     {
       return NBITS;
     }
@@ -245,7 +322,7 @@ namespace etl
 
       for (size_t i = 0; i < SIZE; ++i)
       {
-        n += etl::count_bits(pdata[i]);
+        n += private_bitset::count_bits(pdata[i]);
       }
 
       return n;
@@ -255,10 +332,10 @@ namespace etl
     /// Tests a bit at a position.
     /// Positions greater than the number of configured bits will return <b>false</b>.
     //*************************************************************************
-    bool test(size_t position) const
+    ETL_CONSTEXPR14 bool test(size_t position) const
     {
-      size_t    index;
-      element_t mask;
+      size_t    index = 0;
+      element_t mask  = 0;
 
       if (SIZE == 1)
       {
@@ -412,30 +489,33 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      T v = T(0);
+      // Shifting signed values is undefined, so the value is built unsigned.
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      unsigned_t v = unsigned_t(0);
 
-      const bool OK = (sizeof(T) * CHAR_BIT) >= (SIZE * BITS_PER_ELEMENT);
+      const bool OK = (sizeof(T) * CHAR_BIT) >= NBITS;
 
       ETL_ASSERT(OK, ETL_ERROR(etl::bitset_type_too_small));
 
       if (OK)
       {
-        T shift = T(0);
+        size_t shift = 0U;
 
         for (size_t i = 0; i < SIZE; ++i)
         {
-          v |= T(pdata[i]) << shift;
-          shift += T(BITS_PER_ELEMENT);
+          v |= unsigned_t(pdata[i]) << shift;
+          shift += BITS_PER_ELEMENT;
         }
       }
 
-      return v;
+      return T(v);
     }
 
     //*************************************************************************
     /// Resets the bitset.
     //*************************************************************************
-    ibitset& reset()
+    ETL_CONSTEXPR14 ibitset& reset()
     {
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -576,66 +656,98 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
-      // Where to start.
-      size_t index;
-      size_t bit;
-
-      if (SIZE == 1)
+      if (position >= NBITS)
       {
-        index = 0;
-        bit = position;
+        return ibitset::npos;
       }
-      else
+
+      // Searching for clear bits inverts the elements, so that the search is always for a set bit.
+      const element_t invert = state ? element_t(ALL_CLEAR) : element_t(ALL_SET);
+
+      size_t index = position >> log2<BITS_PER_ELEMENT>::value;
+
+      // Ignore the bits before the position in the first element.
+      element_t value = element_t((pdata[index] ^ invert) & element_t(ALL_SET << (position & (BITS_PER_ELEMENT - 1))));
+
+      while (value == ALL_CLEAR)
       {
-        index = position >> log2<BITS_PER_ELEMENT>::value;
-        bit = position & (BITS_PER_ELEMENT - 1);
+        if (++index == SIZE)
+        {
+          return ibitset::npos;
+        }
+
+        value = element_t(pdata[index] ^ invert);
       }
 
-      element_t mask = 1 << bit;
+      position = (index * BITS_PER_ELEMENT) + private_bitset::lowest_bit(value);
 
-      // For each element in the bitset...
-      while (index < SIZE)
+      // Clear bits above the top of the bitset are not part of it.
+      return (position < NBITS) ? position : size_t(ibitset::npos);
+    }
+
+    //*************************************************************************
+    /// Calls a function with the position of each set bit, in ascending order.
+    /// Each element is visited once, and its lowest set bit cleared after each call.
+    ///\param function The function to call. Takes the position as a size_t.
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_set_bit(TFunction function) const
+    {
+      for (size_t i = 0; i < SIZE; ++i)
       {
-        element_t value = pdata[index];
+        element_t value = pdata[i];
 
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-            (!state && (value != ALL_SET)))
-        {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
+        while (value != ALL_CLEAR)
         {
-          position += (BITS_PER_ELEMENT - bit);
+          function((i * BITS_PER_ELEMENT) + private_bitset::lowest_bit(value));
+          value &= element_t(value - 1U);
         }
+      }
+
+      return function;
+    }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+    //*************************************************************************
+    /// Counts the bits that are set in both bitsets, without creating the
+    /// intersection.
+    //*************************************************************************
+    size_t and_count(const ibitset& other) const
+    {
+      const size_t n = etl::min(SIZE, other.SIZE);
 
-        ++index;
+      size_t count = 0U;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        count += private_bitset::count_bits(element_t(pdata[i] & other.pdata[i]));
       }
 
-      return ibitset::npos;
+      return count;
+    }
+
+    //*************************************************************************
+    /// Are any bits set in both bitsets?
+    //*************************************************************************
+    bool intersects(const ibitset& other) const
+    {
+      const size_t n = etl::min(SIZE, other.SIZE);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        if ((pdata[i] & other.pdata[i]) != ALL_CLEAR)
+        {
+          return true;
+        }
+      }
+
+      return false;
     }
 
     //*************************************************************************
     /// Read [] operator.
     //*************************************************************************
-    bool operator[] (size_t position) const
+    ETL_CONSTEXPR14 bool operator[] (size_t position) const
     {
       return test(position);
     }
@@ -695,6 +807,7 @@ namespace etl
       if (SIZE == 1)
       {
         pdata[0] <<= shift;
+        pdata[0] &= TOP_MASK;
       }
       else
       {
@@ -767,7 +880,9 @@ namespace etl
 #if ETL_CPP11_SUPPORTED
     //*************************************************************************
     /// span
-    /// Returns a span of the underlying data.
+    /// Returns a span of the underlying data, lowest bits first.
+    /// The unused bits above the top of the bitset are always clear, and
+    /// must be left clear if the elements are modified.
     //*************************************************************************
     span_type span()
     {
@@ -789,7 +904,7 @@ namespace etl
     //*************************************************************************
     /// Initialise from an unsigned long long.
     //*************************************************************************
-    ibitset& initialise(unsigned long long value)
+    ETL_CONSTEXPR14 ibitset& initialise(unsigned long long value)
     {
       reset();
 
@@ -825,6 +940,8 @@ namespace etl
       {
         pdata[i] = ~pdata[i];
       }
+
+      pdata[SIZE - 1] &= TOP_MASK;
     }
 
     //*************************************************************************
@@ -838,14 +955,22 @@ namespace etl
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
-    ibitset(size_t nbits_, size_t size_, element_t* pdata_)
-      : NBITS(nbits_),
+    ETL_CONSTEXPR14 ibitset(size_t nbits_, size_t size_, element_t* pdata_)
+      : TOP_MASK(top_mask(nbits_, size_)),
+        NBITS(nbits_),
         SIZE(size_),
         pdata(pdata_)
     {
-      size_t allocated_bits = SIZE * BITS_PER_ELEMENT;
-      size_t top_mask_shift = ((BITS_PER_ELEMENT - (allocated_bits - NBITS)) % BITS_PER_ELEMENT);
-      TOP_MASK = element_t(top_mask_shift == 0 ? ALL_SET : ~(ALL_SET << top_mask_shift));
+    }
+
+    //*************************************************************************
+    /// The mask for the used bits of the top element.
+    //*************************************************************************
+    static ETL_CONSTEXPR element_t top_mask(size_t nbits_, size_t size_)
+    {
+      return ((BITS_PER_ELEMENT - ((size_ * BITS_PER_ELEMENT) - nbits_)) % BITS_PER_ELEMENT) == 0
+               ? element_t(ALL_SET)
+               : element_t(~(ALL_SET << ((BITS_PER_ELEMENT - ((size_ * BITS_PER_ELEMENT) - nbits_)) % BITS_PER_ELEMENT)));
     }
 
     //*************************************************************************
@@ -872,14 +997,22 @@ namespace etl
     //*************************************************************************
 #if defined(ETL_POLYMORPHIC_BITSET) || defined(ETL_POLYMORPHIC_CONTAINERS)
   public:
+  #if ETL_CPP11_SUPPORTED
+    virtual ~ibitset() = default;
+  #else
     virtual ~ibitset()
     {
     }
+  #endif
 #else
   protected:
+  #if ETL_CPP11_SUPPORTED
+    ~ibitset() = default;
+  #else
     ~ibitset()
     {
     }
+  #endif
 #endif
   };
 
@@ -905,26 +1038,31 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    bitset()
+    ETL_CONSTEXPR14 bitset()
       : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      , data()
     {
-      reset();
     }
 
     //*************************************************************************
     /// Copy constructor.
     //*************************************************************************
-    bitset(const bitset<MAXN>& other)
+    ETL_CONSTEXPR14 bitset(const bitset<MAXN>& other)
       : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      , data()
     {
-      etl::copy_n(other.data, ARRAY_SIZE, data);
+      for (size_t i = 0U; i < ARRAY_SIZE; ++i)
+      {
+        data[i] = other.data[i];
+      }
     }
 
     //*************************************************************************
     /// Construct from a value.
     //*************************************************************************
-    bitset(unsigned long long value)
+    ETL_CONSTEXPR14 bitset(unsigned long long value)
       : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      , data()
     {
       initialise(value);
     }
@@ -934,6 +1072,7 @@ namespace etl
     //*************************************************************************
     bitset(const char* text)
       : etl::ibitset(MAXN, ARRAY_SIZE, data)
+      , data()
     {
       set(text);
     }
@@ -1014,7 +1153,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= (ARRAY_SIZE * BITS_PER_ELEMENT), "Type too small");
+      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= MAXN, "Type too small");
 
       return ibitset::value<T>();
     }
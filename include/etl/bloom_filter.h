@@ -39,6 +39,8 @@ SOFTWARE.
 #include "log.h"
 #include "power.h"
 
+#include <stdint.h>
+
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
 ///\ingroup containers
@@ -184,7 +186,655 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
-}
 
+  //***************************************************************************
+  /// A cache blocked implementation of a bloom filter.
+  /// All of the probes for a key fall within one 64 byte block, so a lookup
+  /// touches a single cache line. The K probe positions are derived from two
+  /// hashes using double hashing (Kirsch-Mitzenmacher).
+  /// Hashes must support the () operator and define 'argument_type'.
+  ///\tparam DESIRED_WIDTH The desired number of bits. Rounded up to a power of 2 number of blocks.
+  ///\tparam K             The number of probes per key.
+  ///\tparam THash1        The first hash generator class. Selects the block.
+  ///\tparam THash2        The second hash generator class. Sets the probe stride.
+  /// The hash classes must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            const size_t K,
+            typename     THash1,
+            typename     THash2>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+
+    enum
+    {
+      BLOCK_SIZE      = 64,
+      BITS_PER_WORD   = 32,
+      WORDS_PER_BLOCK = BLOCK_SIZE / sizeof(uint32_t),
+      MINIMUM_BLOCKS  = (DESIRED_WIDTH + (BLOCK_SIZE * 8) - 1) / (BLOCK_SIZE * 8)
+    };
+
+    // Hashes are computed and their blocks prefetched this many keys ahead of the probes.
+    static ETL_CONSTANT size_t BATCH_SIZE = 8U;
+
+  public:
+
+    ETL_STATIC_ASSERT(DESIRED_WIDTH > 0, "Width must be greater than zero");
+    ETL_STATIC_ASSERT((K > 0) && (K <= 16), "K must be in the range 1 to 16");
+
+    enum
+    {
+      BLOCK_BITS       = BLOCK_SIZE * 8,
+      NUMBER_OF_BLOCKS = ((MINIMUM_BLOCKS == 1) || etl::is_power_of_2<MINIMUM_BLOCKS>::value) ? size_t(MINIMUM_BLOCKS) : size_t(etl::power_of_2_round_up<MINIMUM_BLOCKS>::value),
+      WIDTH            = NUMBER_OF_BLOCKS * BLOCK_BITS,
+      NUMBER_OF_PROBES = K
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < N_WORDS; ++i)
+      {
+        flags[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const size_t hash1 = THash1()(key);
+      const size_t hash2 = THash2()(key);
+
+      uint32_t* block = get_block(hash1);
+
+      size_t probe = get_first_probe(hash1);
+      const size_t stride = get_stride(hash2);
+
+      for (size_t i = 0U; i < K; ++i)
+      {
+        const size_t bit = probe & (BLOCK_BITS - 1);
+        block[bit / BITS_PER_WORD] |= uint32_t(1U) << (bit % BITS_PER_WORD);
+        probe += stride;
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      const size_t hash1 = THash1()(key);
+      const size_t hash2 = THash2()(key);
+
+      return probe_block(get_block(hash1), get_first_probe(hash1), get_stride(hash2));
+    }
+
+    //***************************************************************************
+    /// Tests a range of keys to see if they exist in the filter.
+    /// The hashes for a batch of keys are calculated and the blocks prefetched
+    /// before any of them are probed, so that the cache misses overlap.
+    ///\param first  The first key to test.
+    ///\param last   One past the last key to test.
+    ///\param result Output iterator that receives a <b>bool</b> result for each key.
+    ///\return The output iterator, one past the last result.
+    //***************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator exists(TInputIterator first, TInputIterator last, TOutputIterator result) const
+    {
+      const uint32_t* blocks[BATCH_SIZE];
+      size_t          probes[BATCH_SIZE];
+      size_t          strides[BATCH_SIZE];
+
+      while (first != last)
+      {
+        size_t count = 0U;
+
+        while ((count < BATCH_SIZE) && (first != last))
+        {
+          const size_t hash1 = THash1()(*first);
+          const size_t hash2 = THash2()(*first);
+
+          blocks[count]  = get_block(hash1);
+          probes[count]  = get_first_probe(hash1);
+          strides[count] = get_stride(hash2);
+
+          ETL_PREFETCH(blocks[count]);
+
+          ++first;
+          ++count;
+        }
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          *result++ = probe_block(blocks[i], probes[i], strides[i]);
+        }
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < N_WORDS; ++i)
+      {
+        n += etl::count_bits(flags[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t N_WORDS = NUMBER_OF_BLOCKS * WORDS_PER_BLOCK;
+
+    //***************************************************************************
+    /// Gets the block selected by the first hash.
+    //***************************************************************************
+    uint32_t* get_block(size_t hash1)
+    {
+      return &flags[(hash1 & (NUMBER_OF_BLOCKS - 1)) * WORDS_PER_BLOCK];
+    }
+
+    //***************************************************************************
+    const uint32_t* get_block(size_t hash1) const
+    {
+      return &flags[(hash1 & (NUMBER_OF_BLOCKS - 1)) * WORDS_PER_BLOCK];
+    }
+
+    //***************************************************************************
+    /// Gets the first probe from the bits of the first hash not used to
+    /// select the block.
+    //***************************************************************************
+    static size_t get_first_probe(size_t hash1)
+    {
+      return hash1 >> etl::log2<NUMBER_OF_BLOCKS>::value;
+    }
+
+    //***************************************************************************
+    /// Gets the probe stride from the second hash.
+    /// The stride is odd, so the K probes within a block are all distinct.
+    //***************************************************************************
+    static size_t get_stride(size_t hash2)
+    {
+      return hash2 | 1U;
+    }
+
+    //***************************************************************************
+    /// Tests the K probes within a block.
+    //***************************************************************************
+    static bool probe_block(const uint32_t* block, size_t probe, size_t stride)
+    {
+      for (size_t i = 0U; i < K; ++i)
+      {
+        const size_t bit = probe & (BLOCK_BITS - 1);
+
+        if ((block[bit / BITS_PER_WORD] & (uint32_t(1U) << (bit % BITS_PER_WORD))) == 0U)
+        {
+          return false;
+        }
+
+        probe += stride;
+      }
+
+      return true;
+    }
+
+    /// The Bloom filter flags, aligned to the block size where supported.
+#if ETL_CPP11_SUPPORTED && !defined(ETL_COMPILER_ARM5)
+    alignas(BLOCK_SIZE) uint32_t flags[N_WORDS];
+#else
+    uint32_t flags[N_WORDS];
 #endif
+  };
+
+  //***************************************************************************
+  /// A counting bloom filter.
+  /// Each flag is replaced by a 4 bit saturating counter, which allows keys to
+  /// be removed. A counter that saturates is never decremented, so removing
+  /// keys can never cause a false negative.
+  /// Allows up to three hashes to be defined.
+  /// Hashes must support the () operator and define 'argument_type'.
+  ///\tparam DESIRED_WIDTH The desired number of counters. Rounded up to an even number.
+  ///\tparam THash1        The first hash generator class.
+  ///\tparam THash2        The second hash generator class. If omitted, uses the null hash.
+  ///\tparam THash3        The third hash generator class.  If omitted, uses the null hash.
+  /// The hash classes must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            typename     THash1,
+            typename     THash2 = private_bloom_filter::null_hash,
+            typename     THash3 = private_bloom_filter::null_hash>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+    typedef private_bloom_filter::null_hash null_hash;
+
+  public:
+
+    ETL_STATIC_ASSERT(DESIRED_WIDTH > 0, "Width must be greater than zero");
+
+    enum
+    {
+      // Two counters are packed into each byte.
+      WIDTH     = DESIRED_WIDTH + (DESIRED_WIDTH % 2),
+      MAX_COUNT = 15
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (WIDTH / 2); ++i)
+      {
+        counters[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      increment(get_hash<THash1>(key));
+
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        increment(get_hash<THash2>(key));
+      }
+
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        increment(get_hash<THash3>(key));
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Does nothing if the key does not exist in the filter.
+    /// Removing a key that was never added may cause false negatives for keys
+    /// that share its counters.
+    ///\param key The key to remove.
+    //***************************************************************************
+    void remove(parameter_t key)
+    {
+      if (exists(key))
+      {
+        decrement(get_hash<THash1>(key));
+
+        if (!etl::is_same<THash2, null_hash>::value)
+        {
+          decrement(get_hash<THash2>(key));
+        }
+
+        if (!etl::is_same<THash3, null_hash>::value)
+        {
+          decrement(get_hash<THash3>(key));
+        }
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      bool exists1 = (get_counter(get_hash<THash1>(key)) != 0U);
+      bool exists2 = true;
+      bool exists3 = true;
+
+      // Do we have a second hash?
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        exists2 = (get_counter(get_hash<THash2>(key)) != 0U);
+      }
+
+      // Do we have a third hash?
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        exists3 = (get_counter(get_hash<THash3>(key)) != 0U);
+      }
+
+      return exists1 && exists2 && exists3;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of non-zero counters.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < WIDTH; ++i)
+      {
+        if (get_counter(i) != 0U)
+        {
+          ++n;
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the hash for the key.
+    ///\param  key The key.
+    ///\return The hash value.
+    //***************************************************************************
+    template <typename THash>
+    size_t get_hash(parameter_t key) const
+    {
+      size_t hash = THash()(key);
+
+      // Fold the hash down to fit the width.
+      return fold_bits<size_t, etl::log2<WIDTH>::value>(hash);
+    }
+
+    //***************************************************************************
+    /// Gets the counter at an index.
+    //***************************************************************************
+    uint8_t get_counter(size_t index) const
+    {
+      return (counters[index / 2] >> ((index % 2) * 4)) & MAX_COUNT;
+    }
+
+    //***************************************************************************
+    /// Increments the counter at an index, saturating at MAX_COUNT.
+    //***************************************************************************
+    void increment(size_t index)
+    {
+      if (get_counter(index) != MAX_COUNT)
+      {
+        counters[index / 2] += uint8_t(1U << ((index % 2) * 4));
+      }
+    }
 
+    //***************************************************************************
+    /// Decrements the counter at an index.
+    /// Saturated counters are left unchanged, as their true count is unknown.
+    //***************************************************************************
+    void decrement(size_t index)
+    {
+      const uint8_t counter = get_counter(index);
+
+      if ((counter != 0U) && (counter != MAX_COUNT))
+      {
+        counters[index / 2] -= uint8_t(1U << ((index % 2) * 4));
+      }
+    }
+
+    /// The Bloom filter counters, two per byte.
+    uint8_t counters[WIDTH / 2];
+  };
+
+  //***************************************************************************
+  /// A partitioned bloom filter for sliding window de-duplication.
+  /// Keys are added to the current partition and are found in any partition.
+  /// advance() starts a new window by clearing only the oldest partition, so
+  /// a key is remembered for between PARTITIONS - 1 and PARTITIONS windows
+  /// without the cost of rebuilding the whole filter.
+  /// Allows up to three hashes to be defined.
+  /// Hashes must support the () operator and define 'argument_type'.
+  ///\tparam DESIRED_WIDTH The desired number of hash results that can be stored in each partition. Rounded up to best fit the underlying bitset.
+  ///\tparam PARTITIONS    The number of partitions.
+  ///\tparam THash1        The first hash generator class.
+  ///\tparam THash2        The second hash generator class. If omitted, uses the null hash.
+  ///\tparam THash3        The third hash generator class.  If omitted, uses the null hash.
+  /// The hash classes must define <b>argument_type</b>.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            const size_t PARTITIONS,
+            typename     THash1,
+            typename     THash2 = private_bloom_filter::null_hash,
+            typename     THash3 = private_bloom_filter::null_hash>
+  class partitioned_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash1::argument_type>::type parameter_t;
+    typedef private_bloom_filter::null_hash null_hash;
+
+  public:
+
+    ETL_STATIC_ASSERT(PARTITIONS >= 2, "There must be at least two partitions");
+
+    enum
+    {
+      // Make the most efficient use of the bitset.
+      WIDTH                = etl::bitset<DESIRED_WIDTH>::ALLOCATED_BITS,
+      NUMBER_OF_PARTITIONS = PARTITIONS
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    partitioned_bloom_filter()
+      : current(0U)
+    {
+    }
+
+    //***************************************************************************
+    /// Clears all of the partitions.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < PARTITIONS; ++i)
+      {
+        partitions[i].reset();
+      }
+
+      current = 0U;
+    }
+
+    //***************************************************************************
+    /// Starts a new window.
+    /// The oldest partition is cleared and becomes the current partition.
+    //***************************************************************************
+    void advance()
+    {
+      current = (current + 1U) % PARTITIONS;
+      partitions[current].reset();
+    }
+
+    //***************************************************************************
+    /// Adds a key to the current partition.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      etl::bitset<WIDTH>& flags = partitions[current];
+
+      flags.set(get_hash<THash1>(key));
+
+      if (!etl::is_same<THash2, null_hash>::value)
+      {
+        flags.set(get_hash<THash2>(key));
+      }
+
+      if (!etl::is_same<THash3, null_hash>::value)
+      {
+        flags.set(get_hash<THash3>(key));
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in any partition.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      // The hashes are calculated once for all of the partitions.
+      const size_t hash1 = get_hash<THash1>(key);
+      const size_t hash2 = etl::is_same<THash2, null_hash>::value ? hash1 : get_hash<THash2>(key);
+      const size_t hash3 = etl::is_same<THash3, null_hash>::value ? hash1 : get_hash<THash3>(key);
+
+      // Search from the newest partition.
+      size_t index = current;
+
+      for (size_t i = 0U; i < PARTITIONS; ++i)
+      {
+        const etl::bitset<WIDTH>& flags = partitions[index];
+
+        if (flags[hash1] && flags[hash2] && flags[hash3])
+        {
+          return true;
+        }
+
+        index = (index == 0U) ? PARTITIONS - 1U : index - 1U;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Tests a key and adds it to the current partition.
+    ///\param  key The key to test and add.
+    ///\return <b>true</b> if the key already existed in the filter.
+    //***************************************************************************
+    bool test_and_add(parameter_t key)
+    {
+      const bool found = exists(key);
+
+      add(key);
+
+      return found;
+    }
+
+    //***************************************************************************
+    /// Returns the width of each partition.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of partitions.
+    //***************************************************************************
+    size_t number_of_partitions() const
+    {
+      return PARTITIONS;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage across all partitions. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / (WIDTH * PARTITIONS);
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set across all partitions.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < PARTITIONS; ++i)
+      {
+        n += partitions[i].count();
+      }
+
+      return n;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the hash for the key.
+    ///\param  key The key.
+    ///\return The hash value.
+    //***************************************************************************
+    template <typename THash>
+    size_t get_hash(parameter_t key) const
+    {
+      size_t hash = THash()(key);
+
+      // Fold the hash down to fit the width.
+      return fold_bits<size_t, etl::log2<WIDTH>::value>(hash);
+    }
+
+    /// The partition flags.
+    etl::bitset<WIDTH> partitions[PARTITIONS];
+
+    /// The index of the current partition.
+    size_t current;
+  };
+}
+
+#endif
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 #include "utility.h"
+#include "span.h"
 
 namespace etl
 {
@@ -63,6 +64,16 @@ namespace etl
     typedef value_type*           pointer;
     typedef const value_type*     const_pointer;
 
+    //***************************************************
+    /// A run of points along the major axis, such as one row of a line that
+    /// is closer to horizontal than vertical.
+    //***************************************************
+    struct run
+    {
+      value_type start;  ///< The point with the lowest major axis coordinate.
+      size_t     length; ///< The number of points.
+    };
+
     //***************************************************
     /// Const Iterator
     //***************************************************
@@ -248,6 +259,95 @@ namespace etl
       }
     }
 
+    //***************************************************
+    /// Get the number of runs along the major axis.
+    //***************************************************
+    size_t run_count() const
+    {
+      if (y_is_major_axis())
+      {
+        return (dx / 2) + 1;
+      }
+      else
+      {
+        return (dy / 2) + 1;
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //***************************************************
+    /// Writes the points of the line, from the first, to the output.
+    /// Returns the number written, which is the smaller of size() and the
+    /// size of the output.
+    /// Does not affect iterators.
+    //***************************************************
+    size_t points(etl::span<value_type> output) const
+    {
+      run_stepper s(*this);
+
+      const size_t n     = (size() < output.size()) ? size() : output.size();
+      size_t       count = 0U;
+
+      while (count < n)
+      {
+        const T      minor  = s.minor;
+        T            major  = s.major;
+        const size_t length = s.next();
+        const size_t last_i = ((count + length) < n) ? (count + length) : n;
+
+        // The axes are chosen outside of the inner loops.
+        if (s.y_major)
+        {
+          for (; count < last_i; ++count)
+          {
+            output[count] = value_type(minor, major);
+            major = T(major + s.major_increment);
+          }
+        }
+        else
+        {
+          for (; count < last_i; ++count)
+          {
+            output[count] = value_type(major, minor);
+            major = T(major + s.major_increment);
+          }
+        }
+      }
+
+      return n;
+    }
+
+    //***************************************************
+    /// Writes the runs of the line along the major axis, from the first, to
+    /// the output. There are run_count() of them.
+    /// Returns the number written, which is the smaller of run_count() and
+    /// the size of the output.
+    /// Does not affect iterators.
+    //***************************************************
+    size_t runs(etl::span<run> output) const
+    {
+      run_stepper s(*this);
+
+      size_t count = 0U;
+
+      while ((s.remaining != 0U) && (count < output.size()))
+      {
+        const T      minor  = s.minor;
+        const T      major  = s.major;
+        const size_t length = s.next();
+
+        // The point with the lowest major axis coordinate.
+        const T lowest = (s.major_increment < 0) ? T(major + (typename run_stepper::fast_t(length - 1U) * s.major_increment)) : major;
+
+        output[count].start  = s.y_major ? value_type(minor, lowest) : value_type(lowest, minor);
+        output[count].length = length;
+        ++count;
+      }
+
+      return count;
+    }
+#endif
+
     //***************************************************
     /// Equality operator
     //***************************************************
@@ -345,6 +445,100 @@ namespace etl
 
     typedef TWork work_t;
 
+    //***************************************************
+    /// Steps along the line from the first point a run at a time, with the
+    /// same result as next(). Used for the batch functions.
+    /// Within a run the balance rises by the minor delta at each point, and
+    /// the run ends at the first point where it is not negative, so each run
+    /// takes one step rather than one per point.
+    /// After the first run the balance is at least minor_delta - major_delta,
+    /// which bounds the length of a run. Runs are found by counting down from
+    /// that, which takes one or two tries, as division is slow on many targets.
+    //***************************************************
+    struct run_stepper
+    {
+      // Types narrower than int are slow to work with on many targets.
+      typedef typename etl::conditional<(sizeof(work_t) < sizeof(int)), int, work_t>::type fast_t;
+
+      explicit run_stepper(const bresenham_line& line)
+        : y_major(line.y_is_major_axis())
+        , major(y_major ? line.first.y : line.first.x)
+        , minor(y_major ? line.first.x : line.first.y)
+        , major_increment(y_major ? line.y_increment : line.x_increment)
+        , minor_increment(y_major ? line.x_increment : line.y_increment)
+        , major_delta(y_major ? line.dy : line.dx)
+        , minor_delta(y_major ? line.dx : line.dy)
+        , balance(fast_t(minor_delta - (major_delta / 2)))
+        , remaining(line.size())
+        , longest(0)
+        , is_first_run(true)
+      {
+        if (minor_delta != 0)
+        {
+          longest = (major_delta - 1) / minor_delta;
+          longest = (longest < 1) ? 1 : longest;
+        }
+      }
+
+      //*************************************************
+      /// Steps over a run, leaving major and minor at the first point of
+      /// the next. Returns the length of the run.
+      //*************************************************
+      size_t next()
+      {
+        // The number of points after the first that are in the run.
+        size_t steps;
+
+        if (!is_first_run && (balance >= 0))
+        {
+          steps = 0U;
+        }
+        else if (minor_delta == 0)
+        {
+          steps = remaining;
+        }
+        else if (is_first_run)
+        {
+          // The smallest number of steps to make the balance not negative.
+          steps = (balance >= 0) ? 1U : size_t((minor_delta - 1 - balance) / minor_delta);
+        }
+        else
+        {
+          fast_t k = longest;
+
+          while ((k > 1) && ((balance + ((k - 1) * minor_delta)) >= 0))
+          {
+            --k;
+          }
+
+          steps = size_t(k);
+        }
+
+        is_first_run = false;
+
+        const size_t length = ((steps + 1U) < remaining) ? (steps + 1U) : remaining;
+
+        balance    = balance + (fast_t(steps) * minor_delta) - major_delta + minor_delta;
+        major      = T(major + (fast_t(length) * major_increment));
+        minor      = T(minor + minor_increment);
+        remaining -= length;
+
+        return length;
+      }
+
+      const bool   y_major;
+      T            major;
+      T            minor;
+      const fast_t major_increment;
+      const fast_t minor_increment;
+      const fast_t major_delta;   ///< Doubled, as in the line.
+      const fast_t minor_delta;   ///< Doubled, as in the line.
+      fast_t       balance;
+      size_t       remaining;
+      fast_t       longest;       ///< The most steps in a run after the first.
+      bool         is_first_run;
+    };
+
     value_type first;
     value_type last;
     value_type coordinate;
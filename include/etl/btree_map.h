@@ -0,0 +1,653 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "pool.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/btree_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, stored in a B+ tree.
+/// Each node holds many elements, so lookups touch far fewer cache lines than
+/// etl::map. The interface is that of etl::map, except that insertion and
+/// erasure may move the elements, invalidating iterators and references.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public etl::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:full", ETL_BTREE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_range : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:range", ETL_BTREE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_iterator : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:iterator", ETL_BTREE_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_map.
+  /// Can be used as a reference type for all btree_map containing a specific type.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map : public etl::private_btree::btree_table<ETL_OR_STD::pair<const TKey, T>,
+                                                            TKey,
+                                                            etl::private_btree::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                                            TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_btree::btree_table<ETL_OR_STD::pair<const TKey, T>,
+                                            TKey,
+                                            etl::private_btree::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                            TKeyCompare> base;
+
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::difference_type        difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_full if the key is new and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      if (base::full())
+      {
+        iterator itr = base::find(key);
+
+        ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_map_full));
+
+        return itr->second;
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = base::prepare_insert(key);
+
+      if (result.second)
+      {
+        ::new (base::slot_address(result.first)) value_type(key, T());
+      }
+
+      return result.first->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits btree_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(btree_map_iterator));
+      ETL_ASSERT(size_t(d) <= base::max_size(), ETL_ERROR(btree_map_full));
+#endif
+
+      base::clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      if (base::full())
+      {
+        iterator itr = base::find(key_value_pair.first);
+
+        ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_map_full));
+
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = base::prepare_insert(key_value_pair.first);
+
+      if (result.second)
+      {
+        ::new (base::slot_address(result.first)) value_type(key_value_pair);
+      }
+
+      return result;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      if (base::full())
+      {
+        iterator itr = base::find(key_value_pair.first);
+
+        ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_map_full));
+
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = base::prepare_insert(key_value_pair.first);
+
+      if (result.second)
+      {
+        ::new (base::slot_address(result.first)) value_type(etl::move(key_value_pair));
+      }
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (ibtree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_map(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t max_size_)
+      : base(leaf_pool_, internal_pool_, max_size_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first++));
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  ///\ingroup btree_map
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+
+  //*************************************************************************
+  /// A templated btree_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare> base;
+
+    typedef typename base::nodes nodes;
+
+    typedef etl::private_btree::node_counts_for<nodes, MAX_SIZE_> node_counts;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first_, TIterator last_)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator = (btree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        base::move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The pool of leaves.
+    etl::pool<typename nodes::leaf_node, node_counts::Leaves> leaf_pool;
+
+    /// The pool of internal nodes. Always at least one, so that the pool is never zero sized.
+    etl::pool<typename nodes::internal_node, (node_counts::Internals == 0U) ? 1U : node_counts::Internals> internal_pool;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  btree_map(T, Ts...)
+    ->btree_map<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), typename T::first_type>,
+                typename T::second_type,
+                1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
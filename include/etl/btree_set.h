@@ -0,0 +1,562 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "pool.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/btree_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set with the capacity defined at compile time, stored in a B+ tree.
+/// Each node holds many elements, so lookups touch far fewer cache lines than
+/// etl::set. The interface is that of etl::set, except that insertion and
+/// erasure may move the elements, invalidating iterators and references.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_exception : public etl::exception
+  {
+  public:
+
+    btree_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_full : public etl::btree_set_exception
+  {
+  public:
+
+    btree_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_set_exception(ETL_ERROR_TEXT("btree_set:full", ETL_BTREE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_iterator : public etl::btree_set_exception
+  {
+  public:
+
+    btree_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::btree_set_exception(ETL_ERROR_TEXT("btree_set:iterator", ETL_BTREE_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_set.
+  /// Can be used as a reference type for all btree_set containing a specific type.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_set : public etl::private_btree::btree_table<TKey,
+                                                            TKey,
+                                                            etl::private_btree::select_self<TKey>,
+                                                            TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_btree::btree_table<TKey,
+                                            TKey,
+                                            etl::private_btree::select_self<TKey>,
+                                            TKeyCompare> base;
+
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::difference_type        difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*********************************************************************
+    /// Assigns values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits btree_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(btree_set_iterator));
+      ETL_ASSERT(size_t(d) <= base::max_size(), ETL_ERROR(btree_set_full));
+#endif
+
+      base::clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      if (base::full())
+      {
+        iterator itr = base::find(value);
+
+        ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_set_full));
+
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = base::prepare_insert(value);
+
+      if (result.second)
+      {
+        ::new (base::slot_address(result.first)) value_type(value);
+      }
+
+      return result;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      if (base::full())
+      {
+        iterator itr = base::find(value);
+
+        ETL_ASSERT(itr != base::end(), ETL_ERROR(btree_set_full));
+
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      ETL_OR_STD::pair<iterator, bool> result = base::prepare_insert(value);
+
+      if (result.second)
+      {
+        ::new (base::slot_address(result.first)) value_type(etl::move(value));
+      }
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the btree_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return base::key_comp();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (const ibtree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (ibtree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    ibtree_set(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t max_size_)
+      : base(leaf_pool_, internal_pool_, max_size_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first++));
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first btree_set is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_set
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first btree_set is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  ///\ingroup btree_set
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first btree_set is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  ///\ingroup btree_set
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator <=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first btree_set is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  ///\ingroup btree_set
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator >=(const etl::ibtree_set<TKey, TKeyCompare>& lhs, const etl::ibtree_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+
+  //*************************************************************************
+  /// A templated btree_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class btree_set : public etl::ibtree_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, TCompare> base;
+
+    typedef typename base::nodes nodes;
+
+    typedef etl::private_btree::node_counts_for<nodes, MAX_SIZE_> node_counts;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first_, TIterator last_)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<TKey> init)
+      : base(leaf_pool, internal_pool, MAX_SIZE_)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator = (const btree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator = (btree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        base::move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The pool of leaves.
+    etl::pool<typename nodes::leaf_node, node_counts::Leaves> leaf_pool;
+
+    /// The pool of internal nodes. Always at least one, so that the pool is never zero sized.
+    etl::pool<typename nodes::internal_node, (node_counts::Internals == 0U) ? 1U : node_counts::Internals> internal_pool;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  btree_set(T, Ts...)
+    ->btree_set<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), T>, 1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
@@ -36,8 +36,8 @@ SOFTWARE.
 #include "delegate.h"
 #include "type_traits.h"
 #include "static_assert.h"
-#include "cyclic_value.h"
 #include "algorithm.h"
+#include "atomic.h"
 
 #include <cstring>
 
@@ -45,16 +45,100 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_buffer_descriptors
+  {
+    //*************************************************************************
+    /// Access to an atomic 'in use' flag.
+    /// Taking a descriptor is a compare and exchange with acquire ordering, so
+    /// the buffer contents written before the release are visible to the new
+    /// owner. Releasing is a store with release ordering.
+    //*************************************************************************
+    template <typename TFlag, bool Is_Integral = etl::is_integral<TFlag>::value>
+    struct flag_access
+    {
+      typedef TFlag storage_type;
+      typedef decltype(etl::declval<TFlag&>().load()) value_type;
+
+      static const bool is_atomic = true;
+
+      static bool is_set(const storage_type& flag)
+      {
+        return bool(flag.load(etl::memory_order_acquire));
+      }
+
+      static bool try_set(storage_type& flag)
+      {
+        value_type expected = value_type(false);
+
+        return flag.compare_exchange_strong(expected, value_type(true), etl::memory_order_acquire, etl::memory_order_relaxed);
+      }
+
+      static void clear(storage_type& flag)
+      {
+        flag.store(value_type(false), etl::memory_order_release);
+      }
+    };
+
+    //*************************************************************************
+    /// Access to a plain 'in use' flag.
+    /// Only safe where the flag is written in a single store, with one
+    /// context allocating and another releasing, on a single core.
+    //*************************************************************************
+    template <typename TFlag>
+    struct flag_access<TFlag, true>
+    {
+      typedef volatile TFlag storage_type;
+
+      static const bool is_atomic = false;
+
+      static bool is_set(const storage_type& flag)
+      {
+        return bool(flag);
+      }
+
+      static bool try_set(storage_type& flag)
+      {
+        if (flag)
+        {
+          return false;
+        }
+
+        flag = TFlag(true);
+
+        return true;
+      }
+
+      static void clear(storage_type& flag)
+      {
+        flag = TFlag(false);
+      }
+    };
+  }
+
   //***************************************************************************
   /// buffer_descriptors
+  /// With an atomic flag type, the default, any number of contexts may
+  /// allocate and release concurrently without locks. Descriptors are handed
+  /// out in ring order; allocate fails if the next one in the ring is still in
+  /// use.
   //***************************************************************************
+#if ETL_HAS_ATOMIC
+  template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TFlag = etl::atomic_bool>
+#else
   template <typename TBuffer, size_t BUFFER_SIZE_, size_t N_BUFFERS_, typename TFlag = bool>
+#endif
   class buffer_descriptors
   {
   private:
 
     struct descriptor_item;
 
+    typedef private_buffer_descriptors::flag_access<TFlag> flag_access;
+
+#if !ETL_HAS_ATOMIC
+    ETL_STATIC_ASSERT(!flag_access::is_atomic, "Atomic flags are not supported on this platform");
+#endif
+
   public:
 
     typedef TBuffer     value_type;
@@ -113,14 +197,14 @@ namespace etl
       ETL_NODISCARD
       bool is_allocated() const
       {
-        return bool(pdesc_item->in_use);
+        return flag_access::is_set(pdesc_item->in_use);
       }
 
       //*********************************
       ETL_NODISCARD
       bool is_released() const
       {
-        return bool(!pdesc_item->in_use);
+        return !flag_access::is_set(pdesc_item->in_use);
       }
 
       //*********************************
@@ -133,7 +217,7 @@ namespace etl
       //*********************************
       void release()
       {
-        pdesc_item->in_use = false;
+        flag_access::clear(pdesc_item->in_use);
       }
 
     private:
@@ -144,12 +228,6 @@ namespace etl
       {
       }
 
-      //*********************************
-      void allocate()
-      {
-        pdesc_item->in_use = true;;
-      }
-
       /// The pointer to the buffer descriptor.
       descriptor_item* pdesc_item;
     };
@@ -205,8 +283,10 @@ namespace etl
       for (size_t i = 0U; i < N_BUFFERS; ++i)
       {
         descriptor_items[i].pbuffer = pbuffers_ + (i * BUFFER_SIZE);
-        descriptor_items[i].in_use  = false;
+        flag_access::clear(descriptor_items[i].in_use);
       }
+
+      next_counter.store(0U);
     }
 
     //*********************************
@@ -220,10 +300,10 @@ namespace etl
     {
       for (size_t i = 0U; i < N_BUFFERS; ++i)
       {
-        descriptor_items[i].in_use = false;
+        flag_access::clear(descriptor_items[i].in_use);
       }
 
-      next.to_first();
+      next_counter.store(0U);
     }
 
     //*********************************
@@ -243,24 +323,38 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Allocates the next descriptor in the ring.
+    /// Returns an invalid descriptor if it is still in use.
     //*********************************
     ETL_NODISCARD
     descriptor allocate()
-    {    
-      descriptor desc(&descriptor_items[next]);
+    {
+      return allocate_next(etl::integral_constant<bool, flag_access::is_atomic>());
+    }
 
-      if (desc.is_released())
-      {
-        ++next;
-        
-        desc.allocate();
+    //*********************************
+    /// Allocates up to n descriptors, in ring order, stopping at the first
+    /// one that is still in use.
+    /// Returns the number allocated.
+    //*********************************
+    size_t allocate(descriptor* pdescriptors, size_t n)
+    {
+      size_t count = 0U;
 
-        return desc;
-      }
-      else
+      while (count < n)
       {
-        return descriptor();
+        descriptor desc = allocate();
+
+        if (!desc.is_valid())
+        {
+          break;
+        }
+
+        pdescriptors[count++] = desc;
       }
+
+      return count;
     }
 
     //*********************************
@@ -282,13 +376,86 @@ namespace etl
     //*********************************
     struct descriptor_item
     {
-      pointer  pbuffer;
-      volatile flag_type in_use;
+      pointer                            pbuffer;
+      typename flag_access::storage_type in_use;
     };
 
+#if ETL_HAS_ATOMIC
+    //*********************************
+    /// Allocates with atomic flags.
+    /// The descriptor is taken before the ring counter is advanced, so a
+    /// context working from a stale counter gives it straight back.
+    //*********************************
+    descriptor allocate_next(etl::true_type)
+    {
+      size_t current = next_counter.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        descriptor_item& item = descriptor_items[current % N_BUFFERS];
+
+        if (!flag_access::try_set(item.in_use))
+        {
+          // Either the ring is full, or another context has just taken it.
+          const size_t latest = next_counter.load(etl::memory_order_relaxed);
+
+          if (latest == current)
+          {
+            return descriptor();
+          }
+
+          current = latest;
+        }
+        else if (next_counter.compare_exchange_strong(current, current + 1U, etl::memory_order_relaxed))
+        {
+          return descriptor(&item);
+        }
+        else
+        {
+          // Not ours to take. 'current' now holds the latest counter.
+          flag_access::clear(item.in_use);
+        }
+      }
+    }
+#endif
+
+    //*********************************
+    /// Allocates with plain flags, from a single context.
+    //*********************************
+    descriptor allocate_next(etl::false_type)
+    {
+      const size_t current = next_counter.load();
+
+      descriptor_item& item = descriptor_items[current % N_BUFFERS];
+
+      if (flag_access::try_set(item.in_use))
+      {
+        next_counter.store(current + 1U);
+
+        return descriptor(&item);
+      }
+
+      return descriptor();
+    }
+
+#if ETL_HAS_ATOMIC
+    typedef etl::atomic_size_t counter_type;
+#else
+    //*********************************
+    /// A stand in for an atomic counter, when plain flags are used.
+    //*********************************
+    struct counter_type
+    {
+      size_t load() const     { return value; }
+      void store(size_t value_) { value = value_; }
+
+      size_t value;
+    };
+#endif
+
     callback_type callback;
     etl::array<descriptor_item, N_BUFFERS> descriptor_items;
-    etl::cyclic_value<uint_least8_t, 0U, N_BUFFERS - 1> next;
+    counter_type next_counter; ///< Counts allocations. The next descriptor is next_counter % N_BUFFERS.
   };
 }
 #endif
@@ -0,0 +1,723 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_STREAM_INCLUDED
+#define ETL_BYTE_STREAM_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "endianness.h"
+#include "binary.h"
+#include "span.h"
+#include "optional.h"
+#include "varint.h"
+
+///\defgroup byte_stream byte_stream
+/// Reads and writes typed values to a byte buffer in a chosen byte order.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// The unsigned type of each size, and how to reverse its bytes.
+    //*************************************************************************
+    template <size_t VSize>
+    struct uint_of_size;
+
+    template <>
+    struct uint_of_size<1U>
+    {
+      typedef uint8_t type;
+      static type reverse(type value) { return value; }
+    };
+
+    template <>
+    struct uint_of_size<2U>
+    {
+      typedef uint16_t type;
+      static type reverse(type value) { return etl::reverse_bytes(value); }
+    };
+
+    template <>
+    struct uint_of_size<4U>
+    {
+      typedef uint32_t type;
+      static type reverse(type value) { return etl::reverse_bytes(value); }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct uint_of_size<8U>
+    {
+      typedef uint64_t type;
+      static type reverse(type value) { return etl::reverse_bytes(value); }
+    };
+#endif
+
+    //*************************************************************************
+    /// True if values in the buffer have the opposite byte order to the host.
+    //*************************************************************************
+    inline bool needs_reverse(etl::endian buffer_endianness)
+    {
+      return (buffer_endianness != etl::endian::native) && (buffer_endianness != etl::endianness::value());
+    }
+
+    //*************************************************************************
+    /// Stores a value, which may be unaligned.
+    //*************************************************************************
+    template <typename T>
+    void store(uint8_t* p, T value, bool reverse)
+    {
+      typedef uint_of_size<sizeof(T)> uint_t;
+
+      typename uint_t::type u;
+      memcpy(&u, &value, sizeof(T));
+
+      if (reverse)
+      {
+        u = uint_t::reverse(u);
+      }
+
+      memcpy(p, &u, sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Loads a value, which may be unaligned.
+    //*************************************************************************
+    template <typename T>
+    T load(const uint8_t* p, bool reverse)
+    {
+      typedef uint_of_size<sizeof(T)> uint_t;
+
+      typename uint_t::type u;
+      memcpy(&u, p, sizeof(T));
+
+      if (reverse)
+      {
+        u = uint_t::reverse(u);
+      }
+
+      T value;
+      memcpy(&value, &u, sizeof(T));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// The types that can be streamed.
+    //*************************************************************************
+    template <typename T>
+    struct is_streamable : etl::integral_constant<bool, etl::is_integral<T>::value || etl::is_floating_point<T>::value>
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// Writes integral and floating point values to a byte buffer.
+  /// Values are stored in the byte order given to the constructor, which
+  /// defaults to big endian (network order).
+  ///\ingroup byte_stream
+  //***************************************************************************
+  class byte_stream_writer
+  {
+  public:
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Construct from a span.
+    //*************************************************************************
+    explicit byte_stream_writer(etl::span<uint8_t> span_, etl::endian buffer_endianness_ = etl::endian::big)
+      : pdata(span_.data())
+      , pcurrent(span_.data())
+      , length(span_.size())
+      , buffer_endianness(buffer_endianness_)
+      , reverse(private_byte_stream::needs_reverse(buffer_endianness_))
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Construct from a pointer and a length.
+    //*************************************************************************
+    byte_stream_writer(void* begin_, size_t length_, etl::endian buffer_endianness_ = etl::endian::big)
+      : pdata(static_cast<uint8_t*>(begin_))
+      , pcurrent(static_cast<uint8_t*>(begin_))
+      , length(length_)
+      , buffer_endianness(buffer_endianness_)
+      , reverse(private_byte_stream::needs_reverse(buffer_endianness_))
+    {
+    }
+
+    //*************************************************************************
+    /// Writes a value in the stream's byte order.
+    /// Returns false if there is not enough room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      write(T value)
+    {
+      if (available<T>() == 0U)
+      {
+        return false;
+      }
+
+      write_unchecked(value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes a value in the given byte order.
+    /// Returns false if there is not enough room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      write(T value, etl::endian value_endianness)
+    {
+      if (available<T>() == 0U)
+      {
+        return false;
+      }
+
+      write_unchecked(value, value_endianness);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes n values in the stream's byte order.
+    /// Returns false, and writes nothing, if there is not enough room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      write(const T* p, size_t n)
+    {
+      if (available<T>() < n)
+      {
+        return false;
+      }
+
+      write_unchecked(p, n);
+
+      return true;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Writes a range of values in the stream's byte order.
+    /// Returns false, and writes nothing, if there is not enough room.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      write(const etl::span<T, VExtent>& range)
+    {
+      return write(range.data(), range.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Writes an integral value as a varint. Signed values are zigzag encoded.
+    /// Returns false if there is not enough room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      write_varint(T value)
+    {
+      const size_t used = etl::varint_encode(value, pcurrent, available_bytes());
+
+      pcurrent += used;
+
+      return used != 0U;
+    }
+
+    //*************************************************************************
+    /// Writes a value in the stream's byte order, without checking for room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      write_unchecked(T value)
+    {
+      private_byte_stream::store(pcurrent, value, reverse);
+      pcurrent += sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Writes a value in the given byte order, without checking for room.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      write_unchecked(T value, etl::endian value_endianness)
+    {
+      private_byte_stream::store(pcurrent, value, private_byte_stream::needs_reverse(value_endianness));
+      pcurrent += sizeof(T);
+    }
+
+    //*************************************************************************
+    /// Writes n values in the stream's byte order, without checking for room.
+    /// Single bytes, or values that are already in the right order, are
+    /// copied in one go.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      write_unchecked(const T* p, size_t n)
+    {
+      if ((sizeof(T) == 1U) || !reverse)
+      {
+        memcpy(pcurrent, p, n * sizeof(T));
+        pcurrent += n * sizeof(T);
+      }
+      else
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          write_unchecked(p[i]);
+        }
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Writes a range of values in the stream's byte order, without checking
+    /// for room.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      write_unchecked(const etl::span<T, VExtent>& range)
+    {
+      write_unchecked(range.data(), range.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Skips over n values of type T, leaving them unchanged.
+    /// Returns false if there is not enough room.
+    //*************************************************************************
+    template <typename T>
+    bool skip(size_t n)
+    {
+      if (available<T>() < n)
+      {
+        return false;
+      }
+
+      pcurrent += n * sizeof(T);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves back to the start of the stream, or to an offset from it.
+    //*************************************************************************
+    void restart(size_t offset = 0U)
+    {
+      pcurrent = pdata + offset;
+    }
+
+    //*************************************************************************
+    /// The number of values of type T that there is room for.
+    //*************************************************************************
+    template <typename T>
+    size_t available() const
+    {
+      return available_bytes() / sizeof(T);
+    }
+
+    //*************************************************************************
+    /// The number of bytes that there is room for.
+    //*************************************************************************
+    size_t available_bytes() const
+    {
+      return length - size_bytes();
+    }
+
+    //*************************************************************************
+    /// The number of bytes written.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return size_t(pcurrent - pdata);
+    }
+
+    //*************************************************************************
+    /// The capacity of the stream, in bytes.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return length;
+    }
+
+    //*************************************************************************
+    /// True if nothing has been written.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pcurrent == pdata;
+    }
+
+    //*************************************************************************
+    /// True if there is no more room.
+    //*************************************************************************
+    bool full() const
+    {
+      return available_bytes() == 0U;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// The bytes written so far.
+    //*************************************************************************
+    etl::span<uint8_t> used_data() const
+    {
+      return etl::span<uint8_t>(pdata, pcurrent);
+    }
+
+    //*************************************************************************
+    /// The bytes not yet written.
+    //*************************************************************************
+    etl::span<uint8_t> free_data() const
+    {
+      return etl::span<uint8_t>(pcurrent, pdata + length);
+    }
+#endif
+
+    //*************************************************************************
+    /// The byte order of the stream.
+    //*************************************************************************
+    etl::endian get_endianness() const
+    {
+      return buffer_endianness;
+    }
+
+  private:
+
+    uint8_t* const pdata;             ///< The start of the buffer.
+    uint8_t*       pcurrent;          ///< The next byte to write.
+    const size_t   length;            ///< The length of the buffer.
+    etl::endian    buffer_endianness; ///< The byte order of the stream.
+    bool           reverse;           ///< True if the byte order differs from the host.
+  };
+
+  //***************************************************************************
+  /// Reads integral and floating point values from a byte buffer.
+  /// Values are read in the byte order given to the constructor, which
+  /// defaults to big endian (network order).
+  ///\ingroup byte_stream
+  //***************************************************************************
+  class byte_stream_reader
+  {
+  public:
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Construct from a span.
+    //*************************************************************************
+    explicit byte_stream_reader(etl::span<const uint8_t> span_, etl::endian buffer_endianness_ = etl::endian::big)
+      : pdata(span_.data())
+      , pcurrent(span_.data())
+      , length(span_.size())
+      , buffer_endianness(buffer_endianness_)
+      , reverse(private_byte_stream::needs_reverse(buffer_endianness_))
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Construct from a pointer and a length.
+    //*************************************************************************
+    byte_stream_reader(const void* begin_, size_t length_, etl::endian buffer_endianness_ = etl::endian::big)
+      : pdata(static_cast<const uint8_t*>(begin_))
+      , pcurrent(static_cast<const uint8_t*>(begin_))
+      , length(length_)
+      , buffer_endianness(buffer_endianness_)
+      , reverse(private_byte_stream::needs_reverse(buffer_endianness_))
+    {
+    }
+
+    //*************************************************************************
+    /// Reads a value in the stream's byte order.
+    /// Returns an empty optional if there is not enough data.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, etl::optional<T> >::type
+      read()
+    {
+      etl::optional<T> result;
+
+      if (available<T>() != 0U)
+      {
+        result = read_unchecked<T>();
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reads a value in the given byte order.
+    /// Returns an empty optional if there is not enough data.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, etl::optional<T> >::type
+      read(etl::endian value_endianness)
+    {
+      etl::optional<T> result;
+
+      if (available<T>() != 0U)
+      {
+        result = read_unchecked<T>(value_endianness);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reads n values, in the stream's byte order.
+    /// Returns false, and reads nothing, if there is not enough data.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      read(T* p, size_t n)
+    {
+      if (available<T>() < n)
+      {
+        return false;
+      }
+
+      read_unchecked(p, n);
+
+      return true;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Reads values into a range, in the stream's byte order.
+    /// Returns false, and reads nothing, if there is not enough data.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, bool>::type
+      read(const etl::span<T, VExtent>& range)
+    {
+      return read(range.data(), range.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Reads a varint. Signed values are zigzag decoded.
+    /// Returns an empty optional if the data is truncated or malformed.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<T> >::type
+      read_varint()
+    {
+      etl::optional<T> result;
+
+      T value;
+      const size_t used = etl::varint_decode(pcurrent, available_bytes(), value);
+
+      if (used != 0U)
+      {
+        result = value;
+        pcurrent += used;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Reads a value in the stream's byte order, without checking for data.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, T>::type
+      read_unchecked()
+    {
+      const T value = private_byte_stream::load<T>(pcurrent, reverse);
+      pcurrent += sizeof(T);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads a value in the given byte order, without checking for data.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, T>::type
+      read_unchecked(etl::endian value_endianness)
+    {
+      const T value = private_byte_stream::load<T>(pcurrent, private_byte_stream::needs_reverse(value_endianness));
+      pcurrent += sizeof(T);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads n values, in the stream's byte order, without checking for data.
+    /// Single bytes, or values that are already in the right order, are
+    /// copied in one go.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      read_unchecked(T* p, size_t n)
+    {
+      if ((sizeof(T) == 1U) || !reverse)
+      {
+        memcpy(p, pcurrent, n * sizeof(T));
+        pcurrent += n * sizeof(T);
+      }
+      else
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p[i] = read_unchecked<T>();
+        }
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Reads values into a range, in the stream's byte order, without
+    /// checking for data.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    typename etl::enable_if<private_byte_stream::is_streamable<T>::value, void>::type
+      read_unchecked(const etl::span<T, VExtent>& range)
+    {
+      read_unchecked(range.data(), range.size());
+    }
+
+    //*************************************************************************
+    /// Returns a view of the next n bytes, without copying them, and moves
+    /// past them. Returns an empty optional if there is not enough data.
+    //*************************************************************************
+    etl::optional<etl::span<const uint8_t> > read_span(size_t n)
+    {
+      etl::optional<etl::span<const uint8_t> > result;
+
+      if (available_bytes() >= n)
+      {
+        result = etl::span<const uint8_t>(pcurrent, n);
+        pcurrent += n;
+      }
+
+      return result;
+    }
+#endif
+
+    //*************************************************************************
+    /// Skips over n values of type T.
+    /// Returns false if there is not enough data.
+    //*************************************************************************
+    template <typename T>
+    bool skip(size_t n)
+    {
+      if (available<T>() < n)
+      {
+        return false;
+      }
+
+      pcurrent += n * sizeof(T);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves back to the start of the stream, or to an offset from it.
+    //*************************************************************************
+    void restart(size_t offset = 0U)
+    {
+      pcurrent = pdata + offset;
+    }
+
+    //*************************************************************************
+    /// The number of values of type T left to read.
+    //*************************************************************************
+    template <typename T>
+    size_t available() const
+    {
+      return available_bytes() / sizeof(T);
+    }
+
+    //*************************************************************************
+    /// The number of bytes left to read.
+    //*************************************************************************
+    size_t available_bytes() const
+    {
+      return length - size_t(pcurrent - pdata);
+    }
+
+    //*************************************************************************
+    /// True if everything has been read.
+    //*************************************************************************
+    bool empty() const
+    {
+      return available_bytes() == 0U;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// The bytes read so far.
+    //*************************************************************************
+    etl::span<const uint8_t> used_data() const
+    {
+      return etl::span<const uint8_t>(pdata, pcurrent);
+    }
+
+    //*************************************************************************
+    /// The bytes not yet read.
+    //*************************************************************************
+    etl::span<const uint8_t> free_data() const
+    {
+      return etl::span<const uint8_t>(pcurrent, pdata + length);
+    }
+#endif
+
+    //*************************************************************************
+    /// The byte order of the stream.
+    //*************************************************************************
+    etl::endian get_endianness() const
+    {
+      return buffer_endianness;
+    }
+
+  private:
+
+    const uint8_t* const pdata;             ///< The start of the buffer.
+    const uint8_t*       pcurrent;          ///< The next byte to read.
+    const size_t         length;            ///< The length of the buffer.
+    etl::endian          buffer_endianness; ///< The byte order of the stream.
+    bool                 reverse;           ///< True if the byte order differs from the host.
+  };
+}
+
+#endif
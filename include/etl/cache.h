@@ -0,0 +1,940 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CACHE_INCLUDED
+#define ETL_CACHE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "functional.h"
+#include "hash.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "placement_new.h"
+#include "power.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include "delegate.h"
+
+//*****************************************************************************
+///\defgroup cache cache
+/// Fixed capacity caches in front of a slower backing store.
+/// The store is accessed through a read delegate, called on a miss, and a
+/// write delegate, called when a changed value is written back.
+/// Lookup is through an open addressing index, so a hit is O(1) and does not
+/// touch the store.
+/// When 'write through' is off, changed values are only written back when
+/// they are evicted, erased, or when flush() is called.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for all caches.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue>
+  class icache
+  {
+  public:
+
+    typedef TKey   key_type;
+    typedef TValue mapped_type;
+
+    /// Reads the value for a key from the store. Returns false if the store does not hold the key.
+    typedef etl::delegate<bool(const TKey&, TValue&)> read_function_t;
+
+    /// Writes the value for a key to the store.
+    typedef etl::delegate<void(const TKey&, const TValue&)> write_function_t;
+
+    //*************************************************************************
+    /// Constructor.
+    /// By default, 'write_through' is set to true.
+    //*************************************************************************
+    icache()
+      : write_through(true)
+      , read_store()
+      , write_store()
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// A derived cache flushes itself before it is destroyed.
+    //*************************************************************************
+    virtual ~icache()
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the function that reads from the store.
+    //*************************************************************************
+    void set_read_function(read_function_t reader_)
+    {
+      read_store = reader_;
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes to the store.
+    //*************************************************************************
+    void set_write_function(write_function_t writer_)
+    {
+      write_store = writer_;
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag.
+    /// Changing it does not flush values that are already changed.
+    //*************************************************************************
+    void set_write_through(bool write_through_)
+    {
+      write_through = write_through_;
+    }
+
+    //*************************************************************************
+    /// Gets the 'write through' flag.
+    //*************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+    virtual bool read(const TKey& key, TValue& value) = 0;        ///< Reads from the cache. May read from the store using read_store.
+    virtual void write(const TKey& key, const TValue& value) = 0; ///< Writes to the cache. May write to the store using write_store.
+    virtual void flush() = 0;                                     ///< Writes all changed values to the store.
+
+  protected:
+
+    bool write_through; ///< If true, changed values are written to the store immediately. If false then a flush() or eviction is required.
+
+    read_function_t  read_store;  ///< A function that will read a value from the store into the cache.
+    write_function_t write_store; ///< A function that will write a value from the cache into the store.
+
+  private:
+
+    // Disable copy construction and assignment.
+    icache(const icache&) ETL_DELETE;
+    icache& operator =(const icache&) ETL_DELETE;
+  };
+
+  namespace private_cache
+  {
+    //*************************************************************************
+    /// A cached key and value.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct cache_entry
+    {
+      cache_entry(const TKey& key_, const TValue& value_)
+        : key(key_)
+        , value(value_)
+      {
+      }
+
+      TKey   key;
+      TValue value;
+    };
+  }
+
+  //***************************************************************************
+  /// The storage and index shared by the fixed capacity caches.
+  /// The replacement policy is supplied by the derived class through the
+  /// on_hit, on_insert, on_remove, on_clear and select_victim hooks.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class ifixed_cache : public etl::icache<TKey, TValue>
+  {
+  public:
+
+    typedef TKey      key_type;
+    typedef TValue    mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+    typedef size_t    size_type;
+
+    //*************************************************************************
+    /// Reads the value for the key.
+    /// On a miss the value is read from the store and cached.
+    /// Returns false if the key is neither cached nor in the store.
+    //*************************************************************************
+    bool read(const TKey& key, TValue& value) ETL_OVERRIDE
+    {
+      const uint16_t slot = find_slot(key);
+
+      if (slot != NO_SLOT)
+      {
+        on_hit(slot);
+        value = p_entries[slot].value;
+        return true;
+      }
+
+      if (!this->read_store.is_valid() || !this->read_store(key, value))
+      {
+        return false;
+      }
+
+      insert_entry(key, value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes the value for the key.
+    /// Written to the store now if 'write through' is set, otherwise marked as
+    /// changed and written back later.
+    //*************************************************************************
+    void write(const TKey& key, const TValue& value) ETL_OVERRIDE
+    {
+      uint16_t slot = find_slot(key);
+
+      if (slot != NO_SLOT)
+      {
+        on_hit(slot);
+        p_entries[slot].value = value;
+      }
+      else
+      {
+        slot = insert_entry(key, value);
+      }
+
+      if (this->write_through)
+      {
+        write_back(slot);
+      }
+      else
+      {
+        p_flags[slot] |= DIRTY;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes all changed values to the store, in slot order.
+    /// Does nothing if there is no write function.
+    //*************************************************************************
+    void flush() ETL_OVERRIDE
+    {
+      if (this->write_store.is_valid())
+      {
+        for (size_t i = 0U; i < CAPACITY; ++i)
+        {
+          if ((p_flags[i] & DIRTY) != 0U)
+          {
+            write_back(uint16_t(i));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the cached value for the key, counting it as a use.
+    /// Does not read from the store.
+    /// Returns a null pointer if the key is not cached.
+    /// Writing through the pointer is not seen as a change.
+    //*************************************************************************
+    TValue* find(const TKey& key)
+    {
+      const uint16_t slot = find_slot(key);
+
+      if (slot == NO_SLOT)
+      {
+        return ETL_NULLPTR;
+      }
+
+      on_hit(slot);
+
+      return &p_entries[slot].value;
+    }
+
+    //*************************************************************************
+    /// Finds the cached value for the key without counting it as a use.
+    /// Returns a null pointer if the key is not cached.
+    //*************************************************************************
+    const TValue* peek(const TKey& key) const
+    {
+      const uint16_t slot = find_slot(key);
+
+      return (slot == NO_SLOT) ? ETL_NULLPTR : &p_entries[slot].value;
+    }
+
+    //*************************************************************************
+    /// Checks if the key is cached.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find_slot(key) != NO_SLOT;
+    }
+
+    //*************************************************************************
+    /// Checks if the cached value for the key is waiting to be written back.
+    //*************************************************************************
+    bool is_dirty(const TKey& key) const
+    {
+      const uint16_t slot = find_slot(key);
+
+      return (slot != NO_SLOT) && ((p_flags[slot] & DIRTY) != 0U);
+    }
+
+    //*************************************************************************
+    /// Removes the key from the cache, writing back a changed value first.
+    /// Returns true if the key was cached.
+    //*************************************************************************
+    bool erase(const TKey& key)
+    {
+      const uint16_t slot = find_slot(key);
+
+      if (slot == NO_SLOT)
+      {
+        return false;
+      }
+
+      remove_entry(slot);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Flushes and then empties the cache.
+    //*************************************************************************
+    void clear()
+    {
+      flush();
+
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        if ((p_flags[i] & OCCUPIED) != 0U)
+        {
+          p_entries[i].~entry_t();
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Gets the number of cached values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of cached values.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of cached values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+  protected:
+
+    typedef etl::private_cache::cache_entry<TKey, TValue> entry_t;
+
+    static ETL_CONSTANT uint16_t NO_SLOT = 0xFFFFU;
+
+    enum
+    {
+      OCCUPIED   = 1U,
+      DIRTY      = 2U,
+      REFERENCED = 4U
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// index_size_ must be a power of 2 larger than capacity_.
+    //*************************************************************************
+    ifixed_cache(entry_t* p_entries_, uint8_t* p_flags_, uint16_t* p_next_free_, uint16_t* p_index_, size_t capacity_, size_t index_size_)
+      : p_flags(p_flags_)
+      , p_entries(p_entries_)
+      , p_next_free(p_next_free_)
+      , p_index(p_index_)
+      , CAPACITY(capacity_)
+      , INDEX_MASK(index_size_ - 1U)
+      , current_size(0U)
+      , free_head(NO_SLOT)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ifixed_cache()
+    {
+    }
+
+    //*************************************************************************
+    /// Empties the slots and the index, then resets the policy.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_flags[i]     = 0U;
+        p_next_free[i] = uint16_t(i + 1U);
+      }
+
+      p_next_free[CAPACITY - 1U] = NO_SLOT;
+      free_head = 0U;
+
+      for (size_t i = 0U; i <= INDEX_MASK; ++i)
+      {
+        p_index[i] = NO_SLOT;
+      }
+
+      current_size = 0U;
+
+      on_clear();
+    }
+
+    virtual void     on_hit(uint16_t slot) = 0;    ///< The cached value in the slot has been used.
+    virtual void     on_insert(uint16_t slot) = 0; ///< A value has been cached in the slot.
+    virtual void     on_remove(uint16_t slot) = 0; ///< The value in the slot is about to be removed.
+    virtual void     on_clear() = 0;               ///< The cache has been emptied.
+    virtual uint16_t select_victim() = 0;          ///< Chooses the slot to evict when the cache is full.
+
+    uint8_t* p_flags; ///< The OCCUPIED, DIRTY and REFERENCED flags for each slot.
+
+  private:
+
+    //*************************************************************************
+    /// Gets the home position of the key in the index.
+    //*************************************************************************
+    size_t home_of(const TKey& key) const
+    {
+      return size_t(hash_function(key)) & INDEX_MASK;
+    }
+
+    //*************************************************************************
+    /// Gets the slot holding the key, or NO_SLOT.
+    //*************************************************************************
+    uint16_t find_slot(const TKey& key) const
+    {
+      size_t position = home_of(key);
+
+      while (p_index[position] != NO_SLOT)
+      {
+        const uint16_t slot = p_index[position];
+
+        if (key_equal_function(p_entries[slot].key, key))
+        {
+          return slot;
+        }
+
+        position = (position + 1U) & INDEX_MASK;
+      }
+
+      return NO_SLOT;
+    }
+
+    //*************************************************************************
+    /// Caches a key that is known not to be cached, evicting if full.
+    /// The new value is clean.
+    //*************************************************************************
+    uint16_t insert_entry(const TKey& key, const TValue& value)
+    {
+      if (full())
+      {
+        remove_entry(select_victim());
+      }
+
+      const uint16_t slot = free_head;
+      free_head = p_next_free[slot];
+
+      ::new (&p_entries[slot]) entry_t(key, value);
+      p_flags[slot] = OCCUPIED;
+
+      size_t position = home_of(key);
+
+      while (p_index[position] != NO_SLOT)
+      {
+        position = (position + 1U) & INDEX_MASK;
+      }
+
+      p_index[position] = slot;
+      ++current_size;
+
+      on_insert(slot);
+
+      return slot;
+    }
+
+    //*************************************************************************
+    /// Writes back a changed value, then removes the slot from the index and
+    /// the policy and returns it to the free list.
+    //*************************************************************************
+    void remove_entry(uint16_t slot)
+    {
+      if ((p_flags[slot] & DIRTY) != 0U)
+      {
+        write_back(slot);
+      }
+
+      on_remove(slot);
+
+      // Find the slot's position in the index.
+      size_t hole = home_of(p_entries[slot].key);
+
+      while (p_index[hole] != slot)
+      {
+        hole = (hole + 1U) & INDEX_MASK;
+      }
+
+      // Backward shift deletion; move later members of the probe run into the
+      // hole if their home position allows it, so that no tombstones are needed.
+      size_t position = hole;
+
+      while (true)
+      {
+        position = (position + 1U) & INDEX_MASK;
+
+        const uint16_t candidate = p_index[position];
+
+        if (candidate == NO_SLOT)
+        {
+          break;
+        }
+
+        const size_t home = home_of(p_entries[candidate].key);
+
+        // Can move if the home is not cyclically within (hole, position].
+        if (((position - home) & INDEX_MASK) >= ((position - hole) & INDEX_MASK))
+        {
+          p_index[hole] = candidate;
+          hole = position;
+        }
+      }
+
+      p_index[hole] = NO_SLOT;
+
+      p_entries[slot].~entry_t();
+      p_flags[slot]     = 0U;
+      p_next_free[slot] = free_head;
+      free_head         = slot;
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Writes the value in the slot to the store and marks it as clean.
+    //*************************************************************************
+    void write_back(uint16_t slot)
+    {
+      if (this->write_store.is_valid())
+      {
+        this->write_store(p_entries[slot].key, p_entries[slot].value);
+      }
+
+      p_flags[slot] &= uint8_t(~DIRTY);
+    }
+
+    entry_t*  p_entries;   ///< The cached keys and values.
+    uint16_t* p_next_free; ///< The free list links.
+    uint16_t* p_index;     ///< The open addressing index of slots. NO_SLOT is empty.
+
+    const size_t CAPACITY;
+    const size_t INDEX_MASK;
+
+    size_t   current_size;
+    uint16_t free_head;
+
+    hasher    hash_function;
+    key_equal key_equal_function;
+  };
+
+  template <typename TKey, typename TValue, typename THash, typename TKeyEqual>
+  ETL_CONSTANT uint16_t ifixed_cache<TKey, TValue, THash, TKeyEqual>::NO_SLOT;
+
+  //***************************************************************************
+  /// A cache that evicts the least recently used value.
+  /// The slots are kept on a doubly linked recency list; a hit moves its slot
+  /// to the front and the victim is the slot at the back.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class ilru_cache : public etl::ifixed_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::ifixed_cache<TKey, TValue, THash, TKeyEqual> base;
+
+  protected:
+
+    typedef typename base::entry_t entry_t;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ilru_cache(entry_t* p_entries_, uint8_t* p_flags_, uint16_t* p_next_, uint16_t* p_previous_, uint16_t* p_index_, size_t capacity_, size_t index_size_)
+      : base(p_entries_, p_flags_, p_next_, p_index_, capacity_, index_size_)
+      , p_next(p_next_)
+      , p_previous(p_previous_)
+      , head(base::NO_SLOT)
+      , tail(base::NO_SLOT)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ilru_cache()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves the slot to the front of the recency list.
+    //*************************************************************************
+    void on_hit(uint16_t slot) ETL_OVERRIDE
+    {
+      if (slot != head)
+      {
+        unlink(slot);
+        link_front(slot);
+      }
+    }
+
+    //*************************************************************************
+    /// Puts the slot at the front of the recency list.
+    //*************************************************************************
+    void on_insert(uint16_t slot) ETL_OVERRIDE
+    {
+      link_front(slot);
+    }
+
+    //*************************************************************************
+    /// Takes the slot off the recency list.
+    //*************************************************************************
+    void on_remove(uint16_t slot) ETL_OVERRIDE
+    {
+      unlink(slot);
+    }
+
+    //*************************************************************************
+    /// Empties the recency list.
+    //*************************************************************************
+    void on_clear() ETL_OVERRIDE
+    {
+      head = base::NO_SLOT;
+      tail = base::NO_SLOT;
+    }
+
+    //*************************************************************************
+    /// The least recently used slot.
+    //*************************************************************************
+    uint16_t select_victim() ETL_OVERRIDE
+    {
+      return tail;
+    }
+
+    //*************************************************************************
+    /// Links the slot at the front of the recency list.
+    /// The free list shares p_next, as a slot is never on both lists.
+    //*************************************************************************
+    void link_front(uint16_t slot)
+    {
+      p_previous[slot] = base::NO_SLOT;
+      p_next[slot]     = head;
+
+      if (head != base::NO_SLOT)
+      {
+        p_previous[head] = slot;
+      }
+      else
+      {
+        tail = slot;
+      }
+
+      head = slot;
+    }
+
+    //*************************************************************************
+    /// Unlinks the slot from the recency list.
+    //*************************************************************************
+    void unlink(uint16_t slot)
+    {
+      const uint16_t next     = p_next[slot];
+      const uint16_t previous = p_previous[slot];
+
+      if (previous != base::NO_SLOT)
+      {
+        p_next[previous] = next;
+      }
+      else
+      {
+        head = next;
+      }
+
+      if (next != base::NO_SLOT)
+      {
+        p_previous[next] = previous;
+      }
+      else
+      {
+        tail = previous;
+      }
+    }
+
+    uint16_t* p_next;
+    uint16_t* p_previous;
+    uint16_t  head;  ///< The most recently used slot.
+    uint16_t  tail;  ///< The least recently used slot.
+  };
+
+  //***************************************************************************
+  /// A least recently used cache with the capacity defined at compile time.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::ilru_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::ilru_cache<TKey, TValue, THash, TKeyEqual> base;
+    typedef typename base::entry_t entry_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity cache is not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ < 0xFFFFU), "Capacity too large for the 16 bit slot index");
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t INDEX_SIZE = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lru_cache()
+      : base(reinterpret_cast<entry_t*>(&buffer), flags, next, previous, index, MAX_SIZE, INDEX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes back any changed values.
+    //*************************************************************************
+    ~lru_cache()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(entry_t) * MAX_SIZE_, etl::alignment_of<entry_t>::value>::type buffer;
+
+    uint8_t  flags[MAX_SIZE_];
+    uint16_t next[MAX_SIZE_];
+    uint16_t previous[MAX_SIZE_];
+    uint16_t index[INDEX_SIZE];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::INDEX_SIZE;
+
+  //***************************************************************************
+  /// A cache that approximates least recently used with the CLOCK algorithm.
+  /// A hit only sets the slot's referenced flag, so the hit path does no list
+  /// maintenance. To find a victim the hand sweeps the slots, giving each
+  /// referenced slot a second chance by clearing its flag.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iclock_cache : public etl::ifixed_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::ifixed_cache<TKey, TValue, THash, TKeyEqual> base;
+
+  protected:
+
+    typedef typename base::entry_t entry_t;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iclock_cache(entry_t* p_entries_, uint8_t* p_flags_, uint16_t* p_next_free_, uint16_t* p_index_, size_t capacity_, size_t index_size_)
+      : base(p_entries_, p_flags_, p_next_free_, p_index_, capacity_, index_size_)
+      , hand(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iclock_cache()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Marks the slot as referenced.
+    //*************************************************************************
+    void on_hit(uint16_t slot) ETL_OVERRIDE
+    {
+      this->p_flags[slot] |= base::REFERENCED;
+    }
+
+    //*************************************************************************
+    /// A new value starts unreferenced. The hand has just passed its slot if
+    /// it replaced a victim, so it still survives one full sweep.
+    //*************************************************************************
+    void on_insert(uint16_t) ETL_OVERRIDE
+    {
+    }
+
+    //*************************************************************************
+    /// Nothing to do; the slot's flags are cleared by the base.
+    //*************************************************************************
+    void on_remove(uint16_t) ETL_OVERRIDE
+    {
+    }
+
+    //*************************************************************************
+    /// Resets the hand.
+    //*************************************************************************
+    void on_clear() ETL_OVERRIDE
+    {
+      hand = 0U;
+    }
+
+    //*************************************************************************
+    /// Sweeps the hand to the first unreferenced slot, clearing the
+    /// referenced flag of each slot passed over.
+    /// Only called when full, so every slot is occupied.
+    //*************************************************************************
+    uint16_t select_victim() ETL_OVERRIDE
+    {
+      const size_t capacity = this->capacity();
+
+      while ((this->p_flags[hand] & base::REFERENCED) != 0U)
+      {
+        this->p_flags[hand] &= uint8_t(~base::REFERENCED);
+        hand = (hand + 1U == capacity) ? 0U : hand + 1U;
+      }
+
+      const uint16_t victim = uint16_t(hand);
+      hand = (hand + 1U == capacity) ? 0U : hand + 1U;
+
+      return victim;
+    }
+
+    size_t hand;
+  };
+
+  //***************************************************************************
+  /// A CLOCK cache with the capacity defined at compile time.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class clock_cache : public etl::iclock_cache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iclock_cache<TKey, TValue, THash, TKeyEqual> base;
+    typedef typename base::entry_t entry_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity cache is not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ < 0xFFFFU), "Capacity too large for the 16 bit slot index");
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t INDEX_SIZE = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    clock_cache()
+      : base(reinterpret_cast<entry_t*>(&buffer), flags, next_free, index, MAX_SIZE, INDEX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes back any changed values.
+    //*************************************************************************
+    ~clock_cache()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(entry_t) * MAX_SIZE_, etl::alignment_of<entry_t>::value>::type buffer;
+
+    uint8_t  flags[MAX_SIZE_];
+    uint16_t next_free[MAX_SIZE_];
+    uint16_t index[INDEX_SIZE];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t clock_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t clock_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::INDEX_SIZE;
+}
+
+#endif
+#endif
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "atomic.h"
 #include "error_handler.h"
 #include "placement_new.h"
+#include "trace.h"
 
 #if ETL_CPP11_SUPPORTED
   #include "delegate.h"
@@ -325,6 +326,12 @@ namespace etl
         return ptimers[head];
       }
 
+      //*******************************
+      const etl::callback_timer_data& front() const
+      {
+        return ptimers[head];
+      }
+
       //*******************************
       etl::timer::id::type begin()
       {
@@ -574,6 +581,8 @@ namespace etl
                 active_list.insert(timer.id);
               }
 
+              ETL_TRACE_EVENT(etl::trace_event::Callback_Timer_Expired, timer.id, timer.period)
+
               if (timer.p_callback != ETL_NULLPTR)
               {
                 if (timer.cbk_type == callback_timer_data::C_CALLBACK)
@@ -705,6 +714,22 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Returns the number of ticks until the next timer expires.
+    /// Returns etl::timer::state::INACTIVE if no timers are running.
+    /// Allows a tickless system to sleep until then and pass the
+    /// elapsed time to a single call to 'tick'.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      if (active_list.empty())
+      {
+        return etl::timer::state::INACTIVE;
+      }
+
+      return active_list.front().delta;
+    }
+
   protected:
 
     //*******************************************
@@ -0,0 +1,526 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CBOR_INCLUDED
+#define ETL_CBOR_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "string_view.h"
+#include "span.h"
+
+///\defgroup cbor cbor
+/// A streaming CBOR (RFC 8949) writer.
+/// Items are encoded straight into a byte buffer, with no document tree and
+/// no allocation.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Writes CBOR items into a buffer.
+  /// Arrays and maps may have a length given up front, or be indefinite and
+  /// closed with end(). The writer does not check that the number of items
+  /// matches a given length.
+  /// Floating point values use the smallest of half, single and double
+  /// precision that holds the value exactly.
+  /// If the buffer fills up the writer stops writing and has_error() returns
+  /// true.
+  ///\ingroup cbor
+  //***************************************************************************
+  class cbor_writer
+  {
+  public:
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t argument_type;
+#else
+    typedef uint32_t argument_type;
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Construct from a span.
+    //*************************************************************************
+    explicit cbor_writer(etl::span<uint8_t> buffer)
+      : pdata(buffer.data())
+      , length(buffer.size())
+    {
+      restart();
+    }
+#endif
+
+    //*************************************************************************
+    /// Construct from a pointer and a length.
+    //*************************************************************************
+    cbor_writer(void* begin_, size_t length_)
+      : pdata(static_cast<uint8_t*>(begin_))
+      , length(length_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Starts again at the beginning of the buffer.
+    //*************************************************************************
+    void restart()
+    {
+      index = 0U;
+      error = false;
+    }
+
+    //*************************************************************************
+    /// Starts an array of 'count' items.
+    //*************************************************************************
+    cbor_writer& begin_array(size_t count)
+    {
+      put_head(Major_Array, argument_type(count));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Starts an array of unknown length. Close it with end().
+    //*************************************************************************
+    cbor_writer& begin_array()
+    {
+      put(uint8_t(Major_Array | Indefinite));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Starts a map of 'count' key/value pairs.
+    //*************************************************************************
+    cbor_writer& begin_map(size_t count)
+    {
+      put_head(Major_Map, argument_type(count));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Starts a map of unknown length. Close it with end().
+    //*************************************************************************
+    cbor_writer& begin_map()
+    {
+      put(uint8_t(Major_Map | Indefinite));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Ends an array or map of unknown length.
+    //*************************************************************************
+    cbor_writer& end()
+    {
+      put(Break);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a text string as a map key.
+    //*************************************************************************
+    cbor_writer& key(const etl::string_view& name)
+    {
+      return value(name);
+    }
+
+    //*************************************************************************
+    /// Writes a map key and value.
+    //*************************************************************************
+    template <typename T>
+    cbor_writer& member(const etl::string_view& name, const T& v)
+    {
+      return key(name).value(v);
+    }
+
+    //*************************************************************************
+    /// Writes a text string.
+    //*************************************************************************
+    cbor_writer& value(const etl::string_view& text)
+    {
+      put_head(Major_Text, argument_type(text.size()));
+      put(text.data(), text.size());
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a text string.
+    //*************************************************************************
+    cbor_writer& value(const char* text)
+    {
+      return value(etl::string_view(text));
+    }
+
+    //*************************************************************************
+    /// Writes true or false.
+    //*************************************************************************
+    cbor_writer& value(bool b)
+    {
+      put(b ? True : False);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes an unsigned integer.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && !etl::is_same<T, bool>::value, cbor_writer&>::type
+      value(T n)
+    {
+      put_head(Major_Unsigned, argument_type(n));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a signed integer.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, cbor_writer&>::type
+      value(T n)
+    {
+      if (n < 0)
+      {
+        // Negative integers are encoded as -1 - n.
+        put_head(Major_Negative, ~argument_type(n));
+      }
+      else
+      {
+        put_head(Major_Unsigned, argument_type(n));
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a float.
+    //*************************************************************************
+    cbor_writer& value(float f)
+    {
+      put_float(f);
+
+      return *this;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Writes a double.
+    //*************************************************************************
+    cbor_writer& value(double d)
+    {
+      if ((d != d) || (double(float(d)) == d))
+      {
+        put_float(float(d));
+      }
+      else
+      {
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+
+        put(Float64);
+        put_be(bits, 8U);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Writes null.
+    //*************************************************************************
+    cbor_writer& null()
+    {
+      put(Null);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a byte string.
+    //*************************************************************************
+    cbor_writer& bytes(const void* data, size_t size)
+    {
+      put_head(Major_Bytes, argument_type(size));
+      put(static_cast<const char*>(data), size);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Writes a byte string.
+    //*************************************************************************
+    cbor_writer& bytes(etl::span<const uint8_t> data)
+    {
+      return bytes(data.data(), data.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Writes a tag, which applies to the next item.
+    //*************************************************************************
+    cbor_writer& tag(argument_type number)
+    {
+      put_head(Major_Tag, number);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The number of bytes written.
+    //*************************************************************************
+    size_t size() const
+    {
+      return index;
+    }
+
+    //*************************************************************************
+    /// A pointer to the beginning of the buffer.
+    //*************************************************************************
+    const uint8_t* data() const
+    {
+      return pdata;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// The bytes written.
+    //*************************************************************************
+    etl::span<const uint8_t> used_data() const
+    {
+      return etl::span<const uint8_t>(pdata, pdata + index);
+    }
+#endif
+
+    //*************************************************************************
+    /// True if the buffer was too small.
+    //*************************************************************************
+    bool has_error() const
+    {
+      return error;
+    }
+
+  private:
+
+    enum
+    {
+      Major_Unsigned = 0x00U,
+      Major_Negative = 0x20U,
+      Major_Bytes    = 0x40U,
+      Major_Text     = 0x60U,
+      Major_Array    = 0x80U,
+      Major_Map      = 0xA0U,
+      Major_Tag      = 0xC0U,
+      Indefinite     = 0x1FU,
+      False          = 0xF4U,
+      True           = 0xF5U,
+      Null           = 0xF6U,
+      Float16        = 0xF9U,
+      Float32        = 0xFAU,
+      Float64        = 0xFBU,
+      Break          = 0xFFU
+    };
+
+    //*************************************************************************
+    /// Writes a byte.
+    //*************************************************************************
+    void put(uint8_t b)
+    {
+      if (error || (index == length))
+      {
+        error = true;
+      }
+      else
+      {
+        pdata[index++] = b;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes bytes.
+    //*************************************************************************
+    void put(const char* p, size_t size)
+    {
+      if (error || (size > (length - index)))
+      {
+        error = true;
+      }
+      else if (size != 0U)
+      {
+        memcpy(pdata + index, p, size);
+        index += size;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the low 'size' bytes of a value, most significant first.
+    //*************************************************************************
+    void put_be(argument_type value, size_t size)
+    {
+      if (error || (size > (length - index)))
+      {
+        error = true;
+      }
+      else
+      {
+        for (size_t i = size; i != 0U; --i)
+        {
+          pdata[index++] = uint8_t(value >> ((i - 1U) * 8U));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes an item's initial byte and argument, in the fewest bytes.
+    /// Nothing is written unless all of it fits.
+    //*************************************************************************
+    void put_head(uint8_t major, argument_type value)
+    {
+      uint8_t info;
+      size_t  size;
+
+      if (value < 24U)
+      {
+        info = uint8_t(value);
+        size = 0U;
+      }
+      else if (value <= 0xFFU)
+      {
+        info = 24U;
+        size = 1U;
+      }
+      else if (value <= 0xFFFFU)
+      {
+        info = 25U;
+        size = 2U;
+      }
+#if ETL_USING_64BIT_TYPES
+      else if (value <= 0xFFFFFFFFUL)
+      {
+        info = 26U;
+        size = 4U;
+      }
+      else
+      {
+        info = 27U;
+        size = 8U;
+      }
+#else
+      else
+      {
+        info = 26U;
+        size = 4U;
+      }
+#endif
+
+      if (error || ((size + 1U) > (length - index)))
+      {
+        error = true;
+      }
+      else
+      {
+        pdata[index++] = uint8_t(major | info);
+        put_be(value, size);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a float as a half if that is exact, otherwise as a single.
+    //*************************************************************************
+    void put_float(float f)
+    {
+      uint32_t bits;
+      memcpy(&bits, &f, sizeof(bits));
+
+      const uint32_t sign     = (bits >> 16U) & 0x8000U;
+      const uint32_t exponent = (bits >> 23U) & 0xFFU;
+      const uint32_t mantissa = bits & 0x7FFFFFU;
+
+      if (exponent == 0xFFU)
+      {
+        // Infinity, or NaN, which is always written as the canonical half NaN.
+        put(Float16);
+        put_be((mantissa == 0U) ? (sign | 0x7C00U) : 0x7E00U, 2U);
+        return;
+      }
+
+      if ((exponent == 0U) && (mantissa == 0U))
+      {
+        // Zero.
+        put(Float16);
+        put_be(sign, 2U);
+        return;
+      }
+
+      const int32_t power = int32_t(exponent) - 127;
+
+      if ((power >= -14) && (power <= 15) && ((mantissa & 0x1FFFU) == 0U))
+      {
+        // A normal half.
+        put(Float16);
+        put_be(sign | (uint32_t(power + 15) << 10U) | (mantissa >> 13U), 2U);
+        return;
+      }
+
+      if ((exponent != 0U) && (power >= -24) && (power < -14))
+      {
+        // A subnormal half, if no set bits are lost.
+        const uint32_t significand = 0x800000U | mantissa;
+        const uint32_t shift       = uint32_t(-(power + 1));
+
+        if ((significand & ((uint32_t(1U) << shift) - 1U)) == 0U)
+        {
+          put(Float16);
+          put_be(sign | (significand >> shift), 2U);
+          return;
+        }
+      }
+
+      put(Float32);
+      put_be(bits, 4U);
+    }
+
+    uint8_t* pdata;  ///< The buffer.
+    size_t   length; ///< The size of the buffer.
+    size_t   index;  ///< The next byte to write.
+    bool     error;  ///< True if the buffer was too small.
+  };
+}
+
+#endif
@@ -33,6 +33,8 @@ SOFTWARE.
 #include "binary.h"
 #include "frame_check_sequence.h"
 
+#include "private/checksum_kernels.h"
+
 ///\defgroup checksum Checksum calculation
 ///\ingroup maths
 
@@ -46,6 +48,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
     inline T initial() const
     {
       return 0;
@@ -56,6 +61,17 @@ namespace etl
       return sum + value;
     }
 
+    template <typename TIterator>
+    T add(T sum, TIterator begin, const TIterator end) const
+    {
+      return private_checksum::add_range<checksum_policy_sum<T> >(sum, begin, end);
+    }
+
+    static T add_bytes(T sum, const uint8_t* p, size_t n)
+    {
+      return T(sum + private_checksum::sum_bytes(p, n));
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -94,6 +110,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
     inline T initial() const
     {
       return 0;
@@ -104,6 +123,17 @@ namespace etl
       return sum ^ value;
     }
 
+    template <typename TIterator>
+    T add(T sum, TIterator begin, const TIterator end) const
+    {
+      return private_checksum::add_range<checksum_policy_xor<T> >(sum, begin, end);
+    }
+
+    static T add_bytes(T sum, const uint8_t* p, size_t n)
+    {
+      return T(sum ^ private_checksum::xor_bytes(p, n));
+    }
+
     inline T final(T sum) const
     {
       return sum;
@@ -142,6 +172,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
     inline T initial() const
     {
       return 0;
@@ -152,12 +185,159 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+    // Parity is linear over XOR, so the parity of the XOR of all of the bytes is the same.
+    template <typename TIterator>
+    T add(T sum, TIterator begin, const TIterator end) const
+    {
+      return private_checksum::add_range<checksum_policy_parity<T> >(sum, begin, end);
+    }
+
+    static T add_bytes(T sum, const uint8_t* p, size_t n)
+    {
+      return T(sum ^ etl::parity(private_checksum::xor_bytes(p, n)));
+    }
+
     inline T final(T sum) const
     {
       return sum;
     }
   };
 
+  //***************************************************************************
+  /// Fletcher-16 checksum policy.
+  /// The state holds sum2 in the high byte and sum1 in the low byte.
+  //***************************************************************************
+  struct checksum_policy_fletcher16
+  {
+    typedef uint16_t value_type;
+
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
+    inline uint16_t initial() const
+    {
+      return 0U;
+    }
+
+    inline uint16_t add(uint16_t sums, uint8_t value) const
+    {
+      uint32_t sum1 = sums & 0xFFU;
+      uint32_t sum2 = sums >> 8U;
+
+      sum1 = (sum1 + value) % MODULUS;
+      sum2 = (sum2 + sum1)  % MODULUS;
+
+      return uint16_t((sum2 << 8U) | sum1);
+    }
+
+    template <typename TIterator>
+    uint16_t add(uint16_t sums, TIterator begin, const TIterator end) const
+    {
+      return private_checksum::add_range<checksum_policy_fletcher16>(sums, begin, end);
+    }
+
+    // The modulo is deferred until the sums could overflow.
+    static uint16_t add_bytes(uint16_t sums, const uint8_t* p, size_t n)
+    {
+      uint32_t sum1 = sums & 0xFFU;
+      uint32_t sum2 = sums >> 8U;
+
+      while (n != 0U)
+      {
+        const size_t length = (n < private_checksum::Deferred_Modulo_Block) ? n : private_checksum::Deferred_Modulo_Block;
+
+        private_checksum::fletcher_sums(p, length, sum1, sum2);
+
+        sum1 %= MODULUS;
+        sum2 %= MODULUS;
+        p    += length;
+        n    -= length;
+      }
+
+      return uint16_t((sum2 << 8U) | sum1);
+    }
+
+    inline uint16_t final(uint16_t sums) const
+    {
+      return sums;
+    }
+
+    static ETL_CONSTANT uint32_t MODULUS = 255U;
+  };
+
+  //***************************************************************************
+  /// Adler-32 checksum policy.
+  /// The state holds B in the high 16 bits and A in the low 16 bits.
+  //***************************************************************************
+  struct checksum_policy_adler32
+  {
+    typedef uint32_t value_type;
+
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
+    inline uint32_t initial() const
+    {
+      return 1U;
+    }
+
+    inline uint32_t add(uint32_t sums, uint8_t value) const
+    {
+      uint32_t a = sums & 0xFFFFU;
+      uint32_t b = sums >> 16U;
+
+      a += value;
+
+      if (a >= MODULUS)
+      {
+        a -= MODULUS;
+      }
+
+      b += a;
+
+      if (b >= MODULUS)
+      {
+        b -= MODULUS;
+      }
+
+      return (b << 16U) | a;
+    }
+
+    template <typename TIterator>
+    uint32_t add(uint32_t sums, TIterator begin, const TIterator end) const
+    {
+      return private_checksum::add_range<checksum_policy_adler32>(sums, begin, end);
+    }
+
+    // The modulo is deferred until the sums could overflow.
+    static uint32_t add_bytes(uint32_t sums, const uint8_t* p, size_t n)
+    {
+      uint32_t a = sums & 0xFFFFU;
+      uint32_t b = sums >> 16U;
+
+      while (n != 0U)
+      {
+        const size_t length = (n < private_checksum::Deferred_Modulo_Block) ? n : private_checksum::Deferred_Modulo_Block;
+
+        private_checksum::fletcher_sums(p, length, a, b);
+
+        a %= MODULUS;
+        b %= MODULUS;
+        p += length;
+        n -= length;
+      }
+
+      return (b << 16U) | a;
+    }
+
+    inline uint32_t final(uint32_t sums) const
+    {
+      return sums;
+    }
+
+    static ETL_CONSTANT uint32_t MODULUS = 65521U;
+  };
+
   //*************************************************************************
   /// Standard Checksum.
   //*************************************************************************
@@ -302,6 +482,62 @@ namespace etl
       this->add(begin, end);
     }
   };
+
+  //*************************************************************************
+  /// Fletcher-16 Checksum.
+  //*************************************************************************
+  class fletcher16 : public etl::frame_check_sequence<etl::checksum_policy_fletcher16>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher16()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    fletcher16(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //*************************************************************************
+  /// Adler-32 Checksum.
+  //*************************************************************************
+  class adler32 : public etl::frame_check_sequence<etl::checksum_policy_adler32>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    adler32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    adler32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
 }
 
 #endif
@@ -31,15 +31,19 @@ SOFTWARE.
 #ifndef ETL_CIRCULAR_BUFFER_INCLUDED
 #define ETL_CIRCULAR_BUFFER_INCLUDED
 
+#include <string.h>
+
 #include "platform.h"
 #include "vector.h"
 #include "exception.h"
 #include "error_handler.h"
 #include "memory.h"
 #include "memory_model.h"
+#include "integral_limits.h"
 #include "type_traits.h"
 #include "iterator.h"
 #include "static_assert.h"
+#include "span.h"
 
 namespace etl
 {
@@ -70,19 +74,22 @@ namespace etl
   };
 
   //***************************************************************************
-  ///
+  /// The base class for all circular buffers.
+  ///\tparam MEMORY_MODEL The memory model. Determines the type of the indexes
+  /// held in the buffer and its iterators.
   //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
   class circular_buffer_base
   {
   public:
 
-    /// The type used for determining the size of queue.
-    typedef size_t size_type;
+    /// The type used for determining the size of the buffer.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
 
     //*************************************************************************
     size_type size() const
     {
-      return (in >= out) ? in - out : BUFFER_SIZE - (out - in);
+      return size_type((in >= out) ? in - out : BUFFER_SIZE - (out - in));
     }
 
     //*************************************************************************
@@ -100,19 +107,19 @@ namespace etl
     //*************************************************************************
     size_type available() const
     {
-      return max_size() - size();
+      return size_type(max_size() - size());
     }
 
     //*************************************************************************
     size_type max_size() const
     {
-      return BUFFER_SIZE - 1U;
+      return size_type(BUFFER_SIZE - 1U);
     }
 
     //*************************************************************************
     size_type capacity() const
     {
-      return BUFFER_SIZE - 1U;
+      return size_type(BUFFER_SIZE - 1U);
     }
 
   protected:
@@ -134,11 +141,31 @@ namespace etl
   //***************************************************************************
   ///
   //***************************************************************************
-  template <typename T>
-  class icircular_buffer : public circular_buffer_base
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class icircular_buffer : public circular_buffer_base<MEMORY_MODEL>
   {
+  protected:
+
+    typedef etl::circular_buffer_base<MEMORY_MODEL> base_t;
+
+    using base_t::in;
+    using base_t::out;
+    using base_t::BUFFER_SIZE;
+#if defined(ETL_DEBUG_COUNT)
+    using base_t::etl_debug_count;
+#endif
+
   public:
 
+    typedef typename base_t::size_type size_type;
+
+    using base_t::size;
+    using base_t::empty;
+    using base_t::full;
+    using base_t::available;
+    using base_t::max_size;
+    using base_t::capacity;
+
     typedef T           value_type;
     typedef T&          reference;
     typedef const T&    const_reference;
@@ -150,6 +177,26 @@ namespace etl
 
     typedef typename etl::iterator_traits<pointer>::difference_type difference_type;
 
+#if ETL_CPP11_SUPPORTED
+    typedef etl::span<T>       span_type;
+    typedef etl::span<const T> const_span_type;
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Can a range be pushed with memcpy?
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_bulk_copyable
+    {
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value &&
+                                       etl::is_same<typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type, T>::value &&
+                                       etl::is_trivially_copyable<T>::value;
+    };
+
+  public:
+
     //*************************************************************************
     /// Iterator iterating through the circular buffer.
     //*************************************************************************
@@ -240,7 +287,7 @@ namespace etl
         // Are we at the end of the buffer?
         if (current == 0U)
         {
-          current = picb->BUFFER_SIZE - 1;
+          current = size_type(picb->BUFFER_SIZE - 1U);
         }
         else
         {
@@ -269,8 +316,7 @@ namespace etl
       {
         n = picb->BUFFER_SIZE + n;
 
-        current += n;
-        current %= picb->BUFFER_SIZE;
+        current = size_type((current + n) % picb->BUFFER_SIZE);
 
         return (*this);
       }
@@ -391,7 +437,7 @@ namespace etl
       //*************************************************************************
       /// Protected constructor. Only icircular_buffer can create one.
       //*************************************************************************
-      iterator(const icircular_buffer<T>* picb_, size_type current_)
+      iterator(const icircular_buffer* picb_, size_type current_)
         : picb(picb_)
         , current(current_)
       {
@@ -399,7 +445,7 @@ namespace etl
 
     private:
 
-      const icircular_buffer<T>* picb;
+      const icircular_buffer* picb;
       size_type current;
     };
 
@@ -513,7 +559,7 @@ namespace etl
         // Are we at the end of the buffer?
         if (current == 0U)
         {
-          current = picb->BUFFER_SIZE - 1;
+          current = size_type(picb->BUFFER_SIZE - 1U);
         }
         else
         {
@@ -542,8 +588,7 @@ namespace etl
       {
         n = picb->BUFFER_SIZE + n;
 
-        current += n;
-        current %= picb->BUFFER_SIZE;
+        current = size_type((current + n) % picb->BUFFER_SIZE);
 
         return (*this);
       }
@@ -651,7 +696,7 @@ namespace etl
       //*************************************************************************
       /// Protected constructor. Only icircular_buffer can create one.
       //*************************************************************************
-      const_iterator(const icircular_buffer<T>* picb_, size_type current_)
+      const_iterator(const icircular_buffer* picb_, size_type current_)
         : picb(picb_)
         , current(current_)
       {
@@ -659,7 +704,7 @@ namespace etl
 
     private:
 
-      const icircular_buffer<T>* picb;
+      const icircular_buffer* picb;
       size_type current;
     };
 
@@ -809,6 +854,46 @@ namespace etl
       return pbuffer[in == 0U ? BUFFER_SIZE - 1 : in - 1U];
     }
 
+    //*************************************************************************
+    /// Get a reference to the item at the front of the buffer, without
+    /// checking that there is one.
+    /// Undefined behaviour if the buffer is empty.
+    //*************************************************************************
+    reference front_unchecked()
+    {
+      return pbuffer[out];
+    }
+
+    //*************************************************************************
+    /// Get a const reference to the item at the front of the buffer, without
+    /// checking that there is one.
+    /// Undefined behaviour if the buffer is empty.
+    //*************************************************************************
+    const_reference front_unchecked() const
+    {
+      return pbuffer[out];
+    }
+
+    //*************************************************************************
+    /// Get a reference to the item at the back of the buffer, without
+    /// checking that there is one.
+    /// Undefined behaviour if the buffer is empty.
+    //*************************************************************************
+    reference back_unchecked()
+    {
+      return pbuffer[in == 0U ? BUFFER_SIZE - 1 : in - 1U];
+    }
+
+    //*************************************************************************
+    /// Get a const reference to the item at the back of the buffer, without
+    /// checking that there is one.
+    /// Undefined behaviour if the buffer is empty.
+    //*************************************************************************
+    const_reference back_unchecked() const
+    {
+      return pbuffer[in == 0U ? BUFFER_SIZE - 1 : in - 1U];
+    }
+
     //*************************************************************************
     /// Get a reference to the item.
     //*************************************************************************
@@ -834,14 +919,14 @@ namespace etl
     void push(const_reference item)
     {
       ::new (&pbuffer[in]) T(item);
-      in = (in + 1U) % BUFFER_SIZE;
+      in = size_type((in + 1U) % BUFFER_SIZE);
 
       // Did we catch up with the 'out' index?
       if (in == out)
       {
         // Forget about the oldest one.
         pbuffer[out].~T();
-        out = (out + 1U) % BUFFER_SIZE;
+        out = size_type((out + 1U) % BUFFER_SIZE);
       }
       else
       {
@@ -858,14 +943,14 @@ namespace etl
     void push(rvalue_reference item)
     {
       ::new (&pbuffer[in]) T(etl::move(item));
-      in = (in + 1U) % BUFFER_SIZE;
+      in = size_type((in + 1U) % BUFFER_SIZE);
 
       // Did we catch up with the 'out' index?
       if (in == out)
       {
         // Forget about the oldest item.
         pbuffer[out].~T();
-        out = (out + 1U) % BUFFER_SIZE;
+        out = size_type((out + 1U) % BUFFER_SIZE);
       }
       else
       {
@@ -878,7 +963,8 @@ namespace etl
     /// Push a buffer from an iterator range.
     //*************************************************************************
     template <typename TIterator>
-    void push(TIterator first, const TIterator& last)
+    typename etl::enable_if<!is_bulk_copyable<TIterator>::value, void>::type
+      push(TIterator first, const TIterator& last)
     {
       while (first != last)
       {
@@ -886,6 +972,38 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Push a buffer from a pointer range of a trivially copyable type.
+    /// Copies with at most two memcpy calls.
+    /// If the buffer is filled then the oldest items are overwritten.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<is_bulk_copyable<TIterator>::value, void>::type
+      push(TIterator first, const TIterator& last)
+    {
+      size_t length = static_cast<size_t>(last - first);
+
+      // Only the newest items can remain.
+      if (length > capacity())
+      {
+        first += (length - capacity());
+        length = capacity();
+      }
+
+      const size_type n        = size_type(length);
+      const size_type new_size = size_type(etl::min(size_t(size()) + n, size_t(capacity())));
+
+      ETL_ADD_DEBUG_COUNT(new_size - size())
+
+      const size_type n_first = etl::min(n, size_type(BUFFER_SIZE - in));
+
+      memcpy(pbuffer + in, first, n_first * sizeof(T));
+      memcpy(pbuffer, first + n_first, (n - n_first) * sizeof(T));
+
+      in  = size_type((in + n) % BUFFER_SIZE);
+      out = size_type((in + BUFFER_SIZE - new_size) % BUFFER_SIZE);
+    }
+
     //*************************************************************************
     /// pop
     //*************************************************************************
@@ -893,21 +1011,84 @@ namespace etl
     {
       ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
       pbuffer[out].~T();
-      out = (out + 1U) % BUFFER_SIZE;
+      out = size_type((out + 1U) % BUFFER_SIZE);
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// pop_unchecked
+    /// Removes the oldest item without checking that there is one.
+    /// Undefined behaviour if the buffer is empty.
+    //*************************************************************************
+    void pop_unchecked()
+    {
+      pbuffer[out].~T();
+      out = size_type((out + 1U) % BUFFER_SIZE);
       ETL_DECREMENT_DEBUG_COUNT
     }
 
     //*************************************************************************
     /// pop(n)
+    /// Trivially destructible types just move the read index.
     //*************************************************************************
     void pop(size_type n)
     {
-      while (n-- != 0U)
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
       {
-        pop();
+        ETL_ASSERT(n <= size(), ETL_ERROR(circular_buffer_empty));
+
+        out = size_type((out + n) % BUFFER_SIZE);
+        ETL_SUBTRACT_DEBUG_COUNT(n)
+      }
+      else
+      {
+        while (n-- != 0U)
+        {
+          pop();
+        }
       }
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// The first contiguous run of items, starting at the front.
+    /// Empty if the buffer is empty.
+    //*************************************************************************
+    span_type first_span()
+    {
+      return span_type(pbuffer + out, first_span_size());
+    }
+
+    //*************************************************************************
+    /// The first contiguous run of items, starting at the front.
+    /// Empty if the buffer is empty.
+    //*************************************************************************
+    const_span_type first_span() const
+    {
+      return const_span_type(pbuffer + out, first_span_size());
+    }
+
+    //*************************************************************************
+    /// The second contiguous run of items, which follows the first when the
+    /// items wrap around the end of the storage.
+    /// Empty if the items do not wrap.
+    //*************************************************************************
+    span_type second_span()
+    {
+      return span_type(pbuffer, size() - first_span_size());
+    }
+
+    //*************************************************************************
+    /// The second contiguous run of items, which follows the first when the
+    /// items wrap around the end of the storage.
+    /// Empty if the items do not wrap.
+    //*************************************************************************
+    const_span_type second_span() const
+    {
+      return const_span_type(pbuffer, size() - first_span_size());
+    }
+#endif
+
     //*************************************************************************
     /// Clears the buffer.
     //*************************************************************************
@@ -966,7 +1147,7 @@ namespace etl
     /// Protected constructor.
     //*************************************************************************
     icircular_buffer(pointer pbuffer_, size_type max_length)
-      : circular_buffer_base(max_length + 1U)
+      : base_t(size_type(max_length + 1U))
       , pbuffer(pbuffer_)
     {
     }
@@ -1007,6 +1188,15 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// The number of items from the front to the end of the storage, or to
+    /// the back, whichever is first.
+    //*************************************************************************
+    size_type first_span_size() const
+    {
+      return size_type((in >= out) ? (in - out) : (BUFFER_SIZE - out));
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1027,20 +1217,25 @@ namespace etl
   /// A fixed capacity circular buffer.
   /// Internal buffer.
   //***************************************************************************
-  template <typename T, size_t MAX_SIZE_>
-  class circular_buffer : public icircular_buffer<T>
+  template <typename T, size_t MAX_SIZE_, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class circular_buffer : public icircular_buffer<T, MEMORY_MODEL>
   {
+  private:
+
+    typedef etl::icircular_buffer<T, MEMORY_MODEL> base_t;
+
   public:
 
     ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity etl::circular_buffer is not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ < etl::integral_limits<typename base_t::size_type>::max), "Size too large for memory model");
 
-    static ETL_CONSTANT typename icircular_buffer<T>::size_type MAX_SIZE = typename icircular_buffer<T>::size_type(MAX_SIZE_);
+    static ETL_CONSTANT typename base_t::size_type MAX_SIZE = typename base_t::size_type(MAX_SIZE_);
 
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
     circular_buffer()
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
+      : base_t(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
     {
     }
 
@@ -1050,7 +1245,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     circular_buffer(TIterator first, const TIterator& last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
+      : base_t(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
     {
       while (first != last)
       {
@@ -1063,7 +1258,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     circular_buffer(std::initializer_list<T> init)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
+      : base_t(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
     {
       this->push(init.begin(), init.end());
     }
@@ -1073,7 +1268,7 @@ namespace etl
     /// Copy Constructor.
     //*************************************************************************
     circular_buffer(const circular_buffer& other)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
+      : base_t(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
     {
       if (this != &other)
       {
@@ -1100,11 +1295,11 @@ namespace etl
     /// Move Constructor.
     //*************************************************************************
     circular_buffer(circular_buffer&& other)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
+      : base_t(reinterpret_cast<T*>(buffer.raw), MAX_SIZE)
     {
       if (this != &other)
       {
-        typename etl::icircular_buffer<T>::iterator itr = other.begin();
+        typename base_t::iterator itr = other.begin();
         while (itr != other.end())
         {
           this->push(etl::move(*itr));
@@ -1122,7 +1317,7 @@ namespace etl
       {
         this->clear();
 
-        for (typename etl::icircular_buffer<T>::const_iterator itr = other.begin(); itr != other.end(); ++itr)
+        for (typename base_t::const_iterator itr = other.begin(); itr != other.end(); ++itr)
         {          
           this->push(etl::move(*itr));
         }
@@ -1151,16 +1346,20 @@ namespace etl
   /// A fixed capacity circular buffer.
   /// External buffer.
   //***************************************************************************
-  template <typename T>
-  class circular_buffer_ext : public icircular_buffer<T>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class circular_buffer_ext : public icircular_buffer<T, MEMORY_MODEL>
   {
+  private:
+
+    typedef etl::icircular_buffer<T, MEMORY_MODEL> base_t;
+
   public:
 
     //*************************************************************************
     /// Constructor.
     //*************************************************************************
     circular_buffer_ext(void* buffer, size_t max_size)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
     {
     }
 
@@ -1170,7 +1369,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     circular_buffer_ext(TIterator first, const TIterator& last, void* buffer, size_t max_size, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
     {
       while (first != last)
       {
@@ -1183,7 +1382,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     circular_buffer_ext(std::initializer_list<T> init, void* buffer, size_t max_size)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
     {
       this->push(init.begin(), init.end());
     }
@@ -1193,7 +1392,7 @@ namespace etl
     /// Copy Constructor.
     //*************************************************************************
     circular_buffer_ext(const circular_buffer_ext& other, void* buffer, size_t max_size)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
     {
       if (this != &other)
       {
@@ -1221,11 +1420,11 @@ namespace etl
     /// Move Constructor.
     //*************************************************************************
     circular_buffer_ext(circular_buffer_ext&& other, void* buffer, size_t max_size)
-      : icircular_buffer<T>(reinterpret_cast<T*>(buffer), max_size)
+      : base_t(reinterpret_cast<T*>(buffer), max_size)
     {
       if (this != &other)
       {
-        typename etl::icircular_buffer<T>::iterator itr = other.begin();
+        typename base_t::iterator itr = other.begin();
         while (itr != other.end())
         {
           this->push(etl::move(*itr));
@@ -1243,7 +1442,7 @@ namespace etl
       {
         this->clear();
 
-        for (typename etl::icircular_buffer<T>::iterator itr = other.begin(); itr != other.end(); ++itr)
+        for (typename base_t::iterator itr = other.begin(); itr != other.end(); ++itr)
         {          
           this->push(etl::move(*itr));
         }
@@ -1286,8 +1485,8 @@ namespace etl
   //*************************************************************************
   /// Overloaded swap for etl::circular_buffer_ext<T, 0>
   //*************************************************************************
-  template <typename T>
-  void swap(etl::circular_buffer_ext<T>& lhs, etl::circular_buffer_ext<T>& rhs)
+  template <typename T, const size_t MEMORY_MODEL>
+  void swap(etl::circular_buffer_ext<T, MEMORY_MODEL>& lhs, etl::circular_buffer_ext<T, MEMORY_MODEL>& rhs)
   {
     lhs.swap(rhs);
   }
@@ -1295,8 +1494,8 @@ namespace etl
   //*************************************************************************
   /// Equality operator
   //*************************************************************************
-  template <typename T>
-  bool operator ==(const icircular_buffer<T>& lhs, const icircular_buffer<T>& rhs)
+  template <typename T, const size_t MEMORY_MODEL>
+  bool operator ==(const icircular_buffer<T, MEMORY_MODEL>& lhs, const icircular_buffer<T, MEMORY_MODEL>& rhs)
   {
     return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
   }
@@ -1304,8 +1503,8 @@ namespace etl
   //*************************************************************************
   /// Inequality operator
   //*************************************************************************
-  template <typename T>
-  bool operator !=(const icircular_buffer<T>& lhs, const icircular_buffer<T>& rhs)
+  template <typename T, const size_t MEMORY_MODEL>
+  bool operator !=(const icircular_buffer<T, MEMORY_MODEL>& lhs, const icircular_buffer<T, MEMORY_MODEL>& rhs)
   {
     return !(lhs == rhs);
   }
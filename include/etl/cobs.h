@@ -0,0 +1,407 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COBS_INCLUDED
+#define ETL_COBS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "span.h"
+
+#if ETL_CPP11_SUPPORTED
+
+///\defgroup cobs cobs
+/// Consistent Overhead Byte Stuffing.
+/// Encodes a frame so that it contains no zero bytes, with a zero byte used
+/// as the frame delimiter. The overhead is one byte per 254 bytes of data,
+/// plus one.
+/// The encoder and decoder both accept their input in pieces, so a frame may
+/// be split across any number of buffers.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_cobs
+  {
+    //*************************************************************************
+    /// Copies up to n bytes, stopping before the first zero.
+    /// Returns the number of bytes copied.
+    /// Short runs are quicker a byte at a time than with memchr and memcpy.
+    //*************************************************************************
+    inline size_t copy_non_zero(uint8_t* destination, const uint8_t* source, size_t n)
+    {
+      if (n < 32U)
+      {
+        size_t i = 0U;
+
+        while ((i < n) && (source[i] != 0U))
+        {
+          destination[i] = source[i];
+          ++i;
+        }
+
+        return i;
+      }
+
+      const uint8_t* pzero = static_cast<const uint8_t*>(memchr(source, 0, n));
+      const size_t   count = (pzero != ETL_NULLPTR) ? size_t(pzero - source) : n;
+
+      memcpy(destination, source, count);
+
+      return count;
+    }
+  }
+
+  //***************************************************************************
+  /// The largest encoded size of a frame of 'size' bytes, not including the
+  /// delimiter.
+  ///\ingroup cobs
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t cobs_max_encoded_size(size_t size)
+  {
+    return size + (size / 254U) + 1U;
+  }
+
+  //***************************************************************************
+  /// Encodes a frame into an output buffer.
+  /// Each block's code byte is written once the block is complete, so the
+  /// output must be one contiguous buffer, but the input may be added in
+  /// pieces.
+  ///\ingroup cobs
+  //***************************************************************************
+  class cobs_encoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit cobs_encoder(etl::span<uint8_t> output_)
+      : output(output_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Starts a new frame at the beginning of the output buffer.
+    //*************************************************************************
+    void restart()
+    {
+      code_index = 0U;
+      out_index  = 1U;
+      code       = 1U;
+      overflow   = output.empty();
+    }
+
+    //*************************************************************************
+    /// Adds data to the frame.
+    /// Returns false if the output buffer is full.
+    //*************************************************************************
+    bool add(etl::span<const uint8_t> input)
+    {
+      const uint8_t* p = input.data();
+      size_t         n = input.size();
+
+      while ((n != 0U) && !overflow)
+      {
+        if (code == 0xFFU)
+        {
+          close_block();
+        }
+
+        // Copy up to the next zero, or the end of the block.
+        const size_t run   = (n < size_t(0xFFU - code)) ? n : size_t(0xFFU - code);
+        const size_t room  = output.size() - out_index;
+        const size_t limit = (run < room) ? run : room;
+        const size_t count = private_cobs::copy_non_zero(output.data() + out_index, p, limit);
+
+        out_index += count;
+        code      += uint8_t(count);
+        p         += count;
+        n         -= count;
+
+        if (count < limit)
+        {
+          // Stopped at a zero.
+          close_block();
+          ++p;
+          --n;
+        }
+        else if (limit < run)
+        {
+          overflow = true;
+        }
+      }
+
+      return !overflow;
+    }
+
+    //*************************************************************************
+    /// Completes the frame, optionally followed by a zero delimiter.
+    /// Returns the encoded size, or zero if the output buffer was too small.
+    //*************************************************************************
+    size_t finish(bool add_delimiter = true)
+    {
+      if (overflow)
+      {
+        return 0U;
+      }
+
+      output[code_index] = code;
+
+      if (add_delimiter)
+      {
+        if (out_index == output.size())
+        {
+          overflow = true;
+          return 0U;
+        }
+
+        output[out_index++] = 0U;
+      }
+
+      return out_index;
+    }
+
+    //*************************************************************************
+    /// True if the output buffer was too small.
+    //*************************************************************************
+    bool has_overflowed() const
+    {
+      return overflow;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Writes the code for the current block and starts the next one.
+    //*************************************************************************
+    void close_block()
+    {
+      if (out_index == output.size())
+      {
+        overflow = true;
+        return;
+      }
+
+      output[code_index] = code;
+      code_index = out_index++;
+      code       = 1U;
+    }
+
+    etl::span<uint8_t> output;     ///< The output buffer.
+    size_t             code_index; ///< Where the current block's code goes.
+    size_t             out_index;  ///< The next byte to write.
+    uint8_t            code;       ///< One more than the length of the current block.
+    bool               overflow;   ///< True if the output buffer is too small.
+  };
+
+  //***************************************************************************
+  /// Encodes a frame in one go.
+  /// Returns the encoded size, or zero if the output buffer is too small.
+  ///\ingroup cobs
+  //***************************************************************************
+  inline size_t cobs_encode(etl::span<const uint8_t> input, etl::span<uint8_t> output, bool add_delimiter = true)
+  {
+    etl::cobs_encoder encoder(output);
+
+    encoder.add(input);
+
+    return encoder.finish(add_delimiter);
+  }
+
+  //***************************************************************************
+  /// Decodes frames from a stream of encoded bytes.
+  /// Input is given with decode(), which stops after the delimiter at the end
+  /// of a frame and returns the number of bytes it consumed. The rest of the
+  /// input can be given again once the frame has been dealt with and
+  /// next_frame() called.
+  /// Zero delimiters with nothing between them are skipped.
+  ///\ingroup cobs
+  //***************************************************************************
+  class cobs_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit cobs_decoder(etl::span<uint8_t> output_)
+      : output(output_)
+    {
+      next_frame();
+    }
+
+    //*************************************************************************
+    /// Decodes input until the end of a frame or the end of the input.
+    /// Returns the number of bytes consumed.
+    //*************************************************************************
+    size_t decode(etl::span<const uint8_t> input)
+    {
+      const uint8_t* const pbegin = input.data();
+      const uint8_t*       p      = pbegin;
+      const uint8_t* const pend   = pbegin + input.size();
+
+      while ((p != pend) && !complete)
+      {
+        if (error)
+        {
+          // Discard everything up to the next delimiter.
+          const uint8_t* pzero = static_cast<const uint8_t*>(memchr(p, 0, size_t(pend - p)));
+
+          if (pzero == ETL_NULLPTR)
+          {
+            p = pend;
+          }
+          else
+          {
+            p        = pzero + 1;
+            complete = true;
+          }
+        }
+        else if (remaining == 0U)
+        {
+          // A code byte, or the delimiter.
+          const uint8_t code = *p++;
+
+          if (code == 0U)
+          {
+            complete = started;
+          }
+          else
+          {
+            if (zero_pending)
+            {
+              put_zero();
+            }
+
+            started      = true;
+            remaining    = uint8_t(code - 1U);
+            zero_pending = (code != 0xFFU);
+          }
+        }
+        else
+        {
+          // Copy the block's data, up to an unexpected zero.
+          const size_t run   = (size_t(pend - p) < remaining) ? size_t(pend - p) : size_t(remaining);
+          const size_t room  = output.size() - out_index;
+          const size_t limit = (run < room) ? run : room;
+          const size_t count = private_cobs::copy_non_zero(output.data() + out_index, p, limit);
+
+          out_index += count;
+          remaining  = uint8_t(remaining - count);
+          p         += count;
+
+          if (count < limit)
+          {
+            // The frame ended part way through a block.
+            ++p;
+            error    = true;
+            complete = true;
+          }
+          else if (limit < run)
+          {
+            error = true;
+          }
+        }
+      }
+
+      return size_t(p - pbegin);
+    }
+
+    //*************************************************************************
+    /// True if a whole frame has been decoded, or discarded after an error.
+    //*************************************************************************
+    bool is_complete() const
+    {
+      return complete;
+    }
+
+    //*************************************************************************
+    /// True if the frame was malformed or did not fit in the output buffer.
+    //*************************************************************************
+    bool has_error() const
+    {
+      return error;
+    }
+
+    //*************************************************************************
+    /// The decoded frame.
+    //*************************************************************************
+    etl::span<const uint8_t> frame() const
+    {
+      return etl::span<const uint8_t>(output.data(), out_index);
+    }
+
+    //*************************************************************************
+    /// Starts decoding the next frame into the beginning of the output buffer.
+    //*************************************************************************
+    void next_frame()
+    {
+      out_index    = 0U;
+      remaining    = 0U;
+      zero_pending = false;
+      started      = false;
+      complete     = false;
+      error        = false;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the zero implied by the end of a short block.
+    //*************************************************************************
+    void put_zero()
+    {
+      if (out_index == output.size())
+      {
+        error = true;
+      }
+      else
+      {
+        output[out_index++] = 0U;
+      }
+    }
+
+    etl::span<uint8_t> output;       ///< The output buffer.
+    size_t             out_index;    ///< The next byte to write.
+    uint8_t            remaining;    ///< Data bytes left in the current block.
+    bool               zero_pending; ///< True if the current block is followed by a zero.
+    bool               started;      ///< True once a code byte has been seen.
+    bool               complete;     ///< True once the delimiter has been seen.
+    bool               error;        ///< True if the frame is bad.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,447 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPACT_OPTIONAL_INCLUDED
+#define ETL_COMPACT_OPTIONAL_INCLUDED
+
+#include "platform.h"
+#include "optional.h"
+#include "limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+
+///\defgroup compact_optional compact_optional
+/// An optional that marks 'no value' with a value of T that is never used,
+/// rather than with a separate flag, so it is the same size as T.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Policy where 'no value' is a sentinel value of an integral, enum or
+  /// pointer type.
+  ///\ingroup compact_optional
+  //***************************************************************************
+  template <typename T, T Sentinel>
+  struct compact_optional_sentinel
+  {
+    static ETL_CONSTEXPR T empty_value()
+    {
+      return Sentinel;
+    }
+
+    static ETL_CONSTEXPR bool is_empty(const T& value)
+    {
+      return value == Sentinel;
+    }
+  };
+
+  //***************************************************************************
+  /// Policy where 'no value' is a quiet NaN.
+  /// Any NaN is seen as 'no value'.
+  /// Not usable with options that assume there are no NaNs, such as -ffast-math.
+  ///\ingroup compact_optional
+  //***************************************************************************
+  template <typename T>
+  struct compact_optional_nan
+  {
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "T must be a floating point type");
+
+    static ETL_CONSTEXPR T empty_value()
+    {
+      return etl::numeric_limits<T>::quiet_NaN();
+    }
+
+    static ETL_CONSTEXPR bool is_empty(const T& value)
+    {
+      return value != value;
+    }
+  };
+
+  //***************************************************************************
+  /// Policy where 'no value' is a null pointer.
+  ///\ingroup compact_optional
+  //***************************************************************************
+  template <typename T>
+  struct compact_optional_null
+  {
+    ETL_STATIC_ASSERT(etl::is_pointer<T>::value, "T must be a pointer type");
+
+    static ETL_CONSTEXPR T empty_value()
+    {
+      return ETL_NULLPTR;
+    }
+
+    static ETL_CONSTEXPR bool is_empty(const T& value)
+    {
+      return value == ETL_NULLPTR;
+    }
+  };
+
+  //***************************************************************************
+  /// The default policy.
+  /// NaN for floating point types and null for pointers.
+  /// Other types must specify a policy, such as compact_optional_sentinel.
+  ///\ingroup compact_optional
+  //***************************************************************************
+  template <typename T, bool Is_Floating_Point = etl::is_floating_point<T>::value, bool Is_Pointer = etl::is_pointer<T>::value>
+  struct compact_optional_default
+  {
+    ETL_STATIC_ASSERT(Is_Floating_Point || Is_Pointer, "No default policy for this type. Specify one, such as etl::compact_optional_sentinel");
+  };
+
+  template <typename T>
+  struct compact_optional_default<T, true, false> : public etl::compact_optional_nan<T>
+  {
+  };
+
+  template <typename T>
+  struct compact_optional_default<T, false, true> : public etl::compact_optional_null<T>
+  {
+  };
+
+  //***************************************************************************
+  /// An optional with the same interface as etl::optional, that stores
+  /// 'no value' in T itself, as defined by TPolicy, instead of in a separate
+  /// flag. An array of compact_optional<float> is half the size of an array
+  /// of optional<float>.
+  /// The empty value itself cannot be stored; assigning it gives 'no value'.
+  /// If ETL_DEBUG is defined then this asserts etl::optional_invalid.
+  ///\tparam T       The type to store, usually a scalar.
+  ///\tparam TPolicy Defines empty_value() and is_empty(value).
+  ///\ingroup compact_optional
+  //***************************************************************************
+  template <typename T, typename TPolicy = etl::compact_optional_default<T> >
+  class compact_optional
+  {
+  public:
+
+    typedef T       value_type;
+    typedef TPolicy policy_type;
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    ETL_CONSTEXPR compact_optional()
+      : data(TPolicy::empty_value())
+    {
+    }
+
+    //***************************************************************************
+    /// Constructor with nullopt.
+    //***************************************************************************
+    ETL_CONSTEXPR compact_optional(etl::nullopt_t)
+      : data(TPolicy::empty_value())
+    {
+    }
+
+    //***************************************************************************
+    /// Constructor from value type.
+    //***************************************************************************
+    compact_optional(const T& value_)
+      : data(value_)
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(!TPolicy::is_empty(value_), ETL_ERROR(optional_invalid));
+#endif
+    }
+
+    //***************************************************************************
+    /// Assignment operator from nullopt.
+    //***************************************************************************
+    compact_optional& operator =(etl::nullopt_t)
+    {
+      reset();
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Assignment operator from value type.
+    //***************************************************************************
+    compact_optional& operator =(const T& value_)
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(!TPolicy::is_empty(value_), ETL_ERROR(optional_invalid));
+#endif
+
+      data = value_;
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Pointer operator.
+    //***************************************************************************
+    T* operator ->()
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return &data;
+    }
+
+    //***************************************************************************
+    /// Pointer operator.
+    //***************************************************************************
+    const T* operator ->() const
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return &data;
+    }
+
+    //***************************************************************************
+    /// Dereference operator.
+    //***************************************************************************
+    T& operator *()
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return data;
+    }
+
+    //***************************************************************************
+    /// Dereference operator.
+    //***************************************************************************
+    const T& operator *() const
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return data;
+    }
+
+    //***************************************************************************
+    /// Bool conversion operator.
+    //***************************************************************************
+    ETL_EXPLICIT operator bool() const
+    {
+      return has_value();
+    }
+
+    //***************************************************************************
+    // Check whether optional contains value
+    //***************************************************************************
+    ETL_CONSTEXPR bool has_value() const ETL_NOEXCEPT
+    {
+      return !TPolicy::is_empty(data);
+    }
+
+    //***************************************************************************
+    /// Get a reference to the value.
+    //***************************************************************************
+    T& value()
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return data;
+    }
+
+    //***************************************************************************
+    /// Get a const reference to the value.
+    //***************************************************************************
+    const T& value() const
+    {
+#if defined(ETL_DEBUG)
+      ETL_ASSERT(has_value(), ETL_ERROR(optional_invalid));
+#endif
+
+      return data;
+    }
+
+    //***************************************************************************
+    /// Gets the value or a default if no valid.
+    //***************************************************************************
+    T value_or(T default_value) const
+    {
+      return has_value() ? data : default_value;
+    }
+
+    //***************************************************************************
+    /// Swaps this value with another.
+    //***************************************************************************
+    void swap(compact_optional& other)
+    {
+      T temp = data;
+      data = other.data;
+      other.data = temp;
+    }
+
+    //***************************************************************************
+    /// Reset back to invalid.
+    //***************************************************************************
+    void reset()
+    {
+      data = TPolicy::empty_value();
+    }
+
+    //*************************************************************************
+    /// Emplaces a value.
+    //*************************************************************************
+    void emplace(const T& value_)
+    {
+      *this = value_;
+    }
+
+  private:
+
+    T data;
+  };
+
+  //***************************************************************************
+  /// Equality operator.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator ==(const etl::compact_optional<T, TPolicy>& lhs, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    if (bool(lhs) != bool(rhs))
+    {
+      return false;
+    }
+    else if (!bool(lhs))
+    {
+      return true;
+    }
+    else
+    {
+      return lhs.value() == rhs.value();
+    }
+  }
+
+  //***************************************************************************
+  /// Inequality operator.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator !=(const etl::compact_optional<T, TPolicy>& lhs, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator <(const etl::compact_optional<T, TPolicy>& lhs, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    if (!bool(rhs))
+    {
+      return false;
+    }
+    else if (!bool(lhs))
+    {
+      return true;
+    }
+    else
+    {
+      return lhs.value() < rhs.value();
+    }
+  }
+
+  //***************************************************************************
+  /// Equality operator with nullopt.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator ==(const etl::compact_optional<T, TPolicy>& lhs, etl::nullopt_t)
+  {
+    return !bool(lhs);
+  }
+
+  template <typename T, typename TPolicy>
+  bool operator ==(etl::nullopt_t, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    return !bool(rhs);
+  }
+
+  //***************************************************************************
+  /// Inequality operator with nullopt.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator !=(const etl::compact_optional<T, TPolicy>& lhs, etl::nullopt_t)
+  {
+    return bool(lhs);
+  }
+
+  template <typename T, typename TPolicy>
+  bool operator !=(etl::nullopt_t, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    return bool(rhs);
+  }
+
+  //***************************************************************************
+  /// Equality operator with a value.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator ==(const etl::compact_optional<T, TPolicy>& lhs, const T& rhs)
+  {
+    return bool(lhs) ? lhs.value() == rhs : false;
+  }
+
+  template <typename T, typename TPolicy>
+  bool operator ==(const T& lhs, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    return bool(rhs) ? lhs == rhs.value() : false;
+  }
+
+  //***************************************************************************
+  /// Inequality operator with a value.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  bool operator !=(const etl::compact_optional<T, TPolicy>& lhs, const T& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template <typename T, typename TPolicy>
+  bool operator !=(const T& lhs, const etl::compact_optional<T, TPolicy>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Swaps the values.
+  //***************************************************************************
+  template <typename T, typename TPolicy>
+  void swap(etl::compact_optional<T, TPolicy>& lhs, etl::compact_optional<T, TPolicy>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+}
+
+#endif
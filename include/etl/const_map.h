@@ -0,0 +1,518 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_MAP_INCLUDED
+#define ETL_CONST_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "parameter_type.h"
+#include "string_view.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+//*****************************************************************************
+///\defgroup const_map const_map
+/// A map of a fixed set of keys that may be built at compile time.
+/// The elements are found with a minimal perfect hash, so a lookup hashes the
+/// key once, reads one displacement and one index, and compares one key.
+/// A constexpr const_map has no construction cost and may be placed in ROM.
+/// Requires C++14.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_CPP14_SUPPORTED
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_exception : public etl::exception
+  {
+  public:
+
+    const_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Duplicate key exception for the const_map.
+  /// Also raised if two different keys have the same hash.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_duplicate : public etl::const_map_exception
+  {
+  public:
+
+    const_map_duplicate(string_type file_name_, numeric_type line_number_)
+      : etl::const_map_exception(ETL_ERROR_TEXT("const_map:duplicate", ETL_CONST_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_out_of_range : public etl::const_map_exception
+  {
+  public:
+
+    const_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::const_map_exception(ETL_ERROR_TEXT("const_map:range", ETL_CONST_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The default hash for const_map keys.
+  /// Must be usable in a constant expression, so is defined for integral and
+  /// enum keys, and for string views. Other keys need a user supplied hash.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey>
+  struct const_map_hash
+  {
+    constexpr uint64_t operator()(TKey key) const
+    {
+      return static_cast<uint64_t>(key);
+    }
+  };
+
+  //*************************************
+  template <typename T, typename TTraits>
+  struct const_map_hash<etl::basic_string_view<T, TTraits> >
+  {
+    /// FNV-1a.
+    constexpr uint64_t operator()(const etl::basic_string_view<T, TTraits>& key) const
+    {
+      uint64_t hash = 14695981039346656037ULL;
+
+      for (size_t i = 0U; i < key.size(); ++i)
+      {
+        hash = (hash ^ static_cast<uint64_t>(key[i])) * 1099511628211ULL;
+      }
+
+      return hash;
+    }
+  };
+
+  namespace private_const_map
+  {
+    //*************************************************************************
+    /// A list of indexes, to expand the initialiser list in to the elements.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <typename TFirst, typename TSecond>
+    struct join_index_sequences;
+
+    template <size_t... First, size_t... Second>
+    struct join_index_sequences<index_sequence<First...>, index_sequence<Second...> >
+    {
+      typedef index_sequence<First..., (sizeof...(First) + Second)...> type;
+    };
+
+    /// Built in halves, so the template depth grows with log(N).
+    template <size_t N>
+    struct make_index_sequence
+      : join_index_sequences<typename make_index_sequence<N / 2U>::type, typename make_index_sequence<N - (N / 2U)>::type>
+    {
+    };
+
+    template <>
+    struct make_index_sequence<0U>
+    {
+      typedef index_sequence<> type;
+    };
+
+    template <>
+    struct make_index_sequence<1U>
+    {
+      typedef index_sequence<0U> type;
+    };
+
+    //*************************************************************************
+    /// Not constexpr, so that a repeated key in a constexpr const_map fails to
+    /// compile, whatever the error handling configuration.
+    //*************************************************************************
+    inline void const_map_key_is_repeated()
+    {
+    }
+
+    //*************************************************************************
+    /// Finalises a hash, so that every bit depends on every input bit.
+    //*************************************************************************
+    constexpr uint64_t mix(uint64_t value)
+    {
+      value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+      return value ^ (value >> 31);
+    }
+
+    //*************************************************************************
+    /// Maps the top 32 bits of a hash on to [0, range).
+    //*************************************************************************
+    constexpr size_t reduce(uint64_t hash, size_t range)
+    {
+      return size_t(((hash >> 32U) * uint64_t(range)) >> 32U);
+    }
+  }
+
+  //***************************************************************************
+  /// A map of a fixed set of keys.
+  /// e.g.
+  /// constexpr etl::const_map<int, const char*, 3> names({ { 1, "one" }, { 2, "two" }, { 3, "three" } });
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam SIZE_     The number of elements.
+  ///\tparam THash     The hash. Must be constexpr to build at compile time.
+  ///\tparam TKeyEqual The key equality function.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t SIZE_, typename THash = etl::const_map_hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class const_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(SIZE_ > 0U, "A const_map must have at least one element");
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+
+    typedef TKey              key_type;
+    typedef TMapped           mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    static ETL_CONSTANT size_t SIZE = SIZE_;
+
+    /// The number of displacement buckets. About four keys share each.
+    static ETL_CONSTANT size_t Buckets = (SIZE_ + 3U) / 4U;
+
+    //*************************************************************************
+    /// Constructs the map from a list of elements, in any order.
+    /// If asserts or exceptions are enabled, emits const_map_duplicate if a key is repeated.
+    /// If the map is constexpr then a repeated key is a compile error.
+    //*************************************************************************
+    constexpr const_map(const value_type (&values)[SIZE_])
+      : const_map(values, typename private_const_map::make_index_sequence<SIZE_>::type())
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element, in the order given.
+    //*************************************************************************
+    constexpr const_iterator begin() const
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element, in the order given.
+    //*************************************************************************
+    constexpr const_iterator cbegin() const
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the elements.
+    //*************************************************************************
+    constexpr const_iterator end() const
+    {
+      return elements + SIZE_;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the elements.
+    //*************************************************************************
+    constexpr const_iterator cend() const
+    {
+      return elements + SIZE_;
+    }
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element, or end() if not found.
+    //*************************************************************************
+    constexpr const_iterator find(key_parameter_t key) const
+    {
+      const uint64_t hash  = private_const_map::mix(key_hash_function(key));
+      const_iterator itr   = elements + indexes[slot_of(hash, displacements[bucket_of(hash)])];
+
+      return key_equal_function(itr->first, key) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*************************************************************************
+    constexpr size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*************************************************************************
+    constexpr bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits a const_map_out_of_range if the key is not in the map.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*************************************************************************
+    constexpr const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(const_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Gets the size of the map.
+    //*************************************************************************
+    constexpr size_type size() const
+    {
+      return SIZE_;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum size of the map.
+    //*************************************************************************
+    constexpr size_type max_size() const
+    {
+      return SIZE_;
+    }
+
+    //*************************************************************************
+    /// A const_map is never empty.
+    //*************************************************************************
+    constexpr bool empty() const
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Gets the hash function.
+    //*************************************************************************
+    constexpr hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Gets the key equality function.
+    //*************************************************************************
+    constexpr key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<SIZE_ - 1U>::type index_type;
+
+    //*************************************************************************
+    /// Copies the elements and builds the hash.
+    //*************************************************************************
+    template <size_t... Indexes>
+    constexpr const_map(const value_type (&values)[SIZE_], private_const_map::index_sequence<Indexes...>)
+      : elements{ values[Indexes]... },
+        indexes(),
+        displacements(),
+        key_hash_function(),
+        key_equal_function()
+    {
+      build();
+    }
+
+    //*************************************************************************
+    static constexpr size_t bucket_of(uint64_t hash)
+    {
+      return private_const_map::reduce(hash, Buckets);
+    }
+
+    //*************************************************************************
+    static constexpr size_t slot_of(uint64_t hash, uint32_t displacement)
+    {
+      return private_const_map::reduce((hash ^ (uint64_t(displacement) * 0x9E3779B97F4A7C15ULL)) * 0xD6E8FEB86659FD93ULL, SIZE_);
+    }
+
+    //*************************************************************************
+    /// Finds a displacement for each bucket that sends its keys to free slots.
+    /// The largest buckets are placed first, while most slots are free.
+    //*************************************************************************
+    constexpr void build()
+    {
+      uint64_t hashes[SIZE_] = {};
+      size_t   first_member[Buckets + 1U] = {};
+      size_t   members[SIZE_] = {};
+      size_t   slots[SIZE_] = {};
+      bool     occupied[SIZE_] = {};
+
+      // Group the elements by bucket.
+      for (size_t i = 0U; i < SIZE_; ++i)
+      {
+        hashes[i] = private_const_map::mix(key_hash_function(elements[i].first));
+        ++first_member[bucket_of(hashes[i]) + 1U];
+      }
+
+      size_t largest = 0U;
+
+      for (size_t b = 0U; b < Buckets; ++b)
+      {
+        largest = (first_member[b + 1U] > largest) ? first_member[b + 1U] : largest;
+        first_member[b + 1U] += first_member[b];
+      }
+
+      {
+        size_t next[Buckets] = {};
+
+        for (size_t i = 0U; i < SIZE_; ++i)
+        {
+          const size_t b = bucket_of(hashes[i]);
+          members[first_member[b] + next[b]++] = i;
+        }
+      }
+
+      for (size_t bucket_size = largest; bucket_size > 0U; --bucket_size)
+      {
+        for (size_t b = 0U; b < Buckets; ++b)
+        {
+          const size_t first = first_member[b];
+          const size_t last  = first_member[b + 1U];
+
+          if ((last - first) != bucket_size)
+          {
+            continue;
+          }
+
+          // Equal hashes would always share a slot.
+          for (size_t i = first; i < last; ++i)
+          {
+            for (size_t j = i + 1U; j < last; ++j)
+            {
+              if (hashes[members[i]] == hashes[members[j]])
+              {
+                private_const_map::const_map_key_is_repeated();
+                ETL_ASSERT_AND_RETURN(false, ETL_ERROR(const_map_duplicate));
+              }
+            }
+          }
+
+          uint32_t displacement = 0U;
+          bool     placed       = false;
+
+          while (!placed)
+          {
+            placed = true;
+
+            for (size_t i = first; placed && (i < last); ++i)
+            {
+              slots[i] = slot_of(hashes[members[i]], displacement);
+              placed   = !occupied[slots[i]];
+
+              for (size_t j = first; placed && (j < i); ++j)
+              {
+                placed = (slots[j] != slots[i]);
+              }
+            }
+
+            if (!placed)
+            {
+              ++displacement;
+            }
+          }
+
+          displacements[b] = displacement;
+
+          for (size_t i = first; i < last; ++i)
+          {
+            occupied[slots[i]] = true;
+            indexes[slots[i]]  = index_type(members[i]);
+          }
+        }
+      }
+    }
+
+    /// The elements, in the order given.
+    const value_type elements[SIZE_];
+
+    /// The element index for each slot.
+    index_type indexes[SIZE_];
+
+    /// The displacement of the slots for each bucket.
+    uint32_t displacements[Buckets];
+
+    hasher    key_hash_function;
+    key_equal key_equal_function;
+  };
+
+  template <typename TKey, typename TMapped, const size_t SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t const_map<TKey, TMapped, SIZE_, THash, TKeyEqual>::SIZE;
+
+  template <typename TKey, typename TMapped, const size_t SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t const_map<TKey, TMapped, SIZE_, THash, TKeyEqual>::Buckets;
+}
+
+#endif
+#endif
@@ -0,0 +1,528 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COROUTINE_TASK_INCLUDED
+#define ETL_COROUTINE_TASK_INCLUDED
+
+#include "platform.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <coroutine>
+
+#include "task.h"
+#include "ipool.h"
+#include "generic_pool.h"
+#include "utility.h"
+#include "nullptr.h"
+
+//*****************************************************************************
+/// Stackless coroutines that run as scheduler tasks. Requires C++20.
+///
+/// A coroutine function returns etl::coroutine and takes the frame pool as its
+/// first parameter. The frame is allocated from the pool, never from the heap.
+///
+/// etl::coroutine blink(etl::ipool& frames, const volatile uint32_t& ticks)
+/// {
+///   for (;;)
+///   {
+///     toggle_led();
+///     co_await etl::coroutine_delay(ticks, 500);
+///   }
+/// }
+///
+/// etl::coroutine_frame_pool<128, 4> frames;
+/// etl::coroutine_task blinker(1, blink(frames, system_ticks));
+/// scheduler.add_task(blinker);
+///
+/// The task reports work only when the awaited condition is met, so it suits
+/// the polling scheduler policies. It does not call set_task_ready().
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_coroutine_task
+  {
+    /// Frames are aligned as if they came from operator new.
+    static ETL_CONSTANT size_t Frame_Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    /// Space in front of each frame that records the pool that owns it.
+    static ETL_CONSTANT size_t Frame_Header_Size = (sizeof(etl::ipool*) > Frame_Alignment) ? sizeof(etl::ipool*) : Frame_Alignment;
+  }
+
+  //***************************************************************************
+  /// A pool of coroutine frames.
+  /// FRAME_SIZE is the largest frame that the pool can hold.
+  //***************************************************************************
+  template <size_t VFrameSize, size_t VMaxFrames>
+  class coroutine_frame_pool : public etl::generic_pool<VFrameSize + private_coroutine_task::Frame_Header_Size,
+                                                        private_coroutine_task::Frame_Alignment,
+                                                        VMaxFrames>
+  {
+  public:
+
+    static ETL_CONSTANT size_t FRAME_SIZE = VFrameSize;
+    static ETL_CONSTANT size_t MAX_FRAMES = VMaxFrames;
+  };
+
+  //***************************************************************************
+  /// The return type of a coroutine function.
+  /// Owns the coroutine frame and returns it to its pool on destruction.
+  //***************************************************************************
+  class coroutine
+  {
+  public:
+
+    //*************************************************************************
+    /// The coroutine promise.
+    //*************************************************************************
+    class promise_type
+    {
+    public:
+
+      typedef bool (*ready_function_t)(void*);
+
+      promise_type()
+        : p_ready(ETL_NULLPTR)
+        , p_context(ETL_NULLPTR)
+      {
+      }
+
+      //***********************************************************************
+      /// Allocates the frame from the pool passed as the first parameter.
+      /// Returns a null pointer if the pool is full or the frame is too large.
+      //***********************************************************************
+      template <typename... TArgs>
+      static void* operator new(size_t size, etl::ipool& pool, TArgs&...) noexcept
+      {
+        const size_t total_size = size + private_coroutine_task::Frame_Header_Size;
+
+        if (pool.full() || (total_size > pool.max_item_size()))
+        {
+          return ETL_NULLPTR;
+        }
+
+        char* p = pool.allocate<char>();
+
+        if (p == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        *reinterpret_cast<etl::ipool**>(p) = &pool;
+
+        return p + private_coroutine_task::Frame_Header_Size;
+      }
+
+      //***********************************************************************
+      /// Returns the frame to the pool that it came from.
+      //***********************************************************************
+      static void operator delete(void* p_frame)
+      {
+        char* p = static_cast<char*>(p_frame) - private_coroutine_task::Frame_Header_Size;
+
+        (*reinterpret_cast<etl::ipool**>(p))->release(p);
+      }
+
+      //***********************************************************************
+      static etl::coroutine get_return_object_on_allocation_failure() noexcept
+      {
+        return etl::coroutine();
+      }
+
+      //***********************************************************************
+      etl::coroutine get_return_object()
+      {
+        return etl::coroutine(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+
+      //***********************************************************************
+      /// Coroutines start suspended and run when first scheduled.
+      //***********************************************************************
+      std::suspend_always initial_suspend() noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //***********************************************************************
+      /// The frame is kept until the etl::coroutine is destroyed.
+      //***********************************************************************
+      std::suspend_always final_suspend() noexcept
+      {
+        return std::suspend_always();
+      }
+
+      //***********************************************************************
+      void return_void()
+      {
+      }
+
+      //***********************************************************************
+      void unhandled_exception()
+      {
+#if defined(ETL_THROW_EXCEPTIONS)
+        throw;
+#endif
+      }
+
+      //***********************************************************************
+      /// Sets the condition that must be met before the coroutine resumes.
+      /// Called by the awaitables.
+      //***********************************************************************
+      void set_wait(ready_function_t p_ready_, void* p_context_)
+      {
+        p_ready   = p_ready_;
+        p_context = p_context_;
+      }
+
+      //***********************************************************************
+      /// Clears the wait condition.
+      //***********************************************************************
+      void clear_wait()
+      {
+        p_ready   = ETL_NULLPTR;
+        p_context = ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Checks the wait condition.
+      //***********************************************************************
+      bool is_ready() const
+      {
+        return (p_ready == ETL_NULLPTR) || p_ready(p_context);
+      }
+
+    private:
+
+      ready_function_t p_ready;
+      void*            p_context;
+    };
+
+    typedef std::coroutine_handle<promise_type> handle_type;
+
+    //*************************************************************************
+    /// Default constructor. Not associated with a coroutine.
+    //*************************************************************************
+    coroutine()
+      : handle()
+    {
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    coroutine(coroutine&& other)
+      : handle(other.handle)
+    {
+      other.handle = handle_type();
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    coroutine& operator =(coroutine&& other)
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle       = other.handle;
+        other.handle = handle_type();
+      }
+
+      return *this;
+    }
+
+    coroutine(const coroutine&) ETL_DELETE;
+    coroutine& operator =(const coroutine&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Destructor. Returns the frame to its pool.
+    //*************************************************************************
+    ~coroutine()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is a coroutine frame.
+    /// <b>false</b> if the frame could not be allocated.
+    //*************************************************************************
+    bool valid() const
+    {
+      return static_cast<bool>(handle);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the coroutine has finished.
+    //*************************************************************************
+    bool done() const
+    {
+      return !valid() || handle.done();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the coroutine can be resumed.
+    //*************************************************************************
+    bool ready() const
+    {
+      return !done() && handle.promise().is_ready();
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutine until its next suspension point.
+    //*************************************************************************
+    void resume()
+    {
+      if (!done())
+      {
+        handle.promise().clear_wait();
+        handle.resume();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    explicit coroutine(handle_type handle_)
+      : handle(handle_)
+    {
+    }
+
+    //*************************************************************************
+    void destroy()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle = handle_type();
+      }
+    }
+
+    handle_type handle;
+  };
+
+  //***************************************************************************
+  /// A task that runs a coroutine.
+  //***************************************************************************
+  class coroutine_task : public etl::task
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    coroutine_task(etl::task_priority_t priority, etl::coroutine&& coroutine_)
+      : task(priority)
+      , co(etl::move(coroutine_))
+    {
+    }
+
+    //*************************************************************************
+    /// Returns 1 if the coroutine is ready to resume, otherwise 0.
+    //*************************************************************************
+    uint32_t task_request_work() const override
+    {
+      return co.ready() ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Resumes the coroutine.
+    //*************************************************************************
+    void task_process_work() override
+    {
+      co.resume();
+    }
+
+    //*************************************************************************
+    /// Replaces the coroutine. The old frame is released.
+    //*************************************************************************
+    void set_coroutine(etl::coroutine&& coroutine_)
+    {
+      co = etl::move(coroutine_);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the coroutine has finished.
+    //*************************************************************************
+    bool done() const
+    {
+      return co.done();
+    }
+
+  private:
+
+    etl::coroutine co;
+  };
+
+  //***************************************************************************
+  /// Awaitable that gives the other tasks a turn.
+  /// co_await etl::coroutine_yield();
+  //***************************************************************************
+  class coroutine_yield
+  {
+  public:
+
+    bool await_ready() const noexcept
+    {
+      return false;
+    }
+
+    void await_suspend(etl::coroutine::handle_type) const noexcept
+    {
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Awaitable that waits for a number of ticks to pass.
+  /// The tick counter is typically incremented by a timer interrupt.
+  /// co_await etl::coroutine_delay(ticks, 100);
+  //***************************************************************************
+  class coroutine_delay
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor. The delay starts now.
+    //*************************************************************************
+    coroutine_delay(const volatile uint32_t& clock_, uint32_t delay_)
+      : clock(clock_)
+      , start(clock_)
+      , delay(delay_)
+    {
+    }
+
+    bool await_ready() const noexcept
+    {
+      return elapsed();
+    }
+
+    void await_suspend(etl::coroutine::handle_type handle) noexcept
+    {
+      handle.promise().set_wait(&coroutine_delay::is_ready, this);
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    bool elapsed() const
+    {
+      return uint32_t(clock - start) >= delay;
+    }
+
+    //*************************************************************************
+    static bool is_ready(void* p_context)
+    {
+      return static_cast<const coroutine_delay*>(p_context)->elapsed();
+    }
+
+    const volatile uint32_t& clock;
+    const uint32_t           start;
+    const uint32_t           delay;
+  };
+
+  //***************************************************************************
+  /// Awaitable that waits for a value to arrive in a queue.
+  /// The queue must have 'bool pop(value_type&)', such as
+  /// etl::queue_spsc_atomic, etl::queue_spsc_isr or etl::queue_mpmc_atomic.
+  /// The value_type must be default constructible.
+  /// uint8_t c = co_await etl::coroutine_pop(rx_queue);
+  //***************************************************************************
+  template <typename TQueue>
+  class coroutine_pop
+  {
+  public:
+
+    typedef typename TQueue::value_type value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit coroutine_pop(TQueue& queue_)
+      : queue(queue_)
+      , value()
+      , has_value(false)
+    {
+    }
+
+    bool await_ready() noexcept
+    {
+      return try_pop();
+    }
+
+    void await_suspend(etl::coroutine::handle_type handle) noexcept
+    {
+      handle.promise().set_wait(&coroutine_pop::is_ready, this);
+    }
+
+    value_type await_resume()
+    {
+      return etl::move(value);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The value is taken as soon as it is seen, so a policy that polls
+    /// without running the task does not lose it to another consumer.
+    //*************************************************************************
+    bool try_pop()
+    {
+      if (!has_value)
+      {
+        has_value = queue.pop(value);
+      }
+
+      return has_value;
+    }
+
+    //*************************************************************************
+    static bool is_ready(void* p_context)
+    {
+      return static_cast<coroutine_pop*>(p_context)->try_pop();
+    }
+
+    TQueue&    queue;
+    value_type value;
+    bool       has_value;
+  };
+}
+
+#endif
+#endif
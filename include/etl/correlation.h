@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_kernels.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -133,10 +134,9 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first1, TIterator last1, TIterator first2)
     {
-      while (first1 != last1)
-      {
-        add(*first1++, *first2++);
-      }
+      typedef private_statistics::use_kernel<TIterator, TInput, calc_t> use_kernel_t;
+
+      add_range(first1, last1, first2, etl::integral_constant<bool, use_kernel_t::value>());
     }
 
     //*********************************
@@ -212,6 +212,39 @@ namespace etl
 
   private:
   
+    //*********************************
+    /// Add a range, a pair of values at a time.
+    //*********************************
+    template <typename TIterator>
+    void add_range(TIterator first1, TIterator last1, TIterator first2, etl::false_type)
+    {
+      while (first1 != last1)
+      {
+        add(*first1++, *first2++);
+      }
+    }
+
+    //*********************************
+    /// Add contiguous ranges of int16_t or float with the block kernel.
+    //*********************************
+    void add_range(const TInput* first1, const TInput* last1, const TInput* first2, etl::true_type)
+    {
+      typedef typename private_statistics::kernel<TInput>::accumulator_type accumulator_t;
+
+      const size_t n = size_t(last1 - first1);
+
+      private_statistics::co_moments<accumulator_t> block;
+      private_statistics::accumulate_co_moments<true>(first1, first2, n, block);
+
+      inner_product   += calc_t(block.inner_product);
+      sum_of_squares1 += calc_t(block.sum_of_squares1);
+      sum_of_squares2 += calc_t(block.sum_of_squares2);
+      sum1            += calc_t(block.sum1);
+      sum2            += calc_t(block.sum2);
+      counter         += uint32_t(n);
+      recalculate = true;
+    }
+
     //*********************************
     /// Do the calculation.
     //*********************************
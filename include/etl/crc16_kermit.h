@@ -70,6 +70,8 @@ namespace etl
   };
 #endif
 
+  typedef etl::crc16_kermit_t<4096U> crc16_kermit_t4096;
+  typedef etl::crc16_kermit_t<2048U> crc16_kermit_t2048;
   typedef etl::crc16_kermit_t<256U> crc16_kermit_t256;
   typedef etl::crc16_kermit_t<16U>  crc16_kermit_t16;
   typedef etl::crc16_kermit_t<4U>   crc16_kermit_t4;
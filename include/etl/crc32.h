@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc_implementation.h"
+#include "private/crc_hardware.h"
 
 ///\defgroup crc32 32 bit CRC calculation
 ///\ingroup crc
@@ -70,9 +71,21 @@ namespace etl
   };
 #endif
 
+  typedef etl::crc32_t<4096U> crc32_t4096;
+  typedef etl::crc32_t<2048U> crc32_t2048;
   typedef etl::crc32_t<256U> crc32_t256;
   typedef etl::crc32_t<16U>  crc32_t16;
   typedef etl::crc32_t<4U>   crc32_t4;
-  typedef crc32_t256         crc32;
+
+#if ETL_CRC32_HARDWARE_SUPPORTED
+  //*************************************************************************
+  /// Uses the target's CRC instructions.
+  /// Enabled by ETL_CRC_USE_HARDWARE. See private/crc_hardware.h
+  //*************************************************************************
+  typedef etl::frame_check_sequence<etl::private_crc::crc32_ieee_hardware_policy> crc32_hardware;
+  typedef crc32_hardware crc32;
+#else
+  typedef crc32_t256     crc32;
+#endif
 }
 #endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "private/crc_implementation.h"
+#include "private/crc_hardware.h"
 
 ///\defgroup crc32_c 32 bit CRC_C calculation
 ///\ingroup crc
@@ -70,9 +71,21 @@ namespace etl
   };
 #endif
 
+  typedef etl::crc32_c_t<4096U> crc32_c_t4096;
+  typedef etl::crc32_c_t<2048U> crc32_c_t2048;
   typedef etl::crc32_c_t<256U> crc32_c_t256;
   typedef etl::crc32_c_t<16U>  crc32_c_t16;
   typedef etl::crc32_c_t<4U>   crc32_c_t4;
-  typedef crc32_c_t256         crc32_c;
+
+#if ETL_CRC32_C_HARDWARE_SUPPORTED
+  //*************************************************************************
+  /// Uses the target's CRC instructions.
+  /// Enabled by ETL_CRC_USE_HARDWARE. See private/crc_hardware.h
+  //*************************************************************************
+  typedef etl::frame_check_sequence<etl::private_crc::crc32_c_hardware_policy> crc32_c_hardware;
+  typedef crc32_c_hardware crc32_c;
+#else
+  typedef crc32_c_t256     crc32_c;
+#endif
 }
 #endif
@@ -28,8 +28,8 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 ******************************************************************************/
 
-#ifndef ETL_CRC32_D_INCLUDED
-#define ETL_CRC32_D_INCLUDED
+#ifndef ETL_CRC32_Q_INCLUDED
+#define ETL_CRC32_Q_INCLUDED
 
 #include "platform.h"
 #include "private/crc_implementation.h"
@@ -70,6 +70,8 @@ namespace etl
   };
 #endif
 
+  typedef etl::crc32_q_t<4096U> crc32_q_t4096;
+  typedef etl::crc32_q_t<2048U> crc32_q_t2048;
   typedef etl::crc32_q_t<256U> crc32_q_t256;
   typedef etl::crc32_q_t<16U>  crc32_q_t16;
   typedef etl::crc32_q_t<4U>   crc32_q_t4;
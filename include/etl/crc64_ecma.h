@@ -70,6 +70,8 @@ namespace etl
   };
 #endif
 
+  typedef etl::crc64_ecma_t<4096U> crc64_ecma_t4096;
+  typedef etl::crc64_ecma_t<2048U> crc64_ecma_t2048;
   typedef etl::crc64_ecma_t<256U> crc64_ecma_t256;
   typedef etl::crc64_ecma_t<16U>  crc64_ecma_t16;
   typedef etl::crc64_ecma_t<4U>   crc64_ecma_t4;
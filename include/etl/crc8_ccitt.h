@@ -67,6 +67,8 @@ namespace etl
   };
 #endif
 
+  typedef crc8_ccitt_t<4096U> crc8_ccitt_t4096;
+  typedef crc8_ccitt_t<2048U> crc8_ccitt_t2048;
   typedef crc8_ccitt_t<256U> crc8_ccitt_t256;
   typedef crc8_ccitt_t<16U>  crc8_ccitt_t16;
   typedef crc8_ccitt_t<4U>   crc8_ccitt_t4;
@@ -70,6 +70,8 @@ namespace etl
   };
 #endif
     
+  typedef etl::crc8_icode_t<4096U> crc8_icode_t4096;
+  typedef etl::crc8_icode_t<2048U> crc8_icode_t2048;
   typedef etl::crc8_icode_t<256U> crc8_icode_t256;
   typedef etl::crc8_icode_t<16U>  crc8_icode_t16;
   typedef etl::crc8_icode_t<4U>   crc8_icode_t4;
@@ -0,0 +1,322 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_ACCELERATOR_INCLUDED
+#define ETL_CRC_ACCELERATOR_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "span.h"
+#include "type_traits.h"
+#include "private/crc_implementation.h"
+
+///\defgroup crc_accelerator CRC peripheral support
+/// Calculates CRCs with a CRC peripheral, such as those on STM32 and NXP
+/// parts, where the peripheral implements the CRC, and in software where it
+/// does not.
+///
+/// The accelerator is a user supplied type with the following members.
+///
+/// typedef ... parameters_type;
+///   The CRC that the peripheral calculates, as an etl CRC parameters type,
+///   such as etl::private_crc::crc32_parameters. Only the width, polynomial
+///   and bit order must match. The initial value and output XOR are applied
+///   in software.
+///
+/// static const size_t Minimum_Length;
+///   Ranges shorter than this are calculated in software, as the cost of
+///   setting up the peripheral would outweigh the gain.
+///
+/// static accumulator_type calculate(accumulator_type crc, const uint8_t* data, size_t length);
+///   Loads the CRC register with 'crc', adds the data, and returns the
+///   register. The register is in the form the software calculation uses,
+///   which is bit reversed for reflected CRCs, and has no output XOR.
+///
+/// For etl::crc_async, also the following.
+///
+/// static void begin(accumulator_type crc, const uint8_t* data, size_t length);
+///   Starts the same calculation in the background, such as with DMA.
+///
+/// static bool is_complete();
+///   True when the background calculation has finished.
+///
+/// static accumulator_type result();
+///   The CRC register after the background calculation.
+///\ingroup crc
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// True if the peripheral's CRC has the same width, polynomial and bit
+    /// order as the required CRC.
+    //*************************************************************************
+    template <typename TRequired, typename TPeripheral>
+    struct crc_parameters_match
+    {
+      static ETL_CONSTANT bool value = etl::is_same<typename TRequired::accumulator_type, typename TPeripheral::accumulator_type>::value &&
+                                       (TRequired::Polynomial == TPeripheral::Polynomial) &&
+                                       (TRequired::Reflect == TPeripheral::Reflect);
+    };
+
+    //*************************************************************************
+    /// A frame_check_sequence policy that adds contiguous ranges with the
+    /// accelerator, and everything else with the table driven software policy.
+    //*************************************************************************
+    template <typename TCrcParameters, typename TAccelerator, size_t Table_Size>
+    struct crc_accelerated_policy : public crc_policy<TCrcParameters, Table_Size>
+    {
+      typedef crc_policy<TCrcParameters, Table_Size>   software_policy;
+      typedef typename software_policy::accumulator_type accumulator_type;
+
+      // Tells frame_check_sequence that this policy has an optimised range add.
+      typedef void range_add_supported;
+
+      /// True if the accelerator calculates this CRC.
+      static ETL_CONSTANT bool Use_Accelerator = crc_parameters_match<TCrcParameters, typename TAccelerator::parameters_type>::value;
+
+      using software_policy::add;
+
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add(accumulator_type crc, TIterator begin, const TIterator end) const
+      {
+        return add_range(crc, begin, end, etl::integral_constant<bool, Use_Accelerator && etl::is_pointer<TIterator>::value>());
+      }
+
+      //*************************************************************************
+      /// Adds a range in software.
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add_software(accumulator_type crc, TIterator begin, const TIterator end) const
+      {
+        return add_software(crc, begin, end, etl::integral_constant<bool, private_frame_check_sequence::has_range_add<software_policy>::value>());
+      }
+
+    private:
+
+      //*************************************************************************
+      /// A contiguous range that the accelerator can take.
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add_range(accumulator_type crc, TIterator begin, const TIterator end, etl::true_type) const
+      {
+        const size_t length = size_t(end - begin);
+
+        if (length >= TAccelerator::Minimum_Length)
+        {
+          return TAccelerator::calculate(crc, reinterpret_cast<const uint8_t*>(begin), length);
+        }
+        else
+        {
+          return add_software(crc, begin, end);
+        }
+      }
+
+      //*************************************************************************
+      /// Anything else.
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add_range(accumulator_type crc, TIterator begin, const TIterator end, etl::false_type) const
+      {
+        return add_software(crc, begin, end);
+      }
+
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add_software(accumulator_type crc, TIterator begin, const TIterator end, etl::true_type) const
+      {
+        return software_policy::add(crc, begin, end);
+      }
+
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add_software(accumulator_type crc, TIterator begin, const TIterator end, etl::false_type) const
+      {
+        while (begin != end)
+        {
+          crc = software_policy::add(crc, uint8_t(*begin++));
+        }
+
+        return crc;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A CRC that uses a CRC peripheral for contiguous ranges, where the
+  /// peripheral implements the CRC, and the software tables otherwise.
+  /// Gives the same results as etl::crc_type.
+  ///\tparam TCrcParameters The CRC to calculate. e.g. etl::private_crc::crc32_parameters
+  ///\tparam TAccelerator   The peripheral. See above.
+  ///\tparam Table_Size     The table size for the software calculation.
+  ///\ingroup crc_accelerator
+  //***************************************************************************
+  template <typename TCrcParameters, typename TAccelerator, size_t Table_Size = 256U>
+  class crc_accelerated_type : public etl::frame_check_sequence<private_crc::crc_accelerated_policy<TCrcParameters, TAccelerator, Table_Size> >
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_accelerated_type()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc_accelerated_type(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates a CRC in the background with the accelerator, such as with
+  /// DMA, while the CPU does other work.
+  /// Where the accelerator does not implement the CRC, or a buffer is shorter
+  /// than its Minimum_Length, the buffer is added in software within begin().
+  /// Successive buffers continue the same CRC.
+  /// The buffer must not change until the calculation is complete.
+  ///\ingroup crc_accelerator
+  //***************************************************************************
+  template <typename TCrcParameters, typename TAccelerator, size_t Table_Size = 256U>
+  class crc_async
+  {
+  public:
+
+    typedef private_crc::crc_accelerated_policy<TCrcParameters, TAccelerator, Table_Size> policy_type;
+    typedef typename policy_type::accumulator_type                                       value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    crc_async()
+      : policy()
+      , crc(policy.initial())
+      , busy(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Waits for any calculation in progress, then restarts the CRC.
+    //*************************************************************************
+    void reset()
+    {
+      wait();
+      crc = policy.initial();
+    }
+
+    //*************************************************************************
+    /// Waits for any calculation in progress, then starts on the buffer.
+    /// Returns <b>true</b> if the accelerator was started, or <b>false</b> if
+    /// the buffer was added in software and is already complete.
+    //*************************************************************************
+    bool begin(const uint8_t* data, size_t length)
+    {
+      wait();
+
+      if (policy_type::Use_Accelerator && (length >= TAccelerator::Minimum_Length))
+      {
+        TAccelerator::begin(crc, data, length);
+        busy = true;
+      }
+      else
+      {
+        crc = policy.add_software(crc, data, data + length);
+      }
+
+      return busy;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Waits for any calculation in progress, then starts on the buffer.
+    /// Returns <b>true</b> if the accelerator was started, or <b>false</b> if
+    /// the buffer was added in software and is already complete.
+    //*************************************************************************
+    bool begin(etl::span<const uint8_t> data)
+    {
+      return begin(data.data(), data.size());
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is no calculation in progress.
+    //*************************************************************************
+    bool is_complete()
+    {
+      if (busy && TAccelerator::is_complete())
+      {
+        crc  = TAccelerator::result();
+        busy = false;
+      }
+
+      return !busy;
+    }
+
+    //*************************************************************************
+    /// Waits for any calculation in progress, then returns the CRC.
+    //*************************************************************************
+    value_type value()
+    {
+      wait();
+
+      return policy.final(crc);
+    }
+
+  private:
+
+    //*************************************************************************
+    void wait()
+    {
+      while (!is_complete())
+      {
+      }
+    }
+
+    policy_type policy;
+    value_type  crc;
+    bool        busy;
+  };
+}
+
+#endif
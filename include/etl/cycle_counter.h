@@ -0,0 +1,190 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CYCLE_COUNTER_INCLUDED
+#define ETL_CYCLE_COUNTER_INCLUDED
+
+#include "platform.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup cycle_counter cycle_counter
+/// A cheap timestamp source for instrumentation, and scoped timing probes.
+/// The backend is chosen from the target.
+/// Cortex-M3/M4/M7/M33/M55 : The DWT cycle counter. Call enable() at start up.
+/// x86 (GCC, Clang, MSVC)  : rdtsc.
+/// AArch64 (GCC, Clang)    : cntvct_el0. Counts the generic timer, not cycles.
+/// Define ETL_CYCLE_COUNTER_READ() in the profile to use another source, or
+/// to provide one for other targets. It must return an unsigned integer
+/// that counts up; only the low 32 bits are used.
+/// ETL_HAS_CYCLE_COUNTER is 1 if a source is available.
+///\ingroup utilities
+//*****************************************************************************
+
+#if defined(ETL_CYCLE_COUNTER_READ)
+  #define ETL_CYCLE_COUNTER_USER
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__) || \
+      defined(__TARGET_ARCH_7_M) || defined(__TARGET_ARCH_7E_M)
+  #define ETL_CYCLE_COUNTER_DWT
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+  #define ETL_CYCLE_COUNTER_RDTSC
+#elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+  #include <intrin.h>
+  #define ETL_CYCLE_COUNTER_RDTSC
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__aarch64__)
+  #define ETL_CYCLE_COUNTER_CNTVCT
+#endif
+
+#if defined(ETL_CYCLE_COUNTER_USER) || defined(ETL_CYCLE_COUNTER_DWT) || defined(ETL_CYCLE_COUNTER_RDTSC) || defined(ETL_CYCLE_COUNTER_CNTVCT)
+  #define ETL_HAS_CYCLE_COUNTER 1
+#else
+  #define ETL_HAS_CYCLE_COUNTER 0
+#endif
+
+namespace etl
+{
+#if ETL_HAS_CYCLE_COUNTER
+  //***************************************************************************
+  ///\ingroup cycle_counter
+  /// Reads the target's cycle counter.
+  /// Counts are 32 bit and wrap, so intervals must be shorter than 2^32 counts
+  /// (about 1.4 seconds at 3GHz). now() has the signature of the scheduler's
+  /// statistics clock.
+  //***************************************************************************
+  class cycle_counter
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    /// Starts the counter, if the target needs it.
+    /// On Cortex-M this turns on the trace unit and the DWT cycle counter.
+    //*************************************************************************
+    static void enable()
+    {
+#if defined(ETL_CYCLE_COUNTER_DWT)
+      volatile uint32_t& demcr    = *reinterpret_cast<volatile uint32_t*>(0xE000EDFCUL);
+      volatile uint32_t& dwt_ctrl = *reinterpret_cast<volatile uint32_t*>(0xE0001000UL);
+
+      demcr    |= 0x01000000UL; // TRCENA
+      dwt_ctrl |= 0x00000001UL; // CYCCNTENA
+#endif
+    }
+
+    //*************************************************************************
+    /// The current count.
+    //*************************************************************************
+    static value_type now()
+    {
+#if defined(ETL_CYCLE_COUNTER_USER)
+      return value_type(ETL_CYCLE_COUNTER_READ());
+#elif defined(ETL_CYCLE_COUNTER_DWT)
+      return *reinterpret_cast<volatile const uint32_t*>(0xE0001004UL);
+#elif defined(ETL_CYCLE_COUNTER_RDTSC) && defined(ETL_COMPILER_MICROSOFT)
+      return value_type(__rdtsc());
+#elif defined(ETL_CYCLE_COUNTER_RDTSC)
+      return value_type(__builtin_ia32_rdtsc());
+#elif defined(ETL_CYCLE_COUNTER_CNTVCT)
+      uint64_t count;
+      __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(count));
+      return value_type(count);
+#endif
+    }
+
+    //*************************************************************************
+    /// The counts since 'start'.
+    //*************************************************************************
+    static value_type elapsed(value_type start)
+    {
+      return value_type(now() - start);
+    }
+  };
+#endif
+
+  //***************************************************************************
+  ///\ingroup cycle_counter
+  /// Times its own lifetime and passes the elapsed count to a sink when it
+  /// is destroyed.
+  /// The sink may be anything that may be called with the count, such as an
+  /// etl::log_histogram, an etl::tdigest or a function.
+  ///\tparam TSink  The type of the sink.
+  ///\tparam TClock A type with a value_type and a static now(). Defaults to
+  ///               etl::cycle_counter when there is one.
+  //***************************************************************************
+#if ETL_HAS_CYCLE_COUNTER
+  template <typename TSink, typename TClock = etl::cycle_counter>
+#else
+  template <typename TSink, typename TClock>
+#endif
+  class scoped_timer
+  {
+  public:
+
+    typedef typename TClock::value_type value_type;
+
+    //*************************************************************************
+    /// Starts timing.
+    //*************************************************************************
+    explicit scoped_timer(TSink& sink_)
+      : sink(sink_)
+      , start(TClock::now())
+    {
+    }
+
+    //*************************************************************************
+    /// Stops timing and passes the elapsed count to the sink.
+    //*************************************************************************
+    ~scoped_timer()
+    {
+      sink(elapsed());
+    }
+
+    //*************************************************************************
+    /// The counts since construction.
+    //*************************************************************************
+    value_type elapsed() const
+    {
+      return value_type(TClock::now() - start);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    scoped_timer(const scoped_timer&);
+    scoped_timer& operator =(const scoped_timer&);
+
+    TSink&           sink;
+    const value_type start;
+  };
+}
+
+#endif
@@ -157,6 +157,195 @@ namespace etl
     /// Lookup table of delegates.
     etl::array<etl::delegate<void(size_t)>, RANGE> lookup;
   };
+
+  //***************************************************************************
+  /// A delegate service for a sparse set of ids.
+  /// Only one delegate is stored for each id, so the ids may be spread over a
+  /// wide range without the cost of a delegate for every value in the range.
+  /// The ids are held in a sorted table that is fixed at compile time.
+  /// call<ID>() resolves the index at compile time.
+  /// call(id) finds the index with a binary search of the id table.
+  /// \tparam IDs The delegate ids, in strictly ascending order.
+  //***************************************************************************
+  template <const size_t... IDs>
+  class sparse_delegate_service
+  {
+  public:
+
+    /// The number of delegates.
+    static ETL_CONSTANT size_t Number_Of_Ids = sizeof...(IDs);
+
+    ETL_STATIC_ASSERT(Number_Of_Ids > 0U, "No delegate ids");
+
+    //*************************************************************************
+    /// Reset the delegate service.
+    /// Sets all delegates to the internal default.
+    //*************************************************************************
+    sparse_delegate_service()
+    {
+      ETL_STATIC_ASSERT(is_ascending(1U), "Delegate ids must be in strictly ascending order");
+
+      etl::delegate<void(size_t)> default_delegate = etl::delegate<void(size_t)>::create<sparse_delegate_service<IDs...>, &sparse_delegate_service<IDs...>::unhandled>(*this);
+
+      lookup.fill(default_delegate);
+    }
+
+    //*************************************************************************
+    /// Registers a delegate for the specified id.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam ID The id of the delegate.
+    /// \param delegate Reference to the delegate.
+    //*************************************************************************
+    template <const size_t ID>
+    void register_delegate(etl::delegate<void(size_t)> callback)
+    {
+      ETL_STATIC_ASSERT(index_of(ID, 0U) != Number_Of_Ids, "Callback Id not in the list");
+
+      lookup[index_of(ID, 0U)] = callback;
+    }
+
+    //*************************************************************************
+    /// Registers a delegate for the specified id.
+    /// No action if the id is not in the list.
+    /// \param id       Id of the delegate.
+    /// \param delegate Reference to the delegate.
+    //*************************************************************************
+    void register_delegate(const size_t id, etl::delegate<void(size_t)> callback)
+    {
+      const size_t index = find_index(id);
+
+      if (index != Number_Of_Ids)
+      {
+        lookup[index] = callback;
+      }
+    }
+
+    //*************************************************************************
+    /// Registers an alternative delegate for unhandled ids.
+    /// \param delegate A reference to the user supplied 'unhandled' delegate.
+    //*************************************************************************
+    void register_unhandled_delegate(etl::delegate<void(size_t)> callback)
+    {
+      unhandled_delegate = callback;
+    }
+
+    //*************************************************************************
+    /// Executes the delegate function for the id.
+    /// Compile time assert if the id is not in the list.
+    /// \tparam ID The id of the delegate.
+    //*************************************************************************
+    template <const size_t ID>
+    void call()
+    {
+      ETL_STATIC_ASSERT(index_of(ID, 0U) != Number_Of_Ids, "Callback Id not in the list");
+
+      lookup[index_of(ID, 0U)](ID);
+    }
+
+    //*************************************************************************
+    /// Executes the delegate function for the id.
+    /// \param id Id of the delegate.
+    //*************************************************************************
+    void call(const size_t id)
+    {
+      const size_t index = find_index(id);
+
+      if (index != Number_Of_Ids)
+      {
+        lookup[index](id);
+      }
+      else
+      {
+        if (unhandled_delegate.is_valid())
+        {
+          unhandled_delegate(id);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the id is in the list.
+    /// \param id Id of the delegate.
+    //*************************************************************************
+    static bool contains(const size_t id)
+    {
+      return find_index(id) != Number_Of_Ids;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the index of the id at compile time.
+    /// Returns Number_Of_Ids if the id is not in the list.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t index_of(const size_t id, const size_t index)
+    {
+      return (index == Number_Of_Ids) ? Number_Of_Ids
+                                      : ((ids[index] == id) ? index : index_of(id, index + 1U));
+    }
+
+    //*************************************************************************
+    /// Checks at compile time that the ids are in strictly ascending order.
+    //*************************************************************************
+    static ETL_CONSTEXPR bool is_ascending(const size_t index)
+    {
+      return (index >= Number_Of_Ids) ? true
+                                      : ((ids[index - 1U] < ids[index]) && is_ascending(index + 1U));
+    }
+
+    //*************************************************************************
+    /// Finds the index of the id at run time.
+    /// Returns Number_Of_Ids if the id is not in the list.
+    //*************************************************************************
+    static size_t find_index(const size_t id)
+    {
+      size_t first = 0U;
+      size_t last  = Number_Of_Ids;
+
+      while (first < last)
+      {
+        const size_t middle = first + ((last - first) / 2U);
+
+        if (ids[middle] < id)
+        {
+          first = middle + 1U;
+        }
+        else
+        {
+          last = middle;
+        }
+      }
+
+      return ((first != Number_Of_Ids) && (ids[first] == id)) ? first : Number_Of_Ids;
+    }
+
+    //*************************************************************************
+    /// The default callback function.
+    /// Calls the user defined 'unhandled' callback if it exists.
+    //*************************************************************************
+    void unhandled(size_t id)
+    {
+      if (unhandled_delegate.is_valid())
+      {
+        unhandled_delegate(id);
+      }
+    }
+
+    /// The sorted table of ids.
+    static constexpr size_t ids[Number_Of_Ids] = { IDs... };
+
+    /// The default delegate for unhandled ids.
+    etl::delegate<void(size_t)> unhandled_delegate;
+
+    /// Lookup table of delegates, in the same order as the ids.
+    etl::array<etl::delegate<void(size_t)>, Number_Of_Ids> lookup;
+  };
+
+  template <const size_t... IDs>
+  ETL_CONSTANT size_t sparse_delegate_service<IDs...>::Number_Of_Ids;
+
+  template <const size_t... IDs>
+  constexpr size_t sparse_delegate_service<IDs...>::ids[sparse_delegate_service<IDs...>::Number_Of_Ids];
 }
 
 #endif
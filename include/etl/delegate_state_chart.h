@@ -0,0 +1,503 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DELEGATE_STATE_CHART_INCLUDED
+#define ETL_DELEGATE_STATE_CHART_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "array_view.h"
+#include "utility.h"
+#include "delegate.h"
+#include "state_chart.h"
+
+#if ETL_CPP11_NOT_SUPPORTED
+  #if !defined(ETL_IN_UNIT_TEST)
+    #error NOT SUPPORTED FOR C++03 OR BELOW
+  #endif
+#else
+namespace etl
+{
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// The common part of the delegate state charts.
+    /// \tparam TAction The delegate type for transition actions.
+    //*************************************************************************
+    template <typename TAction>
+    class delegate_state_chart_base : public istate_chart
+    {
+    public:
+
+      typedef TAction                action_t;
+      typedef etl::delegate<bool()>  guard_t;
+      typedef etl::delegate<void()>  state_action_t;
+
+      //***********************************************************************
+      /// Transition definition
+      //***********************************************************************
+      struct transition
+      {
+        constexpr transition(const state_id_t current_state_id_,
+                             const event_id_t event_id_,
+                             const state_id_t next_state_id_,
+                             const action_t   action_ = action_t(),
+                             const guard_t    guard_  = guard_t())
+          : from_any_state(false),
+            current_state_id(current_state_id_),
+            event_id(event_id_),
+            next_state_id(next_state_id_),
+            action(action_),
+            guard(guard_)
+        {
+        }
+
+        constexpr transition(const event_id_t event_id_,
+                             const state_id_t next_state_id_,
+                             const action_t   action_ = action_t(),
+                             const guard_t    guard_  = guard_t())
+          : from_any_state(true),
+            current_state_id(0),
+            event_id(event_id_),
+            next_state_id(next_state_id_),
+            action(action_),
+            guard(guard_)
+        {
+        }
+
+        const bool       from_any_state;
+        const state_id_t current_state_id;
+        const event_id_t event_id;
+        const state_id_t next_state_id;
+        const action_t   action;
+        const guard_t    guard;
+      };
+
+      //***********************************************************************
+      /// State definition
+      //***********************************************************************
+      struct state
+      {
+        constexpr state(const state_id_t     state_id_,
+                        const state_action_t on_entry_ = state_action_t(),
+                        const state_action_t on_exit_  = state_action_t())
+          : state_id(state_id_),
+            on_entry(on_entry_),
+            on_exit(on_exit_)
+        {
+        }
+
+        const state_id_t     state_id;
+        const state_action_t on_entry;
+        const state_action_t on_exit;
+      };
+
+      //***********************************************************************
+      /// Sets the transition table.
+      /// \param transition_table_begin_ The start of the transition table.
+      /// \param transition_table_end_   The end of the transition table.
+      //***********************************************************************
+      void set_transition_table(const transition* transition_table_begin_,
+                                const transition* transition_table_end_)
+      {
+        transition_table.assign(transition_table_begin_, transition_table_end_);
+        rebuild_index();
+      }
+
+      //***********************************************************************
+      /// Sets the state table.
+      /// \param state_table_begin_ The start of the state table.
+      /// \param state_table_end_   The end of the state table.
+      //***********************************************************************
+      void set_state_table(const state* state_table_begin_,
+                           const state* state_table_end_)
+      {
+        state_table.assign(state_table_begin_, state_table_end_);
+        rebuild_index();
+      }
+
+      //***********************************************************************
+      /// Sets an index for the tables, so that events and states are found
+      /// without a search. The index is rebuilt if the tables are changed.
+      /// Call before start(), and not from within an action.
+      /// \param index The index. Must be large enough for the state ids, event ids and transitions.
+      /// \return <b>true</b> if the tables fit the index. If not, the tables are searched.
+      //***********************************************************************
+      bool set_index(etl::istate_chart_index& index)
+      {
+        p_index = &index;
+        rebuild_index();
+
+        return p_index != ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Removes the index. The tables are searched for each event.
+      //***********************************************************************
+      void clear_index()
+      {
+        p_index = ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Is an index in use?
+      //***********************************************************************
+      bool has_index() const
+      {
+        return p_index != ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Finds the state table entry for the state id.
+      /// \return A pointer to the entry, or the end of the state table.
+      //***********************************************************************
+      const state* find_state(state_id_t state_id) const
+      {
+        if (p_index != ETL_NULLPTR)
+        {
+          const istate_chart_index::index_t index = p_index->state(state_id);
+
+          return (index == istate_chart_index::No_Index) ? state_table.end() : state_table.begin() + index;
+        }
+
+        const state* s = state_table.begin();
+
+        while ((s != state_table.end()) && (s->state_id != state_id))
+        {
+          ++s;
+        }
+
+        return s;
+      }
+
+      //***********************************************************************
+      /// Starts the state chart.
+      /// \param on_entry_initial Call the initial state's 'on_entry'.
+      //***********************************************************************
+      virtual void start(const bool on_entry_initial = true) ETL_OVERRIDE
+      {
+        if (!started)
+        {
+          if (on_entry_initial)
+          {
+            const state* s = find_state(current_state_id);
+
+            if ((s != state_table.end()) && s->on_entry.is_valid())
+            {
+              s->on_entry();
+            }
+          }
+
+          started = true;
+        }
+      }
+
+    protected:
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      delegate_state_chart_base(const transition* transition_table_begin_,
+                                const transition* transition_table_end_,
+                                const state_id_t  state_id_)
+        : istate_chart(state_id_),
+          transition_table(transition_table_begin_, transition_table_end_),
+          state_table(),
+          started(false),
+          p_index(ETL_NULLPTR)
+      {
+      }
+
+      //***********************************************************************
+      /// Constructor.
+      //***********************************************************************
+      delegate_state_chart_base(const transition* transition_table_begin_,
+                                const transition* transition_table_end_,
+                                const state*      state_table_begin_,
+                                const state*      state_table_end_,
+                                const state_id_t  state_id_)
+        : istate_chart(state_id_),
+          transition_table(transition_table_begin_, transition_table_end_),
+          state_table(state_table_begin_, state_table_end_),
+          started(false),
+          p_index(ETL_NULLPTR)
+      {
+      }
+
+      //***********************************************************************
+      /// Finds the first transition for the event from the current state
+      /// whose guard, if any, returns true.
+      /// \return A pointer to the transition, or ETL_NULLPTR.
+      //***********************************************************************
+      const transition* find_transition(const event_id_t event_id) const
+      {
+        if (!started)
+        {
+          return ETL_NULLPTR;
+        }
+
+        if (p_index != ETL_NULLPTR)
+        {
+          istate_chart_index::index_t index = p_index->first(current_state_id, event_id);
+
+          while (index != istate_chart_index::No_Index)
+          {
+            const transition* t = transition_table.begin() + index;
+
+            if ((t->from_any_state || (t->current_state_id == current_state_id)) &&
+                (!t->guard.is_valid() || t->guard()))
+            {
+              return t;
+            }
+
+            index = p_index->next(index);
+          }
+        }
+        else
+        {
+          for (const transition* t = transition_table.begin(); t != transition_table.end(); ++t)
+          {
+            if ((t->event_id == event_id) &&
+                (t->from_any_state || (t->current_state_id == current_state_id)) &&
+                (!t->guard.is_valid() || t->guard()))
+            {
+              return t;
+            }
+          }
+        }
+
+        return ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Moves to the transition's next state, calling 'on_exit' and
+      /// 'on_entry' if the state changes.
+      //***********************************************************************
+      void change_state(const transition& t)
+      {
+        if (current_state_id != t.next_state_id)
+        {
+          const state* s = find_state(current_state_id);
+
+          if ((s != state_table.end()) && s->on_exit.is_valid())
+          {
+            s->on_exit();
+          }
+
+          current_state_id = t.next_state_id;
+
+          s = find_state(current_state_id);
+
+          if ((s != state_table.end()) && s->on_entry.is_valid())
+          {
+            s->on_entry();
+          }
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Rebuilds the index, if there is one.
+      /// The index is dropped if the tables do not fit.
+      //***********************************************************************
+      void rebuild_index()
+      {
+        if (p_index != ETL_NULLPTR)
+        {
+          if (!private_state_chart::build_index(*p_index, transition_table, state_table, current_state_id))
+          {
+            p_index = ETL_NULLPTR;
+          }
+        }
+      }
+
+      // Disabled
+      delegate_state_chart_base(const delegate_state_chart_base&) ETL_DELETE;
+      delegate_state_chart_base& operator =(const delegate_state_chart_base&) ETL_DELETE;
+
+      etl::array_view<const transition> transition_table; ///< The table of transitions.
+      etl::array_view<const state>      state_table;      ///< The table of states.
+      bool                              started;          ///< Set if the state chart has been started.
+      etl::istate_chart_index*          p_index;          ///< The optional index for the tables.
+    };
+  }
+
+  //***************************************************************************
+  /// A state chart whose guards and actions are delegates rather than
+  /// member functions of a single object.
+  /// The tables may be declared constexpr.
+  /// Data parameter for events.
+  //***************************************************************************
+  template <typename TParameter = void>
+  class delegate_state_chart : public private_state_chart::delegate_state_chart_base<etl::delegate<void(TParameter)> >
+  {
+    typedef private_state_chart::delegate_state_chart_base<etl::delegate<void(TParameter)> > base_t;
+
+  public:
+
+    typedef TParameter                    parameter_t;
+    typedef typename base_t::transition   transition;
+    typedef typename base_t::state        state;
+    typedef istate_chart::event_id_t      event_id_t;
+    typedef istate_chart::state_id_t      state_id_t;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    delegate_state_chart(const transition* transition_table_begin_,
+                         const transition* transition_table_end_,
+                         const state_id_t  state_id_)
+      : base_t(transition_table_begin_, transition_table_end_, state_id_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    delegate_state_chart(const transition* transition_table_begin_,
+                         const transition* transition_table_end_,
+                         const state*      state_table_begin_,
+                         const state*      state_table_end_,
+                         const state_id_t  state_id_)
+      : base_t(transition_table_begin_, transition_table_end_, state_table_begin_, state_table_end_, state_id_)
+    {
+    }
+
+    //*************************************************************************
+    /// Processes the specified event with a default constructed parameter.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    virtual void process_event(const event_id_t event_id) ETL_OVERRIDE
+    {
+      process_event(event_id, typename etl::types<parameter_t>::type());
+    }
+
+    //*************************************************************************
+    /// Processes the specified event.
+    /// The <b>first</b> matching transition whose guard allows it is taken.
+    /// \param event_id The id of the event to process.
+    /// \param data     The data to pass to the action.
+    //*************************************************************************
+    void process_event(const event_id_t event_id, parameter_t data)
+    {
+      const transition* t = this->find_transition(event_id);
+
+      if (t != ETL_NULLPTR)
+      {
+        if (t->action.is_valid())
+        {
+          t->action(etl::forward<parameter_t>(data));
+        }
+
+        this->change_state(*t);
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// A state chart whose guards and actions are delegates rather than
+  /// member functions of a single object.
+  /// The tables may be declared constexpr.
+  //***************************************************************************
+  template <>
+  class delegate_state_chart<void> : public private_state_chart::delegate_state_chart_base<etl::delegate<void()> >
+  {
+    typedef private_state_chart::delegate_state_chart_base<etl::delegate<void()> > base_t;
+
+  public:
+
+    typedef base_t::transition       transition;
+    typedef base_t::state            state;
+    typedef istate_chart::event_id_t event_id_t;
+    typedef istate_chart::state_id_t state_id_t;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    delegate_state_chart(const transition* transition_table_begin_,
+                         const transition* transition_table_end_,
+                         const state_id_t  state_id_)
+      : base_t(transition_table_begin_, transition_table_end_, state_id_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    delegate_state_chart(const transition* transition_table_begin_,
+                         const transition* transition_table_end_,
+                         const state*      state_table_begin_,
+                         const state*      state_table_end_,
+                         const state_id_t  state_id_)
+      : base_t(transition_table_begin_, transition_table_end_, state_table_begin_, state_table_end_, state_id_)
+    {
+    }
+
+    //*************************************************************************
+    /// Processes the specified event.
+    /// The <b>first</b> matching transition whose guard allows it is taken.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    virtual void process_event(const event_id_t event_id) ETL_OVERRIDE
+    {
+      const transition* t = this->find_transition(event_id);
+
+      if (t != ETL_NULLPTR)
+      {
+        if (t->action.is_valid())
+        {
+          t->action();
+        }
+
+        this->change_state(*t);
+      }
+    }
+  };
+}
+#endif
+
+#endif
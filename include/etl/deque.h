@@ -947,6 +947,67 @@ namespace etl
       return const_reverse_iterator(cbegin());
     }
 
+    //*************************************************************************
+    /// Calls a function with each contiguous segment of the deque, front to back.
+    /// The elements are stored in a ring, so there are at most two segments.
+    /// Each segment is a pointer range, so algorithms run over it without the
+    /// wrap check that every deque iterator step makes.
+    ///\param function The function to call, as function(T* first, T* last).
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction segmented_for_each(TFunction function)
+    {
+      if (_begin.index <= _end.index)
+      {
+        if (_begin.index != _end.index)
+        {
+          function(p_buffer + _begin.index, p_buffer + _end.index);
+        }
+      }
+      else
+      {
+        function(p_buffer + _begin.index, p_buffer + BUFFER_SIZE);
+
+        if (_end.index != 0)
+        {
+          function(p_buffer, p_buffer + _end.index);
+        }
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls a function with each contiguous segment of the deque, front to back.
+    ///\param function The function to call, as function(const T* first, const T* last).
+    ///\returns The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction segmented_for_each(TFunction function) const
+    {
+      const_pointer p_data = p_buffer;
+
+      if (_begin.index <= _end.index)
+      {
+        if (_begin.index != _end.index)
+        {
+          function(p_data + _begin.index, p_data + _end.index);
+        }
+      }
+      else
+      {
+        function(p_data + _begin.index, p_data + BUFFER_SIZE);
+
+        if (_end.index != 0)
+        {
+          function(p_data, p_data + _end.index);
+        }
+      }
+
+      return function;
+    }
+
     //*************************************************************************
     /// Clears the deque.
     //*************************************************************************
@@ -1737,6 +1798,29 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Adds an item to the back of the deque without checking for space,
+    /// whatever ETL_CHECK_PUSH_POP is set to.
+    /// Undefined behaviour if the deque is full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back_unchecked(const_reference item)
+    {
+      create_element_back(item);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds an item to the back of the deque without checking for space.
+    /// Undefined behaviour if the deque is full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back_unchecked(rvalue_reference item)
+    {
+      create_element_back(etl::move(item));
+    }
+#endif
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
     //*************************************************************************
     /// Emplaces an item to the back of the deque.
@@ -1837,6 +1921,16 @@ namespace etl
       destroy_element_back();
     }
 
+    //*************************************************************************
+    /// Removes the back item from the deque without checking that there is one,
+    /// whatever ETL_CHECK_PUSH_POP is set to.
+    /// Undefined behaviour if the deque is empty.
+    //*************************************************************************
+    void pop_back_unchecked()
+    {
+      destroy_element_back();
+    }
+
     //*************************************************************************
     /// Adds an item to the front of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1865,6 +1959,29 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Adds an item to the front of the deque without checking for space,
+    /// whatever ETL_CHECK_PUSH_POP is set to.
+    /// Undefined behaviour if the deque is full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_front_unchecked(const_reference item)
+    {
+      create_element_front(item);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds an item to the front of the deque without checking for space.
+    /// Undefined behaviour if the deque is full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_front_unchecked(rvalue_reference item)
+    {
+      create_element_front(etl::move(item));
+    }
+#endif
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
     //*************************************************************************
     /// Emplaces an item to the front of the deque.
@@ -1965,6 +2082,16 @@ namespace etl
       destroy_element_front();
     }
 
+    //*************************************************************************
+    /// Removes the front item from the deque without checking that there is one,
+    /// whatever ETL_CHECK_PUSH_POP is set to.
+    /// Undefined behaviour if the deque is empty.
+    //*************************************************************************
+    void pop_front_unchecked()
+    {
+      destroy_element_front();
+    }
+
     //*************************************************************************
     /// Resizes the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full is 'new_size' is too large.
@@ -32,10 +32,14 @@ SOFTWARE.
 #define ETL_ENDIAN_INCLUDED
 
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "enum_type.h"
 #include "binary.h"
+#include "type_traits.h"
+#include "span.h"
+#include "private/byte_swap_kernels.h"
 
 ///\defgroup endian endian
 /// Constants & utilities for endianess
@@ -196,6 +200,212 @@ namespace etl
     }
   }
 #endif
+
+  namespace private_endianness
+  {
+    //*************************************************************************
+    /// Single bytes are copied.
+    //*************************************************************************
+    template <typename T>
+    void reverse_bytes_array(const T* source, T* destination, size_t count, etl::integral_constant<size_t, 1U>)
+    {
+      if ((source != destination) && (count != 0U))
+      {
+        memcpy(destination, source, count);
+      }
+    }
+
+    //*************************************************************************
+    /// Larger elements use the kernel for their size.
+    //*************************************************************************
+    template <typename T, size_t Size>
+    void reverse_bytes_array(const T* source, T* destination, size_t count, etl::integral_constant<size_t, Size>)
+    {
+      etl::private_byte_swap::reverse_bytes<Size>(reinterpret_cast<const uint8_t*>(source), reinterpret_cast<uint8_t*>(destination), count);
+    }
+
+    //*************************************************************************
+    /// Copies without reversing.
+    //*************************************************************************
+    template <typename T>
+    void copy_array(const T* source, T* destination, size_t count)
+    {
+      if ((source != destination) && (count != 0U))
+      {
+        memcpy(destination, source, count * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    /// True if the host is little endian, so differs from network order.
+    //*************************************************************************
+    inline bool is_host_little()
+    {
+      return etl::endianness::value() == etl::endian::little;
+    }
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each of 'count' elements, in place.
+  /// Uses SSSE3, SSE2 or NEON where available.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    reverse_bytes(T* data, size_t count)
+  {
+    private_endianness::reverse_bytes_array(data, data, count, etl::integral_constant<size_t, sizeof(T)>());
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each of 'count' elements, copying them to
+  /// 'destination'. The arrays may be the same, but must not otherwise overlap.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    reverse_bytes(const T* source, size_t count, T* destination)
+  {
+    private_endianness::reverse_bytes_array(source, destination, count, etl::integral_constant<size_t, sizeof(T)>());
+  }
+
+  //***************************************************************************
+  /// Converts 'count' elements from host to network order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    hton_range(T* data, size_t count)
+  {
+    if (private_endianness::is_host_little())
+    {
+      etl::reverse_bytes(data, count);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts 'count' elements from host to network order, copying them to
+  /// 'destination'.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    hton_range(const T* source, size_t count, T* destination)
+  {
+    if (private_endianness::is_host_little())
+    {
+      etl::reverse_bytes(source, count, destination);
+    }
+    else
+    {
+      private_endianness::copy_array(source, destination, count);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts 'count' elements from network to host order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    ntoh_range(T* data, size_t count)
+  {
+    etl::hton_range(data, count);
+  }
+
+  //***************************************************************************
+  /// Converts 'count' elements from network to host order, copying them to
+  /// 'destination'.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, void>::type
+    ntoh_range(const T* source, size_t count, T* destination)
+  {
+    etl::hton_range(source, count, destination);
+  }
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Reverses the bytes of each element of a span, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent>
+  typename etl::enable_if<etl::is_arithmetic<T>::value && !etl::is_const<T>::value, void>::type
+    reverse_bytes(etl::span<T, VExtent> data)
+  {
+    etl::reverse_bytes(data.data(), data.size());
+  }
+
+  //***************************************************************************
+  /// Reverses the bytes of each element of 'source', copying them to
+  /// 'destination'. Converts as many elements as fit and returns the number
+  /// converted.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent1, size_t VExtent2>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, size_t>::type
+    reverse_bytes(etl::span<T, VExtent1> source, etl::span<typename etl::remove_const<T>::type, VExtent2> destination)
+  {
+    const size_t count = (source.size() < destination.size()) ? source.size() : destination.size();
+
+    etl::reverse_bytes(source.data(), count, destination.data());
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Converts a span from host to network order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent>
+  typename etl::enable_if<etl::is_arithmetic<T>::value && !etl::is_const<T>::value, void>::type
+    hton_range(etl::span<T, VExtent> data)
+  {
+    etl::hton_range(data.data(), data.size());
+  }
+
+  //***************************************************************************
+  /// Converts 'source' from host to network order, copying it to
+  /// 'destination'. Converts as many elements as fit and returns the number
+  /// converted.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent1, size_t VExtent2>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, size_t>::type
+    hton_range(etl::span<T, VExtent1> source, etl::span<typename etl::remove_const<T>::type, VExtent2> destination)
+  {
+    const size_t count = (source.size() < destination.size()) ? source.size() : destination.size();
+
+    etl::hton_range(source.data(), count, destination.data());
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Converts a span from network to host order, in place.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent>
+  typename etl::enable_if<etl::is_arithmetic<T>::value && !etl::is_const<T>::value, void>::type
+    ntoh_range(etl::span<T, VExtent> data)
+  {
+    etl::hton_range(data);
+  }
+
+  //***************************************************************************
+  /// Converts 'source' from network to host order, copying it to
+  /// 'destination'. Converts as many elements as fit and returns the number
+  /// converted.
+  ///\ingroup endian
+  //***************************************************************************
+  template <typename T, size_t VExtent1, size_t VExtent2>
+  typename etl::enable_if<etl::is_arithmetic<T>::value, size_t>::type
+    ntoh_range(etl::span<T, VExtent1> source, etl::span<typename etl::remove_const<T>::type, VExtent2> destination)
+  {
+    return etl::hton_range(source, destination);
+  }
+#endif
 }
 
 #endif
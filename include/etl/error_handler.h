@@ -257,6 +257,36 @@ namespace etl
 }
 #endif
 
+#if defined(ETL_COLD_ASSERTS) && !defined(ETL_NO_CHECKS) && (defined(ETL_THROW_EXCEPTIONS) || defined(ETL_LOG_ERRORS))
+namespace etl
+{
+  namespace private_error_handler
+  {
+    //*************************************************************************
+    /// The failure path of the asserts when ETL_COLD_ASSERTS is defined.
+    /// One is instantiated for each exception type. The call to the error
+    /// handler and the throw are kept out of the function that made the check.
+    //*************************************************************************
+  #if defined(ETL_THROW_EXCEPTIONS)
+    template <typename TException>
+    ETL_NORETURN ETL_COLD void fail(const TException& e)
+    {
+    #if defined(ETL_LOG_ERRORS)
+      etl::error_handler::error(e);
+    #endif
+      throw e;
+    }
+  #else
+    template <typename TException>
+    ETL_COLD void fail(const TException& e)
+    {
+      etl::error_handler::error(e);
+    }
+  #endif
+  }
+}
+#endif
+
 //***************************************************************************
 /// Asserts a condition.
 /// Versions of the macro that return a constant value of 'true' will allow the compiler to optimise away
@@ -265,6 +295,8 @@ namespace etl
 /// If asserts or exceptions are enabled then the error is thrown if the assert fails. The return value is always 'true'.
 /// If ETL_LOG_ERRORS is defined then the error is logged if the assert fails. The return value is the value of the boolean test.
 /// Otherwise 'assert' is called. The return value is always 'true'.
+/// If ETL_COLD_ASSERTS is defined then thrown or logged errors are passed to an
+/// out of line function, so that only the test remains in the calling code.
 ///\ingroup error_handler
 //***************************************************************************
 #if defined(ETL_NO_CHECKS)
@@ -275,7 +307,14 @@ namespace etl
   #define ETL_ALWAYS_ASSERT_AND_RETURN(e)                                                  // Does nothing.
   #define ETL_ALWAYS_ASSERT_AND_RETURN_VALUE(e, v)                                         // Does nothing.
 #elif defined(ETL_THROW_EXCEPTIONS)
-  #if defined(ETL_LOG_ERRORS)
+  #if defined(ETL_COLD_ASSERTS)
+    #define ETL_ASSERT(b, e) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e));}}                     // If the condition fails, throws an exception from out of line.
+    #define ETL_ASSERT_AND_RETURN(b, e) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e));}}          // If the condition fails, throws an exception from out of line.
+    #define ETL_ASSERT_AND_RETURN_VALUE(b, e, v) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e));}} // If the condition fails, throws an exception from out of line.
+    #define ETL_ALWAYS_ASSERT(e) {etl::private_error_handler::fail((e));}                                          // Throws an exception from out of line.
+    #define ETL_ALWAYS_ASSERT_AND_RETURN(e) {etl::private_error_handler::fail((e));}                               // Throws an exception from out of line.
+    #define ETL_ALWAYS_ASSERT_AND_RETURN_VALUE(e, v) {etl::private_error_handler::fail((e));}                      // Throws an exception from out of line.
+  #elif defined(ETL_LOG_ERRORS)
     #define ETL_ASSERT(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e));}}                     // If the condition fails, calls the error handler then throws an exception.
     #define ETL_ASSERT_AND_RETURN(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e));}}          // If the condition fails, calls the error handler then throws an exception.
     #define ETL_ASSERT_AND_RETURN_VALUE(b, e, v) {if (!(b)) {etl::error_handler::error((e)); throw((e));}} // If the condition fails, calls the error handler then throws an exception.
@@ -291,7 +330,14 @@ namespace etl
     #define ETL_ALWAYS_ASSERT_AND_RETURN_VALUE(e, v) {throw((e));}                         // Throws an exception.
   #endif
 #else
-  #if defined(ETL_LOG_ERRORS)
+  #if defined(ETL_LOG_ERRORS) && defined(ETL_COLD_ASSERTS)
+    #define ETL_ASSERT(b, e) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e));}}                                 // If the condition fails, calls the error handler out of line
+    #define ETL_ASSERT_AND_RETURN(b, e) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e)); return;}}              // If the condition fails, calls the error handler out of line and return
+    #define ETL_ASSERT_AND_RETURN_VALUE(b, e, v) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::fail((e)); return (v);}} // If the condition fails, calls the error handler out of line and return a value
+    #define ETL_ALWAYS_ASSERT(e) {etl::private_error_handler::fail((e));}                                                     // Calls the error handler out of line
+    #define ETL_ALWAYS_ASSERT_AND_RETURN(e) {etl::private_error_handler::fail((e)); return;}                                  // Calls the error handler out of line and return
+    #define ETL_ALWAYS_ASSERT_AND_RETURN_VALUE(e, v) {etl::private_error_handler::fail((e)); return (v);}                     // Calls the error handler out of line and return a value
+  #elif defined(ETL_LOG_ERRORS)
     #define ETL_ASSERT(b, e) {if(!(b)) {etl::error_handler::error((e));}}                                 // If the condition fails, calls the error handler
     #define ETL_ASSERT_AND_RETURN(b, e) {if(!(b)) {etl::error_handler::error((e)); return;}}              // If the condition fails, calls the error handler and return
     #define ETL_ASSERT_AND_RETURN_VALUE(b, e, v) {if(!(b)) {etl::error_handler::error((e)); return (v);}} // If the condition fails, calls the error handler and return a value
@@ -0,0 +1,611 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FAST_MATH_INCLUDED
+#define ETL_FAST_MATH_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+#include "fixed_point.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+///\defgroup fast_math fast_math
+/// Run time approximations for targets where libm is slow, such as those
+/// without a floating point unit.
+///
+/// fast_log2 and fast_exp2 take the order of their polynomial as a template
+/// parameter, from 2 to 5. The largest errors are:
+/// Order   log2 (absolute)   exp2 (relative)
+///   2        7.6e-3            2.7e-3
+///   3        8.8e-4            1.0e-4
+///   4        1.1e-4            3.3e-6
+///   5        1.6e-5            9.2e-8
+/// The polynomials are exact at the ends of their ranges, so the results
+/// are continuous and exact at powers of two.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// The coefficients of the polynomials, lowest order first.
+    /// log2(1 + x) and 2^x for x in [0, 1).
+    //*************************************************************************
+    inline const double* log2_polynomial(size_t order)
+    {
+      static const double order2[] = { 0.0, 1.34655525, -0.346555249 };
+      static const double order3[] = { 0.0, 1.42286532, -0.582085418, 0.159220103 };
+      static const double order4[] = { 0.0, 1.43872573, -0.677783926, 0.321188857, -0.0821306608 };
+      static const double order5[] = { 0.0, 1.44191704, -0.709096423, 0.415605999, -0.193575639, 0.045149026 };
+
+      switch (order)
+      {
+        case 2:  return order2;
+        case 3:  return order3;
+        case 4:  return order4;
+        default: return order5;
+      }
+    }
+
+    inline const double* exp2_polynomial(size_t order)
+    {
+      static const double order2[] = { 1.0, 0.660233972, 0.339766028 };
+      static const double order3[] = { 1.0, 0.69542435, 0.226307681, 0.0782679691 };
+      static const double order4[] = { 1.0, 0.693032121, 0.241379764, 0.0520323688, 0.013555747 };
+      static const double order5[] = { 1.0, 0.693151739, 0.240159271, 0.0558186761, 0.00899099507, 0.00187931862 };
+
+      switch (order)
+      {
+        case 2:  return order2;
+        case 3:  return order3;
+        case 4:  return order4;
+        default: return order5;
+      }
+    }
+
+    //*************************************************************************
+    /// Evaluates a polynomial in float.
+    //*************************************************************************
+    template <size_t Order>
+    float horner(const double* coefficients, float x)
+    {
+      float result = float(coefficients[Order]);
+
+      for (size_t i = Order; i != 0U; --i)
+      {
+        result = (result * x) + float(coefficients[i - 1U]);
+      }
+
+      return result;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Evaluates a polynomial in Q30, for x in [0, 1).
+    //*************************************************************************
+    template <size_t Order>
+    int64_t horner_q30(const double* coefficients, int64_t x)
+    {
+      const double one = 1073741824.0;
+
+      int64_t result = int64_t(coefficients[Order] * one);
+
+      for (size_t i = Order; i != 0U; --i)
+      {
+        const double  c = coefficients[i - 1U] * one;
+        result = ((result * x) >> 30) + int64_t((c < 0.0) ? (c - 0.5) : (c + 0.5));
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Shifts a value left or right, rounding half up when shifting right.
+    //*************************************************************************
+    inline int64_t shift(int64_t value, int distance)
+    {
+      if (distance >= 0)
+      {
+        return value << distance;
+      }
+      else if (distance < -62)
+      {
+        return 0;
+      }
+      else
+      {
+        return private_fixed_point::shift_round<etl::fixed_point_rounding::half_up>(value, size_t(-distance));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// The bits of a float.
+    //*************************************************************************
+    inline uint32_t float_bits(float value)
+    {
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+      return bits;
+    }
+
+    inline float bits_float(uint32_t bits)
+    {
+      float value;
+      memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+
+    //*************************************************************************
+    /// sin(x) and cos(x) for x in [0, pi/4], by their series.
+    /// Accurate to double precision. Used to make the sine tables.
+    //*************************************************************************
+    ETL_CONSTEXPR14 double series_sin(double x)
+    {
+      const double x2   = x * x;
+      double       term = x;
+      double       sum  = x;
+
+      for (int n = 1; n < 12; ++n)
+      {
+        term *= -x2 / double((2 * n) * ((2 * n) + 1));
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    ETL_CONSTEXPR14 double series_cos(double x)
+    {
+      const double x2   = x * x;
+      double       term = 1.0;
+      double       sum  = 1.0;
+
+      for (int n = 1; n < 12; ++n)
+      {
+        term *= -x2 / double(((2 * n) - 1) * (2 * n));
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// sin(2.pi.index / size), by symmetry from the first eighth of a turn.
+    //*************************************************************************
+    ETL_CONSTEXPR14 double sine_of_index(size_t index, size_t size)
+    {
+      const double half_pi = 1.57079632679489661923;
+
+      const size_t quarter  = size / 4U;
+      const size_t position = index % size;
+      const bool   negative = position >= (size / 2U);
+
+      size_t in_half = negative ? (position - (size / 2U)) : position;
+      size_t in_quarter = (in_half > quarter) ? (size / 2U) - in_half : in_half;
+
+      double result = 0.0;
+
+      if ((2U * in_quarter) <= quarter)
+      {
+        result = series_sin(half_pi * double(in_quarter) / double(quarter));
+      }
+      else
+      {
+        result = series_cos(half_pi * double(quarter - in_quarter) / double(quarter));
+      }
+
+      return negative ? -result : result;
+    }
+
+    //*************************************************************************
+    /// How the sine table makes and interpolates its values.
+    //*************************************************************************
+    template <typename T>
+    struct sine_value
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "The sine table holds floating or fixed point values");
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        return T(value);
+      }
+
+      /// a + (b - a).fraction, where the fraction is in 1/65536ths.
+      static ETL_CONSTEXPR14 T interpolate(T a, T b, uint32_t fraction)
+      {
+        return a + ((b - a) * (T(fraction) * T(1.0 / 65536.0)));
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+    struct sine_value<etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> >
+    {
+      typedef etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> value_type;
+
+      static ETL_CONSTEXPR14 value_type from_double(double value)
+      {
+        return value_type::from_floating(value);
+      }
+
+      static ETL_CONSTEXPR14 value_type interpolate(value_type a, value_type b, uint32_t fraction)
+      {
+        const int64_t difference = int64_t(b.raw()) - int64_t(a.raw());
+
+        return value_type::from_raw(TStorage(int64_t(a.raw()) + ((difference * int64_t(fraction)) / 65536)));
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// The integer square root of an unsigned value, rounded down.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+    isqrt(T value)
+  {
+    T remainder = value;
+    T result    = 0;
+    T bit       = T(1) << (etl::integral_limits<T>::bits - 2);
+
+    while (bit > remainder)
+    {
+      bit >>= 2;
+    }
+
+    while (bit != 0)
+    {
+      if (remainder >= T(result + bit))
+      {
+        remainder -= T(result + bit);
+        result     = T((result >> 1) + bit);
+      }
+      else
+      {
+        result >>= 1;
+      }
+
+      bit >>= 2;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// The base 2 log of an unsigned value, rounded down.
+  /// Zero gives zero.
+  /// Uses the count leading zeros instruction where the compiler has one.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_unsigned<T>::value, size_t>::type
+    ilog2(T value)
+  {
+    if (value == 0U)
+    {
+      return 0U;
+    }
+
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+    return size_t(etl::integral_limits<unsigned long long>::bits) - 1U - size_t(__builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+    size_t result = 0U;
+
+    while ((value >>= 1) != 0U)
+    {
+      ++result;
+    }
+
+    return result;
+#endif
+  }
+
+  //***************************************************************************
+  /// An approximation of 1 / sqrt(x), for positive x.
+  /// One Newton iteration gives a relative error of less than 1.8e-3, two
+  /// less than 4.8e-6.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Iterations>
+  float fast_inverse_sqrt(float x)
+  {
+    const float half = 0.5f * x;
+
+    float y = private_fast_math::bits_float(0x5F375A86UL - (private_fast_math::float_bits(x) >> 1));
+
+    for (size_t i = 0U; i < Iterations; ++i)
+    {
+      y = y * (1.5f - (half * y * y));
+    }
+
+    return y;
+  }
+
+  inline float fast_inverse_sqrt(float x)
+  {
+    return etl::fast_inverse_sqrt<1U>(x);
+  }
+
+  //***************************************************************************
+  /// An approximation of log2(x), for positive, normal x.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Order>
+  float fast_log2(float x)
+  {
+    ETL_STATIC_ASSERT((Order >= 2U) && (Order <= 5U), "Order must be from 2 to 5");
+
+    const uint32_t bits     = private_fast_math::float_bits(x);
+    const int      exponent = int((bits >> 23) & 0xFFU) - 127;
+
+    // The mantissa, as a value in [1, 2).
+    const float mantissa = private_fast_math::bits_float((bits & 0x007FFFFFUL) | 0x3F800000UL);
+
+    return float(exponent) + private_fast_math::horner<Order>(private_fast_math::log2_polynomial(Order), mantissa - 1.0f);
+  }
+
+  //***************************************************************************
+  /// An approximation of 2^x.
+  /// x is limited to [-126, 128), so the result is normal and finite.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Order>
+  float fast_exp2(float x)
+  {
+    ETL_STATIC_ASSERT((Order >= 2U) && (Order <= 5U), "Order must be from 2 to 5");
+
+    // NaN gives the lower limit.
+    x = (x >= -126.0f) ? x : -126.0f;
+    x = (x <= 127.99999f) ? x : 127.99999f;
+
+    // Split into integral and fractional parts, rounding down.
+    const int32_t truncated = int32_t(x);
+    const int32_t integral  = truncated - ((float(truncated) > x) ? 1 : 0);
+
+    const float    fraction = x - float(integral);
+    const float    power    = private_fast_math::horner<Order>(private_fast_math::exp2_polynomial(Order), fraction);
+    const uint32_t bits     = private_fast_math::float_bits(power) + (uint32_t(integral) << 23);
+
+    return private_fast_math::bits_float(bits);
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// An approximation of log2(x) for fixed point, in integer arithmetic.
+  /// Values that are not positive give the lowest value of the format.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Order, size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    fast_log2(etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> x)
+  {
+    ETL_STATIC_ASSERT((Order >= 2U) && (Order <= 5U), "Order must be from 2 to 5");
+
+    typedef etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> fixed_t;
+
+    if (x.raw() <= 0)
+    {
+      return fixed_t::min();
+    }
+
+    const uint64_t raw      = uint64_t(x.raw());
+    const size_t   exponent = etl::ilog2(raw);
+
+    // The bits below the leading one, as a Q30 fraction.
+    const int64_t fraction = int64_t(((raw << 30) >> exponent) - (uint64_t(1) << 30));
+
+    const int64_t result_q30 = ((int64_t(exponent) - int64_t(Fractional_Bits)) * (int64_t(1) << 30)) +
+                               private_fast_math::horner_q30<Order>(private_fast_math::log2_polynomial(Order), fraction);
+
+    const int64_t result = private_fast_math::shift(result_q30, int(Fractional_Bits) - 30);
+
+    if (result > int64_t(fixed_t::Raw_Max))
+    {
+      return fixed_t::max();
+    }
+    else if (result < int64_t(fixed_t::Raw_Min))
+    {
+      return fixed_t::min();
+    }
+    else
+    {
+      return fixed_t::from_raw(TStorage(result));
+    }
+  }
+
+  //***************************************************************************
+  /// An approximation of 2^x for fixed point, in integer arithmetic.
+  /// Results too large for the format saturate.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Order, size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    fast_exp2(etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> x)
+  {
+    ETL_STATIC_ASSERT((Order >= 2U) && (Order <= 5U), "Order must be from 2 to 5");
+
+    typedef etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> fixed_t;
+
+    const int64_t raw      = int64_t(x.raw());
+    const int64_t integral = private_fixed_point::shift_round<etl::fixed_point_rounding::floor>(raw, Fractional_Bits);
+    const int64_t fraction = raw - (integral * (int64_t(1) << Fractional_Bits));
+
+    // 2^fraction in Q30, in [1, 2).
+    const int64_t power = private_fast_math::horner_q30<Order>(private_fast_math::exp2_polynomial(Order),
+                                                               private_fast_math::shift(fraction, 30 - int(Fractional_Bits)));
+
+    const int64_t distance = integral + int64_t(Fractional_Bits) - 30;
+
+    // The result is at least 2^(distance + 30), so larger distances saturate.
+    if (distance > (int64_t(etl::integral_limits<TStorage>::bits) - 30))
+    {
+      return fixed_t::max();
+    }
+
+    const int64_t result = private_fast_math::shift(power, int(distance));
+
+    if (result > int64_t(fixed_t::Raw_Max))
+    {
+      return fixed_t::max();
+    }
+    else
+    {
+      return fixed_t::from_raw(TStorage(result));
+    }
+  }
+#endif
+
+  //***************************************************************************
+  /// A table of sines, with linear interpolation.
+  /// The table has 2^Table_Bits steps per turn. The largest error is about
+  /// 4.9 / 4^Table_Bits, such as 7.5e-5 for 8 bits.
+  /// T may be float, double or an etl::fixed_point such as etl::q15_t.
+  /// The table is made by the constructor, which is constexpr from C++14, so
+  /// a constexpr table may be placed in read only memory.
+  /// Angles are given either in radians or as a phase, where 2^32 is a whole
+  /// turn, which suits fixed point and phase accumulators.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <size_t Table_Bits, typename T = float>
+  class sine_table
+  {
+    ETL_STATIC_ASSERT((Table_Bits >= 2U) && (Table_Bits <= 16U), "Table_Bits must be from 2 to 16");
+
+    typedef private_fast_math::sine_value<T> value_t;
+
+  public:
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t Size = size_t(1U) << Table_Bits;
+
+    //*************************************************************************
+    /// Makes the table.
+    //*************************************************************************
+    ETL_CONSTEXPR14 sine_table()
+      : table()
+    {
+      for (size_t i = 0U; i <= Size; ++i)
+      {
+        table[i] = value_t::from_double(private_fast_math::sine_of_index(i, Size));
+      }
+    }
+
+    //*************************************************************************
+    /// The sine of a phase, where 2^32 is a whole turn.
+    //*************************************************************************
+    ETL_CONSTEXPR14 T sin_phase(uint32_t phase) const
+    {
+      const size_t   index    = size_t(phase >> (32U - Table_Bits));
+      const uint32_t fraction = uint32_t(phase << Table_Bits) >> 16;
+
+      return value_t::interpolate(table[index], table[index + 1U], fraction);
+    }
+
+    //*************************************************************************
+    /// The cosine of a phase, where 2^32 is a whole turn.
+    //*************************************************************************
+    ETL_CONSTEXPR14 T cos_phase(uint32_t phase) const
+    {
+      return sin_phase(uint32_t(phase + 0x40000000UL));
+    }
+
+    //*************************************************************************
+    /// The sine of an angle in radians.
+    //*************************************************************************
+    template <typename TAngle>
+    typename etl::enable_if<etl::is_floating_point<TAngle>::value, T>::type
+      sin(TAngle radians) const
+    {
+      return sin_phase(to_phase(radians));
+    }
+
+    //*************************************************************************
+    /// The cosine of an angle in radians.
+    //*************************************************************************
+    template <typename TAngle>
+    typename etl::enable_if<etl::is_floating_point<TAngle>::value, T>::type
+      cos(TAngle radians) const
+    {
+      return cos_phase(to_phase(radians));
+    }
+
+    //*************************************************************************
+    /// A value from the table.
+    //*************************************************************************
+    ETL_CONSTEXPR T operator [](size_t index) const
+    {
+      return table[index];
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Converts radians to a phase. The angle must be less than 2^31 turns.
+    /// The arithmetic is done in the type of the angle.
+    //*************************************************************************
+    template <typename TAngle>
+    static uint32_t to_phase(TAngle radians)
+    {
+      const TAngle turns = radians * TAngle(0.15915494309189533577);
+
+      // Keep the fraction of a turn, in [0, 1).
+      TAngle fraction = turns - TAngle(int32_t(turns));
+
+      if (fraction < TAngle(0))
+      {
+        fraction += TAngle(1);
+      }
+
+      if (fraction >= TAngle(1))
+      {
+        fraction = TAngle(0);
+      }
+
+      return uint32_t(uint64_t(fraction * TAngle(4294967296.0)));
+    }
+
+    T table[Size + 1U];
+  };
+
+  template <size_t Table_Bits, typename T>
+  ETL_CONSTANT size_t sine_table<Table_Bits, T>::Size;
+}
+
+#endif
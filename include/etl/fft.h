@@ -0,0 +1,500 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FFT_INCLUDED
+#define ETL_FFT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "power.h"
+#include "fixed_point.h"
+#include "fast_math.h"
+
+#include <stddef.h>
+
+///\defgroup fft fft
+/// Fast Fourier transforms of power of two lengths, in place, with no heap.
+///
+/// Complex data is held as interleaved real and imaginary values, so a
+/// transform of N points works on an array of 2N values.
+///
+/// The twiddle factors are made by the constructor from series in double
+/// precision, without libm. From C++14 the constructor is constexpr, so a
+/// constexpr etl::fft has its tables made by the compiler and placed in read
+/// only memory, with the same values on every target.
+///
+/// Fixed point transforms use only integer arithmetic and give the same
+/// results on every target. Floating point transforms do too, as long as the
+/// compiler does not contract multiplies and adds into fused operations
+/// (-ffp-contract=off for GCC and Clang) or use extended precision.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_fft
+  {
+    //*************************************************************************
+    /// How the transforms do their arithmetic.
+    /// Floating point transforms are not scaled.
+    //*************************************************************************
+    template <typename T>
+    struct arithmetic
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "etl::fft works with floating or signed fixed point values");
+
+      typedef T accumulator_type;
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        return T(value);
+      }
+
+      static accumulator_type widen(T value)
+      {
+        return value;
+      }
+
+      /// Scaled types divide by 2^shift. Floating point ignores it.
+      static T narrow(accumulator_type value, size_t /*shift*/)
+      {
+        return value;
+      }
+
+      static T half(accumulator_type value)
+      {
+        return value * T(0.5);
+      }
+
+      /// (re + j.im) *= (wr + j.wi)
+      static void multiply(T& re, T& im, T wr, T wi)
+      {
+        const T r = (re * wr) - (im * wi);
+
+        im = (re * wi) + (im * wr);
+        re = r;
+      }
+
+      /// Divides by n after an inverse transform.
+      static T rescale(T value, size_t n)
+      {
+        return value * (T(1) / T(n));
+      }
+    };
+
+    //*************************************************************************
+    /// Fixed point sums are made in the wide type and rounded and saturated
+    /// once. Each stage divides by its radix, so that nothing can overflow.
+    //*************************************************************************
+    template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+    struct arithmetic<etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> >
+    {
+      ETL_STATIC_ASSERT(etl::is_signed<TStorage>::value, "etl::fft works with floating or signed fixed point values");
+
+      typedef etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> value_type;
+      typedef typename value_type::wide_type                                       accumulator_type;
+
+      static ETL_CONSTEXPR14 value_type from_double(double value)
+      {
+        return value_type::from_floating(value);
+      }
+
+      static accumulator_type widen(value_type value)
+      {
+        return accumulator_type(value.raw());
+      }
+
+      static value_type narrow(accumulator_type value, size_t shift)
+      {
+        return saturate(private_fixed_point::shift_round<Rounding>(value, shift));
+      }
+
+      static value_type half(accumulator_type value)
+      {
+        return narrow(value, 1U);
+      }
+
+      static void multiply(value_type& re, value_type& im, value_type wr, value_type wi)
+      {
+        const accumulator_type ar = widen(re);
+        const accumulator_type ai = widen(im);
+        const accumulator_type br = widen(wr);
+        const accumulator_type bi = widen(wi);
+
+        re = narrow((ar * br) - (ai * bi), Fractional_Bits);
+        im = narrow((ar * bi) + (ai * br), Fractional_Bits);
+      }
+
+      /// The stages have already divided by n.
+      static value_type rescale(value_type value, size_t /*n*/)
+      {
+        return value;
+      }
+
+    private:
+
+      static value_type saturate(accumulator_type value)
+      {
+        if (value > accumulator_type(value_type::Raw_Max))
+        {
+          return value_type::max();
+        }
+        else if (value < accumulator_type(value_type::Raw_Min))
+        {
+          return value_type::min();
+        }
+        else
+        {
+          return value_type::from_raw(TStorage(value));
+        }
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// A fast Fourier transform of N points, where N is a power of two of at
+  /// least 4.
+  /// Radix 4 stages are used, with one radix 2 stage when N is an odd power
+  /// of two.
+  /// T may be float, double or a signed etl::fixed_point such as etl::q15_t.
+  ///
+  /// Floating point: forward() is not scaled and inverse() divides by N, so
+  /// a round trip returns the input.
+  /// Fixed point: each stage divides by its radix, so both directions divide
+  /// by N and nothing overflows. A round trip returns the input divided by N.
+  ///
+  /// The object holds 1.5N values of T.
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T = float>
+  class fft
+  {
+    ETL_STATIC_ASSERT((N >= 4U) && etl::is_power_of_2<N>::value, "N must be a power of two of at least 4");
+
+    typedef private_fft::arithmetic<T>                  arithmetic_t;
+    typedef typename arithmetic_t::accumulator_type     accumulator_t;
+
+  public:
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t Size = N;
+
+    //*************************************************************************
+    /// Makes the twiddle factors, exp(-2.pi.j.k / N) for k in [0, 3N/4).
+    //*************************************************************************
+    ETL_CONSTEXPR14 fft()
+      : twiddles()
+    {
+      for (size_t k = 0U; k < Twiddle_Count; ++k)
+      {
+        twiddles[2U * k]        = arithmetic_t::from_double(private_fast_math::sine_of_index(k + (N / 4U), N));
+        twiddles[(2U * k) + 1U]  = arithmetic_t::from_double(-private_fast_math::sine_of_index(k, N));
+      }
+    }
+
+    //*************************************************************************
+    /// The forward transform of N complex values, in place.
+    /// data holds 2N interleaved real and imaginary values.
+    //*************************************************************************
+    void forward(T* data) const
+    {
+      transform(data, N, 1U);
+    }
+
+    //*************************************************************************
+    /// The inverse transform of N complex values, in place.
+    /// data holds 2N interleaved real and imaginary values.
+    //*************************************************************************
+    void inverse(T* data) const
+    {
+      conjugate(data, N);
+      transform(data, N, 1U);
+      conjugate(data, N);
+      rescale(data, 2U * N, N);
+    }
+
+    //*************************************************************************
+    /// The forward transform of N real values, in place.
+    /// The result is the first half of the spectrum, as N / 2 complex values,
+    /// except that the imaginary part of bin 0 holds the real part of bin N / 2.
+    /// Both are real, and the other half of the spectrum is their conjugate.
+    //*************************************************************************
+    void forward_real(T* data) const
+    {
+      const size_t M = N / 2U;
+
+      // The even values are the real parts and the odd values the imaginary.
+      transform(data, M, 2U);
+
+      // Bins 0 and N/2.
+      const accumulator_t a = arithmetic_t::widen(data[0]);
+      const accumulator_t b = arithmetic_t::widen(data[1]);
+
+      data[0] = arithmetic_t::narrow(a + b, 1U);
+      data[1] = arithmetic_t::narrow(a - b, 1U);
+
+      // The rest in pairs, k and M - k.
+      for (size_t k = 1U; k <= (M / 2U); ++k)
+      {
+        T* const zk = data + (2U * k);
+        T* const zj = data + (2U * (M - k));
+
+        const accumulator_t kr = arithmetic_t::widen(zk[0]);
+        const accumulator_t ki = arithmetic_t::widen(zk[1]);
+        const accumulator_t jr = arithmetic_t::widen(zj[0]);
+        const accumulator_t ji = arithmetic_t::widen(zj[1]);
+
+        // The transforms of the even and odd values.
+        const T even_r = arithmetic_t::half(kr + jr);
+        const T even_i = arithmetic_t::half(ki - ji);
+        T       odd_r  = arithmetic_t::half(ki + ji);
+        T       odd_i  = arithmetic_t::half(jr - kr);
+
+        arithmetic_t::multiply(odd_r, odd_i, twiddles[2U * k], twiddles[(2U * k) + 1U]);
+
+        const accumulator_t w_even_r = arithmetic_t::widen(even_r);
+        const accumulator_t w_even_i = arithmetic_t::widen(even_i);
+        const accumulator_t w_odd_r  = arithmetic_t::widen(odd_r);
+        const accumulator_t w_odd_i  = arithmetic_t::widen(odd_i);
+
+        zj[0] = arithmetic_t::narrow(w_even_r - w_odd_r, 1U);
+        zj[1] = arithmetic_t::narrow(w_odd_i - w_even_i, 1U);
+        zk[0] = arithmetic_t::narrow(w_even_r + w_odd_r, 1U);
+        zk[1] = arithmetic_t::narrow(w_even_i + w_odd_i, 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// The inverse of forward_real, in place.
+    /// data holds a spectrum packed as forward_real makes it.
+    //*************************************************************************
+    void inverse_real(T* data) const
+    {
+      const size_t M = N / 2U;
+
+      // Bins 0 and N/2.
+      const accumulator_t a = arithmetic_t::widen(data[0]);
+      const accumulator_t b = arithmetic_t::widen(data[1]);
+
+      data[0] = arithmetic_t::half(a + b);
+      data[1] = arithmetic_t::half(a - b);
+
+      // The rest in pairs, k and M - k.
+      for (size_t k = 1U; k <= (M / 2U); ++k)
+      {
+        T* const xk = data + (2U * k);
+        T* const xj = data + (2U * (M - k));
+
+        const accumulator_t kr = arithmetic_t::widen(xk[0]);
+        const accumulator_t ki = arithmetic_t::widen(xk[1]);
+        const accumulator_t jr = arithmetic_t::widen(xj[0]);
+        const accumulator_t ji = arithmetic_t::widen(xj[1]);
+
+        // The transforms of the even and odd values.
+        const T even_r = arithmetic_t::half(kr + jr);
+        const T even_i = arithmetic_t::half(ki - ji);
+        T       odd_r  = arithmetic_t::half(kr - jr);
+        T       odd_i  = arithmetic_t::half(ki + ji);
+
+        arithmetic_t::multiply(odd_r, odd_i, twiddles[2U * k], -twiddles[(2U * k) + 1U]);
+
+        const accumulator_t w_even_r = arithmetic_t::widen(even_r);
+        const accumulator_t w_even_i = arithmetic_t::widen(even_i);
+        const accumulator_t w_odd_r  = arithmetic_t::widen(odd_r);
+        const accumulator_t w_odd_i  = arithmetic_t::widen(odd_i);
+
+        // Even + j.odd
+        xj[0] = arithmetic_t::narrow(w_even_r + w_odd_i, 0U);
+        xj[1] = arithmetic_t::narrow(w_odd_r - w_even_i, 0U);
+        xk[0] = arithmetic_t::narrow(w_even_r - w_odd_i, 0U);
+        xk[1] = arithmetic_t::narrow(w_even_i + w_odd_r, 0U);
+      }
+
+      conjugate(data, M);
+      transform(data, M, 2U);
+      conjugate(data, M);
+      rescale(data, N, M);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Twiddle_Count = (3U * N) / 4U;
+
+    //*************************************************************************
+    /// The forward transform of n complex values, using every stride'th
+    /// twiddle factor.
+    //*************************************************************************
+    void transform(T* data, size_t n, size_t stride) const
+    {
+      bit_reverse(data, n);
+
+      size_t span = 1U;
+
+      // A radix 2 stage first if n is an odd power of two.
+      if ((etl::ilog2(n) & 1U) != 0U)
+      {
+        for (size_t i = 0U; i < (2U * n); i += 4U)
+        {
+          const accumulator_t ar = arithmetic_t::widen(data[i]);
+          const accumulator_t ai = arithmetic_t::widen(data[i + 1U]);
+          const accumulator_t br = arithmetic_t::widen(data[i + 2U]);
+          const accumulator_t bi = arithmetic_t::widen(data[i + 3U]);
+
+          data[i]      = arithmetic_t::narrow(ar + br, 1U);
+          data[i + 1U] = arithmetic_t::narrow(ai + bi, 1U);
+          data[i + 2U] = arithmetic_t::narrow(ar - br, 1U);
+          data[i + 3U] = arithmetic_t::narrow(ai - bi, 1U);
+        }
+
+        span = 2U;
+      }
+
+      // Radix 4 stages, each combining four transforms of 'span' points.
+      // After the bit reversal the four are of the values 0, 2, 1 and 3 mod 4.
+      while (span < n)
+      {
+        const size_t step = stride * (n / (4U * span));
+
+        for (size_t k = 0U; k < span; ++k)
+        {
+          const T w1r = twiddles[2U * (k * step)];
+          const T w1i = twiddles[(2U * (k * step)) + 1U];
+          const T w2r = twiddles[2U * (2U * k * step)];
+          const T w2i = twiddles[(2U * (2U * k * step)) + 1U];
+          const T w3r = twiddles[2U * (3U * k * step)];
+          const T w3i = twiddles[(2U * (3U * k * step)) + 1U];
+
+          for (size_t block = 0U; block < n; block += 4U * span)
+          {
+            T* const p0 = data + (2U * (block + k));
+            T* const p1 = p0 + (2U * span);
+            T* const p2 = p1 + (2U * span);
+            T* const p3 = p2 + (2U * span);
+
+            T b2r = p1[0];
+            T b2i = p1[1];
+            T b1r = p2[0];
+            T b1i = p2[1];
+            T b3r = p3[0];
+            T b3i = p3[1];
+
+            arithmetic_t::multiply(b1r, b1i, w1r, w1i);
+            arithmetic_t::multiply(b2r, b2i, w2r, w2i);
+            arithmetic_t::multiply(b3r, b3i, w3r, w3i);
+
+            const accumulator_t s02r = arithmetic_t::widen(p0[0]) + arithmetic_t::widen(b2r);
+            const accumulator_t s02i = arithmetic_t::widen(p0[1]) + arithmetic_t::widen(b2i);
+            const accumulator_t d02r = arithmetic_t::widen(p0[0]) - arithmetic_t::widen(b2r);
+            const accumulator_t d02i = arithmetic_t::widen(p0[1]) - arithmetic_t::widen(b2i);
+            const accumulator_t s13r = arithmetic_t::widen(b1r)   + arithmetic_t::widen(b3r);
+            const accumulator_t s13i = arithmetic_t::widen(b1i)   + arithmetic_t::widen(b3i);
+            const accumulator_t d13r = arithmetic_t::widen(b1r)   - arithmetic_t::widen(b3r);
+            const accumulator_t d13i = arithmetic_t::widen(b1i)   - arithmetic_t::widen(b3i);
+
+            p0[0] = arithmetic_t::narrow(s02r + s13r, 2U);
+            p0[1] = arithmetic_t::narrow(s02i + s13i, 2U);
+            p1[0] = arithmetic_t::narrow(d02r + d13i, 2U);
+            p1[1] = arithmetic_t::narrow(d02i - d13r, 2U);
+            p2[0] = arithmetic_t::narrow(s02r - s13r, 2U);
+            p2[1] = arithmetic_t::narrow(s02i - s13i, 2U);
+            p3[0] = arithmetic_t::narrow(d02r - d13i, 2U);
+            p3[1] = arithmetic_t::narrow(d02i + d13r, 2U);
+          }
+        }
+
+        span *= 4U;
+      }
+    }
+
+    //*************************************************************************
+    /// Puts n complex values into bit reversed order.
+    //*************************************************************************
+    static void bit_reverse(T* data, size_t n)
+    {
+      size_t j = 0U;
+
+      for (size_t i = 0U; i < (n - 1U); ++i)
+      {
+        if (i < j)
+        {
+          swap(data[2U * i],        data[2U * j]);
+          swap(data[(2U * i) + 1U], data[(2U * j) + 1U]);
+        }
+
+        size_t bit = n >> 1U;
+
+        while ((j & bit) != 0U)
+        {
+          j   ^= bit;
+          bit >>= 1U;
+        }
+
+        j |= bit;
+      }
+    }
+
+    //*************************************************************************
+    static void conjugate(T* data, size_t n)
+    {
+      for (size_t i = 1U; i < (2U * n); i += 2U)
+      {
+        data[i] = -data[i];
+      }
+    }
+
+    //*************************************************************************
+    static void rescale(T* data, size_t count, size_t n)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        data[i] = arithmetic_t::rescale(data[i], n);
+      }
+    }
+
+    //*************************************************************************
+    static void swap(T& a, T& b)
+    {
+      const T temp = a;
+      a = b;
+      b = temp;
+    }
+
+    T twiddles[2U * Twiddle_Count];
+  };
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t fft<N, T>::Size;
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t fft<N, T>::Twiddle_Count;
+}
+
+#endif
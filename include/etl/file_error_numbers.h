@@ -93,5 +93,34 @@ SOFTWARE.
 #define ETL_MESSAGE_ROUTER_REGISTRY_FILE_ID "60"
 #define ETL_ARRAY_WRAPPER_FILE_ID "61"
 #define ETL_MEM_CAST_FILE_ID "62"
+#define ETL_FLAT_HASH_MAP_FILE_ID "63"
+#define ETL_FLAT_HASH_SET_FILE_ID "64"
+#define ETL_BTREE_MAP_FILE_ID "65"
+#define ETL_BTREE_SET_FILE_ID "66"
+#define ETL_STATIC_FLAT_MAP_FILE_ID "67"
+#define ETL_STATIC_FLAT_SET_FILE_ID "68"
+#define ETL_SPLIT_FLAT_MAP_FILE_ID "69"
+#define ETL_CONST_MAP_FILE_ID "70"
+#define ETL_SEQLOCK_UNORDERED_MAP_FILE_ID "71"
+#define ETL_STRIPED_UNORDERED_SET_FILE_ID "72"
+#define ETL_BIP_BUFFER_SPSC_ATOMIC_FILE_ID "73"
+#define ETL_ASYNC_MESSAGE_BUS_FILE_ID "74"
+#define ETL_TO_ARITHMETIC_FILE_ID "75"
+#define ETL_FORMAT_FILE_ID "76"
+#define ETL_HASHED_STRING_VIEW_FILE_ID "77"
+#define ETL_MULTI_PATTERN_MATCHER_FILE_ID "78"
+#define ETL_K_WAY_MERGE_FILE_ID "79"
+#define ETL_SLOT_MAP_FILE_ID "80"
+#define ETL_INDEXED_PRIORITY_QUEUE_FILE_ID "81"
+#define ETL_SMALL_VECTOR_FILE_ID "82"
+#define ETL_ARENA_FILE_ID "83"
+#define ETL_IO_VECTOR_FILE_ID "84"
+#define ETL_FLAT_MAP_VIEW_FILE_ID "85"
+#define ETL_INPLACE_FUNCTION_FILE_ID "86"
+#define ETL_MDSPAN_FILE_ID "87"
+#define ETL_INTRUSIVE_STACK_ATOMIC_FILE_ID "88"
+#define ETL_PREFIX_MAP_FILE_ID "89"
+#define ETL_INTERVAL_MAP_FILE_ID "90"
+#define ETL_INTERVAL_SET_FILE_ID "91"
 
 #endif
@@ -0,0 +1,304 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIR_FILTER_INCLUDED
+#define ETL_FIR_FILTER_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+
+#include "private/filter_arithmetic.h"
+
+#include <stddef.h>
+
+///\defgroup fir_filter fir_filter
+/// A finite impulse response filter.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// A finite impulse response filter with a fixed number of taps.
+  /// y[n] = h[0].x[n] + h[1].x[n-1] + ... + h[Taps-1].x[n-Taps+1]
+  /// TValue may be a built in arithmetic type or an etl::fixed_point. For
+  /// fixed_point, TCoefficient may be a different fixed_point format, and
+  /// the products are summed exactly and rounded once per output.
+  /// The samples are kept in time order in a line with room for a block
+  /// after the history, which is moved back to the start when the line is
+  /// full. The coefficients are held in reverse, so that both run forwards. Blocks are filtered several outputs at a time, which the compiler
+  /// can vectorise. Each output sums its products in the same order however
+  /// the samples are given, so the results do not depend on the block sizes.
+  ///\ingroup fir_filter
+  //***************************************************************************
+  template <typename TValue, size_t Taps, typename TCoefficient = TValue>
+  class fir_filter
+  {
+    ETL_STATIC_ASSERT(Taps > 0U, "There must be at least one tap");
+
+    typedef private_filter::arithmetic<TValue, TCoefficient> arithmetic_t;
+    typedef typename arithmetic_t::accumulator_type          accumulator_t;
+
+    static ETL_CONSTANT size_t History   = Taps - 1U;       ///< The samples kept between outputs.
+    static ETL_CONSTANT size_t Line_Size = History + Taps + 16U;
+    static ETL_CONSTANT size_t Tile_Size = 8U;              ///< The outputs calculated together.
+
+  public:
+
+    typedef TValue       value_type;
+    typedef TCoefficient coefficient_type;
+
+    static ETL_CONSTANT size_t Number_Of_Taps = Taps;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The coefficients are all zero.
+    //*************************************************************************
+    fir_filter()
+    {
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        reversed[i] = TCoefficient();
+      }
+
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param coefficients_ The coefficients, h[0] first.
+    //*************************************************************************
+    explicit fir_filter(const TCoefficient (&coefficients_)[Taps])
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients, h[0] first.
+    /// The samples are not changed.
+    //*************************************************************************
+    template <typename TIterator>
+    void set_coefficients(TIterator first)
+    {
+      for (size_t i = Taps; i != 0U; --i)
+      {
+        reversed[i - 1U] = *first;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets a coefficient.
+    //*************************************************************************
+    TCoefficient coefficient(size_t index) const
+    {
+      return reversed[History - index];
+    }
+
+    //*************************************************************************
+    /// Sets the past samples to zero.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < History; ++i)
+      {
+        line[i] = TValue();
+      }
+
+      end = History;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TValue process(TValue sample)
+    {
+      if (end == Line_Size)
+      {
+        move_history();
+      }
+
+      line[end] = sample;
+
+      return output(end++);
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TValue operator ()(TValue sample)
+    {
+      return process(sample);
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// The output may be the same as the input.
+    /// Returns the end of the output.
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator process(TInputIterator first, TInputIterator last, TOutputIterator result)
+    {
+      while (first != last)
+      {
+        if (end == Line_Size)
+        {
+          move_history();
+        }
+
+        // Take in as many samples as will fit, before any output is written.
+        size_t index = end;
+
+        while ((end != Line_Size) && (first != last))
+        {
+          line[end] = TValue(*first);
+          ++end;
+          ++first;
+        }
+
+        for (; (index + Tile_Size) <= end; index += Tile_Size)
+        {
+          result = output_tile(index, result);
+        }
+
+        for (; index < end; ++index)
+        {
+          *result = output(index);
+          ++result;
+        }
+      }
+
+      return result;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The output for the sample at an index in the line.
+    //*************************************************************************
+    TValue output(size_t index) const
+    {
+      const TValue* samples = line + index - History;
+
+      accumulator_t sum = accumulator_t();
+
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        sum += arithmetic_t::multiply(samples[i], reversed[i]);
+      }
+
+      return arithmetic_t::result(sum);
+    }
+
+    //*************************************************************************
+    /// The outputs for Tile_Size samples from an index in the line.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator output_tile(size_t index, TOutputIterator result) const
+    {
+      typedef etl::integral_constant<bool, private_filter::has_tile_kernel<TValue, TCoefficient>::value> use_kernel_t;
+
+      accumulator_t sums[Tile_Size];
+
+      sum_tile(line + index - History, sums, use_kernel_t());
+
+      for (size_t j = 0U; j < Tile_Size; ++j)
+      {
+        *result = arithmetic_t::result(sums[j]);
+        ++result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Each tap is applied to the whole tile before the next, in the same
+    /// order as output().
+    //*************************************************************************
+    void sum_tile(const TValue* samples, accumulator_t* sums, etl::false_type) const
+    {
+      for (size_t j = 0U; j < Tile_Size; ++j)
+      {
+        sums[j] = accumulator_t();
+      }
+
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        const TCoefficient c = reversed[i];
+
+        for (size_t j = 0U; j < Tile_Size; ++j)
+        {
+          sums[j] += arithmetic_t::multiply(samples[i + j], c);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Uses the SIMD kernel.
+    //*************************************************************************
+    void sum_tile(const TValue* samples, accumulator_t* sums, etl::true_type) const
+    {
+      private_filter::tile_kernel(samples, reversed, Taps, sums);
+    }
+
+    //*************************************************************************
+    /// Moves the last History samples to the start of the line.
+    //*************************************************************************
+    void move_history()
+    {
+      const TValue* source = line + (end - History);
+
+      for (size_t i = 0U; i < History; ++i)
+      {
+        line[i] = source[i];
+      }
+
+      end = History;
+    }
+
+    TCoefficient reversed[Taps];     ///< h[Taps - 1] to h[0].
+    TValue       line[Line_Size];    ///< The samples, oldest first.
+    size_t       end;                ///< The index after the newest sample.
+  };
+
+  template <typename TValue, size_t Taps, typename TCoefficient>
+  ETL_CONSTANT size_t fir_filter<TValue, Taps, TCoefficient>::History;
+
+  template <typename TValue, size_t Taps, typename TCoefficient>
+  ETL_CONSTANT size_t fir_filter<TValue, Taps, TCoefficient>::Line_Size;
+
+  template <typename TValue, size_t Taps, typename TCoefficient>
+  ETL_CONSTANT size_t fir_filter<TValue, Taps, TCoefficient>::Tile_Size;
+
+  template <typename TValue, size_t Taps, typename TCoefficient>
+  ETL_CONSTANT size_t fir_filter<TValue, Taps, TCoefficient>::Number_Of_Taps;
+}
+
+#endif
@@ -0,0 +1,608 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_POINT_INCLUDED
+#define ETL_FIXED_POINT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "smallest.h"
+#include "negative.h"
+#include "absolute.h"
+#include "integral_limits.h"
+
+#include "private/fixed_point_kernels.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+///\defgroup fixed_point fixed_point
+/// Fixed point numbers, for targets without a floating point unit.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// The rounding modes for etl::fixed_point.
+  /// They have the same meanings as the functions in scaled_rounding.h.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  struct fixed_point_rounding
+  {
+    enum enum_type
+    {
+      ceiling,   ///< Toward positive infinity.
+      floor,     ///< Toward negative infinity. Just a shift.
+      zero,      ///< Toward zero.
+      infinity,  ///< Away from zero.
+      half_up,   ///< To nearest. Halves away from zero.
+      half_down, ///< To nearest. Halves toward zero.
+      half_even, ///< To nearest. Halves to even.
+      half_odd   ///< To nearest. Halves to odd.
+    };
+  };
+
+  namespace private_fixed_point
+  {
+    //*************************************************************************
+    /// The type that holds the product of two values.
+    //*************************************************************************
+    template <typename TStorage>
+    struct wide;
+
+    template <> struct wide<int8_t>   { typedef int32_t  type; };
+    template <> struct wide<uint8_t>  { typedef uint32_t type; };
+    template <> struct wide<int16_t>  { typedef int32_t  type; };
+    template <> struct wide<uint16_t> { typedef uint32_t type; };
+#if ETL_USING_64BIT_TYPES
+    template <> struct wide<int32_t>  { typedef int64_t  type; };
+    template <> struct wide<uint32_t> { typedef uint64_t type; };
+#endif
+
+    //*************************************************************************
+    /// Completes a rounding, given the quotient rounded toward zero.
+    /// 'negative' is the sign of the exact result.
+    /// 'inexact' is true if there was a remainder.
+    /// 'half' compares the remainder to one half: -1, 0 or +1.
+    //*************************************************************************
+    template <etl::fixed_point_rounding::enum_type Rounding, typename T>
+    ETL_CONSTEXPR14 T complete_rounding(T quotient, bool negative, bool inexact, int half)
+    {
+      const T away = negative ? T(quotient - 1) : T(quotient + 1);
+
+      switch (Rounding)
+      {
+        case etl::fixed_point_rounding::ceiling:   return (inexact && !negative) ? away : quotient;
+        case etl::fixed_point_rounding::floor:     return (inexact && negative) ? away : quotient;
+        case etl::fixed_point_rounding::zero:      return quotient;
+        case etl::fixed_point_rounding::infinity:  return inexact ? away : quotient;
+        case etl::fixed_point_rounding::half_up:   return (half >= 0) ? away : quotient;
+        case etl::fixed_point_rounding::half_down: return (half > 0) ? away : quotient;
+        case etl::fixed_point_rounding::half_even: return ((half > 0) || ((half == 0) && ((quotient & 1) != 0))) ? away : quotient;
+        case etl::fixed_point_rounding::half_odd:  return ((half > 0) || ((half == 0) && ((quotient & 1) == 0))) ? away : quotient;
+        default:                                   return quotient;
+      }
+    }
+
+    //*************************************************************************
+    /// Divides by 2^shift, rounding.
+    //*************************************************************************
+    template <etl::fixed_point_rounding::enum_type Rounding, typename T>
+    ETL_CONSTEXPR14 T shift_round(T value, size_t shift)
+    {
+      if (shift == 0U)
+      {
+        return value;
+      }
+
+      const bool negative  = etl::is_negative(value);
+      const T    magnitude = etl::absolute(value);
+      const T    quotient  = T(magnitude >> shift);
+      const T    remainder = T(magnitude - (quotient << shift));
+      const T    half      = T(T(1) << (shift - 1U));
+
+      const int compare = (remainder > half) ? 1 : ((remainder < half) ? -1 : 0);
+
+      return complete_rounding<Rounding>(negative ? T(0 - quotient) : quotient, negative, remainder != 0, compare);
+    }
+
+    //*************************************************************************
+    /// Divides, rounding.
+    //*************************************************************************
+    template <etl::fixed_point_rounding::enum_type Rounding, typename T>
+    ETL_CONSTEXPR14 T divide_round(T numerator, T denominator)
+    {
+      const T    quotient  = T(numerator / denominator);
+      const T    remainder = etl::absolute(T(numerator % denominator));
+      const T    divisor   = etl::absolute(denominator);
+      const bool negative  = etl::is_negative(numerator) != etl::is_negative(denominator);
+
+      // Compares the remainder with the divisor minus the remainder, which cannot overflow.
+      const T   rest    = T(divisor - remainder);
+      const int compare = (remainder > rest) ? 1 : ((remainder < rest) ? -1 : 0);
+
+      return complete_rounding<Rounding>(quotient, negative, remainder != 0, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// A fixed point number.
+  /// Integral_Bits and Fractional_Bits are the bits either side of the point,
+  /// not counting the sign. Q15 is fixed_point<0, 15, int16_t>.
+  /// All arithmetic saturates at the limits of the format, including the
+  /// conversions. Division by zero saturates in the direction of the
+  /// numerator.
+  /// Products and quotients are rounded as set by Rounding. 'floor' is the
+  /// quickest, as it is just a shift.
+  /// Storage types of up to 32 bits are supported. 32 bit types need
+  /// ETL_USING_64BIT_TYPES.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t Integral_Bits,
+            size_t Fractional_Bits,
+            typename TStorage = typename etl::smallest_int_for_bits<Integral_Bits + Fractional_Bits + 1U>::type,
+            etl::fixed_point_rounding::enum_type Rounding = etl::fixed_point_rounding::half_up>
+  class fixed_point
+  {
+  public:
+
+    typedef TStorage                                               storage_type;
+    typedef typename private_fixed_point::wide<TStorage>::type     wide_type;
+
+  private:
+
+    static ETL_CONSTANT size_t Value_Bits = Integral_Bits + Fractional_Bits + (etl::is_signed<TStorage>::value ? 1U : 0U);
+
+    ETL_STATIC_ASSERT(etl::is_integral<TStorage>::value, "The storage type must be integral");
+    ETL_STATIC_ASSERT(Value_Bits <= size_t(etl::integral_limits<TStorage>::bits), "The storage type is too small for the format");
+
+  public:
+
+    static ETL_CONSTANT size_t    Integer_Bits  = Integral_Bits;
+    static ETL_CONSTANT size_t    Fraction_Bits = Fractional_Bits;
+    static ETL_CONSTANT wide_type One_Raw       = wide_type(1) << Fractional_Bits;
+    static ETL_CONSTANT TStorage  Raw_Max       = TStorage((wide_type(1) << (Integral_Bits + Fractional_Bits)) - 1);
+    static ETL_CONSTANT TStorage  Raw_Min       = TStorage(etl::is_signed<TStorage>::value ? (0 - (wide_type(1) << (Integral_Bits + Fractional_Bits))) : 0);
+
+    //*************************************************************************
+    /// Constructs zero.
+    //*************************************************************************
+    ETL_CONSTEXPR fixed_point()
+      : value(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Makes a value from its raw representation.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed_point from_raw(TStorage raw)
+    {
+      return fixed_point(saturate(wide_type(raw)));
+    }
+
+    //*************************************************************************
+    /// Makes a value from an integer.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 fixed_point from_integer(wide_type integer)
+    {
+      if (integer > (wide_type(Raw_Max) / One_Raw))
+      {
+        return fixed_point(Raw_Max);
+      }
+      else if (integer < (wide_type(Raw_Min) / One_Raw))
+      {
+        return fixed_point(Raw_Min);
+      }
+      else
+      {
+        return fixed_point(TStorage(integer * One_Raw));
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a value from a floating point number.
+    /// NaN becomes zero.
+    //*************************************************************************
+    template <typename T>
+    static ETL_CONSTEXPR14 typename etl::enable_if<etl::is_floating_point<T>::value, fixed_point>::type
+      from_floating(T floating)
+    {
+      const T scaled = floating * T(One_Raw);
+
+      if (scaled != scaled)
+      {
+        return fixed_point();
+      }
+      else if (scaled >= T(Raw_Max))
+      {
+        return fixed_point(Raw_Max);
+      }
+      else if (scaled <= T(Raw_Min))
+      {
+        return fixed_point(Raw_Min);
+      }
+      else
+      {
+        const wide_type truncated = wide_type(scaled);
+        const T         fraction  = etl::absolute(scaled - T(truncated));
+        const int       compare   = (fraction > T(0.5)) ? 1 : ((fraction < T(0.5)) ? -1 : 0);
+
+        return fixed_point(saturate(private_fixed_point::complete_rounding<Rounding>(truncated, scaled < T(0), fraction != T(0), compare)));
+      }
+    }
+
+    //*************************************************************************
+    /// The raw representation.
+    //*************************************************************************
+    ETL_CONSTEXPR TStorage raw() const
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// The value as an integer, rounded.
+    //*************************************************************************
+    ETL_CONSTEXPR14 wide_type to_integer() const
+    {
+      return private_fixed_point::shift_round<Rounding>(wide_type(value), Fractional_Bits);
+    }
+
+    //*************************************************************************
+    /// The value as a floating point number.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR typename etl::enable_if<etl::is_floating_point<T>::value, T>::type
+      to_floating() const
+    {
+      return T(value) / T(One_Raw);
+    }
+
+    //*************************************************************************
+    /// The largest value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point max()
+    {
+      return fixed_point(Raw_Max);
+    }
+
+    //*************************************************************************
+    /// The smallest value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point min()
+    {
+      return fixed_point(Raw_Min);
+    }
+
+    //*************************************************************************
+    /// The smallest step.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point epsilon()
+    {
+      return fixed_point(TStorage(1));
+    }
+
+    //*************************************************************************
+    /// Saturating arithmetic.
+    //*************************************************************************
+    ETL_CONSTEXPR14 fixed_point& operator +=(const fixed_point& rhs)
+    {
+      value = saturate(wide_type(value) + wide_type(rhs.value));
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator -=(const fixed_point& rhs)
+    {
+      // Unsigned differences would wrap in the wide type.
+      value = (!etl::is_signed<TStorage>::value && (rhs.value > value)) ? Raw_Min : saturate(wide_type(value) - wide_type(rhs.value));
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator *=(const fixed_point& rhs)
+    {
+      value = saturate(private_fixed_point::shift_round<Rounding>(wide_type(wide_type(value) * wide_type(rhs.value)), Fractional_Bits));
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point& operator /=(const fixed_point& rhs)
+    {
+      if (rhs.value == 0)
+      {
+        value = etl::is_negative(value) ? Raw_Min : ((value == 0) ? TStorage(0) : Raw_Max);
+      }
+      else
+      {
+        value = saturate(private_fixed_point::divide_round<Rounding>(wide_type(wide_type(value) * One_Raw), wide_type(rhs.value)));
+      }
+
+      return *this;
+    }
+
+    ETL_CONSTEXPR14 fixed_point operator -() const
+    {
+      return etl::is_signed<TStorage>::value ? fixed_point(saturate(wide_type(0) - wide_type(value))) : fixed_point();
+    }
+
+    //*************************************************************************
+    /// Comparisons.
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    friend ETL_CONSTEXPR bool operator !=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value != rhs.value;
+    }
+
+    friend ETL_CONSTEXPR bool operator <(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    friend ETL_CONSTEXPR bool operator <=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value <= rhs.value;
+    }
+
+    friend ETL_CONSTEXPR bool operator >(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value > rhs.value;
+    }
+
+    friend ETL_CONSTEXPR bool operator >=(const fixed_point& lhs, const fixed_point& rhs)
+    {
+      return lhs.value >= rhs.value;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Constructs from a raw value that is known to be in range.
+    //*************************************************************************
+    explicit ETL_CONSTEXPR fixed_point(TStorage raw)
+      : value(raw)
+    {
+    }
+
+    //*************************************************************************
+    /// Limits a wide value to the format.
+    //*************************************************************************
+    static ETL_CONSTEXPR TStorage saturate(wide_type wide)
+    {
+      return (wide > wide_type(Raw_Max)) ? Raw_Max : ((wide < wide_type(Raw_Min)) ? Raw_Min : TStorage(wide));
+    }
+
+    TStorage value;
+  };
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT size_t fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::Value_Bits;
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT size_t fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::Integer_Bits;
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT size_t fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::Fraction_Bits;
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT typename fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::wide_type fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::One_Raw;
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT TStorage fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::Raw_Max;
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTANT TStorage fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>::Raw_Min;
+
+  //***************************************************************************
+  /// Saturating arithmetic.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTEXPR14 fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    operator +(fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> lhs, const fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>& rhs)
+  {
+    return lhs += rhs;
+  }
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTEXPR14 fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    operator -(fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> lhs, const fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>& rhs)
+  {
+    return lhs -= rhs;
+  }
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTEXPR14 fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    operator *(fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> lhs, const fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>& rhs)
+  {
+    return lhs *= rhs;
+  }
+
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  ETL_CONSTEXPR14 fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>
+    operator /(fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> lhs, const fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>& rhs)
+  {
+    return lhs /= rhs;
+  }
+
+  //***************************************************************************
+  /// The Q formats.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  typedef etl::fixed_point<0, 7, int8_t>   q7_t;
+  typedef etl::fixed_point<0, 15, int16_t> q15_t;
+#if ETL_USING_64BIT_TYPES
+  typedef etl::fixed_point<0, 31, int32_t> q31_t;
+#endif
+
+  namespace private_fixed_point
+  {
+    //*************************************************************************
+    /// Whether arrays of a format can use the 16 bit kernels.
+    //*************************************************************************
+    template <typename TStorage, size_t Value_Bits>
+    struct use_int16_kernel
+    {
+      static ETL_CONSTANT bool value = etl::is_same<TStorage, int16_t>::value && (Value_Bits == 15U);
+    };
+
+    //*************************************************************************
+    /// Whether the 16 bit kernels can do a rounding.
+    //*************************************************************************
+    template <etl::fixed_point_rounding::enum_type Rounding>
+    struct kernel_rounding
+    {
+      static ETL_CONSTANT bool value = (Rounding == etl::fixed_point_rounding::floor) || (Rounding == etl::fixed_point_rounding::half_up);
+    };
+
+    //*************************************************************************
+    /// The raw values of an array.
+    /// fixed_point holds nothing but its raw value.
+    //*************************************************************************
+    template <typename TFixed>
+    const typename TFixed::storage_type* raw_values(const TFixed* p)
+    {
+      ETL_STATIC_ASSERT(sizeof(TFixed) == sizeof(typename TFixed::storage_type), "Unexpected fixed_point layout");
+      return reinterpret_cast<const typename TFixed::storage_type*>(p);
+    }
+
+    template <typename TFixed>
+    typename TFixed::storage_type* raw_values(TFixed* p)
+    {
+      ETL_STATIC_ASSERT(sizeof(TFixed) == sizeof(typename TFixed::storage_type), "Unexpected fixed_point layout");
+      return reinterpret_cast<typename TFixed::storage_type*>(p);
+    }
+
+    //*************************************************************************
+    /// Array operations that have no kernel.
+    //*************************************************************************
+    template <typename TFixed>
+    size_t add_block(const TFixed*, const TFixed*, TFixed*, size_t, etl::false_type)
+    {
+      return 0U;
+    }
+
+    template <typename TFixed>
+    size_t subtract_block(const TFixed*, const TFixed*, TFixed*, size_t, etl::false_type)
+    {
+      return 0U;
+    }
+
+    template <typename TFixed>
+    size_t multiply_block(const TFixed*, const TFixed*, TFixed*, size_t, bool, etl::false_type)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Array operations that have a kernel.
+    //*************************************************************************
+    template <typename TFixed>
+    size_t add_block(const TFixed* a, const TFixed* b, TFixed* result, size_t n, etl::true_type)
+    {
+      return add_int16(raw_values(a), raw_values(b), raw_values(result), n);
+    }
+
+    template <typename TFixed>
+    size_t subtract_block(const TFixed* a, const TFixed* b, TFixed* result, size_t n, etl::true_type)
+    {
+      return subtract_int16(raw_values(a), raw_values(b), raw_values(result), n);
+    }
+
+    template <typename TFixed>
+    size_t multiply_block(const TFixed* a, const TFixed* b, TFixed* result, size_t n, bool round_half_up, etl::true_type)
+    {
+      return multiply_int16(raw_values(a), raw_values(b), raw_values(result), n, int(TFixed::Fraction_Bits), round_half_up);
+    }
+  }
+
+  //***************************************************************************
+  /// Adds two arrays, saturating.
+  /// Q15 style formats use SSE2 or NEON where available.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  void fixed_point_add(const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* a,
+                       const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* b,
+                       etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>*       result,
+                       size_t n)
+  {
+    typedef etl::integral_constant<bool, private_fixed_point::use_int16_kernel<TStorage, Integral_Bits + Fractional_Bits>::value> use_kernel_t;
+
+    for (size_t i = private_fixed_point::add_block(a, b, result, n, use_kernel_t()); i < n; ++i)
+    {
+      result[i] = a[i] + b[i];
+    }
+  }
+
+  //***************************************************************************
+  /// Subtracts two arrays, saturating.
+  /// Q15 style formats use SSE2 or NEON where available.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  void fixed_point_subtract(const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* a,
+                            const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* b,
+                            etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>*       result,
+                            size_t n)
+  {
+    typedef etl::integral_constant<bool, private_fixed_point::use_int16_kernel<TStorage, Integral_Bits + Fractional_Bits>::value> use_kernel_t;
+
+    for (size_t i = private_fixed_point::subtract_block(a, b, result, n, use_kernel_t()); i < n; ++i)
+    {
+      result[i] = a[i] - b[i];
+    }
+  }
+
+  //***************************************************************************
+  /// Multiplies two arrays, rounding and saturating.
+  /// Q15 style formats with 'floor' or 'half_up' rounding use SSE2 or NEON
+  /// where available.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t Integral_Bits, size_t Fractional_Bits, typename TStorage, etl::fixed_point_rounding::enum_type Rounding>
+  void fixed_point_multiply(const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* a,
+                            const etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>* b,
+                            etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding>*       result,
+                            size_t n)
+  {
+    typedef etl::integral_constant<bool, private_fixed_point::use_int16_kernel<TStorage, Integral_Bits + Fractional_Bits>::value &&
+                                         private_fixed_point::kernel_rounding<Rounding>::value> use_kernel_t;
+
+    for (size_t i = private_fixed_point::multiply_block(a, b, result, n, Rounding == etl::fixed_point_rounding::half_up, use_kernel_t()); i < n; ++i)
+    {
+      result[i] = a[i] * b[i];
+    }
+  }
+}
+
+#endif
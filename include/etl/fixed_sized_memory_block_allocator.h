@@ -35,6 +35,7 @@ SOFTWARE.
 #include "imemory_block_allocator.h"
 #include "generic_pool.h"
 #include "alignment.h"
+#include "pool_statistics.h"
 
 namespace etl
 {
@@ -69,6 +70,25 @@ namespace etl
     }
 #endif
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets the usage statistics of the allocator.
+    /// A request that is passed on to a successor counts as a failure here.
+    //*************************************************************************
+    etl::pool_statistics statistics() const
+    {
+      return etl_pool_statistics.get();
+    }
+
+    //*************************************************************************
+    /// Clears the counts. The peak restarts from the current size.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      etl_pool_statistics.reset();
+    }
+#endif
+
   private:
 
     /// A structure that has the size Block_Size.
@@ -86,10 +106,12 @@ namespace etl
           (required_size <= Block_Size) && 
           !pool.full())
       {
+        ETL_POOL_STATISTICS_ALLOCATED
         return  pool.template allocate<block>();
       }
       else
       {
+        ETL_POOL_STATISTICS_FAILED
         return ETL_NULLPTR;
       }
     }
@@ -102,6 +124,7 @@ namespace etl
       if (pool.is_in_pool(pblock))
       {
         pool.release(static_cast<const block* const>(pblock));
+        ETL_POOL_STATISTICS_RELEASED
         return true;
       }
       else
@@ -112,6 +135,8 @@ namespace etl
 
     /// The generic pool from which allocate memory blocks.
     etl::generic_pool<Block_Size, Alignment, Size> pool;
+
+    ETL_DECLARE_POOL_STATISTICS
   };
 }
 
@@ -0,0 +1,590 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_MAP_INCLUDED
+#define ETL_FLAT_HASH_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/flat_hash_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup flat_hash_map flat_hash_map
+/// An open addressing hash map with the capacity defined at compile time.
+/// The elements are stored in the map, with no separate node pool.
+/// Insertion may move the elements, invalidating iterators and references.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_exception : public etl::exception
+  {
+  public:
+
+    flat_hash_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_full : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:full", ETL_FLAT_HASH_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_out_of_range : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:range", ETL_FLAT_HASH_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_iterator : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:iterator", ETL_FLAT_HASH_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_map.
+  /// Can be used as a reference type for all flat_hash_map containing a specific type.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_hash_map : public etl::private_flat_hash::flat_hash_table<ETL_OR_STD::pair<const TKey, T>,
+                                                                        TKey,
+                                                                        etl::private_flat_hash::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                                                        THash,
+                                                                        TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::flat_hash_table<ETL_OR_STD::pair<const TKey, T>,
+                                                    TKey,
+                                                    etl::private_flat_hash::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                                    THash,
+                                                    TKeyEqual> base;
+
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+    typedef typename base::difference_type difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_full if the key is new and the map is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      const size_t hash = base::hash_of(key);
+      size_t       slot = base::find_index(key, hash);
+
+      if (slot == base::slot_count())
+      {
+        // Doesn't exist, so add a new one.
+        ETL_ASSERT(!base::full(), ETL_ERROR(flat_hash_map_full));
+
+        slot = base::prepare_insert(hash);
+        ::new (base::slot_address(slot)) value_type(key, T());
+        base::commit_insert(slot, hash);
+      }
+
+      return base::slot_address(slot)->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_hash_map_iterator));
+      ETL_ASSERT(size_t(d) <= base::max_size(), ETL_ERROR(flat_hash_map_full));
+#endif
+
+      base::clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const size_t hash = base::hash_of(key_value_pair.first);
+      size_t       slot = base::find_index(key_value_pair.first, hash);
+
+      if (slot != base::slot_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), false);
+      }
+
+      ETL_ASSERT(!base::full(), ETL_ERROR(flat_hash_map_full));
+
+      slot = base::prepare_insert(hash);
+      ::new (base::slot_address(slot)) value_type(key_value_pair);
+      base::commit_insert(slot, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), true);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const size_t hash = base::hash_of(key_value_pair.first);
+      size_t       slot = base::find_index(key_value_pair.first, hash);
+
+      if (slot != base::slot_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), false);
+      }
+
+      ETL_ASSERT(!base::full(), ETL_ERROR(flat_hash_map_full));
+
+      slot = base::prepare_insert(hash);
+      ::new (base::slot_address(slot)) value_type(etl::move(key_value_pair));
+      base::commit_insert(slot, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (const iflat_hash_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (iflat_hash_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_map(etl::private_flat_hash::ctrl_t* pcontrol_, value_type* pslots_, size_t number_of_slots_, size_t max_size_)
+      : base(pcontrol_, pslots_, number_of_slots_, max_size_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first++));
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    iflat_hash_map(const iflat_hash_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_HASH_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// The maps are equal if they hold the same keys, with equal mapped values.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>::const_iterator const_iterator;
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      const_iterator other = rhs.find(itr->first);
+
+      if ((other == rhs.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& lhs, const etl::iflat_hash_map<TKey, TMapped, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_map : public etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t SLOT_COUNT = etl::private_flat_hash::slot_count_for<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_map()
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_map(const flat_hash_map& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_map(flat_hash_map&& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_map(TIterator first_, TIterator last_)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (const flat_hash_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (flat_hash_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        base::move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes, one per slot.
+    etl::private_flat_hash::ctrl_t control[SLOT_COUNT];
+
+    /// The storage for the elements.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * SLOT_COUNT, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::SLOT_COUNT;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  flat_hash_map(T, Ts...)
+    ->flat_hash_map<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), typename T::first_type>,
+                    typename T::second_type,
+                    1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
@@ -0,0 +1,517 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_SET_INCLUDED
+#define ETL_FLAT_HASH_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/flat_hash_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup flat_hash_set flat_hash_set
+/// An open addressing hash set with the capacity defined at compile time.
+/// The elements are stored in the set, with no separate node pool.
+/// Insertion may move the elements, invalidating iterators and references.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_exception : public etl::exception
+  {
+  public:
+
+    flat_hash_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_full : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:full", ETL_FLAT_HASH_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_set.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  class flat_hash_set_iterator : public etl::flat_hash_set_exception
+  {
+  public:
+
+    flat_hash_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_set_exception(ETL_ERROR_TEXT("flat_hash_set:iterator", ETL_FLAT_HASH_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_set.
+  /// Can be used as a reference type for all flat_hash_set containing a specific type.
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_hash_set : public etl::private_flat_hash::flat_hash_table<TKey,
+                                                                        TKey,
+                                                                        etl::private_flat_hash::select_self<TKey>,
+                                                                        THash,
+                                                                        TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::flat_hash_table<TKey,
+                                                    TKey,
+                                                    etl::private_flat_hash::select_self<TKey>,
+                                                    THash,
+                                                    TKeyEqual> base;
+
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+    typedef typename base::difference_type difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_hash_set_iterator));
+      ETL_ASSERT(size_t(d) <= base::max_size(), ETL_ERROR(flat_hash_set_full));
+#endif
+
+      base::clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param key The key to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key)
+    {
+      const size_t hash = base::hash_of(key);
+      size_t       slot = base::find_index(key, hash);
+
+      if (slot != base::slot_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), false);
+      }
+
+      ETL_ASSERT(!base::full(), ETL_ERROR(flat_hash_set_full));
+
+      slot = base::prepare_insert(hash);
+      ::new (base::slot_address(slot)) value_type(key);
+      base::commit_insert(slot, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), true);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param key The key to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      const size_t hash = base::hash_of(key);
+      size_t       slot = base::find_index(key, hash);
+
+      if (slot != base::slot_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), false);
+      }
+
+      ETL_ASSERT(!base::full(), ETL_ERROR(flat_hash_set_full));
+
+      slot = base::prepare_insert(hash);
+      ::new (base::slot_address(slot)) value_type(etl::move(key));
+      base::commit_insert(slot, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(base::to_iterator(slot), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key The key to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key The key to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key)
+    {
+      return insert(etl::move(key)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_set.
+    /// If asserts or exceptions are enabled, emits flat_hash_set_full if the flat_hash_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (const iflat_hash_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_set& operator = (iflat_hash_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_set(etl::private_flat_hash::ctrl_t* pcontrol_, value_type* pslots_, size_t number_of_slots_, size_t max_size_)
+      : base(pcontrol_, pslots_, number_of_slots_, max_size_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        insert(etl::move(*first++));
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    iflat_hash_set(const iflat_hash_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_HASH_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_set()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// The sets are equal if they hold the same keys.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iflat_hash_set<TKey, THash, TKeyEqual>::const_iterator const_iterator;
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      if (!rhs.contains(*itr))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_set.
+  ///\param rhs Reference to the second flat_hash_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_hash_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_hash_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_set : public etl::iflat_hash_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t SLOT_COUNT = etl::private_flat_hash::slot_count_for<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_set()
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_set(const flat_hash_set& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_set(flat_hash_set&& other)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_set(TIterator first_, TIterator last_)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_set(std::initializer_list<TKey> init)
+      : base(control, reinterpret_cast<typename base::value_type*>(&slots), SLOT_COUNT, MAX_SIZE_)
+    {
+      base::initialise();
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (const flat_hash_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_set& operator = (flat_hash_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::clear();
+        base::move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes, one per slot.
+    etl::private_flat_hash::ctrl_t control[SLOT_COUNT];
+
+    /// The storage for the elements.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * SLOT_COUNT, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_set<TKey, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_set<TKey, MAX_SIZE_, THash, TKeyEqual>::SLOT_COUNT;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  flat_hash_set(T, Ts...)
+    ->flat_hash_set<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), T>,
+                    1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
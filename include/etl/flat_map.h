@@ -259,6 +259,7 @@ namespace etl
 
     //*********************************************************************
     /// Assigns values to the flat_map.
+    /// The values are sorted and merged in a single step. Only the first value for each key is kept.
     /// If ETL_THROW_EXCEPTIONS & ETL_DEBUG are defined, emits flat_map_full if the flat_map does not have enough free space.
     /// If ETL_THROW_EXCEPTIONS & ETL_DEBUG are defined, emits flat_map_iterator if the iterators are reversed.
     ///\param first The iterator to the first element.
@@ -273,11 +274,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the flat_map from a range sorted by key.
+    /// Avoids the sort that assign performs.
+    /// If ETL_THROW_EXCEPTIONS & ETL_DEBUG are defined, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_map_full));
+#endif
+
+      clear();
+      insert_sorted_unique(first, last);
     }
 
     //*********************************************************************
@@ -366,10 +382,21 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, sorted by key, to the flat_map.
+    /// The values are appended and merged with the existing ones in a single step.
+    /// Values with a key that already exists, or that repeats an earlier key in the range, are ignored.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted_unique(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -637,6 +664,20 @@ namespace etl
       return refmap_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return refmap_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -647,6 +688,20 @@ namespace etl
       return refmap_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return refmap_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -657,6 +712,44 @@ namespace etl
       return refmap_t::count(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return refmap_t::count(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -667,6 +760,20 @@ namespace etl
       return refmap_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return refmap_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -677,6 +784,20 @@ namespace etl
       return refmap_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return refmap_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -687,6 +808,20 @@ namespace etl
       return refmap_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return refmap_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -697,6 +832,20 @@ namespace etl
       return refmap_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return refmap_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -707,6 +856,20 @@ namespace etl
       return refmap_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return refmap_t::equal_range(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -717,6 +880,20 @@ namespace etl
       return refmap_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return refmap_t::equal_range(key);
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -724,7 +901,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign_sorted(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -832,6 +1009,68 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Returns the values removed by a merge to the storage.
+    //*********************************************************************
+    class element_releaser
+    {
+    public:
+
+      explicit element_releaser(iflat_map& map_)
+        : map(map_)
+      {
+      }
+
+      void operator ()(value_type& value) const
+      {
+        map.release_element(value);
+      }
+
+    private:
+
+      iflat_map& map;
+    };
+
+    //*********************************************************************
+    /// Appends a range of values and merges them in to the flat_map.
+    /// Any values that do not fit are inserted individually after the merge.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t index = refmap_t::size();
+
+      while ((first != last) && !refmap_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refmap_t::append(*pvalue);
+      }
+
+      if (!is_sorted)
+      {
+        refmap_t::sort_from(index);
+      }
+
+      refmap_t::merge_from(index, element_releaser(*this));
+
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Destroys a value and returns it to the storage.
+    //*********************************************************************
+    void release_element(value_type& value)
+    {
+      value.~value_type();
+      storage.release(etl::addressof(value));
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
@@ -884,6 +1123,22 @@ namespace etl
     return !(lhs == rhs);
   }
 
+  //***************************************************************************
+  /// Merges the values of one flat_map in to another.
+  /// Values with a key already in the destination are ignored.
+  /// The existing values are skipped by galloping, and only the overlapping
+  /// part of the two maps is merged.
+  /// If asserts or exceptions are enabled, emits flat_map_full if the destination does not have enough free space.
+  ///\param destination The flat_map to merge in to.
+  ///\param source      The flat_map to merge from.
+  ///\ingroup flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  void merge_into(etl::iflat_map<TKey, TMapped, TKeyCompare>& destination, const etl::iflat_map<TKey, TMapped, TKeyCompare>& source)
+  {
+    destination.insert_sorted_unique(source.begin(), source.end());
+  }
+
   //***************************************************************************
   /// A flat_map implementation that uses a fixed size buffer.
   ///\tparam TKey     The key type.
@@ -913,7 +1168,7 @@ namespace etl
     flat_map(const flat_map& other)
       : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign_sorted(other.cbegin(), other.cend());
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -969,7 +1224,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign_sorted(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -0,0 +1,576 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MAP_VIEW_INCLUDED
+#define ETL_FLAT_MAP_VIEW_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "utility.h"
+#include "iterator.h"
+#include "alignment.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+///\defgroup flat_map_view flat_map_view
+/// Read only views of sorted arrays that live elsewhere, such as tables in
+/// flash or in a memory mapped file.
+/// Nothing is copied; a view is just a pointer and a size, so creating one
+/// is O(1). Lookups are O(logN).
+/// A view may be made from a serialized byte image. The image is the array
+/// of elements exactly as it is laid out in memory, sorted by the view's
+/// compare, and suitably aligned for the element type.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// Exception base for flat_map_views
+  //***************************************************************************
+  class flat_map_view_exception : public etl::exception
+  {
+  public:
+
+    flat_map_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// Key not found exception.
+  //***************************************************************************
+  class flat_map_view_out_of_bounds : public etl::flat_map_view_exception
+  {
+  public:
+
+    flat_map_view_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : flat_map_view_exception(ETL_ERROR_TEXT("flat_map_view:bounds", ETL_FLAT_MAP_VIEW_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// Misaligned or wrongly sized image exception.
+  //***************************************************************************
+  class flat_map_view_bad_image : public etl::flat_map_view_exception
+  {
+  public:
+
+    flat_map_view_bad_image(string_type file_name_, numeric_type line_number_)
+      : flat_map_view_exception(ETL_ERROR_TEXT("flat_map_view:bad image", ETL_FLAT_MAP_VIEW_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_map_view
+  {
+    //*************************************************************************
+    /// Checks that a byte image can be read as an array of T.
+    /// On success sets 'count' to the number of elements.
+    //*************************************************************************
+    template <typename T>
+    bool image_to_array(const void* image, size_t image_size, size_t& count)
+    {
+      count = 0U;
+
+      const bool is_valid = ((image != ETL_NULLPTR) || (image_size == 0U)) &&
+                            ((reinterpret_cast<uintptr_t>(image) % etl::alignment_of<T>::value) == 0U) &&
+                            ((image_size % sizeof(T)) == 0U);
+
+      ETL_ASSERT(is_valid, ETL_ERROR(flat_map_view_bad_image));
+
+      if (is_valid)
+      {
+        count = image_size / sizeof(T);
+      }
+
+      return is_valid;
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// A read only view of a sorted array.
+  /// Duplicates are allowed.
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T> >
+  class sorted_array_view
+  {
+  public:
+
+    typedef T        value_type;
+    typedef TCompare value_compare;
+    typedef size_t   size_type;
+    typedef const T& const_reference;
+    typedef const T* const_pointer;
+    typedef const T* const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef ETL_OR_STD::pair<const_iterator, const_iterator> const_range;
+
+    //*************************************************************************
+    /// Default constructor. An empty view.
+    //*************************************************************************
+    ETL_CONSTEXPR sorted_array_view()
+      : pbegin(ETL_NULLPTR)
+      , pend(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an array.
+    //*************************************************************************
+    ETL_CONSTEXPR sorted_array_view(const T* pbegin_, size_t size_)
+      : pbegin(pbegin_)
+      , pend(pbegin_ + size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Creates a view of a serialized byte image of 'image_size' bytes.
+    /// If asserts or exceptions are enabled, emits flat_map_view_bad_image if
+    /// the image is misaligned or not a whole number of elements.
+    /// Otherwise a bad image gives an empty view.
+    //*************************************************************************
+    static sorted_array_view from_image(const void* image, size_t image_size)
+    {
+      size_t count;
+
+      if (private_flat_map_view::image_to_array<T>(image, image_size, count))
+      {
+        return sorted_array_view(static_cast<const T*>(image), count);
+      }
+
+      return sorted_array_view();
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return pbegin;
+    }
+
+    const_iterator cbegin() const
+    {
+      return pbegin;
+    }
+
+    const_iterator end() const
+    {
+      return pend;
+    }
+
+    const_iterator cend() const
+    {
+      return pend;
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(pend);
+    }
+
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(pbegin);
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the indexed element.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return pbegin[i];
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the first element.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return pbegin;
+    }
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return size_type(pend - pbegin);
+    }
+
+    //*************************************************************************
+    /// True if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pbegin == pend;
+    }
+
+    //*************************************************************************
+    /// The first element not less than 'value'.
+    //*************************************************************************
+    const_iterator lower_bound(const T& value) const
+    {
+      return etl::lower_bound(pbegin, pend, value, compare);
+    }
+
+    //*************************************************************************
+    /// The first element greater than 'value'.
+    //*************************************************************************
+    const_iterator upper_bound(const T& value) const
+    {
+      return etl::upper_bound(pbegin, pend, value, compare);
+    }
+
+    //*************************************************************************
+    /// The range of elements equal to 'value'.
+    //*************************************************************************
+    const_range equal_range(const T& value) const
+    {
+      return const_range(lower_bound(value), upper_bound(value));
+    }
+
+    //*************************************************************************
+    /// The first element equal to 'value', or end().
+    //*************************************************************************
+    const_iterator find(const T& value) const
+    {
+      const_iterator itr = lower_bound(value);
+
+      return ((itr != pend) && !compare(value, *itr)) ? itr : pend;
+    }
+
+    //*************************************************************************
+    /// True if an element equal to 'value' is present.
+    //*************************************************************************
+    bool contains(const T& value) const
+    {
+      return find(value) != pend;
+    }
+
+    //*************************************************************************
+    /// The number of elements equal to 'value'.
+    //*************************************************************************
+    size_type count(const T& value) const
+    {
+      const_range range = equal_range(value);
+
+      return size_type(range.second - range.first);
+    }
+
+    //*************************************************************************
+    /// Checks that the elements are in order. This is O(N), so is intended
+    /// for checking an image once, when it is loaded or in a test.
+    //*************************************************************************
+    bool is_sorted() const
+    {
+      return etl::is_sorted(pbegin, pend, compare);
+    }
+
+  private:
+
+    const T* pbegin;
+    const T* pend;
+
+    TCompare compare;
+  };
+
+  //***************************************************************************
+  ///\ingroup flat_map_view
+  /// A read only view of a sorted array of key/mapped pairs.
+  /// Keys are unique.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class const_flat_map_view
+  {
+  public:
+
+    typedef TKey                         key_type;
+    typedef TMapped                      mapped_type;
+    typedef etl::pair<TKey, TMapped>     value_type;
+    typedef TKeyCompare                  key_compare;
+    typedef size_t                       size_type;
+    typedef const value_type&            const_reference;
+    typedef const value_type*            const_pointer;
+    typedef const value_type*            const_iterator;
+    typedef const mapped_type&           const_mapped_reference;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef ETL_OR_STD::pair<const_iterator, const_iterator> const_range;
+
+    //*************************************************************************
+    /// Compares elements by their keys.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return compare(lhs.first, rhs.first);
+      }
+
+      bool operator ()(const value_type& lhs, const key_type& key) const
+      {
+        return compare(lhs.first, key);
+      }
+
+      bool operator ()(const key_type& key, const value_type& rhs) const
+      {
+        return compare(key, rhs.first);
+      }
+
+    private:
+
+      key_compare compare;
+    };
+
+    //*************************************************************************
+    /// Default constructor. An empty view.
+    //*************************************************************************
+    ETL_CONSTEXPR const_flat_map_view()
+      : pbegin(ETL_NULLPTR)
+      , pend(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an array.
+    //*************************************************************************
+    ETL_CONSTEXPR const_flat_map_view(const value_type* pbegin_, size_t size_)
+      : pbegin(pbegin_)
+      , pend(pbegin_ + size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Creates a view of a serialized byte image of 'image_size' bytes.
+    /// If asserts or exceptions are enabled, emits flat_map_view_bad_image if
+    /// the image is misaligned or not a whole number of elements.
+    /// Otherwise a bad image gives an empty view.
+    //*************************************************************************
+    static const_flat_map_view from_image(const void* image, size_t image_size)
+    {
+      size_t count;
+
+      if (private_flat_map_view::image_to_array<value_type>(image, image_size, count))
+      {
+        return const_flat_map_view(static_cast<const value_type*>(image), count);
+      }
+
+      return const_flat_map_view();
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return pbegin;
+    }
+
+    const_iterator cbegin() const
+    {
+      return pbegin;
+    }
+
+    const_iterator end() const
+    {
+      return pend;
+    }
+
+    const_iterator cend() const
+    {
+      return pend;
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(pend);
+    }
+
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(pbegin);
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value mapped to 'key'.
+    /// If asserts or exceptions are enabled, emits flat_map_view_out_of_bounds
+    /// if the key is not in the map.
+    //*************************************************************************
+    const_mapped_reference at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != pend, ETL_ERROR(flat_map_view_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the value mapped to 'key', or ETL_NULLPTR.
+    //*************************************************************************
+    const mapped_type* find_mapped(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      return (itr != pend) ? &itr->second : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the first element.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return pbegin;
+    }
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return size_type(pend - pbegin);
+    }
+
+    //*************************************************************************
+    /// True if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pbegin == pend;
+    }
+
+    //*************************************************************************
+    /// The first element with a key not less than 'key'.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return etl::lower_bound(pbegin, pend, key, compare);
+    }
+
+    //*************************************************************************
+    /// The first element with a key greater than 'key'.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return etl::upper_bound(pbegin, pend, key, compare);
+    }
+
+    //*************************************************************************
+    /// The range of elements with a key equal to 'key'.
+    //*************************************************************************
+    const_range equal_range(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      return const_range(itr, (itr != pend) ? itr + 1 : itr);
+    }
+
+    //*************************************************************************
+    /// The element with a key equal to 'key', or end().
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      return ((itr != pend) && !compare(key, *itr)) ? itr : pend;
+    }
+
+    //*************************************************************************
+    /// True if an element with a key equal to 'key' is present.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find(key) != pend;
+    }
+
+    //*************************************************************************
+    /// The number of elements with a key equal to 'key'.
+    //*************************************************************************
+    size_type count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the key compare.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+    //*************************************************************************
+    /// Returns the value compare.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Checks that the keys are in order and unique. This is O(N), so is
+    /// intended for checking an image once, when it is loaded or in a test.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      for (const_iterator itr = pbegin; (itr != pend) && ((itr + 1) != pend); ++itr)
+      {
+        if (!compare(*itr, *(itr + 1)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+  private:
+
+    const value_type* pbegin;
+    const value_type* pend;
+
+    value_compare compare;
+  };
+}
+
+#endif
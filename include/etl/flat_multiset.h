@@ -493,6 +493,20 @@ namespace etl
       return refset_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return refset_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -503,6 +517,20 @@ namespace etl
       return refset_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return refset_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -513,6 +541,44 @@ namespace etl
       return refset_t::count(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return refset_t::count(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(const_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -523,6 +589,20 @@ namespace etl
       return refset_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return refset_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -533,6 +613,20 @@ namespace etl
       return refset_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return refset_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -543,6 +637,20 @@ namespace etl
       return refset_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return refset_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -553,6 +661,20 @@ namespace etl
       return refset_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return refset_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -563,6 +685,20 @@ namespace etl
       return refset_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return refset_t::equal_range(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -573,6 +709,20 @@ namespace etl
       return refset_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return refset_t::equal_range(key);
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -197,6 +197,7 @@ namespace etl
 
     //*********************************************************************
     /// Assigns values to the flat_set.
+    /// The values are sorted and merged in a single step. Only the first of equal values is kept.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
     /// If asserts or exceptions are enabled, emits flat_set_iterator if the iterators are reversed.
     ///\param first The iterator to the first element.
@@ -211,11 +212,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the flat_set from a sorted range.
+    /// Avoids the sort that assign performs.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_set_full));
+#endif
+
+      clear();
+      insert_sorted_unique(first, last);
     }
 
     //*********************************************************************
@@ -304,10 +320,21 @@ namespace etl
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_set.
+    /// The values are appended and merged with the existing ones in a single step.
+    /// Values that already exist, or that repeat an earlier value in the range, are ignored.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted_unique(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -578,6 +605,20 @@ namespace etl
       return refset_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return refset_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -588,6 +629,20 @@ namespace etl
       return refset_t::find(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return refset_t::find(key);
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -598,6 +653,44 @@ namespace etl
       return refset_t::count(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return refset_t::count(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(const_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -608,6 +701,20 @@ namespace etl
       return refset_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return refset_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -618,6 +725,20 @@ namespace etl
       return refset_t::lower_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return refset_t::lower_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -628,6 +749,20 @@ namespace etl
       return refset_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return refset_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -638,6 +773,20 @@ namespace etl
       return refset_t::upper_bound(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return refset_t::upper_bound(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -648,6 +797,20 @@ namespace etl
       return refset_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return refset_t::equal_range(key);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -655,9 +818,23 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_reference key) const
     {
-      return refset_t::upper_bound(key);
+      return refset_t::equal_range(key);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return refset_t::equal_range(key);
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -665,7 +842,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        assign_sorted(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
@@ -773,6 +950,68 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Returns the values removed by a merge to the storage.
+    //*********************************************************************
+    class element_releaser
+    {
+    public:
+
+      explicit element_releaser(iflat_set& set_)
+        : set(set_)
+      {
+      }
+
+      void operator ()(value_type& value) const
+      {
+        set.release_element(value);
+      }
+
+    private:
+
+      iflat_set& set;
+    };
+
+    //*********************************************************************
+    /// Appends a range of values and merges them in to the flat_set.
+    /// Any values that do not fit are inserted individually after the merge.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool is_sorted)
+    {
+      const size_t index = refset_t::size();
+
+      while ((first != last) && !refset_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refset_t::append(*pvalue);
+      }
+
+      if (!is_sorted)
+      {
+        refset_t::sort_from(index);
+      }
+
+      refset_t::merge_from(index, element_releaser(*this));
+
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Destroys a value and returns it to the storage.
+    //*********************************************************************
+    void release_element(value_type& value)
+    {
+      value.~value_type();
+      storage.release(etl::addressof(value));
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
     // Disable copy construction.
     iflat_set(const iflat_set&);
 
@@ -825,6 +1064,22 @@ namespace etl
     return !(lhs == rhs);
   }
 
+  //***************************************************************************
+  /// Merges the values of one flat_set in to another.
+  /// Values already in the destination are ignored.
+  /// The existing values are skipped by galloping, and only the overlapping
+  /// part of the two sets is merged.
+  /// If asserts or exceptions are enabled, emits flat_set_full if the destination does not have enough free space.
+  ///\param destination The flat_set to merge in to.
+  ///\param source      The flat_set to merge from.
+  ///\ingroup flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  void merge_into(etl::iflat_set<T, TKeyCompare>& destination, const etl::iflat_set<T, TKeyCompare>& source)
+  {
+    destination.insert_sorted_unique(source.begin(), source.end());
+  }
+
   //***************************************************************************
   /// A flat_set implementation that uses a fixed size buffer.
   ///\tparam T        The value type.
@@ -853,7 +1108,7 @@ namespace etl
     flat_set(const flat_set& other)
       : etl::iflat_set<T, TCompare>(lookup, storage)
     {
-      this->assign(other.cbegin(), other.cend());
+      this->assign_sorted(other.cbegin(), other.cend());
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -909,7 +1164,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        this->assign(rhs.cbegin(), rhs.cend());
+        this->assign_sorted(rhs.cbegin(), rhs.cend());
       }
 
       return *this;
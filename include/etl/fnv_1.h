@@ -58,19 +58,19 @@ namespace etl
   {
     typedef uint64_t value_type;
 
-    inline uint64_t initial() const
+    ETL_CONSTEXPR uint64_t initial() const
     {
       return OFFSET_BASIS;
     }
 
-    inline uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return  hash;
     }
 
-    inline uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -90,7 +90,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1_64()
+    ETL_CONSTEXPR14 fnv_1_64()
     {
       this->reset();
     }
@@ -101,7 +101,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    fnv_1_64(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1_64(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -116,19 +116,19 @@ namespace etl
     {
     typedef uint64_t value_type;
 
-    inline uint64_t initial() const
+    ETL_CONSTEXPR uint64_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint64_t add(uint64_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint64_t add(uint64_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    inline uint64_t final(uint64_t hash) const
+    ETL_CONSTEXPR uint64_t final(uint64_t hash) const
     {
       return hash;
     }
@@ -148,7 +148,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1a_64()
+    ETL_CONSTEXPR14 fnv_1a_64()
     {
       this->reset();
     }
@@ -159,7 +159,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    fnv_1a_64(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1a_64(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -175,19 +175,19 @@ namespace etl
     {
     typedef uint32_t value_type;
 
-    inline uint32_t initial() const
+    ETL_CONSTEXPR uint32_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash *= PRIME;
       hash ^= value;
       return hash;
     }
 
-    inline uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR uint32_t final(uint32_t hash) const
     {
       return hash;
     }
@@ -207,7 +207,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1_32()
+    ETL_CONSTEXPR14 fnv_1_32()
     {
       this->reset();
     }
@@ -218,7 +218,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    fnv_1_32(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1_32(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -233,19 +233,19 @@ namespace etl
     {
     typedef uint32_t value_type;
 
-    inline uint32_t initial() const
+    ETL_CONSTEXPR uint32_t initial() const
       {
       return OFFSET_BASIS;
     }
 
-    inline uint32_t add(uint32_t hash, uint8_t value) const
+    ETL_CONSTEXPR14 uint32_t add(uint32_t hash, uint8_t value) const
     {
       hash ^= value;
       hash *= PRIME;
       return hash;
     }
 
-    inline uint32_t final(uint32_t hash) const
+    ETL_CONSTEXPR uint32_t final(uint32_t hash) const
     {
       return hash;
     }
@@ -265,7 +265,7 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    fnv_1a_32()
+    ETL_CONSTEXPR14 fnv_1a_32()
     {
       this->reset();
     }
@@ -276,7 +276,7 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    fnv_1a_32(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 fnv_1a_32(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
@@ -0,0 +1,739 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "char_traits.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "basic_format_spec.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "private/to_string_helper.h"
+
+///\defgroup format format
+/// Writes formatted text in to a bounded string, using a subset of the
+/// std::format syntax.
+/// The format string is parsed when the etl::basic_format_string is
+/// constructed. With C++20 that is always at compile time, and an invalid
+/// format string is a compile error. With C++17 it is at compile time when
+/// the format string is declared constexpr, otherwise when it is passed.
+/// Fields are written in order and are of the form {[:[[fill]align][#][0][width][.precision][type]]}
+/// where align is '<' or '>' and type is one of
+/// integral   : d b B o x X
+/// character  : c d b B o x X
+/// bool       : s d
+/// floating   : f F (the default is the shortest round trip representation)
+/// string     : s (precision is the maximum number of characters)
+/// pointer    : p
+/// '{{' and '}}' are written as '{' and '}'.
+///\ingroup string
+
+#if ETL_CPP17_SUPPORTED
+
+#if defined(__cpp_consteval) && (__cpp_consteval >= 201811L)
+  #define ETL_FORMAT_STRING_CONSTRUCTOR consteval
+#else
+  #define ETL_FORMAT_STRING_CONSTRUCTOR constexpr
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for format exceptions.
+  ///\ingroup format
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An invalid format string, or one that does not match the arguments.
+  ///\ingroup format
+  //***************************************************************************
+  class format_string_invalid : public format_exception
+  {
+  public:
+
+    format_string_invalid(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:invalid", ETL_FORMAT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// The kinds of argument that may be formatted.
+    //*************************************************************************
+    enum class category : uint_least8_t
+    {
+      None,
+      Integral,
+      Character,
+      Boolean,
+      Floating_Point,
+      String,
+      Pointer
+    };
+
+    //*************************************************************************
+    /// Classifies an argument type for a character type.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    struct category_of
+    {
+      static constexpr category value =
+        etl::is_same<T, bool>::value                                 ? category::Boolean        :
+        etl::is_same<T, TChar>::value                                ? category::Character      :
+        etl::is_integral<T>::value                                   ? category::Integral       :
+        etl::is_floating_point<T>::value                             ? category::Floating_Point :
+        etl::is_same<T, const TChar*>::value                         ? category::String         :
+        etl::is_same<T, TChar*>::value                               ? category::String         :
+        etl::is_base_of<etl::ibasic_string<TChar>, T>::value         ? category::String         :
+        etl::is_same<T, etl::basic_string_view<TChar> >::value       ? category::String         :
+        etl::is_pointer<T>::value                                    ? category::Pointer        :
+                                                                       category::None;
+    };
+
+    //*************************************************************************
+    /// Makes the format string parameter a non-deduced context, so that the
+    /// argument types are taken from the arguments alone.
+    //*************************************************************************
+    template <typename T>
+    struct identity
+    {
+      typedef T type;
+    };
+
+    //*************************************************************************
+    /// Called when a format string is invalid.
+    /// Deliberately not constexpr, so that an invalid format string parsed at
+    /// compile time is a compile error.
+    //*************************************************************************
+    inline void format_string_is_invalid()
+    {
+      ETL_ALWAYS_ASSERT(ETL_ERROR(etl::format_string_invalid));
+    }
+
+    //*************************************************************************
+    /// A replacement field, as parsed from the format string.
+    //*************************************************************************
+    template <typename TChar>
+    struct field
+    {
+      TChar         fill          = TChar(' ');
+      TChar         align         = TChar(0);
+      TChar         type          = TChar(0);
+      uint_least8_t width         = 0U;
+      uint_least8_t precision     = 0U;
+      bool          has_precision = false;
+      bool          show_base     = false;
+      bool          zero_pad      = false;
+    };
+
+    //*************************************************************************
+    /// A run of literal text between fields.
+    //*************************************************************************
+    struct segment
+    {
+      size_t begin   = 0U;
+      size_t length  = 0U;
+      bool   escaped = false;
+    };
+  }
+
+  //***************************************************************************
+  /// A format string, parsed in to literal segments and replacement fields
+  /// for the argument types TArgs.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename TChar, typename... TArgs>
+  class basic_format_string
+  {
+  public:
+
+    typedef TChar value_type;
+
+    static constexpr size_t Number_Of_Fields = sizeof...(TArgs);
+
+    static_assert(((private_format::category_of<TChar, TArgs>::value != private_format::category::None) && ...),
+                  "etl::format: unsupported argument type");
+
+    //*************************************************************************
+    /// Parses the format string literal.
+    //*************************************************************************
+    template <size_t Size>
+    ETL_FORMAT_STRING_CONSTRUCTOR basic_format_string(const TChar (&text)[Size])
+      : text_(text)
+      , length_(Size - 1U)
+    {
+      parse();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the format string was parsed without error.
+    //*************************************************************************
+    constexpr bool valid() const
+    {
+      return valid_;
+    }
+
+    //*************************************************************************
+    /// Writes the literal segment that follows field 'index' - 1.
+    //*************************************************************************
+    void write_segment(etl::ibasic_string<TChar>& str, size_t index) const
+    {
+      const private_format::segment& s = segments_[index];
+      const TChar* p    = text_ + s.begin;
+      const TChar* pend = p + s.length;
+
+      if (!s.escaped)
+      {
+        str.append(p, pend);
+      }
+      else
+      {
+        // Doubled braces are written once.
+        while (p != pend)
+        {
+          str.push_back(*p);
+          p += ((*p == TChar('{')) || (*p == TChar('}'))) ? 2 : 1;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets field 'index'.
+    //*************************************************************************
+    constexpr const private_format::field<TChar>& get_field(size_t index) const
+    {
+      return fields_[index];
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the character at index i, or 0 past the end.
+    //*************************************************************************
+    constexpr TChar at(size_t i) const
+    {
+      return (i < length_) ? text_[i] : TChar(0);
+    }
+
+    //*************************************************************************
+    /// Splits the text in to segments and fields.
+    //*************************************************************************
+    constexpr void parse()
+    {
+      constexpr private_format::category categories[] = { private_format::category_of<TChar, TArgs>::value..., private_format::category::None };
+
+      size_t i       = 0U;
+      size_t start   = 0U;
+      size_t n       = 0U;
+      bool   escaped = false;
+
+      while (i < length_)
+      {
+        const TChar c = text_[i];
+
+        if ((c == TChar('{')) && (at(i + 1U) == TChar('{')))
+        {
+          escaped = true;
+          i += 2U;
+        }
+        else if ((c == TChar('}')) && (at(i + 1U) == TChar('}')))
+        {
+          escaped = true;
+          i += 2U;
+        }
+        else if (c == TChar('{'))
+        {
+          if (n == Number_Of_Fields)
+          {
+            // More fields than arguments.
+            private_format::format_string_is_invalid();
+            return;
+          }
+
+          segments_[n].begin   = start;
+          segments_[n].length  = i - start;
+          segments_[n].escaped = escaped;
+
+          if (!parse_field(i, fields_[n], categories[n]))
+          {
+            private_format::format_string_is_invalid();
+            return;
+          }
+
+          ++n;
+          start   = i;
+          escaped = false;
+        }
+        else if (c == TChar('}'))
+        {
+          // An unmatched closing brace.
+          private_format::format_string_is_invalid();
+          return;
+        }
+        else
+        {
+          ++i;
+        }
+      }
+
+      if (n != Number_Of_Fields)
+      {
+        // Fewer fields than arguments.
+        private_format::format_string_is_invalid();
+        return;
+      }
+
+      segments_[n].begin   = start;
+      segments_[n].length  = length_ - start;
+      segments_[n].escaped = escaped;
+
+      valid_ = true;
+    }
+
+    //*************************************************************************
+    /// Parses the field starting at the '{' at index i.
+    /// On return i is the index after the closing '}'.
+    //*************************************************************************
+    constexpr bool parse_field(size_t& i, private_format::field<TChar>& f, private_format::category cat) const
+    {
+      ++i;
+
+      if (at(i) == TChar(':'))
+      {
+        ++i;
+
+        // Fill and alignment.
+        if (is_align(at(i + 1U)) && (at(i) != TChar('{')) && (at(i) != TChar('}')))
+        {
+          f.fill  = at(i);
+          f.align = at(i + 1U);
+          i += 2U;
+        }
+        else if (is_align(at(i)))
+        {
+          f.align = at(i);
+          ++i;
+        }
+
+        if (at(i) == TChar('#'))
+        {
+          f.show_base = true;
+          ++i;
+        }
+
+        if (at(i) == TChar('0'))
+        {
+          f.zero_pad = true;
+          ++i;
+        }
+
+        if (!parse_number(i, f.width))
+        {
+          return false;
+        }
+
+        if (at(i) == TChar('.'))
+        {
+          ++i;
+
+          if (!is_digit(at(i)) || !parse_number(i, f.precision))
+          {
+            return false;
+          }
+
+          f.has_precision = true;
+        }
+
+        if ((at(i) != TChar('}')) && (at(i) != TChar(0)))
+        {
+          f.type = at(i);
+          ++i;
+        }
+      }
+
+      if (at(i) != TChar('}'))
+      {
+        return false;
+      }
+
+      ++i;
+
+      return is_valid_for(f, cat);
+    }
+
+    //*************************************************************************
+    /// Parses an optional decimal number of up to 255.
+    //*************************************************************************
+    constexpr bool parse_number(size_t& i, uint_least8_t& value) const
+    {
+      uint32_t number = 0U;
+
+      while (is_digit(at(i)))
+      {
+        number = (number * 10U) + uint32_t(at(i) - TChar('0'));
+
+        if (number > 255U)
+        {
+          return false;
+        }
+
+        ++i;
+      }
+
+      value = uint_least8_t(number);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks that the field's options apply to the argument's category.
+    //*************************************************************************
+    static constexpr bool is_valid_for(const private_format::field<TChar>& f, private_format::category cat)
+    {
+      const TChar t = f.type;
+
+      switch (cat)
+      {
+        case private_format::category::Integral:
+        {
+          return !f.has_precision && (is_integral_type(t) || (t == TChar(0)));
+        }
+
+        case private_format::category::Character:
+        {
+          return !f.has_precision && (is_integral_type(t) || (t == TChar(0)) || (t == TChar('c')));
+        }
+
+        case private_format::category::Boolean:
+        {
+          return !f.has_precision && !f.show_base && ((t == TChar(0)) || (t == TChar('s')) || (t == TChar('d')));
+        }
+
+        case private_format::category::Floating_Point:
+        {
+          return !f.show_base && ((t == TChar(0)) || (t == TChar('f')) || (t == TChar('F')));
+        }
+
+        case private_format::category::String:
+        {
+          return !f.show_base && !f.zero_pad && ((t == TChar(0)) || (t == TChar('s')));
+        }
+
+        case private_format::category::Pointer:
+        {
+          return !f.has_precision && !f.show_base && ((t == TChar(0)) || (t == TChar('p')));
+        }
+
+        default:
+        {
+          return false;
+        }
+      }
+    }
+
+    //*************************************************************************
+    static constexpr bool is_integral_type(TChar t)
+    {
+      return (t == TChar('d')) || (t == TChar('b')) || (t == TChar('B')) ||
+             (t == TChar('o')) || (t == TChar('x')) || (t == TChar('X'));
+    }
+
+    //*************************************************************************
+    static constexpr bool is_align(TChar c)
+    {
+      return (c == TChar('<')) || (c == TChar('>'));
+    }
+
+    //*************************************************************************
+    static constexpr bool is_digit(TChar c)
+    {
+      return (c >= TChar('0')) && (c <= TChar('9'));
+    }
+
+    const TChar*                  text_;
+    size_t                        length_;
+    private_format::segment       segments_[Number_Of_Fields + 1U] = {};
+    private_format::field<TChar>  fields_[Number_Of_Fields + 1U] = {};
+    bool                          valid_ = false;
+  };
+
+  //***************************************************************************
+  /// Format strings for each character type.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs>
+  using format_string = etl::basic_format_string<char, TArgs...>;
+
+  template <typename... TArgs>
+  using wformat_string = etl::basic_format_string<wchar_t, TArgs...>;
+
+  template <typename... TArgs>
+  using u16format_string = etl::basic_format_string<char16_t, TArgs...>;
+
+  template <typename... TArgs>
+  using u32format_string = etl::basic_format_string<char32_t, TArgs...>;
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Builds the format spec for a field.
+    //*************************************************************************
+    template <typename TChar>
+    etl::basic_format_spec<etl::ibasic_string<TChar> > make_spec(const field<TChar>& f, bool left_by_default)
+    {
+      etl::basic_format_spec<etl::ibasic_string<TChar> > spec;
+
+      switch (f.type)
+      {
+        case TChar('b'): case TChar('B'): spec.binary(); break;
+        case TChar('o'):                  spec.octal();  break;
+        case TChar('x'): case TChar('X'): spec.hex();    break;
+        default:                                         break;
+      }
+
+      spec.upper_case((f.type == TChar('X')) || (f.type == TChar('B')) || (f.type == TChar('F')));
+      spec.show_base(f.show_base);
+      spec.width(f.width);
+      spec.fill(f.fill);
+
+      if ((f.align == TChar('<')) || ((f.align == TChar(0)) && left_by_default))
+      {
+        spec.left();
+      }
+      else
+      {
+        spec.right();
+      }
+
+      return spec;
+    }
+
+    //*************************************************************************
+    /// Pads a number written from 'start' with zeros after any sign or base prefix.
+    //*************************************************************************
+    template <typename TChar>
+    void add_zero_padding(etl::ibasic_string<TChar>& str, size_t start, uint32_t width)
+    {
+      const size_t length = str.size() - start;
+
+      if (length < width)
+      {
+        size_t position = start;
+
+        if (str[position] == TChar('-'))
+        {
+          ++position;
+        }
+
+        if (((position + 1U) < str.size()) && (str[position] == TChar('0')))
+        {
+          const TChar c = str[position + 1U];
+
+          if ((c == TChar('x')) || (c == TChar('X')) || (c == TChar('b')) || (c == TChar('B')))
+          {
+            position += 2U;
+          }
+        }
+
+        // Infinity and NaN are padded with spaces.
+        const bool is_number = (position < str.size()) && (str[position] >= TChar('0')) && (str[position] <= TChar('9'));
+
+        if (is_number)
+        {
+          str.insert(str.begin() + position, width - length, TChar('0'));
+        }
+        else
+        {
+          str.insert(str.begin() + start, width - length, TChar(' '));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writes text, truncated to the field's precision.
+    //*************************************************************************
+    template <typename TChar>
+    void write_text(etl::ibasic_string<TChar>& str, const field<TChar>& f, const TChar* p, size_t length)
+    {
+      if (f.has_precision && (length > f.precision))
+      {
+        length = f.precision;
+      }
+
+      etl::private_to_string::add_string_view(etl::basic_string_view<TChar>(p, length), str, make_spec(f, true), true);
+    }
+
+    //*************************************************************************
+    /// Writes an argument according to its field.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    void write_argument(etl::ibasic_string<TChar>& str, const field<TChar>& f, const T& value)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      constexpr category cat = category_of<TChar, type>::value;
+
+      if constexpr ((cat == category::Character) || (cat == category::Boolean))
+      {
+        if ((f.type == TChar(0)) || (f.type == TChar('c')) || (f.type == TChar('s')))
+        {
+          if constexpr (cat == category::Character)
+          {
+            write_text(str, f, &value, 1U);
+          }
+          else
+          {
+            etl::basic_format_spec<etl::ibasic_string<TChar> > spec = make_spec(f, true);
+            spec.boolalpha(true);
+            etl::private_to_string::add_boolean(value, str, spec, true);
+          }
+
+          return;
+        }
+      }
+
+      if constexpr (cat == category::String)
+      {
+        if constexpr (etl::is_pointer<type>::value)
+        {
+          write_text(str, f, value, (value == ETL_NULLPTR) ? 0U : etl::strlen(value));
+        }
+        else
+        {
+          write_text(str, f, value.data(), value.size());
+        }
+      }
+      else if constexpr (cat == category::Pointer)
+      {
+        etl::basic_format_spec<etl::ibasic_string<TChar> > spec = make_spec(f, false);
+        spec.hex().show_base(true);
+
+        const size_t start = str.size();
+        etl::private_to_string::to_string(static_cast<const volatile void*>(value), str, f.zero_pad ? spec.width(0) : spec, true);
+
+        if (f.zero_pad)
+        {
+          add_zero_padding(str, start, f.width);
+        }
+      }
+      else
+      {
+        etl::basic_format_spec<etl::ibasic_string<TChar> > spec = make_spec(f, false);
+
+        if constexpr (cat == category::Floating_Point)
+        {
+          if (f.has_precision)
+          {
+            spec.precision(f.precision);
+          }
+          else if (f.type == TChar(0))
+          {
+            spec.shortest(true);
+          }
+          else
+          {
+            spec.precision(6U);
+          }
+        }
+
+        // Booleans and characters given an integral presentation.
+        typedef typename etl::conditional<(cat == category::Integral) || (cat == category::Floating_Point),
+                                          type,
+                                          typename etl::conditional<etl::is_signed<type>::value, int, unsigned int>::type>::type value_type;
+
+        const size_t start = str.size();
+
+        if (f.zero_pad)
+        {
+          spec.width(0);
+        }
+
+        etl::private_to_string::to_string(static_cast<value_type>(value), str, spec, true);
+
+        if (f.zero_pad)
+        {
+          add_zero_padding(str, start, f.width);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to the string.
+  /// The text is truncated if the string becomes full.
+  ///\param str  The string to append to.
+  ///\param fmt  The format string.
+  ///\param args The arguments, one for each field.
+  ///\return A reference to the string.
+  ///\ingroup format
+  //***************************************************************************
+  template <typename TChar, typename... TArgs>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str,
+                                       const typename private_format::identity<etl::basic_format_string<TChar, typename etl::decay<const TArgs>::type...> >::type& fmt,
+                                       const TArgs&... args)
+  {
+    if (fmt.valid())
+    {
+      fmt.write_segment(str, 0U);
+
+      size_t index = 0U;
+
+      ((private_format::write_argument(str, fmt.get_field(index), args), fmt.write_segment(str, ++index)), ...);
+
+      (void)index;
+    }
+
+    return str;
+  }
+}
+
+#undef ETL_FORMAT_STRING_CONSTRUCTOR
+
+#endif
+#endif
@@ -324,7 +324,8 @@ namespace etl
     //*************************************************************************
     bool is_trivial_list() const
     {
-      return (size() < 2);
+      // Not size(), as that has to count the nodes when the pool is shared.
+      return (start_node.next == ETL_NULLPTR) || (start_node.next->next == ETL_NULLPTR);
     }
 
     //*************************************************************************
@@ -335,6 +336,30 @@ namespace etl
       left->next = right;
     }
 
+    //*************************************************************************
+    /// Marks a node link by setting its low bit.
+    //*************************************************************************
+    static node_t* tag(node_t* p_node)
+    {
+      return reinterpret_cast<node_t*>(reinterpret_cast<uintptr_t>(p_node) | 1U);
+    }
+
+    //*************************************************************************
+    /// Removes the mark from a node link.
+    //*************************************************************************
+    static node_t* untag(node_t* p_node)
+    {
+      return reinterpret_cast<node_t*>(reinterpret_cast<uintptr_t>(p_node) & ~uintptr_t(1U));
+    }
+
+    //*************************************************************************
+    /// Is the node link marked?
+    //*************************************************************************
+    static bool is_tagged(const node_t* p_node)
+    {
+      return (reinterpret_cast<uintptr_t>(p_node) & 1U) != 0U;
+    }
+
     //*************************************************************************
     /// Set the node pool instance.
     //*************************************************************************
@@ -1156,6 +1181,93 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Rearranges the values so that iterating the forward_list walks forwards
+    /// through memory. After many inserts and erases the nodes of a list end up
+    /// scattered around the pool; this restores the locality of a freshly
+    /// filled list.
+    /// No nodes are allocated or released. The list keeps the same nodes and
+    /// the same sequence of values, but values are swapped between nodes, so
+    /// all iterators, pointers and references are invalidated.
+    /// The nodes are found by scanning the used part of the pool, so it is
+    /// O(N + pool size), and the pool must only contain forward_list nodes.
+    /// Only the nodes of this list are touched, so it may be used on lists that
+    /// share a pool. T's swap should not throw.
+    //*************************************************************************
+    void compact()
+    {
+      if (is_trivial_list())
+      {
+        return;
+      }
+
+      // Mark our nodes by setting the low bit of 'next'.
+      // Free slots and the nodes of other lists hold aligned pointers.
+      size_t count = 0U;
+      node_t* p_node = start_node.next;
+
+      while (p_node != ETL_NULLPTR)
+      {
+        node_t* p_next = p_node->next;
+        p_node->next = tag(p_next);
+        p_node = p_next;
+        ++count;
+      }
+
+      // MacLaren's in-place rearrangement.
+      // The n'th node in address order receives the n'th value in list order.
+      // A node that has been filled keeps a link in 'next' to where its old value went.
+      using ETL_OR_STD::swap; // Allow ADL
+
+      const size_t slots = p_node_pool->initialised_size();
+      size_t remaining = count;
+      p_node = start_node.next;
+
+      for (size_t i = 0U; (i < slots) && (remaining != 0U); ++i)
+      {
+        node_t* p_slot = static_cast<node_t*>(p_node_pool->item_address(i));
+
+        if (is_tagged(p_slot->next))
+        {
+          // Follow the links past the nodes that have already been filled.
+          while (reinterpret_cast<uintptr_t>(p_node) < reinterpret_cast<uintptr_t>(p_slot))
+          {
+            p_node = untag(p_node->next);
+          }
+
+          node_t* p_next = p_node->next;
+
+          if (p_node != p_slot)
+          {
+            swap(data_cast(p_node)->value, data_cast(p_slot)->value);
+            p_node->next = p_slot->next;
+            p_slot->next = tag(p_node);
+          }
+
+          p_node = untag(p_next);
+          --remaining;
+        }
+      }
+
+      // Link the nodes in address order and remove the marks.
+      node_t* p_last = &start_node;
+      remaining = count;
+
+      for (size_t i = 0U; (i < slots) && (remaining != 0U); ++i)
+      {
+        node_t* p_slot = static_cast<node_t*>(p_node_pool->item_address(i));
+
+        if (is_tagged(p_slot->next))
+        {
+          join(p_last, p_slot);
+          p_last = p_slot;
+          --remaining;
+        }
+      }
+
+      p_last->next = ETL_NULLPTR;
+    }
+
     //*************************************************************************
     /// Sort using in-place merge sort algorithm.
     /// Uses 'less-than operator as the predicate.
@@ -43,6 +43,11 @@ ETL_STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support target
 
 namespace etl
 {
+#if ETL_CPP11_SUPPORTED
+  template <size_t N>
+  class io_vector;
+#endif
+
   namespace private_frame_check_sequence
   {
     //***************************************************
@@ -89,6 +94,29 @@ namespace etl
 
       TFCS* p_fcs;
     };
+
+    //***************************************************
+    /// Detects whether a policy supplies an optimised
+    /// range add, signalled by defining 'range_add_supported'.
+    //***************************************************
+    template <typename TPolicy>
+    class has_range_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char c[2]; };
+
+      template <typename U>
+      static yes test(typename U::range_add_supported*);
+
+      template <typename U>
+      static no test(...);
+
+    public:
+
+      static const bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
   }
 
   //***************************************************************************
@@ -110,7 +138,9 @@ namespace etl
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    frame_check_sequence()
+    ETL_CONSTEXPR14 frame_check_sequence()
+      : frame_check()
+      , policy()
     {
       reset();
     }
@@ -121,7 +151,9 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    frame_check_sequence(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 frame_check_sequence(TIterator begin, const TIterator end)
+      : frame_check()
+      , policy()
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
@@ -132,7 +164,7 @@ namespace etl
     //*************************************************************************
     /// Resets the FCS to the initial state.
     //*************************************************************************
-    void reset()
+    ETL_CONSTEXPR14 void reset()
     {
       frame_check = policy.initial();
     }
@@ -143,20 +175,31 @@ namespace etl
     /// \param end
     //*************************************************************************
     template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
+      add_range(begin, end, etl::integral_constant<bool, private_frame_check_sequence::has_range_add<policy_type>::value>());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds each of the ranges in an io_vector, in order.
+    //*************************************************************************
+    template <size_t N>
+    void add(const etl::io_vector<N>& iov)
+    {
+      for (size_t i = 0U; i < iov.size(); ++i)
       {
-        frame_check = policy.add(frame_check, *begin++);
+        add(iov[i].begin(), iov[i].end());
       }
     }
+#endif
 
     //*************************************************************************
     /// \param value The uint8_t to add to the FCS.
     //*************************************************************************
-    void add(uint8_t value_)
+    ETL_CONSTEXPR14 void add(uint8_t value_)
     {
       frame_check = policy.add(frame_check, value_);
     }
@@ -164,7 +207,7 @@ namespace etl
     //*************************************************************************
     /// Gets the FCS value.
     //*************************************************************************
-    value_type value() const
+    ETL_CONSTEXPR14 value_type value() const
     {
       return policy.final(frame_check);
     }
@@ -172,7 +215,7 @@ namespace etl
     //*************************************************************************
     /// Conversion operator to value_type.
     //*************************************************************************
-    operator value_type () const
+    ETL_CONSTEXPR14 operator value_type () const
     {
       return policy.final(frame_check);
     }
@@ -187,6 +230,33 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    /// Accumulates in a local, as the member could otherwise be aliased by a
+    /// char iterator, forcing a store and reload for every value.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      value_type fcs = frame_check;
+
+      while (begin != end)
+      {
+        fcs = policy.add(fcs, *begin++);
+      }
+
+      frame_check = fcs;
+    }
+
+    //*************************************************************************
+    /// Adds a range, using the policy's optimised range add.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      frame_check = policy.add(frame_check, begin, end);
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -62,6 +62,9 @@ SOFTWARE.
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "trace.h"
 
 #include "private/minmax_push.h"
 
@@ -80,12 +83,17 @@ namespace etl
   // For internal FSM use.
   typedef typename etl::larger_type<etl::message_id_t>::type fsm_internal_id_t;
 
+#if ETL_USING_VARIADIC_MESSAGES
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_state;
+#else
   template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_,
             typename T1 = void, typename T2 = void, typename T3 = void, typename T4 = void, 
             typename T5 = void, typename T6 = void, typename T7 = void, typename T8 = void, 
             typename T9 = void, typename T10 = void, typename T11 = void, typename T12 = void, 
             typename T13 = void, typename T14 = void, typename T15 = void, typename T16 = void>
   class fsm_state;
+#endif
 
   //***************************************************************************
   /// Base exception class for FSM.
@@ -164,6 +172,32 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Exception for a full event queue.
+  //***************************************************************************
+  class fsm_event_queue_full : public etl::fsm_exception
+  {
+  public:
+
+    fsm_event_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:event queue full", ETL_FSM_FILE_ID"F"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for deferring an event with no event queue.
+  //***************************************************************************
+  class fsm_no_event_queue : public etl::fsm_exception
+  {
+  public:
+
+    fsm_no_event_queue(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:no event queue", ETL_FSM_FILE_ID"G"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Interface class for FSM states.
   //***************************************************************************
@@ -178,11 +212,15 @@ namespace etl
     /// Allows ifsm_state functions to be private.
     friend class etl::fsm;
     friend class etl::hfsm;
+#if ETL_USING_VARIADIC_MESSAGES
+    template <typename, typename, const etl::fsm_state_id_t, typename...>
+#else
     template <typename, typename, const etl::fsm_state_id_t,
               typename, typename, typename, typename, 
               typename, typename, typename, typename, 
               typename, typename, typename, typename, 
               typename, typename, typename, typename>
+#endif
     friend class etl::fsm_state;
 
     //*******************************************
@@ -201,6 +239,7 @@ namespace etl
     {
       ETL_ASSERT(state.p_parent == ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
       state.p_parent = this;
+      state.depth    = 0U;
 
       if (p_default_child == ETL_NULLPTR)
       {
@@ -236,7 +275,8 @@ namespace etl
         p_context(ETL_NULLPTR),
         p_parent(ETL_NULLPTR),
         p_active_child(ETL_NULLPTR),
-        p_default_child(ETL_NULLPTR)
+        p_default_child(ETL_NULLPTR),
+        depth(0U)
     {
     }
 
@@ -281,11 +321,246 @@ namespace etl
     // A pointer to the default active child.
     ifsm_state* p_default_child;
 
+    // The depth in the hierarchy, counting the root as 1.
+    // Zero if not recorded by hfsm::set_states(). Only used by an HFSM.
+    etl::fsm_state_id_t depth;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
   };
 
+  //***************************************************************************
+  /// Interface for FSM instrumentation hooks.
+  /// Set with fsm::set_hooks(). The hooks do nothing by default.
+  //***************************************************************************
+  class ifsm_hooks
+  {
+  public:
+
+    virtual ~ifsm_hooks()
+    {
+    }
+
+    //*******************************************
+    /// Called before the message is passed to the current state.
+    //*******************************************
+    virtual void on_receive_begin(etl::fsm_state_id_t /*state_id*/, const etl::imessage& /*message*/)
+    {
+    }
+
+    //*******************************************
+    /// Called when the message has been handled and any state changes made.
+    /// The state id is the one that received the message.
+    //*******************************************
+    virtual void on_receive_end(etl::fsm_state_id_t /*state_id*/, const etl::imessage& /*message*/)
+    {
+    }
+
+    //*******************************************
+    /// Called when the current state changes.
+    /// ifsm_state::No_State_Change stands for 'no state' when the FSM is
+    /// started or reset.
+    //*******************************************
+    virtual void on_state_change(etl::fsm_state_id_t /*from_state_id*/, etl::fsm_state_id_t /*to_state_id*/)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for an FSM event queue.
+  /// Set with fsm::set_event_queue(). Holds copies of the messages received
+  /// while the FSM is handling another, and of the messages deferred by the
+  /// states. See etl::fsm_event_queue.
+  //***************************************************************************
+  class ifsm_event_queue
+  {
+  public:
+
+    virtual ~ifsm_event_queue()
+    {
+    }
+
+    //*******************************************
+    /// Copies the message to the back of the queue.
+    /// Returns false if the queue is full.
+    //*******************************************
+    virtual bool push(const etl::imessage& message) = 0;
+
+    //*******************************************
+    /// Removes the message at the front of the queue and returns it.
+    /// The message stays valid until the next call to take() or
+    /// take_deferred().
+    //*******************************************
+    virtual const etl::imessage& take() = 0;
+
+    //*******************************************
+    /// Is the queue empty?
+    //*******************************************
+    virtual bool empty() const = 0;
+
+    //*******************************************
+    /// Copies the message to the back of the deferred messages.
+    /// Returns false if the deferred messages are full.
+    //*******************************************
+    virtual bool defer(const etl::imessage& message) = 0;
+
+    //*******************************************
+    /// Removes the oldest deferred message and returns it.
+    /// The message stays valid until the next call to take() or
+    /// take_deferred().
+    //*******************************************
+    virtual const etl::imessage& take_deferred() = 0;
+
+    //*******************************************
+    /// The number of deferred messages.
+    //*******************************************
+    virtual size_t deferred_size() const = 0;
+
+    //*******************************************
+    /// Removes all queued and deferred messages.
+    //*******************************************
+    virtual void clear() = 0;
+  };
+
+  //***************************************************************************
+  /// FSM hooks that record, for each state, the dwell time, the time spent
+  /// handling messages and the number of times it was entered.
+  /// The clock is a user function returning an unsigned tick count, such as a
+  /// cycle counter or a free running timer. Wrap around is allowed.
+  /// The dwell time of the current state is added when it is exited.
+  ///\tparam MAX_STATES The number of state ids to record. Others are ignored.
+  ///\tparam TTick      The unsigned type returned by the clock.
+  //***************************************************************************
+  template <size_t MAX_STATES, typename TTick = uint32_t>
+  class fsm_profiler : public etl::ifsm_hooks
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TTick>::value, "TTick must be unsigned");
+
+    typedef TTick tick_type;
+    typedef tick_type (*clock_type)();
+
+    //*******************************************
+    /// The statistics for one state.
+    //*******************************************
+    struct statistics
+    {
+      uint32_t          entries;           ///< The number of times the state was entered.
+      uint32_t          messages;          ///< The number of messages received in the state.
+      tick_type         dwell_time;        ///< The total time spent in the state.
+      tick_type         handling_time;     ///< The total time spent handling messages in the state.
+      tick_type         max_handling_time; ///< The longest time spent handling one message.
+      etl::message_id_t max_message_id;    ///< The id of the message that took the longest.
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit fsm_profiler(clock_type clock_)
+      : clock(clock_)
+    {
+      clear();
+    }
+
+    //*******************************************
+    /// Gets the statistics for the state id.
+    //*******************************************
+    const statistics& get_statistics(etl::fsm_state_id_t state_id) const
+    {
+      ETL_ASSERT(size_t(state_id) < MAX_STATES, ETL_ERROR(etl::fsm_state_id_exception));
+
+      return state_statistics[state_id];
+    }
+
+    //*******************************************
+    /// The total number of state changes.
+    //*******************************************
+    uint32_t get_transitions() const
+    {
+      return transitions;
+    }
+
+    //*******************************************
+    /// Clears the statistics.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < MAX_STATES; ++i)
+      {
+        state_statistics[i].entries           = 0U;
+        state_statistics[i].messages          = 0U;
+        state_statistics[i].dwell_time        = 0U;
+        state_statistics[i].handling_time     = 0U;
+        state_statistics[i].max_handling_time = 0U;
+        state_statistics[i].max_message_id    = 0U;
+      }
+
+      transitions  = 0U;
+      receive_time = 0U;
+      enter_time   = clock();
+    }
+
+    //*******************************************
+    void on_receive_begin(etl::fsm_state_id_t, const etl::imessage&) ETL_OVERRIDE
+    {
+      receive_time = clock();
+    }
+
+    //*******************************************
+    void on_receive_end(etl::fsm_state_id_t state_id, const etl::imessage& message) ETL_OVERRIDE
+    {
+      const tick_type elapsed = tick_type(clock() - receive_time);
+
+      if (size_t(state_id) < MAX_STATES)
+      {
+        statistics& s = state_statistics[state_id];
+
+        ++s.messages;
+        s.handling_time = tick_type(s.handling_time + elapsed);
+
+        if (elapsed > s.max_handling_time)
+        {
+          s.max_handling_time = elapsed;
+          s.max_message_id    = message.get_message_id();
+        }
+      }
+    }
+
+    //*******************************************
+    void on_state_change(etl::fsm_state_id_t from_state_id, etl::fsm_state_id_t to_state_id) ETL_OVERRIDE
+    {
+      const tick_type now = clock();
+
+      if (size_t(from_state_id) < MAX_STATES)
+      {
+        statistics& s = state_statistics[from_state_id];
+        s.dwell_time = tick_type(s.dwell_time + tick_type(now - enter_time));
+      }
+
+      if (size_t(to_state_id) < MAX_STATES)
+      {
+        ++state_statistics[to_state_id].entries;
+      }
+
+      if ((from_state_id != ifsm_state::No_State_Change) && (to_state_id != ifsm_state::No_State_Change))
+      {
+        ++transitions;
+      }
+
+      enter_time = now;
+    }
+
+  private:
+
+    clock_type clock;
+    statistics state_statistics[MAX_STATES];
+    uint32_t   transitions;
+    tick_type  receive_time;
+    tick_type  enter_time;
+  };
+
   //***************************************************************************
   /// The FSM class.
   //***************************************************************************
@@ -304,6 +579,9 @@ namespace etl
       , p_state(ETL_NULLPTR)
       , state_list(ETL_NULLPTR)
       , number_of_states(0U)
+      , p_hooks(ETL_NULLPTR)
+      , p_event_queue(ETL_NULLPTR)
+      , is_processing(false)
     {
     }
 
@@ -341,6 +619,8 @@ namespace etl
         p_state = state_list[0];
         ETL_ASSERT(p_state != ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
 
+        notify_state_change(ifsm_state::No_State_Change, p_state->get_state_id());
+
         if (call_on_enter_state)
         {
           etl::fsm_state_id_t next_state_id;
@@ -354,6 +634,11 @@ namespace etl
             {
               ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
               p_state = state_list[next_state_id];
+
+              if (p_state != p_last_state)
+              {
+                notify_state_change(p_last_state->get_state_id(), next_state_id);
+              }
             }
           } while (p_last_state != p_state);
         }
@@ -362,29 +647,40 @@ namespace etl
 
     //*******************************************
     /// Top level message handler for the FSM.
+    /// With an event queue set, a message received while another is being
+    /// handled, such as one a state sends to its own FSM, is queued. The
+    /// queue is drained before the outer call returns, so each message runs
+    /// to completion and the stack does not grow.
     //*******************************************
     void receive(const etl::imessage& message) ETL_OVERRIDE
     {
-      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
-
-      if (have_changed_state(next_state_id))
+      if (p_event_queue == ETL_NULLPTR)
       {
-        ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-        etl::ifsm_state* p_next_state = state_list[next_state_id];
-
-        do
+        process_message(message);
+      }
+      else if (is_processing)
+      {
+        if (!p_event_queue->push(message))
         {
-          p_state->on_exit_state();
-          p_state = p_next_state;
+          ETL_ALWAYS_ASSERT(ETL_ERROR(etl::fsm_event_queue_full));
+        }
+      }
+      else
+      {
+        run_to_completion(message);
+      }
+    }
 
-          next_state_id = p_state->on_enter_state();
+    using imessage_router::receive_batch;
 
-          if (have_changed_state(next_state_id))
-          {
-            ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-            p_next_state = state_list[next_state_id];
-          }
-        } while (p_next_state != p_state); // Have we changed state again?
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    //*******************************************
+    void receive_batch(const etl::imessage* const* p_messages, size_t count) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        etl::fsm::receive(*p_messages[i]);
       }
     }
 
@@ -445,7 +741,82 @@ namespace etl
         p_state->on_exit_state();
       }
 
+      if (p_state != ETL_NULLPTR)
+      {
+        notify_state_change(p_state->get_state_id(), ifsm_state::No_State_Change);
+      }
+
       p_state = ETL_NULLPTR;
+
+      if (p_event_queue != ETL_NULLPTR)
+      {
+        p_event_queue->clear();
+      }
+    }
+
+    //*******************************************
+    /// Sets the event queue.
+    //*******************************************
+    void set_event_queue(etl::ifsm_event_queue& event_queue)
+    {
+      p_event_queue = &event_queue;
+    }
+
+    //*******************************************
+    /// Removes the event queue.
+    //*******************************************
+    void clear_event_queue()
+    {
+      p_event_queue = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Is an event queue set?
+    //*******************************************
+    bool has_event_queue() const
+    {
+      return p_event_queue != ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Defers the message until the next state change, as a UML deferred
+    /// event. Called from a state's event handler for a message that the
+    /// state cannot handle yet. After the state changes, the deferred
+    /// messages are received again, ahead of the queue, oldest first.
+    /// Needs an event queue.
+    //*******************************************
+    void defer_event(const etl::imessage& message)
+    {
+      ETL_ASSERT_AND_RETURN(p_event_queue != ETL_NULLPTR, ETL_ERROR(etl::fsm_no_event_queue));
+
+      if (!p_event_queue->defer(message))
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::fsm_event_queue_full));
+      }
+    }
+
+    //*******************************************
+    /// Sets the instrumentation hooks.
+    //*******************************************
+    void set_hooks(etl::ifsm_hooks& hooks)
+    {
+      p_hooks = &hooks;
+    }
+
+    //*******************************************
+    /// Removes the instrumentation hooks.
+    //*******************************************
+    void clear_hooks()
+    {
+      p_hooks = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Are instrumentation hooks set?
+    //*******************************************
+    bool has_hooks() const
+    {
+      return p_hooks != ETL_NULLPTR;
     }
 
     //********************************************
@@ -466,8 +837,107 @@ namespace etl
       return true;
     }
 
+  protected:
+
+    //*******************************************
+    /// Passes the message to the current state and makes any state changes.
+    //*******************************************
+    virtual void process_message(const etl::imessage& message)
+    {
+      const etl::fsm_state_id_t state_id = p_state->get_state_id();
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_begin(state_id, message);
+      }
+
+      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+
+      if (have_changed_state(next_state_id))
+      {
+        ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+        etl::ifsm_state* p_next_state = state_list[next_state_id];
+
+        do
+        {
+          p_state->on_exit_state();
+          notify_state_change(p_state->get_state_id(), p_next_state->get_state_id());
+          p_state = p_next_state;
+
+          next_state_id = p_state->on_enter_state();
+
+          if (have_changed_state(next_state_id))
+          {
+            ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+            p_next_state = state_list[next_state_id];
+          }
+        } while (p_next_state != p_state); // Have we changed state again?
+      }
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_end(state_id, message);
+      }
+    }
+
   private:
 
+    //*******************************************
+    /// Sets the flag for the lifetime of the object.
+    //*******************************************
+    struct processing_scope
+    {
+      processing_scope(bool& flag_)
+        : flag(flag_)
+      {
+        flag = true;
+      }
+
+      ~processing_scope()
+      {
+        flag = false;
+      }
+
+      bool& flag;
+    };
+
+    //*******************************************
+    /// Handles the message, then the messages queued while handling it.
+    /// After each state change the deferred messages are recalled first.
+    //*******************************************
+    void run_to_completion(const etl::imessage& message)
+    {
+      processing_scope scope(is_processing);
+
+      const etl::ifsm_state* p_last_state = p_state;
+      size_t recall_count = 0U;
+
+      process_message(message);
+
+      while (true)
+      {
+        if (p_state != p_last_state)
+        {
+          p_last_state = p_state;
+          recall_count = p_event_queue->deferred_size();
+        }
+
+        if (recall_count != 0U)
+        {
+          --recall_count;
+          process_message(p_event_queue->take_deferred());
+        }
+        else if (!p_event_queue->empty())
+        {
+          process_message(p_event_queue->take());
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
     //********************************************
     bool have_changed_state(etl::fsm_state_id_t next_state_id) const
     {
@@ -475,11 +945,31 @@ namespace etl
              (next_state_id != ifsm_state::No_State_Change);
     }
 
-    etl::ifsm_state*    p_state;          ///< A pointer to the current state.
-    etl::ifsm_state**   state_list;       ///< The list of added states.
-    etl::fsm_state_id_t number_of_states; ///< The number of states.
+    //********************************************
+    void notify_state_change(etl::fsm_state_id_t from_state_id, etl::fsm_state_id_t to_state_id)
+    {
+      ETL_TRACE_EVENT(etl::trace_event::Fsm_State_Change, from_state_id, to_state_id)
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_state_change(from_state_id, to_state_id);
+      }
+    }
+
+    etl::ifsm_state*       p_state;          ///< A pointer to the current state.
+    etl::ifsm_state**      state_list;       ///< The list of added states.
+    etl::fsm_state_id_t    number_of_states; ///< The number of states.
+    etl::ifsm_hooks*       p_hooks;          ///< The instrumentation hooks, if any.
+    etl::ifsm_event_queue* p_event_queue;    ///< The event queue, if any.
+    bool                   is_processing;    ///< Is the event queue being drained?
   };
+}
 
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/fsm_state_variadic.h"
+#else
+namespace etl
+{
   //***************************************************************************
   // The definition for all 16 message types.
   //***************************************************************************
@@ -538,7 +1028,7 @@ namespace etl
         case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
         case T15::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T15&>(message)); break;
         case T16::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T16&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -602,7 +1092,7 @@ namespace etl
         case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
         case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
         case T15::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T15&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -665,7 +1155,7 @@ namespace etl
         case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
         case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
         case T14::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T14&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -727,7 +1217,7 @@ namespace etl
         case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
         case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
         case T13::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T13&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -787,7 +1277,7 @@ namespace etl
         case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
         case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
         case T12::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T12&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -846,7 +1336,7 @@ namespace etl
         case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
         case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
         case T11::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T11&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -904,7 +1394,7 @@ namespace etl
         case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
         case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
         case T10::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T10&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -961,7 +1451,7 @@ namespace etl
         case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
         case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
         case T9::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T9&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1016,7 +1506,7 @@ namespace etl
         case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
         case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
         case T8::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T8&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1070,7 +1560,7 @@ namespace etl
         case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
         case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
         case T7::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T7&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1123,7 +1613,7 @@ namespace etl
         case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
         case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
         case T6::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T6&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1175,7 +1665,7 @@ namespace etl
         case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
         case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
         case T5::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T5&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1225,7 +1715,7 @@ namespace etl
         case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
         case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
         case T4::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T4&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1274,7 +1764,7 @@ namespace etl
         case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
         case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
         case T3::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T3&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1322,7 +1812,7 @@ namespace etl
       {
         case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
         case T2::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T2&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1369,7 +1859,7 @@ namespace etl
       switch (event_id)
       {
         case T1::ID: new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T1&>(message)); break;
-        default: new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
+        default: ETL_UNLIKELY new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message); break;
       }
 
       return new_state_id;
@@ -1412,6 +1902,7 @@ namespace etl
     }
   };
 }
+#endif
 
 #include "private/minmax_pop.h"
 
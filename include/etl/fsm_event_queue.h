@@ -0,0 +1,182 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_EVENT_QUEUE_INCLUDED
+#define ETL_FSM_EVENT_QUEUE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "fsm.h"
+#include "queue.h"
+#include "message_packet.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup fsm_event_queue fsm_event_queue
+/// A fixed capacity event queue for etl::fsm and etl::hfsm.
+/// Messages are copied into a message packet that can hold any of the
+/// message types the FSM sends to itself or defers.
+///\ingroup fsm
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// An FSM event queue.
+  /// \tparam TMessagePacket The message packet type, such as
+  ///                        etl::message_packet<Message1, Message2>.
+  /// \tparam VQueueSize     The number of messages that may be queued.
+  /// \tparam VDeferredSize  The number of messages that may be deferred.
+  //***************************************************************************
+  template <typename TMessagePacket, const size_t VQueueSize, const size_t VDeferredSize = VQueueSize>
+  class fsm_event_queue : public etl::ifsm_event_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VQueueSize > 0U), "Zero capacity fsm_event_queue is not valid");
+    ETL_STATIC_ASSERT((VDeferredSize > 0U), "Zero capacity deferred list is not valid");
+
+    typedef TMessagePacket message_packet;
+
+    static ETL_CONSTANT size_t Queue_Size    = VQueueSize;
+    static ETL_CONSTANT size_t Deferred_Size = VDeferredSize;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    fsm_event_queue()
+    {
+    }
+
+    //*******************************************
+    /// Copies the message to the back of the queue.
+    /// Returns false if the queue is full.
+    //*******************************************
+    bool push(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (queue.full())
+      {
+        return false;
+      }
+
+      queue.push(message_packet(message));
+
+      return true;
+    }
+
+    //*******************************************
+    /// Removes the message at the front of the queue and returns it.
+    /// Its place in the queue is free while it is handled.
+    //*******************************************
+    const etl::imessage& take() ETL_OVERRIDE
+    {
+      current = queue.front();
+      queue.pop();
+
+      return current.get();
+    }
+
+    //*******************************************
+    /// Is the queue empty?
+    //*******************************************
+    bool empty() const ETL_OVERRIDE
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// The number of queued messages.
+    //*******************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    /// Copies the message to the back of the deferred messages.
+    /// Returns false if the deferred messages are full.
+    //*******************************************
+    bool defer(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (deferred.full())
+      {
+        return false;
+      }
+
+      deferred.push(message_packet(message));
+
+      return true;
+    }
+
+    //*******************************************
+    /// Removes the oldest deferred message and returns it.
+    /// Its place is free while it is handled, so it may be deferred again.
+    //*******************************************
+    const etl::imessage& take_deferred() ETL_OVERRIDE
+    {
+      current = deferred.front();
+      deferred.pop();
+
+      return current.get();
+    }
+
+    //*******************************************
+    /// The number of deferred messages.
+    //*******************************************
+    size_t deferred_size() const ETL_OVERRIDE
+    {
+      return deferred.size();
+    }
+
+    //*******************************************
+    /// Removes all queued and deferred messages.
+    //*******************************************
+    void clear() ETL_OVERRIDE
+    {
+      queue.clear();
+      deferred.clear();
+    }
+
+  private:
+
+    etl::queue<message_packet, VQueueSize>    queue;
+    etl::queue<message_packet, VDeferredSize> deferred;
+    message_packet                            current;  ///< The message being handled.
+  };
+
+  template <typename TMessagePacket, const size_t VQueueSize, const size_t VDeferredSize>
+  ETL_CONSTANT size_t fsm_event_queue<TMessagePacket, VQueueSize, VDeferredSize>::Queue_Size;
+
+  template <typename TMessagePacket, const size_t VQueueSize, const size_t VDeferredSize>
+  ETL_CONSTANT size_t fsm_event_queue<TMessagePacket, VQueueSize, VDeferredSize>::Deferred_Size;
+}
+
+#endif
@@ -118,6 +118,22 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct less<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return (lhs < rhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct less_equal
@@ -130,6 +146,22 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct less_equal<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(rhs < lhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct greater
@@ -142,6 +174,22 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct greater<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return (rhs < lhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct greater_equal
@@ -154,6 +202,22 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct greater_equal<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(lhs < rhs);
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct equal_to
@@ -166,6 +230,22 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
   //***************************************************************************
   template <typename T = void>
   struct not_equal_to
@@ -178,6 +258,48 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Specialisation for void.
+  /// Compares values of any types, and is transparent to containers.
+  //***************************************************************************
+  template <>
+  struct not_equal_to<void>
+  {
+    typedef void is_transparent;
+
+    template <typename T1, typename T2>
+    ETL_CONSTEXPR bool operator()(const T1& lhs, const T2& rhs) const
+    {
+      return !(lhs == rhs);
+    }
+  };
+
+  //***************************************************************************
+  /// Determines if a comparator or hash has an 'is_transparent' type.
+  /// Containers then allow lookup with keys of other types.
+  //***************************************************************************
+  template <typename T>
+  struct comparator_is_transparent
+  {
+  private:
+
+    typedef char yes;
+    struct no { char dummy[2]; };
+
+    template <typename U>
+    static yes test(typename U::is_transparent*);
+
+    template <typename U>
+    static no test(...);
+
+  public:
+
+    static ETL_CONSTANT bool value = (sizeof(test<T>(0)) == sizeof(yes));
+  };
+
+  template <typename T>
+  ETL_CONSTANT bool comparator_is_transparent<T>::value;
+
   //***************************************************************************
 
   template <typename TArgumentType, typename TResultType>
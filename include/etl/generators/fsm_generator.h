@@ -74,6 +74,9 @@ cog.outl("//********************************************************************
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "trace.h"
 
 #include "private/minmax_push.h"
 
@@ -92,6 +95,10 @@ namespace etl
   // For internal FSM use.
   typedef typename etl::larger_type<etl::message_id_t>::type fsm_internal_id_t;
 
+#if ETL_USING_VARIADIC_MESSAGES
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_state;
+#else
   /*[[[cog
   import cog
   cog.outl("template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_,")
@@ -105,6 +112,7 @@ namespace etl
   cog.outl("class fsm_state;")
   ]]]*/
   /*[[[end]]]*/
+#endif
 
   //***************************************************************************
   /// Base exception class for FSM.
@@ -183,6 +191,32 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Exception for a full event queue.
+  //***************************************************************************
+  class fsm_event_queue_full : public etl::fsm_exception
+  {
+  public:
+
+    fsm_event_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:event queue full", ETL_FSM_FILE_ID"F"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for deferring an event with no event queue.
+  //***************************************************************************
+  class fsm_no_event_queue : public etl::fsm_exception
+  {
+  public:
+
+    fsm_no_event_queue(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:no event queue", ETL_FSM_FILE_ID"G"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Interface class for FSM states.
   //***************************************************************************
@@ -197,6 +231,9 @@ namespace etl
     /// Allows ifsm_state functions to be private.
     friend class etl::fsm;
     friend class etl::hfsm;
+#if ETL_USING_VARIADIC_MESSAGES
+    template <typename, typename, const etl::fsm_state_id_t, typename...>
+#else
     /*[[[cog
     import cog
     cog.outl("  template <typename, typename, const etl::fsm_state_id_t,")
@@ -209,6 +246,7 @@ namespace etl
     cog.outl("typename>")
     ]]]*/
     /*[[[end]]]*/
+#endif
     friend class etl::fsm_state;
 
     //*******************************************
@@ -227,6 +265,7 @@ namespace etl
     {
       ETL_ASSERT(state.p_parent == ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
       state.p_parent = this;
+      state.depth    = 0U;
 
       if (p_default_child == ETL_NULLPTR)
       {
@@ -262,7 +301,8 @@ namespace etl
         p_context(ETL_NULLPTR),
         p_parent(ETL_NULLPTR),
         p_active_child(ETL_NULLPTR),
-        p_default_child(ETL_NULLPTR)
+        p_default_child(ETL_NULLPTR),
+        depth(0U)
     {
     }
 
@@ -307,11 +347,246 @@ namespace etl
     // A pointer to the default active child.
     ifsm_state* p_default_child;
 
+    // The depth in the hierarchy, counting the root as 1.
+    // Zero if not recorded by hfsm::set_states(). Only used by an HFSM.
+    etl::fsm_state_id_t depth;
+
     // Disabled.
     ifsm_state(const ifsm_state&);
     ifsm_state& operator =(const ifsm_state&);
   };
 
+  //***************************************************************************
+  /// Interface for FSM instrumentation hooks.
+  /// Set with fsm::set_hooks(). The hooks do nothing by default.
+  //***************************************************************************
+  class ifsm_hooks
+  {
+  public:
+
+    virtual ~ifsm_hooks()
+    {
+    }
+
+    //*******************************************
+    /// Called before the message is passed to the current state.
+    //*******************************************
+    virtual void on_receive_begin(etl::fsm_state_id_t /*state_id*/, const etl::imessage& /*message*/)
+    {
+    }
+
+    //*******************************************
+    /// Called when the message has been handled and any state changes made.
+    /// The state id is the one that received the message.
+    //*******************************************
+    virtual void on_receive_end(etl::fsm_state_id_t /*state_id*/, const etl::imessage& /*message*/)
+    {
+    }
+
+    //*******************************************
+    /// Called when the current state changes.
+    /// ifsm_state::No_State_Change stands for 'no state' when the FSM is
+    /// started or reset.
+    //*******************************************
+    virtual void on_state_change(etl::fsm_state_id_t /*from_state_id*/, etl::fsm_state_id_t /*to_state_id*/)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for an FSM event queue.
+  /// Set with fsm::set_event_queue(). Holds copies of the messages received
+  /// while the FSM is handling another, and of the messages deferred by the
+  /// states. See etl::fsm_event_queue.
+  //***************************************************************************
+  class ifsm_event_queue
+  {
+  public:
+
+    virtual ~ifsm_event_queue()
+    {
+    }
+
+    //*******************************************
+    /// Copies the message to the back of the queue.
+    /// Returns false if the queue is full.
+    //*******************************************
+    virtual bool push(const etl::imessage& message) = 0;
+
+    //*******************************************
+    /// Removes the message at the front of the queue and returns it.
+    /// The message stays valid until the next call to take() or
+    /// take_deferred().
+    //*******************************************
+    virtual const etl::imessage& take() = 0;
+
+    //*******************************************
+    /// Is the queue empty?
+    //*******************************************
+    virtual bool empty() const = 0;
+
+    //*******************************************
+    /// Copies the message to the back of the deferred messages.
+    /// Returns false if the deferred messages are full.
+    //*******************************************
+    virtual bool defer(const etl::imessage& message) = 0;
+
+    //*******************************************
+    /// Removes the oldest deferred message and returns it.
+    /// The message stays valid until the next call to take() or
+    /// take_deferred().
+    //*******************************************
+    virtual const etl::imessage& take_deferred() = 0;
+
+    //*******************************************
+    /// The number of deferred messages.
+    //*******************************************
+    virtual size_t deferred_size() const = 0;
+
+    //*******************************************
+    /// Removes all queued and deferred messages.
+    //*******************************************
+    virtual void clear() = 0;
+  };
+
+  //***************************************************************************
+  /// FSM hooks that record, for each state, the dwell time, the time spent
+  /// handling messages and the number of times it was entered.
+  /// The clock is a user function returning an unsigned tick count, such as a
+  /// cycle counter or a free running timer. Wrap around is allowed.
+  /// The dwell time of the current state is added when it is exited.
+  ///\tparam MAX_STATES The number of state ids to record. Others are ignored.
+  ///\tparam TTick      The unsigned type returned by the clock.
+  //***************************************************************************
+  template <size_t MAX_STATES, typename TTick = uint32_t>
+  class fsm_profiler : public etl::ifsm_hooks
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TTick>::value, "TTick must be unsigned");
+
+    typedef TTick tick_type;
+    typedef tick_type (*clock_type)();
+
+    //*******************************************
+    /// The statistics for one state.
+    //*******************************************
+    struct statistics
+    {
+      uint32_t          entries;           ///< The number of times the state was entered.
+      uint32_t          messages;          ///< The number of messages received in the state.
+      tick_type         dwell_time;        ///< The total time spent in the state.
+      tick_type         handling_time;     ///< The total time spent handling messages in the state.
+      tick_type         max_handling_time; ///< The longest time spent handling one message.
+      etl::message_id_t max_message_id;    ///< The id of the message that took the longest.
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit fsm_profiler(clock_type clock_)
+      : clock(clock_)
+    {
+      clear();
+    }
+
+    //*******************************************
+    /// Gets the statistics for the state id.
+    //*******************************************
+    const statistics& get_statistics(etl::fsm_state_id_t state_id) const
+    {
+      ETL_ASSERT(size_t(state_id) < MAX_STATES, ETL_ERROR(etl::fsm_state_id_exception));
+
+      return state_statistics[state_id];
+    }
+
+    //*******************************************
+    /// The total number of state changes.
+    //*******************************************
+    uint32_t get_transitions() const
+    {
+      return transitions;
+    }
+
+    //*******************************************
+    /// Clears the statistics.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < MAX_STATES; ++i)
+      {
+        state_statistics[i].entries           = 0U;
+        state_statistics[i].messages          = 0U;
+        state_statistics[i].dwell_time        = 0U;
+        state_statistics[i].handling_time     = 0U;
+        state_statistics[i].max_handling_time = 0U;
+        state_statistics[i].max_message_id    = 0U;
+      }
+
+      transitions  = 0U;
+      receive_time = 0U;
+      enter_time   = clock();
+    }
+
+    //*******************************************
+    void on_receive_begin(etl::fsm_state_id_t, const etl::imessage&) ETL_OVERRIDE
+    {
+      receive_time = clock();
+    }
+
+    //*******************************************
+    void on_receive_end(etl::fsm_state_id_t state_id, const etl::imessage& message) ETL_OVERRIDE
+    {
+      const tick_type elapsed = tick_type(clock() - receive_time);
+
+      if (size_t(state_id) < MAX_STATES)
+      {
+        statistics& s = state_statistics[state_id];
+
+        ++s.messages;
+        s.handling_time = tick_type(s.handling_time + elapsed);
+
+        if (elapsed > s.max_handling_time)
+        {
+          s.max_handling_time = elapsed;
+          s.max_message_id    = message.get_message_id();
+        }
+      }
+    }
+
+    //*******************************************
+    void on_state_change(etl::fsm_state_id_t from_state_id, etl::fsm_state_id_t to_state_id) ETL_OVERRIDE
+    {
+      const tick_type now = clock();
+
+      if (size_t(from_state_id) < MAX_STATES)
+      {
+        statistics& s = state_statistics[from_state_id];
+        s.dwell_time = tick_type(s.dwell_time + tick_type(now - enter_time));
+      }
+
+      if (size_t(to_state_id) < MAX_STATES)
+      {
+        ++state_statistics[to_state_id].entries;
+      }
+
+      if ((from_state_id != ifsm_state::No_State_Change) && (to_state_id != ifsm_state::No_State_Change))
+      {
+        ++transitions;
+      }
+
+      enter_time = now;
+    }
+
+  private:
+
+    clock_type clock;
+    statistics state_statistics[MAX_STATES];
+    uint32_t   transitions;
+    tick_type  receive_time;
+    tick_type  enter_time;
+  };
+
   //***************************************************************************
   /// The FSM class.
   //***************************************************************************
@@ -330,6 +605,9 @@ namespace etl
       , p_state(ETL_NULLPTR)
       , state_list(ETL_NULLPTR)
       , number_of_states(0U)
+      , p_hooks(ETL_NULLPTR)
+      , p_event_queue(ETL_NULLPTR)
+      , is_processing(false)
     {
     }
 
@@ -367,6 +645,8 @@ namespace etl
         p_state = state_list[0];
         ETL_ASSERT(p_state != ETL_NULLPTR, ETL_ERROR(etl::fsm_null_state_exception));
 
+        notify_state_change(ifsm_state::No_State_Change, p_state->get_state_id());
+
         if (call_on_enter_state)
         {
           etl::fsm_state_id_t next_state_id;
@@ -380,6 +660,11 @@ namespace etl
             {
               ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
               p_state = state_list[next_state_id];
+
+              if (p_state != p_last_state)
+              {
+                notify_state_change(p_last_state->get_state_id(), next_state_id);
+              }
             }
           } while (p_last_state != p_state);
         }
@@ -388,29 +673,40 @@ namespace etl
 
     //*******************************************
     /// Top level message handler for the FSM.
+    /// With an event queue set, a message received while another is being
+    /// handled, such as one a state sends to its own FSM, is queued. The
+    /// queue is drained before the outer call returns, so each message runs
+    /// to completion and the stack does not grow.
     //*******************************************
     void receive(const etl::imessage& message) ETL_OVERRIDE
     {
-      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
-
-      if (have_changed_state(next_state_id))
+      if (p_event_queue == ETL_NULLPTR)
       {
-        ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-        etl::ifsm_state* p_next_state = state_list[next_state_id];
-
-        do
+        process_message(message);
+      }
+      else if (is_processing)
+      {
+        if (!p_event_queue->push(message))
         {
-          p_state->on_exit_state();
-          p_state = p_next_state;
+          ETL_ALWAYS_ASSERT(ETL_ERROR(etl::fsm_event_queue_full));
+        }
+      }
+      else
+      {
+        run_to_completion(message);
+      }
+    }
 
-          next_state_id = p_state->on_enter_state();
+    using imessage_router::receive_batch;
 
-          if (have_changed_state(next_state_id))
-          {
-            ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
-            p_next_state = state_list[next_state_id];
-          }
-        } while (p_next_state != p_state); // Have we changed state again?
+    //*******************************************
+    /// Handles a batch of messages, in order.
+    //*******************************************
+    void receive_batch(const etl::imessage* const* p_messages, size_t count) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        etl::fsm::receive(*p_messages[i]);
       }
     }
 
@@ -471,7 +767,82 @@ namespace etl
         p_state->on_exit_state();
       }
 
+      if (p_state != ETL_NULLPTR)
+      {
+        notify_state_change(p_state->get_state_id(), ifsm_state::No_State_Change);
+      }
+
       p_state = ETL_NULLPTR;
+
+      if (p_event_queue != ETL_NULLPTR)
+      {
+        p_event_queue->clear();
+      }
+    }
+
+    //*******************************************
+    /// Sets the event queue.
+    //*******************************************
+    void set_event_queue(etl::ifsm_event_queue& event_queue)
+    {
+      p_event_queue = &event_queue;
+    }
+
+    //*******************************************
+    /// Removes the event queue.
+    //*******************************************
+    void clear_event_queue()
+    {
+      p_event_queue = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Is an event queue set?
+    //*******************************************
+    bool has_event_queue() const
+    {
+      return p_event_queue != ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Defers the message until the next state change, as a UML deferred
+    /// event. Called from a state's event handler for a message that the
+    /// state cannot handle yet. After the state changes, the deferred
+    /// messages are received again, ahead of the queue, oldest first.
+    /// Needs an event queue.
+    //*******************************************
+    void defer_event(const etl::imessage& message)
+    {
+      ETL_ASSERT_AND_RETURN(p_event_queue != ETL_NULLPTR, ETL_ERROR(etl::fsm_no_event_queue));
+
+      if (!p_event_queue->defer(message))
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::fsm_event_queue_full));
+      }
+    }
+
+    //*******************************************
+    /// Sets the instrumentation hooks.
+    //*******************************************
+    void set_hooks(etl::ifsm_hooks& hooks)
+    {
+      p_hooks = &hooks;
+    }
+
+    //*******************************************
+    /// Removes the instrumentation hooks.
+    //*******************************************
+    void clear_hooks()
+    {
+      p_hooks = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Are instrumentation hooks set?
+    //*******************************************
+    bool has_hooks() const
+    {
+      return p_hooks != ETL_NULLPTR;
     }
 
     //********************************************
@@ -492,8 +863,107 @@ namespace etl
       return true;
     }
 
+  protected:
+
+    //*******************************************
+    /// Passes the message to the current state and makes any state changes.
+    //*******************************************
+    virtual void process_message(const etl::imessage& message)
+    {
+      const etl::fsm_state_id_t state_id = p_state->get_state_id();
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_begin(state_id, message);
+      }
+
+      etl::fsm_state_id_t next_state_id = p_state->process_event(message);
+
+      if (have_changed_state(next_state_id))
+      {
+        ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+        etl::ifsm_state* p_next_state = state_list[next_state_id];
+
+        do
+        {
+          p_state->on_exit_state();
+          notify_state_change(p_state->get_state_id(), p_next_state->get_state_id());
+          p_state = p_next_state;
+
+          next_state_id = p_state->on_enter_state();
+
+          if (have_changed_state(next_state_id))
+          {
+            ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
+            p_next_state = state_list[next_state_id];
+          }
+        } while (p_next_state != p_state); // Have we changed state again?
+      }
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_end(state_id, message);
+      }
+    }
+
   private:
 
+    //*******************************************
+    /// Sets the flag for the lifetime of the object.
+    //*******************************************
+    struct processing_scope
+    {
+      processing_scope(bool& flag_)
+        : flag(flag_)
+      {
+        flag = true;
+      }
+
+      ~processing_scope()
+      {
+        flag = false;
+      }
+
+      bool& flag;
+    };
+
+    //*******************************************
+    /// Handles the message, then the messages queued while handling it.
+    /// After each state change the deferred messages are recalled first.
+    //*******************************************
+    void run_to_completion(const etl::imessage& message)
+    {
+      processing_scope scope(is_processing);
+
+      const etl::ifsm_state* p_last_state = p_state;
+      size_t recall_count = 0U;
+
+      process_message(message);
+
+      while (true)
+      {
+        if (p_state != p_last_state)
+        {
+          p_last_state = p_state;
+          recall_count = p_event_queue->deferred_size();
+        }
+
+        if (recall_count != 0U)
+        {
+          --recall_count;
+          process_message(p_event_queue->take_deferred());
+        }
+        else if (!p_event_queue->empty())
+        {
+          process_message(p_event_queue->take());
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
     //********************************************
     bool have_changed_state(etl::fsm_state_id_t next_state_id) const
     {
@@ -501,11 +971,31 @@ namespace etl
              (next_state_id != ifsm_state::No_State_Change);
     }
 
-    etl::ifsm_state*    p_state;          ///< A pointer to the current state.
-    etl::ifsm_state**   state_list;       ///< The list of added states.
-    etl::fsm_state_id_t number_of_states; ///< The number of states.
+    //********************************************
+    void notify_state_change(etl::fsm_state_id_t from_state_id, etl::fsm_state_id_t to_state_id)
+    {
+      ETL_TRACE_EVENT(etl::trace_event::Fsm_State_Change, from_state_id, to_state_id)
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_state_change(from_state_id, to_state_id);
+      }
+    }
+
+    etl::ifsm_state*       p_state;          ///< A pointer to the current state.
+    etl::ifsm_state**      state_list;       ///< The list of added states.
+    etl::fsm_state_id_t    number_of_states; ///< The number of states.
+    etl::ifsm_hooks*       p_hooks;          ///< The instrumentation hooks, if any.
+    etl::ifsm_event_queue* p_event_queue;    ///< The event queue, if any.
+    bool                   is_processing;    ///< Is the event queue being drained?
   };
+}
 
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/fsm_state_variadic.h"
+#else
+namespace etl
+{
   /*[[[cog
   import cog
   ################################################
@@ -560,7 +1050,7 @@ namespace etl
       cog.out("      case T%d::ID:" % n)
       cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T%d&>(message));" % n)
       cog.outl(" break;")
-  cog.out("      default:")
+  cog.out("      default: ETL_UNLIKELY")
   cog.out(" new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);")
   cog.outl(" break;")
   cog.outl("    }")
@@ -637,7 +1127,7 @@ namespace etl
           cog.out("      case T%d::ID:" % n)
           cog.out(" new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const T%d&>(message));" % n)
           cog.outl(" break;")
-      cog.out("      default:")
+      cog.out("      default: ETL_UNLIKELY")
       cog.out(" new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);")
       cog.outl(" break;")
       cog.outl("    }")
@@ -693,6 +1183,7 @@ namespace etl
   ]]]*/
   /*[[[end]]]*/
 }
+#endif
 
 #include "private/minmax_pop.h"
 
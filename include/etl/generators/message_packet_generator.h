@@ -69,9 +69,13 @@ cog.outl("//********************************************************************
 #include "largest.h"
 #include "alignment.h"
 #include "utility.h"
+#include "placement_new.h"
 
 #include <stdint.h>
 
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/message_packet_variadic.h"
+#else
 namespace etl
 {
   /*[[[cog
@@ -116,6 +120,36 @@ namespace etl
     cog.outl("  }")
     cog.outl("#endif")
     cog.outl("")
+    cog.outl("#if ETL_CPP11_SUPPORTED")
+    cog.outl("  //********************************************")
+    cog.outl("  /// Constructs from one of the message types, without the switch on the id.")
+    cog.outl("  //********************************************")
+    cog.out("  template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value, int>::type>" % int(Handlers))
+    cog.outl("  explicit message_packet(TMessage&& msg)")
+    cog.outl("    : valid(true)")
+    cog.outl("  {")
+    cog.outl("    void* p = data;")
+    cog.outl("    ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));")
+    cog.outl("  }")
+    cog.outl("#else")
+    cog.outl("  //********************************************")
+    cog.outl("  /// Constructs from one of the message types, without the switch on the id.")
+    cog.outl("  //********************************************")
+    cog.outl("  template <typename TMessage>")
+    cog.out("  explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value, int>::type = 0)" % int(Handlers))
+    cog.outl("    : valid(true)")
+    cog.outl("  {")
+    cog.outl("    void* p = data;")
+    cog.outl("    ::new (p) TMessage(msg);")
+    cog.outl("  }")
+    cog.outl("#endif")
+    cog.outl("")
     cog.outl("  //**********************************************")
     cog.outl("  message_packet(const message_packet& other)")
     cog.outl("    : valid(other.is_valid())")
@@ -166,6 +200,143 @@ namespace etl
     cog.outl("  }")
     cog.outl("#endif")
     cog.outl("")
+    cog.outl("#if ETL_CPP11_SUPPORTED")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Replaces the message with one of the message types, without the switch on the id.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage>")
+    cog.out("  typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value, message_packet&>::type" % int(Handlers))
+    cog.outl("    operator =(TMessage&& msg)")
+    cog.outl("  {")
+    cog.outl("    emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));")
+    cog.outl("")
+    cog.outl("    return *this;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage, typename... TArgs>")
+    cog.outl("  TMessage& emplace(TArgs&&... args)")
+    cog.outl("  {")
+    cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % int(Handlers))
+    cog.outl("")
+    cog.outl("    delete_current_message();")
+    cog.outl("    valid = false;")
+    cog.outl("")
+    cog.outl("    void* p = data;")
+    cog.outl("    TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);")
+    cog.outl("    valid = true;")
+    cog.outl("")
+    cog.outl("    return *pmsg;")
+    cog.outl("  }")
+    cog.outl("#else")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Replaces the message with one of the message types, without the switch on the id.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage>")
+    cog.out("  typename etl::enable_if<etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value, message_packet&>::type" % int(Handlers))
+    cog.outl("    operator =(const TMessage& msg)")
+    cog.outl("  {")
+    cog.outl("    emplace<TMessage>(msg);")
+    cog.outl("")
+    cog.outl("    return *this;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage>")
+    cog.outl("  TMessage& emplace()")
+    cog.outl("  {")
+    cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % int(Handlers))
+    cog.outl("")
+    cog.outl("    delete_current_message();")
+    cog.outl("    valid = false;")
+    cog.outl("")
+    cog.outl("    void* p = data;")
+    cog.outl("    TMessage* pmsg = ::new (p) TMessage();")
+    cog.outl("    valid = true;")
+    cog.outl("")
+    cog.outl("    return *pmsg;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage, typename TArg1>")
+    cog.outl("  TMessage& emplace(const TArg1& arg1)")
+    cog.outl("  {")
+    cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % int(Handlers))
+    cog.outl("")
+    cog.outl("    delete_current_message();")
+    cog.outl("    valid = false;")
+    cog.outl("")
+    cog.outl("    void* p = data;")
+    cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1);")
+    cog.outl("    valid = true;")
+    cog.outl("")
+    cog.outl("    return *pmsg;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage, typename TArg1, typename TArg2>")
+    cog.outl("  TMessage& emplace(const TArg1& arg1, const TArg2& arg2)")
+    cog.outl("  {")
+    cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % int(Handlers))
+    cog.outl("")
+    cog.outl("    delete_current_message();")
+    cog.outl("    valid = false;")
+    cog.outl("")
+    cog.outl("    void* p = data;")
+    cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1, arg2);")
+    cog.outl("    valid = true;")
+    cog.outl("")
+    cog.outl("    return *pmsg;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+    cog.outl("  //**********************************************")
+    cog.outl("  template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>")
+    cog.outl("  TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)")
+    cog.outl("  {")
+    cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+    for n in range(1, int(Handlers)):
+        cog.out("T%d, " % n)
+    cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % int(Handlers))
+    cog.outl("")
+    cog.outl("    delete_current_message();")
+    cog.outl("    valid = false;")
+    cog.outl("")
+    cog.outl("    void* p = data;")
+    cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);")
+    cog.outl("    valid = true;")
+    cog.outl("")
+    cog.outl("    return *pmsg;")
+    cog.outl("  }")
+    cog.outl("#endif")
+    cog.outl("")
     cog.outl("  //********************************************")
     cog.outl("  ~message_packet()")
     cog.outl("  {")
@@ -241,6 +412,22 @@ namespace etl
     cog.outl("T%s>::alignment" % int(Handlers))
     cog.outl("  };")
     cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// The size of the storage for the largest message.")
+    cog.outl("  //**********************************************")
+    cog.outl("  static ETL_CONSTEXPR size_t storage_size()")
+    cog.outl("  {")
+    cog.outl("    return SIZE;")
+    cog.outl("  }")
+    cog.outl("")
+    cog.outl("  //**********************************************")
+    cog.outl("  /// The alignment of the storage for the messages.")
+    cog.outl("  //**********************************************")
+    cog.outl("  static ETL_CONSTEXPR size_t storage_alignment()")
+    cog.outl("  {")
+    cog.outl("    return ALIGNMENT;")
+    cog.outl("  }")
+    cog.outl("")
     cog.outl("private:")
     cog.outl("")
     cog.outl("  //********************************************")
@@ -354,6 +541,36 @@ namespace etl
         cog.outl("  }")
         cog.outl("#endif")
         cog.outl("")
+        cog.outl("#if ETL_CPP11_SUPPORTED")
+        cog.outl("  //********************************************")
+        cog.outl("  /// Constructs from one of the message types, without the switch on the id.")
+        cog.outl("  //********************************************")
+        cog.out("  template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value, int>::type>" % n)
+        cog.outl("  explicit message_packet(TMessage&& msg)")
+        cog.outl("    : valid(true)")
+        cog.outl("  {")
+        cog.outl("    void* p = data;")
+        cog.outl("    ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));")
+        cog.outl("  }")
+        cog.outl("#else")
+        cog.outl("  //********************************************")
+        cog.outl("  /// Constructs from one of the message types, without the switch on the id.")
+        cog.outl("  //********************************************")
+        cog.outl("  template <typename TMessage>")
+        cog.out("  explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value, int>::type = 0)" % n)
+        cog.outl("    : valid(true)")
+        cog.outl("  {")
+        cog.outl("    void* p = data;")
+        cog.outl("    ::new (p) TMessage(msg);")
+        cog.outl("  }")
+        cog.outl("#endif")
+        cog.outl("")
         cog.outl("  //**********************************************")
         cog.outl("  message_packet(const message_packet& other)")
         cog.outl("    : valid(other.is_valid())")
@@ -404,6 +621,143 @@ namespace etl
         cog.outl("  }")
         cog.outl("#endif")
         cog.outl("")
+        cog.outl("#if ETL_CPP11_SUPPORTED")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Replaces the message with one of the message types, without the switch on the id.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage>")
+        cog.out("  typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value, message_packet&>::type" % n)
+        cog.outl("    operator =(TMessage&& msg)")
+        cog.outl("  {")
+        cog.outl("    emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));")
+        cog.outl("")
+        cog.outl("    return *this;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage, typename... TArgs>")
+        cog.outl("  TMessage& emplace(TArgs&&... args)")
+        cog.outl("  {")
+        cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % n)
+        cog.outl("")
+        cog.outl("    delete_current_message();")
+        cog.outl("    valid = false;")
+        cog.outl("")
+        cog.outl("    void* p = data;")
+        cog.outl("    TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);")
+        cog.outl("    valid = true;")
+        cog.outl("")
+        cog.outl("    return *pmsg;")
+        cog.outl("  }")
+        cog.outl("#else")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Replaces the message with one of the message types, without the switch on the id.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage>")
+        cog.out("  typename etl::enable_if<etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value, message_packet&>::type" % n)
+        cog.outl("    operator =(const TMessage& msg)")
+        cog.outl("  {")
+        cog.outl("    emplace<TMessage>(msg);")
+        cog.outl("")
+        cog.outl("    return *this;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage>")
+        cog.outl("  TMessage& emplace()")
+        cog.outl("  {")
+        cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % n)
+        cog.outl("")
+        cog.outl("    delete_current_message();")
+        cog.outl("    valid = false;")
+        cog.outl("")
+        cog.outl("    void* p = data;")
+        cog.outl("    TMessage* pmsg = ::new (p) TMessage();")
+        cog.outl("    valid = true;")
+        cog.outl("")
+        cog.outl("    return *pmsg;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage, typename TArg1>")
+        cog.outl("  TMessage& emplace(const TArg1& arg1)")
+        cog.outl("  {")
+        cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % n)
+        cog.outl("")
+        cog.outl("    delete_current_message();")
+        cog.outl("    valid = false;")
+        cog.outl("")
+        cog.outl("    void* p = data;")
+        cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1);")
+        cog.outl("    valid = true;")
+        cog.outl("")
+        cog.outl("    return *pmsg;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage, typename TArg1, typename TArg2>")
+        cog.outl("  TMessage& emplace(const TArg1& arg1, const TArg2& arg2)")
+        cog.outl("  {")
+        cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % n)
+        cog.outl("")
+        cog.outl("    delete_current_message();")
+        cog.outl("    valid = false;")
+        cog.outl("")
+        cog.outl("    void* p = data;")
+        cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1, arg2);")
+        cog.outl("    valid = true;")
+        cog.outl("")
+        cog.outl("    return *pmsg;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// Constructs a message in the packet, replacing the current one.")
+        cog.outl("  //**********************************************")
+        cog.outl("  template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>")
+        cog.outl("  TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)")
+        cog.outl("  {")
+        cog.out("    ETL_STATIC_ASSERT((etl::is_one_of<TMessage, ")
+        for t in range(1, n):
+            cog.out("T%d, " % t)
+        cog.outl("T%s>::value), \"Unsupported type for this message packet\");" % n)
+        cog.outl("")
+        cog.outl("    delete_current_message();")
+        cog.outl("    valid = false;")
+        cog.outl("")
+        cog.outl("    void* p = data;")
+        cog.outl("    TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);")
+        cog.outl("    valid = true;")
+        cog.outl("")
+        cog.outl("    return *pmsg;")
+        cog.outl("  }")
+        cog.outl("#endif")
+        cog.outl("")
         cog.outl("  //********************************************")
         cog.outl("  ~message_packet()")
         cog.outl("  {")
@@ -480,6 +834,22 @@ namespace etl
         cog.outl("T%s>::alignment" % n)
         cog.outl("  };")
         cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// The size of the storage for the largest message.")
+        cog.outl("  //**********************************************")
+        cog.outl("  static ETL_CONSTEXPR size_t storage_size()")
+        cog.outl("  {")
+        cog.outl("    return SIZE;")
+        cog.outl("  }")
+        cog.outl("")
+        cog.outl("  //**********************************************")
+        cog.outl("  /// The alignment of the storage for the messages.")
+        cog.outl("  //**********************************************")
+        cog.outl("  static ETL_CONSTEXPR size_t storage_alignment()")
+        cog.outl("  {")
+        cog.outl("    return ALIGNMENT;")
+        cog.outl("  }")
+        cog.outl("")
         cog.outl("private:")
         cog.outl("")
         cog.outl("  //********************************************")
@@ -542,3 +912,5 @@ namespace etl
 }
 
 #endif
+
+#endif
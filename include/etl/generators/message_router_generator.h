@@ -77,6 +77,9 @@ cog.outl("//********************************************************************
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "integral_limits.h"
+#include "span.h"
+#include "trace.h"
 
 namespace etl
 {
@@ -151,6 +154,29 @@ namespace etl
       }
     }
 
+    //********************************************
+    /// Receives a batch of messages.
+    /// By default, each message is passed to receive() in turn.
+    /// Override to handle a burst of messages with one virtual call.
+    //********************************************
+    virtual void receive_batch(const etl::imessage* const* p_messages, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        receive(*p_messages[i]);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Receives a batch of messages.
+    //********************************************
+    void receive_batch(etl::span<const etl::imessage* const> messages)
+    {
+      receive_batch(messages.data(), messages.size());
+    }
+#endif
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -306,6 +332,131 @@ namespace etl
   {
     destination.receive(message);
   }
+}
+
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/message_router_variadic.h"
+#else
+namespace etl
+{
+  /*[[[cog
+      import cog
+      ################################################
+      # The accepted id bitmap.
+      ################################################
+      cog.outl("namespace private_message_router")
+      cog.outl("{")
+      cog.outl("  //*************************************************************************")
+      cog.outl("  /// The bit for the message's id, if it is in word 'Word' of the bitmap.")
+      cog.outl("  //*************************************************************************")
+      cog.outl("  template <typename TMessage, size_t Word>")
+      cog.outl("  struct id_bit")
+      cog.outl("  {")
+      cog.outl("    static ETL_CONSTANT uint32_t value = ((size_t(TMessage::ID) / 32U) == Word) ? (uint32_t(1U) << (size_t(TMessage::ID) % 32U)) : 0U;")
+      cog.outl("  };")
+      cog.outl("")
+      cog.outl("  template <size_t Word>")
+      cog.outl("  struct id_bit<void, Word>")
+      cog.outl("  {")
+      cog.outl("    static ETL_CONSTANT uint32_t value = 0U;")
+      cog.outl("  };")
+      cog.outl("")
+      cog.outl("  //*************************************************************************")
+      cog.outl("  /// Is the id the message's id?")
+      cog.outl("  //*************************************************************************")
+      cog.outl("  template <typename TMessage>")
+      cog.outl("  struct is_id")
+      cog.outl("  {")
+      cog.outl("    static bool test(etl::message_id_t id)")
+      cog.outl("    {")
+      cog.outl("      return id == TMessage::ID;")
+      cog.outl("    }")
+      cog.outl("  };")
+      cog.outl("")
+      cog.outl("  template <>")
+      cog.outl("  struct is_id<void>")
+      cog.outl("  {")
+      cog.outl("    static bool test(etl::message_id_t)")
+      cog.outl("    {")
+      cog.outl("      return false;")
+      cog.outl("    }")
+      cog.outl("  };")
+      cog.outl("")
+      cog.outl("  //*************************************************************************")
+      cog.outl("  /// The ids accepted by a router.")
+      cog.outl("  /// For 8 bit ids, a constant bitmap of 256 bits is tested.")
+      cog.outl("  /// For wider ids, each id is compared.")
+      cog.outl("  //*************************************************************************")
+      cog.out("  template <")
+      for n in range(1, int(Handlers)):
+          cog.out("typename T%s = void, " % n)
+          if n % 4 == 0:
+              cog.outl("")
+              cog.out("            ")
+      cog.outl("typename T%s = void>" % int(Handlers))
+      cog.outl("  struct accepted_ids")
+      cog.outl("  {")
+      cog.outl("    //***********************************")
+      cog.outl("    template <size_t Word>")
+      cog.outl("    struct word")
+      cog.outl("    {")
+      cog.out("      static ETL_CONSTANT uint32_t value = ")
+      for n in range(1, int(Handlers) + 1):
+          cog.out("id_bit<T%d, Word>::value" % n)
+          if n != int(Handlers):
+              cog.out(" | ")
+              if n % 4 == 0:
+                  cog.outl("")
+                  cog.out("                                           ")
+      cog.outl(";")
+      cog.outl("    };")
+      cog.outl("")
+      cog.outl("    //***********************************")
+      cog.outl("    static bool test(etl::message_id_t id)")
+      cog.outl("    {")
+      cog.outl("      if (etl::integral_limits<etl::message_id_t>::bits == 8U)")
+      cog.outl("      {")
+      cog.outl("        return (bitmap[size_t(id) / 32U] & (uint32_t(1U) << (size_t(id) % 32U))) != 0U;")
+      cog.outl("      }")
+      cog.outl("      else")
+      cog.outl("      {")
+      cog.out("        return ")
+      for n in range(1, int(Handlers) + 1):
+          cog.out("is_id<T%d>::test(id)" % n)
+          if n != int(Handlers):
+              cog.out(" || ")
+              if n % 4 == 0:
+                  cog.outl("")
+                  cog.out("               ")
+      cog.outl(";")
+      cog.outl("      }")
+      cog.outl("    }")
+      cog.outl("")
+      cog.outl("    static const uint32_t bitmap[8];")
+      cog.outl("  };")
+      cog.outl("")
+      cog.out("  template <")
+      for n in range(1, int(Handlers)):
+          cog.out("typename T%s, " % n)
+          if n % 4 == 0:
+              cog.outl("")
+              cog.out("            ")
+      cog.outl("typename T%s>" % int(Handlers))
+      cog.out("  const uint32_t accepted_ids<")
+      for n in range(1, int(Handlers)):
+          cog.out("T%s, " % n)
+      cog.outl("T%s>::bitmap[8] =" % int(Handlers))
+      cog.outl("  {")
+      for w in range(0, 8):
+          cog.out("    word<%d>::value" % w)
+          if w != 7:
+              cog.outl(",")
+          else:
+              cog.outl("")
+      cog.outl("  };")
+      cog.outl("}")
+  ]]]*/
+  /*[[[end]]]*/
 
   /*[[[cog
       import cog
@@ -355,6 +506,8 @@ namespace etl
       cog.outl("  {")
       cog.outl("    const etl::message_id_t id = msg.get_message_id();")
       cog.outl("")
+      cog.outl("    ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)")
+      cog.outl("")
       cog.outl("    switch (id)")
       cog.outl("    {")
       for n in range(1, int(Handlers) + 1):
@@ -381,18 +534,10 @@ namespace etl
       cog.outl("")
       cog.outl("  bool accepts(etl::message_id_t id) const ETL_OVERRIDE")
       cog.outl("  {")
-      cog.outl("    switch (id)")
-      cog.outl("    {")
-      cog.out("      ")
-      for n in range(1, int(Handlers) + 1):
-          cog.out("case T%d::ID: " % n)
-          if n % 8 == 0:
-              cog.outl("")
-              cog.out("      ")
-      cog.outl("  return true;")
-      cog.outl("      default:")
-      cog.outl("        return false;")
-      cog.outl("    }")
+      cog.out("    return private_message_router::accepted_ids<")
+      for n in range(1, int(Handlers)):
+          cog.out("T%d, " % n)
+      cog.outl("T%d>::test(id);" % int(Handlers))
       cog.outl("  }")
       cog.outl("")
       cog.outl("  //********************************************")
@@ -475,6 +620,8 @@ namespace etl
           cog.outl("  {")
           cog.outl("    const size_t id = msg.get_message_id();")
           cog.outl("")
+          cog.outl("    ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)")
+          cog.outl("")
           cog.outl("    switch (id)")
           cog.outl("    {")
           for t in range(1, n + 1):
@@ -501,19 +648,10 @@ namespace etl
           cog.outl("")
           cog.outl("  bool accepts(etl::message_id_t id) const ETL_OVERRIDE")
           cog.outl("  {")
-          cog.outl("    switch (id)")
-          cog.outl("    {")
-          cog.out("      ")
-          for t in range(1, n + 1):
-              cog.out("case T%d::ID: " % t)
-              if t % 8 == 0:
-                  cog.outl("")
-                  cog.out("      ")
-          cog.outl("")
-          cog.outl("        return true;")
-          cog.outl("      default:")
-          cog.outl("        return false;")
-          cog.outl("    }")
+          cog.out("    return private_message_router::accepted_ids<")
+          for t in range(1, n):
+              cog.out("T%d, " % t)
+          cog.outl("T%d>::test(id);" % n)
           cog.outl("  }")
           cog.outl("")
           cog.outl("  //********************************************")
@@ -537,5 +675,6 @@ namespace etl
   ]]]*/
   /*[[[end]]]*/
 }
+#endif
 
 #endif
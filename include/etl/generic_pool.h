@@ -82,6 +82,33 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate an object from the pool without checking that there is a
+    /// free item.
+    /// Undefined behaviour if the pool is empty.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate_unchecked()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_unchecked<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to n objects from the pool.
+    /// Returns the number allocated.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    size_t allocate_n(U** pp_items, size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_n<U>(pp_items, n);
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
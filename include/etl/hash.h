@@ -36,8 +36,9 @@ SOFTWARE.
 
 #include "platform.h"
 
-// The default hash calculation.
+// The default hash calculations.
 #include "fnv_1.h"
+#include "xxhash.h"
 #include "type_traits.h"
 #include "static_assert.h"
 
@@ -83,6 +84,56 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+#endif
+
+#if defined(ETL_HASH_NO_XXHASH)
+    //*************************************************************************
+    /// Hash to use for strings and byte spans.
+    /// Uses the FNV-1a based generic hash.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    size_t generic_block_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return generic_hash<T>(begin, end);
+    }
+#else
+    //*************************************************************************
+    /// Block hash to use when size_t is 16 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
+    generic_block_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint32_t h = etl::xxhash32(begin, end).value();
+
+      return static_cast<size_t>(h ^ (h >> 16));
+    }
+
+    //*************************************************************************
+    /// Block hash to use when size_t is 32 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
+    generic_block_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return etl::xxhash32(begin, end).value();
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Block hash to use when size_t is 64 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
+    generic_block_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return etl::xxhash64(begin, end).value();
+    }
+#endif
 #endif
   }
 
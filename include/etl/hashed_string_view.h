@@ -0,0 +1,506 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HASHED_STRING_VIEW_INCLUDED
+#define ETL_HASHED_STRING_VIEW_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "char_traits.h"
+#include "string_view.h"
+#include "basic_string.h"
+#include "hash.h"
+#include "functional.h"
+#include "power.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+///\defgroup hashed_string_view hashed_string_view
+/// A string view that carries its hash, and a table that interns strings.
+/// etl::hash of a hashed view returns the stored value, so unordered
+/// containers keyed on it do not rehash the text, and unequal keys are
+/// usually rejected by comparing the hashes alone.
+/// The stored hash is the same as etl::hash of the equivalent string view.
+///\ingroup string
+
+#if ETL_8BIT_SUPPORT
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for string_interner exceptions.
+  ///\ingroup hashed_string_view
+  //***************************************************************************
+  class string_interner_exception : public etl::exception
+  {
+  public:
+
+    string_interner_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The interner has no room for another string.
+  ///\ingroup hashed_string_view
+  //***************************************************************************
+  class string_interner_full : public string_interner_exception
+  {
+  public:
+
+    string_interner_full(string_type file_name_, numeric_type line_number_)
+      : string_interner_exception(ETL_ERROR_TEXT("string_interner:full", ETL_HASHED_STRING_VIEW_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A string view with a precomputed hash.
+  ///\ingroup hashed_string_view
+  //***************************************************************************
+  template <typename T>
+  class basic_hashed_string_view
+  {
+  public:
+
+    typedef T                                value_type;
+    typedef etl::basic_string_view<T>        view_type;
+    typedef size_t                           size_type;
+    typedef typename view_type::const_iterator const_iterator;
+
+    //*************************************************************************
+    /// Default constructor. An empty view.
+    //*************************************************************************
+    basic_hashed_string_view()
+      : text()
+      , hash_value(calculate_hash(view_type()))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a null terminated string.
+    //*************************************************************************
+    basic_hashed_string_view(const T* text_)
+      : text(text_)
+      , hash_value(calculate_hash(text))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and length.
+    //*************************************************************************
+    basic_hashed_string_view(const T* text_, size_type length_)
+      : text(text_, length_)
+      , hash_value(calculate_hash(text))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a string view.
+    //*************************************************************************
+    basic_hashed_string_view(const view_type& text_)
+      : text(text_)
+      , hash_value(calculate_hash(text))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a string.
+    //*************************************************************************
+    basic_hashed_string_view(const etl::ibasic_string<T>& text_)
+      : text(text_.data(), text_.size())
+      , hash_value(calculate_hash(text))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a string view and its hash, as previously calculated.
+    //*************************************************************************
+    basic_hashed_string_view(const view_type& text_, size_t hash_value_)
+      : text(text_)
+      , hash_value(hash_value_)
+    {
+    }
+
+    //*************************************************************************
+    /// The stored hash.
+    //*************************************************************************
+    size_t get_hash() const
+    {
+      return hash_value;
+    }
+
+    //*************************************************************************
+    /// The view of the text.
+    //*************************************************************************
+    const view_type& view() const
+    {
+      return text;
+    }
+
+    //*************************************************************************
+    const T* data() const
+    {
+      return text.data();
+    }
+
+    //*************************************************************************
+    size_type size() const
+    {
+      return text.size();
+    }
+
+    //*************************************************************************
+    size_type length() const
+    {
+      return text.size();
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return text.empty();
+    }
+
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return text.begin();
+    }
+
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return text.end();
+    }
+
+    //*************************************************************************
+    /// Equality. The hashes are compared before the text, and views of the
+    /// same characters are equal without comparing the text.
+    //*************************************************************************
+    friend bool operator ==(const basic_hashed_string_view& lhs, const basic_hashed_string_view& rhs)
+    {
+      return (lhs.hash_value == rhs.hash_value) &&
+             (lhs.text.size() == rhs.text.size()) &&
+             ((lhs.text.data() == rhs.text.data()) || (lhs.text == rhs.text));
+    }
+
+    //*************************************************************************
+    friend bool operator !=(const basic_hashed_string_view& lhs, const basic_hashed_string_view& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    //*************************************************************************
+    /// Lexicographical ordering of the text.
+    //*************************************************************************
+    friend bool operator <(const basic_hashed_string_view& lhs, const basic_hashed_string_view& rhs)
+    {
+      return lhs.text < rhs.text;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Hashes the text. An empty view is hashed through a valid pointer.
+    //*************************************************************************
+    static size_t calculate_hash(const view_type& text_)
+    {
+      static const T empty_text[1] = { T(0) };
+
+      return etl::hash<view_type>()(text_.empty() ? view_type(empty_text, size_t(0U)) : text_);
+    }
+
+    view_type text;
+    size_t    hash_value;
+  };
+
+  typedef etl::basic_hashed_string_view<char>     hashed_string_view;
+  typedef etl::basic_hashed_string_view<wchar_t>  hashed_wstring_view;
+  typedef etl::basic_hashed_string_view<char16_t> hashed_u16string_view;
+  typedef etl::basic_hashed_string_view<char32_t> hashed_u32string_view;
+
+  //***************************************************************************
+  /// Hash function. Returns the stored hash.
+  //***************************************************************************
+  template <typename T>
+  struct hash<etl::basic_hashed_string_view<T> >
+  {
+    size_t operator()(const etl::basic_hashed_string_view<T>& text) const
+    {
+      return text.get_hash();
+    }
+  };
+
+  //***************************************************************************
+  /// Stores one copy of each distinct string and returns hashed views of the
+  /// copies. Interning the same text again returns the same view, so interned
+  /// views may be compared by address.
+  ///\ingroup hashed_string_view
+  //***************************************************************************
+  template <typename T>
+  class ibasic_string_interner
+  {
+  public:
+
+    typedef etl::basic_hashed_string_view<T> value_type;
+    typedef etl::basic_string_view<T>        view_type;
+    typedef size_t                           size_type;
+
+    //*************************************************************************
+    /// Returns the interned copy of the text, adding it if it is new.
+    /// If asserts or exceptions are enabled, emits etl::string_interner_full
+    /// if there is no room for new text, otherwise returns an empty view.
+    //*************************************************************************
+    value_type intern(const value_type& text)
+    {
+      size_type slot = find_slot(text);
+
+      if (p_slots[slot] != 0U)
+      {
+        return p_entries[p_slots[slot] - 1U];
+      }
+
+      if ((n_entries == Max_Strings) || ((Max_Characters - n_characters) < text.size()))
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::string_interner_full));
+        return value_type();
+      }
+
+      T* p_copy = p_text + n_characters;
+      etl::copy_n(text.data(), text.size(), p_copy);
+      n_characters += text.size();
+
+      p_entries[n_entries] = value_type(view_type(p_copy, text.size()), text.get_hash());
+      ++n_entries;
+      p_slots[slot] = n_entries;
+
+      return p_entries[n_entries - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns the interned copy of the text, adding it if it is new.
+    //*************************************************************************
+    value_type intern(const view_type& text)
+    {
+      return intern(value_type(text));
+    }
+
+    //*************************************************************************
+    /// Returns the interned copy of the string, adding it if it is new.
+    //*************************************************************************
+    value_type intern(const etl::ibasic_string<T>& text)
+    {
+      return intern(value_type(text));
+    }
+
+    //*************************************************************************
+    /// Returns the interned copy of a null terminated string, adding it if it is new.
+    //*************************************************************************
+    value_type intern(const T* text)
+    {
+      return intern(value_type(text));
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the text has been interned.
+    //*************************************************************************
+    bool contains(const value_type& text) const
+    {
+      return p_slots[find_slot(text)] != 0U;
+    }
+
+    //*************************************************************************
+    /// Removes all of the strings.
+    /// Views returned previously refer to storage that will be reused.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(p_slots, Number_Of_Slots, size_type(0U));
+      n_entries    = 0U;
+      n_characters = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of strings.
+    //*************************************************************************
+    size_type size() const
+    {
+      return n_entries;
+    }
+
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Strings;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_entries == 0U;
+    }
+
+    //*************************************************************************
+    bool full() const
+    {
+      return n_entries == Max_Strings;
+    }
+
+    //*************************************************************************
+    /// The number of characters stored.
+    //*************************************************************************
+    size_type characters() const
+    {
+      return n_characters;
+    }
+
+    //*************************************************************************
+    size_type max_characters() const
+    {
+      return Max_Characters;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibasic_string_interner(value_type* p_entries_, size_type max_strings_,
+                           size_type*  p_slots_,   size_type number_of_slots_,
+                           T*          p_text_,    size_type max_characters_)
+      : p_entries(p_entries_)
+      , p_slots(p_slots_)
+      , p_text(p_text_)
+      , Max_Strings(max_strings_)
+      , Number_Of_Slots(number_of_slots_)
+      , Max_Characters(max_characters_)
+      , n_entries(0U)
+      , n_characters(0U)
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the slot holding the text, or the empty slot where it would go.
+    /// The slots are an open addressed table, at most half full.
+    //*************************************************************************
+    size_type find_slot(const value_type& text) const
+    {
+      size_type slot = text.get_hash() & (Number_Of_Slots - 1U);
+
+      while ((p_slots[slot] != 0U) && (p_entries[p_slots[slot] - 1U] != text))
+      {
+        slot = (slot + 1U) & (Number_Of_Slots - 1U);
+      }
+
+      return slot;
+    }
+
+    // Disable copy construction and assignment.
+    ibasic_string_interner(const ibasic_string_interner&);
+    ibasic_string_interner& operator =(const ibasic_string_interner&);
+
+    value_type*     p_entries;
+    size_type*      p_slots;
+    T*              p_text;
+    const size_type Max_Strings;
+    const size_type Number_Of_Slots;
+    const size_type Max_Characters;
+    size_type       n_entries;
+    size_type       n_characters;
+  };
+
+  //***************************************************************************
+  /// A string interner with storage for MAX_STRINGS strings totalling
+  /// MAX_CHARACTERS characters.
+  ///\ingroup hashed_string_view
+  //***************************************************************************
+  template <typename T, const size_t MAX_STRINGS, const size_t MAX_CHARACTERS>
+  class basic_string_interner : public etl::ibasic_string_interner<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_STRINGS > 0U, "Zero capacity");
+
+    static ETL_CONSTANT size_t Number_Of_Slots = etl::power_of_2_round_up<MAX_STRINGS * 2U>::value;
+
+    //*************************************************************************
+    basic_string_interner()
+      : etl::ibasic_string_interner<T>(entries, MAX_STRINGS, slots, Number_Of_Slots, text, MAX_CHARACTERS)
+    {
+    }
+
+  private:
+
+    etl::basic_hashed_string_view<T> entries[MAX_STRINGS];
+    size_t                           slots[Number_Of_Slots];
+    T                                text[MAX_CHARACTERS == 0U ? 1U : MAX_CHARACTERS];
+  };
+
+  //***************************************************************************
+  template <const size_t MAX_STRINGS, const size_t MAX_CHARACTERS>
+  class string_interner : public etl::basic_string_interner<char, MAX_STRINGS, MAX_CHARACTERS>
+  {
+  };
+
+  //***************************************************************************
+  template <const size_t MAX_STRINGS, const size_t MAX_CHARACTERS>
+  class wstring_interner : public etl::basic_string_interner<wchar_t, MAX_STRINGS, MAX_CHARACTERS>
+  {
+  };
+
+  //***************************************************************************
+  template <const size_t MAX_STRINGS, const size_t MAX_CHARACTERS>
+  class u16string_interner : public etl::basic_string_interner<char16_t, MAX_STRINGS, MAX_CHARACTERS>
+  {
+  };
+
+  //***************************************************************************
+  template <const size_t MAX_STRINGS, const size_t MAX_CHARACTERS>
+  class u32string_interner : public etl::basic_string_interner<char32_t, MAX_STRINGS, MAX_CHARACTERS>
+  {
+  };
+
+  typedef etl::ibasic_string_interner<char>     istring_interner;
+  typedef etl::ibasic_string_interner<wchar_t>  iwstring_interner;
+  typedef etl::ibasic_string_interner<char16_t> iu16string_interner;
+  typedef etl::ibasic_string_interner<char32_t> iu32string_interner;
+}
+
+#endif
+#endif
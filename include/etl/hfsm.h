@@ -53,10 +53,46 @@ namespace etl
     using fsm::receive;
 
     //*******************************************
-    /// Top level message handler for the HFSM.
+    /// Set the states for the HFSM.
+    /// Also records the depth of each state in the hierarchy, so that
+    /// transitions do not have to find it by walking up the tree.
+    /// Only the depths recorded here are trusted. A leaf state added with
+    /// add_child_state() afterwards has its depth found from its parent's.
+    /// If a state that already has children is attached afterwards, the
+    /// recorded depths of those children are out of date, and set_states()
+    /// must be called again.
     //*******************************************
-    void receive(const etl::imessage& message) ETL_OVERRIDE
+    template <typename TSize>
+    void set_states(etl::ifsm_state** p_states, TSize size)
     {
+      fsm::set_states(p_states, size);
+
+      for (etl::fsm_state_id_t i = 0; i < number_of_states; ++i)
+      {
+        state_list[i]->depth = 0U;
+      }
+
+      for (etl::fsm_state_id_t i = 0; i < number_of_states; ++i)
+      {
+        record_depth(state_list[i]);
+      }
+    }
+
+  protected:
+
+    //*******************************************
+    /// Passes the message to the current state and makes any state changes,
+    /// exiting and entering the states along the hierarchy.
+    //*******************************************
+    void process_message(const etl::imessage& message) ETL_OVERRIDE
+    {
+      const etl::fsm_state_id_t state_id = p_state->get_state_id();
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_begin(state_id, message);
+      }
+
       etl::fsm_state_id_t next_state_id = p_state->process_event(message);
 
       if (next_state_id != ifsm_state::No_State_Change)
@@ -79,8 +115,15 @@ namespace etl
             ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
             p_state = state_list[next_state_id];
           }
+
+          notify_state_change(state_id, p_state->get_state_id());
         }
       }
+
+      if (p_hooks != ETL_NULLPTR) ETL_UNLIKELY
+      {
+        p_hooks->on_receive_end(state_id, message);
+      }
     }
 
   private:
@@ -115,18 +158,33 @@ namespace etl
 
     //*******************************************
     /// Find the depth of the state.
+    /// Uses the recorded depth, if known, otherwise that of the nearest
+    /// ancestor with one. Nothing is recorded here.
     //*******************************************
-    static size_t get_depth(etl::ifsm_state* s)
+    static size_t get_depth(const etl::ifsm_state* s)
     {
-      size_t depth = 0;
+      size_t depth = 0U;
 
-      while (s != ETL_NULLPTR)
+      while ((s != ETL_NULLPTR) && (s->depth == 0U))
       {
-        s = s->p_parent;
         ++depth;
+        s = s->p_parent;
+      }
+
+      return (s == ETL_NULLPTR) ? depth : depth + s->depth;
+    }
+
+    //*******************************************
+    /// Find and record the depth of the state and its ancestors.
+    //*******************************************
+    static size_t record_depth(etl::ifsm_state* s)
+    {
+      if (s->depth == 0U)
+      {
+        s->depth = etl::fsm_state_id_t((s->p_parent == ETL_NULLPTR) ? 1U : record_depth(s->p_parent) + 1U);
       }
 
-      return depth;
+      return s->depth;
     }
 
     //*******************************************
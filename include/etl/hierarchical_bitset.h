@@ -0,0 +1,389 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HIERARCHICAL_BITSET_INCLUDED
+#define ETL_HIERARCHICAL_BITSET_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "bitset.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+///\defgroup hierarchical_bitset hierarchical_bitset
+/// A bitset with a summary level, so that searches skip whole words.
+///\ingroup containers
+
+namespace etl
+{
+  //*************************************************************************
+  /// A bitset that keeps two summary bits for every element of bits.
+  /// One records that the element has a set bit, the other that it has a
+  /// clear bit. find_first and find_next search the summary for the next
+  /// element of interest, so a search looks at one summary word for every
+  /// BITS_PER_ELEMENT elements, rather than at every element.
+  /// The number of set bits is tracked, so count, all, any and none are O(1).
+  /// Positions must be less than size().
+  ///\tparam MAXN The number of bits.
+  ///\ingroup hierarchical_bitset
+  //*************************************************************************
+  template <const size_t MAXN>
+  class hierarchical_bitset
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAXN > 0U, "The bitset must have at least one bit");
+
+    typedef size_t element_t;
+
+    static ETL_CONSTANT size_t BITS_PER_ELEMENT = etl::integral_limits<element_t>::bits;
+    static ETL_CONSTANT size_t ELEMENTS         = (MAXN + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT;
+    static ETL_CONSTANT size_t SUMMARY_ELEMENTS = (ELEMENTS + BITS_PER_ELEMENT - 1U) / BITS_PER_ELEMENT;
+
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    hierarchical_bitset()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// The size of the bitset.
+    //*************************************************************************
+    size_t size() const
+    {
+      return MAXN;
+    }
+
+    //*************************************************************************
+    /// Count the number of bits set.
+    //*************************************************************************
+    size_t count() const
+    {
+      return n_set;
+    }
+
+    //*************************************************************************
+    /// Are all of the bits set?
+    //*************************************************************************
+    bool all() const
+    {
+      return n_set == MAXN;
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const
+    {
+      return n_set != 0U;
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const
+    {
+      return n_set == 0U;
+    }
+
+    //*************************************************************************
+    /// Tests a bit at a position.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      return (data[position / BITS_PER_ELEMENT] & bit_mask(position)) != 0U;
+    }
+
+    //*************************************************************************
+    /// Read [] operator.
+    //*************************************************************************
+    bool operator [](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// Set all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& set()
+    {
+      for (size_t i = 0U; i < ELEMENTS; ++i)
+      {
+        data[i] = full_element(i);
+      }
+
+      for (size_t i = 0U; i < SUMMARY_ELEMENTS; ++i)
+      {
+        has_set[i]   = full_summary_element(i);
+        has_clear[i] = 0U;
+      }
+
+      n_set = MAXN;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Set the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& set(size_t position, bool value = true)
+    {
+      const size_t    index = position / BITS_PER_ELEMENT;
+      const element_t mask  = bit_mask(position);
+      const element_t old   = data[index];
+
+      data[index] = value ? element_t(old | mask) : element_t(old & ~mask);
+
+      if (data[index] != old)
+      {
+        n_set = value ? (n_set + 1U) : (n_set - 1U);
+        update_summary(index);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& reset()
+    {
+      for (size_t i = 0U; i < ELEMENTS; ++i)
+      {
+        data[i] = 0U;
+      }
+
+      for (size_t i = 0U; i < SUMMARY_ELEMENTS; ++i)
+      {
+        has_set[i]   = 0U;
+        has_clear[i] = full_summary_element(i);
+      }
+
+      n_set = 0U;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Reset the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& reset(size_t position)
+    {
+      return set(position, false);
+    }
+
+    //*************************************************************************
+    /// Flip the bit at the position.
+    //*************************************************************************
+    hierarchical_bitset& flip(size_t position)
+    {
+      return set(position, !test(position));
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_first(bool state) const
+    {
+      return find_next(state, 0U);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_next(bool state, size_t position) const
+    {
+      if (position >= MAXN)
+      {
+        return npos;
+      }
+
+      // Searching for clear bits inverts the elements, so that the search is always for a set bit.
+      const element_t invert = state ? element_t(0U) : element_t(ALL_SET);
+
+      size_t index = position / BITS_PER_ELEMENT;
+
+      // Ignore the bits before the position in the first element.
+      element_t value = element_t((data[index] ^ invert) & (ALL_SET << (position % BITS_PER_ELEMENT)));
+
+      if (value == 0U)
+      {
+        index = find_next_element(state ? has_set : has_clear, index + 1U);
+
+        if (index == npos)
+        {
+          return npos;
+        }
+
+        value = element_t(data[index] ^ invert);
+      }
+
+      position = (index * BITS_PER_ELEMENT) + etl::private_bitset::lowest_bit(value);
+
+      // Clear bits above the top of the bitset are not part of it.
+      return (position < MAXN) ? position : size_t(npos);
+    }
+
+    //*************************************************************************
+    /// operator ==
+    //*************************************************************************
+    friend bool operator ==(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      return etl::equal(lhs.data, lhs.data + ELEMENTS, rhs.data);
+    }
+
+    //*************************************************************************
+    /// operator !=
+    //*************************************************************************
+    friend bool operator !=(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    static ETL_CONSTANT element_t ALL_SET = etl::integral_limits<element_t>::max;
+
+    //*************************************************************************
+    /// The mask for the bit at the position, within its element.
+    //*************************************************************************
+    static element_t bit_mask(size_t position)
+    {
+      return element_t(1U) << (position % BITS_PER_ELEMENT);
+    }
+
+    //*************************************************************************
+    /// The value of an element with all of its bits in the bitset set.
+    //*************************************************************************
+    static element_t full_element(size_t index)
+    {
+      const size_t top_bits = MAXN % BITS_PER_ELEMENT;
+
+      return ((index == (ELEMENTS - 1U)) && (top_bits != 0U)) ? element_t(~(ALL_SET << top_bits)) : element_t(ALL_SET);
+    }
+
+    //*************************************************************************
+    /// The value of a summary element with a bit for every element.
+    //*************************************************************************
+    static element_t full_summary_element(size_t index)
+    {
+      const size_t top_bits = ELEMENTS % BITS_PER_ELEMENT;
+
+      return ((index == (SUMMARY_ELEMENTS - 1U)) && (top_bits != 0U)) ? element_t(~(ALL_SET << top_bits)) : element_t(ALL_SET);
+    }
+
+    //*************************************************************************
+    /// Updates the summary bits for an element.
+    //*************************************************************************
+    void update_summary(size_t index)
+    {
+      const size_t    summary_index = index / BITS_PER_ELEMENT;
+      const element_t mask          = bit_mask(index);
+
+      if (data[index] != 0U)
+      {
+        has_set[summary_index] |= mask;
+      }
+      else
+      {
+        has_set[summary_index] &= ~mask;
+      }
+
+      if (data[index] != full_element(index))
+      {
+        has_clear[summary_index] |= mask;
+      }
+      else
+      {
+        has_clear[summary_index] &= ~mask;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the next element, from index, that has its bit set in the summary.
+    //*************************************************************************
+    static size_t find_next_element(const element_t* summary, size_t index)
+    {
+      if (index >= ELEMENTS)
+      {
+        return npos;
+      }
+
+      size_t summary_index = index / BITS_PER_ELEMENT;
+
+      element_t value = element_t(summary[summary_index] & (ALL_SET << (index % BITS_PER_ELEMENT)));
+
+      while (value == 0U)
+      {
+        if (++summary_index == SUMMARY_ELEMENTS)
+        {
+          return npos;
+        }
+
+        value = summary[summary_index];
+      }
+
+      return (summary_index * BITS_PER_ELEMENT) + etl::private_bitset::lowest_bit(value);
+    }
+
+    element_t data[ELEMENTS];
+    element_t has_set[SUMMARY_ELEMENTS];   ///< A bit for each element that has a set bit.
+    element_t has_clear[SUMMARY_ELEMENTS]; ///< A bit for each element that has a clear bit.
+    size_t    n_set;
+  };
+
+  template <const size_t MAXN>
+  ETL_CONSTANT size_t hierarchical_bitset<MAXN>::BITS_PER_ELEMENT;
+
+  template <const size_t MAXN>
+  ETL_CONSTANT size_t hierarchical_bitset<MAXN>::ELEMENTS;
+
+  template <const size_t MAXN>
+  ETL_CONSTANT size_t hierarchical_bitset<MAXN>::SUMMARY_ELEMENTS;
+
+  template <const size_t MAXN>
+  ETL_CONSTANT typename hierarchical_bitset<MAXN>::element_t hierarchical_bitset<MAXN>::ALL_SET;
+}
+
+#endif
@@ -8,11 +8,73 @@
 #include "static_assert.h"
 #include "type_traits.h"
 #include "integral_limits.h"
+#include "iterator.h"
+
+//*****************************************************************************
+// Bulk adds to histograms of up to this many bins count into partial
+// histograms on the stack, three times the size of the histogram.
+// Define as 0 to never use them.
+//*****************************************************************************
+#if !defined(ETL_HISTOGRAM_PARTIAL_BINS)
+  #define ETL_HISTOGRAM_PARTIAL_BINS 256
+#endif
 
 namespace etl
 {
   namespace private_histogram
   {
+    //***************************************************************************
+    /// Gives the bin of a key.
+    //***************************************************************************
+    template <typename TKey>
+    struct key_binner
+    {
+      explicit key_binner(TKey start_)
+        : start(start_)
+      {
+      }
+
+      template <typename TValue>
+      size_t operator ()(const TValue& value) const
+      {
+        return size_t(TKey(value) - start);
+      }
+
+      TKey start;
+    };
+
+    //***************************************************************************
+    /// Gives the bin of a value, given the lowest value and the bin width.
+    /// Values beyond the ends are counted in the end bins, as is NaN.
+    //***************************************************************************
+    template <typename T>
+    struct scaled_binner
+    {
+      scaled_binner(T minimum_, T bin_width_, size_t size_)
+        : minimum(minimum_)
+        , bin_width(bin_width_)
+        , last_bin(T(size_ - 1U))
+      {
+      }
+
+      template <typename TValue>
+      size_t operator ()(const TValue& value) const
+      {
+        T bin = (T(value) - minimum) / bin_width;
+
+        // Written as selects, with NaN failing the first.
+        bin = (bin >= T(0)) ? bin : T(0);
+        bin = (bin <= last_bin) ? bin : last_bin;
+
+        // A signed conversion is quicker than one to size_t on most targets.
+        return size_t(int32_t(bin));
+      }
+
+      T minimum;
+      T bin_width;
+      T last_bin;
+    };
+
     //***************************************************************************
     /// Base for histograms.
     //***************************************************************************
@@ -91,10 +153,99 @@ namespace etl
         return etl::accumulate(accumulator.begin(), accumulator.end(), size_t(0));
       }
 
+      //*********************************
+      /// Adds the counts of another histogram of the same size, so that
+      /// histograms filled separately, such as one per thread, can be combined.
+      //*********************************
+      void merge(const histogram_common& other)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          accumulator[i] = TCount(accumulator[i] + other.accumulator[i]);
+        }
+      }
+
     protected:
 
+      //*********************************
+      /// Counts each sample in the bin given by the binner.
+      /// Consecutive samples are counted in four interleaved histograms, so
+      /// that repeated bins do not make each increment wait for the last.
+      /// This is used when there are enough samples to repay merging the
+      /// partial histograms at the end.
+      //*********************************
+      template <typename TIterator, typename TBinner>
+      void add_bins(TIterator first, TIterator last, const TBinner& binner)
+      {
+        const size_t n = size_t(etl::distance(first, last));
+
+        if ((Max_Size <= ETL_HISTOGRAM_PARTIAL_BINS) && (n >= (4U * Max_Size)))
+        {
+          add_bins_partial(first, n, binner);
+        }
+        else
+        {
+          while (first != last)
+          {
+            ++accumulator[binner(*first)];
+            ++first;
+          }
+        }
+      }
+
       etl::array<TCount, Max_Size> accumulator;
+
+    private:
+
+      static ETL_CONSTANT size_t Partial_Size = (Max_Size <= ETL_HISTOGRAM_PARTIAL_BINS) ? Max_Size : 1U;
+
+      //*********************************
+      template <typename TIterator, typename TBinner>
+      void add_bins_partial(TIterator first, size_t n, const TBinner& binner)
+      {
+        TCount partial1[Partial_Size];
+        TCount partial2[Partial_Size];
+        TCount partial3[Partial_Size];
+
+        etl::fill_n(partial1, Partial_Size, TCount(0));
+        etl::fill_n(partial2, Partial_Size, TCount(0));
+        etl::fill_n(partial3, Partial_Size, TCount(0));
+
+        while (n >= 4U)
+        {
+          const size_t bin0 = binner(*first);
+          ++first;
+          const size_t bin1 = binner(*first);
+          ++first;
+          const size_t bin2 = binner(*first);
+          ++first;
+          const size_t bin3 = binner(*first);
+          ++first;
+
+          ++accumulator[bin0];
+          ++partial1[bin1];
+          ++partial2[bin2];
+          ++partial3[bin3];
+
+          n -= 4U;
+        }
+
+        while (n != 0U)
+        {
+          ++accumulator[binner(*first)];
+          ++first;
+          --n;
+        }
+
+        for (size_t i = 0U; i < Partial_Size; ++i)
+        {
+          accumulator[i] = TCount(accumulator[i] + partial1[i] + partial2[i] + partial3[i]);
+        }
+      }
     };
+
+    template <typename TCount, size_t Max_Size_>
+    ETL_CONSTANT size_t histogram_common<TCount, Max_Size_>::Partial_Size;
   }
 
   //***************************************************************************
@@ -186,10 +337,27 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first++);
-      }
+      this->add_bins(first, last, private_histogram::key_binner<key_type>(key_type(Start_Index)));
+    }
+
+    //*********************************
+    /// Adds a value to bin (value - minimum) / bin_width.
+    /// Values beyond the ends are counted in the end bins.
+    //*********************************
+    template <typename T>
+    void add_scaled(T value, T minimum, T bin_width)
+    {
+      ++this->accumulator[private_histogram::scaled_binner<T>(minimum, bin_width, Max_Size)(value)];
+    }
+
+    //*********************************
+    /// Adds a range of values to bins (value - minimum) / bin_width.
+    /// Values beyond the ends are counted in the end bins.
+    //*********************************
+    template <typename TIterator, typename T>
+    void add_scaled(TIterator first, TIterator last, T minimum, T bin_width)
+    {
+      this->add_bins(first, last, private_histogram::scaled_binner<T>(minimum, bin_width, Max_Size));
     }
 
     //*********************************
@@ -309,10 +477,27 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first++);
-      }
+      this->add_bins(first, last, private_histogram::key_binner<key_type>(start_index));
+    }
+
+    //*********************************
+    /// Adds a value to bin (value - minimum) / bin_width.
+    /// Values beyond the ends are counted in the end bins.
+    //*********************************
+    template <typename T>
+    void add_scaled(T value, T minimum, T bin_width)
+    {
+      ++this->accumulator[private_histogram::scaled_binner<T>(minimum, bin_width, Max_Size)(value)];
+    }
+
+    //*********************************
+    /// Adds a range of values to bins (value - minimum) / bin_width.
+    /// Values beyond the ends are counted in the end bins.
+    //*********************************
+    template <typename TIterator, typename T>
+    void add_scaled(TIterator first, TIterator last, T minimum, T bin_width)
+    {
+      this->add_bins(first, last, private_histogram::scaled_binner<T>(minimum, bin_width, Max_Size));
     }
 
     //*********************************
@@ -466,13 +651,42 @@ namespace etl
 
     //*********************************
     /// Add
+    /// Runs of equal keys are counted with one lookup.
     //*********************************
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
       while (first != last)
       {
-        add(*first++);
+        const key_type key = *first;
+        count_type     run = count_type(1);
+
+        ++first;
+
+        while ((first != last) && !(key < *first) && !(*first < key))
+        {
+          ++run;
+          ++first;
+        }
+
+        count_type& count = accumulator[key];
+        count = count_type(count + run);
+      }
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram, so that histograms filled
+    /// separately, such as one per thread, can be combined.
+    //*********************************
+    void merge(const sparse_histogram& other)
+    {
+      const_iterator itr = other.accumulator.begin();
+
+      while (itr != other.accumulator.end())
+      {
+        count_type& count = accumulator[itr->first];
+        count = count_type(count + itr->second);
+        ++itr;
       }
     }
 
@@ -0,0 +1,225 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IIR_FILTER_INCLUDED
+#define ETL_IIR_FILTER_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+
+#include "private/filter_arithmetic.h"
+
+#include <stddef.h>
+
+///\defgroup iir_filter iir_filter
+/// An infinite impulse response filter, as a cascade of biquads.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// The coefficients of one biquad section, normalised so that a0 is one.
+  /// y[n] = b0.x[n] + b1.x[n-1] + b2.x[n-2] - a1.y[n-1] - a2.y[n-2]
+  ///\ingroup iir_filter
+  //***************************************************************************
+  template <typename TCoefficient>
+  struct biquad_coefficients
+  {
+    TCoefficient b0;
+    TCoefficient b1;
+    TCoefficient b2;
+    TCoefficient a1;
+    TCoefficient a2;
+  };
+
+  //***************************************************************************
+  /// An infinite impulse response filter made of Sections biquads in series.
+  /// Each section uses direct form I, which suits fixed point as the only
+  /// state is past inputs and outputs, and the output of one section is the
+  /// input of the next, so the sections share their delays.
+  /// TValue may be a built in arithmetic type or an etl::fixed_point. For
+  /// fixed_point, TCoefficient may be a different format with more integral
+  /// bits, as biquad coefficients are often larger than one. The products
+  /// of each section are summed exactly and rounded once.
+  ///\ingroup iir_filter
+  //***************************************************************************
+  template <typename TValue, size_t Sections, typename TCoefficient = TValue>
+  class iir_filter
+  {
+    ETL_STATIC_ASSERT(Sections > 0U, "There must be at least one section");
+
+    typedef private_filter::arithmetic<TValue, TCoefficient> arithmetic_t;
+    typedef typename arithmetic_t::accumulator_type          accumulator_t;
+
+  public:
+
+    typedef TValue                                    value_type;
+    typedef TCoefficient                              coefficient_type;
+    typedef etl::biquad_coefficients<TCoefficient>    section_type;
+
+    static ETL_CONSTANT size_t Number_Of_Sections = Sections;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The coefficients are all zero.
+    //*************************************************************************
+    iir_filter()
+    {
+      const section_type zero = { TCoefficient(), TCoefficient(), TCoefficient(), TCoefficient(), TCoefficient() };
+
+      for (size_t i = 0U; i < Sections; ++i)
+      {
+        sections[i] = zero;
+      }
+
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param sections_ The coefficients of each section, the first applied first.
+    //*************************************************************************
+    explicit iir_filter(const section_type (&sections_)[Sections])
+    {
+      set_coefficients(sections_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients of each section, the first applied first.
+    /// The state is not changed.
+    //*************************************************************************
+    template <typename TIterator>
+    void set_coefficients(TIterator first)
+    {
+      for (size_t i = 0U; i < Sections; ++i)
+      {
+        sections[i] = *first;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the coefficients of a section.
+    //*************************************************************************
+    const section_type& section(size_t index) const
+    {
+      return sections[index];
+    }
+
+    //*************************************************************************
+    /// Clears the state.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i <= Sections; ++i)
+      {
+        delays[i].previous1 = TValue();
+        delays[i].previous2 = TValue();
+      }
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TValue process(TValue sample)
+    {
+      TValue x = sample;
+
+      for (size_t i = 0U; i < Sections; ++i)
+      {
+        const section_type& s      = sections[i];
+        delay&              input  = delays[i];
+        delay&              output = delays[i + 1U];
+
+        accumulator_t sum = arithmetic_t::multiply(x, s.b0);
+        sum += arithmetic_t::multiply(input.previous1,  s.b1);
+        sum += arithmetic_t::multiply(input.previous2,  s.b2);
+        sum -= arithmetic_t::multiply(output.previous1, s.a1);
+        sum -= arithmetic_t::multiply(output.previous2, s.a2);
+
+        input.previous2 = input.previous1;
+        input.previous1 = x;
+
+        x = arithmetic_t::result(sum);
+      }
+
+      delays[Sections].previous2 = delays[Sections].previous1;
+      delays[Sections].previous1 = x;
+
+      return x;
+    }
+
+    //*************************************************************************
+    /// Filters one sample.
+    //*************************************************************************
+    TValue operator ()(TValue sample)
+    {
+      return process(sample);
+    }
+
+    //*************************************************************************
+    /// Filters a block of samples.
+    /// The output may be the same as the input.
+    /// Returns the end of the output.
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator process(TInputIterator first, TInputIterator last, TOutputIterator output)
+    {
+      while (first != last)
+      {
+        *output = process(TValue(*first));
+        ++first;
+        ++output;
+      }
+
+      return output;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The last two values into a section.
+    //*************************************************************************
+    struct delay
+    {
+      TValue previous1;
+      TValue previous2;
+    };
+
+    section_type sections[Sections];    ///< The coefficients.
+    delay        delays[Sections + 1U]; ///< The input delays of each section, then the output delays of the last.
+  };
+
+  template <typename TValue, size_t Sections, typename TCoefficient>
+  ETL_CONSTANT size_t iir_filter<TValue, Sections, TCoefficient>::Number_Of_Sections;
+}
+
+#endif
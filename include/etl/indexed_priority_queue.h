@@ -0,0 +1,663 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "memory.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "debug_count.h"
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A priority queue with the capacity defined at compile time, where each
+/// value is given a handle when it is pushed. The handle may be used to change
+/// the value's priority, or to remove it, in O(logN).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for indexed_priority_queue exceptions.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public etl::exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_INDEXED_PRIORITY_QUEUE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a queued value.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_invalid_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:handle", ETL_INDEXED_PRIORITY_QUEUE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// The base for all indexed priority queues that contain a particular type.
+  /// The heap holds handles, and each handle's position in the heap is
+  /// tracked, so a value can be found from its handle in O(1).
+  /// The values themselves are never moved once pushed.
+  /// As with etl::priority_queue, top() is the value that compares greatest,
+  /// so use etl::greater for a min-queue such as Dijkstra's open set.
+  /// Handles are in the range [0, max_size()) and are reused once their value
+  /// has been popped or erased.
+  ///\tparam T        The type of value that the queue holds.
+  ///\tparam TCompare The comparison type.
+  ///\tparam ARITY    The number of children of each node in the heap.
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class iindexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ARITY >= 2U, "A heap needs at least two children per node");
+
+    typedef T         value_type;
+    typedef TCompare  compare_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&       rvalue_reference;
+#endif
+    typedef size_t    size_type;
+    typedef size_t    handle_type;
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle for the value.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (p_values + handle) T(value);
+
+      return link_back(handle);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle for the value.
+    //*************************************************************************
+    handle_type push(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (p_values + handle) T(etl::move(value));
+
+      return link_back(handle);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Constructs a value in the queue.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle for the value.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (p_values + handle) T(etl::forward<Args>(args)...);
+
+      return link_back(handle);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        remove(p_heap[0]);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the highest priority value to destination and removes it.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = top();
+      pop();
+    }
+
+    //*************************************************************************
+    /// Removes the value with the handle.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_invalid_handle));
+
+      remove(handle);
+    }
+
+    //*************************************************************************
+    /// Replaces the value with the handle and restores the heap order.
+    /// Use this for 'decrease key' and 'increase key'.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_invalid_handle));
+
+      p_values[handle] = value;
+      reposition(p_position[handle]);
+    }
+
+    //*************************************************************************
+    /// Checks whether the handle refers to a queued value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < CAPACITY) && (p_position[handle] < current_size);
+    }
+
+    //*************************************************************************
+    /// Gets the value with the handle.
+    /// If asserts or exceptions are enabled, emits etl::indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a queued value.
+    //*************************************************************************
+    const_reference get(handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_invalid_handle));
+
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Gets the value with the handle. The handle is not checked.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Returns the current number of values in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size != 0U)
+      {
+        --current_size;
+
+        const handle_type handle = p_heap[current_size];
+        etl::destroy_at(p_values + handle);
+        p_position[handle] = Free;
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_values_, size_t* p_heap_, size_t* p_position_, size_t max_size_)
+      : p_values(p_values_)
+      , p_heap(p_heap_)
+      , p_position(p_position_)
+      , CAPACITY(max_size_)
+      , current_size(0U)
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_heap[i]     = i;
+        p_position[i] = Free;
+      }
+    }
+
+    //*************************************************************************
+    /// Makes this a copy of other, keeping the same handles.
+    /// Assumes this queue is empty and has the same capacity.
+    //*************************************************************************
+    void clone(const iindexed_priority_queue& other)
+    {
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+        ::new (p_values + handle) T(other.p_values[handle]);
+      }
+
+      copy_handles(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the values from other, keeping the same handles.
+    /// Assumes this queue is empty and has the same capacity.
+    //*************************************************************************
+    void move(iindexed_priority_queue&& other)
+    {
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+        ::new (p_values + handle) T(etl::move(other.p_values[handle]));
+      }
+
+      copy_handles(other);
+      other.clear();
+    }
+#endif
+
+  private:
+
+    /// The position of a handle that is not in the heap.
+    static const size_t Free = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// Adds the handle of a newly constructed value to the back of the heap
+    /// and moves it up to its place.
+    //*************************************************************************
+    handle_type link_back(handle_type handle)
+    {
+      p_position[handle] = current_size;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+
+      sift_up(current_size - 1U);
+
+      return handle;
+    }
+
+    //*************************************************************************
+    /// Removes the value with the handle from the heap and destroys it.
+    /// The last handle in the heap takes its place.
+    //*************************************************************************
+    void remove(handle_type handle)
+    {
+      const size_t index = p_position[handle];
+
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT
+
+      // The removed handle swaps with the last, so that the free handles stay after the heap.
+      place(p_heap[current_size], index);
+      p_heap[current_size] = handle;
+      p_position[handle]   = Free;
+
+      etl::destroy_at(p_values + handle);
+
+      if (index < current_size)
+      {
+        reposition(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the handle at index up or down to restore the heap order.
+    //*************************************************************************
+    void reposition(size_t index)
+    {
+      if ((index > 0U) && compare(p_values[p_heap[(index - 1U) / ARITY]], p_values[p_heap[index]]))
+      {
+        sift_up(index);
+      }
+      else
+      {
+        sift_down(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the handle at index towards the top.
+    //*************************************************************************
+    void sift_up(size_t index)
+    {
+      const handle_type handle = p_heap[index];
+      const T&          value  = p_values[handle];
+
+      while (index > 0U)
+      {
+        const size_t parent = (index - 1U) / ARITY;
+
+        if (!compare(p_values[p_heap[parent]], value))
+        {
+          break;
+        }
+
+        place(p_heap[parent], index);
+        index = parent;
+      }
+
+      place(handle, index);
+    }
+
+    //*************************************************************************
+    /// Moves the handle at index away from the top.
+    //*************************************************************************
+    void sift_down(size_t index)
+    {
+      const handle_type handle = p_heap[index];
+      const T&          value  = p_values[handle];
+
+      while (true)
+      {
+        const size_t first_child = (index * ARITY) + 1U;
+
+        if (first_child >= current_size)
+        {
+          break;
+        }
+
+        const size_t last_child = etl::min(first_child + ARITY, current_size);
+        size_t best = first_child;
+
+        for (size_t child = first_child + 1U; child < last_child; ++child)
+        {
+          if (compare(p_values[p_heap[best]], p_values[p_heap[child]]))
+          {
+            best = child;
+          }
+        }
+
+        if (!compare(value, p_values[p_heap[best]]))
+        {
+          break;
+        }
+
+        place(p_heap[best], index);
+        index = best;
+      }
+
+      place(handle, index);
+    }
+
+    //*************************************************************************
+    /// Puts the handle at the heap index.
+    //*************************************************************************
+    void place(handle_type handle, size_t index)
+    {
+      p_heap[index]      = handle;
+      p_position[handle] = index;
+    }
+
+    //*************************************************************************
+    /// Copies the heap and positions from other.
+    //*************************************************************************
+    void copy_handles(const iindexed_priority_queue& other)
+    {
+      etl::copy(other.p_heap, other.p_heap + CAPACITY, p_heap);
+      etl::copy(other.p_position, other.p_position + CAPACITY, p_position);
+
+      current_size = other.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size)
+    }
+
+    // Disable copy construction.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+
+    T*      p_values;   ///< The values, indexed by handle.
+    size_t* p_heap;     ///< The heap of handles, followed by the free handles.
+    size_t* p_position; ///< The heap position of each handle.
+
+    const size_t CAPACITY;
+    size_t       current_size;
+
+    TCompare compare;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INDEXED_PRIORITY_QUEUE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iindexed_priority_queue()
+    {
+    }
+#else
+  protected:
+    ~iindexed_priority_queue()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// A fixed capacity indexed priority queue.
+  ///\tparam T         The type of value that the queue holds.
+  ///\tparam MAX_SIZE_ The maximum capacity of the queue.
+  ///\tparam TCompare  The comparison type.
+  ///\tparam ARITY     The number of children of each node in the heap. Default 2.
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, ARITY>
+  {
+  private:
+
+    typedef etl::iindexed_priority_queue<T, TCompare, ARITY> base;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity indexed_priority_queue is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. The handles of other are valid for the copy.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other)
+      : base(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+      this->clone(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor. The handles of other are valid for the new queue.
+    //*************************************************************************
+    indexed_priority_queue(indexed_priority_queue&& other)
+      : base(reinterpret_cast<T*>(&buffer), heap, position, MAX_SIZE)
+    {
+      this->move(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator = (const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->clone(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator = (indexed_priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->move(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The values, indexed by handle.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+
+    /// The heap of handles.
+    size_t heap[MAX_SIZE_];
+
+    /// The heap position of each handle.
+    size_t position[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare, const size_t ARITY>
+  ETL_CONSTANT size_t indexed_priority_queue<T, MAX_SIZE_, TCompare, ARITY>::MAX_SIZE;
+}
+
+#endif
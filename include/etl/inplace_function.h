@@ -0,0 +1,246 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INPLACE_FUNCTION_INCLUDED
+#define ETL_INPLACE_FUNCTION_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#if ETL_CPP11_SUPPORTED
+
+///\defgroup inplace_function inplace_function
+/// A callable wrapper that holds the callable by value in fixed storage.
+///\ingroup utilities
+
+#if !defined(ETL_INPLACE_FUNCTION_DEFAULT_SIZE)
+  #define ETL_INPLACE_FUNCTION_DEFAULT_SIZE (2U * sizeof(void*))
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for inplace_function exceptions.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  class inplace_function_exception : public exception
+  {
+  public:
+
+    inplace_function_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an empty inplace_function is called.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  class inplace_function_uninitialised : public inplace_function_exception
+  {
+  public:
+
+    inplace_function_uninitialised(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:uninitialised", ETL_INPLACE_FUNCTION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  template <typename TSignature, size_t Object_Size = ETL_INPLACE_FUNCTION_DEFAULT_SIZE, size_t Alignment = etl::alignment_of<void*>::value>
+  class inplace_function;
+
+  //***************************************************************************
+  /// Holds a lambda, functor or function pointer in 'Object_Size' bytes of
+  /// internal storage.
+  /// A call is a single indirect call through a stub, with no virtual
+  /// function and no pointer to a callable held elsewhere.
+  /// The callable must be trivially copyable, so an inplace_function is
+  /// itself trivially copyable and may be moved with memcpy. Lambdas that
+  /// capture pointers, references and scalars by value qualify.
+  /// Note that without the STL, etl::is_trivially_copyable only recognises
+  /// POD types.
+  ///\ingroup inplace_function
+  //***************************************************************************
+  template <typename TReturn, typename... TParams, size_t Object_Size, size_t Alignment>
+  class inplace_function<TReturn(TParams...), Object_Size, Alignment>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inplace_function()
+      : stub(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a lambda, functor or function.
+    //*************************************************************************
+    template <typename TCallable, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<TCallable>::type, inplace_function>::value, void>::type>
+    inplace_function(TCallable&& callable)
+      : stub(ETL_NULLPTR)
+    {
+      assign(etl::forward<TCallable>(callable));
+    }
+
+    //*************************************************************************
+    /// Construct from a function pointer.
+    /// A null pointer gives an empty inplace_function.
+    //*************************************************************************
+    inplace_function(TReturn(*function)(TParams...))
+      : stub(ETL_NULLPTR)
+    {
+      if (function != ETL_NULLPTR)
+      {
+        assign(function);
+      }
+    }
+
+    inplace_function(const inplace_function&) = default;
+    inplace_function& operator =(const inplace_function&) = default;
+
+    //*************************************************************************
+    /// Assign from a lambda, functor or function.
+    //*************************************************************************
+    template <typename TCallable, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<TCallable>::type, inplace_function>::value, void>::type>
+    inplace_function& operator =(TCallable&& callable)
+    {
+      assign(etl::forward<TCallable>(callable));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign from a function pointer.
+    /// A null pointer gives an empty inplace_function.
+    //*************************************************************************
+    inplace_function& operator =(TReturn(*function)(TParams...))
+    {
+      if (function != ETL_NULLPTR)
+      {
+        assign(function);
+      }
+      else
+      {
+        clear();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Calls the callable.
+    //*************************************************************************
+    TReturn operator()(TParams... args) const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(inplace_function_uninitialised));
+
+      return (*stub)(const_cast<void*>(static_cast<const void*>(&storage)), etl::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    /// Makes the inplace_function empty.
+    //*************************************************************************
+    void clear()
+    {
+      stub = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is a callable.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return stub != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there is a callable.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// The size of the internal storage.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity()
+    {
+      return Object_Size;
+    }
+
+  private:
+
+    typedef TReturn(*stub_type)(void* object, TParams...);
+
+    //*************************************************************************
+    /// Stores a copy of the callable and selects its stub.
+    //*************************************************************************
+    template <typename TCallable>
+    void assign(TCallable&& callable)
+    {
+      typedef typename etl::decay<TCallable>::type type;
+
+      ETL_STATIC_ASSERT(sizeof(type) <= Object_Size, "Callable too large for the inplace_function");
+      ETL_STATIC_ASSERT((Alignment % etl::alignment_of<type>::value) == 0U, "Callable alignment not supported by the inplace_function");
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<type>::value, "Callable must be trivially copyable");
+
+      ::new (static_cast<void*>(&storage)) type(etl::forward<TCallable>(callable));
+      stub = &invoke_stub<type>;
+    }
+
+    //*************************************************************************
+    /// Calls a stored callable.
+    //*************************************************************************
+    template <typename TCallable>
+    static TReturn invoke_stub(void* object, TParams... args)
+    {
+      return (*static_cast<TCallable*>(object))(etl::forward<TParams>(args)...);
+    }
+
+    typename etl::aligned_storage<Object_Size, Alignment>::type storage; ///< The callable.
+    stub_type stub;                                                      ///< Calls the callable, or null.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,1019 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTERVAL_MAP_INCLUDED
+#define ETL_INTERVAL_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "vector.h"
+#include "utility.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+//*****************************************************************************
+///\defgroup interval_map interval_map
+/// Fixed capacity maps from half open key intervals [low, high) to values.
+/// etl::interval_map holds intervals that do not overlap and finds the one
+/// containing a point with a binary search.
+/// etl::interval_multimap allows the intervals to overlap. It keeps them
+/// sorted by their low key, along with an implicit balanced tree of the
+/// highest key in each subtree, so that the intervals overlapping a query are
+/// found in O(log n + k), however they overlap.
+/// Insertion and erasure are O(n), as for etl::flat_map.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for interval_map
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_exception : public etl::exception
+  {
+  public:
+
+    interval_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for interval_map
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_full : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_full(string_type file_name_, numeric_type line_number_)
+      : interval_map_exception(ETL_ERROR_TEXT("interval_map:full", ETL_INTERVAL_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty or reversed interval exception for interval_map
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_invalid_interval : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_invalid_interval(string_type file_name_, numeric_type line_number_)
+      : interval_map_exception(ETL_ERROR_TEXT("interval_map:invalid interval", ETL_INTERVAL_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A half open interval of keys, [low, high).
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey>
+  struct interval
+  {
+    typedef TKey key_type;
+
+    interval()
+      : low()
+      , high()
+    {
+    }
+
+    interval(const TKey& low_, const TKey& high_)
+      : low(low_)
+      , high(high_)
+    {
+    }
+
+    TKey low;  ///< The first key in the interval.
+    TKey high; ///< The key after the last key in the interval.
+  };
+
+  //***************************************************************************
+  /// Equality operator.
+  //***************************************************************************
+  template <typename TKey>
+  bool operator ==(const etl::interval<TKey>& lhs, const etl::interval<TKey>& rhs)
+  {
+    return (lhs.low == rhs.low) && (lhs.high == rhs.high);
+  }
+
+  //***************************************************************************
+  /// Inequality operator.
+  //***************************************************************************
+  template <typename TKey>
+  bool operator !=(const etl::interval<TKey>& lhs, const etl::interval<TKey>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// The base class for interval_map.
+  /// Holds intervals that do not overlap, in key order.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class iinterval_map
+  {
+  public:
+
+    typedef TKey                                      key_type;
+    typedef TValue                                    mapped_type;
+    typedef etl::interval<TKey>                       interval_type;
+    typedef ETL_OR_STD::pair<interval_type, TValue>   value_type;
+    typedef TCompare                                  key_compare;
+    typedef const value_type&                         const_reference;
+    typedef const value_type*                         const_pointer;
+    typedef typename etl::ivector<value_type>::const_iterator const_iterator;
+    typedef size_t                                    size_type;
+    typedef const TKey&                               key_parameter_t;
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return entries.begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return entries.end();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return entries.cbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return entries.cend();
+    }
+
+    //*************************************************************************
+    /// Inserts a value for the interval [low, high).
+    /// If the interval overlaps one already in the map, nothing is inserted
+    /// and the iterator refers to the first overlapped interval.
+    /// If asserts or exceptions are enabled, emits interval_map_invalid_interval
+    /// if low is not less than high, and interval_map_full if the map is full.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, bool> insert(key_parameter_t low, key_parameter_t high, const TValue& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(compare(low, high), ETL_ERROR(interval_map_invalid_interval), ETL_OR_STD::make_pair(end(), false));
+
+      typename etl::ivector<value_type>::iterator itr = upper_bound_high(low);
+
+      if ((itr != entries.end()) && compare(itr->first.low, high))
+      {
+        return ETL_OR_STD::make_pair(const_iterator(itr), false);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(interval_map_full), ETL_OR_STD::make_pair(end(), false));
+
+      itr = entries.insert(itr, value_type(interval_type(low, high), value));
+
+      return ETL_OR_STD::make_pair(const_iterator(itr), true);
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the value of the interval containing the key,
+    /// or nullptr if there is none.
+    //*************************************************************************
+    TValue* find(key_parameter_t key)
+    {
+      typename etl::ivector<value_type>::iterator itr = upper_bound_high(key);
+
+      return ((itr != entries.end()) && !compare(key, itr->first.low)) ? &itr->second : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the value of the interval containing the key,
+    /// or nullptr if there is none.
+    //*************************************************************************
+    const TValue* find(key_parameter_t key) const
+    {
+      const_iterator itr = find_interval(key);
+
+      return (itr != end()) ? &itr->second : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the interval containing the key, or end().
+    //*************************************************************************
+    const_iterator find_interval(key_parameter_t key) const
+    {
+      const_iterator itr = etl::upper_bound(entries.begin(), entries.end(), key, key_before_high(compare));
+
+      return ((itr != entries.end()) && !compare(key, itr->first.low)) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Returns true if an interval contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find_interval(key) != end();
+    }
+
+    //*************************************************************************
+    /// Returns true if any interval overlaps [low, high).
+    //*************************************************************************
+    bool overlaps(key_parameter_t low, key_parameter_t high) const
+    {
+      const_iterator itr = etl::upper_bound(entries.begin(), entries.end(), low, key_before_high(compare));
+
+      return compare(low, high) && (itr != entries.end()) && compare(itr->first.low, high);
+    }
+
+    //*************************************************************************
+    /// Erases the interval containing the key.
+    /// Returns the number of intervals erased.
+    //*************************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const_iterator itr = find_interval(key);
+
+      if (itr == end())
+      {
+        return 0U;
+      }
+
+      erase(itr);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the interval at the iterator.
+    /// Returns an iterator to the next interval.
+    //*************************************************************************
+    const_iterator erase(const_iterator position)
+    {
+      return entries.erase(entries.begin() + etl::distance(cbegin(), position));
+    }
+
+    //*************************************************************************
+    /// Erases all of the intervals.
+    //*************************************************************************
+    void clear()
+    {
+      entries.clear();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals.
+    //*************************************************************************
+    size_type size() const
+    {
+      return entries.size();
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no intervals.
+    //*************************************************************************
+    bool empty() const
+    {
+      return entries.empty();
+    }
+
+    //*************************************************************************
+    /// Returns true if no more intervals can be inserted.
+    //*************************************************************************
+    bool full() const
+    {
+      return entries.full();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return entries.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return entries.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals that can still be inserted.
+    //*************************************************************************
+    size_t available() const
+    {
+      return entries.available();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinterval_map& operator =(const iinterval_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        entries.assign(rhs.entries.begin(), rhs.entries.end());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_map(etl::ivector<value_type>& entries_)
+      : entries(entries_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Compares a key with the high key of an interval.
+    //*************************************************************************
+    struct key_before_high
+    {
+      key_before_high(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const TKey& key, const value_type& entry) const
+      {
+        return compare(key, entry.first.high);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// The first interval whose high key is above the key.
+    /// As the intervals do not overlap, the high keys are in order too.
+    //*************************************************************************
+    typename etl::ivector<value_type>::iterator upper_bound_high(key_parameter_t key)
+    {
+      return etl::upper_bound(entries.begin(), entries.end(), key, key_before_high(compare));
+    }
+
+    // Disable copy construction.
+    iinterval_map(const iinterval_map&);
+
+    etl::ivector<value_type>& entries;
+    TCompare                  compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INTERVAL_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinterval_map()
+    {
+    }
+#else
+  protected:
+    ~iinterval_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// An interval_map with capacity for VSize intervals.
+  /// \tparam TKey     The key type.
+  /// \tparam TValue   The value type.
+  /// \tparam VSize    The maximum number of intervals.
+  /// \tparam TCompare The key ordering.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t VSize, typename TCompare = etl::less<TKey> >
+  class interval_map : public etl::iinterval_map<TKey, TValue, TCompare>
+  {
+    typedef etl::iinterval_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VSize > 0U), "Zero capacity interval_map is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_map()
+      : base_t(storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    interval_map(const interval_map& other)
+      : base_t(storage)
+      , storage(other.storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    interval_map& operator =(const interval_map& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    etl::vector<typename base_t::value_type, VSize> storage;
+  };
+
+  template <typename TKey, typename TValue, const size_t VSize, typename TCompare>
+  ETL_CONSTANT size_t interval_map<TKey, TValue, VSize, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// The base class for interval_multimap.
+  /// Holds intervals that may overlap, ordered by their low key, with
+  /// intervals of equal low key in insertion order.
+  /// Alongside them is an implicit balanced tree over the ordered intervals.
+  /// The subtree holding [first, last) has its root at the middle index and
+  /// records there the highest key of the intervals in the subtree.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class iinterval_multimap
+  {
+  public:
+
+    typedef TKey                                      key_type;
+    typedef TValue                                    mapped_type;
+    typedef etl::interval<TKey>                       interval_type;
+    typedef ETL_OR_STD::pair<interval_type, TValue>   value_type;
+    typedef TCompare                                  key_compare;
+    typedef const value_type&                         const_reference;
+    typedef const value_type*                         const_pointer;
+    typedef typename etl::ivector<value_type>::const_iterator const_iterator;
+    typedef size_t                                    size_type;
+    typedef const TKey&                               key_parameter_t;
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return entries.begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return entries.end();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return entries.cbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return entries.cend();
+    }
+
+    //*************************************************************************
+    /// Inserts a value for the interval [low, high).
+    /// If asserts or exceptions are enabled, emits interval_map_invalid_interval
+    /// if low is not less than high, and interval_map_full if the map is full.
+    //*************************************************************************
+    const_iterator insert(key_parameter_t low, key_parameter_t high, const TValue& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(compare(low, high), ETL_ERROR(interval_map_invalid_interval), end());
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(interval_map_full), end());
+
+      typename etl::ivector<value_type>::iterator itr = etl::upper_bound(entries.begin(), entries.end(), low, key_before_low(compare));
+
+      const size_t index = size_t(etl::distance(entries.begin(), itr));
+
+      entries.insert(itr, value_type(interval_type(low, high), value));
+      max_high.push_back(high);
+      rebuild();
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Calls function(interval, value) for each interval overlapping
+    /// [low, high), in order of their low keys.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_overlap(key_parameter_t low, key_parameter_t high, TFunction function)
+    {
+      if (compare(low, high))
+      {
+        visit(entries.data(), 0U, size(), low, high, false, function);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls function(interval, value) for each interval overlapping
+    /// [low, high), in order of their low keys.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_overlap(key_parameter_t low, key_parameter_t high, TFunction function) const
+    {
+      if (compare(low, high))
+      {
+        visit(static_cast<const value_type*>(entries.data()), 0U, size(), low, high, false, function);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls function(interval, value) for each interval containing the key,
+    /// in order of their low keys.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_containing(key_parameter_t key, TFunction function)
+    {
+      visit(entries.data(), 0U, size(), key, key, true, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls function(interval, value) for each interval containing the key,
+    /// in order of their low keys.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_containing(key_parameter_t key, TFunction function) const
+    {
+      visit(static_cast<const value_type*>(entries.data()), 0U, size(), key, key, true, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Returns true if any interval contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find_first(0U, size(), key, key, true) != end();
+    }
+
+    //*************************************************************************
+    /// Returns true if any interval overlaps [low, high).
+    //*************************************************************************
+    bool overlaps(key_parameter_t low, key_parameter_t high) const
+    {
+      return compare(low, high) && (find_first(0U, size(), low, high, false) != end());
+    }
+
+    //*************************************************************************
+    /// Returns the first interval, by low key, overlapping [low, high),
+    /// or end() if there is none.
+    //*************************************************************************
+    const_iterator find_first_overlap(key_parameter_t low, key_parameter_t high) const
+    {
+      return compare(low, high) ? find_first(0U, size(), low, high, false) : end();
+    }
+
+    //*************************************************************************
+    /// Erases every copy of the interval [low, high).
+    /// Returns the number of intervals erased.
+    //*************************************************************************
+    size_t erase(key_parameter_t low, key_parameter_t high)
+    {
+      typename etl::ivector<value_type>::iterator first = etl::lower_bound(entries.begin(), entries.end(), low, low_before_key(compare));
+      typename etl::ivector<value_type>::iterator last  = etl::upper_bound(first, entries.end(), low, key_before_low(compare));
+
+      size_t count = 0U;
+
+      while (first != last)
+      {
+        if (!compare(first->first.high, high) && !compare(high, first->first.high))
+        {
+          first = entries.erase(first);
+          --last;
+          ++count;
+        }
+        else
+        {
+          ++first;
+        }
+      }
+
+      if (count != 0U)
+      {
+        max_high.resize(size(), low);
+        rebuild();
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Erases the interval at the iterator.
+    /// Returns an iterator to the next interval.
+    //*************************************************************************
+    const_iterator erase(const_iterator position)
+    {
+      const size_t index = size_t(etl::distance(cbegin(), position));
+
+      entries.erase(entries.begin() + index);
+      max_high.pop_back();
+      rebuild();
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Erases all of the intervals.
+    //*************************************************************************
+    void clear()
+    {
+      entries.clear();
+      max_high.clear();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals.
+    //*************************************************************************
+    size_type size() const
+    {
+      return entries.size();
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no intervals.
+    //*************************************************************************
+    bool empty() const
+    {
+      return entries.empty();
+    }
+
+    //*************************************************************************
+    /// Returns true if no more intervals can be inserted.
+    //*************************************************************************
+    bool full() const
+    {
+      return entries.full();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return entries.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return entries.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals that can still be inserted.
+    //*************************************************************************
+    size_t available() const
+    {
+      return entries.available();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinterval_multimap& operator =(const iinterval_multimap& rhs)
+    {
+      if (&rhs != this)
+      {
+        entries.assign(rhs.entries.begin(), rhs.entries.end());
+        max_high.assign(rhs.max_high.begin(), rhs.max_high.end());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_multimap(etl::ivector<value_type>& entries_, etl::ivector<TKey>& max_high_)
+      : entries(entries_)
+      , max_high(max_high_)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Compares a key with the low key of an interval.
+    //*************************************************************************
+    struct key_before_low
+    {
+      key_before_low(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const TKey& key, const value_type& entry) const
+      {
+        return compare(key, entry.first.low);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Compares the low key of an interval with a key.
+    //*************************************************************************
+    struct low_before_key
+    {
+      low_before_key(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const value_type& entry, const TKey& key) const
+      {
+        return compare(entry.first.low, key);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Returns true if an interval starting at entry_low may match the query.
+    /// A point query is the closed interval [key, key].
+    //*************************************************************************
+    bool starts_in_query(key_parameter_t entry_low, key_parameter_t high, bool closed) const
+    {
+      return closed ? !compare(high, entry_low) : compare(entry_low, high);
+    }
+
+    //*************************************************************************
+    /// Visits the matching intervals in the subtree [first, last).
+    //*************************************************************************
+    template <typename TEntry, typename TFunction>
+    void visit(TEntry* p_entries, size_t first, size_t last, key_parameter_t low, key_parameter_t high, bool closed, TFunction& function) const
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      const size_t middle = first + ((last - first) / 2U);
+
+      // Does every interval in the subtree end before the query?
+      if (!compare(low, max_high[middle]))
+      {
+        return;
+      }
+
+      visit(p_entries, first, middle, low, high, closed, function);
+
+      TEntry& entry = p_entries[middle];
+
+      // Intervals to the right start no earlier than this one.
+      if (starts_in_query(entry.first.low, high, closed))
+      {
+        if (compare(low, entry.first.high))
+        {
+          function(entry.first, entry.second);
+        }
+
+        visit(p_entries, middle + 1U, last, low, high, closed, function);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the first matching interval in the subtree [first, last).
+    //*************************************************************************
+    const_iterator find_first(size_t first, size_t last, key_parameter_t low, key_parameter_t high, bool closed) const
+    {
+      if (first == last)
+      {
+        return end();
+      }
+
+      const size_t middle = first + ((last - first) / 2U);
+
+      if (!compare(low, max_high[middle]))
+      {
+        return end();
+      }
+
+      const_iterator itr = find_first(first, middle, low, high, closed);
+
+      if (itr != end())
+      {
+        return itr;
+      }
+
+      const value_type& entry = entries[middle];
+
+      if (!starts_in_query(entry.first.low, high, closed))
+      {
+        return end();
+      }
+
+      if (compare(low, entry.first.high))
+      {
+        return begin() + middle;
+      }
+
+      return find_first(middle + 1U, last, low, high, closed);
+    }
+
+    //*************************************************************************
+    /// Recalculates the highest key of each subtree.
+    //*************************************************************************
+    void rebuild()
+    {
+      if (!empty())
+      {
+        rebuild(0U, size());
+      }
+    }
+
+    //*************************************************************************
+    /// Recalculates the highest key of the subtree [first, last) and returns it.
+    //*************************************************************************
+    const TKey& rebuild(size_t first, size_t last)
+    {
+      const size_t middle = first + ((last - first) / 2U);
+
+      TKey& highest = max_high[middle];
+
+      highest = entries[middle].first.high;
+
+      if (first != middle)
+      {
+        const TKey& left = rebuild(first, middle);
+
+        if (compare(highest, left))
+        {
+          highest = left;
+        }
+      }
+
+      if ((middle + 1U) != last)
+      {
+        const TKey& right = rebuild(middle + 1U, last);
+
+        if (compare(highest, right))
+        {
+          highest = right;
+        }
+      }
+
+      return highest;
+    }
+
+    // Disable copy construction.
+    iinterval_multimap(const iinterval_multimap&);
+
+    etl::ivector<value_type>& entries;
+    etl::ivector<TKey>&       max_high;
+    TCompare                  compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INTERVAL_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinterval_multimap()
+    {
+    }
+#else
+  protected:
+    ~iinterval_multimap()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_map
+  /// An interval_multimap with capacity for VSize intervals.
+  /// \tparam TKey     The key type.
+  /// \tparam TValue   The value type.
+  /// \tparam VSize    The maximum number of intervals.
+  /// \tparam TCompare The key ordering.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t VSize, typename TCompare = etl::less<TKey> >
+  class interval_multimap : public etl::iinterval_multimap<TKey, TValue, TCompare>
+  {
+    typedef etl::iinterval_multimap<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VSize > 0U), "Zero capacity interval_multimap is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_multimap()
+      : base_t(storage, max_high_storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    interval_multimap(const interval_multimap& other)
+      : base_t(storage, max_high_storage)
+      , storage(other.storage)
+      , max_high_storage(other.max_high_storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    interval_multimap& operator =(const interval_multimap& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    etl::vector<typename base_t::value_type, VSize> storage;
+    etl::vector<TKey, VSize>                        max_high_storage;
+  };
+
+  template <typename TKey, typename TValue, const size_t VSize, typename TCompare>
+  ETL_CONSTANT size_t interval_multimap<TKey, TValue, VSize, TCompare>::MAX_SIZE;
+}
+
+#endif
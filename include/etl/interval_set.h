@@ -0,0 +1,518 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTERVAL_SET_INCLUDED
+#define ETL_INTERVAL_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "interval_map.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+//*****************************************************************************
+///\defgroup interval_set interval_set
+/// A fixed capacity set of keys, held as the smallest ordered list of half
+/// open intervals [low, high) that covers them.
+/// Inserting an interval merges it with any it overlaps or touches. Erasing
+/// one trims or splits the intervals it overlaps.
+/// A key is found with a binary search.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for interval_set
+  ///\ingroup interval_set
+  //***************************************************************************
+  class interval_set_exception : public etl::exception
+  {
+  public:
+
+    interval_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for interval_set
+  ///\ingroup interval_set
+  //***************************************************************************
+  class interval_set_full : public etl::interval_set_exception
+  {
+  public:
+
+    interval_set_full(string_type file_name_, numeric_type line_number_)
+      : interval_set_exception(ETL_ERROR_TEXT("interval_set:full", ETL_INTERVAL_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty or reversed interval exception for interval_set
+  ///\ingroup interval_set
+  //***************************************************************************
+  class interval_set_invalid_interval : public etl::interval_set_exception
+  {
+  public:
+
+    interval_set_invalid_interval(string_type file_name_, numeric_type line_number_)
+      : interval_set_exception(ETL_ERROR_TEXT("interval_set:invalid interval", ETL_INTERVAL_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_set
+  /// The base class for interval_set.
+  //***************************************************************************
+  template <typename TKey, typename TCompare = etl::less<TKey> >
+  class iinterval_set
+  {
+  public:
+
+    typedef TKey                                               key_type;
+    typedef etl::interval<TKey>                                value_type;
+    typedef TCompare                                           key_compare;
+    typedef const value_type&                                  const_reference;
+    typedef const value_type*                                  const_pointer;
+    typedef typename etl::ivector<value_type>::const_iterator  const_iterator;
+    typedef size_t                                             size_type;
+    typedef const TKey&                                        key_parameter_t;
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return intervals.begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return intervals.end();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the first interval.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return intervals.cbegin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the intervals.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return intervals.cend();
+    }
+
+    //*************************************************************************
+    /// Adds the keys [low, high) to the set.
+    /// Returns an iterator to the interval now holding them.
+    /// If asserts or exceptions are enabled, emits interval_set_invalid_interval
+    /// if low is not less than high, and interval_set_full if a new interval
+    /// is needed and the set is full.
+    //*************************************************************************
+    const_iterator insert(key_parameter_t low, key_parameter_t high)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(compare(low, high), ETL_ERROR(interval_set_invalid_interval), end());
+
+      // The intervals that overlap or touch [low, high).
+      iterator first = etl::lower_bound(intervals.begin(), intervals.end(), low, high_before_key(compare));
+      iterator last  = etl::upper_bound(first, intervals.end(), high, key_before_low(compare));
+
+      if (first == last)
+      {
+        ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(interval_set_full), end());
+
+        return intervals.insert(first, value_type(low, high));
+      }
+
+      if (compare(low, first->low))
+      {
+        first->low = low;
+      }
+
+      const TKey& last_high = (last - 1)->high;
+
+      if (compare(high, last_high))
+      {
+        first->high = last_high;
+      }
+      else
+      {
+        first->high = high;
+      }
+
+      intervals.erase(first + 1, last);
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Removes the keys [low, high) from the set.
+    /// If asserts or exceptions are enabled, emits interval_set_invalid_interval
+    /// if low is not less than high, and interval_set_full if an interval has
+    /// to be split and the set is full.
+    //*************************************************************************
+    void erase(key_parameter_t low, key_parameter_t high)
+    {
+      ETL_ASSERT_AND_RETURN(compare(low, high), ETL_ERROR(interval_set_invalid_interval));
+
+      // The intervals that overlap [low, high).
+      iterator first = etl::upper_bound(intervals.begin(), intervals.end(), low, key_before_high(compare));
+      iterator last  = etl::lower_bound(first, intervals.end(), high, low_before_key(compare));
+
+      if (first == last)
+      {
+        return;
+      }
+
+      // Split an interval around [low, high).
+      if (((last - first) == 1) && compare(first->low, low) && compare(high, first->high))
+      {
+        ETL_ASSERT_AND_RETURN(!full(), ETL_ERROR(interval_set_full));
+
+        const value_type upper(high, first->high);
+
+        first->high = low;
+        intervals.insert(first + 1, upper);
+
+        return;
+      }
+
+      if (compare(first->low, low))
+      {
+        first->high = low;
+        ++first;
+      }
+
+      if (compare(high, (last - 1)->high))
+      {
+        --last;
+        last->low = high;
+      }
+
+      intervals.erase(first, last);
+    }
+
+    //*************************************************************************
+    /// Erases the interval at the iterator.
+    /// Returns an iterator to the next interval.
+    //*************************************************************************
+    const_iterator erase(const_iterator position)
+    {
+      return intervals.erase(intervals.begin() + etl::distance(cbegin(), position));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the interval containing the key, or end().
+    //*************************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const_iterator itr = etl::upper_bound(intervals.begin(), intervals.end(), key, key_before_high(compare));
+
+      return ((itr != intervals.end()) && !compare(key, itr->low)) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Returns true if the set contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Returns true if the set contains all of the keys [low, high).
+    //*************************************************************************
+    bool contains(key_parameter_t low, key_parameter_t high) const
+    {
+      const_iterator itr = find(low);
+
+      return (itr != end()) && !compare(itr->high, high);
+    }
+
+    //*************************************************************************
+    /// Returns true if the set contains any of the keys [low, high).
+    //*************************************************************************
+    bool overlaps(key_parameter_t low, key_parameter_t high) const
+    {
+      const_iterator itr = etl::upper_bound(intervals.begin(), intervals.end(), low, key_before_high(compare));
+
+      return compare(low, high) && (itr != intervals.end()) && compare(itr->low, high);
+    }
+
+    //*************************************************************************
+    /// Removes all of the keys.
+    //*************************************************************************
+    void clear()
+    {
+      intervals.clear();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals.
+    //*************************************************************************
+    size_type size() const
+    {
+      return intervals.size();
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no intervals.
+    //*************************************************************************
+    bool empty() const
+    {
+      return intervals.empty();
+    }
+
+    //*************************************************************************
+    /// Returns true if no more intervals can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return intervals.full();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return intervals.max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of intervals.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return intervals.capacity();
+    }
+
+    //*************************************************************************
+    /// Returns the number of intervals that can still be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return intervals.available();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinterval_set& operator =(const iinterval_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        intervals.assign(rhs.intervals.begin(), rhs.intervals.end());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_set(etl::ivector<value_type>& intervals_)
+      : intervals(intervals_)
+    {
+    }
+
+  private:
+
+    typedef typename etl::ivector<value_type>::iterator iterator;
+
+    //*************************************************************************
+    /// Compares a key with the high key of an interval.
+    //*************************************************************************
+    struct key_before_high
+    {
+      key_before_high(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const TKey& key, const value_type& entry) const
+      {
+        return compare(key, entry.high);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Compares the high key of an interval with a key.
+    //*************************************************************************
+    struct high_before_key
+    {
+      high_before_key(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const value_type& entry, const TKey& key) const
+      {
+        return compare(entry.high, key);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Compares a key with the low key of an interval.
+    //*************************************************************************
+    struct key_before_low
+    {
+      key_before_low(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const TKey& key, const value_type& entry) const
+      {
+        return compare(key, entry.low);
+      }
+
+      const TCompare& compare;
+    };
+
+    //*************************************************************************
+    /// Compares the low key of an interval with a key.
+    //*************************************************************************
+    struct low_before_key
+    {
+      low_before_key(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator()(const value_type& entry, const TKey& key) const
+      {
+        return compare(entry.low, key);
+      }
+
+      const TCompare& compare;
+    };
+
+    // Disable copy construction.
+    iinterval_set(const iinterval_set&);
+
+    etl::ivector<value_type>& intervals;
+    TCompare                  compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INTERVAL_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinterval_set()
+    {
+    }
+#else
+  protected:
+    ~iinterval_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup interval_set
+  /// An interval_set with capacity for VSize intervals.
+  /// \tparam TKey     The key type.
+  /// \tparam VSize    The maximum number of intervals.
+  /// \tparam TCompare The key ordering.
+  //***************************************************************************
+  template <typename TKey, const size_t VSize, typename TCompare = etl::less<TKey> >
+  class interval_set : public etl::iinterval_set<TKey, TCompare>
+  {
+    typedef etl::iinterval_set<TKey, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VSize > 0U), "Zero capacity interval_set is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_set()
+      : base_t(storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    interval_set(const interval_set& other)
+      : base_t(storage)
+      , storage(other.storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    interval_set& operator =(const interval_set& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    etl::vector<typename base_t::value_type, VSize> storage;
+  };
+
+  template <typename TKey, const size_t VSize, typename TCompare>
+  ETL_CONSTANT size_t interval_set<TKey, VSize, TCompare>::MAX_SIZE;
+}
+
+#endif
@@ -350,7 +350,7 @@ namespace etl
       iterator& operator ++()
       {
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return *this;
       }
 
@@ -358,7 +358,7 @@ namespace etl
       {
         iterator temp(*this);
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return temp;
       }
 
@@ -430,7 +430,7 @@ namespace etl
       const_iterator& operator ++()
       {
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return *this;
       }
 
@@ -438,7 +438,7 @@ namespace etl
       {
         const_iterator temp(*this);
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return temp;
       }
 
@@ -1040,7 +1040,7 @@ namespace etl
     //*************************************************************************
     value_type* get_next(link_type* link) const
     {
-      return static_cast<value_type*>(link->etl_next);
+      return static_cast<value_type*>(static_cast<link_type*>(link->etl_next));
     }
 
     // Disabled.
@@ -32,12 +32,16 @@ SOFTWARE.
 #define ETL_INTRUSIVE_LINKS_INCLUDED
 
 #include <assert.h>
+#include <stdint.h>
 
 #include "platform.h"
 #include "nullptr.h"
 #include "type_traits.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "atomic.h"
 
 #include "utility.h"
 #include "algorithm.h"
@@ -81,6 +85,132 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Link offset out of range exception.
+  //***************************************************************************
+  class link_offset_exception : public etl::link_exception
+  {
+  public:
+
+    link_offset_exception(string_type file_name_, numeric_type line_number_)
+      : link_exception(ETL_ERROR_TEXT("link:offset range", ETL_INTRUSIVE_LINKS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A link pointer stored as a signed byte offset from its own address.
+  /// Used by the compact links, so that a link costs 2 or 4 bytes rather
+  /// than the size of a pointer. The linked objects, and the list object
+  /// holding the terminal link, must all lie within the range of TOffset of
+  /// each other, such as nodes taken from the same pool or array as the list.
+  /// If asserts or exceptions are enabled, emits etl::link_offset_exception
+  /// when a link is out of range.
+  /// Copying rebases the offset, so the copy points at the same link.
+  ///\tparam TLink   The link type pointed to.
+  ///\tparam TOffset The signed offset type. int16_t or int32_t.
+  //***************************************************************************
+  template <typename TLink, typename TOffset>
+  class compact_link_pointer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_signed<TOffset>::value, "TOffset must be signed");
+    ETL_STATIC_ASSERT(sizeof(TOffset) > 1U, "TOffset must be wider than a byte");
+
+    //*************************************************************************
+    /// Default constructor. Creates a null link.
+    //*************************************************************************
+    compact_link_pointer()
+      : offset(Null_Offset)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Points to the same link as other.
+    //*************************************************************************
+    compact_link_pointer(const compact_link_pointer& other)
+    {
+      set(other.get());
+    }
+
+    //*************************************************************************
+    /// Assignment. Points to the same link as other.
+    //*************************************************************************
+    compact_link_pointer& operator =(const compact_link_pointer& other)
+    {
+      set(other.get());
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment from a pointer.
+    //*************************************************************************
+    compact_link_pointer& operator =(TLink* p)
+    {
+      set(p);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets the pointer to the link.
+    //*************************************************************************
+    TLink* get() const
+    {
+      if (offset == Null_Offset)
+      {
+        return ETL_NULLPTR;
+      }
+
+      return reinterpret_cast<TLink*>(reinterpret_cast<uintptr_t>(this) + uintptr_t(intptr_t(offset)));
+    }
+
+    //*************************************************************************
+    /// Conversion to a pointer.
+    //*************************************************************************
+    operator TLink*() const
+    {
+      return get();
+    }
+
+    //*************************************************************************
+    TLink* operator ->() const
+    {
+      return get();
+    }
+
+    //*************************************************************************
+    TLink& operator *() const
+    {
+      return *get();
+    }
+
+  private:
+
+    // Links are at least as aligned as TOffset, so an odd offset never points to one.
+    static const TOffset Null_Offset = 1;
+
+    //*************************************************************************
+    void set(TLink* p)
+    {
+      if (p == ETL_NULLPTR)
+      {
+        offset = Null_Offset;
+      }
+      else
+      {
+        const intptr_t difference = intptr_t(reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(this));
+
+        ETL_ASSERT((difference >= intptr_t(etl::integral_limits<TOffset>::min)) &&
+                   (difference <= intptr_t(etl::integral_limits<TOffset>::max)), ETL_ERROR(link_offset_exception));
+
+        offset = TOffset(difference);
+      }
+    }
+
+    TOffset offset;
+  };
+
   //***************************************************************************
   /// A forward link.
   //***************************************************************************
@@ -105,9 +235,89 @@ namespace etl
     forward_link* etl_next;
   };
 
+  //***************************************************************************
+  /// A forward link that stores the link as an offset.
+  /// May be used in place of forward_link, such as in intrusive_forward_list.
+  ///\tparam TOffset The signed offset type. See etl::compact_link_pointer.
+  //***************************************************************************
+  template <const size_t ID_, typename TOffset = int32_t>
+  struct compact_forward_link
+  {
+    enum
+    {
+      ID = ID_,
+    };
+
+    void clear()
+    {
+      etl_next = ETL_NULLPTR;
+    }
+
+    bool is_linked() const
+    {
+      return etl_next != ETL_NULLPTR;
+    }
+
+    etl::compact_link_pointer<compact_forward_link, TOffset> etl_next;
+  };
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A forward link whose pointer is atomic.
+  /// For the lock free intrusive containers, such as intrusive_stack_atomic
+  /// and intrusive_queue_mpsc_atomic, where one thread may read a link while
+  /// another writes it.
+  /// Copying does not copy the link.
+  //***************************************************************************
+  template <const size_t ID_>
+  struct atomic_forward_link
+  {
+    enum
+    {
+      ID = ID_,
+    };
+
+    atomic_forward_link()
+      : etl_next(ETL_NULLPTR)
+    {
+    }
+
+    atomic_forward_link(const atomic_forward_link&)
+      : etl_next(ETL_NULLPTR)
+    {
+    }
+
+    atomic_forward_link& operator =(const atomic_forward_link&)
+    {
+      return *this;
+    }
+
+    void clear()
+    {
+      etl_next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+    }
+
+    bool is_linked() const
+    {
+      return etl_next.load(etl::memory_order_relaxed) != ETL_NULLPTR;
+    }
+
+    etl::atomic<atomic_forward_link*> etl_next;
+  };
+#endif
+
+  //***************************************************************************
+  /// Is the type a forward link?
+  //***************************************************************************
+  template <typename TLink>
+  struct is_forward_link : etl::integral_constant<bool, etl::is_same<TLink, etl::forward_link<TLink::ID> >::value> {};
+
+  template <const size_t ID_, typename TOffset>
+  struct is_forward_link<etl::compact_forward_link<ID_, TOffset> > : etl::true_type {};
+
   // Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link(TLink& lhs, TLink& rhs)
   {
     lhs.etl_next = &rhs;
@@ -115,7 +325,7 @@ namespace etl
 
   // Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink& rhs)
   {
     rhs.etl_next = lhs.etl_next;
@@ -124,7 +334,7 @@ namespace etl
 
   // Pointer, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link(TLink* lhs, TLink* rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -135,7 +345,7 @@ namespace etl
 
   // Pointer, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink* rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -151,7 +361,7 @@ namespace etl
 
   // Reference, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link(TLink& lhs, TLink* rhs)
   {
     lhs.etl_next = rhs;
@@ -159,7 +369,7 @@ namespace etl
 
   // Reference, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink* rhs)
   {
     if (rhs != ETL_NULLPTR)
@@ -172,7 +382,7 @@ namespace etl
 
   // Pointer, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link(TLink* lhs, TLink& rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -183,7 +393,7 @@ namespace etl
 
   // Pointer, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink& rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -195,7 +405,7 @@ namespace etl
 
   // Reference, Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink& first, TLink& last)
   {
     last.etl_next = lhs.etl_next;
@@ -204,7 +414,7 @@ namespace etl
 
   // Pointer, Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink& first, TLink& last)
   {
     if (lhs != ETL_NULLPTR)
@@ -220,7 +430,7 @@ namespace etl
 
   // Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   unlink_after(TLink& node)
   {
     if (node.etl_next != ETL_NULLPTR)
@@ -232,7 +442,7 @@ namespace etl
 
   // Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::forward_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_forward_link<TLink>::value, void>::type
   unlink_after(TLink& before, TLink& last)
   {
     before.etl_next = last.etl_next;
@@ -286,9 +496,68 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// A bidirectional link that stores the links as offsets.
+  /// May be used in place of bidirectional_link, such as in intrusive_list.
+  ///\tparam TOffset The signed offset type. See etl::compact_link_pointer.
+  //***************************************************************************
+  template <const size_t ID_, typename TOffset = int32_t>
+  struct compact_bidirectional_link
+  {
+    enum
+    {
+      ID = ID_,
+    };
+
+    void clear()
+    {
+      etl_previous = ETL_NULLPTR;
+      etl_next     = ETL_NULLPTR;
+    }
+
+    bool is_linked() const
+    {
+      return (etl_previous != ETL_NULLPTR) || (etl_next != ETL_NULLPTR);
+    }
+
+    void reverse()
+    {
+      compact_bidirectional_link* temp = etl_previous;
+      etl_previous = etl_next;
+      etl_next     = temp;
+    }
+
+    etl::compact_link_pointer<compact_bidirectional_link, TOffset> etl_previous;
+    etl::compact_link_pointer<compact_bidirectional_link, TOffset> etl_next;
+
+    void unlink()
+    {
+      // Connect the previous link with the next.
+      if (etl_previous != ETL_NULLPTR)
+      {
+        etl_previous->etl_next = etl_next;
+      }
+
+      // Connect the next link with the previous.
+      if (etl_next != ETL_NULLPTR)
+      {
+        etl_next->etl_previous = etl_previous;
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// Is the type a bidirectional link?
+  //***************************************************************************
+  template <typename TLink>
+  struct is_bidirectional_link : etl::integral_constant<bool, etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value> {};
+
+  template <const size_t ID_, typename TOffset>
+  struct is_bidirectional_link<etl::compact_bidirectional_link<ID_, TOffset> > : etl::true_type {};
+
   // Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link(TLink& lhs, TLink& rhs)
   {
     lhs.etl_next     = &rhs;
@@ -297,7 +566,7 @@ namespace etl
 
   // Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink& rhs)
   {
     rhs.etl_next     = lhs.etl_next;
@@ -313,7 +582,7 @@ namespace etl
 
   // Pointer, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link(TLink* lhs, TLink* rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -329,7 +598,7 @@ namespace etl
 
   // Pointer, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink* rhs)
   {
     if (rhs != ETL_NULLPTR)
@@ -355,7 +624,7 @@ namespace etl
 
   // Reference, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link(TLink& lhs, TLink* rhs)
   {
     lhs.etl_next = rhs;
@@ -368,7 +637,7 @@ namespace etl
 
   // Reference, Pointer
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink* rhs)
   {
     if (rhs != ETL_NULLPTR)
@@ -387,7 +656,7 @@ namespace etl
 
   // Pointer, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link(TLink* lhs, TLink& rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -400,7 +669,7 @@ namespace etl
 
   // Pointer, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink& rhs)
   {
     if (lhs != ETL_NULLPTR)
@@ -423,7 +692,7 @@ namespace etl
 
   // Reference, Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink& lhs, TLink& first, TLink& last)
   {
     last.etl_next = lhs.etl_next;
@@ -439,7 +708,7 @@ namespace etl
 
   // Pointer, Reference, Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   link_splice(TLink* lhs, TLink& first, TLink& last)
   {
     if (lhs != ETL_NULLPTR)
@@ -466,7 +735,7 @@ namespace etl
 
   // Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   unlink(TLink& node)
   {
     node.unlink();
@@ -474,7 +743,7 @@ namespace etl
 
   // Reference Reference
   template <typename TLink>
-  typename etl::enable_if<etl::is_same<TLink, etl::bidirectional_link<TLink::ID> >::value, void>::type
+  typename etl::enable_if<etl::is_bidirectional_link<TLink>::value, void>::type
   unlink(TLink& first, TLink& last)
   {
     if (&first == &last)
@@ -405,7 +405,7 @@ namespace etl
       iterator& operator ++()
       {
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return *this;
       }
 
@@ -413,14 +413,14 @@ namespace etl
       {
         iterator temp(*this);
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return temp;
       }
 
       iterator& operator --()
       {
         // Read the appropriate 'etl_previous'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_previous);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_previous));
         return *this;
       }
 
@@ -428,7 +428,7 @@ namespace etl
       {
         iterator temp(*this);
         // Read the appropriate 'etl_previous'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_previous);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_previous));
         return temp;
       }
 
@@ -500,7 +500,7 @@ namespace etl
       const_iterator& operator ++()
       {
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return *this;
       }
 
@@ -508,14 +508,14 @@ namespace etl
       {
         const_iterator temp(*this);
         // Read the appropriate 'etl_next'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_next);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_next));
         return temp;
       }
 
       const_iterator& operator --()
       {
         // Read the appropriate 'etl_previous'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_previous);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_previous));
         return *this;
       }
 
@@ -523,7 +523,7 @@ namespace etl
       {
         const_iterator temp(*this);
         // Read the appropriate 'etl_previous'.
-        p_value = static_cast<value_type*>(p_value->link_type::etl_previous);
+        p_value = static_cast<value_type*>(static_cast<link_type*>(p_value->link_type::etl_previous));
         return temp;
       }
 
@@ -1046,7 +1046,7 @@ namespace etl
           // Find the place to insert.
           while ((this_begin != this_end) && !(compare(*other_begin, *this_begin)))
           {
-            this_begin = static_cast<value_type*>(this_begin->link_type::etl_next);
+            this_begin = static_cast<value_type*>(static_cast<link_type*>(this_begin->link_type::etl_next));
           }
 
           // Insert.
@@ -1055,7 +1055,7 @@ namespace etl
             while ((other_begin != other_end) && (compare(*other_begin, *this_begin)))
             {
               value_type* value = other_begin;
-              other_begin = static_cast<value_type*>(other_begin->link_type::etl_next);
+              other_begin = static_cast<value_type*>(static_cast<link_type*>(other_begin->link_type::etl_next));
               etl::link_splice<link_type>(*this_begin->link_type::etl_previous, *value);
             }
           }
@@ -0,0 +1,376 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_PTR_INCLUDED
+#define ETL_INTRUSIVE_PTR_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "utility.h"
+
+///\defgroup intrusive_ptr intrusive_ptr
+/// A smart pointer to an object that holds its own reference count.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// A smart pointer to an object that holds its own reference count.
+  /// The count is changed by calling intrusive_ptr_add_ref(T*) and
+  /// intrusive_ptr_release(T*), which are found by argument dependent lookup.
+  /// Deriving T from etl::intrusive_reference_counted provides them.
+  /// There are no virtual calls and, with a plain integer counter, no atomic
+  /// operations.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename T>
+  class intrusive_ptr
+  {
+  public:
+
+    typedef T element_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    intrusive_ptr()
+      : p_object(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer.
+    /// Adds a reference unless add_ref is false, when the pointer is adopted.
+    //*************************************************************************
+    intrusive_ptr(T* p_object_, bool add_ref = true)
+      : p_object(p_object_)
+    {
+      if ((p_object != ETL_NULLPTR) && add_ref)
+      {
+        intrusive_ptr_add_ref(p_object);
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    intrusive_ptr(const intrusive_ptr& other)
+      : p_object(other.p_object)
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        intrusive_ptr_add_ref(p_object);
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor from a pointer to a derived type.
+    //*************************************************************************
+    template <typename U>
+    intrusive_ptr(const intrusive_ptr<U>& other)
+      : p_object(other.get())
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        intrusive_ptr_add_ref(p_object);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    intrusive_ptr(intrusive_ptr&& other)
+      : p_object(other.p_object)
+    {
+      other.p_object = ETL_NULLPTR;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_ptr()
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        intrusive_ptr_release(p_object);
+      }
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    intrusive_ptr& operator =(const intrusive_ptr& other)
+    {
+      intrusive_ptr(other).swap(*this);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    intrusive_ptr& operator =(intrusive_ptr&& other)
+    {
+      intrusive_ptr(etl::move(other)).swap(*this);
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Assign a pointer, adding a reference.
+    //*************************************************************************
+    intrusive_ptr& operator =(T* p_other)
+    {
+      intrusive_ptr(p_other).swap(*this);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Releases the object.
+    //*************************************************************************
+    void reset()
+    {
+      intrusive_ptr().swap(*this);
+    }
+
+    //*************************************************************************
+    /// Releases the object and points to another.
+    //*************************************************************************
+    void reset(T* p_other, bool add_ref = true)
+    {
+      intrusive_ptr(p_other, add_ref).swap(*this);
+    }
+
+    //*************************************************************************
+    /// Returns the pointer without releasing the reference.
+    //*************************************************************************
+    T* detach()
+    {
+      T* p = p_object;
+      p_object = ETL_NULLPTR;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Gets the pointer.
+    //*************************************************************************
+    T* get() const
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    /// Dereference operator.
+    //*************************************************************************
+    T& operator *() const
+    {
+      return *p_object;
+    }
+
+    //*************************************************************************
+    /// Pointer operator.
+    //*************************************************************************
+    T* operator ->() const
+    {
+      return p_object;
+    }
+
+    //*************************************************************************
+    /// True if not null.
+    //*************************************************************************
+    ETL_EXPLICIT operator bool() const
+    {
+      return p_object != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Swaps with another.
+    //*************************************************************************
+    void swap(intrusive_ptr& other)
+    {
+      T* p = p_object;
+      p_object = other.p_object;
+      other.p_object = p;
+    }
+
+  private:
+
+    T* p_object;
+  };
+
+  //***************************************************************************
+  /// Comparison operators.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename T, typename U>
+  bool operator ==(const etl::intrusive_ptr<T>& lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs.get() == rhs.get();
+  }
+
+  template <typename T, typename U>
+  bool operator !=(const etl::intrusive_ptr<T>& lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs.get() != rhs.get();
+  }
+
+  template <typename T, typename U>
+  bool operator ==(const etl::intrusive_ptr<T>& lhs, U* rhs)
+  {
+    return lhs.get() == rhs;
+  }
+
+  template <typename T, typename U>
+  bool operator !=(const etl::intrusive_ptr<T>& lhs, U* rhs)
+  {
+    return lhs.get() != rhs;
+  }
+
+  template <typename T, typename U>
+  bool operator ==(T* lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs == rhs.get();
+  }
+
+  template <typename T, typename U>
+  bool operator !=(T* lhs, const etl::intrusive_ptr<U>& rhs)
+  {
+    return lhs != rhs.get();
+  }
+
+  template <typename T>
+  bool operator <(const etl::intrusive_ptr<T>& lhs, const etl::intrusive_ptr<T>& rhs)
+  {
+    return lhs.get() < rhs.get();
+  }
+
+  //***************************************************************************
+  /// Swaps two intrusive_ptr.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename T>
+  void swap(etl::intrusive_ptr<T>& lhs, etl::intrusive_ptr<T>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  //***************************************************************************
+  /// A base for objects used with etl::intrusive_ptr.
+  /// Holds the count and provides intrusive_ptr_add_ref and
+  /// intrusive_ptr_release. When the last reference is released
+  /// TDerived::release() is called, for example to return the object to a pool.
+  /// The count is not copied when the object is.
+  ///\tparam TDerived The derived type.
+  ///\tparam TCounter The counter type. A plain integer for objects used by one
+  ///                 thread, or an atomic type such as etl::atomic_int32_t.
+  ///\ingroup intrusive_ptr
+  //***************************************************************************
+  template <typename TDerived, typename TCounter = int32_t>
+  class intrusive_reference_counted
+  {
+  public:
+
+    typedef TCounter counter_type;
+
+    //*************************************************************************
+    /// Gets the current reference count.
+    //*************************************************************************
+    int32_t get_reference_count() const
+    {
+      return int32_t(reference_count);
+    }
+
+    //*************************************************************************
+    /// Adds a reference.
+    //*************************************************************************
+    friend void intrusive_ptr_add_ref(const TDerived* p)
+    {
+      ++static_cast<const intrusive_reference_counted*>(p)->reference_count;
+    }
+
+    //*************************************************************************
+    /// Releases a reference, calling TDerived::release() for the last one.
+    //*************************************************************************
+    friend void intrusive_ptr_release(const TDerived* p)
+    {
+      if (--static_cast<const intrusive_reference_counted*>(p)->reference_count == 0)
+      {
+        const_cast<TDerived*>(p)->release();
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_reference_counted()
+      : reference_count(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. The count is not copied.
+    //*************************************************************************
+    intrusive_reference_counted(const intrusive_reference_counted&)
+      : reference_count(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Assignment. The count is not copied.
+    //*************************************************************************
+    intrusive_reference_counted& operator =(const intrusive_reference_counted&)
+    {
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~intrusive_reference_counted()
+    {
+    }
+
+  private:
+
+    mutable TCounter reference_count;
+  };
+}
+
+#endif
@@ -0,0 +1,205 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+#define ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "intrusive_links.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup intrusive_queue_mpsc_atomic intrusive_queue_mpsc_atomic
+/// An intrusive queue that any number of producers may push to, and one
+/// consumer pops from, without a lock.
+/// Based on Dmitry Vyukov's intrusive MPSC node based queue.
+/// A push is one exchange and one store, and never waits. A pop never waits,
+/// but may return ETL_NULLPTR while a producer is part way through a push,
+/// even though the queue is not empty. The object is then returned by a later
+/// pop, once the push has completed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_queue_mpsc_atomic
+  /// A lock free intrusive multiple producer, single consumer queue.
+  /// \tparam TValue The type of the objects. Must be derived from TLink.
+  /// \tparam TLink  The link type. An etl::atomic_forward_link.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_queue_mpsc_atomic
+  {
+  public:
+
+    typedef TValue        value_type;
+    typedef TLink         link_type;
+    typedef TValue*       pointer;
+    typedef const TValue* const_pointer;
+    typedef size_t        size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    intrusive_queue_mpsc_atomic()
+      : p_back(&stub),
+        p_front(&stub)
+    {
+    }
+
+    //*************************************************************************
+    /// Pushes an object to the back of the queue.
+    /// May be called by any number of producers at the same time.
+    /// The object must not already be in the queue.
+    //*************************************************************************
+    void push(value_type& value)
+    {
+      push_link(static_cast<link_type&>(value));
+    }
+
+    //*************************************************************************
+    /// Pops the object from the front of the queue.
+    /// Must only be called by the consumer.
+    /// \return A pointer to the object, or ETL_NULLPTR if the queue is empty
+    /// or the next object's push has not yet completed.
+    //*************************************************************************
+    pointer pop()
+    {
+      link_type* p_link = p_front;
+      link_type* p_next = next_of(p_link);
+
+      // Step over the stub.
+      if (p_link == &stub)
+      {
+        if (p_next == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        p_front = p_next;
+        p_link  = p_next;
+        p_next  = next_of(p_next);
+      }
+
+      if (p_next != ETL_NULLPTR)
+      {
+        p_front = p_next;
+        return to_value(p_link);
+      }
+
+      // A producer has taken the back, but not yet linked to it.
+      if (p_link != p_back.load(etl::memory_order_acquire))
+      {
+        return ETL_NULLPTR;
+      }
+
+      // The object is the last in the queue.
+      // Push the stub behind it, so that it can be removed.
+      push_link(stub);
+
+      p_next = next_of(p_link);
+
+      if (p_next != ETL_NULLPTR)
+      {
+        p_front = p_next;
+        return to_value(p_link);
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    /// Must only be called by the consumer.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (p_front == &stub) && (next_of(&stub) == ETL_NULLPTR);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Links to the back of the queue.
+    //*************************************************************************
+    void push_link(link_type& link)
+    {
+      link.etl_next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+      link_type* p_previous = p_back.exchange(&link, etl::memory_order_acq_rel);
+
+      // Until this store, the consumer cannot see the object.
+      p_previous->etl_next.store(&link, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// The next link.
+    //*************************************************************************
+    static link_type* next_of(const link_type* p_link)
+    {
+      return static_cast<link_type*>(p_link->etl_next.load(etl::memory_order_acquire));
+    }
+
+    //*************************************************************************
+    /// The object with the link.
+    //*************************************************************************
+    static pointer to_value(link_type* p_link)
+    {
+      return static_cast<pointer>(p_link);
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_queue_mpsc_atomic(const intrusive_queue_mpsc_atomic&);
+    intrusive_queue_mpsc_atomic& operator =(const intrusive_queue_mpsc_atomic&);
+
+    // The back, which every producer writes, is kept on a separate cache line
+    // from the consumer's members when ETL_CACHE_LINE_SIZE is defined.
+
+    etl::atomic<link_type*> p_back;  ///< The last link pushed.
+#if ETL_CACHE_LINE_SIZE > 0
+    char back_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    link_type* p_front;              ///< The next link to pop. Only used by the consumer.
+    link_type  stub;                 ///< Keeps the queue from ever being unlinked.
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,258 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_STACK_ATOMIC_INCLUDED
+#define ETL_INTRUSIVE_STACK_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "intrusive_links.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup intrusive_stack_atomic intrusive_stack_atomic
+/// An intrusive stack that may be shared between threads, cores and ISRs
+/// without a lock.
+/// The objects that may be pushed are held in an array given to the stack.
+/// The top of the stack is held as the index of the object in the array,
+/// with a tag that changes on every push and pop, so that a compare and swap
+/// cannot succeed on a top that was popped and then pushed again (ABA).
+/// The index and the tag each take half of a size_t, which limits the array
+/// to 65534 objects when size_t is 32 bits.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for intrusive_stack_atomic
+  ///\ingroup intrusive_stack_atomic
+  //***************************************************************************
+  class intrusive_stack_atomic_exception : public etl::exception
+  {
+  public:
+
+    intrusive_stack_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The object is not in the stack's array.
+  ///\ingroup intrusive_stack_atomic
+  //***************************************************************************
+  class intrusive_stack_atomic_not_in_buffer : public intrusive_stack_atomic_exception
+  {
+  public:
+
+    intrusive_stack_atomic_not_in_buffer(string_type file_name_, numeric_type line_number_)
+      : intrusive_stack_atomic_exception(ETL_ERROR_TEXT("intrusive_stack_atomic:not in buffer", ETL_INTRUSIVE_STACK_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The array is too large for the index.
+  ///\ingroup intrusive_stack_atomic
+  //***************************************************************************
+  class intrusive_stack_atomic_buffer_too_large : public intrusive_stack_atomic_exception
+  {
+  public:
+
+    intrusive_stack_atomic_buffer_too_large(string_type file_name_, numeric_type line_number_)
+      : intrusive_stack_atomic_exception(ETL_ERROR_TEXT("intrusive_stack_atomic:buffer too large", ETL_INTRUSIVE_STACK_ATOMIC_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup intrusive_stack_atomic
+  /// A lock free intrusive stack.
+  /// Any number of threads may push and pop at the same time.
+  /// \tparam TValue The type of the objects. Must be derived from TLink.
+  /// \tparam TLink  The link type. An etl::atomic_forward_link.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_stack_atomic
+  {
+  public:
+
+    typedef TValue        value_type;
+    typedef TLink         link_type;
+    typedef TValue*       pointer;
+    typedef const TValue* const_pointer;
+    typedef size_t        size_type;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param p_buffer_ The array of objects that may be pushed.
+    /// \param size_     The number of objects in the array.
+    //*************************************************************************
+    intrusive_stack_atomic(TValue* p_buffer_, size_t size_)
+      : p_buffer(p_buffer_),
+        Max_Size(size_),
+        top(No_Index)
+    {
+      ETL_ASSERT(size_ < No_Index, ETL_ERROR(intrusive_stack_atomic_buffer_too_large));
+    }
+
+    //*************************************************************************
+    /// Pushes an object on to the stack.
+    /// The object must be in the stack's array and not already in the stack.
+    /// If asserts or exceptions are enabled, emits intrusive_stack_atomic_not_in_buffer
+    /// if it is not in the array.
+    //*************************************************************************
+    void push(value_type& value)
+    {
+      ETL_ASSERT_AND_RETURN(is_in_buffer(&value), ETL_ERROR(intrusive_stack_atomic_not_in_buffer));
+
+      link_type& link = static_cast<link_type&>(value);
+
+      const size_t index = size_t(&value - p_buffer);
+
+      size_t current_top = top.load(etl::memory_order_relaxed);
+      size_t next_top;
+
+      do
+      {
+        link.etl_next.store(link_of(current_top & Index_Mask), etl::memory_order_relaxed);
+        next_top = ((current_top + Tag_Increment) & ~Index_Mask) | index;
+      } while (!top.compare_exchange_weak(current_top, next_top, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Pops the object from the top of the stack.
+    /// \return A pointer to the object, or ETL_NULLPTR if the stack was empty.
+    //*************************************************************************
+    pointer pop()
+    {
+      size_t current_top = top.load(etl::memory_order_acquire);
+
+      while (true)
+      {
+        const size_t index = current_top & Index_Mask;
+
+        if (index == No_Index)
+        {
+          return ETL_NULLPTR;
+        }
+
+        // The link may be stale if another thread pops and pushes the object
+        // while it is read. The tag then makes the exchange fail.
+        link_type* p_next = static_cast<link_type*>(static_cast<link_type&>(p_buffer[index]).etl_next.load(etl::memory_order_relaxed));
+
+        const size_t next_top = ((current_top + Tag_Increment) & ~Index_Mask) | index_of(p_next);
+
+        if (top.compare_exchange_weak(current_top, next_top, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return p_buffer + index;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Checks to see if the stack is empty.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (top.load(etl::memory_order_relaxed) & Index_Mask) == No_Index;
+    }
+
+    //*************************************************************************
+    /// The number of objects in the stack's array.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the object is in the stack's array.
+    //*************************************************************************
+    bool is_in_buffer(const_pointer p_value) const
+    {
+      const uintptr_t p     = uintptr_t(p_value);
+      const uintptr_t first = uintptr_t(p_buffer);
+      const uintptr_t last  = uintptr_t(p_buffer + Max_Size);
+
+      return (p >= first) && (p < last);
+    }
+
+  private:
+
+    /// The index and the tag each take half of the top.
+    static ETL_CONSTANT size_t Index_Bits    = etl::integral_limits<size_t>::bits / 2;
+    static ETL_CONSTANT size_t Index_Mask    = (size_t(1) << Index_Bits) - 1;
+    static ETL_CONSTANT size_t Tag_Increment = size_t(1) << Index_Bits;
+
+    /// The index that marks an empty stack.
+    static ETL_CONSTANT size_t No_Index = Index_Mask;
+
+    //*************************************************************************
+    /// The link of the object at the index, or ETL_NULLPTR.
+    //*************************************************************************
+    link_type* link_of(size_t index) const
+    {
+      return (index == No_Index) ? ETL_NULLPTR : &static_cast<link_type&>(p_buffer[index]);
+    }
+
+    //*************************************************************************
+    /// The index of the object with the link, or No_Index.
+    //*************************************************************************
+    size_t index_of(link_type* p_link) const
+    {
+      return (p_link == ETL_NULLPTR) ? No_Index : size_t(static_cast<TValue*>(p_link) - p_buffer);
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_stack_atomic(const intrusive_stack_atomic&);
+    intrusive_stack_atomic& operator =(const intrusive_stack_atomic&);
+
+    TValue* const       p_buffer;
+    const size_t        Max_Size;
+    etl::atomic<size_t> top;      ///< The tag and the index of the top object.
+  };
+}
+
+#endif
+
+#endif
@@ -41,10 +41,63 @@ SOFTWARE.
 #include "nullptr.h"
 #include "iterator.h"
 
-#include "iterator.h"
+#include <stddef.h>
 
 namespace etl
 {
+  namespace private_io_port
+  {
+    //*************************************************************************
+    /// Reads n values from the same port, as from a peripheral FIFO.
+    /// Unrolled by four. The accesses are volatile, so they are all made, in
+    /// order.
+    //*************************************************************************
+    template <typename T>
+    void read_fifo(volatile const T* address, T* buffer, size_t n)
+    {
+      while (n >= 4U)
+      {
+        buffer[0] = *address;
+        buffer[1] = *address;
+        buffer[2] = *address;
+        buffer[3] = *address;
+        buffer += 4U;
+        n      -= 4U;
+      }
+
+      while (n != 0U)
+      {
+        *buffer++ = *address;
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes n values to the same port, as to a peripheral FIFO.
+    /// Unrolled by four. The accesses are volatile, so they are all made, in
+    /// order.
+    //*************************************************************************
+    template <typename T>
+    void write_fifo(volatile T* address, const T* buffer, size_t n)
+    {
+      while (n >= 4U)
+      {
+        *address = buffer[0];
+        *address = buffer[1];
+        *address = buffer[2];
+        *address = buffer[3];
+        buffer += 4U;
+        n      -= 4U;
+      }
+
+      while (n != 0U)
+      {
+        *address = *buffer++;
+        --n;
+      }
+    }
+  }
+
   //***************************************************************************
   /// Read write port.
   //***************************************************************************
@@ -70,12 +123,24 @@ namespace etl
       return *reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Read n values into a buffer.
+    void read(T* buffer_, size_t n_) const
+    {
+      private_io_port::read_fifo(reinterpret_cast<const_pointer>(ADDRESS), buffer_, n_);
+    }
+
     /// Write.
     void write(T value_)
     {
       *reinterpret_cast<pointer>(ADDRESS) = value_;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      private_io_port::write_fifo(reinterpret_cast<pointer>(ADDRESS), buffer_, n_);
+    }
+
     /// Write.
     io_port_rw& operator =(T value_)
     {
@@ -150,6 +215,12 @@ namespace etl
       return *reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Read n values into a buffer.
+    void read(T* buffer_, size_t n_) const
+    {
+      private_io_port::read_fifo(reinterpret_cast<const_pointer>(ADDRESS), buffer_, n_);
+    }
+
     /// Read
     const_reference operator *() const
     {
@@ -214,6 +285,12 @@ namespace etl
       *reinterpret_cast<pointer>(ADDRESS) = value_;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      private_io_port::write_fifo(reinterpret_cast<pointer>(ADDRESS), buffer_, n_);
+    }
+
     /// Write
     io_port_wo& operator *()
     {
@@ -291,6 +368,16 @@ namespace etl
       *reinterpret_cast<pointer>(ADDRESS) = shadow_value;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      if (n_ != 0U)
+      {
+        private_io_port::write_fifo(reinterpret_cast<pointer>(ADDRESS), buffer_, n_);
+        shadow_value = buffer_[n_ - 1U];
+      }
+    }
+
     /// Write.
     io_port_wos& operator =(T value_)
     {
@@ -406,12 +493,24 @@ namespace etl
       return *address;
     }
 
+    /// Read n values into a buffer.
+    void read(T* buffer_, size_t n_) const
+    {
+      private_io_port::read_fifo(address, buffer_, n_);
+    }
+
     /// Write.
     void write(T value_)
     {
       *address = value_;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      private_io_port::write_fifo(address, buffer_, n_);
+    }
+
     /// Write.
     io_port_rw& operator =(T value_)
     {
@@ -511,6 +610,12 @@ namespace etl
       return *address;
     }
 
+    /// Read n values into a buffer.
+    void read(T* buffer_, size_t n_) const
+    {
+      private_io_port::read_fifo(address, buffer_, n_);
+    }
+
     /// Read
     const_reference operator *() const
     {
@@ -600,6 +705,12 @@ namespace etl
       *address = value_;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      private_io_port::write_fifo(address, buffer_, n_);
+    }
+
     /// Write.
     void operator =(T value)
     {
@@ -773,6 +884,16 @@ namespace etl
       *address = shadow_value;
     }
 
+    /// Write n values from a buffer.
+    void write(const T* buffer_, size_t n_)
+    {
+      if (n_ != 0U)
+      {
+        private_io_port::write_fifo(address, buffer_, n_);
+        shadow_value = buffer_[n_ - 1U];
+      }
+    }
+
     /// Write.
     io_port_wos& operator =(T value_)
     {
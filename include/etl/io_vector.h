@@ -0,0 +1,298 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IO_VECTOR_INCLUDED
+#define ETL_IO_VECTOR_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "file_error_numbers.h"
+
+#if ETL_CPP11_SUPPORTED
+
+//*****************************************************************************
+///\defgroup io_vector io_vector
+/// A fixed capacity list of byte ranges, for scatter/gather I/O.
+/// A frame may be described as a header, a payload and a trailer in separate
+/// buffers and sent, or checked, without copying them together.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the io_vector.
+  ///\ingroup io_vector
+  //***************************************************************************
+  class io_vector_exception : public etl::exception
+  {
+  public:
+
+    io_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the io_vector.
+  ///\ingroup io_vector
+  //***************************************************************************
+  class io_vector_full : public etl::io_vector_exception
+  {
+  public:
+
+    io_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::io_vector_exception(ETL_ERROR_TEXT("io_vector:full", ETL_IO_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the io_vector.
+  ///\ingroup io_vector
+  //***************************************************************************
+  class io_vector_out_of_bounds : public etl::io_vector_exception
+  {
+  public:
+
+    io_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::io_vector_exception(ETL_ERROR_TEXT("io_vector:bounds", ETL_IO_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A list of up to N byte ranges.
+  ///\tparam N The maximum number of ranges.
+  ///\ingroup io_vector
+  //***************************************************************************
+  template <size_t N>
+  class io_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N != 0U, "io_vector must have a capacity of at least one");
+
+    typedef etl::span<const uint8_t> value_type;
+    typedef size_t                   size_type;
+    typedef const value_type&        const_reference;
+    typedef const value_type*        const_iterator;
+
+    static ETL_CONSTANT size_t MAX_SIZE = N;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    io_vector()
+      : current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Appends a range.
+    /// Returns a reference to this io_vector, so that appends can be chained.
+    /// If asserts or exceptions are enabled, emits an io_vector_full if full.
+    //*************************************************************************
+    io_vector& append(value_type range)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(io_vector_full), *this);
+
+      ranges[current_size++] = range;
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Appends a range from a pointer and a length.
+    //*************************************************************************
+    io_vector& append(const void* data, size_t length)
+    {
+      return append(value_type(static_cast<const uint8_t*>(data), length));
+    }
+
+    //*************************************************************************
+    /// Appends the first 'length' bytes of a buffer described by a descriptor,
+    /// such as etl::buffer_descriptors::descriptor.
+    /// If asserts or exceptions are enabled, emits an io_vector_out_of_bounds
+    /// if 'length' is larger than the buffer.
+    //*************************************************************************
+    template <typename TDescriptor>
+    typename etl::enable_if<etl::is_class<TDescriptor>::value, io_vector&>::type
+      append(const TDescriptor& desc, size_t length)
+    {
+      ETL_STATIC_ASSERT(sizeof(*desc.data()) == 1U, "Descriptor buffers must be byte sized");
+      ETL_ASSERT_AND_RETURN_VALUE(length <= desc.max_size(), ETL_ERROR(io_vector_out_of_bounds), *this);
+
+      return append(value_type(reinterpret_cast<const uint8_t*>(desc.data()), length));
+    }
+
+    //*************************************************************************
+    /// Appends a range.
+    /// If asserts or exceptions are enabled, emits an io_vector_full if full.
+    //*************************************************************************
+    void push_back(value_type range)
+    {
+      append(range);
+    }
+
+    //*************************************************************************
+    /// Removes all of the ranges.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the range at an index.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return ranges[i];
+    }
+
+    //*************************************************************************
+    /// Iterators over the ranges.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return ranges;
+    }
+
+    const_iterator end() const
+    {
+      return ranges + current_size;
+    }
+
+    //*************************************************************************
+    /// The number of ranges.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The maximum number of ranges.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return N;
+    }
+
+    //*************************************************************************
+    /// True if there are no ranges.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// True if no more ranges can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == N;
+    }
+
+    //*************************************************************************
+    /// The total number of bytes in all of the ranges.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        total += ranges[i].size();
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Gathers the ranges into one buffer.
+    /// Copies at most 'length' bytes and returns the number copied.
+    //*************************************************************************
+    size_t copy_to(void* destination, size_t length) const
+    {
+      uint8_t* p     = static_cast<uint8_t*>(destination);
+      size_t   total = 0U;
+
+      for (size_t i = 0U; (i < current_size) && (total < length); ++i)
+      {
+        size_t n = ranges[i].size();
+
+        if (n > (length - total))
+        {
+          n = length - total;
+        }
+
+        if (n != 0U)
+        {
+          memcpy(p + total, ranges[i].data(), n);
+          total += n;
+        }
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Gathers the ranges into a span.
+    /// Returns the number of bytes copied.
+    //*************************************************************************
+    size_t copy_to(etl::span<uint8_t> destination) const
+    {
+      return copy_to(destination.data(), destination.size());
+    }
+
+  private:
+
+    value_type ranges[N];
+    size_t     current_size;
+  };
+
+  template <size_t N>
+  ETL_CONSTANT size_t io_vector<N>::MAX_SIZE;
+}
+
+#endif
+#endif
@@ -38,6 +38,8 @@ SOFTWARE.
 #include "utility.h"
 #include "memory.h"
 #include "placement_new.h"
+#include "pool_statistics.h"
+#include "trace.h"
 
 #define ETL_POOL_CPP03_CODE 0
 
@@ -120,6 +122,18 @@ namespace etl
       return reinterpret_cast<T*>(allocate_item());
     }
 
+    //*************************************************************************
+    /// Allocate storage for an object from the pool, without checking the
+    /// size of 'T' or that the pool has a free item.
+    /// For loops that have already checked available().
+    /// Undefined behaviour if the pool is empty or 'T' is too large.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_unchecked()
+    {
+      return reinterpret_cast<T*>(allocate_item_unchecked());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create default.
@@ -242,6 +256,115 @@ namespace etl
       release_item((char*)p);
     }
 
+    //*************************************************************************
+    /// Release an object in the pool, without checking that it belongs to it.
+    /// Undefined behaviour if the object is not from this pool.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release_unchecked(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item_unchecked((char*)p);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to n objects from the pool.
+    /// The items are taken from the free list in one pass; once the free list
+    /// reaches the items that have never been used, the rest of the batch is
+    /// taken from them as a contiguous run, without touching their links.
+    /// Returns the number allocated, which is less than n if the pool runs
+    /// out. Does not assert or throw for a short batch.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** pp_items, size_t n)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+        return 0U;
+      }
+
+      const size_t free_items = size_t(Max_Size - items_allocated);
+      const size_t count      = (n < free_items) ? n : free_items;
+
+      if (count < n)
+      {
+        ETL_POOL_STATISTICS_FAILED
+      }
+
+      char* const p_unused = p_buffer + (items_initialised * Item_Size);
+      size_t i = 0U;
+
+      // Released items.
+      while ((i < count) && (p_next != p_unused))
+      {
+        pp_items[i++] = reinterpret_cast<T*>(p_next);
+        p_next = *reinterpret_cast<char**>(p_next);
+      }
+
+      // Never used items.
+      if (i < count)
+      {
+        const size_t remaining = count - i;
+
+        for (size_t j = 0U; j < remaining; ++j)
+        {
+          pp_items[i++] = reinterpret_cast<T*>(p_unused + (j * Item_Size));
+        }
+
+        items_initialised += uint32_t(remaining);
+        p_next = p_buffer + (items_initialised * Item_Size);
+      }
+
+      items_allocated += uint32_t(count);
+
+      if (items_allocated == Max_Size)
+      {
+        p_next = ETL_NULLPTR;
+      }
+
+      ETL_POOL_STATISTICS_ALLOCATED_N(count)
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Release n objects back to the pool.
+    /// The items are linked together and spliced onto the free list as one
+    /// segment.
+    /// If asserts or exceptions are enabled and any of the objects does not
+    /// belong to the pool then an etl::pool_object_not_in_pool is thrown and
+    /// none are released.
+    //*************************************************************************
+    template <typename T>
+    void release_n(T* const* pp_items, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ETL_ASSERT_AND_RETURN(is_in_pool(pp_items[i]), ETL_ERROR(pool_object_not_in_pool));
+      }
+
+      // Link the items into one segment.
+      for (size_t i = 0U; (i + 1U) < n; ++i)
+      {
+        *(uintptr_t*)pp_items[i] = uintptr_t(pp_items[i + 1U]);
+      }
+
+      // The end of the segment points to the current free item, or null.
+      *(uintptr_t*)pp_items[n - 1U] = reinterpret_cast<uintptr_t>(p_next);
+
+      p_next = (char*)pp_items[0];
+
+      items_allocated -= uint32_t(n);
+
+      ETL_POOL_STATISTICS_RELEASED_N(n)
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
     //*************************************************************************
@@ -250,8 +373,28 @@ namespace etl
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
+
+      ETL_POOL_STATISTICS_RELEASED_ALL
+    }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets the usage statistics of the pool.
+    //*************************************************************************
+    etl::pool_statistics statistics() const
+    {
+      return etl_pool_statistics.get();
     }
 
+    //*************************************************************************
+    /// Clears the counts. The peak restarts from the current size.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      etl_pool_statistics.reset();
+    }
+#endif
+
     //*************************************************************************
     /// Check to see if the object belongs to the pool.
     /// \param p_object A pointer to the object to be checked.
@@ -271,6 +414,14 @@ namespace etl
       return Max_Size;
     }
 
+    //*************************************************************************
+    /// Returns the size of each item in the pool.
+    //*************************************************************************
+    size_t max_item_size() const
+    {
+      return Item_Size;
+    }
+
     //*************************************************************************
     /// Returns the maximum number of items in the pool.
     //*************************************************************************
@@ -313,6 +464,25 @@ namespace etl
       return items_allocated == Max_Size;
     }
 
+    //*************************************************************************
+    /// Returns the number of item slots, from the start of the buffer, that
+    /// have been handed out at least once. Slots at or beyond this index have
+    /// never been written to.
+    //*************************************************************************
+    size_t initialised_size() const
+    {
+      return items_initialised;
+    }
+
+    //*************************************************************************
+    /// Returns the address of the item slot at 'index'.
+    /// The slot may be free or allocated.
+    //*************************************************************************
+    void* item_address(size_t index) const
+    {
+      return p_buffer + (index * Item_Size);
+    }
+
   protected:
 
     //*************************************************************************
@@ -340,35 +510,49 @@ namespace etl
       // Any free space left?
       if (items_allocated < Max_Size)
       {
-        // Initialise another one if necessary.
-        if (items_initialised < Max_Size)
-        {
-          char* p = p_buffer + (items_initialised * Item_Size);
-          char* np = p + Item_Size;
-          *reinterpret_cast<char**>(p) = np;
-          ++items_initialised;
-        }
+        p_value = allocate_item_unchecked();
+      }
+      else
+      {
+        ETL_POOL_STATISTICS_FAILED
+        ETL_TRACE_EVENT(etl::trace_event::Pool_Allocation_Failed, Item_Size, Max_Size)
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
 
-        // Get the address of new allocated item.
-        p_value = p_next;
+      return p_value;
+    }
 
-        ++items_allocated;
-        if (items_allocated != Max_Size)
-        {
-          // Set up the pointer to the next free item
-          p_next = *reinterpret_cast<char**>(p_next);
-        }
-        else
-        {
-          // No more left!
-          p_next = ETL_NULLPTR;
-        }
+    //*************************************************************************
+    /// Allocate an item from the pool, assuming that there is one free.
+    //*************************************************************************
+    char* allocate_item_unchecked()
+    {
+      // Initialise another one if necessary.
+      if (items_initialised < Max_Size)
+      {
+        char* p = p_buffer + (items_initialised * Item_Size);
+        char* np = p + Item_Size;
+        *reinterpret_cast<char**>(p) = np;
+        ++items_initialised;
+      }
+
+      // Get the address of new allocated item.
+      char* p_value = p_next;
+
+      ++items_allocated;
+      if (items_allocated != Max_Size)
+      {
+        // Set up the pointer to the next free item
+        p_next = *reinterpret_cast<char**>(p_next);
       }
       else
       {
-        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        // No more left!
+        p_next = ETL_NULLPTR;
       }
 
+      ETL_POOL_STATISTICS_ALLOCATED
+
       return p_value;
     }
 
@@ -380,6 +564,14 @@ namespace etl
       // Does it belong to us?
       ETL_ASSERT(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
 
+      release_item_unchecked(p_value);
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool, assuming that it belongs to it.
+    //*************************************************************************
+    void release_item_unchecked(char* p_value)
+    {
       if (p_next != ETL_NULLPTR)
       {
         // Point it to the current free item.
@@ -394,6 +586,8 @@ namespace etl
       p_next = p_value;
 
       --items_allocated;
+
+      ETL_POOL_STATISTICS_RELEASED
     }
 
     //*************************************************************************
@@ -429,6 +623,8 @@ namespace etl
     const uint32_t Item_Size;    ///< The size of allocated items.
     const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
 
+    ETL_DECLARE_POOL_STATISTICS
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -77,6 +77,27 @@ namespace etl
       return hash;
     }
 
+    // Tells frame_check_sequence that this policy has an optimised range add.
+    typedef void range_add_supported;
+
+    //*************************************************************************
+    /// Adds a range, checking for finalisation once rather than per value.
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t add(value_type hash, TIterator begin, const TIterator end) const
+    {
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      while (begin != end)
+      {
+        hash += uint8_t(*begin++);
+        hash += (hash << 10);
+        hash ^= (hash >> 6);
+      }
+
+      return hash;
+    }
+
     inline uint32_t final(value_type hash) const
     {
       hash += (hash << 3);
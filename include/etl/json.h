@@ -0,0 +1,1111 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_JSON_INCLUDED
+#define ETL_JSON_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "string.h"
+#include "string_view.h"
+#include "to_string.h"
+#include "format_spec.h"
+
+///\defgroup json json
+/// A streaming JSON writer and a pull tokenizer.
+/// The writer appends straight to an etl::istring. The tokenizer reads a
+/// string_view one token at a time. Neither builds a document tree or
+/// allocates.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_json
+  {
+    //*************************************************************************
+    /// True if the character must be escaped in a JSON string.
+    //*************************************************************************
+    inline bool needs_escape(char c)
+    {
+      return (c == '"') || (c == '\\') || (static_cast<unsigned char>(c) < 0x20U);
+    }
+
+    //*************************************************************************
+    /// The value of a hex digit, or -1.
+    //*************************************************************************
+    inline int hex_value(char c)
+    {
+      if ((c >= '0') && (c <= '9'))
+      {
+        return c - '0';
+      }
+      else if ((c >= 'a') && (c <= 'f'))
+      {
+        return c - 'a' + 10;
+      }
+      else if ((c >= 'A') && (c <= 'F'))
+      {
+        return c - 'A' + 10;
+      }
+
+      return -1;
+    }
+
+    //*************************************************************************
+    /// Reads four hex digits.
+    //*************************************************************************
+    inline bool read_hex4(const char* p, uint32_t& value)
+    {
+      value = 0U;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        const int digit = hex_value(p[i]);
+
+        if (digit < 0)
+        {
+          return false;
+        }
+
+        value = (value << 4U) | uint32_t(digit);
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes JSON text, appending it to a string.
+  /// Commas and colons are added automatically.
+  /// If the string fills up, or the calls do not describe valid JSON, the
+  /// writer stops writing and has_error() returns true.
+  /// Floating point values are written in the shortest form that reads back
+  /// exactly. NaN and infinities, which JSON cannot represent, are written as
+  /// null.
+  ///\ingroup json
+  //***************************************************************************
+  class json_writer
+  {
+  public:
+
+    /// The deepest nesting of objects and arrays.
+    static ETL_CONSTANT size_t Max_Depth = 32U;
+
+    //*************************************************************************
+    /// Constructor. The string is cleared.
+    //*************************************************************************
+    explicit json_writer(etl::istring& text_)
+      : text(text_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Clears the string and starts again.
+    //*************************************************************************
+    void restart()
+    {
+      text.clear();
+      depth       = 0U;
+      is_object   = 0U;
+      has_element = 0U;
+      after_key   = false;
+      error       = false;
+    }
+
+    //*************************************************************************
+    /// Starts an object.
+    //*************************************************************************
+    json_writer& begin_object()
+    {
+      return open('{', true);
+    }
+
+    //*************************************************************************
+    /// Ends an object.
+    //*************************************************************************
+    json_writer& end_object()
+    {
+      return close('}', true);
+    }
+
+    //*************************************************************************
+    /// Starts an array.
+    //*************************************************************************
+    json_writer& begin_array()
+    {
+      return open('[', false);
+    }
+
+    //*************************************************************************
+    /// Ends an array.
+    //*************************************************************************
+    json_writer& end_array()
+    {
+      return close(']', false);
+    }
+
+    //*************************************************************************
+    /// Writes the name of an object member.
+    //*************************************************************************
+    json_writer& key(const etl::string_view& name)
+    {
+      if ((depth == 0U) || !in_object() || after_key)
+      {
+        error = true;
+      }
+      else
+      {
+        separate();
+        put_string(name);
+        put(':');
+        after_key = true;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a string value.
+    //*************************************************************************
+    json_writer& value(const etl::string_view& s)
+    {
+      if (begin_value())
+      {
+        put_string(s);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a string value.
+    //*************************************************************************
+    json_writer& value(const char* s)
+    {
+      return value(etl::string_view(s));
+    }
+
+    //*************************************************************************
+    /// Writes true or false.
+    //*************************************************************************
+    json_writer& value(bool b)
+    {
+      if (begin_value())
+      {
+        b ? put("true", 4U) : put("false", 5U);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes an integral value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, json_writer&>::type
+      value(T n)
+    {
+      if (begin_value())
+      {
+        etl::string<Max_Number_Length> number;
+        etl::to_string(n, number);
+        put(number.data(), number.size());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes a floating point value.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, json_writer&>::type
+      value(T n)
+    {
+      if (begin_value())
+      {
+        if ((n != n) || ((n - n) != (n - n)))
+        {
+          // NaN or infinity.
+          put("null", 4U);
+        }
+        else
+        {
+          etl::string<Max_Number_Length> number;
+          etl::to_string(n, number, etl::format_spec().shortest(true));
+          put(number.data(), number.size());
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes null.
+    //*************************************************************************
+    json_writer& null()
+    {
+      if (begin_value())
+      {
+        put("null", 4U);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes text that is already valid JSON, such as a pre-rendered value.
+    //*************************************************************************
+    json_writer& raw_value(const etl::string_view& json)
+    {
+      if (begin_value())
+      {
+        put(json.data(), json.size());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Writes an object member.
+    //*************************************************************************
+    template <typename T>
+    json_writer& member(const etl::string_view& name, const T& v)
+    {
+      return key(name).value(v);
+    }
+
+    //*************************************************************************
+    /// True once a whole value has been written.
+    //*************************************************************************
+    bool is_complete() const
+    {
+      return !error && (depth == 0U) && !text.empty();
+    }
+
+    //*************************************************************************
+    /// True if the string was too small or the JSON would be invalid.
+    //*************************************************************************
+    bool has_error() const
+    {
+      return error;
+    }
+
+    //*************************************************************************
+    /// The text written so far.
+    //*************************************************************************
+    const etl::istring& str() const
+    {
+      return text;
+    }
+
+  private:
+
+    /// Enough for any integer and the shortest form of any double.
+    static ETL_CONSTANT size_t Max_Number_Length = 32U;
+
+    //*************************************************************************
+    /// The bit for the current depth.
+    //*************************************************************************
+    uint32_t level_bit() const
+    {
+      return uint32_t(1U) << (depth - 1U);
+    }
+
+    //*************************************************************************
+    /// True if the innermost container is an object.
+    //*************************************************************************
+    bool in_object() const
+    {
+      return (is_object & level_bit()) != 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a comma if this is not the first element.
+    //*************************************************************************
+    void separate()
+    {
+      if (depth != 0U)
+      {
+        if ((has_element & level_bit()) != 0U)
+        {
+          put(',');
+        }
+
+        has_element |= level_bit();
+      }
+    }
+
+    //*************************************************************************
+    /// Checks that a value may be written here, and adds a comma if needed.
+    //*************************************************************************
+    bool begin_value()
+    {
+      if (error)
+      {
+        return false;
+      }
+
+      if (depth == 0U)
+      {
+        // Only one value at the top level.
+        error = !text.empty();
+      }
+      else if (after_key)
+      {
+        after_key = false;
+      }
+      else if (in_object())
+      {
+        // A member needs a key.
+        error = true;
+      }
+      else
+      {
+        separate();
+      }
+
+      return !error;
+    }
+
+    //*************************************************************************
+    /// Starts an object or array.
+    //*************************************************************************
+    json_writer& open(char c, bool object)
+    {
+      if (depth == Max_Depth)
+      {
+        error = true;
+      }
+      else if (begin_value())
+      {
+        put(c);
+
+        ++depth;
+        has_element &= ~level_bit();
+
+        if (object)
+        {
+          is_object |= level_bit();
+        }
+        else
+        {
+          is_object &= ~level_bit();
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Ends an object or array.
+    //*************************************************************************
+    json_writer& close(char c, bool object)
+    {
+      if ((depth == 0U) || (in_object() != object) || after_key)
+      {
+        error = true;
+      }
+      else
+      {
+        put(c);
+        --depth;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Appends characters, or sets the error if they do not fit.
+    //*************************************************************************
+    void put(const char* s, size_t length)
+    {
+      if (error || (length > text.available()))
+      {
+        error = true;
+      }
+      else
+      {
+        text.append(s, length);
+      }
+    }
+
+    //*************************************************************************
+    /// Appends a character, or sets the error if it does not fit.
+    //*************************************************************************
+    void put(char c)
+    {
+      if (error || text.full())
+      {
+        error = true;
+      }
+      else
+      {
+        text.push_back(c);
+      }
+    }
+
+    //*************************************************************************
+    /// Appends a quoted, escaped string.
+    /// Runs of characters that need no escaping are appended in one go.
+    //*************************************************************************
+    void put_string(const etl::string_view& s)
+    {
+      static const char hex[] = "0123456789abcdef";
+
+      const char*       p    = s.data();
+      const char* const end  = p + s.size();
+
+      put('"');
+
+      while ((p != end) && !error)
+      {
+        const char* run = p;
+
+        while ((p != end) && !private_json::needs_escape(*p))
+        {
+          ++p;
+        }
+
+        put(run, size_t(p - run));
+
+        if (p != end)
+        {
+          const char c = *p++;
+
+          switch (c)
+          {
+            case '"':  put("\\\"", 2U); break;
+            case '\\': put("\\\\", 2U); break;
+            case '\b': put("\\b", 2U);  break;
+            case '\f': put("\\f", 2U);  break;
+            case '\n': put("\\n", 2U);  break;
+            case '\r': put("\\r", 2U);  break;
+            case '\t': put("\\t", 2U);  break;
+            default:
+            {
+              const char escape[] = { '\\', 'u', '0', '0', hex[(c >> 4) & 0x0F], hex[c & 0x0F] };
+              put(escape, sizeof(escape));
+              break;
+            }
+          }
+        }
+      }
+
+      put('"');
+    }
+
+    etl::istring& text;        ///< The output.
+    size_t        depth;       ///< The nesting depth.
+    uint32_t      is_object;   ///< One bit per level. Set for objects, clear for arrays.
+    uint32_t      has_element; ///< One bit per level. Set once the container has an element.
+    bool          after_key;   ///< True if a key has been written and its value has not.
+    bool          error;       ///< True if the output is unusable.
+  };
+
+  //***************************************************************************
+  /// A token read by json_tokenizer.
+  ///\ingroup json
+  //***************************************************************************
+  struct json_token
+  {
+    enum type_t
+    {
+      Begin_Object,
+      End_Object,
+      Begin_Array,
+      End_Array,
+      Key,
+      String,
+      Number,
+      True,
+      False,
+      Null,
+      End,
+      Error
+    };
+
+    json_token()
+      : type(End)
+      , text()
+      , has_escapes(false)
+    {
+    }
+
+    json_token(type_t type_, const etl::string_view& text_, bool has_escapes_ = false)
+      : type(type_)
+      , text(text_)
+      , has_escapes(has_escapes_)
+    {
+    }
+
+    type_t           type;        ///< What the token is.
+    etl::string_view text;        ///< Keys and strings without quotes or unescaping. Numbers as written.
+    bool             has_escapes; ///< True if a key or string contains escape sequences.
+  };
+
+  //***************************************************************************
+  /// Reads JSON text one token at a time.
+  /// Keys and strings refer to the original text, so nothing is copied. Use
+  /// json_unescape for those with has_escapes set, and etl::to_arithmetic for
+  /// numbers.
+  /// The structure and the lexical form of every token are checked. After the
+  /// first error, next() keeps returning an Error token.
+  ///\ingroup json
+  //***************************************************************************
+  class json_tokenizer
+  {
+  public:
+
+    /// The deepest nesting of objects and arrays.
+    static ETL_CONSTANT size_t Max_Depth = 32U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit json_tokenizer(const etl::string_view& text)
+      : p(text.data())
+      , end(text.data() + text.size())
+      , depth(0U)
+      , is_object(0U)
+      , expect(Expect_Value)
+    {
+    }
+
+    //*************************************************************************
+    /// Reads the next token.
+    /// Returns an End token at the end of a complete value.
+    //*************************************************************************
+    json_token next()
+    {
+      while (true)
+      {
+        skip_whitespace();
+
+        if (expect == Expect_Error)
+        {
+          return json_token(json_token::Error, etl::string_view());
+        }
+
+        if (p == end)
+        {
+          return (expect == Expect_Done) ? json_token(json_token::End, etl::string_view()) : fail();
+        }
+
+        const char c = *p;
+
+        switch (expect)
+        {
+          case Expect_Colon:
+          {
+            if (c != ':')
+            {
+              return fail();
+            }
+
+            ++p;
+            expect = Expect_Value;
+            break;
+          }
+
+          case Expect_Comma_Or_End:
+          {
+            if (c == ',')
+            {
+              ++p;
+              expect = in_object() ? Expect_Key : Expect_Value;
+              break;
+            }
+
+            return close(c);
+          }
+
+          case Expect_Key_Or_End:
+          {
+            return (c == '}') ? close(c) : read_key();
+          }
+
+          case Expect_Key:
+          {
+            return read_key();
+          }
+
+          case Expect_Value_Or_End:
+          {
+            return (c == ']') ? close(c) : read_value();
+          }
+
+          case Expect_Value:
+          {
+            return read_value();
+          }
+
+          default:
+          {
+            // Text after the end of the value.
+            return fail();
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The nesting depth after the last token.
+    //*************************************************************************
+    size_t get_depth() const
+    {
+      return depth;
+    }
+
+  private:
+
+    enum expect_t
+    {
+      Expect_Value,
+      Expect_Value_Or_End,
+      Expect_Key,
+      Expect_Key_Or_End,
+      Expect_Colon,
+      Expect_Comma_Or_End,
+      Expect_Done,
+      Expect_Error
+    };
+
+    //*************************************************************************
+    bool in_object() const
+    {
+      return (is_object & (uint32_t(1U) << (depth - 1U))) != 0U;
+    }
+
+    //*************************************************************************
+    void skip_whitespace()
+    {
+      while ((p != end) && ((*p == ' ') || (*p == '\t') || (*p == '\n') || (*p == '\r')))
+      {
+        ++p;
+      }
+    }
+
+    //*************************************************************************
+    json_token fail()
+    {
+      expect = Expect_Error;
+
+      return json_token(json_token::Error, etl::string_view());
+    }
+
+    //*************************************************************************
+    /// Sets what is expected after a complete value.
+    //*************************************************************************
+    void after_value()
+    {
+      expect = (depth == 0U) ? Expect_Done : Expect_Comma_Or_End;
+    }
+
+    //*************************************************************************
+    json_token close(char c)
+    {
+      const bool object = in_object();
+
+      if ((c != (object ? '}' : ']')))
+      {
+        return fail();
+      }
+
+      ++p;
+      --depth;
+      after_value();
+
+      return json_token(object ? json_token::End_Object : json_token::End_Array, etl::string_view(p - 1, 1U));
+    }
+
+    //*************************************************************************
+    json_token open(bool object)
+    {
+      if (depth == Max_Depth)
+      {
+        return fail();
+      }
+
+      ++p;
+      ++depth;
+
+      const uint32_t bit = uint32_t(1U) << (depth - 1U);
+
+      if (object)
+      {
+        is_object |= bit;
+        expect     = Expect_Key_Or_End;
+      }
+      else
+      {
+        is_object &= ~bit;
+        expect     = Expect_Value_Or_End;
+      }
+
+      return json_token(object ? json_token::Begin_Object : json_token::Begin_Array, etl::string_view(p - 1, 1U));
+    }
+
+    //*************************************************************************
+    json_token read_key()
+    {
+      json_token token = read_string();
+
+      if (token.type == json_token::String)
+      {
+        token.type = json_token::Key;
+        expect     = Expect_Colon;
+      }
+
+      return token;
+    }
+
+    //*************************************************************************
+    json_token read_value()
+    {
+      json_token token;
+
+      switch (*p)
+      {
+        case '{': return open(true);
+        case '[': return open(false);
+        case '"': token = read_string();                               break;
+        case 't': token = read_literal("true", 4U, json_token::True);   break;
+        case 'f': token = read_literal("false", 5U, json_token::False); break;
+        case 'n': token = read_literal("null", 4U, json_token::Null);   break;
+        default:  token = read_number();                               break;
+      }
+
+      if (token.type != json_token::Error)
+      {
+        after_value();
+      }
+
+      return token;
+    }
+
+    //*************************************************************************
+    json_token read_string()
+    {
+      if (*p != '"')
+      {
+        return fail();
+      }
+
+      const char* const start       = ++p;
+      bool              has_escapes = false;
+
+      while (true)
+      {
+        // Skip plain characters.
+        while ((p != end) && !private_json::needs_escape(*p))
+        {
+          ++p;
+        }
+
+        if (p == end)
+        {
+          return fail();
+        }
+
+        const char c = *p;
+
+        if (c == '"')
+        {
+          break;
+        }
+        else if (c == '\\')
+        {
+          has_escapes = true;
+
+          if ((end - p) < 2)
+          {
+            return fail();
+          }
+
+          const char e = p[1];
+
+          if (e == 'u')
+          {
+            uint32_t code;
+
+            if (((end - p) < 6) || !private_json::read_hex4(p + 2, code))
+            {
+              return fail();
+            }
+
+            p += 6;
+          }
+          else if ((e == '"') || (e == '\\') || (e == '/') || (e == 'b') || (e == 'f') || (e == 'n') || (e == 'r') || (e == 't'))
+          {
+            p += 2;
+          }
+          else
+          {
+            return fail();
+          }
+        }
+        else
+        {
+          // Unescaped control character.
+          return fail();
+        }
+      }
+
+      const etl::string_view text(start, size_t(p - start));
+      ++p;
+
+      return json_token(json_token::String, text, has_escapes);
+    }
+
+    //*************************************************************************
+    json_token read_literal(const char* literal, size_t length, json_token::type_t type)
+    {
+      if ((size_t(end - p) < length) || (etl::string_view(p, length) != etl::string_view(literal, length)))
+      {
+        return fail();
+      }
+
+      const etl::string_view text(p, length);
+      p += length;
+
+      return json_token(type, text);
+    }
+
+    //*************************************************************************
+    /// Checks a number against the JSON grammar.
+    /// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+    //*************************************************************************
+    json_token read_number()
+    {
+      const char* const start = p;
+
+      if ((p != end) && (*p == '-'))
+      {
+        ++p;
+      }
+
+      if ((p != end) && (*p == '0'))
+      {
+        ++p;
+      }
+      else if (!skip_digits())
+      {
+        return fail();
+      }
+
+      if ((p != end) && (*p == '.'))
+      {
+        ++p;
+
+        if (!skip_digits())
+        {
+          return fail();
+        }
+      }
+
+      if ((p != end) && ((*p == 'e') || (*p == 'E')))
+      {
+        ++p;
+
+        if ((p != end) && ((*p == '+') || (*p == '-')))
+        {
+          ++p;
+        }
+
+        if (!skip_digits())
+        {
+          return fail();
+        }
+      }
+
+      return json_token(json_token::Number, etl::string_view(start, size_t(p - start)));
+    }
+
+    //*************************************************************************
+    /// Skips one or more digits. Returns false if there were none.
+    //*************************************************************************
+    bool skip_digits()
+    {
+      const char* const start = p;
+
+      while ((p != end) && (*p >= '0') && (*p <= '9'))
+      {
+        ++p;
+      }
+
+      return p != start;
+    }
+
+    const char*       p;         ///< The next character.
+    const char* const end;       ///< The end of the text.
+    size_t            depth;     ///< The nesting depth.
+    uint32_t          is_object; ///< One bit per level. Set for objects, clear for arrays.
+    expect_t          expect;    ///< What may come next.
+  };
+
+  //***************************************************************************
+  /// Decodes the escape sequences in the text of a key or string token,
+  /// appending the result, in UTF-8, to 'out'.
+  /// Returns false if an escape is malformed or 'out' is too small.
+  ///\ingroup json
+  //***************************************************************************
+  inline bool json_unescape(const etl::string_view& text, etl::istring& out)
+  {
+    const char*       p   = text.data();
+    const char* const end = p + text.size();
+
+    while (p != end)
+    {
+      // Append the run up to the next escape.
+      const char* run = p;
+
+      while ((p != end) && (*p != '\\'))
+      {
+        ++p;
+      }
+
+      if (size_t(p - run) > out.available())
+      {
+        return false;
+      }
+
+      out.append(run, size_t(p - run));
+
+      if (p == end)
+      {
+        break;
+      }
+
+      if ((end - p) < 2)
+      {
+        return false;
+      }
+
+      const char e = p[1];
+      p += 2;
+
+      uint32_t code;
+
+      switch (e)
+      {
+        case '"':  code = '"';  break;
+        case '\\': code = '\\'; break;
+        case '/':  code = '/';  break;
+        case 'b':  code = '\b'; break;
+        case 'f':  code = '\f'; break;
+        case 'n':  code = '\n'; break;
+        case 'r':  code = '\r'; break;
+        case 't':  code = '\t'; break;
+        case 'u':
+        {
+          if (((end - p) < 4) || !private_json::read_hex4(p, code))
+          {
+            return false;
+          }
+
+          p += 4;
+
+          if ((code >= 0xD800U) && (code < 0xDC00U))
+          {
+            // A high surrogate must be followed by a low one.
+            uint32_t low;
+
+            if (((end - p) < 6) || (p[0] != '\\') || (p[1] != 'u') || !private_json::read_hex4(p + 2, low) ||
+                (low < 0xDC00U) || (low >= 0xE000U))
+            {
+              return false;
+            }
+
+            p   += 6;
+            code = 0x10000U + ((code - 0xD800U) << 10U) + (low - 0xDC00U);
+          }
+          else if ((code >= 0xDC00U) && (code < 0xE000U))
+          {
+            return false;
+          }
+
+          break;
+        }
+
+        default:
+        {
+          return false;
+        }
+      }
+
+      // Append as UTF-8.
+      char   utf8[4];
+      size_t length;
+
+      if (code < 0x80U)
+      {
+        utf8[0] = char(code);
+        length  = 1U;
+      }
+      else if (code < 0x800U)
+      {
+        utf8[0] = char(0xC0U | (code >> 6U));
+        utf8[1] = char(0x80U | (code & 0x3FU));
+        length  = 2U;
+      }
+      else if (code < 0x10000U)
+      {
+        utf8[0] = char(0xE0U | (code >> 12U));
+        utf8[1] = char(0x80U | ((code >> 6U) & 0x3FU));
+        utf8[2] = char(0x80U | (code & 0x3FU));
+        length  = 3U;
+      }
+      else
+      {
+        utf8[0] = char(0xF0U | (code >> 18U));
+        utf8[1] = char(0x80U | ((code >> 12U) & 0x3FU));
+        utf8[2] = char(0x80U | ((code >> 6U) & 0x3FU));
+        utf8[3] = char(0x80U | (code & 0x3FU));
+        length  = 4U;
+      }
+
+      if (length > out.available())
+      {
+        return false;
+      }
+
+      out.append(utf8, length);
+    }
+
+    return true;
+  }
+}
+
+#endif
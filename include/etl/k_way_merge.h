@@ -0,0 +1,383 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_K_WAY_MERGE_INCLUDED
+#define ETL_K_WAY_MERGE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup k_way_merge k_way_merge
+/// Merges up to a fixed number of sorted runs with a tournament tree.
+/// The tree holds the loser of each match, so replacing the winner replays
+/// only its own path: one comparison per level, log2(K) per element, where a
+/// binary heap needs up to two per level.
+///\ingroup algorithm
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the k_way_merger.
+  ///\ingroup k_way_merge
+  //***************************************************************************
+  class k_way_merge_exception : public etl::exception
+  {
+  public:
+
+    k_way_merge_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the k_way_merger.
+  ///\ingroup k_way_merge
+  //***************************************************************************
+  class k_way_merge_full : public etl::k_way_merge_exception
+  {
+  public:
+
+    k_way_merge_full(string_type file_name_, numeric_type line_number_)
+      : etl::k_way_merge_exception(ETL_ERROR_TEXT("k_way_merge:full", ETL_K_WAY_MERGE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Merges up to MAX_RUNS sorted runs, one element at a time.
+  /// Stable. Equal elements are taken from the run that was added first.
+  /// A run that has been used up may be given more data with 'refill', so
+  /// that streams can be merged continuously as their data arrives.
+  ///\tparam TIterator The iterator type of the runs.
+  ///\tparam MAX_RUNS  The maximum number of runs.
+  ///\tparam TCompare  The comparison. Default = etl::less
+  ///\ingroup k_way_merge
+  //***************************************************************************
+  template <typename TIterator, const size_t MAX_RUNS, typename TCompare = etl::less<typename etl::iterator_traits<TIterator>::value_type> >
+  class k_way_merger
+  {
+    ETL_STATIC_ASSERT(MAX_RUNS > 0U, "MAX_RUNS must be at least one");
+
+  public:
+
+    typedef TIterator                                              iterator;
+    typedef typename etl::iterator_traits<TIterator>::value_type  value_type;
+    typedef typename etl::iterator_traits<TIterator>::reference   reference;
+    typedef TCompare                                               value_compare;
+    typedef size_t                                                 size_type;
+
+    static ETL_CONSTANT size_t Max_Runs = MAX_RUNS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    k_way_merger()
+      : n_runs(0U)
+      , is_built(false)
+      , compare()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with a comparison.
+    //*************************************************************************
+    explicit k_way_merger(const TCompare& compare_)
+      : n_runs(0U)
+      , is_built(false)
+      , compare(compare_)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a sorted run.
+    /// If asserts or exceptions are enabled, emits k_way_merge_full if there
+    /// are already MAX_RUNS runs.
+    ///\return The index of the run.
+    //*************************************************************************
+    size_t add_run(TIterator first, TIterator last)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(n_runs < MAX_RUNS, ETL_ERROR(k_way_merge_full), n_runs);
+
+      current[n_runs] = first;
+      ends[n_runs]    = last;
+      is_built        = false;
+
+      return n_runs++;
+    }
+
+    //*************************************************************************
+    /// Replaces the remaining elements of a run.
+    /// Normally used to give more data to a run that has been used up.
+    /// The new elements must not be less than any already taken from the
+    /// merger, if the output is to stay sorted.
+    //*************************************************************************
+    void refill(size_t run, TIterator first, TIterator last)
+    {
+      current[run] = first;
+      ends[run]    = last;
+      is_built     = false;
+    }
+
+    //*************************************************************************
+    /// Removes all of the runs.
+    //*************************************************************************
+    void clear()
+    {
+      n_runs   = 0U;
+      is_built = false;
+    }
+
+    //*************************************************************************
+    /// The number of runs.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_runs;
+    }
+
+    //*************************************************************************
+    /// Whether a run has been used up.
+    //*************************************************************************
+    bool exhausted(size_t run) const
+    {
+      return current[run] == ends[run];
+    }
+
+    //*************************************************************************
+    /// Returns true if all of the runs have been used up.
+    //*************************************************************************
+    bool empty()
+    {
+      build();
+
+      return (n_runs == 0U) || exhausted(tree[0]);
+    }
+
+    //*************************************************************************
+    /// The smallest remaining element.
+    /// Undefined if the merger is empty.
+    //*************************************************************************
+    reference top()
+    {
+      build();
+
+      return *current[tree[0]];
+    }
+
+    //*************************************************************************
+    /// The index of the run holding the smallest remaining element.
+    /// Undefined if the merger is empty.
+    //*************************************************************************
+    size_t top_run()
+    {
+      build();
+
+      return tree[0];
+    }
+
+    //*************************************************************************
+    /// Removes the smallest remaining element.
+    /// Undefined if the merger is empty.
+    //*************************************************************************
+    void pop()
+    {
+      build();
+
+      const size_t winner = tree[0];
+
+      ++current[winner];
+      replay(winner);
+    }
+
+    //*************************************************************************
+    /// Copies all of the remaining elements, in order, to the output.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator merge(TOutputIterator out)
+    {
+      while (!empty())
+      {
+        *out = *current[tree[0]];
+        ++out;
+        pop();
+      }
+
+      return out;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Whether the head of run a goes before the head of run b.
+    /// Used up runs go after all others. Ties go to the lower run.
+    //*************************************************************************
+    bool before(size_t a, size_t b) const
+    {
+      if (exhausted(a))
+      {
+        return false;
+      }
+
+      if (exhausted(b))
+      {
+        return true;
+      }
+
+      if (compare(*current[b], *current[a]))
+      {
+        return false;
+      }
+
+      return compare(*current[a], *current[b]) || (a < b);
+    }
+
+    //*************************************************************************
+    /// Plays the matches below a node, and returns the winner.
+    /// Nodes 1 to n_runs - 1 are matches; n_runs to 2 * n_runs - 1 are the runs.
+    /// n_runs never exceeds MAX_RUNS; testing both shows the compiler the bound.
+    //*************************************************************************
+    size_t play(size_t node)
+    {
+      if ((node >= n_runs) || (node >= MAX_RUNS))
+      {
+        return node - n_runs;
+      }
+
+      const size_t winner1 = play(2U * node);
+      const size_t winner2 = play((2U * node) + 1U);
+
+      if (before(winner2, winner1))
+      {
+        tree[node] = winner1;
+        return winner2;
+      }
+      else
+      {
+        tree[node] = winner2;
+        return winner1;
+      }
+    }
+
+    //*************************************************************************
+    /// Builds the tree, if the runs have changed.
+    //*************************************************************************
+    void build()
+    {
+      if (!is_built && (n_runs != 0U))
+      {
+        tree[0]  = play(1U);
+        is_built = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Replays the matches from a run to the root, after its head has changed.
+    //*************************************************************************
+    void replay(size_t winner)
+    {
+      for (size_t node = (winner + n_runs) / 2U; (node != 0U) && (node < MAX_RUNS); node /= 2U)
+      {
+        if (before(tree[node], winner))
+        {
+          const size_t loser = winner;
+          winner     = tree[node];
+          tree[node] = loser;
+        }
+      }
+
+      tree[0] = winner;
+    }
+
+    TIterator current[MAX_RUNS];
+    TIterator ends[MAX_RUNS];
+    size_t    tree[MAX_RUNS];   ///< tree[0] is the winner, tree[1..n_runs - 1] the losers.
+    size_t    n_runs;
+    bool      is_built;
+    TCompare  compare;
+  };
+
+  template <typename TIterator, const size_t MAX_RUNS, typename TCompare>
+  ETL_CONSTANT size_t k_way_merger<TIterator, MAX_RUNS, TCompare>::Max_Runs;
+
+  //***************************************************************************
+  /// Merges the sorted runs in a range of iterator pairs to the output.
+  /// Each element of the range has 'first' and 'second' iterators, as
+  /// etl::pair and std::pair do.
+  /// If asserts or exceptions are enabled, emits k_way_merge_full if there
+  /// are more than MAX_RUNS runs.
+  ///\tparam MAX_RUNS The maximum number of runs.
+  ///\ingroup k_way_merge
+  //***************************************************************************
+  template <size_t MAX_RUNS, typename TRunIterator, typename TOutputIterator, typename TCompare>
+  TOutputIterator k_way_merge(TRunIterator runs_first, TRunIterator runs_last, TOutputIterator out, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TRunIterator>::value_type run_t;
+    typedef typename run_t::first_type                               iterator_t;
+
+    etl::k_way_merger<iterator_t, MAX_RUNS, TCompare> merger(compare);
+
+    while (runs_first != runs_last)
+    {
+      merger.add_run(runs_first->first, runs_first->second);
+      ++runs_first;
+    }
+
+    return merger.merge(out);
+  }
+
+  //***************************************************************************
+  /// Merges the sorted runs in a range of iterator pairs to the output.
+  ///\tparam MAX_RUNS The maximum number of runs.
+  ///\ingroup k_way_merge
+  //***************************************************************************
+  template <size_t MAX_RUNS, typename TRunIterator, typename TOutputIterator>
+  TOutputIterator k_way_merge(TRunIterator runs_first, TRunIterator runs_last, TOutputIterator out)
+  {
+    typedef typename etl::iterator_traits<TRunIterator>::value_type run_t;
+    typedef typename run_t::first_type                               iterator_t;
+    typedef typename etl::iterator_traits<iterator_t>::value_type    value_t;
+
+    return etl::k_way_merge<MAX_RUNS>(runs_first, runs_last, out, etl::less<value_t>());
+  }
+}
+
+#endif
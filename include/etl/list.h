@@ -50,6 +50,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "parameter_type.h"
 #include "placement_new.h"
+#include "private/node_handle.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -259,7 +260,8 @@ namespace etl
       }
       else
       {
-        return p_node_pool->size();
+        // Nodes held by node handles are still allocated from the pool.
+        return p_node_pool->size() - extracted_count;
       }
     }
 
@@ -297,7 +299,8 @@ namespace etl
     //*************************************************************************
     bool is_trivial_list() const
     {
-      return (size() < 2);
+      // Not size(), as that has to count the nodes when the pool is shared.
+      return (terminal_node.next == terminal_node.previous);
     }
 
     //*************************************************************************
@@ -351,13 +354,101 @@ namespace etl
       right.previous = &left;
     }
 
+    //*************************************************************************
+    /// Is the address of node 'a' lower than that of node 'b'?
+    //*************************************************************************
+    static bool is_lower_address(const node_t* a, const node_t* b)
+    {
+      return reinterpret_cast<uintptr_t>(a) < reinterpret_cast<uintptr_t>(b);
+    }
+
+    //*************************************************************************
+    /// Sorts a null terminated chain of nodes, linked through 'previous', into
+    /// ascending address order. Returns the new head of the chain.
+    /// Bottom up merge sort, in the same way as ilist::sort.
+    //*************************************************************************
+    static node_t* sort_by_address(node_t* p_head)
+    {
+      size_t chain_size = 1U;
+
+      while (true)
+      {
+        node_t* p_left           = p_head;
+        node_t* p_tail           = ETL_NULLPTR;
+        size_t  number_of_merges = 0U;
+
+        p_head = ETL_NULLPTR;
+
+        while (p_left != ETL_NULLPTR)
+        {
+          ++number_of_merges;
+
+          // Step 'chain_size' places along from left.
+          node_t* p_right   = p_left;
+          size_t  left_size = 0U;
+
+          while ((left_size < chain_size) && (p_right != ETL_NULLPTR))
+          {
+            ++left_size;
+            p_right = p_right->previous;
+          }
+
+          size_t right_size = chain_size;
+
+          // Merge the two chains.
+          while ((left_size > 0U) || ((right_size > 0U) && (p_right != ETL_NULLPTR)))
+          {
+            node_t* p_node;
+
+            if ((left_size == 0U) ||
+                ((right_size > 0U) && (p_right != ETL_NULLPTR) && is_lower_address(p_right, p_left)))
+            {
+              p_node  = p_right;
+              p_right = p_right->previous;
+              --right_size;
+            }
+            else
+            {
+              p_node = p_left;
+              p_left = p_left->previous;
+              --left_size;
+            }
+
+            if (p_tail == ETL_NULLPTR)
+            {
+              p_head = p_node;
+            }
+            else
+            {
+              p_tail->previous = p_node;
+            }
+
+            p_tail = p_node;
+          }
+
+          p_left = p_right;
+        }
+
+        p_tail->previous = ETL_NULLPTR;
+
+        // If we have done only one merge, we're finished.
+        if (number_of_merges <= 1U)
+        {
+          return p_head;
+        }
+
+        chain_size *= 2U;
+      }
+    }
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
     explicit list_base(bool pool_is_shared_)
       : p_node_pool(ETL_NULLPTR),
         MAX_SIZE(0),
-        pool_is_shared(pool_is_shared_)
+        pool_is_shared(pool_is_shared_),
+        extracted_count(0U)
     {
       join(terminal_node, terminal_node);
     }
@@ -368,7 +459,8 @@ namespace etl
     list_base(etl::ipool& node_pool_, size_type   max_size_, bool pool_is_shared_)
       : p_node_pool(&node_pool_),
         MAX_SIZE(max_size_),
-        pool_is_shared(pool_is_shared_)
+        pool_is_shared(pool_is_shared_),
+        extracted_count(0U)
     {
       join(terminal_node, terminal_node);
     }
@@ -401,6 +493,7 @@ namespace etl
     node_t      terminal_node;   ///< The node that acts as the list start and end.
     size_type   MAX_SIZE;        ///< The maximum size of the list.
     bool        pool_is_shared;  ///< If <b>true</b> then the pool is shared between lists.
+    size_type   extracted_count; ///< The number of nodes from an unshared pool held by node handles.
     ETL_DECLARE_DEBUG_COUNT      ///< Internal debugging.
   };
 
@@ -664,6 +757,31 @@ namespace etl
     typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
     typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Owns a node that has been extracted from a list.
+    /// The node can be inserted into any list of the same type. Lists that
+    /// share a pool relink it; otherwise its value is moved into a new node.
+    //*************************************************************************
+    class node_type : public etl::private_node_handle::value_node_handle<T>
+    {
+    public:
+
+      node_type()
+      {
+      }
+
+    private:
+
+      friend class ilist;
+
+      node_type(data_node_t& node, etl::ipool& pool, size_type* p_extracted)
+        : etl::private_node_handle::value_node_handle<T>(&node, &node.value, &pool, p_extracted)
+      {
+      }
+    };
+#endif
+
     //*************************************************************************
     /// Gets the beginning of the list.
     //*************************************************************************
@@ -1097,6 +1215,61 @@ namespace etl
 
       return iterator(data_node);
     }
+
+    //*************************************************************************
+    /// Inserts an extracted node to the list at the specified position.
+    /// If the node came from this list's pool it is relinked, otherwise its
+    /// value is moved into a new node and the old one released.
+    ///\return An iterator to the inserted value, or end() if the node was empty.
+    //*************************************************************************
+    iterator insert(iterator position, node_type&& node)
+    {
+      if (node.empty())
+      {
+        return end();
+      }
+
+      if (node.get_pool() == p_node_pool)
+      {
+        data_node_t& data_node = *static_cast<data_node_t*>(node.release());
+        insert_node(*position.p_node, data_node);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        return iterator(data_node);
+      }
+      else
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(list_full));
+
+        data_node_t& data_node = allocate_data_node(etl::move(node.value()));
+        insert_node(*position.p_node, data_node);
+        node.reset();
+
+        return iterator(data_node);
+      }
+    }
+
+    //*************************************************************************
+    /// Unlinks the element at the specified position and returns ownership of
+    /// its node. The node remains allocated from this list's pool.
+    //*************************************************************************
+    node_type extract(iterator position)
+    {
+      data_node_t& data_node = static_cast<data_node_t&>(*position.p_node);
+
+      join(*data_node.previous, *data_node.next);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      if (has_shared_pool())
+      {
+        return node_type(data_node, *p_node_pool, ETL_NULLPTR);
+      }
+      else
+      {
+        ++extracted_count;
+        return node_type(data_node, *p_node_pool, &extracted_count);
+      }
+    }
 #endif
 
     //*************************************************************************
@@ -1365,8 +1538,15 @@ namespace etl
     {
       if (&other != this)
       {
-        insert(to, other.begin(), other.end());
-        other.erase(other.begin(), other.end());
+        if (other.p_node_pool == p_node_pool)
+        {
+          relink(to, other, other.begin(), other.end());
+        }
+        else
+        {
+          insert(to, other.begin(), other.end());
+          other.erase(other.begin(), other.end());
+        }
       }
     }
 
@@ -1378,6 +1558,12 @@ namespace etl
     {
       if (&other != this)
       {
+        if (other.p_node_pool == p_node_pool)
+        {
+          relink(to, other, other.begin(), other.end());
+          return;
+        }
+
         typename ilist<T>::iterator itr = other.begin();
         while (itr != other.end())
         {
@@ -1399,6 +1585,12 @@ namespace etl
         // Internal move.
         move(to, from);
       }
+      else if (other.p_node_pool == p_node_pool)
+      {
+        // From another list sharing our pool.
+        iterator last = from;
+        relink(to, other, from, ++last);
+      }
       else
       {
         // From another list.
@@ -1418,6 +1610,12 @@ namespace etl
         // Internal move.
         move(to, from);
       }
+      else if (other.p_node_pool == p_node_pool)
+      {
+        // From another list sharing our pool.
+        iterator last = from;
+        relink(to, other, from, ++last);
+      }
       else
       {
         // From another list.
@@ -1437,6 +1635,11 @@ namespace etl
         // Internal move.
         move(to, first, last);
       }
+      else if (other.p_node_pool == p_node_pool)
+      {
+        // From another list sharing our pool.
+        relink(to, other, first, last);
+      }
       else
       {
         // From another list.
@@ -1456,6 +1659,11 @@ namespace etl
         // Internal move.
         move(to, first, last);
       }
+      else if (other.p_node_pool == p_node_pool)
+      {
+        // From another list sharing our pool.
+        relink(to, other, first, last);
+      }
       else
       {
         // From another list.
@@ -1492,6 +1700,12 @@ namespace etl
         ETL_ASSERT(etl::is_sorted(begin(), end(), compare), ETL_ERROR(list_unsorted));
 #endif
 
+        if (other.p_node_pool == p_node_pool)
+        {
+          merge_by_relinking(other, compare);
+          return;
+        }
+
         ilist::iterator other_begin = other.begin();
         ilist::iterator other_end = other.end();
 
@@ -1549,6 +1763,12 @@ namespace etl
         ETL_ASSERT(etl::is_sorted(begin(), end(), compare), ETL_ERROR(list_unsorted));
 #endif
 
+        if (other.p_node_pool == p_node_pool)
+        {
+          merge_by_relinking(other, compare);
+          return;
+        }
+
         ilist::iterator other_begin = other.begin();
         ilist::iterator other_end = other.end();
 
@@ -1588,6 +1808,82 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Rearranges the values so that iterating the list walks forwards through
+    /// memory. After many inserts and erases the nodes of a list end up
+    /// scattered around the pool; this restores the locality of a freshly
+    /// filled list.
+    /// No nodes are allocated or released. The list keeps the same nodes and
+    /// the same sequence of values, but values are swapped between nodes, so
+    /// all iterators, pointers and references are invalidated.
+    /// Only the nodes of this list are touched, so it may be used on lists that
+    /// share a pool. O(N log N) and needs no extra storage.
+    /// T's swap should not throw.
+    //*************************************************************************
+    void compact()
+    {
+      if (is_trivial_list())
+      {
+        return;
+      }
+
+      // Chain the nodes through 'previous', in list order, then sort that chain by address.
+      node_t* p_node = terminal_node.next;
+
+      while (p_node->next != &terminal_node)
+      {
+        p_node->previous = p_node->next;
+        p_node = p_node->next;
+      }
+
+      p_node->previous = ETL_NULLPTR;
+
+      node_t* const p_lowest = sort_by_address(terminal_node.next);
+
+      // MacLaren's in-place rearrangement.
+      // The n'th node in address order receives the n'th value in list order.
+      // A node that has been filled keeps a link in 'next' to where its old value went.
+      using ETL_OR_STD::swap; // Allow ADL
+
+      node_t* p_slot = p_lowest;
+      p_node = terminal_node.next;
+
+      while (p_slot != ETL_NULLPTR)
+      {
+        // Follow the links past the nodes that have already been filled.
+        while (is_lower_address(p_node, p_slot))
+        {
+          p_node = p_node->next;
+        }
+
+        node_t* p_next = p_node->next;
+
+        if (p_node != p_slot)
+        {
+          swap(data_cast(p_node)->value, data_cast(p_slot)->value);
+          p_node->next = p_slot->next;
+          p_slot->next = p_node;
+        }
+
+        p_node = p_next;
+        p_slot = p_slot->previous;
+      }
+
+      // Link the nodes in address order.
+      node_t* p_last = &terminal_node;
+      p_slot = p_lowest;
+
+      while (p_slot != ETL_NULLPTR)
+      {
+        node_t* p_next = p_slot->previous;
+        join(*p_last, *p_slot);
+        p_last = p_slot;
+        p_slot = p_next;
+      }
+
+      join(*p_last, terminal_node);
+    }
+
     //*************************************************************************
     /// Sort using in-place merge sort algorithm.
     /// Uses 'less-than operator as the predicate.
@@ -1794,7 +2090,7 @@ namespace etl
       {
         if (!empty())
         {
-          if (etl::is_trivially_destructible<T>::value && !has_shared_pool())
+          if (etl::is_trivially_destructible<T>::value && !has_shared_pool() && (extracted_count == 0U))
           {
             ETL_ASSERT(p_node_pool != ETL_NULLPTR, ETL_ERROR(list_no_pool));
             p_node_pool->release_all();
@@ -1926,6 +2222,71 @@ namespace etl
       join(final_node, to_node);
     }
 
+    //*************************************************************************
+    /// Moves a range of nodes from another list that shares this list's pool
+    /// to the position before 'to'. The nodes are relinked, not copied.
+    //*************************************************************************
+    void relink(iterator to, ilist& other, iterator first, iterator last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+#if defined(ETL_DEBUG_COUNT)
+      const size_t n = etl::distance(first, last);
+      other.etl_debug_count -= n;
+      ETL_ADD_DEBUG_COUNT(n)
+#else
+      (void)other;
+#endif
+
+      node_t& first_node = *first.p_node;
+      node_t& last_node  = *last.p_node;
+      node_t& to_node    = *to.p_node;
+      node_t& final_node = *last_node.previous;
+
+      // Disconnect the range from the other list.
+      join(*first_node.previous, last_node);
+
+      // Attach it to the new position.
+      join(*to_node.previous, first_node);
+      join(final_node, to_node);
+    }
+
+    //*************************************************************************
+    /// Merges a sorted list that shares this list's pool by relinking runs
+    /// of its nodes.
+    //*************************************************************************
+    template <typename TCompare>
+    void merge_by_relinking(ilist& other, TCompare compare)
+    {
+      iterator other_begin = other.begin();
+      iterator other_end   = other.end();
+      iterator this_begin  = begin();
+      iterator this_end    = end();
+
+      while (other_begin != other_end)
+      {
+        // Find the place to insert.
+        while ((this_begin != this_end) && !compare(*other_begin, *this_begin))
+        {
+          ++this_begin;
+        }
+
+        // Find the run of nodes that go before it.
+        iterator run_end = other_begin;
+
+        do
+        {
+          ++run_end;
+        } while ((run_end != other_end) && ((this_begin == this_end) || compare(*run_end, *this_begin)));
+
+        relink(this_begin, other, other_begin, run_end);
+        other_begin = run_end;
+      }
+    }
+
     //*************************************************************************
     /// Remove a node.
     //*************************************************************************
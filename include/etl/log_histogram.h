@@ -0,0 +1,368 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LOG_HISTOGRAM_INCLUDED
+#define ETL_LOG_HISTOGRAM_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup log_histogram log_histogram
+/// A histogram of unsigned integers with logarithmically sized buckets, in
+/// the style of HdrHistogram.
+/// Values below 2^(Precision_Bits + 1) have a bucket each. Above that, every
+/// power of two range is split into 2^Precision_Bits buckets, so a value is
+/// known to within a relative error of 2^-Precision_Bits across the whole
+/// range of the type, in a fixed number of counters.
+/// For example, uint32_t with Precision_Bits of 5 gives 3% precision in 896
+/// counters.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Log bucketed histogram.
+  ///\tparam TValue         The unsigned integral value type.
+  ///\tparam TCount         The integral type of each bucket's count.
+  ///\tparam Precision_Bits The number of bits of each value that are kept.
+  ///\ingroup log_histogram
+  //***************************************************************************
+  template <typename TValue, typename TCount, size_t Precision_Bits>
+  class log_histogram
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TValue>::value && etl::is_unsigned<TValue>::value, "Only unsigned integral values allowed");
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value, "Only integral count allowed");
+    ETL_STATIC_ASSERT(Precision_Bits < size_t(etl::integral_limits<TValue>::bits), "Too many precision bits for the value type");
+
+    typedef TValue value_type;
+    typedef TCount count_type;
+
+    static ETL_CONSTANT size_t Sub_Buckets = size_t(1U) << Precision_Bits;
+    static ETL_CONSTANT size_t Max_Size    = (size_t(etl::integral_limits<TValue>::bits) - Precision_Bits + 1U) * Sub_Buckets;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    log_histogram()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    log_histogram(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(value_type value)
+    {
+      add(value, count_type(1));
+    }
+
+    //*********************************
+    /// Add a value a number of times.
+    //*********************************
+    void add(value_type value, count_type n)
+    {
+      if (n == count_type(0))
+      {
+        return;
+      }
+
+      buckets[bucket_index(value)] += n;
+
+      minimum = ((total == 0U) || (value < minimum)) ? value : minimum;
+      maximum = ((total == 0U) || (value > maximum)) ? value : maximum;
+      total  += size_t(n);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(value_type value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Adds the counts of another histogram to this one.
+    //*********************************
+    void merge(const log_histogram& other)
+    {
+      if (&other == this)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          buckets[i] += buckets[i];
+        }
+
+        total += total;
+        return;
+      }
+
+      if (other.total == 0U)
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < Max_Size; ++i)
+      {
+        buckets[i] += other.buckets[i];
+      }
+
+      minimum = ((total == 0U) || (other.minimum < minimum)) ? other.minimum : minimum;
+      maximum = ((total == 0U) || (other.maximum > maximum)) ? other.maximum : maximum;
+      total  += other.total;
+    }
+
+    //*********************************
+    /// Gets the value below which a fraction q of the values lie.
+    /// Returns the highest value of the bucket holding the value of that
+    /// rank, so it is never below the true value, and never above max().
+    /// Returns zero if the histogram is empty.
+    //*********************************
+    value_type value_at_quantile(double q) const
+    {
+      if (total == 0U)
+      {
+        return value_type(0);
+      }
+
+      if (q <= 0.0)
+      {
+        return minimum;
+      }
+
+      // The rank of the value, counting from 1, rounded up.
+      const double rank_d = q * double(total);
+      size_t       rank   = (rank_d < double(total)) ? size_t(rank_d) : total;
+
+      if ((rank == 0U) || (double(rank) < rank_d))
+      {
+        ++rank;
+      }
+
+      size_t cumulative = 0U;
+
+      for (size_t i = 0U; i < Max_Size; ++i)
+      {
+        cumulative += size_t(buckets[i]);
+
+        if (cumulative >= rank)
+        {
+          const value_type highest = bucket_highest(i);
+
+          return (highest < maximum) ? highest : maximum;
+        }
+      }
+
+      return maximum;
+    }
+
+    //*********************************
+    /// The smallest value added, or zero if the histogram is empty.
+    //*********************************
+    value_type min() const
+    {
+      return minimum;
+    }
+
+    //*********************************
+    /// The largest value added, or zero if the histogram is empty.
+    //*********************************
+    value_type max() const
+    {
+      return maximum;
+    }
+
+    //*********************************
+    /// The count in a bucket.
+    //*********************************
+    count_type operator [](size_t index) const
+    {
+      return buckets[index];
+    }
+
+    //*********************************
+    /// The number of buckets.
+    //*********************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return Max_Size;
+    }
+
+    //*********************************
+    /// The number of values added.
+    //*********************************
+    size_t count() const
+    {
+      return total;
+    }
+
+    //*********************************
+    /// True if no values have been added.
+    //*********************************
+    bool empty() const
+    {
+      return total == 0U;
+    }
+
+    //*********************************
+    /// Clear the histogram.
+    //*********************************
+    void clear()
+    {
+      buckets.fill(count_type(0));
+      minimum = value_type(0);
+      maximum = value_type(0);
+      total   = 0U;
+    }
+
+    //*********************************
+    /// The index of the bucket that holds a value.
+    //*********************************
+    static size_t bucket_index(value_type value)
+    {
+      if (value < value_type(2U * Sub_Buckets))
+      {
+        return size_t(value);
+      }
+
+      const size_t shift = bit_width(value) - (Precision_Bits + 1U);
+
+      return (shift * Sub_Buckets) + size_t(value >> shift);
+    }
+
+    //*********************************
+    /// The lowest value that is counted in a bucket.
+    //*********************************
+    static value_type bucket_lowest(size_t index)
+    {
+      if (index < (2U * Sub_Buckets))
+      {
+        return value_type(index);
+      }
+
+      const size_t shift    = (index / Sub_Buckets) - 1U;
+      const size_t mantissa = (index % Sub_Buckets) + Sub_Buckets;
+
+      return value_type(value_type(mantissa) << shift);
+    }
+
+    //*********************************
+    /// The highest value that is counted in a bucket.
+    //*********************************
+    static value_type bucket_highest(size_t index)
+    {
+      if (index < (2U * Sub_Buckets))
+      {
+        return value_type(index);
+      }
+
+      const size_t shift = (index / Sub_Buckets) - 1U;
+
+      return value_type(bucket_lowest(index) + value_type((value_type(1U) << shift) - 1U));
+    }
+
+  private:
+
+    //*********************************
+    /// The number of bits needed to represent the non-zero value.
+    /// GCC and Clang use the hardware count leading zeros instruction.
+    //*********************************
+    static size_t bit_width(value_type value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(etl::integral_limits<unsigned long long>::bits) - size_t(__builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+      size_t width = 0U;
+
+      while (value != 0U)
+      {
+        value >>= 1U;
+        ++width;
+      }
+
+      return width;
+#endif
+    }
+
+    etl::array<count_type, Max_Size> buckets;
+    value_type minimum;
+    value_type maximum;
+    size_t     total;
+  };
+
+  template <typename TValue, typename TCount, size_t Precision_Bits>
+  ETL_CONSTANT size_t log_histogram<TValue, TCount, Precision_Bits>::Sub_Buckets;
+
+  template <typename TValue, typename TCount, size_t Precision_Bits>
+  ETL_CONSTANT size_t log_histogram<TValue, TCount, Precision_Bits>::Max_Size;
+}
+
+#endif
@@ -0,0 +1,416 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LZ4_INCLUDED
+#define ETL_LZ4_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "span.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED
+
+///\defgroup lz4 lz4
+/// Compression and decompression in the LZ4 block format.
+/// Uses no heap. The compressor's only working memory is a hash table whose
+/// size is chosen by the caller, trading RAM for compression ratio.
+/// Runs of repeated bytes are encoded as overlapping matches, so no separate
+/// run-length scheme is needed.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_lz4
+  {
+    static ETL_CONSTANT size_t  Min_Match     = 4U;  ///< The shortest match.
+    static ETL_CONSTANT size_t  Last_Literals = 5U;  ///< The last bytes are always literals.
+    static ETL_CONSTANT size_t  Match_Limit   = 12U; ///< The last match must start this far from the end.
+    static ETL_CONSTANT size_t  Max_Offset    = 65535U;
+    static ETL_CONSTANT uint8_t Run_Mask      = 0x0FU;
+
+    //*************************************************************************
+    /// Reads four bytes, which may be unaligned.
+    //*************************************************************************
+    inline uint32_t read32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Hashes four bytes into 'hash_bits' bits.
+    //*************************************************************************
+    inline uint32_t hash_position(uint32_t value, uint_least8_t hash_bits)
+    {
+      return uint32_t(value * 2654435761U) >> (32U - hash_bits);
+    }
+
+    //*************************************************************************
+    /// Writes a length that did not fit in the token.
+    //*************************************************************************
+    inline uint8_t* write_length(uint8_t* op, size_t length)
+    {
+      while (length >= 255U)
+      {
+        *op++   = 255U;
+        length -= 255U;
+      }
+
+      *op++ = uint8_t(length);
+
+      return op;
+    }
+
+    //*************************************************************************
+    /// Writes one sequence: literals, then an optional match.
+    /// Returns ETL_NULLPTR if it does not fit.
+    //*************************************************************************
+    inline uint8_t* write_sequence(uint8_t* op, uint8_t* const op_end,
+                                   const uint8_t* literals, size_t literal_length,
+                                   size_t offset, size_t match_length)
+    {
+      // Worst case size: the token, the literal length, the literals,
+      // the offset and the match length.
+      const size_t worst = 1U + (literal_length / 255U) + 1U + literal_length + 2U + (match_length / 255U) + 1U;
+
+      if (worst > size_t(op_end - op))
+      {
+        return ETL_NULLPTR;
+      }
+
+      uint8_t* const ptoken = op++;
+
+      if (literal_length >= Run_Mask)
+      {
+        *ptoken = uint8_t(Run_Mask << 4U);
+        op = write_length(op, literal_length - Run_Mask);
+      }
+      else
+      {
+        *ptoken = uint8_t(literal_length << 4U);
+      }
+
+      if (literal_length != 0U)
+      {
+        memcpy(op, literals, literal_length);
+        op += literal_length;
+      }
+
+      if (match_length != 0U)
+      {
+        *op++ = uint8_t(offset);
+        *op++ = uint8_t(offset >> 8U);
+
+        const size_t length = match_length - Min_Match;
+
+        if (length >= Run_Mask)
+        {
+          *ptoken |= Run_Mask;
+          op = write_length(op, length - Run_Mask);
+        }
+        else
+        {
+          *ptoken |= uint8_t(length);
+        }
+      }
+
+      return op;
+    }
+  }
+
+  //***************************************************************************
+  /// The largest compressed size for 'size' bytes of input.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t lz4_max_compressed_size(size_t size)
+  {
+    return size + (size / 255U) + 16U;
+  }
+
+  //***************************************************************************
+  /// Compresses a block, using a hash table supplied by the caller.
+  /// The table's size must be a power of two, no larger than 2^16 entries.
+  /// Larger tables find more matches. Its contents on entry do not matter.
+  /// Returns the compressed size, or zero if the output is too small.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline size_t lz4_compress(etl::span<const uint8_t> input, etl::span<uint8_t> output, etl::span<uint32_t> hash_table)
+  {
+    using namespace private_lz4;
+
+    const size_t table_size = hash_table.size();
+
+    if ((table_size < 2U) || ((table_size & (table_size - 1U)) != 0U) || (table_size > 65536U))
+    {
+      return 0U;
+    }
+
+    uint_least8_t hash_bits = 0U;
+
+    while ((size_t(1U) << hash_bits) < table_size)
+    {
+      ++hash_bits;
+    }
+
+    const uint8_t* const in     = input.data();
+    const size_t         length = input.size();
+    uint8_t*             op     = output.data();
+    uint8_t* const       op_end = op + output.size();
+    size_t               anchor = 0U;
+
+    if (length >= (Match_Limit + 1U))
+    {
+      for (size_t i = 0U; i < table_size; ++i)
+      {
+        hash_table[i] = 0U;
+      }
+
+      const size_t match_start_limit = length - Match_Limit;
+      const size_t match_end_limit   = length - Last_Literals;
+
+      size_t position = 1U;
+
+      while (position < match_start_limit)
+      {
+        const uint32_t sequence = read32(in + position);
+        uint32_t&      entry    = hash_table[hash_position(sequence, hash_bits)];
+        size_t         match    = entry;
+
+        entry = uint32_t(position);
+
+        if ((match >= position) || ((position - match) > Max_Offset) || (read32(in + match) != sequence))
+        {
+          // Step faster through data that does not compress.
+          position += 1U + ((position - anchor) >> 6U);
+          continue;
+        }
+
+        // Extend the match backwards, into the pending literals.
+        while ((position > anchor) && (match > 0U) && (in[position - 1U] == in[match - 1U]))
+        {
+          --position;
+          --match;
+        }
+
+        // Extend the match forwards.
+        size_t match_length = Min_Match;
+
+        while (((position + match_length) < match_end_limit) && (in[position + match_length] == in[match + match_length]))
+        {
+          ++match_length;
+        }
+
+        op = write_sequence(op, op_end, in + anchor, position - anchor, position - match, match_length);
+
+        if (op == ETL_NULLPTR)
+        {
+          return 0U;
+        }
+
+        position += match_length;
+        anchor    = position;
+
+        // Remember a position inside the match, to help the next search.
+        if (position < match_start_limit)
+        {
+          hash_table[hash_position(read32(in + position - 2U), hash_bits)] = uint32_t(position - 2U);
+        }
+      }
+    }
+
+    // The remaining bytes are literals.
+    op = write_sequence(op, op_end, in + anchor, length - anchor, 0U, 0U);
+
+    if (op == ETL_NULLPTR)
+    {
+      return 0U;
+    }
+
+    return size_t(op - output.data());
+  }
+
+  //***************************************************************************
+  /// Compresses blocks using its own hash table of 2^HASH_BITS entries.
+  ///\tparam HASH_BITS Between 8 and 16. Each extra bit doubles the table.
+  ///\ingroup lz4
+  //***************************************************************************
+  template <size_t HASH_BITS = 12U>
+  class lz4_compressor
+  {
+  public:
+
+    ETL_STATIC_ASSERT((HASH_BITS >= 8U) && (HASH_BITS <= 16U), "HASH_BITS must be between 8 and 16");
+
+    static ETL_CONSTANT size_t Hash_Table_Size = size_t(1U) << HASH_BITS;
+
+    //*************************************************************************
+    /// Compresses a block.
+    /// Returns the compressed size, or zero if the output is too small.
+    //*************************************************************************
+    size_t compress(etl::span<const uint8_t> input, etl::span<uint8_t> output)
+    {
+      return etl::lz4_compress(input, output, etl::span<uint32_t>(hash_table, Hash_Table_Size));
+    }
+
+  private:
+
+    uint32_t hash_table[Hash_Table_Size];
+  };
+
+  template <size_t HASH_BITS>
+  ETL_CONSTANT size_t lz4_compressor<HASH_BITS>::Hash_Table_Size;
+
+  //***************************************************************************
+  /// Decompresses a block.
+  /// Every length and offset is checked, so malformed input cannot read or
+  /// write outside the buffers.
+  /// Returns the decompressed size, or zero if the input is malformed or the
+  /// output is too small.
+  ///\ingroup lz4
+  //***************************************************************************
+  inline size_t lz4_decompress(etl::span<const uint8_t> input, etl::span<uint8_t> output)
+  {
+    using namespace private_lz4;
+
+    const uint8_t*       ip       = input.data();
+    const uint8_t* const ip_end   = ip + input.size();
+    uint8_t* const       op_begin = output.data();
+    uint8_t*             op       = op_begin;
+    uint8_t* const       op_end   = op + output.size();
+
+    while (ip != ip_end)
+    {
+      const uint8_t token = *ip++;
+
+      // Literals.
+      size_t literal_length = token >> 4U;
+
+      if (literal_length == Run_Mask)
+      {
+        uint8_t extra;
+
+        do
+        {
+          if (ip == ip_end)
+          {
+            return 0U;
+          }
+
+          extra           = *ip++;
+          literal_length += extra;
+        } while (extra == 255U);
+      }
+
+      if ((literal_length > size_t(ip_end - ip)) || (literal_length > size_t(op_end - op)))
+      {
+        return 0U;
+      }
+
+      if (literal_length != 0U)
+      {
+        memcpy(op, ip, literal_length);
+        ip += literal_length;
+        op += literal_length;
+      }
+
+      // The last sequence has no match.
+      if (ip == ip_end)
+      {
+        break;
+      }
+
+      // Match.
+      if (size_t(ip_end - ip) < 2U)
+      {
+        return 0U;
+      }
+
+      const size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8U);
+      ip += 2U;
+
+      if ((offset == 0U) || (offset > size_t(op - op_begin)))
+      {
+        return 0U;
+      }
+
+      size_t match_length = token & Run_Mask;
+
+      if (match_length == Run_Mask)
+      {
+        uint8_t extra;
+
+        do
+        {
+          if (ip == ip_end)
+          {
+            return 0U;
+          }
+
+          extra         = *ip++;
+          match_length += extra;
+        } while (extra == 255U);
+      }
+
+      match_length += Min_Match;
+
+      if (match_length > size_t(op_end - op))
+      {
+        return 0U;
+      }
+
+      const uint8_t* match = op - offset;
+
+      if (offset >= match_length)
+      {
+        memcpy(op, match, match_length);
+        op += match_length;
+      }
+      else
+      {
+        // Overlapping, as for a run of repeated bytes.
+        for (size_t i = 0U; i < match_length; ++i)
+        {
+          *op++ = *match++;
+        }
+      }
+    }
+
+    return size_t(op - op_begin);
+  }
+}
+
+#endif
+#endif
@@ -48,6 +48,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "private/node_handle.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -528,6 +529,20 @@ namespace etl
       return kcompare(key, node.value.first);
     }
 
+#if ETL_CPP11_SUPPORTED
+    template <typename K>
+    bool node_comp(const Data_Node& node, const K& key) const
+    {
+      return kcompare(node.value.first, key);
+    }
+
+    template <typename K>
+    bool node_comp(const K& key, const Data_Node& node) const
+    {
+      return kcompare(key, node.value.first);
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used in the map.
@@ -793,6 +808,40 @@ namespace etl
     typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
     typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Owns a node that has been extracted from a map.
+    /// The node still occupies a place in the pool of the map it came from.
+    //*************************************************************************
+    class node_type : public etl::private_node_handle::key_value_node_handle<TKey, TMapped>
+    {
+    public:
+
+      node_type()
+      {
+      }
+
+    private:
+
+      friend class imap;
+
+      node_type(Data_Node& node, etl::ipool& pool)
+        : etl::private_node_handle::key_value_node_handle<TKey, TMapped>(&node, &node.value, &pool, ETL_NULLPTR)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// The result of inserting a node.
+    //*************************************************************************
+    struct insert_return_type
+    {
+      iterator  position;
+      bool      inserted;
+      node_type node;
+    };
+#endif
+
     //*************************************************************************
     /// Gets the beginning of the map.
     //*************************************************************************
@@ -969,6 +1018,44 @@ namespace etl
       return find_node(root_node, key) ? 1 : 0;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_type count(const K& key) const
+    {
+      return find_node(root_node, key) ? 1 : 0;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*************************************************************************
     /// Returns two iterators with bounding (lower bound, upper bound) the key
     /// provided
@@ -980,6 +1067,21 @@ namespace etl
         iterator(*this, find_upper_node(root_node, key)));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// Only available if the key comparator is transparent.
+    /// provided
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(
+        iterator(*this, find_lower_node(root_node, key)),
+        iterator(*this, find_upper_node(root_node, key)));
+    }
+#endif
+
     //*************************************************************************
     /// Returns two const iterators with bounding (lower bound, upper bound)
     /// the key provided.
@@ -991,6 +1093,21 @@ namespace etl
         const_iterator(*this, find_upper_node(root_node, key)));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// Only available if the key comparator is transparent.
+    /// the key provided.
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(
+        const_iterator(*this, find_lower_node(root_node, key)),
+        const_iterator(*this, find_upper_node(root_node, key)));
+    }
+#endif
+
     //*************************************************************************
     /// Erases the value at the specified position.
     //*************************************************************************
@@ -1062,6 +1179,20 @@ namespace etl
       return iterator(*this, find_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      return iterator(*this, find_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1072,6 +1203,20 @@ namespace etl
       return const_iterator(*this, find_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_iterator(*this, find_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a value to the map.
     /// If asserts or exceptions are enabled, emits map_full if the map is already full.
@@ -1218,6 +1363,255 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*********************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator /*position*/, Args && ... args)
+    {
+      return emplace(etl::forward<Args>(args)...).first;
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*********************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1)
+    {
+      return emplace(value1).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2)
+    {
+      return emplace(value1, value2).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace(value1, value2, value3).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the map.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace(value1, value2, value3, value4).first;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a node extracted from a map of the same type.
+    /// A node from this map is relinked, otherwise its value is moved into
+    /// a new node and the old one is released.
+    /// If the key is already present the node is returned in the result.
+    //*********************************************************************
+    insert_return_type insert(node_type&& node)
+    {
+      insert_return_type result = { end(), false, node_type() };
+
+      if (!node.empty())
+      {
+        result.position = insert(cend(), etl::move(node));
+        result.inserted = node.empty();
+
+        if (!result.inserted)
+        {
+          result.node = etl::move(node);
+        }
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Inserts a node extracted from a map of the same type.
+    /// The node is left in the handle if the key is already present.
+    ///\return An iterator to the element with the node's key, or end() if
+    /// the node was empty.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, node_type&& node)
+    {
+      if (node.empty())
+      {
+        return end();
+      }
+
+      Node* found = find_node(root_node, node.key());
+
+      if (found == ETL_NULLPTR)
+      {
+        found = insert_node(root_node, claim_node(node));
+      }
+
+      return iterator(*this, found);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element at the specified position and returns ownership
+    /// of its node.
+    //*********************************************************************
+    node_type extract(const_iterator position)
+    {
+      return extract((*position).first);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element with the specified key and returns ownership of
+    /// its node. The handle is empty if the key is not present.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      Node* found = unlink_node(root_node, key);
+
+      if (found == ETL_NULLPTR)
+      {
+        return node_type();
+      }
+
+      ETL_DECREMENT_DEBUG_COUNT
+
+      return node_type(imap::data_cast(*found), *p_node_pool);
+    }
+
+    //*********************************************************************
+    /// Moves the elements of another map whose keys are not in this one.
+    /// Elements with keys that are already present are left in 'other'.
+    //*********************************************************************
+    void merge(imap& other)
+    {
+      if (&other != this)
+      {
+        iterator itr = other.begin();
+
+        while (itr != other.end())
+        {
+          iterator current = itr++;
+
+          if (find_node(root_node, (*current).first) == ETL_NULLPTR)
+          {
+            node_type node = other.extract(current);
+            insert_node(root_node, claim_node(node));
+          }
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the elements of another map whose keys are not in this one.
+    //*********************************************************************
+    void merge(imap&& other)
+    {
+      merge(other);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the map.
     /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
@@ -1245,6 +1639,21 @@ namespace etl
       return iterator(*this, find_lower_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// Only available if the key comparator is transparent.
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, find_lower_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Returns a const_iterator pointing to the first element in the
     /// container whose key is not considered to go before the key provided
@@ -1256,6 +1665,21 @@ namespace etl
       return const_iterator(*this, find_lower_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// Only available if the key comparator is transparent.
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, find_lower_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Returns an iterator pointing to the first element in the container
     /// whose key is not considered to go after the key provided or end()
@@ -1267,6 +1691,21 @@ namespace etl
       return iterator(*this, find_upper_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// Only available if the key comparator is transparent.
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, find_upper_node(root_node, key));
+    }
+#endif
+
     //*********************************************************************
     /// Returns a const_iterator pointing to the first element in the
     /// container whose key is not considered to go after the key provided
@@ -1278,6 +1717,21 @@ namespace etl
       return const_iterator(*this, find_upper_node(root_node, key));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// Only available if the key comparator is transparent.
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, find_upper_node(root_node, key));
+    }
+#endif
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -1357,6 +1811,17 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a node whose value has been constructed.
+    /// The node is destroyed if the key is already present.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace_node(Data_Node& node)
+    {
+      Node* inserted_node = insert_node(root_node, node);
+
+      return ETL_OR_STD::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
@@ -1381,6 +1846,30 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Takes the node from a handle. A node from another pool has its value
+    /// moved into a new node from this pool.
+    //*************************************************************************
+    Data_Node& claim_node(node_type& node)
+    {
+      if (node.get_pool() == p_node_pool)
+      {
+        ETL_INCREMENT_DEBUG_COUNT
+        return *static_cast<Data_Node*>(node.release());
+      }
+      else
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+        Data_Node& data_node = allocate_data_node(etl::move(node.get_value()));
+        node.reset();
+
+        return data_node;
+      }
+    }
+#endif
+
     //*************************************************************************
     /// Create a Data_Node.
     //*************************************************************************
@@ -1433,6 +1922,42 @@ namespace etl
       return found;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the value matching the node provided
+    //*************************************************************************
+    template <typename K>
+    Node* find_node(Node* position, const K& key)
+    {
+      Node* found = position;
+      while (found)
+      {
+        // Downcast found to Data_Node class for comparison and other operations
+        Data_Node& found_data_node = imap::data_cast(*found);
+
+        // Compare the node value to the current position value
+        if (node_comp(key, found_data_node))
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (node_comp(found_data_node, key))
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
+      }
+
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
+#endif
+
     //*************************************************************************
     /// Find the value matching the node provided
     //*************************************************************************
@@ -1466,6 +1991,42 @@ namespace etl
       return found;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the value matching the node provided
+    //*************************************************************************
+    template <typename K>
+    const Node* find_node(const Node* position, const K& key) const
+    {
+      const Node* found = position;
+      while (found)
+      {
+        // Downcast found to Data_Node class for comparison and other operations
+        const Data_Node& found_data_node = imap::data_cast(*found);
+
+        // Compare the node value to the current position value
+        if (node_comp(key, found_data_node))
+        {
+          // Keep searching for the node on the left
+          found = found->children[kLeft];
+        }
+        else if (node_comp(found_data_node, key))
+        {
+          // Keep searching for the node on the right
+          found = found->children[kRight];
+        }
+        else
+        {
+          // Node that matches the key provided was found, exit loop
+          break;
+        }
+      }
+
+      // Return the node found (might be ETL_NULLPTR)
+      return found;
+    }
+#endif
+
     //*************************************************************************
     /// Find the reference node matching the node provided
     //*************************************************************************
@@ -1648,6 +2209,50 @@ namespace etl
       return lower_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the node whose key is not considered to go before the key provided
+    //*************************************************************************
+    template <typename K>
+    Node* find_lower_node(Node* position, const K& key) const
+    {
+      // Something at this position? keep going
+      Node* lower_node = ETL_NULLPTR;
+      while (position)
+      {
+        // Downcast lower node to Data_Node reference for key comparisons
+        Data_Node& data_node = imap::data_cast(*position);
+        // Compare the key value to the current lower node key value
+        if (node_comp(key, data_node))
+        {
+          lower_node = position;
+          if (position->children[kLeft])
+          {
+            position = position->children[kLeft];
+          }
+          else
+          {
+            // Found lowest node
+            break;
+          }
+        }
+        else if (node_comp(data_node, key))
+        {
+          position = position->children[kRight];
+        }
+        else
+        {
+          // Make note of current position, but keep looking to left for more
+          lower_node = position;
+          position = position->children[kLeft];
+        }
+      }
+
+      // Return the lower_node position found
+      return lower_node;
+    }
+#endif
+
     //*************************************************************************
     /// Find the node whose key is considered to go after the key provided
     //*************************************************************************
@@ -1686,6 +2291,47 @@ namespace etl
       return upper_node;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Find the node whose key is considered to go after the key provided
+    //*************************************************************************
+    template <typename K>
+    Node* find_upper_node(Node* position, const K& key) const
+    {
+      // Keep track of parent of last upper node
+      Node* upper_node = ETL_NULLPTR;
+      // Start with position provided
+      Node* node = position;
+      while (node)
+      {
+        // Downcast position to Data_Node reference for key comparisons
+        Data_Node& data_node = imap::data_cast(*node);
+        // Compare the key value to the current upper node key value
+        if (node_comp(key, data_node))
+        {
+          upper_node = node;
+          node = node->children[kLeft];
+        }
+        else if (node_comp(data_node, key))
+        {
+          node = node->children[kRight];
+        }
+        else if (node->children[kRight])
+        {
+          upper_node = find_limit_node(node->children[kRight], kLeft);
+          break;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      // Return the upper node position found (might be ETL_NULLPTR)
+      return upper_node;
+    }
+#endif
+
     //*************************************************************************
     /// Insert a node.
     //*************************************************************************
@@ -1944,6 +2590,22 @@ namespace etl
     /// provided
     //*************************************************************************
     Node* remove_node(Node*& position, key_parameter_t key)
+    {
+      Node* found = unlink_node(position, key);
+
+      if (found)
+      {
+        destroy_data_node(imap::data_cast(*found));
+      }
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Unlink the node specified from somewhere starting at the position
+    /// provided, without destroying it
+    //*************************************************************************
+    Node* unlink_node(Node*& position, key_parameter_t key)
     {
       // Step 1: Find the target node that matches the key provided, the
       // replacement node (might be the same as target node), and the critical
@@ -2119,14 +2781,8 @@ namespace etl
           }
         }
 
-        // Downcast found into data node
-        Data_Node& found_data_node = imap::data_cast(*found);
-
         // One less.
         --current_size;
-
-        // Destroy the node removed
-        destroy_data_node(found_data_node);
       } // if(found)
 
         // Return node found (might be ETL_NULLPTR)
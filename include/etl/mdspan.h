@@ -0,0 +1,1101 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MDSPAN_INCLUDED
+#define ETL_MDSPAN_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "array.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "span.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#if ETL_CPP11_SUPPORTED
+
+///\defgroup mdspan mdspan
+/// A non-owning multi-dimensional view of contiguous storage, after
+/// std::mdspan. The layout policy maps indices to offsets, so row major,
+/// column major and strided views, such as tiles and transposes, can share
+/// the same data without copying.
+/// Elements are accessed with operator(), as there is no multi-argument
+/// operator[] before C++23.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for mdspan exceptions.
+  ///\ingroup mdspan
+  //***************************************************************************
+  class mdspan_exception : public exception
+  {
+  public:
+
+    mdspan_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The storage or slice is out of range.
+  ///\ingroup mdspan
+  //***************************************************************************
+  class mdspan_out_of_range : public mdspan_exception
+  {
+  public:
+
+    mdspan_out_of_range(string_type file_name_, numeric_type line_number_)
+      : mdspan_exception(ETL_ERROR_TEXT("mdspan:range", ETL_MDSPAN_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A run time extent does not match a static extent.
+  ///\ingroup mdspan
+  //***************************************************************************
+  class mdspan_extent_mismatch : public mdspan_exception
+  {
+  public:
+
+    mdspan_extent_mismatch(string_type file_name_, numeric_type line_number_)
+      : mdspan_exception(ETL_ERROR_TEXT("mdspan:extents", ETL_MDSPAN_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// The static extent for rank 'r'.
+    //*************************************************************************
+    template <size_t... Extents>
+    struct static_extent_of;
+
+    template <>
+    struct static_extent_of<>
+    {
+      static ETL_CONSTEXPR size_t get(size_t)
+      {
+        return 0U;
+      }
+    };
+
+    template <size_t First, size_t... Rest>
+    struct static_extent_of<First, Rest...>
+    {
+      static ETL_CONSTEXPR size_t get(size_t r)
+      {
+        return (r == 0U) ? First : static_extent_of<Rest...>::get(r - 1U);
+      }
+    };
+
+    //*************************************************************************
+    /// The number of dynamic extents.
+    //*************************************************************************
+    template <size_t... Extents>
+    struct count_dynamic;
+
+    template <>
+    struct count_dynamic<>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t First, size_t... Rest>
+    struct count_dynamic<First, Rest...>
+    {
+      static ETL_CONSTANT size_t value = ((First == etl::dynamic_extent) ? 1U : 0U) + count_dynamic<Rest...>::value;
+    };
+
+    //*************************************************************************
+    /// True if all of the types are integral.
+    //*************************************************************************
+    template <typename... T>
+    struct all_integral;
+
+    template <>
+    struct all_integral<>
+    {
+      static ETL_CONSTANT bool value = true;
+    };
+
+    template <typename T, typename... TRest>
+    struct all_integral<T, TRest...>
+    {
+      static ETL_CONSTANT bool value = etl::is_integral<T>::value && all_integral<TRest...>::value;
+    };
+  }
+
+  //***************************************************************************
+  /// The extents of each rank. Each may be static, or etl::dynamic_extent to
+  /// be set at run time.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TIndex, size_t... Extents>
+  class extents
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TIndex>::value, "Index type must be integral");
+
+    typedef TIndex                                   index_type;
+    typedef typename etl::make_unsigned<TIndex>::type size_type;
+    typedef size_t                                   rank_type;
+
+    //*************************************************************************
+    /// The number of dimensions.
+    //*************************************************************************
+    static ETL_CONSTEXPR rank_type rank()
+    {
+      return sizeof...(Extents);
+    }
+
+    //*************************************************************************
+    /// The number of dimensions with a dynamic extent.
+    //*************************************************************************
+    static ETL_CONSTEXPR rank_type rank_dynamic()
+    {
+      return private_mdspan::count_dynamic<Extents...>::value;
+    }
+
+    //*************************************************************************
+    /// The static extent of rank 'r', or etl::dynamic_extent.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t static_extent(rank_type r)
+    {
+      return private_mdspan::static_extent_of<Extents...>::get(r);
+    }
+
+    //*************************************************************************
+    /// Default constructor. Dynamic extents are zero.
+    //*************************************************************************
+    extents()
+    {
+      for (rank_type r = 0U; r < rank(); ++r)
+      {
+        values[r] = (static_extent(r) == etl::dynamic_extent) ? index_type(0) : index_type(static_extent(r));
+      }
+    }
+
+    //*************************************************************************
+    /// Construct from either the dynamic extents, or all of the extents.
+    //*************************************************************************
+    template <typename... TIndices, typename = typename etl::enable_if<(sizeof...(TIndices) != 0U) && private_mdspan::all_integral<TIndices...>::value, void>::type>
+    explicit extents(TIndices... indices)
+    {
+      ETL_STATIC_ASSERT((sizeof...(TIndices) == sizeof...(Extents)) || (sizeof...(TIndices) == private_mdspan::count_dynamic<Extents...>::value), "Wrong number of extents");
+
+      const index_type in[] = { static_cast<index_type>(indices)... };
+
+      assign(in, sizeof...(TIndices));
+    }
+
+    //*************************************************************************
+    /// Construct from an array of either the dynamic extents, or all of the extents.
+    //*************************************************************************
+    template <typename TOther, size_t N>
+    explicit extents(const TOther (&in)[N])
+    {
+      ETL_STATIC_ASSERT((N == sizeof...(Extents)) || (N == private_mdspan::count_dynamic<Extents...>::value), "Wrong number of extents");
+
+      assign(in, N);
+    }
+
+    //*************************************************************************
+    /// Construct from an array of either the dynamic extents, or all of the extents.
+    //*************************************************************************
+    template <typename TOther, size_t N>
+    explicit extents(const etl::array<TOther, N>& in)
+    {
+      ETL_STATIC_ASSERT((N == sizeof...(Extents)) || (N == private_mdspan::count_dynamic<Extents...>::value), "Wrong number of extents");
+
+      assign(in.data(), N);
+    }
+
+    //*************************************************************************
+    /// The extent of rank 'r'.
+    //*************************************************************************
+    index_type extent(rank_type r) const
+    {
+      return values[r];
+    }
+
+    //*************************************************************************
+    /// The product of the extents.
+    //*************************************************************************
+    size_t size() const
+    {
+      size_t n = 1U;
+
+      for (rank_type r = 0U; r < rank(); ++r)
+      {
+        n *= size_t(values[r]);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Equal if the ranks and all of the extents are equal.
+    //*************************************************************************
+    template <typename TOther, size_t... OtherExtents>
+    bool operator ==(const etl::extents<TOther, OtherExtents...>& rhs) const
+    {
+      if (rank() != rhs.rank())
+      {
+        return false;
+      }
+
+      for (rank_type r = 0U; r < rank(); ++r)
+      {
+        if (size_t(values[r]) != size_t(rhs.extent(r)))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <typename TOther, size_t... OtherExtents>
+    bool operator !=(const etl::extents<TOther, OtherExtents...>& rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Sets the extents from either the dynamic extents, or all of the extents.
+    //*************************************************************************
+    template <typename TOther>
+    void assign(const TOther* in, size_t n)
+    {
+      size_t d = 0U;
+
+      for (rank_type r = 0U; r < rank(); ++r)
+      {
+        if (static_extent(r) == etl::dynamic_extent)
+        {
+          values[r] = static_cast<index_type>(in[(n == rank()) ? r : d++]);
+        }
+        else
+        {
+          ETL_ASSERT((n != rank()) || (size_t(in[r]) == static_extent(r)), ETL_ERROR(etl::mdspan_extent_mismatch));
+          values[r] = static_cast<index_type>(static_extent(r));
+        }
+      }
+    }
+
+    index_type values[(sizeof...(Extents) == 0U) ? 1U : sizeof...(Extents)];
+  };
+
+  namespace private_mdspan
+  {
+    template <typename TIndex, size_t Rank, size_t... Extents>
+    struct make_dextents
+    {
+      typedef typename make_dextents<TIndex, Rank - 1U, etl::dynamic_extent, Extents...>::type type;
+    };
+
+    template <typename TIndex, size_t... Extents>
+    struct make_dextents<TIndex, 0U, Extents...>
+    {
+      typedef etl::extents<TIndex, Extents...> type;
+    };
+
+    //*************************************************************************
+    /// The flat index for row major order, by Horner's method.
+    //*************************************************************************
+    template <typename TExtents, typename TIndex>
+    typename TExtents::index_type offset_right(const TExtents& e, const TIndex* indices)
+    {
+      typename TExtents::index_type offset = 0;
+
+      for (size_t r = 0U; r < TExtents::rank(); ++r)
+      {
+        offset = static_cast<typename TExtents::index_type>((offset * e.extent(r)) + indices[r]);
+      }
+
+      return offset;
+    }
+
+    //*************************************************************************
+    /// The flat index for column major order, by Horner's method.
+    //*************************************************************************
+    template <typename TExtents, typename TIndex>
+    typename TExtents::index_type offset_left(const TExtents& e, const TIndex* indices)
+    {
+      typename TExtents::index_type offset = 0;
+
+      for (size_t r = TExtents::rank(); r != 0U; --r)
+      {
+        offset = static_cast<typename TExtents::index_type>((offset * e.extent(r - 1U)) + indices[r - 1U]);
+      }
+
+      return offset;
+    }
+  }
+
+  //***************************************************************************
+  /// Extents that are all dynamic.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TIndex, size_t Rank>
+  using dextents = typename private_mdspan::make_dextents<TIndex, Rank>::type;
+
+  //***************************************************************************
+  /// Row major layout. The last index is contiguous.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_right
+  {
+    template <typename TExtents>
+    class mapping;
+  };
+
+  //***************************************************************************
+  /// Column major layout. The first index is contiguous.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_left
+  {
+    template <typename TExtents>
+    class mapping;
+  };
+
+  //***************************************************************************
+  /// A layout with a given stride for each rank.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_stride
+  {
+    template <typename TExtents>
+    class mapping;
+  };
+
+  //***************************************************************************
+  /// The mapping for layout_right.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TExtents>
+  class layout_right::mapping
+  {
+  public:
+
+    typedef TExtents                        extents_type;
+    typedef typename TExtents::index_type   index_type;
+    typedef typename TExtents::size_type    size_type;
+    typedef typename TExtents::rank_type    rank_type;
+    typedef etl::layout_right               layout_type;
+
+    //*************************************************************************
+    mapping()
+      : ext()
+    {
+    }
+
+    //*************************************************************************
+    mapping(const extents_type& ext_)
+      : ext(ext_)
+    {
+    }
+
+    //*************************************************************************
+    const extents_type& extents() const
+    {
+      return ext;
+    }
+
+    //*************************************************************************
+    /// The size of the storage needed.
+    //*************************************************************************
+    index_type required_span_size() const
+    {
+      return static_cast<index_type>(ext.size());
+    }
+
+    //*************************************************************************
+    /// The offset of the element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    index_type operator()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == extents_type::rank(), "Wrong number of indices");
+
+      const index_type in[sizeof...(TIndices) + 1U] = { static_cast<index_type>(indices)... };
+
+      return private_mdspan::offset_right(ext, in);
+    }
+
+    //*************************************************************************
+    /// The distance between elements of rank 'r'.
+    //*************************************************************************
+    index_type stride(rank_type r) const
+    {
+      index_type s = 1;
+
+      for (rank_type i = r + 1U; i < extents_type::rank(); ++i)
+      {
+        s = static_cast<index_type>(s * ext.extent(i));
+      }
+
+      return s;
+    }
+
+    static ETL_CONSTEXPR bool is_always_unique()     { return true; }
+    static ETL_CONSTEXPR bool is_always_exhaustive() { return true; }
+    static ETL_CONSTEXPR bool is_always_strided()    { return true; }
+    static ETL_CONSTEXPR bool is_unique()            { return true; }
+    static ETL_CONSTEXPR bool is_exhaustive()        { return true; }
+    static ETL_CONSTEXPR bool is_strided()           { return true; }
+
+  private:
+
+    extents_type ext;
+  };
+
+  //***************************************************************************
+  /// The mapping for layout_left.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TExtents>
+  class layout_left::mapping
+  {
+  public:
+
+    typedef TExtents                        extents_type;
+    typedef typename TExtents::index_type   index_type;
+    typedef typename TExtents::size_type    size_type;
+    typedef typename TExtents::rank_type    rank_type;
+    typedef etl::layout_left                layout_type;
+
+    //*************************************************************************
+    mapping()
+      : ext()
+    {
+    }
+
+    //*************************************************************************
+    mapping(const extents_type& ext_)
+      : ext(ext_)
+    {
+    }
+
+    //*************************************************************************
+    const extents_type& extents() const
+    {
+      return ext;
+    }
+
+    //*************************************************************************
+    /// The size of the storage needed.
+    //*************************************************************************
+    index_type required_span_size() const
+    {
+      return static_cast<index_type>(ext.size());
+    }
+
+    //*************************************************************************
+    /// The offset of the element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    index_type operator()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == extents_type::rank(), "Wrong number of indices");
+
+      const index_type in[sizeof...(TIndices) + 1U] = { static_cast<index_type>(indices)... };
+
+      return private_mdspan::offset_left(ext, in);
+    }
+
+    //*************************************************************************
+    /// The distance between elements of rank 'r'.
+    //*************************************************************************
+    index_type stride(rank_type r) const
+    {
+      index_type s = 1;
+
+      for (rank_type i = 0U; i < r; ++i)
+      {
+        s = static_cast<index_type>(s * ext.extent(i));
+      }
+
+      return s;
+    }
+
+    static ETL_CONSTEXPR bool is_always_unique()     { return true; }
+    static ETL_CONSTEXPR bool is_always_exhaustive() { return true; }
+    static ETL_CONSTEXPR bool is_always_strided()    { return true; }
+    static ETL_CONSTEXPR bool is_unique()            { return true; }
+    static ETL_CONSTEXPR bool is_exhaustive()        { return true; }
+    static ETL_CONSTEXPR bool is_strided()           { return true; }
+
+  private:
+
+    extents_type ext;
+  };
+
+  //***************************************************************************
+  /// The mapping for layout_stride.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TExtents>
+  class layout_stride::mapping
+  {
+  public:
+
+    typedef TExtents                        extents_type;
+    typedef typename TExtents::index_type   index_type;
+    typedef typename TExtents::size_type    size_type;
+    typedef typename TExtents::rank_type    rank_type;
+    typedef etl::layout_stride              layout_type;
+
+    //*************************************************************************
+    /// Default constructor. Row major strides.
+    //*************************************************************************
+    mapping()
+      : ext()
+    {
+      set_strides(etl::layout_right::mapping<extents_type>(ext));
+    }
+
+    //*************************************************************************
+    /// Construct from extents and strides.
+    /// 'strides' is an array or other type indexable by rank.
+    //*************************************************************************
+    template <typename TStrides>
+    mapping(const extents_type& ext_, const TStrides& strides_)
+      : ext(ext_)
+    {
+      for (rank_type r = 0U; r < extents_type::rank(); ++r)
+      {
+        strides[r] = static_cast<index_type>(strides_[r]);
+      }
+    }
+
+    //*************************************************************************
+    /// Construct from a layout_right or layout_left mapping.
+    //*************************************************************************
+    template <typename TMapping, typename = typename etl::enable_if<etl::is_same<typename TMapping::extents_type, extents_type>::value, void>::type>
+    explicit mapping(const TMapping& other)
+      : ext(other.extents())
+    {
+      set_strides(other);
+    }
+
+    //*************************************************************************
+    const extents_type& extents() const
+    {
+      return ext;
+    }
+
+    //*************************************************************************
+    /// The size of the storage needed.
+    //*************************************************************************
+    index_type required_span_size() const
+    {
+      index_type size = 1;
+
+      for (rank_type r = 0U; r < extents_type::rank(); ++r)
+      {
+        if (ext.extent(r) == 0)
+        {
+          return 0;
+        }
+
+        size = static_cast<index_type>(size + ((ext.extent(r) - 1) * strides[r]));
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// The offset of the element at the indices.
+    //*************************************************************************
+    template <typename... TIndices>
+    index_type operator()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == extents_type::rank(), "Wrong number of indices");
+
+      const index_type in[sizeof...(TIndices) + 1U] = { static_cast<index_type>(indices)... };
+
+      index_type offset = 0;
+
+      for (rank_type r = 0U; r < extents_type::rank(); ++r)
+      {
+        offset = static_cast<index_type>(offset + (in[r] * strides[r]));
+      }
+
+      return offset;
+    }
+
+    //*************************************************************************
+    /// The distance between elements of rank 'r'.
+    //*************************************************************************
+    index_type stride(rank_type r) const
+    {
+      return strides[r];
+    }
+
+    static ETL_CONSTEXPR bool is_always_unique()     { return true; }
+    static ETL_CONSTEXPR bool is_always_exhaustive() { return false; }
+    static ETL_CONSTEXPR bool is_always_strided()    { return true; }
+    static ETL_CONSTEXPR bool is_unique()            { return true; }
+    static ETL_CONSTEXPR bool is_strided()           { return true; }
+
+    //*************************************************************************
+    /// True if the view covers all of the storage it spans.
+    //*************************************************************************
+    bool is_exhaustive() const
+    {
+      return size_t(required_span_size()) == ext.size();
+    }
+
+  private:
+
+    //*************************************************************************
+    template <typename TMapping>
+    void set_strides(const TMapping& other)
+    {
+      for (rank_type r = 0U; r < extents_type::rank(); ++r)
+      {
+        strides[r] = other.stride(r);
+      }
+    }
+
+    extents_type ext;
+    index_type   strides[(extents_type::rank() == 0U) ? 1U : extents_type::rank()];
+  };
+
+  //***************************************************************************
+  /// A non-owning multi-dimensional view.
+  ///\tparam T        The element type.
+  ///\tparam TExtents An etl::extents.
+  ///\tparam TLayout  etl::layout_right, etl::layout_left or etl::layout_stride.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, typename TExtents, typename TLayout = etl::layout_right>
+  class mdspan
+  {
+  public:
+
+    typedef TExtents                                        extents_type;
+    typedef TLayout                                         layout_type;
+    typedef typename TLayout::template mapping<TExtents>   mapping_type;
+    typedef T                                               element_type;
+    typedef typename etl::remove_cv<T>::type                value_type;
+    typedef typename extents_type::index_type               index_type;
+    typedef typename extents_type::size_type                size_type;
+    typedef typename extents_type::rank_type                rank_type;
+    typedef T*                                              data_handle_type;
+    typedef T&                                              reference;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    mdspan()
+      : pdata(ETL_NULLPTR)
+      , map()
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and the dynamic extents, or all of the extents.
+    //*************************************************************************
+    template <typename... TIndices, typename = typename etl::enable_if<private_mdspan::all_integral<TIndices...>::value, void>::type>
+    explicit mdspan(T* pdata_, TIndices... indices)
+      : pdata(pdata_)
+      , map(extents_type(indices...))
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and extents.
+    //*************************************************************************
+    mdspan(T* pdata_, const extents_type& ext)
+      : pdata(pdata_)
+      , map(ext)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and a mapping.
+    //*************************************************************************
+    mdspan(T* pdata_, const mapping_type& map_)
+      : pdata(pdata_)
+      , map(map_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a span and extents.
+    /// The span must be large enough for the extents.
+    //*************************************************************************
+    template <size_t Extent>
+    mdspan(const etl::span<T, Extent>& storage, const extents_type& ext)
+      : pdata(storage.data())
+      , map(ext)
+    {
+      ETL_ASSERT(storage.size() >= size_t(map.required_span_size()), ETL_ERROR(etl::mdspan_out_of_range));
+    }
+
+    //*************************************************************************
+    /// Construct from a span and a mapping.
+    /// The span must be large enough for the mapping.
+    //*************************************************************************
+    template <size_t Extent>
+    mdspan(const etl::span<T, Extent>& storage, const mapping_type& map_)
+      : pdata(storage.data())
+      , map(map_)
+    {
+      ETL_ASSERT(storage.size() >= size_t(map.required_span_size()), ETL_ERROR(etl::mdspan_out_of_range));
+    }
+
+    //*************************************************************************
+    /// Construct a view of const elements from a view of non-const elements.
+    //*************************************************************************
+    template <typename U, typename = typename etl::enable_if<etl::is_same<const U, T>::value && !etl::is_same<U, T>::value, void>::type>
+    mdspan(const etl::mdspan<U, TExtents, TLayout>& other)
+      : pdata(other.data_handle())
+      , map(other.mapping())
+    {
+    }
+
+    //*************************************************************************
+    /// The element at the indices. There is no range check.
+    //*************************************************************************
+    template <typename... TIndices>
+    reference operator()(TIndices... indices) const
+    {
+      return pdata[map(indices...)];
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR rank_type rank()
+    {
+      return extents_type::rank();
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR rank_type rank_dynamic()
+    {
+      return extents_type::rank_dynamic();
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t static_extent(rank_type r)
+    {
+      return extents_type::static_extent(r);
+    }
+
+    //*************************************************************************
+    index_type extent(rank_type r) const
+    {
+      return map.extents().extent(r);
+    }
+
+    //*************************************************************************
+    /// The number of elements in the view.
+    //*************************************************************************
+    size_t size() const
+    {
+      return map.extents().size();
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    const extents_type& extents() const
+    {
+      return map.extents();
+    }
+
+    //*************************************************************************
+    const mapping_type& mapping() const
+    {
+      return map;
+    }
+
+    //*************************************************************************
+    data_handle_type data_handle() const
+    {
+      return pdata;
+    }
+
+    //*************************************************************************
+    index_type stride(rank_type r) const
+    {
+      return map.stride(r);
+    }
+
+    //*************************************************************************
+    bool is_unique() const
+    {
+      return map.is_unique();
+    }
+
+    //*************************************************************************
+    bool is_exhaustive() const
+    {
+      return map.is_exhaustive();
+    }
+
+    //*************************************************************************
+    bool is_strided() const
+    {
+      return map.is_strided();
+    }
+
+  private:
+
+    T*           pdata;
+    mapping_type map;
+  };
+
+  //***************************************************************************
+  /// Selects all of the indices of a rank in submdspan.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct full_extent_t
+  {
+  };
+
+  static ETL_CONSTANT full_extent_t full_extent = full_extent_t();
+
+  //***************************************************************************
+  /// Selects 'extent' indices, 'stride' apart, from 'offset', in submdspan.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename TOffset = size_t, typename TExtent = size_t, typename TStride = size_t>
+  struct strided_slice
+  {
+    TOffset offset;
+    TExtent extent;
+    TStride stride;
+  };
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// The number of slices that keep their rank.
+    //*************************************************************************
+    template <typename... TSlices>
+    struct count_ranges;
+
+    template <>
+    struct count_ranges<>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename TSlice, typename... TRest>
+    struct count_ranges<TSlice, TRest...>
+    {
+      static ETL_CONSTANT size_t value = (etl::is_integral<TSlice>::value ? 0U : 1U) + count_ranges<TRest...>::value;
+    };
+
+    //*************************************************************************
+    /// Accumulates the offset, extents and strides of a submdspan.
+    //*************************************************************************
+    template <typename TIndex, size_t Rank>
+    struct slicer
+    {
+      slicer()
+        : offset(0)
+        , rank(0U)
+      {
+      }
+
+      //***********************************
+      template <typename TSlice>
+      typename etl::enable_if<etl::is_integral<TSlice>::value, void>::type
+        add(TIndex extent, TIndex stride, TSlice index)
+      {
+        ETL_ASSERT(TIndex(index) < extent, ETL_ERROR(etl::mdspan_out_of_range));
+        (void)extent;
+
+        offset = static_cast<TIndex>(offset + (TIndex(index) * stride));
+      }
+
+      //***********************************
+      void add(TIndex extent, TIndex stride, etl::full_extent_t)
+      {
+        keep(extent, stride);
+      }
+
+      //***********************************
+      template <typename TFirst, typename TLast>
+      void add(TIndex extent, TIndex stride, const etl::pair<TFirst, TLast>& range)
+      {
+        ETL_ASSERT((TIndex(range.first) <= TIndex(range.second)) && (TIndex(range.second) <= extent), ETL_ERROR(etl::mdspan_out_of_range));
+        (void)extent;
+
+        offset = static_cast<TIndex>(offset + (TIndex(range.first) * stride));
+        keep(static_cast<TIndex>(range.second - range.first), stride);
+      }
+
+      //***********************************
+      template <typename TOffset, typename TExtent, typename TStride>
+      void add(TIndex extent, TIndex stride, const etl::strided_slice<TOffset, TExtent, TStride>& slice)
+      {
+        ETL_ASSERT((TIndex(slice.stride) > 0) && ((TIndex(slice.offset) + TIndex(slice.extent)) <= extent), ETL_ERROR(etl::mdspan_out_of_range));
+        (void)extent;
+
+        offset = static_cast<TIndex>(offset + (TIndex(slice.offset) * stride));
+        keep((slice.extent == 0) ? TIndex(0) : static_cast<TIndex>(1 + ((TIndex(slice.extent) - 1) / TIndex(slice.stride))),
+             static_cast<TIndex>(stride * TIndex(slice.stride)));
+      }
+
+      //***********************************
+      void keep(TIndex extent, TIndex stride)
+      {
+        extents[rank] = extent;
+        strides[rank] = stride;
+        ++rank;
+      }
+
+      TIndex offset;
+      size_t rank;
+      TIndex extents[(Rank == 0U) ? 1U : Rank];
+      TIndex strides[(Rank == 0U) ? 1U : Rank];
+    };
+
+    //*************************************************************************
+    /// Makes the layout_stride mapping for a submdspan.
+    //*************************************************************************
+    template <typename TMapping, typename TSlicer>
+    TMapping make_sub_mapping(const TSlicer& s, etl::integral_constant<bool, true>)
+    {
+      return TMapping(typename TMapping::extents_type(s.extents), s.strides);
+    }
+
+    template <typename TMapping, typename TSlicer>
+    TMapping make_sub_mapping(const TSlicer&, etl::integral_constant<bool, false>)
+    {
+      return TMapping();
+    }
+  }
+
+  //***************************************************************************
+  /// A view of part of an mdspan, without copying.
+  /// Each slice is one of:
+  /// An index, which removes the rank.
+  /// etl::full_extent, for all of the rank.
+  /// An etl::pair of [first, last) indices.
+  /// An etl::strided_slice.
+  /// The result has dynamic extents and layout_stride.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, typename TExtents, typename TLayout, typename... TSlices>
+  etl::mdspan<T, etl::dextents<typename TExtents::index_type, private_mdspan::count_ranges<TSlices...>::value>, etl::layout_stride>
+    submdspan(const etl::mdspan<T, TExtents, TLayout>& source, TSlices... slices)
+  {
+    ETL_STATIC_ASSERT(sizeof...(TSlices) == TExtents::rank(), "Wrong number of slices");
+
+    typedef typename TExtents::index_type index_type;
+    typedef etl::dextents<index_type, private_mdspan::count_ranges<TSlices...>::value> sub_extents_type;
+    typedef etl::mdspan<T, sub_extents_type, etl::layout_stride> sub_mdspan_type;
+    typedef typename sub_mdspan_type::mapping_type sub_mapping_type;
+
+    private_mdspan::slicer<index_type, sub_extents_type::rank()> s;
+
+    size_t r = 0U;
+    const int expand[] = { 0, (s.add(source.extent(r), source.stride(r), slices), ++r, 0)... };
+    (void)expand;
+
+    return sub_mdspan_type(source.data_handle() + s.offset,
+                           private_mdspan::make_sub_mapping<sub_mapping_type>(s, etl::integral_constant<bool, (sub_extents_type::rank() != 0U)>()));
+  }
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// The element type and extents of nested etl::arrays, as used by etl::multi_array.
+    //*************************************************************************
+    template <typename T, size_t... Extents>
+    struct nested_array
+    {
+      typedef T value_type;
+      typedef etl::extents<size_t, Extents...> extents_type;
+    };
+
+    template <typename T, size_t N, size_t... Extents>
+    struct nested_array<etl::array<T, N>, Extents...> : nested_array<T, Extents..., N>
+    {
+    };
+  }
+
+  //***************************************************************************
+  /// A row major view of an etl::multi_array or etl::array.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t N>
+  etl::mdspan<typename private_mdspan::nested_array<etl::array<T, N> >::value_type,
+              typename private_mdspan::nested_array<etl::array<T, N> >::extents_type>
+    make_mdspan(etl::array<T, N>& a)
+  {
+    typedef private_mdspan::nested_array<etl::array<T, N> > nested;
+    typedef typename nested::value_type value_type;
+
+    return etl::mdspan<value_type, typename nested::extents_type>(reinterpret_cast<value_type*>(a.data()), typename nested::extents_type());
+  }
+
+  //***************************************************************************
+  /// A row major view of a const etl::multi_array or etl::array.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t N>
+  etl::mdspan<const typename private_mdspan::nested_array<etl::array<T, N> >::value_type,
+              typename private_mdspan::nested_array<etl::array<T, N> >::extents_type>
+    make_mdspan(const etl::array<T, N>& a)
+  {
+    typedef private_mdspan::nested_array<etl::array<T, N> > nested;
+    typedef const typename nested::value_type value_type;
+
+    return etl::mdspan<value_type, typename nested::extents_type>(reinterpret_cast<value_type*>(a.data()), typename nested::extents_type());
+  }
+}
+
+#endif
+#endif
@@ -42,6 +42,8 @@ SOFTWARE.
 
 #include <assert.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
 
 #if defined(ETL_IN_UNIT_TEST) || ETL_USING_STL
   #include <memory>
@@ -67,6 +69,44 @@ namespace etl
 #endif
   }
 
+  //*****************************************************************************
+  /// The minimum distance between two objects to avoid false sharing, and the
+  /// maximum size of memory to promote true sharing.
+  /// ETL_CACHE_LINE_SIZE, if the profile defines it, otherwise 1, as a target
+  /// without a data cache has no false sharing.
+  /// https://en.cppreference.com/w/cpp/thread/hardware_destructive_interference_size
+  ///\ingroup memory
+  //*****************************************************************************
+#if ETL_CACHE_LINE_SIZE > 0
+  static ETL_CONSTANT size_t hardware_destructive_interference_size  = ETL_CACHE_LINE_SIZE;
+  static ETL_CONSTANT size_t hardware_constructive_interference_size = ETL_CACHE_LINE_SIZE;
+#else
+  static ETL_CONSTANT size_t hardware_destructive_interference_size  = 1U;
+  static ETL_CONSTANT size_t hardware_constructive_interference_size = 1U;
+#endif
+
+  //*****************************************************************************
+  /// Hints that the memory at the address will soon be read.
+  /// Does nothing if the compiler has no prefetch builtin.
+  ///\ingroup memory
+  //*****************************************************************************
+  inline void prefetch_read(const void* address)
+  {
+    ETL_PREFETCH(address);
+    (void)address;
+  }
+
+  //*****************************************************************************
+  /// Hints that the memory at the address will soon be written.
+  /// Does nothing if the compiler has no prefetch builtin.
+  ///\ingroup memory
+  //*****************************************************************************
+  inline void prefetch_write(const void* address)
+  {
+    ETL_PREFETCH_WRITE(address);
+    (void)address;
+  }
+
 #if ETL_NOT_USING_STL
   //*****************************************************************************
   /// Fills uninitialised memory range with a value.
@@ -226,7 +266,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_copy(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
   {
     return etl::copy(i_begin, i_end, o_begin);
@@ -238,7 +278,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_copy(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
   {
     typedef typename etl::iterator_traits<TOutputIterator>::value_type value_type;
@@ -262,7 +302,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_copy(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::copy(i_begin, i_end, o_begin);
@@ -278,7 +318,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_copy(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::uninitialized_copy(i_begin, i_end, o_begin);
@@ -374,7 +414,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
   {
     return etl::move(i_begin, i_end, o_begin);
@@ -386,7 +426,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
   {
     typedef typename etl::iterator_traits<TOutputIterator>::value_type value_type;
@@ -410,7 +450,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::move(i_begin, i_end, o_begin);
@@ -426,7 +466,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::uninitialized_move(i_begin, i_end, o_begin);
@@ -499,7 +539,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TSize, typename TOutputIterator>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin)
   {
     return etl::move(i_begin, i_begin + n, o_begin);
@@ -511,7 +551,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TSize, typename TOutputIterator>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin)
   {
     typedef typename etl::iterator_traits<TOutputIterator>::value_type value_type;
@@ -535,7 +575,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::move(i_begin, i_begin + n, o_begin);
@@ -551,7 +591,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
     uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TCounter& count)
   {
     TOutputIterator o_end = etl::uninitialized_move(i_begin, i_begin + n, o_begin);
@@ -666,7 +706,7 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, void>::type
     uninitialized_default_construct(TOutputIterator o_begin, TOutputIterator o_end, TCounter& count)
   {
-    count = int32_t(etl::distance(o_begin, o_end));
+    count += int32_t(etl::distance(o_begin, o_end));
   }
 
   //*****************************************************************************
@@ -690,8 +730,7 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TOutputIterator>
-  typename etl::enable_if<!etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, void>::type
-  uninitialized_default_construct(TOutputIterator o_begin, TOutputIterator o_end)
+  void uninitialized_default_construct(TOutputIterator o_begin, TOutputIterator o_end)
   {
     std::uninitialized_default_construct(o_begin, o_end);
   }
@@ -703,10 +742,9 @@ namespace etl
   ///\ingroup memory
   //*****************************************************************************
   template <typename TOutputIterator, typename TCounter>
-  typename etl::enable_if<etl::is_trivially_constructible<typename etl::iterator_traits<TOutputIterator>::value_type>::value, void>::type
-    uninitialized_default_construct(TOutputIterator o_begin, TOutputIterator o_end, TCounter& count)
+  void uninitialized_default_construct(TOutputIterator o_begin, TOutputIterator o_end, TCounter& count)
   {
-    count = int32_t(etl::distance(o_begin, o_end));
+    count += int32_t(etl::distance(o_begin, o_end));
 
     std::uninitialized_default_construct(o_begin, o_end);
   }
@@ -1194,6 +1232,51 @@ namespace etl
   }
 #endif
 
+  //*****************************************************************************
+  /// Relocates a range of objects to uninitialised memory.
+  /// The objects are moved to the destination and the sources are destroyed.
+  /// Trivially copyable types are copied as raw memory.
+  /// The number of live objects is unchanged, so there is no debug counter version.
+  /// The ranges must not overlap.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  typename etl::enable_if<etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+    uninitialized_relocate(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
+  {
+    return etl::copy(i_begin, i_end, o_begin);
+  }
+
+  //*****************************************************************************
+  /// Relocates a range of objects to uninitialised memory.
+  /// The objects are moved to the destination and the sources are destroyed.
+  /// The number of live objects is unchanged, so there is no debug counter version.
+  /// The ranges must not overlap.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  typename etl::enable_if<!etl::is_trivially_copyable<typename etl::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
+    uninitialized_relocate(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
+  {
+    TOutputIterator o_end = etl::uninitialized_move(i_begin, i_end, o_begin);
+
+    etl::destroy(i_begin, i_end);
+
+    return o_end;
+  }
+
+  //*****************************************************************************
+  /// Relocates N objects to uninitialised memory.
+  /// The objects are moved to the destination and the sources are destroyed.
+  /// The ranges must not overlap.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TSize, typename TOutputIterator>
+  TOutputIterator uninitialized_relocate_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin)
+  {
+    return etl::uninitialized_relocate(i_begin, i_begin + n, o_begin);
+  }
+
   //*****************************************************************************
   /// Default deleter.
   ///\tparam T The pointed to type type.
@@ -1814,6 +1897,59 @@ namespace etl
     }
   };
 
+  namespace private_memory
+  {
+    //***************************************************************************
+    /// Fills memory through volatile stores, so that the writes are not elided.
+    /// The aligned middle of the range is written a word at a time.
+    //***************************************************************************
+    inline void volatile_fill(volatile char* p, size_t n, char value)
+    {
+      typedef uintptr_t word_t;
+
+      const size_t Word_Size = sizeof(word_t);
+
+      // Bytes up to the first word boundary.
+      while ((n != 0U) && ((reinterpret_cast<uintptr_t>(p) % Word_Size) != 0U))
+      {
+        *p++ = value;
+        --n;
+      }
+
+      if (n >= Word_Size)
+      {
+        const word_t pattern = (word_t(~word_t(0)) / UCHAR_MAX) * static_cast<unsigned char>(value);
+
+        volatile word_t* pw = reinterpret_cast<volatile word_t*>(p);
+        size_t words = n / Word_Size;
+        n -= words * Word_Size;
+
+        while (words >= 4U)
+        {
+          pw[0] = pattern;
+          pw[1] = pattern;
+          pw[2] = pattern;
+          pw[3] = pattern;
+          pw    += 4;
+          words -= 4U;
+        }
+
+        while (words--)
+        {
+          *pw++ = pattern;
+        }
+
+        p = reinterpret_cast<volatile char*>(pw);
+      }
+
+      // The remaining bytes.
+      while (n--)
+      {
+        *p++ = value;
+      }
+    }
+  }
+
   //*****************************************************************************
   /// A low level function that clears an object's memory to zero.
   ///\param p Pointer to the memory.
@@ -1822,10 +1958,7 @@ namespace etl
   //*****************************************************************************
   inline void memory_clear(volatile char* p, size_t n)
   {
-    while (n--)
-    {
-      *p++ = 0;
-    }
+    private_memory::volatile_fill(p, n, 0);
   }
 
   //*****************************************************************************
@@ -1877,10 +2010,7 @@ namespace etl
   //*****************************************************************************
   inline void memory_set(volatile char* p, size_t n, char value)
   {
-    while (n--)
-    {
-      *p++ = value;
-    }
+    private_memory::volatile_fill(p, n, value);
   }
 
   //*****************************************************************************
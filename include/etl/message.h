@@ -36,6 +36,18 @@ SOFTWARE.
 #include "exception.h"
 #include "message_types.h"
 
+//*****************************************************************************
+/// message_packet, message_router and fsm_state are variadic for C++17, with
+/// no limit on the number of message types. The generated versions, for up
+/// to 16 types, are used for earlier standards, or when
+/// ETL_USE_LEGACY_MESSAGE_TEMPLATES is defined.
+//*****************************************************************************
+#if ETL_CPP17_SUPPORTED && !defined(ETL_USE_LEGACY_MESSAGE_TEMPLATES)
+  #define ETL_USING_VARIADIC_MESSAGES 1
+#else
+  #define ETL_USING_VARIADIC_MESSAGES 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
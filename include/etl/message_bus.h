@@ -41,6 +41,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
 
 namespace etl
 {
@@ -70,6 +71,270 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// The interface for a message bus index.
+  /// Records, for each message id, which of the bus's subscribers accept it,
+  /// so that a broadcast only visits the routers that handle the message.
+  /// Message ids outside the range 0 to max_ids() - 1 are not indexed and are
+  /// offered to every subscriber as before.
+  //***************************************************************************
+  class imessage_bus_index
+  {
+  public:
+
+    typedef uint32_t word_t;
+
+    static ETL_CONSTANT size_t Bits_Per_Word = 32U;
+
+    //*************************************************************************
+    /// The maximum number of message ids.
+    //*************************************************************************
+    size_t max_ids() const
+    {
+      return Max_Ids;
+    }
+
+    //*************************************************************************
+    /// The maximum number of subscribers.
+    //*************************************************************************
+    size_t max_routers() const
+    {
+      return Max_Routers;
+    }
+
+    //*************************************************************************
+    /// The number of words in the subscriber set for each message id.
+    //*************************************************************************
+    size_t words_per_id() const
+    {
+      return Words_Per_Id;
+    }
+
+    //*************************************************************************
+    /// Clears the index.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (Max_Ids * Words_Per_Id); ++i)
+      {
+        p_words[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Is the message id in range?
+    //*************************************************************************
+    bool is_valid_id(etl::message_id_t id) const
+    {
+      return size_t(id) < Max_Ids;
+    }
+
+    //*************************************************************************
+    /// The subscriber set for the message id.
+    /// Bit n is set if the subscriber at position n accepts the id.
+    //*************************************************************************
+    const word_t* subscribers(etl::message_id_t id) const
+    {
+      return p_words + (size_t(id) * Words_Per_Id);
+    }
+
+    //*************************************************************************
+    /// Marks the subscriber at the position as accepting the message id.
+    //*************************************************************************
+    void set(etl::message_id_t id, size_t position)
+    {
+      p_words[(size_t(id) * Words_Per_Id) + (position / Bits_Per_Word)] |= word_t(1U) << (position % Bits_Per_Word);
+    }
+
+    //*************************************************************************
+    /// Does the subscriber at the position accept the message id?
+    //*************************************************************************
+    bool test(etl::message_id_t id, size_t position) const
+    {
+      return (subscribers(id)[position / Bits_Per_Word] & (word_t(1U) << (position % Bits_Per_Word))) != 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imessage_bus_index(word_t* p_words_, size_t max_ids_, size_t max_routers_)
+      : p_words(p_words_),
+        Max_Ids(max_ids_),
+        Max_Routers(max_routers_),
+        Words_Per_Id((max_routers_ + Bits_Per_Word - 1U) / Bits_Per_Word)
+    {
+    }
+
+  private:
+
+    word_t*      p_words; ///< The subscriber set for each message id.
+    const size_t Max_Ids;
+    const size_t Max_Routers;
+    const size_t Words_Per_Id;
+  };
+
+  //***************************************************************************
+  /// A message bus index with storage for the specified number of message ids
+  /// and subscribers.
+  /// Pass to message_bus::set_index().
+  //***************************************************************************
+  template <size_t VMaxIds, size_t VMaxRouters>
+  class message_bus_index : public imessage_bus_index
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VMaxIds > 0U) && (VMaxRouters > 0U), "Zero sized index");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    message_bus_index()
+      : imessage_bus_index(buffer, VMaxIds, VMaxRouters)
+    {
+      clear();
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Words = (VMaxRouters + Bits_Per_Word - 1U) / Bits_Per_Word;
+
+    word_t buffer[VMaxIds * Words];
+  };
+
+  //***************************************************************************
+  /// Records, for each router id, where the bus's subscribers with that id
+  /// are in its subscriber list, so that an addressed message goes straight
+  /// to them without a search.
+  /// Router ids outside the range 0 to max_ids() - 1 are not indexed and are
+  /// searched for as before.
+  //***************************************************************************
+  class imessage_bus_router_index
+  {
+  public:
+
+    typedef uint_least8_t position_t;
+
+    //*************************************************************************
+    /// The maximum number of router ids.
+    //*************************************************************************
+    size_t max_ids() const
+    {
+      return Max_Ids;
+    }
+
+    //*************************************************************************
+    /// Clears the index.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Max_Ids; ++i)
+      {
+        p_first[i] = 0U;
+        p_last[i]  = 0U;
+      }
+
+      first_bus = 0U;
+    }
+
+    //*************************************************************************
+    /// Is the router id in range?
+    //*************************************************************************
+    bool is_valid_id(etl::message_router_id_t id) const
+    {
+      return size_t(id) < Max_Ids;
+    }
+
+    //*************************************************************************
+    /// The position of the first subscriber with the id.
+    //*************************************************************************
+    size_t first(etl::message_router_id_t id) const
+    {
+      return p_first[id];
+    }
+
+    //*************************************************************************
+    /// The position after the last subscriber with the id.
+    //*************************************************************************
+    size_t last(etl::message_router_id_t id) const
+    {
+      return p_last[id];
+    }
+
+    //*************************************************************************
+    /// The position of the first subscriber that is a message bus.
+    //*************************************************************************
+    size_t first_message_bus() const
+    {
+      return first_bus;
+    }
+
+    //*************************************************************************
+    /// Sets the positions of the subscribers with the id.
+    //*************************************************************************
+    void set(etl::message_router_id_t id, size_t first_, size_t last_)
+    {
+      p_first[id] = position_t(first_);
+      p_last[id]  = position_t(last_);
+    }
+
+    //*************************************************************************
+    /// Sets the position of the first subscriber that is a message bus.
+    //*************************************************************************
+    void set_first_message_bus(size_t position)
+    {
+      first_bus = position_t(position);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imessage_bus_router_index(position_t* p_first_, position_t* p_last_, size_t max_ids_)
+      : p_first(p_first_),
+        p_last(p_last_),
+        first_bus(0U),
+        Max_Ids(max_ids_)
+    {
+    }
+
+  private:
+
+    position_t*  p_first;   ///< The first subscriber for each id.
+    position_t*  p_last;    ///< One past the last subscriber for each id.
+    position_t   first_bus; ///< The first subscriber that is a message bus.
+    const size_t Max_Ids;
+  };
+
+  //***************************************************************************
+  /// A message bus router index with storage for the specified number of
+  /// router ids. The default covers every ordinary router id.
+  /// Pass to message_bus::set_router_index().
+  //***************************************************************************
+  template <size_t VMaxIds = etl::imessage_router::MAX_MESSAGE_ROUTER + 1U>
+  class message_bus_router_index : public imessage_bus_router_index
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMaxIds > 0U, "Zero sized index");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    message_bus_router_index()
+      : imessage_bus_router_index(first_buffer, last_buffer, VMaxIds)
+    {
+      clear();
+    }
+
+  private:
+
+    position_t first_buffer[VMaxIds];
+    position_t last_buffer[VMaxIds];
+  };
+
   //***************************************************************************
   /// Interface for message bus
   //***************************************************************************
@@ -105,6 +370,8 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          index_is_valid        = false;
+          router_index_is_valid = false;
         }
       }
 
@@ -128,6 +395,8 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        index_is_valid        = false;
+        router_index_is_valid = false;
       }
     }
 
@@ -141,6 +410,8 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        index_is_valid        = false;
+        router_index_is_valid = false;
       }
     }
 
@@ -166,21 +437,18 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
+#if ETL_CPP11_SUPPORTED
+          const etl::message_id_t id = shared_msg.get_message().get_message_id();
 
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
+          if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id))
           {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(shared_msg.get_message().get_message_id()))
-            {
-              router.receive(shared_msg);
-            }
-
-            ++irouter;
+            broadcast_indexed(id, shared_msg);
+          }
+          else
+#endif
+          {
+            broadcast<etl::shared_message>(shared_msg.get_message().get_message_id(), shared_msg);
           }
-
           break;
         }
 
@@ -188,40 +456,7 @@ namespace etl
         // Must be an addressed message.
         default:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Find routers with the id.
-          ETL_OR_STD::pair<router_list_t::iterator, router_list_t::iterator> range = etl::equal_range(router_list.begin(),
-                                                                                                      router_list.end(),
-                                                                                                      destination_router_id,
-                                                                                                      compare_router_id());
-
-          // Call all of them.
-          while (range.first != range.second)
-          {
-            if ((*(range.first))->accepts(shared_msg.get_message().get_message_id()))
-            {
-              (*(range.first))->receive(shared_msg);
-            }
-
-            ++range.first;
-          }
-
-          // Do any message buses.
-          // These are always at the end of the list.
-          irouter = etl::lower_bound(router_list.begin(),
-                                     router_list.end(),
-                                     etl::imessage_bus::MESSAGE_BUS,
-                                     compare_router_id());
-
-          while (irouter != router_list.end())
-          {
-            // So pass it on.
-            (*irouter)->receive(destination_router_id, shared_msg);
-
-            ++irouter;
-          }
-
+          send_addressed<etl::shared_message&>(destination_router_id, shared_msg.get_message().get_message_id(), shared_msg);
           break;
         }
       }
@@ -237,21 +472,7 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
-
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
-          {
-            etl::imessage_router& router = **irouter;
-
-            if (router.accepts(message.get_message_id()))
-            {
-              router.receive(message);
-            }
-
-            ++irouter;
-          }
-
+          broadcast<const etl::imessage&>(message.get_message_id(), message);
           break;
         }
 
@@ -259,41 +480,54 @@ namespace etl
         // Must be an addressed message.
         default:
         {
-          router_list_t::iterator irouter = router_list.begin();
+          send_addressed<const etl::imessage&>(destination_router_id, message.get_message_id(), message);
+          break;
+        }
+      }
+    }
 
-          // Find routers with the id.
-          ETL_OR_STD::pair<router_list_t::iterator, router_list_t::iterator> range = etl::equal_range(router_list.begin(),
-                                                                                                      router_list.end(),
-                                                                                                      destination_router_id,
-                                                                                                      compare_router_id());
+    using etl::imessage_router::receive_batch;
 
-          // Call all of them.
-          while (range.first != range.second)
-          {
-            if ((*(range.first))->accepts(message.get_message_id()))
-            {
-              (*(range.first))->receive(message);
-            }
+    //*******************************************
+    /// Broadcasts a batch of messages.
+    /// Each subscriber is given all of the messages it accepts before the
+    /// next subscriber is visited. A subscriber that accepts every message
+    /// in the batch receives it with one call to receive_batch().
+    //*******************************************
+    virtual void receive_batch(const etl::imessage* const* p_messages, size_t count) ETL_OVERRIDE
+    {
+      if ((p_index != ETL_NULLPTR) && !index_is_valid)
+      {
+        rebuild_index();
+      }
 
-            ++range.first;
-          }
+      for (size_t position = 0U; position < router_list.size(); ++position)
+      {
+        etl::imessage_router& router = *router_list[position];
 
-          // Do any message buses.
-          // These are always at the end of the list.
-          irouter = etl::lower_bound(router_list.begin(),
-                                     router_list.end(),
-                                     etl::imessage_bus::MESSAGE_BUS,
-                                     compare_router_id());
+        size_t accepted = 0U;
 
-          while (irouter != router_list.end())
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (router_accepts(position, p_messages[i]->get_message_id()))
           {
-            // So pass it on.
-            (*irouter)->receive(destination_router_id, message);
-
-            ++irouter;
+            ++accepted;
           }
+        }
 
-          break;
+        if (accepted == count)
+        {
+          router.receive_batch(p_messages, count);
+        }
+        else if (accepted != 0U)
+        {
+          for (size_t i = 0U; i < count; ++i)
+          {
+            if (router_accepts(position, p_messages[i]->get_message_id()))
+            {
+              router.receive(*p_messages[i]);
+            }
+          }
         }
       }
     }
@@ -318,7 +552,76 @@ namespace etl
     //*******************************************
     void clear()
     {
-      return router_list.clear();
+      router_list.clear();
+      index_is_valid        = false;
+      router_index_is_valid = false;
+    }
+
+    //*******************************************
+    /// Uses the index to find the subscribers for each broadcast message.
+    /// The index is rebuilt on the first broadcast after the subscribers
+    /// change, by asking each subscriber which of the indexed ids it accepts.
+    /// Subscribers must not change the ids they accept while subscribed.
+    /// Returns false, and does not use the index, if it cannot hold as many
+    /// subscribers as the bus.
+    //*******************************************
+    bool set_index(etl::imessage_bus_index& index)
+    {
+      if (index.max_routers() < router_list.max_size())
+      {
+        p_index = ETL_NULLPTR;
+      }
+      else
+      {
+        p_index = &index;
+        rebuild_index();
+      }
+
+      return p_index != ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Removes the index. Every subscriber is offered each broadcast message.
+    //*******************************************
+    void clear_index()
+    {
+      p_index = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Is an index in use?
+    //*******************************************
+    bool has_index() const
+    {
+      return p_index != ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Uses the router index to find the subscribers for addressed messages.
+    /// The index is rebuilt on the first addressed message after the
+    /// subscribers change.
+    //*******************************************
+    void set_router_index(etl::imessage_bus_router_index& index)
+    {
+      p_router_index = &index;
+      rebuild_router_index();
+    }
+
+    //*******************************************
+    /// Removes the router index. The subscribers are searched for each
+    /// addressed message.
+    //*******************************************
+    void clear_router_index()
+    {
+      p_router_index = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Is a router index in use?
+    //*******************************************
+    bool has_router_index() const
+    {
+      return p_router_index != ETL_NULLPTR;
     }
 
     //********************************************
@@ -346,12 +649,250 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR),
+        p_router_index(ETL_NULLPTR),
+        index_is_valid(false),
+        router_index_is_valid(false)
     {
     }
 
   private:
 
+    //*******************************************
+    /// Sends the message to every subscriber that accepts the id.
+    //*******************************************
+    template <typename TMessage>
+    void broadcast(etl::message_id_t id, TMessage message)
+    {
+      if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id))
+      {
+        if (!index_is_valid)
+        {
+          rebuild_index();
+        }
+
+        const etl::imessage_bus_index::word_t* p_subscribers = p_index->subscribers(id);
+
+        // Only visit the subscribers that accept the id.
+        for (size_t i = 0U; i < p_index->words_per_id(); ++i)
+        {
+          etl::imessage_bus_index::word_t word = p_subscribers[i];
+
+          while (word != 0U)
+          {
+            size_t position = (i * etl::imessage_bus_index::Bits_Per_Word) + etl::count_trailing_zeros(word);
+
+            if (position < router_list.size())
+            {
+              router_list[position]->receive(message);
+            }
+
+            word &= word - 1U;
+          }
+        }
+      }
+      else
+      {
+        router_list_t::iterator irouter = router_list.begin();
+
+        // Broadcast to everyone.
+        while (irouter != router_list.end())
+        {
+          etl::imessage_router& router = **irouter;
+
+          if (router.accepts(id))
+          {
+            router.receive(message);
+          }
+
+          ++irouter;
+        }
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*******************************************
+    /// Sends the shared message to every subscriber in the index that accepts the id.
+    /// The references for all of the subscribers are added in one operation,
+    /// and each subscriber is moved its own adopted copy.
+    //*******************************************
+    void broadcast_indexed(etl::message_id_t id, etl::shared_message& shared_msg)
+    {
+      if (!index_is_valid)
+      {
+        rebuild_index();
+      }
+
+      const etl::imessage_bus_index::word_t* p_subscribers = p_index->subscribers(id);
+
+      // Count the subscribers.
+      uint32_t count = 0U;
+
+      for (size_t i = 0U; i < p_index->words_per_id(); ++i)
+      {
+        count += etl::count_bits(p_subscribers[i]);
+      }
+
+      shared_msg.acquire(count);
+
+      for (size_t i = 0U; i < p_index->words_per_id(); ++i)
+      {
+        etl::imessage_bus_index::word_t word = p_subscribers[i];
+
+        while (word != 0U)
+        {
+          size_t position = (i * etl::imessage_bus_index::Bits_Per_Word) + etl::count_trailing_zeros(word);
+
+          router_list[position]->receive(etl::shared_message(etl::shared_message::adopt_reference_t(), shared_msg));
+
+          word &= word - 1U;
+        }
+      }
+    }
+#endif
+
+    //*******************************************
+    /// Sends the message to the subscribers with the router id, then passes
+    /// it on to any subscribers that are message buses.
+    //*******************************************
+    template <typename TMessage>
+    void send_addressed(etl::message_router_id_t destination_router_id, etl::message_id_t id, TMessage message)
+    {
+      size_t first;
+      size_t last;
+      size_t first_bus;
+
+      if (p_router_index != ETL_NULLPTR)
+      {
+        if (!router_index_is_valid)
+        {
+          rebuild_router_index();
+        }
+
+        first_bus = p_router_index->first_message_bus();
+      }
+      else
+      {
+        first_bus = etl::lower_bound(router_list.begin(),
+                                     router_list.end(),
+                                     etl::imessage_bus::MESSAGE_BUS,
+                                     compare_router_id()) - router_list.begin();
+      }
+
+      if ((p_router_index != ETL_NULLPTR) && p_router_index->is_valid_id(destination_router_id))
+      {
+        first = p_router_index->first(destination_router_id);
+        last  = p_router_index->last(destination_router_id);
+      }
+      else
+      {
+        // Find routers with the id.
+        ETL_OR_STD::pair<router_list_t::iterator, router_list_t::iterator> range = etl::equal_range(router_list.begin(),
+                                                                                                    router_list.end(),
+                                                                                                    destination_router_id,
+                                                                                                    compare_router_id());
+
+        first = range.first  - router_list.begin();
+        last  = range.second - router_list.begin();
+      }
+
+      // Call all of them.
+      while (first != last)
+      {
+        etl::imessage_router& router = *router_list[first];
+
+        if (router.accepts(id))
+        {
+          router.receive(message);
+        }
+
+        ++first;
+      }
+
+      // Do any message buses.
+      // These are always at the end of the list.
+      while (first_bus != router_list.size())
+      {
+        // So pass it on.
+        router_list[first_bus]->receive(destination_router_id, message);
+
+        ++first_bus;
+      }
+    }
+
+    //*******************************************
+    /// Records where the subscribers with each indexed router id are.
+    //*******************************************
+    void rebuild_router_index()
+    {
+      p_router_index->clear();
+
+      size_t position = 0U;
+
+      while (position != router_list.size())
+      {
+        const etl::message_router_id_t id = router_list[position]->get_message_router_id();
+
+        // The list is sorted by id, so routers with the same id are together.
+        size_t last = position + 1U;
+
+        while ((last != router_list.size()) && (router_list[last]->get_message_router_id() == id))
+        {
+          ++last;
+        }
+
+        if (p_router_index->is_valid_id(id))
+        {
+          p_router_index->set(id, position, last);
+        }
+
+        position = last;
+      }
+
+      p_router_index->set_first_message_bus(etl::lower_bound(router_list.begin(),
+                                                             router_list.end(),
+                                                             etl::imessage_bus::MESSAGE_BUS,
+                                                             compare_router_id()) - router_list.begin());
+
+      router_index_is_valid = true;
+    }
+
+    //*******************************************
+    /// Does the subscriber at the position accept the id?
+    /// Uses the index, if there is one and it holds the id.
+    //*******************************************
+    bool router_accepts(size_t position, etl::message_id_t id) const
+    {
+      if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id))
+      {
+        return p_index->test(id, position);
+      }
+
+      return router_list[position]->accepts(id);
+    }
+
+    //*******************************************
+    /// Records which indexed ids each subscriber accepts.
+    //*******************************************
+    void rebuild_index()
+    {
+      p_index->clear();
+
+      for (size_t id = 0U; id < p_index->max_ids(); ++id)
+      {
+        for (size_t position = 0U; position < router_list.size(); ++position)
+        {
+          if (router_list[position]->accepts(etl::message_id_t(id)))
+          {
+            p_index->set(etl::message_id_t(id), position);
+          }
+        }
+      }
+
+      index_is_valid = true;
+    }
+
     //*******************************************
     // How to compare routers to router ids.
     //*******************************************
@@ -368,7 +909,11 @@ namespace etl
       }
     };
 
-    router_list_t& router_list;
+    router_list_t&                  router_list;
+    etl::imessage_bus_index*        p_index;
+    etl::imessage_bus_router_index* p_router_index;
+    bool                            index_is_valid;
+    bool                            router_index_is_valid;
   };
 
   //***************************************************************************
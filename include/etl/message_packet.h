@@ -57,9 +57,13 @@ SOFTWARE.
 #include "largest.h"
 #include "alignment.h"
 #include "utility.h"
+#include "placement_new.h"
 
 #include <stdint.h>
 
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/message_packet_variadic.h"
+#else
 namespace etl
 {
   //***************************************************************************
@@ -95,6 +99,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -145,6 +173,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -210,6 +354,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -343,6 +503,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -393,6 +577,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -458,6 +758,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -588,6 +904,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -638,48 +978,164 @@ namespace etl
     }
   #endif
 
-    //********************************************
-    ~message_packet()
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, message_packet&>::type
+      operator =(TMessage&& msg)
     {
-      delete_current_message();
-    }
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
 
-    //********************************************
-    etl::imessage& get() ETL_NOEXCEPT
-    {
-      return *static_cast<etl::imessage*>(data);
+      return *this;
     }
 
-    //********************************************
-    const etl::imessage& get() const ETL_NOEXCEPT
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
     {
-      return *static_cast<const etl::imessage*>(data);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value), "Unsupported type for this message packet");
 
-    //********************************************
-    bool is_valid() const
-    {
-      return valid;
-    }
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
 
+      return *pmsg;
+    }
+  #else
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, message_packet&>::type
+      operator =(const TMessage& msg)
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: 
-          return true;
-        default:
-          return false;
-      }
+      emplace<TMessage>(msg);
+
+      return *this;
     }
 
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      return accepts(msg.get_message_id());
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      switch (id)
+      {
+        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
+        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: 
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
 
     //**********************************************
     template <etl::message_id_t Id>
@@ -703,6 +1159,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -830,6 +1302,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -880,6 +1376,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -945,6 +1557,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -1068,6 +1696,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -1118,52 +1770,168 @@ namespace etl
     }
   #endif
 
-    //********************************************
-    ~message_packet()
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, message_packet&>::type
+      operator =(TMessage&& msg)
     {
-      delete_current_message();
-    }
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
 
-    //********************************************
-    etl::imessage& get() ETL_NOEXCEPT
-    {
-      return *static_cast<etl::imessage*>(data);
+      return *this;
     }
 
-    //********************************************
-    const etl::imessage& get() const ETL_NOEXCEPT
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
     {
-      return *static_cast<const etl::imessage*>(data);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value), "Unsupported type for this message packet");
 
-    //********************************************
-    bool is_valid() const
-    {
-      return valid;
-    }
+      delete_current_message();
+      valid = false;
 
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, message_packet&>::type
+      operator =(const TMessage& msg)
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: 
-          return true;
-        default:
-          return false;
-      }
+      emplace<TMessage>(msg);
+
+      return *this;
     }
 
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      return accepts(msg.get_message_id());
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
     }
 
     //**********************************************
-    template <etl::message_id_t Id>
-    static ETL_CONSTEXPR bool accepts()
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      switch (id)
+      {
+        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
+        case T9::ID: case T10::ID: case T11::ID: case T12::ID: 
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static ETL_CONSTEXPR bool accepts()
     {
       return accepts(Id);
     }
@@ -1183,6 +1951,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -1303,6 +2087,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -1353,6 +2161,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -1418,6 +2342,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -1535,6 +2475,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -1585,57 +2549,173 @@ namespace etl
     }
   #endif
 
-    //********************************************
-    ~message_packet()
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, message_packet&>::type
+      operator =(TMessage&& msg)
     {
-      delete_current_message();
-    }
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
 
-    //********************************************
-    etl::imessage& get() ETL_NOEXCEPT
-    {
-      return *static_cast<etl::imessage*>(data);
+      return *this;
     }
 
-    //********************************************
-    const etl::imessage& get() const ETL_NOEXCEPT
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
     {
-      return *static_cast<const etl::imessage*>(data);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value), "Unsupported type for this message packet");
 
-    //********************************************
-    bool is_valid() const
-    {
-      return valid;
-    }
+      delete_current_message();
+      valid = false;
 
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, message_packet&>::type
+      operator =(const TMessage& msg)
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: 
-          return true;
-        default:
-          return false;
-      }
+      emplace<TMessage>(msg);
+
+      return *this;
     }
 
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      return accepts(msg.get_message_id());
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
     }
 
     //**********************************************
-    template <etl::message_id_t Id>
-    static ETL_CONSTEXPR bool accepts()
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
     {
-      return accepts(Id);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value), "Unsupported type for this message packet");
 
-    //**********************************************
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      switch (id)
+      {
+        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
+        case T9::ID: case T10::ID: 
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static ETL_CONSTEXPR bool accepts()
+    {
+      return accepts(Id);
+    }
+
+    //**********************************************
     template <typename TMessage>
     static ETL_CONSTEXPR
     typename etl::enable_if<!etl::is_integral<TMessage>::value, bool>::type
@@ -1650,6 +2730,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -1764,6 +2860,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -1814,6 +2934,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -1879,6 +3115,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -1989,6 +3241,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -2039,54 +3315,170 @@ namespace etl
     }
   #endif
 
-    //********************************************
-    ~message_packet()
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7, T8>::value, message_packet&>::type
+      operator =(TMessage&& msg)
     {
-      delete_current_message();
-    }
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
 
-    //********************************************
-    etl::imessage& get() ETL_NOEXCEPT
-    {
-      return *static_cast<etl::imessage*>(data);
+      return *this;
     }
 
-    //********************************************
-    const etl::imessage& get() const ETL_NOEXCEPT
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
     {
-      return *static_cast<const etl::imessage*>(data);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value), "Unsupported type for this message packet");
 
-    //********************************************
-    bool is_valid() const
-    {
-      return valid;
-    }
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
 
+      return *pmsg;
+    }
+  #else
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, message_packet&>::type
+      operator =(const TMessage& msg)
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        
-          return true;
-        default:
-          return false;
-      }
+      emplace<TMessage>(msg);
+
+      return *this;
     }
 
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      return accepts(msg.get_message_id());
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
     }
 
     //**********************************************
-    template <etl::message_id_t Id>
-    static ETL_CONSTEXPR bool accepts()
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
     {
-      return accepts(Id);
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      switch (id)
+      {
+        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
+        
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static ETL_CONSTEXPR bool accepts()
+    {
+      return accepts(Id);
     }
 
     //**********************************************
@@ -2104,6 +3496,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7, T8>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -2211,6 +3619,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -2261,6 +3693,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6, T7>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -2325,6 +3873,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6, T7>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -2429,6 +3993,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -2479,57 +4067,173 @@ namespace etl
     }
   #endif
 
-    //********************************************
-    ~message_packet()
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5, T6>::value, message_packet&>::type
+      operator =(TMessage&& msg)
     {
-      delete_current_message();
-    }
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
 
-    //********************************************
-    etl::imessage& get() ETL_NOEXCEPT
-    {
-      return *static_cast<etl::imessage*>(data);
+      return *this;
     }
 
-    //********************************************
-    const etl::imessage& get() const ETL_NOEXCEPT
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
     {
-      return *static_cast<const etl::imessage*>(data);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value), "Unsupported type for this message packet");
 
-    //********************************************
-    bool is_valid() const
-    {
-      return valid;
-    }
+      delete_current_message();
+      valid = false;
 
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, message_packet&>::type
+      operator =(const TMessage& msg)
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: 
-          return true;
-        default:
-          return false;
-      }
+      emplace<TMessage>(msg);
+
+      return *this;
     }
 
     //**********************************************
-    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      return accepts(msg.get_message_id());
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
     }
 
     //**********************************************
-    template <etl::message_id_t Id>
-    static ETL_CONSTEXPR bool accepts()
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
     {
-      return accepts(Id);
-    }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value), "Unsupported type for this message packet");
 
-    //**********************************************
-    template <typename TMessage>
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      switch (id)
+      {
+        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: 
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static ETL_CONSTEXPR bool accepts()
+    {
+      return accepts(Id);
+    }
+
+    //**********************************************
+    template <typename TMessage>
     static ETL_CONSTEXPR
     typename etl::enable_if<!etl::is_integral<TMessage>::value, bool>::type
       accepts()
@@ -2543,6 +4247,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5, T6>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -2644,6 +4364,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -2694,6 +4438,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4, T5>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -2758,6 +4618,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4, T5>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -2855,6 +4731,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -2905,6 +4805,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3, T4>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3, T4>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3, T4>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -2969,6 +4985,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3, T4>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -3061,55 +5093,195 @@ namespace etl
     {
       add_new_message(etl::move(msg));
     }
-  #endif
+  #endif
+
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
+    //**********************************************
+    message_packet(const message_packet& other)
+      : valid(other.is_valid())
+    {
+      if (valid)
+      {
+        add_new_message(other.get());
+      }
+    }
+
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    message_packet(message_packet&& other)
+      : valid(other.is_valid())
+    {
+      if (valid)
+      {
+        add_new_message(etl::move(other.get()));
+      }
+    }
+  #endif
+
+    //**********************************************
+    message_packet& operator =(const message_packet& rhs)
+    {
+      delete_current_message();
+      valid = rhs.is_valid();
+      if (valid)
+      {
+        add_new_message(rhs.get());
+      }
+
+      return *this;
+    }
+
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    message_packet& operator =(message_packet&& rhs)
+    {
+      delete_current_message();
+      valid = rhs.is_valid();
+      if (valid)
+      {
+        add_new_message(etl::move(rhs.get()));
+      }
+
+      return *this;
+    }
+  #endif
+
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2, T3>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2, T3>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
 
     //**********************************************
-    message_packet(const message_packet& other)
-      : valid(other.is_valid())
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
     {
-      if (valid)
-      {
-        add_new_message(other.get());
-      }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
     }
 
-  #if ETL_CPP11_SUPPORTED
     //**********************************************
-    message_packet(message_packet&& other)
-      : valid(other.is_valid())
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
     {
-      if (valid)
-      {
-        add_new_message(etl::move(other.get()));
-      }
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
     }
-  #endif
 
     //**********************************************
-    message_packet& operator =(const message_packet& rhs)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
     {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3>::value), "Unsupported type for this message packet");
+
       delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(rhs.get());
-      }
+      valid = false;
 
-      return *this;
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
     }
 
-  #if ETL_CPP11_SUPPORTED
     //**********************************************
-    message_packet& operator =(message_packet&& rhs)
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
     {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2, T3>::value), "Unsupported type for this message packet");
+
       delete_current_message();
-      valid = rhs.is_valid();
-      if (valid)
-      {
-        add_new_message(etl::move(rhs.get()));
-      }
+      valid = false;
 
-      return *this;
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
     }
   #endif
 
@@ -3177,6 +5349,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2, T3>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -3268,6 +5456,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1, T2>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -3318,6 +5530,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1, T2>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1, T2>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1, T2>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -3382,6 +5710,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1, T2>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -3470,6 +5814,30 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+  #else
+    //********************************************
+    /// Constructs from one of the message types, without the switch on the id.
+    //********************************************
+    template <typename TMessage>
+    explicit message_packet(const TMessage& msg, typename etl::enable_if<etl::is_one_of<TMessage, T1>::value, int>::type = 0)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) TMessage(msg);
+    }
+  #endif
+
     //**********************************************
     message_packet(const message_packet& other)
       : valid(other.is_valid())
@@ -3520,6 +5888,122 @@ namespace etl
     }
   #endif
 
+  #if ETL_CPP11_SUPPORTED
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, T1>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+  #else
+    //**********************************************
+    /// Replaces the message with one of the message types, without the switch on the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<TMessage, T1>::value, message_packet&>::type
+      operator =(const TMessage& msg)
+    {
+      emplace<TMessage>(msg);
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage>
+    TMessage& emplace()
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage();
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1>
+    TMessage& emplace(const TArg1& arg1)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename TArg1, typename TArg2, typename TArg3>
+    TMessage& emplace(const TArg1& arg1, const TArg2& arg2, const TArg3& arg3)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, T1>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(arg1, arg2, arg3);
+      valid = true;
+
+      return *pmsg;
+    }
+  #endif
+
     //********************************************
     ~message_packet()
     {
@@ -3584,6 +6068,22 @@ namespace etl
       ALIGNMENT = etl::largest<T1>::alignment
     };
 
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static ETL_CONSTEXPR size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
   private:
 
     //********************************************
@@ -3641,3 +6141,5 @@ namespace etl
 }
 
 #endif
+
+#endif
@@ -65,6 +65,9 @@ SOFTWARE.
 #include "nullptr.h"
 #include "placement_new.h"
 #include "successor.h"
+#include "integral_limits.h"
+#include "span.h"
+#include "trace.h"
 
 namespace etl
 {
@@ -139,6 +142,29 @@ namespace etl
       }
     }
 
+    //********************************************
+    /// Receives a batch of messages.
+    /// By default, each message is passed to receive() in turn.
+    /// Override to handle a burst of messages with one virtual call.
+    //********************************************
+    virtual void receive_batch(const etl::imessage* const* p_messages, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        receive(*p_messages[i]);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //********************************************
+    /// Receives a batch of messages.
+    //********************************************
+    void receive_batch(etl::span<const etl::imessage* const> messages)
+    {
+      receive_batch(messages.data(), messages.size());
+    }
+#endif
+
     //********************************************
     bool accepts(const etl::imessage& msg) const
     {
@@ -294,6 +320,107 @@ namespace etl
   {
     destination.receive(message);
   }
+}
+
+#if ETL_USING_VARIADIC_MESSAGES
+  #include "private/message_router_variadic.h"
+#else
+namespace etl
+{
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// The bit for the message's id, if it is in word 'Word' of the bitmap.
+    //*************************************************************************
+    template <typename TMessage, size_t Word>
+    struct id_bit
+    {
+      static ETL_CONSTANT uint32_t value = ((size_t(TMessage::ID) / 32U) == Word) ? (uint32_t(1U) << (size_t(TMessage::ID) % 32U)) : 0U;
+    };
+
+    template <size_t Word>
+    struct id_bit<void, Word>
+    {
+      static ETL_CONSTANT uint32_t value = 0U;
+    };
+
+    //*************************************************************************
+    /// Is the id the message's id?
+    //*************************************************************************
+    template <typename TMessage>
+    struct is_id
+    {
+      static bool test(etl::message_id_t id)
+      {
+        return id == TMessage::ID;
+      }
+    };
+
+    template <>
+    struct is_id<void>
+    {
+      static bool test(etl::message_id_t)
+      {
+        return false;
+      }
+    };
+
+    //*************************************************************************
+    /// The ids accepted by a router.
+    /// For 8 bit ids, a constant bitmap of 256 bits is tested.
+    /// For wider ids, each id is compared.
+    //*************************************************************************
+    template <typename T1 = void, typename T2 = void, typename T3 = void, typename T4 = void, 
+              typename T5 = void, typename T6 = void, typename T7 = void, typename T8 = void, 
+              typename T9 = void, typename T10 = void, typename T11 = void, typename T12 = void, 
+              typename T13 = void, typename T14 = void, typename T15 = void, typename T16 = void>
+    struct accepted_ids
+    {
+      //***********************************
+      template <size_t Word>
+      struct word
+      {
+        static ETL_CONSTANT uint32_t value = id_bit<T1, Word>::value | id_bit<T2, Word>::value | id_bit<T3, Word>::value | id_bit<T4, Word>::value | 
+                                             id_bit<T5, Word>::value | id_bit<T6, Word>::value | id_bit<T7, Word>::value | id_bit<T8, Word>::value | 
+                                             id_bit<T9, Word>::value | id_bit<T10, Word>::value | id_bit<T11, Word>::value | id_bit<T12, Word>::value | 
+                                             id_bit<T13, Word>::value | id_bit<T14, Word>::value | id_bit<T15, Word>::value | id_bit<T16, Word>::value;
+      };
+
+      //***********************************
+      static bool test(etl::message_id_t id)
+      {
+        if (etl::integral_limits<etl::message_id_t>::bits == 8U)
+        {
+          return (bitmap[size_t(id) / 32U] & (uint32_t(1U) << (size_t(id) % 32U))) != 0U;
+        }
+        else
+        {
+          return is_id<T1>::test(id) || is_id<T2>::test(id) || is_id<T3>::test(id) || is_id<T4>::test(id) || 
+                 is_id<T5>::test(id) || is_id<T6>::test(id) || is_id<T7>::test(id) || is_id<T8>::test(id) || 
+                 is_id<T9>::test(id) || is_id<T10>::test(id) || is_id<T11>::test(id) || is_id<T12>::test(id) || 
+                 is_id<T13>::test(id) || is_id<T14>::test(id) || is_id<T15>::test(id) || is_id<T16>::test(id);
+        }
+      }
+
+      static const uint32_t bitmap[8];
+    };
+
+    template <typename T1, typename T2, typename T3, typename T4, 
+              typename T5, typename T6, typename T7, typename T8, 
+              typename T9, typename T10, typename T11, typename T12, 
+              typename T13, typename T14, typename T15, typename T16>
+    const uint32_t accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::bitmap[8] =
+    {
+      word<0>::value,
+      word<1>::value,
+      word<2>::value,
+      word<3>::value,
+      word<4>::value,
+      word<5>::value,
+      word<6>::value,
+      word<7>::value
+    };
+  }
 
   //***************************************************************************
   // The definition for all 16 message types.
@@ -330,6 +457,8 @@ namespace etl
     {
       const etl::message_id_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -368,14 +497,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: case T15::ID: case T16::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::test(id);
     }
 
     //********************************************
@@ -433,6 +555,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -470,14 +594,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: case T15::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::test(id);
     }
 
     //********************************************
@@ -535,6 +652,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -571,14 +690,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: case T14::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::test(id);
     }
 
     //********************************************
@@ -636,6 +748,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -671,14 +785,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: case T13::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::test(id);
     }
 
     //********************************************
@@ -735,6 +842,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -769,14 +878,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: case T12::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::test(id);
     }
 
     //********************************************
@@ -833,6 +935,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -866,14 +970,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: case T11::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::test(id);
     }
 
     //********************************************
@@ -930,6 +1027,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -962,14 +1061,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: case T10::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::test(id);
     }
 
     //********************************************
@@ -1026,6 +1118,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1057,14 +1151,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        case T9::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8, T9>::test(id);
     }
 
     //********************************************
@@ -1120,6 +1207,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1150,14 +1239,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: case T8::ID: 
-        
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7, T8>::test(id);
     }
 
     //********************************************
@@ -1213,6 +1295,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1242,13 +1326,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: case T7::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6, T7>::test(id);
     }
 
     //********************************************
@@ -1304,6 +1382,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1332,13 +1412,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: case T6::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5, T6>::test(id);
     }
 
     //********************************************
@@ -1394,6 +1468,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1421,13 +1497,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: case T5::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4, T5>::test(id);
     }
 
     //********************************************
@@ -1482,6 +1552,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1508,13 +1580,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: case T4::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3, T4>::test(id);
     }
 
     //********************************************
@@ -1569,6 +1635,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1594,13 +1662,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: case T3::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2, T3>::test(id);
     }
 
     //********************************************
@@ -1655,6 +1717,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1679,13 +1743,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: case T2::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1, T2>::test(id);
     }
 
     //********************************************
@@ -1740,6 +1798,8 @@ namespace etl
     {
       const size_t id = msg.get_message_id();
 
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
       switch (id)
       {
         case T1::ID: static_cast<TDerived*>(this)->on_receive(static_cast<const T1&>(msg)); break;
@@ -1763,13 +1823,7 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      switch (id)
-      {
-        case T1::ID: 
-          return true;
-        default:
-          return false;
-      }
+      return private_message_router::accepted_ids<T1>::test(id);
     }
 
     //********************************************
@@ -1791,5 +1845,6 @@ namespace etl
     }
   };
 }
+#endif
 
 #endif
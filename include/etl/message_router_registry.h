@@ -39,6 +39,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "iterator.h"
 #include "memory.h"
+#include "static_assert.h"
 
 namespace etl
 {
@@ -68,6 +69,102 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Maps router ids directly to the first registered router with the id,
+  /// so that find() does not search the registry.
+  /// Router ids outside the range 0 to max_ids() - 1 are not indexed and are
+  /// searched for as before.
+  //***************************************************************************
+  class imessage_router_registry_index
+  {
+  public:
+
+    //*************************************************************************
+    /// The maximum number of router ids.
+    //*************************************************************************
+    size_t max_ids() const
+    {
+      return Max_Ids;
+    }
+
+    //*************************************************************************
+    /// Clears the index.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Max_Ids; ++i)
+      {
+        p_routers[i] = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Is the router id in range?
+    //*************************************************************************
+    bool is_valid_id(etl::message_router_id_t id) const
+    {
+      return size_t(id) < Max_Ids;
+    }
+
+    //*************************************************************************
+    /// The router for the id, or ETL_NULLPTR.
+    //*************************************************************************
+    etl::imessage_router* get(etl::message_router_id_t id) const
+    {
+      return p_routers[id];
+    }
+
+    //*************************************************************************
+    /// Sets the router for the id.
+    //*************************************************************************
+    void set(etl::message_router_id_t id, etl::imessage_router* p_router)
+    {
+      p_routers[id] = p_router;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imessage_router_registry_index(etl::imessage_router** p_routers_, size_t max_ids_)
+      : p_routers(p_routers_),
+        Max_Ids(max_ids_)
+    {
+    }
+
+  private:
+
+    etl::imessage_router** p_routers; ///< The first router for each id.
+    const size_t           Max_Ids;
+  };
+
+  //***************************************************************************
+  /// A message router registry index with storage for the specified number
+  /// of router ids. The default covers every ordinary router id.
+  /// Pass to message_router_registry::set_index().
+  //***************************************************************************
+  template <size_t VMaxIds = etl::imessage_router::MAX_MESSAGE_ROUTER + 1U>
+  class message_router_registry_index : public imessage_router_registry_index
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMaxIds > 0U, "Zero sized index");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    message_router_registry_index()
+      : imessage_router_registry_index(buffer, VMaxIds)
+    {
+      clear();
+    }
+
+  private:
+
+    etl::imessage_router* buffer[VMaxIds];
+  };
+
   //***************************************************************************
   /// This is the base of all message router registries.
   //***************************************************************************
@@ -295,30 +392,12 @@ namespace etl
     //********************************************
     etl::imessage_router* find(etl::message_router_id_t id)
     {
-      IRegistry::iterator itr = registry.find(id);
-
-      if (registry.find(id) != registry.end())
-      {
-        return itr->second;
-      }
-      else
-      {
-        return ETL_NULLPTR;
-      }
+      return find_router(id);
     }
 
     const etl::imessage_router* find(etl::message_router_id_t id) const
     {
-      IRegistry::const_iterator itr = registry.find(id);
-
-      if (registry.find(id) != registry.end())
-      {
-        return itr->second;
-      }
-      else
-      {
-        return ETL_NULLPTR;
-      }
+      return find_router(id);
     }
 
     //********************************************
@@ -355,9 +434,17 @@ namespace etl
     {
       if (!registry.full() && !contains(router))
       {
-        IRegistry::value_type element(router.get_message_router_id(), &router);
+        const etl::message_router_id_t id = router.get_message_router_id();
+
+        IRegistry::value_type element(id, &router);
 
         registry.insert(element);
+
+        // Routers with the same id are added after the existing ones.
+        if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id) && (p_index->get(id) == ETL_NULLPTR))
+        {
+          p_index->set(id, &router);
+        }
       }
       else
       {
@@ -396,6 +483,11 @@ namespace etl
     void remove(etl::message_router_id_t id)
     {
       registry.erase(id);
+
+      if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id))
+      {
+        p_index->set(id, ETL_NULLPTR);
+      }
     }
 
     //********************************************
@@ -405,9 +497,6 @@ namespace etl
     bool contains(const etl::message_router_id_t id) const
     {
       return find(id) != ETL_NULLPTR;
-
-
-      //return registry.find(id) != registry.end();
     }
 
     //********************************************
@@ -485,19 +574,86 @@ namespace etl
       return registry.max_size();
     }
 
+    //********************************************
+    /// Uses the index to find routers by id without searching the registry.
+    /// The index is kept up to date as routers are added and removed.
+    //********************************************
+    void set_index(etl::imessage_router_registry_index& index)
+    {
+      p_index = &index;
+      rebuild_index();
+    }
+
+    //********************************************
+    /// Removes the index. The registry is searched for each id.
+    //********************************************
+    void clear_index()
+    {
+      p_index = ETL_NULLPTR;
+    }
+
+    //********************************************
+    /// Is an index in use?
+    //********************************************
+    bool has_index() const
+    {
+      return p_index != ETL_NULLPTR;
+    }
+
   protected:
 
     //********************************************
     // Constructor.
     //********************************************
     imessage_router_registry(IRegistry& registry_)
-      : registry(registry_)
+      : registry(registry_),
+        p_index(ETL_NULLPTR)
     {
     }
 
+    //********************************************
+    /// Records the first router for each indexed id.
+    //********************************************
+    void rebuild_index()
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        p_index->clear();
+
+        IRegistry::const_iterator itr = registry.cbegin();
+
+        while (itr != registry.cend())
+        {
+          // Only the first router with each id is recorded.
+          if (p_index->is_valid_id(itr->first) && (p_index->get(itr->first) == ETL_NULLPTR))
+          {
+            p_index->set(itr->first, itr->second);
+          }
+
+          ++itr;
+        }
+      }
+    }
+
   private:
 
-    IRegistry& registry;
+    //********************************************
+    /// Finds the first router with the id.
+    //********************************************
+    etl::imessage_router* find_router(etl::message_router_id_t id) const
+    {
+      if ((p_index != ETL_NULLPTR) && p_index->is_valid_id(id))
+      {
+        return p_index->get(id);
+      }
+
+      IRegistry::const_iterator itr = registry.find(id);
+
+      return (itr != registry.cend()) ? itr->second : ETL_NULLPTR;
+    }
+
+    IRegistry&                           registry;
+    etl::imessage_router_registry_index* p_index;
   };
 
   //***************************************************************************
@@ -561,6 +717,7 @@ namespace etl
     message_router_registry& operator =(const message_router_registry& rhs)
     {
       registry = rhs.registry;
+      this->rebuild_index();
 
       return *this;
     }
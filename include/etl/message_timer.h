@@ -280,6 +280,12 @@ namespace etl
         return ptimers[head];
       }
 
+      //*******************************
+      const etl::message_timer_data& front() const
+      {
+        return ptimers[head];
+      }
+
       //*******************************
       etl::timer::id::type begin()
       {
@@ -583,6 +589,22 @@ namespace etl
       return false;
     }
 
+    //*******************************************
+    /// Returns the number of ticks until the next timer expires.
+    /// Returns etl::timer::state::INACTIVE if no timers are running.
+    /// Allows a tickless system to sleep until then and pass the
+    /// elapsed time to a single call to 'tick'.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      if (active_list.empty())
+      {
+        return etl::timer::state::INACTIVE;
+      }
+
+      return active_list.front().delta;
+    }
+
   protected:
 
     //*******************************************
@@ -0,0 +1,785 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MOVING_STATISTICS_INCLUDED
+#define ETL_MOVING_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "circular_buffer.h"
+#include "deque.h"
+#include "mean.h"
+#include "variance.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup moving_statistics moving_statistics
+/// Statistics over a sliding window of the most recent samples.
+/// Each new sample costs amortised O(1), whatever the size of the window.
+///\ingroup utilities
+
+namespace etl
+{
+  namespace private_moving_statistics
+  {
+    //*************************************************************************
+    /// The minimum or maximum over a window, by a monotonic queue.
+    /// The queue holds the samples that could still become the extreme
+    /// value, in order of arrival. The front is always the current extreme.
+    /// Each sample is pushed and popped at most once.
+    //*************************************************************************
+    template <typename T, size_t Window_Size, typename TCompare>
+    class monotonic_window
+    {
+    public:
+
+      ETL_STATIC_ASSERT(Window_Size > 0U, "The window must hold at least one sample");
+
+      //*********************************
+      /// Constructor.
+      //*********************************
+      monotonic_window()
+      {
+        clear();
+      }
+
+      //*********************************
+      /// Adds a sample.
+      //*********************************
+      void add(T value)
+      {
+        // Forget the front if it has left the window.
+        if (!candidates.empty() && ((sequence - candidates.front().sequence) >= Window_Size))
+        {
+          candidates.pop_front();
+        }
+
+        // Samples that can no longer be the extreme.
+        while (!candidates.empty() && !compare(candidates.back().value, value))
+        {
+          candidates.pop_back();
+        }
+
+        entry e = { value, sequence };
+        candidates.push_back(e);
+
+        ++sequence;
+
+        if (counter < Window_Size)
+        {
+          ++counter;
+        }
+      }
+
+      //*********************************
+      /// The extreme value in the window, or T() if it is empty.
+      //*********************************
+      T value() const
+      {
+        return candidates.empty() ? T() : candidates.front().value;
+      }
+
+      //*********************************
+      /// The number of samples in the window.
+      //*********************************
+      size_t count() const
+      {
+        return counter;
+      }
+
+      //*********************************
+      /// Empties the window.
+      //*********************************
+      void clear()
+      {
+        candidates.clear();
+        sequence = 0U;
+        counter  = 0U;
+      }
+
+    private:
+
+      struct entry
+      {
+        T      value;
+        size_t sequence; ///< Wraps harmlessly, as only differences are used.
+      };
+
+      etl::deque<entry, Window_Size> candidates;
+      TCompare compare;
+      size_t   sequence; ///< The sequence number of the next sample.
+      size_t   counter;  ///< The number of samples in the window.
+    };
+  }
+
+  //***************************************************************************
+  /// The mean of the last Window_Size samples.
+  /// A floating point sum is recalculated from the window once every
+  /// Window_Size samples, so that rounding errors cannot build up.
+  ///\ingroup moving_statistics
+  //***************************************************************************
+  template <typename TInput, size_t Window_Size, typename TCalc = TInput>
+  class moving_mean
+  {
+  private:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "The window must hold at least one sample");
+
+    typedef typename private_mean::mean_traits<TInput, TCalc>::calc_t calc_t;
+
+  public:
+
+    typedef TInput value_type;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    moving_mean()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    moving_mean(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    /// Once the window is full, the oldest value is removed.
+    //*********************************
+    void add(TInput value)
+    {
+      if (samples.full())
+      {
+        sum -= calc_t(samples.front());
+      }
+
+      samples.push(value);
+      sum += calc_t(value);
+      recalculate = true;
+
+      if (etl::is_floating_point<calc_t>::value && (++updates == Window_Size))
+      {
+        refresh();
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the mean of the window.
+    //*********************************
+    double get_mean() const
+    {
+      if (recalculate)
+      {
+        mean_value = samples.empty() ? 0.0 : double(sum) / double(samples.size());
+        recalculate = false;
+      }
+
+      return mean_value;
+    }
+
+    //*********************************
+    /// Get the mean of the window.
+    //*********************************
+    operator double() const
+    {
+      return get_mean();
+    }
+
+    //*********************************
+    /// Get the number of values in the window.
+    //*********************************
+    size_t count() const
+    {
+      return samples.size();
+    }
+
+    //*********************************
+    /// True if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      samples.clear();
+      sum         = calc_t(0);
+      updates     = 0U;
+      mean_value  = 0.0;
+      recalculate = true;
+    }
+
+  private:
+
+    //*********************************
+    /// Recalculates the sum from the window.
+    //*********************************
+    void refresh()
+    {
+      sum = calc_t(0);
+
+      for (typename etl::circular_buffer<TInput, Window_Size>::const_iterator itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        sum += calc_t(*itr);
+      }
+
+      updates = 0U;
+    }
+
+    etl::circular_buffer<TInput, Window_Size> samples;
+    calc_t sum;
+    size_t updates; ///< Values added since the sum was recalculated.
+    mutable double mean_value;
+    mutable bool   recalculate;
+  };
+
+  template <typename TInput, size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t moving_mean<TInput, Window_Size, TCalc>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// The variance of the last Window_Size samples.
+  /// Keeps a running mean and sum of squared deviations by Welford's method,
+  /// extended to remove the oldest sample as each new one arrives. They are
+  /// recalculated from the window once every Window_Size samples, so that
+  /// rounding errors cannot build up.
+  /// The calculation type is TCalc if it is floating point, otherwise double.
+  ///\ingroup moving_statistics
+  //***************************************************************************
+  template <bool Variance_Type, typename TInput, size_t Window_Size, typename TCalc = TInput>
+  class moving_variance
+  {
+  private:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "The window must hold at least one sample");
+
+    static ETL_CONSTANT size_t Adjustment = (Variance_Type == variance_type::Population) ? 0U : 1U;
+
+    typedef typename private_variance::welford_traits<TCalc>::calc_t calc_t;
+
+  public:
+
+    typedef TInput value_type;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    moving_variance()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    moving_variance(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    /// Once the window is full, the oldest value is removed.
+    //*********************************
+    void add(TInput value)
+    {
+      const calc_t x = calc_t(value);
+
+      if (samples.full())
+      {
+        // Replace the oldest value.
+        const calc_t y        = calc_t(samples.front());
+        const calc_t old_mean = mean;
+
+        mean += (x - y) / calc_t(Window_Size);
+        m2   += (x - y) * ((x - mean) + (y - old_mean));
+      }
+      else
+      {
+        const calc_t delta = x - mean;
+
+        mean += delta / calc_t(samples.size() + 1U);
+        m2   += delta * (x - mean);
+      }
+
+      samples.push(value);
+      recalculate = true;
+
+      if (++updates == Window_Size)
+      {
+        refresh();
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the mean of the window.
+    //*********************************
+    double get_mean() const
+    {
+      return double(mean);
+    }
+
+    //*********************************
+    /// Get the variance of the window.
+    //*********************************
+    double get_variance() const
+    {
+      calculate();
+
+      return variance_value;
+    }
+
+    //*********************************
+    /// Get the standard deviation of the window.
+    //*********************************
+    double get_standard_deviation() const
+    {
+      calculate();
+
+      return standard_deviation_value;
+    }
+
+    //*********************************
+    /// Get the variance of the window.
+    //*********************************
+    operator double() const
+    {
+      return get_variance();
+    }
+
+    //*********************************
+    /// Get the number of values in the window.
+    //*********************************
+    size_t count() const
+    {
+      return samples.size();
+    }
+
+    //*********************************
+    /// True if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      samples.clear();
+      mean                     = calc_t(0);
+      m2                       = calc_t(0);
+      updates                  = 0U;
+      variance_value           = 0.0;
+      standard_deviation_value = 0.0;
+      recalculate              = true;
+    }
+
+  private:
+
+    //*********************************
+    /// Do the calculation.
+    //*********************************
+    void calculate() const
+    {
+      if (recalculate)
+      {
+        variance_value           = 0.0;
+        standard_deviation_value = 0.0;
+
+        const size_t n = samples.size();
+
+        // Rounding can leave a tiny negative sum of squares.
+        if ((n > Adjustment) && (m2 > calc_t(0)))
+        {
+          variance_value           = double(m2) / double(n - Adjustment);
+          standard_deviation_value = sqrt(variance_value);
+        }
+
+        recalculate = false;
+      }
+    }
+
+    //*********************************
+    /// Recalculates the mean and sum of squared deviations from the window.
+    //*********************************
+    void refresh()
+    {
+      typedef typename etl::circular_buffer<TInput, Window_Size>::const_iterator iterator;
+
+      calc_t sum = calc_t(0);
+
+      for (iterator itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        sum += calc_t(*itr);
+      }
+
+      mean = sum / calc_t(samples.size());
+      m2   = calc_t(0);
+
+      for (iterator itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        const calc_t delta = calc_t(*itr) - mean;
+        m2 += delta * delta;
+      }
+
+      updates = 0U;
+    }
+
+    etl::circular_buffer<TInput, Window_Size> samples;
+    calc_t mean;
+    calc_t m2;      ///< The sum of squared deviations from the mean.
+    size_t updates; ///< Values added since the sums were recalculated.
+    mutable double variance_value;
+    mutable double standard_deviation_value;
+    mutable bool   recalculate;
+  };
+
+  template <bool Variance_Type, typename TInput, size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t moving_variance<Variance_Type, TInput, Window_Size, TCalc>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// The minimum of the last Window_Size samples.
+  ///\ingroup moving_statistics
+  //***************************************************************************
+  template <typename T, size_t Window_Size, typename TCompare = etl::less<T> >
+  class moving_min
+  {
+  public:
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    moving_min()
+    {
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    moving_min(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(T value)
+    {
+      window.add(value);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        window.add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(T value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the minimum of the window, or T() if it is empty.
+    //*********************************
+    T get_min() const
+    {
+      return window.value();
+    }
+
+    //*********************************
+    /// Get the minimum of the window, or T() if it is empty.
+    //*********************************
+    operator T() const
+    {
+      return get_min();
+    }
+
+    //*********************************
+    /// Get the number of values in the window.
+    //*********************************
+    size_t count() const
+    {
+      return window.count();
+    }
+
+    //*********************************
+    /// True if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return window.count() == Window_Size;
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      window.clear();
+    }
+
+  private:
+
+    private_moving_statistics::monotonic_window<T, Window_Size, TCompare> window;
+  };
+
+  template <typename T, size_t Window_Size, typename TCompare>
+  ETL_CONSTANT size_t moving_min<T, Window_Size, TCompare>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// The maximum of the last Window_Size samples.
+  ///\ingroup moving_statistics
+  //***************************************************************************
+  template <typename T, size_t Window_Size, typename TCompare = etl::greater<T> >
+  class moving_max
+  {
+  public:
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    moving_max()
+    {
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    moving_max(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(T value)
+    {
+      window.add(value);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        window.add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(T value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the maximum of the window, or T() if it is empty.
+    //*********************************
+    T get_max() const
+    {
+      return window.value();
+    }
+
+    //*********************************
+    /// Get the maximum of the window, or T() if it is empty.
+    //*********************************
+    operator T() const
+    {
+      return get_max();
+    }
+
+    //*********************************
+    /// Get the number of values in the window.
+    //*********************************
+    size_t count() const
+    {
+      return window.count();
+    }
+
+    //*********************************
+    /// True if the window is full.
+    //*********************************
+    bool full() const
+    {
+      return window.count() == Window_Size;
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      window.clear();
+    }
+
+  private:
+
+    private_moving_statistics::monotonic_window<T, Window_Size, TCompare> window;
+  };
+
+  template <typename T, size_t Window_Size, typename TCompare>
+  ETL_CONSTANT size_t moving_max<T, Window_Size, TCompare>::WINDOW_SIZE;
+}
+
+#endif
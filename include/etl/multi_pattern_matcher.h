@@ -0,0 +1,555 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MULTI_PATTERN_MATCHER_INCLUDED
+#define ETL_MULTI_PATTERN_MATCHER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "char_traits.h"
+#include "integral_limits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+
+///\defgroup multi_pattern_matcher multi_pattern_matcher
+/// Finds any of a set of patterns in one pass over the text, using an
+/// Aho-Corasick automaton held in fixed storage.
+/// Patterns are added, then build() is called before searching.
+/// Where matches overlap, the one that starts first wins, and of those
+/// starting at the same position, the longest.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for multi_pattern_matcher exceptions.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  class multi_pattern_matcher_exception : public etl::exception
+  {
+  public:
+
+    multi_pattern_matcher_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There are not enough states for the pattern.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  class multi_pattern_matcher_full : public multi_pattern_matcher_exception
+  {
+  public:
+
+    multi_pattern_matcher_full(string_type file_name_, numeric_type line_number_)
+      : multi_pattern_matcher_exception(ETL_ERROR_TEXT("multi_pattern_matcher:full", ETL_MULTI_PATTERN_MATCHER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A pattern is empty.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  class multi_pattern_matcher_empty_pattern : public multi_pattern_matcher_exception
+  {
+  public:
+
+    multi_pattern_matcher_empty_pattern(string_type file_name_, numeric_type line_number_)
+      : multi_pattern_matcher_exception(ETL_ERROR_TEXT("multi_pattern_matcher:empty pattern", ETL_MULTI_PATTERN_MATCHER_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The matcher was searched before build() was called.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  class multi_pattern_matcher_not_built : public multi_pattern_matcher_exception
+  {
+  public:
+
+    multi_pattern_matcher_not_built(string_type file_name_, numeric_type line_number_)
+      : multi_pattern_matcher_exception(ETL_ERROR_TEXT("multi_pattern_matcher:not built", ETL_MULTI_PATTERN_MATCHER_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The result of a search.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  struct pattern_match
+  {
+#if ETL_CPP11_SUPPORTED
+    static constexpr size_t npos = etl::integral_limits<size_t>::max;
+#else
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+#endif
+
+    pattern_match()
+      : position(npos)
+      , length(0U)
+      , index(npos)
+    {
+    }
+
+    pattern_match(size_t position_, size_t length_, size_t index_)
+      : position(position_)
+      , length(length_)
+      , index(index_)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if a pattern was found.
+    //*************************************************************************
+    bool found() const
+    {
+      return position != npos;
+    }
+
+    size_t position; ///< The position of the match in the text.
+    size_t length;   ///< The length of the match.
+    size_t index;    ///< The index of the pattern, in the order that they were added.
+  };
+
+  //***************************************************************************
+  /// The interface to a multi pattern matcher.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  template <typename T>
+  class imulti_pattern_matcher
+  {
+  public:
+
+    typedef T        value_type;
+    typedef size_t   size_type;
+    typedef uint16_t state_index;
+
+#if ETL_CPP11_SUPPORTED
+    static constexpr size_t npos = etl::integral_limits<size_t>::max;
+#else
+    enum
+    {
+      npos = etl::integral_limits<size_t>::max
+    };
+#endif
+
+    //*************************************************************************
+    /// Adds a pattern.
+    /// If asserts or exceptions are enabled, emits etl::multi_pattern_matcher_full
+    /// if there are not enough states, or etl::multi_pattern_matcher_empty_pattern
+    /// if the pattern is empty.
+    ///\return The index of the pattern, or npos if it could not be added.
+    /// Adding a pattern again returns the original index.
+    //*************************************************************************
+    size_t add(const T* pattern, size_t length)
+    {
+      if (length == 0U)
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::multi_pattern_matcher_empty_pattern));
+        return npos;
+      }
+
+      // Count the new states first, so that a failed add leaves the trie unchanged.
+      state_index s = 0U;
+      size_t      i = 0U;
+
+      while (i < length)
+      {
+        const state_index child = find_child(s, pattern[i]);
+
+        if (child == 0U)
+        {
+          break;
+        }
+
+        s = child;
+        ++i;
+      }
+
+      if ((length - i) > (Max_States - n_states))
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::multi_pattern_matcher_full));
+        return npos;
+      }
+
+      while (i < length)
+      {
+        const state_index child = state_index(n_states++);
+
+        p_states[child].c            = pattern[i];
+        p_states[child].first_child  = 0U;
+        p_states[child].next_sibling = p_states[s].first_child;
+        p_states[child].depth        = state_index(p_states[s].depth + 1U);
+        p_states[child].pattern      = 0U;
+        p_states[s].first_child      = child;
+
+        s = child;
+        ++i;
+      }
+
+      if (p_states[s].pattern == 0U)
+      {
+        p_states[s].pattern = state_index(++n_patterns);
+      }
+
+      built = false;
+
+      return p_states[s].pattern - 1U;
+    }
+
+    //*************************************************************************
+    /// Adds a null terminated pattern.
+    //*************************************************************************
+    size_t add(const T* pattern)
+    {
+      return add(pattern, etl::strlen(pattern));
+    }
+
+    //*************************************************************************
+    /// Adds a pattern held in a string or string view.
+    //*************************************************************************
+    template <typename TString>
+    size_t add(const TString& pattern)
+    {
+      return add(pattern.data(), pattern.size());
+    }
+
+    //*************************************************************************
+    /// Calculates the failure and output links.
+    /// Must be called after adding patterns and before searching.
+    //*************************************************************************
+    void build()
+    {
+      // Breadth first, so that a state's failure link is always to a state
+      // that has already been processed.
+      size_t head = 0U;
+      size_t tail = 0U;
+
+      p_states[0].fail   = 0U;
+      p_states[0].output = 0U;
+
+      for (state_index child = p_states[0].first_child; child != 0U; child = p_states[child].next_sibling)
+      {
+        p_states[child].fail   = 0U;
+        p_states[child].output = 0U;
+        p_queue[tail++] = child;
+      }
+
+      while (head != tail)
+      {
+        const state_index s = p_queue[head++];
+
+        for (state_index child = p_states[s].first_child; child != 0U; child = p_states[child].next_sibling)
+        {
+          const T c = p_states[child].c;
+
+          state_index f = p_states[s].fail;
+
+          while ((f != 0U) && (find_child(f, c) == 0U))
+          {
+            f = p_states[f].fail;
+          }
+
+          f = find_child(f, c);
+
+          p_states[child].fail   = f;
+          p_states[child].output = (p_states[f].pattern != 0U) ? f : p_states[f].output;
+          p_queue[tail++] = child;
+        }
+      }
+
+      built = true;
+    }
+
+    //*************************************************************************
+    /// Finds the first match at or after 'position'.
+    /// If asserts or exceptions are enabled, emits etl::multi_pattern_matcher_not_built
+    /// if build() has not been called since the last pattern was added.
+    //*************************************************************************
+    pattern_match find(const T* text, size_t length, size_t position = 0U) const
+    {
+      pattern_match best;
+
+      if (!built)
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(etl::multi_pattern_matcher_not_built));
+        return best;
+      }
+
+      state_index s = 0U;
+
+      for (size_t i = position; i < length; ++i)
+      {
+        s = next_state(s, text[i]);
+
+        // Every pattern that ends here.
+        state_index o = (p_states[s].pattern != 0U) ? s : p_states[s].output;
+
+        while (o != 0U)
+        {
+          const size_t start = i + 1U - p_states[o].depth;
+
+          if ((start < best.position) || ((start == best.position) && (p_states[o].depth > best.length)))
+          {
+            best = pattern_match(start, p_states[o].depth, p_states[o].pattern - 1U);
+          }
+
+          o = p_states[o].output;
+        }
+
+        // No later match can start at or before the best so far.
+        if (best.found() && ((i + 1U - p_states[s].depth) > best.position))
+        {
+          break;
+        }
+      }
+
+      return best;
+    }
+
+    //*************************************************************************
+    /// Finds the first match in a string or string view at or after 'position'.
+    //*************************************************************************
+    template <typename TString>
+    pattern_match find(const TString& text, size_t position = 0U) const
+    {
+      return find(text.data(), text.size(), position);
+    }
+
+    //*************************************************************************
+    /// Removes all of the patterns.
+    //*************************************************************************
+    void clear()
+    {
+      p_states[0].first_child = 0U;
+      p_states[0].depth       = 0U;
+      p_states[0].pattern     = 0U;
+      n_states   = 1U;
+      n_patterns = 0U;
+      built      = false;
+    }
+
+    //*************************************************************************
+    /// The number of distinct patterns.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_patterns;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_patterns == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of states used, including the root.
+    //*************************************************************************
+    size_t states() const
+    {
+      return n_states;
+    }
+
+    //*************************************************************************
+    size_t max_states() const
+    {
+      return Max_States;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if build() has been called since the last change.
+    //*************************************************************************
+    bool is_built() const
+    {
+      return built;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A node of the trie. The character is the one on the edge leading to it.
+    //*************************************************************************
+    struct state
+    {
+      T           c;
+      state_index first_child;
+      state_index next_sibling;
+      state_index fail;
+      state_index output;  ///< The next state on the failure chain that ends a pattern.
+      state_index depth;
+      state_index pattern; ///< The pattern index + 1, or 0.
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    imulti_pattern_matcher(state* p_states_, state_index* p_queue_, size_t max_states_)
+      : p_states(p_states_)
+      , p_queue(p_queue_)
+      , Max_States(max_states_)
+      , n_states(1U)
+      , n_patterns(0U)
+      , built(false)
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The child of s along c, or 0.
+    //*************************************************************************
+    state_index find_child(state_index s, const T c) const
+    {
+      state_index child = p_states[s].first_child;
+
+      while ((child != 0U) && (p_states[child].c != c))
+      {
+        child = p_states[child].next_sibling;
+      }
+
+      return child;
+    }
+
+    //*************************************************************************
+    /// Follows the goto and failure links.
+    //*************************************************************************
+    state_index next_state(state_index s, const T c) const
+    {
+      while (true)
+      {
+        const state_index child = find_child(s, c);
+
+        if ((child != 0U) || (s == 0U))
+        {
+          return child;
+        }
+
+        s = p_states[s].fail;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    imulti_pattern_matcher(const imulti_pattern_matcher&);
+    imulti_pattern_matcher& operator =(const imulti_pattern_matcher&);
+
+    state*       p_states;
+    state_index* p_queue;
+    const size_t Max_States;
+    size_t       n_states;
+    size_t       n_patterns;
+    bool         built;
+  };
+
+  //***************************************************************************
+  /// A multi pattern matcher with storage for MAX_STATES states.
+  /// Each distinct pattern prefix uses one state, and the root uses one,
+  /// so the patterns "he", "she" and "hers" need 1 + 2 + 3 + 2 = 8.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  template <typename T, const size_t MAX_STATES>
+  class multi_pattern_matcher : public etl::imulti_pattern_matcher<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_STATES > 1U) && (MAX_STATES <= 65535U), "MAX_STATES must be in the range 2 to 65535");
+
+    //*************************************************************************
+    multi_pattern_matcher()
+      : etl::imulti_pattern_matcher<T>(states_buffer, queue_buffer, MAX_STATES)
+    {
+    }
+
+  private:
+
+    typename etl::imulti_pattern_matcher<T>::state       states_buffer[MAX_STATES];
+    typename etl::imulti_pattern_matcher<T>::state_index queue_buffer[MAX_STATES];
+  };
+
+  //***************************************************************************
+  /// Finds the first of any of the matcher's patterns in the text.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  template <typename TStringView>
+  pattern_match find_any(const TStringView& text,
+                         const etl::imulti_pattern_matcher<typename TStringView::value_type>& matcher,
+                         size_t position = 0U)
+  {
+    return matcher.find(text.data(), text.size(), position);
+  }
+
+  //***************************************************************************
+  /// Replaces every match of the matcher's patterns in one pass.
+  /// A match of pattern i is replaced with replacements[i].
+  /// Text that is inserted is not searched again.
+  ///\ingroup multi_pattern_matcher
+  //***************************************************************************
+  template <typename TIString>
+  void replace_strings(TIString& s,
+                       const etl::imulti_pattern_matcher<typename TIString::value_type>& matcher,
+                       const typename TIString::value_type* const* replacements)
+  {
+    typedef typename TIString::size_type size_type;
+
+    size_t position = 0U;
+
+    while (position < s.size())
+    {
+      const pattern_match match = matcher.find(s.data(), s.size(), position);
+
+      if (!match.found())
+      {
+        break;
+      }
+
+      const typename TIString::value_type* p_new = replacements[match.index];
+      const size_t new_length = etl::strlen(p_new);
+
+      s.replace(size_type(match.position), size_type(match.length), p_new, size_type(new_length));
+
+      position = match.position + new_length;
+    }
+  }
+}
+
+#endif
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "functional.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "span.h"
 
 namespace etl
 {
@@ -172,6 +173,36 @@ namespace etl
       return count;
     }
 
+    //***************************************************************************
+    /// Steps to the next logical values of the ranges as if the innermost range
+    /// had completed a whole pass. The innermost range stays at its first value.
+    /// Used with the innermost range's values() to process a pass at a time.
+    //***************************************************************************
+    void next_pass()
+    {
+      if (inner == ETL_NULLPTR)
+      {
+        // This is the innermost range.
+        has_completed = true;
+        return;
+      }
+
+      // Find the range that holds the innermost.
+      imulti_range* outer = this;
+
+      while (outer->inner->inner != ETL_NULLPTR)
+      {
+        outer = outer->inner;
+      }
+
+      // Step without it.
+      imulti_range* innermost = outer->inner;
+
+      outer->inner = ETL_NULLPTR;
+      next();
+      outer->inner = innermost;
+    }
+
     //***************************************************************************
     /// Pure virtual functions.
     //***************************************************************************
@@ -491,6 +522,28 @@ namespace etl
       return current;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //***************************************************************************
+    /// Writes the values of one pass of this range, from the first, to the
+    /// output. Inner ranges are not included.
+    /// Returns the number written, which stops at the size of the output.
+    //***************************************************************************
+    size_t values(etl::span<value_type> output) const
+    {
+      value_type value = first;
+      size_t     count = 0U;
+
+      while ((count < output.size()) && (*p_compare)(value, last))
+      {
+        output[count] = value;
+        ++count;
+        (*p_stepper)(value);
+      }
+
+      return count;
+    }
+#endif
+
   private:
 
     //***************************************************************************
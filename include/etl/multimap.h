@@ -48,6 +48,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "private/node_handle.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -949,6 +950,30 @@ namespace etl
     typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
     typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Owns a node that has been extracted from a multimap.
+    /// The node still occupies a place in the pool of the multimap it came from.
+    //*************************************************************************
+    class node_type : public etl::private_node_handle::key_value_node_handle<TKey, TMapped>
+    {
+    public:
+
+      node_type()
+      {
+      }
+
+    private:
+
+      friend class imultimap;
+
+      node_type(Data_Node& node, etl::ipool& pool)
+        : etl::private_node_handle::key_value_node_handle<TKey, TMapped>(&node, &node.value, &pool, ETL_NULLPTR)
+      {
+      }
+    };
+#endif
+
     //*************************************************************************
     /// Gets the beginning of the multimap.
     //*************************************************************************
@@ -1291,6 +1316,218 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator /*position*/, Args && ... args)
+    {
+      return emplace(etl::forward<Args>(args)...);
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*********************************************************************
+    template <typename T1>
+    iterator emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// If asserts or exceptions are enabled, emits multimap_full if the multimap is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+      Data_Node& node = create_data_node();
+      ::new ((void*)&node.value) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1)
+    {
+      return emplace(value1);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2)
+    {
+      return emplace(value1, value2);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace(value1, value2, value3);
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace(value1, value2, value3, value4);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a node extracted from a multimap of the same type.
+    /// A node from this multimap is relinked, otherwise its value is moved into
+    /// a new node and the old one is released.
+    ///\return An iterator to the inserted element, or end() if the node was
+    /// empty.
+    //*********************************************************************
+    iterator insert(node_type&& node)
+    {
+      if (node.empty())
+      {
+        return end();
+      }
+
+      return iterator(*this, insert_node(root_node, claim_node(node)));
+    }
+
+    //*********************************************************************
+    /// Inserts a node extracted from a multimap of the same type.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, node_type&& node)
+    {
+      return insert(etl::move(node));
+    }
+
+    //*********************************************************************
+    /// Unlinks the element at the specified position and returns ownership
+    /// of its node.
+    //*********************************************************************
+    node_type extract(const_iterator position)
+    {
+      Node* node = const_cast<Node*>(position.p_node);
+
+      unlink_node(node);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      return node_type(imultimap::data_cast(*node), *p_node_pool);
+    }
+
+    //*********************************************************************
+    /// Unlinks the first element with the specified key and returns
+    /// ownership of its node. The handle is empty if the key is not present.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      const_iterator position = find(key);
+
+      if (position == cend())
+      {
+        return node_type();
+      }
+
+      return extract(position);
+    }
+
+    //*********************************************************************
+    /// Moves all of the elements of another multimap into this one.
+    //*********************************************************************
+    void merge(imultimap& other)
+    {
+      if (&other != this)
+      {
+        while (!other.empty())
+        {
+          node_type node = other.extract(other.cbegin());
+          insert_node(root_node, claim_node(node));
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Moves all of the elements of another multimap into this one.
+    //*********************************************************************
+    void merge(imultimap&& other)
+    {
+      merge(other);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the multimap.
     /// If asserts or exceptions are enabled, emits map_full if the multimap does not have enough free space.
@@ -1430,6 +1667,16 @@ namespace etl
 
   private:
 
+    //*********************************************************************
+    /// Inserts a node whose value has been constructed.
+    //*********************************************************************
+    iterator emplace_node(Data_Node& node)
+    {
+      Node* inserted_node = insert_node(root_node, node);
+
+      return iterator(*this, inserted_node);
+    }
+
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
@@ -1454,6 +1701,30 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Takes the node from a handle. A node from another pool has its value
+    /// moved into a new node from this pool.
+    //*************************************************************************
+    Data_Node& claim_node(node_type& node)
+    {
+      if (node.get_pool() == p_node_pool)
+      {
+        ETL_INCREMENT_DEBUG_COUNT
+        return *static_cast<Data_Node*>(node.release());
+      }
+      else
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(multimap_full));
+
+        Data_Node& data_node = allocate_data_node(etl::move(node.get_value()));
+        node.reset();
+
+        return data_node;
+      }
+    }
+#endif
+
     //*************************************************************************
     /// Create a Data_Node.
     //*************************************************************************
@@ -1765,6 +2036,18 @@ namespace etl
     /// provided
     //*************************************************************************
     void remove_node(Node* node)
+    {
+      if (node)
+      {
+        unlink_node(node);
+        destroy_data_node(imultimap::data_cast(*node));
+      }
+    }
+
+    //*************************************************************************
+    /// Unlink the node specified, without destroying it
+    //*************************************************************************
+    void unlink_node(Node* node)
     {
       // If valid found node was provided then proceed with steps 1 through 5
       if (node)
@@ -1989,9 +2272,6 @@ namespace etl
 
         // One less.
         --current_size;
-
-        // Destroy the node detached above
-        destroy_data_node(data_node);
       } // if(found)
     }
 
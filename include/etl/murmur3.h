@@ -37,6 +37,7 @@ SOFTWARE.
 #include "ihash.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "iterator.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -69,8 +70,13 @@ namespace etl
     /// Default constructor.
     /// \param seed The seed value. Default = 0.
     //*************************************************************************
-    murmur3(value_type seed_ = 0)
-      : seed(seed_)
+    ETL_CONSTEXPR14 murmur3(value_type seed_ = 0)
+      : is_finalised(false)
+      , block_fill_count(0)
+      , char_count(0)
+      , block(0)
+      , hash(seed_)
+      , seed(seed_)
     {
       reset();
     }
@@ -82,31 +88,24 @@ namespace etl
     /// \param seed  The seed value. Default = 0.
     //*************************************************************************
     template<typename TIterator>
-    murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
-      : seed(seed_)
+    ETL_CONSTEXPR14 murmur3(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : is_finalised(false)
+      , block_fill_count(0)
+      , char_count(0)
+      , block(0)
+      , hash(seed_)
+      , seed(seed_)
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
     }
 
     //*************************************************************************
     /// Resets the hash to the initial state.
     //*************************************************************************
-    void reset()
+    ETL_CONSTEXPR14 void reset()
     {
       hash             = seed;
       char_count       = 0;
@@ -121,24 +120,12 @@ namespace etl
     /// \param end
     //*************************************************************************
     template<typename TIterator>
-    void add(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
     }
 
     //*************************************************************************
@@ -146,12 +133,39 @@ namespace etl
     /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
     /// \param value The char to add to the hash.
     //*************************************************************************
-    void add(uint8_t value_)
+    ETL_CONSTEXPR14 void add(uint8_t value_)
     {
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8);
+      add_value(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a value to the current block.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void add_value(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8);
 
       if (++block_fill_count == FULL_BLOCK)
       {
@@ -164,28 +178,57 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Gets the hash value.
+    /// Adds a range from a random access iterator.
+    /// Whole blocks are assembled directly from the data, which the compiler
+    /// reduces to a single little endian word load for contiguous data.
     //*************************************************************************
-    value_type value()
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, ETL_OR_STD::random_access_iterator_tag)
     {
-      finalise();
-      return hash;
+      // Complete any partially filled block.
+      while ((block_fill_count != 0) && (begin != end))
+      {
+        add_value(uint8_t(*begin++));
+      }
+
+      while ((end - begin) >= FULL_BLOCK)
+      {
+        block = value_type(uint8_t(begin[0]))         | (value_type(uint8_t(begin[1])) << 8) |
+               (value_type(uint8_t(begin[2])) << 16) | (value_type(uint8_t(begin[3])) << 24);
+
+        add_block();
+        begin      += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      // Only the whole block loop can have left a used block behind.
+      if (block_fill_count == 0)
+      {
+        block = 0;
+      }
+
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
     }
 
     //*************************************************************************
-    /// Conversion operator to value_type.
+    /// Adds a range from any other iterator.
     //*************************************************************************
-    operator value_type ()
+    template<typename TIterator, typename TIteratorCategory>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, TIteratorCategory)
     {
-      return value();
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
     }
 
-  private:
-
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
-    void add_block()
+    ETL_CONSTEXPR14 void add_block()
     {
       block *= CONSTANT1;
       block = rotate_left(block, SHIFT1);
@@ -199,7 +242,7 @@ namespace etl
     //*************************************************************************
     /// Finalises the hash.
     //*************************************************************************
-    void finalise()
+    ETL_CONSTEXPR14 void finalise()
     {
       if (!is_finalised)
       {
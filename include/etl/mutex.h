@@ -50,4 +50,9 @@ SOFTWARE.
   #define ETL_HAS_MUTEX 0
 #endif
 
+// Spinning mutexes, for any platform with atomics.
+#include "mutex/spin_mutex.h"
+#include "mutex/ticket_mutex.h"
+#include "mutex/shared_mutex.h"
+
 #endif
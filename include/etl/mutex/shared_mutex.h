@@ -0,0 +1,154 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARED_MUTEX_INCLUDED
+#define ETL_SHARED_MUTEX_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "spin_mutex.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief A spinning reader-writer mutex.
+  /// Any number of readers may hold the lock with lock_shared(), or one writer
+  /// with lock(). A waiting writer stops new readers taking the lock, so that
+  /// writers cannot be starved.
+  //***************************************************************************
+  class shared_mutex
+  {
+  public:
+
+    shared_mutex()
+      : state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Lock for exclusive access.
+    //*************************************************************************
+    void lock()
+    {
+      private_mutex::spin_backoff backoff;
+
+      // Claim the writer bit.
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      while (((s & Writer) != 0U) ||
+             !state.compare_exchange_weak(s, s | Writer, etl::memory_order_acquire, etl::memory_order_relaxed))
+      {
+        backoff();
+        s = state.load(etl::memory_order_relaxed);
+      }
+
+      // Wait for the readers to leave.
+      while (state.load(etl::memory_order_acquire) != Writer)
+      {
+        backoff();
+      }
+    }
+
+    //*************************************************************************
+    /// Try to lock for exclusive access.
+    //*************************************************************************
+    bool try_lock()
+    {
+      uint32_t s = 0U;
+
+      return state.compare_exchange_strong(s, Writer, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Unlock from exclusive access.
+    //*************************************************************************
+    void unlock()
+    {
+      state.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Lock for shared access.
+    //*************************************************************************
+    void lock_shared()
+    {
+      private_mutex::spin_backoff backoff;
+
+      while (!try_lock_shared())
+      {
+        backoff();
+      }
+    }
+
+    //*************************************************************************
+    /// Try to lock for shared access.
+    //*************************************************************************
+    bool try_lock_shared()
+    {
+      uint32_t s = state.load(etl::memory_order_relaxed);
+
+      while ((s & Writer) == 0U)
+      {
+        if (state.compare_exchange_weak(s, s + 1U, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Unlock from shared access.
+    //*************************************************************************
+    void unlock_shared()
+    {
+      state.fetch_sub(1U, etl::memory_order_release);
+    }
+
+  private:
+
+    shared_mutex(const shared_mutex&) ETL_DELETE;
+    shared_mutex& operator =(const shared_mutex&) ETL_DELETE;
+
+    /// Set while a writer holds, or is waiting for, the lock.
+    static ETL_CONSTANT uint32_t Writer = 0x80000000UL;
+
+    /// The writer bit and the number of readers.
+    etl::atomic_uint32_t state;
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,162 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPIN_MUTEX_INCLUDED
+#define ETL_SPIN_MUTEX_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#include <stdint.h>
+
+#if ETL_USING_STL && ETL_CPP11_SUPPORTED
+  #include <thread>
+#endif
+
+#if defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+  #include <intrin.h>
+#endif
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_mutex
+  {
+    //*************************************************************************
+    /// Tells the CPU that this is a spin wait loop.
+    /// Saves power and frees the pipeline for a hyperthreaded sibling.
+    //*************************************************************************
+    inline void spin_pause()
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #if defined(__i386__) || defined(__x86_64__)
+      __builtin_ia32_pause();
+  #elif defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+      __asm__ __volatile__("yield");
+  #endif
+#elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+      _mm_pause();
+#endif
+    }
+
+    //*************************************************************************
+    /// Exponential backoff for spin waits.
+    /// Pauses for 1, 2, 4 ... Max_Pauses, then yields to the OS, if there is one.
+    //*************************************************************************
+    class spin_backoff
+    {
+    public:
+
+      static ETL_CONSTANT uint32_t Max_Pauses = 64U;
+
+      spin_backoff()
+        : pauses(1U)
+      {
+      }
+
+      void operator()()
+      {
+        if (pauses <= Max_Pauses)
+        {
+          for (uint32_t i = 0U; i < pauses; ++i)
+          {
+            spin_pause();
+          }
+
+          pauses *= 2U;
+        }
+        else
+        {
+#if ETL_USING_STL && ETL_CPP11_SUPPORTED
+          std::this_thread::yield();
+#else
+          spin_pause();
+#endif
+        }
+      }
+
+    private:
+
+      uint32_t pauses;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief A mutex that spins, with backoff, until it is unlocked.
+  /// For very short critical sections, where an OS mutex costs more than the
+  /// wait. Not fair. Do not use where the owner may be preempted by a waiter
+  /// of higher priority on the same core.
+  //***************************************************************************
+  class spin_mutex
+  {
+  public:
+
+    spin_mutex()
+      : flag(false)
+    {
+    }
+
+    void lock()
+    {
+      private_mutex::spin_backoff backoff;
+
+      // Only write to the flag when it looks free, so waiters spin in their own cache.
+      while (flag.exchange(true, etl::memory_order_acquire))
+      {
+        while (flag.load(etl::memory_order_relaxed))
+        {
+          backoff();
+        }
+      }
+    }
+
+    bool try_lock()
+    {
+      return !flag.load(etl::memory_order_relaxed) &&
+             !flag.exchange(true, etl::memory_order_acquire);
+    }
+
+    void unlock()
+    {
+      flag.store(false, etl::memory_order_release);
+    }
+
+  private:
+
+    spin_mutex(const spin_mutex&) ETL_DELETE;
+    spin_mutex& operator =(const spin_mutex&) ETL_DELETE;
+
+    etl::atomic_bool flag;
+  };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TICKET_MUTEX_INCLUDED
+#define ETL_TICKET_MUTEX_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "spin_mutex.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief A fair spinning mutex.
+  /// Each caller of lock() takes a ticket and waits until it is served, so
+  /// the lock is granted in the order that it was requested.
+  //***************************************************************************
+  class ticket_mutex
+  {
+  public:
+
+    ticket_mutex()
+      : next_ticket(0U),
+        now_serving(0U)
+    {
+    }
+
+    void lock()
+    {
+      const uint32_t ticket = next_ticket.fetch_add(1U, etl::memory_order_relaxed);
+
+      private_mutex::spin_backoff backoff;
+
+      while (now_serving.load(etl::memory_order_acquire) != ticket)
+      {
+        backoff();
+      }
+    }
+
+    bool try_lock()
+    {
+      // Only take a ticket if it would be served immediately.
+      uint32_t ticket = now_serving.load(etl::memory_order_relaxed);
+
+      return next_ticket.compare_exchange_strong(ticket, ticket + 1U, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    void unlock()
+    {
+      // Only the owner writes now_serving.
+      now_serving.store(now_serving.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+  private:
+
+    ticket_mutex(const ticket_mutex&) ETL_DELETE;
+    ticket_mutex& operator =(const ticket_mutex&) ETL_DELETE;
+
+    etl::atomic_uint32_t next_ticket;
+    etl::atomic_uint32_t now_serving;
+  };
+}
+
+#endif
+
+#endif
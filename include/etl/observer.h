@@ -58,6 +58,10 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 
+#if ETL_CPP11_SUPPORTED
+  #include "delegate.h"
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -464,6 +468,198 @@ namespace etl
   };
 
 #endif
+
+#if ETL_CPP11_SUPPORTED
+  //*********************************************************************
+  /// An observable that notifies a list of etl::delegates.
+  /// The delegates are stored contiguously and are called directly, without
+  /// virtual dispatch. The observers do not have to derive from etl::observer.
+  ///\tparam TNotification The notification type.
+  ///\tparam MAX_OBSERVERS The maximum number of delegates that can be accomodated.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename TNotification, const size_t MAX_OBSERVERS>
+  class delegate_observable
+  {
+  public:
+
+    typedef size_t                             size_type;
+    typedef etl::delegate<void(TNotification)> delegate_type;
+
+    typedef etl::vector<delegate_type, MAX_OBSERVERS> Observer_List;
+
+    //*****************************************************************
+    /// Add a delegate to the list.
+    /// If asserts or exceptions are enabled then an etl::observer_list_full
+    /// is emitted if the observer list is already full.
+    ///\param observer The delegate to call.
+    //*****************************************************************
+    void add_observer(const delegate_type& observer)
+    {
+      // Not there?
+      if (etl::find(observer_list.begin(), observer_list.end(), observer) == observer_list.end())
+      {
+        // Is there enough room?
+        ETL_ASSERT(!observer_list.full(), ETL_ERROR(etl::observer_list_full));
+
+        // Add it.
+        observer_list.push_back(observer);
+      }
+    }
+
+    //*****************************************************************
+    /// Remove a particular delegate from the list.
+    ///\param observer The delegate to remove.
+    ///\return <b>true</b> if the delegate was removed, <b>false</b> if not.
+    //*****************************************************************
+    bool remove_observer(const delegate_type& observer)
+    {
+      typename Observer_List::iterator i_observer = etl::find(observer_list.begin(), observer_list.end(), observer);
+
+      // Found it?
+      if (i_observer != observer_list.end())
+      {
+        // Erase it.
+        observer_list.erase(i_observer);
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*****************************************************************
+    /// Clear all delegates from the list.
+    //*****************************************************************
+    void clear_observers()
+    {
+      observer_list.clear();
+    }
+
+    //*****************************************************************
+    /// Returns the number of delegates.
+    //*****************************************************************
+    size_type number_of_observers() const
+    {
+      return observer_list.size();
+    }
+
+    //*****************************************************************
+    /// Notify all of the delegates, sending them the notification.
+    ///\param n The notification.
+    //*****************************************************************
+    void notify_observers(TNotification n)
+    {
+      const delegate_type* p_observer = observer_list.data();
+      const delegate_type* p_end      = p_observer + observer_list.size();
+
+      while (p_observer != p_end)
+      {
+        (*p_observer)(n);
+        ++p_observer;
+      }
+    }
+
+  protected:
+
+    ~delegate_observable()
+    {
+    }
+
+  private:
+
+    /// The list of delegates.
+    Observer_List observer_list;
+  };
+
+  //*********************************************************************
+  /// An observable with a fixed list of observers, whose types are given
+  /// as template parameters.
+  /// Each observer's notification() is called through its named type, not
+  /// through virtual dispatch, so the calls may be inlined. The types should
+  /// be the most derived types of the observers.
+  ///\tparam TObservers The observer types.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename... TObservers>
+  class static_observable;
+
+  //*********************************************************************
+  /// A static_observable with no observers.
+  ///\ingroup observer
+  //*********************************************************************
+  template <>
+  class static_observable<>
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    static ETL_CONSTEXPR size_type number_of_observers()
+    {
+      return 0U;
+    }
+
+    //*****************************************************************
+    /// Does nothing.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(const TNotification&)
+    {
+    }
+  };
+
+  //*********************************************************************
+  /// A static_observable with one or more observers.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename TObserver, typename... TRest>
+  class static_observable<TObserver, TRest...>
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*****************************************************************
+    /// Constructor.
+    ///\param observer_ The first observer.
+    ///\param rest_     The other observers.
+    //*****************************************************************
+    static_observable(TObserver& observer_, TRest&... rest_)
+      : observer(observer_)
+      , rest(rest_...)
+    {
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    static ETL_CONSTEXPR size_type number_of_observers()
+    {
+      return 1U + sizeof...(TRest);
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, in order, sending them the notification.
+    ///\param n The notification.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(const TNotification& n)
+    {
+      observer.TObserver::notification(n);
+      rest.notify_observers(n);
+    }
+
+  private:
+
+    TObserver&                       observer;
+    etl::static_observable<TRest...> rest;
+  };
+#endif
 }
 
 #endif
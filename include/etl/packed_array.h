@@ -0,0 +1,388 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PACKED_ARRAY_INCLUDED
+#define ETL_PACKED_ARRAY_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "binary.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "algorithm.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include "span.h"
+#endif
+
+//*****************************************************************************
+///\defgroup packed_array packed_array
+/// A fixed size array of VBits wide unsigned integers, packed end to end
+/// into words, so that each element takes VBits bits of storage.
+/// Elements may span two words.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup packed_array
+  /// A fixed size array of bit packed unsigned integers.
+  /// \tparam VBits The number of bits in each element. 1 to 32.
+  /// \tparam VSize The number of elements.
+  //***************************************************************************
+  template <size_t VBits, size_t VSize>
+  class packed_array
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VBits > 0U) && (VBits <= 32U), "Element bits must be from 1 to 32");
+
+    typedef typename etl::smallest_uint_for_bits<VBits>::type value_type;
+    typedef size_t                                             size_type;
+
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_type;
+#else
+    typedef uint32_t word_type;
+#endif
+
+    static ETL_CONSTANT size_t Bits      = VBits;
+    static ETL_CONSTANT size_t Size      = VSize;
+    static ETL_CONSTANT size_t Word_Bits = etl::integral_limits<word_type>::bits;
+    static ETL_CONSTANT size_t Words     = ((VBits * VSize) + Word_Bits - 1U) / Word_Bits;
+
+    //*************************************************************************
+    /// A reference to an element.
+    //*************************************************************************
+    class reference
+    {
+    public:
+
+      friend class packed_array;
+
+      //*******************************
+      /// Gets the element.
+      //*******************************
+      operator value_type() const
+      {
+        return p_array->get(index);
+      }
+
+      //*******************************
+      /// Sets the element.
+      //*******************************
+      reference& operator =(value_type value)
+      {
+        p_array->set(index, value);
+        return *this;
+      }
+
+      //*******************************
+      /// Sets the element from another element.
+      //*******************************
+      reference& operator =(const reference& other)
+      {
+        p_array->set(index, value_type(other));
+        return *this;
+      }
+
+    private:
+
+      //*******************************
+      /// Constructor.
+      //*******************************
+      reference(packed_array& array_, size_t index_)
+        : p_array(&array_),
+          index(index_)
+      {
+      }
+
+      packed_array* p_array;
+      size_t        index;
+    };
+
+    //*************************************************************************
+    /// Constructor. All of the elements are zero.
+    //*************************************************************************
+    packed_array()
+    {
+      etl::fill_n(words, Words, word_type(0));
+    }
+
+    //*************************************************************************
+    /// Constructor. All of the elements are set to the value.
+    //*************************************************************************
+    explicit packed_array(value_type value)
+    {
+      fill(value);
+    }
+
+    //*************************************************************************
+    /// Gets the element at the index.
+    //*************************************************************************
+    value_type get(size_t index) const
+    {
+      return value_type(etl::get_packed_bits(words, index * VBits, VBits));
+    }
+
+    //*************************************************************************
+    /// Sets the element at the index.
+    /// Bits of the value above VBits are ignored.
+    //*************************************************************************
+    void set(size_t index, value_type value)
+    {
+      etl::set_packed_bits(words, index * VBits, VBits, word_type(value));
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at the index.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return reference(*this, index);
+    }
+
+    //*************************************************************************
+    /// Returns the element at the index.
+    //*************************************************************************
+    value_type operator [](size_t index) const
+    {
+      return get(index);
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return reference(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the first element.
+    //*************************************************************************
+    value_type front() const
+    {
+      return get(0U);
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return reference(*this, VSize - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns the last element.
+    //*************************************************************************
+    value_type back() const
+    {
+      return get(VSize - 1U);
+    }
+
+    //*************************************************************************
+    /// Sets all of the elements to the value.
+    //*************************************************************************
+    void fill(value_type value)
+    {
+      etl::fill_n(words, Words, word_type(0));
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        set(i, value);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies elements out to an array of integers.
+    /// \param p_destination The start of the destination.
+    /// \param count         The maximum number of elements to copy.
+    /// \param position      The index of the first element to copy.
+    /// \return The number of elements copied.
+    //*************************************************************************
+    template <typename T>
+    size_t unpack(T* p_destination, size_t count, size_t position = 0U) const
+    {
+      count = copy_count(count, position);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        p_destination[i] = T(get(position + i));
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Copies elements in from an array of integers.
+    /// Bits of the values above VBits are ignored.
+    /// \param p_source The start of the source.
+    /// \param count    The maximum number of elements to copy.
+    /// \param position The index of the first element to copy to.
+    /// \return The number of elements copied.
+    //*************************************************************************
+    template <typename T>
+    size_t pack(const T* p_source, size_t count, size_t position = 0U)
+    {
+      count = copy_count(count, position);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        set(position + i, value_type(p_source[i]));
+      }
+
+      return count;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Copies elements out to a span of integers.
+    /// \param destination The destination.
+    /// \param position    The index of the first element to copy.
+    /// \return The number of elements copied.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    size_t unpack(etl::span<T, VExtent> destination, size_t position = 0U) const
+    {
+      return unpack(destination.data(), destination.size(), position);
+    }
+
+    //*************************************************************************
+    /// Copies elements in from a span of integers.
+    /// \param source   The source.
+    /// \param position The index of the first element to copy to.
+    /// \return The number of elements copied.
+    //*************************************************************************
+    template <typename T, size_t VExtent>
+    size_t pack(etl::span<T, VExtent> source, size_t position = 0U)
+    {
+      return pack(static_cast<const T*>(source.data()), source.size(), position);
+    }
+#endif
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// The maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Is the array empty?
+    //*************************************************************************
+    ETL_CONSTEXPR bool empty() const
+    {
+      return VSize == 0U;
+    }
+
+    //*************************************************************************
+    /// A pointer to the words that hold the elements.
+    //*************************************************************************
+    word_type* data()
+    {
+      return words;
+    }
+
+    //*************************************************************************
+    /// A pointer to the words that hold the elements.
+    //*************************************************************************
+    const word_type* data() const
+    {
+      return words;
+    }
+
+    //*************************************************************************
+    /// The number of words that hold the elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t data_size() const
+    {
+      return Words;
+    }
+
+    //*************************************************************************
+    /// Equality operator.
+    //*************************************************************************
+    friend bool operator ==(const packed_array& lhs, const packed_array& rhs)
+    {
+      return etl::equal(lhs.words, lhs.words + Words, rhs.words);
+    }
+
+    //*************************************************************************
+    /// Inequality operator.
+    //*************************************************************************
+    friend bool operator !=(const packed_array& lhs, const packed_array& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The number of elements that can be copied from the position.
+    //*************************************************************************
+    static size_t copy_count(size_t count, size_t position)
+    {
+      return (position < VSize) ? etl::min(count, VSize - position) : 0U;
+    }
+
+    // Unused bits in the last word are always zero, so that arrays compare
+    // equal if their elements are equal.
+    word_type words[(Words != 0U) ? Words : 1U];
+  };
+
+  template <size_t VBits, size_t VSize>
+  ETL_CONSTANT size_t packed_array<VBits, VSize>::Bits;
+
+  template <size_t VBits, size_t VSize>
+  ETL_CONSTANT size_t packed_array<VBits, VSize>::Size;
+
+  template <size_t VBits, size_t VSize>
+  ETL_CONSTANT size_t packed_array<VBits, VSize>::Word_Bits;
+
+  template <size_t VBits, size_t VSize>
+  ETL_CONSTANT size_t packed_array<VBits, VSize>::Words;
+}
+
+#endif
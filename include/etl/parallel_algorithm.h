@@ -0,0 +1,599 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_ALGORITHM_INCLUDED
+#define ETL_PARALLEL_ALGORITHM_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "memory.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_CPP11_SUPPORTED
+
+#include "delegate.h"
+
+#if ETL_USING_STL
+  #include <thread>
+  #include <mutex>
+  #include <condition_variable>
+  #include <atomic>
+  #define ETL_HAS_THREAD_EXECUTOR 1
+#else
+  #define ETL_HAS_THREAD_EXECUTOR 0
+#endif
+
+///\defgroup parallel_algorithm parallel_algorithm
+/// Parallel versions of for_each, transform, reduce and sort.
+/// The range is split into chunks that are handed to an executor.
+///\ingroup algorithm
+
+//*****************************************************************************
+/// The size, in bytes, of the chunks a range is split into.
+/// Small enough to stay in the L1 cache of the core that processes it.
+//*****************************************************************************
+#if !defined(ETL_PARALLEL_CHUNK_BYTES)
+  #define ETL_PARALLEL_CHUNK_BYTES 16384U
+#endif
+
+//*****************************************************************************
+/// The maximum number of partial results held by etl::parallel::reduce.
+//*****************************************************************************
+#if !defined(ETL_PARALLEL_MAX_REDUCE_BLOCKS)
+  #define ETL_PARALLEL_MAX_REDUCE_BLOCKS 64U
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for executors used by the parallel algorithms.
+  /// An executor may be built on std::thread, an RTOS or a thread pool.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  class iexecutor
+  {
+  public:
+
+    typedef etl::delegate<void(size_t)> task_type;
+
+    virtual ~iexecutor()
+    {
+    }
+
+    //*************************************************************************
+    /// The number of tasks that may be run at the same time.
+    //*************************************************************************
+    virtual size_t concurrency() const = 0;
+
+    //*************************************************************************
+    /// Calls task(i) once for each i in [0, n_tasks), possibly concurrently.
+    /// Returns when all of the calls have completed.
+    //*************************************************************************
+    virtual void run(size_t n_tasks, task_type task) = 0;
+  };
+
+  //***************************************************************************
+  /// An executor that runs all of the tasks on the calling thread.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  class sequential_executor : public etl::iexecutor
+  {
+  public:
+
+    size_t concurrency() const ETL_OVERRIDE
+    {
+      return 1U;
+    }
+
+    void run(size_t n_tasks, task_type task) ETL_OVERRIDE
+    {
+      for (size_t i = 0U; i < n_tasks; ++i)
+      {
+        task(i);
+      }
+    }
+  };
+
+#if ETL_HAS_THREAD_EXECUTOR
+  //***************************************************************************
+  /// An executor with a pool of std::thread workers.
+  /// The thread that calls run() works alongside the pool, so a pool of
+  /// N threads starts N - 1 workers.
+  /// run() must not be called from more than one thread at a time, or from
+  /// inside one of its own tasks. Tasks must not throw.
+  ///\tparam MAX_THREADS_ The maximum number of threads, including the caller.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <const size_t MAX_THREADS_>
+  class thread_executor : public etl::iexecutor
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_THREADS_ > 0U, "There must be at least one thread");
+
+    static ETL_CONSTANT size_t MAX_THREADS = MAX_THREADS_;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Starts n_threads - 1 workers. Defaults to one thread per core.
+    //*************************************************************************
+    explicit thread_executor(size_t n_threads = std::thread::hardware_concurrency())
+      : n_workers(0U)
+      , n_active(0U)
+      , generation(0U)
+      , stopping(false)
+      , n_tasks(0U)
+      , next_task(0U)
+    {
+      n_threads = etl::clamp(n_threads, size_t(1U), MAX_THREADS);
+
+      for (; n_workers < (n_threads - 1U); ++n_workers)
+      {
+        workers[n_workers] = std::thread(&thread_executor::worker_loop, this);
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Stops and joins the workers.
+    //*************************************************************************
+    ~thread_executor()
+    {
+      {
+        std::lock_guard<std::mutex> lock(access);
+        stopping = true;
+      }
+
+      wake.notify_all();
+
+      for (size_t i = 0U; i < n_workers; ++i)
+      {
+        workers[i].join();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of threads, including the caller of run().
+    //*************************************************************************
+    size_t concurrency() const ETL_OVERRIDE
+    {
+      return n_workers + 1U;
+    }
+
+    //*************************************************************************
+    /// Runs the tasks on the workers and the calling thread.
+    //*************************************************************************
+    void run(size_t n_tasks_, task_type task_) ETL_OVERRIDE
+    {
+      if ((n_workers == 0U) || (n_tasks_ <= 1U))
+      {
+        for (size_t i = 0U; i < n_tasks_; ++i)
+        {
+          task_(i);
+        }
+
+        return;
+      }
+
+      {
+        // Workers that woke too late for the last run may still be leaving it.
+        std::unique_lock<std::mutex> lock(access);
+        idle.wait(lock, [this]() { return n_active == 0U; });
+
+        task    = task_;
+        n_tasks = n_tasks_;
+        next_task.store(0U);
+        ++generation;
+      }
+
+      wake.notify_all();
+
+      execute_tasks();
+
+      // Every task has been taken. Wait for the workers still running one.
+      std::unique_lock<std::mutex> lock(access);
+      idle.wait(lock, [this]() { return n_active == 0U; });
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Waits for each run and joins in.
+    //*************************************************************************
+    void worker_loop()
+    {
+      size_t seen = 0U;
+
+      while (true)
+      {
+        {
+          std::unique_lock<std::mutex> lock(access);
+          wake.wait(lock, [this, seen]() { return stopping || (generation != seen); });
+
+          if (stopping)
+          {
+            return;
+          }
+
+          seen = generation;
+          ++n_active;
+        }
+
+        execute_tasks();
+
+        bool notify;
+
+        {
+          std::lock_guard<std::mutex> lock(access);
+          notify = (--n_active == 0U);
+        }
+
+        if (notify)
+        {
+          idle.notify_all();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Takes and runs tasks until there are none left.
+    /// The task and count do not change while a worker is active.
+    //*************************************************************************
+    void execute_tasks()
+    {
+      while (true)
+      {
+        const size_t i = next_task.fetch_add(1U);
+
+        if (i >= n_tasks)
+        {
+          break;
+        }
+
+        task(i);
+      }
+    }
+
+    std::thread             workers[MAX_THREADS];
+    size_t                  n_workers;
+    std::mutex              access;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    size_t                  n_active;
+    size_t                  generation;
+    bool                    stopping;
+    task_type               task;
+    size_t                  n_tasks;
+    std::atomic<size_t>     next_task;
+  };
+
+  template <const size_t MAX_THREADS_>
+  ETL_CONSTANT size_t thread_executor<MAX_THREADS_>::MAX_THREADS;
+#endif
+
+  namespace private_parallel
+  {
+    //*************************************************************************
+    /// The number of elements of the given size in a chunk.
+    //*************************************************************************
+    inline size_t chunk_length(size_t element_size)
+    {
+      return (element_size >= ETL_PARALLEL_CHUNK_BYTES) ? 1U : (ETL_PARALLEL_CHUNK_BYTES / element_size);
+    }
+
+    //*************************************************************************
+    /// The number of pieces of piece_length needed to cover length.
+    //*************************************************************************
+    inline size_t n_pieces(size_t length, size_t piece_length)
+    {
+      return (length + piece_length - 1U) / piece_length;
+    }
+
+    //*************************************************************************
+    /// The offset of the start of part i of n_parts equal parts.
+    //*************************************************************************
+    inline size_t part_offset(size_t length, size_t i, size_t n_parts)
+    {
+      return ((length / n_parts) * i) + (((length % n_parts) * i) / n_parts);
+    }
+  }
+
+  namespace parallel
+  {
+    //*************************************************************************
+    /// Calls function for each element of the range, in parallel.
+    /// The order of the calls is unspecified.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    void for_each(etl::iexecutor& executor, TIterator first, TIterator last, TFunction function)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "Random access iterators required");
+
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const size_t length   = static_cast<size_t>(etl::distance(first, last));
+      const size_t chunk    = private_parallel::chunk_length(sizeof(value_type));
+      const size_t n_chunks = private_parallel::n_pieces(length, chunk);
+
+      auto process = [&](size_t i)
+      {
+        TIterator       itr = first + difference_type(i * chunk);
+        const TIterator end = (i == (n_chunks - 1U)) ? last : itr + difference_type(chunk);
+
+        for (; itr != end; ++itr)
+        {
+          function(*itr);
+        }
+      };
+
+      executor.run(n_chunks, etl::iexecutor::task_type(process));
+    }
+
+    //*************************************************************************
+    /// Transforms the range into the destination, in parallel.
+    ///\return An iterator to the end of the destination range.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator, typename TUnaryOperation>
+    TOutputIterator transform(etl::iexecutor& executor, TInputIterator first, TInputIterator last, TOutputIterator d_first, TUnaryOperation operation)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TInputIterator>::value,  "Random access iterators required");
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TOutputIterator>::value, "Random access iterators required");
+
+      typedef typename etl::iterator_traits<TInputIterator>::value_type       value_type;
+      typedef typename etl::iterator_traits<TInputIterator>::difference_type  in_difference_type;
+      typedef typename etl::iterator_traits<TOutputIterator>::difference_type out_difference_type;
+
+      const size_t length   = static_cast<size_t>(etl::distance(first, last));
+      const size_t chunk    = private_parallel::chunk_length(sizeof(value_type));
+      const size_t n_chunks = private_parallel::n_pieces(length, chunk);
+
+      auto process = [&](size_t i)
+      {
+        TInputIterator       itr = first + in_difference_type(i * chunk);
+        const TInputIterator end = (i == (n_chunks - 1U)) ? last : itr + in_difference_type(chunk);
+        TOutputIterator      out = d_first + out_difference_type(i * chunk);
+
+        for (; itr != end; ++itr, ++out)
+        {
+          *out = operation(*itr);
+        }
+      };
+
+      executor.run(n_chunks, etl::iexecutor::task_type(process));
+
+      return d_first + out_difference_type(length);
+    }
+
+    //*************************************************************************
+    /// Transforms two ranges into the destination, in parallel.
+    ///\return An iterator to the end of the destination range.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryOperation>
+    TOutputIterator transform(etl::iexecutor& executor, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TOutputIterator d_first, TBinaryOperation operation)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TInputIterator1>::value, "Random access iterators required");
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TInputIterator2>::value, "Random access iterators required");
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TOutputIterator>::value, "Random access iterators required");
+
+      typedef typename etl::iterator_traits<TInputIterator1>::value_type      value_type;
+      typedef typename etl::iterator_traits<TInputIterator1>::difference_type in1_difference_type;
+      typedef typename etl::iterator_traits<TInputIterator2>::difference_type in2_difference_type;
+      typedef typename etl::iterator_traits<TOutputIterator>::difference_type out_difference_type;
+
+      const size_t length   = static_cast<size_t>(etl::distance(first1, last1));
+      const size_t chunk    = private_parallel::chunk_length(sizeof(value_type));
+      const size_t n_chunks = private_parallel::n_pieces(length, chunk);
+
+      auto process = [&](size_t i)
+      {
+        TInputIterator1       itr1 = first1 + in1_difference_type(i * chunk);
+        const TInputIterator1 end  = (i == (n_chunks - 1U)) ? last1 : itr1 + in1_difference_type(chunk);
+        TInputIterator2       itr2 = first2 + in2_difference_type(i * chunk);
+        TOutputIterator       out  = d_first + out_difference_type(i * chunk);
+
+        for (; itr1 != end; ++itr1, ++itr2, ++out)
+        {
+          *out = operation(*itr1, *itr2);
+        }
+      };
+
+      executor.run(n_chunks, etl::iexecutor::task_type(process));
+
+      return d_first + out_difference_type(length);
+    }
+
+    //*************************************************************************
+    /// Reduces the range with operation, in parallel.
+    /// The range is split into at most ETL_PARALLEL_MAX_REDUCE_BLOCKS blocks.
+    /// The partial results are combined in order, so operation need only be
+    /// associative.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TBinaryOperation>
+    T reduce(etl::iexecutor& executor, TIterator first, TIterator last, T init, TBinaryOperation operation)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "Random access iterators required");
+
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const size_t length   = static_cast<size_t>(etl::distance(first, last));
+      const size_t chunk    = private_parallel::chunk_length(sizeof(value_type));
+      size_t       n_blocks = etl::min(private_parallel::n_pieces(length, chunk), size_t(ETL_PARALLEL_MAX_REDUCE_BLOCKS));
+
+      if (n_blocks <= 1U)
+      {
+        for (; first != last; ++first)
+        {
+          init = operation(init, *first);
+        }
+
+        return init;
+      }
+
+      // Whole chunks per block, and no empty blocks.
+      const size_t block = private_parallel::n_pieces(private_parallel::n_pieces(length, n_blocks), chunk) * chunk;
+      n_blocks = private_parallel::n_pieces(length, block);
+
+      etl::uninitialized_buffer_of<T, ETL_PARALLEL_MAX_REDUCE_BLOCKS> partials;
+
+      auto process = [&](size_t i)
+      {
+        TIterator       itr = first + difference_type(i * block);
+        const TIterator end = (i == (n_blocks - 1U)) ? last : itr + difference_type(block);
+
+        T value(*itr);
+
+        for (++itr; itr != end; ++itr)
+        {
+          value = operation(value, *itr);
+        }
+
+        ::new (&partials[int(i)]) T(etl::move(value));
+      };
+
+      executor.run(n_blocks, etl::iexecutor::task_type(process));
+
+      for (size_t i = 0U; i < n_blocks; ++i)
+      {
+        init = operation(init, partials[int(i)]);
+        partials[int(i)].~T();
+      }
+
+      return init;
+    }
+
+    //*************************************************************************
+    /// Sums the range, in parallel.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    T reduce(etl::iexecutor& executor, TIterator first, TIterator last, T init)
+    {
+      return etl::parallel::reduce(executor, first, last, init, etl::plus<T>());
+    }
+
+    //*************************************************************************
+    /// Sums the range, in parallel, starting from value_type().
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::iterator_traits<TIterator>::value_type reduce(etl::iexecutor& executor, TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      return etl::parallel::reduce(executor, first, last, value_type(), etl::plus<value_type>());
+    }
+
+    //*************************************************************************
+    /// Sorts the range, in parallel.
+    /// The range is split into a power of two parts, at least one per thread,
+    /// that are sorted concurrently and then merged in pairs, also
+    /// concurrently, until one remains.
+    /// The merges use etl::inplace_merge.
+    /// Not stable.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(etl::iexecutor& executor, TIterator first, TIterator last, TCompare compare)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "Random access iterators required");
+
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const size_t length = static_cast<size_t>(etl::distance(first, last));
+      const size_t chunk  = private_parallel::chunk_length(sizeof(value_type));
+
+      size_t n_parts = 1U;
+
+      while ((n_parts < executor.concurrency()) && ((length / (n_parts * 2U)) >= chunk))
+      {
+        n_parts *= 2U;
+      }
+
+      if (n_parts == 1U)
+      {
+        etl::sort(first, last, compare);
+        return;
+      }
+
+      auto part = [&](size_t i)
+      {
+        return first + difference_type(private_parallel::part_offset(length, i, n_parts));
+      };
+
+      auto sort_part = [&](size_t i)
+      {
+        etl::sort(part(i), part(i + 1U), compare);
+      };
+
+      executor.run(n_parts, etl::iexecutor::task_type(sort_part));
+
+      for (size_t width = 1U; width < n_parts; width *= 2U)
+      {
+        auto merge_parts = [&](size_t i)
+        {
+          const size_t start = i * width * 2U;
+
+          etl::inplace_merge(part(start), part(start + width), part(start + (width * 2U)), compare);
+        };
+
+        executor.run(n_parts / (width * 2U), etl::iexecutor::task_type(merge_parts));
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the range, in parallel, using etl::less.
+    ///\ingroup parallel_algorithm
+    //*************************************************************************
+    template <typename TIterator>
+    void sort(etl::iexecutor& executor, TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      etl::parallel::sort(executor, first, last, etl::less<value_type>());
+    }
+  }
+}
+
+#endif
+#endif
@@ -209,6 +209,44 @@ SOFTWARE.
   #define ETL_CONSTINIT
 #endif
 
+// Data prefetch hints, for reading, and for writing.
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_PREFETCH(address) __builtin_prefetch(address)
+  #define ETL_PREFETCH_WRITE(address) __builtin_prefetch(address, 1)
+#else
+  #define ETL_PREFETCH(address)
+  #define ETL_PREFETCH_WRITE(address)
+#endif
+
+// Branch prediction hints for conditions.
+// ETL_LIKELY and ETL_UNLIKELY are the C++20 attributes, for statements.
+// These are for expressions, and work before C++20 on GCC and Clang.
+// e.g. if (ETL_PREDICT_FALSE(p == ETL_NULLPTR))
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_PREDICT_TRUE(condition)  __builtin_expect(!!(condition), 1)
+  #define ETL_PREDICT_FALSE(condition) __builtin_expect(!!(condition), 0)
+#else
+  #define ETL_PREDICT_TRUE(condition)  (condition)
+  #define ETL_PREDICT_FALSE(condition) (condition)
+#endif
+
+// Marks a function as rarely called, and keeps it out of line.
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6) || defined(ETL_COMPILER_ARM7)
+  #define ETL_COLD __attribute__((cold, noinline))
+#elif defined(ETL_COMPILER_MICROSOFT)
+  #define ETL_COLD __declspec(noinline)
+#else
+  #define ETL_COLD
+#endif
+
+// The size of a cache line.
+// Define in the profile to pad data that is written by different cores on to separate cache lines,
+// and to enable prefetching in the pools. The x86 profiles define it as 64.
+// Defaults to 0, for no padding, as most targets have no data cache.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 0
+#endif
+
 // Sort out namespaces for STL/No STL options.
 #include "private/choose_namespace.h"
 
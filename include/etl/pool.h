@@ -81,6 +81,25 @@ namespace etl
       return base_t::template allocate<T>();
     }
 
+    //*************************************************************************
+    /// Allocate an object from the pool without checking that there is a
+    /// free item.
+    /// Undefined behaviour if the pool is empty.
+    //*************************************************************************
+    T* allocate_unchecked()
+    {
+      return base_t::template allocate_unchecked<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for up to n objects from the pool.
+    /// Returns the number allocated.
+    //*************************************************************************
+    size_t allocate_n(T** pp_items, size_t n)
+    {
+      return base_t::template allocate_n<T>(pp_items, n);
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -160,6 +179,29 @@ namespace etl
       base_t::release(p_object);
     }
 
+    //*************************************************************************
+    /// Releases the object without checking that it belongs to the pool.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    template <typename U>
+    void release_unchecked(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release_unchecked(p_object);
+    }
+
+    //*************************************************************************
+    /// Releases n objects.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    //*************************************************************************
+    template <typename U>
+    void release_n(U* const* pp_items, size_t n)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release_n(pp_items, n);
+    }
+
     //*************************************************************************
     /// Destroys the object.
     /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
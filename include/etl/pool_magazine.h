@@ -0,0 +1,359 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_MAGAZINE_INCLUDED
+#define ETL_POOL_MAGAZINE_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "atomic_pool.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup pool_magazine pool_magazine
+/// A per thread cache of free items in front of a shared etl::iatomic_pool.
+/// Each thread or core owns its own magazine, so most allocations and
+/// releases touch only memory private to that thread. The shared pool is only
+/// visited to refill an empty magazine or to drain a full one, and then for
+/// half of the magazine at a time, with a single exchange of the pool's free
+/// list head.
+/// A magazine must only be used by the thread that owns it. Items may be
+/// released to any thread's own magazine, or directly to the shared pool,
+/// wherever they were allocated.
+/// Uses the exceptions of etl::pool.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A cache of up to VCapacity free items from a shared atomic pool.
+  ///\ingroup pool_magazine
+  //***************************************************************************
+  template <const size_t VCapacity>
+  class pool_magazine
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VCapacity >= 2U), "Magazine capacity must be at least 2");
+
+    static ETL_CONSTANT size_t CAPACITY = VCapacity;
+    static ETL_CONSTANT size_t BATCH    = VCapacity / 2U; ///< The number of items moved to or from the shared pool at a time.
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit pool_magazine(etl::iatomic_pool& shared_pool_)
+      : p_shared_pool(&shared_pool_)
+      , count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns the cached items to the shared pool.
+    //*************************************************************************
+    ~pool_magazine()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > p_shared_pool->item_size())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      T* p = try_allocate<T>();
+
+      if (p == ETL_NULLPTR)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Try to allocate storage for an object.
+    /// Returns a null pointer if there are no more free items or the object
+    /// is too large for the pool. Does not assert or throw.
+    //*************************************************************************
+    template <typename T>
+    T* try_allocate()
+    {
+      if (sizeof(T) > p_shared_pool->item_size())
+      {
+        return ETL_NULLPTR;
+      }
+
+      if (count == 0U)
+      {
+        count = p_shared_pool->allocate_n(items, BATCH);
+
+        if (count == 0U)
+        {
+          return ETL_NULLPTR;
+        }
+      }
+
+      return static_cast<T*>(items[--count]);
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 2 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 3 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object and create with 4 parameters.
+    //*************************************************************************
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object and create with the arguments.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object and releases its storage.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (p_object != ETL_NULLPTR)
+      {
+        p_object->~T();
+        release(p_object);
+      }
+    }
+
+    //*************************************************************************
+    /// Releases an object into the magazine.
+    /// If the magazine is full then the oldest half is first returned to the
+    /// shared pool, keeping the most recently released, and so most likely
+    /// cached, items for reuse.
+    /// If asserts or exceptions are enabled and the object does not belong to
+    /// the shared pool then an etl::pool_object_not_in_pool is thrown.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      ETL_ASSERT_AND_RETURN(p_shared_pool->is_in_pool(p_object), ETL_ERROR(pool_object_not_in_pool));
+
+      if (count == CAPACITY)
+      {
+        drain(BATCH);
+      }
+
+      items[count++] = const_cast<void*>(p_object);
+    }
+
+    //*************************************************************************
+    /// Returns all of the cached items to the shared pool.
+    //*************************************************************************
+    void flush()
+    {
+      drain(count);
+    }
+
+    //*************************************************************************
+    /// Gets the number of cached free items.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of cached free items.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no cached free items.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the magazine is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return count == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Gets the shared pool.
+    //*************************************************************************
+    etl::iatomic_pool& get_shared_pool() const
+    {
+      return *p_shared_pool;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Returns the n oldest cached items to the shared pool.
+    //*************************************************************************
+    void drain(size_t n)
+    {
+      p_shared_pool->release_n(items, n);
+
+      for (size_t i = n; i < count; ++i)
+      {
+        items[i - n] = items[i];
+      }
+
+      count -= n;
+    }
+
+    // Should not be copied.
+    pool_magazine(const pool_magazine&) ETL_DELETE;
+    pool_magazine& operator =(const pool_magazine&) ETL_DELETE;
+
+    etl::iatomic_pool* p_shared_pool;
+    size_t             count;
+    void*              items[VCapacity];
+  };
+
+  template <const size_t VCapacity>
+  ETL_CONSTANT size_t pool_magazine<VCapacity>::CAPACITY;
+
+  template <const size_t VCapacity>
+  ETL_CONSTANT size_t pool_magazine<VCapacity>::BATCH;
+}
+
+#endif
+#endif
@@ -0,0 +1,164 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_STATISTICS_INCLUDED
+#define ETL_POOL_STATISTICS_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+
+///\defgroup pool_statistics pool statistics
+/// Optional usage statistics for pools and memory block allocators, to help
+/// size them from measurements rather than guesses.
+/// Enabled by defining ETL_POOL_STATISTICS. Otherwise the counters take no
+/// space, the hooks compile to nothing, and there is no statistics() member.
+/// The counters are not synchronised; in a pool shared between threads the
+/// caller must serialise statistics() with the allocations.
+///\ingroup utilities
+
+#if defined(ETL_POOL_STATISTICS)
+
+#define ETL_DECLARE_POOL_STATISTICS        etl::pool_statistics_counter etl_pool_statistics;
+#define ETL_POOL_STATISTICS_ALLOCATED      etl_pool_statistics.allocated(1U);
+#define ETL_POOL_STATISTICS_ALLOCATED_N(n) etl_pool_statistics.allocated(n);
+#define ETL_POOL_STATISTICS_RELEASED       etl_pool_statistics.released(1U);
+#define ETL_POOL_STATISTICS_RELEASED_N(n)  etl_pool_statistics.released(n);
+#define ETL_POOL_STATISTICS_RELEASED_ALL   etl_pool_statistics.released_all();
+#define ETL_POOL_STATISTICS_FAILED         etl_pool_statistics.failed();
+
+namespace etl
+{
+  //***************************************************************************
+  /// A snapshot of the usage of a pool or allocator.
+  ///\ingroup pool_statistics
+  //***************************************************************************
+  struct pool_statistics
+  {
+    size_t size;        ///< The number of items currently allocated.
+    size_t peak_size;   ///< The largest number of items allocated at once.
+    size_t allocations; ///< The number of successful allocations.
+    size_t releases;    ///< The number of releases.
+    size_t failures;    ///< The number of allocations that could not be satisfied.
+  };
+
+  //***************************************************************************
+  /// Counts the allocations and releases of a pool or allocator.
+  ///\ingroup pool_statistics
+  //***************************************************************************
+  class pool_statistics_counter
+  {
+  public:
+
+    pool_statistics_counter()
+      : current_size(0U)
+      , peak_size(0U)
+      , allocations(0U)
+      , releases(0U)
+      , failures(0U)
+    {
+    }
+
+    void allocated(size_t n)
+    {
+      allocations  += n;
+      current_size += n;
+
+      if (current_size > peak_size)
+      {
+        peak_size = current_size;
+      }
+    }
+
+    void released(size_t n)
+    {
+      releases     += n;
+      current_size -= n;
+    }
+
+    void released_all()
+    {
+      releases += current_size;
+      current_size = 0U;
+    }
+
+    void failed()
+    {
+      ++failures;
+    }
+
+    //*************************************************************************
+    /// Gets the statistics.
+    //*************************************************************************
+    etl::pool_statistics get() const
+    {
+      etl::pool_statistics statistics;
+
+      statistics.size        = current_size;
+      statistics.peak_size   = peak_size;
+      statistics.allocations = allocations;
+      statistics.releases    = releases;
+      statistics.failures    = failures;
+
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the counts. The peak restarts from the current size.
+    //*************************************************************************
+    void reset()
+    {
+      peak_size   = current_size;
+      allocations = 0U;
+      releases    = 0U;
+      failures    = 0U;
+    }
+
+  private:
+
+    size_t current_size;
+    size_t peak_size;
+    size_t allocations;
+    size_t releases;
+    size_t failures;
+  };
+}
+
+#else
+  #define ETL_DECLARE_POOL_STATISTICS
+  #define ETL_POOL_STATISTICS_ALLOCATED
+  #define ETL_POOL_STATISTICS_ALLOCATED_N(n)
+  #define ETL_POOL_STATISTICS_RELEASED
+  #define ETL_POOL_STATISTICS_RELEASED_N(n)
+  #define ETL_POOL_STATISTICS_RELEASED_ALL
+  #define ETL_POOL_STATISTICS_FAILED
+#endif // ETL_POOL_STATISTICS
+
+#endif
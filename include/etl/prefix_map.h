@@ -0,0 +1,820 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PREFIX_MAP_INCLUDED
+#define ETL_PREFIX_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "pool.h"
+#include "optional.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "algorithm.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+//*****************************************************************************
+///\defgroup prefix_map prefix_map
+/// A fixed capacity map from bit string prefixes to values, held in a path
+/// compressed binary radix trie, with a longest prefix match query.
+/// Keys may be integers, whose bits are taken MSB first, or byte strings,
+/// any type with size() and operator[] returning a char sized element, such
+/// as etl::string_view. Each entry is a key and a prefix length in bits.
+/// A lookup visits at most one node per bit of the key, whatever the number
+/// of entries.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for prefix_map
+  ///\ingroup prefix_map
+  //***************************************************************************
+  class prefix_map_exception : public etl::exception
+  {
+  public:
+
+    prefix_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The prefix_map is full.
+  ///\ingroup prefix_map
+  //***************************************************************************
+  class prefix_map_full : public prefix_map_exception
+  {
+  public:
+
+    prefix_map_full(string_type file_name_, numeric_type line_number_)
+      : prefix_map_exception(ETL_ERROR_TEXT("prefix_map:full", ETL_PREFIX_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The prefix length is longer than the key.
+  ///\ingroup prefix_map
+  //***************************************************************************
+  class prefix_map_out_of_bounds : public prefix_map_exception
+  {
+  public:
+
+    prefix_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : prefix_map_exception(ETL_ERROR_TEXT("prefix_map:bounds", ETL_PREFIX_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Bit access for prefix_map keys.
+  /// The default is for byte strings. Bit 0 is the MSB of the first byte.
+  ///\ingroup prefix_map
+  //***************************************************************************
+  template <typename TKey, typename TEnable = void>
+  struct prefix_map_key_traits
+  {
+    //*************************************************************************
+    /// The number of bits in the key.
+    //*************************************************************************
+    static size_t bits(const TKey& key)
+    {
+      return size_t(key.size()) * 8U;
+    }
+
+    //*************************************************************************
+    /// The bit at the index.
+    //*************************************************************************
+    static size_t bit(const TKey& key, size_t index)
+    {
+      return (get_byte(key, index / 8U) >> (7U - (index % 8U))) & 1U;
+    }
+
+    //*************************************************************************
+    /// Are the bits from 'first' up to 'last' the same?
+    /// The bits before 'first' are known to be the same.
+    //*************************************************************************
+    static bool equal(const TKey& lhs, const TKey& rhs, size_t first, size_t last)
+    {
+      size_t index = first / 8U;
+
+      while (index < (last / 8U))
+      {
+        if (get_byte(lhs, index) != get_byte(rhs, index))
+        {
+          return false;
+        }
+
+        ++index;
+      }
+
+      const size_t remainder = last % 8U;
+
+      if (remainder != 0U)
+      {
+        const uint8_t mask = uint8_t(0xFFU << (8U - remainder));
+
+        return ((get_byte(lhs, index) ^ get_byte(rhs, index)) & mask) == 0U;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The index of the first bit from 'first' up to 'last' that differs,
+    /// or 'last' if they are the same.
+    /// The bits before 'first' are known to be the same.
+    //*************************************************************************
+    static size_t mismatch(const TKey& lhs, const TKey& rhs, size_t first, size_t last)
+    {
+      for (size_t index = first / 8U; (index * 8U) < last; ++index)
+      {
+        uint8_t difference = get_byte(lhs, index) ^ get_byte(rhs, index);
+
+        if (difference != 0U)
+        {
+          size_t position = index * 8U;
+
+          while ((difference & 0x80U) == 0U)
+          {
+            difference = uint8_t(difference << 1U);
+            ++position;
+          }
+
+          return etl::min(position, last);
+        }
+      }
+
+      return last;
+    }
+
+  private:
+
+    static uint8_t get_byte(const TKey& key, size_t index)
+    {
+      return uint8_t(key[index]);
+    }
+  };
+
+  //***************************************************************************
+  /// Bit access for integral prefix_map keys.
+  /// Bit 0 is the MSB.
+  ///\ingroup prefix_map
+  //***************************************************************************
+  template <typename TKey>
+  struct prefix_map_key_traits<TKey, typename etl::enable_if<etl::is_integral<TKey>::value>::type>
+  {
+    typedef typename etl::make_unsigned<TKey>::type unsigned_t;
+
+    static ETL_CONSTANT size_t Bits = etl::integral_limits<unsigned_t>::bits;
+
+    //*************************************************************************
+    /// The number of bits in the key.
+    //*************************************************************************
+    static size_t bits(TKey)
+    {
+      return Bits;
+    }
+
+    //*************************************************************************
+    /// The bit at the index.
+    //*************************************************************************
+    static size_t bit(TKey key, size_t index)
+    {
+      return size_t(unsigned_t(key) >> (Bits - 1U - index)) & 1U;
+    }
+
+    //*************************************************************************
+    /// Are the bits up to 'last' the same?
+    //*************************************************************************
+    static bool equal(TKey lhs, TKey rhs, size_t /*first*/, size_t last)
+    {
+      if (last == 0U)
+      {
+        return true;
+      }
+
+      const unsigned_t mask = unsigned_t(~(unsigned_t(~unsigned_t(0)) >> (last - 1U) >> 1U));
+
+      return ((unsigned_t(lhs) ^ unsigned_t(rhs)) & mask) == 0U;
+    }
+
+    //*************************************************************************
+    /// The index of the first bit from 'first' up to 'last' that differs,
+    /// or 'last' if they are the same.
+    //*************************************************************************
+    static size_t mismatch(TKey lhs, TKey rhs, size_t first, size_t last)
+    {
+      const unsigned_t difference = unsigned_t(lhs) ^ unsigned_t(rhs);
+
+      while ((first < last) && (((difference >> (Bits - 1U - first)) & 1U) == 0U))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup prefix_map
+  /// The base of all prefix_maps of a key and value type.
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyTraits = etl::prefix_map_key_traits<TKey> >
+  class iprefix_map
+  {
+  public:
+
+    typedef TKey       key_type;
+    typedef TValue     mapped_type;
+    typedef TKeyTraits key_traits;
+    typedef size_t     size_type;
+
+    //*************************************************************************
+    /// Inserts a value for the whole key.
+    /// \return <b>true</b> if inserted, <b>false</b> if the key already has a value.
+    /// If asserts or exceptions are enabled, emits prefix_map_full if there is no room.
+    //*************************************************************************
+    bool insert(const TKey& key, const TValue& value)
+    {
+      return insert(key, TKeyTraits::bits(key), value);
+    }
+
+    //*************************************************************************
+    /// Inserts a value for the first 'length' bits of the key.
+    /// \return <b>true</b> if inserted, <b>false</b> if the prefix already has a value.
+    /// If asserts or exceptions are enabled, emits prefix_map_full if there is no room,
+    /// or prefix_map_out_of_bounds if the length is longer than the key.
+    //*************************************************************************
+    bool insert(const TKey& key, size_t length, const TValue& value)
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(length <= TKeyTraits::bits(key), ETL_ERROR(prefix_map_out_of_bounds), false);
+
+      node_t** p_link = &p_root;
+      size_t   checked = 0U;
+
+      while (*p_link != ETL_NULLPTR)
+      {
+        node_t* p_node = *p_link;
+
+        const size_t common = TKeyTraits::mismatch(p_node->key, key, checked, etl::min(p_node->length, length));
+
+        if (common < p_node->length)
+        {
+          // The node is not a prefix of the key, so the key goes above it.
+          ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(prefix_map_full), false);
+
+          if (common == length)
+          {
+            // The key is a prefix of the node.
+            node_t* p_new = create_node(key, length, value);
+            p_new->child[TKeyTraits::bit(p_node->key, length)] = p_node;
+            *p_link = p_new;
+          }
+          else
+          {
+            // They part at 'common'.
+            node_t* p_branch = create_node(key, common);
+            node_t* p_new    = create_node(key, length, value);
+            p_branch->child[TKeyTraits::bit(p_node->key, common)] = p_node;
+            p_branch->child[TKeyTraits::bit(key, common)]         = p_new;
+            *p_link = p_branch;
+          }
+
+          return true;
+        }
+
+        if (p_node->length == length)
+        {
+          if (p_node->value.has_value())
+          {
+            return false;
+          }
+
+          // A branch becomes an entry.
+          ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(prefix_map_full), false);
+
+          p_node->value = value;
+          ++entry_count;
+
+          return true;
+        }
+
+        checked = p_node->length;
+        p_link  = &p_node->child[TKeyTraits::bit(key, p_node->length)];
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(prefix_map_full), false);
+
+      *p_link = create_node(key, length, value);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Finds the value for the whole key.
+    /// \return A pointer to the value, or ETL_NULLPTR if not found.
+    //*************************************************************************
+    TValue* find(const TKey& key)
+    {
+      return find(key, TKeyTraits::bits(key));
+    }
+
+    //*************************************************************************
+    /// Finds the value for the whole key.
+    /// \return A pointer to the value, or ETL_NULLPTR if not found.
+    //*************************************************************************
+    const TValue* find(const TKey& key) const
+    {
+      return find(key, TKeyTraits::bits(key));
+    }
+
+    //*************************************************************************
+    /// Finds the value for the first 'length' bits of the key.
+    /// \return A pointer to the value, or ETL_NULLPTR if not found.
+    //*************************************************************************
+    TValue* find(const TKey& key, size_t length)
+    {
+      node_t* p_node = find_node(key, length);
+
+      return ((p_node != ETL_NULLPTR) && p_node->value.has_value()) ? &p_node->value.value() : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the value for the first 'length' bits of the key.
+    /// \return A pointer to the value, or ETL_NULLPTR if not found.
+    //*************************************************************************
+    const TValue* find(const TKey& key, size_t length) const
+    {
+      const node_t* p_node = find_node(key, length);
+
+      return ((p_node != ETL_NULLPTR) && p_node->value.has_value()) ? &p_node->value.value() : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Is there a value for the whole key?
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Is there a value for the first 'length' bits of the key?
+    //*************************************************************************
+    bool contains(const TKey& key, size_t length) const
+    {
+      return find(key, length) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest prefix of the key.
+    /// \return A pointer to the value, or ETL_NULLPTR if no prefix matches.
+    //*************************************************************************
+    TValue* longest_prefix_match(const TKey& key)
+    {
+      node_t* p_match = longest_match_node(key);
+
+      return (p_match != ETL_NULLPTR) ? &p_match->value.value() : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the value of the longest prefix of the key.
+    /// \return A pointer to the value, or ETL_NULLPTR if no prefix matches.
+    //*************************************************************************
+    const TValue* longest_prefix_match(const TKey& key) const
+    {
+      const node_t* p_match = longest_match_node(key);
+
+      return (p_match != ETL_NULLPTR) ? &p_match->value.value() : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Calls the function with the value of every prefix of the key,
+    /// shortest first.
+    /// \return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_match(const TKey& key, TFunction function)
+    {
+      const size_t length = TKeyTraits::bits(key);
+
+      node_t* p_node  = p_root;
+      size_t  checked = 0U;
+
+      while ((p_node != ETL_NULLPTR) && (p_node->length <= length) && TKeyTraits::equal(p_node->key, key, checked, p_node->length))
+      {
+        if (p_node->value.has_value())
+        {
+          function(p_node->value.value());
+        }
+
+        if (p_node->length == length)
+        {
+          break;
+        }
+
+        checked = p_node->length;
+        p_node  = p_node->child[TKeyTraits::bit(key, p_node->length)];
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Erases the value for the whole key.
+    /// \return The number of values erased.
+    //*************************************************************************
+    size_t erase(const TKey& key)
+    {
+      return erase(key, TKeyTraits::bits(key));
+    }
+
+    //*************************************************************************
+    /// Erases the value for the first 'length' bits of the key.
+    /// \return The number of values erased.
+    //*************************************************************************
+    size_t erase(const TKey& key, size_t length)
+    {
+      node_t** p_link        = &p_root;
+      node_t** p_parent_link = ETL_NULLPTR;
+      size_t   checked       = 0U;
+
+      while ((*p_link != ETL_NULLPTR) && ((*p_link)->length < length))
+      {
+        node_t* p_node = *p_link;
+
+        if (!TKeyTraits::equal(p_node->key, key, checked, p_node->length))
+        {
+          return 0U;
+        }
+
+        checked       = p_node->length;
+        p_parent_link = p_link;
+        p_link        = &p_node->child[TKeyTraits::bit(key, p_node->length)];
+      }
+
+      node_t* p_node = *p_link;
+
+      if ((p_node == ETL_NULLPTR) ||
+          (p_node->length != length) ||
+          !p_node->value.has_value() ||
+          !TKeyTraits::equal(p_node->key, key, checked, length))
+      {
+        return 0U;
+      }
+
+      p_node->value.reset();
+      --entry_count;
+
+      // A node with two children stays as a branch.
+      if ((p_node->child[0] != ETL_NULLPTR) && (p_node->child[1] != ETL_NULLPTR))
+      {
+        return 1U;
+      }
+
+      node_t* p_child = (p_node->child[0] != ETL_NULLPTR) ? p_node->child[0] : p_node->child[1];
+
+      *p_link = p_child;
+      node_pool.destroy(p_node);
+
+      // A branch left with one child is no longer needed.
+      if ((p_child == ETL_NULLPTR) && (p_parent_link != ETL_NULLPTR))
+      {
+        node_t* p_parent = *p_parent_link;
+
+        if (!p_parent->value.has_value())
+        {
+          *p_parent_link = (p_parent->child[0] != ETL_NULLPTR) ? p_parent->child[0] : p_parent->child[1];
+          node_pool.destroy(p_parent);
+        }
+      }
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_tree(p_root);
+      p_root      = ETL_NULLPTR;
+      entry_count = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of values.
+    //*************************************************************************
+    size_t size() const
+    {
+      return entry_count;
+    }
+
+    //*************************************************************************
+    /// Are there no values?
+    //*************************************************************************
+    bool empty() const
+    {
+      return entry_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Is there no room for another value?
+    //*************************************************************************
+    bool full() const
+    {
+      return entry_count == Max_Size;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// The number of values that may be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - entry_count;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A trie node. It holds its whole prefix, as the first 'length' bits
+    /// of 'key'. Nodes without a value always have two children.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t(const TKey& key_, size_t length_)
+        : key(key_),
+          length(length_),
+          value()
+      {
+        child[0] = ETL_NULLPTR;
+        child[1] = ETL_NULLPTR;
+      }
+
+      TKey                  key;
+      size_t                length;
+      etl::optional<TValue> value;
+      node_t*               child[2];
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iprefix_map(etl::ipool& node_pool_, size_t max_size_)
+      : node_pool(node_pool_),
+        p_root(ETL_NULLPTR),
+        entry_count(0U),
+        Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~iprefix_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the values from another prefix_map.
+    //*************************************************************************
+    void assign(const iprefix_map& other)
+    {
+      if (&other != this)
+      {
+        clear();
+        copy_tree(other.p_root);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Creates a branch node.
+    //*************************************************************************
+    node_t* create_node(const TKey& key, size_t length)
+    {
+      return node_pool.template create<node_t>(key, length);
+    }
+
+    //*************************************************************************
+    /// Creates an entry node.
+    //*************************************************************************
+    node_t* create_node(const TKey& key, size_t length, const TValue& value)
+    {
+      node_t* p_node = create_node(key, length);
+      p_node->value = value;
+      ++entry_count;
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Finds the node for the first 'length' bits of the key.
+    //*************************************************************************
+    node_t* find_node(const TKey& key, size_t length) const
+    {
+      ETL_ASSERT_AND_RETURN_VALUE(length <= TKeyTraits::bits(key), ETL_ERROR(prefix_map_out_of_bounds), ETL_NULLPTR);
+
+      node_t* p_node  = p_root;
+      size_t  checked = 0U;
+
+      while ((p_node != ETL_NULLPTR) && (p_node->length <= length))
+      {
+        if (!TKeyTraits::equal(p_node->key, key, checked, p_node->length))
+        {
+          return ETL_NULLPTR;
+        }
+
+        if (p_node->length == length)
+        {
+          return p_node;
+        }
+
+        checked = p_node->length;
+        p_node  = p_node->child[TKeyTraits::bit(key, p_node->length)];
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Finds the node with the longest prefix of the key that has a value.
+    //*************************************************************************
+    node_t* longest_match_node(const TKey& key) const
+    {
+      const size_t length = TKeyTraits::bits(key);
+
+      node_t* p_match = ETL_NULLPTR;
+      node_t* p_node  = p_root;
+      size_t  checked = 0U;
+
+      while ((p_node != ETL_NULLPTR) && (p_node->length <= length) && TKeyTraits::equal(p_node->key, key, checked, p_node->length))
+      {
+        if (p_node->value.has_value())
+        {
+          p_match = p_node;
+        }
+
+        if (p_node->length == length)
+        {
+          break;
+        }
+
+        checked = p_node->length;
+        p_node  = p_node->child[TKeyTraits::bit(key, p_node->length)];
+      }
+
+      return p_match;
+    }
+
+    //*************************************************************************
+    /// Destroys the node and the nodes below it.
+    //*************************************************************************
+    void destroy_tree(node_t* p_node)
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        destroy_tree(p_node->child[0]);
+        destroy_tree(p_node->child[1]);
+        node_pool.destroy(p_node);
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts the values of the node and the nodes below it.
+    //*************************************************************************
+    void copy_tree(const node_t* p_node)
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        if (p_node->value.has_value())
+        {
+          insert(p_node->key, p_node->length, p_node->value.value());
+        }
+
+        copy_tree(p_node->child[0]);
+        copy_tree(p_node->child[1]);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iprefix_map(const iprefix_map&);
+    iprefix_map& operator =(const iprefix_map&);
+
+    etl::ipool&  node_pool;
+    node_t*      p_root;
+    size_t       entry_count;
+    const size_t Max_Size;
+  };
+
+  //***************************************************************************
+  ///\ingroup prefix_map
+  /// A prefix_map with capacity for VSize values.
+  /// \tparam TKey       The key type. An integral type or a byte string.
+  /// \tparam TValue     The value type.
+  /// \tparam VSize      The maximum number of values.
+  /// \tparam TKeyTraits The bit access for the key.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t VSize, typename TKeyTraits = etl::prefix_map_key_traits<TKey> >
+  class prefix_map : public etl::iprefix_map<TKey, TValue, TKeyTraits>
+  {
+    typedef etl::iprefix_map<TKey, TValue, TKeyTraits> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VSize > 0U), "Zero capacity prefix_map is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    prefix_map()
+      : base_t(node_pool, VSize)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    prefix_map(const prefix_map& other)
+      : base_t(node_pool, VSize)
+    {
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~prefix_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    prefix_map& operator =(const prefix_map& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    // Each value adds at most one branch node.
+    etl::pool<typename base_t::node_t, VSize * 2U> node_pool;
+  };
+
+  template <typename TKey, typename TValue, const size_t VSize, typename TKeyTraits>
+  ETL_CONSTANT size_t prefix_map<TKey, TValue, VSize, TKeyTraits>::MAX_SIZE;
+}
+
+#endif
@@ -44,6 +44,8 @@ SOFTWARE.
 #include "parameter_type.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "iterator.h"
+#include "static_assert.h"
 
 //*****************************************************************************
 ///\defgroup queue queue
@@ -96,6 +98,153 @@ namespace etl
     }
   };
 
+  namespace private_priority_queue
+  {
+    //*************************************************************************
+    /// Heap operations for a heap where each node has ARITY children.
+    //*************************************************************************
+    template <const size_t ARITY>
+    struct heap
+    {
+      ETL_STATIC_ASSERT(ARITY >= 2U, "A heap needs at least two children per node");
+
+      //***********************************************************************
+      /// Moves the value at index towards the top until its parent does not compare less.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void sift_up(TIterator first, size_t index, TCompare compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+        value_t value = private_algorithm::move_or_copy(first[index]);
+
+        while (index > 0U)
+        {
+          const size_t parent = (index - 1U) / ARITY;
+
+          if (!compare(first[parent], value))
+          {
+            break;
+          }
+
+          first[index] = private_algorithm::move_or_copy(first[parent]);
+          index = parent;
+        }
+
+        first[index] = private_algorithm::move_or_copy(value);
+      }
+
+      //***********************************************************************
+      /// Moves the value at index away from the top until no child compares greater.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void sift_down(TIterator first, size_t index, size_t length, TCompare compare)
+      {
+        typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+        value_t value = private_algorithm::move_or_copy(first[index]);
+
+        while (true)
+        {
+          const size_t first_child = (index * ARITY) + 1U;
+
+          if (first_child >= length)
+          {
+            break;
+          }
+
+          const size_t last_child = etl::min(first_child + ARITY, length);
+          size_t best = first_child;
+
+          for (size_t child = first_child + 1U; child < last_child; ++child)
+          {
+            if (compare(first[best], first[child]))
+            {
+              best = child;
+            }
+          }
+
+          if (!compare(value, first[best]))
+          {
+            break;
+          }
+
+          first[index] = private_algorithm::move_or_copy(first[best]);
+          index = best;
+        }
+
+        first[index] = private_algorithm::move_or_copy(value);
+      }
+
+      //***********************************************************************
+      /// Adds the value at last - 1 to the heap [first, last - 1).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        sift_up(first, size_t(last - first) - 1U, compare);
+      }
+
+      //***********************************************************************
+      /// Moves the top of the heap to last - 1 and restores the heap [first, last - 1).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        const size_t length = size_t(last - first);
+
+        if (length > 1U)
+        {
+          using ETL_OR_STD::swap; // Allow ADL
+          swap(first[0], first[length - 1U]);
+          sift_down(first, 0U, length - 1U, compare);
+        }
+      }
+
+      //***********************************************************************
+      /// Makes a heap from [first, last).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        const size_t length = size_t(last - first);
+
+        if (length > 1U)
+        {
+          for (size_t parent = ((length - 2U) / ARITY) + 1U; parent-- > 0U;)
+          {
+            sift_down(first, parent, length, compare);
+          }
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// The binary heap uses the standard heap algorithms.
+    //*************************************************************************
+    template <>
+    struct heap<2U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::push_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::pop_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        etl::make_heap(first, last, compare);
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup queue
   ///\brief This is the base for all priority queues that contain a particular type.
@@ -111,10 +260,17 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam ARITY The number of children of each node in the heap.
+  /// A 4-ary heap is shallower than a binary heap and its children share
+  /// cache lines, which makes pop faster for large queues.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare = etl::less<T> >
+  template <typename T, typename TContainer, typename TCompare = etl::less<T>, const size_t ARITY = 2U>
   class ipriority_queue
   {
+  private:
+
+    typedef etl::private_priority_queue::heap<ARITY> heap_type;
+
   public:
 
     typedef T                     value_type;         ///< The type stored in the queue.
@@ -159,7 +315,7 @@ namespace etl
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -176,7 +332,7 @@ namespace etl
       // Put element at end
       container.push_back(etl::move(value));
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -195,7 +351,7 @@ namespace etl
       // Put element at end
       container.emplace_back(etl::forward<Args>(args)...);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #else
     //*************************************************************************
@@ -212,7 +368,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -229,7 +385,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -246,7 +402,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -263,7 +419,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      heap_type::push(container.begin(), container.end(), compare);
     }
 #endif
 
@@ -287,7 +443,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      etl::make_heap(container.begin(), container.end(), compare);
+      heap_type::make(container.begin(), container.end(), compare);
     }
 
     //*************************************************************************
@@ -297,7 +453,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      etl::pop_heap(container.begin(), container.end(), compare);
+      heap_type::pop(container.begin(), container.end(), compare);
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -411,9 +567,10 @@ namespace etl
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam ARITY The number of children of each node in the heap. Default 2.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type>, const size_t ARITY = 2U>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, ARITY>
   {
   public:
 
@@ -426,7 +583,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
     }
 
@@ -434,9 +591,9 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -444,9 +601,9 @@ namespace etl
     /// Move constructor
     //*************************************************************************
     priority_queue(priority_queue&& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move(etl::move(rhs));
     }
 #endif
 
@@ -458,9 +615,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::assign(first, last);
     }
 
     //*************************************************************************
@@ -468,7 +625,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clear();
     }
 
     //*************************************************************************
@@ -478,7 +635,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
       }
 
       return *this;
@@ -492,7 +649,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move(etl::move(rhs));
       }
 
       return *this;
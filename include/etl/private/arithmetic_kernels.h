@@ -0,0 +1,956 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARITHMETIC_KERNELS_INCLUDED
+#define ETL_ARITHMETIC_KERNELS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "minmax_push.h"
+
+//*****************************************************************************
+// find, count, min/max and sum kernels for contiguous ranges of arithmetic
+// types, used by the algorithms when the iterators are pointers.
+// They process 16 bytes at a time with SSE2 or NEON when the compiler
+// reports that the target supports them, unless ETL_ARITHMETIC_NO_SIMD is
+// defined.
+// SSE2 covers 8, 16, 32 and 64 bit integers, float and double. 64 bit
+// integers have no min or max. NEON covers 8, 16 and 32 bit integers and float.
+//*****************************************************************************
+#if !defined(ETL_ARITHMETIC_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_ARITHMETIC_SIMD_SSE2 1
+#else
+  #define ETL_ARITHMETIC_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_ARITHMETIC_NO_SIMD) && !ETL_ARITHMETIC_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+  #define ETL_ARITHMETIC_SIMD_NEON 1
+#else
+  #define ETL_ARITHMETIC_SIMD_NEON 0
+#endif
+
+#define ETL_ARITHMETIC_SIMD (ETL_ARITHMETIC_SIMD_SSE2 || ETL_ARITHMETIC_SIMD_NEON)
+
+#if ETL_ARITHMETIC_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_ARITHMETIC_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+//*****************************************************************************
+// The sum kernel is not usable in a constant expression, so it is only used
+// where the compiler can tell whether it is being constant evaluated.
+//*****************************************************************************
+#if ETL_CPP14_SUPPORTED && !defined(ETL_FORCE_NO_ADVANCED_CPP)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+      #define ETL_ARITHMETIC_SIMD_SUM 1
+    #endif
+  #endif
+#else
+  #define ETL_ARITHMETIC_SIMD_SUM 1
+#endif
+
+#if !defined(ETL_ARITHMETIC_SIMD_SUM)
+  #define ETL_ARITHMETIC_SIMD_SUM 0
+#endif
+
+namespace etl
+{
+  namespace private_arithmetic
+  {
+    //*************************************************************************
+    /// The fixed width type that the kernels use for T, or void if there is
+    /// none. Integral types map to the integer of the same size and
+    /// signedness.
+    //*************************************************************************
+    template <typename T,
+              bool Is_Integral = etl::is_integral<T>::value && !etl::is_same<T, bool>::value,
+              bool Is_Signed   = etl::is_signed<T>::value,
+              size_t Size      = sizeof(T)>
+    struct canonical
+    {
+      typedef void type;
+    };
+
+    template <typename T> struct canonical<T, true, true,  1U> { typedef int8_t   type; };
+    template <typename T> struct canonical<T, true, false, 1U> { typedef uint8_t  type; };
+    template <typename T> struct canonical<T, true, true,  2U> { typedef int16_t  type; };
+    template <typename T> struct canonical<T, true, false, 2U> { typedef uint16_t type; };
+    template <typename T> struct canonical<T, true, true,  4U> { typedef int32_t  type; };
+    template <typename T> struct canonical<T, true, false, 4U> { typedef uint32_t type; };
+#if ETL_USING_64BIT_TYPES
+    template <typename T> struct canonical<T, true, true,  8U> { typedef int64_t  type; };
+    template <typename T> struct canonical<T, true, false, 8U> { typedef uint64_t type; };
+#endif
+    template <> struct canonical<float,  false, true, sizeof(float)>  { typedef float  type; };
+    template <> struct canonical<double, false, true, sizeof(double)> { typedef double type; };
+
+    //*************************************************************************
+    /// The vector operations for each type.
+    /// Specialisations set Supported, and Has_Min_Max and Has_Add where the
+    /// operations exist.
+    //*************************************************************************
+    template <typename T>
+    struct simd
+    {
+      enum
+      {
+        Supported   = 0,
+        Has_Min_Max = 0,
+        Has_Add     = 0
+      };
+    };
+
+#if ETL_ARITHMETIC_SIMD_SSE2
+    // _mm_movemask_epi8 gives one bit per byte.
+    static const size_t Mask_Bits_Per_Byte = 1U;
+
+    //*************************************************************************
+    /// Selects a where the mask is set, otherwise b.
+    //*************************************************************************
+    inline __m128i sse2_select(__m128i mask, __m128i a, __m128i b)
+    {
+      return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    //*************************************************************************
+    /// The operations common to all of the integer types.
+    //*************************************************************************
+    template <typename T, typename TCounterLane>
+    struct sse2_integer
+    {
+      typedef __m128i      vector_type;
+      typedef __m128i      mask_type;
+      typedef __m128i      counter_type;
+      typedef TCounterLane counter_lane_type;
+
+      enum
+      {
+        Supported = 1,
+        Lanes     = 16 / sizeof(T),
+        Has_Add   = 1
+      };
+
+      static vector_type load(const void* p)
+      {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+      }
+
+      static void store(T* p, vector_type v)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+      }
+
+      static void store_counter(counter_lane_type* p, counter_type c)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), c);
+      }
+
+      static uint64_t byte_mask(mask_type m)
+      {
+        return uint64_t(uint32_t(_mm_movemask_epi8(m)));
+      }
+
+      static counter_type counter_zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static mask_type nan_zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static mask_type nan_accumulate(mask_type nans, vector_type)
+      {
+        return nans;
+      }
+
+      static bool any_nan(mask_type)
+      {
+        return false;
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int8_t> : public sse2_integer<int8_t, uint8_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 255 };
+
+      static vector_type splat(int8_t v)                     { return _mm_set1_epi8(char(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi8(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi8(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi8(c, m); }
+
+      // Biased to unsigned, for the unsigned byte min and max.
+      static vector_type min(vector_type a, vector_type b)
+      {
+        const __m128i bias = _mm_set1_epi8(char(0x80));
+        return _mm_xor_si128(_mm_min_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      }
+
+      static vector_type max(vector_type a, vector_type b)
+      {
+        const __m128i bias = _mm_set1_epi8(char(0x80));
+        return _mm_xor_si128(_mm_max_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint8_t> : public sse2_integer<uint8_t, uint8_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 255 };
+
+      static vector_type splat(uint8_t v)                    { return _mm_set1_epi8(char(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi8(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi8(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return _mm_min_epu8(a, b); }
+      static vector_type max(vector_type a, vector_type b)   { return _mm_max_epu8(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi8(c, m); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int16_t> : public sse2_integer<int16_t, uint16_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 65535 };
+
+      static vector_type splat(int16_t v)                    { return _mm_set1_epi16(short(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi16(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi16(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return _mm_min_epi16(a, b); }
+      static vector_type max(vector_type a, vector_type b)   { return _mm_max_epi16(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi16(c, m); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint16_t> : public sse2_integer<uint16_t, uint16_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 65535 };
+
+      static vector_type splat(uint16_t v)                   { return _mm_set1_epi16(short(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi16(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi16(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi16(c, m); }
+
+      // Biased to signed, for the signed 16 bit min and max.
+      static vector_type min(vector_type a, vector_type b)
+      {
+        const __m128i bias = _mm_set1_epi16(short(0x8000));
+        return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      }
+
+      static vector_type max(vector_type a, vector_type b)
+      {
+        const __m128i bias = _mm_set1_epi16(short(0x8000));
+        return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int32_t> : public sse2_integer<int32_t, uint32_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 0x7FFFFFFF };
+
+      static vector_type splat(int32_t v)                    { return _mm_set1_epi32(v); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi32(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return sse2_select(_mm_cmpgt_epi32(a, b), b, a); }
+      static vector_type max(vector_type a, vector_type b)   { return sse2_select(_mm_cmpgt_epi32(a, b), a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi32(c, m); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint32_t> : public sse2_integer<uint32_t, uint32_t>
+    {
+      enum { Has_Min_Max = 1, Count_Flush = 0x7FFFFFFF };
+
+      static vector_type splat(uint32_t v)                   { return _mm_set1_epi32(int(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_epi32(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return sse2_select(greater(a, b), b, a); }
+      static vector_type max(vector_type a, vector_type b)   { return sse2_select(greater(a, b), a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi32(c, m); }
+
+      // Biased to signed, for the signed compare.
+      static mask_type greater(vector_type a, vector_type b)
+      {
+        const __m128i bias = _mm_set1_epi32(int(0x80000000U));
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+      }
+    };
+
+  #if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// 64 bit equality from two 32 bit halves.
+    //*************************************************************************
+    inline __m128i sse2_equal_64(__m128i a, __m128i b)
+    {
+      const __m128i halves = _mm_cmpeq_epi32(a, b);
+      return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    //*************************************************************************
+    template <>
+    struct simd<int64_t> : public sse2_integer<int64_t, uint64_t>
+    {
+      enum { Has_Min_Max = 0, Count_Flush = 0x7FFFFFFF };
+
+      static vector_type splat(int64_t v)                    { return _mm_set1_epi64x(v); }
+      static mask_type   equal(vector_type a, vector_type b) { return sse2_equal_64(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi64(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi64(c, m); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint64_t> : public sse2_integer<uint64_t, uint64_t>
+    {
+      enum { Has_Min_Max = 0, Count_Flush = 0x7FFFFFFF };
+
+      static vector_type splat(uint64_t v)                   { return _mm_set1_epi64x(int64_t(v)); }
+      static mask_type   equal(vector_type a, vector_type b) { return sse2_equal_64(a, b); }
+      static vector_type add(vector_type a, vector_type b)   { return _mm_add_epi64(a, b); }
+
+      static counter_type count_step(counter_type c, mask_type m) { return _mm_sub_epi64(c, m); }
+    };
+  #endif
+
+    //*************************************************************************
+    template <>
+    struct simd<float>
+    {
+      typedef __m128   vector_type;
+      typedef __m128   mask_type;
+      typedef __m128i  counter_type;
+      typedef uint32_t counter_lane_type;
+
+      enum
+      {
+        Supported   = 1,
+        Lanes       = 4,
+        Has_Min_Max = 1,
+        Has_Add     = 0,
+        Count_Flush = 0x7FFFFFFF
+      };
+
+      static vector_type load(const void* p)                 { return _mm_loadu_ps(static_cast<const float*>(p)); }
+      static void        store(float* p, vector_type v)      { _mm_storeu_ps(p, v); }
+      static vector_type splat(float v)                      { return _mm_set1_ps(v); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_ps(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return _mm_min_ps(a, b); }
+      static vector_type max(vector_type a, vector_type b)   { return _mm_max_ps(a, b); }
+      static uint64_t    byte_mask(mask_type m)              { return uint64_t(uint32_t(_mm_movemask_epi8(_mm_castps_si128(m)))); }
+
+      static counter_type counter_zero()                                          { return _mm_setzero_si128(); }
+      static counter_type count_step(counter_type c, mask_type m)                 { return _mm_sub_epi32(c, _mm_castps_si128(m)); }
+      static void         store_counter(counter_lane_type* p, counter_type c)     { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), c); }
+
+      static mask_type nan_zero()                                  { return _mm_setzero_ps(); }
+      static mask_type nan_accumulate(mask_type nans, vector_type v) { return _mm_or_ps(nans, _mm_cmpunord_ps(v, v)); }
+      static bool      any_nan(mask_type nans)                     { return _mm_movemask_ps(nans) != 0; }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<double>
+    {
+      typedef __m128d  vector_type;
+      typedef __m128d  mask_type;
+      typedef __m128i  counter_type;
+      typedef uint64_t counter_lane_type;
+
+      enum
+      {
+        Supported   = 1,
+        Lanes       = 2,
+        Has_Min_Max = 1,
+        Has_Add     = 0,
+        Count_Flush = 0x7FFFFFFF
+      };
+
+      static vector_type load(const void* p)                 { return _mm_loadu_pd(static_cast<const double*>(p)); }
+      static void        store(double* p, vector_type v)     { _mm_storeu_pd(p, v); }
+      static vector_type splat(double v)                     { return _mm_set1_pd(v); }
+      static mask_type   equal(vector_type a, vector_type b) { return _mm_cmpeq_pd(a, b); }
+      static vector_type min(vector_type a, vector_type b)   { return _mm_min_pd(a, b); }
+      static vector_type max(vector_type a, vector_type b)   { return _mm_max_pd(a, b); }
+      static uint64_t    byte_mask(mask_type m)              { return uint64_t(uint32_t(_mm_movemask_epi8(_mm_castpd_si128(m)))); }
+
+      static counter_type counter_zero()                                          { return _mm_setzero_si128(); }
+      static counter_type count_step(counter_type c, mask_type m)                 { return _mm_sub_epi64(c, _mm_castpd_si128(m)); }
+      static void         store_counter(counter_lane_type* p, counter_type c)     { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), c); }
+
+      static mask_type nan_zero()                                  { return _mm_setzero_pd(); }
+      static mask_type nan_accumulate(mask_type nans, vector_type v) { return _mm_or_pd(nans, _mm_cmpunord_pd(v, v)); }
+      static bool      any_nan(mask_type nans)                     { return _mm_movemask_pd(nans) != 0; }
+    };
+#endif
+
+#if ETL_ARITHMETIC_SIMD_NEON
+    // The narrowing shift gives four bits per byte.
+    static const size_t Mask_Bits_Per_Byte = 4U;
+
+    //*************************************************************************
+    /// Four bits per byte, set where the byte of the mask is set.
+    //*************************************************************************
+    inline uint64_t neon_byte_mask(uint8x16_t m)
+    {
+      const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(m), 4);
+
+      return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    //*************************************************************************
+    /// The operations common to all of the integer types.
+    //*************************************************************************
+    template <typename T, typename TMask>
+    struct neon_integer
+    {
+      typedef TMask mask_type;
+      typedef TMask counter_type;
+
+      enum
+      {
+        Supported   = 1,
+        Lanes       = 16 / sizeof(T),
+        Has_Min_Max = 1,
+        Has_Add     = 1
+      };
+
+      static mask_type nan_zero()
+      {
+        return mask_type();
+      }
+
+      template <typename TVector>
+      static mask_type nan_accumulate(mask_type nans, TVector)
+      {
+        return nans;
+      }
+
+      static bool any_nan(mask_type)
+      {
+        return false;
+      }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int8_t> : public neon_integer<int8_t, uint8x16_t>
+    {
+      typedef int8x16_t vector_type;
+      typedef uint8_t   counter_lane_type;
+
+      enum { Count_Flush = 255 };
+
+      static vector_type  load(const void* p)                 { return vld1q_s8(static_cast<const int8_t*>(p)); }
+      static void         store(int8_t* p, vector_type v)     { vst1q_s8(p, v); }
+      static vector_type  splat(int8_t v)                     { return vdupq_n_s8(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_s8(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_s8(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_s8(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_s8(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(m); }
+      static counter_type counter_zero()                      { return vdupq_n_u8(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u8(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u8(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint8_t> : public neon_integer<uint8_t, uint8x16_t>
+    {
+      typedef uint8x16_t vector_type;
+      typedef uint8_t    counter_lane_type;
+
+      enum { Count_Flush = 255 };
+
+      static vector_type  load(const void* p)                 { return vld1q_u8(static_cast<const uint8_t*>(p)); }
+      static void         store(uint8_t* p, vector_type v)    { vst1q_u8(p, v); }
+      static vector_type  splat(uint8_t v)                    { return vdupq_n_u8(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_u8(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_u8(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_u8(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_u8(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(m); }
+      static counter_type counter_zero()                      { return vdupq_n_u8(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u8(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u8(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int16_t> : public neon_integer<int16_t, uint16x8_t>
+    {
+      typedef int16x8_t vector_type;
+      typedef uint16_t  counter_lane_type;
+
+      enum { Count_Flush = 65535 };
+
+      static vector_type  load(const void* p)                 { return vld1q_s16(static_cast<const int16_t*>(p)); }
+      static void         store(int16_t* p, vector_type v)    { vst1q_s16(p, v); }
+      static vector_type  splat(int16_t v)                    { return vdupq_n_s16(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_s16(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_s16(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_s16(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_s16(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(vreinterpretq_u8_u16(m)); }
+      static counter_type counter_zero()                      { return vdupq_n_u16(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u16(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u16(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint16_t> : public neon_integer<uint16_t, uint16x8_t>
+    {
+      typedef uint16x8_t vector_type;
+      typedef uint16_t   counter_lane_type;
+
+      enum { Count_Flush = 65535 };
+
+      static vector_type  load(const void* p)                 { return vld1q_u16(static_cast<const uint16_t*>(p)); }
+      static void         store(uint16_t* p, vector_type v)   { vst1q_u16(p, v); }
+      static vector_type  splat(uint16_t v)                   { return vdupq_n_u16(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_u16(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_u16(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_u16(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_u16(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(vreinterpretq_u8_u16(m)); }
+      static counter_type counter_zero()                      { return vdupq_n_u16(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u16(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u16(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<int32_t> : public neon_integer<int32_t, uint32x4_t>
+    {
+      typedef int32x4_t vector_type;
+      typedef uint32_t  counter_lane_type;
+
+      enum { Count_Flush = 0x7FFFFFFF };
+
+      static vector_type  load(const void* p)                 { return vld1q_s32(static_cast<const int32_t*>(p)); }
+      static void         store(int32_t* p, vector_type v)    { vst1q_s32(p, v); }
+      static vector_type  splat(int32_t v)                    { return vdupq_n_s32(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_s32(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_s32(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_s32(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_s32(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(vreinterpretq_u8_u32(m)); }
+      static counter_type counter_zero()                      { return vdupq_n_u32(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u32(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u32(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<uint32_t> : public neon_integer<uint32_t, uint32x4_t>
+    {
+      typedef uint32x4_t vector_type;
+      typedef uint32_t   counter_lane_type;
+
+      enum { Count_Flush = 0x7FFFFFFF };
+
+      static vector_type  load(const void* p)                 { return vld1q_u32(static_cast<const uint32_t*>(p)); }
+      static void         store(uint32_t* p, vector_type v)   { vst1q_u32(p, v); }
+      static vector_type  splat(uint32_t v)                   { return vdupq_n_u32(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_u32(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_u32(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_u32(a, b); }
+      static vector_type  add(vector_type a, vector_type b)   { return vaddq_u32(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(vreinterpretq_u8_u32(m)); }
+      static counter_type counter_zero()                      { return vdupq_n_u32(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u32(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u32(p, c); }
+    };
+
+    //*************************************************************************
+    template <>
+    struct simd<float>
+    {
+      typedef float32x4_t vector_type;
+      typedef uint32x4_t  mask_type;
+      typedef uint32x4_t  counter_type;
+      typedef uint32_t    counter_lane_type;
+
+      enum
+      {
+        Supported   = 1,
+        Lanes       = 4,
+        Has_Min_Max = 1,
+        Has_Add     = 0,
+        Count_Flush = 0x7FFFFFFF
+      };
+
+      static vector_type  load(const void* p)                 { return vld1q_f32(static_cast<const float*>(p)); }
+      static void         store(float* p, vector_type v)      { vst1q_f32(p, v); }
+      static vector_type  splat(float v)                      { return vdupq_n_f32(v); }
+      static mask_type    equal(vector_type a, vector_type b) { return vceqq_f32(a, b); }
+      static vector_type  min(vector_type a, vector_type b)   { return vminq_f32(a, b); }
+      static vector_type  max(vector_type a, vector_type b)   { return vmaxq_f32(a, b); }
+      static uint64_t     byte_mask(mask_type m)              { return neon_byte_mask(vreinterpretq_u8_u32(m)); }
+      static counter_type counter_zero()                      { return vdupq_n_u32(0U); }
+
+      static counter_type count_step(counter_type c, mask_type m)             { return vsubq_u32(c, m); }
+      static void         store_counter(counter_lane_type* p, counter_type c) { vst1q_u32(p, c); }
+
+      // A NaN is not equal to itself.
+      static mask_type nan_zero()                                  { return vdupq_n_u32(0U); }
+      static mask_type nan_accumulate(mask_type nans, vector_type v) { return vorrq_u32(nans, vmvnq_u32(vceqq_f32(v, v))); }
+      static bool      any_nan(mask_type nans)                     { return byte_mask(nans) != 0U; }
+    };
+#endif
+
+    //*************************************************************************
+    /// Whether the kernels support a range of T.
+    //*************************************************************************
+    template <typename T>
+    struct has_kernel
+    {
+      typedef simd<typename canonical<typename etl::remove_cv<T>::type>::type> ops;
+
+      static ETL_CONSTANT bool find    = (ops::Supported != 0);
+      static ETL_CONSTANT bool min_max = (ops::Supported != 0) && (ops::Has_Min_Max != 0);
+      static ETL_CONSTANT bool sum     = (ops::Supported != 0) && (ops::Has_Add != 0) && (ETL_ARITHMETIC_SIMD_SUM != 0);
+    };
+
+#if ETL_ARITHMETIC_SIMD
+    //*************************************************************************
+    /// The index of the lowest set bit. The mask must not be zero.
+    /// binary.h is not used, as it depends on algorithm.h.
+    //*************************************************************************
+    inline size_t lowest_bit(uint64_t mask)
+    {
+      size_t index = 0U;
+
+      if ((mask & 0xFFFFFFFFU) == 0U) { mask >>= 32U; index += 32U; }
+      if ((mask & 0xFFFFU)     == 0U) { mask >>= 16U; index += 16U; }
+      if ((mask & 0xFFU)       == 0U) { mask >>= 8U;  index += 8U;  }
+      if ((mask & 0xFU)        == 0U) { mask >>= 4U;  index += 4U;  }
+      if ((mask & 0x3U)        == 0U) { mask >>= 2U;  index += 2U;  }
+      if ((mask & 0x1U)        == 0U) {               index += 1U;  }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The index of the highest set bit. The mask must not be zero.
+    //*************************************************************************
+    inline size_t highest_bit(uint64_t mask)
+    {
+      size_t index = 0U;
+
+      if ((mask >> 32U) != 0U) { mask >>= 32U; index += 32U; }
+      if ((mask >> 16U) != 0U) { mask >>= 16U; index += 16U; }
+      if ((mask >> 8U)  != 0U) { mask >>= 8U;  index += 8U;  }
+      if ((mask >> 4U)  != 0U) { mask >>= 4U;  index += 4U;  }
+      if ((mask >> 2U)  != 0U) { mask >>= 2U;  index += 2U;  }
+      if ((mask >> 1U)  != 0U) {               index += 1U;  }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Finds the first element equal to value, or returns last.
+    //*************************************************************************
+    template <typename T>
+    T* find(T* first, T* last, typename etl::remove_cv<T>::type value)
+    {
+      typedef typename etl::remove_cv<T>::type value_t;
+      typedef typename canonical<value_t>::type canonical_t;
+      typedef simd<canonical_t> ops;
+
+      const typename ops::vector_type needle = ops::splat(canonical_t(value));
+
+      while (size_t(last - first) >= size_t(ops::Lanes))
+      {
+        const uint64_t mask = ops::byte_mask(ops::equal(ops::load(first), needle));
+
+        if (mask != 0U)
+        {
+          return first + (lowest_bit(mask) / (Mask_Bits_Per_Byte * sizeof(value_t)));
+        }
+
+        first += ops::Lanes;
+      }
+
+      while ((first != last) && !(*first == value))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last element equal to value, or returns last.
+    //*************************************************************************
+    template <typename T>
+    T* find_last(T* first, T* last, typename etl::remove_cv<T>::type value)
+    {
+      typedef typename etl::remove_cv<T>::type value_t;
+      typedef typename canonical<value_t>::type canonical_t;
+      typedef simd<canonical_t> ops;
+
+      const typename ops::vector_type needle = ops::splat(canonical_t(value));
+
+      T* const end = last;
+
+      while (size_t(last - first) >= size_t(ops::Lanes))
+      {
+        T* const block = last - ops::Lanes;
+
+        const uint64_t mask = ops::byte_mask(ops::equal(ops::load(block), needle));
+
+        if (mask != 0U)
+        {
+          return block + (highest_bit(mask) / (Mask_Bits_Per_Byte * sizeof(value_t)));
+        }
+
+        last = block;
+      }
+
+      while (last != first)
+      {
+        --last;
+
+        if (*last == value)
+        {
+          return last;
+        }
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Counts the elements equal to value.
+    //*************************************************************************
+    template <typename T>
+    ptrdiff_t count(const T* first, const T* last, T value)
+    {
+      typedef typename canonical<T>::type canonical_t;
+      typedef simd<canonical_t> ops;
+      typedef typename ops::counter_lane_type counter_lane_t;
+
+      const typename ops::vector_type needle = ops::splat(canonical_t(value));
+
+      size_t n = 0U;
+
+      while (size_t(last - first) >= size_t(ops::Lanes))
+      {
+        // Each lane counts up to Count_Flush matches before it is added to the total.
+        typename ops::counter_type counter = ops::counter_zero();
+
+        size_t steps = size_t(last - first) / size_t(ops::Lanes);
+        steps = (steps < size_t(ops::Count_Flush)) ? steps : size_t(ops::Count_Flush);
+
+        while (steps-- != 0U)
+        {
+          counter = ops::count_step(counter, ops::equal(ops::load(first), needle));
+          first += ops::Lanes;
+        }
+
+        counter_lane_t lanes[ops::Lanes];
+        ops::store_counter(lanes, counter);
+
+        for (size_t i = 0U; i < size_t(ops::Lanes); ++i)
+        {
+          n += size_t(lanes[i]);
+        }
+      }
+
+      while (first != last)
+      {
+        if (*first++ == value)
+        {
+          ++n;
+        }
+      }
+
+      return ptrdiff_t(n);
+    }
+
+    //*************************************************************************
+    /// Gets the smallest and largest values of a range that is not empty.
+    /// Only the values selected by Want_Min and Want_Max are set.
+    /// Returns false, leaving the values unset, if there is a NaN.
+    //*************************************************************************
+    template <bool Want_Min, bool Want_Max, typename T>
+    bool min_max_values(const T* first, const T* last, T& minimum, T& maximum)
+    {
+      typedef typename canonical<T>::type canonical_t;
+      typedef simd<canonical_t> ops;
+      typedef typename ops::vector_type vector_t;
+
+      minimum = *first;
+      maximum = *first;
+
+      if (size_t(last - first) >= size_t(2 * ops::Lanes))
+      {
+        // Two sets of accumulators, to halve the dependency chains.
+        vector_t v_min0 = ops::load(first);
+        vector_t v_min1 = ops::load(first + ops::Lanes);
+        vector_t v_max0 = v_min0;
+        vector_t v_max1 = v_min1;
+
+        typename ops::mask_type nans = ops::nan_accumulate(ops::nan_accumulate(ops::nan_zero(), v_min0), v_min1);
+
+        first += 2 * ops::Lanes;
+
+        while (size_t(last - first) >= size_t(2 * ops::Lanes))
+        {
+          const vector_t v0 = ops::load(first);
+          const vector_t v1 = ops::load(first + ops::Lanes);
+
+          if (Want_Min)
+          {
+            v_min0 = ops::min(v_min0, v0);
+            v_min1 = ops::min(v_min1, v1);
+          }
+
+          if (Want_Max)
+          {
+            v_max0 = ops::max(v_max0, v0);
+            v_max1 = ops::max(v_max1, v1);
+          }
+
+          nans = ops::nan_accumulate(ops::nan_accumulate(nans, v0), v1);
+
+          first += 2 * ops::Lanes;
+        }
+
+        if (ops::any_nan(nans))
+        {
+          return false;
+        }
+
+        canonical_t lanes_min[ops::Lanes];
+        canonical_t lanes_max[ops::Lanes];
+        ops::store(lanes_min, ops::min(v_min0, v_min1));
+        ops::store(lanes_max, ops::max(v_max0, v_max1));
+
+        minimum = T(lanes_min[0]);
+        maximum = T(lanes_max[0]);
+
+        for (size_t i = 1U; i < size_t(ops::Lanes); ++i)
+        {
+          minimum = (T(lanes_min[i]) < minimum) ? T(lanes_min[i]) : minimum;
+          maximum = (maximum < T(lanes_max[i])) ? T(lanes_max[i]) : maximum;
+        }
+      }
+
+      for (; first != last; ++first)
+      {
+        // A NaN is not equal to itself.
+        if (!(*first == *first))
+        {
+          return false;
+        }
+
+        minimum = (*first < minimum) ? *first : minimum;
+        maximum = (maximum < *first) ? *first : maximum;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sums the elements, wrapping as the scalar sum would.
+    //*************************************************************************
+    template <typename T>
+    T sum(const T* first, const T* last)
+    {
+      typedef typename canonical<T>::type canonical_t;
+      typedef simd<canonical_t> ops;
+
+      T total = T(0);
+
+      if (size_t(last - first) >= size_t(ops::Lanes))
+      {
+        typename ops::vector_type v_sum = ops::splat(canonical_t(0));
+
+        while (size_t(last - first) >= size_t(ops::Lanes))
+        {
+          v_sum = ops::add(v_sum, ops::load(first));
+          first += ops::Lanes;
+        }
+
+        canonical_t lanes[ops::Lanes];
+        ops::store(lanes, v_sum);
+
+        for (size_t i = 0U; i < size_t(ops::Lanes); ++i)
+        {
+          total = T(total + T(lanes[i]));
+        }
+      }
+
+      while (first != last)
+      {
+        total = T(total + *first++);
+      }
+
+      return total;
+    }
+#endif
+  }
+}
+
+#include "minmax_pop.h"
+
+#endif
@@ -0,0 +1,1742 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_TABLE_INCLUDED
+#define ETL_BTREE_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../type_traits.h"
+#include "../functional.h"
+#include "../parameter_type.h"
+#include "../alignment.h"
+#include "../placement_new.h"
+#include "../ipool.h"
+#include "../debug_count.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// The B+ tree used by etl::btree_map and etl::btree_set.
+//
+// The elements are held, in order, in leaf nodes that are linked together for
+// iteration. The internal nodes hold copies of the keys that separate their
+// children. Each node holds as many entries as fit in ETL_BTREE_NODE_SIZE
+// bytes, so a lookup touches a few cache lines per level, rather than one per
+// comparison as in a node per element tree.
+//
+// Full nodes are split on the way down during an insert, and nodes with the
+// minimum number of entries are refilled on the way down during an erase, so
+// neither ever has to walk back up the tree.
+//*****************************************************************************
+#if !defined(ETL_BTREE_NODE_SIZE)
+  #define ETL_BTREE_NODE_SIZE 256
+#endif
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct select_first
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element.
+    //*************************************************************************
+    template <typename TKey>
+    struct select_self
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Moves an object to uninitialised storage and destroys the original.
+    //*************************************************************************
+    template <typename T>
+    void relocate(T* to, T* from)
+    {
+#if ETL_CPP11_SUPPORTED
+      ::new (to) T(etl::move(*from));
+#else
+      ::new (to) T(*from);
+#endif
+      from->~T();
+    }
+
+    //*************************************************************************
+    /// The nodes of the tree.
+    /// Each node holds at least four entries, whatever their size.
+    //*************************************************************************
+    template <typename TValue, typename TKey>
+    struct btree_nodes
+    {
+    private:
+
+      static ETL_CONSTANT size_t Leaf_Header     = sizeof(size_t) + (2U * sizeof(void*));
+      static ETL_CONSTANT size_t Internal_Header = sizeof(size_t) + sizeof(void*);
+      static ETL_CONSTANT size_t Leaf_Fit        = (ETL_BTREE_NODE_SIZE > Leaf_Header) ? (ETL_BTREE_NODE_SIZE - Leaf_Header) / sizeof(TValue) : 0U;
+      static ETL_CONSTANT size_t Internal_Fit    = (ETL_BTREE_NODE_SIZE > Internal_Header) ? (ETL_BTREE_NODE_SIZE - Internal_Header) / (sizeof(TKey) + sizeof(void*)) : 0U;
+
+    public:
+
+      /// The maximum number of elements in a leaf.
+      static ETL_CONSTANT size_t Leaf_Capacity = (Leaf_Fit < 4U) ? 4U : Leaf_Fit;
+
+      /// The minimum number of elements in a leaf that is not the root.
+      static ETL_CONSTANT size_t Leaf_Minimum = Leaf_Capacity / 2U;
+
+      /// The maximum number of keys in an internal node.
+      static ETL_CONSTANT size_t Internal_Capacity = (Internal_Fit < 4U) ? 4U : Internal_Fit;
+
+      /// The minimum number of keys in an internal node that is not the root.
+      static ETL_CONSTANT size_t Internal_Minimum = (Internal_Capacity / 2U) - 1U;
+
+      //***********************************************************************
+      struct node
+      {
+        size_t count;
+      };
+
+      //***********************************************************************
+      struct leaf_node : public node
+      {
+        TValue* values()
+        {
+          return reinterpret_cast<TValue*>(&storage);
+        }
+
+        const TValue* values() const
+        {
+          return reinterpret_cast<const TValue*>(&storage);
+        }
+
+        leaf_node* prev;
+        leaf_node* next;
+        typename etl::aligned_storage<sizeof(TValue) * Leaf_Capacity, etl::alignment_of<TValue>::value>::type storage;
+      };
+
+      //***********************************************************************
+      struct internal_node : public node
+      {
+        TKey* keys()
+        {
+          return reinterpret_cast<TKey*>(&storage);
+        }
+
+        const TKey* keys() const
+        {
+          return reinterpret_cast<const TKey*>(&storage);
+        }
+
+        node* children[Internal_Capacity + 1U];
+        typename etl::aligned_storage<sizeof(TKey) * Internal_Capacity, etl::alignment_of<TKey>::value>::type storage;
+      };
+    };
+
+    //*************************************************************************
+    /// The most internal nodes that a tree with a number of nodes on its
+    /// lowest level may need.
+    //*************************************************************************
+    template <size_t Nodes, size_t Min_Children, bool Is_Root = (Nodes <= 1U)>
+    struct internal_nodes_for
+    {
+    private:
+
+      static ETL_CONSTANT size_t Above = ((Nodes / Min_Children) > 1U) ? (Nodes / Min_Children) : 1U;
+
+    public:
+
+      static ETL_CONSTANT size_t value = Above + internal_nodes_for<Above, Min_Children>::value;
+    };
+
+    template <size_t Nodes, size_t Min_Children>
+    struct internal_nodes_for<Nodes, Min_Children, true>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    //*************************************************************************
+    /// The numbers of nodes needed for a capacity.
+    //*************************************************************************
+    template <typename TNodes, size_t Capacity>
+    struct node_counts_for
+    {
+      /// Every leaf but the root is at least half full.
+      static ETL_CONSTANT size_t Leaves = (Capacity <= TNodes::Leaf_Capacity) ? 1U : (Capacity / TNodes::Leaf_Minimum);
+
+      static ETL_CONSTANT size_t Internals = internal_nodes_for<Leaves, TNodes::Internal_Minimum + 1U>::value;
+    };
+
+    //*************************************************************************
+    /// The B+ tree.
+    ///\tparam TValue   The stored type.
+    ///\tparam TKey     The key type.
+    ///\tparam TKeyOf   Has a static 'get' that returns the key of a value.
+    ///\tparam TCompare The key compare function type.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare>
+    class btree_table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef TCompare          key_compare;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+      typedef value_type&&      rvalue_reference;
+#endif
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      typedef etl::private_btree::btree_nodes<TValue, TKey> nodes;
+      typedef typename nodes::node          node;
+      typedef typename nodes::leaf_node     leaf_node;
+      typedef typename nodes::internal_node internal_node;
+
+    private:
+
+      //*********************************************************************
+      /// An element's position in the leaves.
+      //*********************************************************************
+      struct position
+      {
+        position(leaf_node* pleaf_, size_t index_)
+          : pleaf(pleaf_),
+            index(index_)
+        {
+        }
+
+        leaf_node* pleaf;
+        size_t     index;
+      };
+
+    public:
+
+      class const_iterator;
+
+      //*********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+      {
+      public:
+
+        friend class btree_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : ptable(ETL_NULLPTR),
+            pleaf(ETL_NULLPTR),
+            index(0U)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          if (++index == pleaf->count)
+          {
+            pleaf = pleaf->next;
+            index = 0U;
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        iterator& operator --()
+        {
+          if (pleaf == ETL_NULLPTR)
+          {
+            pleaf = ptable->plast;
+            index = pleaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            pleaf = pleaf->prev;
+            index = pleaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          operator--();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return pleaf->values()[index];
+        }
+
+        //*********************************
+        pointer operator &() const
+        {
+          return pleaf->values() + index;
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return pleaf->values() + index;
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.pleaf == rhs.pleaf) && (lhs.index == rhs.index);
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(const btree_table* ptable_, position pos)
+          : ptable(ptable_),
+            pleaf(pos.pleaf),
+            index(pos.index)
+        {
+        }
+
+        const btree_table* ptable;
+        leaf_node*         pleaf;
+        size_t             index;
+      };
+
+      //*********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class btree_table;
+        friend class iterator;
+
+        //*********************************
+        const_iterator()
+          : ptable(ETL_NULLPTR),
+            pleaf(ETL_NULLPTR),
+            index(0U)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename btree_table::iterator& other)
+          : ptable(other.ptable),
+            pleaf(other.pleaf),
+            index(other.index)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          if (++index == pleaf->count)
+          {
+            pleaf = pleaf->next;
+            index = 0U;
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_iterator& operator --()
+        {
+          if (pleaf == ETL_NULLPTR)
+          {
+            pleaf = ptable->plast;
+            index = pleaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            pleaf = pleaf->prev;
+            index = pleaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          operator--();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return pleaf->values()[index];
+        }
+
+        //*********************************
+        const_pointer operator &() const
+        {
+          return pleaf->values() + index;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return pleaf->values() + index;
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return (lhs.pleaf == rhs.pleaf) && (lhs.index == rhs.index);
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const btree_table* ptable_, position pos)
+          : ptable(ptable_),
+            pleaf(pos.pleaf),
+            index(pos.index)
+        {
+        }
+
+        const btree_table* ptable;
+        const leaf_node*   pleaf;
+        size_t             index;
+      };
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        return iterator(this, position(pfirst, 0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this, position(pfirst, 0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return begin();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(this, position(ETL_NULLPTR, 0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this, position(ETL_NULLPTR, 0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return end();
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Gets the size of the table.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == maximum_size;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      ///\return The remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return maximum_size - current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the number of levels in the tree.
+      /// An empty tree has no levels.
+      //*********************************************************************
+      size_t depth() const
+      {
+        return (proot == ETL_NULLPTR) ? 0U : height + 1U;
+      }
+
+      //*********************************************************************
+      /// How to compare two keys.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return iterator(this, find_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator find(const K& key)
+      {
+        return iterator(this, find_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return const_iterator(this, find_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator find(const K& key) const
+      {
+        return const_iterator(this, find_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Counts the elements with the key.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_position(key).pleaf == ETL_NULLPTR) ? 0U : 1U;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Counts the elements with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      size_t count(const K& key) const
+      {
+        return (find_position(key).pleaf == ETL_NULLPTR) ? 0U : 1U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Checks if the table contains an element with the key.
+      ///\param key The key to search for.
+      ///\return <b>true</b> if the key exists.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find_position(key).pleaf != ETL_NULLPTR;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Checks if the table contains an element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return <b>true</b> if the key exists.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      bool contains(const K& key) const
+      {
+        return find_position(key).pleaf != ETL_NULLPTR;
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        return iterator(this, lower_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator lower_bound(const K& key)
+      {
+        return iterator(this, lower_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return const_iterator(this, lower_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator lower_bound(const K& key) const
+      {
+        return const_iterator(this, lower_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        return iterator(this, upper_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator upper_bound(const K& key)
+      {
+        return iterator(this, upper_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return const_iterator(this, upper_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator upper_bound(const K& key) const
+      {
+        return const_iterator(this, upper_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return An iterator pair.
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator pair.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator pair.
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator pair.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        return erase_key(key);
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      /// Erasing may move the other elements, so the iterator to the next
+      /// element is found again from its key.
+      ///\param ielement Iterator to the element.
+      ///\return An iterator to the next element.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        const key_type key(TKeyOf::get(*ielement));
+
+        erase_key(key);
+
+        return lower_bound(key);
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      ///\param first Iterator to the first element.
+      ///\param last  Iterator to the last element + 1.
+      ///\return An iterator to the element after the range.
+      //*********************************************************************
+      iterator erase(const_iterator first_, const_iterator last_)
+      {
+        // The iterators are invalidated by each erase, so count the elements first.
+        size_t n = size_t(etl::distance(first_, last_));
+
+        iterator itr = iterator(this, position(const_cast<leaf_node*>(first_.pleaf), first_.index));
+
+        while (n-- != 0U)
+        {
+          itr = erase(itr);
+        }
+
+        return itr;
+      }
+
+      //*************************************************************************
+      /// Clears the table.
+      //*************************************************************************
+      void clear()
+      {
+        initialise();
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      btree_table(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t maximum_size_)
+        : p_leaf_pool(&leaf_pool_),
+          p_internal_pool(&internal_pool_),
+          proot(ETL_NULLPTR),
+          pfirst(ETL_NULLPTR),
+          plast(ETL_NULLPTR),
+          height(0U),
+          maximum_size(maximum_size_),
+          current_size(0U)
+      {
+      }
+
+      //*********************************************************************
+      /// Destroys all of the elements and empties the table.
+      //*********************************************************************
+      void initialise()
+      {
+        if (proot != ETL_NULLPTR)
+        {
+          destroy_node(proot, height);
+        }
+
+        proot        = ETL_NULLPTR;
+        pfirst       = ETL_NULLPTR;
+        plast        = ETL_NULLPTR;
+        height       = 0U;
+        current_size = 0U;
+        ETL_RESET_DEBUG_COUNT
+      }
+
+      //*********************************************************************
+      /// Makes room for a new element with the key.
+      /// If the key is new, the returned iterator points to uninitialised
+      /// storage that the caller must construct the element in.
+      ///\return The iterator and <b>true</b> if the key is new.
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, bool> prepare_insert(key_parameter_t key)
+      {
+        if (proot == ETL_NULLPTR)
+        {
+          leaf_node* pleaf = allocate_leaf();
+          pleaf->prev = ETL_NULLPTR;
+          pleaf->next = ETL_NULLPTR;
+
+          proot  = pleaf;
+          pfirst = pleaf;
+          plast  = pleaf;
+        }
+        else if (is_full(proot, height))
+        {
+          // Grow the tree by a level.
+          internal_node* pnew_root = allocate_internal();
+          pnew_root->children[0] = proot;
+
+          split_child(*pnew_root, 0U, height);
+
+          proot = pnew_root;
+          ++height;
+        }
+
+        node*  pnode = proot;
+        size_t level = height;
+
+        while (level != 0U)
+        {
+          internal_node& parent = static_cast<internal_node&>(*pnode);
+          size_t i = child_index(parent, key);
+
+          if (is_full(parent.children[i], level - 1U))
+          {
+            split_child(parent, i, level - 1U);
+
+            if (!compare(key, parent.keys()[i]))
+            {
+              ++i;
+            }
+          }
+
+          pnode = parent.children[i];
+          --level;
+        }
+
+        leaf_node& leaf = static_cast<leaf_node&>(*pnode);
+        size_t i = lower_index(leaf, key);
+
+        if ((i != leaf.count) && !compare(key, TKeyOf::get(leaf.values()[i])))
+        {
+          return ETL_OR_STD::pair<iterator, bool>(iterator(this, position(&leaf, i)), false);
+        }
+
+        // Make a gap for the new element.
+        value_type* values = leaf.values();
+
+        for (size_t j = leaf.count; j > i; --j)
+        {
+          relocate(values + j, values + j - 1U);
+        }
+
+        ++leaf.count;
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, position(&leaf, i)), true);
+      }
+
+      //*********************************************************************
+      /// Gets the address of the element at an iterator.
+      //*********************************************************************
+      static pointer slot_address(iterator itr)
+      {
+        return itr.pleaf->values() + itr.index;
+      }
+
+    private:
+
+      /// Searches of nodes halve the range until it is this size, and then
+      /// compare with the rest, which is faster than a branch per comparison.
+      static ETL_CONSTANT size_t Linear_Search_Size = 8U;
+
+      //*********************************************************************
+      /// The index of the first element in a leaf not less than the key.
+      //*********************************************************************
+      template <typename K>
+      size_t lower_index(const leaf_node& leaf, const K& key) const
+      {
+        const value_type* values = leaf.values();
+
+        size_t first = 0U;
+        size_t n     = leaf.count;
+
+        while (n > Linear_Search_Size)
+        {
+          const size_t step = n / 2U;
+
+          if (compare(TKeyOf::get(values[first + step]), key))
+          {
+            first += step + 1U;
+            n     -= step + 1U;
+          }
+          else
+          {
+            n = step;
+          }
+        }
+
+        // Count the rest without branching.
+        const size_t last = first + n;
+
+        for (size_t i = first; i < last; ++i)
+        {
+          first += (compare(TKeyOf::get(values[i]), key)) ? 1U : 0U;
+        }
+
+        return first;
+      }
+
+      //*********************************************************************
+      /// The index of the first element in a leaf greater than the key.
+      //*********************************************************************
+      template <typename K>
+      size_t upper_index(const leaf_node& leaf, const K& key) const
+      {
+        const value_type* values = leaf.values();
+
+        size_t first = 0U;
+        size_t n     = leaf.count;
+
+        while (n > Linear_Search_Size)
+        {
+          const size_t step = n / 2U;
+
+          if (!compare(key, TKeyOf::get(values[first + step])))
+          {
+            first += step + 1U;
+            n     -= step + 1U;
+          }
+          else
+          {
+            n = step;
+          }
+        }
+
+        // Count the rest without branching.
+        const size_t last = first + n;
+
+        for (size_t i = first; i < last; ++i)
+        {
+          first += (!compare(key, TKeyOf::get(values[i]))) ? 1U : 0U;
+        }
+
+        return first;
+      }
+
+      //*********************************************************************
+      /// The index of the child of an internal node that may hold the key.
+      /// The keys in child 'i' are not less than key 'i - 1' and less than key 'i'.
+      //*********************************************************************
+      template <typename K>
+      size_t child_index(const internal_node& parent, const K& key) const
+      {
+        const key_type* keys = parent.keys();
+
+        size_t first = 0U;
+        size_t n     = parent.count;
+
+        while (n > Linear_Search_Size)
+        {
+          const size_t step = n / 2U;
+
+          if (!compare(key, keys[first + step]))
+          {
+            first += step + 1U;
+            n     -= step + 1U;
+          }
+          else
+          {
+            n = step;
+          }
+        }
+
+        // Count the rest without branching.
+        const size_t last = first + n;
+
+        for (size_t i = first; i < last; ++i)
+        {
+          first += (!compare(key, keys[i])) ? 1U : 0U;
+        }
+
+        return first;
+      }
+
+      //*********************************************************************
+      /// Finds the leaf that may hold the key.
+      //*********************************************************************
+      template <typename K>
+      leaf_node* find_leaf(const K& key) const
+      {
+        node* pnode = proot;
+
+        for (size_t level = height; level != 0U; --level)
+        {
+          const internal_node& parent = static_cast<const internal_node&>(*pnode);
+          pnode = parent.children[child_index(parent, key)];
+        }
+
+        return static_cast<leaf_node*>(pnode);
+      }
+
+      //*********************************************************************
+      /// Converts an index one past the end of a leaf to the next leaf.
+      //*********************************************************************
+      static position normalise(leaf_node* pleaf, size_t index)
+      {
+        if (index == pleaf->count)
+        {
+          return position(pleaf->next, 0U);
+        }
+
+        return position(pleaf, index);
+      }
+
+      //*********************************************************************
+      /// The position of the element with the key, or the end position.
+      //*********************************************************************
+      template <typename K>
+      position find_position(const K& key) const
+      {
+        if (proot != ETL_NULLPTR)
+        {
+          leaf_node* pleaf = find_leaf(key);
+          size_t i = lower_index(*pleaf, key);
+
+          if ((i != pleaf->count) && !compare(key, TKeyOf::get(pleaf->values()[i])))
+          {
+            return position(pleaf, i);
+          }
+        }
+
+        return position(ETL_NULLPTR, 0U);
+      }
+
+      //*********************************************************************
+      /// The position of the first element not less than the key.
+      //*********************************************************************
+      template <typename K>
+      position lower_position(const K& key) const
+      {
+        if (proot == ETL_NULLPTR)
+        {
+          return position(ETL_NULLPTR, 0U);
+        }
+
+        leaf_node* pleaf = find_leaf(key);
+
+        return normalise(pleaf, lower_index(*pleaf, key));
+      }
+
+      //*********************************************************************
+      /// The position of the first element greater than the key.
+      //*********************************************************************
+      template <typename K>
+      position upper_position(const K& key) const
+      {
+        if (proot == ETL_NULLPTR)
+        {
+          return position(ETL_NULLPTR, 0U);
+        }
+
+        leaf_node* pleaf = find_leaf(key);
+
+        return normalise(pleaf, upper_index(*pleaf, key));
+      }
+
+      //*********************************************************************
+      /// Is the node at the level full?
+      //*********************************************************************
+      static bool is_full(const node* pnode, size_t level)
+      {
+        return pnode->count == ((level == 0U) ? nodes::Leaf_Capacity : nodes::Internal_Capacity);
+      }
+
+      //*********************************************************************
+      /// Does the node at the level have the minimum number of entries?
+      //*********************************************************************
+      static bool is_minimal(const node* pnode, size_t level)
+      {
+        return pnode->count <= ((level == 0U) ? nodes::Leaf_Minimum : nodes::Internal_Minimum);
+      }
+
+      //*********************************************************************
+      /// Inserts a key and the child to its right into an internal node.
+      //*********************************************************************
+      static void insert_key(internal_node& parent, size_t i, node* pchild)
+      {
+        key_type* keys = parent.keys();
+
+        for (size_t j = parent.count; j > i; --j)
+        {
+          relocate(keys + j, keys + j - 1U);
+          parent.children[j + 1U] = parent.children[j];
+        }
+
+        parent.children[i + 1U] = pchild;
+        ++parent.count;
+      }
+
+      //*********************************************************************
+      /// Removes key 'i', which has been moved out, and the child to its right
+      /// from an internal node.
+      //*********************************************************************
+      static void remove_key(internal_node& parent, size_t i)
+      {
+        key_type* keys = parent.keys();
+
+        for (size_t j = i + 1U; j < parent.count; ++j)
+        {
+          relocate(keys + j - 1U, keys + j);
+          parent.children[j] = parent.children[j + 1U];
+        }
+
+        --parent.count;
+      }
+
+      //*********************************************************************
+      /// Replaces a key in an internal node.
+      //*********************************************************************
+      static void replace_key(internal_node& parent, size_t i, const key_type& key)
+      {
+        key_type* keys = parent.keys();
+
+        keys[i].~key_type();
+        ::new (keys + i) key_type(key);
+      }
+
+      //*********************************************************************
+      /// Splits the full child 'i' of a node that is not full.
+      //*********************************************************************
+      void split_child(internal_node& parent, size_t i, size_t level)
+      {
+        if (level == 0U)
+        {
+          leaf_node& left  = static_cast<leaf_node&>(*parent.children[i]);
+          leaf_node& right = *allocate_leaf();
+
+          const size_t mid = nodes::Leaf_Capacity / 2U;
+
+          for (size_t j = mid; j < left.count; ++j)
+          {
+            relocate(right.values() + (j - mid), left.values() + j);
+          }
+
+          right.count = left.count - mid;
+          left.count  = mid;
+
+          right.prev = &left;
+          right.next = left.next;
+
+          if (left.next == ETL_NULLPTR)
+          {
+            plast = &right;
+          }
+          else
+          {
+            left.next->prev = &right;
+          }
+
+          left.next = &right;
+
+          // Make a gap for the separator.
+          insert_key(parent, i, &right);
+          ::new (parent.keys() + i) key_type(TKeyOf::get(right.values()[0]));
+        }
+        else
+        {
+          internal_node& left  = static_cast<internal_node&>(*parent.children[i]);
+          internal_node& right = *allocate_internal();
+
+          const size_t mid = nodes::Internal_Capacity / 2U;
+
+          for (size_t j = mid + 1U; j < left.count; ++j)
+          {
+            relocate(right.keys() + (j - mid - 1U), left.keys() + j);
+            right.children[j - mid - 1U] = left.children[j];
+          }
+
+          right.children[left.count - mid - 1U] = left.children[left.count];
+          right.count = left.count - mid - 1U;
+
+          // The middle key moves up.
+          insert_key(parent, i, &right);
+          relocate(parent.keys() + i, left.keys() + mid);
+
+          left.count = mid;
+        }
+      }
+
+      //*********************************************************************
+      /// Moves an entry from the left sibling to child 'i'.
+      //*********************************************************************
+      void borrow_from_left(internal_node& parent, size_t i, size_t level)
+      {
+        if (level == 0U)
+        {
+          leaf_node& left  = static_cast<leaf_node&>(*parent.children[i - 1U]);
+          leaf_node& child = static_cast<leaf_node&>(*parent.children[i]);
+
+          value_type* values = child.values();
+
+          for (size_t j = child.count; j > 0U; --j)
+          {
+            relocate(values + j, values + j - 1U);
+          }
+
+          relocate(values, left.values() + left.count - 1U);
+          --left.count;
+          ++child.count;
+
+          replace_key(parent, i - 1U, TKeyOf::get(values[0]));
+        }
+        else
+        {
+          internal_node& left  = static_cast<internal_node&>(*parent.children[i - 1U]);
+          internal_node& child = static_cast<internal_node&>(*parent.children[i]);
+
+          key_type* keys = child.keys();
+
+          child.children[child.count + 1U] = child.children[child.count];
+
+          for (size_t j = child.count; j > 0U; --j)
+          {
+            relocate(keys + j, keys + j - 1U);
+            child.children[j] = child.children[j - 1U];
+          }
+
+          // Rotate through the parent.
+          relocate(keys, parent.keys() + i - 1U);
+          child.children[0] = left.children[left.count];
+          relocate(parent.keys() + i - 1U, left.keys() + left.count - 1U);
+
+          --left.count;
+          ++child.count;
+        }
+      }
+
+      //*********************************************************************
+      /// Moves an entry from the right sibling to child 'i'.
+      //*********************************************************************
+      void borrow_from_right(internal_node& parent, size_t i, size_t level)
+      {
+        if (level == 0U)
+        {
+          leaf_node& child = static_cast<leaf_node&>(*parent.children[i]);
+          leaf_node& right = static_cast<leaf_node&>(*parent.children[i + 1U]);
+
+          value_type* values = right.values();
+
+          relocate(child.values() + child.count, values);
+
+          for (size_t j = 1U; j < right.count; ++j)
+          {
+            relocate(values + j - 1U, values + j);
+          }
+
+          ++child.count;
+          --right.count;
+
+          replace_key(parent, i, TKeyOf::get(values[0]));
+        }
+        else
+        {
+          internal_node& child = static_cast<internal_node&>(*parent.children[i]);
+          internal_node& right = static_cast<internal_node&>(*parent.children[i + 1U]);
+
+          key_type* keys = right.keys();
+
+          // Rotate through the parent.
+          relocate(child.keys() + child.count, parent.keys() + i);
+          child.children[child.count + 1U] = right.children[0];
+          relocate(parent.keys() + i, keys);
+
+          for (size_t j = 1U; j < right.count; ++j)
+          {
+            relocate(keys + j - 1U, keys + j);
+            right.children[j - 1U] = right.children[j];
+          }
+
+          right.children[right.count - 1U] = right.children[right.count];
+
+          ++child.count;
+          --right.count;
+        }
+      }
+
+      //*********************************************************************
+      /// Merges child 'i + 1' into child 'i'.
+      //*********************************************************************
+      void merge_children(internal_node& parent, size_t i, size_t level)
+      {
+        if (level == 0U)
+        {
+          leaf_node& left  = static_cast<leaf_node&>(*parent.children[i]);
+          leaf_node& right = static_cast<leaf_node&>(*parent.children[i + 1U]);
+
+          for (size_t j = 0U; j < right.count; ++j)
+          {
+            relocate(left.values() + left.count + j, right.values() + j);
+          }
+
+          left.count += right.count;
+          left.next   = right.next;
+
+          if (right.next == ETL_NULLPTR)
+          {
+            plast = &left;
+          }
+          else
+          {
+            right.next->prev = &left;
+          }
+
+          p_leaf_pool->release(&right);
+        }
+        else
+        {
+          internal_node& left  = static_cast<internal_node&>(*parent.children[i]);
+          internal_node& right = static_cast<internal_node&>(*parent.children[i + 1U]);
+
+          // The separator moves down.
+          relocate(left.keys() + left.count, parent.keys() + i);
+
+          for (size_t j = 0U; j < right.count; ++j)
+          {
+            relocate(left.keys() + left.count + 1U + j, right.keys() + j);
+            left.children[left.count + 1U + j] = right.children[j];
+          }
+
+          left.children[left.count + 1U + right.count] = right.children[right.count];
+          left.count += 1U + right.count;
+
+          p_internal_pool->release(&right);
+        }
+
+        remove_key(parent, i);
+      }
+
+      //*********************************************************************
+      /// Makes sure child 'i' has more than the minimum number of entries.
+      ///\return The index of the child that now holds the entries of child 'i'.
+      //*********************************************************************
+      size_t refill_child(internal_node& parent, size_t i, size_t level)
+      {
+        if ((i != 0U) && !is_minimal(parent.children[i - 1U], level))
+        {
+          borrow_from_left(parent, i, level);
+        }
+        else if ((i != parent.count) && !is_minimal(parent.children[i + 1U], level))
+        {
+          borrow_from_right(parent, i, level);
+        }
+        else if (i != parent.count)
+        {
+          merge_children(parent, i, level);
+        }
+        else
+        {
+          merge_children(parent, i - 1U, level);
+          --i;
+        }
+
+        return i;
+      }
+
+      //*********************************************************************
+      /// Erases the element with the key.
+      //*********************************************************************
+      template <typename K>
+      size_t erase_key(const K& key)
+      {
+        if (proot == ETL_NULLPTR)
+        {
+          return 0U;
+        }
+
+        node*  pnode = proot;
+        size_t level = height;
+
+        while (level != 0U)
+        {
+          internal_node& parent = static_cast<internal_node&>(*pnode);
+          size_t i = child_index(parent, key);
+
+          if (is_minimal(parent.children[i], level - 1U))
+          {
+            i = refill_child(parent, i, level - 1U);
+
+            if (parent.count == 0U)
+            {
+              // The root's last two children have merged, so shrink the tree by a level.
+              proot = parent.children[0];
+              p_internal_pool->release(&parent);
+              --height;
+            }
+          }
+
+          pnode = (level > height) ? proot : parent.children[i];
+          --level;
+        }
+
+        leaf_node& leaf = static_cast<leaf_node&>(*pnode);
+        size_t i = lower_index(leaf, key);
+
+        if ((i == leaf.count) || compare(key, TKeyOf::get(leaf.values()[i])))
+        {
+          return 0U;
+        }
+
+        value_type* values = leaf.values();
+
+        values[i].~value_type();
+
+        for (size_t j = i + 1U; j < leaf.count; ++j)
+        {
+          relocate(values + j - 1U, values + j);
+        }
+
+        --leaf.count;
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT
+
+        if (leaf.count == 0U)
+        {
+          // Only the root may become empty.
+          p_leaf_pool->release(&leaf);
+          proot  = ETL_NULLPTR;
+          pfirst = ETL_NULLPTR;
+          plast  = ETL_NULLPTR;
+        }
+
+        return 1U;
+      }
+
+      //*********************************************************************
+      /// Destroys a node and its children.
+      //*********************************************************************
+      void destroy_node(node* pnode, size_t level)
+      {
+        if (level == 0U)
+        {
+          leaf_node& leaf = static_cast<leaf_node&>(*pnode);
+
+          for (size_t i = 0U; i < leaf.count; ++i)
+          {
+            leaf.values()[i].~value_type();
+          }
+
+          p_leaf_pool->release(&leaf);
+        }
+        else
+        {
+          internal_node& parent = static_cast<internal_node&>(*pnode);
+
+          for (size_t i = 0U; i < parent.count; ++i)
+          {
+            parent.keys()[i].~key_type();
+          }
+
+          for (size_t i = 0U; i <= parent.count; ++i)
+          {
+            destroy_node(parent.children[i], level - 1U);
+          }
+
+          p_internal_pool->release(&parent);
+        }
+      }
+
+      //*********************************************************************
+      /// Allocates an empty leaf.
+      //*********************************************************************
+      leaf_node* allocate_leaf()
+      {
+        leaf_node* (etl::ipool::*func)() = &etl::ipool::allocate<leaf_node>;
+        leaf_node* pleaf = (p_leaf_pool->*func)();
+        pleaf->count = 0U;
+
+        return pleaf;
+      }
+
+      //*********************************************************************
+      /// Allocates an empty internal node.
+      //*********************************************************************
+      internal_node* allocate_internal()
+      {
+        internal_node* (etl::ipool::*func)() = &etl::ipool::allocate<internal_node>;
+        internal_node* pinternal = (p_internal_pool->*func)();
+        pinternal->count = 0U;
+
+        return pinternal;
+      }
+
+      // Disable copy construction.
+      btree_table(const btree_table&);
+      btree_table& operator =(const btree_table&);
+
+      /// The pool of leaves.
+      etl::ipool* p_leaf_pool;
+
+      /// The pool of internal nodes.
+      etl::ipool* p_internal_pool;
+
+      /// The root of the tree.
+      node* proot;
+
+      /// The first leaf.
+      leaf_node* pfirst;
+
+      /// The last leaf.
+      leaf_node* plast;
+
+      /// The number of internal levels above the leaves.
+      size_t height;
+
+      /// The maximum number of elements.
+      const size_t maximum_size;
+
+      /// The number of elements.
+      size_t current_size;
+
+      /// The function that compares the keys.
+      key_compare compare;
+
+      /// For library debugging purposes only.
+      ETL_DECLARE_DEBUG_COUNT
+
+    protected:
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~btree_table()
+      {
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,224 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_SWAP_KERNELS_INCLUDED
+#define ETL_BYTE_SWAP_KERNELS_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+// Kernels that reverse the bytes of each element of an array.
+// SSSE3 (pshufb), SSE2 or NEON (vrev) versions are used when the compiler
+// reports that the target supports them, unless ETL_BYTE_SWAP_NO_SIMD is
+// defined.
+//*****************************************************************************
+#if !defined(ETL_BYTE_SWAP_NO_SIMD) && (defined(__SSSE3__) || defined(__AVX__))
+  #define ETL_BYTE_SWAP_SIMD_SSSE3 1
+#else
+  #define ETL_BYTE_SWAP_SIMD_SSSE3 0
+#endif
+
+#if !defined(ETL_BYTE_SWAP_NO_SIMD) && !ETL_BYTE_SWAP_SIMD_SSSE3 && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_BYTE_SWAP_SIMD_SSE2 1
+#else
+  #define ETL_BYTE_SWAP_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_BYTE_SWAP_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_BYTE_SWAP_SIMD_NEON 1
+#else
+  #define ETL_BYTE_SWAP_SIMD_NEON 0
+#endif
+
+#if ETL_BYTE_SWAP_SIMD_SSSE3
+  #include <tmmintrin.h>
+#elif ETL_BYTE_SWAP_SIMD_SSE2
+  #include <emmintrin.h>
+#elif ETL_BYTE_SWAP_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_byte_swap
+  {
+    //*************************************************************************
+    /// The unsigned type of each element size.
+    //*************************************************************************
+    template <size_t Size>
+    struct uint_of_size;
+
+    template <>
+    struct uint_of_size<2U>
+    {
+      typedef uint16_t type;
+    };
+
+    template <>
+    struct uint_of_size<4U>
+    {
+      typedef uint32_t type;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct uint_of_size<8U>
+    {
+      typedef uint64_t type;
+    };
+#endif
+
+#if ETL_BYTE_SWAP_SIMD_SSSE3
+    //*************************************************************************
+    /// Reverses the bytes of each element of a vector with one pshufb.
+    //*************************************************************************
+    template <size_t Size>
+    __m128i swap_vector(__m128i v)
+    {
+      const __m128i mask = (Size == 2U) ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14) :
+                           (Size == 4U) ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12) :
+                                          _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+
+      return _mm_shuffle_epi8(v, mask);
+    }
+#elif ETL_BYTE_SWAP_SIMD_SSE2
+    //*************************************************************************
+    /// Reverses the bytes of each element of a vector.
+    /// The 16 bit words are put in order with shuffles, then the bytes of each
+    /// word are swapped with shifts.
+    //*************************************************************************
+    template <size_t Size>
+    __m128i swap_vector(__m128i v)
+    {
+      if (Size == 4U)
+      {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      }
+      else if (Size == 8U)
+      {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+      }
+
+      return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+#elif ETL_BYTE_SWAP_SIMD_NEON
+    //*************************************************************************
+    /// Reverses the bytes of each element of a vector with one vrev.
+    //*************************************************************************
+    template <size_t Size>
+    uint8x16_t swap_vector(uint8x16_t v)
+    {
+      return (Size == 2U) ? vrev16q_u8(v) : (Size == 4U) ? vrev32q_u8(v) : vrev64q_u8(v);
+    }
+#endif
+
+    //*************************************************************************
+    /// Reverses the bytes of 'count' elements of 'Size' bytes.
+    /// 'source' and 'destination' may be the same, but must not otherwise
+    /// overlap. Neither needs to be aligned.
+    //*************************************************************************
+    template <size_t Size>
+    void reverse_bytes(const uint8_t* source, uint8_t* destination, size_t count)
+    {
+      typedef typename uint_of_size<Size>::type uint_t;
+
+#if ETL_BYTE_SWAP_SIMD_SSSE3 || ETL_BYTE_SWAP_SIMD_SSE2
+      const size_t Per_Vector = 16U / Size;
+
+      while (count >= (2U * Per_Vector))
+      {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16U));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination),       swap_vector<Size>(v0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16U), swap_vector<Size>(v1));
+
+        source      += 32U;
+        destination += 32U;
+        count       -= 2U * Per_Vector;
+      }
+#elif ETL_BYTE_SWAP_SIMD_NEON
+      const size_t Per_Vector = 16U / Size;
+
+      while (count >= (2U * Per_Vector))
+      {
+        const uint8x16_t v0 = vld1q_u8(source);
+        const uint8x16_t v1 = vld1q_u8(source + 16U);
+
+        vst1q_u8(destination,       swap_vector<Size>(v0));
+        vst1q_u8(destination + 16U, swap_vector<Size>(v1));
+
+        source      += 32U;
+        destination += 32U;
+        count       -= 2U * Per_Vector;
+      }
+#endif
+
+      // Four at a time, loading all four before storing any.
+      while (count >= 4U)
+      {
+        uint_t v[4];
+        memcpy(v, source, sizeof(v));
+
+        v[0] = etl::reverse_bytes(v[0]);
+        v[1] = etl::reverse_bytes(v[1]);
+        v[2] = etl::reverse_bytes(v[2]);
+        v[3] = etl::reverse_bytes(v[3]);
+
+        memcpy(destination, v, sizeof(v));
+
+        source      += sizeof(v);
+        destination += sizeof(v);
+        count       -= 4U;
+      }
+
+      while (count != 0U)
+      {
+        uint_t v;
+        memcpy(&v, source, sizeof(v));
+        v = etl::reverse_bytes(v);
+        memcpy(destination, &v, sizeof(v));
+
+        source      += sizeof(v);
+        destination += sizeof(v);
+        --count;
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,305 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHECKSUM_KERNELS_INCLUDED
+#define ETL_CHECKSUM_KERNELS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Block kernels for the checksum policies.
+// SSE2 versions are used when the compiler reports that the target supports
+// them, unless ETL_CHECKSUM_NO_SIMD is defined.
+//*****************************************************************************
+#if !defined(ETL_CHECKSUM_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_CHECKSUM_SIMD_SSE2 1
+#else
+  #define ETL_CHECKSUM_SIMD_SSE2 0
+#endif
+
+#if ETL_CHECKSUM_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_checksum
+  {
+    //*************************************************************************
+    /// The largest number of bytes that may be added to a pair of running sums,
+    /// each less than 65521, before the 32 bit second sum could overflow.
+    /// 255n(n+1)/2 + (n+1)(65521-1) <= 2^32-1
+    //*************************************************************************
+    static ETL_CONSTANT size_t Deferred_Modulo_Block = 5552U;
+
+#if ETL_CHECKSUM_SIMD_SSE2
+    //*************************************************************************
+    /// Sums the low 32 bits of each 64 bit lane.
+    /// The caller guarantees that the lanes and the result fit in 32 bits.
+    //*************************************************************************
+    inline uint32_t sum_lanes64(__m128i v)
+    {
+      return uint32_t(_mm_cvtsi128_si32(v)) + uint32_t(_mm_cvtsi128_si32(_mm_srli_si128(v, 8)));
+    }
+
+    //*************************************************************************
+    /// Sums each 32 bit lane.
+    //*************************************************************************
+    inline uint32_t sum_lanes32(__m128i v)
+    {
+      v = _mm_add_epi32(v, _mm_srli_si128(v, 8));
+      v = _mm_add_epi32(v, _mm_srli_si128(v, 4));
+
+      return uint32_t(_mm_cvtsi128_si32(v));
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns the sum of the bytes.
+    //*************************************************************************
+    inline uint64_t sum_bytes(const uint8_t* p, size_t n)
+    {
+      uint64_t sum = 0U;
+
+#if ETL_CHECKSUM_SIMD_SSE2
+      const __m128i zero = _mm_setzero_si128();
+      __m128i sum0 = _mm_setzero_si128();
+      __m128i sum1 = _mm_setzero_si128();
+
+      while (n >= 32U)
+      {
+        sum0 = _mm_add_epi64(sum0, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),      zero));
+        sum1 = _mm_add_epi64(sum1, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), zero));
+        p += 32U;
+        n -= 32U;
+      }
+
+      uint64_t lanes[2];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(sum0, sum1));
+
+      sum = lanes[0] + lanes[1];
+#endif
+
+      // Four independent accumulators, folded in before they could overflow.
+      while (n >= 4U)
+      {
+        uint32_t sum0 = 0U;
+        uint32_t sum1 = 0U;
+        uint32_t sum2 = 0U;
+        uint32_t sum3 = 0U;
+
+        size_t count = (n / 4U) < 65536U ? (n / 4U) : 65536U;
+        n -= count * 4U;
+
+        while (count-- != 0U)
+        {
+          sum0 += p[0];
+          sum1 += p[1];
+          sum2 += p[2];
+          sum3 += p[3];
+          p += 4U;
+        }
+
+        sum += uint64_t(sum0) + sum1 + sum2 + sum3;
+      }
+
+      while (n-- != 0U)
+      {
+        sum += *p++;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Returns the XOR of the bytes.
+    //*************************************************************************
+    inline uint8_t xor_bytes(const uint8_t* p, size_t n)
+    {
+      uint8_t result = 0U;
+
+#if ETL_CHECKSUM_SIMD_SSE2
+      __m128i x = _mm_setzero_si128();
+
+      while (n >= 16U)
+      {
+        x = _mm_xor_si128(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        p += 16U;
+        n -= 16U;
+      }
+
+      x = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+      x = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+      x = _mm_xor_si128(x, _mm_srli_si128(x, 2));
+      x = _mm_xor_si128(x, _mm_srli_si128(x, 1));
+
+      result = uint8_t(_mm_cvtsi128_si32(x));
+#endif
+
+      uint8_t x0 = 0U;
+      uint8_t x1 = 0U;
+      uint8_t x2 = 0U;
+      uint8_t x3 = 0U;
+
+      while (n >= 4U)
+      {
+        x0 ^= p[0];
+        x1 ^= p[1];
+        x2 ^= p[2];
+        x3 ^= p[3];
+        p += 4U;
+        n -= 4U;
+      }
+
+      while (n-- != 0U)
+      {
+        x0 ^= *p++;
+      }
+
+      return uint8_t(result ^ x0 ^ x1 ^ x2 ^ x3);
+    }
+
+    //*************************************************************************
+    /// Updates the two running sums of the Fletcher and Adler checksums,
+    /// without any modulo reduction.
+    /// a += x[i], b += a, for each byte.
+    /// n must not exceed Deferred_Modulo_Block.
+    //*************************************************************************
+    inline void fletcher_sums(const uint8_t* p, size_t n, uint32_t& a_, uint32_t& b_)
+    {
+      uint32_t a = a_;
+      uint32_t b = b_;
+
+#if ETL_CHECKSUM_SIMD_SSE2
+      const size_t blocks = n / 16U;
+
+      if (blocks != 0U)
+      {
+        // Weights of each byte's contribution to b, within a block of 16.
+        const __m128i weights_low  = _mm_set_epi16(9, 10, 11, 12, 13, 14, 15, 16);
+        const __m128i weights_high = _mm_set_epi16(1, 2, 3, 4, 5, 6, 7, 8);
+        const __m128i zero         = _mm_setzero_si128();
+
+        __m128i sum  = _mm_setzero_si128(); // The running sum of the bytes.
+        __m128i psum = _mm_setzero_si128(); // The sum of 'sum' before each block.
+        __m128i wsum = _mm_setzero_si128(); // The weighted sums within each block.
+
+        for (size_t i = 0U; i < blocks; ++i)
+        {
+          const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+          psum = _mm_add_epi64(psum, sum);
+          sum  = _mm_add_epi64(sum, _mm_sad_epu8(bytes, zero));
+          wsum = _mm_add_epi32(wsum, _mm_madd_epi16(_mm_unpacklo_epi8(bytes, zero), weights_low));
+          wsum = _mm_add_epi32(wsum, _mm_madd_epi16(_mm_unpackhi_epi8(bytes, zero), weights_high));
+
+          p += 16U;
+        }
+
+        const uint32_t length = uint32_t(blocks * 16U);
+
+        b += (length * a) + (16U * sum_lanes64(psum)) + sum_lanes32(wsum);
+        a += sum_lanes64(sum);
+
+        n -= length;
+      }
+#endif
+
+      while (n >= 8U)
+      {
+        a += p[0]; b += a;
+        a += p[1]; b += a;
+        a += p[2]; b += a;
+        a += p[3]; b += a;
+        a += p[4]; b += a;
+        a += p[5]; b += a;
+        a += p[6]; b += a;
+        a += p[7]; b += a;
+        p += 8U;
+        n -= 8U;
+      }
+
+      while (n-- != 0U)
+      {
+        a += *p++;
+        b += a;
+      }
+
+      a_ = a;
+      b_ = b;
+    }
+
+    //*************************************************************************
+    /// Adds a range of bytes to a checksum, via the policy's static block kernel.
+    /// Pointers are passed straight to the kernel.
+    //*************************************************************************
+    template <typename TPolicy, typename TValue, typename TIterator>
+    TValue add_range(TValue value, TIterator begin, const TIterator end, etl::true_type)
+    {
+      return TPolicy::add_bytes(value, reinterpret_cast<const uint8_t*>(begin), size_t(end - begin));
+    }
+
+    //*************************************************************************
+    /// Other iterators are copied to the kernel in blocks.
+    //*************************************************************************
+    template <typename TPolicy, typename TValue, typename TIterator>
+    TValue add_range(TValue value, TIterator begin, const TIterator end, etl::false_type)
+    {
+      uint8_t block[64U];
+
+      while (begin != end)
+      {
+        size_t count = 0U;
+
+        while ((count < sizeof(block)) && (begin != end))
+        {
+          block[count++] = uint8_t(*begin++);
+        }
+
+        value = TPolicy::add_bytes(value, block, count);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    template <typename TPolicy, typename TValue, typename TIterator>
+    TValue add_range(TValue value, TIterator begin, const TIterator end)
+    {
+      return add_range<TPolicy>(value, begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+  }
+}
+
+#endif
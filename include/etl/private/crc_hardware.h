@@ -0,0 +1,192 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_HARDWARE_INCLUDED
+#define ETL_CRC_HARDWARE_INCLUDED
+
+#include "../platform.h"
+#include "../frame_check_sequence.h"
+#include "crc_implementation.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Hardware CRC support.
+// Define ETL_CRC_USE_HARDWARE in the profile to allow the use of CRC
+// instructions, when the compiler reports that the target supports them.
+// x86    : SSE4.2 crc32 instructions (CRC32-C only). e.g. -msse4.2
+// ARMv8  : ACLE CRC32 instructions (CRC32 & CRC32-C). e.g. -march=armv8-a+crc
+//*****************************************************************************
+#if defined(ETL_CRC_USE_HARDWARE) && (defined(__SSE4_2__) || defined(__AVX__))
+  #define ETL_CRC_HARDWARE_X86 1
+#else
+  #define ETL_CRC_HARDWARE_X86 0
+#endif
+
+#if defined(ETL_CRC_USE_HARDWARE) && defined(__ARM_FEATURE_CRC32)
+  #define ETL_CRC_HARDWARE_ARM 1
+#else
+  #define ETL_CRC_HARDWARE_ARM 0
+#endif
+
+#define ETL_CRC32_C_HARDWARE_SUPPORTED (ETL_CRC_HARDWARE_X86 || ETL_CRC_HARDWARE_ARM)
+#define ETL_CRC32_HARDWARE_SUPPORTED   (ETL_CRC_HARDWARE_ARM)
+
+#if ETL_CRC_HARDWARE_X86
+  #include <nmmintrin.h>
+#endif
+
+#if ETL_CRC_HARDWARE_ARM
+  #include <arm_acle.h>
+#endif
+
+#if ETL_CRC32_C_HARDWARE_SUPPORTED || ETL_CRC32_HARDWARE_SUPPORTED
+namespace etl
+{
+  namespace private_crc
+  {
+    //*****************************************************************************
+    /// Assembles 8 bytes in to a little endian 64 bit word, regardless of the
+    /// endianness of the target. The compiler reduces this to a single load.
+    //*****************************************************************************
+    inline uint64_t crc_hardware_block(const uint8_t* block)
+    {
+      return  uint64_t(block[0])         | (uint64_t(block[1]) << 8U)  |
+             (uint64_t(block[2]) << 16U) | (uint64_t(block[3]) << 24U) |
+             (uint64_t(block[4]) << 32U) | (uint64_t(block[5]) << 40U) |
+             (uint64_t(block[6]) << 48U) | (uint64_t(block[7]) << 56U);
+    }
+
+    //*****************************************************************************
+    /// Common framework for the hardware policies.
+    /// TCrcParameters describes the CRC the instructions implement.
+    /// TInstructions supplies 'add_byte' and 'add_block' for 8 bytes.
+    //*****************************************************************************
+    template <typename TCrcParameters, typename TInstructions>
+    struct crc32_hardware_policy
+    {
+      typedef TCrcParameters parameters_type;
+      typedef uint32_t accumulator_type;
+      typedef uint32_t value_type;
+
+      // Tells frame_check_sequence that this policy has an optimised range add.
+      typedef void range_add_supported;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return 0xFFFFFFFFUL;
+      }
+
+      //*************************************************************************
+      accumulator_type add(accumulator_type crc, uint8_t value) const
+      {
+        return TInstructions::add_byte(crc, value);
+      }
+
+      //*************************************************************************
+      accumulator_type add_block(accumulator_type crc, const uint8_t* block) const
+      {
+        return TInstructions::add_block(crc, crc_hardware_block(block));
+      }
+
+      //*************************************************************************
+      template <typename TIterator>
+      accumulator_type add(accumulator_type crc, TIterator begin, const TIterator end) const
+      {
+        return crc_add_range<8U>(*this, crc, begin, end);
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ 0xFFFFFFFFUL;
+      }
+    };
+
+#if ETL_CRC32_C_HARDWARE_SUPPORTED
+    //*****************************************************************************
+    /// CRC32-C instructions.
+    //*****************************************************************************
+    struct crc32_c_instructions
+    {
+      //*************************************************************************
+      static uint32_t add_byte(uint32_t crc, uint8_t value)
+      {
+  #if ETL_CRC_HARDWARE_ARM
+        return __crc32cb(crc, value);
+  #else
+        return _mm_crc32_u8(crc, value);
+  #endif
+      }
+
+      //*************************************************************************
+      static uint32_t add_block(uint32_t crc, uint64_t value)
+      {
+  #if ETL_CRC_HARDWARE_ARM
+        return __crc32cd(crc, value);
+  #elif ETL_PLATFORM_64BIT
+        return uint32_t(_mm_crc32_u64(crc, value));
+  #else
+        crc = _mm_crc32_u32(crc, uint32_t(value));
+        return _mm_crc32_u32(crc, uint32_t(value >> 32U));
+  #endif
+      }
+    };
+
+    typedef crc32_hardware_policy<crc32_c_parameters, crc32_c_instructions> crc32_c_hardware_policy;
+#endif
+
+#if ETL_CRC32_HARDWARE_SUPPORTED
+    //*****************************************************************************
+    /// CRC32 instructions.
+    //*****************************************************************************
+    struct crc32_instructions
+    {
+      //*************************************************************************
+      static uint32_t add_byte(uint32_t crc, uint8_t value)
+      {
+        return __crc32b(crc, value);
+      }
+
+      //*************************************************************************
+      static uint32_t add_block(uint32_t crc, uint64_t value)
+      {
+        return __crc32d(crc, value);
+      }
+    };
+
+    typedef crc32_hardware_policy<crc32_parameters, crc32_instructions> crc32_ieee_hardware_policy;
+#endif
+  }
+}
+#endif
+
+#endif
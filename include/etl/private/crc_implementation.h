@@ -36,6 +36,7 @@ SOFTWARE.
 #include "../static_assert.h"
 #include "../binary.h"
 #include "../type_traits.h"
+#include "../iterator.h"
 
 #include "stdint.h"
 
@@ -133,7 +134,7 @@ namespace etl
     // Accumulator_Bits > Chunk_Bits
     // Not Reflected
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, bool Reflect>
-    static
+    static ETL_CONSTEXPR14
     typename etl::enable_if<(Accumulator_Bits > Chunk_Bits) && !Reflect, TAccumulator>::type
       crc_update_chunk(TAccumulator crc, uint8_t value, const TAccumulator table[])
     {
@@ -151,7 +152,7 @@ namespace etl
     // Accumulator_Bits > Chunk_Bits
     // Reflected
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, bool Reflect>
-    static
+    static ETL_CONSTEXPR14
     typename etl::enable_if<(Accumulator_Bits > Chunk_Bits) && Reflect, TAccumulator>::type
       crc_update_chunk(TAccumulator crc, uint8_t value, const TAccumulator table[])
     {
@@ -169,7 +170,7 @@ namespace etl
     // Accumulator_Bits == Chunk_Bits
     // Not Reflected
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, bool Reflect>
-    static
+    static ETL_CONSTEXPR14
     typename etl::enable_if<(Accumulator_Bits == Chunk_Bits) && !Reflect, TAccumulator>::type
       crc_update_chunk(TAccumulator crc, uint8_t value, const TAccumulator table[])
     {
@@ -186,7 +187,7 @@ namespace etl
     // Accumulator_Bits == Chunk_Bits
     // Reflected
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, bool Reflect>
-    static
+    static ETL_CONSTEXPR14
     typename etl::enable_if<(Accumulator_Bits == Chunk_Bits) && Reflect, TAccumulator>::type
       crc_update_chunk(TAccumulator crc, uint8_t value, const TAccumulator table[])
     {
@@ -210,17 +211,11 @@ namespace etl
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
     struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 4U>
     {
+      static const TAccumulator table[4U];
+
       //*************************************************************************
-      TAccumulator add(TAccumulator crc, uint8_t value) const
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
       {
-        static ETL_CONSTANT TAccumulator table[4U] =
-        {
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value
-        };
-        
         if ETL_IF_CONSTEXPR(Reflect)
         {
           crc = crc_update_chunk<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Reflect>(crc, value, table);
@@ -240,34 +235,25 @@ namespace etl
       }
     };
 
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTEXPR const TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 4U>::table[4U] =
+    {
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value
+    };
+
     //*********************************
     // Table size of 16.
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
     struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 16U>
     {
+      static const TAccumulator table[16U];
+
       //*************************************************************************
-      TAccumulator add(TAccumulator crc, uint8_t value) const
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
       {
-        static ETL_CONSTANT TAccumulator table[16U] =
-        {
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Chunk_Bits>::value
-        };
-
         if ETL_IF_CONSTEXPR(Reflect)
         {
           crc = crc_update_chunk<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Reflect>(crc, value, table);
@@ -283,280 +269,754 @@ namespace etl
       }
     };
 
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTEXPR const TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 16U>::table[16U] =
+    {
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Chunk_Bits>::value
+    };
+
     //*********************************
     // Table size of 256.
     template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
     struct crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>
     {
+      static const TAccumulator table[256U];
+
       //*************************************************************************
-      TAccumulator add(TAccumulator crc, uint8_t value) const
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
       {
-        static ETL_CONSTANT TAccumulator table[256U] =
-        {
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 17U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 18U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 19U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 20U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 21U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 22U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 23U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 24U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 25U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 26U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 27U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 28U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 29U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 30U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 31U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 32U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 33U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 34U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 35U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 36U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 37U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 38U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 39U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 40U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 41U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 42U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 43U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 44U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 45U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 46U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 47U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 48U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 49U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 50U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 51U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 52U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 53U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 54U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 55U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 56U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 57U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 58U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 59U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 60U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 61U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 62U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 63U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 64U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 65U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 66U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 67U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 68U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 69U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 70U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 71U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 72U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 73U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 74U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 75U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 76U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 77U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 78U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 79U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 80U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 81U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 82U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 83U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 84U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 85U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 86U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 87U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 88U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 89U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 90U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 91U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 92U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 93U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 94U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 95U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 96U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 97U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 98U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 99U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 100U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 101U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 102U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 103U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 104U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 105U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 106U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 107U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 108U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 109U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 110U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 111U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 112U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 113U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 114U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 115U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 116U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 117U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 118U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 119U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 120U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 121U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 122U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 123U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 124U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 125U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 126U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 127U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 129U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 130U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 131U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 132U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 133U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 134U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 135U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 136U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 137U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 138U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 139U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 140U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 141U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 142U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 143U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 144U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 145U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 146U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 147U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 148U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 149U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 150U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 151U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 152U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 153U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 154U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 155U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 156U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 157U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 158U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 159U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 160U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 161U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 162U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 163U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 164U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 165U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 166U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 167U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 168U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 169U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 170U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 171U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 172U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 173U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 174U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 175U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 176U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 177U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 178U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 179U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 180U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 181U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 182U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 183U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 184U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 185U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 186U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 187U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 188U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 189U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 190U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 191U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 192U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 193U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 194U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 195U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 196U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 197U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 198U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 199U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 200U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 201U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 202U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 203U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 204U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 205U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 206U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 207U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 208U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 209U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 210U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 211U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 212U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 213U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 214U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 215U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 216U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 217U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 218U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 219U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 220U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 221U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 222U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 223U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 224U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 225U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 226U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 227U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 228U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 229U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 230U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 231U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 232U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 233U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 234U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 235U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 236U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 237U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 238U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 239U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 240U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 241U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 242U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 243U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 244U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 245U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 246U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 247U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 248U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 249U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 250U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 251U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 252U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 253U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Chunk_Bits>::value,
-          crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Chunk_Bits>::value
-        };
-
         crc = crc_update_chunk<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Reflect>(crc, value, table);
 
         return crc;
       }
     };
 
+    template <typename TAccumulator, size_t Accumulator_Bits, size_t Chunk_Bits, uint8_t Chunk_Mask, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTEXPR const TAccumulator crc_table<TAccumulator, Accumulator_Bits, Chunk_Bits, Chunk_Mask, Polynomial, Reflect, 256U>::table[256U] =
+    {
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 17U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 18U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 19U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 20U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 21U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 22U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 23U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 24U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 25U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 26U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 27U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 28U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 29U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 30U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 31U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 32U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 33U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 34U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 35U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 36U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 37U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 38U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 39U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 40U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 41U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 42U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 43U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 44U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 45U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 46U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 47U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 48U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 49U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 50U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 51U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 52U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 53U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 54U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 55U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 56U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 57U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 58U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 59U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 60U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 61U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 62U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 63U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 64U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 65U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 66U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 67U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 68U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 69U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 70U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 71U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 72U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 73U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 74U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 75U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 76U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 77U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 78U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 79U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 80U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 81U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 82U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 83U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 84U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 85U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 86U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 87U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 88U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 89U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 90U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 91U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 92U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 93U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 94U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 95U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 96U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 97U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 98U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 99U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 100U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 101U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 102U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 103U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 104U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 105U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 106U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 107U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 108U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 109U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 110U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 111U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 112U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 113U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 114U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 115U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 116U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 117U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 118U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 119U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 120U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 121U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 122U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 123U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 124U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 125U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 126U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 127U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 129U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 130U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 131U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 132U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 133U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 134U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 135U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 136U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 137U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 138U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 139U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 140U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 141U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 142U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 143U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 144U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 145U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 146U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 147U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 148U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 149U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 150U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 151U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 152U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 153U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 154U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 155U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 156U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 157U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 158U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 159U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 160U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 161U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 162U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 163U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 164U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 165U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 166U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 167U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 168U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 169U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 170U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 171U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 172U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 173U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 174U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 175U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 176U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 177U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 178U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 179U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 180U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 181U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 182U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 183U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 184U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 185U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 186U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 187U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 188U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 189U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 190U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 191U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 192U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 193U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 194U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 195U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 196U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 197U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 198U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 199U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 200U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 201U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 202U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 203U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 204U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 205U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 206U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 207U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 208U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 209U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 210U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 211U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 212U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 213U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 214U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 215U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 216U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 217U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 218U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 219U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 220U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 221U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 222U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 223U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 224U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 225U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 226U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 227U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 228U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 229U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 230U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 231U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 232U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 233U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 234U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 235U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 236U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 237U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 238U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 239U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 240U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 241U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 242U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 243U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 244U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 245U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 246U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 247U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 248U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 249U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 250U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 251U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 252U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 253U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Chunk_Bits>::value,
+      crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Chunk_Bits>::value
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC of byte 'Index' followed by 'Slice' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+      static ETL_CONSTANT size_t       Next     = Reflect ? size_t(Previous & 0xFFU) : size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = Reflect ? TAccumulator(TAccumulator(Previous >> 4U) >> 4U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Next, 8U>::value
+                                                       : TAccumulator(TAccumulator(Previous << 4U) << 4U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Next, 8U>::value;
+    };
+
+    //*********************************
+    // Slice zero is the standard 256 entry table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Table
+    /// One of the 256 entry tables used by the slice-by-N algorithm.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    struct crc_slice_table
+    {
+      static const TAccumulator table[256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice>
+    ETL_CONSTEXPR const TAccumulator crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice>::table[256U] =
+    {
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 1U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 2U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 3U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 4U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 5U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 6U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 7U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 9U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 10U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 11U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 12U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 13U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 14U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 15U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 17U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 18U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 19U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 20U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 21U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 22U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 23U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 24U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 25U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 26U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 27U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 28U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 29U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 30U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 31U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 32U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 33U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 34U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 35U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 36U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 37U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 38U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 39U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 40U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 41U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 42U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 43U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 44U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 45U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 46U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 47U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 48U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 49U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 50U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 51U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 52U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 53U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 54U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 55U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 56U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 57U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 58U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 59U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 60U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 61U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 62U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 63U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 64U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 65U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 66U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 67U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 68U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 69U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 70U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 71U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 72U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 73U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 74U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 75U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 76U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 77U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 78U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 79U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 80U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 81U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 82U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 83U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 84U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 85U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 86U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 87U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 88U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 89U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 90U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 91U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 92U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 93U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 94U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 95U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 96U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 97U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 98U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 99U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 100U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 101U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 102U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 103U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 104U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 105U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 106U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 107U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 108U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 109U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 110U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 111U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 112U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 113U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 114U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 115U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 116U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 117U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 118U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 119U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 120U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 121U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 122U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 123U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 124U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 125U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 126U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 127U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 128U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 129U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 130U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 131U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 132U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 133U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 134U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 135U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 136U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 137U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 138U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 139U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 140U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 141U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 142U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 143U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 144U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 145U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 146U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 147U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 148U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 149U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 150U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 151U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 152U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 153U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 154U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 155U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 156U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 157U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 158U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 159U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 160U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 161U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 162U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 163U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 164U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 165U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 166U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 167U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 168U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 169U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 170U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 171U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 172U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 173U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 174U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 175U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 176U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 177U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 178U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 179U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 180U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 181U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 182U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 183U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 184U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 185U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 186U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 187U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 188U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 189U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 190U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 191U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 192U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 193U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 194U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 195U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 196U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 197U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 198U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 199U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 200U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 201U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 202U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 203U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 204U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 205U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 206U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 207U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 208U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 209U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 210U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 211U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 212U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 213U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 214U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 215U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 216U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 217U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 218U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 219U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 220U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 221U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 222U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 223U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 224U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 225U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 226U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 227U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 228U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 229U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 230U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 231U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 232U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 233U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 234U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 235U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 236U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 237U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 238U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 239U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 240U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 241U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 242U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 243U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 244U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 245U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 246U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 247U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 248U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 249U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 250U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 251U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 252U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 253U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 254U, Slice>::value,
+      crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 255U, Slice>::value
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Byte
+    /// Gets the byte of the CRC that is combined with the data byte at 'Index'.
+    /// Returns zero if the accumulator has fewer than 'Index + 1' bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Index, bool In_Range = (Index < (Accumulator_Bits / 8U))>
+    struct crc_slice_byte
+    {
+      static ETL_CONSTEXPR uint8_t get(TAccumulator crc)
+      {
+        return Reflect ? uint8_t(crc >> (Index * 8U))
+                       : uint8_t(crc >> (Accumulator_Bits - ((Index + 1U) * 8U)));
+      }
+    };
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Index>
+    struct crc_slice_byte<TAccumulator, Accumulator_Bits, Reflect, Index, false>
+    {
+      static ETL_CONSTEXPR uint8_t get(TAccumulator)
+      {
+        return 0U;
+      }
+    };
+
+    //*****************************************************************************
+    /// CRC Slice Step
+    /// Unrolls the table lookups for a block of 'Slices' bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices, size_t Index>
+    struct crc_slice_step
+    {
+      static ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, const uint8_t* block)
+      {
+        const uint8_t value = block[Index] ^ crc_slice_byte<TAccumulator, Accumulator_Bits, Reflect, Index>::get(crc);
+
+        return crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices - 1U - Index>::table[value] ^
+               crc_slice_step<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Index + 1U>::add(crc, block);
+      }
+    };
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_step<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, Slices>
+    {
+      static ETL_CONSTEXPR TAccumulator add(TAccumulator, const uint8_t*)
+      {
+        return TAccumulator(0U);
+      }
+    };
+
+    //*****************************************************************************
+    /// Adds a range to a CRC, 'Block_Size' bytes at a time where possible.
+    /// TPolicy supplies add(crc, value) and add_block(crc, const uint8_t* block).
+    //*****************************************************************************
+    template <size_t Block_Size, typename TPolicy, typename TAccumulator, typename TIterator>
+    ETL_CONSTEXPR14 TAccumulator crc_add_range(const TPolicy& policy, TAccumulator crc, TIterator begin, const TIterator end, ETL_OR_STD::random_access_iterator_tag)
+    {
+      uint8_t block[Block_Size] = {};
+
+      while ((end - begin) >= typename etl::iterator_traits<TIterator>::difference_type(Block_Size))
+      {
+        for (size_t i = 0U; i < Block_Size; ++i)
+        {
+          block[i] = uint8_t(begin[i]);
+        }
+
+        crc    = policy.add_block(crc, block);
+        begin += Block_Size;
+      }
+
+      while (begin != end)
+      {
+        crc = policy.add(crc, uint8_t(*begin++));
+      }
+
+      return crc;
+    }
+
+    //*********************************
+    template <size_t Block_Size, typename TPolicy, typename TAccumulator, typename TIterator, typename TIteratorCategory>
+    ETL_CONSTEXPR14 TAccumulator crc_add_range(const TPolicy& policy, TAccumulator crc, TIterator begin, const TIterator end, TIteratorCategory)
+    {
+      uint8_t block[Block_Size] = {};
+
+      while (begin != end)
+      {
+        size_t count = 0U;
+
+        while ((count < Block_Size) && (begin != end))
+        {
+          block[count++] = uint8_t(*begin++);
+        }
+
+        if (count == Block_Size)
+        {
+          crc = policy.add_block(crc, block);
+        }
+        else
+        {
+          for (size_t i = 0U; i < count; ++i)
+          {
+            crc = policy.add(crc, block[i]);
+          }
+        }
+      }
+
+      return crc;
+    }
+
+    //*********************************
+    template <size_t Block_Size, typename TPolicy, typename TAccumulator, typename TIterator>
+    ETL_CONSTEXPR14 TAccumulator crc_add_range(const TPolicy& policy, TAccumulator crc, TIterator begin, const TIterator end)
+    {
+      return crc_add_range<Block_Size>(policy, crc, begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*****************************************************************************
+    /// CRC Slice Tables
+    /// Processes 'Slices' bytes per iteration using 'Slices' tables of 256 entries.
+    /// The accumulator is never wider than the block, so the remaining CRC bits
+    /// are entirely folded into the lookups.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_tables
+    {
+      ETL_STATIC_ASSERT((Accumulator_Bits / 8U) <= Slices, "Accumulator is wider than the slice block");
+
+      // Tells frame_check_sequence that this policy has an optimised range add.
+      typedef void range_add_supported;
+
+      //*************************************************************************
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U>::table);
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR14 TAccumulator add_block(TAccumulator crc, const uint8_t* block) const
+      {
+        return crc_slice_step<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices, 0U>::add(crc, block);
+      }
+
+      //*************************************************************************
+      template <typename TIterator>
+      ETL_CONSTEXPR14 TAccumulator add(TAccumulator crc, TIterator begin, const TIterator end) const
+      {
+        return crc_add_range<Slices>(*this, crc, begin, end);
+      }
+    };
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
@@ -574,6 +1034,7 @@ namespace etl
                                                                TCrcParameters::Reflect, 
                                                                256U> 
     {
+      typedef TCrcParameters                            parameters_type;
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
 
@@ -585,7 +1046,7 @@ namespace etl
       }
 
       //*************************************************************************
-      accumulator_type final(accumulator_type crc) const
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
       {
         return crc ^ TCrcParameters::Xor_Out;
       }
@@ -602,6 +1063,7 @@ namespace etl
                                                               TCrcParameters::Reflect, 
                                                               16U> 
     {
+      typedef TCrcParameters                            parameters_type;
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
 
@@ -613,7 +1075,7 @@ namespace etl
       }
 
       //*************************************************************************
-      accumulator_type final(accumulator_type crc) const
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
       {
         return crc ^ TCrcParameters::Xor_Out;
       }
@@ -630,6 +1092,61 @@ namespace etl
                                                              TCrcParameters::Reflect, 
                                                              4U> 
     {
+      typedef TCrcParameters                            parameters_type;
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slice-by-16, 16 tables of 256 entries.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_tables<typename TCrcParameters::accumulator_type,
+                                                                  TCrcParameters::Accumulator_Bits,
+                                                                  TCrcParameters::Polynomial,
+                                                                  TCrcParameters::Reflect,
+                                                                  16U>
+    {
+      typedef TCrcParameters                            parameters_type;
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slice-by-8, 8 tables of 256 entries.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_tables<typename TCrcParameters::accumulator_type,
+                                                                  TCrcParameters::Accumulator_Bits,
+                                                                  TCrcParameters::Polynomial,
+                                                                  TCrcParameters::Reflect,
+                                                                  8U>
+    {
+      typedef TCrcParameters                            parameters_type;
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
 
@@ -641,27 +1158,123 @@ namespace etl
       }
 
       //*************************************************************************
-      accumulator_type final(accumulator_type crc) const
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
       {
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+    //*****************************************************************************
+    /// GF(2) polynomial arithmetic modulo the CRC polynomial, in the bit order
+    /// of the CRC register. Used by crc_combine.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_gf2
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// The polynomial '1'.
+      //*************************************************************************
+      static accumulator_type one()
+      {
+        return TCrcParameters::Reflect ? accumulator_type(accumulator_type(1U) << (Bits - 1U)) : accumulator_type(1U);
+      }
+
+      //*************************************************************************
+      /// Multiplies by 'x', i.e. advances the register by one zero bit.
+      //*************************************************************************
+      static accumulator_type times_x(accumulator_type value)
+      {
+        if (TCrcParameters::Reflect)
+        {
+          const bool do_poly = (value & accumulator_type(1U)) != 0U;
+          value = accumulator_type(value >> 1U);
+
+          return do_poly ? accumulator_type(value ^ etl::reverse_bits_const<accumulator_type, TCrcParameters::Polynomial>::value) : value;
+        }
+        else
+        {
+          const bool do_poly = (value & accumulator_type(accumulator_type(1U) << (Bits - 1U))) != 0U;
+          value = accumulator_type(value << 1U);
+
+          return do_poly ? accumulator_type(value ^ TCrcParameters::Polynomial) : value;
+        }
+      }
+
+      //*************************************************************************
+      /// Multiplies two polynomials.
+      //*************************************************************************
+      static accumulator_type multiply(accumulator_type a, accumulator_type b)
+      {
+        accumulator_type result = 0U;
+
+        // Horner's method, highest order term of 'b' first.
+        for (size_t i = 0U; i < Bits; ++i)
+        {
+          const size_t bit = TCrcParameters::Reflect ? i : (Bits - 1U - i);
+
+          result = times_x(result);
+
+          if (((b >> bit) & 1U) != 0U)
+          {
+            result ^= a;
+          }
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Calculates x^(8 * n) modulo the polynomial.
+      //*************************************************************************
+      static accumulator_type x_pow_8n(size_t n)
+      {
+        accumulator_type x8 = one();
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          x8 = times_x(x8);
+        }
+
+        accumulator_type result = one();
+
+        while (n != 0U)
+        {
+          if ((n & 1U) != 0U)
+          {
+            result = multiply(result, x8);
+          }
+
+          x8 = multiply(x8, x8);
+          n >>= 1U;
+        }
+
+        return result;
+      }
+    };
   }
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
+  /// Table_Size selects the algorithm.
+  /// 4, 16 & 256 process one byte per iteration using 2, 4 or 8 bit chunks.
+  /// 2048 & 4096 process 8 or 16 bytes per iteration (slice-by-8 & slice-by-16).
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
   class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U),
+                      "Table size must be 4, 16, 256, 2048 (slice-by-8) or 4096 (slice-by-16)");
 
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
-    crc_type()
+    ETL_CONSTEXPR14 crc_type()
     {
       this->reset();
     }
@@ -672,12 +1285,38 @@ namespace etl
     /// \param end   End of the range.
     //*************************************************************************
     template<typename TIterator>
-    crc_type(TIterator begin, const TIterator end)
+    ETL_CONSTEXPR14 crc_type(TIterator begin, const TIterator end)
     {
       this->reset();
       this->add(begin, end);
     }
   };
+
+  //*****************************************************************************
+  /// Combines the CRCs of two consecutive blocks.
+  /// Returns the CRC of block 1 followed by block 2, given only the CRC of each
+  /// block and the length of block 2. The cost is O(log(length2)).
+  ///\tparam TCrc The CRC type. e.g. etl::crc32
+  ///\param crc1    The CRC of the first block.
+  ///\param crc2    The CRC of the second block.
+  ///\param length2 The length of the second block, in bytes.
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc1, typename TCrc::value_type crc2, size_t length2)
+  {
+    typedef typename TCrc::policy_type::parameters_type parameters_type;
+    typedef typename TCrc::value_type                   value_type;
+    typedef private_crc::crc_gf2<parameters_type>       gf2;
+
+    const value_type initial = parameters_type::Reflect ? etl::reverse_bits_const<value_type, parameters_type::Initial>::value
+                                                        : parameters_type::Initial;
+
+    // Remove block 1's output xor, replace the initial value that block 2 started from
+    // with block 1's register, and advance it over block 2's length.
+    value_type state = value_type(crc1 ^ parameters_type::Xor_Out ^ initial);
+
+    return value_type(gf2::multiply(state, gf2::x_pow_8n(length2)) ^ crc2);
+  }
 }
 
 #endif
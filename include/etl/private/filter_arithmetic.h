@@ -0,0 +1,190 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FILTER_ARITHMETIC_INCLUDED
+#define ETL_FILTER_ARITHMETIC_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../fixed_point.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// The FIR filter calculates its outputs in tiles of eight. For float, SSE2 or
+// NEON is used when the compiler reports that the target supports it, unless
+// ETL_FILTER_NO_SIMD is defined, as compilers do not reliably vectorise the
+// generic code at every optimisation level.
+//*****************************************************************************
+#if !defined(ETL_FILTER_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_FILTER_SIMD_SSE2 1
+#else
+  #define ETL_FILTER_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_FILTER_NO_SIMD) && !ETL_FILTER_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_FILTER_SIMD_NEON 1
+#else
+  #define ETL_FILTER_SIMD_NEON 0
+#endif
+
+#if ETL_FILTER_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_FILTER_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_filter
+  {
+    //*************************************************************************
+    /// How the filters multiply samples by coefficients and add the products.
+    /// Built in types use their own arithmetic.
+    //*************************************************************************
+    template <typename TValue, typename TCoefficient>
+    struct arithmetic
+    {
+      typedef TValue accumulator_type;
+
+      static accumulator_type multiply(TValue sample, TCoefficient coefficient)
+      {
+        return accumulator_type(sample * coefficient);
+      }
+
+      static TValue result(accumulator_type accumulator)
+      {
+        return TValue(accumulator);
+      }
+    };
+
+    //*************************************************************************
+    /// Fixed point products are summed exactly in a wide integer and rounded
+    /// and saturated once, at the end.
+    /// The coefficients may have a different format to the samples, so that
+    /// coefficients above one, as biquads need, can be held.
+    //*************************************************************************
+    template <size_t Integral_Bits,   size_t Fractional_Bits,   typename TStorage,   etl::fixed_point_rounding::enum_type Rounding,
+              size_t C_Integral_Bits, size_t C_Fractional_Bits, typename C_TStorage, etl::fixed_point_rounding::enum_type C_Rounding>
+    struct arithmetic<etl::fixed_point<Integral_Bits,   Fractional_Bits,   TStorage,   Rounding>,
+                      etl::fixed_point<C_Integral_Bits, C_Fractional_Bits, C_TStorage, C_Rounding> >
+    {
+      typedef etl::fixed_point<Integral_Bits, Fractional_Bits, TStorage, Rounding> value_type;
+
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<etl::is_signed<TStorage>::value || etl::is_signed<C_TStorage>::value, int64_t, uint64_t>::type accumulator_type;
+#else
+      typedef typename etl::conditional<etl::is_signed<TStorage>::value || etl::is_signed<C_TStorage>::value, int32_t, uint32_t>::type accumulator_type;
+#endif
+
+      static accumulator_type multiply(value_type sample, etl::fixed_point<C_Integral_Bits, C_Fractional_Bits, C_TStorage, C_Rounding> coefficient)
+      {
+        return accumulator_type(sample.raw()) * accumulator_type(coefficient.raw());
+      }
+
+      static value_type result(accumulator_type accumulator)
+      {
+        const accumulator_type raw = private_fixed_point::shift_round<Rounding>(accumulator, C_Fractional_Bits);
+
+        if (raw > accumulator_type(value_type::Raw_Max))
+        {
+          return value_type::max();
+        }
+        else if (raw < accumulator_type(value_type::Raw_Min))
+        {
+          return value_type::min();
+        }
+        else
+        {
+          return value_type::from_raw(TStorage(raw));
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Whether there is a tile kernel for the types.
+    //*************************************************************************
+    template <typename TValue, typename TCoefficient>
+    struct has_tile_kernel
+    {
+      static ETL_CONSTANT bool value = (ETL_FILTER_SIMD_SSE2 || ETL_FILTER_SIMD_NEON) &&
+                                       etl::is_same<TValue, float>::value &&
+                                       etl::is_same<TCoefficient, float>::value;
+    };
+
+    //*************************************************************************
+    /// Eight sums of products of float.
+    /// sums[j] = samples[j].coefficients[0] + samples[j + 1].coefficients[1] + ...
+    /// Each lane adds its products in order, like the scalar code.
+    //*************************************************************************
+    inline void tile_kernel(const float* samples, const float* coefficients, size_t n, float* sums)
+    {
+#if ETL_FILTER_SIMD_SSE2
+      __m128 sum0 = _mm_setzero_ps();
+      __m128 sum1 = _mm_setzero_ps();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const __m128 c = _mm_set1_ps(coefficients[i]);
+
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(samples + i),      c));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(samples + i + 4U), c));
+      }
+
+      _mm_storeu_ps(sums,      sum0);
+      _mm_storeu_ps(sums + 4U, sum1);
+#elif ETL_FILTER_SIMD_NEON
+      float32x4_t sum0 = vdupq_n_f32(0.0f);
+      float32x4_t sum1 = vdupq_n_f32(0.0f);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const float32x4_t c = vdupq_n_f32(coefficients[i]);
+
+        sum0 = vaddq_f32(sum0, vmulq_f32(vld1q_f32(samples + i),      c));
+        sum1 = vaddq_f32(sum1, vmulq_f32(vld1q_f32(samples + i + 4U), c));
+      }
+
+      vst1q_f32(sums,      sum0);
+      vst1q_f32(sums + 4U, sum1);
+#else
+      (void)samples;
+      (void)coefficients;
+      (void)n;
+      (void)sums;
+#endif
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,225 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_POINT_KERNELS_INCLUDED
+#define ETL_FIXED_POINT_KERNELS_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Block kernels for arrays of 16 bit fixed point values, such as Q15.
+// They work on the raw int16_t values and stop at a multiple of 8, leaving
+// the rest for the scalar code. Sums saturate at the limits of int16_t.
+// Products are rounded with 'floor' or 'half up' and saturated, exactly as
+// etl::fixed_point does.
+// SSE2 or NEON versions are used when the compiler reports that the target
+// supports them, unless ETL_FIXED_POINT_NO_SIMD is defined.
+//*****************************************************************************
+#if !defined(ETL_FIXED_POINT_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_FIXED_POINT_SIMD_SSE2 1
+#else
+  #define ETL_FIXED_POINT_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_FIXED_POINT_NO_SIMD) && !ETL_FIXED_POINT_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_FIXED_POINT_SIMD_NEON 1
+#else
+  #define ETL_FIXED_POINT_SIMD_NEON 0
+#endif
+
+#if ETL_FIXED_POINT_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_FIXED_POINT_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_fixed_point
+  {
+#if ETL_FIXED_POINT_SIMD_SSE2
+    //*************************************************************************
+    /// Multiplies eight pairs, shifting each 32 bit product right.
+    /// For 'half up' rounding, half is added, less one for negative products,
+    /// so that ties round away from zero.
+    //*************************************************************************
+    inline __m128i sse2_multiply(__m128i a, __m128i b, __m128i shift, __m128i half, bool round_half_up)
+    {
+      const __m128i lo = _mm_mullo_epi16(a, b);
+      const __m128i hi = _mm_mulhi_epi16(a, b);
+
+      __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+      __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+      if (round_half_up)
+      {
+        p0 = _mm_add_epi32(_mm_add_epi32(p0, half), _mm_srai_epi32(p0, 31));
+        p1 = _mm_add_epi32(_mm_add_epi32(p1, half), _mm_srai_epi32(p1, 31));
+      }
+
+      return _mm_packs_epi32(_mm_sra_epi32(p0, shift), _mm_sra_epi32(p1, shift));
+    }
+#endif
+
+#if ETL_FIXED_POINT_SIMD_NEON
+    //*************************************************************************
+    /// Multiplies four pairs, shifting each 32 bit product right.
+    //*************************************************************************
+    inline int16x4_t neon_multiply(int16x4_t a, int16x4_t b, int32x4_t shift, int32x4_t half, bool round_half_up)
+    {
+      int32x4_t p = vmull_s16(a, b);
+
+      if (round_half_up)
+      {
+        p = vaddq_s32(vaddq_s32(p, half), vshrq_n_s32(p, 31));
+      }
+
+      return vqmovn_s32(vshlq_s32(p, shift));
+    }
+#endif
+
+    //*************************************************************************
+    /// Saturating sums.
+    /// Returns the number of values done.
+    //*************************************************************************
+    inline size_t add_int16(const int16_t* a, const int16_t* b, int16_t* result, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_FIXED_POINT_SIMD_SSE2
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_adds_epi16(va, vb));
+      }
+#elif ETL_FIXED_POINT_SIMD_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        vst1q_s16(result + i, vqaddq_s16(vld1q_s16(a + i), vld1q_s16(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)result;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Saturating differences.
+    /// Returns the number of values done.
+    //*************************************************************************
+    inline size_t subtract_int16(const int16_t* a, const int16_t* b, int16_t* result, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_FIXED_POINT_SIMD_SSE2
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_subs_epi16(va, vb));
+      }
+#elif ETL_FIXED_POINT_SIMD_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        vst1q_s16(result + i, vqsubq_s16(vld1q_s16(a + i), vld1q_s16(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)result;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Rounded, saturating products of values with the given number of
+    /// fractional bits.
+    /// Returns the number of values done.
+    //*************************************************************************
+    inline size_t multiply_int16(const int16_t* a, const int16_t* b, int16_t* result, size_t n, int fractional_bits, bool round_half_up)
+    {
+      size_t i = 0U;
+
+      // Nothing to round when there are no fractional bits.
+      round_half_up = round_half_up && (fractional_bits != 0);
+
+#if ETL_FIXED_POINT_SIMD_SSE2
+      const __m128i shift = _mm_cvtsi32_si128(fractional_bits);
+      const __m128i half  = _mm_set1_epi32(round_half_up ? (1 << (fractional_bits - 1)) : 0);
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), sse2_multiply(va, vb, shift, half, round_half_up));
+      }
+#elif ETL_FIXED_POINT_SIMD_NEON
+      const int32x4_t shift = vdupq_n_s32(-fractional_bits);
+      const int32x4_t half  = vdupq_n_s32(round_half_up ? (1 << (fractional_bits - 1)) : 0);
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const int16x8_t va = vld1q_s16(a + i);
+        const int16x8_t vb = vld1q_s16(b + i);
+
+        const int16x4_t r0 = neon_multiply(vget_low_s16(va),  vget_low_s16(vb),  shift, half, round_half_up);
+        const int16x4_t r1 = neon_multiply(vget_high_s16(va), vget_high_s16(vb), shift, half, round_half_up);
+
+        vst1q_s16(result + i, vcombine_s16(r0, r1));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)result;
+      (void)n;
+      (void)fractional_bits;
+#endif
+
+      return i;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,1220 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_TABLE_INCLUDED
+#define ETL_FLAT_HASH_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../type_traits.h"
+#include "../functional.h"
+#include "../parameter_type.h"
+#include "../binary.h"
+#include "../power.h"
+#include "../placement_new.h"
+#include "../debug_count.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// The open addressing hash table used by etl::flat_hash_map and
+// etl::flat_hash_set.
+//
+// Each slot has a control byte that is either 'empty', 'deleted' or holds
+// the low 7 bits of the hash of the element in the slot. Slots are probed a
+// group at a time, the control bytes for the group being compared with the
+// hash in parallel. SSE2 is used for 16 slot groups when the compiler reports
+// that the target supports it, unless ETL_FLAT_HASH_NO_SIMD is defined.
+// Otherwise, 8 slot groups are compared in a 64 bit word.
+//*****************************************************************************
+#if !defined(ETL_FLAT_HASH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_FLAT_HASH_SIMD_SSE2 1
+#else
+  #define ETL_FLAT_HASH_SIMD_SSE2 0
+#endif
+
+#if ETL_FLAT_HASH_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    typedef int8_t ctrl_t;
+
+    static ETL_CONSTANT ctrl_t Ctrl_Empty   = -128; // 0b10000000
+    static ETL_CONSTANT ctrl_t Ctrl_Deleted = -2;   // 0b11111110
+
+    //*************************************************************************
+    /// The index of the lowest set bit.
+    //*************************************************************************
+    inline size_t lowest_bit(uint32_t value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(__builtin_ctz(value));
+#else
+      return size_t(etl::count_trailing_zeros(value));
+#endif
+    }
+
+#if ETL_USING_64BIT_TYPES
+    inline size_t lowest_bit(uint64_t value)
+    {
+  #if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(__builtin_ctzll(value));
+  #else
+      return size_t(etl::count_trailing_zeros(value));
+  #endif
+    }
+#endif
+
+#if ETL_FLAT_HASH_SIMD_SSE2
+    //*************************************************************************
+    /// A group of 16 control bytes, compared with SSE2.
+    /// Each bit of a mask is one slot.
+    //*************************************************************************
+    struct group
+    {
+      typedef uint32_t mask_t;
+
+      static ETL_CONSTANT size_t Width = 16U;
+
+      explicit group(const ctrl_t* pctrl)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pctrl)))
+      {
+      }
+
+      mask_t match(ctrl_t h2) const
+      {
+        return mask_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+      }
+
+      mask_t match_empty() const
+      {
+        return mask_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(Ctrl_Empty), ctrl)));
+      }
+
+      mask_t match_empty_or_deleted() const
+      {
+        return mask_t(_mm_movemask_epi8(ctrl));
+      }
+
+      static size_t lowest(mask_t mask)
+      {
+        return lowest_bit(mask);
+      }
+
+      __m128i ctrl;
+    };
+#else
+    //*************************************************************************
+    /// A group of control bytes, compared within a word.
+    /// The top bit of each byte of a mask is one slot.
+    /// 'match' may report false positives, which the key compare rejects.
+    //*************************************************************************
+    struct group
+    {
+  #if ETL_USING_64BIT_TYPES
+      typedef uint64_t mask_t;
+  #else
+      typedef uint32_t mask_t;
+  #endif
+
+      static ETL_CONSTANT size_t Width = sizeof(mask_t);
+
+      explicit group(const ctrl_t* pctrl)
+        : ctrl(0U)
+      {
+        // The first slot is in the low byte, whatever the platform.
+  #if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_MSC_VER)
+        memcpy(&ctrl, pctrl, sizeof(ctrl));
+  #else
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          ctrl |= mask_t(uint8_t(pctrl[i])) << (8U * i);
+        }
+  #endif
+      }
+
+      mask_t match(ctrl_t h2) const
+      {
+        const mask_t x = ctrl ^ (lsbs() * uint8_t(h2));
+
+        return (x - lsbs()) & ~x & msbs();
+      }
+
+      mask_t match_empty() const
+      {
+        // Only 'empty' has the top bit set and bit 1 clear.
+        return ctrl & ~(ctrl << 6U) & msbs();
+      }
+
+      mask_t match_empty_or_deleted() const
+      {
+        return ctrl & msbs();
+      }
+
+      static size_t lowest(mask_t mask)
+      {
+        return lowest_bit(mask) >> 3U;
+      }
+
+      static mask_t lsbs()
+      {
+        return mask_t(~mask_t(0U)) / 0xFFU;
+      }
+
+      static mask_t msbs()
+      {
+        return lsbs() << 7U;
+      }
+
+      mask_t ctrl;
+    };
+#endif
+
+    //*************************************************************************
+    /// Mixes the bits of the hash, so that keys with poor hashes, such as
+    /// integers, spread over the groups.
+    //*************************************************************************
+    template <size_t Size = sizeof(size_t)>
+    struct mixer
+    {
+      static size_t mix(size_t h)
+      {
+        uint32_t value = uint32_t(h);
+
+        value ^= value >> 16U;
+        value *= 0x85EBCA6BUL;
+        value ^= value >> 13U;
+        value *= 0xC2B2AE35UL;
+        value ^= value >> 16U;
+
+        return size_t(value);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct mixer<8U>
+    {
+      static size_t mix(size_t h)
+      {
+        uint64_t value = uint64_t(h);
+
+        value ^= value >> 33U;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33U;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33U;
+
+        return size_t(value);
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// The number of slots needed for a capacity.
+    /// A power of 2, at least one group, with the capacity no more than 7/8
+    /// of the slots.
+    //*************************************************************************
+    template <size_t Capacity>
+    struct slot_count_for
+    {
+    private:
+
+      static ETL_CONSTANT size_t Required = Capacity + ((Capacity + 6U) / 7U);
+
+    public:
+
+      static ETL_CONSTANT size_t value = (Required <= group::Width) ? group::Width
+                                                                    : size_t(etl::power_of_2_round_up<Required>::value);
+    };
+
+    template <size_t Capacity>
+    ETL_CONSTANT size_t slot_count_for<Capacity>::value;
+
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct select_first
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element.
+    //*************************************************************************
+    template <typename TKey>
+    struct select_self
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The open addressing hash table.
+    ///\tparam TValue    The stored type.
+    ///\tparam TKey      The key type.
+    ///\tparam TKeyOf    Has a static 'get' that returns the key of a value.
+    ///\tparam THash     The hash function type.
+    ///\tparam TKeyEqual The key compare function type.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    class flat_hash_table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef THash             hasher;
+      typedef TKeyEqual         key_equal;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+      typedef value_type&&      rvalue_reference;
+#endif
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      class const_iterator;
+
+      //*********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+      {
+      public:
+
+        friend class flat_hash_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : pctrl(ETL_NULLPTR),
+            pctrl_end(ETL_NULLPTR),
+            pslot(ETL_NULLPTR)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          do
+          {
+            ++pctrl;
+            ++pslot;
+          } while ((pctrl != pctrl_end) && (*pctrl < 0));
+
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return *pslot;
+        }
+
+        //*********************************
+        pointer operator &() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.pslot == rhs.pslot;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(const ctrl_t* pctrl_, const ctrl_t* pctrl_end_, pointer pslot_)
+          : pctrl(pctrl_),
+            pctrl_end(pctrl_end_),
+            pslot(pslot_)
+        {
+        }
+
+        const ctrl_t* pctrl;
+        const ctrl_t* pctrl_end;
+        pointer       pslot;
+      };
+
+      //*********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class flat_hash_table;
+        friend class iterator;
+
+        //*********************************
+        const_iterator()
+          : pctrl(ETL_NULLPTR),
+            pctrl_end(ETL_NULLPTR),
+            pslot(ETL_NULLPTR)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename flat_hash_table::iterator& other)
+          : pctrl(other.pctrl),
+            pctrl_end(other.pctrl_end),
+            pslot(other.pslot)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          do
+          {
+            ++pctrl;
+            ++pslot;
+          } while ((pctrl != pctrl_end) && (*pctrl < 0));
+
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return *pslot;
+        }
+
+        //*********************************
+        const_pointer operator &() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.pslot == rhs.pslot;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const ctrl_t* pctrl_, const ctrl_t* pctrl_end_, const_pointer pslot_)
+          : pctrl(pctrl_),
+            pctrl_end(pctrl_end_),
+            pslot(pslot_)
+        {
+        }
+
+        const ctrl_t* pctrl;
+        const ctrl_t* pctrl_end;
+        const_pointer pslot;
+      };
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        size_t index = first_full(0U);
+
+        return iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        size_t index = first_full(0U);
+
+        return const_iterator(pcontrol + index, pcontrol + number_of_slots, pslots + index);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return begin();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(pcontrol + number_of_slots, pcontrol + number_of_slots, pslots + number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(pcontrol + number_of_slots, pcontrol + number_of_slots, pslots + number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return end();
+      }
+
+      //*********************************************************************
+      /// Gets the size of the table.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == maximum_size;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return maximum_size - current_size;
+      }
+
+      //*********************************************************************
+      /// Returns the number of slots in the table.
+      /// This is greater than the capacity, so that probes stay short.
+      //*********************************************************************
+      size_type slot_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Returns the load factor = size / slot_count.
+      //*********************************************************************
+      float load_factor() const
+      {
+        return static_cast<float>(size()) / static_cast<float>(slot_count());
+      }
+
+      //*********************************************************************
+      /// Returns the function that hashes the keys.
+      //*********************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*********************************************************************
+      /// Returns the function that compares the keys.
+      //*********************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return to_iterator(find_index(key, hash_of(key)));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the hasher and key_equal are transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      iterator find(const K& key)
+      {
+        return to_iterator(find_index(key, hash_of(key)));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return to_iterator(find_index(key, hash_of(key)));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the hasher and key_equal are transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      const_iterator find(const K& key) const
+      {
+        return to_iterator(find_index(key, hash_of(key)));
+      }
+#endif
+
+      //*********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_index(key, hash_of(key)) != number_of_slots) ? 1U : 0U;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Counts an element.
+      /// Only available if the hasher and key_equal are transparent.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      size_t count(const K& key) const
+      {
+        return (find_index(key, hash_of(key)) != number_of_slots) ? 1U : 0U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Checks if the table contains the key.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find_index(key, hash_of(key)) != number_of_slots;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Checks if the table contains the key.
+      /// Only available if the hasher and key_equal are transparent.
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      bool contains(const K& key) const
+      {
+        return find_index(key, hash_of(key)) != number_of_slots;
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing all elements with key 'key'.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        iterator f = find(key);
+        iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<iterator, iterator>(f, l);
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing all elements with key 'key'.
+      /// Only available if the hasher and key_equal are transparent.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+      {
+        iterator f = find(key);
+        iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<iterator, iterator>(f, l);
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing all elements with key 'key'.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        const_iterator f = find(key);
+        const_iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing all elements with key 'key'.
+      /// Only available if the hasher and key_equal are transparent.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+      {
+        const_iterator f = find(key);
+        const_iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        size_t index = find_index(key, hash_of(key));
+
+        if (index == number_of_slots)
+        {
+          return 0U;
+        }
+
+        erase_index(index);
+
+        return 1U;
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param ielement Iterator to the element.
+      ///\return An iterator to the next element.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        size_t index = size_t(ielement.pslot - pslots);
+
+        erase_index(index);
+
+        return to_iterator(first_full(index + 1U));
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      ///\param first Iterator to the first element.
+      ///\param last  Iterator to the last element + 1.
+      ///\return An iterator to the element after the range.
+      //*********************************************************************
+      iterator erase(const_iterator first_, const_iterator last_)
+      {
+        // Erasing never moves the other elements.
+        while (first_ != last_)
+        {
+          first_ = erase(first_);
+        }
+
+        return to_iterator(size_t(last_.pslot - pslots));
+      }
+
+      //*************************************************************************
+      /// Clears the table.
+      //*************************************************************************
+      void clear()
+      {
+        initialise();
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      flat_hash_table(ctrl_t* pcontrol_, value_type* pslots_, size_t number_of_slots_, size_t maximum_size_)
+        : pcontrol(pcontrol_),
+          pslots(pslots_),
+          number_of_slots(number_of_slots_),
+          group_mask((number_of_slots_ / group::Width) - 1U),
+          maximum_size(maximum_size_),
+          maximum_load(number_of_slots_ - (number_of_slots_ / 16U)),
+          current_size(0U),
+          deleted_count(0U)
+      {
+      }
+
+      //*********************************************************************
+      /// Destroys all of the elements and empties the table.
+      //*********************************************************************
+      void initialise()
+      {
+        if (current_size != 0U)
+        {
+          for (size_t i = 0U; i < number_of_slots; ++i)
+          {
+            if (pcontrol[i] >= 0)
+            {
+              pslots[i].~value_type();
+              ETL_DECREMENT_DEBUG_COUNT
+            }
+          }
+        }
+
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          pcontrol[i] = Ctrl_Empty;
+        }
+
+        current_size  = 0U;
+        deleted_count = 0U;
+      }
+
+      //*********************************************************************
+      /// The hash of a key.
+      //*********************************************************************
+      template <typename K>
+      size_t hash_of(const K& key) const
+      {
+        return mixer<>::mix(size_t(key_hash_function(key)));
+      }
+
+      //*********************************************************************
+      /// Finds the slot holding the key.
+      ///\return The slot index, or number_of_slots if not found.
+      //*********************************************************************
+      template <typename K>
+      size_t find_index(const K& key, size_t hash) const
+      {
+        const ctrl_t h2    = get_h2(hash);
+        size_t       index = get_h1(hash) & group_mask;
+
+        for (size_t probe = 1U; probe <= (group_mask + 1U); ++probe)
+        {
+          const size_t first_slot = index * group::Width;
+
+          ETL_PREFETCH(pslots + first_slot);
+
+          const group g(pcontrol + first_slot);
+
+          typename group::mask_t mask = g.match(h2);
+
+          while (mask != 0U)
+          {
+            const size_t slot = first_slot + group::lowest(mask);
+
+            if (key_equal_function(key, TKeyOf::get(pslots[slot])))
+            {
+              return slot;
+            }
+
+            mask &= mask - 1U;
+          }
+
+          // A probe never passes a group with an empty slot.
+          if (g.match_empty() != 0U)
+          {
+            break;
+          }
+
+          index = (index + probe) & group_mask;
+        }
+
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Finds a free slot for a new element that is not already in the table.
+      /// The caller must have checked that the table is not full.
+      /// The caller constructs the element in the slot, then calls commit_insert.
+      //*********************************************************************
+      size_t prepare_insert(size_t hash)
+      {
+        // Too many deleted slots make probes long. Reuse them.
+        if ((current_size + deleted_count) >= maximum_load)
+        {
+          drop_deleted();
+        }
+
+        return find_first_free(hash);
+      }
+
+      //*********************************************************************
+      /// Records that an element has been constructed in a slot returned by
+      /// prepare_insert.
+      //*********************************************************************
+      void commit_insert(size_t slot, size_t hash)
+      {
+        if (pcontrol[slot] == Ctrl_Deleted)
+        {
+          --deleted_count;
+        }
+
+        pcontrol[slot] = get_h2(hash);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+
+      //*********************************************************************
+      /// Destroys the element in a slot.
+      //*********************************************************************
+      void erase_index(size_t slot)
+      {
+        pslots[slot].~value_type();
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT
+
+        // If the group already has an empty slot then no probe has passed
+        // through it, so this slot may become empty too.
+        const group g(pcontrol + (slot & ~(group::Width - 1U)));
+
+        if (g.match_empty() != 0U)
+        {
+          pcontrol[slot] = Ctrl_Empty;
+        }
+        else
+        {
+          pcontrol[slot] = Ctrl_Deleted;
+          ++deleted_count;
+        }
+      }
+
+      //*********************************************************************
+      /// Converts a slot index to an iterator.
+      //*********************************************************************
+      iterator to_iterator(size_t slot)
+      {
+        return iterator(pcontrol + slot, pcontrol + number_of_slots, pslots + slot);
+      }
+
+      //*********************************************************************
+      const_iterator to_iterator(size_t slot) const
+      {
+        return const_iterator(pcontrol + slot, pcontrol + number_of_slots, pslots + slot);
+      }
+
+      //*********************************************************************
+      /// Gets the slot index of an iterator.
+      //*********************************************************************
+      size_t to_index(const_iterator itr) const
+      {
+        return size_t(itr.pslot - pslots);
+      }
+
+      //*********************************************************************
+      /// Gets the address of a slot.
+      //*********************************************************************
+      value_type* slot_address(size_t slot)
+      {
+        return pslots + slot;
+      }
+
+    private:
+
+      //*********************************************************************
+      static ctrl_t get_h2(size_t hash)
+      {
+        return ctrl_t(hash & 0x7FU);
+      }
+
+      //*********************************************************************
+      static size_t get_h1(size_t hash)
+      {
+        return hash >> 7U;
+      }
+
+      //*********************************************************************
+      /// The index of the first full slot at or after 'slot'.
+      //*********************************************************************
+      size_t first_full(size_t slot) const
+      {
+        while ((slot < number_of_slots) && (pcontrol[slot] < 0))
+        {
+          ++slot;
+        }
+
+        return slot;
+      }
+
+      //*********************************************************************
+      /// Finds the first empty or deleted slot in the probe sequence.
+      //*********************************************************************
+      size_t find_first_free(size_t hash) const
+      {
+        size_t index = get_h1(hash) & group_mask;
+        size_t probe = 1U;
+
+        for (;;)
+        {
+          const size_t first_slot = index * group::Width;
+          const group  g(pcontrol + first_slot);
+
+          typename group::mask_t mask = g.match_empty_or_deleted();
+
+          if (mask != 0U)
+          {
+            return first_slot + group::lowest(mask);
+          }
+
+          // Triangular steps visit every group, as the count is a power of 2.
+          index = (index + probe) & group_mask;
+          ++probe;
+        }
+      }
+
+      //*********************************************************************
+      /// Rehashes the elements in place, turning every deleted slot back into
+      /// an empty one.
+      //*********************************************************************
+      void drop_deleted()
+      {
+        // Mark the elements as 'deleted' and the deleted slots as 'empty'.
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          pcontrol[i] = (pcontrol[i] == Ctrl_Deleted) ? Ctrl_Empty : ((pcontrol[i] >= 0) ? Ctrl_Deleted : pcontrol[i]);
+        }
+
+        deleted_count = 0U;
+
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (pcontrol[i] != Ctrl_Deleted)
+          {
+            continue;
+          }
+
+          const size_t hash   = hash_of(TKeyOf::get(pslots[i]));
+          const size_t target = find_first_free(hash);
+
+          if ((target / group::Width) == (i / group::Width))
+          {
+            // Already in the best group.
+            pcontrol[i] = get_h2(hash);
+          }
+          else if (pcontrol[target] == Ctrl_Empty)
+          {
+            relocate(i, target);
+            pcontrol[target] = get_h2(hash);
+            pcontrol[i]      = Ctrl_Empty;
+          }
+          else
+          {
+            // The target holds an element that is still to be placed.
+            swap_slots(i, target);
+            pcontrol[target] = get_h2(hash);
+            --i;
+          }
+        }
+      }
+
+      //*********************************************************************
+      /// Moves an element to an unused slot.
+      //*********************************************************************
+      void relocate(size_t from, size_t to)
+      {
+#if ETL_CPP11_SUPPORTED
+        ::new (pslots + to) value_type(etl::move(pslots[from]));
+#else
+        ::new (pslots + to) value_type(pslots[from]);
+#endif
+        pslots[from].~value_type();
+      }
+
+      //*********************************************************************
+      /// Swaps the elements in two slots.
+      //*********************************************************************
+      void swap_slots(size_t a, size_t b)
+      {
+#if ETL_CPP11_SUPPORTED
+        value_type temp(etl::move(pslots[a]));
+        pslots[a].~value_type();
+        ::new (pslots + a) value_type(etl::move(pslots[b]));
+        pslots[b].~value_type();
+        ::new (pslots + b) value_type(etl::move(temp));
+#else
+        value_type temp(pslots[a]);
+        pslots[a].~value_type();
+        ::new (pslots + a) value_type(pslots[b]);
+        pslots[b].~value_type();
+        ::new (pslots + b) value_type(temp);
+#endif
+      }
+
+      // Disable copy construction.
+      flat_hash_table(const flat_hash_table&);
+
+      /// The control bytes.
+      ctrl_t* pcontrol;
+
+      /// The slots.
+      value_type* pslots;
+
+      /// The number of slots. A power of 2, and a whole number of groups.
+      const size_t number_of_slots;
+
+      /// The number of groups - 1.
+      const size_t group_mask;
+
+      /// The maximum number of elements.
+      const size_t maximum_size;
+
+      /// The maximum number of full and deleted slots before the deleted
+      /// slots are reclaimed. 15/16 of the slots. As the size is no more
+      /// than 7/8 of the slots, at least 1/16 are reclaimed each time.
+      const size_t maximum_load;
+
+      /// The number of elements.
+      size_t current_size;
+
+      /// The number of deleted slots.
+      size_t deleted_count;
+
+      /// The function that creates the hashes.
+      hasher key_hash_function;
+
+      /// The function that compares the keys for equality.
+      key_equal key_equal_function;
+
+      /// For library debugging purposes only.
+      ETL_DECLARE_DEBUG_COUNT
+
+    protected:
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~flat_hash_table()
+      {
+      }
+    };
+  }
+}
+
+#endif
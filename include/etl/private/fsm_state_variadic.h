@@ -0,0 +1,104 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_STATE_VARIADIC_INCLUDED
+#define ETL_FSM_STATE_VARIADIC_INCLUDED
+
+#include "../platform.h"
+#include "../message.h"
+#include "../message_packet.h"
+#include "../static_assert.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A state for any number of message types, including none.
+  //***************************************************************************
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessageTypes>
+  class fsm_state : public ifsm_state
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::private_message_packet::ids_are_unique<TMessageTypes...>(), "Message ids must be unique");
+
+    enum
+    {
+      STATE_ID = STATE_ID_
+    };
+
+    fsm_state()
+      : ifsm_state(STATE_ID)
+    {
+    }
+
+  protected:
+
+    ~fsm_state()
+    {
+    }
+
+    inline TContext& get_fsm_context() const
+    {
+      return static_cast<TContext&>(ifsm_state::get_fsm_context());
+    }
+
+  private:
+
+    etl::fsm_state_id_t process_event(const etl::imessage& message)
+    {
+      etl::fsm_state_id_t new_state_id;
+      ETL_MAYBE_UNUSED const etl::message_id_t event_id = message.get_message_id();
+
+      if (!(process_if<TMessageTypes>(event_id, message, new_state_id) || ...))
+      {
+        new_state_id = p_parent ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
+      }
+
+      return new_state_id;
+    }
+
+    //********************************************
+    /// Calls on_event if the id is the message's id.
+    //********************************************
+    template <typename TMessage>
+    bool process_if(etl::message_id_t event_id, const etl::imessage& message, etl::fsm_state_id_t& new_state_id)
+    {
+      if (event_id == TMessage::ID)
+      {
+        new_state_id = static_cast<TDerived*>(this)->on_event(static_cast<const TMessage&>(message));
+        return true;
+      }
+
+      return false;
+    }
+  };
+}
+
+#endif
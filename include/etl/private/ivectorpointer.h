@@ -349,6 +349,16 @@ namespace etl
       base_t::push_back(value);
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking for space.
+    /// Undefined behaviour if the vector is full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(parameter_t value)
+    {
+      base_t::push_back_unchecked(value);
+    }
+
     //*********************************************************************
     /// Constructs a value at the end of the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -368,6 +378,16 @@ namespace etl
       base_t::pop_back();
     }
 
+    //*************************************************************************
+    /// Removes an element from the end of the vector without checking that
+    /// there is one.
+    /// Undefined behaviour if the vector is empty.
+    //*************************************************************************
+    void pop_back_unchecked()
+    {
+      base_t::pop_back_unchecked();
+    }
+
     //*********************************************************************
     /// Inserts a value to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -780,6 +800,16 @@ namespace etl
       base_t::push_back(const_cast<T*>(value));
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking for space.
+    /// Undefined behaviour if the vector is full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(parameter_t value)
+    {
+      base_t::push_back_unchecked(const_cast<T*>(value));
+    }
+
     //*************************************************************************
     /// Removes an element from the end of the vector.
     /// Does nothing if the vector is empty.
@@ -789,6 +819,16 @@ namespace etl
       base_t::pop_back();
     }
 
+    //*************************************************************************
+    /// Removes an element from the end of the vector without checking that
+    /// there is one.
+    /// Undefined behaviour if the vector is empty.
+    //*************************************************************************
+    void pop_back_unchecked()
+    {
+      base_t::pop_back_unchecked();
+    }
+
     //*********************************************************************
     /// Inserts a value to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -0,0 +1,362 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_PACKET_VARIADIC_INCLUDED
+#define ETL_MESSAGE_PACKET_VARIADIC_INCLUDED
+
+#include "../platform.h"
+#include "../message.h"
+#include "../error_handler.h"
+#include "../static_assert.h"
+#include "../largest.h"
+#include "../alignment.h"
+#include "../utility.h"
+#include "../type_traits.h"
+#include "../placement_new.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_message_packet
+  {
+    //*************************************************************************
+    /// True if none of the message types share an id.
+    /// Stands in for the duplicate case labels that catch this in the
+    /// generated versions.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    constexpr bool ids_are_unique()
+    {
+      if constexpr (sizeof...(TMessageTypes) < 2U)
+      {
+        return true;
+      }
+      else
+      {
+        const etl::message_id_t ids[] = { etl::message_id_t(TMessageTypes::ID)... };
+
+        for (size_t i = 0U; i < sizeof...(TMessageTypes); ++i)
+        {
+          for (size_t j = i + 1U; j < sizeof...(TMessageTypes); ++j)
+          {
+            if (ids[i] == ids[j])
+            {
+              return false;
+            }
+          }
+        }
+
+        return true;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// A packet that can hold any one of the message types.
+  /// Variadic, so there is no limit on the number of types.
+  //***************************************************************************
+  template <typename... TMessageTypes>
+  class message_packet
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) != 0U, "message_packet must have at least one message type");
+    ETL_STATIC_ASSERT(etl::private_message_packet::ids_are_unique<TMessageTypes...>(), "Message ids must be unique");
+
+    //********************************************
+    message_packet()
+      : valid(false)
+    {
+    }
+
+    //********************************************
+    explicit message_packet(const etl::imessage& msg)
+      : valid(true)
+    {
+      add_new_message(msg);
+    }
+
+    //********************************************
+    explicit message_packet(etl::imessage&& msg)
+      : valid(true)
+    {
+      add_new_message(etl::move(msg));
+    }
+
+    //********************************************
+    /// Constructs from one of the message types, without the search for the id.
+    //********************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, TMessageTypes...>::value, int>::type>
+    explicit message_packet(TMessage&& msg)
+      : valid(true)
+    {
+      void* p = data;
+      ::new (p) typename etl::decay<TMessage>::type(etl::forward<TMessage>(msg));
+    }
+
+    //**********************************************
+    message_packet(const message_packet& other)
+      : valid(other.is_valid())
+    {
+      if (valid)
+      {
+        add_new_message(other.get());
+      }
+    }
+
+    //**********************************************
+    message_packet(message_packet&& other)
+      : valid(other.is_valid())
+    {
+      if (valid)
+      {
+        add_new_message(etl::move(other.get()));
+      }
+    }
+
+    //**********************************************
+    message_packet& operator =(const message_packet& rhs)
+    {
+      delete_current_message();
+      valid = rhs.is_valid();
+      if (valid)
+      {
+        add_new_message(rhs.get());
+      }
+
+      return *this;
+    }
+
+    //**********************************************
+    message_packet& operator =(message_packet&& rhs)
+    {
+      delete_current_message();
+      valid = rhs.is_valid();
+      if (valid)
+      {
+        add_new_message(etl::move(rhs.get()));
+      }
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Replaces the message with one of the message types, without the search for the id.
+    //**********************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_one_of<typename etl::decay<TMessage>::type, TMessageTypes...>::value, message_packet&>::type
+      operator =(TMessage&& msg)
+    {
+      emplace<typename etl::decay<TMessage>::type>(etl::forward<TMessage>(msg));
+
+      return *this;
+    }
+
+    //**********************************************
+    /// Constructs a message in the packet, replacing the current one.
+    //**********************************************
+    template <typename TMessage, typename... TArgs>
+    TMessage& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, TMessageTypes...>::value), "Unsupported type for this message packet");
+
+      delete_current_message();
+      valid = false;
+
+      void* p = data;
+      TMessage* pmsg = ::new (p) TMessage(etl::forward<TArgs>(args)...);
+      valid = true;
+
+      return *pmsg;
+    }
+
+    //********************************************
+    ~message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return valid;
+    }
+
+    //**********************************************
+    static constexpr bool accepts(etl::message_id_t id)
+    {
+      return ((id == TMessageTypes::ID) || ...);
+    }
+
+    //**********************************************
+    static constexpr bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static constexpr bool accepts()
+    {
+      return accepts(Id);
+    }
+
+    //**********************************************
+    template <typename TMessage>
+    static constexpr
+    typename etl::enable_if<!etl::is_integral<TMessage>::value, bool>::type
+      accepts()
+    {
+      return accepts(TMessage::ID);
+    }
+
+    enum
+    {
+      SIZE      = etl::largest<TMessageTypes...>::size,
+      ALIGNMENT = etl::largest<TMessageTypes...>::alignment
+    };
+
+    //**********************************************
+    /// The size of the storage for the largest message.
+    //**********************************************
+    static constexpr size_t storage_size()
+    {
+      return SIZE;
+    }
+
+    //**********************************************
+    /// The alignment of the storage for the messages.
+    //**********************************************
+    static constexpr size_t storage_alignment()
+    {
+      return ALIGNMENT;
+    }
+
+  private:
+
+    //********************************************
+    void delete_current_message()
+    {
+      if (valid)
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+  #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
+        pmsg->~imessage();
+  #else
+        const etl::message_id_t id = pmsg->get_message_id();
+
+        (destroy_if<TMessageTypes>(id, pmsg) || ...);
+  #endif
+      }
+    }
+
+    //********************************************
+    template <typename TMessage>
+    static bool destroy_if(etl::message_id_t id, etl::imessage* pmsg)
+    {
+      if (id == TMessage::ID)
+      {
+        static_cast<TMessage*>(pmsg)->~TMessage();
+        return true;
+      }
+
+      return false;
+    }
+
+    //********************************************
+    void add_new_message(const etl::imessage& msg)
+    {
+      const etl::message_id_t id = msg.get_message_id();
+
+      if (!(copy_if<TMessageTypes>(id, msg) || ...))
+      {
+        ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+      }
+    }
+
+    //********************************************
+    void add_new_message(etl::imessage&& msg)
+    {
+      const etl::message_id_t id = msg.get_message_id();
+
+      if (!(move_if<TMessageTypes>(id, msg) || ...))
+      {
+        ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+      }
+    }
+
+    //********************************************
+    template <typename TMessage>
+    bool copy_if(etl::message_id_t id, const etl::imessage& msg)
+    {
+      if (id == TMessage::ID)
+      {
+        void* p = data;
+        ::new (p) TMessage(static_cast<const TMessage&>(msg));
+        return true;
+      }
+
+      return false;
+    }
+
+    //********************************************
+    template <typename TMessage>
+    bool move_if(etl::message_id_t id, etl::imessage& msg)
+    {
+      if (id == TMessage::ID)
+      {
+        void* p = data;
+        ::new (p) TMessage(static_cast<TMessage&&>(msg));
+        return true;
+      }
+
+      return false;
+    }
+
+    typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    bool valid;
+  };
+}
+
+#endif
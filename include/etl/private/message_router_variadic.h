@@ -0,0 +1,173 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ROUTER_VARIADIC_INCLUDED
+#define ETL_MESSAGE_ROUTER_VARIADIC_INCLUDED
+
+#include "../platform.h"
+#include "../message.h"
+#include "../message_packet.h"
+#include "../error_handler.h"
+#include "../static_assert.h"
+#include "../integral_limits.h"
+#include "../trace.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// The ids accepted by a router.
+    /// For 8 bit ids, a constant bitmap of 256 bits is tested.
+    /// For wider ids, each id is compared.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    struct accepted_ids
+    {
+      //***********************************
+      static constexpr uint32_t word(size_t w)
+      {
+        return (0U | ... | (((size_t(TMessageTypes::ID) / 32U) == w) ? (uint32_t(1U) << (size_t(TMessageTypes::ID) % 32U)) : 0U));
+      }
+
+      //***********************************
+      static bool test(etl::message_id_t id)
+      {
+        if constexpr (etl::integral_limits<etl::message_id_t>::bits == 8U)
+        {
+          return (bitmap[size_t(id) / 32U] & (uint32_t(1U) << (size_t(id) % 32U))) != 0U;
+        }
+        else
+        {
+          return ((id == TMessageTypes::ID) || ...);
+        }
+      }
+
+      static constexpr uint32_t bitmap[8] = { word(0), word(1), word(2), word(3), word(4), word(5), word(6), word(7) };
+    };
+  }
+
+  //***************************************************************************
+  /// A message router for any number of message types.
+  //***************************************************************************
+  template <typename TDerived, typename... TMessageTypes>
+  class message_router : public imessage_router
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) != 0U, "message_router must have at least one message type");
+    ETL_STATIC_ASSERT(etl::private_message_packet::ids_are_unique<TMessageTypes...>(), "Message ids must be unique");
+
+    typedef etl::message_packet<TMessageTypes...> message_packet;
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_)
+      : imessage_router(id_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    using etl::imessage_router::receive;
+
+    void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      const etl::message_id_t id = msg.get_message_id();
+
+      ETL_TRACE_EVENT(etl::trace_event::Message_Router_Receive, get_message_router_id(), id)
+
+      if (!(receive_if<TMessageTypes>(id, msg) || ...))
+      {
+        if (has_successor())
+        {
+          get_successor().receive(msg);
+        }
+        else
+        {
+          static_cast<TDerived*>(this)->on_receive_unknown(msg);
+        }
+      }
+    }
+
+    //**********************************************
+    using imessage_router::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return private_message_router::accepted_ids<TMessageTypes...>::test(id);
+    }
+
+    //********************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  private:
+
+    //********************************************
+    /// Calls on_receive if the id is the message's id.
+    //********************************************
+    template <typename TMessage>
+    bool receive_if(etl::message_id_t id, const etl::imessage& msg)
+    {
+      if (id == TMessage::ID)
+      {
+        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
+        return true;
+      }
+
+      return false;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,292 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_NODE_HANDLE_INCLUDED
+#define ETL_NODE_HANDLE_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../ipool.h"
+#include "../utility.h"
+
+#if ETL_CPP11_SUPPORTED
+
+namespace etl
+{
+  namespace private_node_handle
+  {
+    //*************************************************************************
+    /// Owns a node that has been extracted from a node based container.
+    /// The node stays allocated from the pool of the container that it came
+    /// from, so the handle must not outlive that pool.
+    /// If the container's size is derived from its pool, 'p_extracted' points
+    /// at the container's count of nodes that are held by handles.
+    //*************************************************************************
+    template <typename TValue>
+    class node_handle_base
+    {
+    public:
+
+      //***********************************************************************
+      node_handle_base()
+        : p_node(ETL_NULLPTR)
+        , p_value(ETL_NULLPTR)
+        , p_pool(ETL_NULLPTR)
+        , p_extracted(ETL_NULLPTR)
+      {
+      }
+
+      //***********************************************************************
+      node_handle_base(node_handle_base&& other)
+        : p_node(other.p_node)
+        , p_value(other.p_value)
+        , p_pool(other.p_pool)
+        , p_extracted(other.p_extracted)
+      {
+        other.clear();
+      }
+
+      //***********************************************************************
+      node_handle_base& operator =(node_handle_base&& other)
+      {
+        if (&other != this)
+        {
+          reset();
+
+          p_node      = other.p_node;
+          p_value     = other.p_value;
+          p_pool      = other.p_pool;
+          p_extracted = other.p_extracted;
+
+          other.clear();
+        }
+
+        return *this;
+      }
+
+      //***********************************************************************
+      /// Destroys the value and returns the node to its pool.
+      //***********************************************************************
+      ~node_handle_base()
+      {
+        reset();
+      }
+
+      //***********************************************************************
+      /// Returns <b>true</b> if the handle does not own a node.
+      //***********************************************************************
+      bool empty() const
+      {
+        return p_node == ETL_NULLPTR;
+      }
+
+      //***********************************************************************
+      /// Returns <b>true</b> if the handle owns a node.
+      //***********************************************************************
+      explicit operator bool() const
+      {
+        return !empty();
+      }
+
+      //***********************************************************************
+      /// Swaps with another handle.
+      //***********************************************************************
+      void swap(node_handle_base& other)
+      {
+        using ETL_OR_STD::swap; // Allow ADL
+
+        swap(p_node,      other.p_node);
+        swap(p_value,     other.p_value);
+        swap(p_pool,      other.p_pool);
+        swap(p_extracted, other.p_extracted);
+      }
+
+    protected:
+
+      //***********************************************************************
+      node_handle_base(void* p_node_, TValue* p_value_, etl::ipool* p_pool_, size_t* p_extracted_)
+        : p_node(p_node_)
+        , p_value(p_value_)
+        , p_pool(p_pool_)
+        , p_extracted(p_extracted_)
+      {
+      }
+
+      //***********************************************************************
+      /// The value held in the node.
+      //***********************************************************************
+      TValue& get_value() const
+      {
+        return *p_value;
+      }
+
+      //***********************************************************************
+      /// The pool that the node was allocated from.
+      //***********************************************************************
+      const etl::ipool* get_pool() const
+      {
+        return p_pool;
+      }
+
+      //***********************************************************************
+      /// Gives up ownership of the node, which the caller relinks.
+      //***********************************************************************
+      void* release()
+      {
+        void* p = p_node;
+
+        if (p_extracted != ETL_NULLPTR)
+        {
+          --(*p_extracted);
+        }
+
+        clear();
+
+        return p;
+      }
+
+      //***********************************************************************
+      /// Destroys the value and returns the node to its pool.
+      //***********************************************************************
+      void reset()
+      {
+        if (p_node != ETL_NULLPTR)
+        {
+          p_value->~TValue();
+          p_pool->release(p_node);
+
+          if (p_extracted != ETL_NULLPTR)
+          {
+            --(*p_extracted);
+          }
+
+          clear();
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      void clear()
+      {
+        p_node      = ETL_NULLPTR;
+        p_value     = ETL_NULLPTR;
+        p_pool      = ETL_NULLPTR;
+        p_extracted = ETL_NULLPTR;
+      }
+
+      node_handle_base(const node_handle_base&) ETL_DELETE;
+      node_handle_base& operator =(const node_handle_base&) ETL_DELETE;
+
+      void*       p_node;
+      TValue*     p_value;
+      etl::ipool* p_pool;
+      size_t*     p_extracted;
+    };
+
+    //*************************************************************************
+    /// Node handle for containers of values; list, set and multiset.
+    //*************************************************************************
+    template <typename TValue>
+    class value_node_handle : public node_handle_base<TValue>
+    {
+    public:
+
+      typedef TValue value_type;
+
+      //***********************************************************************
+      value_node_handle()
+      {
+      }
+
+      //***********************************************************************
+      /// The value held in the node.
+      //***********************************************************************
+      value_type& value() const
+      {
+        return this->get_value();
+      }
+
+    protected:
+
+      //***********************************************************************
+      value_node_handle(void* p_node_, TValue* p_value_, etl::ipool* p_pool_, size_t* p_extracted_)
+        : node_handle_base<TValue>(p_node_, p_value_, p_pool_, p_extracted_)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Node handle for containers of key/mapped pairs; map and multimap.
+    /// The key is const in the stored pair, so it is only readable.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    class key_value_node_handle : public node_handle_base<ETL_OR_STD::pair<const TKey, TMapped> >
+    {
+    public:
+
+      typedef TKey    key_type;
+      typedef TMapped mapped_type;
+
+      //***********************************************************************
+      key_value_node_handle()
+      {
+      }
+
+      //***********************************************************************
+      /// The key held in the node.
+      //***********************************************************************
+      const key_type& key() const
+      {
+        return this->get_value().first;
+      }
+
+      //***********************************************************************
+      /// The mapped value held in the node.
+      //***********************************************************************
+      mapped_type& mapped() const
+      {
+        return this->get_value().second;
+      }
+
+    protected:
+
+      //***********************************************************************
+      key_value_node_handle(void* p_node_, ETL_OR_STD::pair<const TKey, TMapped>* p_value_, etl::ipool* p_pool_, size_t* p_extracted_)
+        : node_handle_base<ETL_OR_STD::pair<const TKey, TMapped> >(p_node_, p_value_, p_pool_, p_extracted_)
+      {
+      }
+    };
+  }
+}
+
+#endif
+#endif
@@ -410,6 +410,16 @@ namespace etl
       *p_end++ = value;
     }
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking for space.
+    /// Undefined behaviour if the vector is full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(value_type value)
+    {
+      *p_end++ = value;
+    }
+
     //*********************************************************************
     /// Emplaces a value at the end of the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -435,6 +445,16 @@ namespace etl
       --p_end;
     }
 
+    //*************************************************************************
+    /// Removes an element from the end of the vector without checking that
+    /// there is one.
+    /// Undefined behaviour if the vector is empty.
+    //*************************************************************************
+    void pop_back_unchecked()
+    {
+      --p_end;
+    }
+
     //*********************************************************************
     /// Inserts a value to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
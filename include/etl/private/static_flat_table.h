@@ -0,0 +1,1122 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_TABLE_INCLUDED
+#define ETL_STATIC_FLAT_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../type_traits.h"
+#include "../functional.h"
+#include "../parameter_type.h"
+#include "../placement_new.h"
+#include "../debug_count.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// The read optimised sorted table used by etl::static_flat_map and
+// etl::static_flat_set.
+//
+// The keys are held in a contiguous array in Eytzinger order, which is the
+// breadth first order of a complete binary search tree. Element 'k' has its
+// children at '2k' and '2k + 1', so the search is a branchless walk down the
+// array, and the keys a few levels below can be prefetched while the
+// comparison at the current level is made. Positions start at 1, and
+// position 0 is the end.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_static_flat
+  {
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct select_first
+    {
+      static const TKey& get(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set element.
+    //*************************************************************************
+    template <typename TKey>
+    struct select_self
+    {
+      static const TKey& get(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The number of trailing set bits.
+    //*************************************************************************
+    inline size_t trailing_ones(size_t value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(__builtin_ctzll(~static_cast<unsigned long long>(value)));
+#else
+      size_t count = 0U;
+
+      while ((value & 1U) != 0U)
+      {
+        value >>= 1U;
+        ++count;
+      }
+
+      return count;
+#endif
+    }
+
+    //*************************************************************************
+    /// The number of trailing clear bits. The value must not be zero.
+    //*************************************************************************
+    inline size_t trailing_zeros(size_t value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(__builtin_ctzll(static_cast<unsigned long long>(value)));
+#else
+      size_t count = 0U;
+
+      while ((value & 1U) == 0U)
+      {
+        value >>= 1U;
+        ++count;
+      }
+
+      return count;
+#endif
+    }
+
+    //*************************************************************************
+    /// The Eytzinger position of the element with the sorted rank.
+    ///\param rank The rank, from 1.
+    ///\param size The number of elements.
+    //*************************************************************************
+    inline size_t position_of_rank(size_t rank, size_t size)
+    {
+      // The half full level above the leaves of the smallest perfect tree
+      // holding 'size' elements.
+      size_t half = 1U;
+
+      while ((half * 2U) <= size)
+      {
+        half *= 2U;
+      }
+
+      // The leaves that exist have the odd ranks of the perfect tree, so
+      // once past them, only the even ranks remain.
+      const size_t leaves = size - (half - 1U);
+      const size_t perfect_rank = (rank <= (2U * leaves)) ? rank : ((2U * rank) - (2U * leaves));
+
+      return ((2U * half) + perfect_rank) >> (trailing_zeros(perfect_rank) + 1U);
+    }
+
+    //*************************************************************************
+    /// The Eytzinger position of the next element in sorted order.
+    //*************************************************************************
+    inline size_t next_position(size_t position, size_t size)
+    {
+      if (((2U * position) + 1U) <= size)
+      {
+        // The leftmost element of the right subtree.
+        position = (2U * position) + 1U;
+
+        while ((2U * position) <= size)
+        {
+          position *= 2U;
+        }
+      }
+      else
+      {
+        // Up past the right children, and then past one left child.
+        position >>= (trailing_ones(position) + 1U);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// The Eytzinger position of the previous element in sorted order.
+    /// The end position gives the last element.
+    //*************************************************************************
+    inline size_t previous_position(size_t position, size_t size)
+    {
+      if (position == 0U)
+      {
+        position = 1U;
+
+        while (((2U * position) + 1U) <= size)
+        {
+          position = (2U * position) + 1U;
+        }
+      }
+      else if ((2U * position) <= size)
+      {
+        // The rightmost element of the left subtree.
+        position *= 2U;
+
+        while (((2U * position) + 1U) <= size)
+        {
+          position = (2U * position) + 1U;
+        }
+      }
+      else
+      {
+        // Up past the left children, and then past one right child.
+        position >>= (trailing_zeros(position) + 1U);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// The sorted table.
+    ///\tparam TValue   The stored type.
+    ///\tparam TKey     The key type.
+    ///\tparam TKeyOf   Has a static 'get' that returns the key of a value.
+    ///\tparam TCompare The key compare function type.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare>
+    class static_flat_table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef TCompare          key_compare;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      class const_iterator;
+
+      //*********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+      {
+      public:
+
+        friend class static_flat_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : pelements(ETL_NULLPTR),
+            position(0U),
+            size(0U)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          position = next_position(position, size);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        iterator& operator --()
+        {
+          position = previous_position(position, size);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          operator--();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return pelements[position];
+        }
+
+        //*********************************
+        pointer operator &() const
+        {
+          return pelements + position;
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return pelements + position;
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.position == rhs.position;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(pointer pelements_, size_t position_, size_t size_)
+          : pelements(pelements_),
+            position(position_),
+            size(size_)
+        {
+        }
+
+        pointer pelements;
+        size_t  position;
+        size_t  size;
+      };
+
+      //*********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+      {
+      public:
+
+        friend class static_flat_table;
+        friend class iterator;
+
+        //*********************************
+        const_iterator()
+          : pelements(ETL_NULLPTR),
+            position(0U),
+            size(0U)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename static_flat_table::iterator& other)
+          : pelements(other.pelements),
+            position(other.position),
+            size(other.size)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          position = next_position(position, size);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_iterator& operator --()
+        {
+          position = previous_position(position, size);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          operator--();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return pelements[position];
+        }
+
+        //*********************************
+        const_pointer operator &() const
+        {
+          return pelements + position;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return pelements + position;
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.position == rhs.position;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const_pointer pelements_, size_t position_, size_t size_)
+          : pelements(pelements_),
+            position(position_),
+            size(size_)
+        {
+        }
+
+        const_pointer pelements;
+        size_t        position;
+        size_t        size;
+      };
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+      typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        return to_iterator(first_position());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return to_iterator(first_position());
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return begin();
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return to_iterator(0U);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return to_iterator(0U);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return end();
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      const_reverse_iterator rbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse beginning of the table.
+      //*********************************************************************
+      const_reverse_iterator crbegin() const
+      {
+        return const_reverse_iterator(end());
+      }
+
+      //*********************************************************************
+      /// Returns a reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      const_reverse_iterator rend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Returns a const_reverse_iterator to the reverse end of the table.
+      //*********************************************************************
+      const_reverse_iterator crend() const
+      {
+        return const_reverse_iterator(begin());
+      }
+
+      //*********************************************************************
+      /// Gets the size of the table.
+      //*********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum possible size of the table.
+      //*********************************************************************
+      size_type capacity() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return current_size == maximum_size;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      ///\return The remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return maximum_size - current_size;
+      }
+
+      //*********************************************************************
+      /// How to compare two keys.
+      //*********************************************************************
+      key_compare key_comp() const
+      {
+        return compare;
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return to_iterator(find_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator find(const K& key)
+      {
+        return to_iterator(find_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return to_iterator(find_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds an element.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator find(const K& key) const
+      {
+        return to_iterator(find_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Counts the elements with the key.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_position(key) == 0U) ? 0U : 1U;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Counts the elements with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      size_t count(const K& key) const
+      {
+        return (find_position(key) == 0U) ? 0U : 1U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Checks if the table contains an element with the key.
+      ///\param key The key to search for.
+      ///\return <b>true</b> if the key exists.
+      //*********************************************************************
+      bool contains(key_parameter_t key) const
+      {
+        return find_position(key) != 0U;
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Checks if the table contains an element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return <b>true</b> if the key exists.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      bool contains(const K& key) const
+      {
+        return find_position(key) != 0U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      iterator lower_bound(key_parameter_t key)
+      {
+        return to_iterator(lower_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator lower_bound(const K& key)
+      {
+        return to_iterator(lower_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      const_iterator lower_bound(key_parameter_t key) const
+      {
+        return to_iterator(lower_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key not less than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator lower_bound(const K& key) const
+      {
+        return to_iterator(lower_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      iterator upper_bound(key_parameter_t key)
+      {
+        return to_iterator(upper_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      iterator upper_bound(const K& key)
+      {
+        return to_iterator(upper_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      const_iterator upper_bound(key_parameter_t key) const
+      {
+        return to_iterator(upper_position(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Finds the first element with a key greater than the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element, or end().
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      const_iterator upper_bound(const K& key) const
+      {
+        return to_iterator(upper_position(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return An iterator pair.
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return An iterator pair.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return A const_iterator pair.
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      /// Only available if the key comparator is transparent.
+      ///\param key The key to search for.
+      ///\return A const_iterator pair.
+      //*********************************************************************
+      template <typename K, typename KC = TCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+      }
+#endif
+
+      //*************************************************************************
+      /// Clears the table.
+      //*************************************************************************
+      void clear()
+      {
+        initialise();
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      /// The arrays are indexed from 1.
+      /// The keys and elements are the same array if the elements are the keys.
+      //*********************************************************************
+      static_flat_table(key_type* pkeys_, value_type* pelements_, uint8_t* pflags_, size_t maximum_size_)
+        : pkeys(pkeys_),
+          pelements(pelements_),
+          pflags(pflags_),
+          maximum_size(maximum_size_),
+          current_size(0U)
+      {
+      }
+
+      //*********************************************************************
+      /// Destroys all of the elements and empties the table.
+      //*********************************************************************
+      void initialise()
+      {
+        for (size_t i = 1U; i <= current_size; ++i)
+        {
+          if (static_cast<void*>(pkeys) != static_cast<void*>(pelements))
+          {
+            pkeys[i].~key_type();
+          }
+
+          pelements[i].~value_type();
+        }
+
+        current_size = 0U;
+        ETL_RESET_DEBUG_COUNT
+      }
+
+      //*********************************************************************
+      /// Copies the keys of a range to positions 1 to n, sorts them, and
+      /// removes the duplicates.
+      ///\return The number of unique keys.
+      //*********************************************************************
+      template <typename TIterator>
+      size_t sort_keys(TIterator first, TIterator last)
+      {
+        size_t n = 0U;
+
+        while (first != last)
+        {
+          ::new (pkeys + n + 1U) key_type(TKeyOf::get(*first++));
+          ++n;
+        }
+
+        etl::sort(pkeys + 1U, pkeys + n + 1U, compare);
+
+        size_t unique = (n == 0U) ? 0U : 1U;
+
+        for (size_t i = 2U; i <= n; ++i)
+        {
+          if (compare(pkeys[unique], pkeys[i]))
+          {
+            ++unique;
+
+            if (unique != i)
+            {
+              pkeys[unique] = pkeys[i];
+            }
+          }
+        }
+
+        for (size_t i = unique + 1U; i <= n; ++i)
+        {
+          pkeys[i].~key_type();
+        }
+
+        return unique;
+      }
+
+      //*********************************************************************
+      /// The sorted rank, from 1, of a key of the sorted and unique keys.
+      //*********************************************************************
+      size_t rank_of(key_parameter_t key, size_t size) const
+      {
+        return size_t(etl::lower_bound(pkeys + 1U, pkeys + size + 1U, key, compare) - pkeys);
+      }
+
+      //*********************************************************************
+      /// Clears the flags for positions 1 to n.
+      //*********************************************************************
+      void clear_flags(size_t n)
+      {
+        for (size_t i = 0U; i <= (n / 8U); ++i)
+        {
+          pflags[i] = 0U;
+        }
+      }
+
+      //*********************************************************************
+      /// Sets the flag for a position.
+      ///\return <b>true</b> if it was already set.
+      //*********************************************************************
+      bool test_and_set_flag(size_t position)
+      {
+        const uint8_t mask = uint8_t(1U << (position % 8U));
+        const bool    was_set = (pflags[position / 8U] & mask) != 0U;
+
+        pflags[position / 8U] |= mask;
+
+        return was_set;
+      }
+
+      //*********************************************************************
+      /// Sets the size after a build.
+      //*********************************************************************
+      void set_size(size_t size)
+      {
+        current_size = size;
+        ETL_ADD_DEBUG_COUNT(size)
+      }
+
+      //*********************************************************************
+      /// Copies the elements of another table, which are already in order.
+      //*********************************************************************
+      void copy_from(const static_flat_table& other)
+      {
+        initialise();
+
+        for (size_t i = 1U; i <= other.current_size; ++i)
+        {
+          ::new (pelements + i) value_type(other.pelements[i]);
+
+          if (static_cast<void*>(pkeys) != static_cast<void*>(pelements))
+          {
+            ::new (pkeys + i) key_type(other.pkeys[i]);
+          }
+        }
+
+        set_size(other.current_size);
+      }
+
+#if ETL_CPP11_SUPPORTED
+      //*********************************************************************
+      /// Moves the elements of another table, which are already in order.
+      //*********************************************************************
+      void move_from(static_flat_table& other)
+      {
+        initialise();
+
+        for (size_t i = 1U; i <= other.current_size; ++i)
+        {
+          ::new (pelements + i) value_type(etl::move(other.pelements[i]));
+
+          if (static_cast<void*>(pkeys) != static_cast<void*>(pelements))
+          {
+            ::new (pkeys + i) key_type(etl::move(other.pkeys[i]));
+          }
+        }
+
+        set_size(other.current_size);
+        other.initialise();
+      }
+#endif
+
+      /// The keys, in Eytzinger order once built.
+      key_type* pkeys;
+
+      /// The elements, in Eytzinger order.
+      value_type* pelements;
+
+      /// Scratch flags for building, one bit per position.
+      uint8_t* pflags;
+
+      /// The function that compares the keys.
+      key_compare compare;
+
+    private:
+
+      /// Keys this many positions ahead are prefetched during a search.
+      /// They are four levels down, covering all sixteen descendants.
+      static ETL_CONSTANT size_t Prefetch_Distance = 16U;
+
+      //*********************************************************************
+      iterator to_iterator(size_t position)
+      {
+        return iterator(pelements, position, current_size);
+      }
+
+      //*********************************************************************
+      const_iterator to_iterator(size_t position) const
+      {
+        return const_iterator(pelements, position, current_size);
+      }
+
+      //*********************************************************************
+      /// The position of the first element in sorted order.
+      //*********************************************************************
+      size_t first_position() const
+      {
+        if (current_size == 0U)
+        {
+          return 0U;
+        }
+
+        size_t position = 1U;
+
+        while ((2U * position) <= current_size)
+        {
+          position *= 2U;
+        }
+
+        return position;
+      }
+
+      //*********************************************************************
+      /// The position of the first element not less than the key.
+      //*********************************************************************
+      template <typename K>
+      size_t lower_position(const K& key) const
+      {
+        size_t k = 1U;
+
+        while (k <= current_size)
+        {
+          if ((k * Prefetch_Distance) <= current_size)
+          {
+            ETL_PREFETCH(pkeys + (k * Prefetch_Distance));
+          }
+
+          // Right if less, otherwise left.
+          k = (2U * k) + (compare(pkeys[k], key) ? 1U : 0U);
+        }
+
+        // Undo the right turns after the last left turn, and that left turn.
+        return k >> (trailing_ones(k) + 1U);
+      }
+
+      //*********************************************************************
+      /// The position of the first element greater than the key.
+      //*********************************************************************
+      template <typename K>
+      size_t upper_position(const K& key) const
+      {
+        size_t k = 1U;
+
+        while (k <= current_size)
+        {
+          if ((k * Prefetch_Distance) <= current_size)
+          {
+            ETL_PREFETCH(pkeys + (k * Prefetch_Distance));
+          }
+
+          // Right if not greater, otherwise left.
+          k = (2U * k) + (compare(key, pkeys[k]) ? 0U : 1U);
+        }
+
+        return k >> (trailing_ones(k) + 1U);
+      }
+
+      //*********************************************************************
+      /// The position of the element with the key, or 0.
+      //*********************************************************************
+      template <typename K>
+      size_t find_position(const K& key) const
+      {
+        const size_t k = lower_position(key);
+
+        return ((k != 0U) && !compare(key, pkeys[k])) ? k : 0U;
+      }
+
+      // Disable copy construction.
+      static_flat_table(const static_flat_table&);
+      static_flat_table& operator =(const static_flat_table&);
+
+      /// The maximum number of elements.
+      const size_t maximum_size;
+
+      /// The number of elements.
+      size_t current_size;
+
+      /// For library debugging purposes only.
+      ETL_DECLARE_DEBUG_COUNT
+
+    protected:
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~static_flat_table()
+      {
+      }
+    };
+  }
+}
+
+#endif
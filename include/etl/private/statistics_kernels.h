@@ -0,0 +1,726 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_KERNELS_INCLUDED
+#define ETL_STATISTICS_KERNELS_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Block kernels for the statistics classes, used when a range of int16_t or
+// float is given by pointers.
+// int16_t samples are summed exactly in 64 bit integers. float samples and
+// their products are summed in double, which holds the product of two floats
+// exactly, so a block is rounded once rather than once per sample.
+// SSE2 or NEON versions are used when the compiler reports that the target
+// supports them, unless ETL_STATISTICS_NO_SIMD is defined. The NEON float
+// kernels need AArch64, as 32 bit NEON has no double lanes.
+//*****************************************************************************
+#if !defined(ETL_STATISTICS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_STATISTICS_SIMD_SSE2 1
+#else
+  #define ETL_STATISTICS_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_STATISTICS_NO_SIMD) && !ETL_STATISTICS_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define ETL_STATISTICS_SIMD_NEON 1
+#else
+  #define ETL_STATISTICS_SIMD_NEON 0
+#endif
+
+#if ETL_STATISTICS_SIMD_NEON && defined(__aarch64__)
+  #define ETL_STATISTICS_SIMD_NEON_DOUBLE 1
+#else
+  #define ETL_STATISTICS_SIMD_NEON_DOUBLE 0
+#endif
+
+#if ETL_STATISTICS_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_STATISTICS_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// The sums for a single series.
+    //*************************************************************************
+    template <typename TAccumulator>
+    struct moments
+    {
+      moments()
+        : sum(0)
+        , sum_of_squares(0)
+      {
+      }
+
+      TAccumulator sum;
+      TAccumulator sum_of_squares;
+    };
+
+    //*************************************************************************
+    /// The sums for a pair of series.
+    //*************************************************************************
+    template <typename TAccumulator>
+    struct co_moments
+    {
+      co_moments()
+        : sum1(0)
+        , sum2(0)
+        , sum_of_squares1(0)
+        , sum_of_squares2(0)
+        , inner_product(0)
+      {
+      }
+
+      TAccumulator sum1;
+      TAccumulator sum2;
+      TAccumulator sum_of_squares1;
+      TAccumulator sum_of_squares2;
+      TAccumulator inner_product;
+    };
+
+    //*************************************************************************
+    /// The sample types that have a kernel.
+    //*************************************************************************
+    template <typename T>
+    struct kernel
+    {
+      static ETL_CONSTANT bool Supported = false;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct kernel<int16_t>
+    {
+      static ETL_CONSTANT bool Supported = true;
+
+      typedef int64_t accumulator_type;
+    };
+#endif
+
+    template <>
+    struct kernel<float>
+    {
+      static ETL_CONSTANT bool Supported = true;
+
+      typedef double accumulator_type;
+    };
+
+    //*************************************************************************
+    /// Whether a range given by TIterator can use the kernel for TInput.
+    /// The results are converted to TCalc, so it must be arithmetic.
+    //*************************************************************************
+    template <typename TIterator, typename TInput, typename TCalc>
+    struct use_kernel
+    {
+      typedef typename etl::remove_const<typename etl::remove_pointer<TIterator>::type>::type pointee_t;
+
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value &&
+                                       etl::is_same<pointee_t, TInput>::value &&
+                                       etl::is_arithmetic<TCalc>::value &&
+                                       kernel<TInput>::Supported;
+    };
+
+#if ETL_STATISTICS_SIMD_SSE2
+    //*************************************************************************
+    /// Adds the lanes of a vector of int32_t.
+    //*************************************************************************
+    inline int64_t sse2_sum_int32(__m128i v)
+    {
+      int32_t lanes[4];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+
+      return int64_t(lanes[0]) + int64_t(lanes[1]) + int64_t(lanes[2]) + int64_t(lanes[3]);
+    }
+
+    //*************************************************************************
+    /// Adds the lanes of a vector of int64_t.
+    //*************************************************************************
+    inline int64_t sse2_sum_int64(__m128i v)
+    {
+      int64_t lanes[2];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+
+      return lanes[0] + lanes[1];
+    }
+
+    //*************************************************************************
+    /// Adds the lanes of a vector of double.
+    //*************************************************************************
+    inline double sse2_sum_double(__m128d v)
+    {
+      return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+    }
+
+    //*************************************************************************
+    /// Adds a vector of samples to the sum and/or the sum of squares.
+    //*************************************************************************
+    template <bool Want_Sum, bool Want_Squares>
+    void sse2_add_moments(__m128d& sum, __m128d& squares, __m128d x)
+    {
+      if (Want_Sum)
+      {
+        sum = _mm_add_pd(sum, x);
+      }
+
+      if (Want_Squares)
+      {
+        squares = _mm_add_pd(squares, _mm_mul_pd(x, x));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds vectors of pairs of samples to the sums, the inner product and
+    /// optionally the sums of squares.
+    //*************************************************************************
+    template <bool Want_Squares>
+    void sse2_add_co_moments(__m128d& sum1, __m128d& sum2, __m128d& squares1, __m128d& squares2, __m128d& inner, __m128d x, __m128d y)
+    {
+      sum1  = _mm_add_pd(sum1, x);
+      sum2  = _mm_add_pd(sum2, y);
+      inner = _mm_add_pd(inner, _mm_mul_pd(x, y));
+
+      if (Want_Squares)
+      {
+        squares1 = _mm_add_pd(squares1, _mm_mul_pd(x, x));
+        squares2 = _mm_add_pd(squares2, _mm_mul_pd(y, y));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds pairs of squares of int16_t to a vector of int64_t.
+    /// A pair of squares is at most 2^31, so it is widened as unsigned.
+    //*************************************************************************
+    inline __m128i sse2_add_squares(__m128i total, __m128i a)
+    {
+      const __m128i squares = _mm_madd_epi16(a, a);
+
+      total = _mm_add_epi64(total, _mm_unpacklo_epi32(squares, _mm_setzero_si128()));
+      total = _mm_add_epi64(total, _mm_unpackhi_epi32(squares, _mm_setzero_si128()));
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Adds pairs of products of int16_t to a vector of int64_t.
+    /// A pair sums to at most 2^31, which pmaddwd returns as INT32_MIN. No
+    /// pair can sum to INT32_MIN itself, so that lane is widened as unsigned.
+    //*************************************************************************
+    inline __m128i sse2_add_products(__m128i total, __m128i a, __m128i b)
+    {
+      const __m128i products = _mm_madd_epi16(a, b);
+      const __m128i wrapped  = _mm_cmpeq_epi32(products, _mm_set1_epi32(int32_t(0x80000000UL)));
+      const __m128i sign     = _mm_andnot_si128(wrapped, _mm_srai_epi32(products, 31));
+
+      total = _mm_add_epi64(total, _mm_unpacklo_epi32(products, sign));
+      total = _mm_add_epi64(total, _mm_unpackhi_epi32(products, sign));
+
+      return total;
+    }
+#endif
+
+#if ETL_STATISTICS_SIMD_NEON
+    //*************************************************************************
+    /// Adds the products of int16_t to a vector of int64_t.
+    //*************************************************************************
+    inline int64x2_t neon_add_products(int64x2_t total, int16x8_t a, int16x8_t b)
+    {
+      total = vpadalq_s32(total, vmull_s16(vget_low_s16(a), vget_low_s16(b)));
+      total = vpadalq_s32(total, vmull_s16(vget_high_s16(a), vget_high_s16(b)));
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Adds the lanes of a vector of int64_t.
+    //*************************************************************************
+    inline int64_t neon_sum_int64(int64x2_t v)
+    {
+      return vgetq_lane_s64(v, 0) + vgetq_lane_s64(v, 1);
+    }
+#endif
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The largest number of vectors of int16_t that can be summed in 32 bit
+    /// lanes. Each lane gains at most 2 * 32768 a vector.
+    //*************************************************************************
+    static const size_t Max_Int16_Vectors = 16384U;
+
+    //*************************************************************************
+    /// Accumulates the sum and/or the sum of squares of n int16_t.
+    //*************************************************************************
+    template <bool Want_Sum, bool Want_Squares>
+    void accumulate_moments(const int16_t* p, size_t n, moments<int64_t>& m)
+    {
+  #if ETL_STATISTICS_SIMD_SSE2
+      const __m128i ones = _mm_set1_epi16(1);
+
+      while (n >= 8U)
+      {
+        size_t vectors = n / 8U;
+        vectors = (vectors < Max_Int16_Vectors) ? vectors : Max_Int16_Vectors;
+        n      -= vectors * 8U;
+
+        __m128i sum     = _mm_setzero_si128();
+        __m128i squares = _mm_setzero_si128();
+
+        while (vectors-- != 0U)
+        {
+          const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+          p += 8U;
+
+          if (Want_Sum)
+          {
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(x, ones));
+          }
+
+          if (Want_Squares)
+          {
+            squares = sse2_add_squares(squares, x);
+          }
+        }
+
+        m.sum            += sse2_sum_int32(sum);
+        m.sum_of_squares += sse2_sum_int64(squares);
+      }
+  #elif ETL_STATISTICS_SIMD_NEON
+      while (n >= 8U)
+      {
+        size_t vectors = n / 8U;
+        vectors = (vectors < Max_Int16_Vectors) ? vectors : Max_Int16_Vectors;
+        n      -= vectors * 8U;
+
+        int32x4_t sum     = vdupq_n_s32(0);
+        int64x2_t squares = vdupq_n_s64(0);
+
+        while (vectors-- != 0U)
+        {
+          const int16x8_t x = vld1q_s16(p);
+          p += 8U;
+
+          if (Want_Sum)
+          {
+            sum = vpadalq_s16(sum, x);
+          }
+
+          if (Want_Squares)
+          {
+            squares = neon_add_products(squares, x, x);
+          }
+        }
+
+        m.sum            += neon_sum_int64(vpaddlq_s32(sum));
+        m.sum_of_squares += neon_sum_int64(squares);
+      }
+  #endif
+
+      while (n-- != 0U)
+      {
+        const int32_t x = *p++;
+
+        if (Want_Sum)
+        {
+          m.sum += x;
+        }
+
+        if (Want_Squares)
+        {
+          m.sum_of_squares += x * x;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Accumulates the sums, the inner product and optionally the sums of
+    /// squares of n pairs of int16_t.
+    //*************************************************************************
+    template <bool Want_Squares>
+    void accumulate_co_moments(const int16_t* p1, const int16_t* p2, size_t n, co_moments<int64_t>& m)
+    {
+  #if ETL_STATISTICS_SIMD_SSE2
+      const __m128i ones = _mm_set1_epi16(1);
+
+      while (n >= 8U)
+      {
+        size_t vectors = n / 8U;
+        vectors = (vectors < Max_Int16_Vectors) ? vectors : Max_Int16_Vectors;
+        n      -= vectors * 8U;
+
+        __m128i sum1     = _mm_setzero_si128();
+        __m128i sum2     = _mm_setzero_si128();
+        __m128i squares1 = _mm_setzero_si128();
+        __m128i squares2 = _mm_setzero_si128();
+        __m128i inner    = _mm_setzero_si128();
+
+        while (vectors-- != 0U)
+        {
+          const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1));
+          const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2));
+          p1 += 8U;
+          p2 += 8U;
+
+          sum1  = _mm_add_epi32(sum1, _mm_madd_epi16(x, ones));
+          sum2  = _mm_add_epi32(sum2, _mm_madd_epi16(y, ones));
+          inner = sse2_add_products(inner, x, y);
+
+          if (Want_Squares)
+          {
+            squares1 = sse2_add_squares(squares1, x);
+            squares2 = sse2_add_squares(squares2, y);
+          }
+        }
+
+        m.sum1            += sse2_sum_int32(sum1);
+        m.sum2            += sse2_sum_int32(sum2);
+        m.sum_of_squares1 += sse2_sum_int64(squares1);
+        m.sum_of_squares2 += sse2_sum_int64(squares2);
+        m.inner_product   += sse2_sum_int64(inner);
+      }
+  #elif ETL_STATISTICS_SIMD_NEON
+      while (n >= 8U)
+      {
+        size_t vectors = n / 8U;
+        vectors = (vectors < Max_Int16_Vectors) ? vectors : Max_Int16_Vectors;
+        n      -= vectors * 8U;
+
+        int32x4_t sum1     = vdupq_n_s32(0);
+        int32x4_t sum2     = vdupq_n_s32(0);
+        int64x2_t squares1 = vdupq_n_s64(0);
+        int64x2_t squares2 = vdupq_n_s64(0);
+        int64x2_t inner    = vdupq_n_s64(0);
+
+        while (vectors-- != 0U)
+        {
+          const int16x8_t x = vld1q_s16(p1);
+          const int16x8_t y = vld1q_s16(p2);
+          p1 += 8U;
+          p2 += 8U;
+
+          sum1  = vpadalq_s16(sum1, x);
+          sum2  = vpadalq_s16(sum2, y);
+          inner = neon_add_products(inner, x, y);
+
+          if (Want_Squares)
+          {
+            squares1 = neon_add_products(squares1, x, x);
+            squares2 = neon_add_products(squares2, y, y);
+          }
+        }
+
+        m.sum1            += neon_sum_int64(vpaddlq_s32(sum1));
+        m.sum2            += neon_sum_int64(vpaddlq_s32(sum2));
+        m.sum_of_squares1 += neon_sum_int64(squares1);
+        m.sum_of_squares2 += neon_sum_int64(squares2);
+        m.inner_product   += neon_sum_int64(inner);
+      }
+  #endif
+
+      while (n-- != 0U)
+      {
+        const int32_t x = *p1++;
+        const int32_t y = *p2++;
+
+        m.sum1          += x;
+        m.sum2          += y;
+        m.inner_product += x * y;
+
+        if (Want_Squares)
+        {
+          m.sum_of_squares1 += x * x;
+          m.sum_of_squares2 += y * y;
+        }
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// The number of float samples summed in float before the partial sums
+    /// are added to the double totals, where there are no double lanes.
+    //*************************************************************************
+    static const size_t Float_Chunk = 64U;
+
+    //*************************************************************************
+    /// Accumulates the sum and/or the sum of squares of n float.
+    //*************************************************************************
+    template <bool Want_Sum, bool Want_Squares>
+    void accumulate_moments(const float* p, size_t n, moments<double>& m)
+    {
+#if ETL_STATISTICS_SIMD_SSE2
+      // Eight at a time, in four double accumulators for each sum, so that
+      // the loop is not bound by the latency of the additions.
+      __m128d sum0     = _mm_setzero_pd();
+      __m128d sum1     = _mm_setzero_pd();
+      __m128d sum2     = _mm_setzero_pd();
+      __m128d sum3     = _mm_setzero_pd();
+      __m128d squares0 = _mm_setzero_pd();
+      __m128d squares1 = _mm_setzero_pd();
+      __m128d squares2 = _mm_setzero_pd();
+      __m128d squares3 = _mm_setzero_pd();
+
+      while (n >= 8U)
+      {
+        const __m128 x0 = _mm_loadu_ps(p);
+        const __m128 x1 = _mm_loadu_ps(p + 4U);
+        p += 8U;
+        n -= 8U;
+
+        sse2_add_moments<Want_Sum, Want_Squares>(sum0, squares0, _mm_cvtps_pd(x0));
+        sse2_add_moments<Want_Sum, Want_Squares>(sum1, squares1, _mm_cvtps_pd(_mm_movehl_ps(x0, x0)));
+        sse2_add_moments<Want_Sum, Want_Squares>(sum2, squares2, _mm_cvtps_pd(x1));
+        sse2_add_moments<Want_Sum, Want_Squares>(sum3, squares3, _mm_cvtps_pd(_mm_movehl_ps(x1, x1)));
+      }
+
+      m.sum            += sse2_sum_double(_mm_add_pd(_mm_add_pd(sum0, sum1), _mm_add_pd(sum2, sum3)));
+      m.sum_of_squares += sse2_sum_double(_mm_add_pd(_mm_add_pd(squares0, squares1), _mm_add_pd(squares2, squares3)));
+#elif ETL_STATISTICS_SIMD_NEON_DOUBLE
+      float64x2_t sum_lo     = vdupq_n_f64(0.0);
+      float64x2_t sum_hi     = vdupq_n_f64(0.0);
+      float64x2_t squares_lo = vdupq_n_f64(0.0);
+      float64x2_t squares_hi = vdupq_n_f64(0.0);
+
+      while (n >= 4U)
+      {
+        const float32x4_t x  = vld1q_f32(p);
+        const float64x2_t lo = vcvt_f64_f32(vget_low_f32(x));
+        const float64x2_t hi = vcvt_high_f64_f32(x);
+        p += 4U;
+        n -= 4U;
+
+        if (Want_Sum)
+        {
+          sum_lo = vaddq_f64(sum_lo, lo);
+          sum_hi = vaddq_f64(sum_hi, hi);
+        }
+
+        if (Want_Squares)
+        {
+          squares_lo = vfmaq_f64(squares_lo, lo, lo);
+          squares_hi = vfmaq_f64(squares_hi, hi, hi);
+        }
+      }
+
+      m.sum            += vaddvq_f64(vaddq_f64(sum_lo, sum_hi));
+      m.sum_of_squares += vaddvq_f64(vaddq_f64(squares_lo, squares_hi));
+#else
+      // Four partial sums break the dependency between the additions.
+      while (n >= 4U)
+      {
+        size_t count = n & ~size_t(3U);
+        count = (count < Float_Chunk) ? count : Float_Chunk;
+        n    -= count;
+
+        float sum[4]     = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float squares[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        for (; count != 0U; count -= 4U)
+        {
+          for (size_t i = 0U; i < 4U; ++i)
+          {
+            const float x = p[i];
+
+            if (Want_Sum)
+            {
+              sum[i] += x;
+            }
+
+            if (Want_Squares)
+            {
+              squares[i] += x * x;
+            }
+          }
+
+          p += 4U;
+        }
+
+        m.sum            += double(sum[0] + sum[1]) + double(sum[2] + sum[3]);
+        m.sum_of_squares += double(squares[0] + squares[1]) + double(squares[2] + squares[3]);
+      }
+#endif
+
+      while (n-- != 0U)
+      {
+        const double x = *p++;
+
+        if (Want_Sum)
+        {
+          m.sum += x;
+        }
+
+        if (Want_Squares)
+        {
+          m.sum_of_squares += x * x;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Accumulates the sums, the inner product and optionally the sums of
+    /// squares of n pairs of float.
+    //*************************************************************************
+    template <bool Want_Squares>
+    void accumulate_co_moments(const float* p1, const float* p2, size_t n, co_moments<double>& m)
+    {
+#if ETL_STATISTICS_SIMD_SSE2
+      // Four pairs at a time, in two double accumulators for each sum.
+      __m128d sum1_lo     = _mm_setzero_pd();
+      __m128d sum1_hi     = _mm_setzero_pd();
+      __m128d sum2_lo     = _mm_setzero_pd();
+      __m128d sum2_hi     = _mm_setzero_pd();
+      __m128d squares1_lo = _mm_setzero_pd();
+      __m128d squares1_hi = _mm_setzero_pd();
+      __m128d squares2_lo = _mm_setzero_pd();
+      __m128d squares2_hi = _mm_setzero_pd();
+      __m128d inner_lo    = _mm_setzero_pd();
+      __m128d inner_hi    = _mm_setzero_pd();
+
+      while (n >= 4U)
+      {
+        const __m128 x = _mm_loadu_ps(p1);
+        const __m128 y = _mm_loadu_ps(p2);
+        p1 += 4U;
+        p2 += 4U;
+        n  -= 4U;
+
+        sse2_add_co_moments<Want_Squares>(sum1_lo, sum2_lo, squares1_lo, squares2_lo, inner_lo,
+                                          _mm_cvtps_pd(x), _mm_cvtps_pd(y));
+        sse2_add_co_moments<Want_Squares>(sum1_hi, sum2_hi, squares1_hi, squares2_hi, inner_hi,
+                                          _mm_cvtps_pd(_mm_movehl_ps(x, x)), _mm_cvtps_pd(_mm_movehl_ps(y, y)));
+      }
+
+      m.sum1            += sse2_sum_double(_mm_add_pd(sum1_lo, sum1_hi));
+      m.sum2            += sse2_sum_double(_mm_add_pd(sum2_lo, sum2_hi));
+      m.sum_of_squares1 += sse2_sum_double(_mm_add_pd(squares1_lo, squares1_hi));
+      m.sum_of_squares2 += sse2_sum_double(_mm_add_pd(squares2_lo, squares2_hi));
+      m.inner_product   += sse2_sum_double(_mm_add_pd(inner_lo, inner_hi));
+#elif ETL_STATISTICS_SIMD_NEON_DOUBLE
+      float64x2_t sum1     = vdupq_n_f64(0.0);
+      float64x2_t sum2     = vdupq_n_f64(0.0);
+      float64x2_t squares1 = vdupq_n_f64(0.0);
+      float64x2_t squares2 = vdupq_n_f64(0.0);
+      float64x2_t inner    = vdupq_n_f64(0.0);
+
+      while (n >= 2U)
+      {
+        const float64x2_t x = vcvt_f64_f32(vld1_f32(p1));
+        const float64x2_t y = vcvt_f64_f32(vld1_f32(p2));
+        p1 += 2U;
+        p2 += 2U;
+        n  -= 2U;
+
+        sum1  = vaddq_f64(sum1, x);
+        sum2  = vaddq_f64(sum2, y);
+        inner = vfmaq_f64(inner, x, y);
+
+        if (Want_Squares)
+        {
+          squares1 = vfmaq_f64(squares1, x, x);
+          squares2 = vfmaq_f64(squares2, y, y);
+        }
+      }
+
+      m.sum1            += vaddvq_f64(sum1);
+      m.sum2            += vaddvq_f64(sum2);
+      m.sum_of_squares1 += vaddvq_f64(squares1);
+      m.sum_of_squares2 += vaddvq_f64(squares2);
+      m.inner_product   += vaddvq_f64(inner);
+#else
+      // Two partial sums break the dependency between the additions.
+      while (n >= 2U)
+      {
+        size_t count = n & ~size_t(1U);
+        count = (count < Float_Chunk) ? count : Float_Chunk;
+        n    -= count;
+
+        float sum1[2]     = { 0.0f, 0.0f };
+        float sum2[2]     = { 0.0f, 0.0f };
+        float squares1[2] = { 0.0f, 0.0f };
+        float squares2[2] = { 0.0f, 0.0f };
+        float inner[2]    = { 0.0f, 0.0f };
+
+        for (; count != 0U; count -= 2U)
+        {
+          for (size_t i = 0U; i < 2U; ++i)
+          {
+            const float x = p1[i];
+            const float y = p2[i];
+
+            sum1[i]  += x;
+            sum2[i]  += y;
+            inner[i] += x * y;
+
+            if (Want_Squares)
+            {
+              squares1[i] += x * x;
+              squares2[i] += y * y;
+            }
+          }
+
+          p1 += 2U;
+          p2 += 2U;
+        }
+
+        m.sum1            += double(sum1[0]) + double(sum1[1]);
+        m.sum2            += double(sum2[0]) + double(sum2[1]);
+        m.sum_of_squares1 += double(squares1[0]) + double(squares1[1]);
+        m.sum_of_squares2 += double(squares2[0]) + double(squares2[1]);
+        m.inner_product   += double(inner[0]) + double(inner[1]);
+      }
+#endif
+
+      while (n-- != 0U)
+      {
+        const double x = *p1++;
+        const double y = *p2++;
+
+        m.sum1          += x;
+        m.sum2          += y;
+        m.inner_product += x * y;
+
+        if (Want_Squares)
+        {
+          m.sum_of_squares1 += x * x;
+          m.sum_of_squares2 += y * y;
+        }
+      }
+    }
+  }
+}
+
+#endif
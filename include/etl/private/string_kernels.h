@@ -0,0 +1,918 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_KERNELS_INCLUDED
+#define ETL_STRING_KERNELS_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../searcher.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// Search, compare, case and transcoding kernels for the strings and string views.
+// The 'char' versions process 16 characters at a time with SSE2 or NEON when
+// the compiler reports that the target supports them, unless
+// ETL_STRING_NO_SIMD is defined.
+//*****************************************************************************
+#if !defined(ETL_STRING_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_STRING_SIMD_SSE2 1
+#else
+  #define ETL_STRING_SIMD_SSE2 0
+#endif
+
+#if !defined(ETL_STRING_NO_SIMD) && !ETL_STRING_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__)) && !defined(__ARM_BIG_ENDIAN)
+  #define ETL_STRING_SIMD_NEON 1
+#else
+  #define ETL_STRING_SIMD_NEON 0
+#endif
+
+#if ETL_STRING_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_STRING_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+namespace etl
+{
+  namespace private_string
+  {
+#if ETL_STRING_SIMD_SSE2
+    //*************************************************************************
+    /// One bit per character, set where the 16 characters are equal.
+    //*************************************************************************
+    inline uint16_t equal_mask(const char* p1, const char* p2)
+    {
+      const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p1));
+      const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p2));
+
+      return uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)));
+    }
+
+    //*************************************************************************
+    inline uint16_t equal_mask(const char* p, const __m128i& c)
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+      return uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, c)));
+    }
+#endif
+
+#if ETL_STRING_SIMD_NEON
+    //*************************************************************************
+    /// Four bits per character, set where the 16 characters are equal.
+    //*************************************************************************
+    inline uint64_t equal_mask(const uint8x16_t& v1, const uint8x16_t& v2)
+    {
+      const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(v1, v2)), 4);
+
+      return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    //*************************************************************************
+    inline uint64_t equal_mask(const char* p1, const char* p2)
+    {
+      return equal_mask(vld1q_u8(reinterpret_cast<const uint8_t*>(p1)), vld1q_u8(reinterpret_cast<const uint8_t*>(p2)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first c in the range, or returns last.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, const T c)
+    {
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    inline const char* find_char(const char* first, const char* last, const char c)
+    {
+#if ETL_STRING_SIMD_SSE2
+      const __m128i needle = _mm_set1_epi8(c);
+
+      while ((last - first) >= 16)
+      {
+        const uint16_t mask = equal_mask(first, needle);
+
+        if (mask != 0U)
+        {
+          return first + etl::count_trailing_zeros(mask);
+        }
+
+        first += 16;
+      }
+#elif ETL_STRING_SIMD_NEON
+      const uint8x16_t needle = vdupq_n_u8(uint8_t(c));
+
+      while ((last - first) >= 16)
+      {
+        const uint64_t mask = equal_mask(vld1q_u8(reinterpret_cast<const uint8_t*>(first)), needle);
+
+        if (mask != 0U)
+        {
+          return first + (etl::count_trailing_zeros(mask) / 4U);
+        }
+
+        first += 16;
+      }
+#endif
+
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first difference, or n if there is none.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch(const T* p1, const T* p2, const size_t n)
+    {
+      size_t i = 0U;
+
+      while ((i != n) && (p1[i] == p2[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    inline size_t mismatch(const char* p1, const char* p2, const size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      while ((n - i) >= 16U)
+      {
+        const uint16_t mask = equal_mask(p1 + i, p2 + i);
+
+        if (mask != 0xFFFFU)
+        {
+          return i + etl::count_trailing_zeros(uint16_t(~mask));
+        }
+
+        i += 16U;
+      }
+#elif ETL_STRING_SIMD_NEON
+      while ((n - i) >= 16U)
+      {
+        const uint64_t mask = equal_mask(p1 + i, p2 + i);
+
+        if (mask != UINT64_MAX)
+        {
+          return i + (etl::count_trailing_zeros(uint64_t(~mask)) / 4U);
+        }
+
+        i += 16U;
+      }
+#endif
+
+      while ((i != n) && (p1[i] == p2[i]))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Compares n characters. Returns -1, 0 or 1.
+    //*************************************************************************
+    template <typename T>
+    int compare(const T* p1, const T* p2, const size_t n)
+    {
+      const size_t i = etl::private_string::mismatch(p1, p2, n);
+
+      if (i == n)
+      {
+        return 0;
+      }
+
+      return (p1[i] < p2[i]) ? -1 : 1;
+    }
+
+    //*************************************************************************
+    /// Tuning for search.
+    //*************************************************************************
+    enum
+    {
+      // Patterns at least this long may switch to Boyer-Moore-Horspool.
+      Horspool_Min_Length = 6,
+
+      // The number of false candidates in a window before deciding whether to switch.
+      Horspool_Candidates = 16,
+
+      // Switch if the false candidates are, on average, closer than this.
+      Horspool_Candidate_Spacing = 64,
+
+      // Switch only if there is at least this much left to search.
+      Horspool_Min_Remaining = 256
+    };
+
+    //*************************************************************************
+    /// Finds the first occurrence of s[0, n) in the range, or returns last.
+    /// Candidates are found by searching for the first character.
+    /// If the first character turns out to be common, and the pattern is
+    /// long enough, the rest of the range is searched with
+    /// Boyer-Moore-Horspool, which skips ahead by up to the pattern length.
+    //*************************************************************************
+    template <typename T>
+    const T* search(const T* first, const T* last, const T* s, const size_t n)
+    {
+      if (n == 0U)
+      {
+        return first;
+      }
+
+      if (size_t(last - first) < n)
+      {
+        return last;
+      }
+
+      // The last position that a match could start.
+      const T* const final_start = last - n + 1;
+
+      const T* window     = first;
+      size_t   candidates = 0U;
+
+      while (first != final_start)
+      {
+        first = etl::private_string::find_char(first, final_start, s[0]);
+
+        if (first == final_start)
+        {
+          break;
+        }
+
+        if (etl::private_string::mismatch(first + 1, s + 1, n - 1U) == (n - 1U))
+        {
+          return first;
+        }
+
+        ++first;
+
+        if ((n >= size_t(Horspool_Min_Length)) && (++candidates == size_t(Horspool_Candidates)))
+        {
+          if ((size_t(first - window) < size_t(Horspool_Candidates * Horspool_Candidate_Spacing)) &&
+              (size_t(last - first) >= size_t(Horspool_Min_Remaining)))
+          {
+            etl::private_searcher::horspool_table table;
+            table.build(s, n);
+
+            return etl::private_searcher::horspool_search(first, last, s, n, table);
+          }
+
+          window     = first;
+          candidates = 0U;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of 'char', as a 256 bit map.
+    //*************************************************************************
+    class char_set
+    {
+    public:
+
+      //*******************************************
+      char_set(const char* s, size_t n)
+      {
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          bits[i] = 0U;
+        }
+
+        while (n-- != 0U)
+        {
+          const uint8_t c = uint8_t(*s++);
+          bits[c >> 5U] |= (uint32_t(1U) << (c & 0x1FU));
+        }
+      }
+
+      //*******************************************
+      bool contains(const char c) const
+      {
+        const uint8_t u = uint8_t(c);
+
+        return ((bits[u >> 5U] >> (u & 0x1FU)) & 1U) != 0U;
+      }
+
+    private:
+
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// A set of delimiters, searched element by element.
+    /// The characters are referenced, not copied.
+    //*************************************************************************
+    template <typename T>
+    class delimiter_set
+    {
+    public:
+
+      //*******************************************
+      delimiter_set(const T* s, size_t n)
+        : p_delimiters(s)
+        , length(n)
+      {
+      }
+
+      //*******************************************
+      bool contains(const T c) const
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          if (p_delimiters[i] == c)
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      const T* p_delimiters;
+      size_t   length;
+    };
+
+    //*************************************************************************
+    /// The 'char' delimiters are held as a bit map.
+    //*************************************************************************
+    template <>
+    class delimiter_set<char> : public char_set
+    {
+    public:
+
+      //*******************************************
+      delimiter_set(const char* s, size_t n)
+        : char_set(s, n)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Finds the first character in the range that is in s[0, n).
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_of(const T* first, const T* last, const T* s, const size_t n)
+    {
+      while (first != last)
+      {
+        for (size_t j = 0U; j < n; ++j)
+        {
+          if (*first == s[j])
+          {
+            return first;
+          }
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    inline const char* find_first_of(const char* first, const char* last, const char* s, const size_t n)
+    {
+      if (n == 1U)
+      {
+        return etl::private_string::find_char(first, last, s[0]);
+      }
+
+      const char_set set(s, n);
+
+      while ((first != last) && !set.contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the first character in the range that is not in s[0, n).
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_not_of(const T* first, const T* last, const T* s, const size_t n)
+    {
+      while (first != last)
+      {
+        bool found = false;
+
+        for (size_t j = 0U; j < n; ++j)
+        {
+          if (*first == s[j])
+          {
+            found = true;
+            break;
+          }
+        }
+
+        if (!found)
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    inline const char* find_first_not_of(const char* first, const char* last, const char* s, const size_t n)
+    {
+      const char_set set(s, n);
+
+      while ((first != last) && set.contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// ASCII case conversion of one character, as in the "C" locale.
+    /// Other characters are unchanged.
+    //*************************************************************************
+    template <typename T>
+    T to_upper_ascii(const T c)
+    {
+      return ((c >= T('a')) && (c <= T('z'))) ? T(c - T('a' - 'A')) : c;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    T to_lower_ascii(const T c)
+    {
+      return ((c >= T('A')) && (c <= T('Z'))) ? T(c + T('a' - 'A')) : c;
+    }
+
+#if ETL_STRING_SIMD_SSE2
+    //*************************************************************************
+    /// Changes the case of the letters in 16 characters.
+    /// The compares are signed, so characters above 0x7F are never letters.
+    //*************************************************************************
+    inline __m128i upper_case_block(const __m128i& v)
+    {
+      const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+
+      return _mm_xor_si128(v, _mm_and_si128(is_lower, _mm_set1_epi8(0x20)));
+    }
+
+    //*************************************************************************
+    inline __m128i lower_case_block(const __m128i& v)
+    {
+      const __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+      return _mm_or_si128(v, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+    }
+#endif
+
+#if ETL_STRING_SIMD_NEON
+    //*************************************************************************
+    /// Changes the case of the letters in 16 characters.
+    //*************************************************************************
+    inline uint8x16_t upper_case_block(const uint8x16_t& v)
+    {
+      const uint8x16_t is_lower = vandq_u8(vcgeq_u8(v, vdupq_n_u8('a')), vcleq_u8(v, vdupq_n_u8('z')));
+
+      return veorq_u8(v, vandq_u8(is_lower, vdupq_n_u8(0x20)));
+    }
+
+    //*************************************************************************
+    inline uint8x16_t lower_case_block(const uint8x16_t& v)
+    {
+      const uint8x16_t is_upper = vandq_u8(vcgeq_u8(v, vdupq_n_u8('A')), vcleq_u8(v, vdupq_n_u8('Z')));
+
+      return vorrq_u8(v, vandq_u8(is_upper, vdupq_n_u8(0x20)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Converts the ASCII letters in the range to upper case.
+    //*************************************************************************
+    template <typename T>
+    void to_upper_ascii(T* first, T* last)
+    {
+      while (first != last)
+      {
+        *first = etl::private_string::to_upper_ascii(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    inline void to_upper_ascii(char* first, char* last)
+    {
+#if ETL_STRING_SIMD_SSE2
+      while ((last - first) >= 16)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first), upper_case_block(v));
+        first += 16;
+      }
+#elif ETL_STRING_SIMD_NEON
+      while ((last - first) >= 16)
+      {
+        uint8_t* p = reinterpret_cast<uint8_t*>(first);
+        vst1q_u8(p, upper_case_block(vld1q_u8(p)));
+        first += 16;
+      }
+#endif
+
+      while (first != last)
+      {
+        *first = etl::private_string::to_upper_ascii(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Converts the ASCII letters in the range to lower case.
+    //*************************************************************************
+    template <typename T>
+    void to_lower_ascii(T* first, T* last)
+    {
+      while (first != last)
+      {
+        *first = etl::private_string::to_lower_ascii(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    inline void to_lower_ascii(char* first, char* last)
+    {
+#if ETL_STRING_SIMD_SSE2
+      while ((last - first) >= 16)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first), lower_case_block(v));
+        first += 16;
+      }
+#elif ETL_STRING_SIMD_NEON
+      while ((last - first) >= 16)
+      {
+        uint8_t* p = reinterpret_cast<uint8_t*>(first);
+        vst1q_u8(p, lower_case_block(vld1q_u8(p)));
+        first += 16;
+      }
+#endif
+
+      while (first != last)
+      {
+        *first = etl::private_string::to_lower_ascii(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces each old_c in the range with new_c.
+    //*************************************************************************
+    template <typename T>
+    void replace_char(T* first, T* last, const T old_c, const T new_c)
+    {
+      while (first != last)
+      {
+        if (*first == old_c)
+        {
+          *first = new_c;
+        }
+
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    inline void replace_char(char* first, char* last, const char old_c, const char new_c)
+    {
+#if ETL_STRING_SIMD_SSE2
+      const __m128i old_v = _mm_set1_epi8(old_c);
+      const __m128i new_v = _mm_set1_epi8(new_c);
+
+      while ((last - first) >= 16)
+      {
+        const __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i hits = _mm_cmpeq_epi8(v, old_v);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first), _mm_or_si128(_mm_and_si128(hits, new_v), _mm_andnot_si128(hits, v)));
+        first += 16;
+      }
+#elif ETL_STRING_SIMD_NEON
+      const uint8x16_t old_v = vdupq_n_u8(uint8_t(old_c));
+      const uint8x16_t new_v = vdupq_n_u8(uint8_t(new_c));
+
+      while ((last - first) >= 16)
+      {
+        uint8_t* p = reinterpret_cast<uint8_t*>(first);
+        const uint8x16_t v = vld1q_u8(p);
+        vst1q_u8(p, vbslq_u8(vceqq_u8(v, old_v), new_v, v));
+        first += 16;
+      }
+#endif
+
+      while (first != last)
+      {
+        if (*first == old_c)
+        {
+          *first = new_c;
+        }
+
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first difference, ignoring the case of ASCII
+    /// letters, or n if there is none.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch_ignoring_case(const T* p1, const T* p2, const size_t n)
+    {
+      size_t i = 0U;
+
+      while ((i != n) && (etl::private_string::to_lower_ascii(p1[i]) == etl::private_string::to_lower_ascii(p2[i])))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    inline size_t mismatch_ignoring_case(const char* p1, const char* p2, const size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      while ((n - i) >= 16U)
+      {
+        const __m128i v1 = lower_case_block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p1 + i)));
+        const __m128i v2 = lower_case_block(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p2 + i)));
+        const uint16_t mask = uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)));
+
+        if (mask != 0xFFFFU)
+        {
+          return i + etl::count_trailing_zeros(uint16_t(~mask));
+        }
+
+        i += 16U;
+      }
+#elif ETL_STRING_SIMD_NEON
+      while ((n - i) >= 16U)
+      {
+        const uint8x16_t v1 = lower_case_block(vld1q_u8(reinterpret_cast<const uint8_t*>(p1 + i)));
+        const uint8x16_t v2 = lower_case_block(vld1q_u8(reinterpret_cast<const uint8_t*>(p2 + i)));
+        const uint64_t mask = equal_mask(v1, v2);
+
+        if (mask != UINT64_MAX)
+        {
+          return i + (etl::count_trailing_zeros(uint64_t(~mask)) / 4U);
+        }
+
+        i += 16U;
+      }
+#endif
+
+      while ((i != n) && (etl::private_string::to_lower_ascii(p1[i]) == etl::private_string::to_lower_ascii(p2[i])))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The length of the leading run of ASCII characters.
+    //*************************************************************************
+    inline size_t ascii_length(const char* p, const size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      while ((n - i) >= 16U)
+      {
+        const uint16_t mask = uint16_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i))));
+
+        if (mask != 0U)
+        {
+          return i + etl::count_trailing_zeros(mask);
+        }
+
+        i += 16U;
+      }
+#elif ETL_STRING_SIMD_NEON
+      const uint8x16_t limit = vdupq_n_u8(0x80U);
+
+      while ((n - i) >= 16U)
+      {
+        const uint8x16_t high = vcgeq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(p + i)), limit);
+        const uint64_t   mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0);
+
+        if (mask != 0U)
+        {
+          return i + (etl::count_trailing_zeros(mask) / 4U);
+        }
+
+        i += 16U;
+      }
+#endif
+
+      while ((i != n) && (uint8_t(p[i]) < 0x80U))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Copies the leading run of ASCII characters from one character type to
+    /// another. Returns the number of characters copied.
+    //*************************************************************************
+    template <typename TIn, typename TOut>
+    size_t copy_ascii(const TIn* p, const size_t n, TOut* out)
+    {
+      size_t i = 0U;
+
+      while ((i != n) && (uint32_t(p[i]) < 0x80U))
+      {
+        out[i] = TOut(p[i]);
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    inline size_t copy_ascii(const char* p, const size_t n, char16_t* out)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      const __m128i zero = _mm_setzero_si128();
+
+      while ((n - i) >= 16U)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+        if (_mm_movemask_epi8(v) != 0)
+        {
+          break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),      _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8U), _mm_unpackhi_epi8(v, zero));
+        i += 16U;
+      }
+#elif ETL_STRING_SIMD_NEON
+      const uint8x16_t limit = vdupq_n_u8(0x80U);
+
+      while ((n - i) >= 16U)
+      {
+        const uint8x16_t v    = vld1q_u8(reinterpret_cast<const uint8_t*>(p + i));
+        const uint8x16_t high = vcgeq_u8(v, limit);
+
+        if (vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(high), 4)), 0) != 0U)
+        {
+          break;
+        }
+
+        vst1q_u16(reinterpret_cast<uint16_t*>(out + i),      vmovl_u8(vget_low_u8(v)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(out + i + 8U), vmovl_u8(vget_high_u8(v)));
+        i += 16U;
+      }
+#endif
+
+      return i + copy_ascii<char, char16_t>(p + i, n - i, out + i);
+    }
+
+    //*************************************************************************
+    inline size_t copy_ascii(const char* p, const size_t n, char32_t* out)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      const __m128i zero = _mm_setzero_si128();
+
+      while ((n - i) >= 16U)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+
+        if (_mm_movemask_epi8(v) != 0)
+        {
+          break;
+        }
+
+        const __m128i low  = _mm_unpacklo_epi8(v, zero);
+        const __m128i high = _mm_unpackhi_epi8(v, zero);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),       _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4U),  _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8U),  _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12U), _mm_unpackhi_epi16(high, zero));
+        i += 16U;
+      }
+#endif
+
+      return i + copy_ascii<char, char32_t>(p + i, n - i, out + i);
+    }
+
+    //*************************************************************************
+    inline size_t copy_ascii(const char16_t* p, const size_t n, char* out)
+    {
+      size_t i = 0U;
+
+#if ETL_STRING_SIMD_SSE2
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i high = _mm_set1_epi16(short(0xFF80));
+
+      while ((n - i) >= 16U)
+      {
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + 8U));
+        const __m128i hi = _mm_and_si128(_mm_or_si128(v1, v2), high);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(hi, zero)) != 0xFFFF)
+        {
+          break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(v1, v2));
+        i += 16U;
+      }
+#elif ETL_STRING_SIMD_NEON
+      const uint16x8_t limit = vdupq_n_u16(0x80U);
+
+      while ((n - i) >= 16U)
+      {
+        const uint16x8_t v1   = vld1q_u16(reinterpret_cast<const uint16_t*>(p + i));
+        const uint16x8_t v2   = vld1q_u16(reinterpret_cast<const uint16_t*>(p + i + 8U));
+        const uint16x8_t high = vcgeq_u16(vmaxq_u16(v1, v2), limit);
+
+        if (vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(high)), 0) != 0U)
+        {
+          break;
+        }
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(out + i), vcombine_u8(vmovn_u16(v1), vmovn_u16(v2)));
+        i += 16U;
+      }
+#endif
+
+      return i + copy_ascii<char16_t, char>(p + i, n - i, out + i);
+    }
+  }
+}
+
+#endif
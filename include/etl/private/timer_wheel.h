@@ -0,0 +1,339 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../static_assert.h"
+#include "../timer.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Common definitions for the timer wheels.
+  /// The modes and start states are those in etl::timer.
+  //***************************************************************************
+  struct timer_wheel
+  {
+    // Timer id.
+    struct id
+    {
+      enum
+      {
+        NO_TIMER = 0xFFFF
+      };
+
+      typedef uint_least16_t type;
+    };
+  };
+
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// A hierarchical timing wheel of intrusive timer lists.
+    /// Level L has 2^SLOT_BITS slots, each covering 2^(SLOT_BITS * L) ticks.
+    /// A timer is placed on the lowest level that spans its remaining time, and
+    /// is moved down a level each time the level above turns over to its slot.
+    /// Insert, remove and expire are O(1). Advancing the time is O(1) per tick,
+    /// plus the cost of moving down any timers in the slots that turn over.
+    /// TData must have 'expiry', 'slot', 'previous' and 'next' members.
+    ///\tparam TData The timer data type.
+    //*************************************************************************
+    template <typename TData>
+    class wheel
+    {
+    public:
+
+      typedef etl::timer_wheel::id::type id_type;
+
+      /// The slot value of a timer that is not in the wheel.
+      static ETL_CONSTANT uint_least16_t No_Slot = 0xFFFFU;
+
+      //*******************************
+      wheel(TData* ptimers_, id_type* pslots_, uint_least8_t slot_bits_, uint_least8_t levels_)
+        : ptimers(ptimers_),
+          pslots(pslots_),
+          slot_bits(slot_bits_),
+          levels(levels_),
+          slot_mask((1UL << slot_bits_) - 1U),
+          now(0U),
+          active(0U)
+      {
+        clear();
+      }
+
+      //*******************************
+      /// Empties the wheel and resets the time.
+      //*******************************
+      void clear()
+      {
+        const size_t n_slots = size_t(levels) << slot_bits;
+
+        for (size_t i = 0U; i < n_slots; ++i)
+        {
+          pslots[i] = etl::timer_wheel::id::NO_TIMER;
+        }
+
+        now    = 0U;
+        active = 0U;
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active == 0U;
+      }
+
+      //*******************************
+      /// The number of timers in the wheel.
+      //*******************************
+      size_t size() const
+      {
+        return active;
+      }
+
+      //*******************************
+      /// Inserts the timer to expire after delay ticks.
+      //*******************************
+      void insert(id_type id_, uint32_t delay)
+      {
+        ptimers[id_].expiry = now + delay;
+        place(id_);
+        ++active;
+      }
+
+      //*******************************
+      /// Removes the timer from the wheel.
+      //*******************************
+      void remove(id_type id_)
+      {
+        unlink(id_);
+        --active;
+      }
+
+      //*******************************
+      /// Removes and returns a timer that is due at the current time.
+      /// Returns etl::timer_wheel::id::NO_TIMER if there are none.
+      //*******************************
+      id_type pop_due()
+      {
+        const id_type id = pslots[now & slot_mask];
+
+        if (id != etl::timer_wheel::id::NO_TIMER)
+        {
+          remove(id);
+        }
+
+        return id;
+      }
+
+      //*******************************
+      /// Advances the time by one tick.
+      /// Moves down the timers in any higher level slots that turn over.
+      //*******************************
+      void advance()
+      {
+        ++now;
+
+        for (uint_least8_t level = 1U; level < levels; ++level)
+        {
+          const uint_least8_t shift = uint_least8_t(slot_bits * level);
+
+          // Only turns over when all of the lower levels have wrapped.
+          if ((shift >= 32U) || ((now & ((uint32_t(1U) << shift) - 1U)) != 0U))
+          {
+            break;
+          }
+
+          cascade((size_t(level) << slot_bits) + ((now >> shift) & slot_mask));
+        }
+      }
+
+      //*******************************
+      /// Returns the number of ticks until the next tick that either expires
+      /// a timer or moves timers down from a higher level.
+      /// The wheel must not be empty.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t next = etl::timer::state::INACTIVE;
+
+        // A timer on the lowest level expires at the time of its slot.
+        for (uint32_t offset = 0U; offset <= slot_mask; ++offset)
+        {
+          if (pslots[(now + offset) & slot_mask] != etl::timer_wheel::id::NO_TIMER)
+          {
+            next = offset;
+            break;
+          }
+        }
+
+        // A slot on a higher level moves its timers down when it turns over.
+        for (uint_least8_t level = 1U; level < levels; ++level)
+        {
+          const uint_least8_t shift = uint_least8_t(slot_bits * level);
+          const uint32_t      index = now >> shift;
+          const size_t        base  = size_t(level) << slot_bits;
+
+          for (uint32_t offset = 1U; offset <= (slot_mask + 1U); ++offset)
+          {
+            if (pslots[base + ((index + offset) & slot_mask)] != etl::timer_wheel::id::NO_TIMER)
+            {
+              const uint32_t delta = ((index + offset) << shift) - now;
+
+              next = (delta < next) ? delta : next;
+              break;
+            }
+          }
+        }
+
+        return next;
+      }
+
+      //*******************************
+      /// Advances the time without expiring or moving any timers.
+      /// No timer may be due within the skipped ticks.
+      //*******************************
+      void skip(uint32_t count)
+      {
+        now += count;
+      }
+
+    private:
+
+      //*******************************
+      /// Links the timer into the slot for its expiry time.
+      //*******************************
+      void place(id_type id_)
+      {
+        TData& timer = ptimers[id_];
+
+        const uint32_t delta = timer.expiry - now;
+
+        // Find the lowest level that spans the remaining time.
+        uint_least8_t level = 0U;
+
+        while ((level + 1U) < levels)
+        {
+          const uint_least8_t shift = uint_least8_t(slot_bits * (level + 1U));
+
+          if ((delta >> shift) == 0U)
+          {
+            break;
+          }
+
+          ++level;
+        }
+
+        const size_t slot = (size_t(level) << slot_bits) + ((timer.expiry >> (slot_bits * level)) & slot_mask);
+
+        // Append to the circular list for the slot.
+        const id_type head = pslots[slot];
+
+        if (head == etl::timer_wheel::id::NO_TIMER)
+        {
+          pslots[slot]   = id_;
+          timer.previous = id_;
+          timer.next     = id_;
+        }
+        else
+        {
+          TData& first = ptimers[head];
+
+          timer.previous                = first.previous;
+          timer.next                    = head;
+          ptimers[first.previous].next  = id_;
+          first.previous                = id_;
+        }
+
+        timer.slot = uint_least16_t(slot);
+      }
+
+      //*******************************
+      /// Unlinks the timer from its slot.
+      //*******************************
+      void unlink(id_type id_)
+      {
+        TData& timer = ptimers[id_];
+
+        if (timer.next == id_)
+        {
+          pslots[timer.slot] = etl::timer_wheel::id::NO_TIMER;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+          ptimers[timer.next].previous = timer.previous;
+
+          if (pslots[timer.slot] == id_)
+          {
+            pslots[timer.slot] = timer.next;
+          }
+        }
+
+        timer.previous = etl::timer_wheel::id::NO_TIMER;
+        timer.next     = etl::timer_wheel::id::NO_TIMER;
+        timer.slot     = No_Slot;
+      }
+
+      //*******************************
+      /// Moves the timers in the slot down to the lower levels.
+      //*******************************
+      void cascade(size_t slot)
+      {
+        id_type id = pslots[slot];
+
+        while (id != etl::timer_wheel::id::NO_TIMER)
+        {
+          unlink(id);
+          place(id);
+
+          id = pslots[slot];
+        }
+      }
+
+      TData* const         ptimers;
+      id_type* const       pslots;
+      const uint_least8_t  slot_bits;
+      const uint_least8_t  levels;
+      const uint32_t       slot_mask;
+      uint32_t             now;
+      size_t               active;
+    };
+
+    template <typename TData>
+    ETL_CONSTANT uint_least16_t wheel<TData>::No_Slot;
+  }
+}
+
+#endif
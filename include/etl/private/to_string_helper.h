@@ -45,6 +45,7 @@ SOFTWARE.
 #include "../algorithm.h"
 #include "../iterator.h"
 #include "../limits.h"
+#include "ryu.h"
 
 namespace etl
 {
@@ -129,8 +130,149 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// Digit tables for integral formatting.
+    //***************************************************************************
+    template <typename TDummy = void>
+    struct digit_tables
+    {
+      static const char decimal_pairs[200];
+      static const char lower_case[16];
+      static const char upper_case[16];
+    };
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::decimal_pairs[200] =
+    {
+      '0','0', '0','1', '0','2', '0','3', '0','4', '0','5', '0','6', '0','7', '0','8', '0','9',
+      '1','0', '1','1', '1','2', '1','3', '1','4', '1','5', '1','6', '1','7', '1','8', '1','9',
+      '2','0', '2','1', '2','2', '2','3', '2','4', '2','5', '2','6', '2','7', '2','8', '2','9',
+      '3','0', '3','1', '3','2', '3','3', '3','4', '3','5', '3','6', '3','7', '3','8', '3','9',
+      '4','0', '4','1', '4','2', '4','3', '4','4', '4','5', '4','6', '4','7', '4','8', '4','9',
+      '5','0', '5','1', '5','2', '5','3', '5','4', '5','5', '5','6', '5','7', '5','8', '5','9',
+      '6','0', '6','1', '6','2', '6','3', '6','4', '6','5', '6','6', '6','7', '6','8', '6','9',
+      '7','0', '7','1', '7','2', '7','3', '7','4', '7','5', '7','6', '7','7', '7','8', '7','9',
+      '8','0', '8','1', '8','2', '8','3', '8','4', '8','5', '8','6', '8','7', '8','8', '8','9',
+      '9','0', '9','1', '9','2', '9','3', '9','4', '9','5', '9','6', '9','7', '9','8', '9','9'
+    };
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::lower_case[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+    template <typename TDummy>
+    const char digit_tables<TDummy>::upper_case[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+    //***************************************************************************
+    /// Returns the shift for a power of two base, or 0 if it is not one.
+    //***************************************************************************
+    inline uint32_t base_shift(const uint32_t base)
+    {
+      switch (base)
+      {
+        case 2U:  return 1U;
+        case 8U:  return 3U;
+        case 16U: return 4U;
+        default:  return 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Returns the number of digits needed for a value.
+    //***************************************************************************
+    template <typename T>
+    uint32_t count_digits(T value, const uint32_t base, const uint32_t shift)
+    {
+      uint32_t count = 1U;
+
+      if (base == 10U)
+      {
+        // Four digits at a time.
+        for (;;)
+        {
+          if (value < 10U)    { return count; }
+          if (value < 100U)   { return count + 1U; }
+          if (value < 1000U)  { return count + 2U; }
+          if (value < 10000U) { return count + 3U; }
+
+          value /= 10000U;
+          count += 4U;
+        }
+      }
+      else if (shift != 0U)
+      {
+        while ((value >>= shift) != 0U)
+        {
+          ++count;
+        }
+      }
+      else
+      {
+        while ((value /= base) != 0U)
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of a value backwards, ending at p_end.
+    //***************************************************************************
+    template <typename T, typename TChar>
+    void write_digits(T value, TChar* p_end, const uint32_t base, const uint32_t shift, const bool upper_case)
+    {
+      if (base == 10U)
+      {
+        // Two digits at a time.
+        while (value >= 100U)
+        {
+          const uint32_t index = uint32_t(value % 100U) * 2U;
+          value /= 100U;
+
+          *--p_end = TChar(digit_tables<>::decimal_pairs[index + 1U]);
+          *--p_end = TChar(digit_tables<>::decimal_pairs[index]);
+        }
+
+        if (value >= 10U)
+        {
+          const uint32_t index = uint32_t(value) * 2U;
+
+          *--p_end = TChar(digit_tables<>::decimal_pairs[index + 1U]);
+          *--p_end = TChar(digit_tables<>::decimal_pairs[index]);
+        }
+        else
+        {
+          *--p_end = TChar('0' + uint32_t(value));
+        }
+      }
+      else if (shift != 0U)
+      {
+        const char* digits = upper_case ? digit_tables<>::upper_case : digit_tables<>::lower_case;
+        const T     mask   = T(base - 1U);
+
+        do
+        {
+          *--p_end = TChar(digits[value & mask]);
+          value >>= shift;
+        } while (value != 0U);
+      }
+      else
+      {
+        do
+        {
+          const uint32_t remainder = uint32_t(value % base);
+          value /= base;
+
+          *--p_end = (remainder > 9U) ? (upper_case ? TChar('A' + (remainder - 10U)) : TChar('a' + (remainder - 10U))) : TChar('0' + remainder);
+        } while (value != 0U);
+      }
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
+    /// The length is worked out first, so that the characters can be written
+    /// once, in place.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value,
@@ -139,8 +281,9 @@ namespace etl
                       bool append,
                       const bool negative)
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type           type;
+      typedef typename TIString::iterator             iterator;
+      typedef typename etl::make_unsigned<T>::type    unsigned_t;
 
       if (!append)
       {
@@ -149,65 +292,64 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
+      const uint32_t base  = format.get_base();
+      const uint32_t shift = etl::private_to_string::base_shift(base);
+
+      const unsigned_t magnitude = etl::is_negative(value) ? unsigned_t(unsigned_t(0) - unsigned_t(value)) : unsigned_t(value);
+
+      // If number is negative, add '-' (a negative zero might occur for fractional numbers > -1.0)
+      const bool add_sign = (base == 10U) && negative;
+
+      // The base prefix is not shown for zero.
+      uint32_t prefix_length = 0U;
+
+      if (format.is_show_base() && (magnitude != 0U))
       {
-        // If number is negative, append '-' (a negative zero might occure for fractional numbers > -1.0) 
-        if ((format.get_base() == 10U) && negative)
-        {
-          str.push_back(type('-'));
-        }
+        prefix_length = (base == 2U) || (base == 16U) ? 2U : ((base == 8U) ? 1U : 0U);
+      }
+
+      const uint32_t n_digits = etl::private_to_string::count_digits(magnitude, base, shift);
+      const size_t   length   = (add_sign ? 1U : 0U) + prefix_length + n_digits;
+
+      // Write straight into the string if it fits. Otherwise build the text
+      // and append what fits, so that the string is truncated as usual.
+      type buffer[1U + 2U + etl::numeric_limits<unsigned_t>::digits];
+
+      const bool fits = (length <= str.available());
 
-        str.push_back(type('0'));
+      type* p = buffer;
+
+      if (fits)
+      {
+        const size_t old_size = str.size();
+        str.uninitialized_resize(old_size + length);
+        p = &str[old_size];
       }
-      else
+
+      if (add_sign)
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
-        {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
-        }
+        *p++ = type('-');
+      }
+
+      if (prefix_length != 0U)
+      {
+        *p++ = type('0');
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10U) && negative)
+        if (base == 2U)
         {
-          str.push_back(type('-'));
+          *p++ = format.is_upper_case() ? type('B') : type('b');
         }
-
-        if (format.is_show_base())
+        else if (base == 16U)
         {
-          switch (format.get_base())
-          {
-            case 2U:
-            {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
-              break;
-            }
-
-            case 8U:
-            {
-              str.push_back(type('0'));
-              break;
-            }
-
-            case 16U:
-            {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
-              break;
-            }
-
-            default:
-            {
-              break;
-            }
-          }
+          *p++ = format.is_upper_case() ? type('X') : type('x');
         }
+      }
+
+      etl::private_to_string::write_digits(magnitude, p + n_digits, base, shift, format.is_upper_case());
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+      if (!fits)
+      {
+        str.append(buffer, buffer + length);
       }
 
       etl::private_to_string::add_alignment(str, start, format);
@@ -258,6 +400,96 @@ namespace etl
       }
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Helper function for the shortest round trip floating point format.
+    /// Uses fixed notation for decimal exponents -7 < x < 21, otherwise
+    /// scientific notation, as ECMAScript Number.prototype.toString.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point_shortest(const T value,
+                                     TIString& str,
+                                     const etl::basic_format_spec<TIString>& format)
+    {
+      typedef typename TIString::value_type type;
+
+      // Sign, "0.000000" and 17 digits, or sign, 17 digits, '.' and "e-324".
+      type buffer[32];
+      type* p = buffer;
+
+      if (value < T(0.0))
+      {
+        *p++ = type('-');
+      }
+
+      if (value == T(0.0))
+      {
+        *p++ = type('0');
+        str.append(buffer, p);
+        return;
+      }
+
+      const etl::private_ryu::floating_decimal decimal = etl::private_ryu::to_decimal(value);
+
+      const int32_t n_digits = int32_t(etl::private_to_string::count_digits(decimal.mantissa, 10U, 0U));
+
+      // The position of the decimal point relative to the first digit.
+      const int32_t point = n_digits + decimal.exponent;
+
+      if ((point >= n_digits) && (point <= 21))
+      {
+        // Integral, with trailing zeros.
+        p += n_digits;
+        etl::private_to_string::write_digits(decimal.mantissa, p, 10U, 0U, false);
+        etl::fill_n(p, point - n_digits, type('0'));
+        p += point - n_digits;
+      }
+      else if ((point > 0) && (point <= 21))
+      {
+        // The decimal point is inside the digits.
+        type* p_point = p + point;
+        p += n_digits;
+        etl::private_to_string::write_digits(decimal.mantissa, p, 10U, 0U, false);
+        etl::copy_backward(p_point, p, p + 1);
+        *p_point = type('.');
+        ++p;
+      }
+      else if ((point > -6) && (point <= 0))
+      {
+        // Leading zeros.
+        *p++ = type('0');
+        *p++ = type('.');
+        etl::fill_n(p, -point, type('0'));
+        p += -point;
+        p += n_digits;
+        etl::private_to_string::write_digits(decimal.mantissa, p, 10U, 0U, false);
+      }
+      else
+      {
+        // Scientific.
+        type* p_point = p + 1;
+        p += n_digits;
+        etl::private_to_string::write_digits(decimal.mantissa, p, 10U, 0U, false);
+
+        if (n_digits > 1)
+        {
+          etl::copy_backward(p_point, p, p + 1);
+          *p_point = type('.');
+          ++p;
+        }
+
+        *p++ = format.is_upper_case() ? type('E') : type('e');
+        *p++ = (point > 0) ? type('+') : type('-');
+
+        const uint32_t exponent = uint32_t((point > 0) ? (point - 1) : (1 - point));
+        p += etl::private_to_string::count_digits(exponent, 10U, 0U);
+        etl::private_to_string::write_digits(exponent, p, 10U, 0U, false);
+      }
+
+      str.append(buffer, p);
+    }
+#endif
+
     //***************************************************************************
     /// Helper function for floating point.
     //***************************************************************************
@@ -281,6 +513,12 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_USING_64BIT_TYPES
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_floating_point_shortest(value, str, format);
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -0,0 +1,108 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_HASH_CACHE_INCLUDED
+#define ETL_UNORDERED_HASH_CACHE_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Hash policy for the unordered containers.
+  /// Wrapping a hasher in cached_hash makes the container store the full hash
+  /// of each key in its node. Keys are then only compared when the hashes
+  /// match, and copies between containers reuse the stored hashes.
+  /// e.g. etl::unordered_map<Key, Value, 16, 8, etl::cached_hash<etl::hash<Key> > >
+  ///\ingroup unordered_map
+  //***************************************************************************
+  template <typename THash>
+  struct cached_hash : public THash
+  {
+    typedef THash hasher_type;
+  };
+
+  //***************************************************************************
+  /// Is the hasher a cached_hash?
+  //***************************************************************************
+  template <typename THash>
+  struct is_cached_hash : public etl::false_type
+  {
+  };
+
+  template <typename THash>
+  struct is_cached_hash<etl::cached_hash<THash> > : public etl::true_type
+  {
+  };
+
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// The hash stored in a node.
+    /// Nothing is stored by default, and every hash matches.
+    //*************************************************************************
+    template <bool Cached>
+    struct node_hash
+    {
+      void set_hash(size_t)
+      {
+      }
+
+      bool hash_matches(size_t) const
+      {
+        return true;
+      }
+    };
+
+    //*************************************************************************
+    /// Specialisation for cached hashes.
+    //*************************************************************************
+    template <>
+    struct node_hash<true>
+    {
+      void set_hash(size_t hash_)
+      {
+        hash = hash_;
+      }
+
+      bool hash_matches(size_t hash_) const
+      {
+        return hash == hash_;
+      }
+
+      size_t hash;
+    };
+  }
+}
+
+#endif
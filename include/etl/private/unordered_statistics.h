@@ -0,0 +1,121 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_STATISTICS_INCLUDED
+#define ETL_UNORDERED_STATISTICS_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Statistics on the distribution and memory use of an unordered container.
+  /// The chain length of a bucket is the number of elements in it.
+  ///\ingroup unordered_map
+  //***************************************************************************
+  struct unordered_statistics
+  {
+    size_t size;              ///< The number of elements.
+    size_t bucket_count;      ///< The number of buckets.
+    size_t used_buckets;      ///< The number of buckets with at least one element.
+    size_t max_chain_length;  ///< The number of elements in the fullest bucket.
+    float  mean_chain_length; ///< The mean number of elements in the used buckets.
+    float  load_factor;       ///< size / bucket_count.
+    size_t node_size;         ///< The size of the node that holds each element.
+    size_t bytes_used;        ///< The size of the nodes in use plus the bucket array.
+    size_t bytes_reserved;    ///< The size of all of the nodes plus the bucket array.
+    float  bytes_per_element; ///< bytes_used / size, or 0 if empty.
+  };
+
+  namespace private_unordered
+  {
+    //*************************************************************************
+    /// Gathers the statistics for an array of buckets.
+    //*************************************************************************
+    template <typename TBucket>
+    etl::unordered_statistics get_statistics(const TBucket* pbuckets, size_t number_of_buckets, size_t node_size, size_t max_size)
+    {
+      etl::unordered_statistics statistics;
+
+      statistics.size             = 0U;
+      statistics.bucket_count     = number_of_buckets;
+      statistics.used_buckets     = 0U;
+      statistics.max_chain_length = 0U;
+
+      for (size_t i = 0U; i < number_of_buckets; ++i)
+      {
+        size_t length = pbuckets[i].size();
+
+        if (length != 0U)
+        {
+          statistics.size += length;
+          ++statistics.used_buckets;
+
+          if (length > statistics.max_chain_length)
+          {
+            statistics.max_chain_length = length;
+          }
+        }
+      }
+
+      statistics.mean_chain_length = (statistics.used_buckets == 0U) ? 0.0f : static_cast<float>(statistics.size) / static_cast<float>(statistics.used_buckets);
+      statistics.load_factor       = static_cast<float>(statistics.size) / static_cast<float>(number_of_buckets);
+      statistics.node_size         = node_size;
+      statistics.bytes_used        = (statistics.size * node_size) + (number_of_buckets * sizeof(TBucket));
+      statistics.bytes_reserved    = (max_size * node_size) + (number_of_buckets * sizeof(TBucket));
+      statistics.bytes_per_element = (statistics.size == 0U) ? 0.0f : static_cast<float>(statistics.bytes_used) / static_cast<float>(statistics.size);
+
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Adds the chain length of each bucket to a histogram.
+    /// Lengths past the end of the histogram are added to the last bin.
+    //*************************************************************************
+    template <typename TBucket, typename THistogram>
+    void add_chain_lengths(const TBucket* pbuckets, size_t number_of_buckets, THistogram& histogram)
+    {
+      typedef typename THistogram::key_type key_type;
+
+      const size_t last_bin = histogram.size() - 1U;
+
+      for (size_t i = 0U; i < number_of_buckets; ++i)
+      {
+        size_t length = pbuckets[i].size();
+
+        histogram.add(static_cast<key_type>((length < last_bin) ? length : last_bin));
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,1188 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_VARIANT_VARIADIC_INCLUDED
+#define ETL_VARIANT_VARIADIC_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../utility.h"
+#include "../largest.h"
+#include "../smallest.h"
+#include "../type_traits.h"
+#include "../integral_limits.h"
+#include "../static_assert.h"
+#include "../alignment.h"
+#include "../error_handler.h"
+#include "../placement_new.h"
+#include "../parameter_type.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// An empty alternative, for variants that may hold 'no value'.
+  ///\ingroup variant
+  //***************************************************************************
+  struct monostate
+  {
+  };
+
+  constexpr bool operator ==(etl::monostate, etl::monostate) ETL_NOEXCEPT { return true; }
+  constexpr bool operator !=(etl::monostate, etl::monostate) ETL_NOEXCEPT { return false; }
+  constexpr bool operator < (etl::monostate, etl::monostate) ETL_NOEXCEPT { return false; }
+
+  //***************************************************************************
+  /// The index of a valueless variant.
+  ///\ingroup variant
+  //***************************************************************************
+  static ETL_CONSTANT size_t variant_npos = etl::integral_limits<size_t>::max;
+
+  template <typename... TTypes>
+  class variant;
+
+  namespace private_variant
+  {
+    //*************************************************************************
+    /// The index of T in TTypes, or variant_npos.
+    //*************************************************************************
+    template <typename T, typename... TTypes>
+    struct index_of_type;
+
+    template <typename T>
+    struct index_of_type<T> : etl::integral_constant<size_t, etl::variant_npos>
+    {
+    };
+
+    template <typename T, typename T0, typename... TRest>
+    struct index_of_type<T, T0, TRest...>
+      : etl::integral_constant<size_t, etl::is_same<T, T0>::value                          ? 0U :
+                                       (index_of_type<T, TRest...>::value == etl::variant_npos) ? etl::variant_npos :
+                                       index_of_type<T, TRest...>::value + 1U>
+    {
+    };
+
+    //*************************************************************************
+    /// The type at index I in TTypes.
+    //*************************************************************************
+    template <size_t I, typename T0, typename... TRest>
+    struct type_at_index
+    {
+      typedef typename type_at_index<I - 1U, TRest...>::type type;
+    };
+
+    template <typename T0, typename... TRest>
+    struct type_at_index<0U, T0, TRest...>
+    {
+      typedef T0 type;
+    };
+
+    //*************************************************************************
+    /// A sequence of indexes, 0 to N - 1.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+    };
+
+    template <size_t N, size_t... Indexes>
+    struct make_index_sequence : make_index_sequence<N - 1U, N - 1U, Indexes...>
+    {
+    };
+
+    template <size_t... Indexes>
+    struct make_index_sequence<0U, Indexes...>
+    {
+      typedef index_sequence<Indexes...> type;
+    };
+
+    //*************************************************************************
+    /// True if TTrait is true for all of TTypes.
+    //*************************************************************************
+    template <template <typename> class TTrait, typename... TTypes>
+    struct all_of : etl::true_type
+    {
+    };
+
+    template <template <typename> class TTrait, typename T0, typename... TRest>
+    struct all_of<TTrait, T0, TRest...> : etl::integral_constant<bool, TTrait<T0>::value && all_of<TTrait, TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// True if all of TTypes are derived from TBase.
+    //*************************************************************************
+    template <typename TBase, typename... TTypes>
+    struct all_derived_from : etl::true_type
+    {
+    };
+
+    template <typename TBase, typename T0, typename... TRest>
+    struct all_derived_from<TBase, T0, TRest...>
+      : etl::integral_constant<bool, (etl::is_same<TBase, T0>::value || etl::is_base_of<TBase, T0>::value) && all_derived_from<TBase, TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The operations on one alternative, referenced from the dispatch tables.
+    //*************************************************************************
+    template <typename T>
+    struct operations
+    {
+      static void destroy(void* p)
+      {
+        static_cast<T*>(p)->~T();
+      }
+
+      static void copy_construct(void* p, const void* p_other)
+      {
+        ::new (p) T(*static_cast<const T*>(p_other));
+      }
+
+      static void move_construct(void* p, void* p_other)
+      {
+        ::new (p) T(etl::move(*static_cast<T*>(p_other)));
+      }
+
+      static void copy_assign(void* p, const void* p_other)
+      {
+        *static_cast<T*>(p) = *static_cast<const T*>(p_other);
+      }
+
+      static void move_assign(void* p, void* p_other)
+      {
+        *static_cast<T*>(p) = etl::move(*static_cast<T*>(p_other));
+      }
+
+      static bool equal(const void* p_lhs, const void* p_rhs)
+      {
+        return *static_cast<const T*>(p_lhs) == *static_cast<const T*>(p_rhs);
+      }
+
+      static bool less(const void* p_lhs, const void* p_rhs)
+      {
+        return *static_cast<const T*>(p_lhs) < *static_cast<const T*>(p_rhs);
+      }
+
+      template <typename TBase>
+      static TBase* upcast(void* p)
+      {
+        return static_cast<T*>(p);
+      }
+
+      template <typename TBase>
+      static const TBase* upcast_const(const void* p)
+      {
+        return static_cast<const T*>(p);
+      }
+    };
+
+    //*************************************************************************
+    /// Dispatch on the index through a table of function pointers, one entry
+    /// per alternative. The tables are constant and indexed directly, so each
+    /// operation is a single indirect call with no virtual functions.
+    //*************************************************************************
+    template <typename... TTypes>
+    struct dispatch
+    {
+      static void destroy(size_t index, void* p)
+      {
+        typedef void (*function_t)(void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::destroy... };
+        table[index](p);
+      }
+
+      static void copy_construct(size_t index, void* p, const void* p_other)
+      {
+        typedef void (*function_t)(void*, const void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::copy_construct... };
+        table[index](p, p_other);
+      }
+
+      static void move_construct(size_t index, void* p, void* p_other)
+      {
+        typedef void (*function_t)(void*, void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::move_construct... };
+        table[index](p, p_other);
+      }
+
+      static void copy_assign(size_t index, void* p, const void* p_other)
+      {
+        typedef void (*function_t)(void*, const void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::copy_assign... };
+        table[index](p, p_other);
+      }
+
+      static void move_assign(size_t index, void* p, void* p_other)
+      {
+        typedef void (*function_t)(void*, void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::move_assign... };
+        table[index](p, p_other);
+      }
+
+      static bool equal(size_t index, const void* p_lhs, const void* p_rhs)
+      {
+        typedef bool (*function_t)(const void*, const void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::equal... };
+        return table[index](p_lhs, p_rhs);
+      }
+
+      static bool less(size_t index, const void* p_lhs, const void* p_rhs)
+      {
+        typedef bool (*function_t)(const void*, const void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::less... };
+        return table[index](p_lhs, p_rhs);
+      }
+
+      template <typename TBase>
+      static TBase* upcast(size_t index, void* p)
+      {
+        typedef TBase* (*function_t)(void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::template upcast<TBase>... };
+        return table[index](p);
+      }
+
+      template <typename TBase>
+      static const TBase* upcast(size_t index, const void* p)
+      {
+        typedef const TBase* (*function_t)(const void*);
+        static ETL_CONSTEXPR function_t table[] = { &operations<TTypes>::template upcast_const<TBase>... };
+        return table[index](p);
+      }
+    };
+
+    //*************************************************************************
+    /// How the visited value is passed to the visitor.
+    //*************************************************************************
+    struct as_lvalue
+    {
+      template <typename T>
+      struct apply
+      {
+        typedef T  value_type;
+        typedef T& reference;
+      };
+    };
+
+    struct as_const_lvalue
+    {
+      template <typename T>
+      struct apply
+      {
+        typedef const T  value_type;
+        typedef const T& reference;
+      };
+    };
+
+    struct as_rvalue
+    {
+      template <typename T>
+      struct apply
+      {
+        typedef T   value_type;
+        typedef T&& reference;
+      };
+    };
+
+    //*************************************************************************
+    /// Calls the visitor with the value of the type at index I.
+    /// Indexes past the end of the list are never called, and forward to the
+    /// first type so that every case of the switch below can be instantiated.
+    //*************************************************************************
+    template <bool Valid, size_t I, typename... TTypes>
+    struct visit_case
+    {
+      template <typename TReturn, typename TQualifier, typename TVisitor, typename TPointer>
+      static TReturn call(TVisitor& visitor, TPointer p)
+      {
+        typedef typename TQualifier::template apply<typename type_at_index<I, TTypes...>::type> qualified;
+
+        return static_cast<TReturn>(visitor(static_cast<typename qualified::reference>(*static_cast<typename qualified::value_type*>(p))));
+      }
+    };
+
+    template <size_t I, typename... TTypes>
+    struct visit_case<false, I, TTypes...> : visit_case<true, 0U, TTypes...>
+    {
+    };
+
+    //*************************************************************************
+    /// Calls the visitor with the value at the index.
+    /// The first eight types are dispatched with a switch, which the compiler
+    /// turns into a jump table or compares with each call to the visitor
+    /// inlined. Any further types go through a constant table of function
+    /// pointers.
+    //*************************************************************************
+    template <typename... TTypes>
+    struct visit_switch
+    {
+      template <typename TReturn, typename TQualifier, typename TVisitor, typename TPointer>
+      static TReturn call(size_t index, TVisitor& visitor, TPointer p)
+      {
+        static ETL_CONSTANT size_t N = sizeof...(TTypes);
+
+        switch (index)
+        {
+          case 0U: return visit_case<(0U < N), 0U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 1U: return visit_case<(1U < N), 1U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 2U: return visit_case<(2U < N), 2U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 3U: return visit_case<(3U < N), 3U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 4U: return visit_case<(4U < N), 4U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 5U: return visit_case<(5U < N), 5U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 6U: return visit_case<(6U < N), 6U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          case 7U: return visit_case<(7U < N), 7U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+          default: return call_indirect<TReturn, TQualifier>(index, visitor, p, typename indirect_indexes<(N > 8U)>::type());
+        }
+      }
+
+    private:
+
+      template <bool Indirect, typename = void>
+      struct indirect_indexes
+      {
+        typedef typename make_index_sequence<sizeof...(TTypes)>::type type;
+      };
+
+      template <typename TDummy>
+      struct indirect_indexes<false, TDummy>
+      {
+        typedef etl::false_type type;
+      };
+
+      template <typename TReturn, typename TQualifier, typename TVisitor, typename TPointer, size_t... Indexes>
+      static TReturn call_indirect(size_t index, TVisitor& visitor, TPointer p, index_sequence<Indexes...>)
+      {
+        typedef TReturn (*function_t)(TVisitor&, TPointer);
+
+        static ETL_CONSTEXPR function_t table[] = { &visit_case<true, Indexes, TTypes...>::template call<TReturn, TQualifier, TVisitor, TPointer>... };
+
+        return table[index](visitor, p);
+      }
+
+      template <typename TReturn, typename TQualifier, typename TVisitor, typename TPointer>
+      static TReturn call_indirect(size_t, TVisitor& visitor, TPointer p, etl::false_type)
+      {
+        return visit_case<true, 0U, TTypes...>::template call<TReturn, TQualifier>(visitor, p);
+      }
+    };
+
+    //*************************************************************************
+    /// Access to the storage of a variant, for the free functions.
+    //*************************************************************************
+    struct variant_access
+    {
+      template <typename T, typename TVariant>
+      static T* pointer(TVariant& v)
+      {
+        return static_cast<T*>(v.storage());
+      }
+
+      template <typename T, typename TVariant>
+      static const T* pointer(const TVariant& v)
+      {
+        return static_cast<const T*>(v.storage());
+      }
+
+      template <typename TVariant>
+      static size_t type_id(const TVariant& v)
+      {
+        return v.type_id;
+      }
+
+      template <typename TVariant>
+      static void* storage(TVariant& v)
+      {
+        return v.storage();
+      }
+
+      template <typename TVariant>
+      static const void* storage(const TVariant& v)
+      {
+        return v.storage();
+      }
+    };
+
+    //*************************************************************************
+    /// The reader base for variant::call, as for the legacy variant.
+    /// Declares a pure virtual read for each of the types.
+    //*************************************************************************
+    template <typename T0, typename... TRest>
+    class reader_type : public reader_type<TRest...>
+    {
+    public:
+
+      using reader_type<TRest...>::read;
+
+      virtual void read(typename etl::parameter_type<T0>::type value) = 0;
+    };
+
+    template <typename T0>
+    class reader_type<T0>
+    {
+    public:
+
+      virtual void read(typename etl::parameter_type<T0>::type value) = 0;
+    };
+
+    //*************************************************************************
+    /// Passes the visited value to a reader.
+    //*************************************************************************
+    template <typename TReader>
+    struct read_visitor
+    {
+      explicit read_visitor(TReader& reader_)
+        : reader(reader_)
+      {
+      }
+
+      template <typename T>
+      void operator()(T& value) const
+      {
+        reader.read(value);
+      }
+
+      TReader& reader;
+    };
+  }
+
+  //***************************************************************************
+  /// A type safe union of any number of types.
+  /// Values are assigned or emplaced as one of the exact types in the list.
+  /// Visit the stored value with etl::visit, which dispatches with a switch
+  /// on the index rather than through a virtual reader.
+  /// When all of the types are trivially copyable, copy and move are a plain
+  /// copy of the storage; when all are trivially destructible no destructor
+  /// is dispatched.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename... TTypes>
+  class variant
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) > 0U, "variant must have at least one type");
+
+    //*************************************************************************
+    /// The type used for the stored index.
+    //*************************************************************************
+    typedef typename etl::smallest_uint_for_value<sizeof...(TTypes)>::type type_id_t;
+
+    //*************************************************************************
+    /// The id of a variant that holds no value.
+    //*************************************************************************
+    static ETL_CONSTANT type_id_t UNSUPPORTED_TYPE_ID = etl::integral_limits<type_id_t>::max;
+
+    //*************************************************************************
+    /// The base type for readers, as for the legacy variant.
+    //*************************************************************************
+    template <typename... TReaderTypes>
+    using reader_type = private_variant::reader_type<TReaderTypes...>;
+
+    typedef reader_type<TTypes...> reader;
+
+  private:
+
+    friend struct private_variant::variant_access;
+
+    typedef private_variant::dispatch<TTypes...> dispatch_t;
+
+    typedef typename etl::largest_type<TTypes...>::type largest_t;
+
+    static ETL_CONSTANT size_t SIZE      = sizeof(largest_t);
+    static ETL_CONSTANT size_t ALIGNMENT = etl::largest_alignment<TTypes...>::value;
+
+    static ETL_CONSTANT bool Trivially_Copyable     = private_variant::all_of<etl::is_trivially_copyable, TTypes...>::value;
+    static ETL_CONSTANT bool Trivially_Destructible = private_variant::all_of<etl::is_trivially_destructible, TTypes...>::value;
+
+    template <typename T>
+    struct index_of : private_variant::index_of_type<T, TTypes...>
+    {
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    /// Default constructs the first type.
+    //*************************************************************************
+    variant()
+      : type_id(UNSUPPORTED_TYPE_ID)
+    {
+      typedef typename private_variant::type_at_index<0U, TTypes...>::type type;
+
+      ::new (storage()) type();
+      type_id = 0U;
+    }
+
+    //*************************************************************************
+    /// Construct from a value of one of the types.
+    //*************************************************************************
+    template <typename T, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<T>::type, variant>::value>::type>
+    variant(T&& value)
+      : type_id(UNSUPPORTED_TYPE_ID)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      ETL_STATIC_ASSERT(index_of<type>::value != etl::variant_npos, "Unsupported type");
+
+      ::new (storage()) type(etl::forward<T>(value));
+      type_id = type_id_t(index_of<type>::value);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    variant(const variant& other)
+      : type_id(UNSUPPORTED_TYPE_ID)
+    {
+      if (Trivially_Copyable)
+      {
+        memcpy(storage(), other.storage(), SIZE);
+      }
+      else if (other.is_valid())
+      {
+        dispatch_t::copy_construct(other.type_id, storage(), other.storage());
+      }
+
+      type_id = other.type_id;
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    variant(variant&& other)
+      : type_id(UNSUPPORTED_TYPE_ID)
+    {
+      if (Trivially_Copyable)
+      {
+        memcpy(storage(), other.storage(), SIZE);
+      }
+      else if (other.is_valid())
+      {
+        dispatch_t::move_construct(other.type_id, storage(), other.storage());
+      }
+
+      type_id = other.type_id;
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~variant()
+    {
+      destroy_current();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    variant& operator =(const variant& other)
+    {
+      if (this != &other)
+      {
+        if (Trivially_Copyable)
+        {
+          memcpy(storage(), other.storage(), SIZE);
+          type_id = other.type_id;
+        }
+        else if (is_valid() && (type_id == other.type_id))
+        {
+          dispatch_t::copy_assign(type_id, storage(), other.storage());
+        }
+        else
+        {
+          destroy_current();
+
+          if (other.is_valid())
+          {
+            dispatch_t::copy_construct(other.type_id, storage(), other.storage());
+            type_id = other.type_id;
+          }
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    variant& operator =(variant&& other)
+    {
+      if (this != &other)
+      {
+        if (Trivially_Copyable)
+        {
+          memcpy(storage(), other.storage(), SIZE);
+          type_id = other.type_id;
+        }
+        else if (is_valid() && (type_id == other.type_id))
+        {
+          dispatch_t::move_assign(type_id, storage(), other.storage());
+        }
+        else
+        {
+          destroy_current();
+
+          if (other.is_valid())
+          {
+            dispatch_t::move_construct(other.type_id, storage(), other.storage());
+            type_id = other.type_id;
+          }
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a value of one of the types.
+    //*************************************************************************
+    template <typename T, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<T>::type, variant>::value>::type>
+    variant& operator =(T&& value)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      ETL_STATIC_ASSERT(index_of<type>::value != etl::variant_npos, "Unsupported type");
+
+      if (type_id == index_of<type>::value)
+      {
+        *static_cast<type*>(storage()) = etl::forward<T>(value);
+      }
+      else
+      {
+        emplace<type>(etl::forward<T>(value));
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Constructs a T in place, destroying the current value.
+    //*************************************************************************
+    template <typename T, typename... TArgs>
+    T& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(index_of<T>::value != etl::variant_npos, "Unsupported type");
+
+      destroy_current();
+
+      ::new (storage()) T(etl::forward<TArgs>(args)...);
+      type_id = type_id_t(index_of<T>::value);
+
+      return *static_cast<T*>(storage());
+    }
+
+    //*************************************************************************
+    /// Constructs the type at index I in place, destroying the current value.
+    //*************************************************************************
+    template <size_t I, typename... TArgs>
+    typename private_variant::type_at_index<I, TTypes...>::type& emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT(I < sizeof...(TTypes), "Index out of range");
+
+      typedef typename private_variant::type_at_index<I, TTypes...>::type type;
+
+      destroy_current();
+
+      ::new (storage()) type(etl::forward<TArgs>(args)...);
+      type_id = type_id_t(I);
+
+      return *static_cast<type*>(storage());
+    }
+
+    //*************************************************************************
+    /// The index of the stored type, or etl::variant_npos.
+    //*************************************************************************
+    size_t index() const ETL_NOEXCEPT
+    {
+      return is_valid() ? size_t(type_id) : etl::variant_npos;
+    }
+
+    //*************************************************************************
+    /// True if an exception during construction left no value.
+    //*************************************************************************
+    bool valueless_by_exception() const ETL_NOEXCEPT
+    {
+      return !is_valid();
+    }
+
+    //*************************************************************************
+    /// True if a value is stored.
+    //*************************************************************************
+    bool is_valid() const ETL_NOEXCEPT
+    {
+      return type_id != UNSUPPORTED_TYPE_ID;
+    }
+
+    //*************************************************************************
+    /// True if the stored type is T.
+    //*************************************************************************
+    template <typename T>
+    bool is_type() const ETL_NOEXCEPT
+    {
+      return type_id == index_of<T>::value;
+    }
+
+    //*************************************************************************
+    /// True if the other variant stores the same type.
+    //*************************************************************************
+    bool is_same_type(const variant& other) const ETL_NOEXCEPT
+    {
+      return type_id == other.type_id;
+    }
+
+    //*************************************************************************
+    /// True if T is one of the types.
+    //*************************************************************************
+    template <typename T>
+    static bool is_supported_type() ETL_NOEXCEPT
+    {
+      return index_of<T>::value != etl::variant_npos;
+    }
+
+    //*************************************************************************
+    /// Destroys the stored value, leaving no value.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_current();
+    }
+
+    //*************************************************************************
+    /// Gets the stored value as a T. The same as etl::get<T>.
+    /// Asserts etl::variant_incorrect_type_exception if T is not the type held.
+    //*************************************************************************
+    template <typename T>
+    T& get()
+    {
+      ETL_STATIC_ASSERT((index_of<T>::value != etl::variant_npos), "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return *static_cast<T*>(storage());
+    }
+
+    //*************************************************************************
+    /// Gets the stored value as a const T. The same as etl::get<T>.
+    /// Asserts etl::variant_incorrect_type_exception if T is not the type held.
+    //*************************************************************************
+    template <typename T>
+    const T& get() const
+    {
+      ETL_STATIC_ASSERT((index_of<T>::value != etl::variant_npos), "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return *static_cast<const T*>(storage());
+    }
+
+    //*************************************************************************
+    /// Calls the read function of the reader for the stored type, as for the
+    /// legacy variant. Does nothing if no value is stored.
+    /// etl::visit avoids the virtual call.
+    //*************************************************************************
+    void call(reader& r)
+    {
+      if (is_valid())
+      {
+        private_variant::read_visitor<reader> visitor(r);
+
+        private_variant::visit_switch<TTypes...>::template call<void, private_variant::as_lvalue>(type_id, visitor, storage());
+      }
+    }
+
+    //*************************************************************************
+    /// Accepts a reader. The same as call.
+    //*************************************************************************
+    void accept(reader& r)
+    {
+      call(r);
+    }
+
+    //*************************************************************************
+    /// Gets the stored value as a TBase, which all of the types must derive from.
+    //*************************************************************************
+    template <typename TBase>
+    TBase& upcast()
+    {
+      ETL_STATIC_ASSERT((private_variant::all_derived_from<TBase, TTypes...>::value), "Not all types are derived from TBase");
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return *dispatch_t::template upcast<TBase>(type_id, storage());
+    }
+
+    //*************************************************************************
+    /// Gets the stored value as a const TBase, which all of the types must derive from.
+    //*************************************************************************
+    template <typename TBase>
+    const TBase& upcast() const
+    {
+      ETL_STATIC_ASSERT((private_variant::all_derived_from<TBase, TTypes...>::value), "Not all types are derived from TBase");
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return *dispatch_t::template upcast<TBase>(type_id, static_cast<const void*>(storage()));
+    }
+
+    //*************************************************************************
+    /// Swaps with another variant.
+    //*************************************************************************
+    void swap(variant& other)
+    {
+      variant temp(etl::move(other));
+      other = etl::move(*this);
+      *this = etl::move(temp);
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    friend bool operator ==(const variant& lhs, const variant& rhs)
+    {
+      if (lhs.type_id != rhs.type_id)
+      {
+        return false;
+      }
+
+      return !lhs.is_valid() || dispatch_t::equal(lhs.type_id, lhs.storage(), rhs.storage());
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    friend bool operator !=(const variant& lhs, const variant& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    //*************************************************************************
+    /// Less than. Ordered by index, then by value.
+    /// A valueless variant is less than any other.
+    //*************************************************************************
+    friend bool operator <(const variant& lhs, const variant& rhs)
+    {
+      if (!rhs.is_valid())
+      {
+        return false;
+      }
+
+      if (!lhs.is_valid())
+      {
+        return true;
+      }
+
+      if (lhs.type_id != rhs.type_id)
+      {
+        return lhs.type_id < rhs.type_id;
+      }
+
+      return dispatch_t::less(lhs.type_id, lhs.storage(), rhs.storage());
+    }
+
+    friend bool operator >(const variant& lhs, const variant& rhs)
+    {
+      return rhs < lhs;
+    }
+
+    friend bool operator <=(const variant& lhs, const variant& rhs)
+    {
+      return !(rhs < lhs);
+    }
+
+    friend bool operator >=(const variant& lhs, const variant& rhs)
+    {
+      return !(lhs < rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Destroys the current value and marks the variant as valueless.
+    //*************************************************************************
+    void destroy_current()
+    {
+      if (!Trivially_Destructible && is_valid())
+      {
+        dispatch_t::destroy(type_id, storage());
+      }
+
+      type_id = UNSUPPORTED_TYPE_ID;
+    }
+
+    void* storage()
+    {
+      return static_cast<void*>(&data);
+    }
+
+    const void* storage() const
+    {
+      return static_cast<const void*>(&data);
+    }
+
+    //*************************************************************************
+    /// The internal storage, aligned for all of the types.
+    //*************************************************************************
+    typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+
+    //*************************************************************************
+    /// The index of the stored type.
+    //*************************************************************************
+    type_id_t type_id;
+  };
+
+  //***************************************************************************
+  /// The number of types in a variant.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename TVariant>
+  struct variant_size;
+
+  template <typename... TTypes>
+  struct variant_size<etl::variant<TTypes...> > : etl::integral_constant<size_t, sizeof...(TTypes)>
+  {
+  };
+
+  template <typename TVariant>
+  struct variant_size<const TVariant> : etl::variant_size<TVariant>
+  {
+  };
+
+#if ETL_CPP17_SUPPORTED
+  template <typename TVariant>
+  inline constexpr size_t variant_size_v = etl::variant_size<TVariant>::value;
+#endif
+
+  //***************************************************************************
+  /// The type at index I of a variant.
+  ///\ingroup variant
+  //***************************************************************************
+  template <size_t I, typename TVariant>
+  struct variant_alternative;
+
+  template <size_t I, typename... TTypes>
+  struct variant_alternative<I, etl::variant<TTypes...> >
+  {
+    typedef typename private_variant::type_at_index<I, TTypes...>::type type;
+  };
+
+  template <size_t I, typename TVariant>
+  struct variant_alternative<I, const TVariant>
+  {
+    typedef typename etl::add_const<typename etl::variant_alternative<I, TVariant>::type>::type type;
+  };
+
+  template <size_t I, typename TVariant>
+  using variant_alternative_t = typename etl::variant_alternative<I, TVariant>::type;
+
+  //***************************************************************************
+  /// True if the variant holds a T.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  bool holds_alternative(const etl::variant<TTypes...>& v) ETL_NOEXCEPT
+  {
+    return v.template is_type<T>();
+  }
+
+  //***************************************************************************
+  /// Gets the value at index I.
+  /// Asserts etl::variant_incorrect_type_exception if the index is not the one held.
+  ///\ingroup variant
+  //***************************************************************************
+  template <size_t I, typename... TTypes>
+  typename etl::variant_alternative<I, etl::variant<TTypes...> >::type& get(etl::variant<TTypes...>& v)
+  {
+    typedef typename etl::variant_alternative<I, etl::variant<TTypes...> >::type type;
+
+    ETL_ASSERT(v.index() == I, ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return *private_variant::variant_access::pointer<type>(v);
+  }
+
+  template <size_t I, typename... TTypes>
+  const typename etl::variant_alternative<I, etl::variant<TTypes...> >::type& get(const etl::variant<TTypes...>& v)
+  {
+    typedef typename etl::variant_alternative<I, etl::variant<TTypes...> >::type type;
+
+    ETL_ASSERT(v.index() == I, ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return *private_variant::variant_access::pointer<type>(v);
+  }
+
+  template <size_t I, typename... TTypes>
+  typename etl::variant_alternative<I, etl::variant<TTypes...> >::type&& get(etl::variant<TTypes...>&& v)
+  {
+    return etl::move(etl::get<I>(v));
+  }
+
+  //***************************************************************************
+  /// Gets the value of type T.
+  /// Asserts etl::variant_incorrect_type_exception if T is not the type held.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  T& get(etl::variant<TTypes...>& v)
+  {
+    ETL_STATIC_ASSERT((private_variant::index_of_type<T, TTypes...>::value != etl::variant_npos), "Unsupported type");
+    ETL_ASSERT(v.template is_type<T>(), ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return *private_variant::variant_access::pointer<T>(v);
+  }
+
+  template <typename T, typename... TTypes>
+  const T& get(const etl::variant<TTypes...>& v)
+  {
+    ETL_STATIC_ASSERT((private_variant::index_of_type<T, TTypes...>::value != etl::variant_npos), "Unsupported type");
+    ETL_ASSERT(v.template is_type<T>(), ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return *private_variant::variant_access::pointer<T>(v);
+  }
+
+  template <typename T, typename... TTypes>
+  T&& get(etl::variant<TTypes...>&& v)
+  {
+    return etl::move(etl::get<T>(v));
+  }
+
+  //***************************************************************************
+  /// Gets a pointer to the value at index I, or null if it is not the one held.
+  ///\ingroup variant
+  //***************************************************************************
+  template <size_t I, typename... TTypes>
+  typename etl::add_pointer<typename etl::variant_alternative<I, etl::variant<TTypes...> >::type>::type
+    get_if(etl::variant<TTypes...>* pv) ETL_NOEXCEPT
+  {
+    typedef typename etl::variant_alternative<I, etl::variant<TTypes...> >::type type;
+
+    return ((pv != ETL_NULLPTR) && (pv->index() == I)) ? private_variant::variant_access::pointer<type>(*pv) : ETL_NULLPTR;
+  }
+
+  template <size_t I, typename... TTypes>
+  typename etl::add_pointer<const typename etl::variant_alternative<I, etl::variant<TTypes...> >::type>::type
+    get_if(const etl::variant<TTypes...>* pv) ETL_NOEXCEPT
+  {
+    typedef typename etl::variant_alternative<I, etl::variant<TTypes...> >::type type;
+
+    return ((pv != ETL_NULLPTR) && (pv->index() == I)) ? private_variant::variant_access::pointer<type>(*pv) : ETL_NULLPTR;
+  }
+
+  //***************************************************************************
+  /// Gets a pointer to the value of type T, or null if it is not the type held.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename T, typename... TTypes>
+  T* get_if(etl::variant<TTypes...>* pv) ETL_NOEXCEPT
+  {
+    ETL_STATIC_ASSERT((private_variant::index_of_type<T, TTypes...>::value != etl::variant_npos), "Unsupported type");
+
+    return ((pv != ETL_NULLPTR) && pv->template is_type<T>()) ? private_variant::variant_access::pointer<T>(*pv) : ETL_NULLPTR;
+  }
+
+  template <typename T, typename... TTypes>
+  const T* get_if(const etl::variant<TTypes...>* pv) ETL_NOEXCEPT
+  {
+    ETL_STATIC_ASSERT((private_variant::index_of_type<T, TTypes...>::value != etl::variant_npos), "Unsupported type");
+
+    return ((pv != ETL_NULLPTR) && pv->template is_type<T>()) ? private_variant::variant_access::pointer<T>(*pv) : ETL_NULLPTR;
+  }
+
+  //***************************************************************************
+  /// Calls the visitor with the value held by the variant, returning TReturn.
+  /// Dispatches with a switch on the stored index; there is no virtual call
+  /// and the visitor's operator() for each type can be inlined.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename TReturn, typename TVisitor, typename... TTypes>
+  TReturn visit(TVisitor&& visitor, etl::variant<TTypes...>& v)
+  {
+    ETL_ASSERT(v.is_valid(), ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return private_variant::visit_switch<TTypes...>::template call<TReturn, private_variant::as_lvalue>(private_variant::variant_access::type_id(v), visitor, private_variant::variant_access::storage(v));
+  }
+
+  template <typename TReturn, typename TVisitor, typename... TTypes>
+  TReturn visit(TVisitor&& visitor, const etl::variant<TTypes...>& v)
+  {
+    ETL_ASSERT(v.is_valid(), ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return private_variant::visit_switch<TTypes...>::template call<TReturn, private_variant::as_const_lvalue>(private_variant::variant_access::type_id(v), visitor, private_variant::variant_access::storage(v));
+  }
+
+  template <typename TReturn, typename TVisitor, typename... TTypes>
+  TReturn visit(TVisitor&& visitor, etl::variant<TTypes...>&& v)
+  {
+    ETL_ASSERT(v.is_valid(), ETL_ERROR(etl::variant_incorrect_type_exception));
+
+    return private_variant::visit_switch<TTypes...>::template call<TReturn, private_variant::as_rvalue>(private_variant::variant_access::type_id(v), visitor, private_variant::variant_access::storage(v));
+  }
+
+  //***************************************************************************
+  /// Calls the visitor with the value held by the variant.
+  /// The return type is that of the visitor called with the first type.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename TVisitor, typename T0, typename... TRest>
+  auto visit(TVisitor&& visitor, etl::variant<T0, TRest...>& v)
+    -> decltype(etl::declval<TVisitor&>()(etl::declval<T0&>()))
+  {
+    typedef decltype(etl::declval<TVisitor&>()(etl::declval<T0&>())) return_t;
+
+    return etl::visit<return_t>(etl::forward<TVisitor>(visitor), v);
+  }
+
+  template <typename TVisitor, typename T0, typename... TRest>
+  auto visit(TVisitor&& visitor, const etl::variant<T0, TRest...>& v)
+    -> decltype(etl::declval<TVisitor&>()(etl::declval<const T0&>()))
+  {
+    typedef decltype(etl::declval<TVisitor&>()(etl::declval<const T0&>())) return_t;
+
+    return etl::visit<return_t>(etl::forward<TVisitor>(visitor), v);
+  }
+
+  template <typename TVisitor, typename T0, typename... TRest>
+  auto visit(TVisitor&& visitor, etl::variant<T0, TRest...>&& v)
+    -> decltype(etl::declval<TVisitor&>()(etl::declval<T0&&>()))
+  {
+    typedef decltype(etl::declval<TVisitor&>()(etl::declval<T0&&>())) return_t;
+
+    return etl::visit<return_t>(etl::forward<TVisitor>(visitor), etl::move(v));
+  }
+
+  //***************************************************************************
+  /// Swaps two variants.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename... TTypes>
+  void swap(etl::variant<TTypes...>& lhs, etl::variant<TTypes...>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+}
+
+#endif
@@ -36,6 +36,10 @@ SOFTWARE.
 //*****************************************************************************
 
 #define ETL_TARGET_DEVICE_X86
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
 #define ETL_TARGET_OS_LINUX
+#define ETL_CRC_USE_HARDWARE
 
 #endif
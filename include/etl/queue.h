@@ -492,7 +492,7 @@ namespace etl
       if (&rhs != this)
       {
         clear();
-        move_clone(rhs);
+        move_clone(etl::move(rhs));
       }
 
       return *this;
@@ -513,7 +513,7 @@ namespace etl
       for (size_type i = 0; i < other.size(); ++i)
       {
         push(other.p_buffer[index]);
-        index = (index == (CAPACITY - 1)) ? 0 : index + 1;
+        index = (index == (other.CAPACITY - 1)) ? 0 : index + 1;
       }
     }
 
@@ -530,7 +530,7 @@ namespace etl
       for (size_type i = 0; i < other.size(); ++i)
       {
         push(etl::move(other.p_buffer[index]));
-        index = (index == (CAPACITY - 1)) ? 0 : index + 1;
+        index = (index == (other.CAPACITY - 1)) ? 0 : index + 1;
       }
     }
 #endif
@@ -610,7 +610,7 @@ namespace etl
 
 #if ETL_CPP11_SUPPORTED
     //*************************************************************************
-    /// Copy constructor
+    /// Move constructor
     //*************************************************************************
     queue(queue&& rhs)
       : base_t(reinterpret_cast<T*>(&buffer[0]), SIZE)
@@ -648,7 +648,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        base_t::move_clone(rhs);
+        base_t::move_clone(etl::move(rhs));
       }
 
       return *this;
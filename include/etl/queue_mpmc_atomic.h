@@ -0,0 +1,611 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "power.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type read_position  = read.load(etl::memory_order_acquire);
+      size_type write_position = write.load(etl::memory_order_acquire);
+
+      size_type n = size_type(write_position - read_position);
+
+      // The positions may be read part way through another thread's update.
+      if (n > MAX_SIZE)
+      {
+        n = (difference_type(n) < 0) ? 0 : MAX_SIZE;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        MASK(max_size_ - 1),
+        write(0),
+        read(0)
+    {
+    }
+
+    // The positions claimed by the producers and the consumers are kept on
+    // separate cache lines when ETL_CACHE_LINE_SIZE is defined.
+
+    const size_type MAX_SIZE;     ///< The maximum number of items in the queue.
+    const size_type MASK;         ///< Converts a position to a slot index.
+#if ETL_CACHE_LINE_SIZE > 0
+    char size_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> write; ///< The next position to push to.
+#if ETL_CACHE_LINE_SIZE > 0
+    char write_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> read;  ///< The next position to pop from.
+#if ETL_CACHE_LINE_SIZE > 0
+    char read_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers
+  /// without locks. Each slot holds a sequence number that tells a producer when
+  /// the slot is free and a consumer when it holds a value.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                        rvalue_reference;///< An rvalue_reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::move(value));
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(etl::forward<Args>(args)...);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      slot* p_slot = claim_push(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (p_slot->value()) T(value1, value2, value3, value4);
+        publish_push(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      slot* p_slot = claim_pop(position);
+
+      if (p_slot == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03)
+      value = etl::move(*p_slot->value());
+#else
+      value = *p_slot->value();
+#endif
+
+      publish_pop(p_slot, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      slot* p_slot = claim_pop(position);
+
+      if (p_slot == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+      publish_pop(p_slot, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    typedef typename base_t::difference_type difference_type;
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// The sequence equals the position when the slot is free to push to, and
+    /// the position + 1 when it holds the value pushed at that position.
+    //*************************************************************************
+    struct slot
+    {
+      T* value()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot* p_slots_, size_type max_size_)
+      : base_t(max_size_),
+        p_slots(p_slots_)
+    {
+    }
+
+    //*************************************************************************
+    /// Marks every slot as free for the first lap.
+    /// Called from the derived constructor, once the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_slots[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    using base_t::write;
+    using base_t::read;
+    using base_t::MAX_SIZE;
+    using base_t::MASK;
+
+    //*************************************************************************
+    /// Claims the next free slot for a push.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot* claim_push(size_type& position)
+    {
+      position = write.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot* p_slot = &p_slots[position & MASK];
+        size_type sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type difference = difference_type(size_type(sequence - position));
+
+        if (difference == 0)
+        {
+          // The slot is free. Try to take the position.
+          if (write.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer has taken the position.
+          position = write.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a pushed value visible to the consumers.
+    //*************************************************************************
+    void publish_push(slot* p_slot, size_type position)
+    {
+      p_slot->sequence.store(size_type(position + 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the oldest filled slot for a pop.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot* claim_pop(size_type& position)
+    {
+      position = read.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot* p_slot = &p_slots[position & MASK];
+        size_type sequence = p_slot->sequence.load(etl::memory_order_acquire);
+        difference_type difference = difference_type(size_type(sequence - size_type(position + 1)));
+
+        if (difference == 0)
+        {
+          // The slot holds a value. Try to take the position.
+          if (read.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_slot;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been pushed to yet.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer has taken the position.
+          position = read.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys a popped value and frees the slot for the next lap.
+    //*************************************************************************
+    void publish_pop(slot* p_slot, size_type position)
+    {
+      p_slot->value()->~T();
+      p_slot->sequence.store(size_type(position + MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    slot* p_slots; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    // The positions wrap around the size type, so the size must divide it exactly
+    // and leave room for the signed comparison of sequences.
+    ETL_STATIC_ASSERT(((SIZE == 1) || etl::is_power_of_2<SIZE>::value), "Size must be a power of 2");
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 2)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(slots, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_CPP11_SUPPORTED
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The slots used in the queue_mpmc_atomic.
+    typename base_t::slot slots[SIZE];
+  };
+}
+
+#endif
+
+#endif
@@ -128,9 +128,11 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
+      : RESERVED(reserved_),
+        write(0),
+        cached_read(0),
         read(0),
-        RESERVED(reserved_)
+        cached_write(0)
     {
     }
 
@@ -149,9 +151,53 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    //*************************************************************************
+    /// Checks, from the 'push' thread, that the next index is free.
+    /// Only reloads the read index if the cached copy shows the queue as full.
+    //*************************************************************************
+    bool can_push(size_type next_index)
+    {
+      if (next_index == cached_read)
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+      }
+
+      return next_index != cached_read;
+    }
+
+    //*************************************************************************
+    /// Checks, from the 'pop' thread, that there is an item at the read index.
+    /// Only reloads the write index if the cached copy shows the queue as empty.
+    //*************************************************************************
+    bool can_pop(size_type read_index)
+    {
+      if (read_index == cached_write)
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+      }
+
+      return read_index != cached_write;
+    }
+
+    // The indexes written by each thread are kept on separate cache lines
+    // when ETL_CACHE_LINE_SIZE is defined.
+
+    const size_type RESERVED;             ///< The maximum number of items in the queue.
+#if ETL_CACHE_LINE_SIZE > 0
+    char reserved_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> write;         ///< Where to input new data.
+    size_type              cached_read;   ///< The 'push' thread's last copy of read.
+#if ETL_CACHE_LINE_SIZE > 0
+    char write_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> read;          ///< Where to get the oldest data.
+    size_type              cached_write;  ///< The 'pop' thread's last copy of write.
+#if ETL_CACHE_LINE_SIZE > 0
+    char read_padding[ETL_CACHE_LINE_SIZE];
+#endif
 
   private:
 
@@ -203,6 +249,8 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::can_push;
+    using base_t::can_pop;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +260,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +282,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +307,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -282,7 +330,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -305,7 +353,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -328,7 +376,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -351,7 +399,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -372,7 +420,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -400,7 +448,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -415,6 +463,140 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Reserves the next slot for the 'push' thread to fill in place.
+    /// The value is default initialised in the slot.
+    /// A successful try_reserve() must be followed by commit() before the
+    /// next push or reserve.
+    ///\return A pointer to the value in the slot, or ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    T* try_reserve()
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (can_push(next_index))
+      {
+        return ::new (&p_buffer[write_index]) T;
+      }
+
+      // Queue is full.
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Makes the value in the slot returned by try_reserve() available to the
+    /// 'pop' thread.
+    //*************************************************************************
+    void commit()
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index, RESERVED);
+
+      if (can_push(next_index))
+      {
+        write.store(next_index, etl::memory_order_release);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the oldest value for the 'pop' thread to read in place.
+    /// The value stays in the queue until release() is called.
+    ///\return A pointer to the value, or ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    const T* try_peek()
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      if (can_pop(read_index))
+      {
+        return &p_buffer[read_index];
+      }
+
+      // Queue is empty
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Destroys the value returned by try_peek() and frees its slot for the
+    /// 'push' thread.
+    //*************************************************************************
+    void release()
+    {
+      pop();
+    }
+
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Stops when the queue is full.
+    /// The write index is published once for the whole burst.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type count = 0;
+
+      while (first != last)
+      {
+        size_type next_index = get_next_index(write_index, RESERVED);
+
+        if (!can_push(next_index))
+        {
+          // Queue is full.
+          break;
+        }
+
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = next_index;
+        ++first;
+        ++count;
+      }
+
+      if (count != 0)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// The read index is published once for the whole burst.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type count = 0;
+
+      while ((count != max_count) && can_pop(read_index))
+      {
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03)
+        *out = etl::move(p_buffer[read_index]);
+#else
+        *out = p_buffer[read_index];
+#endif
+
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, RESERVED);
+        ++out;
+        ++count;
+      }
+
+      if (count != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Clear the queue.
     /// Must be called from thread that pops the queue or when there is no
@@ -106,6 +106,27 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue from an ISR.
+    /// Stops when the queue is full.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_isr(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_isr(TOutputIterator out, size_type max_count)
+    {
+      return pop_implementation(out, max_count);
+    }
+
     //*************************************************************************
     /// How much free space available in the queue.
     /// Called from ISR.
@@ -382,6 +403,63 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// The indexes and size are updated once for the whole burst.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type index = write_index;
+      size_type count = 0;
+      size_type space = MAX_SIZE - current_size;
+
+      while ((first != last) && (count != space))
+      {
+        ::new (&p_buffer[index]) T(*first);
+        index = get_next_index(index, MAX_SIZE);
+        ++first;
+        ++count;
+      }
+
+      write_index = index;
+      current_size += count;
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// The indexes and size are updated once for the whole burst.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_count)
+    {
+      size_type index = read_index;
+      size_type count = 0;
+      size_type available = current_size;
+
+      while ((count != max_count) && (count != available))
+      {
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03)
+        *out = etl::move(p_buffer[index]);
+#else
+        *out = p_buffer[index];
+#endif
+        p_buffer[index].~T();
+        index = get_next_index(index, MAX_SIZE);
+        ++out;
+        ++count;
+      }
+
+      read_index = index;
+      current_size -= count;
+
+      return count;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -589,6 +667,39 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Stops when the queue is full.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(first, last);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(out, max_count);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
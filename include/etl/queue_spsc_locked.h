@@ -431,6 +431,62 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Stops when the queue is full.
+    /// Unlocked
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_from_unlocked(TIterator first, TIterator last)
+    {
+      return push_implementation(first, last);
+    }
+
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Stops when the queue is full.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      lock();
+
+      size_type result = push_implementation(first, last);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Unlocked
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_from_unlocked(TOutputIterator out, size_type max_count)
+    {
+      return pop_implementation(out, max_count);
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      lock();
+
+      size_type result = pop_implementation(out, max_count);
+
+      unlock();
+
+      return result;
+    }
+
     //*************************************************************************
     /// Clear the queue from the ISR.
     //*************************************************************************
@@ -727,6 +783,63 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// The indexes and size are updated once for the whole burst.
+    /// Unlocked.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push_implementation(TIterator first, TIterator last)
+    {
+      size_type index = this->write_index;
+      size_type count = 0;
+      size_type space = this->MAX_SIZE - this->current_size;
+
+      while ((first != last) && (count != space))
+      {
+        ::new (&p_buffer[index]) T(*first);
+        index = this->get_next_index(index, this->MAX_SIZE);
+        ++first;
+        ++count;
+      }
+
+      this->write_index = index;
+      this->current_size += count;
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// The indexes and size are updated once for the whole burst.
+    /// Unlocked.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop_implementation(TOutputIterator out, size_type max_count)
+    {
+      size_type index = this->read_index;
+      size_type count = 0;
+      size_type available = this->current_size;
+
+      while ((count != max_count) && (count != available))
+      {
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03)
+        *out = etl::move(p_buffer[index]);
+#else
+        *out = p_buffer[index];
+#endif
+        p_buffer[index].~T();
+        index = this->get_next_index(index, this->MAX_SIZE);
+        ++out;
+        ++count;
+      }
+
+      this->read_index = index;
+      this->current_size -= count;
+
+      return count;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_locked(const iqueue_spsc_locked&) ETL_DELETE;
     iqueue_spsc_locked& operator =(const iqueue_spsc_locked&) ETL_DELETE;
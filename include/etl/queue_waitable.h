@@ -0,0 +1,338 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_WAITABLE_INCLUDED
+#define ETL_QUEUE_WAITABLE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "semaphore.h"
+#include "utility.h"
+
+#if ETL_HAS_ATOMIC && ETL_HAS_SEMAPHORE
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// Wraps a concurrent queue so that consumers can wait for a value instead
+  /// of polling.
+  /// A consumer that finds the queue empty registers as waiting and sleeps on
+  /// an etl::semaphore. Producers only release the semaphore while a consumer
+  /// is waiting, so a busy queue makes no system calls.
+  ///\code
+  /// etl::queue_waitable<etl::queue_spsc_atomic<int, 16> > myQueue;
+  ///\endcode
+  /// The concurrency rules are those of the wrapped queue.
+  /// \tparam TQueue A default constructible queue, such as etl::queue_spsc_atomic,
+  ///                etl::queue_mpmc_atomic or etl::queue_mpmc_mutex.
+  //***************************************************************************
+  template <typename TQueue>
+  class queue_waitable
+  {
+  public:
+
+    typedef TQueue                           queue_type;      ///< The wrapped queue.
+    typedef typename TQueue::value_type      value_type;      ///< The type stored in the queue.
+    typedef typename TQueue::reference       reference;       ///< A reference to the type used in the queue.
+    typedef typename TQueue::const_reference const_reference; ///< A const reference to the type used in the queue.
+#if ETL_CPP11_SUPPORTED
+    typedef typename TQueue::rvalue_reference rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename TQueue::size_type       size_type;       ///< The type used for determining the size of the queue.
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_waitable()
+      : waiters(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      return notify(queue.push(value));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      return notify(queue.push(etl::move(value)));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_WAITABLE_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      return notify(queue.emplace(etl::forward<Args>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      return notify(queue.emplace(value1));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      return notify(queue.emplace(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return notify(queue.emplace(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return notify(queue.emplace(value1, value2, value3, value4));
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue without waiting.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      return queue.pop(value);
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard, without waiting.
+    //*************************************************************************
+    bool pop()
+    {
+      return queue.pop();
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting for as long as it takes for one
+    /// to be pushed.
+    //*************************************************************************
+    void pop_wait(reference value)
+    {
+      if (queue.pop(value))
+      {
+        return;
+      }
+
+      begin_wait();
+
+      while (!queue.pop(value))
+      {
+        signal.acquire();
+      }
+
+      end_wait();
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting for up to timeout_ms milliseconds
+    /// for one to be pushed.
+    /// The timeout covers the whole call. A wake up that finds the queue empty,
+    /// because another consumer took the value, only waits for the time left.
+    ///\return <b>true</b> if a value was popped.
+    //*************************************************************************
+    bool pop_wait(reference value, uint32_t timeout_ms)
+    {
+      if (queue.pop(value))
+      {
+        return true;
+      }
+
+      const uint32_t start = etl::semaphore::time_ms();
+
+      begin_wait();
+
+      bool     result    = queue.pop(value);
+      uint32_t remaining = timeout_ms;
+
+      while (!result && signal.try_acquire_for(remaining))
+      {
+        result = queue.pop(value);
+
+        if (!result)
+        {
+          const uint32_t elapsed = etl::semaphore::time_ms() - start;
+
+          if (elapsed >= timeout_ms)
+          {
+            break;
+          }
+
+          remaining = timeout_ms - elapsed;
+        }
+      }
+
+      end_wait();
+
+      // A value may have been pushed just as the wait timed out.
+      return result || queue.pop(value);
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    //*************************************************************************
+    bool full() const
+    {
+      return queue.full();
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    //*************************************************************************
+    size_type size() const
+    {
+      return queue.size();
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    //*************************************************************************
+    size_type available() const
+    {
+      return queue.available();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return queue.capacity();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return queue.max_size();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Wakes a waiting consumer after a successful push.
+    //*************************************************************************
+    bool notify(bool pushed)
+    {
+      if (pushed)
+      {
+        // Orders the push before the check for waiters.
+        // Pairs with the fence in begin_wait.
+        etl::atomic_thread_fence(etl::memory_order_seq_cst);
+
+        if (waiters.load(etl::memory_order_relaxed) != 0)
+        {
+          signal.release();
+        }
+      }
+
+      return pushed;
+    }
+
+    //*************************************************************************
+    /// Registers a consumer as waiting.
+    /// The queue must be checked again afterwards, as a push may have been
+    /// missed before the consumer was registered.
+    //*************************************************************************
+    void begin_wait()
+    {
+      waiters.fetch_add(1, etl::memory_order_relaxed);
+
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+    }
+
+    //*************************************************************************
+    /// Unregisters a waiting consumer.
+    //*************************************************************************
+    void end_wait()
+    {
+      waiters.fetch_sub(1, etl::memory_order_relaxed);
+    }
+
+    // Disable copy construction and assignment.
+    queue_waitable(const queue_waitable&) ETL_DELETE;
+    queue_waitable& operator =(const queue_waitable&) ETL_DELETE;
+
+    TQueue              queue;     ///< The wrapped queue.
+    etl::semaphore      signal;    ///< Released when a value is pushed while a consumer waits.
+    etl::atomic<size_t> waiters;   ///< The number of waiting consumers.
+  };
+}
+
+#endif
+
+#endif
@@ -521,6 +521,324 @@ namespace etl
   };
 #endif
 
+  namespace private_random
+  {
+    //***************************************************************************
+    /// Maps the output of a 32 bit generator to an inclusive range without bias.
+    /// Uses Lemire's multiply and shift, which only needs a division when the
+    /// product lands in the small biased region.
+    /// https://arxiv.org/abs/1805.10941
+    //***************************************************************************
+    template <typename TGenerator>
+    uint32_t unbiased_range(TGenerator& generator, uint32_t low, uint32_t high)
+    {
+      const uint32_t r = high - low + 1U;
+
+      if (r == 0U)
+      {
+        // The full 32 bit range.
+        return generator();
+      }
+
+#if ETL_USING_64BIT_TYPES
+      uint64_t product  = uint64_t(generator()) * r;
+      uint32_t fraction = uint32_t(product);
+
+      if (fraction < r)
+      {
+        const uint32_t threshold = uint32_t(0U - r) % r;
+
+        while (fraction < threshold)
+        {
+          product  = uint64_t(generator()) * r;
+          fraction = uint32_t(product);
+        }
+      }
+
+      return low + uint32_t(product >> 32);
+#else
+      // Reject the values above the largest multiple of the range.
+      const uint32_t threshold = uint32_t(0U - r) % r;
+      uint32_t       n         = generator();
+
+      while (n < threshold)
+      {
+        n = generator();
+      }
+
+      return low + (n % r);
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the xoshiro128++ algorithm.
+  /// The members are not virtual, even when ETL_POLYMORPHIC_RANDOM is defined,
+  /// apart from those that implement etl::random, so bulk generation needs
+  /// no call per value.
+  /// range() is unbiased.
+  /// https://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro128 ETL_FINAL : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro128()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint32_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro128(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is filled from a SplitMix style sequence, which can never
+    /// leave it all zero.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        seed += 0x9E3779B9UL;
+
+        uint32_t z = seed;
+        z = (z ^ (z >> 16)) * 0x85EBCA6BUL;
+        z = (z ^ (z >> 13)) * 0xC2B2AE35UL;
+        state[i] = z ^ (z >> 16);
+      }
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro128 number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro128 number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return private_random::unbiased_range(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Get a float in the range [0, 1).
+    //***************************************************************************
+    float uniform_float()
+    {
+      return float(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    //***************************************************************************
+    /// Get a double in the range [0, 1), using two numbers from the sequence.
+    //***************************************************************************
+    double uniform_double()
+    {
+      const uint32_t upper = next() >> 5;
+      const uint32_t lower = next() >> 6;
+
+      return ((double(upper) * 67108864.0) + double(lower)) * (1.0 / 9007199254740992.0);
+    }
+
+    //***************************************************************************
+    /// Fills a range with random numbers.
+    //***************************************************************************
+    template <typename TIterator>
+    void generate(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        *first = next();
+        ++first;
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Steps the generator.
+    //***************************************************************************
+    uint32_t next()
+    {
+      const uint32_t result = etl::rotate_left(uint32_t(state[0] + state[3]), 7U) + state[0];
+      const uint32_t t      = state[1] << 9;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = etl::rotate_left(state[3], 11U);
+
+      return result;
+    }
+
+    uint32_t state[4];
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the xoshiro256++ algorithm, which makes 64 bits at a time.
+  /// generate() uses both halves of each 64 bit number and is the quickest
+  /// way to get a lot of random numbers on 64 bit targets.
+  /// The members are not virtual, even when ETL_POLYMORPHIC_RANDOM is defined,
+  /// apart from those that implement etl::random.
+  /// range() is unbiased.
+  /// https://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro256 ETL_FINAL : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro256()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint32_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro256(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is filled from a SplitMix64 sequence, as recommended by the
+    /// authors.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint64_t s = seed;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        s += 0x9E3779B97F4A7C15ULL;
+
+        uint64_t z = s;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        state[i] = z ^ (z >> 31);
+      }
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro256 number.
+    /// The upper half of the next 64 bit number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return uint32_t(next() >> 32);
+    }
+
+    //***************************************************************************
+    /// Get the next 64 bit random_xoshiro256 number.
+    //***************************************************************************
+    uint64_t next_uint64()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Get the next random_xoshiro256 number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return private_random::unbiased_range(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Get a float in the range [0, 1).
+    //***************************************************************************
+    float uniform_float()
+    {
+      return float(next() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    //***************************************************************************
+    /// Get a double in the range [0, 1).
+    //***************************************************************************
+    double uniform_double()
+    {
+      return double(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    //***************************************************************************
+    /// Fills a range with random numbers.
+    /// Each 64 bit number supplies two values.
+    //***************************************************************************
+    template <typename TIterator>
+    void generate(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const uint64_t n = next();
+
+        *first = uint32_t(n >> 32);
+        ++first;
+
+        if (first != last)
+        {
+          *first = uint32_t(n);
+          ++first;
+        }
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Steps the generator.
+    //***************************************************************************
+    uint64_t next()
+    {
+      const uint64_t result = etl::rotate_left(uint64_t(state[0] + state[3]), 23U) + state[0];
+      const uint64_t t      = state[1] << 17;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = etl::rotate_left(state[3], 45U);
+
+      return result;
+    }
+
+    uint64_t state[4];
+  };
+#endif
+
 #if ETL_8BIT_SUPPORT
   //***************************************************************************
   /// A 32 bit random number generator.
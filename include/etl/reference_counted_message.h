@@ -219,6 +219,14 @@ namespace etl
   //***************************************************************************
   template <typename TMessage>
   using atomic_counted_message = etl::reference_counted_message<TMessage, etl::atomic_int32_t>;
+
+  //***************************************************************************
+  /// Class for creating reference counted messages using a biased counter.
+  /// Call share() on the counter before passing the message to another thread.
+  /// \tparam TMessage The type to be reference counted.
+  //***************************************************************************
+  template <typename TMessage>
+  using biased_counted_message = etl::reference_counted_message<TMessage, etl::biased_counter>;
 #endif
 }
 
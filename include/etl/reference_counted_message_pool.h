@@ -42,6 +42,7 @@ SOFTWARE.
 #include "atomic.h"
 #include "memory.h"
 #include "largest.h"
+#include "pool_statistics.h"
 
 namespace etl
 {
@@ -115,6 +116,7 @@ namespace etl
 
       lock();
       p = static_cast<prcm_t>(memory_block_allocator.allocate(sizeof(rcm_t), etl::alignment_of<rcm_t>::value));
+      count_allocation(p != ETL_NULLPTR);
       unlock();
 
       if (p != ETL_NULLPTR)
@@ -142,6 +144,7 @@ namespace etl
 
       lock();
       p = static_cast<prcm_t>(memory_block_allocator.allocate(sizeof(rcm_t), etl::alignment_of<rcm_t>::value));
+      count_allocation(p != ETL_NULLPTR);
       unlock();
 
       if (p != ETL_NULLPTR)
@@ -162,6 +165,10 @@ namespace etl
       rcmessage.~ireference_counted_message();
       lock();
       bool released = memory_block_allocator.release(&rcmessage);
+      if (released)
+      {
+        ETL_POOL_STATISTICS_RELEASED
+      }
       unlock();
 
       ETL_ASSERT(released, ETL_ERROR(etl::reference_counted_message_pool_release_failure));
@@ -244,17 +251,60 @@ namespace etl
     };
 #endif
 
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    /// Gets the usage statistics of the pool.
+    /// Counted while the pool is locked.
+    //*************************************************************************
+    etl::pool_statistics statistics()
+    {
+      lock();
+      etl::pool_statistics s = etl_pool_statistics.get();
+      unlock();
+
+      return s;
+    }
+
+    //*************************************************************************
+    /// Clears the counts. The peak restarts from the current size.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      lock();
+      etl_pool_statistics.reset();
+      unlock();
+    }
+#endif
+
   private:
 
+    //*************************************************************************
+    /// Counts an allocation or a failure, if statistics are enabled.
+    //*************************************************************************
+    void count_allocation(bool succeeded)
+    {
+      if (succeeded)
+      {
+        ETL_POOL_STATISTICS_ALLOCATED
+      }
+      else
+      {
+        ETL_POOL_STATISTICS_FAILED
+      }
+    }
+
     /// The raw memory block pool.
     imemory_block_allocator& memory_block_allocator;
 
+    ETL_DECLARE_POOL_STATISTICS
+
     // Should not be copied.
     reference_counted_message_pool(const reference_counted_message_pool&) ETL_DELETE;
     reference_counted_message_pool& operator =(const reference_counted_message_pool&) ETL_DELETE;
   };
 
 #if ETL_CPP11_SUPPORTED && ETL_HAS_ATOMIC
+  /// Lock free if used with etl::atomic_fixed_sized_memory_block_allocator.
   using  atomic_counted_message_pool = reference_counted_message_pool<etl::atomic_int>;
 #endif
 }
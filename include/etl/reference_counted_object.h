@@ -30,6 +30,7 @@
 #define ETL_REFERENCE_COUNTED_OBJECT_INCLUDED
 
 #include <stdint.h>
+#include <assert.h>
 
 #include "platform.h"
 #include "atomic.h"
@@ -46,6 +47,7 @@ namespace etl
     virtual ~ireference_counter() {};
     virtual void set_reference_count(int32_t value) = 0;
     virtual void increment_reference_count() = 0;
+    virtual void add_reference_count(int32_t count) = 0;
     ETL_NODISCARD virtual int32_t decrement_reference_count() = 0;
     ETL_NODISCARD virtual int32_t get_reference_count() const = 0;
   };
@@ -82,6 +84,14 @@ namespace etl
       ++reference_count;
     }
 
+    //***************************************************************************
+    /// Add to the reference count, in one operation.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t count) ETL_OVERRIDE
+    {
+      reference_count += count;
+    }
+
     //***************************************************************************
     /// Decrement the reference count.
     //***************************************************************************
@@ -137,6 +147,14 @@ namespace etl
       // Do nothing.
     }
 
+    //***************************************************************************
+    /// Add to the reference count.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t /*count*/) ETL_OVERRIDE
+    {
+      // Do nothing.
+    }
+
     //***************************************************************************
     /// Decrement the reference count.
     //***************************************************************************
@@ -154,6 +172,157 @@ namespace etl
     }
   };
 
+#if ETL_CPP11_SUPPORTED && ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Counter type tag that selects biased reference counting.
+  /// Use as the TCounter parameter, e.g. reference_counted_object<T, etl::biased_counter>.
+  //***************************************************************************
+  struct biased_counter
+  {
+  };
+
+  namespace private_reference_counter
+  {
+    //*************************************************************************
+    /// A token that is unique to the calling thread.
+    //*************************************************************************
+    inline const void* current_thread_token()
+    {
+      static thread_local char token;
+
+      return &token;
+    }
+  }
+
+  //***************************************************************************
+  /// A biased reference counter.
+  /// The thread that sets the count owns the object, and while it is the only
+  /// thread using it the count is a plain integer with no atomic operations.
+  /// Call share() on the owner thread before the object is made visible to
+  /// another thread; the count is then moved to an atomic counter that all
+  /// threads use until the count is next set.
+  /// Using an unshared counter from a thread other than the owner asserts.
+  //***************************************************************************
+  template <>
+  class reference_counter<etl::biased_counter> : public ireference_counter
+  {
+  public:
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    reference_counter()
+      : p_owner(private_reference_counter::current_thread_token())
+      , biased_count(0)
+      , shared_count(0)
+      , shared(false)
+    {
+    }
+
+    //***************************************************************************
+    /// Set the reference count.
+    /// The calling thread becomes the owner and the count is unshared.
+    //***************************************************************************
+    virtual void set_reference_count(int32_t value) ETL_OVERRIDE
+    {
+      p_owner      = private_reference_counter::current_thread_token();
+      biased_count = value;
+      shared       = false;
+      shared_count.store(0);
+    }
+
+    //***************************************************************************
+    /// Increment the reference count.
+    //***************************************************************************
+    virtual void increment_reference_count() ETL_OVERRIDE
+    {
+      add_reference_count(1);
+    }
+
+    //***************************************************************************
+    /// Add to the reference count, in one operation.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t count) ETL_OVERRIDE
+    {
+      if (shared)
+      {
+        shared_count.fetch_add(count);
+      }
+      else
+      {
+        assert(is_owner());
+
+        biased_count += count;
+      }
+    }
+
+    //***************************************************************************
+    /// Decrement the reference count.
+    //***************************************************************************
+    ETL_NODISCARD virtual int32_t decrement_reference_count() ETL_OVERRIDE
+    {
+      if (shared)
+      {
+        return int32_t(shared_count.fetch_sub(1) - 1);
+      }
+      else
+      {
+        assert(is_owner());
+        assert(biased_count > 0);
+
+        return --biased_count;
+      }
+    }
+
+    //***************************************************************************
+    /// Get the current reference count.
+    //***************************************************************************
+    ETL_NODISCARD virtual int32_t get_reference_count() const ETL_OVERRIDE
+    {
+      return shared ? int32_t(shared_count.load()) : biased_count;
+    }
+
+    //***************************************************************************
+    /// Moves the count to the atomic counter, so that other threads may use it.
+    /// Must be called by the owner thread, before the object is passed on.
+    //***************************************************************************
+    void share()
+    {
+      if (!shared)
+      {
+        assert(is_owner());
+
+        shared_count.store(biased_count);
+        biased_count = 0;
+        shared       = true;
+      }
+    }
+
+    //***************************************************************************
+    /// True if the count has been shared.
+    //***************************************************************************
+    ETL_NODISCARD bool is_shared() const
+    {
+      return shared;
+    }
+
+    //***************************************************************************
+    /// True if the calling thread is the owner.
+    //***************************************************************************
+    ETL_NODISCARD bool is_owner() const
+    {
+      return p_owner == private_reference_counter::current_thread_token();
+    }
+
+  private:
+
+    const void*         p_owner;      ///< The owning thread.
+    int32_t             biased_count; ///< The count while unshared.
+    etl::atomic_int32_t shared_count; ///< The count once shared.
+    bool                shared;       ///< Whether the count has been shared.
+  };
+#endif
+
   //***************************************************************************
   /// Base for all reference counted objects.
   //***************************************************************************
@@ -244,6 +413,13 @@ namespace etl
   //***************************************************************************
   template <typename TObject>
   using atomic_counted_object = etl::reference_counted_object<TObject, etl::atomic_int32_t>;
+
+  //***************************************************************************
+  /// Class for creating reference counted objects using a biased counter.
+  /// \tparam TObject  The type to be reference counted.
+  //***************************************************************************
+  template <typename TObject>
+  using biased_counted_object = etl::reference_counted_object<TObject, etl::biased_counter>;
 #endif
 }
 
@@ -42,6 +42,8 @@ SOFTWARE.
 #include "exception.h"
 #include "static_assert.h"
 #include "iterator.h"
+#include "functional.h"
+#include "algorithm.h"
 
 //*****************************************************************************
 ///\defgroup reference_flat_map reference_flat_map
@@ -329,6 +331,35 @@ namespace etl
         return comp(key, element.first);
       }
 
+#if ETL_CPP11_SUPPORTED
+      template <typename K>
+      bool operator ()(const value_type& element, const K& key) const
+      {
+        return comp(element.first, key);
+      }
+
+      template <typename K>
+      bool operator ()(const K& key, const value_type& element) const
+      {
+        return comp(key, element.first);
+      }
+#endif
+
+      key_compare comp;
+    };
+
+    //*********************************************************************
+    /// How to compare lookup entries.
+    //*********************************************************************
+    class LookupCompare
+    {
+    public:
+
+      bool operator ()(const value_type* element1, const value_type* element2) const
+      {
+        return comp(element1->first, element2->first);
+      }
+
       key_compare comp;
     };
 
@@ -637,6 +668,34 @@ namespace etl
       return end();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      iterator itr = lower_bound(key);
+
+      if (itr != end())
+      {
+        if (keys_are_equal(itr->first, key))
+        {
+          return itr;
+        }
+        else
+        {
+          return end();
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -661,6 +720,34 @@ namespace etl
       return end();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      if (itr != end())
+      {
+        if (keys_are_equal(itr->first, key))
+        {
+          return itr;
+        }
+        else
+        {
+          return end();
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -671,6 +758,44 @@ namespace etl
       return (find(key) == end()) ? 0U : 1U;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -681,6 +806,20 @@ namespace etl
       return etl::lower_bound(begin(), end(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return etl::lower_bound(begin(), end(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the lower bound of a key
     ///\param key The key to search for.
@@ -691,6 +830,20 @@ namespace etl
       return etl::lower_bound(cbegin(), cend(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return etl::lower_bound(cbegin(), cend(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -701,6 +854,20 @@ namespace etl
       return etl::upper_bound(begin(), end(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the upper bound of a key
     ///\param key The key to search for.
@@ -711,6 +878,20 @@ namespace etl
       return etl::upper_bound(begin(), end(), key, compare);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -723,6 +904,22 @@ namespace etl
       return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator i_lower = etl::lower_bound(begin(), end(), key, compare);
+
+      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, end(), key, compare));
+    }
+#endif
+
     //*********************************************************************
     /// Finds the range of equal elements of a key
     ///\param key The key to search for.
@@ -735,6 +932,22 @@ namespace etl
       return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator i_lower = etl::lower_bound(cbegin(), cend(), key, compare);
+
+      return ETL_OR_STD::make_pair(i_lower, etl::upper_bound(i_lower, cend(), key, compare));
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the reference_flat_map.
     ///\return The current size of the reference_flat_map.
@@ -835,6 +1048,77 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the lookup, without regard to the order.
+    /// The order must be restored with merge_from before the next lookup.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Stable sorts the values appended from index onwards.
+    ///\param index The index of the first appended value.
+    //*********************************************************************
+    void sort_from(size_t index)
+    {
+      etl::stable_sort(lookup.begin() + index, lookup.end(), LookupCompare());
+    }
+
+    //*********************************************************************
+    /// Merges the sorted values appended from index onwards into the map.
+    /// Values with a key that is already in the map, or that repeat the key
+    /// of an earlier appended value, are removed and passed to release.
+    ///\param index   The index of the first appended value.
+    ///\param release Called with each value that is removed.
+    //*********************************************************************
+    template <typename TRelease>
+    void merge_from(size_t index, TRelease release)
+    {
+      typename lookup_t::iterator head     = lookup.begin();
+      typename lookup_t::iterator head_end = lookup.begin() + index;
+      typename lookup_t::iterator output   = head_end;
+      typename lookup_t::iterator input    = head_end;
+
+      while (input != lookup.end())
+      {
+        value_type& value = **input;
+
+        // Find the first existing value that is not less than this one.
+        // Galloping skips long stretches of existing values cheaply.
+        head = etl::private_algorithm::gallop_lower_bound(head, head_end, &value, LookupCompare());
+
+        bool in_map   = (head != head_end) && !key_compare()(value.first, (*head)->first);
+        bool repeated = (output != head_end) && !key_compare()((*etl::prev(output))->first, value.first);
+
+        if (in_map || repeated)
+        {
+          release(value);
+        }
+        else
+        {
+          *output++ = &value;
+        }
+
+        ++input;
+      }
+
+      lookup.erase(output, lookup.end());
+
+      // Only merge if the new values do not all follow the existing ones.
+      if ((index != 0) && (output != head_end) && key_compare()((*head_end)->first, (*etl::prev(head_end))->first))
+      {
+        // Values before the first new one, and new values after the last
+        // existing one, are already in place.
+        typename lookup_t::iterator first = etl::upper_bound(lookup.begin(), head_end, *head_end, LookupCompare());
+        typename lookup_t::iterator last  = etl::lower_bound(head_end, lookup.end(), *etl::prev(head_end), LookupCompare());
+
+        etl::inplace_merge(first, head_end, last, LookupCompare());
+      }
+    }
+
     //*********************************************************************
     /// Check to see if the keys are equal.
     //*********************************************************************
@@ -843,6 +1127,17 @@ namespace etl
       return !key_compare()(key1, key2) && !key_compare()(key2, key1);
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Check to see if the keys are equal, for transparent comparators.
+    //*********************************************************************
+    template <typename K>
+    bool keys_are_equal(key_parameter_t key1, const K& key2) const
+    {
+      return !key_compare()(key1, key2) && !key_compare()(key2, key1);
+    }
+#endif
+
   private:
 
     // Disable copy construction and assignment.
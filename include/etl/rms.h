@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_kernels.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -120,10 +121,9 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first++);
-      }
+      typedef private_statistics::use_kernel<TIterator, TInput, calc_t> use_kernel_t;
+
+      add_range(first, last, etl::integral_constant<bool, use_kernel_t::value>());
     }
 
     //*********************************
@@ -200,6 +200,35 @@ namespace etl
 
   private:
   
+    //*********************************
+    /// Add a range, a value at a time.
+    //*********************************
+    template <typename TIterator>
+    void add_range(TIterator first, TIterator last, etl::false_type)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// Add a contiguous range of int16_t or float with the block kernel.
+    //*********************************
+    void add_range(const TInput* first, const TInput* last, etl::true_type)
+    {
+      typedef typename private_statistics::kernel<TInput>::accumulator_type accumulator_t;
+
+      const size_t n = size_t(last - first);
+
+      private_statistics::moments<accumulator_t> block;
+      private_statistics::accumulate_moments<false, true>(first, n, block);
+
+      sum_of_squares += calc_t(block.sum_of_squares);
+      counter        += uint32_t(n);
+      recalculate = true;
+    }
+
     calc_t   sum_of_squares;
     uint32_t counter;
     mutable double rms_value;
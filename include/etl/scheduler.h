@@ -39,6 +39,9 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "atomic.h"
+#include "binary.h"
+#include "trace.h"
 
 namespace etl
 {
@@ -94,6 +97,136 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Run time and work statistics for a task.
+  /// Collected by the scheduler when a statistics clock has been set.
+  /// Times are in the units of the clock.
+  //***************************************************************************
+  struct task_statistics
+  {
+    typedef uint32_t (*clock_function_t)();
+
+    task_statistics()
+      : p_task(ETL_NULLPTR)
+      , p_clock(ETL_NULLPTR)
+      , invocations(0U)
+      , max_time(0U)
+      , total_time(0U)
+      , work_requests(0U)
+      , total_work(0U)
+    {
+    }
+
+    explicit task_statistics(const etl::task& task)
+      : p_task(&task)
+      , p_clock(ETL_NULLPTR)
+      , invocations(0U)
+      , max_time(0U)
+      , total_time(0U)
+      , work_requests(0U)
+      , total_work(0U)
+    {
+    }
+
+    //*******************************************
+    /// Resets the counters.
+    //*******************************************
+    void clear()
+    {
+      invocations   = 0U;
+      max_time      = 0U;
+      total_time    = 0U;
+      work_requests = 0U;
+      total_work    = 0U;
+    }
+
+    //*******************************************
+    /// The average time taken by task_process_work().
+    //*******************************************
+    uint32_t average_time() const
+    {
+      return (invocations == 0U) ? 0U : uint32_t(total_time / invocations);
+    }
+
+    //*******************************************
+    /// The average value returned by task_request_work().
+    //*******************************************
+    uint32_t average_work() const
+    {
+      return (work_requests == 0U) ? 0U : uint32_t(total_work / work_requests);
+    }
+
+    const etl::task* p_task;        ///< The task.
+    clock_function_t p_clock;       ///< The clock used to time the task.
+    uint32_t         invocations;   ///< Calls to task_process_work().
+    uint32_t         max_time;      ///< Longest call to task_process_work().
+    uint64_t         total_time;    ///< Total time in task_process_work().
+    uint32_t         work_requests; ///< Calls to task_request_work().
+    uint64_t         total_work;    ///< Sum of the values returned by task_request_work().
+  };
+
+  namespace private_scheduler
+  {
+    //*******************************************
+    /// Asks the task for work, counting the request if the scheduler is
+    /// collecting statistics.
+    //*******************************************
+    inline uint32_t request_work(const etl::task& task)
+    {
+      const uint32_t n_work = task.task_request_work();
+
+      etl::task_statistics* p_statistics = task.get_task_statistics();
+
+      if (p_statistics != ETL_NULLPTR)
+      {
+        ++p_statistics->work_requests;
+        p_statistics->total_work += n_work;
+      }
+
+      return n_work;
+    }
+
+    //*******************************************
+    /// Calls the task to process work, timing it if the scheduler is
+    /// collecting statistics.
+    //*******************************************
+    inline void process_work(etl::task& task)
+    {
+      ETL_TRACE_EVENT(etl::trace_event::Scheduler_Task_Begin, task.get_task_priority(), 0U)
+
+      etl::task_statistics* p_statistics = task.get_task_statistics();
+
+      if (p_statistics == ETL_NULLPTR)
+      {
+        task.task_process_work();
+      }
+      else
+      {
+        const uint32_t start = p_statistics->p_clock();
+
+        task.task_process_work();
+
+        // The record may have moved if a task was added during the work.
+        p_statistics = task.get_task_statistics();
+
+        if (p_statistics != ETL_NULLPTR)
+        {
+          const uint32_t elapsed = uint32_t(p_statistics->p_clock() - start);
+
+          ++p_statistics->invocations;
+          p_statistics->total_time += elapsed;
+
+          if (elapsed > p_statistics->max_time)
+          {
+            p_statistics->max_time = elapsed;
+          }
+        }
+      }
+
+      ETL_TRACE_EVENT(etl::trace_event::Scheduler_Task_End, task.get_task_priority(), 0U)
+    }
+  }
+
   //***************************************************************************
   /// Sequential Single.
   /// A policy the scheduler can use to decide what to do next.
@@ -109,9 +242,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        if (task.task_request_work() > 0)
+        if (etl::private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          etl::private_scheduler::process_work(task);
           idle = false;
         }
       }
@@ -138,9 +271,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        while (task.task_request_work() > 0)
+        while (etl::private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          etl::private_scheduler::process_work(task);
           idle = false;
         }
       }
@@ -168,9 +301,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        if (task.task_request_work() > 0)
+        if (etl::private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          etl::private_scheduler::process_work(task);
           idle = false;
           break;
         }
@@ -203,7 +336,7 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        uint32_t n_work = task.task_request_work();
+        uint32_t n_work = etl::private_scheduler::request_work(task);
 
         if (n_work > most_work)
         {
@@ -215,13 +348,231 @@ namespace etl
 
       if (!idle)
       {
-        task_list[most_index]->task_process_work();
+        etl::private_scheduler::process_work(*(task_list[most_index]));
       }
 
       return idle;
     }
   };
 
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Ready Bitmap.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Calls the highest priority task that has signalled that it has work.
+  /// Tasks call set_task_ready() when they are given work, which sets their bit
+  /// in a bitmap. The highest priority ready task is found from the lowest set
+  /// bit, so tasks without work are never polled. Only the task that has just
+  /// run is asked if it has more work.
+  /// Supports up to 32 tasks.
+  //***************************************************************************
+  struct scheduler_policy_ready_bitmap
+  {
+    scheduler_policy_ready_bitmap()
+      : ready_bits(0U)
+      , bound_tasks(0U)
+    {
+    }
+
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      if (task_list.size() != bound_tasks)
+      {
+        bind_tasks(task_list);
+      }
+
+      const uint32_t ready = ready_bits.load();
+
+      if (ready == 0U)
+      {
+        return true;
+      }
+
+      const uint_least8_t index = etl::count_trailing_zeros(ready);
+      const uint32_t      mask  = uint32_t(1U) << index;
+
+      // Clear before running, so that a signal during the work is kept.
+      ready_bits.fetch_and(~mask);
+
+      etl::task& task = *(task_list[index]);
+
+      etl::private_scheduler::process_work(task);
+
+      if (etl::private_scheduler::request_work(task) > 0)
+      {
+        ready_bits.fetch_or(mask);
+      }
+
+      return false;
+    }
+
+  private:
+
+    //*******************************************
+    /// Gives each task its bit, in priority order.
+    /// Tasks that already have work are marked as ready.
+    //*******************************************
+    void bind_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      ETL_ASSERT(task_list.size() <= 32U, ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+
+      const size_t n_tasks = (task_list.size() <= 32U) ? task_list.size() : 32U;
+
+      uint32_t bits = 0U;
+
+      for (size_t index = 0; index < n_tasks; ++index)
+      {
+        etl::task& task = *(task_list[index]);
+
+        const uint32_t mask = uint32_t(1U) << index;
+
+        task.set_task_ready_bitmap(&ready_bits, mask);
+
+        if (etl::private_scheduler::request_work(task) > 0)
+        {
+          bits |= mask;
+        }
+      }
+
+      ready_bits.store(bits);
+      bound_tasks = task_list.size();
+    }
+
+    etl::atomic_uint32_t ready_bits;
+    size_t               bound_tasks;
+  };
+#endif
+
+  //***************************************************************************
+  /// Details of a task that finished its work after its deadline.
+  //***************************************************************************
+  struct deadline_overrun
+  {
+    deadline_overrun(etl::task& task_, uint32_t deadline_, uint32_t finish_time_)
+      : task(task_)
+      , deadline(deadline_)
+      , finish_time(finish_time_)
+    {
+    }
+
+    //*******************************************
+    /// How late the work was finished.
+    //*******************************************
+    uint32_t lateness() const
+    {
+      return uint32_t(finish_time - deadline);
+    }
+
+    etl::task&     task;        ///< The task that overran.
+    const uint32_t deadline;    ///< The deadline that was missed.
+    const uint32_t finish_time; ///< When the work was finished.
+  };
+
+  //***************************************************************************
+  /// Earliest Deadline.
+  /// A policy the scheduler can use to decide what to do next.
+  /// Calls the task with work that has the earliest deadline, as returned by
+  /// task_deadline(). Tasks without a deadline are called only when no task
+  /// with a deadline has work, highest priority first.
+  /// Deadlines are compared relative to the clock, so the clock may wrap, as
+  /// long as deadlines are less than half its range away. Without a clock,
+  /// deadlines are compared as plain numbers and overruns are not detected.
+  /// Every task is polled for work on each pass, so the earliest deadline is
+  /// found by a single scan rather than from a heap that would need rebuilding.
+  //***************************************************************************
+  struct scheduler_policy_earliest_deadline
+  {
+    typedef uint32_t (*clock_function_t)();
+
+    scheduler_policy_earliest_deadline()
+      : p_clock(ETL_NULLPTR)
+      , p_overrun_callback(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Sets the clock that deadlines are measured against.
+    //*******************************************
+    void set_deadline_clock(clock_function_t p_clock_)
+    {
+      p_clock = p_clock_;
+    }
+
+    //*******************************************
+    /// Sets the callback for work that finishes after its deadline.
+    //*******************************************
+    void set_overrun_callback(etl::ifunction<const etl::deadline_overrun&>& callback)
+    {
+      p_overrun_callback = &callback;
+    }
+
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      const uint32_t now = (p_clock != ETL_NULLPTR) ? p_clock() : 0U;
+
+      etl::task* p_deadline_task = ETL_NULLPTR;
+      etl::task* p_other_task    = ETL_NULLPTR;
+      uint32_t   earliest        = 0U;
+      int32_t    earliest_offset = 0;
+
+      for (size_t index = 0; index < task_list.size(); ++index)
+      {
+        etl::task& task = *(task_list[index]);
+
+        if (etl::private_scheduler::request_work(task) > 0)
+        {
+          uint32_t deadline;
+
+          if (task.task_deadline(deadline))
+          {
+            const int32_t offset = int32_t(deadline - now);
+
+            if ((p_deadline_task == ETL_NULLPTR) || (offset < earliest_offset))
+            {
+              p_deadline_task = &task;
+              earliest        = deadline;
+              earliest_offset = offset;
+            }
+          }
+          else if (p_other_task == ETL_NULLPTR)
+          {
+            p_other_task = &task;
+          }
+        }
+      }
+
+      if (p_deadline_task != ETL_NULLPTR)
+      {
+        etl::private_scheduler::process_work(*p_deadline_task);
+
+        if ((p_clock != ETL_NULLPTR) && (p_overrun_callback != ETL_NULLPTR))
+        {
+          const uint32_t finish_time = p_clock();
+
+          if (int32_t(finish_time - earliest) > 0)
+          {
+            (*p_overrun_callback)(etl::deadline_overrun(*p_deadline_task, earliest, finish_time));
+          }
+        }
+
+        return false;
+      }
+      else if (p_other_task != ETL_NULLPTR)
+      {
+        etl::private_scheduler::process_work(*p_other_task);
+
+        return false;
+      }
+
+      return true;
+    }
+
+  private:
+
+    clock_function_t                              p_clock;
+    etl::ifunction<const etl::deadline_overrun&>* p_overrun_callback;
+  };
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -229,6 +580,8 @@ namespace etl
   {
   public:
 
+    typedef etl::ivector<etl::task_statistics>::const_iterator statistics_iterator;
+
     //*******************************************
     // Virtuals.
     //*******************************************
@@ -293,12 +646,80 @@ namespace etl
                                                                    task.get_task_priority(),
                                                                    compare_priority());
 
+        if (p_statistics_list != ETL_NULLPTR)
+        {
+          const size_t index = size_t(etl::distance(task_list.begin(), itask));
+
+          p_statistics_list->insert(p_statistics_list->begin() + index, etl::task_statistics(task));
+        }
+
         task_list.insert(itask, &task);
 
+        bind_statistics();
+
         task.on_task_added();
       }
     }
 
+    //*******************************************
+    /// Starts collecting task statistics, timed with the supplied clock.
+    /// The clock may be a cycle counter and may wrap.
+    /// A null clock stops the collection. The counters are kept.
+    //*******************************************
+    void set_statistics_clock(etl::task_statistics::clock_function_t p_clock)
+    {
+      p_statistics_clock = p_clock;
+
+      bind_statistics();
+    }
+
+    //*******************************************
+    /// Resets the statistics for all tasks.
+    //*******************************************
+    void clear_statistics()
+    {
+      if (p_statistics_list != ETL_NULLPTR)
+      {
+        for (statistics_list_t::iterator itr = p_statistics_list->begin(); itr != p_statistics_list->end(); ++itr)
+        {
+          itr->clear();
+        }
+      }
+    }
+
+    //*******************************************
+    /// Gets the statistics for a task.
+    /// Returns a null pointer if the task has not been added.
+    //*******************************************
+    const etl::task_statistics* get_statistics(const etl::task& task) const
+    {
+      for (statistics_iterator itr = statistics_begin(); itr != statistics_end(); ++itr)
+      {
+        if (itr->p_task == &task)
+        {
+          return itr;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Iterates over the statistics for the tasks, in priority order.
+    //*******************************************
+    statistics_iterator statistics_begin() const
+    {
+      return (p_statistics_list != ETL_NULLPTR) ? p_statistics_list->begin() : ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Iterates over the statistics for the tasks, in priority order.
+    //*******************************************
+    statistics_iterator statistics_end() const
+    {
+      return (p_statistics_list != ETL_NULLPTR) ? p_statistics_list->end() : ETL_NULLPTR;
+    }
+
     //*******************************************
     /// Add a task list.
     /// Adds to the tasks to the internal task list in priority order.
@@ -325,7 +746,23 @@ namespace etl
         scheduler_exit(false),
         p_idle_callback(ETL_NULLPTR),
         p_watchdog_callback(ETL_NULLPTR),
-        task_list(task_list_)
+        task_list(task_list_),
+        p_statistics_list(ETL_NULLPTR),
+        p_statistics_clock(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with storage for task statistics.
+    //*******************************************
+    ischeduler(etl::ivector<etl::task*>& task_list_, etl::ivector<etl::task_statistics>& statistics_list_)
+      : scheduler_running(false),
+        scheduler_exit(false),
+        p_idle_callback(ETL_NULLPTR),
+        p_watchdog_callback(ETL_NULLPTR),
+        task_list(task_list_),
+        p_statistics_list(&statistics_list_),
+        p_statistics_clock(ETL_NULLPTR)
     {
     }
 
@@ -347,8 +784,34 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Points each task at its statistics record, or at none if statistics
+    /// are not being collected.
+    //*******************************************
+    void bind_statistics()
+    {
+      const bool enabled = (p_statistics_list != ETL_NULLPTR) && (p_statistics_clock != ETL_NULLPTR);
+
+      for (size_t index = 0; index < task_list.size(); ++index)
+      {
+        etl::task_statistics* p_statistics = ETL_NULLPTR;
+
+        if (enabled)
+        {
+          p_statistics = &(*p_statistics_list)[index];
+          p_statistics->p_clock = p_statistics_clock;
+        }
+
+        task_list[index]->set_task_statistics(p_statistics);
+      }
+    }
+
     typedef etl::ivector<etl::task*> task_list_t;
+    typedef etl::ivector<etl::task_statistics> statistics_list_t;
+
     task_list_t& task_list;
+    statistics_list_t* p_statistics_list;
+    etl::task_statistics::clock_function_t p_statistics_clock;
   };
 
   //***************************************************************************
@@ -365,10 +828,27 @@ namespace etl
     };
 
     scheduler()
-      : ischeduler(task_list)
+      : ischeduler(task_list, statistics_list)
     {
     }
 
+    //*******************************************
+    /// Gets the scheduling policy, to configure it.
+    //*******************************************
+    TSchedulerPolicy& get_scheduler_policy()
+    {
+      return *this;
+    }
+
+    //*******************************************
+    /// Destructor.
+    /// Detaches the tasks from the statistics records.
+    //*******************************************
+    ~scheduler()
+    {
+      set_statistics_clock(ETL_NULLPTR);
+    }
+
     //*******************************************
     /// Start the scheduler.
     //*******************************************
@@ -401,6 +881,8 @@ namespace etl
 
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
     task_list_t task_list;
+
+    etl::vector<etl::task_statistics, MAX_TASKS> statistics_list;
   };
 }
 
@@ -0,0 +1,501 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEARCHER_INCLUDED
+#define ETL_SEARCHER_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup searcher searcher
+/// Searcher objects for etl::search, as C++17's std::default_searcher and
+/// std::boyer_moore_horspool_searcher, and a two-way searcher.
+/// A searcher is constructed from the pattern and called with the range to
+/// search. It returns the matching sub-range, or an empty range at 'last'.
+///\ingroup algorithm
+
+namespace etl
+{
+  namespace private_searcher
+  {
+    //*************************************************************************
+    /// The Boyer-Moore-Horspool skip table.
+    /// Elements are keyed on their low eight bits. Elements that share a key
+    /// share the smallest skip of any of them, which keeps the skip safe for
+    /// element types wider than a byte.
+    /// Skips saturate at 255, so patterns longer than that still work, but
+    /// skip no further.
+    //*************************************************************************
+    class horspool_table
+    {
+    public:
+
+      //*******************************************
+      template <typename TIterator>
+      void build(TIterator pattern, size_t length)
+      {
+        const uint8_t default_skip = uint8_t((length < 255U) ? length : 255U);
+
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          skips[i] = default_skip;
+        }
+
+        // Later occurrences overwrite earlier ones with a smaller skip.
+        for (size_t i = 0U; (i + 1U) < length; ++i)
+        {
+          const size_t distance = length - 1U - i;
+
+          skips[key(pattern[i])] = uint8_t((distance < 255U) ? distance : 255U);
+        }
+      }
+
+      //*******************************************
+      template <typename T>
+      size_t skip(const T& value) const
+      {
+        return skips[key(value)];
+      }
+
+    private:
+
+      //*******************************************
+      template <typename T>
+      static uint8_t key(const T& value)
+      {
+        return static_cast<uint8_t>(value);
+      }
+
+      uint8_t skips[256];
+    };
+
+    //*************************************************************************
+    /// Finds the pattern with the skip table.
+    /// Returns the position of the match, or last.
+    //*************************************************************************
+    template <typename TIterator, typename TPatternIterator>
+    TIterator horspool_search(TIterator first, TIterator last, TPatternIterator pattern, size_t length, const horspool_table& table)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (length == 0U)
+      {
+        return first;
+      }
+
+      const size_t size = size_t(last - first);
+
+      if (size < length)
+      {
+        return last;
+      }
+
+      const size_t final_start = size - length;
+      const size_t back        = length - 1U;
+
+      size_t position = 0U;
+
+      while (position <= final_start)
+      {
+        TIterator candidate = first + difference_t(position);
+
+        // Compare the last element first, as it has already been read for the skip.
+        const typename etl::iterator_traits<TIterator>::value_type& last_element = candidate[difference_t(back)];
+
+        if (last_element == pattern[back])
+        {
+          size_t i = 0U;
+
+          while ((i != back) && (candidate[difference_t(i)] == pattern[i]))
+          {
+            ++i;
+          }
+
+          if (i == back)
+          {
+            return candidate;
+          }
+        }
+
+        position += table.skip(last_element);
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the critical factorisation of the pattern for the two-way
+    /// algorithm, from the maximal suffixes for the two orderings.
+    /// Returns the start of the right half, and sets the period of the
+    /// maximal suffix that was chosen.
+    //*************************************************************************
+    template <typename TIterator>
+    size_t critical_factorisation(TIterator pattern, size_t length, size_t& period)
+    {
+      // The suffix positions start at -1 and rely on unsigned wrap around.
+      size_t max_suffix = ~size_t(0U);
+      size_t j          = 0U;
+      size_t k          = 1U;
+      size_t p          = 1U;
+
+      while ((j + k) < length)
+      {
+        if (pattern[j + k] < pattern[max_suffix + k])
+        {
+          j += k;
+          k = 1U;
+          p = j - max_suffix;
+        }
+        else if (pattern[j + k] == pattern[max_suffix + k])
+        {
+          if (k != p)
+          {
+            ++k;
+          }
+          else
+          {
+            j += p;
+            k = 1U;
+          }
+        }
+        else
+        {
+          max_suffix = j++;
+          k = p = 1U;
+        }
+      }
+
+      period = p;
+
+      size_t max_suffix_reverse = ~size_t(0U);
+      j = 0U;
+      k = 1U;
+      p = 1U;
+
+      while ((j + k) < length)
+      {
+        if (pattern[max_suffix_reverse + k] < pattern[j + k])
+        {
+          j += k;
+          k = 1U;
+          p = j - max_suffix_reverse;
+        }
+        else if (pattern[j + k] == pattern[max_suffix_reverse + k])
+        {
+          if (k != p)
+          {
+            ++k;
+          }
+          else
+          {
+            j += p;
+            k = 1U;
+          }
+        }
+        else
+        {
+          max_suffix_reverse = j++;
+          k = p = 1U;
+        }
+      }
+
+      if ((max_suffix_reverse + 1U) < (max_suffix + 1U))
+      {
+        return max_suffix + 1U;
+      }
+
+      period = p;
+
+      return max_suffix_reverse + 1U;
+    }
+  }
+
+  //***************************************************************************
+  /// A searcher that uses etl::search.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator, typename TCompare = etl::equal_to<typename etl::iterator_traits<TPatternIterator>::value_type> >
+  class default_searcher
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    default_searcher(TPatternIterator pattern_first_, TPatternIterator pattern_last_, TCompare compare_ = TCompare())
+      : pattern_first(pattern_first_)
+      , pattern_last(pattern_last_)
+      , compare(compare_)
+    {
+    }
+
+    //*************************************************************************
+    /// Finds the pattern in the range.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_OR_STD::pair<TIterator, TIterator> operator()(TIterator first, TIterator last) const
+    {
+      TIterator match = etl::search(first, last, pattern_first, pattern_last, compare);
+
+      if (match == last)
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(last, last);
+      }
+
+      TIterator match_end = match;
+      etl::advance(match_end, etl::distance(pattern_first, pattern_last));
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(match, match_end);
+    }
+
+  private:
+
+    TPatternIterator pattern_first;
+    TPatternIterator pattern_last;
+    TCompare         compare;
+  };
+
+  //***************************************************************************
+  /// A searcher that uses the Boyer-Moore-Horspool algorithm.
+  /// Sub-linear on average for longer patterns, as it skips ahead by up to
+  /// the length of the pattern on a mismatch.
+  /// The skip table is a fixed 256 bytes, keyed on the low eight bits of each
+  /// element, so it suits char and byte ranges. Elements must be integral,
+  /// or convert to one, and are compared with operator ==.
+  /// The pattern and range iterators must be random access.
+  /// The pattern must outlive the searcher.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator>
+  class boyer_moore_horspool_searcher
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    boyer_moore_horspool_searcher(TPatternIterator pattern_first_, TPatternIterator pattern_last_)
+      : pattern_first(pattern_first_)
+      , length(size_t(etl::distance(pattern_first_, pattern_last_)))
+    {
+      table.build(pattern_first, length);
+    }
+
+    //*************************************************************************
+    /// Finds the pattern in the range.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_OR_STD::pair<TIterator, TIterator> operator()(TIterator first, TIterator last) const
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      TIterator match = private_searcher::horspool_search(first, last, pattern_first, length, table);
+
+      if ((match == last) && (length != 0U))
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(last, last);
+      }
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(match, match + difference_t(length));
+    }
+
+  private:
+
+    TPatternIterator                   pattern_first;
+    size_t                             length;
+    private_searcher::horspool_table   table;
+  };
+
+  //***************************************************************************
+  /// A searcher that uses the two-way algorithm of Crochemore and Perrin.
+  /// Linear in the worst case, O(N + M), with constant extra space, so it
+  /// suits repetitive data, such as runs of padding or preambles, where a
+  /// naive search degrades to O(N * M).
+  /// Elements are compared with operator < and operator ==.
+  /// The pattern and range iterators must be random access.
+  /// The pattern must outlive the searcher.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator>
+  class two_way_searcher
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    two_way_searcher(TPatternIterator pattern_first_, TPatternIterator pattern_last_)
+      : pattern(pattern_first_)
+      , length(size_t(etl::distance(pattern_first_, pattern_last_)))
+      , suffix(0U)
+      , period(1U)
+      , periodic(false)
+    {
+      if (length != 0U)
+      {
+        suffix = private_searcher::critical_factorisation(pattern, length, period);
+
+        // The pattern is periodic if the left half repeats at the period.
+        periodic = ((period + suffix) <= length);
+
+        for (size_t i = 0U; periodic && (i < suffix); ++i)
+        {
+          periodic = (pattern[i] == pattern[i + period]);
+        }
+
+        if (!periodic)
+        {
+          period = etl::max(suffix, length - suffix) + 1U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the pattern in the range.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_OR_STD::pair<TIterator, TIterator> operator()(TIterator first, TIterator last) const
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const size_t size = size_t(last - first);
+
+      if (length == 0U)
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(first, first);
+      }
+
+      if (size >= length)
+      {
+        const size_t final_start = size - length;
+
+        size_t j      = 0U;
+        size_t memory = 0U;
+
+        while (j <= final_start)
+        {
+          TIterator candidate = first + difference_t(j);
+
+          // Match the right half, left to right.
+          size_t i = etl::max(suffix, memory);
+
+          while ((i < length) && (pattern[i] == candidate[difference_t(i)]))
+          {
+            ++i;
+          }
+
+          if (i < length)
+          {
+            j += i - suffix + 1U;
+            memory = 0U;
+          }
+          else
+          {
+            // Match the left half, right to left, stopping at what the last shift remembered.
+            i = suffix;
+
+            while ((i > memory) && (pattern[i - 1U] == candidate[difference_t(i - 1U)]))
+            {
+              --i;
+            }
+
+            if (i <= memory)
+            {
+              return ETL_OR_STD::pair<TIterator, TIterator>(candidate, candidate + difference_t(length));
+            }
+
+            j += period;
+            memory = periodic ? (length - period) : 0U;
+          }
+        }
+      }
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(last, last);
+    }
+
+  private:
+
+    TPatternIterator pattern;
+    size_t           length;
+    size_t           suffix;
+    size_t           period;
+    bool             periodic;
+  };
+
+  //***************************************************************************
+  /// Makes a default_searcher.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator>
+  default_searcher<TPatternIterator> make_default_searcher(TPatternIterator pattern_first, TPatternIterator pattern_last)
+  {
+    return default_searcher<TPatternIterator>(pattern_first, pattern_last);
+  }
+
+  //***************************************************************************
+  /// Makes a boyer_moore_horspool_searcher.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator>
+  boyer_moore_horspool_searcher<TPatternIterator> make_boyer_moore_horspool_searcher(TPatternIterator pattern_first, TPatternIterator pattern_last)
+  {
+    return boyer_moore_horspool_searcher<TPatternIterator>(pattern_first, pattern_last);
+  }
+
+  //***************************************************************************
+  /// Makes a two_way_searcher.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TPatternIterator>
+  two_way_searcher<TPatternIterator> make_two_way_searcher(TPatternIterator pattern_first, TPatternIterator pattern_last)
+  {
+    return two_way_searcher<TPatternIterator>(pattern_first, pattern_last);
+  }
+
+  //***************************************************************************
+  /// Searches the range with a searcher.
+  ///\return The start of the match, or last.
+  ///\ingroup searcher
+  //***************************************************************************
+  template <typename TIterator, typename TSearcher>
+  ETL_NODISCARD
+  TIterator search(TIterator first, TIterator last, const TSearcher& searcher)
+  {
+    return searcher(first, last).first;
+  }
+}
+
+#endif
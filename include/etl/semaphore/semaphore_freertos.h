@@ -0,0 +1,97 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEMAPHORE_FREERTOS_INCLUDED
+#define ETL_SEMAPHORE_FREERTOS_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include <semphr.h>
+#include <task.h>
+
+namespace etl
+{
+//***************************************************************************
+///\ingroup semaphore
+///\brief This counting semaphore class is implemented using FreeRTOS's
+/// counting semaphores
+//***************************************************************************
+class semaphore
+{
+ public:
+
+  semaphore()
+  {
+    access = xSemaphoreCreateCountingStatic(UBaseType_t(~UBaseType_t(0)), 0, &semaphore_allocation);
+  }
+
+  void release()
+  {
+    xSemaphoreGive(access);
+  }
+
+  void acquire()
+  {
+    xSemaphoreTake(access, portMAX_DELAY); // portMAX_DELAY=block forever
+  }
+
+  bool try_acquire()
+  {
+    return xSemaphoreTake(access, 0) == pdTRUE;
+  }
+
+  bool try_acquire_for(uint32_t timeout_ms)
+  {
+    return xSemaphoreTake(access, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+  }
+
+  // A millisecond count for measuring timeouts.
+  // Only differences between counts are meaningful, and only while they are
+  // within the range of the tick count.
+  static uint32_t time_ms()
+  {
+    return uint32_t(xTaskGetTickCount()) * uint32_t(portTICK_PERIOD_MS);
+  }
+
+ private:
+  // Non-copyable
+  semaphore(const semaphore&);
+  semaphore& operator=(const semaphore&);
+  // Memory to hold the semaphore
+  StaticSemaphore_t semaphore_allocation;
+  // The semaphore handle itself
+  SemaphoreHandle_t access;
+};
+}
+
+#endif
@@ -0,0 +1,138 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEMAPHORE_STD_INCLUDED
+#define ETL_SEMAPHORE_STD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup semaphore
+  ///\brief This counting semaphore class is implemented using std::mutex and
+  /// std::condition_variable.
+  //***************************************************************************
+  class semaphore
+  {
+  public:
+
+    semaphore()
+      : count(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a count and wakes one waiting thread.
+    //*************************************************************************
+    void release()
+    {
+      {
+        std::lock_guard<std::mutex> lock(access);
+        ++count;
+      }
+
+      condition.notify_one();
+    }
+
+    //*************************************************************************
+    /// Waits for, and takes, a count.
+    //*************************************************************************
+    void acquire()
+    {
+      std::unique_lock<std::mutex> lock(access);
+
+      condition.wait(lock, [this]() { return count != 0; });
+
+      --count;
+    }
+
+    //*************************************************************************
+    /// Takes a count if there is one.
+    //*************************************************************************
+    bool try_acquire()
+    {
+      std::lock_guard<std::mutex> lock(access);
+
+      if (count == 0)
+      {
+        return false;
+      }
+
+      --count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Waits for up to timeout_ms milliseconds for a count, and takes it.
+    //*************************************************************************
+    bool try_acquire_for(uint32_t timeout_ms)
+    {
+      std::unique_lock<std::mutex> lock(access);
+
+      if (!condition.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() { return count != 0; }))
+      {
+        return false;
+      }
+
+      --count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns a millisecond count for measuring timeouts.
+    /// It wraps modulo 2^32, so only differences between counts are meaningful.
+    //*************************************************************************
+    static uint32_t time_ms()
+    {
+      return uint32_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+  private:
+
+    semaphore(const semaphore&) = delete;
+    semaphore& operator =(const semaphore&) = delete;
+
+    std::mutex              access;
+    std::condition_variable condition;
+    size_t                  count;
+  };
+}
+
+#endif
@@ -0,0 +1,211 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_INCLUDED
+#define ETL_SEQLOCK_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "mutex/spin_mutex.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup seqlock seqlock
+/// A value shared between one writer and many readers.
+/// The writer never waits. Readers never write to shared memory; they retry
+/// if the value was written while they read it.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup seqlock
+  /// A sequence locked value.
+  /// The sequence count is odd while a write is in progress.
+  /// The value is held as an array of atomic words, so a read that overlaps a
+  /// write is not a data race; the copy is discarded and the read is retried.
+  /// Only one thread may write at a time.
+  /// Without the STL, etl::is_trivially_copyable must be specialised for class types.
+  ///\tparam T The type of the value. Must be trivially copyable.
+  //***************************************************************************
+  template <typename T>
+  class seqlock
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+    typedef T        value_type;
+    typedef uint32_t sequence_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// The value is value initialised.
+    //*************************************************************************
+    seqlock()
+      : sequence(0U)
+    {
+      store_words(T());
+    }
+
+    //*************************************************************************
+    /// Construct with an initial value.
+    //*************************************************************************
+    explicit seqlock(const T& value)
+      : sequence(0U)
+    {
+      store_words(value);
+    }
+
+    //*************************************************************************
+    /// Writes a new value.
+    /// Must not be called from more than one thread at a time.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      const sequence_type s = sequence.load(etl::memory_order_relaxed);
+
+      // Odd while the write is in progress.
+      sequence.store(s + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      store_words(value);
+
+      sequence.store(s + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Reads the value, retrying until a consistent copy is made.
+    //*************************************************************************
+    T read() const
+    {
+      T value;
+
+      read(value);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads the value, retrying until a consistent copy is made.
+    //*************************************************************************
+    void read(T& value) const
+    {
+      while (!try_read(value))
+      {
+        private_mutex::spin_pause();
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a single attempt to read the value.
+    /// Returns <b>false</b> and leaves value unchanged if a write overlapped.
+    //*************************************************************************
+    bool try_read(T& value) const
+    {
+      const sequence_type s1 = sequence.load(etl::memory_order_acquire);
+
+      if ((s1 & 1U) != 0U)
+      {
+        return false;
+      }
+
+      size_t copy[Words];
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        copy[i] = words[i].load(etl::memory_order_relaxed);
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      if (sequence.load(etl::memory_order_relaxed) != s1)
+      {
+        return false;
+      }
+
+      memcpy(&value, copy, sizeof(T));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns the sequence count.
+    /// It changes by two for every write, and is odd while a write is in progress.
+    //*************************************************************************
+    sequence_type get_sequence() const
+    {
+      return sequence.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    /// The number of words needed to hold a T.
+    static ETL_CONSTANT size_t Words = (sizeof(T) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+    //*************************************************************************
+    /// Copies the value to the words.
+    //*************************************************************************
+    void store_words(const T& value)
+    {
+      size_t copy[Words];
+
+      copy[Words - 1U] = 0U; // Clear any padding in the last word.
+      memcpy(copy, &value, sizeof(T));
+
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        words[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    seqlock(const seqlock&) ETL_DELETE;
+    seqlock& operator =(const seqlock&) ETL_DELETE;
+
+    etl::atomic<sequence_type> sequence;
+    etl::atomic<size_t>        words[Words];
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t seqlock<T>::Words;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,621 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_UNORDERED_MAP_INCLUDED
+#define ETL_SEQLOCK_UNORDERED_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "functional.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "power.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup seqlock_unordered_map seqlock_unordered_map
+/// A fixed capacity hash map for one writer and any number of concurrent readers.
+/// The writer brackets each change with increments of an atomic sequence
+/// counter. Readers copy the mapped value out and retry if the counter was odd
+/// or changed while they read, so they never take a lock or block the writer.
+/// A reader may retry while a write is in progress, so it suits data that is
+/// read constantly and changed rarely.
+/// Each slot is held as an array of atomic words, as in etl::seqlock, so a read
+/// that overlaps a write is not a data race; the copy is discarded and the
+/// read is retried.
+/// The keys and mapped values must be trivially copyable. Without the STL,
+/// etl::is_trivially_copyable must be specialised for class types.
+/// Uses open addressing with linear probing, in a table of at least twice the
+/// capacity, rounded up to a power of 2.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the seqlock_unordered_map.
+  ///\ingroup seqlock_unordered_map
+  //***************************************************************************
+  class seqlock_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    seqlock_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the seqlock_unordered_map.
+  ///\ingroup seqlock_unordered_map
+  //***************************************************************************
+  class seqlock_unordered_map_full : public etl::seqlock_unordered_map_exception
+  {
+  public:
+
+    seqlock_unordered_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::seqlock_unordered_map_exception(ETL_ERROR_TEXT("seqlock_unordered_map:full", ETL_SEQLOCK_UNORDERED_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized seqlock_unordered_map.
+  /// Can be used as a reference type for all seqlock_unordered_map containing a specific type.
+  /// find, contains, size and empty may be called from any thread.
+  /// All of the other functions must only be called from the writer thread.
+  ///\ingroup seqlock_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iseqlock_unordered_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TKey>::value,    "The key must be trivially copyable");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TMapped>::value, "The mapped type must be trivially copyable");
+
+    typedef TKey      key_type;
+    typedef TMapped   mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+    typedef size_t    size_type;
+
+    typedef typename etl::parameter_type<TKey>::type    key_parameter_t;
+    typedef typename etl::parameter_type<TMapped>::type mapped_parameter_t;
+
+  protected:
+
+    //*************************************************************************
+    /// A key and its mapped value.
+    //*************************************************************************
+    struct slot_t
+    {
+      TKey    key;
+      TMapped mapped;
+    };
+
+    /// The number of words needed to hold a slot.
+    static ETL_CONSTANT size_t Slot_Words = (sizeof(slot_t) + sizeof(size_t) - 1U) / sizeof(size_t);
+
+    typedef etl::atomic<size_t>  slot_word_t;
+    typedef etl::atomic<uint8_t> state_t;
+
+  public:
+
+    //*************************************************************************
+    /// Copies the mapped value for the key, if the key exists.
+    /// May be called from any thread.
+    ///\param key    The key to search for.
+    ///\param mapped Set to the mapped value if the key exists.
+    ///\return <b>true</b> if the key exists.
+    //*************************************************************************
+    bool find(key_parameter_t key, mapped_type& mapped) const
+    {
+      const size_t home = home_index(key);
+
+      bool found;
+      uint32_t sequence;
+
+      do
+      {
+        sequence = read_begin();
+
+        size_t index = find_index(key, home);
+
+        found = (index != table_size);
+
+        if (found)
+        {
+          mapped = load_slot(index).mapped;
+        }
+      } while (read_retry(sequence));
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    /// May be called from any thread.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      const size_t home = home_index(key);
+
+      bool found;
+      uint32_t sequence;
+
+      do
+      {
+        sequence = read_begin();
+        found    = (find_index(key, home) != table_size);
+      } while (read_retry(sequence));
+
+      return found;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    /// May be called from any thread.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    /// May be called from any thread.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size of the map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - size();
+    }
+
+    //*************************************************************************
+    /// Inserts a key and mapped value, if the key does not already exist.
+    /// If asserts or exceptions are enabled, emits seqlock_unordered_map_full if the map is already full.
+    ///\param key    The key.
+    ///\param mapped The mapped value.
+    ///\return <b>true</b> if the key was inserted.
+    //*************************************************************************
+    bool insert(key_parameter_t key, mapped_parameter_t mapped)
+    {
+      size_t index = home_index(key);
+
+      while (is_used(index))
+      {
+        if (key_equal_function(load_slot(index).key, key))
+        {
+          return false;
+        }
+
+        index = next_index(index);
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(seqlock_unordered_map_full), false);
+
+      const slot_t slot = { key, mapped };
+
+      write_begin();
+      store_slot(index, slot);
+      pstates[index].store(Used, etl::memory_order_relaxed);
+      current_size.store(size() + 1U, etl::memory_order_relaxed);
+      write_end();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Inserts a key and mapped value, or assigns the mapped value if the key already exists.
+    /// If asserts or exceptions are enabled, emits seqlock_unordered_map_full if the map is already full.
+    ///\param key    The key.
+    ///\param mapped The mapped value.
+    ///\return <b>true</b> if the key was inserted.
+    //*************************************************************************
+    bool insert_or_assign(key_parameter_t key, mapped_parameter_t mapped)
+    {
+      size_t index = find_index(key, home_index(key));
+
+      if (index == table_size)
+      {
+        return insert(key, mapped);
+      }
+
+      slot_t slot = load_slot(index);
+      slot.mapped = mapped;
+
+      write_begin();
+      store_slot(index, slot);
+      write_end();
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Erases the element with the key.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*************************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_t hole = find_index(key, home_index(key));
+
+      if (hole == table_size)
+      {
+        return 0U;
+      }
+
+      write_begin();
+
+      // Shift back any following elements that would no longer be found past the hole.
+      size_t index = next_index(hole);
+
+      while (is_used(index))
+      {
+        const slot_t slot = load_slot(index);
+        size_t home = home_index(slot.key);
+
+        bool stays = (hole <= index) ? ((hole < home) && (home <= index))
+                                     : ((hole < home) || (home <= index));
+
+        if (!stays)
+        {
+          store_slot(hole, slot);
+          hole = index;
+        }
+
+        index = next_index(index);
+      }
+
+      pstates[hole].store(Empty, etl::memory_order_relaxed);
+      current_size.store(size() - 1U, etl::memory_order_relaxed);
+
+      write_end();
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      write_begin();
+
+      for (size_t i = 0U; i < table_size; ++i)
+      {
+        pstates[i].store(Empty, etl::memory_order_relaxed);
+      }
+
+      current_size.store(0U, etl::memory_order_relaxed);
+
+      write_end();
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iseqlock_unordered_map(slot_word_t* pslot_words_, state_t* pstates_, size_t max_size_, size_t table_size_)
+      : pslot_words(pslot_words_),
+        pstates(pstates_),
+        maximum_size(max_size_),
+        table_size(table_size_),
+        current_size(0U),
+        sequence_count(0U)
+    {
+      for (size_t i = 0U; i < table_size; ++i)
+      {
+        pstates[i].store(Empty, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    enum
+    {
+      Empty = 0,
+      Used  = 1
+    };
+
+    //*************************************************************************
+    /// The index that a key's probe starts at.
+    //*************************************************************************
+    size_t home_index(key_parameter_t key) const
+    {
+      return key_hash_function(key) & (table_size - 1U);
+    }
+
+    //*************************************************************************
+    /// The next index in the probe sequence.
+    //*************************************************************************
+    size_t next_index(size_t index) const
+    {
+      return (index + 1U) & (table_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Finds the index of the key, or returns table_size.
+    /// The probe is bounded by the table size, as a reader may see a partial update.
+    //*************************************************************************
+    size_t find_index(key_parameter_t key, size_t index) const
+    {
+      for (size_t probes = 0U; (probes < table_size) && is_used(index); ++probes)
+      {
+        if (key_equal_function(load_slot(index).key, key))
+        {
+          return index;
+        }
+
+        index = next_index(index);
+      }
+
+      return table_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the slot at the index is used.
+    //*************************************************************************
+    bool is_used(size_t index) const
+    {
+      return pstates[index].load(etl::memory_order_relaxed) != Empty;
+    }
+
+    //*************************************************************************
+    /// Copies the slot at the index out of its words.
+    //*************************************************************************
+    slot_t load_slot(size_t index) const
+    {
+      const slot_word_t* pwords = pslot_words + (index * Slot_Words);
+
+      size_t copy[Slot_Words];
+
+      for (size_t i = 0U; i < Slot_Words; ++i)
+      {
+        copy[i] = pwords[i].load(etl::memory_order_relaxed);
+      }
+
+      typename etl::aligned_storage<sizeof(slot_t), etl::alignment_of<slot_t>::value>::type buffer;
+      memcpy(&buffer, copy, sizeof(slot_t));
+
+      return *reinterpret_cast<const slot_t*>(&buffer);
+    }
+
+    //*************************************************************************
+    /// Copies the slot to the words at the index.
+    //*************************************************************************
+    void store_slot(size_t index, const slot_t& slot)
+    {
+      slot_word_t* pwords = pslot_words + (index * Slot_Words);
+
+      size_t copy[Slot_Words];
+
+      copy[Slot_Words - 1U] = 0U; // Clear any padding in the last word.
+      memcpy(copy, &slot, sizeof(slot_t));
+
+      for (size_t i = 0U; i < Slot_Words; ++i)
+      {
+        pwords[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Waits for any write in progress and returns the sequence count.
+    //*************************************************************************
+    uint32_t read_begin() const
+    {
+      uint32_t sequence;
+
+      do
+      {
+        sequence = sequence_count.load(etl::memory_order_acquire);
+      } while ((sequence & 1U) != 0U);
+
+      return sequence;
+    }
+
+    //*************************************************************************
+    /// Checks if a write overlapped the read that started with the sequence count.
+    //*************************************************************************
+    bool read_retry(uint32_t sequence) const
+    {
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      return sequence_count.load(etl::memory_order_relaxed) != sequence;
+    }
+
+    //*************************************************************************
+    /// Makes the sequence count odd before a change.
+    //*************************************************************************
+    void write_begin()
+    {
+      sequence_count.store(sequence_count.load(etl::memory_order_relaxed) + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Makes the sequence count even after a change.
+    //*************************************************************************
+    void write_end()
+    {
+      sequence_count.store(sequence_count.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iseqlock_unordered_map(const iseqlock_unordered_map&);
+    iseqlock_unordered_map& operator =(const iseqlock_unordered_map&);
+
+    slot_word_t*        pslot_words;
+    state_t*            pstates;
+    const size_t        maximum_size;
+    const size_t        table_size;
+    etl::atomic<size_t> current_size;
+
+    hasher    key_hash_function;
+    key_equal key_equal_function;
+
+    etl::atomic<uint32_t> sequence_count;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SEQLOCK_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iseqlock_unordered_map()
+    {
+    }
+#else
+  protected:
+    ~iseqlock_unordered_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A seqlock_unordered_map implementation that uses a fixed size buffer.
+  ///\tparam TKey      The key type.
+  ///\tparam TMapped   The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam THash     The hash function for the keys. Default = etl::hash<TKey>
+  ///\tparam TKeyEqual The function to compare keys. Default = etl::equal_to<TKey>
+  ///\ingroup seqlock_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class seqlock_unordered_map : public etl::iseqlock_unordered_map<TKey, TMapped, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iseqlock_unordered_map<TKey, TMapped, THash, TKeyEqual> base;
+    typedef typename base::slot_word_t slot_word_t;
+    typedef typename base::state_t     state_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t TABLE_SIZE = etl::power_of_2_round_up<2U * MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    seqlock_unordered_map()
+      : base(slot_words, states, MAX_SIZE, TABLE_SIZE)
+    {
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    seqlock_unordered_map(const seqlock_unordered_map&);
+    seqlock_unordered_map& operator =(const seqlock_unordered_map&);
+
+    /// The keys and mapped values.
+    slot_word_t slot_words[TABLE_SIZE * base::Slot_Words];
+
+    /// Whether each slot is used.
+    state_t states[TABLE_SIZE];
+  };
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t iseqlock_unordered_map<TKey, TMapped, THash, TKeyEqual>::Slot_Words;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t seqlock_unordered_map<TKey, TMapped, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t seqlock_unordered_map<TKey, TMapped, MAX_SIZE_, THash, TKeyEqual>::TABLE_SIZE;
+}
+
+#endif
+
+#endif
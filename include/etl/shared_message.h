@@ -49,6 +49,14 @@ namespace etl
   {
   public:
 
+    //*************************************************************************
+    /// Tag to construct a shared_message from a reference that has already
+    /// been counted by acquire().
+    //*************************************************************************
+    struct adopt_reference_t
+    {
+    };
+
     //*************************************************************************
     /// Constructor
     //*************************************************************************
@@ -85,6 +93,16 @@ namespace etl
       p_rcmessage->get_reference_counter().increment_reference_count();
     }
 
+    //*************************************************************************
+    /// Constructor
+    /// Adopts a reference that was counted by a previous call to acquire().
+    /// The reference count is not changed.
+    //*************************************************************************
+    shared_message(adopt_reference_t, const etl::shared_message& other)
+      : p_rcmessage(other.p_rcmessage)
+    {
+    }
+
 #if ETL_CPP11_SUPPORTED
     //*************************************************************************
     /// Move constructor
@@ -169,6 +187,20 @@ namespace etl
       return p_rcmessage->get_message();
     }
 
+    //*************************************************************************
+    /// Adds count references to the message, in one operation.
+    /// Each reference must be handed to exactly one shared_message that is
+    /// constructed with adopt_reference_t.
+    /// Used to hand out many copies for the cost of one counter update.
+    //*************************************************************************
+    void acquire(uint32_t count)
+    {
+      if (count != 0U)
+      {
+        p_rcmessage->get_reference_counter().add_reference_count(int32_t(count));
+      }
+    }
+
     //*************************************************************************
     /// Get the current reference count for this shared message.
     //*************************************************************************
@@ -0,0 +1,268 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLAB_ALLOCATOR_INCLUDED
+#define ETL_SLAB_ALLOCATOR_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "fixed_sized_memory_block_allocator.h"
+#include "integral_limits.h"
+#include "log.h"
+#include "static_assert.h"
+
+namespace etl
+{
+  namespace private_slab_allocator
+  {
+    //*************************************************************************
+    /// The fixed sized allocators for the size classes from VBlock_Size up to
+    /// VMax_Block_Size, doubling each time.
+    /// The classes are laid out in increasing order of address.
+    //*************************************************************************
+    template <size_t VBlock_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks, bool VIs_Last = (VBlock_Size >= VMax_Block_Size)>
+    struct size_classes
+    {
+      void get(etl::imemory_block_allocator** pp_allocators, const char** pp_begin)
+      {
+        *pp_allocators = &allocator;
+        *pp_begin      = reinterpret_cast<const char*>(&allocator);
+
+        larger.get(pp_allocators + 1, pp_begin + 1);
+      }
+
+      etl::fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VBlocks>    allocator;
+      size_classes<VBlock_Size * 2U, VMax_Block_Size, VAlignment, VBlocks>          larger;
+    };
+
+    //*************************************************************************
+    /// The largest size class.
+    //*************************************************************************
+    template <size_t VBlock_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks>
+    struct size_classes<VBlock_Size, VMax_Block_Size, VAlignment, VBlocks, true>
+    {
+      void get(etl::imemory_block_allocator** pp_allocators, const char** pp_begin)
+      {
+        *pp_allocators = &allocator;
+        *pp_begin      = reinterpret_cast<const char*>(&allocator);
+        *(pp_begin + 1) = reinterpret_cast<const char*>(&allocator + 1);
+      }
+
+      etl::fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VBlocks> allocator;
+    };
+  }
+
+  //*************************************************************************
+  /// A memory block allocator with power of 2 size classes.
+  /// Holds a fixed_sized_memory_block_allocator of VBlocks_Per_Class blocks
+  /// for each block size from VMin_Block_Size to VMax_Block_Size.
+  /// The class for a request is calculated from the leading zeros of the
+  /// size, so an allocation is O(1) whatever the mix of sizes, and wastes
+  /// less than half of a block. If the class is exhausted then the next
+  /// larger class with a free block is used.
+  /// A release finds the owning class by address, without any virtual calls
+  /// to the classes that do not own the block.
+  /// Successors may be chained as for any other imemory_block_allocator.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  class slab_allocator : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VMin_Block_Size > 0U) && ((VMin_Block_Size & (VMin_Block_Size - 1U)) == 0U), "Minimum block size must be a power of 2");
+    ETL_STATIC_ASSERT((VMax_Block_Size & (VMax_Block_Size - 1U)) == 0U, "Maximum block size must be a power of 2");
+    ETL_STATIC_ASSERT(VMax_Block_Size >= VMin_Block_Size, "Maximum block size must not be less than the minimum");
+
+    static ETL_CONSTANT size_t Min_Block_Size    = VMin_Block_Size;
+    static ETL_CONSTANT size_t Max_Block_Size    = VMax_Block_Size;
+    static ETL_CONSTANT size_t Alignment         = VAlignment;
+    static ETL_CONSTANT size_t Blocks_Per_Class  = VBlocks_Per_Class;
+    static ETL_CONSTANT size_t Number_Of_Classes = size_t(etl::log2<VMax_Block_Size>::value) - size_t(etl::log2<VMin_Block_Size>::value) + 1U;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    slab_allocator()
+    {
+      classes.get(allocators, class_begin);
+    }
+
+    //*************************************************************************
+    /// Gets the size class that serves a request.
+    /// Returns Number_Of_Classes if the size is larger than Max_Block_Size.
+    //*************************************************************************
+    static size_t size_class(size_t required_size)
+    {
+      if (required_size <= Min_Block_Size)
+      {
+        return 0U;
+      }
+      else if (required_size > Max_Block_Size)
+      {
+        return Number_Of_Classes;
+      }
+      else
+      {
+        return bit_width(required_size - 1U) - size_t(etl::log2<VMin_Block_Size>::value);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the block size of a size class.
+    //*************************************************************************
+    static size_t class_block_size(size_t index)
+    {
+      return Min_Block_Size << index;
+    }
+
+#if defined(ETL_IN_UNIT_TEST)
+    //*************************************************************************
+    /// Gets the size class that owns the block, or Number_Of_Classes.
+    /// For unit testing purposes.
+    //*************************************************************************
+    size_t owner_class_of(const void* const pblock) const
+    {
+      return find_owner(pblock);
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// The number of bits needed to represent the non-zero value.
+    /// GCC and Clang use the hardware count leading zeros instruction.
+    //*************************************************************************
+    static size_t bit_width(size_t value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return size_t(etl::integral_limits<unsigned long long>::bits) - size_t(__builtin_clzll(static_cast<unsigned long long>(value)));
+#else
+      // The value is never more than Max_Block_Size, so this loop is bounded by the class count.
+      size_t width = size_t(etl::log2<VMin_Block_Size>::value);
+      value >>= width;
+
+      while (value != 0U)
+      {
+        value >>= 1U;
+        ++width;
+      }
+
+      return width;
+#endif
+    }
+
+    //*************************************************************************
+    /// Gets the size class whose storage contains the block, or Number_Of_Classes.
+    //*************************************************************************
+    size_t find_owner(const void* const pblock) const
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      if ((p >= class_begin[0]) && (p < class_begin[Number_Of_Classes]))
+      {
+        for (size_t i = 1U; i < Number_Of_Classes; ++i)
+        {
+          if (p < class_begin[i])
+          {
+            return i - 1U;
+          }
+        }
+
+        return Number_Of_Classes - 1U;
+      }
+
+      return Number_Of_Classes;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment <= Alignment)
+      {
+        for (size_t i = size_class(required_size); i < Number_Of_Classes; ++i)
+        {
+          void* p = allocators[i]->allocate(required_size, required_alignment);
+
+          if (p != ETL_NULLPTR)
+          {
+            return p;
+          }
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      const size_t index = find_owner(pblock);
+
+      if (index < Number_Of_Classes)
+      {
+        return allocators[index]->release(pblock);
+      }
+
+      return false;
+    }
+
+    /// The fixed sized allocators for each class.
+    private_slab_allocator::size_classes<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class> classes;
+
+    /// The allocator for each class.
+    etl::imemory_block_allocator* allocators[Number_Of_Classes];
+
+    /// The start of each class's storage, followed by the end of the last.
+    const char* class_begin[Number_Of_Classes + 1U];
+  };
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Max_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Alignment;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Blocks_Per_Class;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t slab_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Number_Of_Classes;
+}
+
+#endif
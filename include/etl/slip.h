@@ -0,0 +1,416 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIP_INCLUDED
+#define ETL_SLIP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "span.h"
+
+#if ETL_CPP11_SUPPORTED
+
+///\defgroup slip slip
+/// Serial Line Internet Protocol framing (RFC 1055).
+/// Frames end with an END byte. END and ESC bytes in the data are replaced
+/// by two byte escape sequences.
+/// The encoder and decoder both accept their input in pieces, so a frame may
+/// be split across any number of buffers.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// The SLIP special characters.
+  ///\ingroup slip
+  //***************************************************************************
+  struct slip
+  {
+    enum : uint8_t
+    {
+      END     = 0xC0U,
+      ESC     = 0xDBU,
+      ESC_END = 0xDCU,
+      ESC_ESC = 0xDDU
+    };
+  };
+
+  namespace private_slip
+  {
+    //*************************************************************************
+    /// Copies up to n bytes, stopping before the first END or ESC.
+    /// Returns the number of bytes copied.
+    /// Short runs are quicker a byte at a time. Longer ones use memchr for
+    /// each special character, the second search bounded by the first.
+    //*************************************************************************
+    inline size_t copy_plain(uint8_t* destination, const uint8_t* source, size_t n)
+    {
+      if (n < 32U)
+      {
+        size_t i = 0U;
+
+        while ((i < n) && (source[i] != etl::slip::END) && (source[i] != etl::slip::ESC))
+        {
+          destination[i] = source[i];
+          ++i;
+        }
+
+        return i;
+      }
+
+      const uint8_t* pend  = static_cast<const uint8_t*>(memchr(source, etl::slip::END, n));
+      size_t         count = (pend != ETL_NULLPTR) ? size_t(pend - source) : n;
+      const uint8_t* pesc  = static_cast<const uint8_t*>(memchr(source, etl::slip::ESC, count));
+
+      if (pesc != ETL_NULLPTR)
+      {
+        count = size_t(pesc - source);
+      }
+
+      memcpy(destination, source, count);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes before the first END or ESC.
+    //*************************************************************************
+    inline size_t skip_plain(const uint8_t* source, size_t n)
+    {
+      size_t i = 0U;
+
+      while ((i < n) && (source[i] != etl::slip::END) && (source[i] != etl::slip::ESC))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+  }
+
+  //***************************************************************************
+  /// The largest encoded size of a frame of 'size' bytes, including the END.
+  ///\ingroup slip
+  //***************************************************************************
+  inline ETL_CONSTEXPR size_t slip_max_encoded_size(size_t size)
+  {
+    return (2U * size) + 1U;
+  }
+
+  //***************************************************************************
+  /// Encodes a frame into an output buffer.
+  ///\ingroup slip
+  //***************************************************************************
+  class slip_encoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit slip_encoder(etl::span<uint8_t> output_)
+      : output(output_)
+    {
+      restart();
+    }
+
+    //*************************************************************************
+    /// Starts a new frame at the beginning of the output buffer.
+    //*************************************************************************
+    void restart()
+    {
+      out_index = 0U;
+      overflow  = false;
+    }
+
+    //*************************************************************************
+    /// Adds data to the frame.
+    /// Returns false if the output buffer is full.
+    //*************************************************************************
+    bool add(etl::span<const uint8_t> input)
+    {
+      const uint8_t* p    = input.data();
+      const uint8_t* pend = p + input.size();
+
+      while ((p != pend) && !overflow)
+      {
+        // Copy up to the next special character.
+        const size_t run   = size_t(pend - p);
+        const size_t room  = output.size() - out_index;
+        const size_t limit = (run < room) ? run : room;
+        const size_t count = private_slip::copy_plain(output.data() + out_index, p, limit);
+
+        out_index += count;
+        p         += count;
+
+        if (count < limit)
+        {
+          // Stopped at a special character.
+          if ((output.size() - out_index) < 2U)
+          {
+            overflow = true;
+            break;
+          }
+
+          output[out_index++] = etl::slip::ESC;
+          output[out_index++] = (*p++ == etl::slip::END) ? uint8_t(etl::slip::ESC_END) : uint8_t(etl::slip::ESC_ESC);
+        }
+        else if (limit < run)
+        {
+          overflow = true;
+        }
+      }
+
+      return !overflow;
+    }
+
+    //*************************************************************************
+    /// Completes the frame with an END.
+    /// Returns the encoded size, or zero if the output buffer was too small.
+    //*************************************************************************
+    size_t finish()
+    {
+      if (overflow || (out_index == output.size()))
+      {
+        overflow = true;
+        return 0U;
+      }
+
+      output[out_index++] = etl::slip::END;
+
+      return out_index;
+    }
+
+    //*************************************************************************
+    /// True if the output buffer was too small.
+    //*************************************************************************
+    bool has_overflowed() const
+    {
+      return overflow;
+    }
+
+  private:
+
+    etl::span<uint8_t> output;    ///< The output buffer.
+    size_t             out_index; ///< The next byte to write.
+    bool               overflow;  ///< True if the output buffer is too small.
+  };
+
+  //***************************************************************************
+  /// Encodes a frame in one go.
+  /// Returns the encoded size, or zero if the output buffer is too small.
+  ///\ingroup slip
+  //***************************************************************************
+  inline size_t slip_encode(etl::span<const uint8_t> input, etl::span<uint8_t> output)
+  {
+    etl::slip_encoder encoder(output);
+
+    encoder.add(input);
+
+    return encoder.finish();
+  }
+
+  //***************************************************************************
+  /// Decodes frames from a stream of encoded bytes.
+  /// Input is given with decode(), which stops after the END at the end of a
+  /// frame and returns the number of bytes it consumed. The rest of the input
+  /// can be given again once the frame has been dealt with and next_frame()
+  /// called.
+  /// END bytes with nothing between them are skipped.
+  ///\ingroup slip
+  //***************************************************************************
+  class slip_decoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit slip_decoder(etl::span<uint8_t> output_)
+      : output(output_)
+    {
+      next_frame();
+    }
+
+    //*************************************************************************
+    /// Decodes input until the end of a frame or the end of the input.
+    /// Returns the number of bytes consumed.
+    //*************************************************************************
+    size_t decode(etl::span<const uint8_t> input)
+    {
+      const uint8_t* const pbegin = input.data();
+      const uint8_t*       p      = pbegin;
+      const uint8_t* const pend   = pbegin + input.size();
+
+      while ((p != pend) && !complete)
+      {
+        if (escape_pending)
+        {
+          // The second byte of an escape sequence.
+          const uint8_t c = *p;
+
+          escape_pending = false;
+
+          if (c == etl::slip::END)
+          {
+            // A frame that ends with ESC is malformed. Leave the END for below.
+            error = true;
+            continue;
+          }
+
+          ++p;
+
+          if (c == etl::slip::ESC_END)
+          {
+            put(etl::slip::END);
+          }
+          else if (c == etl::slip::ESC_ESC)
+          {
+            put(etl::slip::ESC);
+          }
+          else
+          {
+            error = true;
+          }
+        }
+        else
+        {
+          // Copy up to the next special character.
+          const size_t run   = size_t(pend - p);
+          const size_t room  = output.size() - out_index;
+          const size_t limit = (run < room) ? run : room;
+          const size_t count = private_slip::copy_plain(output.data() + out_index, p, limit);
+
+          if (count != 0U)
+          {
+            started    = true;
+            out_index += count;
+            p         += count;
+          }
+
+          if ((count == limit) && (limit < run))
+          {
+            // Out of room. Discard data up to the next special character.
+            const size_t skipped = private_slip::skip_plain(p, size_t(pend - p));
+
+            if (skipped != 0U)
+            {
+              started = true;
+              error   = true;
+              p      += skipped;
+            }
+          }
+
+          if (p != pend)
+          {
+            // Stopped at a special character.
+            if (*p++ == etl::slip::END)
+            {
+              complete = started;
+            }
+            else
+            {
+              started        = true;
+              escape_pending = true;
+            }
+          }
+        }
+      }
+
+      return size_t(p - pbegin);
+    }
+
+    //*************************************************************************
+    /// True if a whole frame has been decoded.
+    //*************************************************************************
+    bool is_complete() const
+    {
+      return complete;
+    }
+
+    //*************************************************************************
+    /// True if the frame was malformed or did not fit in the output buffer.
+    //*************************************************************************
+    bool has_error() const
+    {
+      return error;
+    }
+
+    //*************************************************************************
+    /// The decoded frame.
+    //*************************************************************************
+    etl::span<const uint8_t> frame() const
+    {
+      return etl::span<const uint8_t>(output.data(), out_index);
+    }
+
+    //*************************************************************************
+    /// Starts decoding the next frame into the beginning of the output buffer.
+    //*************************************************************************
+    void next_frame()
+    {
+      out_index      = 0U;
+      escape_pending = false;
+      started        = false;
+      complete       = false;
+      error          = false;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds an unescaped byte.
+    //*************************************************************************
+    void put(uint8_t c)
+    {
+      if (out_index == output.size())
+      {
+        error = true;
+      }
+      else
+      {
+        output[out_index++] = c;
+      }
+    }
+
+    etl::span<uint8_t> output;         ///< The output buffer.
+    size_t             out_index;      ///< The next byte to write.
+    bool               escape_pending; ///< True if the last byte was ESC.
+    bool               started;        ///< True once any data has been seen.
+    bool               complete;       ///< True once the END has been seen.
+    bool               error;          ///< True if the frame is bad.
+  };
+}
+
+#endif
+#endif
@@ -0,0 +1,850 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLOT_MAP_INCLUDED
+#define ETL_SLOT_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "memory.h"
+#include "debug_count.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup slot_map slot_map
+/// A container with the capacity defined at compile time that hands out
+/// generation checked keys for its elements.
+/// The elements are kept densely packed, so iterating over them is a linear
+/// walk of an array. Erasing moves the last element into the hole.
+/// A key stays valid until its element is erased, however the other elements
+/// are moved around. Using a key after its element has been erased is
+/// detected, as the generation in the key no longer matches.
+/// Insert, erase and lookup are O(1).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_exception : public etl::exception
+  {
+  public:
+
+    slot_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_full : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:full", ETL_SLOT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid key exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_invalid_key : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_invalid_key(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:key", ETL_SLOT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The key returned by a slot_map.
+  /// A 32 bit value holding a 16 bit slot index and a 16 bit generation.
+  /// A default constructed key never refers to an element.
+  /// As the generation wraps, a key may be mistaken for a new element after
+  /// its slot has been reused 65536 times.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_key
+  {
+  public:
+
+    enum
+    {
+      INDEX_BITS    = 16U,
+      INDEX_MASK    = 0xFFFFU,
+      INVALID_INDEX = 0xFFFFU
+    };
+
+    //*************************************************************************
+    /// Default constructor. Creates a key that refers to nothing.
+    //*************************************************************************
+    slot_map_key()
+      : key(INVALID_INDEX)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a value previously returned by value().
+    //*************************************************************************
+    explicit slot_map_key(uint32_t value_)
+      : key(value_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a slot index and generation.
+    //*************************************************************************
+    slot_map_key(uint32_t index_, uint32_t generation_)
+      : key((generation_ << INDEX_BITS) | (index_ & uint32_t(INDEX_MASK)))
+    {
+    }
+
+    //*************************************************************************
+    /// The slot index.
+    //*************************************************************************
+    uint32_t index() const
+    {
+      return key & uint32_t(INDEX_MASK);
+    }
+
+    //*************************************************************************
+    /// The generation of the slot when the key was issued.
+    //*************************************************************************
+    uint32_t generation() const
+    {
+      return key >> INDEX_BITS;
+    }
+
+    //*************************************************************************
+    /// The key as a 32 bit value.
+    //*************************************************************************
+    uint32_t value() const
+    {
+      return key;
+    }
+
+    //*************************************************************************
+    friend bool operator ==(const slot_map_key& lhs, const slot_map_key& rhs)
+    {
+      return lhs.key == rhs.key;
+    }
+
+    //*************************************************************************
+    friend bool operator !=(const slot_map_key& lhs, const slot_map_key& rhs)
+    {
+      return lhs.key != rhs.key;
+    }
+
+  private:
+
+    uint32_t key;
+  };
+
+  //***************************************************************************
+  /// The slot bookkeeping for a slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  struct slot_map_slot
+  {
+    /// The index of the element in the dense storage if in use,
+    /// otherwise the next free slot.
+    uint16_t index;
+    uint16_t generation;
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized slot_map.
+  /// Can be used as a reference type for all slot_map containing a specific type.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T>
+  class islot_map
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef T*                iterator;
+    typedef const T*          const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+    typedef etl::slot_map_key key_type;
+
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    /// The elements are in no particular order.
+    //*************************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the first element.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the first element.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to one past the last element.
+    //*************************************************************************
+    iterator end()
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to one past the last element.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to one past the last element.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_buffer + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to one before the first element.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to one before the first element.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the densely packed elements.
+    //*************************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the densely packed elements.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Inserts a copy of value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The key for the new element.
+    //*************************************************************************
+    key_type insert(const_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(value);
+
+      return allocate_slot();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Inserts value by moving it.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The key for the new element.
+    //*************************************************************************
+    key_type insert(rvalue_reference value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(etl::move(value));
+
+      return allocate_slot();
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The key for the new element.
+    //*************************************************************************
+    template <typename ... Args>
+    key_type emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(etl::forward<Args>(args)...);
+
+      return allocate_slot();
+    }
+#else
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The key for the new element.
+    //*************************************************************************
+    template <typename T1>
+    key_type emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(value1);
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    key_type emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(value1, value2);
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    key_type emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(value1, value2, value3);
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    key_type emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(slot_map_full));
+
+      ::new (p_buffer + current_size) T(value1, value2, value3, value4);
+
+      return allocate_slot();
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the element referred to by the key.
+    ///\return 1 if an element was erased, 0 if the key was not valid.
+    //*************************************************************************
+    size_t erase(key_type key)
+    {
+      if (!contains(key))
+      {
+        return 0U;
+      }
+
+      erase_at(p_slots[key.index()].index);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the element at the iterator.
+    /// The last element is moved into its place.
+    ///\return An iterator to the element that replaced the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      size_t index = size_t(position - p_buffer);
+
+      erase_at(index);
+
+      return p_buffer + index;
+    }
+
+    //*************************************************************************
+    /// Erases all of the elements.
+    /// All keys previously issued become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size != 0U)
+      {
+        erase_at(current_size - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks whether the key refers to an element.
+    //*************************************************************************
+    bool contains(key_type key) const
+    {
+      const uint32_t index = key.index();
+
+      return (index < CAPACITY) &&
+             (p_slots[index].generation == key.generation()) &&
+             (p_slots[index].index < current_size) &&
+             (p_element_slots[p_slots[index].index] == index);
+    }
+
+    //*************************************************************************
+    /// Finds the element referred to by the key.
+    ///\return An iterator to the element, or end() if the key is not valid.
+    //*************************************************************************
+    iterator find(key_type key)
+    {
+      return contains(key) ? p_buffer + p_slots[key.index()].index : end();
+    }
+
+    //*************************************************************************
+    /// Finds the element referred to by the key.
+    ///\return A const iterator to the element, or end() if the key is not valid.
+    //*************************************************************************
+    const_iterator find(key_type key) const
+    {
+      return contains(key) ? p_buffer + p_slots[key.index()].index : end();
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element referred to by the key.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_key if the key is not valid.
+    //*************************************************************************
+    reference at(key_type key)
+    {
+      ETL_ASSERT(contains(key), ETL_ERROR(slot_map_invalid_key));
+
+      return p_buffer[p_slots[key.index()].index];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the element referred to by the key.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_key if the key is not valid.
+    //*************************************************************************
+    const_reference at(key_type key) const
+    {
+      ETL_ASSERT(contains(key), ETL_ERROR(slot_map_invalid_key));
+
+      return p_buffer[p_slots[key.index()].index];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element referred to by the key.
+    /// The key is not checked.
+    //*************************************************************************
+    reference operator [](key_type key)
+    {
+      return p_buffer[p_slots[key.index()].index];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the element referred to by the key.
+    /// The key is not checked.
+    //*************************************************************************
+    const_reference operator [](key_type key) const
+    {
+      return p_buffer[p_slots[key.index()].index];
+    }
+
+    //*************************************************************************
+    /// Gets the key for the element at the iterator.
+    //*************************************************************************
+    key_type key_of(const_iterator position) const
+    {
+      const uint16_t slot = p_element_slots[position - p_buffer];
+
+      return key_type(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Gets the current number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the slot_map.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the slot_map.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the slot_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the slot_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    islot_map(T* p_buffer_, etl::slot_map_slot* p_slots_, uint16_t* p_element_slots_, size_t max_size_)
+      : p_buffer(p_buffer_)
+      , p_slots(p_slots_)
+      , p_element_slots(p_element_slots_)
+      , CAPACITY(max_size_)
+      , current_size(0U)
+      , free_head(0U)
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_slots[i].index      = uint16_t(i + 1U);
+        p_slots[i].generation = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the elements and slots of a slot_map of the same capacity,
+    /// so that keys issued by rhs are valid for this slot_map.
+    /// Assumes this slot_map is empty.
+    //*************************************************************************
+    void copy_container(const islot_map& rhs)
+    {
+      for (size_t i = 0U; i < rhs.current_size; ++i)
+      {
+        ::new (p_buffer + i) T(rhs.p_buffer[i]);
+      }
+
+      copy_slots(rhs);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the elements and slots of a slot_map of the same capacity,
+    /// so that keys issued by rhs are valid for this slot_map.
+    /// Assumes this slot_map is empty.
+    //*************************************************************************
+    void move_container(islot_map&& rhs)
+    {
+      for (size_t i = 0U; i < rhs.current_size; ++i)
+      {
+        ::new (p_buffer + i) T(etl::move(rhs.p_buffer[i]));
+      }
+
+      copy_slots(rhs);
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Takes a slot from the free list for the element just constructed at
+    /// the end of the dense storage.
+    //*************************************************************************
+    key_type allocate_slot()
+    {
+      const uint16_t slot = free_head;
+
+      free_head = p_slots[slot].index;
+      p_slots[slot].index = uint16_t(current_size);
+      p_element_slots[current_size] = slot;
+
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return key_type(slot, p_slots[slot].generation);
+    }
+
+    //*************************************************************************
+    /// Erases the element at index by moving the last element into its place,
+    /// then returns its slot to the free list with a new generation.
+    //*************************************************************************
+    void erase_at(size_t index)
+    {
+      const uint16_t slot = p_element_slots[index];
+      const size_t   last = current_size - 1U;
+
+      if (index != last)
+      {
+#if ETL_CPP11_SUPPORTED
+        p_buffer[index] = etl::move(p_buffer[last]);
+#else
+        p_buffer[index] = p_buffer[last];
+#endif
+        p_element_slots[index] = p_element_slots[last];
+        p_slots[p_element_slots[index]].index = uint16_t(index);
+      }
+
+      etl::destroy_at(p_buffer + last);
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT
+
+      p_slots[slot].generation = uint16_t(p_slots[slot].generation + 1U);
+      p_slots[slot].index = free_head;
+      free_head = slot;
+    }
+
+    //*************************************************************************
+    /// Copies the slot bookkeeping from rhs.
+    //*************************************************************************
+    void copy_slots(const islot_map& rhs)
+    {
+      etl::copy(rhs.p_slots, rhs.p_slots + CAPACITY, p_slots);
+      etl::copy(rhs.p_element_slots, rhs.p_element_slots + rhs.current_size, p_element_slots);
+
+      current_size = rhs.current_size;
+      free_head    = rhs.free_head;
+      ETL_ADD_DEBUG_COUNT(current_size)
+    }
+
+    // Disable copy construction.
+    islot_map(const islot_map&);
+
+    T*                  p_buffer;        ///< The densely packed elements.
+    etl::slot_map_slot* p_slots;         ///< The slots that keys refer to.
+    uint16_t*           p_element_slots; ///< The slot for each element.
+
+    const size_t CAPACITY;
+    size_t       current_size;
+    uint16_t     free_head;              ///< The first free slot.
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SLOT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~islot_map()
+    {
+    }
+#else
+  protected:
+    ~islot_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A slot_map with the capacity defined at compile time.
+  ///\tparam T         The element type.
+  ///\tparam MAX_SIZE_ The maximum number of elements. Must be less than 65535.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class slot_map : public etl::islot_map<T>
+  {
+  private:
+
+    typedef etl::islot_map<T> base;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity slot_map is not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ < size_t(etl::slot_map_key::INVALID_INDEX)), "Capacity too large for the key's slot index");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slot_map()
+      : base(reinterpret_cast<T*>(&buffer), slots, element_slots, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Keys issued by other are valid for the copy.
+    //*************************************************************************
+    slot_map(const slot_map& other)
+      : base(reinterpret_cast<T*>(&buffer), slots, element_slots, MAX_SIZE)
+    {
+      this->copy_container(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    /// Keys issued by other are valid for the new slot_map.
+    //*************************************************************************
+    slot_map(slot_map&& other)
+      : base(reinterpret_cast<T*>(&buffer), slots, element_slots, MAX_SIZE)
+    {
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~slot_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// Keys issued by rhs are valid for this slot_map; its own keys are not.
+    //*************************************************************************
+    slot_map& operator = (const slot_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->copy_container(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    /// Keys issued by rhs are valid for this slot_map; its own keys are not.
+    //*************************************************************************
+    slot_map& operator = (slot_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->clear();
+        this->move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The densely packed elements.
+    typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+
+    /// The slots that keys refer to.
+    etl::slot_map_slot slots[MAX_SIZE_];
+
+    /// The slot for each element.
+    uint16_t element_slots[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t slot_map<T, MAX_SIZE_>::MAX_SIZE;
+}
+
+#endif
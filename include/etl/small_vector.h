@@ -0,0 +1,1059 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SMALL_VECTOR_INCLUDED
+#define ETL_SMALL_VECTOR_INCLUDED
+
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "memory.h"
+#include "debug_count.h"
+#include "static_assert.h"
+#include "imemory_block_allocator.h"
+
+//*****************************************************************************
+///\defgroup small_vector small_vector
+/// A vector that holds up to N elements in an internal buffer and, when that
+/// overflows, moves once into a single larger block obtained from an
+/// etl::imemory_block_allocator.
+/// Suits many vectors that are usually small but occasionally large, where
+/// sizing every one for the worst case would waste memory.
+/// The block is kept until the vector is destroyed or shrink_to_fit() is
+/// called, so the vector spills at most once per lifetime of the block.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the small_vector.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_exception : public etl::exception
+  {
+  public:
+
+    small_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the small_vector.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_full : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:full", ETL_SMALL_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the small_vector.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_out_of_bounds : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:bounds", ETL_SMALL_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Allocation failure exception for the small_vector.
+  /// Raised when the allocator cannot supply the spill block.
+  ///\ingroup small_vector
+  //***************************************************************************
+  class small_vector_no_allocation : public etl::small_vector_exception
+  {
+  public:
+
+    small_vector_no_allocation(string_type file_name_, numeric_type line_number_)
+      : etl::small_vector_exception(ETL_ERROR_TEXT("small_vector:allocation", ETL_SMALL_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for small_vector.
+  /// Can be used as a reference type for all small_vectors of the same
+  /// element type.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  class ismall_vector
+  {
+  public:
+
+    typedef T                                             value_type;
+    typedef T&                                            reference;
+    typedef const T&                                      const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef T&&                                           rvalue_reference;
+#endif
+    typedef T*                                            pointer;
+    typedef const T*                                      const_pointer;
+    typedef T*                                            iterator;
+    typedef const T*                                      const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>        reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator>  const_reverse_iterator;
+    typedef size_t                                        size_type;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*************************************************************************
+    iterator begin()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*************************************************************************
+    iterator end()
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_end;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    //*************************************************************************
+    reference operator [](size_t i)
+    {
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::small_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < size(), ETL_ERROR(small_vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return *p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return *(p_end - 1);
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return *(p_end - 1);
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the beginning of the vector data.
+    //*************************************************************************
+    pointer data()
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the beginning of the vector data.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return p_buffer;
+    }
+
+    //*************************************************************************
+    /// Returns the current number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return size_type(p_end - p_buffer);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (p_end == p_buffer);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if no more elements can be added, even by spilling.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == max_size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that can be held without spilling, or
+    /// before running out of room if already spilled.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return current_capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements the internal buffer can hold.
+    //*************************************************************************
+    size_type inline_capacity() const
+    {
+      return INLINE_CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the most elements the vector can ever hold.
+    /// This is the spill capacity if an allocator has been given, otherwise
+    /// the internal capacity.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return ((p_allocator != ETL_NULLPTR) && (SPILL_CAPACITY > INLINE_CAPACITY)) ? SPILL_CAPACITY : INLINE_CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining number of elements that can be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the elements are held in a block from the allocator.
+    //*************************************************************************
+    bool is_spilled() const
+    {
+      return (p_buffer != p_inline);
+    }
+
+    //*************************************************************************
+    /// Makes room for at least 'n' elements, spilling if necessary.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if 'n' is more than max_size().
+    //*************************************************************************
+    void reserve(size_t n)
+    {
+      if (n > current_capacity)
+      {
+        spill(n);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the elements back into the internal buffer and releases the block,
+    /// if they will fit.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if (is_spilled() && (size() <= INLINE_CAPACITY))
+      {
+        T* p_block = p_buffer;
+
+        p_end    = relocate(p_buffer, p_end, p_inline);
+        p_buffer = p_inline;
+        current_capacity = INLINE_CAPACITY;
+
+        p_allocator->release(p_block);
+      }
+    }
+
+    //*************************************************************************
+    /// Resizes the vector.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if 'new_size' is more than max_size().
+    //*************************************************************************
+    void resize(size_t new_size)
+    {
+      resize(new_size, T());
+    }
+
+    //*************************************************************************
+    /// Resizes the vector, filling new elements with 'value'.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if 'new_size' is more than max_size().
+    //*************************************************************************
+    void resize(size_t new_size, const_reference value)
+    {
+      const size_t current_size = size();
+
+      if (new_size > current_size)
+      {
+        const T copy(value);
+
+        reserve(new_size);
+
+        etl::uninitialized_fill_n(p_end, new_size - current_size, copy);
+        ETL_ADD_DEBUG_COUNT(new_size - current_size)
+      }
+      else
+      {
+        etl::destroy(p_buffer + new_size, p_end);
+        ETL_SUBTRACT_DEBUG_COUNT(current_size - new_size)
+      }
+
+      p_end = p_buffer + new_size;
+    }
+
+    //*************************************************************************
+    /// Adds an element to the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        // 'value' may refer to an element, so build the new one before the old ones move.
+        T* p_block = allocate_spill_block(size() + 1U);
+        ::new (p_block + size()) T(value);
+        adopt_spill_block(p_block);
+      }
+      else
+      {
+        ::new (p_end) T(value);
+      }
+
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Adds an element to the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        T* p_block = allocate_spill_block(size() + 1U);
+        ::new (p_block + size()) T(etl::move(value));
+        adopt_spill_block(p_block);
+      }
+      else
+      {
+        ::new (p_end) T(etl::move(value));
+      }
+
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Constructs an element at the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      if (p_end == (p_buffer + current_capacity))
+      {
+        T* p_block = allocate_spill_block(size() + 1U);
+        ::new (p_block + size()) T(etl::forward<Args>(args)...);
+        adopt_spill_block(p_block);
+      }
+      else
+      {
+        ::new (p_end) T(etl::forward<Args>(args)...);
+      }
+
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return back();
+    }
+#else
+    //*************************************************************************
+    /// Constructs an element at the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_back(const T1& value1)
+    {
+      return emplace_back_value(T(value1));
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_back(const T1& value1, const T2& value2)
+    {
+      return emplace_back_value(T(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace_back_value(T(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Constructs an element at the back, spilling if the internal buffer is full.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace_back_value(T(value1, value2, value3, value4));
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the last element.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(small_vector_out_of_bounds));
+#endif
+      --p_end;
+      etl::destroy_at(p_end);
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      const size_t index = size_t(position - p_buffer);
+
+      push_back(value);
+      etl::rotate(p_buffer + index, p_end - 1, p_end);
+
+      return p_buffer + index;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the vector is at max_size().
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      const size_t index = size_t(position - p_buffer);
+
+      push_back(etl::move(value));
+      etl::rotate(p_buffer + index, p_end - 1, p_end);
+
+      return p_buffer + index;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element following the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      iterator i_position = p_buffer + (position - p_buffer);
+
+      etl::move(i_position + 1, p_end, i_position);
+      pop_back();
+
+      return i_position;
+    }
+
+    //*************************************************************************
+    /// Erases the elements in the range [first, last).
+    ///\return An iterator to the element following the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator i_first = p_buffer + (first - p_buffer);
+      iterator i_last  = p_buffer + (last - p_buffer);
+
+      if (i_first != i_last)
+      {
+        iterator i_new_end = etl::move(i_last, p_end, i_first);
+        const size_t n = size_t(p_end - i_new_end);
+
+        etl::destroy(i_new_end, p_end);
+        ETL_SUBTRACT_DEBUG_COUNT(n)
+        p_end = i_new_end;
+      }
+
+      return i_first;
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with the range [first, last).
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if the range is larger than max_size().
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with 'n' copies of 'value'.
+    /// If asserts or exceptions are enabled, emits etl::small_vector_full if 'n' is larger than max_size().
+    //*************************************************************************
+    void assign(size_t n, const_reference value)
+    {
+      clear();
+      resize(n, value);
+    }
+
+    //*************************************************************************
+    /// Destroys all of the elements.
+    /// A spill block is kept; use shrink_to_fit() to release it.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_buffer, p_end);
+      ETL_RESET_DEBUG_COUNT
+      p_end = p_buffer;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The allocator and spill capacity are not changed.
+    //*************************************************************************
+    ismall_vector& operator = (const ismall_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    /// Takes the spill block from rhs if they share an allocator.
+    //*************************************************************************
+    ismall_vector& operator = (ismall_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        release_spill_block();
+        move_container(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ismall_vector(T* p_inline_, size_t inline_capacity_, etl::imemory_block_allocator* p_allocator_, size_t spill_capacity_)
+      : p_buffer(p_inline_)
+      , p_end(p_inline_)
+      , current_capacity(inline_capacity_)
+      , p_inline(p_inline_)
+      , INLINE_CAPACITY(inline_capacity_)
+      , p_allocator(p_allocator_)
+      , SPILL_CAPACITY(spill_capacity_)
+    {
+    }
+
+    //*************************************************************************
+    /// Gives a spill block back to the allocator.
+    /// The vector must be empty.
+    //*************************************************************************
+    void release_spill_block()
+    {
+      if (is_spilled())
+      {
+        p_allocator->release(p_buffer);
+        p_buffer = p_inline;
+        p_end    = p_inline;
+        current_capacity = INLINE_CAPACITY;
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the contents of 'other' to this empty, unspilled vector.
+    /// A spill block is taken over if both use the same allocator and spill
+    /// capacity, otherwise the elements are moved one by one.
+    //*************************************************************************
+    void move_container(ismall_vector& other)
+    {
+      if (other.is_spilled() && (other.p_allocator == p_allocator) && (other.SPILL_CAPACITY == SPILL_CAPACITY))
+      {
+        p_buffer         = other.p_buffer;
+        p_end            = other.p_end;
+        current_capacity = other.current_capacity;
+        ETL_ADD_DEBUG_COUNT(other.size())
+
+        other.p_buffer         = other.p_inline;
+        other.p_end            = other.p_inline;
+        other.current_capacity = other.INLINE_CAPACITY;
+        ETL_OBJECT_RESET_DEBUG_COUNT(other)
+      }
+      else
+      {
+        reserve(other.size());
+
+        p_end = relocate(other.p_buffer, other.p_end, p_buffer);
+        ETL_ADD_DEBUG_COUNT(other.size())
+
+        other.p_end = other.p_buffer;
+        ETL_OBJECT_RESET_DEBUG_COUNT(other)
+        other.release_spill_block();
+      }
+    }
+#endif
+
+    etl::imemory_block_allocator* get_allocator() const
+    {
+      return p_allocator;
+    }
+
+    size_type get_spill_capacity() const
+    {
+      return SPILL_CAPACITY;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves the elements in [first, last) to the uninitialised memory at
+    /// 'destination' and destroys the originals.
+    //*************************************************************************
+    static T* relocate(T* first, T* last, T* destination)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        const size_t n = size_t(last - first);
+        memcpy(static_cast<void*>(destination), static_cast<const void*>(first), n * sizeof(T));
+        return destination + n;
+      }
+      else
+      {
+#if ETL_CPP11_SUPPORTED
+        T* result = etl::uninitialized_move(first, last, destination);
+#else
+        T* result = etl::uninitialized_copy(first, last, destination);
+#endif
+        etl::destroy(first, last);
+        return result;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets a spill block able to hold at least 'n' elements.
+    //*************************************************************************
+    T* allocate_spill_block(size_t n)
+    {
+      (void)n;
+
+      ETL_ASSERT((n <= max_size()) && !is_spilled(), ETL_ERROR(small_vector_full));
+
+      void* p_block = p_allocator->allocate(SPILL_CAPACITY * sizeof(T), etl::alignment_of<T>::value);
+
+      ETL_ASSERT(p_block != ETL_NULLPTR, ETL_ERROR(small_vector_no_allocation));
+
+      return static_cast<T*>(p_block);
+    }
+
+    //*************************************************************************
+    /// Moves the elements to the spill block and starts using it.
+    //*************************************************************************
+    void adopt_spill_block(T* p_block)
+    {
+      p_end    = relocate(p_buffer, p_end, p_block);
+      p_buffer = p_block;
+      current_capacity = SPILL_CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Moves the elements to a spill block able to hold 'n' elements.
+    //*************************************************************************
+    void spill(size_t n)
+    {
+      adopt_spill_block(allocate_spill_block(n));
+    }
+
+#if !(ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT)
+    //*************************************************************************
+    /// Adds a constructed element for the C++03 emplace_back.
+    //*************************************************************************
+    reference emplace_back_value(const_reference value)
+    {
+      push_back(value);
+      return back();
+    }
+#endif
+
+    // Disable copy construction.
+    ismall_vector(const ismall_vector&);
+
+    T*         p_buffer;          ///< The internal buffer or the spill block.
+    T*         p_end;             ///< One past the last element.
+    size_type  current_capacity;  ///< The capacity of the buffer in use.
+    T* const   p_inline;          ///< The internal buffer.
+    const size_type INLINE_CAPACITY;  ///< The capacity of the internal buffer.
+    etl::imemory_block_allocator* p_allocator; ///< Supplies the spill block.
+    const size_type SPILL_CAPACITY;   ///< The capacity of the spill block.
+
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SMALL_VECTOR) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ismall_vector()
+    {
+    }
+#else
+  protected:
+    ~ismall_vector()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A small_vector with N elements held internally.
+  ///\tparam T  The element type.
+  ///\tparam N  The number of elements held without spilling.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T, const size_t N>
+  class small_vector : public etl::ismall_vector<T>
+  {
+  private:
+
+    typedef etl::ismall_vector<T> base;
+
+  public:
+
+    ETL_STATIC_ASSERT((N > 0U), "Zero capacity small_vector is not valid");
+
+    static ETL_CONSTANT size_t INLINE_SIZE = N;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Without an allocator the vector can never hold more than N elements.
+    //*************************************************************************
+    small_vector()
+      : base(reinterpret_cast<T*>(&buffer), N, ETL_NULLPTR, 0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param allocator      Supplies the block used once N is exceeded.
+    ///\param spill_capacity The number of elements the block holds.
+    //*************************************************************************
+    small_vector(etl::imemory_block_allocator& allocator, size_t spill_capacity)
+      : base(reinterpret_cast<T*>(&buffer), N, &allocator, spill_capacity)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same allocator and spill capacity as 'other'.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : base(reinterpret_cast<T*>(&buffer), N, other.get_allocator(), other.get_spill_capacity())
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    /// Uses the same allocator and spill capacity as 'other', and takes over
+    /// its spill block.
+    //*************************************************************************
+    small_vector(small_vector&& other)
+      : base(reinterpret_cast<T*>(&buffer), N, other.get_allocator(), other.get_spill_capacity())
+    {
+      this->move_container(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~small_vector()
+    {
+      this->clear();
+      this->release_spill_block();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    /// The allocator and spill capacity are not changed.
+    //*************************************************************************
+    small_vector& operator = (const small_vector& rhs)
+    {
+      base::operator = (rhs);
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    small_vector& operator = (small_vector&& rhs)
+    {
+      base::operator = (etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The internal buffer.
+    typename etl::aligned_storage<sizeof(T) * N, etl::alignment_of<T>::value>::type buffer;
+  };
+
+  template <typename T, const size_t N>
+  ETL_CONSTANT size_t small_vector<T, N>::INLINE_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator <(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator >(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator <=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T>
+  bool operator >=(const etl::ismall_vector<T>& lhs, const etl::ismall_vector<T>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
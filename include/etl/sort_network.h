@@ -0,0 +1,255 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SORT_NETWORK_INCLUDED
+#define ETL_SORT_NETWORK_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "array.h"
+#include "functional.h"
+#include "iterator.h"
+#include "static_assert.h"
+
+//*****************************************************************************
+///\defgroup sort_network sort_network
+/// Sorts a small fixed number of elements with a sorting network.
+/// The compare and exchange steps are generated at compile time from
+/// Batcher's odd-even merge sort, so the sort is straight line code with no
+/// loops, and the exchanges are written as selects that a compiler can turn
+/// into conditional moves for arithmetic types.
+/// Up to 8 elements the networks are the optimal size. Above that they use
+/// a few more steps than the best known networks, e.g. 63 rather than 60 for 16.
+/// Not a stable sort.
+///\ingroup algorithm
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_sort_network
+  {
+    //*************************************************************************
+    /// Orders two elements.
+    //*************************************************************************
+    template <size_t VFirst, size_t VSecond, typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void compare_exchange(TIterator first, TCompare& compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      const value_type a = first[VFirst];
+      const value_type b = first[VSecond];
+
+      const bool exchange = compare(b, a);
+
+      first[VFirst]  = exchange ? b : a;
+      first[VSecond] = exchange ? a : b;
+    }
+
+    // The loops of Batcher's odd-even merge sort, for any size.
+    // for (p = 1; p < N; p += p)
+    //   for (k = p; k >= 1; k /= 2)
+    //     for (j = k % p; j + k < N; j += 2k)
+    //       for (i = 0; i < min(k, N - j - k); ++i)
+    //         if ((i + j) / 2p == (i + j + k) / 2p)
+    //           compare_exchange(i + j, i + j + k)
+
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, size_t J, size_t I, size_t IEnd, bool VRun = (I < IEnd)>
+    struct loop_i
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator first, TCompare& compare)
+      {
+        if (((I + J) / (2U * P)) == ((I + J + K) / (2U * P)))
+        {
+          compare_exchange<I + J, I + J + K>(first, compare);
+        }
+
+        loop_i<N, P, K, J, I + 1U, IEnd>::run(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K, size_t J, size_t I, size_t IEnd>
+    struct loop_i<N, P, K, J, I, IEnd, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator, TCompare&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, size_t J, bool VRun = ((J + K) < N)>
+    struct loop_j
+    {
+      static ETL_CONSTANT size_t IEnd = ((N - J - K) < K) ? (N - J - K) : K;
+
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator first, TCompare& compare)
+      {
+        loop_i<N, P, K, J, 0U, IEnd>::run(first, compare);
+        loop_j<N, P, K, J + (2U * K)>::run(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K, size_t J>
+    struct loop_j<N, P, K, J, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator, TCompare&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, size_t K, bool VRun = (K >= 1U)>
+    struct loop_k
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator first, TCompare& compare)
+      {
+        loop_j<N, P, K, K % P>::run(first, compare);
+        loop_k<N, P, K / 2U>::run(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P, size_t K>
+    struct loop_k<N, P, K, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator, TCompare&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    template <size_t N, size_t P, bool VRun = (P < N)>
+    struct loop_p
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator first, TCompare& compare)
+      {
+        loop_k<N, P, P>::run(first, compare);
+        loop_p<N, P * 2U>::run(first, compare);
+      }
+    };
+
+    template <size_t N, size_t P>
+    struct loop_p<N, P, false>
+    {
+      template <typename TIterator, typename TCompare>
+      static ETL_CONSTEXPR14 void run(TIterator, TCompare&)
+      {
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// Sorts N elements with a sorting network.
+  ///\param first   An iterator to the first of the N elements.
+  ///\param compare The comparison.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator, typename TCompare>
+  ETL_CONSTEXPR14 void sort_network(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(N <= 32U, "sort_network is for up to 32 elements");
+
+    private_sort_network::loop_p<N, 1U>::run(first, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts N elements with a sorting network.
+  ///\param first An iterator to the first of the N elements.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  ETL_CONSTEXPR14 void sort_network(TIterator first)
+  {
+    etl::sort_network<N>(first, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts an array with a sorting network.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <typename T, size_t N, typename TCompare>
+  ETL_CONSTEXPR14 void sort_network(etl::array<T, N>& values, TCompare compare)
+  {
+    etl::sort_network<N>(values.begin(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts an array with a sorting network.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <typename T, size_t N>
+  ETL_CONSTEXPR14 void sort_network(etl::array<T, N>& values)
+  {
+    etl::sort_network<N>(values.begin(), etl::less<T>());
+  }
+
+  //***************************************************************************
+  /// Returns the median of N values, using a sorting network on a copy.
+  /// For an even N, returns the lower of the two middle values.
+  ///\param first An iterator to the first of the N values.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <size_t N, typename TIterator>
+  ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::value_type median(TIterator first)
+  {
+    ETL_STATIC_ASSERT(N > 0U, "median of no values");
+
+    etl::array<typename etl::iterator_traits<TIterator>::value_type, N> values = {};
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      values[i] = *first++;
+    }
+
+    etl::sort_network(values);
+
+    return values[(N - 1U) / 2U];
+  }
+
+  //***************************************************************************
+  /// Returns the median of the values in an array, using a sorting network on a copy.
+  /// For an even N, returns the lower of the two middle values.
+  ///\ingroup sort_network
+  //***************************************************************************
+  template <typename T, size_t N>
+  ETL_CONSTEXPR14 T median(const etl::array<T, N>& samples)
+  {
+    return etl::median<N>(samples.begin());
+  }
+}
+
+#endif
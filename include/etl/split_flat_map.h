@@ -0,0 +1,1567 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPLIT_FLAT_MAP_INCLUDED
+#define ETL_SPLIT_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "debug_count.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup split_flat_map split_flat_map
+/// A flat_map with the capacity defined at compile time, that stores the keys
+/// by value in one array and the mapped values in a parallel array.
+/// A search only touches the densely packed keys, and the final steps are a
+/// branchless count that compilers can vectorise for small integral keys.
+/// Has insertion of O(N) and find of O(logN).
+/// As the key and mapped value are not stored together, the iterators
+/// dereference to a proxy holding references to both.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the split_flat_map.
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  class split_flat_map_exception : public etl::exception
+  {
+  public:
+
+    split_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the split_flat_map.
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  class split_flat_map_full : public etl::split_flat_map_exception
+  {
+  public:
+
+    split_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::split_flat_map_exception(ETL_ERROR_TEXT("split_flat_map:full", ETL_SPLIT_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the split_flat_map.
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  class split_flat_map_out_of_range : public etl::split_flat_map_exception
+  {
+  public:
+
+    split_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::split_flat_map_exception(ETL_ERROR_TEXT("split_flat_map:range", ETL_SPLIT_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized split_flat_map.
+  /// Can be used as a reference type for all split_flat_map containing a specific type.
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class isplit_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<TKey, TMapped> value_type;
+    typedef TKey              key_type;
+    typedef TMapped           mapped_type;
+    typedef TKeyCompare       key_compare;
+    typedef const value_type& const_reference;
+#if ETL_CPP11_SUPPORTED
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*************************************************************************
+    /// What an iterator dereferences to.
+    /// Refers to a key and its mapped value.
+    //*************************************************************************
+    template <typename TMappedReference>
+    class element_reference
+    {
+    public:
+
+      element_reference(const key_type& first_, TMappedReference second_)
+        : first(first_),
+          second(second_)
+      {
+      }
+
+      /// Allows 'iterator->first'.
+      const element_reference* operator ->() const
+      {
+        return this;
+      }
+
+      /// Converts to a copy of the element.
+      operator value_type() const
+      {
+        return value_type(first, second);
+      }
+
+      friend bool operator ==(const element_reference& lhs, const element_reference& rhs)
+      {
+        return (lhs.first == rhs.first) && (lhs.second == rhs.second);
+      }
+
+      friend bool operator !=(const element_reference& lhs, const element_reference& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      const key_type&  first;
+      TMappedReference second;
+
+    private:
+
+      element_reference& operator =(const element_reference&);
+    };
+
+    typedef element_reference<mapped_type&>       reference;
+    typedef element_reference<const mapped_type&> const_element_reference;
+
+    class const_iterator;
+
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, ptrdiff_t, reference, reference>
+    {
+    public:
+
+      friend class isplit_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : pkeys(ETL_NULLPTR),
+          pvalues(ETL_NULLPTR)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        ++pkeys;
+        ++pvalues;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --pkeys;
+        --pvalues;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        operator--();
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        pkeys   += n;
+        pvalues += n;
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        pkeys   -= n;
+        pvalues -= n;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return reference(*pkeys, *pvalues);
+      }
+
+      reference operator ->() const
+      {
+        return reference(*pkeys, *pvalues);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return reference(pkeys[n], pvalues[n]);
+      }
+
+      friend iterator operator +(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(difference_type n, const iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend iterator operator -(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkeys - rhs.pkeys;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkeys == rhs.pkeys;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pkeys < rhs.pkeys;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      iterator(const key_type* pkeys_, mapped_type* pvalues_)
+        : pkeys(pkeys_),
+          pvalues(pvalues_)
+      {
+      }
+
+      const key_type* pkeys;
+      mapped_type*    pvalues;
+    };
+
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, ptrdiff_t, const_element_reference, const_element_reference>
+    {
+    public:
+
+      friend class isplit_flat_map;
+
+      const_iterator()
+        : pkeys(ETL_NULLPTR),
+          pvalues(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename isplit_flat_map::iterator& other)
+        : pkeys(other.pkeys),
+          pvalues(other.pvalues)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        ++pkeys;
+        ++pvalues;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --pkeys;
+        --pvalues;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        operator--();
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        pkeys   += n;
+        pvalues += n;
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        pkeys   -= n;
+        pvalues -= n;
+        return *this;
+      }
+
+      const_element_reference operator *() const
+      {
+        return const_element_reference(*pkeys, *pvalues);
+      }
+
+      const_element_reference operator ->() const
+      {
+        return const_element_reference(*pkeys, *pvalues);
+      }
+
+      const_element_reference operator [](difference_type n) const
+      {
+        return const_element_reference(pkeys[n], pvalues[n]);
+      }
+
+      friend const_iterator operator +(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend const_iterator operator +(difference_type n, const const_iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend const_iterator operator -(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkeys - rhs.pkeys;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkeys == rhs.pkeys;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pkeys < rhs.pkeys;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      const_iterator(const key_type* pkeys_, const mapped_type* pvalues_)
+        : pkeys(pkeys_),
+          pvalues(pvalues_)
+      {
+      }
+
+      const key_type*    pkeys;
+      const mapped_type* pvalues;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the split_flat_map.
+    ///\return An iterator to the beginning of the split_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(pkeys, pvalues);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the split_flat_map.
+    ///\return A const iterator to the beginning of the split_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(pkeys, pvalues);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the split_flat_map.
+    ///\return An iterator to the end of the split_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pkeys + current_size, pvalues + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the split_flat_map.
+    ///\return A const iterator to the end of the split_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pkeys + current_size, pvalues + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the split_flat_map.
+    ///\return A const iterator to the beginning of the split_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the split_flat_map.
+    ///\return A const iterator to the end of the split_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the split_flat_map.
+    ///\return Iterator to the reverse beginning of the split_flat_map.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the split_flat_map.
+    ///\return Const iterator to the reverse beginning of the split_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the split_flat_map.
+    ///\return Reverse iterator to the end + 1 of the split_flat_map.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the split_flat_map.
+    ///\return Const reverse iterator to the end + 1 of the split_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the split_flat_map.
+    ///\return Const reverse iterator to the reverse beginning of the split_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return rbegin();
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the split_flat_map.
+    ///\return Const reverse iterator to the end + 1 of the split_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return rend();
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the key is new and the split_flat_map is full.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      if (!found(index, key))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(split_flat_map_full));
+
+        open_slot(index, key);
+        ::new (pvalues + index) mapped_type();
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+
+      return pvalues[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits split_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      ETL_ASSERT(found(index, key), ETL_ERROR(split_flat_map_out_of_range));
+
+      return pvalues[index];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits split_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const size_t index = lower_index(key);
+
+      ETL_ASSERT(found(index, key), ETL_ERROR(split_flat_map_out_of_range));
+
+      return pvalues[index];
+    }
+
+    //*********************************************************************
+    /// Assigns values to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      const size_t index = lower_index(value.first);
+
+      if (found(index, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(split_flat_map_full));
+
+      open_slot(index, value.first);
+      ::new (pvalues + index) mapped_type(value.second);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), true);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      const size_t index = lower_index(value.first);
+
+      if (found(index, value.first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(split_flat_map_full));
+
+      open_slot(index, value.first);
+      ::new (pvalues + index) mapped_type(etl::move(value.second));
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Moves a value to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the split_flat_map.
+    /// If asserts or exceptions are enabled, emits split_flat_map_full if the split_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is only constructed if the key is new.
+    //*************************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, Args && ... args)
+    {
+      const size_t index = lower_index(key);
+
+      if (found(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(split_flat_map_full));
+
+      open_slot(index, key);
+      ::new (pvalues + index) mapped_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), true);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is only constructed if the key is new.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const key_type& key, const T1& value1)
+    {
+      const size_t index = lower_index(key);
+
+      if (found(index, key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(split_flat_map_full));
+
+      open_slot(index, key);
+      ::new (pvalues + index) mapped_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return ETL_OR_STD::pair<iterator, bool>(to_iterator(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      if (!found(index, key))
+      {
+        return 0U;
+      }
+
+      close_slots(index, 1U);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    //*********************************************************************
+    void erase(iterator i_element)
+    {
+      close_slots(size_t(i_element.pkeys - pkeys), 1U);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    void erase(iterator first, iterator last)
+    {
+      close_slots(size_t(first.pkeys - pkeys), size_t(last - first));
+    }
+
+    //*************************************************************************
+    /// Clears the split_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      close_slots(0U, current_size);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t index = lower_index(key);
+
+      return found(index, key) ? to_iterator(index) : end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      const size_t index = lower_index(key);
+
+      return found(index, key) ? to_iterator(index) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return A const_iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t index = lower_index(key);
+
+      return found(index, key) ? to_iterator(index) : end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return A const_iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      const size_t index = lower_index(key);
+
+      return found(index, key) ? to_iterator(index) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return found(lower_index(key), key) ? 1U : 0U;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return found(lower_index(key), key) ? 1U : 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the split_flat_map contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return found(lower_index(key), key);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the split_flat_map contains an element with the key.
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return found(lower_index(key), key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return to_iterator(lower_index(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator lower_bound(const K& key)
+    {
+      return to_iterator(lower_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return to_iterator(lower_index(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return to_iterator(lower_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return to_iterator(upper_index(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    iterator upper_bound(const K& key)
+    {
+      return to_iterator(upper_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return to_iterator(upper_index(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return to_iterator(upper_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    /// Only available if the key comparator is transparent.
+    ///\param key The key to search for.
+    ///\return A const_iterator pair.
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, typename etl::enable_if<etl::comparator_is_transparent<KC>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isplit_flat_map& operator = (const isplit_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    isplit_flat_map& operator = (isplit_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the split_flat_map.
+    ///\return The current size of the split_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the split_flat_map.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the split_flat_map.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the split_flat_map.
+    ///\return The capacity of the split_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the split_flat_map.
+    ///\return The maximum size of the split_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// The keys, in order, as a contiguous array of size().
+    //*************************************************************************
+    const key_type* keys() const
+    {
+      return pkeys;
+    }
+
+    //*************************************************************************
+    /// The mapped values, in key order, as a contiguous array of size().
+    //*************************************************************************
+    mapped_type* values()
+    {
+      return pvalues;
+    }
+
+    //*************************************************************************
+    /// The mapped values, in key order, as a contiguous array of size().
+    //*************************************************************************
+    const mapped_type* values() const
+    {
+      return pvalues;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    isplit_flat_map(key_type* pkeys_, mapped_type* pvalues_, size_t max_size_)
+      : pkeys(pkeys_),
+        pvalues(pvalues_),
+        maximum_size(max_size_),
+        current_size(0U)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move a split_flat_map.
+    /// Assumes the split_flat_map is initialised and empty.
+    //*************************************************************************
+    void move_container(isplit_flat_map&& rhs)
+    {
+      clear();
+
+      for (size_t i = 0U; i < rhs.current_size; ++i)
+      {
+        ::new (pkeys + i) key_type(etl::move(rhs.pkeys[i]));
+        ::new (pvalues + i) mapped_type(etl::move(rhs.pvalues[i]));
+      }
+
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size)
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    /// Below this many keys, searching continues as a branchless count.
+    static ETL_CONSTANT size_t Linear_Search_Size = 16U;
+
+    //*********************************************************************
+    iterator to_iterator(size_t index)
+    {
+      return iterator(pkeys + index, pvalues + index);
+    }
+
+    //*********************************************************************
+    const_iterator to_iterator(size_t index) const
+    {
+      return const_iterator(pkeys + index, pvalues + index);
+    }
+
+    //*********************************************************************
+    /// Is the key at the index equal to the key?
+    //*********************************************************************
+    template <typename K>
+    bool found(size_t index, const K& key) const
+    {
+      return (index != current_size) && !compare(key, pkeys[index]);
+    }
+
+    //*********************************************************************
+    /// The index of the first key not less than the key.
+    //*********************************************************************
+    template <typename K>
+    size_t lower_index(const K& key) const
+    {
+      const key_type* first = pkeys;
+      size_t n = current_size;
+
+      // Halve the range without branching on the result.
+      while (n > Linear_Search_Size)
+      {
+        const size_t half = n / 2U;
+        first = compare(first[half], key) ? first + half : first;
+        n -= half;
+      }
+
+      // Count the remaining keys that are less.
+      size_t less = 0U;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        less += compare(first[i], key) ? 1U : 0U;
+      }
+
+      return size_t(first - pkeys) + less;
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than the key.
+    //*********************************************************************
+    template <typename K>
+    size_t upper_index(const K& key) const
+    {
+      const key_type* first = pkeys;
+      size_t n = current_size;
+
+      while (n > Linear_Search_Size)
+      {
+        const size_t half = n / 2U;
+        first = compare(key, first[half]) ? first : first + half;
+        n -= half;
+      }
+
+      size_t not_greater = 0U;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        not_greater += compare(key, first[i]) ? 0U : 1U;
+      }
+
+      return size_t(first - pkeys) + not_greater;
+    }
+
+    //*********************************************************************
+    /// Makes room at the index, and constructs the key there.
+    /// The mapped value at the index is left unconstructed.
+    //*********************************************************************
+    template <typename K>
+    void open_slot(size_t index, const K& key)
+    {
+      if (index == current_size)
+      {
+        ::new (pkeys + index) key_type(key);
+      }
+      else
+      {
+        const size_t last = current_size - 1U;
+
+#if ETL_CPP11_SUPPORTED
+        ::new (pkeys + current_size) key_type(etl::move(pkeys[last]));
+        ::new (pvalues + current_size) mapped_type(etl::move(pvalues[last]));
+#else
+        ::new (pkeys + current_size) key_type(pkeys[last]);
+        ::new (pvalues + current_size) mapped_type(pvalues[last]);
+#endif
+        etl::move_backward(pkeys + index, pkeys + last, pkeys + current_size);
+        etl::move_backward(pvalues + index, pvalues + last, pvalues + current_size);
+
+        pkeys[index] = key;
+        pvalues[index].~mapped_type();
+      }
+
+      ++current_size;
+    }
+
+    //*********************************************************************
+    /// Removes a number of elements from the index.
+    //*********************************************************************
+    void close_slots(size_t index, size_t n)
+    {
+      etl::move(pkeys + index + n, pkeys + current_size, pkeys + index);
+      etl::move(pvalues + index + n, pvalues + current_size, pvalues + index);
+
+      for (size_t i = current_size - n; i < current_size; ++i)
+      {
+        pkeys[i].~key_type();
+        pvalues[i].~mapped_type();
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+
+      current_size -= n;
+    }
+
+    // Disable copy construction.
+    isplit_flat_map(const isplit_flat_map&);
+
+    key_type*    pkeys;
+    mapped_type* pvalues;
+    key_compare  compare;
+
+    const size_t maximum_size;
+    size_t       current_size;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SPLIT_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~isplit_flat_map()
+    {
+    }
+#else
+  protected:
+    ~isplit_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first split_flat_map.
+  ///\param rhs Reference to the second split_flat_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::isplit_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::isplit_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first split_flat_map.
+  ///\param rhs Reference to the second split_flat_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::isplit_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::isplit_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A split_flat_map implementation that uses a fixed size buffer.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The value type.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\ingroup split_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class split_flat_map : public etl::isplit_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::isplit_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    split_flat_map()
+      : base(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    split_flat_map(const split_flat_map& other)
+      : base(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    split_flat_map(split_flat_map&& other)
+      : base(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      if (&other != this)
+      {
+        this->move_container(etl::move(other));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    split_flat_map(TIterator first, TIterator last)
+      : base(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    split_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(reinterpret_cast<TKey*>(&keys_buffer), reinterpret_cast<TValue*>(&values_buffer), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~split_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    split_flat_map& operator = (const split_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    split_flat_map& operator = (split_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The keys.
+    typename etl::aligned_storage<sizeof(TKey) * MAX_SIZE_, etl::alignment_of<TKey>::value>::type keys_buffer;
+
+    /// The mapped values.
+    typename etl::aligned_storage<sizeof(TValue) * MAX_SIZE_, etl::alignment_of<TValue>::value>::type values_buffer;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t split_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  split_flat_map(T, Ts...)
+    ->split_flat_map<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), typename T::first_type>,
+                     typename T::second_type,
+                     1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
@@ -36,6 +36,7 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "static_assert.h"
 
 namespace etl
 {
@@ -75,6 +76,283 @@ namespace etl
     state_id_t current_state_id; ///< The current state id.
   };
 
+  //***************************************************************************
+  /// The interface for a state chart index.
+  /// Maps each [state][event] pair directly to its candidate transitions, so
+  /// that a state_chart does not have to search its tables for every event.
+  /// State and event ids must be in the ranges 0 to max_states() - 1 and
+  /// 0 to max_events() - 1.
+  //***************************************************************************
+  class istate_chart_index
+  {
+  public:
+
+    typedef uint16_t index_t;
+
+    static ETL_CONSTANT index_t No_Index = UINT16_MAX;
+
+    //*************************************************************************
+    /// The maximum number of state ids.
+    //*************************************************************************
+    size_t max_states() const
+    {
+      return Max_States;
+    }
+
+    //*************************************************************************
+    /// The maximum number of event ids.
+    //*************************************************************************
+    size_t max_events() const
+    {
+      return Max_Events;
+    }
+
+    //*************************************************************************
+    /// The maximum number of transitions.
+    //*************************************************************************
+    size_t max_transitions() const
+    {
+      return Max_Transitions;
+    }
+
+    //*************************************************************************
+    /// Clears the index.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < (Max_States * Max_Events); ++i)
+      {
+        p_first[i] = No_Index;
+      }
+
+      for (size_t i = 0U; i < Max_Transitions; ++i)
+      {
+        p_next[i] = No_Index;
+      }
+
+      for (size_t i = 0U; i < Max_States; ++i)
+      {
+        p_state[i] = No_Index;
+      }
+    }
+
+    //*************************************************************************
+    /// The index of the first candidate transition for the state and event.
+    //*************************************************************************
+    index_t first(istate_chart::state_id_t state_id, istate_chart::event_id_t event_id) const
+    {
+      if (is_valid_state(state_id) && is_valid_event(event_id))
+      {
+        return p_first[(size_t(state_id) * Max_Events) + size_t(event_id)];
+      }
+
+      return No_Index;
+    }
+
+    //*************************************************************************
+    /// The index of the next candidate transition after the one at index.
+    /// Transitions from any state are chained to every later transition for
+    /// the same event; the caller must check the state.
+    //*************************************************************************
+    index_t next(index_t index) const
+    {
+      return p_next[index];
+    }
+
+    //*************************************************************************
+    /// The index of the state table entry for the state id.
+    //*************************************************************************
+    index_t state(istate_chart::state_id_t state_id) const
+    {
+      return is_valid_state(state_id) ? p_state[state_id] : No_Index;
+    }
+
+    //*************************************************************************
+    /// Sets the first candidate transition for the state and event.
+    //*************************************************************************
+    void set_first(istate_chart::state_id_t state_id, istate_chart::event_id_t event_id, index_t index)
+    {
+      p_first[(size_t(state_id) * Max_Events) + size_t(event_id)] = index;
+    }
+
+    //*************************************************************************
+    /// Sets the candidate transition that follows the one at index.
+    //*************************************************************************
+    void set_next(index_t index, index_t next_index)
+    {
+      p_next[index] = next_index;
+    }
+
+    //*************************************************************************
+    /// Sets the state table entry for the state id.
+    //*************************************************************************
+    void set_state(istate_chart::state_id_t state_id, index_t index)
+    {
+      p_state[state_id] = index;
+    }
+
+    //*************************************************************************
+    /// Is the state id in range?
+    //*************************************************************************
+    bool is_valid_state(istate_chart::state_id_t state_id) const
+    {
+      return (state_id >= 0) && (size_t(state_id) < Max_States);
+    }
+
+    //*************************************************************************
+    /// Is the event id in range?
+    //*************************************************************************
+    bool is_valid_event(istate_chart::event_id_t event_id) const
+    {
+      return (event_id >= 0) && (size_t(event_id) < Max_Events);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    istate_chart_index(index_t* p_first_, index_t* p_next_, index_t* p_state_,
+                       size_t max_states_, size_t max_events_, size_t max_transitions_)
+      : p_first(p_first_),
+        p_next(p_next_),
+        p_state(p_state_),
+        Max_States(max_states_),
+        Max_Events(max_events_),
+        Max_Transitions(max_transitions_)
+    {
+    }
+
+  private:
+
+    index_t*     p_first; ///< The first candidate transition for each [state][event].
+    index_t*     p_next;  ///< The next candidate transition for each transition.
+    index_t*     p_state; ///< The state table entry for each state id.
+    const size_t Max_States;
+    const size_t Max_Events;
+    const size_t Max_Transitions;
+  };
+
+  //***************************************************************************
+  /// A state chart index with storage for the specified number of state ids,
+  /// event ids and transitions.
+  /// Pass to state_chart::set_index().
+  //***************************************************************************
+  template <size_t VMaxStates, size_t VMaxEvents, size_t VMaxTransitions>
+  class state_chart_index : public istate_chart_index
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VMaxStates > 0U) && (VMaxEvents > 0U) && (VMaxTransitions > 0U), "Zero sized index");
+    ETL_STATIC_ASSERT((VMaxStates < UINT16_MAX) && (VMaxTransitions < UINT16_MAX), "Index too large");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    state_chart_index()
+      : istate_chart_index(first_buffer, next_buffer, state_buffer, VMaxStates, VMaxEvents, VMaxTransitions)
+    {
+      clear();
+    }
+
+  private:
+
+    index_t first_buffer[VMaxStates * VMaxEvents];
+    index_t next_buffer[VMaxTransitions];
+    index_t state_buffer[VMaxStates];
+  };
+
+  namespace private_state_chart
+  {
+    //*************************************************************************
+    /// Builds the index for the transition and state tables.
+    /// Returns false if the tables do not fit the index.
+    //*************************************************************************
+    template <typename TTransition, typename TState>
+    bool build_index(etl::istate_chart_index&                index,
+                     const etl::array_view<const TTransition>& transition_table,
+                     const etl::array_view<const TState>&      state_table,
+                     istate_chart::state_id_t                  initial_state_id)
+    {
+      typedef etl::istate_chart_index::index_t index_t;
+
+      index.clear();
+
+      if ((transition_table.size() > index.max_transitions()) ||
+          (state_table.size() >= etl::istate_chart_index::No_Index) ||
+          !index.is_valid_state(initial_state_id))
+      {
+        return false;
+      }
+
+      // Check that every id fits.
+      for (size_t i = 0U; i < transition_table.size(); ++i)
+      {
+        const TTransition& t = transition_table[i];
+
+        if (!index.is_valid_event(t.event_id) ||
+            !index.is_valid_state(t.next_state_id) ||
+            (!t.from_any_state && !index.is_valid_state(t.current_state_id)))
+        {
+          return false;
+        }
+      }
+
+      for (size_t i = 0U; i < state_table.size(); ++i)
+      {
+        if (!index.is_valid_state(state_table[i].state_id))
+        {
+          return false;
+        }
+      }
+
+      // The first candidate for each [state][event].
+      // Working backwards leaves the earliest entry in the table.
+      for (size_t i = transition_table.size(); i-- > 0U;)
+      {
+        const TTransition& t = transition_table[i];
+
+        if (t.from_any_state)
+        {
+          for (size_t state_id = 0U; state_id < index.max_states(); ++state_id)
+          {
+            index.set_first(istate_chart::state_id_t(state_id), t.event_id, index_t(i));
+          }
+        }
+        else
+        {
+          index.set_first(t.current_state_id, t.event_id, index_t(i));
+        }
+      }
+
+      // The next candidate after each transition, for when a guard fails.
+      for (size_t i = 0U; i < transition_table.size(); ++i)
+      {
+        const TTransition& t = transition_table[i];
+
+        for (size_t j = i + 1U; j < transition_table.size(); ++j)
+        {
+          const TTransition& n = transition_table[j];
+
+          if ((n.event_id == t.event_id) &&
+              (t.from_any_state || n.from_any_state || (n.current_state_id == t.current_state_id)))
+          {
+            index.set_next(index_t(i), index_t(j));
+            break;
+          }
+        }
+      }
+
+      // The first state table entry for each state id.
+      for (size_t i = state_table.size(); i-- > 0U;)
+      {
+        index.set_state(state_table[i].state_id, index_t(i));
+      }
+
+      return true;
+    }
+  }
+
   //***************************************************************************
   /// Simple Finite State Machine
   /// Data parameter for events.
@@ -159,7 +437,8 @@ namespace etl
       : istate_chart(state_id_),
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
-        started(false)
+        started(false),
+        p_index(ETL_NULLPTR)
     {
     }
 
@@ -182,7 +461,8 @@ namespace etl
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
         state_table(state_table_begin_, state_table_end_),
-        started(false)
+        started(false),
+        p_index(ETL_NULLPTR)
     {
     }
 
@@ -195,6 +475,7 @@ namespace etl
                               const transition* transition_table_end_)
     {
       transition_table.assign(transition_table_begin_, transition_table_end_);
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -206,6 +487,38 @@ namespace etl
                          const state* state_table_end_)
     {
       state_table.assign(state_table_begin_, state_table_end_);
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets an index for the tables, so that events and states are found
+    /// without a search. The index is rebuilt if the tables are changed.
+    /// Call before start(), and not from within an action.
+    /// \param index The index. Must be large enough for the state ids, event ids and transitions.
+    /// \return <b>true</b> if the tables fit the index. If not, the tables are searched as before.
+    //*************************************************************************
+    bool set_index(etl::istate_chart_index& index)
+    {
+      p_index = &index;
+      rebuild_index();
+
+      return p_index != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Removes the index. The tables are searched for each event.
+    //*************************************************************************
+    void clear_index()
+    {
+      p_index = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Is an index in use?
+    //*************************************************************************
+    bool has_index() const
+    {
+      return p_index != ETL_NULLPTR;
     }
 
     //*************************************************************************
@@ -232,7 +545,13 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      if (state_table.empty())
+      if (p_index != ETL_NULLPTR)
+      {
+        const istate_chart_index::index_t index = p_index->state(state_id);
+
+        return (index == istate_chart_index::No_Index) ? state_table.end() : state_table.begin() + index;
+      }
+      else if (state_table.empty())
       {
         return state_table.end();
       }
@@ -288,10 +607,83 @@ namespace etl
     void process_event(const event_id_t event_id, parameter_t data)
     {
       if (started)
+      {
+        // Find the first transition whose guard allows it.
+        const transition* t = find_transition(event_id);
+
+        // Found an entry?
+        if (t != transition_table.end())
+        {
+          // Shall we execute the action?
+          if (t->action != ETL_NULLPTR)
+          {
+#if ETL_CPP11_SUPPORTED
+            (object.*t->action)(etl::forward<parameter_t>(data));
+#else
+            (object.*t->action)(data);
+#endif
+          }
+
+          // Changing state?
+          if (current_state_id != t->next_state_id)
+          {
+            const state* s;
+
+            // See if we have a state item for the current state.
+            s = find_state(current_state_id);
+
+            // If the current state has an 'on_exit' then call it.
+            if ((s != state_table.end()) && (s->on_exit != ETL_NULLPTR))
+            {
+              (object.*(s->on_exit))();
+            }
+
+            current_state_id = t->next_state_id;
+
+            // See if we have a state item for the new state.
+            s = find_state(current_state_id);
+
+            // If the new state has an 'on_entry' then call it.
+            if ((s != state_table.end()) && (s->on_entry != ETL_NULLPTR))
+            {
+              (object.*(s->on_entry))();
+            }
+          }
+
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the first transition for the event from the current state whose
+    /// guard, if any, returns true.
+    //*************************************************************************
+    const transition* find_transition(const event_id_t event_id)
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        istate_chart_index::index_t index = p_index->first(current_state_id, event_id);
+
+        while (index != istate_chart_index::No_Index)
+        {
+          const transition* t = transition_table.begin() + index;
+
+          if ((t->from_any_state || (t->current_state_id == current_state_id)) &&
+              ((t->guard == ETL_NULLPTR) || ((object.*t->guard)())))
+          {
+            return t;
+          }
+
+          index = p_index->next(index);
+        }
+      }
+      else
       {
         const transition* t = transition_table.begin();
 
-        // Keep looping until we execute a transition or reach the end of the table.
+        // Keep looping until we find a transition or reach the end of the table.
         while (t != transition_table.end())
         {
           // Scan the transition table from the latest position.
@@ -305,55 +697,32 @@ namespace etl
             // Shall we execute the transition?
             if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
-              {
-#if ETL_CPP11_SUPPORTED
-                (object.*t->action)(etl::forward<parameter_t>(data));
-#else
-                (object.*t->action)(data);
-#endif
-              }
-
-              // Changing state?
-              if (current_state_id != t->next_state_id)
-              {
-                const state* s;
-
-                // See if we have a state item for the current state.
-                s = find_state(current_state_id);
-
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table.end()) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (object.*(s->on_exit))();
-                }
-
-                current_state_id = t->next_state_id;
-
-                // See if we have a state item for the new state.
-                s = find_state(current_state_id);
-
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table.end()) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
-
-              t = transition_table.end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
+              return t;
             }
+
+            // Start the search from the next item in the table.
+            ++t;
           }
         }
       }
+
+      return transition_table.end();
     }
 
-  private:
+    //*************************************************************************
+    /// Rebuilds the index, if there is one.
+    /// The index is dropped if the tables do not fit.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        if (!private_state_chart::build_index(*p_index, transition_table, state_table, current_state_id))
+        {
+          p_index = ETL_NULLPTR;
+        }
+      }
+    }
 
     //*************************************************************************
     struct is_transition
@@ -397,6 +766,7 @@ namespace etl
     const etl::array_view<const transition> transition_table; ///< The table of transitions.
     etl::array_view<const state>            state_table;      ///< The table of states.
     bool                                    started;          ///< Set if the state chart has been started.
+    etl::istate_chart_index*                p_index;          ///< The optional index for the tables.
   };
 
   //***************************************************************************
@@ -480,7 +850,8 @@ namespace etl
       : istate_chart(state_id_),
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
-        started(false)
+        started(false),
+        p_index(ETL_NULLPTR)
     {
     }
 
@@ -503,7 +874,8 @@ namespace etl
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
         state_table(state_table_begin_, state_table_end_),
-        started(false)
+        started(false),
+        p_index(ETL_NULLPTR)
     {
     }
 
@@ -516,6 +888,7 @@ namespace etl
                               const transition* transition_table_end_)
     {
       transition_table.assign(transition_table_begin_, transition_table_end_);
+      rebuild_index();
     }
 
     //*************************************************************************
@@ -527,6 +900,38 @@ namespace etl
                          const state* state_table_end_)
     {
       state_table.assign(state_table_begin_, state_table_end_);
+      rebuild_index();
+    }
+
+    //*************************************************************************
+    /// Sets an index for the tables, so that events and states are found
+    /// without a search. The index is rebuilt if the tables are changed.
+    /// Call before start(), and not from within an action.
+    /// \param index The index. Must be large enough for the state ids, event ids and transitions.
+    /// \return <b>true</b> if the tables fit the index. If not, the tables are searched as before.
+    //*************************************************************************
+    bool set_index(etl::istate_chart_index& index)
+    {
+      p_index = &index;
+      rebuild_index();
+
+      return p_index != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Removes the index. The tables are searched for each event.
+    //*************************************************************************
+    void clear_index()
+    {
+      p_index = ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Is an index in use?
+    //*************************************************************************
+    bool has_index() const
+    {
+      return p_index != ETL_NULLPTR;
     }
 
     //*************************************************************************
@@ -553,7 +958,13 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
-      if (state_table.empty())
+      if (p_index != ETL_NULLPTR)
+      {
+        const istate_chart_index::index_t index = p_index->state(state_id);
+
+        return (index == istate_chart_index::No_Index) ? state_table.end() : state_table.begin() + index;
+      }
+      else if (state_table.empty())
       {
         return state_table.end();
       }
@@ -597,10 +1008,79 @@ namespace etl
     virtual void process_event(const event_id_t event_id) ETL_OVERRIDE
     {
       if (started)
+      {
+        // Find the first transition whose guard allows it.
+        const transition* t = find_transition(event_id);
+
+        // Found an entry?
+        if (t != transition_table.end())
+        {
+          // Shall we execute the action?
+          if (t->action != ETL_NULLPTR)
+          {
+            (object.*t->action)();
+          }
+
+          // Changing state?
+          if (current_state_id != t->next_state_id)
+          {
+            const state* s;
+
+            // See if we have a state item for the current state.
+            s = find_state(current_state_id);
+
+            // If the current state has an 'on_exit' then call it.
+            if ((s != state_table.end()) && (s->on_exit != ETL_NULLPTR))
+            {
+              (object.*(s->on_exit))();
+            }
+
+            current_state_id = t->next_state_id;
+
+            // See if we have a state item for the new state.
+            s = find_state(current_state_id);
+
+            // If the new state has an 'on_entry' then call it.
+            if ((s != state_table.end()) && (s->on_entry != ETL_NULLPTR))
+            {
+              (object.*(s->on_entry))();
+            }
+          }
+
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the first transition for the event from the current state whose
+    /// guard, if any, returns true.
+    //*************************************************************************
+    const transition* find_transition(const event_id_t event_id)
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        istate_chart_index::index_t index = p_index->first(current_state_id, event_id);
+
+        while (index != istate_chart_index::No_Index)
+        {
+          const transition* t = transition_table.begin() + index;
+
+          if ((t->from_any_state || (t->current_state_id == current_state_id)) &&
+              ((t->guard == ETL_NULLPTR) || ((object.*t->guard)())))
+          {
+            return t;
+          }
+
+          index = p_index->next(index);
+        }
+      }
+      else
       {
         const transition* t = transition_table.begin();
 
-        // Keep looping until we execute a transition or reach the end of the table.
+        // Keep looping until we find a transition or reach the end of the table.
         while (t != transition_table.end())
         {
           // Scan the transition table from the latest position.
@@ -614,51 +1094,32 @@ namespace etl
             // Shall we execute the transition?
             if ((t->guard == ETL_NULLPTR) || ((object.*t->guard)()))
             {
-              // Shall we execute the action?
-              if (t->action != ETL_NULLPTR)
-              {
-                (object.*t->action)();
-              }
-
-              // Changing state?
-              if (current_state_id != t->next_state_id)
-              {
-                const state* s;
-
-                // See if we have a state item for the current state.
-                s = find_state(current_state_id);
-
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table.end()) && (s->on_exit != ETL_NULLPTR))
-                {
-                  (object.*(s->on_exit))();
-                }
-
-                current_state_id = t->next_state_id;
-
-                // See if we have a state item for the new state.
-                s = find_state(current_state_id);
-
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table.end()) && (s->on_entry != ETL_NULLPTR))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
-
-              t = transition_table.end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
+              return t;
             }
+
+            // Start the search from the next item in the table.
+            ++t;
           }
         }
       }
+
+      return transition_table.end();
     }
 
-  private:
+    //*************************************************************************
+    /// Rebuilds the index, if there is one.
+    /// The index is dropped if the tables do not fit.
+    //*************************************************************************
+    void rebuild_index()
+    {
+      if (p_index != ETL_NULLPTR)
+      {
+        if (!private_state_chart::build_index(*p_index, transition_table, state_table, current_state_id))
+        {
+          p_index = ETL_NULLPTR;
+        }
+      }
+    }
 
     //*************************************************************************
     struct is_transition
@@ -702,6 +1163,7 @@ namespace etl
     const etl::array_view<const transition> transition_table; ///< The table of transitions.
     etl::array_view<const state>            state_table;      ///< The table of states.
     bool                                    started;          ///< Set if the state chart has been started.
+    etl::istate_chart_index*                p_index;          ///< The optional index for the tables.
   };
 }
 
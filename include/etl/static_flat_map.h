@@ -0,0 +1,432 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_MAP_INCLUDED
+#define ETL_STATIC_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/static_flat_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup static_flat_map static_flat_map
+/// A read optimised map with the capacity defined at compile time.
+/// The map is built in one go from a range, and then only looked up. The keys
+/// are copied to an array of their own, in Eytzinger order, so that a search
+/// is a branchless walk over densely packed keys. The mapped values may be
+/// modified, but elements cannot be inserted or erased individually.
+/// Iteration is in key order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the static_flat_map.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  class static_flat_map_exception : public etl::exception
+  {
+  public:
+
+    static_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the static_flat_map.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  class static_flat_map_full : public etl::static_flat_map_exception
+  {
+  public:
+
+    static_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::static_flat_map_exception(ETL_ERROR_TEXT("static_flat_map:full", ETL_STATIC_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the static_flat_map.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  class static_flat_map_out_of_range : public etl::static_flat_map_exception
+  {
+  public:
+
+    static_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::static_flat_map_exception(ETL_ERROR_TEXT("static_flat_map:range", ETL_STATIC_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized static_flat_map.
+  /// Can be used as a reference type for all static_flat_map containing a specific type.
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename TKeyCompare = etl::less<TKey> >
+  class istatic_flat_map : public etl::private_static_flat::static_flat_table<ETL_OR_STD::pair<const TKey, T>,
+                                                                              TKey,
+                                                                              etl::private_static_flat::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                                                              TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_static_flat::static_flat_table<ETL_OR_STD::pair<const TKey, T>,
+                                                        TKey,
+                                                        etl::private_static_flat::select_first<TKey, ETL_OR_STD::pair<const TKey, T> >,
+                                                        TKeyCompare> base;
+
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::difference_type        difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(static_flat_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::static_flat_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator itr = base::find(key);
+
+      ETL_ASSERT(itr != base::end(), ETL_ERROR(static_flat_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Builds the map from a range, replacing the current contents.
+    /// The range does not need to be sorted. Where keys are duplicated, the
+    /// first is kept. The range is traversed more than once.
+    /// If asserts or exceptions are enabled, emits static_flat_map_full if the range does not fit.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      base::clear();
+
+      ETL_ASSERT_AND_RETURN(size_t(etl::distance(first, last)) <= base::max_size(), ETL_ERROR(static_flat_map_full));
+
+      const size_t size = base::sort_keys(first, last);
+
+      // Construct each element at the position of its key's rank.
+      base::clear_flags(size);
+
+      while (first != last)
+      {
+        const size_t position = etl::private_static_flat::position_of_rank(base::rank_of(first->first, size), size);
+
+        if (!base::test_and_set_flag(position))
+        {
+          ::new (base::pelements + position) value_type(*first);
+        }
+
+        ++first;
+      }
+
+      // Put the keys in the same order as the elements.
+      for (size_t i = 1U; i <= size; ++i)
+      {
+        base::pkeys[i] = base::pelements[i].first;
+      }
+
+      base::set_size(size);
+    }
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    istatic_flat_map(key_type* pkeys_, value_type* pelements_, uint8_t* pflags_, size_t max_size_)
+      : base(pkeys_, pelements_, pflags_, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    istatic_flat_map(const istatic_flat_map&);
+    istatic_flat_map& operator =(const istatic_flat_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STATIC_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~istatic_flat_map()
+    {
+    }
+#else
+  protected:
+    ~istatic_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first static_flat_map.
+  ///\param rhs Reference to the second static_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first static_flat_map.
+  ///\param rhs Reference to the second static_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup static_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::istatic_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated static_flat_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class static_flat_map : public etl::istatic_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::istatic_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    static_flat_map()
+      : base(reinterpret_cast<TKey*>(&keys), reinterpret_cast<typename base::value_type*>(&elements), flags, MAX_SIZE_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    static_flat_map(const static_flat_map& other)
+      : base(reinterpret_cast<TKey*>(&keys), reinterpret_cast<typename base::value_type*>(&elements), flags, MAX_SIZE_)
+    {
+      base::copy_from(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    static_flat_map(static_flat_map&& other)
+      : base(reinterpret_cast<TKey*>(&keys), reinterpret_cast<typename base::value_type*>(&elements), flags, MAX_SIZE_)
+    {
+      base::move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    static_flat_map(TIterator first_, TIterator last_)
+      : base(reinterpret_cast<TKey*>(&keys), reinterpret_cast<typename base::value_type*>(&elements), flags, MAX_SIZE_)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    static_flat_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init)
+      : base(reinterpret_cast<TKey*>(&keys), reinterpret_cast<typename base::value_type*>(&elements), flags, MAX_SIZE_)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~static_flat_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    static_flat_map& operator = (const static_flat_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    static_flat_map& operator = (static_flat_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The keys, from index 1.
+    typename etl::aligned_storage<sizeof(TKey) * (MAX_SIZE_ + 1U), etl::alignment_of<TKey>::value>::type keys;
+
+    /// The elements, from index 1.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * (MAX_SIZE_ + 1U), etl::alignment_of<typename base::value_type>::value>::type elements;
+
+    /// The flags used while building.
+    uint8_t flags[(MAX_SIZE_ / 8U) + 1U];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t static_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  static_flat_map(T, Ts...)
+    ->static_flat_map<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), typename T::first_type>,
+                      typename T::second_type,
+                      1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
@@ -0,0 +1,363 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATIC_FLAT_SET_INCLUDED
+#define ETL_STATIC_FLAT_SET_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "private/static_flat_table.h"
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup static_flat_set static_flat_set
+/// A read optimised set with the capacity defined at compile time.
+/// The set is built in one go from a range, and then only looked up. The keys
+/// are stored in Eytzinger order, so that a search is a branchless walk over
+/// densely packed keys. Elements cannot be inserted or erased individually.
+/// Iteration is in key order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the static_flat_set.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  class static_flat_set_exception : public etl::exception
+  {
+  public:
+
+    static_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the static_flat_set.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  class static_flat_set_full : public etl::static_flat_set_exception
+  {
+  public:
+
+    static_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::static_flat_set_exception(ETL_ERROR_TEXT("static_flat_set:full", ETL_STATIC_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized static_flat_set.
+  /// Can be used as a reference type for all static_flat_set containing a specific type.
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class istatic_flat_set : public etl::private_static_flat::static_flat_table<TKey,
+                                                                              TKey,
+                                                                              etl::private_static_flat::select_self<TKey>,
+                                                                              TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_static_flat::static_flat_table<TKey,
+                                                        TKey,
+                                                        etl::private_static_flat::select_self<TKey>,
+                                                        TKeyCompare> base;
+
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef typename base::iterator               iterator;
+    typedef typename base::const_iterator         const_iterator;
+    typedef typename base::reverse_iterator       reverse_iterator;
+    typedef typename base::const_reverse_iterator const_reverse_iterator;
+    typedef typename base::difference_type        difference_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    //*********************************************************************
+    /// Builds the set from a range, replacing the current contents.
+    /// The range does not need to be sorted. Duplicated keys are removed.
+    /// If asserts or exceptions are enabled, emits static_flat_set_full if the range does not fit.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      base::clear();
+
+      ETL_ASSERT_AND_RETURN(size_t(etl::distance(first, last)) <= base::max_size(), ETL_ERROR(static_flat_set_full));
+
+      const size_t size = base::sort_keys(first, last);
+
+      // Permute the sorted keys in to Eytzinger order, one cycle at a time.
+      base::clear_flags(size);
+
+      for (size_t start = 1U; start <= size; ++start)
+      {
+        if (!base::test_and_set_flag(start))
+        {
+          value_type temp(base::pkeys[start]);
+          size_t     rank = start;
+          size_t     position;
+
+          do
+          {
+            position = etl::private_static_flat::position_of_rank(rank, size);
+            ETL_OR_STD::swap(temp, base::pkeys[position]);
+            base::test_and_set_flag(position);
+            rank = position;
+          } while (position != start);
+        }
+      }
+
+      base::set_size(size);
+    }
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return base::key_comp();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    istatic_flat_set(value_type* pelements_, uint8_t* pflags_, size_t max_size_)
+      : base(pelements_, pelements_, pflags_, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    istatic_flat_set(const istatic_flat_set&);
+    istatic_flat_set& operator =(const istatic_flat_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STATIC_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~istatic_flat_set()
+    {
+    }
+#else
+  protected:
+    ~istatic_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first static_flat_set.
+  ///\param rhs Reference to the second static_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::istatic_flat_set<TKey, TKeyCompare>& lhs, const etl::istatic_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first static_flat_set.
+  ///\param rhs Reference to the second static_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup static_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::istatic_flat_set<TKey, TKeyCompare>& lhs, const etl::istatic_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated static_flat_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class static_flat_set : public etl::istatic_flat_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::istatic_flat_set<TKey, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    static_flat_set()
+      : base(reinterpret_cast<TKey*>(&elements), flags, MAX_SIZE_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    static_flat_set(const static_flat_set& other)
+      : base(reinterpret_cast<TKey*>(&elements), flags, MAX_SIZE_)
+    {
+      base::copy_from(other);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    static_flat_set(static_flat_set&& other)
+      : base(reinterpret_cast<TKey*>(&elements), flags, MAX_SIZE_)
+    {
+      base::move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    static_flat_set(TIterator first_, TIterator last_)
+      : base(reinterpret_cast<TKey*>(&elements), flags, MAX_SIZE_)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    static_flat_set(std::initializer_list<TKey> init)
+      : base(reinterpret_cast<TKey*>(&elements), flags, MAX_SIZE_)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~static_flat_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    static_flat_set& operator = (const static_flat_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    static_flat_set& operator = (static_flat_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The elements, from index 1.
+    typename etl::aligned_storage<sizeof(TKey) * (MAX_SIZE_ + 1U), etl::alignment_of<TKey>::value>::type elements;
+
+    /// The flags used while building.
+    uint8_t flags[(MAX_SIZE_ / 8U) + 1U];
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t static_flat_set<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_CPP17_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
+  template <typename T, typename... Ts>
+  static_flat_set(T, Ts...)
+    ->static_flat_set<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), T>, 1U + sizeof...(Ts)>;
+#endif
+}
+
+#endif
@@ -445,8 +445,8 @@ namespace etl
   {
     size_t operator()(const etl::istring& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -455,8 +455,8 @@ namespace etl
   {
     size_t operator()(const etl::string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -465,8 +465,8 @@ namespace etl
   {
     size_t operator()(const etl::string_ext& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 #endif
@@ -0,0 +1,402 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_BUILDER_INCLUDED
+#define ETL_STRING_BUILDER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "char_traits.h"
+#include "ipool.h"
+#include "span.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "error_handler.h"
+
+///\defgroup string_builder string_builder
+/// Assembles large text in a chain of chunks allocated from an etl::ipool,
+/// so that it does not need one contiguous buffer sized for the largest text.
+/// Each pool item holds one chunk; its header is followed by the characters.
+/// The pool's items must be aligned for a pointer.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// Builds text in a chain of pool allocated chunks.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <typename T>
+  class basic_string_builder
+  {
+  public:
+
+    typedef T                         value_type;
+    typedef size_t                    size_type;
+    typedef etl::ibasic_string<T>     interface_type;
+#if ETL_CPP11_SUPPORTED
+    typedef etl::span<const T>        segment_type;
+#endif
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool that the chunks are allocated from.
+    //*************************************************************************
+    explicit basic_string_builder(etl::ipool& pool_)
+      : pool(pool_)
+      , p_head(ETL_NULLPTR)
+      , p_tail(ETL_NULLPTR)
+      , chunk_capacity((pool_.max_item_size() > sizeof(chunk)) ? (pool_.max_item_size() - sizeof(chunk)) / sizeof(T) : 0U)
+      , current_size(0U)
+      , n_chunks(0U)
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Returns the chunks to the pool.
+    //*************************************************************************
+    ~basic_string_builder()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Appends a character.
+    //*************************************************************************
+    basic_string_builder& push_back(T c)
+    {
+      return append(&c, 1U);
+    }
+
+    //*************************************************************************
+    /// Appends n copies of a character.
+    //*************************************************************************
+    basic_string_builder& append(size_type n, T c)
+    {
+      while (n != 0U)
+      {
+        T* p = reserve_tail();
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        const size_type count = etl::min(n, chunk_capacity - p_tail->size);
+
+        etl::fill_n(p, count, c);
+        p_tail->size  += count;
+        current_size  += count;
+        n             -= count;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Appends n characters.
+    //*************************************************************************
+    basic_string_builder& append(const T* s, size_type n)
+    {
+      while (n != 0U)
+      {
+        T* p = reserve_tail();
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        const size_type count = etl::min(n, chunk_capacity - p_tail->size);
+
+        etl::copy_n(s, count, p);
+        p_tail->size  += count;
+        current_size  += count;
+        s             += count;
+        n             -= count;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Appends a null terminated string.
+    //*************************************************************************
+    basic_string_builder& append(const T* s)
+    {
+      return append(s, etl::strlen(s));
+    }
+
+    //*************************************************************************
+    /// Appends a string.
+    //*************************************************************************
+    basic_string_builder& append(const etl::ibasic_string<T>& s)
+    {
+      return append(s.data(), s.size());
+    }
+
+    //*************************************************************************
+    /// Appends a string view.
+    //*************************************************************************
+    template <typename TTraits>
+    basic_string_builder& append(const etl::basic_string_view<T, TTraits>& view)
+    {
+      return append(view.data(), view.size());
+    }
+
+    //*************************************************************************
+    /// Appends text.
+    //*************************************************************************
+    template <typename TText>
+    basic_string_builder& operator +=(const TText& text)
+    {
+      return append(text);
+    }
+
+    //*************************************************************************
+    /// Appends a character.
+    //*************************************************************************
+    basic_string_builder& operator +=(T c)
+    {
+      return push_back(c);
+    }
+
+    //*************************************************************************
+    /// Returns the chunks to the pool.
+    //*************************************************************************
+    void clear()
+    {
+      while (p_head != ETL_NULLPTR)
+      {
+        chunk* p_next = p_head->p_next;
+        pool.release(p_head);
+        p_head = p_next;
+      }
+
+      p_tail       = ETL_NULLPTR;
+      current_size = 0U;
+      n_chunks     = 0U;
+      truncated    = false;
+    }
+
+    //*************************************************************************
+    /// The number of characters.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no characters.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of chunks, and therefore segments, in use.
+    //*************************************************************************
+    size_type number_of_segments() const
+    {
+      return n_chunks;
+    }
+
+    //*************************************************************************
+    /// The number of characters that each chunk holds.
+    //*************************************************************************
+    size_type chunk_size() const
+    {
+      return chunk_capacity;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if text was lost because the pool ran out of chunks.
+    //*************************************************************************
+    bool is_truncated() const
+    {
+      return truncated;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Fills 'segments' with a span for each chunk, in order, for use in a
+    /// scatter/gather write.
+    /// The spans remain valid until the builder is cleared or destroyed.
+    ///\return The number of segments written, which is limited by the size of 'segments'.
+    //*************************************************************************
+    size_type get_segments(etl::span<segment_type> segments) const
+    {
+      size_type n = 0U;
+      const chunk* p = p_head;
+
+      while ((p != ETL_NULLPTR) && (n < segments.size()))
+      {
+        segments[n] = segment_type(p->text(), p->size);
+        p = p->p_next;
+        ++n;
+      }
+
+      return n;
+    }
+#endif
+
+    //*************************************************************************
+    /// Copies up to 'length' characters, starting at 'position', to 'destination'.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_type copy(T* destination, size_type length, size_type position = 0U) const
+    {
+      size_type copied = 0U;
+      const chunk* p = p_head;
+
+      while ((p != ETL_NULLPTR) && (copied < length))
+      {
+        if (position >= p->size)
+        {
+          position -= p->size;
+        }
+        else
+        {
+          const size_type count = etl::min(length - copied, p->size - position);
+
+          etl::copy_n(p->text() + position, count, destination + copied);
+          copied  += count;
+          position = 0U;
+        }
+
+        p = p->p_next;
+      }
+
+      return copied;
+    }
+
+    //*************************************************************************
+    /// Assigns the text to a string, truncating if it does not fit.
+    //*************************************************************************
+    void copy_to(etl::ibasic_string<T>& str) const
+    {
+      str.clear();
+
+      const chunk* p = p_head;
+
+      while (p != ETL_NULLPTR)
+      {
+        str.append(p->text(), p->text() + p->size);
+        p = p->p_next;
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The header at the start of each pool item.
+    /// The characters follow it.
+    //*************************************************************************
+    struct chunk
+    {
+      chunk*    p_next;
+      size_type size;
+
+      T* text()
+      {
+        return reinterpret_cast<T*>(this + 1);
+      }
+
+      const T* text() const
+      {
+        return reinterpret_cast<const T*>(this + 1);
+      }
+    };
+
+    //*************************************************************************
+    /// Returns a pointer to the free space in the last chunk, allocating a
+    /// new chunk if it is full.
+    /// Returns a null pointer and sets the truncated flag if there are no
+    /// more chunks.
+    //*************************************************************************
+    T* reserve_tail()
+    {
+      if ((p_tail == ETL_NULLPTR) || (p_tail->size == chunk_capacity))
+      {
+        if (pool.full() || (chunk_capacity == 0U))
+        {
+          truncated = true;
+#if defined(ETL_STRING_TRUNCATION_IS_ERROR)
+          ETL_ALWAYS_ASSERT(ETL_ERROR(string_truncation));
+#endif
+          return ETL_NULLPTR;
+        }
+
+        chunk* p_chunk = pool.allocate<chunk>();
+        p_chunk->p_next = ETL_NULLPTR;
+        p_chunk->size   = 0U;
+
+        if (p_tail == ETL_NULLPTR)
+        {
+          p_head = p_chunk;
+        }
+        else
+        {
+          p_tail->p_next = p_chunk;
+        }
+
+        p_tail = p_chunk;
+        ++n_chunks;
+      }
+
+      return p_tail->text() + p_tail->size;
+    }
+
+    // Disable copy construction and assignment.
+    basic_string_builder(const basic_string_builder&) ETL_DELETE;
+    basic_string_builder& operator =(const basic_string_builder&) ETL_DELETE;
+
+    etl::ipool&     pool;
+    chunk*          p_head;
+    chunk*          p_tail;
+    const size_type chunk_capacity;
+    size_type       current_size;
+    size_type       n_chunks;
+    bool            truncated;
+  };
+
+  typedef etl::basic_string_builder<char>     string_builder;
+  typedef etl::basic_string_builder<wchar_t>  wstring_builder;
+  typedef etl::basic_string_builder<char16_t> u16string_builder;
+  typedef etl::basic_string_builder<char32_t> u32string_builder;
+}
+
+#endif
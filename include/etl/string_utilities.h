@@ -35,10 +35,12 @@ SOFTWARE.
 #include "algorithm.h"
 #include "enum_type.h"
 #include "memory.h"
+#include "iterator.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "fnv_1.h"
+#include "private/string_kernels.h"
 
-#include <ctype.h>
 #include <stdint.h>
 
 namespace etl
@@ -449,9 +451,17 @@ namespace etl
                           const TPair* pairsbegin,
                           const TPair* pairsend)
   {
+    if (s.empty())
+    {
+      return;
+    }
+
+    typename TIString::value_type* first = &s[0];
+    typename TIString::value_type* last  = first + s.size();
+
     while (pairsbegin != pairsend)
     {
-      etl::replace(s.begin(), s.end(), pairsbegin->first, pairsbegin->second);
+      etl::private_string::replace_char(first, last, pairsbegin->first, pairsbegin->second);
       ++pairsbegin;
     }
   }
@@ -513,6 +523,24 @@ namespace etl
     return last;
   }
 
+  //*********************************************************************
+  /// Find first of any of delimiters within the string
+  /// Uses a bit map of the delimiters for 'char'.
+  //*********************************************************************
+  inline const char* find_first_of(const char* first, const char* last, const char* delimiters)
+  {
+    return etl::private_string::find_first_of(first, last, delimiters, etl::strlen(delimiters));
+  }
+
+  //*********************************************************************
+  /// Find first of any of delimiters within the string
+  /// Uses a bit map of the delimiters for 'char'.
+  //*********************************************************************
+  inline char* find_first_of(char* first, char* last, const char* delimiters)
+  {
+    return first + (etl::find_first_of(static_cast<const char*>(first), static_cast<const char*>(last), delimiters) - first);
+  }
+
   //*********************************************************************
   /// Find first of any of delimiters within the string
   //*********************************************************************
@@ -567,6 +595,24 @@ namespace etl
     return last;
   }
 
+  //*********************************************************************
+  /// Find first not of any of delimiters within the string
+  /// Uses a bit map of the delimiters for 'char'.
+  //*********************************************************************
+  inline const char* find_first_not_of(const char* first, const char* last, const char* delimiters)
+  {
+    return etl::private_string::find_first_not_of(first, last, delimiters, etl::strlen(delimiters));
+  }
+
+  //*********************************************************************
+  /// Find first not of any of delimiters within the string
+  /// Uses a bit map of the delimiters for 'char'.
+  //*********************************************************************
+  inline char* find_first_not_of(char* first, char* last, const char* delimiters)
+  {
+    return first + (etl::find_first_not_of(static_cast<const char*>(first), static_cast<const char*>(last), delimiters) - first);
+  }
+
   //*********************************************************************
   /// Find first not of any of delimiters within the string
   //*********************************************************************
@@ -743,6 +789,244 @@ namespace etl
     return etl::optional<TStringView>(view);
   }
 
+  //***************************************************************************
+  /// split_view
+  /// A lazy range of the tokens in a string view, separated by any of a set
+  /// of delimiters. The tokens are views of the input, so nothing is copied.
+  /// N delimiters separate N + 1 tokens, unless empty tokens are ignored.
+  /// The input, and for character types other than 'char' the delimiters,
+  /// must outlive the split_view.
+  ///\code
+  /// etl::split_view<etl::string_view> fields(line, ",");
+  ///
+  /// for (etl::split_view<etl::string_view>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr)
+  /// {
+  ///   process(*itr);
+  /// }
+  ///\endcode
+  //***************************************************************************
+  template <typename TStringView>
+  class split_view
+  {
+  public:
+
+    typedef TStringView                           value_type;
+    typedef typename TStringView::value_type      char_type;
+    typedef typename TStringView::const_pointer   const_pointer;
+    typedef size_t                                size_type;
+
+    //*************************************************************************
+    /// Iterates through the tokens.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class split_view;
+
+      //*******************************************
+      const_iterator()
+        : p_owner(ETL_NULLPTR)
+        , token_begin(ETL_NULLPTR)
+        , token_end(ETL_NULLPTR)
+      {
+      }
+
+      //*******************************************
+      const_iterator& operator ++()
+      {
+        next();
+        return *this;
+      }
+
+      //*******************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        next();
+        return temp;
+      }
+
+      //*******************************************
+      value_type operator *() const
+      {
+        return value_type(token_begin, size_type(token_end - token_begin));
+      }
+
+      //*******************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.token_begin == rhs.token_begin) && (lhs.token_end == rhs.token_end);
+      }
+
+      //*******************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************************
+      /// Constructs the iterator for the first token.
+      //*******************************************
+      explicit const_iterator(const split_view& owner)
+        : p_owner(&owner)
+        , token_begin(owner.first)
+        , token_end(owner.find_delimiter(owner.first))
+      {
+        if (owner.first == ETL_NULLPTR)
+        {
+          set_end();
+        }
+        else if (owner.ignore_empty_tokens && (token_begin == token_end))
+        {
+          next();
+        }
+      }
+
+      //*******************************************
+      /// Constructs the end iterator.
+      //*******************************************
+      const_iterator(const split_view& owner, bool)
+        : p_owner(&owner)
+        , token_begin(ETL_NULLPTR)
+        , token_end(ETL_NULLPTR)
+      {
+      }
+
+      //*******************************************
+      void next()
+      {
+        for (;;)
+        {
+          if (token_end == p_owner->last)
+          {
+            set_end();
+            return;
+          }
+
+          // Step over the delimiter.
+          token_begin = token_end + 1;
+          token_end   = p_owner->find_delimiter(token_begin);
+
+          if (!p_owner->ignore_empty_tokens || (token_begin != token_end))
+          {
+            return;
+          }
+        }
+      }
+
+      //*******************************************
+      void set_end()
+      {
+        token_begin = ETL_NULLPTR;
+        token_end   = ETL_NULLPTR;
+      }
+
+      const split_view* p_owner;
+      const_pointer     token_begin;
+      const_pointer     token_end;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Constructs from the input and a null terminated list of delimiters.
+    //*************************************************************************
+    split_view(const TStringView& input, const_pointer delimiters_, bool ignore_empty_tokens_ = false)
+      : first(input.data())
+      , last(input.data() + input.size())
+      , delimiters(delimiters_, etl::strlen(delimiters_))
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from the input and a view of the delimiters.
+    //*************************************************************************
+    split_view(const TStringView& input, const TStringView& delimiters_, bool ignore_empty_tokens_ = false)
+      : first(input.data())
+      , last(input.data() + input.size())
+      , delimiters(delimiters_.data(), delimiters_.size())
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// The first token.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this);
+    }
+
+    //*************************************************************************
+    /// Past the last token.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, true);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no tokens.
+    //*************************************************************************
+    bool empty() const
+    {
+      return begin() == end();
+    }
+
+    //*************************************************************************
+    /// Counts the tokens, in one pass and without creating them.
+    //*************************************************************************
+    size_type size() const
+    {
+      if (first == ETL_NULLPTR)
+      {
+        return 0U;
+      }
+
+      size_type count    = 0U;
+      bool      in_token = false;
+
+      for (const_pointer p = first; p != last; ++p)
+      {
+        if (delimiters.contains(*p))
+        {
+          count   += (!ignore_empty_tokens || in_token) ? 1U : 0U;
+          in_token = false;
+        }
+        else
+        {
+          in_token = true;
+        }
+      }
+
+      return count + ((!ignore_empty_tokens || in_token) ? 1U : 0U);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the next delimiter, or the end of the input.
+    //*************************************************************************
+    const_pointer find_delimiter(const_pointer p) const
+    {
+      while ((p != last) && !delimiters.contains(*p))
+      {
+        ++p;
+      }
+
+      return p;
+    }
+
+    const_pointer first;
+    const_pointer last;
+    etl::private_string::delimiter_set<char_type> delimiters;
+    bool ignore_empty_tokens;
+  };
+
   //***************************************************************************
   /// pad_left
   //***************************************************************************
@@ -802,35 +1086,171 @@ namespace etl
 
   //***************************************************************************
   /// to_upper_case
+  /// Converts the ASCII letters, as in the "C" locale.
   //***************************************************************************
   template <typename TString>
   void to_upper_case(TString& s)
   {
-    etl::transform(s.begin(), s.end(), s.begin(), ::toupper);
+    if (!s.empty())
+    {
+      etl::private_string::to_upper_ascii(&s[0], &s[0] + s.size());
+    }
   }
 
   //***************************************************************************
   /// to_lower_case
+  /// Converts the ASCII letters, as in the "C" locale.
   //***************************************************************************
   template <typename TString>
   void to_lower_case(TString& s)
   {
-    etl::transform(s.begin(), s.end(), s.begin(), ::tolower);
+    if (!s.empty())
+    {
+      etl::private_string::to_lower_ascii(&s[0], &s[0] + s.size());
+    }
   }
 
   //***************************************************************************
   /// to_sentence_case
+  /// Converts the ASCII letters, as in the "C" locale.
   //***************************************************************************
   template <typename TString>
   void to_sentence_case(TString& s)
   {
-    typename TString::iterator itr = s.begin();
+    if (!s.empty())
+    {
+      s[0] = etl::private_string::to_upper_ascii(s[0]);
+      etl::private_string::to_lower_ascii(&s[0] + 1, &s[0] + s.size());
+    }
+  }
+
+  //***************************************************************************
+  /// compare_case_insensitive
+  /// Compares two strings, ignoring the case of ASCII letters.
+  ///\return Negative, zero or positive, as for compare.
+  //***************************************************************************
+  template <typename TStringView>
+  int compare_case_insensitive(const TStringView& lhs, const TStringView& rhs)
+  {
+    typedef typename TStringView::value_type type;
+
+    const size_t length = etl::min(lhs.size(), rhs.size());
+    const size_t i      = etl::private_string::mismatch_ignoring_case(lhs.data(), rhs.data(), length);
+
+    if (i != length)
+    {
+      const type l = etl::private_string::to_lower_ascii(lhs[i]);
+      const type r = etl::private_string::to_lower_ascii(rhs[i]);
+
+      return (l < r) ? -1 : 1;
+    }
+
+    return (lhs.size() == rhs.size()) ? 0 : ((lhs.size() < rhs.size()) ? -1 : 1);
+  }
+
+  //***************************************************************************
+  /// equal_case_insensitive
+  /// Checks two strings for equality, ignoring the case of ASCII letters.
+  //***************************************************************************
+  template <typename TStringView>
+  bool equal_case_insensitive(const TStringView& lhs, const TStringView& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           (etl::private_string::mismatch_ignoring_case(lhs.data(), rhs.data(), lhs.size()) == lhs.size());
+  }
+
+  //***************************************************************************
+  /// find_case_insensitive
+  /// Finds a string, ignoring the case of ASCII letters.
+  ///\return The position of the first match at or after 'position', or npos.
+  //***************************************************************************
+  template <typename TStringView>
+  size_t find_case_insensitive(const TStringView& text, const TStringView& pattern, size_t position = 0U)
+  {
+    typedef typename TStringView::value_type type;
+
+    const size_t n = pattern.size();
 
-    *itr = typename TString::value_type(::toupper(*itr));
-    ++itr;
+    if ((position > text.size()) || (n > (text.size() - position)))
+    {
+      return TStringView::npos;
+    }
 
-    etl::transform(itr, s.end(), itr, ::tolower);
+    if (n == 0U)
+    {
+      return position;
+    }
+
+    const type first_lower = etl::private_string::to_lower_ascii(pattern[0]);
+    const size_t final_start = text.size() - n;
+
+    for (size_t i = position; i <= final_start; ++i)
+    {
+      if ((etl::private_string::to_lower_ascii(text[i]) == first_lower) &&
+          (etl::private_string::mismatch_ignoring_case(text.data() + i + 1U, pattern.data() + 1U, n - 1U) == (n - 1U)))
+      {
+        return i;
+      }
+    }
+
+    return TStringView::npos;
   }
+
+  //***************************************************************************
+  /// case_insensitive_hash
+  /// A hash that ignores the case of ASCII letters, for use with
+  /// case_insensitive_equal_to as the key hash of an unordered container.
+  /// Uses FNV-1a of the lower case text.
+  //***************************************************************************
+  template <typename TStringView>
+  struct case_insensitive_hash
+  {
+    size_t operator()(const TStringView& text) const
+    {
+      typedef typename TStringView::value_type type;
+
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<sizeof(size_t) == sizeof(uint64_t), etl::fnv_1a_64, etl::fnv_1a_32>::type hasher_t;
+#else
+      typedef etl::fnv_1a_32 hasher_t;
+#endif
+
+      hasher_t hasher;
+
+      // Lower the text a block at a time.
+      type buffer[64];
+
+      const type* p      = text.data();
+      size_t      length = text.size();
+
+      while (length != 0U)
+      {
+        const size_t n = etl::min(length, size_t(64U));
+
+        etl::copy_n(p, n, buffer);
+        etl::private_string::to_lower_ascii(buffer, buffer + n);
+        hasher.add(reinterpret_cast<const uint8_t*>(buffer), reinterpret_cast<const uint8_t*>(buffer + n));
+
+        p      += n;
+        length -= n;
+      }
+
+      return static_cast<size_t>(hasher.value());
+    }
+  };
+
+  //***************************************************************************
+  /// case_insensitive_equal_to
+  /// Equality that ignores the case of ASCII letters.
+  //***************************************************************************
+  template <typename TStringView>
+  struct case_insensitive_equal_to
+  {
+    bool operator()(const TStringView& lhs, const TStringView& rhs) const
+    {
+      return etl::equal_case_insensitive(lhs, rhs);
+    }
+  };
 }
 
 #endif
\ No newline at end of file
@@ -406,7 +406,14 @@ namespace etl
     //*************************************************************************
     int compare(basic_string_view<T, TTraits> view) const
     {
-      return (*this == view) ? 0 : ((*this > view) ? 1 : -1);
+      const int result = etl::private_string::compare(data(), view.data(), etl::min(size(), view.size()));
+
+      if (result != 0)
+      {
+        return result;
+      }
+
+      return (size() < view.size()) ? -1 : ((size() > view.size()) ? 1 : 0);
     }
 
     int compare(size_type position, size_type count, basic_string_view view) const
@@ -486,21 +493,14 @@ namespace etl
     //*************************************************************************
     size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((position > size()) || (view.size() > (size() - position)))
       {
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const_pointer p = etl::private_string::search(mbegin + position, mend, view.data(), view.size());
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return etl::distance(begin(), iposition);
-      }
+      return (p == mend) ? npos : size_type(p - mbegin);
     }
 
     size_type find(T c, size_type position = 0) const
@@ -565,21 +565,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
+        const_pointer p = etl::private_string::find_first_of(mbegin + position, mend, view.data(), view.size());
 
-          for (size_t j = 0; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
+        if (p != mend)
+        {
+          return size_type(p - mbegin);
         }
       }
 
@@ -654,28 +646,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
+        const_pointer p = etl::private_string::find_first_not_of(mbegin + position, mend, view.data(), view.size());
 
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
+        if (p != mend)
+        {
+          return size_type(p - mbegin);
         }
       }
 
@@ -774,7 +751,7 @@ namespace etl
     //*************************************************************************
     friend bool operator < (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
-      return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+      return lhs.compare(rhs) < 0;
     }
 
     //*************************************************************************
@@ -848,8 +825,8 @@ namespace etl
   {
     size_t operator()(const etl::string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -858,8 +835,8 @@ namespace etl
   {
     size_t operator()(const etl::wstring_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -868,8 +845,8 @@ namespace etl
   {
     size_t operator()(const etl::u16string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -878,8 +855,8 @@ namespace etl
   {
     size_t operator()(const etl::u32string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 #endif
@@ -0,0 +1,568 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRIPED_UNORDERED_SET_INCLUDED
+#define ETL_STRIPED_UNORDERED_SET_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "mutex.h"
+#include "functional.h"
+#include "hash.h"
+#include "pool.h"
+#include "intrusive_forward_list.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+
+#if ETL_HAS_MUTEX
+
+//*****************************************************************************
+///\defgroup striped_unordered_set striped_unordered_set
+/// A fixed capacity unordered set that any number of threads may use at once.
+/// The buckets are shared among a number of stripes, each with its own
+/// etl::mutex, so threads only contend when their keys hash to the same stripe.
+/// The node pool has its own mutex, held only to allocate or release a node.
+/// The locks are always taken stripe first, then pool, so they cannot deadlock.
+/// There are no iterators, as they could not be kept valid while other threads
+/// erase. for_each visits the elements one stripe at a time instead.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the striped_unordered_set.
+  ///\ingroup striped_unordered_set
+  //***************************************************************************
+  class striped_unordered_set_exception : public etl::exception
+  {
+  public:
+
+    striped_unordered_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the striped_unordered_set.
+  ///\ingroup striped_unordered_set
+  //***************************************************************************
+  class striped_unordered_set_full : public etl::striped_unordered_set_exception
+  {
+  public:
+
+    striped_unordered_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::striped_unordered_set_exception(ETL_ERROR_TEXT("striped_unordered_set:full", ETL_STRIPED_UNORDERED_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized striped_unordered_set.
+  /// Can be used as a reference type for all striped_unordered_set containing a specific type.
+  /// All of the member functions may be called from any thread.
+  ///\ingroup striped_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class istriped_unordered_set
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+    typedef etl::forward_link<0> link_t;
+
+    // The nodes that store the elements.
+    struct node_t : public link_t
+    {
+      node_t(const_reference key_)
+        : key(key_)
+      {
+      }
+
+      value_type key;
+    };
+
+  protected:
+
+    typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
+    typedef etl::ipool pool_t;
+
+  public:
+
+    //*********************************************************************
+    /// Inserts a value, if it does not already exist.
+    /// If asserts or exceptions are enabled, emits striped_unordered_set_full if the set is already full.
+    ///\param key The value to insert.
+    ///\return <b>true</b> if the value was inserted.
+    //*********************************************************************
+    bool insert(const_reference key)
+    {
+      size_t index = bucket_index(key);
+
+      etl::mutex& stripe = stripe_of(index);
+      stripe.lock();
+
+      bucket_t& bucket   = pbuckets[index];
+      bool      exists   = bucket_contains(bucket, key);
+      bool      inserted = false;
+
+      if (!exists)
+      {
+        node_t* pnode = allocate_node();
+
+        if (pnode != ETL_NULLPTR)
+        {
+          ::new (&pnode->key) value_type(key);
+          bucket.insert_after(bucket.before_begin(), *pnode);
+          inserted = true;
+        }
+      }
+
+      stripe.unlock();
+
+      // Neither inserted nor already there means that the pool was empty.
+      ETL_ASSERT(inserted || exists, ETL_ERROR(striped_unordered_set_full));
+
+      return inserted;
+    }
+
+    //*********************************************************************
+    /// Erases a value.
+    ///\param key The value to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_t index = bucket_index(key);
+
+      etl::mutex& stripe = stripe_of(index);
+      stripe.lock();
+
+      bucket_t& bucket = pbuckets[index];
+      size_t    count  = 0U;
+
+      typename bucket_t::iterator iprevious = bucket.before_begin();
+      typename bucket_t::iterator icurrent  = bucket.begin();
+
+      while (icurrent != bucket.end())
+      {
+        if (key_equal_function(icurrent->key, key))
+        {
+          node_t& node = *icurrent;
+          bucket.erase_after(iprevious);
+          release_node(node);
+          count = 1U;
+          break;
+        }
+
+        iprevious = icurrent;
+        ++icurrent;
+      }
+
+      stripe.unlock();
+
+      return count;
+    }
+
+    //*********************************************************************
+    /// Checks if the set contains the value.
+    ///\param key The value to search for.
+    ///\return <b>true</b> if the value exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      size_t index = bucket_index(key);
+
+      etl::mutex& stripe = stripe_of(index);
+      stripe.lock();
+
+      bool result = bucket_contains(pbuckets[index], key);
+
+      stripe.unlock();
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Counts the elements equal to the value.
+    ///\param key The value to search for.
+    ///\return 0 or 1.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Calls the function for every element, one stripe at a time.
+    /// The elements of a stripe cannot change while the function visits them.
+    /// The function must not call back in to the set.
+    ///\param function Called with a const reference to each element.
+    //*********************************************************************
+    template <typename TFunction>
+    TFunction for_each(TFunction function) const
+    {
+      for (size_t s = 0U; s < number_of_stripes; ++s)
+      {
+        pstripes[s].lock();
+
+        for (size_t i = s; i < number_of_buckets; i += number_of_stripes)
+        {
+          typename bucket_t::const_iterator inode = pbuckets[i].begin();
+
+          while (inode != pbuckets[i].end())
+          {
+            function(inode->key);
+            ++inode;
+          }
+        }
+
+        pstripes[s].unlock();
+      }
+
+      return function;
+    }
+
+    //*********************************************************************
+    /// Erases all of the elements.
+    //*********************************************************************
+    void clear()
+    {
+      for (size_t s = 0U; s < number_of_stripes; ++s)
+      {
+        pstripes[s].lock();
+      }
+
+      for (size_t i = 0U; i < number_of_buckets; ++i)
+      {
+        bucket_t& bucket = pbuckets[i];
+
+        while (!bucket.empty())
+        {
+          node_t& node = bucket.front();
+          bucket.pop_front();
+          release_node(node);
+        }
+      }
+
+      for (size_t s = number_of_stripes; s != 0U; --s)
+      {
+        pstripes[s - 1U].unlock();
+      }
+    }
+
+    //*********************************************************************
+    /// Returns the number of elements.
+    //*********************************************************************
+    size_type size() const
+    {
+      pool_lock.lock();
+      size_t result = pnodepool->size();
+      pool_lock.unlock();
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Checks if the set is empty.
+    //*********************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*********************************************************************
+    /// Checks if the set is full.
+    //*********************************************************************
+    bool full() const
+    {
+      return size() == max_size();
+    }
+
+    //*********************************************************************
+    /// Returns the remaining capacity.
+    //*********************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*********************************************************************
+    /// Returns the capacity of the set.
+    //*********************************************************************
+    size_type capacity() const
+    {
+      return pnodepool->max_size();
+    }
+
+    //*********************************************************************
+    /// Returns the maximum size of the set.
+    //*********************************************************************
+    size_type max_size() const
+    {
+      return pnodepool->max_size();
+    }
+
+    //*********************************************************************
+    /// Returns the number of buckets.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return number_of_buckets;
+    }
+
+    //*********************************************************************
+    /// Returns the number of stripes.
+    //*********************************************************************
+    size_type stripe_count() const
+    {
+      return number_of_stripes;
+    }
+
+    //*********************************************************************
+    /// Returns the function that hashes the keys.
+    //*********************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*********************************************************************
+    /// Returns the function that compares the keys.
+    //*********************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    istriped_unordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::mutex* pstripes_, size_t number_of_stripes_)
+      : pnodepool(&node_pool_),
+        pbuckets(pbuckets_),
+        number_of_buckets(number_of_buckets_),
+        pstripes(pstripes_),
+        number_of_stripes(number_of_stripes_)
+    {
+    }
+
+  private:
+
+    //*********************************************************************
+    /// The bucket that the key hashes to.
+    //*********************************************************************
+    size_t bucket_index(key_parameter_t key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+
+    //*********************************************************************
+    /// The mutex that guards the bucket.
+    //*********************************************************************
+    etl::mutex& stripe_of(size_t index) const
+    {
+      return pstripes[index % number_of_stripes];
+    }
+
+    //*********************************************************************
+    /// Checks if the bucket contains the key.
+    /// The bucket's stripe must be locked.
+    //*********************************************************************
+    bool bucket_contains(const bucket_t& bucket, key_parameter_t key) const
+    {
+      typename bucket_t::const_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        if (key_equal_function(inode->key, key))
+        {
+          return true;
+        }
+
+        ++inode;
+      }
+
+      return false;
+    }
+
+    //*********************************************************************
+    /// Gets a node from the pool, or ETL_NULLPTR if it is empty.
+    //*********************************************************************
+    node_t* allocate_node()
+    {
+      node_t* pnode = ETL_NULLPTR;
+
+      pool_lock.lock();
+
+      if (!pnodepool->full())
+      {
+        node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
+        pnode = (pnodepool->*func)();
+      }
+
+      pool_lock.unlock();
+
+      return pnode;
+    }
+
+    //*********************************************************************
+    /// Destroys the key and returns the node to the pool.
+    //*********************************************************************
+    void release_node(node_t& node)
+    {
+      node.key.~value_type();
+
+      pool_lock.lock();
+      pnodepool->release(&node);
+      pool_lock.unlock();
+    }
+
+    // Disable copy construction and assignment.
+    istriped_unordered_set(const istriped_unordered_set&);
+    istriped_unordered_set& operator =(const istriped_unordered_set&);
+
+    pool_t*            pnodepool;
+    bucket_t*          pbuckets;
+    const size_t       number_of_buckets;
+    etl::mutex*        pstripes;
+    const size_t       number_of_stripes;
+    mutable etl::mutex pool_lock;
+
+    hasher    key_hash_function;
+    key_equal key_equal_function;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_STRIPED_UNORDERED_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~istriped_unordered_set()
+    {
+    }
+#else
+  protected:
+    ~istriped_unordered_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A striped_unordered_set implementation that uses a fixed size buffer.
+  ///\tparam TKey         The key type.
+  ///\tparam MAX_SIZE_    The maximum number of elements that can be stored.
+  ///\tparam MAX_BUCKETS_ The number of buckets. Default = MAX_SIZE_
+  ///\tparam MAX_STRIPES_ The number of mutexes shared among the buckets. Default = 8, or MAX_BUCKETS_ if fewer.
+  ///\tparam THash        The hash function for the keys. Default = etl::hash<TKey>
+  ///\tparam TKeyEqual    The function to compare keys. Default = etl::equal_to<TKey>
+  ///\ingroup striped_unordered_set
+  //***************************************************************************
+  template <typename TKey,
+            const size_t MAX_SIZE_,
+            const size_t MAX_BUCKETS_ = MAX_SIZE_,
+            const size_t MAX_STRIPES_ = ((MAX_BUCKETS_ < 8U) ? MAX_BUCKETS_ : 8U),
+            typename THash = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class striped_unordered_set : public etl::istriped_unordered_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::istriped_unordered_set<TKey, THash, TKeyEqual> base;
+
+    ETL_STATIC_ASSERT((MAX_STRIPES_ != 0U) && (MAX_STRIPES_ <= MAX_BUCKETS_), "The number of stripes must be between 1 and the number of buckets");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_STRIPES = MAX_STRIPES_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    striped_unordered_set()
+      : base(node_pool, buckets, MAX_BUCKETS_, stripes, MAX_STRIPES_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~striped_unordered_set()
+    {
+      base::clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    striped_unordered_set(const striped_unordered_set&);
+    striped_unordered_set& operator =(const striped_unordered_set&);
+
+    /// The pool of nodes used for the striped_unordered_set.
+    etl::pool<typename base::node_t, MAX_SIZE> node_pool;
+
+    /// The buckets of node lists.
+    etl::intrusive_forward_list<typename base::node_t> buckets[MAX_BUCKETS_];
+
+    /// The mutexes for the stripes of buckets.
+    etl::mutex stripes[MAX_STRIPES_];
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t striped_unordered_set<TKey, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t striped_unordered_set<TKey, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual>::MAX_BUCKETS;
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t striped_unordered_set<TKey, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual>::MAX_STRIPES;
+}
+
+#endif
+
+#endif
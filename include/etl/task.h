@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "nullptr.h"
+#include "atomic.h"
 
 namespace etl
 {
@@ -52,6 +54,8 @@ namespace etl
 
   typedef uint_least8_t task_priority_t;
 
+  struct task_statistics;
+
   //***************************************************************************
   /// Task.
   //***************************************************************************
@@ -64,7 +68,12 @@ namespace etl
     //*******************************************
     task(task_priority_t priority)
       : task_running(true),
-        task_priority(priority)
+        task_priority(priority),
+        p_statistics(ETL_NULLPTR)
+#if ETL_HAS_ATOMIC
+        , p_ready_bits(ETL_NULLPTR)
+        , ready_mask(0U)
+#endif
     {
     }
 
@@ -94,6 +103,17 @@ namespace etl
       // Do nothing.
     }
 
+    //*******************************************
+    /// Called by deadline scheduling policies to get the time by which the
+    /// current work must be done, in the units of the scheduler's clock.
+    /// Returns <b>false</b> if the task has no deadline.
+    //*******************************************
+    virtual bool task_deadline(uint32_t& deadline) const
+    {
+      (void)deadline;
+      return false;
+    }
+
     //*******************************************
     /// Set the running state for the task.
     //*******************************************
@@ -119,10 +139,60 @@ namespace etl
       return task_priority;
     }
 
+    //*******************************************
+    /// Sets the statistics record for the task.
+    /// Called by the scheduler.
+    //*******************************************
+    void set_task_statistics(etl::task_statistics* p_statistics_)
+    {
+      p_statistics = p_statistics_;
+    }
+
+    //*******************************************
+    /// Gets the statistics record for the task.
+    /// Null if the scheduler is not collecting statistics.
+    //*******************************************
+    etl::task_statistics* get_task_statistics() const
+    {
+      return p_statistics;
+    }
+
+#if ETL_HAS_ATOMIC
+    //*******************************************
+    /// Signals that the task has work, for schedulers that keep a bitmap of
+    /// ready tasks. Does nothing for other schedulers.
+    /// May be called from an interrupt or another thread.
+    //*******************************************
+    void set_task_ready()
+    {
+      etl::atomic_uint32_t* p_bits = p_ready_bits;
+
+      if (p_bits != ETL_NULLPTR)
+      {
+        p_bits->fetch_or(ready_mask);
+      }
+    }
+
+    //*******************************************
+    /// Sets the ready bitmap and the bit for the task.
+    /// Called by the scheduler policy.
+    //*******************************************
+    void set_task_ready_bitmap(etl::atomic_uint32_t* p_ready_bits_, uint32_t ready_mask_)
+    {
+      ready_mask   = ready_mask_;
+      p_ready_bits = p_ready_bits_;
+    }
+#endif
+
   private:
 
     bool task_running;
     etl::task_priority_t task_priority;
+    etl::task_statistics* p_statistics;
+#if ETL_HAS_ATOMIC
+    etl::atomic_uint32_t* volatile p_ready_bits;
+    volatile uint32_t              ready_mask;
+#endif
   };
 }
 
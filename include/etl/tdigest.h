@@ -0,0 +1,435 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TDIGEST_INCLUDED
+#define ETL_TDIGEST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "array.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "math_constants.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup tdigest tdigest
+/// A mergeable sketch of a distribution of floating point values, from which
+/// quantiles can be estimated, in a fixed amount of memory (Dunning's merging
+/// t-digest).
+/// Values are summarised by weighted centroids. Centroids near the median may
+/// be large, while those near the tails are kept small, so extreme quantiles
+/// such as p99 and p99.9 are accurate.
+/// New values are buffered and merged into the centroids when the buffer is
+/// full, or when a quantile is requested.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// t-digest.
+  ///\tparam T             The floating point value type.
+  ///\tparam Max_Centroids The maximum number of centroids. More gives greater accuracy.
+  ///\tparam Buffer_Size   The number of values buffered before they are merged.
+  ///\ingroup tdigest
+  //***************************************************************************
+  template <typename T, size_t Max_Centroids, size_t Buffer_Size = Max_Centroids>
+  class tdigest
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "Only floating point values allowed");
+    ETL_STATIC_ASSERT(Max_Centroids >= 2U, "At least two centroids are needed");
+    ETL_STATIC_ASSERT(Buffer_Size >= 1U, "The buffer must hold at least one value");
+
+    typedef T        value_type;
+    typedef uint32_t weight_type;
+
+    //*********************************
+    /// A weighted mean of a number of values.
+    //*********************************
+    struct centroid
+    {
+      value_type  mean;
+      weight_type weight;
+    };
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    tdigest()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    tdigest(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    /// NaNs are ignored.
+    //*********************************
+    void add(value_type value)
+    {
+      add(value, weight_type(1U));
+    }
+
+    //*********************************
+    /// Add a value with a weight.
+    /// NaNs are ignored.
+    //*********************************
+    void add(value_type value, weight_type weight)
+    {
+      if ((value != value) || (weight == 0U))
+      {
+        return;
+      }
+
+      minimum = ((total == 0U) || (value < minimum)) ? value : minimum;
+      maximum = ((total == 0U) || (value > maximum)) ? value : maximum;
+
+      push(value, weight);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(value_type value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Adds the values summarised by another digest to this one.
+    //*********************************
+    void merge(const tdigest& other)
+    {
+      if (other.total == 0U)
+      {
+        return;
+      }
+
+      if (&other == this)
+      {
+        // Every value twice.
+        flush();
+
+        for (size_t i = 0U; i < n_centroids; ++i)
+        {
+          nodes[i].weight += nodes[i].weight;
+        }
+
+        total += total;
+        return;
+      }
+
+      minimum = ((total == 0U) || (other.minimum < minimum)) ? other.minimum : minimum;
+      maximum = ((total == 0U) || (other.maximum > maximum)) ? other.maximum : maximum;
+
+      const size_t n = other.n_centroids + other.n_buffered;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        push(other.nodes[i].mean, other.nodes[i].weight);
+      }
+    }
+
+    //*********************************
+    /// Estimates the value below which a fraction q of the values lie.
+    /// The estimate interpolates between the centroids, and between the
+    /// outer centroids and the exact minimum and maximum.
+    /// Returns zero if the digest is empty.
+    //*********************************
+    value_type quantile(double q) const
+    {
+      flush();
+
+      if (total == 0U)
+      {
+        return value_type(0);
+      }
+
+      if (q <= 0.0)
+      {
+        return minimum;
+      }
+
+      if (q >= 1.0)
+      {
+        return maximum;
+      }
+
+      const double target = q * double(total);
+
+      // Interpolate between the points (0, min), (centre of each centroid, mean) and (total, max).
+      double     previous_rank  = 0.0;
+      value_type previous_value = minimum;
+      double     cumulative     = 0.0;
+
+      for (size_t i = 0U; i < n_centroids; ++i)
+      {
+        const double rank = cumulative + (double(nodes[i].weight) / 2.0);
+
+        if (target < rank)
+        {
+          return interpolate(previous_rank, previous_value, rank, nodes[i].mean, target);
+        }
+
+        cumulative     += double(nodes[i].weight);
+        previous_rank   = rank;
+        previous_value  = nodes[i].mean;
+      }
+
+      return interpolate(previous_rank, previous_value, double(total), maximum, target);
+    }
+
+    //*********************************
+    /// The smallest value added, or zero if the digest is empty.
+    //*********************************
+    value_type min() const
+    {
+      return minimum;
+    }
+
+    //*********************************
+    /// The largest value added, or zero if the digest is empty.
+    //*********************************
+    value_type max() const
+    {
+      return maximum;
+    }
+
+    //*********************************
+    /// The total weight of the values added.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(total);
+    }
+
+    //*********************************
+    /// True if no values have been added.
+    //*********************************
+    bool empty() const
+    {
+      return total == 0U;
+    }
+
+    //*********************************
+    /// The number of centroids, once buffered values have been merged.
+    //*********************************
+    size_t centroid_count() const
+    {
+      flush();
+
+      return n_centroids;
+    }
+
+    //*********************************
+    /// A centroid, in order of their means.
+    //*********************************
+    const centroid& get_centroid(size_t index) const
+    {
+      flush();
+
+      return nodes[index];
+    }
+
+    //*********************************
+    /// Clear the digest.
+    //*********************************
+    void clear()
+    {
+      n_centroids = 0U;
+      n_buffered  = 0U;
+      total       = 0U;
+      minimum     = value_type(0);
+      maximum     = value_type(0);
+    }
+
+  private:
+
+    //*********************************
+    /// Buffers a weighted value.
+    //*********************************
+    void push(value_type value, weight_type weight)
+    {
+      if (n_buffered == Buffer_Size)
+      {
+        flush();
+      }
+
+      centroid& c = nodes[n_centroids + n_buffered];
+      c.mean   = value;
+      c.weight = weight;
+
+      ++n_buffered;
+      total += weight;
+    }
+
+    //*********************************
+    /// Orders centroids by their means.
+    //*********************************
+    static bool compare_mean(const centroid& lhs, const centroid& rhs)
+    {
+      return lhs.mean < rhs.mean;
+    }
+
+    //*********************************
+    /// The scale function, which maps a quantile to the number of centroids
+    /// that lie below it. Its slope, and so the size allowed for a centroid,
+    /// falls towards the tails.
+    /// k(q) = (delta / 2pi) asin(2q - 1), where delta is Max_Centroids - 1.
+    /// Two neighbouring centroids after a merge cover more than one unit of
+    /// k between them, and k covers delta / 2 units, so there are never more
+    /// than delta + 1 centroids.
+    //*********************************
+    static double scale(double q)
+    {
+      return (double(Max_Centroids - 1U) / (2.0 * etl::math::pi)) * asin((2.0 * q) - 1.0);
+    }
+
+    //*********************************
+    /// The inverse of the scale function.
+    //*********************************
+    static double inverse_scale(double k)
+    {
+      const double angle = (k * 2.0 * etl::math::pi) / double(Max_Centroids - 1U);
+
+      return (angle >= (etl::math::pi / 2.0)) ? 1.0 : ((sin(angle) + 1.0) / 2.0);
+    }
+
+    //*********************************
+    /// Sorts the buffered values into the centroids and merges neighbours
+    /// as far as the scale function allows.
+    //*********************************
+    void flush() const
+    {
+      if (n_buffered == 0U)
+      {
+        return;
+      }
+
+      const size_t n = n_centroids + n_buffered;
+
+      etl::sort(nodes.begin(), nodes.begin() + n, compare_mean);
+
+      const double total_weight = double(total);
+
+      double before = 0.0; // The weight of the centroids before the current one.
+      double limit  = total_weight * inverse_scale(scale(0.0) + 1.0);
+      size_t out    = 0U;
+
+      centroid current = nodes[0];
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        const double proposed = before + double(current.weight) + double(nodes[i].weight);
+
+        // The last centroid absorbs the rest, if rounding would otherwise leave too many.
+        if ((proposed <= limit) || (out == (Max_Centroids - 1U)))
+        {
+          const double weight = double(current.weight) + double(nodes[i].weight);
+
+          current.mean    = value_type(double(current.mean) + ((double(nodes[i].mean) - double(current.mean)) * (double(nodes[i].weight) / weight)));
+          current.weight += nodes[i].weight;
+        }
+        else
+        {
+          before += double(current.weight);
+          limit   = total_weight * inverse_scale(scale(before / total_weight) + 1.0);
+
+          nodes[out++] = current;
+          current      = nodes[i];
+        }
+      }
+
+      nodes[out++] = current;
+
+      n_centroids = out;
+      n_buffered  = 0U;
+    }
+
+    //*********************************
+    /// Linear interpolation between two points.
+    //*********************************
+    static value_type interpolate(double x0, value_type y0, double x1, value_type y1, double x)
+    {
+      if (x1 <= x0)
+      {
+        return y1;
+      }
+
+      return value_type(double(y0) + ((double(y1) - double(y0)) * ((x - x0) / (x1 - x0))));
+    }
+
+    // The centroids, in order, followed by the buffered values.
+    mutable etl::array<centroid, Max_Centroids + Buffer_Size> nodes;
+    mutable size_t n_centroids;
+    mutable size_t n_buffered;
+    weight_type    total;
+    value_type     minimum;
+    value_type     maximum;
+  };
+}
+
+#endif
@@ -0,0 +1,187 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_COMMAND_QUEUE_INCLUDED
+#define ETL_TIMER_COMMAND_QUEUE_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "timer.h"
+#include "queue_mpmc_atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Queues timer starts and stops from any context, for a timer controller
+  /// that is ticked from a single context.
+  /// start() and stop() push a command to a lock free queue. tick() applies
+  /// the queued commands and then ticks the controller, so an update from
+  /// another thread or an interrupt never causes a tick to be skipped.
+  /// Works with callback_timer, message_timer, callback_timer_wheel and
+  /// message_timer_wheel. All other calls to the controller must be made from
+  /// the context that calls tick().
+  ///\tparam TTimer The timer controller type.
+  ///\tparam SIZE   The maximum number of queued commands. Must be a power of 2.
+  //***************************************************************************
+  template <typename TTimer, const size_t SIZE>
+  class timer_command_queue
+  {
+  public:
+
+    typedef TTimer timer_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit timer_command_queue(TTimer& timer_)
+      : timer(timer_)
+    {
+    }
+
+    //*******************************************
+    /// Queues a start of the timer.
+    /// Returns false if the queue is full.
+    //*******************************************
+    bool start(uint_least16_t id_, bool immediate_ = false)
+    {
+      command cmd = { id_, uint_least8_t(immediate_ ? START_IMMEDIATE : START) };
+
+      return queue.push(cmd);
+    }
+
+    //*******************************************
+    /// Queues a stop of the timer.
+    /// Returns false if the queue is full.
+    //*******************************************
+    bool stop(uint_least16_t id_)
+    {
+      command cmd = { id_, uint_least8_t(STOP) };
+
+      return queue.push(cmd);
+    }
+
+    //*******************************************
+    /// Applies the queued commands, then ticks the timer controller.
+    /// Returns the result of the controller's tick.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      process();
+
+      return timer.tick(count);
+    }
+
+    //*******************************************
+    /// Applies the queued commands, in the order they were queued.
+    //*******************************************
+    void process()
+    {
+      command cmd;
+
+      while (queue.pop(cmd))
+      {
+        switch (cmd.type)
+        {
+          case START:
+          {
+            timer.start(cmd.id, false);
+            break;
+          }
+
+          case START_IMMEDIATE:
+          {
+            timer.start(cmd.id, true);
+            break;
+          }
+
+          default:
+          {
+            timer.stop(cmd.id);
+            break;
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Discards any queued commands.
+    //*******************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+    //*******************************************
+    /// Returns true if no commands are queued.
+    //*******************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// Gets the timer controller.
+    //*******************************************
+    TTimer& get_timer()
+    {
+      return timer;
+    }
+
+  private:
+
+    enum
+    {
+      START,
+      START_IMMEDIATE,
+      STOP
+    };
+
+    struct command
+    {
+      uint_least16_t id;
+      uint_least8_t  type;
+    };
+
+    TTimer& timer;
+    etl::queue_mpmc_atomic<command, SIZE> queue;
+
+    // Disabled.
+    timer_command_queue(const timer_command_queue&) ETL_DELETE;
+    timer_command_queue& operator =(const timer_command_queue&) ETL_DELETE;
+  };
+}
+
+#endif
+
+#endif
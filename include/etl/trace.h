@@ -0,0 +1,356 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRACE_INCLUDED
+#define ETL_TRACE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup trace trace
+/// A timeline of fixed size event records, for finding out what happened and
+/// when, at a cost low enough for interrupt handlers and inner loops.
+/// etl::trace_buffer is a ring of records that may be written from any
+/// context without locks. The oldest records are overwritten.
+///
+/// Defining ETL_TRACE creates one global trace_buffer per core and turns on
+/// the hooks in the ETL. Events are written with ETL_TRACE_EVENT(event, arg1, arg2).
+/// Without ETL_TRACE the hooks compile to nothing.
+/// The following may be defined to configure the global buffers.
+/// ETL_TRACE_SIZE        The number of records per core. A power of two. Default 256.
+/// ETL_TRACE_CORES       The number of cores. Default 1.
+/// ETL_TRACE_CORE_ID()   The index of the current core. Default 0.
+/// ETL_TRACE_TIMESTAMP() A uint32_t timestamp, such as a cycle counter. Default 0.
+///\ingroup utilities
+//*****************************************************************************
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup trace
+  /// The event ids used by the ETL's own hooks.
+  /// Ids up to User_Last are free for the application.
+  //***************************************************************************
+  struct trace_event
+  {
+    enum
+    {
+      User_Last              = 0xFEFFU,
+      Message_Router_Receive = 0xFF00U, ///< arg1 = router id, arg2 = message id.
+      Fsm_State_Change,                 ///< arg1 = old state id, arg2 = new state id.
+      Scheduler_Task_Begin,             ///< arg1 = task priority, arg2 = 0.
+      Scheduler_Task_End,               ///< arg1 = task priority, arg2 = 0.
+      Callback_Timer_Expired,           ///< arg1 = timer id, arg2 = period.
+      Pool_Allocation_Failed            ///< arg1 = item size, arg2 = number of items.
+    };
+  };
+
+  //***************************************************************************
+  ///\ingroup trace
+  /// A trace record.
+  //***************************************************************************
+  struct trace_record
+  {
+    uint32_t timestamp; ///< The timestamp given to write().
+    uint16_t event;     ///< The event id.
+    uint16_t sequence;  ///< The low 16 bits of the record's position in the trace.
+    uint32_t arg1;      ///< The first event argument.
+    uint32_t arg2;      ///< The second event argument.
+  };
+
+  //***************************************************************************
+  ///\ingroup trace
+  /// A ring of trace records.
+  /// write() may be called from any thread or interrupt handler. It claims a
+  /// slot with one atomic increment and never waits or branches on the state
+  /// of the ring.
+  /// Each slot is stamped with its position in the trace once it is complete,
+  /// so read() discards records that are still being written or that were
+  /// overwritten while they were copied.
+  ///\tparam VSize The number of records. A power of two, from 2 to 32768.
+  //***************************************************************************
+  template <size_t VSize>
+  class trace_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VSize >= 2U) && (VSize <= 32768U) && ((VSize & (VSize - 1U)) == 0U), "VSize must be a power of two from 2 to 32768");
+
+    static ETL_CONSTANT size_t SIZE = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    trace_buffer()
+      : next(0U)
+      , first(0U)
+    {
+      for (uint32_t i = 0U; i < VSize; ++i)
+      {
+        slots[i].tag.store(busy_tag(i), etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a record.
+    //*************************************************************************
+    void write(uint32_t timestamp, uint16_t event, uint32_t arg1, uint32_t arg2)
+    {
+      const uint32_t position = next.fetch_add(1U, etl::memory_order_relaxed);
+      slot& s = slots[position & Mask];
+
+      s.tag.store(busy_tag(position), etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      s.timestamp.store(timestamp, etl::memory_order_relaxed);
+      s.arg1.store(arg1, etl::memory_order_relaxed);
+      s.arg2.store(arg2, etl::memory_order_relaxed);
+
+      s.tag.store((uint32_t(uint16_t(position)) << 16U) | event, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Copies up to max_records of the most recent records, oldest first.
+    /// Records that are incomplete, or that are overwritten during the copy,
+    /// are left out.
+    /// Returns the number of records copied.
+    //*************************************************************************
+    size_t read(etl::trace_record* p_records, size_t max_records) const
+    {
+      const uint32_t end   = next.load(etl::memory_order_acquire);
+      size_t         count = available(end);
+
+      if (count > max_records)
+      {
+        count = max_records;
+      }
+
+      size_t n_copied = 0U;
+
+      for (uint32_t position = end - uint32_t(count); position != end; ++position)
+      {
+        const slot& s = slots[position & Mask];
+
+        const uint32_t tag = s.tag.load(etl::memory_order_acquire);
+
+        etl::trace_record record;
+        record.timestamp = s.timestamp.load(etl::memory_order_relaxed);
+        record.arg1      = s.arg1.load(etl::memory_order_relaxed);
+        record.arg2      = s.arg2.load(etl::memory_order_relaxed);
+        record.event     = uint16_t(tag);
+        record.sequence  = uint16_t(tag >> 16U);
+
+        etl::atomic_thread_fence(etl::memory_order_acquire);
+
+        // Keep it if it was complete and did not change while it was copied.
+        if ((record.sequence == uint16_t(position)) && (s.tag.load(etl::memory_order_relaxed) == tag))
+        {
+          p_records[n_copied++] = record;
+        }
+      }
+
+      return n_copied;
+    }
+
+    //*************************************************************************
+    /// Forgets the records written so far.
+    //*************************************************************************
+    void clear()
+    {
+      first.store(next.load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// The number of records written since construction or the last clear(),
+    /// up to the capacity.
+    //*************************************************************************
+    size_t size() const
+    {
+      return available(next.load(etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// True if no records have been written since construction or the last clear().
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of records that the buffer can hold.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t capacity() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// The total number of records written, including those overwritten.
+    /// Wraps at 2^32.
+    //*************************************************************************
+    uint32_t total() const
+    {
+      return next.load(etl::memory_order_relaxed);
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t Mask = uint32_t(VSize - 1U);
+
+    //*************************************************************************
+    /// A slot in the ring.
+    /// The tag holds the sequence in the upper 16 bits and the event in the lower.
+    //*************************************************************************
+    struct slot
+    {
+      etl::atomic<uint32_t> tag;
+      etl::atomic<uint32_t> timestamp;
+      etl::atomic<uint32_t> arg1;
+      etl::atomic<uint32_t> arg2;
+    };
+
+    //*************************************************************************
+    /// The tag of a slot while the record at 'position' is written.
+    /// Its sequence can never match that of a position that maps to the same
+    /// slot, as x + ~x is odd and the positions differ by a multiple of an
+    /// even VSize.
+    //*************************************************************************
+    static uint32_t busy_tag(uint32_t position)
+    {
+      return uint32_t(uint16_t(~position)) << 16U;
+    }
+
+    //*************************************************************************
+    /// The number of readable records when the next position is 'end'.
+    //*************************************************************************
+    size_t available(uint32_t end) const
+    {
+      const uint32_t written = end - first.load(etl::memory_order_relaxed);
+
+      return (written < VSize) ? size_t(written) : VSize;
+    }
+
+    slot                  slots[VSize];
+    etl::atomic<uint32_t> next;  ///< The position of the next record.
+    etl::atomic<uint32_t> first; ///< The position of the first record since clear().
+
+    // Disable copy construction and assignment.
+    trace_buffer(const trace_buffer&);
+    trace_buffer& operator =(const trace_buffer&);
+  };
+
+  template <size_t VSize>
+  ETL_CONSTANT size_t trace_buffer<VSize>::SIZE;
+
+  template <size_t VSize>
+  ETL_CONSTANT uint32_t trace_buffer<VSize>::Mask;
+}
+
+#endif // ETL_HAS_ATOMIC
+
+#if defined(ETL_TRACE)
+
+  #if !ETL_HAS_ATOMIC
+    #error ETL_TRACE requires etl::atomic
+  #endif
+
+  #if !defined(ETL_TRACE_SIZE)
+    #define ETL_TRACE_SIZE 256
+  #endif
+
+  #if !defined(ETL_TRACE_CORES)
+    #define ETL_TRACE_CORES 1
+  #endif
+
+  #if !defined(ETL_TRACE_CORE_ID)
+    #define ETL_TRACE_CORE_ID() 0U
+  #endif
+
+  #if !defined(ETL_TRACE_TIMESTAMP)
+    #define ETL_TRACE_TIMESTAMP() 0U
+  #endif
+
+namespace etl
+{
+  namespace private_trace
+  {
+    //*************************************************************************
+    /// Holds the global trace buffers.
+    /// A template, so that the definition may be in the header.
+    //*************************************************************************
+    template <typename T = void>
+    struct storage
+    {
+      static etl::trace_buffer<ETL_TRACE_SIZE> buffers[ETL_TRACE_CORES];
+    };
+
+    template <typename T>
+    etl::trace_buffer<ETL_TRACE_SIZE> storage<T>::buffers[ETL_TRACE_CORES];
+  }
+
+  //***************************************************************************
+  ///\ingroup trace
+  /// The global trace buffer type.
+  //***************************************************************************
+  typedef etl::trace_buffer<ETL_TRACE_SIZE> global_trace_buffer;
+
+  //***************************************************************************
+  ///\ingroup trace
+  /// Gets the global trace buffer for a core.
+  //***************************************************************************
+  inline etl::global_trace_buffer& get_trace_buffer(size_t core = 0U)
+  {
+    return etl::private_trace::storage<>::buffers[core];
+  }
+
+  //***************************************************************************
+  ///\ingroup trace
+  /// Writes a record to the current core's global trace buffer.
+  //***************************************************************************
+  inline void trace(uint16_t event, uint32_t arg1, uint32_t arg2)
+  {
+    etl::private_trace::storage<>::buffers[ETL_TRACE_CORE_ID()].write(uint32_t(ETL_TRACE_TIMESTAMP()), event, arg1, arg2);
+  }
+}
+
+  #define ETL_TRACE_EVENT(event, arg1, arg2) etl::trace(uint16_t(event), uint32_t(arg1), uint32_t(arg2));
+#else
+  #define ETL_TRACE_EVENT(event, arg1, arg2)
+#endif // ETL_TRACE
+
+#endif
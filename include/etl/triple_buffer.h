@@ -0,0 +1,326 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRIPLE_BUFFER_INCLUDED
+#define ETL_TRIPLE_BUFFER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup triple_buffer triple_buffer
+/// Hands whole frames, such as camera images or blocks of ADC samples, from
+/// one producer to one consumer without copying them.
+/// The producer fills a buffer in place and publishes it. The consumer takes
+/// the most recently published buffer and reads it in place. Publishing and
+/// taking exchange buffer indexes, never the contents.
+/// The buffers may hold the frames themselves, or descriptors from an
+/// etl::buffer_descriptors, so that the frame memory is shared with a DMA
+/// controller.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup triple_buffer
+  /// A wait free latest value exchange between one producer and one consumer.
+  /// The producer always has a buffer to write to and the consumer always has
+  /// a buffer to read from, so neither waits for the other. Frames that the
+  /// consumer is too slow to take are overwritten by later ones.
+  /// The producer and consumer may be on different cores.
+  ///\tparam T The type of a buffer.
+  //***************************************************************************
+  template <typename T>
+  class triple_buffer
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// The buffers are default constructed.
+    //*************************************************************************
+    triple_buffer()
+      : back(2U)
+      , front(0U)
+      , state(1U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs with each buffer set to value.
+    //*************************************************************************
+    explicit triple_buffer(const T& value)
+      : back(2U)
+      , front(0U)
+      , state(1U)
+    {
+      buffers[0] = value;
+      buffers[1] = value;
+      buffers[2] = value;
+    }
+
+    //*************************************************************************
+    /// The buffer that the producer fills.
+    /// Producer only.
+    //*************************************************************************
+    T& write_buffer()
+    {
+      return buffers[back];
+    }
+
+    //*************************************************************************
+    /// Publishes the write buffer, and gives the producer a new one.
+    /// Returns <b>true</b> if the previously published buffer had not been
+    /// taken by the consumer. It is then the new write buffer, which lets the
+    /// producer release any resources that it refers to.
+    /// Producer only.
+    //*************************************************************************
+    bool publish()
+    {
+      const uint8_t previous = state.exchange(uint8_t(back | Fresh), etl::memory_order_acq_rel);
+
+      back = uint8_t(previous & Index_Mask);
+
+      return (previous & Fresh) != 0U;
+    }
+
+    //*************************************************************************
+    /// True if a buffer has been published since the consumer last took one.
+    //*************************************************************************
+    bool has_new_data() const
+    {
+      return (state.load(etl::memory_order_acquire) & Fresh) != 0U;
+    }
+
+    //*************************************************************************
+    /// Takes the most recently published buffer, if there is a new one.
+    /// The previous read buffer is given back to the producer, so any use of
+    /// it must be finished first.
+    /// Returns <b>true</b> if the read buffer changed.
+    /// Consumer only.
+    //*************************************************************************
+    bool update()
+    {
+      if (!has_new_data())
+      {
+        return false;
+      }
+
+      // Only the consumer clears the flag, so it is still set here.
+      const uint8_t previous = state.exchange(front, etl::memory_order_acq_rel);
+
+      front = uint8_t(previous & Index_Mask);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The buffer that the consumer reads.
+    /// Consumer only.
+    //*************************************************************************
+    T& read_buffer()
+    {
+      return buffers[front];
+    }
+
+    //*************************************************************************
+    /// The buffer that the consumer reads.
+    /// Consumer only.
+    //*************************************************************************
+    const T& read_buffer() const
+    {
+      return buffers[front];
+    }
+
+  private:
+
+    // The shared state holds the index of the middle buffer, and whether it
+    // has been published since the consumer last took it.
+    static ETL_CONSTANT uint8_t Index_Mask = 0x03U;
+    static ETL_CONSTANT uint8_t Fresh      = 0x04U;
+
+    // Disable copy construction and assignment.
+    triple_buffer(const triple_buffer&) ETL_DELETE;
+    triple_buffer& operator =(const triple_buffer&) ETL_DELETE;
+
+    T                    buffers[3];
+    uint8_t              back;  ///< Owned by the producer.
+    uint8_t              front; ///< Owned by the consumer.
+    etl::atomic<uint8_t> state;
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint8_t triple_buffer<T>::Index_Mask;
+
+  template <typename T>
+  ETL_CONSTANT uint8_t triple_buffer<T>::Fresh;
+
+  //***************************************************************************
+  ///\ingroup triple_buffer
+  /// A double buffer, where the producer is typically an interrupt, such as a
+  /// DMA complete interrupt, that swaps the buffers after filling one.
+  /// Uses a third less memory than etl::triple_buffer, but the buffer that
+  /// the producer moves on to is the one that the consumer was reading, so the
+  /// consumer must finish with a frame within one frame period.
+  ///\tparam T The type of a buffer.
+  //***************************************************************************
+  template <typename T>
+  class double_buffer
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// The buffers are default constructed.
+    //*************************************************************************
+    double_buffer()
+      : back(1U)
+      , front(0U)
+      , state(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs with each buffer set to value.
+    //*************************************************************************
+    explicit double_buffer(const T& value)
+      : back(1U)
+      , front(0U)
+      , state(0U)
+    {
+      buffers[0] = value;
+      buffers[1] = value;
+    }
+
+    //*************************************************************************
+    /// The buffer that the producer fills.
+    /// Producer only.
+    //*************************************************************************
+    T& write_buffer()
+    {
+      return buffers[back];
+    }
+
+    //*************************************************************************
+    /// Publishes the write buffer, and makes the other one the write buffer.
+    /// Returns <b>true</b> if the previously published buffer had not been
+    /// taken by the consumer.
+    /// Producer only. May be called from an interrupt.
+    //*************************************************************************
+    bool swap()
+    {
+      const uint8_t previous = state.exchange(uint8_t(back | Fresh), etl::memory_order_acq_rel);
+
+      back = uint8_t(back ^ Index_Mask);
+
+      return (previous & Fresh) != 0U;
+    }
+
+    //*************************************************************************
+    /// True if a buffer has been published since the consumer last took one.
+    //*************************************************************************
+    bool has_new_data() const
+    {
+      return (state.load(etl::memory_order_acquire) & Fresh) != 0U;
+    }
+
+    //*************************************************************************
+    /// Takes the most recently published buffer, if there is a new one.
+    /// Returns <b>true</b> if there was a new one.
+    /// Consumer only.
+    //*************************************************************************
+    bool update()
+    {
+      if (!has_new_data())
+      {
+        return false;
+      }
+
+      const uint8_t previous = state.fetch_and(uint8_t(~Fresh), etl::memory_order_acq_rel);
+
+      front = uint8_t(previous & Index_Mask);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The buffer that the consumer reads.
+    /// Consumer only.
+    //*************************************************************************
+    T& read_buffer()
+    {
+      return buffers[front];
+    }
+
+    //*************************************************************************
+    /// The buffer that the consumer reads.
+    /// Consumer only.
+    //*************************************************************************
+    const T& read_buffer() const
+    {
+      return buffers[front];
+    }
+
+  private:
+
+    // The shared state holds the index of the published buffer, and whether
+    // it has been published since the consumer last took it.
+    static ETL_CONSTANT uint8_t Index_Mask = 0x01U;
+    static ETL_CONSTANT uint8_t Fresh      = 0x02U;
+
+    // Disable copy construction and assignment.
+    double_buffer(const double_buffer&) ETL_DELETE;
+    double_buffer& operator =(const double_buffer&) ETL_DELETE;
+
+    T                    buffers[2];
+    uint8_t              back;  ///< Owned by the producer.
+    uint8_t              front; ///< Owned by the consumer.
+    etl::atomic<uint8_t> state;
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint8_t double_buffer<T>::Index_Mask;
+
+  template <typename T>
+  ETL_CONSTANT uint8_t double_buffer<T>::Fresh;
+}
+
+#endif
+#endif
@@ -1591,6 +1591,22 @@ namespace etl
   template <typename T, typename T1, typename... TRest>
   inline constexpr bool are_all_same_v = are_all_same<T, T1, TRest...>::value;
 #endif
+
+  //***************************************************************************
+  /// is_trivially_relocatable
+  /// True if an object may be moved to a new address with a plain memory copy,
+  /// leaving the source as raw storage without running its destructor.
+  /// Defaults to is_trivially_copyable. Specialise for types that hold no
+  /// pointers into themselves but have user defined copy or destruction.
+  /// Types that point into their own storage, such as etl::string and
+  /// etl::vector, must not be specialised.
+  ///\ingroup types
+  template <typename T> struct is_trivially_relocatable : etl::is_trivially_copyable<T> {};
+
+#if ETL_CPP17_SUPPORTED
+  template <typename T>
+  inline constexpr bool is_trivially_relocatable_v = etl::is_trivially_relocatable<T>::value;
+#endif
 }
 
 #endif // ETL_TYPE_TRAITS_INCLUDED
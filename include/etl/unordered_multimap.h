@@ -52,6 +52,9 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 #include "placement_new.h"
+#include "private/node_handle.h"
+#include "private/unordered_hash_cache.h"
+#include "private/unordered_statistics.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -149,7 +152,8 @@ namespace etl
 
     typedef etl::forward_link<0> link_t; // Default link.
 
-    struct node_t : public link_t // The nodes that store the elements.
+    // The nodes that store the elements.
+    struct node_t : public link_t, public etl::private_unordered::node_hash<etl::is_cached_hash<THash>::value>
     {
       node_t(const_reference key_value_pair_)
         : key_value_pair(key_value_pair_)
@@ -467,6 +471,31 @@ namespace etl
 
     typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Owns a node that has been extracted from an unordered_multimap.
+    /// The node still occupies a place in the pool of the unordered_multimap it came
+    /// from, but is not counted in its size.
+    //*********************************************************************
+    class node_type : public etl::private_node_handle::key_value_node_handle<TKey, T>
+    {
+    public:
+
+      node_type()
+      {
+      }
+
+    private:
+
+      friend class iunordered_multimap;
+
+      node_type(node_t& node, etl::ipool& pool, size_t* p_extracted)
+        : etl::private_node_handle::key_value_node_handle<TKey, T>(&node, &node.key_value_pair, &pool, p_extracted)
+      {
+      }
+    };
+#endif
+
     //*********************************************************************
     /// Returns an iterator to the beginning of the unordered_multimap.
     ///\return An iterator to the beginning of the unordered_multimap.
@@ -584,6 +613,19 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns the bucket index for the key.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\return The bucket index for the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -644,158 +686,263 @@ namespace etl
     //*********************************************************************
     iterator insert(const_reference key_value_pair)
     {
-      iterator result = end();
-
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+      return insert_hashed(key_value_pair, key_hash_function(key_value_pair.first));
+    }
 
-      const key_type&    key = key_value_pair.first;
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    iterator insert(rvalue_reference key_value_pair)
+    {
+      return insert_hashed(etl::move(key_value_pair), key_hash_function(key_value_pair.first));
+    }
+#endif
 
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
+    //*********************************************************************
+    /// Inserts a value to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair);
+    }
 
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value to the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair));
+    }
+#endif
 
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key_value_pair) value_type(key_value_pair);
-        ETL_INCREMENT_DEBUG_COUNT
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-        // Just add the pointer to the bucket;
-        bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(pbucket);
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key_value_pair) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
-      }
-      else
-      {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
+      return emplace_node(node);
+    }
 
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key_value_pair.first == key)
-          {
-            break;
-          }
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator /*position*/, Args && ... args)
+    {
+      return emplace(etl::forward<Args>(args)...);
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    //*********************************************************************
+    template <typename T1>
+    iterator emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-          ++inode_previous;
-          ++inode;
-        }
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key_value_pair) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
 
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key_value_pair) value_type(key_value_pair);
-        ETL_INCREMENT_DEBUG_COUNT
+      return emplace_node(node);
+    }
 
-        // Add the node to the end of the bucket;
-        bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
-        ++inode_previous;
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
-      }
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key_value_pair) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
 
-      return result;
+      return emplace_node(node);
     }
 
-#if ETL_CPP11_SUPPORTED
     //*********************************************************************
-    /// Inserts a value to the unordered_multimap.
+    /// Constructs a value in place in the unordered_multimap.
     /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
-    ///\param value The value to insert.
     //*********************************************************************
-    iterator insert(rvalue_reference key_value_pair)
+    template <typename T1, typename T2, typename T3>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3)
     {
-      iterator result = end();
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key_value_pair) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
+    }
 
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
       ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
 
-      const key_type&    key = key_value_pair.first;
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key_value_pair) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
 
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
+      return emplace_node(node);
+    }
 
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1)
+    {
+      return emplace(value1);
+    }
 
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
-        ETL_INCREMENT_DEBUG_COUNT
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2)
+    {
+      return emplace(value1, value2);
+    }
 
-          // Just add the pointer to the bucket;
-          bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(pbucket);
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace(value1, value2, value3);
+    }
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
-      }
-      else
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_multimap.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace(value1, value2, value3, value4);
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a node extracted from an unordered_multimap of the same type.
+    /// A node from this unordered_multimap is relinked, otherwise its value is moved
+    /// into a new node and the old one is released.
+    ///\return An iterator to the inserted element, or end() if the node was
+    /// empty.
+    //*********************************************************************
+    iterator insert(node_type&& node)
+    {
+      if (node.empty())
       {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
+        return end();
+      }
 
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key_value_pair.first == key)
-          {
-            break;
-          }
+      return emplace_node(claim_node(node));
+    }
 
-          ++inode_previous;
-          ++inode;
-        }
+    //*********************************************************************
+    /// Inserts a node extracted from an unordered_multimap of the same type.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, node_type&& node)
+    {
+      return insert(etl::move(node));
+    }
 
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
-        ETL_INCREMENT_DEBUG_COUNT
+    //*********************************************************************
+    /// Unlinks the element at the specified position and returns ownership
+    /// of its node.
+    //*********************************************************************
+    node_type extract(const_iterator ielement)
+    {
+      bucket_t&      bucket    = ielement.get_bucket();
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent  = ielement.get_local_iterator();
 
-          // Add the node to the end of the bucket;
-          bucket.insert_after(inode_previous, node);
-        adjust_first_last_markers_after_insert(&bucket);
-        ++inode_previous;
+      // Find the node previous to the one we're interested in.
+      while (iprevious->etl_next != &*icurrent)
+      {
+        ++iprevious;
+      }
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+      bucket.erase_after(iprevious); // Unlink from the bucket.
+      ++extracted_count;
+      adjust_first_last_markers_after_erase(&bucket);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      return node_type(*icurrent, *pnodepool, &extracted_count);
+    }
+
+    //*********************************************************************
+    /// Unlinks the first element with the specified key and returns
+    /// ownership of its node. The handle is empty if the key is not present.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      const_iterator ielement = find(key);
+
+      if (ielement == cend())
+      {
+        return node_type();
       }
 
-      return result;
+      return extract(ielement);
     }
-#endif
 
     //*********************************************************************
-    /// Inserts a value to the unordered_multimap.
-    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
-    ///\param position The position to insert at.
-    ///\param value    The value to insert.
+    /// Moves all of the elements of another unordered_multimap into this one.
     //*********************************************************************
-    iterator insert(const_iterator, const_reference key_value_pair)
+    void merge(iunordered_multimap& other)
     {
-      return insert(key_value_pair);
+      if (&other != this)
+      {
+        while (!other.empty())
+        {
+          insert(other.extract(other.cbegin()));
+        }
+      }
     }
 
-#if ETL_CPP11_SUPPORTED
     //*********************************************************************
-    /// Inserts a value to the unordered_multimap.
-    /// If asserts or exceptions are enabled, emits unordered_multimap_full if the unordered_multimap is already full.
-    ///\param position The position to insert at.
-    ///\param value    The value to insert.
+    /// Moves all of the elements of another unordered_multimap into this one.
     //*********************************************************************
-    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    void merge(iunordered_multimap&& other)
     {
-      return insert(etl::move(key_value_pair));
+      merge(other);
     }
 #endif
 
@@ -823,7 +970,8 @@ namespace etl
     size_t erase(key_parameter_t key)
     {
       size_t n = 0;
-      size_t bucket_id = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t bucket_id = hash % number_of_buckets;
 
       bucket_t& bucket = pbuckets[bucket_id];
 
@@ -832,7 +980,7 @@ namespace etl
 
       while (icurrent != bucket.end())
       {
-        if (icurrent->key_value_pair.first == key)
+        if (keys_match(*icurrent, hash, key))
         {
           bucket.erase_after(iprevious);          // Unlink from the bucket.
           icurrent->key_value_pair.~value_type(); // Destroy the value.
@@ -842,6 +990,11 @@ namespace etl
           icurrent = iprevious;
           ETL_DECREMENT_DEBUG_COUNT
         }
+        else if (n != 0U)
+        {
+          // Past the group of equal keys.
+          break;
+        }
         else
         {
           ++iprevious;
@@ -958,29 +1111,59 @@ namespace etl
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
-    ///\return 1 if the key exists, otherwise 0.
+    ///\return The number of elements with the key.
     //*********************************************************************
     size_t count(key_parameter_t key) const
     {
-      size_t n = 0;
-      const_iterator f = find(key);
-      const_iterator l = f;
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
 
-      if (l != end())
-      {
-        ++l;
-        ++n;
+      return find_group(key, pbucket, ifirst, ilast);
+    }
 
-        while ((l != end()) && (key == l->first))
-        {
-          ++l;
-          ++n;
-        }
-      }
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return The number of elements with the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
 
-      return n;
+      return find_group(key, pbucket, ifirst, ilast);
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -988,7 +1171,46 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (keys_match(*inode, hash, key))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1003,7 +1225,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (keys_match(*inode, hash, key))
           {
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1014,6 +1236,7 @@ namespace etl
 
       return end();
     }
+#endif
 
     //*********************************************************************
     /// Finds an element.
@@ -1022,7 +1245,46 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      size_t index = get_bucket_index(key);
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (keys_match(*inode, hash, key))
+          {
+            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
@@ -1037,7 +1299,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key_value_pair.first))
+          if (keys_match(*inode, hash, key))
           {
             return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
@@ -1048,6 +1310,7 @@ namespace etl
 
       return end();
     }
+#endif
 
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
@@ -1059,21 +1322,51 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator f = find(key);
-      iterator l = f;
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
 
-      if (l != end())
+      if (find_group(key, pbucket, ifirst, ilast) == 0U)
       {
-        ++l;
+        return ETL_OR_STD::pair<iterator, iterator>(end(), end());
+      }
 
-        while ((l != end()) && (key == l->first))
-        {
-          ++l;
-        }
+      iterator f((pbuckets + number_of_buckets), pbucket, ifirst);
+      iterator l((pbuckets + number_of_buckets), pbucket, ilast);
+      ++l;
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// Only available if the hasher and key_equal are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
+
+      if (find_group(key, pbucket, ifirst, ilast) == 0U)
+      {
+        return ETL_OR_STD::pair<iterator, iterator>(end(), end());
       }
 
+      iterator f((pbuckets + number_of_buckets), pbucket, ifirst);
+      iterator l((pbuckets + number_of_buckets), pbucket, ilast);
+      ++l;
+
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
+#endif
 
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
@@ -1085,28 +1378,58 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator f = find(key);
-      const_iterator l = f;
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
 
-      if (l != end())
+      if (find_group(key, pbucket, ifirst, ilast) == 0U)
       {
-        ++l;
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(end(), end());
+      }
 
-        while ((l != end()) && (key == l->first))
-        {
-          ++l;
-        }
+      const_iterator f((pbuckets + number_of_buckets), pbucket, ifirst);
+      const_iterator l((pbuckets + number_of_buckets), pbucket, ilast);
+      ++l;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// Only available if the hasher and key_equal are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      bucket_t*      pbucket;
+      local_iterator ifirst;
+      local_iterator ilast;
+
+      if (find_group(key, pbucket, ifirst, ilast) == 0U)
+      {
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(end(), end());
       }
 
+      const_iterator f((pbuckets + number_of_buckets), pbucket, ifirst);
+      const_iterator l((pbuckets + number_of_buckets), pbucket, ilast);
+      ++l;
+
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
+#endif
 
     //*************************************************************************
     /// Gets the size of the unordered_multimap.
     //*************************************************************************
     size_type size() const
     {
-      return pnodepool->size();
+      return pnodepool->size() - extracted_count;
     }
 
     //*************************************************************************
@@ -1130,7 +1453,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return pnodepool->empty();
+      return pnodepool->size() == extracted_count;
     }
 
     //*************************************************************************
@@ -1159,6 +1482,27 @@ namespace etl
       return static_cast<float>(size()) / static_cast<float>(bucket_count());
     }
 
+    //*************************************************************************
+    /// Returns statistics on how the elements are spread among the buckets and the memory used.
+    ///\return The statistics.
+    //*************************************************************************
+    etl::unordered_statistics statistics() const
+    {
+      return etl::private_unordered::get_statistics(pbuckets, number_of_buckets, sizeof(node_t), max_size());
+    }
+
+    //*************************************************************************
+    /// Adds the number of elements in each bucket to a histogram that starts at 0.
+    /// Buckets with more elements than the last bin are counted in the last bin.
+    /// e.g. etl::histogram<size_t, uint16_t, 8, 0>
+    ///\param histogram The histogram to add to.
+    //*************************************************************************
+    template <typename THistogram>
+    void bucket_histogram(THistogram& histogram) const
+    {
+      etl::private_unordered::add_chain_lengths(pbuckets, number_of_buckets, histogram);
+    }
+
     //*************************************************************************
     /// Returns the function that hashes the keys.
     ///\return The function that hashes the keys..
@@ -1185,7 +1529,7 @@ namespace etl
       // Skip if doing self assignment
       if (this != &rhs)
       {
-        assign(rhs.cbegin(), rhs.cend());
+        copy(rhs);
       }
 
       return *this;
@@ -1215,7 +1559,8 @@ namespace etl
     iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
       : pnodepool(&node_pool_),
         pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
+        number_of_buckets(number_of_buckets_),
+        extracted_count(0U)
     {
     }
 
@@ -1238,10 +1583,17 @@ namespace etl
 
             while (it != bucket.end())
             {
+              node_t& node = *it++;
+
               // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ++it;
+              node.key_value_pair.~value_type();
               ETL_DECREMENT_DEBUG_COUNT
+
+              // Nodes held by node handles stay allocated, so release individually.
+              if (extracted_count != 0U)
+              {
+                pnodepool->release(&node);
+              }
             }
 
             // Now it's safe to clear the bucket.
@@ -1250,13 +1602,32 @@ namespace etl
         }
 
         // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
+        if (extracted_count == 0U)
+        {
+          pnodepool->release_all();
+        }
       }
 
       first = pbuckets;
       last = first;
     }
 
+    //*************************************************************************
+    /// Copy from another unordered_multimap, reusing the hashes of its elements.
+    //*************************************************************************
+    void copy(const iunordered_multimap& other)
+    {
+      clear();
+
+      const_iterator itr = other.cbegin();
+
+      while (itr != other.cend())
+      {
+        insert_hashed(*itr, other.get_node_hash(*itr.get_local_iterator()));
+        ++itr;
+      }
+    }
+
 #if ETL_CPP11_SUPPORTED
     //*************************************************************************
     /// Move from a range
@@ -1265,7 +1636,9 @@ namespace etl
     {
       while (first != last)
       {
-        insert(etl::move(*first++));
+        const size_t hash = get_node_hash(*first.get_local_iterator());
+
+        insert_hashed(etl::move(*first++), hash);
       }
     }
 #endif
@@ -1281,6 +1654,268 @@ namespace etl
       return *(pnodepool->*func)();
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Takes the node from a handle. A node from another pool has its value
+    /// moved into a new node from this pool.
+    //*********************************************************************
+    node_t& claim_node(node_type& node)
+    {
+      if (node.get_pool() == pnodepool)
+      {
+        ETL_INCREMENT_DEBUG_COUNT
+        return *static_cast<node_t*>(node.release());
+      }
+      else
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+
+        node_t& new_node = create_data_node();
+        ::new (&new_node.key_value_pair) value_type(etl::move(node.get_value()));
+        ETL_INCREMENT_DEBUG_COUNT
+        node.reset();
+
+        return new_node;
+      }
+    }
+#endif
+
+    //*********************************************************************
+    /// Links a node whose value has been constructed into its bucket.
+    //*********************************************************************
+    iterator emplace_node(node_t& node)
+    {
+      const key_type& key  = node.key_value_pair.first;
+      const size_t    hash = key_hash_function(key);
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      bucket_t& bucket  = *pbucket;
+
+      node.set_hash(hash);
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode          = bucket.begin();
+
+      while ((inode != bucket.end()) && !keys_match(*inode, hash, key))
+      {
+        ++inode_previous;
+        ++inode;
+      }
+
+      bucket.insert_after(inode_previous, node);
+      adjust_first_last_markers_after_insert(pbucket);
+      ++inode_previous;
+
+      return iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+    }
+
+    //*********************************************************************
+    /// Inserts a value with a known hash.
+    //*********************************************************************
+    iterator insert_hashed(const_reference key_value_pair, size_t hash)
+    {
+      iterator result = end();
+
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+
+      const key_type&    key = key_value_pair.first;
+
+      // Get the hash index.
+      size_t index = hash % number_of_buckets;
+
+      // Get the bucket & bucket iterator.
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // The first one in the bucket?
+      if (bucket.empty())
+      {
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key_value_pair) value_type(key_value_pair);
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Just add the pointer to the bucket;
+        bucket.insert_after(bucket.before_begin(), node);
+        adjust_first_last_markers_after_insert(pbucket);
+
+        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+      }
+      else
+      {
+        // Step though the bucket looking for a place to insert.
+        local_iterator inode_previous = bucket.before_begin();
+        local_iterator inode = bucket.begin();
+
+        while (inode != bucket.end())
+        {
+          // Do we already have this key?
+          if (keys_match(*inode, hash, key))
+          {
+            break;
+          }
+
+          ++inode_previous;
+          ++inode;
+        }
+
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key_value_pair) value_type(key_value_pair);
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Add the node to the end of the bucket;
+        bucket.insert_after(inode_previous, node);
+        adjust_first_last_markers_after_insert(&bucket);
+        ++inode_previous;
+
+        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+      }
+
+      return result;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value with a known hash.
+    //*********************************************************************
+    iterator insert_hashed(rvalue_reference key_value_pair, size_t hash)
+    {
+      iterator result = end();
+
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_multimap_full));
+
+      const key_type&    key = key_value_pair.first;
+
+      // Get the hash index.
+      size_t index = hash % number_of_buckets;
+
+      // Get the bucket & bucket iterator.
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // The first one in the bucket?
+      if (bucket.empty())
+      {
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Just add the pointer to the bucket;
+        bucket.insert_after(bucket.before_begin(), node);
+        adjust_first_last_markers_after_insert(pbucket);
+
+        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+      }
+      else
+      {
+        // Step though the bucket looking for a place to insert.
+        local_iterator inode_previous = bucket.before_begin();
+        local_iterator inode = bucket.begin();
+
+        while (inode != bucket.end())
+        {
+          // Do we already have this key?
+          if (keys_match(*inode, hash, key))
+          {
+            break;
+          }
+
+          ++inode_previous;
+          ++inode;
+        }
+
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key_value_pair) value_type(etl::move(key_value_pair));
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+          // Add the node to the end of the bucket;
+          bucket.insert_after(inode_previous, node);
+        adjust_first_last_markers_after_insert(&bucket);
+        ++inode_previous;
+
+        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+      }
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the group of nodes holding the key and returns its size.
+    /// Equal keys are always adjacent in their bucket, as every insert links
+    /// the new node in front of the first one with the same key, and erasing
+    /// nodes cannot separate the others. The search stops at the end of the
+    /// group, rather than walking the rest of the bucket or the container.
+    //*********************************************************************
+    template <typename K>
+    size_t find_group(const K& key, bucket_t*& pbucket, local_iterator& ifirst, local_iterator& ilast) const
+    {
+      const size_t hash = key_hash_function(key);
+
+      pbucket = pbuckets + (hash % number_of_buckets);
+
+      local_iterator inode = pbucket->begin();
+      local_iterator iend  = pbucket->end();
+
+      while ((inode != iend) && !keys_match(*inode, hash, key))
+      {
+        ++inode;
+      }
+
+      ifirst = inode;
+      ilast  = inode;
+
+      size_t n = 0U;
+
+      while ((inode != iend) && keys_match(*inode, hash, key))
+      {
+        ilast = inode;
+        ++inode;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*********************************************************************
+    /// Checks if the node holds the key.
+    /// The keys are only compared if the node's hash matches.
+    //*********************************************************************
+    template <typename K>
+    bool keys_match(const node_t& node, size_t hash, const K& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key_value_pair.first);
+    }
+
+    //*********************************************************************
+    /// Gets the hash of the key held by the node.
+    /// The stored hash is used if the hasher is a cached_hash.
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node) const
+    {
+      return get_node_hash(node, etl::is_cached_hash<THash>());
+    }
+
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node, etl::true_type) const
+    {
+      return node.hash;
+    }
+
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node, etl::false_type) const
+    {
+      return key_hash_function(node.key_value_pair.first);
+    }
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1361,6 +1996,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The number of nodes from the pool that are held by node handles.
+    size_t extracted_count;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1449,7 +2087,7 @@ namespace etl
       // Skip if doing self assignment
       if (this != &other)
       {
-        base::assign(other.cbegin(), other.cend());
+        base::copy(other);
       }
     }
 
@@ -1508,7 +2146,7 @@ namespace etl
       // Skip if doing self assignment
       if (this != &rhs)
       {
-        base::assign(rhs.cbegin(), rhs.cend());
+        base::copy(rhs);
       }
 
       return *this;
@@ -52,6 +52,9 @@ SOFTWARE.
 #include "debug_count.h"
 #include "iterator.h"
 #include "placement_new.h"
+#include "private/node_handle.h"
+#include "private/unordered_hash_cache.h"
+#include "private/unordered_statistics.h"
 
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && ETL_USING_STL
   #include <initializer_list>
@@ -148,7 +151,7 @@ namespace etl
     typedef etl::forward_link<0> link_t;
 
     // The nodes that store the elements.
-    struct node_t : public link_t
+    struct node_t : public link_t, public etl::private_unordered::node_hash<etl::is_cached_hash<THash>::value>
     {
       node_t(const_reference key_)
         : key(key_)
@@ -464,6 +467,41 @@ namespace etl
 
     typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Owns a node that has been extracted from an unordered_set.
+    /// The node still occupies a place in the pool of the unordered_set it came
+    /// from, but is not counted in its size.
+    //*********************************************************************
+    class node_type : public etl::private_node_handle::value_node_handle<TKey>
+    {
+    public:
+
+      node_type()
+      {
+      }
+
+    private:
+
+      friend class iunordered_set;
+
+      node_type(node_t& node, etl::ipool& pool, size_t* p_extracted)
+        : etl::private_node_handle::value_node_handle<TKey>(&node, &node.key, &pool, p_extracted)
+      {
+      }
+    };
+
+    //*********************************************************************
+    /// The result of inserting a node.
+    //*********************************************************************
+    struct insert_return_type
+    {
+      iterator  position;
+      bool      inserted;
+      node_type node;
+    };
+#endif
+
     //*********************************************************************
     /// Returns an iterator to the beginning of the unordered_set.
     ///\return An iterator to the beginning of the unordered_set.
@@ -581,6 +619,19 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns the bucket index for the key.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\return The bucket index for the key.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -641,69 +692,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(const_reference key)
     {
-      ETL_OR_STD::pair<iterator, bool> result(end(), false);
-
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
-
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
-
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key) value_type(key);
-        ETL_INCREMENT_DEBUG_COUNT
-
-        // Just add the pointer to the bucket;
-        bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
-
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
-        result.second = true;
-      }
-      else
-      {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
-
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key == key)
-          {
-            break;
-          }
-
-          ++inode_previous;
-          ++inode;
-        }
-
-        // Not already there?
-        if (inode == bucket.end())
-        {
-          // Get a new node.
-          node_t& node = create_data_node();
-          ::new (&node.key) value_type(key);
-          ETL_INCREMENT_DEBUG_COUNT
-
-          // Add the node to the end of the bucket;
-          bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
-          ++inode_previous;
-
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
-          result.second = true;
-        }
-      }
-
-      return result;
+      return insert_hashed(key, key_hash_function(key));
     }
 
 #if ETL_CPP11_SUPPORTED
@@ -714,69 +703,7 @@ namespace etl
     //*********************************************************************
     ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
     {
-      ETL_OR_STD::pair<iterator, bool> result(end(), false);
-
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
-
-      // Get the hash index.
-      size_t index = get_bucket_index(key);
-
-      // Get the bucket & bucket iterator.
-      bucket_t* pbucket = pbuckets + index;
-      bucket_t& bucket = *pbucket;
-
-      // The first one in the bucket?
-      if (bucket.empty())
-      {
-        // Get a new node.
-        node_t& node = create_data_node();
-        ::new (&node.key) value_type(etl::move(key));
-        ETL_INCREMENT_DEBUG_COUNT
-
-          // Just add the pointer to the bucket;
-          bucket.insert_after(bucket.before_begin(), node);
-        adjust_first_last_markers_after_insert(&bucket);
-
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
-        result.second = true;
-      }
-      else
-      {
-        // Step though the bucket looking for a place to insert.
-        local_iterator inode_previous = bucket.before_begin();
-        local_iterator inode = bucket.begin();
-
-        while (inode != bucket.end())
-        {
-          // Do we already have this key?
-          if (inode->key == key)
-          {
-            break;
-          }
-
-          ++inode_previous;
-          ++inode;
-        }
-
-        // Not already there?
-        if (inode == bucket.end())
-        {
-          // Get a new node.
-          node_t& node = create_data_node();
-          ::new (&node.key) value_type(etl::move(key));
-          ETL_INCREMENT_DEBUG_COUNT
-
-            // Add the node to the end of the bucket;
-            bucket.insert_after(inode_previous, node);
-          adjust_first_last_markers_after_insert(&bucket);
-          ++inode_previous;
-
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
-          result.second = true;
-        }
-      }
-
-      return result;
+      return insert_hashed(etl::move(key), key_hash_function(key));
     }
 #endif
 
@@ -804,111 +731,429 @@ namespace etl
     }
 #endif
 
+#if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT
     //*********************************************************************
-    /// Inserts a range of values to the unordered_set.
-    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set does not have enough free space.
-    ///\param position The position to insert at.
-    ///\param first    The first element to add.
-    ///\param last     The last + 1 element to add.
+    /// Constructs a value in place in the unordered_set.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
     //*********************************************************************
-    template <class TIterator>
-    void insert(TIterator first_, TIterator last_)
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args && ... args)
     {
-      while (first_ != last_)
-      {
-        insert(*first_++);
-      }
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key) value_type(etl::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
     }
 
     //*********************************************************************
-    /// Erases an element.
-    ///\param key The key to erase.
-    ///\return The number of elements erased. 0 or 1.
+    /// Constructs a value in place in the unordered_set.
+    /// The position is only a hint, and is ignored.
     //*********************************************************************
-    size_t erase(key_parameter_t key)
+    template <typename ... Args>
+    iterator emplace_hint(const_iterator /*position*/, Args && ... args)
     {
-      size_t n = 0;
-      size_t index = get_bucket_index(key);
+      return emplace(etl::forward<Args>(args)...).first;
+    }
+#else
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    //*********************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
-      bucket_t& bucket = pbuckets[index];
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key) value_type(value1);
+      ETL_INCREMENT_DEBUG_COUNT
 
-      local_iterator iprevious = bucket.before_begin();
-      local_iterator icurrent = bucket.begin();
+      return emplace_node(node);
+    }
 
-      // Search for the key, if we have it.
-      while ((icurrent != bucket.end()) && (icurrent->key != key))
-      {
-        ++iprevious;
-        ++icurrent;
-      }
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
-      // Did we find it?
-      if (icurrent != bucket.end())
-      {
-        bucket.erase_after(iprevious);  // Unlink from the bucket.
-        icurrent->key.~value_type();    // Destroy the value.
-        pnodepool->release(&*icurrent); // Release it back to the pool.
-        adjust_first_last_markers_after_erase(&bucket);
-        n = 1;
-        ETL_DECREMENT_DEBUG_COUNT
-      }
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key) value_type(value1, value2);
+      ETL_INCREMENT_DEBUG_COUNT
 
-      return n;
+      return emplace_node(node);
     }
 
     //*********************************************************************
-    /// Erases an element.
-    ///\param ielement Iterator to the element.
+    /// Constructs a value in place in the unordered_set.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
     //*********************************************************************
-    iterator erase(const_iterator ielement)
+    template <typename T1, typename T2, typename T3>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3)
     {
-      // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
-      ++inext;
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
-      bucket_t&      bucket = ielement.get_bucket();
-      local_iterator iprevious = bucket.before_begin();
-      local_iterator icurrent = ielement.get_local_iterator();
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key) value_type(value1, value2, value3);
+      ETL_INCREMENT_DEBUG_COUNT
 
-      // Find the node previous to the one we're interested in.
-      while (iprevious->etl_next != &*icurrent)
-      {
-        ++iprevious;
-      }
+      return emplace_node(node);
+    }
 
-      bucket.erase_after(iprevious);  // Unlink from the bucket.
-      icurrent->key.~value_type();    // Destroy the value.
-      pnodepool->release(&*icurrent); // Release it back to the pool.
-      adjust_first_last_markers_after_erase(&bucket);
-      ETL_DECREMENT_DEBUG_COUNT
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// If the key is already present, the new value is destroyed, and the
+    /// iterator is to the existing one.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set is already full.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
 
-      return inext;
+      node_t& node = create_data_node();
+      ::new ((void*)&node.key) value_type(value1, value2, value3, value4);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      return emplace_node(node);
     }
 
     //*********************************************************************
-    /// Erases a range of elements.
-    /// The range includes all the elements between first and last, including the
-    /// element pointed by first, but not the one pointed to by last.
-    ///\param first Iterator to the first element.
-    ///\param last  Iterator to the last element.
+    /// Constructs a value in place in the unordered_set.
+    /// The position is only a hint, and is ignored.
     //*********************************************************************
-    iterator erase(const_iterator first_, const_iterator last_)
+    template <typename T1>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1)
     {
-      // Erasing everything?
-      if ((first_ == begin()) && (last_ == end()))
-      {
-        clear();
-        return end();
-      }
+      return emplace(value1).first;
+    }
 
-      // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2)
+    {
+      return emplace(value1, value2).first;
+    }
 
-      // Get the starting point.
-      bucket_t*      pbucket     = first_.get_bucket_list_iterator();
-      bucket_t*      pend_bucket = last_.get_bucket_list_iterator();
-      local_iterator iprevious   = pbucket->before_begin();
-      local_iterator icurrent    = first_.get_local_iterator();
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3)
+    {
+      return emplace(value1, value2, value3).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in place in the unordered_set.
+    /// The position is only a hint, and is ignored.
+    //*********************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace_hint(const_iterator /*position*/, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return emplace(value1, value2, value3, value4).first;
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a node extracted from an unordered_set of the same type.
+    /// A node from this unordered_set is relinked, otherwise its value is moved
+    /// into a new node and the old one is released.
+    /// If the key is already present the node is returned in the result.
+    //*********************************************************************
+    insert_return_type insert(node_type&& node)
+    {
+      insert_return_type result = { end(), false, node_type() };
+
+      if (!node.empty())
+      {
+        result.position = insert(cend(), etl::move(node));
+        result.inserted = node.empty();
+
+        if (!result.inserted)
+        {
+          result.node = etl::move(node);
+        }
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Inserts a node extracted from an unordered_set of the same type.
+    /// The node is left in the handle if the key is already present.
+    ///\return An iterator to the element with the node's key, or end() if
+    /// the node was empty.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, node_type&& node)
+    {
+      if (node.empty())
+      {
+        return end();
+      }
+
+      const key_type& key  = node.value();
+      const size_t    hash = key_hash_function(key);
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      bucket_t& bucket  = *pbucket;
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode          = bucket.begin();
+
+      while ((inode != bucket.end()) && !keys_match(*inode, hash, key))
+      {
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Not already there?
+      if (inode == bucket.end())
+      {
+        node_t& new_node = claim_node(node);
+        new_node.set_hash(hash);
+
+        bucket.insert_after(inode_previous, new_node);
+        adjust_first_last_markers_after_insert(pbucket);
+        inode = ++inode_previous;
+      }
+
+      return iterator((pbuckets + number_of_buckets), pbucket, inode);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element at the specified position and returns ownership
+    /// of its node.
+    //*********************************************************************
+    node_type extract(const_iterator ielement)
+    {
+      bucket_t&      bucket    = ielement.get_bucket();
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent  = ielement.get_local_iterator();
+
+      // Find the node previous to the one we're interested in.
+      while (iprevious->etl_next != &*icurrent)
+      {
+        ++iprevious;
+      }
+
+      bucket.erase_after(iprevious); // Unlink from the bucket.
+      ++extracted_count;
+      adjust_first_last_markers_after_erase(&bucket);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      return node_type(*icurrent, *pnodepool, &extracted_count);
+    }
+
+    //*********************************************************************
+    /// Unlinks the element with the specified key and returns
+    /// ownership of its node. The handle is empty if the key is not present.
+    //*********************************************************************
+    node_type extract(key_parameter_t key)
+    {
+      const_iterator ielement = find(key);
+
+      if (ielement == cend())
+      {
+        return node_type();
+      }
+
+      return extract(ielement);
+    }
+
+    //*********************************************************************
+    /// Moves the elements of another unordered_set whose keys are not in this
+    /// one. Elements with keys that are already present are left in 'other'.
+    //*********************************************************************
+    void merge(iunordered_set& other)
+    {
+      if (&other != this)
+      {
+        iterator itr = other.begin();
+
+        while (itr != other.end())
+        {
+          iterator current = itr++;
+
+          if (find(*current) == end())
+          {
+            insert(cend(), other.extract(current));
+          }
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Moves the elements of another unordered_set whose keys are not in this
+    /// one.
+    //*********************************************************************
+    void merge(iunordered_set&& other)
+    {
+      merge(other);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_set.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a batch of values to the unordered_set.
+    /// All of the keys in a batch are hashed, and their buckets prefetched,
+    /// before any are inserted, so that the memory accesses overlap.
+    /// If asserts or exceptions are enabled, emits unordered_set_full if the unordered_set does not have enough free space.
+    ///\param first Iterator to the first value. Must be a forward iterator.
+    ///\param last  Iterator to the last value + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void insert_batch(TIterator first, TIterator last)
+    {
+      size_t hashes[Batch_Size];
+      size_t indexes[Batch_Size];
+
+      while (first != last)
+      {
+        TIterator batch_first = first;
+        size_t n = 0U;
+
+        while ((n < Batch_Size) && (first != last))
+        {
+          prefetch_bucket(*first, hashes[n], indexes[n]);
+          ++first;
+          ++n;
+        }
+
+        prefetch_first_nodes(indexes, n);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          insert_hashed(*batch_first++, hashes[i]);
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_t n = 0;
+      const size_t hash = key_hash_function(key);
+      size_t index = hash % number_of_buckets;
+
+      bucket_t& bucket = pbuckets[index];
+
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = bucket.begin();
+
+      // Search for the key, if we have it.
+      while ((icurrent != bucket.end()) && !keys_match(*icurrent, hash, key))
+      {
+        ++iprevious;
+        ++icurrent;
+      }
+
+      // Did we find it?
+      if (icurrent != bucket.end())
+      {
+        bucket.erase_after(iprevious);  // Unlink from the bucket.
+        icurrent->key.~value_type();    // Destroy the value.
+        pnodepool->release(&*icurrent); // Release it back to the pool.
+        adjust_first_last_markers_after_erase(&bucket);
+        n = 1;
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+
+      return n;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      // Make a note of the next one.
+      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      ++inext;
+
+      bucket_t&      bucket = ielement.get_bucket();
+      local_iterator iprevious = bucket.before_begin();
+      local_iterator icurrent = ielement.get_local_iterator();
+
+      // Find the node previous to the one we're interested in.
+      while (iprevious->etl_next != &*icurrent)
+      {
+        ++iprevious;
+      }
+
+      bucket.erase_after(iprevious);  // Unlink from the bucket.
+      icurrent->key.~value_type();    // Destroy the value.
+      pnodepool->release(&*icurrent); // Release it back to the pool.
+      adjust_first_last_markers_after_erase(&bucket);
+      ETL_DECREMENT_DEBUG_COUNT
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == begin()) && (last_ == end()))
+      {
+        clear();
+        return end();
+      }
+
+      // Make a note of the last.
+      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+
+      // Get the starting point.
+      bucket_t*      pbucket     = first_.get_bucket_list_iterator();
+      bucket_t*      pend_bucket = last_.get_bucket_list_iterator();
+      local_iterator iprevious   = pbucket->before_begin();
+      local_iterator icurrent    = first_.get_local_iterator();
       local_iterator iend        = last_.get_local_iterator(); // Note: May not be in the same bucket as icurrent.
 
       // Find the node previous to the first one.
@@ -947,36 +1192,808 @@ namespace etl
         }
       }
 
-      return result;
+      return result;
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_set.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Counts an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Checks if the container contains an element with the key.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return <b>true</b> if the key exists.
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      const size_t hash = key_hash_function(key);
+
+      return find_hashed(key, hash, hash % number_of_buckets);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    iterator find(const K& key)
+    {
+      const size_t hash = key_hash_function(key);
+
+      return find_hashed(key, hash, hash % number_of_buckets);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      const size_t hash = key_hash_function(key);
+
+      return find_hashed(key, hash, hash % number_of_buckets);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Finds an element.
+    /// Only available if the hasher and key_equal are transparent.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    const_iterator find(const K& key) const
+    {
+      const size_t hash = key_hash_function(key);
+
+      return find_hashed(key, hash, hash % number_of_buckets);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds a batch of keys.
+    /// All of the keys in a batch are hashed, and their buckets prefetched,
+    /// before any are searched for, so that the memory accesses overlap.
+    ///\param first  Iterator to the first key. Must be a forward iterator.
+    ///\param last   Iterator to the last key + 1.
+    ///\param result Output iterator for the results. end() for each key not found.
+    ///\return The output iterator after the last result.
+    //*********************************************************************
+    template <typename TKeyIterator, typename TOutputIterator>
+    TOutputIterator find_batch(TKeyIterator first, TKeyIterator last, TOutputIterator result)
+    {
+      size_t hashes[Batch_Size];
+      size_t indexes[Batch_Size];
+
+      while (first != last)
+      {
+        TKeyIterator batch_first = first;
+        size_t n = 0U;
+
+        while ((n < Batch_Size) && (first != last))
+        {
+          prefetch_bucket(*first++, hashes[n], indexes[n]);
+          ++n;
+        }
+
+        prefetch_first_nodes(indexes, n);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          *result++ = find_hashed(*batch_first++, hashes[i], indexes[i]);
+        }
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Finds a batch of keys.
+    /// All of the keys in a batch are hashed, and their buckets prefetched,
+    /// before any are searched for, so that the memory accesses overlap.
+    ///\param first  Iterator to the first key. Must be a forward iterator.
+    ///\param last   Iterator to the last key + 1.
+    ///\param result Output iterator for the results. end() for each key not found.
+    ///\return The output iterator after the last result.
+    //*********************************************************************
+    template <typename TKeyIterator, typename TOutputIterator>
+    TOutputIterator find_batch(TKeyIterator first, TKeyIterator last, TOutputIterator result) const
+    {
+      size_t hashes[Batch_Size];
+      size_t indexes[Batch_Size];
+
+      while (first != last)
+      {
+        TKeyIterator batch_first = first;
+        size_t n = 0U;
+
+        while ((n < Batch_Size) && (first != last))
+        {
+          prefetch_bucket(*first++, hashes[n], indexes[n]);
+          ++n;
+        }
+
+        prefetch_first_nodes(indexes, n);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          *result++ = find_hashed(*batch_first++, hashes[i], indexes[i]);
+        }
+      }
+
+      return result;
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// Only available if the hasher and key_equal are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Returns a range containing all elements with key 'key' in the container.
+    /// Only available if the hasher and key_equal are transparent.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, typename etl::enable_if<etl::comparator_is_transparent<KH>::value && etl::comparator_is_transparent<KE>::value, int>::type = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the unordered_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return pnodepool->size() - extracted_count;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return pnodepool->max_size();
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return pnodepool->max_size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pnodepool->size() == extracted_count;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return pnodepool->full();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return pnodepool->available();
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns statistics on how the elements are spread among the buckets and the memory used.
+    ///\return The statistics.
+    //*************************************************************************
+    etl::unordered_statistics statistics() const
+    {
+      return etl::private_unordered::get_statistics(pbuckets, number_of_buckets, sizeof(node_t), max_size());
+    }
+
+    //*************************************************************************
+    /// Adds the number of elements in each bucket to a histogram that starts at 0.
+    /// Buckets with more elements than the last bin are counted in the last bin.
+    /// e.g. etl::histogram<size_t, uint16_t, 8, 0>
+    ///\param histogram The histogram to add to.
+    //*************************************************************************
+    template <typename THistogram>
+    void bucket_histogram(THistogram& histogram) const
+    {
+      etl::private_unordered::add_chain_lengths(pbuckets, number_of_buckets, histogram);
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_set& operator = (const iunordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        copy(rhs);
+      }
+
+      return *this;
+    }
+
+#if  ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_set& operator = (iunordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
+      : pnodepool(&node_pool_),
+        pbuckets(pbuckets_),
+        number_of_buckets(number_of_buckets_),
+        extracted_count(0U)
+    {
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_set.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        // For each bucket...
+        for (size_t i = 0; i < number_of_buckets; ++i)
+        {
+          bucket_t& bucket = pbuckets[i];
+
+          if (!bucket.empty())
+          {
+            // For each item in the bucket...
+            local_iterator it = bucket.begin();
+
+            while (it != bucket.end())
+            {
+              node_t& node = *it++;
+
+              // Destroy the value contents.
+              node.key.~value_type();
+              ETL_DECREMENT_DEBUG_COUNT
+
+              // Nodes held by node handles stay allocated, so release individually.
+              if (extracted_count != 0U)
+              {
+                pnodepool->release(&node);
+              }
+            }
+
+            // Now it's safe to clear the bucket.
+            bucket.clear();
+          }
+        }
+
+        // Now it's safe to clear the entire pool in one go.
+        if (extracted_count == 0U)
+        {
+          pnodepool->release_all();
+        }
+      }
+
+      first = pbuckets;
+      last = first;
+    }
+
+    //*************************************************************************
+    /// Copy from another unordered_set, reusing the hashes of its elements.
+    //*************************************************************************
+    void copy(const iunordered_set& other)
+    {
+      clear();
+
+      const_iterator itr = other.cbegin();
+
+      while (itr != other.cend())
+      {
+        insert_hashed(*itr, other.get_node_hash(*itr.get_local_iterator()));
+        ++itr;
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = etl::distance(first, last);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_set_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_set_full));
+#endif
+
+      while (first != last)
+      {
+        const size_t hash = get_node_hash(*first.get_local_iterator());
+
+        insert_hashed(etl::move(*first++), hash);
+      }
+    }
+#endif
+
+  private:
+
+    /// The number of keys that are hashed and prefetched together by the batch functions.
+    enum
+    {
+      Batch_Size = 16U
+    };
+
+    //*************************************************************************
+    /// Create a node.
+    //*************************************************************************
+    node_t& create_data_node()
+    {
+      node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
+      return *(pnodepool->*func)();
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Takes the node from a handle. A node from another pool has its value
+    /// moved into a new node from this pool.
+    //*********************************************************************
+    node_t& claim_node(node_type& node)
+    {
+      if (node.get_pool() == pnodepool)
+      {
+        ETL_INCREMENT_DEBUG_COUNT
+        return *static_cast<node_t*>(node.release());
+      }
+      else
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+        node_t& new_node = create_data_node();
+        ::new (&new_node.key) value_type(etl::move(node.get_value()));
+        ETL_INCREMENT_DEBUG_COUNT
+        node.reset();
+
+        return new_node;
+      }
+    }
+#endif
+
+    //*********************************************************************
+    /// Links a node whose value has been constructed into its bucket.
+    /// The node is destroyed if the key is already present.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> emplace_node(node_t& node)
+    {
+      const key_type& key  = node.key;
+      const size_t    hash = key_hash_function(key);
+
+      bucket_t* pbucket = pbuckets + (hash % number_of_buckets);
+      bucket_t& bucket  = *pbucket;
+
+      node.set_hash(hash);
+
+      // Step though the bucket looking for a place to insert.
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode          = bucket.begin();
+
+      while ((inode != bucket.end()) && !keys_match(*inode, hash, key))
+      {
+        ++inode_previous;
+        ++inode;
+      }
+
+      // Already there?
+      if (inode != bucket.end())
+      {
+        node.key.~value_type();
+        pnodepool->release(&node);
+        ETL_DECREMENT_DEBUG_COUNT
+
+        return ETL_OR_STD::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode), false);
+      }
+
+      bucket.insert_after(inode_previous, node);
+      adjust_first_last_markers_after_insert(pbucket);
+      ++inode_previous;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode_previous), true);
+    }
+
+    //*********************************************************************
+    /// Inserts a value with a known hash.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_hashed(const_reference key, size_t hash)
+    {
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+      // Get the hash index.
+      size_t index = hash % number_of_buckets;
+
+      // Get the bucket & bucket iterator.
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // The first one in the bucket?
+      if (bucket.empty())
+      {
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key) value_type(key);
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Just add the pointer to the bucket;
+        bucket.insert_after(bucket.before_begin(), node);
+        adjust_first_last_markers_after_insert(&bucket);
+
+        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.second = true;
+      }
+      else
+      {
+        // Step though the bucket looking for a place to insert.
+        local_iterator inode_previous = bucket.before_begin();
+        local_iterator inode = bucket.begin();
+
+        while (inode != bucket.end())
+        {
+          // Do we already have this key?
+          if (keys_match(*inode, hash, key))
+          {
+            break;
+          }
+
+          ++inode_previous;
+          ++inode;
+        }
+
+        // Not already there?
+        if (inode == bucket.end())
+        {
+          // Get a new node.
+          node_t& node = create_data_node();
+          ::new (&node.key) value_type(key);
+          node.set_hash(hash);
+          ETL_INCREMENT_DEBUG_COUNT
+
+          // Add the node to the end of the bucket;
+          bucket.insert_after(inode_previous, node);
+          adjust_first_last_markers_after_insert(&bucket);
+          ++inode_previous;
+
+          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.second = true;
+        }
+      }
+
+      return result;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value with a known hash.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_hashed(rvalue_reference key, size_t hash)
+    {
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_set_full));
+
+      // Get the hash index.
+      size_t index = hash % number_of_buckets;
+
+      // Get the bucket & bucket iterator.
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // The first one in the bucket?
+      if (bucket.empty())
+      {
+        // Get a new node.
+        node_t& node = create_data_node();
+        ::new (&node.key) value_type(etl::move(key));
+        node.set_hash(hash);
+        ETL_INCREMENT_DEBUG_COUNT
+
+        // Just add the pointer to the bucket;
+        bucket.insert_after(bucket.before_begin(), node);
+        adjust_first_last_markers_after_insert(&bucket);
+
+        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.second = true;
+      }
+      else
+      {
+        // Step though the bucket looking for a place to insert.
+        local_iterator inode_previous = bucket.before_begin();
+        local_iterator inode = bucket.begin();
+
+        while (inode != bucket.end())
+        {
+          // Do we already have this key?
+          if (keys_match(*inode, hash, key))
+          {
+            break;
+          }
+
+          ++inode_previous;
+          ++inode;
+        }
+
+        // Not already there?
+        if (inode == bucket.end())
+        {
+          // Get a new node.
+          node_t& node = create_data_node();
+          ::new (&node.key) value_type(etl::move(key));
+          node.set_hash(hash);
+          ETL_INCREMENT_DEBUG_COUNT
+
+          // Add the node to the end of the bucket;
+          bucket.insert_after(inode_previous, node);
+          adjust_first_last_markers_after_insert(&bucket);
+          ++inode_previous;
+
+          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.second = true;
+        }
+      }
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Checks if the node holds the key.
+    /// The keys are only compared if the node's hash matches.
+    //*********************************************************************
+    template <typename K>
+    bool keys_match(const node_t& node, size_t hash, const K& key) const
+    {
+      return node.hash_matches(hash) && key_equal_function(key, node.key);
+    }
+
+    //*********************************************************************
+    /// Gets the hash of the key held by the node.
+    /// The stored hash is used if the hasher is a cached_hash.
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node) const
+    {
+      return get_node_hash(node, etl::is_cached_hash<THash>());
+    }
+
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node, etl::true_type) const
+    {
+      return node.hash;
     }
 
-    //*************************************************************************
-    /// Clears the unordered_set.
-    //*************************************************************************
-    void clear()
+    //*********************************************************************
+    size_t get_node_hash(const node_t& node, etl::false_type) const
     {
-      initialise();
+      return key_hash_function(node.key);
     }
 
     //*********************************************************************
-    /// Counts an element.
-    ///\param key The key to search for.
-    ///\return 1 if the key exists, otherwise 0.
+    /// Hashes a key and prefetches its bucket.
     //*********************************************************************
-    size_t count(key_parameter_t key) const
+    template <typename K>
+    void prefetch_bucket(const K& key, size_t& hash, size_t& index) const
     {
-      return (find(key) == end()) ? 0 : 1;
+      hash  = key_hash_function(key);
+      index = hash % number_of_buckets;
+
+      ETL_PREFETCH(pbuckets + index);
     }
 
     //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator to the element if the key exists, otherwise end().
+    /// Prefetches the first node in each bucket.
     //*********************************************************************
-    iterator find(key_parameter_t key)
+    void prefetch_first_nodes(const size_t* indexes, size_t n) const
     {
-      size_t index = get_bucket_index(key);
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const bucket_t& bucket = pbuckets[indexes[i]];
+
+        if (!bucket.empty())
+        {
+          ETL_PREFETCH(&*bucket.begin());
+        }
+      }
+    }
 
+    //*********************************************************************
+    /// Finds an element with a known hash.
+    //*********************************************************************
+    template <typename K>
+    iterator find_hashed(const K& key, size_t hash, size_t index)
+    {
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
 
@@ -990,7 +2007,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (keys_match(*inode, hash, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1003,14 +2020,11 @@ namespace etl
     }
 
     //*********************************************************************
-    /// Finds an element.
-    ///\param key The key to search for.
-    ///\return An iterator to the element if the key exists, otherwise end().
+    /// Finds an element with a known hash.
     //*********************************************************************
-    const_iterator find(key_parameter_t key) const
+    template <typename K>
+    const_iterator find_hashed(const K& key, size_t hash, size_t index) const
     {
-      size_t index = get_bucket_index(key);
-
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket = *pbucket;
 
@@ -1024,7 +2038,7 @@ namespace etl
         while (inode != iend)
         {
           // Do we have this one?
-          if (key_equal_function(key, inode->key))
+          if (keys_match(*inode, hash, key))
           {
             return iterator(pbuckets + number_of_buckets, pbucket, inode);
           }
@@ -1036,235 +2050,6 @@ namespace etl
       return end();
     }
 
-    //*********************************************************************
-    /// Returns a range containing all elements with key 'key' in the container.
-    /// The range is defined by two iterators, the first pointing to the first
-    /// element of the wanted range and the second pointing past the last
-    /// element of the range.
-    ///\param key The key to search for.
-    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
-    //*********************************************************************
-    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
-    {
-      iterator f = find(key);
-      iterator l = f;
-
-      if (l != end())
-      {
-        ++l;
-      }
-
-      return ETL_OR_STD::pair<iterator, iterator>(f, l);
-    }
-
-    //*********************************************************************
-    /// Returns a range containing all elements with key 'key' in the container.
-    /// The range is defined by two iterators, the first pointing to the first
-    /// element of the wanted range and the second pointing past the last
-    /// element of the range.
-    ///\param key The key to search for.
-    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
-    //*********************************************************************
-    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
-    {
-      const_iterator f = find(key);
-      const_iterator l = f;
-
-      if (l != end())
-      {
-        ++l;
-      }
-
-      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
-    }
-
-    //*************************************************************************
-    /// Gets the size of the unordered_set.
-    //*************************************************************************
-    size_type size() const
-    {
-      return pnodepool->size();
-    }
-
-    //*************************************************************************
-    /// Gets the maximum possible size of the unordered_set.
-    //*************************************************************************
-    size_type max_size() const
-    {
-      return pnodepool->max_size();
-    }
-
-    //*************************************************************************
-    /// Gets the maximum possible size of the unordered_set.
-    //*************************************************************************
-    size_type capacity() const
-    {
-      return pnodepool->max_size();
-    }
-
-    //*************************************************************************
-    /// Checks to see if the unordered_set is empty.
-    //*************************************************************************
-    bool empty() const
-    {
-      return pnodepool->empty();
-    }
-
-    //*************************************************************************
-    /// Checks to see if the unordered_set is full.
-    //*************************************************************************
-    bool full() const
-    {
-      return pnodepool->full();
-    }
-
-    //*************************************************************************
-    /// Returns the remaining capacity.
-    ///\return The remaining capacity.
-    //*************************************************************************
-    size_t available() const
-    {
-      return pnodepool->available();
-    }
-
-    //*************************************************************************
-    /// Returns the load factor = size / bucket_count.
-    ///\return The load factor = size / bucket_count.
-    //*************************************************************************
-    float load_factor() const
-    {
-      return static_cast<float>(size()) / static_cast<float>(bucket_count());
-    }
-
-    //*************************************************************************
-    /// Returns the function that hashes the keys.
-    ///\return The function that hashes the keys..
-    //*************************************************************************
-    hasher hash_function() const
-    {
-      return key_hash_function;
-    }
-
-    //*************************************************************************
-    /// Returns the function that compares the keys.
-    ///\return The function that compares the keys..
-    //*************************************************************************
-    key_equal key_eq() const
-    {
-      return key_equal_function;
-    }
-
-    //*************************************************************************
-    /// Assignment operator.
-    //*************************************************************************
-    iunordered_set& operator = (const iunordered_set& rhs)
-    {
-      // Skip if doing self assignment
-      if (this != &rhs)
-      {
-        assign(rhs.cbegin(), rhs.cend());
-      }
-
-      return *this;
-    }
-
-#if  ETL_CPP11_SUPPORTED
-    //*************************************************************************
-    /// Move assignment operator.
-    //*************************************************************************
-    iunordered_set& operator = (iunordered_set&& rhs)
-    {
-      // Skip if doing self assignment
-      if (this != &rhs)
-      {
-        clear();
-        move(rhs.begin(), rhs.end());
-      }
-
-      return *this;
-    }
-#endif
-
-  protected:
-
-    //*********************************************************************
-    /// Constructor.
-    //*********************************************************************
-    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_)
-      : pnodepool(&node_pool_),
-        pbuckets(pbuckets_),
-        number_of_buckets(number_of_buckets_)
-    {
-    }
-
-    //*********************************************************************
-    /// Initialise the unordered_set.
-    //*********************************************************************
-    void initialise()
-    {
-      if (!empty())
-      {
-        // For each bucket...
-        for (size_t i = 0; i < number_of_buckets; ++i)
-        {
-          bucket_t& bucket = pbuckets[i];
-
-          if (!bucket.empty())
-          {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
-            {
-              // Destroy the value contents.
-              it->key.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
-            }
-
-            // Now it's safe to clear the bucket.
-            bucket.clear();
-          }
-        }
-
-        // Now it's safe to clear the entire pool in one go.
-        pnodepool->release_all();
-      }
-
-      first = pbuckets;
-      last = first;
-    }
-
-#if ETL_CPP11_SUPPORTED
-    //*************************************************************************
-    /// Move from a range
-    //*************************************************************************
-    void move(iterator first, iterator last)
-    {
-#if defined(ETL_DEBUG)
-      difference_type d = etl::distance(first, last);
-      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_set_iterator));
-      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_set_full));
-#endif
-
-      while (first != last)
-      {
-        insert(etl::move(*first++));
-      }
-    }
-#endif
-
-  private:
-
-    //*************************************************************************
-    /// Create a node.
-    //*************************************************************************
-    node_t& create_data_node()
-    {
-      node_t* (etl::ipool::*func)() = &etl::ipool::allocate<node_t>;
-      return *(pnodepool->*func)();
-    }
-
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1345,6 +2130,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The number of nodes from the pool that are held by node handles.
+    size_t extracted_count;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1433,7 +2221,7 @@ namespace etl
       // Skip if doing self assignment
       if (this != &other)
       {
-        base::assign(other.cbegin(), other.cend());
+        base::copy(other);
       }
     }
 
@@ -1492,7 +2280,7 @@ namespace etl
       // Skip if doing self assignment
       if (this != &rhs)
       {
-        base::assign(rhs.cbegin(), rhs.cend());
+        base::copy(rhs);
       }
 
       return *this;
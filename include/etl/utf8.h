@@ -0,0 +1,479 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UTF8_INCLUDED
+#define ETL_UTF8_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "enum_type.h"
+#include "string_view.h"
+#include "string.h"
+#include "wstring.h"
+#include "u16string.h"
+#include "u32string.h"
+#include "private/string_kernels.h"
+
+///\defgroup utf8 utf8
+/// UTF-8 validation, and transcoding between UTF-8 and UTF-16, UTF-32 or
+/// wide strings.
+/// Validation is strict; overlong forms, surrogates and values above U+10FFFF
+/// are rejected. Conversions append to the output string and never exceed its
+/// capacity. They stop at the first problem and report why, and how much of
+/// the input was consumed, so that the caller may resume.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a UTF conversion.
+  /// Incomplete_Sequence means that the input ended part way through a
+  /// character; the partial character has not been consumed.
+  /// Output_Full means that the next character would not fit in the output.
+  ///\ingroup utf8
+  //***************************************************************************
+  struct utf_status
+  {
+    enum enum_type
+    {
+      Ok,
+      Invalid_Sequence,
+      Incomplete_Sequence,
+      Output_Full
+    };
+
+    ETL_DECLARE_ENUM_TYPE(utf_status, uint_least8_t)
+    ETL_ENUM_TYPE(Ok,                  "Ok")
+    ETL_ENUM_TYPE(Invalid_Sequence,    "Invalid Sequence")
+    ETL_ENUM_TYPE(Incomplete_Sequence, "Incomplete Sequence")
+    ETL_ENUM_TYPE(Output_Full,         "Output Full")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a UTF conversion.
+  /// 'read' is the number of input code units consumed and 'written' the
+  /// number of output code units appended.
+  ///\ingroup utf8
+  //***************************************************************************
+  struct utf_result
+  {
+    utf_result()
+      : status(etl::utf_status::Ok)
+      , read(0U)
+      , written(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// True if the whole input was converted.
+    //*************************************************************************
+    bool ok() const
+    {
+      return status == etl::utf_status::Ok;
+    }
+
+    etl::utf_status status;
+    size_t          read;
+    size_t          written;
+  };
+
+  namespace private_utf8
+  {
+    //*************************************************************************
+    /// Decodes the UTF-8 sequence at 'p' into 'code_point'.
+    /// Returns the length of the sequence, or zero if it is invalid or
+    /// incomplete, in which case 'status' is set.
+    //*************************************************************************
+    inline size_t decode(const char* p, const size_t n, uint32_t& code_point, etl::utf_status& status)
+    {
+      const uint32_t b0 = uint8_t(p[0]);
+
+      // The permitted range of the second byte. Narrowed for the lead bytes
+      // that could otherwise start an overlong form, a surrogate or a value
+      // above U+10FFFF.
+      uint32_t low  = 0x80U;
+      uint32_t high = 0xBFU;
+      size_t   length;
+
+      if (b0 < 0x80U)
+      {
+        code_point = b0;
+        return 1U;
+      }
+      else if (b0 < 0xC2U)
+      {
+        status = etl::utf_status::Invalid_Sequence;
+        return 0U;
+      }
+      else if (b0 < 0xE0U)
+      {
+        length     = 2U;
+        code_point = b0 & 0x1FU;
+      }
+      else if (b0 < 0xF0U)
+      {
+        length     = 3U;
+        code_point = b0 & 0x0FU;
+        low        = (b0 == 0xE0U) ? 0xA0U : low;
+        high       = (b0 == 0xEDU) ? 0x9FU : high;
+      }
+      else if (b0 < 0xF5U)
+      {
+        length     = 4U;
+        code_point = b0 & 0x07U;
+        low        = (b0 == 0xF0U) ? 0x90U : low;
+        high       = (b0 == 0xF4U) ? 0x8FU : high;
+      }
+      else
+      {
+        status = etl::utf_status::Invalid_Sequence;
+        return 0U;
+      }
+
+      for (size_t i = 1U; i < length; ++i)
+      {
+        if (i == n)
+        {
+          status = etl::utf_status::Incomplete_Sequence;
+          return 0U;
+        }
+
+        const uint32_t b = uint8_t(p[i]);
+
+        if ((b < low) || (b > high))
+        {
+          status = etl::utf_status::Invalid_Sequence;
+          return 0U;
+        }
+
+        code_point = (code_point << 6U) | (b & 0x3FU);
+        low        = 0x80U;
+        high       = 0xBFU;
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Converts UTF-8 to UTF-16 or UTF-32, selected by the size of TChar.
+    //*************************************************************************
+    template <typename TChar>
+    etl::utf_result from_utf8(const etl::string_view& text, etl::ibasic_string<TChar>& out)
+    {
+      const bool   is_utf16 = (sizeof(TChar) == 2U);
+      const char*  p        = text.data();
+      const size_t n        = text.size();
+      const size_t start    = out.size();
+      const size_t room     = out.capacity() - start;
+
+      etl::utf_result result;
+      size_t i = 0U;
+      size_t j = 0U;
+
+      // Write directly into the free capacity, then trim to what was written.
+      out.uninitialized_resize(out.capacity());
+      TChar* q = out.data() + start;
+
+      while (i != n)
+      {
+        const size_t run = etl::private_string::copy_ascii(p + i, etl::min(n - i, room - j), q + j);
+        i += run;
+        j += run;
+
+        if (i == n)
+        {
+          break;
+        }
+
+        if (j == room)
+        {
+          result.status = etl::utf_status::Output_Full;
+          break;
+        }
+
+        uint32_t code_point;
+        const size_t length = decode(p + i, n - i, code_point, result.status);
+
+        if (length == 0U)
+        {
+          break;
+        }
+
+        if (is_utf16 && (code_point >= 0x10000U))
+        {
+          if ((room - j) < 2U)
+          {
+            result.status = etl::utf_status::Output_Full;
+            break;
+          }
+
+          code_point -= 0x10000U;
+          q[j++] = TChar(0xD800U + (code_point >> 10U));
+          q[j++] = TChar(0xDC00U + (code_point & 0x3FFU));
+        }
+        else
+        {
+          q[j++] = TChar(code_point);
+        }
+
+        i += length;
+      }
+
+      out.uninitialized_resize(start + j);
+
+      result.read    = i;
+      result.written = j;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Converts UTF-16 or UTF-32, selected by the size of TChar, to UTF-8.
+    //*************************************************************************
+    template <typename TChar>
+    etl::utf_result to_utf8(const etl::basic_string_view<TChar>& text, etl::istring& out)
+    {
+      const bool   is_utf16 = (sizeof(TChar) == 2U);
+      const TChar* p        = text.data();
+      const size_t n        = text.size();
+      const size_t start    = out.size();
+      const size_t room     = out.capacity() - start;
+
+      etl::utf_result result;
+      size_t i = 0U;
+      size_t j = 0U;
+
+      out.uninitialized_resize(out.capacity());
+      char* q = out.data() + start;
+
+      while (i != n)
+      {
+        const size_t run = etl::private_string::copy_ascii(p + i, etl::min(n - i, room - j), q + j);
+        i += run;
+        j += run;
+
+        if (i == n)
+        {
+          break;
+        }
+
+        if (j == room)
+        {
+          result.status = etl::utf_status::Output_Full;
+          break;
+        }
+
+        uint32_t code_point = is_utf16 ? uint32_t(uint16_t(p[i])) : uint32_t(p[i]);
+        size_t   length     = 1U;
+
+        if ((code_point >= 0xD800U) && (code_point <= 0xDFFFU))
+        {
+          // Only a high surrogate followed by a low surrogate is valid, and only in UTF-16.
+          if (!is_utf16 || (code_point > 0xDBFFU))
+          {
+            result.status = etl::utf_status::Invalid_Sequence;
+            break;
+          }
+
+          if ((i + 1U) == n)
+          {
+            result.status = etl::utf_status::Incomplete_Sequence;
+            break;
+          }
+
+          const uint32_t low = uint16_t(p[i + 1U]);
+
+          if ((low < 0xDC00U) || (low > 0xDFFFU))
+          {
+            result.status = etl::utf_status::Invalid_Sequence;
+            break;
+          }
+
+          code_point = 0x10000U + ((code_point - 0xD800U) << 10U) + (low - 0xDC00U);
+          length     = 2U;
+        }
+        else if (code_point > 0x10FFFFU)
+        {
+          result.status = etl::utf_status::Invalid_Sequence;
+          break;
+        }
+
+        const size_t bytes = (code_point < 0x800U) ? 2U : (code_point < 0x10000U) ? 3U : 4U;
+
+        if ((room - j) < bytes)
+        {
+          result.status = etl::utf_status::Output_Full;
+          break;
+        }
+
+        switch (bytes)
+        {
+          case 2U:
+          {
+            q[j++] = char(0xC0U | (code_point >> 6U));
+            break;
+          }
+
+          case 3U:
+          {
+            q[j++] = char(0xE0U | (code_point >> 12U));
+            q[j++] = char(0x80U | ((code_point >> 6U) & 0x3FU));
+            break;
+          }
+
+          default:
+          {
+            q[j++] = char(0xF0U | (code_point >> 18U));
+            q[j++] = char(0x80U | ((code_point >> 12U) & 0x3FU));
+            q[j++] = char(0x80U | ((code_point >> 6U) & 0x3FU));
+            break;
+          }
+        }
+
+        q[j++] = char(0x80U | (code_point & 0x3FU));
+        i += length;
+      }
+
+      out.uninitialized_resize(start + j);
+
+      result.read    = i;
+      result.written = j;
+
+      return result;
+    }
+  }
+
+  //***************************************************************************
+  /// Returns the result of validating the text as UTF-8.
+  /// On failure, 'read' is the offset of the offending sequence.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result validate_utf8(const etl::string_view& text)
+  {
+    const char*  p = text.data();
+    const size_t n = text.size();
+
+    etl::utf_result result;
+    size_t i = 0U;
+
+    while (i != n)
+    {
+      i += etl::private_string::ascii_length(p + i, n - i);
+
+      if (i != n)
+      {
+        uint32_t code_point;
+        const size_t length = etl::private_utf8::decode(p + i, n - i, code_point, result.status);
+
+        if (length == 0U)
+        {
+          break;
+        }
+
+        i += length;
+      }
+    }
+
+    result.read = i;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Returns true if the text is valid UTF-8.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline bool is_valid_utf8(const etl::string_view& text)
+  {
+    return etl::validate_utf8(text).ok();
+  }
+
+  //***************************************************************************
+  /// Appends the UTF-8 text to the UTF-16 string.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result utf8_to_utf16(const etl::string_view& text, etl::iu16string& out)
+  {
+    return etl::private_utf8::from_utf8(text, out);
+  }
+
+  //***************************************************************************
+  /// Appends the UTF-8 text to the UTF-32 string.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result utf8_to_utf32(const etl::string_view& text, etl::iu32string& out)
+  {
+    return etl::private_utf8::from_utf8(text, out);
+  }
+
+  //***************************************************************************
+  /// Appends the UTF-8 text to the wide string.
+  /// The wide string is UTF-16 or UTF-32, depending on the size of wchar_t.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result utf8_to_wide(const etl::string_view& text, etl::iwstring& out)
+  {
+    return etl::private_utf8::from_utf8(text, out);
+  }
+
+  //***************************************************************************
+  /// Appends the UTF-16 text to the UTF-8 string.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result utf16_to_utf8(const etl::u16string_view& text, etl::istring& out)
+  {
+    return etl::private_utf8::to_utf8(text, out);
+  }
+
+  //***************************************************************************
+  /// Appends the UTF-32 text to the UTF-8 string.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result utf32_to_utf8(const etl::u32string_view& text, etl::istring& out)
+  {
+    return etl::private_utf8::to_utf8(text, out);
+  }
+
+  //***************************************************************************
+  /// Appends the wide text to the UTF-8 string.
+  /// The wide string is UTF-16 or UTF-32, depending on the size of wchar_t.
+  ///\ingroup utf8
+  //***************************************************************************
+  inline etl::utf_result wide_to_utf8(const etl::wstring_view& text, etl::istring& out)
+  {
+    return etl::private_utf8::to_utf8(text, out);
+  }
+}
+
+#endif
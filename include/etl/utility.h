@@ -145,7 +145,7 @@ namespace etl
     }
 
     /// Copy constructor
-    pair(const pair<T1, T2>& other)
+    ETL_CONSTEXPR14 pair(const pair<T1, T2>& other)
       : first(other.first)
       , second(other.second)
     {
@@ -233,6 +233,12 @@ namespace etl
 #endif
   };
 
+  //******************************************************************************
+  /// A pair is trivially relocatable if both of its members are.
+  template <typename T1, typename T2>
+  struct is_trivially_relocatable<etl::pair<T1, T2> >
+    : etl::integral_constant<bool, etl::is_trivially_relocatable<T1>::value && etl::is_trivially_relocatable<T2>::value> {};
+
   //******************************************************************************
 #if ETL_CPP11_SUPPORTED
   template <typename T1, typename T2>
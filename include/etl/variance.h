@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "private/statistics_kernels.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -68,6 +69,16 @@ namespace etl
     {
       typedef double calc_t;
     };
+
+    //***************************************************************************
+    /// The calculation type for a running mean and sum of squared deviations.
+    /// TCalc if it is floating point, otherwise double.
+    //***************************************************************************
+    template <typename TCalc>
+    struct welford_traits
+    {
+      typedef typename etl::conditional<etl::is_floating_point<TCalc>::value, TCalc, double>::type calc_t;
+    };
   }
 
   //***************************************************************************
@@ -130,10 +141,9 @@ namespace etl
     template <typename TIterator>
     void add(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        add(*first++);
-      }
+      typedef private_statistics::use_kernel<TIterator, TInput, calc_t> use_kernel_t;
+
+      add_range(first, last, etl::integral_constant<bool, use_kernel_t::value>());
     }
 
     //*********************************
@@ -210,12 +220,220 @@ namespace etl
 
   private:
   
+    //*********************************
+    /// Add a range, a value at a time.
+    //*********************************
+    template <typename TIterator>
+    void add_range(TIterator first, TIterator last, etl::false_type)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// Add a contiguous range of int16_t or float with the block kernel.
+    //*********************************
+    void add_range(const TInput* first, const TInput* last, etl::true_type)
+    {
+      typedef typename private_statistics::kernel<TInput>::accumulator_type accumulator_t;
+
+      const size_t n = size_t(last - first);
+
+      private_statistics::moments<accumulator_t> block;
+      private_statistics::accumulate_moments<true, true>(first, n, block);
+
+      sum_of_squares += calc_t(block.sum_of_squares);
+      sum            += calc_t(block.sum);
+      counter        += uint32_t(n);
+      recalculate = true;
+    }
+
     calc_t   sum_of_squares;
     calc_t   sum;
     uint32_t counter;
     mutable double variance_value;
     mutable bool   recalculate;
   };
+
+  //***************************************************************************
+  /// Variance, by Welford's method.
+  /// Keeps a running mean and sum of squared deviations from it, rather than
+  /// the sum and sum of squares, so that the result does not cancel away when
+  /// the mean is large compared to the spread. Each value costs a division.
+  /// Partial results, such as those from separate threads or blocks, can be
+  /// combined with merge().
+  /// The calculation type is TCalc if it is floating point, otherwise double.
+  //***************************************************************************
+  template <bool Variance_Type, typename TInput, typename TCalc = TInput>
+  class welford_variance
+  {
+  private:
+
+    static ETL_CONSTANT int Adjustment = (Variance_Type == variance_type::Population) ? 0 : 1;
+
+    typedef typename private_variance::welford_traits<TCalc>::calc_t calc_t;
+
+  public:
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    welford_variance()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    welford_variance(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      const calc_t x     = calc_t(value);
+      const calc_t delta = x - mean;
+
+      ++counter;
+      mean += delta / calc_t(counter);
+      m2   += delta * (x - mean);
+      recalculate = true;
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first++);
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Combines the values added to another with those added to this, as if
+    /// they had all been added here (Chan et al.).
+    //*********************************
+    void merge(const welford_variance& other)
+    {
+      if (other.counter != 0U)
+      {
+        if (counter == 0U)
+        {
+          mean    = other.mean;
+          m2      = other.m2;
+          counter = other.counter;
+        }
+        else
+        {
+          const calc_t n_this  = calc_t(counter);
+          const calc_t n_other = calc_t(other.counter);
+          const calc_t n       = n_this + n_other;
+          const calc_t delta   = other.mean - mean;
+
+          mean    += delta * (n_other / n);
+          m2      += other.m2 + (delta * delta * (n_this * n_other / n));
+          counter += other.counter;
+        }
+
+        recalculate = true;
+      }
+    }
+
+    //*********************************
+    /// Get the mean.
+    //*********************************
+    double get_mean() const
+    {
+      return double(mean);
+    }
+
+    //*********************************
+    /// Get the variance.
+    //*********************************
+    double get_variance() const
+    {
+      if (recalculate)
+      {
+        variance_value = 0.0;
+
+        if ((counter > uint32_t(Adjustment)) && (m2 > calc_t(0)))
+        {
+          variance_value = double(m2) / double(counter - uint32_t(Adjustment));
+        }
+
+        recalculate = false;
+      }
+
+      return variance_value;
+    }
+
+    //*********************************
+    /// Get the variance.
+    //*********************************
+    operator double() const
+    {
+      return get_variance();
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(counter);
+    }
+
+    //*********************************
+    /// Clear the variance.
+    //*********************************
+    void clear()
+    {
+      mean           = calc_t(0);
+      m2             = calc_t(0);
+      counter        = 0U;
+      variance_value = 0.0;
+      recalculate    = true;
+    }
+
+  private:
+
+    calc_t   mean;
+    calc_t   m2; ///< The sum of squared deviations from the mean.
+    uint32_t counter;
+    mutable double variance_value;
+    mutable bool   recalculate;
+  };
 }
 
 #endif
@@ -0,0 +1,393 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_VARINT_INCLUDED
+#define ETL_VARINT_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED
+  #include "span.h"
+#endif
+
+///\defgroup varint varint
+/// Variable length integer encoding, as used by protobuf.
+/// Unsigned values are encoded as LEB128, seven bits per byte, least
+/// significant group first, with the top bit set on every byte but the last.
+/// Signed values are zigzag encoded first, so that small negative numbers
+/// are short too.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Maps signed values onto unsigned ones, so that values near zero have
+  /// small encodings. 0, -1, 1, -2, 2 ... become 0, 1, 2, 3, 4 ...
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR typename etl::make_unsigned<T>::type zigzag_encode(T value)
+  {
+    ETL_STATIC_ASSERT(etl::is_signed<T>::value, "zigzag_encode requires a signed type");
+
+    typedef typename etl::make_unsigned<T>::type utype;
+
+    return utype(utype(utype(value) << 1U) ^ utype(-utype(value < 0)));
+  }
+
+  //***************************************************************************
+  /// The inverse of zigzag_encode.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR typename etl::make_signed<T>::type zigzag_decode(T value)
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<T>::value, "zigzag_decode requires an unsigned type");
+
+    typedef typename etl::make_signed<T>::type stype;
+
+    return stype((value >> 1U) ^ T(-T(value & 1U)));
+  }
+
+  //***************************************************************************
+  /// The largest number of bytes needed to encode a T.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  struct varint_max_size
+  {
+    static ETL_CONSTANT size_t value = (etl::integral_limits<T>::bits + 6U) / 7U;
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t varint_max_size<T>::value;
+
+  namespace private_varint
+  {
+    //*************************************************************************
+    /// Signed values are zigzag encoded, unsigned values are unchanged.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+      to_unsigned(T value)
+    {
+      return etl::zigzag_encode(value);
+    }
+
+    template <typename T>
+    typename etl::enable_if<!etl::is_signed<T>::value, T>::type
+      to_unsigned(T value)
+    {
+      return value;
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, T>::type
+      from_unsigned(typename etl::make_unsigned<T>::type value)
+    {
+      return etl::zigzag_decode(value);
+    }
+
+    template <typename T>
+    typename etl::enable_if<!etl::is_signed<T>::value, T>::type
+      from_unsigned(T value)
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// Encodes without checking for room.
+    //*************************************************************************
+    template <typename TUnsigned>
+    size_t encode(TUnsigned value, uint8_t* p)
+    {
+      size_t i = 0U;
+
+      while (value >= 0x80U)
+      {
+        p[i++] = uint8_t(value | 0x80U);
+        value >>= 7U;
+      }
+
+      p[i++] = uint8_t(value);
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Decodes an unsigned value.
+    /// Returns the number of bytes consumed, or zero if the input is truncated,
+    /// too long, or the value does not fit in TUnsigned.
+    //*************************************************************************
+    template <typename TUnsigned>
+    size_t decode(const uint8_t* p, size_t n, TUnsigned& value)
+    {
+      static ETL_CONSTANT int Bits = etl::integral_limits<TUnsigned>::bits;
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      // Most values are small, so handle one and two bytes without a loop.
+      const uint8_t b0 = p[0];
+
+      if (b0 < 0x80U)
+      {
+        value = TUnsigned(b0);
+        return 1U;
+      }
+
+      if ((Bits > 8) && (n >= 2U) && (p[1] < 0x80U))
+      {
+        value = TUnsigned((b0 & 0x7FU) | (TUnsigned(p[1]) << 7U));
+        return 2U;
+      }
+
+      const size_t max_size = (n < varint_max_size<TUnsigned>::value) ? n : varint_max_size<TUnsigned>::value;
+
+      TUnsigned result = 0U;
+      int       shift  = 0;
+
+      for (size_t i = 0U; i < max_size; ++i)
+      {
+        const TUnsigned chunk = TUnsigned(p[i] & 0x7FU);
+
+        // The last group may only use the bits that are left.
+        if (((shift + 7) > Bits) && ((chunk >> (Bits - shift)) != 0U))
+        {
+          return 0U;
+        }
+
+        result |= TUnsigned(chunk << shift);
+
+        if (p[i] < 0x80U)
+        {
+          value = result;
+          return i + 1U;
+        }
+
+        shift += 7;
+      }
+
+      return 0U;
+    }
+  }
+
+  //***************************************************************************
+  /// The number of bytes needed to encode value.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  size_t varint_size(T value)
+  {
+    typename etl::make_unsigned<T>::type u = private_varint::to_unsigned(value);
+
+    size_t size = 1U;
+
+    while (u >= 0x80U)
+    {
+      u >>= 7U;
+      ++size;
+    }
+
+    return size;
+  }
+
+  //***************************************************************************
+  /// Encodes value into the n bytes at p.
+  /// Signed types are zigzag encoded.
+  /// Returns the number of bytes written, or zero if there is not enough room.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_encode(T value, uint8_t* p, size_t n)
+  {
+    if ((n < varint_max_size<T>::value) && (n < varint_size(value)))
+    {
+      return 0U;
+    }
+
+    return private_varint::encode(private_varint::to_unsigned(value), p);
+  }
+
+  //***************************************************************************
+  /// Decodes a value from the n bytes at p.
+  /// Signed types are zigzag decoded.
+  /// Returns the number of bytes consumed, or zero if the input is truncated,
+  /// malformed, or the value does not fit in T.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_decode(const uint8_t* p, size_t n, T& value)
+  {
+    typename etl::make_unsigned<T>::type u;
+
+    const size_t used = private_varint::decode(p, n, u);
+
+    if (used != 0U)
+    {
+      value = private_varint::from_unsigned<T>(u);
+    }
+
+    return used;
+  }
+
+  //***************************************************************************
+  /// Encodes count values into the n bytes at p.
+  /// Returns the number of bytes written, or zero if there is not enough room.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_encode(const T* values, size_t count, uint8_t* p, size_t n)
+  {
+    size_t total = 0U;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      const size_t used = varint_encode(values[i], p + total, n - total);
+
+      if (used == 0U)
+      {
+        return 0U;
+      }
+
+      total += used;
+    }
+
+    return total;
+  }
+
+  //***************************************************************************
+  /// Decodes count values from the n bytes at p.
+  /// Returns the number of bytes consumed, or zero if any value could not be
+  /// decoded.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_decode(const uint8_t* p, size_t n, T* values, size_t count)
+  {
+    typedef typename etl::make_unsigned<T>::type utype;
+
+    size_t total = 0U;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      if (total == n)
+      {
+        return 0U;
+      }
+
+      // Single byte values are taken directly.
+      const uint8_t b = p[total];
+
+      if (b < 0x80U)
+      {
+        values[i] = private_varint::from_unsigned<T>(utype(b));
+        ++total;
+      }
+      else
+      {
+        const size_t used = varint_decode(p + total, n - total, values[i]);
+
+        if (used == 0U)
+        {
+          return 0U;
+        }
+
+        total += used;
+      }
+    }
+
+    return total;
+  }
+
+#if ETL_CPP11_SUPPORTED
+  //***************************************************************************
+  /// Encodes value into a span.
+  /// Returns the number of bytes written, or zero if there is not enough room.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T, size_t VExtent>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_encode(T value, const etl::span<uint8_t, VExtent>& output)
+  {
+    return varint_encode(value, output.data(), output.size());
+  }
+
+  //***************************************************************************
+  /// Decodes a value from a span.
+  /// Returns the number of bytes consumed, or zero on failure.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T, size_t VExtent>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_decode(const etl::span<const uint8_t, VExtent>& input, T& value)
+  {
+    return varint_decode(input.data(), input.size(), value);
+  }
+
+  //***************************************************************************
+  /// Encodes a span of values into a span.
+  /// Returns the number of bytes written, or zero if there is not enough room.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T, size_t VExtent1, size_t VExtent2>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_encode(const etl::span<const T, VExtent1>& values, const etl::span<uint8_t, VExtent2>& output)
+  {
+    return varint_encode(values.data(), values.size(), output.data(), output.size());
+  }
+
+  //***************************************************************************
+  /// Decodes a span of values from a span.
+  /// Returns the number of bytes consumed, or zero on failure.
+  ///\ingroup varint
+  //***************************************************************************
+  template <typename T, size_t VExtent1, size_t VExtent2>
+  typename etl::enable_if<etl::is_integral<T>::value, size_t>::type
+    varint_decode(const etl::span<const uint8_t, VExtent1>& input, const etl::span<T, VExtent2>& values)
+  {
+    return varint_decode(input.data(), input.size(), values.data(), values.size());
+  }
+#endif
+}
+
+#endif
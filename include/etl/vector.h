@@ -35,7 +35,7 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
-#include <stddef.h>
+#include <string.h>
 
 #include "platform.h"
 #include "algorithm.h"
@@ -451,6 +451,30 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking for space,
+    /// whatever ETL_CHECK_PUSH_POP is set to.
+    /// For loops that have already checked, or sized, the vector.
+    /// Undefined behaviour if the vector is full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(const_reference value)
+    {
+      create_back(value);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value at the end of the vector without checking for space.
+    /// Undefined behaviour if the vector is full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back_unchecked(rvalue_reference value)
+    {
+      create_back(etl::move(value));
+    }
+#endif
+
 #if ETL_CPP11_SUPPORTED && ETL_NOT_USING_STLPORT && !defined(ETL_VECTOR_FORCE_CPP03)
     //*********************************************************************
     /// Constructs a value at the end of the vector.
@@ -545,6 +569,16 @@ namespace etl
       destroy_back();
     }
 
+    //*************************************************************************
+    /// Removes an element from the end of the vector without checking that
+    /// there is one, whatever ETL_CHECK_PUSH_POP is set to.
+    /// Undefined behaviour if the vector is empty.
+    //*************************************************************************
+    void pop_back_unchecked()
+    {
+      destroy_back();
+    }
+
     //*********************************************************************
     /// Inserts a value to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -559,6 +593,11 @@ namespace etl
       {
         create_back(value);
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        relocate_tail(position, 1U);
+        etl::create_copy_at(etl::addressof(*position), value);
+      }
       else
       {
         create_back(back());
@@ -584,6 +623,11 @@ namespace etl
       {
         create_back(etl::move(value));
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        relocate_tail(position, 1U);
+        etl::create_copy_at(etl::addressof(*position), etl::move(value));
+      }
       else
       {
         create_back(etl::move(back()));
@@ -614,9 +658,17 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        etl::move_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          relocate_tail(position, 1U);
+        }
+        else
+        {
+          create_back(back());
+          etl::move_backward(position, p_end - 2, p_end - 1);
+          (*position).~T();
+        }
       }
 
       ::new (p) T(etl::forward<Args>(args)...);
@@ -639,9 +691,17 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        etl::move_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          relocate_tail(position, 1U);
+        }
+        else
+        {
+          create_back(back());
+          etl::move_backward(position, p_end - 2, p_end - 1);
+          (*position).~T();
+        }
       }
 
       ::new (p) T(value1);
@@ -664,9 +724,17 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        etl::move_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          relocate_tail(position, 1U);
+        }
+        else
+        {
+          create_back(back());
+          etl::move_backward(position, p_end - 2, p_end - 1);
+          (*position).~T();
+        }
       }
 
       ::new (p) T(value1, value2);
@@ -689,9 +757,17 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        etl::move_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          relocate_tail(position, 1U);
+        }
+        else
+        {
+          create_back(back());
+          etl::move_backward(position, p_end - 2, p_end - 1);
+          (*position).~T();
+        }
       }
 
       ::new (p) T(value1, value2, value3);
@@ -714,9 +790,17 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        etl::move_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+
+        if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+        {
+          relocate_tail(position, 1U);
+        }
+        else
+        {
+          create_back(back());
+          etl::move_backward(position, p_end - 2, p_end - 1);
+          (*position).~T();
+        }
       }
 
       ::new (p) T(value1, value2, value3, value4);
@@ -736,6 +820,13 @@ namespace etl
     {
       ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        relocate_tail(position, n);
+        etl::uninitialized_fill_n(position, n, value);
+        return;
+      }
+
       size_t insert_n = n;
       size_t insert_begin = etl::distance(begin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -793,6 +884,13 @@ namespace etl
 
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        relocate_tail(position, count);
+        etl::uninitialized_copy(first, last, position);
+        return;
+      }
+
       size_t insert_n = count;
       size_t insert_begin = etl::distance(begin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -842,8 +940,16 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      etl::move(i_element + 1, end(), i_element);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(etl::addressof(*i_element));
+        close_gap(i_element, i_element + 1);
+      }
+      else
+      {
+        etl::move(i_element + 1, end(), i_element);
+        destroy_back();
+      }
 
       return i_element;
     }
@@ -862,6 +968,11 @@ namespace etl
       {
         clear();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy(first, last);
+        close_gap(first, last);
+      }
       else
       {
         etl::move(last, end(), first);
@@ -898,14 +1009,7 @@ namespace etl
       if (&rhs != this)
       {
         clear();
-        iterator itr = rhs.begin();
-        while (itr != rhs.end())
-        {
-          push_back(etl::move(*itr));
-          ++itr;
-        }
-
-        rhs.initialise();
+        move_container(rhs);
       }
 
       return *this;
@@ -988,11 +1092,71 @@ namespace etl
       p_end    = p_buffer_ + length;
     }
 
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Moves the contents of an empty vector's buffer from rhs, leaving rhs empty.
+    /// Trivially relocatable types are transferred with a single memcpy.
+    //*************************************************************************
+    void move_container(ivector& rhs)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        const size_t n = rhs.size();
+        ETL_ASSERT(n <= CAPACITY, ETL_ERROR(vector_full));
+
+        memcpy(static_cast<void*>(p_buffer), static_cast<const void*>(rhs.p_buffer), n * sizeof(T));
+        p_end = p_buffer + n;
+        ETL_ADD_DEBUG_COUNT(n)
+
+        // The elements now live in this vector, so they must not be destroyed in rhs.
+        rhs.p_end = rhs.p_buffer;
+        ETL_OBJECT_RESET_DEBUG_COUNT(rhs)
+      }
+      else
+      {
+        iterator itr = rhs.begin();
+        while (itr != rhs.end())
+        {
+          push_back(etl::move(*itr));
+          ++itr;
+        }
+
+        rhs.initialise();
+      }
+    }
+#endif
+
     pointer p_buffer; ///< Pointer to the start of the buffer.
     pointer p_end;    ///< Pointer to one past the last element in the buffer.
 
   private:
 
+    //*********************************************************************
+    /// Shifts the elements from position to the end up by n with a single
+    /// memmove, leaving n slots of raw storage at position.
+    /// Only used for trivially relocatable types.
+    //*********************************************************************
+    void relocate_tail(iterator position, size_t n)
+    {
+      memmove(static_cast<void*>(position + n), static_cast<const void*>(position), size_t(p_end - position) * sizeof(T));
+      ETL_ADD_DEBUG_COUNT(n)
+      p_end += n;
+    }
+
+    //*********************************************************************
+    /// Closes the gap left by already destroyed elements in [first, last)
+    /// by shifting the tail down with a single memmove.
+    /// Only used for trivially relocatable types.
+    //*********************************************************************
+    void close_gap(iterator first, iterator last)
+    {
+      const size_t n = size_t(last - first);
+
+      memmove(static_cast<void*>(first), static_cast<const void*>(last), size_t(p_end - last) * sizeof(T));
+      ETL_SUBTRACT_DEBUG_COUNT(n)
+      p_end -= n;
+    }
+
     //*********************************************************************
     /// Create a new element with a default value at the back.
     //*********************************************************************
@@ -1244,15 +1408,7 @@ namespace etl
       if (this != &other)
       {
         this->initialise();
-
-        typename etl::ivector<T>::iterator itr = other.begin();
-        while (itr != other.end())
-        {
-          this->push_back(etl::move(*itr));
-          ++itr;
-        }
-
-        other.initialise();
+        this->move_container(other);
       }
     }
 
@@ -1264,14 +1420,7 @@ namespace etl
       if (&rhs != this)
       {
         this->clear();
-        typename etl::ivector<T>::iterator itr = rhs.begin();
-        while (itr != rhs.end())
-        {
-          this->push_back(etl::move(*itr));
-          ++itr;
-        }
-
-        rhs.initialise();
+        this->move_container(rhs);
       }
 
       return *this;
@@ -1417,15 +1566,7 @@ namespace etl
       if (this != &other)
       {
         this->initialise();
-
-        typename etl::ivector<T>::iterator itr = other.begin();
-        while (itr != other.end())
-        {
-          this->push_back(etl::move(*itr));
-          ++itr;
-        }
-
-        other.initialise();
+        this->move_container(other);
       }
     }
 
@@ -1437,15 +1578,7 @@ namespace etl
       if (&rhs != this)
       {
         this->clear();
-
-        typename etl::ivector<T>::iterator itr = rhs.begin();
-        while (itr != rhs.end())
-        {
-          this->push_back(etl::move(*itr));
-          ++itr;
-        }
-
-        rhs.initialise();
+        this->move_container(rhs);
       }
 
       return *this;
@@ -0,0 +1,318 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_DEQUE_INCLUDED
+#define ETL_WORK_STEALING_DEQUE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "power.h"
+#include "static_assert.h"
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup work_stealing_deque work_stealing_deque
+/// A fixed capacity, lock free deque for one owner thread and any number of
+/// thief threads, as used for the per worker task queues of a thread pool.
+/// The owner pushes and pops at the bottom, so it works on its most recent
+/// tasks first. Thieves steal from the top, taking the oldest tasks.
+/// Based on the Chase-Lev deque, with the memory orderings from
+/// "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al.).
+/// The buffer does not grow. A push to a full deque fails.
+/// The values are held in atomics, so T must be an integral or pointer type,
+/// such as a pointer to a task.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for specifically sized work_stealing_deques.
+  /// Can be used as a reference type for all work_stealing_deques containing a specific type.
+  /// push and pop must only be called from the owner thread.
+  /// steal, empty and size may be called from any thread.
+  ///\ingroup work_stealing_deque
+  //***************************************************************************
+  template <typename T>
+  class iwork_stealing_deque
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value || etl::is_pointer<T>::value, "T must be an integral or pointer type");
+
+    typedef T      value_type; ///< The type stored in the deque.
+    typedef size_t size_type;  ///< The type used for determining the size of the deque.
+
+    //*************************************************************************
+    /// Pushes a value to the bottom of the deque.
+    /// Owner thread only.
+    ///\return <b>false</b> if the deque is full.
+    //*************************************************************************
+    bool push(T value)
+    {
+      size_type b = bottom.load(etl::memory_order_relaxed);
+      size_type t = top.load(etl::memory_order_acquire);
+
+      if ((b - t) >= MAX_SIZE)
+      {
+        // Deque is full.
+        return false;
+      }
+
+      p_buffer[b & MASK].store(value, etl::memory_order_relaxed);
+
+      bottom.store(b + 1, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops the most recently pushed value from the bottom of the deque.
+    /// Owner thread only.
+    ///\return <b>false</b> if the deque is empty, or the last value was stolen.
+    //*************************************************************************
+    bool pop(T& value)
+    {
+      size_type b = bottom.load(etl::memory_order_relaxed) - 1;
+
+      // Claim the bottom value before looking at the top.
+      bottom.store(b, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+
+      size_type t = top.load(etl::memory_order_relaxed);
+
+      if (difference_type(b - t) < 0)
+      {
+        // Deque is empty.
+        bottom.store(b + 1, etl::memory_order_relaxed);
+        return false;
+      }
+
+      T result = p_buffer[b & MASK].load(etl::memory_order_relaxed);
+
+      if (b == t)
+      {
+        // The last value. Race the thieves for it.
+        bool won = top.compare_exchange_strong(t, t + 1, etl::memory_order_seq_cst, etl::memory_order_relaxed);
+
+        bottom.store(b + 1, etl::memory_order_relaxed);
+
+        if (!won)
+        {
+          return false;
+        }
+      }
+
+      value = result;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Steals the oldest value from the top of the deque.
+    /// Any thread.
+    ///\return <b>false</b> if the deque is empty, or another thread took the value first.
+    //*************************************************************************
+    bool steal(T& value)
+    {
+      size_type t = top.load(etl::memory_order_acquire);
+      etl::atomic_thread_fence(etl::memory_order_seq_cst);
+      size_type b = bottom.load(etl::memory_order_acquire);
+
+      if (difference_type(b - t) <= 0)
+      {
+        // Deque is empty.
+        return false;
+      }
+
+      T result = p_buffer[t & MASK].load(etl::memory_order_relaxed);
+
+      if (!top.compare_exchange_strong(t, t + 1, etl::memory_order_seq_cst, etl::memory_order_relaxed))
+      {
+        // Lost the race to the owner or another thief.
+        return false;
+      }
+
+      value = result;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// How many values are in the deque?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type t = top.load(etl::memory_order_acquire);
+      size_type b = bottom.load(etl::memory_order_acquire);
+
+      difference_type n = difference_type(b - t);
+
+      return (n < 0) ? 0 : size_type(n);
+    }
+
+    //*************************************************************************
+    /// Is the deque empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the deque full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() >= MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many values can the deque hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many values can the deque hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iwork_stealing_deque(etl::atomic<T>* p_buffer_, size_type max_size_)
+      : p_buffer(p_buffer_),
+        MAX_SIZE(max_size_),
+        MASK(max_size_ - 1),
+        top(0),
+        bottom(0)
+    {
+    }
+
+  private:
+
+    typedef etl::make_signed<size_type>::type difference_type;
+
+    // Disable copy construction and assignment.
+    iwork_stealing_deque(const iwork_stealing_deque&) ETL_DELETE;
+    iwork_stealing_deque& operator =(const iwork_stealing_deque&) ETL_DELETE;
+
+    etl::atomic<T>* p_buffer;   ///< The internal buffer.
+    const size_type MAX_SIZE;   ///< The maximum number of values in the deque.
+    const size_type MASK;       ///< Converts a position to a buffer index.
+#if ETL_CACHE_LINE_SIZE > 0
+    char size_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    // The top is written by the thieves and the bottom by the owner.
+    etl::atomic<size_type> top;    ///< The next position to steal from.
+#if ETL_CACHE_LINE_SIZE > 0
+    char top_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    etl::atomic<size_type> bottom; ///< The next position to push to.
+#if ETL_CACHE_LINE_SIZE > 0
+    char bottom_padding[ETL_CACHE_LINE_SIZE];
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_WORK_STEALING_DEQUE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iwork_stealing_deque()
+    {
+    }
+#else
+  protected:
+    ~iwork_stealing_deque()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A fixed capacity work stealing deque.
+  ///\tparam T    The type of value stored. Must be an integral or pointer type.
+  ///\tparam SIZE The maximum number of values. Must be a power of 2.
+  ///\ingroup work_stealing_deque
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  class work_stealing_deque : public etl::iwork_stealing_deque<T>
+  {
+  private:
+
+    typedef etl::iwork_stealing_deque<T> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(((SIZE == 1) || etl::is_power_of_2<SIZE>::value), "Size must be a power of 2");
+
+    static ETL_CONSTANT size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    work_stealing_deque()
+      : base_t(buffer, MAX_SIZE)
+    {
+    }
+
+  private:
+
+    work_stealing_deque(const work_stealing_deque&) ETL_DELETE;
+    work_stealing_deque& operator =(const work_stealing_deque&) ETL_DELETE;
+
+    etl::atomic<T> buffer[SIZE]; ///< The values.
+  };
+
+  template <typename T, const size_t SIZE>
+  ETL_CONSTANT size_t work_stealing_deque<T, SIZE>::MAX_SIZE;
+}
+
+#endif
+
+#endif
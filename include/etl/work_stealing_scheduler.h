@@ -0,0 +1,415 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_SCHEDULER_INCLUDED
+#define ETL_WORK_STEALING_SCHEDULER_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "algorithm.h"
+#include "vector.h"
+#include "function.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "task.h"
+#include "scheduler.h"
+#include "work_stealing_deque.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// 'Invalid worker' exception.
+  //***************************************************************************
+  class scheduler_invalid_worker_exception : public etl::scheduler_exception
+  {
+  public:
+
+    scheduler_invalid_worker_exception(string_type file_name_, numeric_type line_number_)
+      : etl::scheduler_exception(ETL_ERROR_TEXT("scheduler:invalid worker", ETL_SCHEDULER_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A scheduler that runs tasks on several worker loops, one for each
+  /// thread or core.
+  /// Each worker has its own tasks and its own run queue of those that have
+  /// work. A worker runs its highest priority task with work. When it has
+  /// none, it steals a ready task from another worker.
+  /// A task may be pinned to a worker, in which case only that worker runs it.
+  /// A task is never run by two workers at the same time.
+  /// Tasks are added before the workers are started.
+  ///\tparam MAX_TASKS_   The maximum number of tasks.
+  ///\tparam MAX_WORKERS_ The number of workers.
+  //***************************************************************************
+  template <const size_t MAX_TASKS_, const size_t MAX_WORKERS_>
+  class work_stealing_scheduler
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TASKS_ > 0U,   "There must be at least one task");
+    ETL_STATIC_ASSERT(MAX_WORKERS_ > 0U, "There must be at least one worker");
+
+    enum
+    {
+      MAX_TASKS   = MAX_TASKS_,
+      MAX_WORKERS = MAX_WORKERS_
+    };
+
+    /// The worker id for a task that any worker may run.
+    static ETL_CONSTANT size_t ANY_WORKER = etl::integral_limits<size_t>::max;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    work_stealing_scheduler()
+      : n_tasks(0U),
+        scheduler_exit(false),
+        p_idle_callback(ETL_NULLPTR),
+        p_watchdog_callback(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Set the idle callback.
+    /// Called with the id of a worker that found no work.
+    //*******************************************
+    void set_idle_callback(etl::ifunction<size_t>& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback.
+    /// Called with the id of the worker after each pass.
+    //*******************************************
+    void set_watchdog_callback(etl::ifunction<size_t>& callback)
+    {
+      p_watchdog_callback = &callback;
+    }
+
+    //*******************************************
+    /// Add a task.
+    /// If worker_id_ is ANY_WORKER, the task is given to the worker with
+    /// the fewest tasks, and may be stolen by the others.
+    /// Otherwise, the task is pinned to that worker.
+    //*******************************************
+    void add_task(etl::task& task, size_t worker_id_ = ANY_WORKER)
+    {
+      ETL_ASSERT(n_tasks < MAX_TASKS, ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+      ETL_ASSERT((worker_id_ == ANY_WORKER) || (worker_id_ < MAX_WORKERS), ETL_ERROR(etl::scheduler_invalid_worker_exception));
+
+      if ((n_tasks < MAX_TASKS) && ((worker_id_ == ANY_WORKER) || (worker_id_ < MAX_WORKERS)))
+      {
+        task_entry& entry = entries[n_tasks++];
+
+        entry.p_task    = &task;
+        entry.stealable = (worker_id_ == ANY_WORKER);
+        entry.queued.store(false);
+
+        if (entry.stealable)
+        {
+          worker& home = workers[least_loaded_worker()];
+
+          // Ascending priority, so the highest priority is pushed last, and popped first.
+          typename task_list_t::iterator itask = etl::upper_bound(home.stealable_tasks.begin(),
+                                                                  home.stealable_tasks.end(),
+                                                                  task.get_task_priority(),
+                                                                  compare_ascending());
+          home.stealable_tasks.insert(itask, &entry);
+        }
+        else
+        {
+          worker& home = workers[worker_id_];
+
+          typename task_list_t::iterator itask = etl::upper_bound(home.pinned_tasks.begin(),
+                                                                  home.pinned_tasks.end(),
+                                                                  task.get_task_priority(),
+                                                                  compare_descending());
+          home.pinned_tasks.insert(itask, &entry);
+        }
+
+        task.on_task_added();
+      }
+    }
+
+    //*******************************************
+    /// Runs the worker loop until exit_scheduler() is called.
+    /// Call from the thread or core for the worker.
+    //*******************************************
+    void start(size_t worker_id)
+    {
+      ETL_ASSERT(n_tasks > 0U, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      while (!scheduler_exit.load())
+      {
+        bool idle = !process(worker_id);
+
+        if (p_watchdog_callback)
+        {
+          (*p_watchdog_callback)(worker_id);
+        }
+
+        if (idle && p_idle_callback)
+        {
+          (*p_idle_callback)(worker_id);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Makes one pass of the worker loop.
+    /// Runs one unit of work from a task, if there is any.
+    /// Returns true if work was done.
+    //*******************************************
+    bool process(size_t worker_id)
+    {
+      worker& self = workers[worker_id];
+
+      if (self.run_queue.empty())
+      {
+        refill(self);
+      }
+
+      // The highest priority pinned task with work.
+      task_entry* p_pinned = ETL_NULLPTR;
+
+      for (size_t i = 0U; i < self.pinned_tasks.size(); ++i)
+      {
+        if (self.pinned_tasks[i]->p_task->task_request_work() > 0U)
+        {
+          p_pinned = self.pinned_tasks[i];
+          break;
+        }
+      }
+
+      // The highest priority ready task from the run queue.
+      task_entry* p_ready = ETL_NULLPTR;
+
+      if (self.run_queue.pop(p_ready))
+      {
+        if ((p_pinned != ETL_NULLPTR) &&
+            (p_pinned->p_task->get_task_priority() > p_ready->p_task->get_task_priority()))
+        {
+          // Keep it for later.
+          self.run_queue.push(p_ready);
+          p_ready = ETL_NULLPTR;
+        }
+      }
+      else if (p_pinned == ETL_NULLPTR)
+      {
+        p_ready = steal(worker_id);
+      }
+
+      if (p_ready != ETL_NULLPTR)
+      {
+        p_ready->p_task->task_process_work();
+
+        // The task may now be queued again.
+        p_ready->queued.store(false);
+
+        return true;
+      }
+
+      if (p_pinned != ETL_NULLPTR)
+      {
+        p_pinned->p_task->task_process_work();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Force the workers to exit.
+    //*******************************************
+    void exit_scheduler()
+    {
+      scheduler_exit.store(true);
+    }
+
+    //*******************************************
+    /// Gets the number of tasks.
+    //*******************************************
+    size_t size() const
+    {
+      return n_tasks;
+    }
+
+  private:
+
+    //*******************************************
+    /// A task and its run state.
+    //*******************************************
+    struct task_entry
+    {
+      task_entry()
+        : p_task(ETL_NULLPTR),
+          queued(false),
+          stealable(false)
+      {
+      }
+
+      etl::task*       p_task;
+      etl::atomic_bool queued;    ///< In a run queue, or being run.
+      bool             stealable;
+    };
+
+    typedef etl::vector<task_entry*, MAX_TASKS> task_list_t;
+
+    static ETL_CONSTANT size_t QUEUE_SIZE = etl::power_of_2_round_up<MAX_TASKS>::value;
+
+    //*******************************************
+    /// A worker's tasks and run queue.
+    //*******************************************
+    struct worker
+    {
+      task_list_t stealable_tasks; ///< In ascending priority.
+      task_list_t pinned_tasks;    ///< In descending priority.
+      etl::work_stealing_deque<task_entry*, QUEUE_SIZE> run_queue;
+    };
+
+    //*******************************************
+    struct compare_ascending
+    {
+      bool operator()(etl::task_priority_t priority, const task_entry* p_entry) const
+      {
+        return priority < p_entry->p_task->get_task_priority();
+      }
+    };
+
+    //*******************************************
+    struct compare_descending
+    {
+      bool operator()(etl::task_priority_t priority, const task_entry* p_entry) const
+      {
+        return priority > p_entry->p_task->get_task_priority();
+      }
+    };
+
+    //*******************************************
+    /// Queues the worker's stealable tasks that have work.
+    /// A task is claimed before it is asked, so it is never asked for work
+    /// while another worker is running it.
+    //*******************************************
+    void refill(worker& self)
+    {
+      for (size_t i = 0U; i < self.stealable_tasks.size(); ++i)
+      {
+        task_entry& entry = *self.stealable_tasks[i];
+
+        bool expected = false;
+
+        if (entry.queued.compare_exchange_strong(expected, true))
+        {
+          if (entry.p_task->task_request_work() > 0U)
+          {
+            self.run_queue.push(&entry);
+          }
+          else
+          {
+            entry.queued.store(false);
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Steals a ready task from one of the other workers.
+    //*******************************************
+    task_entry* steal(size_t worker_id)
+    {
+      task_entry* p_entry = ETL_NULLPTR;
+
+      for (size_t i = 1U; i < MAX_WORKERS; ++i)
+      {
+        worker& victim = workers[(worker_id + i) % MAX_WORKERS];
+
+        if (victim.run_queue.steal(p_entry))
+        {
+          return p_entry;
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// The worker with the fewest tasks.
+    //*******************************************
+    size_t least_loaded_worker() const
+    {
+      size_t id    = 0U;
+      size_t least = MAX_TASKS + 1U;
+
+      for (size_t i = 0U; i < MAX_WORKERS; ++i)
+      {
+        const size_t load = workers[i].stealable_tasks.size() + workers[i].pinned_tasks.size();
+
+        if (load < least)
+        {
+          least = load;
+          id    = i;
+        }
+      }
+
+      return id;
+    }
+
+    task_entry       entries[MAX_TASKS];
+    size_t           n_tasks;
+    worker           workers[MAX_WORKERS];
+    etl::atomic_bool scheduler_exit;
+    etl::ifunction<size_t>* p_idle_callback;
+    etl::ifunction<size_t>* p_watchdog_callback;
+
+    // Disabled.
+    work_stealing_scheduler(const work_stealing_scheduler&) ETL_DELETE;
+    work_stealing_scheduler& operator =(const work_stealing_scheduler&) ETL_DELETE;
+  };
+
+  template <const size_t MAX_TASKS_, const size_t MAX_WORKERS_>
+  ETL_CONSTANT size_t work_stealing_scheduler<MAX_TASKS_, MAX_WORKERS_>::ANY_WORKER;
+
+  template <const size_t MAX_TASKS_, const size_t MAX_WORKERS_>
+  ETL_CONSTANT size_t work_stealing_scheduler<MAX_TASKS_, MAX_WORKERS_>::QUEUE_SIZE;
+}
+
+#endif
+
+#endif
@@ -428,8 +428,8 @@ namespace etl
   {
     size_t operator()(const etl::iwstring& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -438,8 +438,8 @@ namespace etl
   {
     size_t operator()(const etl::wstring<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 
@@ -448,8 +448,8 @@ namespace etl
   {
     size_t operator()(const etl::wstring_ext& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
-                                                     reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      return etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+                                                           reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
 #endif
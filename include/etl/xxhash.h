@@ -0,0 +1,576 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_XXHASH_INCLUDED
+#define ETL_XXHASH_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "ihash.h"
+#include "binary.h"
+#include "error_handler.h"
+#include "iterator.h"
+#include "static_assert.h"
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup xxhash xxHash hash calculations
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_xxhash
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit word from a random access iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    uint32_t read32(TIterator p)
+    {
+      return  uint32_t(uint8_t(p[0]))        | (uint32_t(uint8_t(p[1])) << 8) |
+             (uint32_t(uint8_t(p[2])) << 16) | (uint32_t(uint8_t(p[3])) << 24);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Reads a little endian 64 bit word from a random access iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    uint64_t read64(TIterator p)
+    {
+      return uint64_t(read32(p)) | (uint64_t(read32(p + 4)) << 32);
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Calculates the 32 bit xxHash (XXH32).
+  /// Data is consumed in 16 byte stripes across four independent lanes.
+  /// See https://github.com/Cyan4973/xxHash for more details.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash32
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash32(value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash32(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      lane[0]      = seed + PRIME1 + PRIME2;
+      lane[1]      = seed + PRIME2;
+      lane[2]      = seed;
+      lane[3]      = seed - PRIME1;
+      hash         = 0;
+      char_count   = 0;
+      buffer_size  = 0;
+      is_finalised = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_value(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a value to the stripe buffer.
+    //*************************************************************************
+    void add_value(uint8_t value_)
+    {
+      buffer[buffer_size] = value_;
+
+      if (++buffer_size == STRIPE_SIZE)
+      {
+        add_stripe(buffer);
+        buffer_size = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range from a random access iterator.
+    /// Whole stripes are read directly from the data without buffering.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, ETL_OR_STD::random_access_iterator_tag)
+    {
+      // Complete any partially filled stripe.
+      while ((buffer_size != 0) && (begin != end))
+      {
+        add_value(uint8_t(*begin++));
+      }
+
+      while ((end - begin) >= STRIPE_SIZE)
+      {
+        add_stripe(begin);
+        begin      += STRIPE_SIZE;
+        char_count += STRIPE_SIZE;
+      }
+
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range from any other iterator.
+    //*************************************************************************
+    template<typename TIterator, typename TIteratorCategory>
+    void add_range(TIterator begin, const TIterator end, TIteratorCategory)
+    {
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Mixes one word into a lane.
+    //*************************************************************************
+    static value_type round(value_type accumulator, value_type input)
+    {
+      accumulator += input * PRIME2;
+      accumulator  = etl::rotate_left(accumulator, 13);
+
+      return accumulator * PRIME1;
+    }
+
+    //*************************************************************************
+    /// Adds a full stripe to the lanes.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_stripe(TIterator p)
+    {
+      lane[0] = round(lane[0], private_xxhash::read32(p));
+      lane[1] = round(lane[1], private_xxhash::read32(p + 4));
+      lane[2] = round(lane[2], private_xxhash::read32(p + 8));
+      lane[3] = round(lane[3], private_xxhash::read32(p + 12));
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        if (char_count >= STRIPE_SIZE)
+        {
+          hash = etl::rotate_left(lane[0], 1)  + etl::rotate_left(lane[1], 7) +
+                 etl::rotate_left(lane[2], 12) + etl::rotate_left(lane[3], 18);
+        }
+        else
+        {
+          hash = seed + PRIME5;
+        }
+
+        hash += value_type(char_count);
+
+        const uint8_t* p         = buffer;
+        const uint8_t* const end = buffer + buffer_size;
+
+        while ((end - p) >= 4)
+        {
+          hash += private_xxhash::read32(p) * PRIME3;
+          hash  = etl::rotate_left(hash, 17) * PRIME4;
+          p    += 4;
+        }
+
+        while (p != end)
+        {
+          hash += value_type(*p++) * PRIME5;
+          hash  = etl::rotate_left(hash, 11) * PRIME1;
+        }
+
+        hash ^= (hash >> 15);
+        hash *= PRIME2;
+        hash ^= (hash >> 13);
+        hash *= PRIME3;
+        hash ^= (hash >> 16);
+
+        is_finalised = true;
+      }
+    }
+
+    static ETL_CONSTANT uint8_t    STRIPE_SIZE = 16;
+    static ETL_CONSTANT value_type PRIME1      = 0x9E3779B1UL;
+    static ETL_CONSTANT value_type PRIME2      = 0x85EBCA77UL;
+    static ETL_CONSTANT value_type PRIME3      = 0xC2B2AE3DUL;
+    static ETL_CONSTANT value_type PRIME4      = 0x27D4EB2FUL;
+    static ETL_CONSTANT value_type PRIME5      = 0x165667B1UL;
+
+    bool       is_finalised;
+    uint8_t    buffer_size;
+    size_t     char_count;
+    value_type lane[4];
+    value_type hash;
+    value_type seed;
+    uint8_t    buffer[STRIPE_SIZE];
+  };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 64 bit xxHash (XXH64).
+  /// Data is consumed in 32 byte stripes across four independent lanes.
+  /// See https://github.com/Cyan4973/xxHash for more details.
+  ///\ingroup xxhash
+  //***************************************************************************
+  class xxhash64
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    xxhash64(value_type seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    xxhash64(TIterator begin, const TIterator end, value_type seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      lane[0]      = seed + PRIME1 + PRIME2;
+      lane[1]      = seed + PRIME2;
+      lane[2]      = seed;
+      lane[3]      = seed - PRIME1;
+      hash         = 0;
+      char_count   = 0;
+      buffer_size  = 0;
+      is_finalised = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, typename etl::iterator_traits<TIterator>::iterator_category());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_value(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a value to the stripe buffer.
+    //*************************************************************************
+    void add_value(uint8_t value_)
+    {
+      buffer[buffer_size] = value_;
+
+      if (++buffer_size == STRIPE_SIZE)
+      {
+        add_stripe(buffer);
+        buffer_size = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range from a random access iterator.
+    /// Whole stripes are read directly from the data without buffering.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, ETL_OR_STD::random_access_iterator_tag)
+    {
+      // Complete any partially filled stripe.
+      while ((buffer_size != 0) && (begin != end))
+      {
+        add_value(uint8_t(*begin++));
+      }
+
+      while ((end - begin) >= STRIPE_SIZE)
+      {
+        add_stripe(begin);
+        begin      += STRIPE_SIZE;
+        char_count += STRIPE_SIZE;
+      }
+
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range from any other iterator.
+    //*************************************************************************
+    template<typename TIterator, typename TIteratorCategory>
+    void add_range(TIterator begin, const TIterator end, TIteratorCategory)
+    {
+      while (begin != end)
+      {
+        add_value(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Mixes one word into a lane.
+    //*************************************************************************
+    static value_type round(value_type accumulator, value_type input)
+    {
+      accumulator += input * PRIME2;
+      accumulator  = etl::rotate_left(accumulator, 31);
+
+      return accumulator * PRIME1;
+    }
+
+    //*************************************************************************
+    /// Merges a lane into the converged hash.
+    //*************************************************************************
+    static value_type merge_round(value_type accumulator, value_type input)
+    {
+      accumulator ^= round(0, input);
+
+      return (accumulator * PRIME1) + PRIME4;
+    }
+
+    //*************************************************************************
+    /// Adds a full stripe to the lanes.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_stripe(TIterator p)
+    {
+      lane[0] = round(lane[0], private_xxhash::read64(p));
+      lane[1] = round(lane[1], private_xxhash::read64(p + 8));
+      lane[2] = round(lane[2], private_xxhash::read64(p + 16));
+      lane[3] = round(lane[3], private_xxhash::read64(p + 24));
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        if (char_count >= STRIPE_SIZE)
+        {
+          hash = etl::rotate_left(lane[0], 1)  + etl::rotate_left(lane[1], 7) +
+                 etl::rotate_left(lane[2], 12) + etl::rotate_left(lane[3], 18);
+
+          hash = merge_round(hash, lane[0]);
+          hash = merge_round(hash, lane[1]);
+          hash = merge_round(hash, lane[2]);
+          hash = merge_round(hash, lane[3]);
+        }
+        else
+        {
+          hash = seed + PRIME5;
+        }
+
+        hash += value_type(char_count);
+
+        const uint8_t* p         = buffer;
+        const uint8_t* const end = buffer + buffer_size;
+
+        while ((end - p) >= 8)
+        {
+          hash ^= round(0, private_xxhash::read64(p));
+          hash  = (etl::rotate_left(hash, 27) * PRIME1) + PRIME4;
+          p    += 8;
+        }
+
+        if ((end - p) >= 4)
+        {
+          hash ^= value_type(private_xxhash::read32(p)) * PRIME1;
+          hash  = (etl::rotate_left(hash, 23) * PRIME2) + PRIME3;
+          p    += 4;
+        }
+
+        while (p != end)
+        {
+          hash ^= value_type(*p++) * PRIME5;
+          hash  = etl::rotate_left(hash, 11) * PRIME1;
+        }
+
+        hash ^= (hash >> 33);
+        hash *= PRIME2;
+        hash ^= (hash >> 29);
+        hash *= PRIME3;
+        hash ^= (hash >> 32);
+
+        is_finalised = true;
+      }
+    }
+
+    static ETL_CONSTANT uint8_t    STRIPE_SIZE = 32;
+    static ETL_CONSTANT value_type PRIME1      = 0x9E3779B185EBCA87ULL;
+    static ETL_CONSTANT value_type PRIME2      = 0xC2B2AE3D27D4EB4FULL;
+    static ETL_CONSTANT value_type PRIME3      = 0x165667B19E3779F9ULL;
+    static ETL_CONSTANT value_type PRIME4      = 0x85EBCA77C2B2AE63ULL;
+    static ETL_CONSTANT value_type PRIME5      = 0x27D4EB2F165667C5ULL;
+
+    bool       is_finalised;
+    uint8_t    buffer_size;
+    size_t     char_count;
+    value_type lane[4];
+    value_type hash;
+    value_type seed;
+    uint8_t    buffer[STRIPE_SIZE];
+  };
+#endif
+}
+
+#endif
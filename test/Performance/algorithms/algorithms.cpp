@@ -0,0 +1,758 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Micro-benchmarks for the algorithms, each compared with its std equivalent.
+//
+// Usage: etl_algorithms [--time-ms N] [--csv] [filter...]
+// The options are described in ../benchmark.h.
+//
+// By default the benchmark is built with ETL_NO_STL, so that the etl
+// algorithms use their own implementations rather than forwarding to std.
+// Build with the CMake option ALGORITHMS_USE_STL to measure the forwarding
+// versions instead.
+//
+// The ranges are passed as pointers, as the etl algorithms do not recognise
+// the std iterator tags when built with ETL_NO_STL.
+//
+// Ranges are copied from the same pseudo random source before every call that
+// modifies them, for both etl and std. Results are the fastest of several
+// repeated measurements, in nanoseconds per element (or per lookup).
+// The ratio is std time / etl time; above 1 means that etl is faster.
+//*****************************************************************************
+
+#include "etl/algorithm.h"
+#include "etl/searcher.h"
+#include "etl/span.h"
+#include "etl/mean.h"
+#include "etl/variance.h"
+#include "etl/correlation.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../benchmark.h"
+
+
+namespace
+{
+  using benchmark::consume;
+  using benchmark::function_t;
+
+  //***************************************************************************
+  /// A type that is not trivially copyable.
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t    key;
+    std::string name;
+
+    friend bool operator <(const Record& lhs, const Record& rhs)
+    {
+      return lhs.key < rhs.key;
+    }
+  };
+
+  //***************************************************************************
+  /// The test data.
+  //***************************************************************************
+  const size_t N_Large   = 10000U;  // Elements for the sorts, heaps and copies.
+  const size_t N_Records = 2000U;   // Records for the sorts and copies.
+  const size_t N_Small   = 64U;     // Elements in each insertion sort.
+  const size_t N_Table   = 65536U;  // Elements in the sorted lookup table.
+  const size_t N_Lookups = 1024U;   // Lookups per call.
+  const size_t N_Rotates = 16U;     // Rotations per call.
+  const size_t N_Partial = 100U;    // Elements selected by partial_sort.
+  const size_t N_Frame   = 1024U;   // Samples in each statistics frame.
+
+  std::vector<int32_t> random_ints;
+  std::vector<int32_t> sorted_ints;
+  std::vector<int32_t> few_unique_ints;
+  std::vector<int32_t> table;
+  std::vector<int32_t> keys;
+  std::vector<size_t>  middles;
+  std::vector<Record>  random_records;
+  std::vector<int16_t> samples16;
+  std::vector<int16_t> samples16_2;
+  std::vector<float>   samples_f;
+  std::vector<float>   samples_f2;
+
+  // Working copies, so that the sources are unchanged.
+  std::vector<int32_t> work_ints;
+  std::vector<int32_t> work_ints2;
+  std::vector<Record>  work_records;
+  std::vector<Record>  work_records2;
+
+  // About 2KB of text ending with the search target.
+  std::string text;
+  const char  needle[]    = "zebra crossing";
+  const size_t needle_size = sizeof(needle) - 1U;
+
+  const char* const dictionary[] =
+  {
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+    "india", "juliet", "kilo", "lima", "mike", "november", "oscar", "papa",
+    "quebec", "romeo", "sierra", "tango", "uniform", "victor", "whiskey", "xray"
+  };
+
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state;
+  }
+
+  //***************************************************************************
+  void make_data()
+  {
+    for (size_t i = 0U; i < N_Large; ++i)
+    {
+      random_ints.push_back(int32_t(random() >> 1));
+      few_unique_ints.push_back(int32_t(random() % 16U));
+    }
+
+    sorted_ints = random_ints;
+    std::sort(sorted_ints.data(), (sorted_ints.data() + sorted_ints.size()));
+
+    for (size_t i = 0U; i < N_Records; ++i)
+    {
+      Record record;
+      record.key  = random();
+      record.name = dictionary[random() % ETL_ARRAY_SIZE(dictionary)];
+
+      random_records.push_back(record);
+    }
+
+    for (size_t i = 0U; i < N_Table; ++i)
+    {
+      table.push_back(int32_t(i * 3U));
+    }
+
+    for (size_t i = 0U; i < N_Lookups; ++i)
+    {
+      // Half are in the table.
+      keys.push_back(int32_t(random() % (N_Table * 3U)));
+    }
+
+    for (size_t i = 0U; i < N_Rotates; ++i)
+    {
+      middles.push_back(random() % N_Large);
+    }
+
+    while (text.size() < 2000U)
+    {
+      text += dictionary[random() % ETL_ARRAY_SIZE(dictionary)];
+      text += ' ';
+    }
+
+    text += needle;
+
+    for (size_t i = 0U; i < N_Frame; ++i)
+    {
+      samples16.push_back(int16_t(random() >> 16));
+      samples16_2.push_back(int16_t(random() >> 16));
+      samples_f.push_back(float(int16_t(random() >> 16)) / 32768.0f);
+      samples_f2.push_back(float(int16_t(random() >> 16)) / 32768.0f);
+    }
+
+    work_ints.resize(N_Large);
+    work_ints2.resize(N_Large);
+    work_records.resize(N_Records);
+    work_records2.resize(N_Records);
+  }
+
+  //***************************************************************************
+  void load(const std::vector<int32_t>& source)
+  {
+    std::memcpy(work_ints.data(), source.data(), source.size() * sizeof(int32_t));
+  }
+
+  void load_records()
+  {
+    for (size_t i = 0U; i < N_Records; ++i)
+    {
+      work_records[i] = random_records[i];
+    }
+  }
+
+  //***************************************************************************
+  /// sort
+  //***************************************************************************
+  template <const std::vector<int32_t>& Source>
+  void etl_sort_ints()
+  {
+    load(Source);
+    etl::sort(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  template <const std::vector<int32_t>& Source>
+  void std_sort_ints()
+  {
+    load(Source);
+    std::sort(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_sort_records()
+  {
+    load_records();
+    etl::sort(work_records.data(), (work_records.data() + work_records.size()));
+    consume(work_records[N_Records / 2U].key);
+  }
+
+  void std_sort_records()
+  {
+    load_records();
+    std::sort(work_records.data(), (work_records.data() + work_records.size()));
+    consume(work_records[N_Records / 2U].key);
+  }
+
+  void etl_stable_sort_ints()
+  {
+    load(random_ints);
+    etl::stable_sort(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_stable_sort_ints_buffer()
+  {
+    load(random_ints);
+    etl::stable_sort(work_ints.data(), (work_ints.data() + work_ints.size()), etl::span<int32_t, etl::dynamic_extent>(work_ints2.data(), work_ints2.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void std_stable_sort_ints()
+  {
+    load(random_ints);
+    std::stable_sort(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_stable_sort_records()
+  {
+    load_records();
+    etl::stable_sort(work_records.data(), (work_records.data() + work_records.size()));
+    consume(work_records[N_Records / 2U].key);
+  }
+
+  void std_stable_sort_records()
+  {
+    load_records();
+    std::stable_sort(work_records.data(), (work_records.data() + work_records.size()));
+    consume(work_records[N_Records / 2U].key);
+  }
+
+  void etl_shell_sort_ints()
+  {
+    load(random_ints);
+    etl::shell_sort(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_insertion_sort_small()
+  {
+    load(random_ints);
+
+    for (size_t i = 0U; (i + N_Small) <= N_Large; i += N_Small)
+    {
+      etl::insertion_sort(work_ints.data() + i, work_ints.data() + i + N_Small);
+    }
+
+    consume(size_t(work_ints[N_Small / 2U]));
+  }
+
+  void std_sort_small()
+  {
+    load(random_ints);
+
+    for (size_t i = 0U; (i + N_Small) <= N_Large; i += N_Small)
+    {
+      std::sort(work_ints.data() + i, work_ints.data() + i + N_Small);
+    }
+
+    consume(size_t(work_ints[N_Small / 2U]));
+  }
+
+  //***************************************************************************
+  /// Selection
+  //***************************************************************************
+  void etl_nth_element()
+  {
+    load(random_ints);
+    etl::nth_element(work_ints.data(), work_ints.data() + (N_Large / 2U), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void std_nth_element()
+  {
+    load(random_ints);
+    std::nth_element(work_ints.data(), work_ints.data() + (N_Large / 2U), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_partial_sort()
+  {
+    load(random_ints);
+    etl::partial_sort(work_ints.data(), work_ints.data() + N_Partial, (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Partial - 1U]));
+  }
+
+  void std_partial_sort()
+  {
+    load(random_ints);
+    std::partial_sort(work_ints.data(), work_ints.data() + N_Partial, (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Partial - 1U]));
+  }
+
+  //***************************************************************************
+  /// Heaps
+  //***************************************************************************
+  void etl_make_heap()
+  {
+    load(random_ints);
+    etl::make_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[0]));
+  }
+
+  void std_make_heap()
+  {
+    load(random_ints);
+    std::make_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[0]));
+  }
+
+  void etl_push_pop_heap()
+  {
+    load(random_ints);
+
+    for (size_t i = 1U; i <= N_Large; ++i)
+    {
+      etl::push_heap(work_ints.data(), work_ints.data() + i);
+    }
+
+    for (size_t i = N_Large; i > 1U; --i)
+    {
+      etl::pop_heap(work_ints.data(), work_ints.data() + i);
+    }
+
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void std_push_pop_heap()
+  {
+    load(random_ints);
+
+    for (size_t i = 1U; i <= N_Large; ++i)
+    {
+      std::push_heap(work_ints.data(), work_ints.data() + i);
+    }
+
+    for (size_t i = N_Large; i > 1U; --i)
+    {
+      std::pop_heap(work_ints.data(), work_ints.data() + i);
+    }
+
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_sort_heap()
+  {
+    load(random_ints);
+    std::make_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    etl::sort_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void std_sort_heap()
+  {
+    load(random_ints);
+    std::make_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    std::sort_heap(work_ints.data(), (work_ints.data() + work_ints.size()));
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  //***************************************************************************
+  /// Searching
+  //***************************************************************************
+  void etl_search()
+  {
+    consume(size_t(etl::search(text.data(), (text.data() + text.size()), needle, needle + needle_size) - text.data()));
+  }
+
+  void std_search()
+  {
+    consume(size_t(std::search(text.data(), (text.data() + text.size()), needle, needle + needle_size) - text.data()));
+  }
+
+  void etl_search_horspool()
+  {
+    static const etl::boyer_moore_horspool_searcher<const char*> searcher(needle, needle + needle_size);
+
+    consume(size_t(etl::search(text.data(), (text.data() + text.size()), searcher) - text.data()));
+  }
+
+#if defined(__cpp_lib_boyer_moore_searcher)
+  void std_search_horspool()
+  {
+    static const std::boyer_moore_horspool_searcher<const char*> searcher(needle, needle + needle_size);
+
+    consume(size_t(std::search(text.data(), (text.data() + text.size()), searcher) - text.data()));
+  }
+#endif
+
+  void etl_lower_bound()
+  {
+    for (size_t i = 0U; i < N_Lookups; ++i)
+    {
+      consume(size_t(etl::lower_bound(table.data(), (table.data() + table.size()), keys[i]) - table.data()));
+    }
+  }
+
+  void std_lower_bound()
+  {
+    for (size_t i = 0U; i < N_Lookups; ++i)
+    {
+      consume(size_t(std::lower_bound(table.data(), (table.data() + table.size()), keys[i]) - table.data()));
+    }
+  }
+
+  void etl_binary_search()
+  {
+    for (size_t i = 0U; i < N_Lookups; ++i)
+    {
+      consume(size_t(etl::binary_search(table.data(), (table.data() + table.size()), keys[i])));
+    }
+  }
+
+  void std_binary_search()
+  {
+    for (size_t i = 0U; i < N_Lookups; ++i)
+    {
+      consume(size_t(std::binary_search(table.data(), (table.data() + table.size()), keys[i])));
+    }
+  }
+
+  //***************************************************************************
+  /// Contiguous scans. These use raw pointers, so that the vector kernels
+  /// can be selected.
+  //***************************************************************************
+  void etl_find()
+  {
+    consume(size_t(etl::find(random_ints.data(), random_ints.data() + N_Large, -1) - random_ints.data()));
+  }
+
+  void std_find()
+  {
+    consume(size_t(std::find(random_ints.data(), random_ints.data() + N_Large, -1) - random_ints.data()));
+  }
+
+  void etl_count()
+  {
+    consume(size_t(etl::count(few_unique_ints.data(), few_unique_ints.data() + N_Large, 7)));
+  }
+
+  void std_count()
+  {
+    consume(size_t(std::count(few_unique_ints.data(), few_unique_ints.data() + N_Large, 7)));
+  }
+
+  void etl_minmax_element()
+  {
+    consume(size_t(*etl::minmax_element(random_ints.data(), random_ints.data() + N_Large).second));
+  }
+
+  void std_minmax_element()
+  {
+    consume(size_t(*std::minmax_element(random_ints.data(), random_ints.data() + N_Large).second));
+  }
+
+  void etl_accumulate()
+  {
+    consume(size_t(etl::accumulate(random_ints.data(), random_ints.data() + N_Large, int32_t(0))));
+  }
+
+  void std_accumulate()
+  {
+    consume(size_t(std::accumulate(random_ints.data(), random_ints.data() + N_Large, int32_t(0))));
+  }
+
+  //***************************************************************************
+  /// Statistics over a frame of samples.
+  /// The std versions sum the same quantities with accumulate and
+  /// inner_product.
+  //***************************************************************************
+  void etl_mean_float()
+  {
+    etl::mean<float> mean(samples_f.data(), samples_f.data() + N_Frame);
+    consume(size_t(mean.get_mean() * 1000.0));
+  }
+
+  void std_mean_float()
+  {
+    const float sum = std::accumulate(samples_f.data(), samples_f.data() + N_Frame, 0.0f);
+    consume(size_t(double(sum) / N_Frame * 1000.0));
+  }
+
+  void etl_variance_int16()
+  {
+    etl::variance<etl::variance_type::Sample, int16_t, int64_t> variance(samples16.data(), samples16.data() + N_Frame);
+    consume(size_t(variance.get_variance()));
+  }
+
+  void std_variance_int16()
+  {
+    const int64_t sum     = std::accumulate(samples16.data(), samples16.data() + N_Frame, int64_t(0));
+    const int64_t squares = std::inner_product(samples16.data(), samples16.data() + N_Frame, samples16.data(), int64_t(0));
+    const double  n       = double(N_Frame);
+    consume(size_t(((n * double(squares)) - (double(sum) * double(sum))) / (n * (n - 1.0))));
+  }
+
+  void etl_variance_float()
+  {
+    etl::variance<etl::variance_type::Sample, float> variance(samples_f.data(), samples_f.data() + N_Frame);
+    consume(size_t(variance.get_variance() * 1000.0));
+  }
+
+  void std_variance_float()
+  {
+    const float  sum     = std::accumulate(samples_f.data(), samples_f.data() + N_Frame, 0.0f);
+    const float  squares = std::inner_product(samples_f.data(), samples_f.data() + N_Frame, samples_f.data(), 0.0f);
+    const double n       = double(N_Frame);
+    consume(size_t(((n * squares) - (double(sum) * sum)) / (n * (n - 1.0)) * 1000.0));
+  }
+
+  void etl_correlation_int16()
+  {
+    etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> correlation(samples16.data(), samples16.data() + N_Frame, samples16_2.data());
+    consume(size_t(correlation.get_correlation() * 1000.0));
+  }
+
+  void std_correlation_int16()
+  {
+    const int64_t sum1     = std::accumulate(samples16.data(), samples16.data() + N_Frame, int64_t(0));
+    const int64_t sum2     = std::accumulate(samples16_2.data(), samples16_2.data() + N_Frame, int64_t(0));
+    const int64_t squares1 = std::inner_product(samples16.data(), samples16.data() + N_Frame, samples16.data(), int64_t(0));
+    const int64_t squares2 = std::inner_product(samples16_2.data(), samples16_2.data() + N_Frame, samples16_2.data(), int64_t(0));
+    const int64_t inner    = std::inner_product(samples16.data(), samples16.data() + N_Frame, samples16_2.data(), int64_t(0));
+    consume(size_t(sum1 ^ sum2 ^ squares1 ^ squares2 ^ inner));
+  }
+
+  void etl_correlation_float()
+  {
+    etl::correlation<etl::correlation_type::Sample, float> correlation(samples_f.data(), samples_f.data() + N_Frame, samples_f2.data());
+    consume(size_t(correlation.get_correlation() * 1000.0));
+  }
+
+  void std_correlation_float()
+  {
+    const float sum1     = std::accumulate(samples_f.data(), samples_f.data() + N_Frame, 0.0f);
+    const float sum2     = std::accumulate(samples_f2.data(), samples_f2.data() + N_Frame, 0.0f);
+    const float squares1 = std::inner_product(samples_f.data(), samples_f.data() + N_Frame, samples_f.data(), 0.0f);
+    const float squares2 = std::inner_product(samples_f2.data(), samples_f2.data() + N_Frame, samples_f2.data(), 0.0f);
+    const float inner    = std::inner_product(samples_f.data(), samples_f.data() + N_Frame, samples_f2.data(), 0.0f);
+    consume(size_t((sum1 + sum2 + squares1 + squares2 + inner) * 1000.0f));
+  }
+
+  //***************************************************************************
+  /// Rotate, copy and move
+  //***************************************************************************
+  void etl_rotate()
+  {
+    for (size_t i = 0U; i < N_Rotates; ++i)
+    {
+      etl::rotate(work_ints.data(), work_ints.data() + middles[i], (work_ints.data() + work_ints.size()));
+    }
+
+    consume(size_t(work_ints[0]));
+  }
+
+  void std_rotate()
+  {
+    for (size_t i = 0U; i < N_Rotates; ++i)
+    {
+      std::rotate(work_ints.data(), work_ints.data() + middles[i], (work_ints.data() + work_ints.size()));
+    }
+
+    consume(size_t(work_ints[0]));
+  }
+
+  void etl_copy_ints()
+  {
+    etl::copy(random_ints.data(), (random_ints.data() + random_ints.size()), work_ints.data());
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void std_copy_ints()
+  {
+    std::copy(random_ints.data(), (random_ints.data() + random_ints.size()), work_ints.data());
+    consume(size_t(work_ints[N_Large / 2U]));
+  }
+
+  void etl_copy_records()
+  {
+    etl::copy(random_records.data(), (random_records.data() + random_records.size()), work_records.data());
+    consume(work_records[N_Records / 2U].name.size());
+  }
+
+  void std_copy_records()
+  {
+    std::copy(random_records.data(), (random_records.data() + random_records.size()), work_records.data());
+    consume(work_records[N_Records / 2U].name.size());
+  }
+
+  // Moves there and back, so that the values are not left moved from.
+  void etl_move_records()
+  {
+    etl::move(work_records.data(), (work_records.data() + work_records.size()), work_records2.data());
+    etl::move(work_records2.data(), (work_records2.data() + work_records2.size()), work_records.data());
+    consume(work_records[N_Records / 2U].name.size());
+  }
+
+  void std_move_records()
+  {
+    std::move(work_records.data(), (work_records.data() + work_records.size()), work_records2.data());
+    std::move(work_records2.data(), (work_records2.data() + work_records2.size()), work_records.data());
+    consume(work_records[N_Records / 2U].name.size());
+  }
+
+  struct benchmark_t
+  {
+    const char* name;
+    size_t      operations;
+    function_t  etl_function;
+    const char* std_name;
+    function_t  std_function;
+  };
+
+  //***************************************************************************
+  /// Every benchmark that is measured.
+  //***************************************************************************
+  const benchmark_t benchmarks[] =
+  {
+    { "sort int32 random",            N_Large,       &etl_sort_ints<random_ints>,     "std::sort",          &std_sort_ints<random_ints> },
+    { "sort int32 sorted",            N_Large,       &etl_sort_ints<sorted_ints>,     "std::sort",          &std_sort_ints<sorted_ints> },
+    { "sort int32 few unique",        N_Large,       &etl_sort_ints<few_unique_ints>, "std::sort",          &std_sort_ints<few_unique_ints> },
+    { "sort record",                  N_Records,     &etl_sort_records,               "std::sort",          &std_sort_records },
+    { "stable_sort int32",            N_Large,       &etl_stable_sort_ints,           "std::stable_sort",   &std_stable_sort_ints },
+    { "stable_sort int32 buffer",     N_Large,       &etl_stable_sort_ints_buffer,    "std::stable_sort",   &std_stable_sort_ints },
+    { "stable_sort record",           N_Records,     &etl_stable_sort_records,        "std::stable_sort",   &std_stable_sort_records },
+    { "shell_sort int32",             N_Large,       &etl_shell_sort_ints,            "std::sort",          &std_sort_ints<random_ints> },
+    { "insertion_sort int32 x64",     N_Large,       &etl_insertion_sort_small,       "std::sort",          &std_sort_small },
+    { "nth_element int32",            N_Large,       &etl_nth_element,                "std::nth_element",   &std_nth_element },
+    { "partial_sort int32 100",       N_Large,       &etl_partial_sort,               "std::partial_sort",  &std_partial_sort },
+    { "make_heap int32",              N_Large,       &etl_make_heap,                  "std::make_heap",     &std_make_heap },
+    { "push_heap/pop_heap int32",     N_Large,       &etl_push_pop_heap,              "std::push/pop_heap", &std_push_pop_heap },
+    { "sort_heap int32",              N_Large,       &etl_sort_heap,                  "std::sort_heap",     &std_sort_heap },
+    { "search 2KB",                   1U,            &etl_search,                     "std::search",        &std_search },
+#if defined(__cpp_lib_boyer_moore_searcher)
+    { "search horspool 2KB",          1U,            &etl_search_horspool,            "std::bmh_searcher",  &std_search_horspool },
+#else
+    { "search horspool 2KB",          1U,            &etl_search_horspool,            "std::search",        &std_search },
+#endif
+    { "lower_bound int32 64K",        N_Lookups,     &etl_lower_bound,                "std::lower_bound",   &std_lower_bound },
+    { "binary_search int32 64K",      N_Lookups,     &etl_binary_search,              "std::binary_search", &std_binary_search },
+    { "find int32 pointer",           N_Large,       &etl_find,                       "std::find",          &std_find },
+    { "count int32 pointer",          N_Large,       &etl_count,                      "std::count",         &std_count },
+    { "minmax_element int32 pointer", N_Large,       &etl_minmax_element,             "std::minmax_element", &std_minmax_element },
+    { "accumulate int32 pointer",     N_Large,       &etl_accumulate,                 "std::accumulate",    &std_accumulate },
+    { "mean float 1024",              N_Frame,       &etl_mean_float,                 "std::accumulate",    &std_mean_float },
+    { "variance int16 1024",          N_Frame,       &etl_variance_int16,             "std::inner_product", &std_variance_int16 },
+    { "variance float 1024",          N_Frame,       &etl_variance_float,             "std::inner_product", &std_variance_float },
+    { "correlation int16 1024",       N_Frame,       &etl_correlation_int16,          "std::inner_product", &std_correlation_int16 },
+    { "correlation float 1024",       N_Frame,       &etl_correlation_float,          "std::inner_product", &std_correlation_float },
+    { "rotate int32",                 N_Rotates * N_Large, &etl_rotate,               "std::rotate",        &std_rotate },
+    { "copy int32",                   N_Large,       &etl_copy_ints,                  "std::copy",          &std_copy_ints },
+    { "copy record",                  N_Records,     &etl_copy_records,               "std::copy",          &std_copy_records },
+    { "move record",                  2U * N_Records, &etl_move_records,              "std::move",          &std_move_records }
+  };
+
+
+  //***************************************************************************
+  /// Prints the options that change the speed of the algorithms.
+  //***************************************************************************
+  void print_configuration()
+  {
+    std::printf("etl algorithms:          %s\n", ETL_USING_STL ? "forwarding to std" : "own implementations (ETL_NO_STL)");
+    std::printf("Arithmetic kernels:      %s\n", ETL_ARITHMETIC_SIMD_SSE2 ? "SSE2" : (ETL_ARITHMETIC_SIMD_NEON ? "NEON" : "none"));
+    std::printf("Statistics kernels:      %s\n\n", ETL_STATISTICS_SIMD_SSE2 ? "SSE2" : (ETL_STATISTICS_SIMD_NEON ? "NEON" : "none"));
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  benchmark::options_t options;
+
+  if (!benchmark::parse_options(argc, argv, options))
+  {
+    return 0;
+  }
+
+  make_data();
+
+  if (options.csv)
+  {
+    std::printf("benchmark,etl ns/op,std,std ns/op,std/etl\n");
+  }
+  else
+  {
+    print_configuration();
+    std::printf("%-30s %10s   %-20s %10s %8s\n", "Benchmark", "etl ns/op", "std", "ns/op", "std/etl");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!options.matches(benchmark.name))
+    {
+      continue;
+    }
+
+    const double etl_ns = benchmark::measure(benchmark.etl_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+    const double std_ns = benchmark::measure(benchmark.std_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+
+    if (options.csv)
+    {
+      std::printf("%s,%.2f,%s,%.2f,%.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+    else
+    {
+      std::printf("%-30s %10.2f   %-20s %10.2f %8.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,734 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Allocate and release throughput and latency of the pools and memory block
+// allocators, compared with malloc and operator new.
+//
+// Usage: etl_allocators [options] [filter...]
+//   --ops N        Allocate/release pairs per workload (default 1M).
+//   --no-pin       Do not pin the threads to cores.
+//   --csv          Output comma separated values.
+//   filter         Only run allocators whose name contains one of the filters.
+//
+// Workloads:
+//   lifo           Allocate a batch of 64 blocks, then release them in
+//                  reverse order.
+//   fragment       Keep Live_Blocks blocks allocated. Each step releases a
+//                  random block and allocates a new one, of a random size
+//                  between 8 and Block_Size bytes. The free lists end up in
+//                  random order.
+//   producer       One thread allocates and passes the blocks through an SPSC
+//                  queue to a second thread, which releases them. Only run for
+//                  the allocators that are thread safe.
+//
+// The rate is allocate/release pairs per second. The latency is the mean time
+// of one pair in each batch of 64, in nanoseconds, including the cost of
+// reading the clock. For 'producer' it is measured by the allocating thread.
+//
+// To compare against another malloc, such as jemalloc, on a hosted build run
+// the benchmark with that malloc preloaded, e.g.
+//   LD_PRELOAD=libjemalloc.so etl_allocators malloc new
+//*****************************************************************************
+
+#include "etl/pool.h"
+#include "etl/generic_pool.h"
+#include "etl/variant_pool.h"
+#include "etl/atomic_pool.h"
+#include "etl/pool_magazine.h"
+#include "etl/arena.h"
+#include "etl/slab_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/atomic_fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/message.h"
+#include "etl/queue_spsc_atomic.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#elif defined(_WIN32)
+  #include <windows.h>
+#endif
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  const size_t Block_Size  = 64U;    // The largest block requested.
+  const size_t Alignment   = 8U;
+  const size_t Pool_Size   = 4096U;  // Blocks in each pool.
+  const size_t Live_Blocks = 2048U;  // Blocks kept allocated by 'fragment'.
+  const size_t Batch       = 64U;
+  const size_t Queue_Size  = 1024U;
+
+  size_t ops = 1000000U;
+  bool   pin = true;
+  bool   csv = false;
+
+  //***************************************************************************
+  /// The objects stored in the typed pools.
+  //***************************************************************************
+  struct Object
+  {
+    char data[Block_Size];
+  };
+
+  struct Small
+  {
+    char data[16];
+  };
+
+  struct Message : public etl::message<1>
+  {
+    char data[Block_Size - sizeof(etl::message<1>)];
+  };
+
+  //***************************************************************************
+  /// Pseudo random sizes and indexes.
+  //***************************************************************************
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state >> 8;
+  }
+
+  //***************************************************************************
+  /// Nanoseconds from an arbitrary epoch.
+  //***************************************************************************
+  uint64_t now_ns()
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count());
+  }
+
+  //***************************************************************************
+  /// Pins the calling thread to a core.
+  //***************************************************************************
+  void pin_to_core(size_t core)
+  {
+    if (!pin)
+    {
+      return;
+    }
+
+    const size_t cores = std::max(1U, std::thread::hardware_concurrency());
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(int(core % cores), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (core % cores));
+#else
+    (void)core;
+    (void)cores;
+#endif
+  }
+
+  //***************************************************************************
+  /// The allocators.
+  /// Each has allocate(size) and release(p). The fixed size pools ignore the
+  /// size, as it is never more than Block_Size.
+  //***************************************************************************
+  struct malloc_allocator
+  {
+    void* allocate(size_t size) { return std::malloc(size); }
+    void  release(void* p)      { std::free(p); }
+  };
+
+  struct new_allocator
+  {
+    void* allocate(size_t size) { return ::operator new(size); }
+    void  release(void* p)      { ::operator delete(p); }
+  };
+
+  struct pool_allocator
+  {
+    void* allocate(size_t)  { return pool.allocate(); }
+    void  release(void* p)  { pool.release(static_cast<Object*>(p)); }
+
+    etl::pool<Object, Pool_Size> pool;
+  };
+
+  struct locked_pool_allocator
+  {
+    void* allocate(size_t)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return pool.allocate();
+    }
+
+    void release(void* p)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pool.release(static_cast<Object*>(p));
+    }
+
+    std::mutex                   mutex;
+    etl::pool<Object, Pool_Size> pool;
+  };
+
+  struct generic_pool_allocator
+  {
+    void* allocate(size_t)  { return pool.allocate<Object>(); }
+    void  release(void* p)  { pool.release(p); }
+
+    etl::generic_pool<Block_Size, Alignment, Pool_Size> pool;
+  };
+
+  struct variant_pool_allocator
+  {
+    void* allocate(size_t)  { return pool.create<Object>(); }
+    void  release(void* p)  { pool.destroy(static_cast<Object*>(p)); }
+
+    etl::variant_pool<Pool_Size, Small, Object> pool;
+  };
+
+  struct arena_pool_allocator
+  {
+    arena_pool_allocator()
+      : arena(buffer, sizeof(buffer))
+      , pool(arena, Pool_Size)
+    {
+    }
+
+    void* allocate(size_t)  { return pool.allocate<Object>(); }
+    void  release(void* p)  { pool.release(p); }
+
+    char                   buffer[(Pool_Size + 1U) * sizeof(Object)];
+    etl::arena             arena;
+    etl::arena_pool<Object> pool;
+  };
+
+  struct atomic_pool_allocator
+  {
+    void* allocate(size_t)  { return pool.allocate(); }
+    void  release(void* p)  { pool.release(static_cast<Object*>(p)); }
+
+    etl::atomic_pool<Object, Pool_Size> pool;
+  };
+
+  // Each thread uses its own magazine in front of a shared atomic pool.
+  struct pool_magazine_allocator
+  {
+    typedef etl::pool_magazine<32U> magazine_t;
+
+    magazine_t& magazine()
+    {
+      static thread_local magazine_t local(pool);
+      return local;
+    }
+
+    void* allocate(size_t)  { return magazine().allocate<Object>(); }
+    void  release(void* p)  { magazine().release(p); }
+
+    etl::atomic_pool<Object, Pool_Size> pool;
+  };
+
+  struct block_allocator
+  {
+    void* allocate(size_t size) { return allocator.allocate(size, Alignment); }
+    void  release(void* p)      { allocator.release(p); }
+
+    etl::fixed_sized_memory_block_allocator<Block_Size, Alignment, Pool_Size> allocator;
+  };
+
+  struct atomic_block_allocator
+  {
+    void* allocate(size_t size) { return allocator.allocate(size, Alignment); }
+    void  release(void* p)      { allocator.release(p); }
+
+    etl::atomic_fixed_sized_memory_block_allocator<Block_Size, Alignment, Pool_Size> allocator;
+  };
+
+  // Blocks of 16, 32 and 64 bytes. Each request starts at the smallest, so a
+  // 64 byte request walks the whole chain.
+  struct block_allocator_chain
+  {
+    block_allocator_chain()
+    {
+      small.set_successor(medium);
+      medium.set_successor(large);
+    }
+
+    void* allocate(size_t size) { return small.allocate(size, Alignment); }
+    void  release(void* p)      { small.release(p); }
+
+    etl::fixed_sized_memory_block_allocator<16U,         Alignment, Pool_Size> small;
+    etl::fixed_sized_memory_block_allocator<32U,         Alignment, Pool_Size> medium;
+    etl::fixed_sized_memory_block_allocator<Block_Size,  Alignment, Pool_Size> large;
+  };
+
+  struct slab_allocator
+  {
+    void* allocate(size_t size) { return allocator.allocate(size, Alignment); }
+    void  release(void* p)      { allocator.release(p); }
+
+    etl::slab_allocator<16U, Block_Size, Alignment, Pool_Size> allocator;
+  };
+
+  struct message_pool_allocator
+  {
+    typedef etl::reference_counted_message<Message, int32_t> rcm_t;
+
+    message_pool_allocator()
+      : pool(block_allocator)
+    {
+    }
+
+    void* allocate(size_t)
+    {
+      return pool.allocate<Message>();
+    }
+
+    void release(void* p)
+    {
+      pool.release(*static_cast<etl::ireference_counted_message*>(static_cast<rcm_t*>(p)));
+    }
+
+    etl::fixed_sized_memory_block_allocator<sizeof(rcm_t), etl::alignment_of<rcm_t>::value, Pool_Size> block_allocator;
+    etl::reference_counted_message_pool<int32_t> pool;
+  };
+
+  // A message pool that locks a mutex, over an atomic block allocator.
+  struct locked_message_pool : public etl::reference_counted_message_pool<etl::atomic_int32_t>
+  {
+    explicit locked_message_pool(etl::imemory_block_allocator& allocator)
+      : etl::reference_counted_message_pool<etl::atomic_int32_t>(allocator)
+    {
+    }
+
+    virtual void lock() ETL_OVERRIDE   { mutex.lock(); }
+    virtual void unlock() ETL_OVERRIDE { mutex.unlock(); }
+
+    std::mutex mutex;
+  };
+
+  struct atomic_message_pool_allocator
+  {
+    typedef etl::reference_counted_message<Message, etl::atomic_int32_t> rcm_t;
+
+    atomic_message_pool_allocator()
+      : pool(block_allocator)
+    {
+    }
+
+    void* allocate(size_t)
+    {
+      return pool.allocate<Message>();
+    }
+
+    void release(void* p)
+    {
+      pool.release(*static_cast<etl::ireference_counted_message*>(static_cast<rcm_t*>(p)));
+    }
+
+    etl::atomic_fixed_sized_memory_block_allocator<sizeof(rcm_t), etl::alignment_of<rcm_t>::value, Pool_Size> block_allocator;
+    locked_message_pool pool;
+  };
+
+  //***************************************************************************
+  /// One instance of each allocator.
+  /// Allocated on the heap, as the pools are large.
+  //***************************************************************************
+  template <typename TAllocator>
+  TAllocator& instance()
+  {
+    static TAllocator* p_allocator = new TAllocator;
+    return *p_allocator;
+  }
+
+  //***************************************************************************
+  /// The result of one benchmark.
+  //***************************************************************************
+  struct result_t
+  {
+    double ops_per_second;
+    double p50;
+    double p99;
+    double p999;
+    double max;
+  };
+
+  //***************************************************************************
+  /// Calculates the percentiles of the latency samples.
+  //***************************************************************************
+  result_t make_result(double total_ops, double seconds, std::vector<uint64_t>& samples)
+  {
+    result_t result = { total_ops / seconds, 0.0, 0.0, 0.0, 0.0 };
+
+    if (!samples.empty())
+    {
+      std::sort(samples.begin(), samples.end());
+
+      result.p50  = double(samples[(samples.size() * 50U)  / 100U]);
+      result.p99  = double(samples[(samples.size() * 99U)  / 100U]);
+      result.p999 = double(samples[(samples.size() * 999U) / 1000U]);
+      result.max  = double(samples.back());
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Writes to a block, so that the allocation cannot be discarded and the
+  /// cost of touching new memory is included.
+  /// The message pools return constructed messages, so write to the payload.
+  //***************************************************************************
+  template <typename TAllocator>
+  void touch(TAllocator&, void* p, size_t value)
+  {
+    *static_cast<volatile char*>(p) = char(value);
+  }
+
+  void touch(message_pool_allocator&, void* p, size_t value)
+  {
+    *static_cast<volatile char*>(static_cast<message_pool_allocator::rcm_t*>(p)->get_message().data) = char(value);
+  }
+
+  void touch(atomic_message_pool_allocator&, void* p, size_t value)
+  {
+    *static_cast<volatile char*>(static_cast<atomic_message_pool_allocator::rcm_t*>(p)->get_message().data) = char(value);
+  }
+
+  //***************************************************************************
+  /// Allocates a batch, then releases it in reverse order.
+  //***************************************************************************
+  template <typename TAllocator>
+  result_t lifo()
+  {
+    TAllocator& allocator = instance<TAllocator>();
+
+    std::vector<uint64_t> samples;
+    samples.reserve(ops / Batch);
+
+    void* blocks[Batch];
+
+    const uint64_t start = now_ns();
+
+    for (size_t done = 0U; done < ops; done += Batch)
+    {
+      const uint64_t batch_start = now_ns();
+
+      for (size_t i = 0U; i < Batch; ++i)
+      {
+        blocks[i] = allocator.allocate(Block_Size);
+        touch(allocator, blocks[i], i);
+      }
+
+      for (size_t i = Batch; i > 0U; --i)
+      {
+        allocator.release(blocks[i - 1U]);
+      }
+
+      samples.push_back((now_ns() - batch_start) / Batch);
+    }
+
+    const double seconds = double(now_ns() - start) * 1.0e-9;
+
+    return make_result(double(samples.size() * Batch), seconds, samples);
+  }
+
+  //***************************************************************************
+  /// Replaces random blocks in a set of live blocks.
+  //***************************************************************************
+  template <typename TAllocator>
+  result_t fragment()
+  {
+    TAllocator& allocator = instance<TAllocator>();
+
+    std::vector<void*> live(Live_Blocks);
+
+    for (size_t i = 0U; i < Live_Blocks; ++i)
+    {
+      live[i] = allocator.allocate(8U + (random() % (Block_Size - 7U)));
+      touch(allocator, live[i], i);
+    }
+
+    std::vector<uint64_t> samples;
+    samples.reserve(ops / Batch);
+
+    const uint64_t start = now_ns();
+
+    for (size_t done = 0U; done < ops; done += Batch)
+    {
+      const uint64_t batch_start = now_ns();
+
+      for (size_t i = 0U; i < Batch; ++i)
+      {
+        const size_t index = random() % Live_Blocks;
+
+        allocator.release(live[index]);
+        live[index] = allocator.allocate(8U + (random() % (Block_Size - 7U)));
+        touch(allocator, live[index], i);
+      }
+
+      samples.push_back((now_ns() - batch_start) / Batch);
+    }
+
+    const double seconds = double(now_ns() - start) * 1.0e-9;
+
+    for (size_t i = 0U; i < Live_Blocks; ++i)
+    {
+      allocator.release(live[i]);
+    }
+
+    return make_result(double(samples.size() * Batch), seconds, samples);
+  }
+
+  //***************************************************************************
+  /// One thread allocates, the other releases.
+  //***************************************************************************
+  template <typename TAllocator>
+  result_t producer()
+  {
+    TAllocator& allocator = instance<TAllocator>();
+
+    etl::queue_spsc_atomic<void*, Queue_Size> queue;
+
+    const size_t total = (ops / Batch) * Batch;
+
+    std::vector<uint64_t> samples;
+    samples.reserve(total / Batch);
+
+    std::atomic<bool> go(false);
+
+    std::thread consumer([&]()
+    {
+      pin_to_core(1U);
+
+      while (!go.load())
+      {
+        std::this_thread::yield();
+      }
+
+      size_t received = 0U;
+      void*  p;
+
+      while (received < total)
+      {
+        if (queue.pop(p))
+        {
+          allocator.release(p);
+          ++received;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    pin_to_core(0U);
+
+    const uint64_t start = now_ns();
+    go.store(true);
+
+    for (size_t done = 0U; done < total; done += Batch)
+    {
+      const uint64_t batch_start = now_ns();
+
+      for (size_t i = 0U; i < Batch; ++i)
+      {
+        void* p = allocator.allocate(Block_Size);
+
+        // The pools may be empty while the consumer catches up.
+        while (p == nullptr)
+        {
+          std::this_thread::yield();
+          p = allocator.allocate(Block_Size);
+        }
+
+        touch(allocator, p, i);
+
+        while (!queue.push(p))
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      samples.push_back((now_ns() - batch_start) / Batch);
+    }
+
+    consumer.join();
+
+    const double seconds = double(now_ns() - start) * 1.0e-9;
+
+    return make_result(double(total), seconds, samples);
+  }
+
+  //***************************************************************************
+  /// The benchmarks. A null function means the workload is not run.
+  //***************************************************************************
+  typedef result_t (*function_t)();
+
+  struct benchmark_t
+  {
+    const char* name;
+    function_t  lifo;
+    function_t  fragment;
+    function_t  producer;
+  };
+
+  const benchmark_t benchmarks[] =
+  {
+    { "malloc",                  &lifo<malloc_allocator>,              &fragment<malloc_allocator>,              &producer<malloc_allocator> },
+    { "new",                     &lifo<new_allocator>,                 &fragment<new_allocator>,                 &producer<new_allocator> },
+    { "pool",                    &lifo<pool_allocator>,                &fragment<pool_allocator>,                nullptr },
+    { "pool+mutex",              &lifo<locked_pool_allocator>,         &fragment<locked_pool_allocator>,         &producer<locked_pool_allocator> },
+    { "generic_pool",            &lifo<generic_pool_allocator>,        &fragment<generic_pool_allocator>,        nullptr },
+    { "variant_pool",            &lifo<variant_pool_allocator>,        &fragment<variant_pool_allocator>,        nullptr },
+    { "arena_pool",              &lifo<arena_pool_allocator>,          &fragment<arena_pool_allocator>,          nullptr },
+    { "atomic_pool",             &lifo<atomic_pool_allocator>,         &fragment<atomic_pool_allocator>,         &producer<atomic_pool_allocator> },
+    { "pool_magazine",           &lifo<pool_magazine_allocator>,       &fragment<pool_magazine_allocator>,       &producer<pool_magazine_allocator> },
+    { "block_allocator",         &lifo<block_allocator>,               &fragment<block_allocator>,               nullptr },
+    { "atomic_block_allocator",  &lifo<atomic_block_allocator>,        &fragment<atomic_block_allocator>,        &producer<atomic_block_allocator> },
+    { "block_allocator_chain",   &lifo<block_allocator_chain>,         &fragment<block_allocator_chain>,         nullptr },
+    { "slab_allocator",          &lifo<slab_allocator>,                &fragment<slab_allocator>,                nullptr },
+    { "message_pool",            &lifo<message_pool_allocator>,        &fragment<message_pool_allocator>,        nullptr },
+    { "message_pool+mutex",      &lifo<atomic_message_pool_allocator>, &fragment<atomic_message_pool_allocator>, &producer<atomic_message_pool_allocator> }
+  };
+
+  //***************************************************************************
+  bool matches(const char* name, const std::vector<std::string>& filters)
+  {
+    if (filters.empty())
+    {
+      return true;
+    }
+
+    for (size_t i = 0U; i < filters.size(); ++i)
+    {
+      if (std::strstr(name, filters[i].c_str()) != nullptr)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  void print(const char* name, const char* workload, function_t function)
+  {
+    if (function == nullptr)
+    {
+      return;
+    }
+
+    const result_t result = function();
+
+    if (csv)
+    {
+      std::printf("%s,%s,%.0f,%.0f,%.0f,%.0f,%.0f\n", name, workload,
+                  result.ops_per_second, result.p50, result.p99, result.p999, result.max);
+    }
+    else
+    {
+      std::printf("%-24s %-9s %14.0f %10.0f %10.0f %10.0f %10.0f\n", name, workload,
+                  result.ops_per_second, result.p50, result.p99, result.p999, result.max);
+    }
+
+    std::fflush(stdout);
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+
+    if ((arg == "--ops") && (i + 1 < argc))
+    {
+      ops = size_t(std::atof(argv[++i]));
+    }
+    else if (arg == "--no-pin")
+    {
+      pin = false;
+    }
+    else if (arg == "--csv")
+    {
+      csv = true;
+    }
+    else if ((arg == "--help") || (arg == "-h"))
+    {
+      std::printf("Usage: %s [--ops N] [--no-pin] [--csv] [filter...]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filters.push_back(arg);
+    }
+  }
+
+  ops = std::max(Batch, ops);
+
+  if (csv)
+  {
+    std::printf("allocator,workload,ops/s,p50 ns,p99 ns,p99.9 ns,max ns\n");
+  }
+  else
+  {
+    std::printf("%-24s %-9s %14s %10s %10s %10s %10s\n", "Allocator", "Workload", "ops/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!matches(benchmark.name, filters))
+    {
+      continue;
+    }
+
+    print(benchmark.name, "lifo",     benchmark.lifo);
+    print(benchmark.name, "fragment", benchmark.fragment);
+    print(benchmark.name, "producer", benchmark.producer);
+  }
+
+  return 0;
+}
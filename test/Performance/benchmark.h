@@ -0,0 +1,199 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// The measurement harness shared by the micro-benchmarks.
+//
+// Usage: <benchmark> [options] [filter...]
+//   --time-ms N    Minimum measurement time per result (default 50).
+//   --csv          Output comma separated values.
+//   filter         Only run benchmarks whose name contains one of the filters.
+//
+// Each result is the fastest of several repeated measurements, so that
+// interruptions by the operating system are discarded.
+//*****************************************************************************
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+  //***************************************************************************
+  /// Prevents the compiler discarding the results.
+  //***************************************************************************
+  inline volatile size_t& sink()
+  {
+    static volatile size_t value = 0U;
+
+    return value;
+  }
+
+  template <typename T>
+  void consume(T value)
+  {
+    sink() = sink() ^ size_t(value);
+  }
+
+  //***************************************************************************
+  /// A function that is measured.
+  //***************************************************************************
+  typedef void (*function_t)();
+
+  typedef std::chrono::steady_clock clock_type;
+
+  //***************************************************************************
+  /// Returns the fastest time for one call, in seconds.
+  /// The number of calls per measurement is doubled until the measurement
+  /// takes long enough to trust the clock.
+  //***************************************************************************
+  inline double measure(function_t function, double minimum_seconds)
+  {
+    const int Repeats = 5;
+
+    // Warm up the caches and the branch predictors.
+    function();
+
+    size_t calls = 1U;
+
+    for (;;)
+    {
+      clock_type::time_point start = clock_type::now();
+
+      for (size_t i = 0U; i < calls; ++i)
+      {
+        function();
+      }
+
+      double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+
+      if ((seconds * Repeats) >= minimum_seconds)
+      {
+        break;
+      }
+
+      calls *= 2U;
+    }
+
+    double best = 1.0e30;
+
+    for (int r = 0; r < Repeats; ++r)
+    {
+      clock_type::time_point start = clock_type::now();
+
+      for (size_t i = 0U; i < calls; ++i)
+      {
+        function();
+      }
+
+      best = std::min(best, std::chrono::duration<double>(clock_type::now() - start).count() / double(calls));
+    }
+
+    return best;
+  }
+
+  //***************************************************************************
+  /// The command line options.
+  //***************************************************************************
+  struct options_t
+  {
+    options_t()
+      : min_time(0.05),
+        csv(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Checks if the name contains one of the filters, or there are none.
+    //*************************************************************************
+    bool matches(const char* name) const
+    {
+      if (filters.empty())
+      {
+        return true;
+      }
+
+      for (size_t i = 0U; i < filters.size(); ++i)
+      {
+        if (std::strstr(name, filters[i].c_str()) != nullptr)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    double                   min_time; ///< The minimum measurement time, in seconds.
+    bool                     csv;      ///< Output comma separated values.
+    std::vector<std::string> filters;  ///< Only run benchmarks whose name contains one of these.
+  };
+
+  //***************************************************************************
+  /// Parses the command line.
+  /// Returns false if the usage was printed and the benchmark should exit.
+  //***************************************************************************
+  inline bool parse_options(int argc, char* argv[], options_t& options)
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      std::string arg = argv[i];
+
+      if ((arg == "--time-ms") && (i + 1 < argc))
+      {
+        options.min_time = std::atof(argv[++i]) / 1000.0;
+      }
+      else if (arg == "--csv")
+      {
+        options.csv = true;
+      }
+      else if ((arg == "--help") || (arg == "-h"))
+      {
+        std::printf("Usage: %s [--time-ms N] [--csv] [filter...]\n", argv[0]);
+        return false;
+      }
+      else
+      {
+        options.filters.push_back(arg);
+      }
+    }
+
+    return true;
+  }
+}
+
+#endif
@@ -0,0 +1,572 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Contention benchmark for the concurrent queues, pools and atomics.
+//
+// Usage: etl_concurrency [options] [filter...]
+//   --threads N    Largest number of threads (default: the number of cores).
+//   --ops N        Operations per thread (default 1M).
+//   --no-pin       Do not pin the threads to cores.
+//   --csv          Output comma separated values.
+//   filter         Only run benchmarks whose name contains one of the filters.
+//
+// For the queues, the latency is the time from push to pop, sampled every
+// 64th item. For the pools and atomics it is the mean time of one operation
+// in each batch of 64. Latencies are in nanoseconds and include the cost of
+// reading the clock.
+//
+// The atomic backend is chosen by the build. The CMake project builds one
+// executable for each backend that the compiler supports.
+//*****************************************************************************
+
+#include "etl/atomic.h"
+#include "etl/mutex.h"
+#include "etl/function.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_spsc_locked.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/pool.h"
+#include "etl/atomic_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#elif defined(_WIN32)
+  #include <windows.h>
+#endif
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  const size_t Queue_Size   = 1024U;
+  const size_t Pool_Size    = 1024U;
+  const size_t Sample_Every = 64U;
+
+  size_t max_threads = 1U;
+  size_t ops         = 1000000U;
+  bool   pin         = true;
+  bool   csv         = false;
+
+  //***************************************************************************
+  /// The name of the atomic backend in use.
+  //***************************************************************************
+  const char* atomic_backend()
+  {
+#if defined(ETL_ATOMIC_STD_INCLUDED)
+    return "std";
+#elif defined(ETL_ATOMIC_ARM_INCLUDED)
+    return "arm";
+#elif defined(ETL_ATOMIC_CLANG_INCLUDED)
+    return "clang_sync";
+#elif defined(ETL_ATOMIC_GCC_SYNC_INCLUDED)
+    return "gcc_sync";
+#else
+    return "unknown";
+#endif
+  }
+
+  //***************************************************************************
+  /// Nanoseconds from an arbitrary epoch.
+  //***************************************************************************
+  uint64_t now_ns()
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count());
+  }
+
+  //***************************************************************************
+  /// Pins the calling thread to a core.
+  //***************************************************************************
+  void pin_to_core(size_t core)
+  {
+    if (!pin)
+    {
+      return;
+    }
+
+    const size_t cores = std::max(1U, std::thread::hardware_concurrency());
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(int(core % cores), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << (core % cores));
+#else
+    (void)core;
+    (void)cores;
+#endif
+  }
+
+  //***************************************************************************
+  /// The result of one benchmark.
+  //***************************************************************************
+  struct result_t
+  {
+    double ops_per_second;
+    double p50;
+    double p99;
+    double p999;
+    double max;
+  };
+
+  //***************************************************************************
+  /// Runs a function on each of several pinned threads, started together.
+  /// Returns the time from the start until the last thread finished.
+  //***************************************************************************
+  template <typename TFunction>
+  double run_threads(size_t n_threads, TFunction function)
+  {
+    std::atomic<size_t> ready(0U);
+    std::atomic<bool>   go(false);
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0U; t < n_threads; ++t)
+    {
+      threads.push_back(std::thread([&, t]()
+      {
+        pin_to_core(t);
+        ready.fetch_add(1U);
+
+        while (!go.load())
+        {
+        }
+
+        function(t);
+      }));
+    }
+
+    while (ready.load() != n_threads)
+    {
+      std::this_thread::yield();
+    }
+
+    clock_type::time_point start = clock_type::now();
+    go.store(true);
+
+    for (size_t t = 0U; t < n_threads; ++t)
+    {
+      threads[t].join();
+    }
+
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+  }
+
+  //***************************************************************************
+  /// Calculates the percentiles of the merged latency samples.
+  //***************************************************************************
+  result_t make_result(double total_ops, double seconds, std::vector<std::vector<uint64_t> >& samples)
+  {
+    std::vector<uint64_t> all;
+
+    for (size_t i = 0U; i < samples.size(); ++i)
+    {
+      all.insert(all.end(), samples[i].begin(), samples[i].end());
+    }
+
+    result_t result = { total_ops / seconds, 0.0, 0.0, 0.0, 0.0 };
+
+    if (!all.empty())
+    {
+      std::sort(all.begin(), all.end());
+
+      result.p50  = double(all[(all.size() * 50U)  / 100U]);
+      result.p99  = double(all[(all.size() * 99U)  / 100U]);
+      result.p999 = double(all[(all.size() * 999U) / 1000U]);
+      result.max  = double(all.back());
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Producers push time stamps and consumers pop them.
+  /// Threads 0 to producers - 1 are producers, the rest are consumers.
+  //***************************************************************************
+  template <typename TQueue>
+  result_t queue_benchmark(TQueue& queue, size_t producers, size_t consumers)
+  {
+    const size_t total = producers * ops;
+
+    std::atomic<size_t> consumed(0U);
+    std::vector<std::vector<uint64_t> > samples(consumers);
+
+    for (size_t c = 0U; c < consumers; ++c)
+    {
+      samples[c].reserve(total / (Sample_Every * consumers) + 16U);
+    }
+
+    double seconds = run_threads(producers + consumers, [&](size_t t)
+    {
+      if (t < producers)
+      {
+        for (size_t i = 0U; i < ops; ++i)
+        {
+          while (!queue.push(now_ns()))
+          {
+          }
+        }
+      }
+      else
+      {
+        std::vector<uint64_t>& thread_samples = samples[t - producers];
+        size_t count = 0U;
+        uint64_t stamp;
+
+        while (consumed.load(std::memory_order_relaxed) < total)
+        {
+          if (queue.pop(stamp))
+          {
+            consumed.fetch_add(1U, std::memory_order_relaxed);
+
+            if ((++count % Sample_Every) == 0U)
+            {
+              thread_samples.push_back(now_ns() - stamp);
+            }
+          }
+        }
+      }
+    });
+
+    return make_result(double(total), seconds, samples);
+  }
+
+  //***************************************************************************
+  /// Each thread times batches of an operation.
+  //***************************************************************************
+  template <typename TOperation>
+  result_t batch_benchmark(size_t n_threads, TOperation operation)
+  {
+    std::vector<std::vector<uint64_t> > samples(n_threads);
+
+    for (size_t t = 0U; t < n_threads; ++t)
+    {
+      samples[t].reserve(ops / Sample_Every + 1U);
+    }
+
+    double seconds = run_threads(n_threads, [&](size_t t)
+    {
+      for (size_t i = 0U; i < ops; i += Sample_Every)
+      {
+        uint64_t start = now_ns();
+
+        for (size_t j = 0U; j < Sample_Every; ++j)
+        {
+          operation(i + j);
+        }
+
+        samples[t].push_back((now_ns() - start) / Sample_Every);
+      }
+    });
+
+    return make_result(double(n_threads * ((ops + Sample_Every - 1U) / Sample_Every) * Sample_Every), seconds, samples);
+  }
+
+  //***************************************************************************
+  // The queues.
+  //***************************************************************************
+  typedef etl::queue_spsc_atomic<uint64_t, Queue_Size> spsc_atomic_t;
+  typedef etl::queue_spsc_locked<uint64_t, Queue_Size> spsc_locked_t;
+  typedef etl::queue_mpmc_mutex<uint64_t, Queue_Size>  mpmc_mutex_t;
+  typedef etl::queue_mpmc_atomic<uint64_t, Queue_Size> mpmc_atomic_t;
+
+  std::mutex spsc_mutex;
+
+  void spsc_lock()
+  {
+    spsc_mutex.lock();
+  }
+
+  void spsc_unlock()
+  {
+    spsc_mutex.unlock();
+  }
+
+  //***************************************************************************
+  /// Adapts queue_spsc_locked, whose locked push and pop take no lock
+  /// argument, to the same interface as the other queues.
+  //***************************************************************************
+  struct spsc_locked_adaptor
+  {
+    spsc_locked_adaptor()
+      : queue(lock, unlock)
+    {
+    }
+
+    bool push(uint64_t value)
+    {
+      return queue.push(value);
+    }
+
+    bool pop(uint64_t& value)
+    {
+      return queue.pop(value);
+    }
+
+    etl::function_fv<spsc_lock>   lock;
+    etl::function_fv<spsc_unlock> unlock;
+    spsc_locked_t                 queue;
+  };
+
+  //***************************************************************************
+  // The pools.
+  //***************************************************************************
+  template <typename TLock>
+  struct locked_pool
+  {
+    uint64_t* allocate()
+    {
+      access.lock();
+      uint64_t* p = pool.allocate();
+      access.unlock();
+
+      return p;
+    }
+
+    void release(uint64_t* p)
+    {
+      access.lock();
+      pool.release(p);
+      access.unlock();
+    }
+
+    TLock                             access;
+    etl::pool<uint64_t, Pool_Size>    pool;
+  };
+
+  template <typename TPool>
+  result_t pool_benchmark(size_t n_threads)
+  {
+    TPool pool;
+
+    return batch_benchmark(n_threads, [&pool](size_t i)
+    {
+      uint64_t* p = pool.allocate();
+      *p = i;
+      pool.release(p);
+    });
+  }
+
+  //***************************************************************************
+  // The atomics.
+  //***************************************************************************
+  result_t atomic_fetch_add_benchmark(size_t n_threads)
+  {
+    etl::atomic<uint32_t> value(0U);
+
+    return batch_benchmark(n_threads, [&value](size_t)
+    {
+      value.fetch_add(1U);
+    });
+  }
+
+  result_t atomic_compare_exchange_benchmark(size_t n_threads)
+  {
+    etl::atomic<uint32_t> value(0U);
+
+    return batch_benchmark(n_threads, [&value](size_t)
+    {
+      uint32_t expected = value.load(etl::memory_order_relaxed);
+
+      while (!value.compare_exchange_weak(expected, expected + 1U))
+      {
+      }
+    });
+  }
+
+  //***************************************************************************
+  bool matches(const char* name, const std::vector<std::string>& filters)
+  {
+    if (filters.empty())
+    {
+      return true;
+    }
+
+    for (size_t i = 0U; i < filters.size(); ++i)
+    {
+      if (std::strstr(name, filters[i].c_str()) != nullptr)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  void print(const char* name, size_t n_threads, const result_t& result)
+  {
+    if (csv)
+    {
+      std::printf("%s,%s,%zu,%.0f,%.0f,%.0f,%.0f,%.0f\n", name, atomic_backend(), n_threads,
+                  result.ops_per_second, result.p50, result.p99, result.p999, result.max);
+    }
+    else
+    {
+      std::printf("%-32s %7zu %14.0f %10.0f %10.0f %10.0f %10.0f\n", name, n_threads,
+                  result.ops_per_second, result.p50, result.p99, result.p999, result.max);
+    }
+
+    std::fflush(stdout);
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  max_threads = std::max(1U, std::thread::hardware_concurrency());
+
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+
+    if ((arg == "--threads") && (i + 1 < argc))
+    {
+      max_threads = size_t(std::strtoull(argv[++i], nullptr, 0));
+    }
+    else if ((arg == "--ops") && (i + 1 < argc))
+    {
+      ops = size_t(std::strtoull(argv[++i], nullptr, 0));
+    }
+    else if (arg == "--no-pin")
+    {
+      pin = false;
+    }
+    else if (arg == "--csv")
+    {
+      csv = true;
+    }
+    else if ((arg == "--help") || (arg == "-h"))
+    {
+      std::printf("Usage: %s [--threads N] [--ops N] [--no-pin] [--csv] [filter...]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filters.push_back(arg);
+    }
+  }
+
+  max_threads = std::max(size_t(1U), max_threads);
+  ops         = std::max(Sample_Every, ops);
+
+  if (csv)
+  {
+    std::printf("benchmark,backend,threads,ops/s,p50 ns,p99 ns,p99.9 ns,max ns\n");
+  }
+  else
+  {
+    std::printf("Atomic backend: %s\n\n", atomic_backend());
+    std::printf("%-32s %7s %14s %10s %10s %10s %10s\n", "Benchmark", "Threads", "ops/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+  }
+
+  // The SPSC queues always have one producer and one consumer.
+  if (matches("queue_spsc_atomic", filters))
+  {
+    spsc_atomic_t* queue = new spsc_atomic_t;
+    print("queue_spsc_atomic", 2U, queue_benchmark(*queue, 1U, 1U));
+    delete queue;
+  }
+
+  if (matches("queue_spsc_locked", filters))
+  {
+    spsc_locked_adaptor* queue = new spsc_locked_adaptor;
+    print("queue_spsc_locked", 2U, queue_benchmark(*queue, 1U, 1U));
+    delete queue;
+  }
+
+  // The MPMC queues have an equal number of producers and consumers.
+  for (size_t n = 1U; (n * 2U) <= std::max(size_t(2U), max_threads); ++n)
+  {
+    if (matches("queue_mpmc_mutex", filters))
+    {
+      mpmc_mutex_t* queue = new mpmc_mutex_t;
+      print("queue_mpmc_mutex", n * 2U, queue_benchmark(*queue, n, n));
+      delete queue;
+    }
+
+    if (matches("queue_mpmc_atomic", filters))
+    {
+      mpmc_atomic_t* queue = new mpmc_atomic_t;
+      print("queue_mpmc_atomic", n * 2U, queue_benchmark(*queue, n, n));
+      delete queue;
+    }
+  }
+
+  for (size_t n = 1U; n <= max_threads; ++n)
+  {
+    if (matches("pool+std::mutex", filters))
+    {
+      print("pool+std::mutex", n, pool_benchmark<locked_pool<std::mutex> >(n));
+    }
+
+    if (matches("pool+spin_mutex", filters))
+    {
+      print("pool+spin_mutex", n, pool_benchmark<locked_pool<etl::spin_mutex> >(n));
+    }
+
+    if (matches("pool+ticket_mutex", filters))
+    {
+      print("pool+ticket_mutex", n, pool_benchmark<locked_pool<etl::ticket_mutex> >(n));
+    }
+
+    if (matches("atomic_pool", filters))
+    {
+      print("atomic_pool", n, pool_benchmark<etl::atomic_pool<uint64_t, Pool_Size> >(n));
+    }
+
+    if (matches("atomic::fetch_add", filters))
+    {
+      print("atomic::fetch_add", n, atomic_fetch_add_benchmark(n));
+    }
+
+    if (matches("atomic::compare_exchange", filters))
+    {
+      print("atomic::compare_exchange", n, atomic_compare_exchange_benchmark(n));
+    }
+  }
+
+  return 0;
+}
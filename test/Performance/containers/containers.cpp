@@ -0,0 +1,682 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput and memory footprint of the containers, each compared with its
+// std equivalent.
+//
+// Usage: etl_containers [--time-ms N] [--csv] [filter...]
+// The options are described in ../benchmark.h.
+//
+// Every container holds up to N_Elements int32_t elements (or key/value pairs
+// of int32_t). The etl containers are sized for exactly that number.
+// The keys are distinct and in pseudo random order. Half of the lookups are
+// for keys that are present.
+//
+// Throughput results are the fastest of several repeated measurements, in
+// nanoseconds per element operation. The 'pop' and 'erase' results include
+// refilling the container first, so they count two operations per element.
+// The ratio is std time / etl time; above 1 means that etl is faster.
+//
+// The footprint is the total memory used by a full container, including its
+// heap allocations, divided by the number of elements. Heap allocations are
+// counted by replacing the global operator new and delete.
+//*****************************************************************************
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/map.h"
+#include "etl/set.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/circular_buffer.h"
+#include "etl/priority_queue.h"
+#include "etl/bitset.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <new>
+#include <queue>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../benchmark.h"
+
+namespace
+{
+  //***************************************************************************
+  /// The number of bytes currently allocated from the heap.
+  /// Each allocation is prefixed by its size, so that delete can subtract it.
+  //***************************************************************************
+  size_t heap_bytes = 0U;
+
+  const size_t Heap_Header = 16U;
+}
+
+//*****************************************************************************
+void* operator new(size_t size)
+{
+  char* p = static_cast<char*>(std::malloc(size + Heap_Header));
+
+  if (p == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+
+  *reinterpret_cast<size_t*>(p) = size;
+  heap_bytes += size;
+
+  return p + Heap_Header;
+}
+
+void operator delete(void* p) noexcept
+{
+  if (p != nullptr)
+  {
+    char* block = static_cast<char*>(p) - Heap_Header;
+    heap_bytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+  }
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  operator delete(p);
+}
+
+namespace
+{
+  using benchmark::consume;
+  using benchmark::function_t;
+
+  //***************************************************************************
+  /// The test data.
+  //***************************************************************************
+  const size_t N_Elements = 1000U;  // Elements in each container.
+  const size_t N_Bits     = 4096U;  // Bits in each bitset.
+
+  std::vector<int32_t> keys;        // Distinct keys in random order.
+  std::vector<int32_t> lookups;     // Half are in 'keys'.
+  std::vector<size_t>  positions;   // Bit positions.
+
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state;
+  }
+
+  //***************************************************************************
+  void make_data()
+  {
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      // Even keys are present, odd keys are not.
+      keys.push_back(int32_t(i * 2U));
+    }
+
+    for (size_t i = N_Elements - 1U; i > 0U; --i)
+    {
+      std::swap(keys[i], keys[random() % (i + 1U)]);
+    }
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      lookups.push_back(int32_t(random() % (N_Elements * 2U)));
+      positions.push_back(random() % N_Bits);
+    }
+  }
+
+  //***************************************************************************
+  /// The containers.
+  //***************************************************************************
+  typedef etl::vector<int32_t, N_Elements>                   etl_vector_t;
+  typedef etl::deque<int32_t, N_Elements>                    etl_deque_t;
+  typedef etl::list<int32_t, N_Elements>                     etl_list_t;
+  typedef etl::forward_list<int32_t, N_Elements>             etl_forward_list_t;
+  typedef etl::map<int32_t, int32_t, N_Elements>             etl_map_t;
+  typedef etl::set<int32_t, N_Elements>                      etl_set_t;
+  typedef etl::flat_map<int32_t, int32_t, N_Elements>        etl_flat_map_t;
+  typedef etl::unordered_map<int32_t, int32_t, N_Elements>   etl_unordered_map_t;
+  typedef etl::circular_buffer<int32_t, N_Elements>          etl_circular_buffer_t;
+  typedef etl::priority_queue<int32_t, N_Elements>           etl_priority_queue_t;
+  typedef etl::bitset<N_Bits>                                etl_bitset_t;
+
+  typedef std::vector<int32_t>                               std_vector_t;
+  typedef std::deque<int32_t>                                std_deque_t;
+  typedef std::list<int32_t>                                 std_list_t;
+  typedef std::forward_list<int32_t>                         std_forward_list_t;
+  typedef std::map<int32_t, int32_t>                         std_map_t;
+  typedef std::set<int32_t>                                  std_set_t;
+  typedef std::unordered_map<int32_t, int32_t>               std_unordered_map_t;
+  typedef std::priority_queue<int32_t>                       std_priority_queue_t;
+  typedef std::bitset<N_Bits>                                std_bitset_t;
+
+  //***************************************************************************
+  /// One instance of each container, shared by its benchmarks.
+  /// Allocated on the heap, as the etl containers are large.
+  //***************************************************************************
+  template <typename TContainer>
+  TContainer& instance()
+  {
+    static TContainer* p_container = new TContainer;
+    return *p_container;
+  }
+
+  //***************************************************************************
+  /// Adds to, and removes from, the sequences.
+  /// The exact container types are overloaded where they differ.
+  //***************************************************************************
+  template <typename TContainer>
+  void add(TContainer& container, int32_t value)
+  {
+    container.push_back(value);
+  }
+
+  void add(etl_forward_list_t& container, int32_t value)    { container.push_front(value); }
+  void add(std_forward_list_t& container, int32_t value)    { container.push_front(value); }
+  void add(etl_circular_buffer_t& container, int32_t value) { container.push(value); }
+
+  template <typename TContainer>
+  void remove(TContainer& container)
+  {
+    container.pop_front();
+  }
+
+  void remove(etl_vector_t& container)          { container.pop_back(); }
+  void remove(std_vector_t& container)          { container.pop_back(); }
+  void remove(etl_circular_buffer_t& container) { container.pop(); }
+
+  //***************************************************************************
+  /// Fills a container with the keys.
+  //***************************************************************************
+  template <typename TContainer>
+  void fill_sequence(TContainer& container)
+  {
+    container.clear();
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      add(container, keys[i]);
+    }
+  }
+
+  template <typename TContainer>
+  void fill_map(TContainer& container)
+  {
+    container.clear();
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.insert(typename TContainer::value_type(keys[i], keys[i]));
+    }
+  }
+
+  template <typename TContainer>
+  void fill_set(TContainer& container)
+  {
+    container.clear();
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.insert(keys[i]);
+    }
+  }
+
+  template <typename TContainer>
+  void fill_queue(TContainer& container)
+  {
+    while (!container.empty())
+    {
+      container.pop();
+    }
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.push(keys[i]);
+    }
+  }
+
+  template <typename TContainer>
+  void fill_bits(TContainer& container)
+  {
+    container.reset();
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.set(positions[i]);
+    }
+  }
+
+  //***************************************************************************
+  /// Sequences
+  //***************************************************************************
+  template <typename TContainer>
+  void sequence_fill()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_sequence(container);
+    consume(size_t(container.front()));
+  }
+
+  template <typename TContainer>
+  void sequence_iterate()
+  {
+    TContainer& container = instance<TContainer>();
+
+    if (container.empty())
+    {
+      fill_sequence(container);
+    }
+
+    size_t sum = 0U;
+
+    for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+    {
+      sum += size_t(*itr);
+    }
+
+    consume(sum);
+  }
+
+  template <typename TContainer>
+  void sequence_pop()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_sequence(container);
+
+    size_t sum = 0U;
+
+    while (!container.empty())
+    {
+      sum += size_t(container.front());
+      remove(container);
+    }
+
+    consume(sum);
+  }
+
+  //***************************************************************************
+  /// Maps and sets
+  //***************************************************************************
+  template <typename TContainer>
+  void map_insert()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_map(container);
+    consume(container.size());
+  }
+
+  template <typename TContainer>
+  void set_insert()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_set(container);
+    consume(container.size());
+  }
+
+  template <typename TContainer>
+  void associative_find()
+  {
+    TContainer& container = instance<TContainer>();
+
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      found += (container.find(lookups[i]) != container.end()) ? 1U : 0U;
+    }
+
+    consume(found);
+  }
+
+  template <typename TContainer>
+  void map_find()
+  {
+    if (instance<TContainer>().empty())
+    {
+      fill_map(instance<TContainer>());
+    }
+
+    associative_find<TContainer>();
+  }
+
+  template <typename TContainer>
+  void set_find()
+  {
+    if (instance<TContainer>().empty())
+    {
+      fill_set(instance<TContainer>());
+    }
+
+    associative_find<TContainer>();
+  }
+
+  template <typename TContainer>
+  void map_erase()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_map(container);
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.erase(keys[i]);
+    }
+
+    consume(container.size());
+  }
+
+  template <typename TContainer>
+  void set_erase()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_set(container);
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      container.erase(keys[i]);
+    }
+
+    consume(container.size());
+  }
+
+  template <typename TContainer>
+  void map_iterate()
+  {
+    TContainer& container = instance<TContainer>();
+
+    if (container.empty())
+    {
+      fill_map(container);
+    }
+
+    size_t sum = 0U;
+
+    for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+    {
+      sum += size_t(itr->second);
+    }
+
+    consume(sum);
+  }
+
+  template <typename TContainer>
+  void set_iterate()
+  {
+    TContainer& container = instance<TContainer>();
+
+    if (container.empty())
+    {
+      fill_set(container);
+    }
+
+    size_t sum = 0U;
+
+    for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+    {
+      sum += size_t(*itr);
+    }
+
+    consume(sum);
+  }
+
+  //***************************************************************************
+  /// Queues
+  //***************************************************************************
+  template <typename TContainer>
+  void queue_push_pop()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_queue(container);
+
+    size_t sum = 0U;
+
+    while (!container.empty())
+    {
+      sum += size_t(container.top());
+      container.pop();
+    }
+
+    consume(sum);
+  }
+
+  //***************************************************************************
+  /// Bitsets
+  //***************************************************************************
+  template <typename TContainer>
+  void bitset_set()
+  {
+    TContainer& container = instance<TContainer>();
+    fill_bits(container);
+    consume(container.count());
+  }
+
+  template <typename TContainer>
+  void bitset_test()
+  {
+    TContainer& container = instance<TContainer>();
+
+    size_t found = 0U;
+
+    for (size_t i = 0U; i < N_Elements; ++i)
+    {
+      found += container.test(size_t(lookups[i]) % N_Bits) ? 1U : 0U;
+    }
+
+    consume(found);
+  }
+
+  struct benchmark_t
+  {
+    const char* name;
+    size_t      operations;
+    function_t  etl_function;
+    const char* std_name;
+    function_t  std_function;
+  };
+
+  //***************************************************************************
+  /// Every benchmark that is measured.
+  //***************************************************************************
+  const benchmark_t benchmarks[] =
+  {
+    { "vector push_back",         N_Elements,      &sequence_fill<etl_vector_t>,                 "std::vector",         &sequence_fill<std_vector_t> },
+    { "vector iterate",           N_Elements,      &sequence_iterate<etl_vector_t>,              "std::vector",         &sequence_iterate<std_vector_t> },
+    { "vector pop_back",          2U * N_Elements, &sequence_pop<etl_vector_t>,                  "std::vector",         &sequence_pop<std_vector_t> },
+    { "deque push_back",          N_Elements,      &sequence_fill<etl_deque_t>,                  "std::deque",          &sequence_fill<std_deque_t> },
+    { "deque iterate",            N_Elements,      &sequence_iterate<etl_deque_t>,               "std::deque",          &sequence_iterate<std_deque_t> },
+    { "deque pop_front",          2U * N_Elements, &sequence_pop<etl_deque_t>,                   "std::deque",          &sequence_pop<std_deque_t> },
+    { "list push_back",           N_Elements,      &sequence_fill<etl_list_t>,                   "std::list",           &sequence_fill<std_list_t> },
+    { "list iterate",             N_Elements,      &sequence_iterate<etl_list_t>,                "std::list",           &sequence_iterate<std_list_t> },
+    { "list pop_front",           2U * N_Elements, &sequence_pop<etl_list_t>,                    "std::list",           &sequence_pop<std_list_t> },
+    { "forward_list push_front",  N_Elements,      &sequence_fill<etl_forward_list_t>,           "std::forward_list",   &sequence_fill<std_forward_list_t> },
+    { "forward_list iterate",     N_Elements,      &sequence_iterate<etl_forward_list_t>,        "std::forward_list",   &sequence_iterate<std_forward_list_t> },
+    { "forward_list pop_front",   2U * N_Elements, &sequence_pop<etl_forward_list_t>,            "std::forward_list",   &sequence_pop<std_forward_list_t> },
+    { "circular_buffer push",     N_Elements,      &sequence_fill<etl_circular_buffer_t>,        "std::deque",          &sequence_fill<std_deque_t> },
+    { "circular_buffer iterate",  N_Elements,      &sequence_iterate<etl_circular_buffer_t>,     "std::deque",          &sequence_iterate<std_deque_t> },
+    { "circular_buffer pop",      2U * N_Elements, &sequence_pop<etl_circular_buffer_t>,         "std::deque",          &sequence_pop<std_deque_t> },
+    { "map insert",               N_Elements,      &map_insert<etl_map_t>,                       "std::map",            &map_insert<std_map_t> },
+    { "map find",                 N_Elements,      &map_find<etl_map_t>,                         "std::map",            &map_find<std_map_t> },
+    { "map iterate",              N_Elements,      &map_iterate<etl_map_t>,                      "std::map",            &map_iterate<std_map_t> },
+    { "map erase",                2U * N_Elements, &map_erase<etl_map_t>,                        "std::map",            &map_erase<std_map_t> },
+    { "set insert",               N_Elements,      &set_insert<etl_set_t>,                       "std::set",            &set_insert<std_set_t> },
+    { "set find",                 N_Elements,      &set_find<etl_set_t>,                         "std::set",            &set_find<std_set_t> },
+    { "set iterate",              N_Elements,      &set_iterate<etl_set_t>,                      "std::set",            &set_iterate<std_set_t> },
+    { "set erase",                2U * N_Elements, &set_erase<etl_set_t>,                        "std::set",            &set_erase<std_set_t> },
+    { "flat_map insert",          N_Elements,      &map_insert<etl_flat_map_t>,                  "std::map",            &map_insert<std_map_t> },
+    { "flat_map find",            N_Elements,      &map_find<etl_flat_map_t>,                    "std::map",            &map_find<std_map_t> },
+    { "flat_map iterate",         N_Elements,      &map_iterate<etl_flat_map_t>,                 "std::map",            &map_iterate<std_map_t> },
+    { "flat_map erase",           2U * N_Elements, &map_erase<etl_flat_map_t>,                   "std::map",            &map_erase<std_map_t> },
+    { "unordered_map insert",     N_Elements,      &map_insert<etl_unordered_map_t>,             "std::unordered_map",  &map_insert<std_unordered_map_t> },
+    { "unordered_map find",       N_Elements,      &map_find<etl_unordered_map_t>,               "std::unordered_map",  &map_find<std_unordered_map_t> },
+    { "unordered_map iterate",    N_Elements,      &map_iterate<etl_unordered_map_t>,            "std::unordered_map",  &map_iterate<std_unordered_map_t> },
+    { "unordered_map erase",      2U * N_Elements, &map_erase<etl_unordered_map_t>,              "std::unordered_map",  &map_erase<std_unordered_map_t> },
+    { "priority_queue push/pop",  2U * N_Elements, &queue_push_pop<etl_priority_queue_t>,        "std::priority_queue", &queue_push_pop<std_priority_queue_t> },
+    { "bitset set",               N_Elements,      &bitset_set<etl_bitset_t>,                    "std::bitset",         &bitset_set<std_bitset_t> },
+    { "bitset test",              N_Elements,      &bitset_test<etl_bitset_t>,                   "std::bitset",         &bitset_test<std_bitset_t> }
+  };
+
+  //***************************************************************************
+  /// Returns the memory used by a full container, including its heap
+  /// allocations, in bytes per element.
+  //***************************************************************************
+  template <typename TContainer, void (*Fill)(TContainer&)>
+  double footprint()
+  {
+    const size_t before = heap_bytes;
+
+    TContainer* p_container = new TContainer;
+    Fill(*p_container);
+
+    const size_t used = heap_bytes - before;
+
+    delete p_container;
+
+    return double(used) / double(N_Elements);
+  }
+
+  typedef double (*footprint_function_t)();
+
+  struct footprint_t
+  {
+    const char*          name;
+    footprint_function_t etl_function;
+    const char*          std_name;
+    footprint_function_t std_function;
+  };
+
+  //***************************************************************************
+  /// Every footprint that is measured.
+  /// For the bitsets, N_Elements bits are set out of N_Bits.
+  //***************************************************************************
+  const footprint_t footprints[] =
+  {
+    { "vector",          &footprint<etl_vector_t,          &fill_sequence<etl_vector_t> >,          "std::vector",         &footprint<std_vector_t,         &fill_sequence<std_vector_t> > },
+    { "deque",           &footprint<etl_deque_t,           &fill_sequence<etl_deque_t> >,           "std::deque",          &footprint<std_deque_t,          &fill_sequence<std_deque_t> > },
+    { "list",            &footprint<etl_list_t,            &fill_sequence<etl_list_t> >,            "std::list",           &footprint<std_list_t,           &fill_sequence<std_list_t> > },
+    { "forward_list",    &footprint<etl_forward_list_t,    &fill_sequence<etl_forward_list_t> >,    "std::forward_list",   &footprint<std_forward_list_t,   &fill_sequence<std_forward_list_t> > },
+    { "circular_buffer", &footprint<etl_circular_buffer_t, &fill_sequence<etl_circular_buffer_t> >, "std::deque",          &footprint<std_deque_t,          &fill_sequence<std_deque_t> > },
+    { "map",             &footprint<etl_map_t,             &fill_map<etl_map_t> >,                  "std::map",            &footprint<std_map_t,            &fill_map<std_map_t> > },
+    { "set",             &footprint<etl_set_t,             &fill_set<etl_set_t> >,                  "std::set",            &footprint<std_set_t,            &fill_set<std_set_t> > },
+    { "flat_map",        &footprint<etl_flat_map_t,        &fill_map<etl_flat_map_t> >,             "std::map",            &footprint<std_map_t,            &fill_map<std_map_t> > },
+    { "unordered_map",   &footprint<etl_unordered_map_t,   &fill_map<etl_unordered_map_t> >,        "std::unordered_map",  &footprint<std_unordered_map_t,  &fill_map<std_unordered_map_t> > },
+    { "priority_queue",  &footprint<etl_priority_queue_t,  &fill_queue<etl_priority_queue_t> >,     "std::priority_queue", &footprint<std_priority_queue_t, &fill_queue<std_priority_queue_t> > },
+    { "bitset",          &footprint<etl_bitset_t,          &fill_bits<etl_bitset_t> >,              "std::bitset",         &footprint<std_bitset_t,         &fill_bits<std_bitset_t> > }
+  };
+
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  benchmark::options_t options;
+
+  if (!benchmark::parse_options(argc, argv, options))
+  {
+    return 0;
+  }
+
+  make_data();
+
+  // Throughput.
+  if (options.csv)
+  {
+    std::printf("benchmark,etl ns/op,std,std ns/op,std/etl\n");
+  }
+  else
+  {
+    std::printf("%-26s %10s   %-20s %10s %8s\n", "Benchmark", "etl ns/op", "std", "ns/op", "std/etl");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!options.matches(benchmark.name))
+    {
+      continue;
+    }
+
+    const double etl_ns = benchmark::measure(benchmark.etl_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+    const double std_ns = benchmark::measure(benchmark.std_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+
+    if (options.csv)
+    {
+      std::printf("%s,%.2f,%s,%.2f,%.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+    else
+    {
+      std::printf("%-26s %10.2f   %-20s %10.2f %8.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+  }
+
+  // Footprint.
+  if (options.csv)
+  {
+    std::printf("\ncontainer,etl bytes/element,std,std bytes/element\n");
+  }
+  else
+  {
+    std::printf("\n%-26s %10s   %-20s %10s\n", "Footprint", "etl B/elem", "std", "B/elem");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(footprints); ++i)
+  {
+    const footprint_t& footprint = footprints[i];
+
+    if (!options.matches(footprint.name))
+    {
+      continue;
+    }
+
+    const double etl_bytes = footprint.etl_function();
+    const double std_bytes = footprint.std_function();
+
+    if (options.csv)
+    {
+      std::printf("%s,%.2f,%s,%.2f\n", footprint.name, etl_bytes, footprint.std_name, std_bytes);
+    }
+    else
+    {
+      std::printf("%-26s %10.2f   %-20s %10.2f\n", footprint.name, etl_bytes, footprint.std_name, std_bytes);
+    }
+  }
+
+  return 0;
+}
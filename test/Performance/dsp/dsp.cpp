@@ -0,0 +1,482 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Cost per sample of the statistics, filters and random number generators.
+//
+// Usage: etl_dsp [--time-ms N] [--csv] [filter...]
+// The options are described in ../benchmark.h.
+//
+// Each benchmark processes 1024 pseudo random samples of float, int16_t and
+// int32_t. The scalar column passes them one at a time to add() or to the
+// function operator. The block column passes the whole array to the range
+// add(), or to generate() for the generators, where the class has one.
+// The generators are also measured with range(0, 99).
+// Results are the fastest of several repeated measurements, in nanoseconds
+// per sample. The ratio is scalar time / block time.
+//
+// The integral statistics are calculated in int64_t.
+//*****************************************************************************
+
+#include "etl/mean.h"
+#include "etl/variance.h"
+#include "etl/standard_deviation.h"
+#include "etl/rms.h"
+#include "etl/covariance.h"
+#include "etl/correlation.h"
+#include "etl/histogram.h"
+#include "etl/cumulative_moving_average.h"
+#include "etl/quantize.h"
+#include "etl/limiter.h"
+#include "etl/threshold.h"
+#include "etl/rescale.h"
+#include "etl/random.h"
+#include "etl/crc32.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "../benchmark.h"
+
+namespace
+{
+  using benchmark::consume;
+  using benchmark::function_t;
+
+  //***************************************************************************
+  /// The test data.
+  //***************************************************************************
+  const size_t N_Samples = 1024U;
+  const size_t N_Bins    = 256U;
+
+  template <typename T>
+  struct samples
+  {
+    static T first[N_Samples];  ///< Values across most of the range of T.
+    static T second[N_Samples]; ///< Correlated with first.
+    static T keys[N_Samples];   ///< Values from 0 to N_Bins - 1.
+    static T output[N_Samples]; ///< The results of the filters.
+  };
+
+  template <typename T> T samples<T>::first[N_Samples];
+  template <typename T> T samples<T>::second[N_Samples];
+  template <typename T> T samples<T>::keys[N_Samples];
+  template <typename T> T samples<T>::output[N_Samples];
+
+  uint32_t random_output[N_Samples];
+
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state;
+  }
+
+  //***************************************************************************
+  void make_data()
+  {
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      const int16_t a = int16_t(random() >> 16U);
+      const int16_t b = int16_t((a / 2) + (int16_t(random() >> 16U) / 4));
+      const int16_t k = int16_t(random() % N_Bins);
+
+      samples<int16_t>::first[i]  = a;
+      samples<int16_t>::second[i] = b;
+      samples<int16_t>::keys[i]   = k;
+
+      samples<int32_t>::first[i]  = int32_t(a) << 8;
+      samples<int32_t>::second[i] = int32_t(b) << 8;
+      samples<int32_t>::keys[i]   = k;
+
+      samples<float>::first[i]  = float(a) / 32768.0f;
+      samples<float>::second[i] = float(b) / 32768.0f;
+      samples<float>::keys[i]   = float(k) + 0.5f;
+    }
+  }
+
+  //***************************************************************************
+  /// The type the integral statistics are calculated in.
+  //***************************************************************************
+  template <typename T>
+  struct calc
+  {
+    typedef int64_t type;
+  };
+
+  template <>
+  struct calc<float>
+  {
+    typedef float type;
+  };
+
+  //***************************************************************************
+  /// A fraction of the full scale of the samples.
+  //***************************************************************************
+  template <typename T>
+  T level(double fraction)
+  {
+    const double full_scale = etl::is_floating_point<T>::value ? 1.0 : (etl::is_same<T, int16_t>::value ? 32768.0 : 8388608.0);
+
+    return T(fraction * full_scale);
+  }
+
+  //***************************************************************************
+  /// The statistics of a single series.
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void statistic_scalar()
+  {
+    TStatistic statistic;
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      statistic.add(samples<T>::first[i]);
+    }
+
+    consume(double(statistic));
+  }
+
+  template <typename TStatistic, typename T>
+  void statistic_block()
+  {
+    TStatistic statistic;
+
+    statistic.add(samples<T>::first, samples<T>::first + N_Samples);
+
+    consume(double(statistic));
+  }
+
+  //***************************************************************************
+  /// The statistics of a pair of series.
+  //***************************************************************************
+  template <typename TStatistic, typename T>
+  void pair_statistic_scalar()
+  {
+    TStatistic statistic;
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      statistic.add(samples<T>::first[i], samples<T>::second[i]);
+    }
+
+    consume(double(statistic));
+  }
+
+  template <typename TStatistic, typename T>
+  void pair_statistic_block()
+  {
+    TStatistic statistic;
+
+    statistic.add(samples<T>::first, samples<T>::first + N_Samples, samples<T>::second);
+
+    consume(double(statistic));
+  }
+
+  //***************************************************************************
+  /// Histograms of integral keys, and of floats binned with add_scaled().
+  //***************************************************************************
+  template <typename T>
+  void histogram_scalar()
+  {
+    etl::histogram<T, uint32_t, N_Bins, 0> histogram;
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      histogram.add(samples<T>::keys[i]);
+    }
+
+    consume(histogram[N_Bins / 2U]);
+  }
+
+  template <typename T>
+  void histogram_block()
+  {
+    etl::histogram<T, uint32_t, N_Bins, 0> histogram;
+
+    histogram.add(samples<T>::keys, samples<T>::keys + N_Samples);
+
+    consume(histogram[N_Bins / 2U]);
+  }
+
+  template <>
+  void histogram_scalar<float>()
+  {
+    etl::histogram<int32_t, uint32_t, N_Bins, 0> histogram;
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      histogram.add_scaled(samples<float>::keys[i], 0.0f, 1.0f);
+    }
+
+    consume(histogram[N_Bins / 2U]);
+  }
+
+  template <>
+  void histogram_block<float>()
+  {
+    etl::histogram<int32_t, uint32_t, N_Bins, 0> histogram;
+
+    histogram.add_scaled(samples<float>::keys, samples<float>::keys + N_Samples, 0.0f, 1.0f);
+
+    consume(histogram[N_Bins / 2U]);
+  }
+
+  //***************************************************************************
+  /// Cumulative moving average. The block version uses the insert iterator.
+  //***************************************************************************
+  template <typename T>
+  void cma_scalar()
+  {
+    etl::cumulative_moving_average<T, 16U> cma(T(0));
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      cma.add(samples<T>::first[i]);
+    }
+
+    consume(cma.value());
+  }
+
+  template <typename T>
+  void cma_block()
+  {
+    etl::cumulative_moving_average<T, 16U> cma(T(0));
+
+    std::copy(samples<T>::first, samples<T>::first + N_Samples, cma.input());
+
+    consume(cma.value());
+  }
+
+  //***************************************************************************
+  /// The filters. These have no block interface, so are applied in a loop.
+  //***************************************************************************
+  template <typename TFilter, typename T>
+  void apply_filter(const TFilter& filter)
+  {
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      samples<T>::output[i] = filter(samples<T>::first[i]);
+    }
+
+    consume(samples<T>::output[N_Samples - 1U]);
+  }
+
+  template <typename T>
+  void quantize_scalar()
+  {
+    // Eight levels, evenly spread.
+    T thresholds[7];
+    T levels[8];
+
+    for (int i = 0; i < 8; ++i)
+    {
+      levels[i] = level<T>(-0.875 + (0.25 * i));
+
+      if (i < 7)
+      {
+        thresholds[i] = level<T>(-0.75 + (0.25 * i));
+      }
+    }
+
+    apply_filter<etl::quantize<T>, T>(etl::quantize<T>(thresholds, levels, 8U));
+  }
+
+  template <typename T>
+  void limiter_scalar()
+  {
+    apply_filter<etl::limiter<T>, T>(etl::limiter<T>(level<T>(-0.5), level<T>(0.5)));
+  }
+
+  template <typename T>
+  void threshold_scalar()
+  {
+    apply_filter<etl::threshold<T>, T>(etl::threshold<T>(level<T>(0.25), level<T>(0.0), level<T>(0.5)));
+  }
+
+  template <typename T>
+  void rescale_scalar()
+  {
+    apply_filter<etl::rescale<T, T>, T>(etl::rescale<T, T>(level<T>(-1.0), level<T>(0.99), level<T>(0.0), level<T>(0.5)));
+  }
+
+  //***************************************************************************
+  /// The random number generators.
+  //***************************************************************************
+  template <typename TGenerator>
+  void random_scalar()
+  {
+    static TGenerator generator(0x12345678UL);
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      random_output[i] = generator();
+    }
+
+    consume(random_output[N_Samples - 1U]);
+  }
+
+  template <typename TGenerator>
+  void random_block()
+  {
+    static TGenerator generator(0x12345678UL);
+
+    generator.generate(random_output, random_output + N_Samples);
+
+    consume(random_output[N_Samples - 1U]);
+  }
+
+  template <typename TGenerator>
+  void random_range()
+  {
+    static TGenerator generator(0x12345678UL);
+
+    for (size_t i = 0U; i < N_Samples; ++i)
+    {
+      random_output[i] = generator.range(0U, 99U);
+    }
+
+    consume(random_output[N_Samples - 1U]);
+  }
+
+  struct benchmark_t
+  {
+    const char* name;
+    const char* type;
+    function_t  scalar_function;
+    function_t  block_function; ///< Null if there is no block interface.
+  };
+
+  typedef etl::variance_type           vt;
+  typedef etl::standard_deviation_type sdt;
+  typedef etl::covariance_type         ct;
+  typedef etl::correlation_type        rt;
+
+  //***************************************************************************
+  /// Every benchmark that is measured.
+  //***************************************************************************
+#define ETL_DSP_BENCHMARKS(T) \
+    { "mean",                      #T, &statistic_scalar<etl::mean<T, calc<T>::type>, T>,                                &statistic_block<etl::mean<T, calc<T>::type>, T> },                                \
+    { "variance",                  #T, &statistic_scalar<etl::variance<vt::Sample, T, calc<T>::type>, T>,                &statistic_block<etl::variance<vt::Sample, T, calc<T>::type>, T> },                \
+    { "standard_deviation",        #T, &statistic_scalar<etl::standard_deviation<sdt::Sample, T, calc<T>::type>, T>,     &statistic_block<etl::standard_deviation<sdt::Sample, T, calc<T>::type>, T> },     \
+    { "rms",                       #T, &statistic_scalar<etl::rms<T, calc<T>::type>, T>,                                 &statistic_block<etl::rms<T, calc<T>::type>, T> },                                 \
+    { "covariance",                #T, &pair_statistic_scalar<etl::covariance<ct::Sample, T, calc<T>::type>, T>,         &pair_statistic_block<etl::covariance<ct::Sample, T, calc<T>::type>, T> },         \
+    { "correlation",               #T, &pair_statistic_scalar<etl::correlation<rt::Sample, T, calc<T>::type>, T>,        &pair_statistic_block<etl::correlation<rt::Sample, T, calc<T>::type>, T> },        \
+    { "histogram",                 #T, &histogram_scalar<T>,                                                             &histogram_block<T> },                                                             \
+    { "cumulative_moving_average", #T, &cma_scalar<T>,                                                                   &cma_block<T> },                                                                   \
+    { "quantize",                  #T, &quantize_scalar<T>,                                                              nullptr },                                                                         \
+    { "limiter",                   #T, &limiter_scalar<T>,                                                               nullptr },                                                                         \
+    { "threshold",                 #T, &threshold_scalar<T>,                                                             nullptr },                                                                         \
+    { "rescale",                   #T, &rescale_scalar<T>,                                                               nullptr }
+
+#define ETL_RANDOM_BENCHMARKS(generator, block) \
+    { #generator,                  "uint32_t", &random_scalar<etl::generator>,                                           block },                                                                           \
+    { #generator " range",         "uint32_t", &random_range<etl::generator>,                                            nullptr }
+
+  const benchmark_t benchmarks[] =
+  {
+    ETL_DSP_BENCHMARKS(float),
+    ETL_DSP_BENCHMARKS(int16_t),
+    ETL_DSP_BENCHMARKS(int32_t),
+    ETL_RANDOM_BENCHMARKS(random_xorshift,    nullptr),
+    ETL_RANDOM_BENCHMARKS(random_lcg,         nullptr),
+    ETL_RANDOM_BENCHMARKS(random_clcg,        nullptr),
+    ETL_RANDOM_BENCHMARKS(random_lsfr,        nullptr),
+    ETL_RANDOM_BENCHMARKS(random_mwc,         nullptr),
+    ETL_RANDOM_BENCHMARKS(random_pcg,         nullptr),
+    ETL_RANDOM_BENCHMARKS(random_xoshiro128,  &random_block<etl::random_xoshiro128>),
+    ETL_RANDOM_BENCHMARKS(random_xoshiro256,  &random_block<etl::random_xoshiro256>),
+    ETL_RANDOM_BENCHMARKS(random_hash<etl::crc32>, nullptr)
+  };
+
+#undef ETL_DSP_BENCHMARKS
+#undef ETL_RANDOM_BENCHMARKS
+
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  benchmark::options_t options;
+
+  if (!benchmark::parse_options(argc, argv, options))
+  {
+    return 0;
+  }
+
+  make_data();
+
+  if (options.csv)
+  {
+    std::printf("benchmark,type,scalar ns/sample,block ns/sample,scalar/block\n");
+  }
+  else
+  {
+    std::printf("%-30s %-10s %12s %12s %14s\n", "Benchmark", "Type", "scalar ns", "block ns", "scalar/block");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!options.matches(benchmark.name))
+    {
+      continue;
+    }
+
+    const double scalar_ns = (benchmark::measure(benchmark.scalar_function, options.min_time) * 1.0e9) / double(N_Samples);
+
+    if (benchmark.block_function == nullptr)
+    {
+      if (options.csv)
+      {
+        std::printf("%s,%s,%.2f,,\n", benchmark.name, benchmark.type, scalar_ns);
+      }
+      else
+      {
+        std::printf("%-30s %-10s %12.2f %12s %14s\n", benchmark.name, benchmark.type, scalar_ns, "-", "-");
+      }
+    }
+    else
+    {
+      const double block_ns = (benchmark::measure(benchmark.block_function, options.min_time) * 1.0e9) / double(N_Samples);
+
+      if (options.csv)
+      {
+        std::printf("%s,%s,%.2f,%.2f,%.2f\n", benchmark.name, benchmark.type, scalar_ns, block_ns, scalar_ns / block_ns);
+      }
+      else
+      {
+        std::printf("%-30s %-10s %12.2f %12.2f %14.2f\n", benchmark.name, benchmark.type, scalar_ns, block_ns, scalar_ns / block_ns);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,556 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Message throughput and dispatch latency benchmark for the routers, buses
+// and state machines.
+//
+// Usage: etl_messaging [options] [filter...]
+//   --ops N        Messages for each benchmark (default 1M).
+//   --csv          Output comma separated values.
+//   filter         Only run benchmarks whose name contains one of the filters.
+//
+// Each benchmark is run twice. The first run times the whole loop, to give
+// the messages per second. The second run times every 64th dispatch on its
+// own, to give the latency percentiles. Latencies are in nanoseconds and
+// include the cost of reading the clock.
+//
+// The router and bus benchmarks cycle through four message types, each with
+// a payload of 4, 64 or 256 bytes, and are run with 1, 4 and 16 routers.
+//*****************************************************************************
+
+#include "etl/message.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/fsm.h"
+#include "etl/state_chart.h"
+#include "etl/array.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef std::chrono::steady_clock clock_type;
+
+  const size_t Sample_Every = 64U;
+  const size_t Max_Routers  = 16U;
+
+  size_t ops = 1000000U;
+  bool   csv = false;
+
+#if defined(__GNUC__)
+  //***************************************************************************
+  /// Stops the compiler optimising away the result.
+  //***************************************************************************
+  template <typename T>
+  void do_not_optimise(const T& value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+#else
+  volatile uint32_t sink;
+
+  template <typename T>
+  void do_not_optimise(const T& value)
+  {
+    sink = uint32_t(value);
+  }
+#endif
+
+  //***************************************************************************
+  /// Nanoseconds from an arbitrary epoch.
+  //***************************************************************************
+  uint64_t now_ns()
+  {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count());
+  }
+
+  //***************************************************************************
+  /// The result of one benchmark.
+  //***************************************************************************
+  struct result_t
+  {
+    double messages_per_second;
+    double p50;
+    double p99;
+    double max;
+  };
+
+  //***************************************************************************
+  /// Measures the throughput, then the latency, of a dispatch function.
+  /// The function is called with the message number.
+  //***************************************************************************
+  template <typename TFunction>
+  result_t measure(TFunction function)
+  {
+    // Warm up.
+    for (size_t i = 0U; i < (ops / 16U); ++i)
+    {
+      function(i);
+    }
+
+    clock_type::time_point start = clock_type::now();
+
+    for (size_t i = 0U; i < ops; ++i)
+    {
+      function(i);
+    }
+
+    const double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    std::vector<uint64_t> samples;
+    samples.reserve(ops / Sample_Every);
+
+    for (size_t i = 0U; i < ops; i += Sample_Every)
+    {
+      const uint64_t begin = now_ns();
+      function(i);
+      samples.push_back(now_ns() - begin);
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    result_t result = { double(ops) / seconds, 0.0, 0.0, 0.0 };
+
+    if (!samples.empty())
+    {
+      result.p50 = double(samples[(samples.size() * 50U) / 100U]);
+      result.p99 = double(samples[(samples.size() * 99U) / 100U]);
+      result.max = double(samples.back());
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  bool matches(const char* name, const std::vector<std::string>& filters)
+  {
+    if (filters.empty())
+    {
+      return true;
+    }
+
+    for (size_t i = 0U; i < filters.size(); ++i)
+    {
+      if (std::strstr(name, filters[i].c_str()) != nullptr)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  void print(const char* name, size_t routers, size_t payload, const result_t& result)
+  {
+    if (csv)
+    {
+      std::printf("%s,%zu,%zu,%.0f,%.0f,%.0f,%.0f\n", name, routers, payload,
+                  result.messages_per_second, result.p50, result.p99, result.max);
+    }
+    else
+    {
+      std::printf("%-24s %7zu %7zu %14.0f %10.0f %10.0f %10.0f\n", name, routers, payload,
+                  result.messages_per_second, result.p50, result.p99, result.max);
+    }
+
+    std::fflush(stdout);
+  }
+
+  //***************************************************************************
+  // Routers and buses.
+  //***************************************************************************
+
+  //***************************************************************************
+  /// A message with a payload of the given size.
+  //***************************************************************************
+  template <etl::message_id_t ID, size_t Payload_Size>
+  struct Payload : public etl::message<ID>
+  {
+    Payload()
+    {
+      std::memset(data, int(ID), Payload_Size);
+    }
+
+    uint8_t data[Payload_Size];
+  };
+
+  //***************************************************************************
+  /// A router that handles four message types.
+  //***************************************************************************
+  template <size_t Payload_Size>
+  class Sink : public etl::message_router<Sink<Payload_Size>,
+                                          Payload<1, Payload_Size>,
+                                          Payload<2, Payload_Size>,
+                                          Payload<3, Payload_Size>,
+                                          Payload<4, Payload_Size> >
+  {
+  public:
+
+    typedef etl::message_router<Sink<Payload_Size>,
+                                Payload<1, Payload_Size>,
+                                Payload<2, Payload_Size>,
+                                Payload<3, Payload_Size>,
+                                Payload<4, Payload_Size> > base_t;
+
+    Sink(etl::message_router_id_t id)
+      : base_t(id)
+      , total(0U)
+    {
+    }
+
+    template <etl::message_id_t ID>
+    void on_receive(const Payload<ID, Payload_Size>& msg)
+    {
+      total += msg.data[0] + msg.data[Payload_Size - 1U];
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    uint32_t total;
+  };
+
+  //***************************************************************************
+  /// The four messages for a payload size.
+  //***************************************************************************
+  template <size_t Payload_Size>
+  struct Messages
+  {
+    Messages()
+    {
+      list[0] = &m1;
+      list[1] = &m2;
+      list[2] = &m3;
+      list[3] = &m4;
+    }
+
+    const etl::imessage& operator [](size_t i) const
+    {
+      return *list[i & 3U];
+    }
+
+    Payload<1, Payload_Size> m1;
+    Payload<2, Payload_Size> m2;
+    Payload<3, Payload_Size> m3;
+    Payload<4, Payload_Size> m4;
+
+    const etl::imessage* list[4];
+  };
+
+  typedef etl::message_bus<Max_Routers> bus_t;
+
+  //***************************************************************************
+  /// Runs the router and bus benchmarks for a payload size.
+  //***************************************************************************
+  template <size_t Payload_Size>
+  void router_benchmarks(const std::vector<std::string>& filters)
+  {
+    const Messages<Payload_Size> messages;
+    const size_t router_counts[] = { 1U, 4U, 16U };
+
+    if (matches("router_direct", filters))
+    {
+      Sink<Payload_Size> router(0U);
+
+      print("router_direct", 1U, Payload_Size, measure([&](size_t i)
+      {
+        router.receive(messages[i]);
+      }));
+
+      do_not_optimise(router.total);
+    }
+
+    for (size_t r = 0U; r < (sizeof(router_counts) / sizeof(router_counts[0])); ++r)
+    {
+      const size_t n_routers = router_counts[r];
+
+      std::vector<Sink<Payload_Size>*> routers;
+
+      for (size_t i = 0U; i < n_routers; ++i)
+      {
+        routers.push_back(new Sink<Payload_Size>(etl::message_router_id_t(i)));
+      }
+
+      bus_t* bus = new bus_t;
+
+      for (size_t i = 0U; i < n_routers; ++i)
+      {
+        bus->subscribe(*routers[i]);
+      }
+
+      if (matches("bus_broadcast", filters))
+      {
+        print("bus_broadcast", n_routers, Payload_Size, measure([&](size_t i)
+        {
+          bus->receive(messages[i]);
+        }));
+      }
+
+      if (matches("bus_broadcast_indexed", filters))
+      {
+        etl::message_bus_index<5U, Max_Routers> index;
+        bus->set_index(index);
+
+        print("bus_broadcast_indexed", n_routers, Payload_Size, measure([&](size_t i)
+        {
+          bus->receive(messages[i]);
+        }));
+
+        bus->clear_index();
+      }
+
+      if (matches("bus_addressed", filters))
+      {
+        print("bus_addressed", n_routers, Payload_Size, measure([&](size_t i)
+        {
+          bus->receive(etl::message_router_id_t(i % n_routers), messages[i]);
+        }));
+      }
+
+      for (size_t i = 0U; i < n_routers; ++i)
+      {
+        do_not_optimise(routers[i]->total);
+        delete routers[i];
+      }
+
+      delete bus;
+    }
+  }
+
+  //***************************************************************************
+  // State machines.
+  //***************************************************************************
+  const etl::message_id_t Toggle_Id = 1U;
+  const etl::message_id_t Stay_Id   = 2U;
+
+  struct Toggle : public etl::message<Toggle_Id>
+  {
+  };
+
+  struct Stay : public etl::message<Stay_Id>
+  {
+  };
+
+  //***************************************************************************
+  /// An fsm with two states that toggles between them.
+  //***************************************************************************
+  class Machine : public etl::fsm
+  {
+  public:
+
+    Machine()
+      : fsm(0U)
+      , stays(0U)
+    {
+    }
+
+    uint32_t stays;
+  };
+
+  template <etl::fsm_state_id_t State_Id>
+  class Side : public etl::fsm_state<Machine, Side<State_Id>, State_Id, Toggle, Stay>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Toggle&)
+    {
+      return State_Id ^ 1U;
+    }
+
+    etl::fsm_state_id_t on_event(const Stay&)
+    {
+      ++this->get_fsm_context().stays;
+      return State_Id;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return State_Id;
+    }
+  };
+
+  //***************************************************************************
+  /// A state_chart with two states that toggles between them.
+  //***************************************************************************
+  class Chart : public etl::state_chart<Chart>
+  {
+  public:
+
+    enum
+    {
+      Left,
+      Right,
+      Number_Of_States
+    };
+
+    enum
+    {
+      Toggle_Event,
+      Stay_Event,
+      Number_Of_Events
+    };
+
+    Chart()
+      : state_chart<Chart>(*this, transition_table.begin(), transition_table.end(), Left)
+      , stays(0U)
+    {
+    }
+
+    void on_stay()
+    {
+      ++stays;
+    }
+
+    uint32_t stays;
+
+    static const etl::array<Chart::transition, 4> transition_table;
+  };
+
+  const etl::array<Chart::transition, 4> Chart::transition_table =
+  {
+    Chart::transition(Chart::Left,  Chart::Toggle_Event, Chart::Right),
+    Chart::transition(Chart::Left,  Chart::Stay_Event,   Chart::Left,  &Chart::on_stay),
+    Chart::transition(Chart::Right, Chart::Toggle_Event, Chart::Left),
+    Chart::transition(Chart::Right, Chart::Stay_Event,   Chart::Right, &Chart::on_stay)
+  };
+
+  //***************************************************************************
+  /// Runs the state machine benchmarks.
+  /// Every other message changes the state.
+  //***************************************************************************
+  void state_machine_benchmarks(const std::vector<std::string>& filters)
+  {
+    if (matches("fsm", filters))
+    {
+      Machine machine;
+      Side<0U> left;
+      Side<1U> right;
+      etl::ifsm_state* states[] = { &left, &right };
+
+      machine.set_states(states, 2U);
+      machine.start();
+
+      const Toggle toggle;
+      const Stay   stay;
+      const etl::imessage* messages[] = { &toggle, &stay };
+
+      print("fsm", 1U, 0U, measure([&](size_t i)
+      {
+        machine.receive(*messages[i & 1U]);
+      }));
+
+      do_not_optimise(machine.stays);
+    }
+
+    if (matches("state_chart", filters))
+    {
+      Chart chart;
+      chart.start();
+
+      print("state_chart", 1U, 0U, measure([&](size_t i)
+      {
+        chart.process_event(etl::istate_chart::event_id_t(i & 1U));
+      }));
+
+      do_not_optimise(chart.stays);
+    }
+
+    if (matches("state_chart_indexed", filters))
+    {
+      Chart chart;
+      etl::state_chart_index<Chart::Number_Of_States, Chart::Number_Of_Events, 4U> index;
+
+      chart.set_index(index);
+      chart.start();
+
+      print("state_chart_indexed", 1U, 0U, measure([&](size_t i)
+      {
+        chart.process_event(etl::istate_chart::event_id_t(i & 1U));
+      }));
+
+      do_not_optimise(chart.stays);
+    }
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+
+    if ((arg == "--ops") && (i + 1 < argc))
+    {
+      ops = size_t(std::strtoull(argv[++i], nullptr, 0));
+    }
+    else if (arg == "--csv")
+    {
+      csv = true;
+    }
+    else if ((arg == "--help") || (arg == "-h"))
+    {
+      std::printf("Usage: %s [--ops N] [--csv] [filter...]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filters.push_back(arg);
+    }
+  }
+
+  ops = std::max(Sample_Every, ops);
+
+  if (csv)
+  {
+    std::printf("benchmark,routers,payload,messages/s,p50 ns,p99 ns,max ns\n");
+  }
+  else
+  {
+    std::printf("%-24s %7s %7s %14s %10s %10s %10s\n", "Benchmark", "Routers", "Payload", "messages/s", "p50 ns", "p99 ns", "max ns");
+  }
+
+  router_benchmarks<4U>(filters);
+  router_benchmarks<64U>(filters);
+  router_benchmarks<256U>(filters);
+
+  state_machine_benchmarks(filters);
+
+  return 0;
+}
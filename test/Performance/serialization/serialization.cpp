@@ -0,0 +1,628 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput benchmark for the serialization classes, each compared with a
+// hand-written baseline that does the same job as simply as possible.
+//
+// Usage: etl_serialization [--time-ms N] [--csv] [filter...]
+// The options are described in ../benchmark.h.
+//
+// Each benchmark encodes or decodes 1024 pseudo random values. MB/s is
+// measured against the size of the values in memory, so that an encoder and
+// its baseline are compared over the same work. The ratio is etl MB/s /
+// baseline MB/s; above 1 means that etl is faster.
+//
+// The memcpy baselines show the cost of the data movement alone. The other
+// baselines are a direct shift-and-mask implementation of the same format.
+//*****************************************************************************
+
+#include "etl/bit_stream.h"
+#include "etl/byte_stream.h"
+#include "etl/endianness.h"
+#include "etl/binary.h"
+#include "etl/varint.h"
+#include "etl/cobs.h"
+#include "etl/slip.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "../benchmark.h"
+
+namespace
+{
+  using benchmark::consume;
+  using benchmark::function_t;
+
+  //***************************************************************************
+  /// The test data.
+  //***************************************************************************
+  const size_t N_Values = 1024U;
+
+  uint16_t values16[N_Values];
+  uint32_t values32[N_Values];
+  uint64_t values64[N_Values];
+  uint32_t varint_values[N_Values];
+  uint32_t decoded32[N_Values];
+  uint16_t decoded16[N_Values];
+  uint64_t decoded64[N_Values];
+
+  // The output of every encoder and decoder. Large enough for any of them.
+  uint8_t encoded[N_Values * 16U];
+
+  // Pseudo random bytes, the input for the bit and byte readers.
+  const uint8_t* const random_bytes = reinterpret_cast<const uint8_t*>(values64);
+
+  // Bytes for the framing codecs, with some zeros and special characters.
+  uint8_t frame[N_Values * 4U];
+
+  // The encoded forms, made once so that the decoders have input.
+  uint8_t varint_encoded[N_Values * 5U];
+  uint8_t cobs_encoded[N_Values * 5U];
+  uint8_t slip_encoded[N_Values * 8U];
+  size_t  varint_size;
+  size_t  cobs_size;
+  size_t  slip_size;
+
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state;
+  }
+
+  //***************************************************************************
+  void make_data()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      values16[i] = uint16_t(random());
+      values32[i] = random();
+      values64[i] = (uint64_t(random()) << 32U) | random();
+
+      // Spread the magnitudes, so that all varint lengths are represented.
+      varint_values[i] = random() >> (random() % 32U);
+    }
+
+    for (size_t i = 0U; i < sizeof(frame); ++i)
+    {
+      const uint32_t r = random();
+
+      // About 1 in 64 bytes is 0, 0xC0 or 0xDB.
+      switch ((r >> 8U) % 64U)
+      {
+        case 0U:  frame[i] = 0x00U; break;
+        case 1U:  frame[i] = 0xC0U; break;
+        case 2U:  frame[i] = 0xDBU; break;
+        default:  frame[i] = uint8_t(r >> 24U) | 0x01U; break;
+      }
+    }
+
+    varint_size = etl::varint_encode(varint_values, N_Values, varint_encoded, sizeof(varint_encoded));
+    cobs_size   = etl::cobs_encode(etl::span<const uint8_t>(frame, sizeof(frame)), etl::span<uint8_t>(cobs_encoded, sizeof(cobs_encoded)));
+    slip_size   = etl::slip_encode(etl::span<const uint8_t>(frame, sizeof(frame)), etl::span<uint8_t>(slip_encoded, sizeof(slip_encoded)));
+  }
+
+  //***************************************************************************
+  /// Copies the bytes of an array. The baseline for every codec.
+  //***************************************************************************
+  template <size_t Bytes>
+  void baseline_memcpy()
+  {
+    memcpy(encoded, random_bytes, Bytes);
+    consume(encoded[Bytes - 1U]);
+  }
+
+  //***************************************************************************
+  /// bit_stream at several field widths.
+  //***************************************************************************
+  template <uint_least8_t Width>
+  void etl_bit_stream_put()
+  {
+    etl::bit_stream stream(encoded, sizeof(encoded));
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      stream.put(values32[i], Width);
+    }
+
+    consume(encoded[0]);
+  }
+
+  template <uint_least8_t Width>
+  void etl_bit_stream_get()
+  {
+    etl::bit_stream stream(const_cast<uint8_t*>(random_bytes), N_Values * 8U);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      stream.get(decoded32[i], Width);
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  template <uint_least8_t Width>
+  void etl_bit_stream_write()
+  {
+    etl::bit_stream_writer writer(encoded, sizeof(encoded));
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      writer.write(values32[i], Width);
+    }
+
+    writer.flush();
+    consume(encoded[0]);
+  }
+
+  template <uint_least8_t Width>
+  void etl_bit_stream_read()
+  {
+    etl::bit_stream_reader reader(random_bytes, N_Values * 8U);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      reader.read(decoded32[i], Width);
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// Hand-written MSB first bit packing with a 64 bit accumulator.
+  //***************************************************************************
+  template <uint_least8_t Width>
+  void baseline_pack()
+  {
+    const uint32_t mask  = (Width == 32U) ? 0xFFFFFFFFUL : ((uint32_t(1U) << Width) - 1U);
+    uint64_t       bits  = 0U;
+    uint32_t       count = 0U;
+    uint8_t*       p     = encoded;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      bits   = (bits << Width) | (values32[i] & mask);
+      count += Width;
+
+      while (count >= 8U)
+      {
+        count -= 8U;
+        *p++ = uint8_t(bits >> count);
+      }
+    }
+
+    if (count != 0U)
+    {
+      *p = uint8_t(bits << (8U - count));
+    }
+
+    consume(encoded[0]);
+  }
+
+  template <uint_least8_t Width>
+  void baseline_unpack()
+  {
+    const uint32_t mask  = (Width == 32U) ? 0xFFFFFFFFUL : ((uint32_t(1U) << Width) - 1U);
+    uint64_t       bits  = 0U;
+    uint32_t       count = 0U;
+    const uint8_t* p     = random_bytes;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      while (count < Width)
+      {
+        bits   = (bits << 8U) | *p++;
+        count += 8U;
+      }
+
+      count       -= Width;
+      decoded32[i] = uint32_t(bits >> count) & mask;
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// ntoh and reverse_bytes over arrays.
+  //***************************************************************************
+  void etl_ntoh16()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      decoded16[i] = etl::ntoh(values16[i]);
+    }
+
+    consume(decoded16[N_Values - 1U]);
+  }
+
+  void etl_ntoh32()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      decoded32[i] = etl::ntoh(values32[i]);
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  void etl_ntoh64()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      decoded64[i] = etl::ntoh(values64[i]);
+    }
+
+    consume(size_t(decoded64[N_Values - 1U]));
+  }
+
+  void etl_reverse_bytes32()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      decoded32[i] = etl::reverse_bytes(values32[i]);
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// The array forms of reverse_bytes and ntoh.
+  //***************************************************************************
+  void etl_reverse_bytes16_array()
+  {
+    etl::reverse_bytes(values16, N_Values, decoded16);
+    consume(decoded16[N_Values - 1U]);
+  }
+
+  void etl_reverse_bytes32_array()
+  {
+    etl::reverse_bytes(values32, N_Values, decoded32);
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  void etl_reverse_bytes64_array()
+  {
+    etl::reverse_bytes(values64, N_Values, decoded64);
+    consume(size_t(decoded64[N_Values - 1U]));
+  }
+
+  void etl_ntoh_range32()
+  {
+    etl::ntoh_range(values32, N_Values, decoded32);
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// Hand-written big endian loads, a byte at a time.
+  //***************************************************************************
+  void baseline_load_be32()
+  {
+    const uint8_t* p = random_bytes;
+
+    for (size_t i = 0U; i < N_Values; ++i, p += 4U)
+    {
+      decoded32[i] = (uint32_t(p[0]) << 24U) | (uint32_t(p[1]) << 16U) | (uint32_t(p[2]) << 8U) | uint32_t(p[3]);
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// byte_stream, one value at a time and in batches.
+  //***************************************************************************
+  void etl_byte_stream_write()
+  {
+    etl::byte_stream_writer writer(encoded, sizeof(encoded), etl::endian::big);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      writer.write_unchecked(values32[i]);
+    }
+
+    consume(encoded[0]);
+  }
+
+  void etl_byte_stream_write_batch()
+  {
+    etl::byte_stream_writer writer(encoded, sizeof(encoded), etl::endian::big);
+
+    writer.write(values32, N_Values);
+
+    consume(encoded[0]);
+  }
+
+  void etl_byte_stream_read()
+  {
+    etl::byte_stream_reader reader(random_bytes, N_Values * 8U, etl::endian::big);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      decoded32[i] = reader.read_unchecked<uint32_t>();
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  void etl_byte_stream_read_batch()
+  {
+    etl::byte_stream_reader reader(random_bytes, N_Values * 8U, etl::endian::big);
+
+    reader.read(decoded32, N_Values);
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// Hand-written big endian stores, a byte at a time.
+  //***************************************************************************
+  void baseline_store_be32()
+  {
+    uint8_t* p = encoded;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      const uint32_t value = values32[i];
+
+      *p++ = uint8_t(value >> 24U);
+      *p++ = uint8_t(value >> 16U);
+      *p++ = uint8_t(value >> 8U);
+      *p++ = uint8_t(value);
+    }
+
+    consume(encoded[0]);
+  }
+
+  //***************************************************************************
+  /// varint.
+  //***************************************************************************
+  void etl_varint_encode()
+  {
+    consume(etl::varint_encode(varint_values, N_Values, encoded, sizeof(encoded)));
+  }
+
+  void etl_varint_decode()
+  {
+    consume(etl::varint_decode(varint_encoded, varint_size, decoded32, N_Values));
+  }
+
+  //***************************************************************************
+  /// Hand-written LEB128.
+  //***************************************************************************
+  void baseline_leb128_encode()
+  {
+    uint8_t* p = encoded;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      uint32_t value = varint_values[i];
+
+      while (value >= 0x80U)
+      {
+        *p++    = uint8_t(value | 0x80U);
+        value >>= 7U;
+      }
+
+      *p++ = uint8_t(value);
+    }
+
+    consume(size_t(p - encoded));
+  }
+
+  void baseline_leb128_decode()
+  {
+    const uint8_t* p = varint_encoded;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      uint32_t value = 0U;
+      uint32_t shift = 0U;
+      uint8_t  b;
+
+      do
+      {
+        b      = *p++;
+        value |= uint32_t(b & 0x7FU) << shift;
+        shift += 7U;
+      } while ((b & 0x80U) != 0U);
+
+      decoded32[i] = value;
+    }
+
+    consume(decoded32[N_Values - 1U]);
+  }
+
+  //***************************************************************************
+  /// COBS and SLIP framing.
+  //***************************************************************************
+  void etl_cobs_encode()
+  {
+    consume(etl::cobs_encode(etl::span<const uint8_t>(frame, sizeof(frame)), etl::span<uint8_t>(encoded, sizeof(encoded))));
+  }
+
+  void etl_cobs_decode()
+  {
+    etl::cobs_decoder decoder(etl::span<uint8_t>(encoded, sizeof(encoded)));
+
+    decoder.decode(etl::span<const uint8_t>(cobs_encoded, cobs_size));
+
+    consume(decoder.frame().size());
+  }
+
+  void etl_slip_encode()
+  {
+    consume(etl::slip_encode(etl::span<const uint8_t>(frame, sizeof(frame)), etl::span<uint8_t>(encoded, sizeof(encoded))));
+  }
+
+  void etl_slip_decode()
+  {
+    etl::slip_decoder decoder(etl::span<uint8_t>(encoded, sizeof(encoded)));
+
+    decoder.decode(etl::span<const uint8_t>(slip_encoded, slip_size));
+
+    consume(decoder.frame().size());
+  }
+
+  //***************************************************************************
+  /// Hand-written byte at a time COBS encoder.
+  //***************************************************************************
+  void baseline_cobs_encode()
+  {
+    uint8_t* code_pointer = encoded;
+    uint8_t* p            = encoded + 1;
+    uint8_t  code         = 1U;
+
+    for (size_t i = 0U; i < sizeof(frame); ++i)
+    {
+      if (frame[i] == 0U)
+      {
+        *code_pointer = code;
+        code_pointer  = p++;
+        code          = 1U;
+      }
+      else
+      {
+        *p++ = frame[i];
+
+        if (++code == 0xFFU)
+        {
+          *code_pointer = code;
+          code_pointer  = p++;
+          code          = 1U;
+        }
+      }
+    }
+
+    *code_pointer = code;
+    *p++          = 0U;
+
+    consume(size_t(p - encoded));
+  }
+
+  struct benchmark_t
+  {
+    const char* name;
+    size_t      bytes;
+    function_t  etl_function;
+    const char* baseline_name;
+    function_t  baseline_function;
+  };
+
+  //***************************************************************************
+  /// Every benchmark that is measured.
+  /// The bit stream sizes are those of the packed fields.
+  //***************************************************************************
+#define ETL_BIT_BENCHMARKS(width) \
+    { "bit_stream put " #width " bits",         (N_Values * width) / 8U, &etl_bit_stream_put<width>,   "shift and mask", &baseline_pack<width> },   \
+    { "bit_stream get " #width " bits",         (N_Values * width) / 8U, &etl_bit_stream_get<width>,   "shift and mask", &baseline_unpack<width> }, \
+    { "bit_stream_writer " #width " bits",      (N_Values * width) / 8U, &etl_bit_stream_write<width>, "shift and mask", &baseline_pack<width> },   \
+    { "bit_stream_reader " #width " bits",      (N_Values * width) / 8U, &etl_bit_stream_read<width>,  "shift and mask", &baseline_unpack<width> }
+
+  const benchmark_t benchmarks[] =
+  {
+    ETL_BIT_BENCHMARKS(1),
+    ETL_BIT_BENCHMARKS(5),
+    ETL_BIT_BENCHMARKS(12),
+    ETL_BIT_BENCHMARKS(32),
+    { "bit_stream_writer 32 bits",      N_Values * 4U,  &etl_bit_stream_write<32>,     "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "ntoh uint16_t",                  N_Values * 2U,  &etl_ntoh16,                   "memcpy",         &baseline_memcpy<N_Values * 2U> },
+    { "ntoh uint32_t",                  N_Values * 4U,  &etl_ntoh32,                   "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "ntoh uint32_t",                  N_Values * 4U,  &etl_ntoh32,                   "byte loads",     &baseline_load_be32 },
+    { "ntoh uint64_t",                  N_Values * 8U,  &etl_ntoh64,                   "memcpy",         &baseline_memcpy<N_Values * 8U> },
+    { "reverse_bytes uint32_t",         N_Values * 4U,  &etl_reverse_bytes32,          "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "reverse_bytes uint16_t[]",       N_Values * 2U,  &etl_reverse_bytes16_array,    "ntoh loop",      &etl_ntoh16 },
+    { "reverse_bytes uint32_t[]",       N_Values * 4U,  &etl_reverse_bytes32_array,    "ntoh loop",      &etl_ntoh32 },
+    { "reverse_bytes uint64_t[]",       N_Values * 8U,  &etl_reverse_bytes64_array,    "ntoh loop",      &etl_ntoh64 },
+    { "reverse_bytes uint32_t[]",       N_Values * 4U,  &etl_reverse_bytes32_array,    "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "ntoh_range uint32_t",            N_Values * 4U,  &etl_ntoh_range32,             "ntoh loop",      &etl_ntoh32 },
+    { "byte_stream write uint32_t",     N_Values * 4U,  &etl_byte_stream_write,        "byte stores",    &baseline_store_be32 },
+    { "byte_stream write uint32_t[]",   N_Values * 4U,  &etl_byte_stream_write_batch,  "byte stores",    &baseline_store_be32 },
+    { "byte_stream write uint32_t[]",   N_Values * 4U,  &etl_byte_stream_write_batch,  "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "byte_stream read uint32_t",      N_Values * 4U,  &etl_byte_stream_read,         "byte loads",     &baseline_load_be32 },
+    { "byte_stream read uint32_t[]",    N_Values * 4U,  &etl_byte_stream_read_batch,   "byte loads",     &baseline_load_be32 },
+    { "varint encode uint32_t",         N_Values * 4U,  &etl_varint_encode,            "LEB128 loop",    &baseline_leb128_encode },
+    { "varint decode uint32_t",         N_Values * 4U,  &etl_varint_decode,            "LEB128 loop",    &baseline_leb128_decode },
+    { "varint encode uint32_t",         N_Values * 4U,  &etl_varint_encode,            "memcpy",         &baseline_memcpy<N_Values * 4U> },
+    { "cobs encode 4KB",                sizeof(frame),  &etl_cobs_encode,              "byte loop",      &baseline_cobs_encode },
+    { "cobs encode 4KB",                sizeof(frame),  &etl_cobs_encode,              "memcpy",         &baseline_memcpy<sizeof(frame)> },
+    { "cobs decode 4KB",                sizeof(frame),  &etl_cobs_decode,              "memcpy",         &baseline_memcpy<sizeof(frame)> },
+    { "slip encode 4KB",                sizeof(frame),  &etl_slip_encode,              "memcpy",         &baseline_memcpy<sizeof(frame)> },
+    { "slip decode 4KB",                sizeof(frame),  &etl_slip_decode,              "memcpy",         &baseline_memcpy<sizeof(frame)> }
+  };
+
+#undef ETL_BIT_BENCHMARKS
+
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  benchmark::options_t options;
+
+  if (!benchmark::parse_options(argc, argv, options))
+  {
+    return 0;
+  }
+
+  make_data();
+
+  if (options.csv)
+  {
+    std::printf("benchmark,etl MB/s,baseline,baseline MB/s,etl/baseline\n");
+  }
+  else
+  {
+    std::printf("%-32s %10s   %-16s %10s %12s\n", "Benchmark", "etl MB/s", "Baseline", "MB/s", "etl/baseline");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!options.matches(benchmark.name))
+    {
+      continue;
+    }
+
+    const double etl_mbs      = double(benchmark.bytes) / (benchmark::measure(benchmark.etl_function, options.min_time) * 1.0e6);
+    const double baseline_mbs = double(benchmark.bytes) / (benchmark::measure(benchmark.baseline_function, options.min_time) * 1.0e6);
+
+    if (options.csv)
+    {
+      std::printf("%s,%.1f,%s,%.1f,%.2f\n", benchmark.name, etl_mbs, benchmark.baseline_name, baseline_mbs, etl_mbs / baseline_mbs);
+    }
+    else
+    {
+      std::printf("%-32s %10.1f   %-16s %10.1f %12.2f\n", benchmark.name, etl_mbs, benchmark.baseline_name, baseline_mbs, etl_mbs / baseline_mbs);
+    }
+  }
+
+  return 0;
+}
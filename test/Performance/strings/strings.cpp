@@ -0,0 +1,669 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Micro-benchmarks for the string and formatting classes, each compared with
+// its std equivalent.
+//
+// Usage: etl_strings [--time-ms N] [--csv] [filter...]
+// The options are described in ../benchmark.h.
+//
+// Each benchmark works through a fixed set of pseudo random values or words,
+// so that branch prediction does not see a trivial pattern. Results are the
+// fastest of several repeated measurements, in nanoseconds per operation.
+// The ratio is std time / etl time; above 1 means that etl is faster.
+//
+// The string configuration that the benchmark was built with is printed
+// first. Build with -DETL_STRING_NO_SIMD, -DETL_DISABLE_STRING_TRUNCATION_CHECKS
+// or -DETL_DISABLE_STRING_CLEAR_AFTER_USE to compare configurations.
+//*****************************************************************************
+
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/string_stream.h"
+#include "etl/string_utilities.h"
+#include "etl/to_string.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../benchmark.h"
+
+namespace
+{
+  using benchmark::consume;
+  using benchmark::function_t;
+
+  //***************************************************************************
+  /// The test data.
+  //***************************************************************************
+  const size_t N_Values = 256U;
+  const size_t N_Words  = 64U;
+
+  int32_t  ints[N_Values];
+  uint32_t uints[N_Values];
+  double   doubles[N_Values];
+
+  // About 2KB of text ending with the search target, the same in each form.
+  std::string       std_text;
+  etl::string<4096> etl_text;
+  const char        needle[]    = "zebra crossing";
+  const size_t      needle_size = sizeof(needle) - 1U;
+
+  // Words with leading and trailing whitespace, and a comma separated list.
+  std::vector<std::string>     std_padded;
+  std::vector<etl::string<32>> etl_padded;
+  std::string                  std_csv;
+  etl::string<1024>            etl_csv;
+
+  const char* const dictionary[] =
+  {
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+    "india", "juliet", "kilo", "lima", "mike", "november", "oscar", "papa",
+    "quebec", "romeo", "sierra", "tango", "uniform", "victor", "whiskey", "xray"
+  };
+
+  const char* const whitespace[] = { "", " ", "  ", "\t", " \t ", "\n" };
+
+  uint32_t state = 0x12345678UL;
+
+  uint32_t random()
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    return state;
+  }
+
+  //***************************************************************************
+  void make_data()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      // Spread the magnitudes, so that all lengths are represented.
+      const uint32_t shift = random() % 32U;
+
+      uints[i]   = random() >> shift;
+      ints[i]    = (random() & 1U) ? int32_t(uints[i] >> 1) : -int32_t(uints[i] >> 1);
+      doubles[i] = double(int32_t(random())) / double(1U << (random() % 24U));
+    }
+
+    while (std_text.size() < 2000U)
+    {
+      std_text += dictionary[random() % ETL_ARRAY_SIZE(dictionary)];
+      std_text += ' ';
+    }
+
+    std_text += needle;
+    etl_text.assign(std_text.data(), std_text.size());
+
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      std::string word = whitespace[random() % ETL_ARRAY_SIZE(whitespace)];
+      word += dictionary[random() % ETL_ARRAY_SIZE(dictionary)];
+      word += whitespace[random() % ETL_ARRAY_SIZE(whitespace)];
+
+      std_padded.push_back(word);
+      etl_padded.push_back(etl::string<32>(word.data(), word.size()));
+
+      if (i != 0U)
+      {
+        std_csv += ',';
+      }
+
+      std_csv += dictionary[random() % ETL_ARRAY_SIZE(dictionary)];
+    }
+
+    etl_csv.assign(std_csv.data(), std_csv.size());
+  }
+
+  //***************************************************************************
+  /// to_string
+  //***************************************************************************
+  void etl_to_string_int()
+  {
+    etl::string<32> s;
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      etl::to_string(ints[i], s);
+      consume(s.size());
+    }
+  }
+
+  void std_to_chars_int()
+  {
+    char s[32];
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      consume(size_t(std::to_chars(s, s + sizeof(s), ints[i]).ptr - s));
+    }
+  }
+
+  void std_to_string_int()
+  {
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      consume(std::to_string(ints[i]).size());
+    }
+  }
+
+  template <uint32_t Base>
+  void etl_to_string_base()
+  {
+    etl::string<40> s;
+    etl::format_spec format;
+    format.base(Base);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      etl::to_string(uints[i], s, format);
+      consume(s.size());
+    }
+  }
+
+  template <int Base>
+  void std_to_chars_base()
+  {
+    char s[40];
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      consume(size_t(std::to_chars(s, s + sizeof(s), uints[i], Base).ptr - s));
+    }
+  }
+
+  void etl_to_string_fixed()
+  {
+    etl::string<64> s;
+    etl::format_spec format;
+    format.precision(6U);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      etl::to_string(doubles[i], s, format);
+      consume(s.size());
+    }
+  }
+
+  void std_fixed()
+  {
+    char s[64];
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+#if defined(__cpp_lib_to_chars)
+      consume(size_t(std::to_chars(s, s + sizeof(s), doubles[i], std::chars_format::fixed, 6).ptr - s));
+#else
+      consume(size_t(std::snprintf(s, sizeof(s), "%.6f", doubles[i])));
+#endif
+    }
+  }
+
+  void etl_to_string_shortest()
+  {
+    etl::string<64> s;
+    etl::format_spec format;
+    format.shortest(true);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      etl::to_string(doubles[i], s, format);
+      consume(s.size());
+    }
+  }
+
+  void std_shortest()
+  {
+    char s[64];
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+#if defined(__cpp_lib_to_chars)
+      consume(size_t(std::to_chars(s, s + sizeof(s), doubles[i]).ptr - s));
+#else
+      consume(size_t(std::snprintf(s, sizeof(s), "%.17g", doubles[i])));
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// string_stream
+  //***************************************************************************
+  void etl_string_stream()
+  {
+    etl::string<128> s;
+    etl::string_stream ss(s);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      s.clear();
+      ss << etl::dec << "id=" << ints[i] << " flags=" << etl::hex << uints[i]
+         << " value=" << etl::dec << etl::setprecision(3) << doubles[i] << " name=" << dictionary[i % ETL_ARRAY_SIZE(dictionary)];
+      consume(s.size());
+    }
+  }
+
+  void std_ostringstream()
+  {
+    std::ostringstream ss;
+    ss.setf(std::ios::fixed, std::ios::floatfield);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      ss.str(std::string());
+      ss << std::dec << "id=" << ints[i] << " flags=" << std::hex << uints[i]
+         << " value=" << std::dec << std::setprecision(3) << doubles[i] << " name=" << dictionary[i % ETL_ARRAY_SIZE(dictionary)];
+      consume(ss.str().size());
+    }
+  }
+
+  //***************************************************************************
+  /// ibasic_string
+  //***************************************************************************
+  void etl_string_find()
+  {
+    consume(etl_text.find(needle));
+  }
+
+  void std_string_find()
+  {
+    consume(std_text.find(needle));
+  }
+
+  void etl_string_find_char()
+  {
+    consume(etl_text.find('z'));
+  }
+
+  void std_string_find_char()
+  {
+    consume(std_text.find('z'));
+  }
+
+  void etl_string_rfind()
+  {
+    consume(etl_text.rfind("alpha"));
+  }
+
+  void std_string_rfind()
+  {
+    consume(std_text.rfind("alpha"));
+  }
+
+  void etl_string_find_first_of()
+  {
+    consume(etl_text.find_first_of("zZ!?"));
+  }
+
+  void std_string_find_first_of()
+  {
+    consume(std_text.find_first_of("zZ!?"));
+  }
+
+  void etl_string_compare()
+  {
+    static const etl::string<4096> other(etl_text);
+
+    consume(size_t(etl_text.compare(other)));
+  }
+
+  void std_string_compare()
+  {
+    static const std::string other(std_text);
+
+    consume(size_t(std_text.compare(other)));
+  }
+
+  void etl_string_append()
+  {
+    etl::string<1024> s;
+
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      s.append(dictionary[i % ETL_ARRAY_SIZE(dictionary)]);
+      s.append(1U, ' ');
+    }
+
+    consume(s.size());
+  }
+
+  void std_string_append()
+  {
+    std::string s;
+
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      s.append(dictionary[i % ETL_ARRAY_SIZE(dictionary)]);
+      s.append(1U, ' ');
+    }
+
+    consume(s.size());
+  }
+
+  void std_string_append_reserved()
+  {
+    std::string s;
+    s.reserve(1024U);
+
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      s.append(dictionary[i % ETL_ARRAY_SIZE(dictionary)]);
+      s.append(1U, ' ');
+    }
+
+    consume(s.size());
+  }
+
+  //***************************************************************************
+  /// string_utilities
+  //***************************************************************************
+  void etl_trim_whitespace()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      etl::string<32> s(etl_padded[i]);
+      etl::trim_whitespace(s);
+      consume(s.size());
+    }
+  }
+
+  void std_trim_whitespace()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      std::string s(std_padded[i]);
+      s.erase(s.find_last_not_of(" \t\n\v\f\r") + 1U);
+      s.erase(0U, s.find_first_not_of(" \t\n\v\f\r"));
+      consume(s.size());
+    }
+  }
+
+  void etl_trim_view_whitespace()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      etl::string_view view(etl_padded[i]);
+      consume(etl::trim_view_whitespace(view).size());
+    }
+  }
+
+  void std_trim_view_whitespace()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      std::string_view view(std_padded[i]);
+      const size_t first = view.find_first_not_of(" \t\n\v\f\r");
+
+      if (first != std::string_view::npos)
+      {
+        view = view.substr(first, view.find_last_not_of(" \t\n\v\f\r") + 1U - first);
+      }
+      else
+      {
+        view = std::string_view();
+      }
+
+      consume(view.size());
+    }
+  }
+
+  void etl_get_token()
+  {
+    etl::optional<etl::string_view> token;
+
+    while ((token = etl::get_token(etl_csv, ",", token, true)))
+    {
+      consume(token.value().size());
+    }
+  }
+
+  void etl_split_view()
+  {
+    etl::split_view<etl::string_view> tokens(etl::string_view(etl_csv), ",");
+
+    for (etl::split_view<etl::string_view>::const_iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+    {
+      consume((*itr).size());
+    }
+  }
+
+  void std_tokenize()
+  {
+    std::string_view text(std_csv);
+    size_t position = 0U;
+
+    while (position < text.size())
+    {
+      size_t end = text.find_first_of(',', position);
+
+      if (end == std::string_view::npos)
+      {
+        end = text.size();
+      }
+
+      if (end != position)
+      {
+        consume(end - position);
+      }
+
+      position = end + 1U;
+    }
+  }
+
+  //***************************************************************************
+  /// string_view
+  //***************************************************************************
+  void etl_view_find()
+  {
+    consume(etl::string_view(etl_text).find(etl::string_view(needle, needle_size)));
+  }
+
+  void std_view_find()
+  {
+    consume(std::string_view(std_text).find(std::string_view(needle, needle_size)));
+  }
+
+  void etl_view_find_first_of()
+  {
+    consume(etl::string_view(etl_text).find_first_of(etl::string_view("zZ!?")));
+  }
+
+  void std_view_find_first_of()
+  {
+    consume(std::string_view(std_text).find_first_of(std::string_view("zZ!?")));
+  }
+
+  void etl_view_compare()
+  {
+    static const etl::string<4096> other(etl_text);
+
+    consume(size_t(etl::string_view(etl_text).compare(etl::string_view(other))));
+  }
+
+  void std_view_compare()
+  {
+    static const std::string other(std_text);
+
+    consume(size_t(std::string_view(std_text).compare(std::string_view(other))));
+  }
+
+  void etl_view_starts_ends_with()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      const etl::string_view view(etl_padded[i]);
+      consume(view.starts_with(etl::string_view("  ")) + view.ends_with('o'));
+    }
+  }
+
+  void std_view_starts_ends_with()
+  {
+    for (size_t i = 0U; i < N_Words; ++i)
+    {
+      const std::string_view view(std_padded[i]);
+      const bool starts = (view.size() >= 2U) && (view.compare(0U, 2U, "  ") == 0);
+      const bool ends   = !view.empty() && (view.back() == 'o');
+      consume(starts + ends);
+    }
+  }
+
+  void etl_view_substr()
+  {
+    const etl::string_view view(etl_text);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      consume(view.substr(i * 7U, 16U).size());
+    }
+  }
+
+  void std_view_substr()
+  {
+    const std::string_view view(std_text);
+
+    for (size_t i = 0U; i < N_Values; ++i)
+    {
+      consume(view.substr(i * 7U, 16U).size());
+    }
+  }
+
+  struct benchmark_t
+  {
+    const char* name;
+    size_t      operations;
+    function_t  etl_function;
+    const char* std_name;
+    function_t  std_function;
+  };
+
+  //***************************************************************************
+  /// Every benchmark that is measured.
+  //***************************************************************************
+  const benchmark_t benchmarks[] =
+  {
+    { "to_string int32",             N_Values, &etl_to_string_int,        "std::to_chars",     &std_to_chars_int },
+    { "to_string int32",             N_Values, &etl_to_string_int,        "std::to_string",    &std_to_string_int },
+    { "to_string uint32 base 2",     N_Values, &etl_to_string_base<2U>,   "std::to_chars",     &std_to_chars_base<2> },
+    { "to_string uint32 base 8",     N_Values, &etl_to_string_base<8U>,   "std::to_chars",     &std_to_chars_base<8> },
+    { "to_string uint32 base 10",    N_Values, &etl_to_string_base<10U>,  "std::to_chars",     &std_to_chars_base<10> },
+    { "to_string uint32 base 16",    N_Values, &etl_to_string_base<16U>,  "std::to_chars",     &std_to_chars_base<16> },
+#if defined(__cpp_lib_to_chars)
+    { "to_string double fixed 6",    N_Values, &etl_to_string_fixed,      "std::to_chars",     &std_fixed },
+    { "to_string double shortest",   N_Values, &etl_to_string_shortest,   "std::to_chars",     &std_shortest },
+#else
+    { "to_string double fixed 6",    N_Values, &etl_to_string_fixed,      "snprintf %.6f",     &std_fixed },
+    { "to_string double shortest",   N_Values, &etl_to_string_shortest,   "snprintf %.17g",    &std_shortest },
+#endif
+    { "string_stream 4 fields",      N_Values, &etl_string_stream,        "std::ostringstream", &std_ostringstream },
+    { "string find 2KB",             1U,       &etl_string_find,          "std::string",       &std_string_find },
+    { "string find char 2KB",        1U,       &etl_string_find_char,     "std::string",       &std_string_find_char },
+    { "string rfind 2KB",            1U,       &etl_string_rfind,         "std::string",       &std_string_rfind },
+    { "string find_first_of 2KB",    1U,       &etl_string_find_first_of, "std::string",       &std_string_find_first_of },
+    { "string compare 2KB",          1U,       &etl_string_compare,       "std::string",       &std_string_compare },
+    { "string append words",         N_Words,  &etl_string_append,        "std::string",       &std_string_append },
+    { "string append words",         N_Words,  &etl_string_append,        "std::string+reserve", &std_string_append_reserved },
+    { "trim_whitespace",             N_Words,  &etl_trim_whitespace,      "std::string",       &std_trim_whitespace },
+    { "trim_view_whitespace",        N_Words,  &etl_trim_view_whitespace, "std::string_view",  &std_trim_view_whitespace },
+    { "get_token csv",               N_Words,  &etl_get_token,            "std::string_view",  &std_tokenize },
+    { "split_view csv",              N_Words,  &etl_split_view,           "std::string_view",  &std_tokenize },
+    { "string_view find 2KB",        1U,       &etl_view_find,            "std::string_view",  &std_view_find },
+    { "string_view find_first_of 2KB", 1U,     &etl_view_find_first_of,   "std::string_view",  &std_view_find_first_of },
+    { "string_view compare 2KB",     1U,       &etl_view_compare,         "std::string_view",  &std_view_compare },
+    { "string_view starts/ends_with", N_Words, &etl_view_starts_ends_with, "std::string_view", &std_view_starts_ends_with },
+    { "string_view substr",          N_Values, &etl_view_substr,          "std::string_view",  &std_view_substr }
+  };
+
+
+  //***************************************************************************
+  /// Prints the options that change the speed of the string classes.
+  //***************************************************************************
+  void print_configuration()
+  {
+    std::printf("SIMD kernels:            %s\n", ETL_STRING_SIMD_SSE2 ? "SSE2" : (ETL_STRING_SIMD_NEON ? "NEON" : "none"));
+    std::printf("Truncation checks:       %s\n", ETL_STRING_TRUNCATION_CHECKS_ENABLED ? "enabled" : "disabled");
+    std::printf("Clear after use:         %s\n", ETL_STRING_CLEAR_AFTER_USE_ENABLED ? "enabled" : "disabled");
+#if defined(__cpp_lib_to_chars)
+    std::printf("Floating point to_chars: yes\n\n");
+#else
+    std::printf("Floating point to_chars: no, using snprintf\n\n");
+#endif
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  benchmark::options_t options;
+
+  if (!benchmark::parse_options(argc, argv, options))
+  {
+    return 0;
+  }
+
+  make_data();
+
+  if (options.csv)
+  {
+    std::printf("benchmark,etl ns/op,std,std ns/op,std/etl\n");
+  }
+  else
+  {
+    print_configuration();
+    std::printf("%-32s %10s   %-20s %10s %8s\n", "Benchmark", "etl ns/op", "std", "ns/op", "std/etl");
+  }
+
+  for (size_t i = 0U; i < ETL_ARRAY_SIZE(benchmarks); ++i)
+  {
+    const benchmark_t& benchmark = benchmarks[i];
+
+    if (!options.matches(benchmark.name))
+    {
+      continue;
+    }
+
+    const double etl_ns = benchmark::measure(benchmark.etl_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+    const double std_ns = benchmark::measure(benchmark.std_function, options.min_time) * 1.0e9 / double(benchmark.operations);
+
+    if (options.csv)
+    {
+      std::printf("%s,%.2f,%s,%.2f,%.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+    else
+    {
+      std::printf("%-32s %10.2f   %-20s %10.2f %8.2f\n", benchmark.name, etl_ns, benchmark.std_name, std_ns, std_ns / etl_ns);
+    }
+  }
+
+  return 0;
+}
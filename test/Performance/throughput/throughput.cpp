@@ -0,0 +1,467 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput benchmark for the CRC, hash and checksum classes.
+//
+// Usage: etl_throughput [options] [filter...]
+//   --min-size N   Smallest buffer size in bytes (default 16).
+//   --max-size N   Largest buffer size in bytes (default 16M).
+//   --time-ms N    Minimum measurement time per result (default 50).
+//   --mhz N        Clock frequency used to derive cycles/byte when there is
+//                  no cycle counter.
+//   --csv          Output comma separated values.
+//   filter         Only run algorithms whose name contains one of the filters.
+//
+// Sizes are stepped by a factor of 4. Each result is the fastest of several
+// repeated measurements.
+//*****************************************************************************
+
+#include "etl/crc.h"
+#include "etl/fnv_1.h"
+#include "etl/jenkins.h"
+#include "etl/murmur3.h"
+#include "etl/xxhash.h"
+#include "etl/pearson.h"
+#include "etl/checksum.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define ETL_BENCHMARK_HAS_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+  #include <intrin.h>
+  #define ETL_BENCHMARK_HAS_TSC 1
+#else
+  #define ETL_BENCHMARK_HAS_TSC 0
+#endif
+
+namespace
+{
+  //***************************************************************************
+  /// Prevents the compiler discarding the results.
+  //***************************************************************************
+  volatile uint64_t sink;
+
+  template <typename T>
+  void consume(const T& value)
+  {
+    sink = sink ^ uint64_t(value);
+  }
+
+  template <size_t Length>
+  void consume(const etl::array<uint8_t, Length>& value)
+  {
+    sink = sink ^ value[0];
+  }
+
+  //***************************************************************************
+  /// Calculates the value of one buffer.
+  //***************************************************************************
+  template <typename TAlgorithm>
+  void calculate(const uint8_t* data, size_t length)
+  {
+    TAlgorithm algorithm;
+    algorithm.add(data, data + length);
+    consume(algorithm.value());
+  }
+
+  typedef void (*function_t)(const uint8_t*, size_t);
+
+  struct algorithm_t
+  {
+    const char* name;
+    function_t  function;
+  };
+
+  //***************************************************************************
+  /// Every algorithm that is measured.
+  //***************************************************************************
+#define ETL_BENCHMARK(name)     { #name, &calculate<etl::name> }
+
+#define ETL_BENCHMARK_CRC(name) ETL_BENCHMARK(name##_t4),    \
+                                ETL_BENCHMARK(name##_t16),   \
+                                ETL_BENCHMARK(name##_t256),  \
+                                ETL_BENCHMARK(name##_t2048), \
+                                ETL_BENCHMARK(name##_t4096)
+
+  const algorithm_t algorithms[] =
+  {
+    ETL_BENCHMARK_CRC(crc8_ccitt),
+    ETL_BENCHMARK_CRC(crc8_cdma2000),
+    ETL_BENCHMARK_CRC(crc8_darc),
+    ETL_BENCHMARK_CRC(crc8_dvbs2),
+    ETL_BENCHMARK_CRC(crc8_ebu),
+    ETL_BENCHMARK_CRC(crc8_icode),
+    ETL_BENCHMARK_CRC(crc8_itu),
+    ETL_BENCHMARK_CRC(crc8_maxim),
+    ETL_BENCHMARK_CRC(crc8_rohc),
+    ETL_BENCHMARK_CRC(crc8_wcdma),
+    ETL_BENCHMARK_CRC(crc16),
+    ETL_BENCHMARK_CRC(crc16_a),
+    ETL_BENCHMARK_CRC(crc16_arc),
+    ETL_BENCHMARK_CRC(crc16_aug_ccitt),
+    ETL_BENCHMARK_CRC(crc16_buypass),
+    ETL_BENCHMARK_CRC(crc16_ccitt),
+    ETL_BENCHMARK_CRC(crc16_cdma2000),
+    ETL_BENCHMARK_CRC(crc16_dds110),
+    ETL_BENCHMARK_CRC(crc16_dect_r),
+    ETL_BENCHMARK_CRC(crc16_dect_x),
+    ETL_BENCHMARK_CRC(crc16_dnp),
+    ETL_BENCHMARK_CRC(crc16_en13757),
+    ETL_BENCHMARK_CRC(crc16_genibus),
+    ETL_BENCHMARK_CRC(crc16_kermit),
+    ETL_BENCHMARK_CRC(crc16_maxim),
+    ETL_BENCHMARK_CRC(crc16_mcrf4xx),
+    ETL_BENCHMARK_CRC(crc16_modbus),
+    ETL_BENCHMARK_CRC(crc16_profibus),
+    ETL_BENCHMARK_CRC(crc16_riello),
+    ETL_BENCHMARK_CRC(crc16_t10dif),
+    ETL_BENCHMARK_CRC(crc16_teledisk),
+    ETL_BENCHMARK_CRC(crc16_tms37157),
+    ETL_BENCHMARK_CRC(crc16_usb),
+    ETL_BENCHMARK_CRC(crc16_x25),
+    ETL_BENCHMARK_CRC(crc16_xmodem),
+    ETL_BENCHMARK_CRC(crc32),
+    ETL_BENCHMARK_CRC(crc32_bzip2),
+    ETL_BENCHMARK_CRC(crc32_c),
+    ETL_BENCHMARK_CRC(crc32_d),
+    ETL_BENCHMARK_CRC(crc32_jamcrc),
+    ETL_BENCHMARK_CRC(crc32_mpeg2),
+    ETL_BENCHMARK_CRC(crc32_posix),
+    ETL_BENCHMARK_CRC(crc32_q),
+    ETL_BENCHMARK_CRC(crc32_xfer),
+#if ETL_USING_64BIT_TYPES
+    ETL_BENCHMARK_CRC(crc64_ecma),
+#endif
+#if ETL_CRC32_HARDWARE_SUPPORTED
+    ETL_BENCHMARK(crc32_hardware),
+#endif
+#if ETL_CRC32_C_HARDWARE_SUPPORTED
+    ETL_BENCHMARK(crc32_c_hardware),
+#endif
+    ETL_BENCHMARK(fnv_1_32),
+    ETL_BENCHMARK(fnv_1a_32),
+#if ETL_USING_64BIT_TYPES
+    ETL_BENCHMARK(fnv_1_64),
+    ETL_BENCHMARK(fnv_1a_64),
+#endif
+    ETL_BENCHMARK(jenkins),
+    { "murmur3<uint32_t>", &calculate<etl::murmur3<uint32_t> > },
+    ETL_BENCHMARK(xxhash32),
+#if ETL_USING_64BIT_TYPES
+    ETL_BENCHMARK(xxhash64),
+#endif
+    { "pearson<4>", &calculate<etl::pearson<4> > },
+    { "checksum<uint8_t>",            &calculate<etl::checksum<uint8_t> > },
+    { "checksum<uint32_t>",           &calculate<etl::checksum<uint32_t> > },
+    { "bsd_checksum<uint8_t>",        &calculate<etl::bsd_checksum<uint8_t> > },
+    { "bsd_checksum<uint16_t>",       &calculate<etl::bsd_checksum<uint16_t> > },
+    { "xor_checksum<uint8_t>",        &calculate<etl::xor_checksum<uint8_t> > },
+    { "xor_rotate_checksum<uint8_t>", &calculate<etl::xor_rotate_checksum<uint8_t> > },
+    { "parity_checksum<uint8_t>",     &calculate<etl::parity_checksum<uint8_t> > },
+    ETL_BENCHMARK(fletcher16),
+    ETL_BENCHMARK(adler32)
+  };
+
+#undef ETL_BENCHMARK_CRC
+#undef ETL_BENCHMARK
+
+  //***************************************************************************
+  /// Timing.
+  //***************************************************************************
+  typedef std::chrono::steady_clock clock_type;
+
+  uint64_t read_cycles()
+  {
+#if ETL_BENCHMARK_HAS_TSC
+    return uint64_t(__rdtsc());
+#else
+    return 0U;
+#endif
+  }
+
+  struct result_t
+  {
+    double seconds;
+    double cycles;
+  };
+
+  //***************************************************************************
+  /// Returns the fastest time and cycle count for one call.
+  /// The number of calls per measurement is doubled until the measurement
+  /// takes long enough to trust the clock.
+  //***************************************************************************
+  result_t measure(function_t function, const uint8_t* data, size_t length, double minimum_seconds)
+  {
+    const int Repeats = 5;
+
+    // Warm up the caches and the branch predictors.
+    function(data, length);
+
+    size_t calls = 1U;
+
+    for (;;)
+    {
+      clock_type::time_point start = clock_type::now();
+
+      for (size_t i = 0U; i < calls; ++i)
+      {
+        function(data, length);
+      }
+
+      double seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+
+      if ((seconds * Repeats) >= minimum_seconds)
+      {
+        break;
+      }
+
+      calls *= 2U;
+    }
+
+    result_t best = { 1.0e30, 1.0e30 };
+
+    for (int r = 0; r < Repeats; ++r)
+    {
+      clock_type::time_point start  = clock_type::now();
+      uint64_t               cycles = read_cycles();
+
+      for (size_t i = 0U; i < calls; ++i)
+      {
+        function(data, length);
+      }
+
+      cycles = read_cycles() - cycles;
+      double seconds = std::chrono::duration<double>(clock_type::now() - start).count() / double(calls);
+
+      if (seconds < best.seconds)
+      {
+        best.seconds = seconds;
+        best.cycles  = double(cycles) / double(calls);
+      }
+    }
+
+    return best;
+  }
+
+  //***************************************************************************
+  /// Parses a size with an optional K or M suffix.
+  //***************************************************************************
+  size_t parse_size(const char* text)
+  {
+    char*  end  = nullptr;
+    size_t size = size_t(std::strtoull(text, &end, 0));
+
+    if ((*end == 'k') || (*end == 'K'))
+    {
+      size *= 1024U;
+    }
+    else if ((*end == 'm') || (*end == 'M'))
+    {
+      size *= 1024U * 1024U;
+    }
+
+    return size;
+  }
+
+  //***************************************************************************
+  /// Formats a size as B, KB or MB.
+  //***************************************************************************
+  std::string format_size(size_t size)
+  {
+    char text[32];
+
+    if ((size >= (1024U * 1024U)) && ((size % (1024U * 1024U)) == 0U))
+    {
+      std::snprintf(text, sizeof(text), "%zuMB", size / (1024U * 1024U));
+    }
+    else if ((size >= 1024U) && ((size % 1024U) == 0U))
+    {
+      std::snprintf(text, sizeof(text), "%zuKB", size / 1024U);
+    }
+    else
+    {
+      std::snprintf(text, sizeof(text), "%zuB", size);
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  bool matches(const char* name, const std::vector<std::string>& filters)
+  {
+    if (filters.empty())
+    {
+      return true;
+    }
+
+    for (size_t i = 0U; i < filters.size(); ++i)
+    {
+      if (std::strstr(name, filters[i].c_str()) != nullptr)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  size_t min_size = 16U;
+  size_t max_size = 16U * 1024U * 1024U;
+  double min_time = 0.05;
+  double mhz      = 0.0;
+  bool   csv      = false;
+
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+
+    if ((arg == "--min-size") && (i + 1 < argc))
+    {
+      min_size = parse_size(argv[++i]);
+    }
+    else if ((arg == "--max-size") && (i + 1 < argc))
+    {
+      max_size = parse_size(argv[++i]);
+    }
+    else if ((arg == "--time-ms") && (i + 1 < argc))
+    {
+      min_time = std::atof(argv[++i]) / 1000.0;
+    }
+    else if ((arg == "--mhz") && (i + 1 < argc))
+    {
+      mhz = std::atof(argv[++i]);
+    }
+    else if (arg == "--csv")
+    {
+      csv = true;
+    }
+    else if ((arg == "--help") || (arg == "-h"))
+    {
+      std::printf("Usage: %s [--min-size N] [--max-size N] [--time-ms N] [--mhz N] [--csv] [filter...]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filters.push_back(arg);
+    }
+  }
+
+  if (min_size == 0U)
+  {
+    min_size = 1U;
+  }
+
+  // Pseudo random test data, so that no algorithm sees a trivial pattern.
+  std::vector<uint8_t> buffer(max_size);
+  uint32_t state = 0x12345678UL;
+
+  for (size_t i = 0U; i < buffer.size(); ++i)
+  {
+    state = (state * 1664525UL) + 1013904223UL;
+    buffer[i] = uint8_t(state >> 24);
+  }
+
+  const bool has_cycles = ETL_BENCHMARK_HAS_TSC || (mhz != 0.0);
+
+  if (csv)
+  {
+    std::printf("algorithm,size,MB/s,cycles/byte\n");
+  }
+  else
+  {
+#if ETL_BENCHMARK_HAS_TSC
+    std::printf("Cycles are measured with the time stamp counter, which may not run at the core clock.\n\n");
+#endif
+    std::printf("%-30s %8s %12s %12s\n", "Algorithm", "Size", "MB/s", "cycles/byte");
+  }
+
+  for (size_t a = 0U; a < sizeof(algorithms) / sizeof(algorithms[0]); ++a)
+  {
+    const algorithm_t& algorithm = algorithms[a];
+
+    if (!matches(algorithm.name, filters))
+    {
+      continue;
+    }
+
+    for (size_t size = min_size; size <= max_size; size *= 4U)
+    {
+      result_t result = measure(algorithm.function, buffer.data(), size, min_time);
+
+      double mb_per_second   = (double(size) / result.seconds) / (1024.0 * 1024.0);
+      double cycles_per_byte = ETL_BENCHMARK_HAS_TSC ? (result.cycles / double(size))
+                                                     : ((result.seconds * mhz * 1.0e6) / double(size));
+
+      if (csv)
+      {
+        if (has_cycles)
+        {
+          std::printf("%s,%zu,%.1f,%.3f\n", algorithm.name, size, mb_per_second, cycles_per_byte);
+        }
+        else
+        {
+          std::printf("%s,%zu,%.1f,\n", algorithm.name, size, mb_per_second);
+        }
+      }
+      else
+      {
+        if (has_cycles)
+        {
+          std::printf("%-30s %8s %12.1f %12.3f\n", algorithm.name, format_size(size).c_str(), mb_per_second, cycles_per_byte);
+        }
+        else
+        {
+          std::printf("%-30s %8s %12.1f %12s\n", algorithm.name, format_size(size).c_str(), mb_per_second, "-");
+        }
+      }
+
+      std::fflush(stdout);
+    }
+
+    if (!csv)
+    {
+      std::printf("\n");
+    }
+  }
+
+  return 0;
+}
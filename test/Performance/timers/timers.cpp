@@ -0,0 +1,518 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Start, stop and tick cost of the timer frameworks against the number of
+// active timers.
+//
+// Usage: etl_timers [options] [filter...]
+//   --ops N          Start/stop pairs for each benchmark (default 20000).
+//   --ticks N        Ticks for each benchmark (default 20000).
+//   --max-period N   Longest timer period, in ticks (default 1000).
+//   --csv            Output comma separated values.
+//   filter           Only run timers whose name contains one of the filters.
+//
+// All timers are registered with pseudo random periods and started. Then a
+// random timer is repeatedly stopped and started again, timing each call, so
+// every call sees the full number of active timers. Then the timers are ticked
+// one tick at a time. Expired one-shot timers are restarted between ticks,
+// outside the timing, so that the number of active timers stays the same.
+//
+// The delta list timers hold at most 254 timers. The wheel timers are also
+// run with 1024 and 4096.
+//
+// Costs are in cycles of the time stamp counter where there is one, otherwise
+// in nanoseconds. The cost of reading the counter has been subtracted.
+//*****************************************************************************
+
+#define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+#define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
+
+#include "etl/callback_timer.h"
+#include "etl/message_timer.h"
+#include "etl/callback_timer_wheel.h"
+#include "etl/message_timer_wheel.h"
+#include "etl/delegate_timer_wheel.h"
+#include "etl/message_router.h"
+#include "etl/function.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define ETL_BENCHMARK_HAS_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+  #include <intrin.h>
+  #define ETL_BENCHMARK_HAS_TSC 1
+#else
+  #define ETL_BENCHMARK_HAS_TSC 0
+#endif
+
+namespace
+{
+  size_t   ops        = 20000U;
+  size_t   ticks      = 20000U;
+  uint32_t max_period = 1000U;
+  bool     csv        = false;
+
+  //***************************************************************************
+  /// Cycles, or nanoseconds if there is no cycle counter.
+  //***************************************************************************
+  uint64_t timestamp()
+  {
+#if ETL_BENCHMARK_HAS_TSC
+    return uint64_t(__rdtsc());
+#else
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+  }
+
+  //***************************************************************************
+  /// The smallest time between two timestamps.
+  //***************************************************************************
+  uint64_t timestamp_overhead()
+  {
+    uint64_t overhead = ~uint64_t(0U);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      const uint64_t start = timestamp();
+      overhead = std::min(overhead, timestamp() - start);
+    }
+
+    return overhead;
+  }
+
+  uint64_t overhead = 0U;
+
+  //***************************************************************************
+  /// Accumulates the cost of a call.
+  //***************************************************************************
+  struct cost_t
+  {
+    cost_t()
+      : total(0U)
+      , max(0U)
+      , count(0U)
+    {
+    }
+
+    void add(uint64_t start, uint64_t end)
+    {
+      const uint64_t elapsed = end - start;
+      const uint64_t cost    = (elapsed > overhead) ? (elapsed - overhead) : 0U;
+
+      total += cost;
+      max    = std::max(max, cost);
+      ++count;
+    }
+
+    double mean() const
+    {
+      return (count == 0U) ? 0.0 : double(total) / double(count);
+    }
+
+    uint64_t total;
+    uint64_t max;
+    size_t   count;
+  };
+
+  //***************************************************************************
+  /// The indexes of the timers that expired during a tick.
+  //***************************************************************************
+  std::vector<size_t> expired;
+
+  //***************************************************************************
+  /// A callback that records the timer that expired.
+  //***************************************************************************
+  struct Recorder : public etl::ifunction<void>
+  {
+    explicit Recorder(size_t index_)
+      : index(index_)
+    {
+    }
+
+    void operator ()() const
+    {
+      expired.push_back(index);
+    }
+
+    void on_expired()
+    {
+      expired.push_back(index);
+    }
+
+    size_t index;
+  };
+
+  //***************************************************************************
+  /// The message sent by the message timers.
+  //***************************************************************************
+  struct Expired : public etl::message<1U>
+  {
+    explicit Expired(size_t index_)
+      : index(index_)
+    {
+    }
+
+    size_t index;
+  };
+
+  //***************************************************************************
+  /// Records the timer that sent the message.
+  //***************************************************************************
+  class Sink : public etl::message_router<Sink, Expired>
+  {
+  public:
+
+    Sink()
+      : message_router(0U)
+    {
+    }
+
+    void on_receive(const Expired& msg)
+    {
+      expired.push_back(msg.index);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Adapts callback_timer and callback_timer_wheel.
+  //***************************************************************************
+  template <typename TTimer>
+  class CallbackBackend
+  {
+  public:
+
+    CallbackBackend(const std::vector<uint32_t>& periods, bool repeating)
+    {
+      recorders.reserve(periods.size());
+
+      for (size_t i = 0U; i < periods.size(); ++i)
+      {
+        recorders.push_back(Recorder(i));
+        ids.push_back(timer.register_timer(recorders.back(), periods[i], repeating));
+      }
+
+      timer.enable(true);
+    }
+
+    bool start(size_t i) { return timer.start(ids[i]); }
+    bool stop(size_t i)  { return timer.stop(ids[i]); }
+    bool tick()          { return timer.tick(1U); }
+
+  private:
+
+    TTimer                 timer;
+    std::vector<Recorder>  recorders;
+    std::vector<uintmax_t> ids;
+  };
+
+  //***************************************************************************
+  /// Adapts message_timer and message_timer_wheel.
+  //***************************************************************************
+  template <typename TTimer>
+  class MessageBackend
+  {
+  public:
+
+    MessageBackend(const std::vector<uint32_t>& periods, bool repeating)
+    {
+      messages.reserve(periods.size());
+
+      for (size_t i = 0U; i < periods.size(); ++i)
+      {
+        messages.push_back(Expired(i));
+        ids.push_back(timer.register_timer(messages.back(), sink, periods[i], repeating));
+      }
+
+      timer.enable(true);
+    }
+
+    bool start(size_t i) { return timer.start(ids[i]); }
+    bool stop(size_t i)  { return timer.stop(ids[i]); }
+    bool tick()          { return timer.tick(1U); }
+
+  private:
+
+    TTimer                 timer;
+    Sink                   sink;
+    std::vector<Expired>   messages;
+    std::vector<uintmax_t> ids;
+  };
+
+  //***************************************************************************
+  /// Adapts delegate_timer_wheel.
+  //***************************************************************************
+  template <typename TTimer>
+  class DelegateBackend
+  {
+  public:
+
+    DelegateBackend(const std::vector<uint32_t>& periods, bool repeating)
+    {
+      recorders.reserve(periods.size());
+
+      for (size_t i = 0U; i < periods.size(); ++i)
+      {
+        recorders.push_back(Recorder(i));
+        ids.push_back(timer.register_timer(etl::delegate<void()>::create<Recorder, &Recorder::on_expired>(recorders.back()), periods[i], repeating));
+      }
+
+      timer.enable(true);
+    }
+
+    bool start(size_t i) { return timer.start(ids[i]); }
+    bool stop(size_t i)  { return timer.stop(ids[i]); }
+    bool tick()          { return timer.tick(1U); }
+
+  private:
+
+    TTimer                 timer;
+    std::vector<Recorder>  recorders;
+    std::vector<uintmax_t> ids;
+  };
+
+  //***************************************************************************
+  bool matches(const char* name, const std::vector<std::string>& filters)
+  {
+    if (filters.empty())
+    {
+      return true;
+    }
+
+    for (size_t i = 0U; i < filters.size(); ++i)
+    {
+      if (std::strstr(name, filters[i].c_str()) != nullptr)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  /// Measures one timer type with one number of timers.
+  //***************************************************************************
+  template <typename TBackend>
+  void run(const char* name, size_t n_timers, bool repeating)
+  {
+    uint32_t random = 0x12345678UL;
+
+    std::vector<uint32_t> periods(n_timers);
+
+    for (size_t i = 0U; i < n_timers; ++i)
+    {
+      random     = (random * 1664525UL) + 1013904223UL;
+      periods[i] = 1U + ((random >> 8) % max_period);
+    }
+
+    // The timers are large, so keep them off the stack.
+    std::unique_ptr<TBackend> backend(new TBackend(periods, repeating));
+
+    for (size_t i = 0U; i < n_timers; ++i)
+    {
+      backend->start(i);
+    }
+
+    cost_t start_cost;
+    cost_t stop_cost;
+
+    for (size_t op = 0U; op < ops; ++op)
+    {
+      random = (random * 1664525UL) + 1013904223UL;
+      const size_t i = (random >> 8) % n_timers;
+
+      uint64_t t0 = timestamp();
+      backend->stop(i);
+      uint64_t t1 = timestamp();
+      backend->start(i);
+      uint64_t t2 = timestamp();
+
+      stop_cost.add(t0, t1);
+      start_cost.add(t1, t2);
+    }
+
+    cost_t tick_cost;
+    size_t n_expired = 0U;
+
+    expired.reserve(n_timers);
+
+    for (size_t t = 0U; t < ticks; ++t)
+    {
+      expired.clear();
+
+      uint64_t t0 = timestamp();
+      backend->tick();
+      uint64_t t1 = timestamp();
+
+      tick_cost.add(t0, t1);
+      n_expired += expired.size();
+
+      if (!repeating)
+      {
+        for (size_t i = 0U; i < expired.size(); ++i)
+        {
+          backend->start(expired[i]);
+        }
+      }
+    }
+
+    const char* mode = repeating ? "repeating" : "one-shot";
+
+    if (csv)
+    {
+      std::printf("%s,%zu,%s,%.1f,%.1f,%.1f,%llu,%.2f\n", name, n_timers, mode,
+                  start_cost.mean(), stop_cost.mean(), tick_cost.mean(),
+                  static_cast<unsigned long long>(tick_cost.max), double(n_expired) / double(ticks));
+    }
+    else
+    {
+      std::printf("%-22s %7zu %-10s %10.1f %10.1f %10.1f %10llu %10.2f\n", name, n_timers, mode,
+                  start_cost.mean(), stop_cost.mean(), tick_cost.mean(),
+                  static_cast<unsigned long long>(tick_cost.max), double(n_expired) / double(ticks));
+    }
+  }
+
+  //***************************************************************************
+  /// Measures one timer type with one number of timers, one-shot and repeating.
+  //***************************************************************************
+  template <typename TBackend>
+  void run_both(const char* name, size_t n_timers, const std::vector<std::string>& filters)
+  {
+    if (matches(name, filters))
+    {
+      run<TBackend>(name, n_timers, false);
+      run<TBackend>(name, n_timers, true);
+    }
+  }
+
+  //***************************************************************************
+  /// Runs all of the timer types for a number of timers.
+  //***************************************************************************
+  template <size_t N_Timers>
+  void run_list_and_wheel(const std::vector<std::string>& filters)
+  {
+    run_both<CallbackBackend<etl::callback_timer<N_Timers> > >("callback_timer", N_Timers, filters);
+    run_both<MessageBackend<etl::message_timer<N_Timers> > >("message_timer", N_Timers, filters);
+    run_both<CallbackBackend<etl::callback_timer_wheel<N_Timers> > >("callback_timer_wheel", N_Timers, filters);
+    run_both<MessageBackend<etl::message_timer_wheel<N_Timers> > >("message_timer_wheel", N_Timers, filters);
+    run_both<DelegateBackend<etl::delegate_timer_wheel<N_Timers> > >("delegate_timer_wheel", N_Timers, filters);
+  }
+
+  //***************************************************************************
+  /// Runs the wheel timer types for a number of timers.
+  //***************************************************************************
+  template <size_t N_Timers>
+  void run_wheel(const std::vector<std::string>& filters)
+  {
+    run_both<CallbackBackend<etl::callback_timer_wheel<N_Timers> > >("callback_timer_wheel", N_Timers, filters);
+    run_both<MessageBackend<etl::message_timer_wheel<N_Timers> > >("message_timer_wheel", N_Timers, filters);
+    run_both<DelegateBackend<etl::delegate_timer_wheel<N_Timers> > >("delegate_timer_wheel", N_Timers, filters);
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> filters;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+
+    if ((arg == "--ops") && (i + 1 < argc))
+    {
+      ops = size_t(std::strtoull(argv[++i], nullptr, 0));
+    }
+    else if ((arg == "--ticks") && (i + 1 < argc))
+    {
+      ticks = size_t(std::strtoull(argv[++i], nullptr, 0));
+    }
+    else if ((arg == "--max-period") && (i + 1 < argc))
+    {
+      max_period = uint32_t(std::strtoul(argv[++i], nullptr, 0));
+    }
+    else if (arg == "--csv")
+    {
+      csv = true;
+    }
+    else if ((arg == "--help") || (arg == "-h"))
+    {
+      std::printf("Usage: %s [--ops N] [--ticks N] [--max-period N] [--csv] [filter...]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filters.push_back(arg);
+    }
+  }
+
+  ops        = std::max(size_t(1U), ops);
+  ticks      = std::max(size_t(1U), ticks);
+  max_period = std::max(uint32_t(1U), max_period);
+  overhead   = timestamp_overhead();
+
+#if ETL_BENCHMARK_HAS_TSC
+  const char* units = "cycles";
+#else
+  const char* units = "ns";
+#endif
+
+  if (csv)
+  {
+    std::printf("timer,timers,mode,start %s,stop %s,tick %s,tick max %s,expired/tick\n", units, units, units, units);
+  }
+  else
+  {
+#if ETL_BENCHMARK_HAS_TSC
+    std::printf("Cycles are measured with the time stamp counter, which may not run at the core clock.\n\n");
+#endif
+    std::printf("%-22s %7s %-10s %10s %10s %10s %10s %10s\n", "Timer", "Timers", "Mode", "start", "stop", "tick", "tick max", "expired");
+  }
+
+  run_list_and_wheel<8U>(filters);
+  run_list_and_wheel<64U>(filters);
+  run_list_and_wheel<254U>(filters);
+  run_wheel<1024U>(filters);
+  run_wheel<4096U>(filters);
+
+  return 0;
+}
@@ -39,7 +39,10 @@ SOFTWARE.
 #define ETL_IDEQUE_REPAIR_ENABLE
 #define ETL_IN_UNIT_TEST
 #define ETL_DEBUG_COUNT
+#define ETL_POOL_STATISTICS
+#define ETL_TRACE
 #define ETL_ARRAY_VIEW_IS_MUTABLE
+#define ETL_CRC_USE_HARDWARE
 
 #define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
 #define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
@@ -30,6 +30,7 @@ SOFTWARE.
 
 #include "etl/algorithm.h"
 #include "etl/container.h"
+#include "etl/span.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
@@ -43,6 +44,7 @@ SOFTWARE.
 #include <numeric>
 #include <random>
 #include <memory>
+#include <limits>
 
 namespace
 {
@@ -131,6 +133,82 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  // Checks the pointer overloads against std for every length up to 70 and
+  // every start offset up to 3, with values repeating so that there are
+  // duplicate minimums and maximums.
+  //***************************************************************************
+  template <typename T>
+  bool check_arithmetic_pointer_algorithms()
+  {
+    std::vector<T> buffer(80);
+
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      buffer[i] = T((i * 37U) % 23U) - T(5);
+    }
+
+    for (size_t offset = 0; offset < 4; ++offset)
+    {
+      for (size_t length = 0; length <= 70; ++length)
+      {
+        const T* first = buffer.data() + offset;
+        const T* last  = first + length;
+
+        if ((etl::min_element(first, last) != std::min_element(first, last)) ||
+            (etl::max_element(first, last) != std::max_element(first, last)) ||
+            (etl::minmax_element(first, last).first  != std::minmax_element(first, last).first) ||
+            (etl::minmax_element(first, last).second != std::minmax_element(first, last).second))
+        {
+          return false;
+        }
+
+        for (int v = -6; v < 20; v += 3)
+        {
+          if ((etl::find(first, last, T(v)) != std::find(first, last, T(v))) ||
+              (etl::count(first, last, T(v)) != std::count(first, last, T(v))))
+          {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_arithmetic_pointer_accumulate()
+  {
+    std::vector<T> buffer(300);
+
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      buffer[i] = T(i * 101U + 7U);
+    }
+
+    for (size_t length = 0; length <= buffer.size(); length += 13)
+    {
+      const T* first = buffer.data();
+      const T* last  = first + length;
+
+      T expected = T(3);
+
+      for (const T* p = first; p != last; ++p)
+      {
+        expected = T(expected + *p);
+      }
+
+      if (etl::accumulate(first, last, T(3)) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_algorithm)
   {
     //*************************************************************************
@@ -223,6 +301,86 @@ namespace
       CHECK_EQUAL(std::distance(data.begin(), expected.second), std::distance(data.begin(), result.second));
     }
 
+    //*************************************************************************
+    TEST(arithmetic_pointer_algorithms)
+    {
+      CHECK(check_arithmetic_pointer_algorithms<int8_t>());
+      CHECK(check_arithmetic_pointer_algorithms<uint8_t>());
+      CHECK(check_arithmetic_pointer_algorithms<char>());
+      CHECK(check_arithmetic_pointer_algorithms<int16_t>());
+      CHECK(check_arithmetic_pointer_algorithms<uint16_t>());
+      CHECK(check_arithmetic_pointer_algorithms<int32_t>());
+      CHECK(check_arithmetic_pointer_algorithms<uint32_t>());
+      CHECK(check_arithmetic_pointer_algorithms<int64_t>());
+      CHECK(check_arithmetic_pointer_algorithms<uint64_t>());
+      CHECK(check_arithmetic_pointer_algorithms<float>());
+      CHECK(check_arithmetic_pointer_algorithms<double>());
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_pointer_algorithms_extreme_values)
+    {
+      int8_t   i8[40];
+      uint32_t u32[40];
+
+      std::fill(std::begin(i8), std::end(i8), int8_t(0));
+      std::fill(std::begin(u32), std::end(u32), uint32_t(1));
+
+      i8[17]  = -128;
+      i8[33]  = 127;
+      u32[5]  = 0xFFFFFFFFUL;
+      u32[38] = 0U;
+
+      CHECK_EQUAL(17, etl::min_element(std::begin(i8), std::end(i8)) - std::begin(i8));
+      CHECK_EQUAL(33, etl::max_element(std::begin(i8), std::end(i8)) - std::begin(i8));
+      CHECK_EQUAL(38, etl::min_element(std::begin(u32), std::end(u32)) - std::begin(u32));
+      CHECK_EQUAL(5,  etl::max_element(std::begin(u32), std::end(u32)) - std::begin(u32));
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_pointer_algorithms_nan)
+    {
+      float data[20];
+
+      for (size_t i = 0; i < 20; ++i)
+      {
+        data[i] = float(i % 7);
+      }
+
+      data[9] = std::numeric_limits<float>::quiet_NaN();
+
+      CHECK(etl::min_element(std::begin(data), std::end(data)) == std::min_element(std::begin(data), std::end(data)));
+      CHECK(etl::max_element(std::begin(data), std::end(data)) == std::max_element(std::begin(data), std::end(data)));
+      CHECK(etl::minmax_element(std::begin(data), std::end(data)).first  == std::minmax_element(std::begin(data), std::end(data)).first);
+      CHECK(etl::minmax_element(std::begin(data), std::end(data)).second == std::minmax_element(std::begin(data), std::end(data)).second);
+      CHECK(etl::find(std::begin(data), std::end(data), data[9]) == std::end(data));
+      CHECK_EQUAL(0, etl::count(std::begin(data), std::end(data), data[9]));
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_pointer_count_many)
+    {
+      // More matches than an 8 bit lane counter can hold.
+      std::vector<uint8_t> data(100000U, uint8_t(7));
+      data[500] = 8;
+
+      CHECK_EQUAL(99999, etl::count(data.data(), data.data() + data.size(), uint8_t(7)));
+      CHECK_EQUAL(1,     etl::count(data.data(), data.data() + data.size(), uint8_t(8)));
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_pointer_accumulate)
+    {
+      CHECK(check_arithmetic_pointer_accumulate<int8_t>());
+      CHECK(check_arithmetic_pointer_accumulate<uint8_t>());
+      CHECK(check_arithmetic_pointer_accumulate<int16_t>());
+      CHECK(check_arithmetic_pointer_accumulate<uint16_t>());
+      CHECK(check_arithmetic_pointer_accumulate<int32_t>());
+      CHECK(check_arithmetic_pointer_accumulate<uint32_t>());
+      CHECK(check_arithmetic_pointer_accumulate<int64_t>());
+      CHECK(check_arithmetic_pointer_accumulate<uint64_t>());
+    }
+
     //*************************************************************************
     TEST(minmax)
     {
@@ -662,6 +820,75 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(binary_search)
+    {
+      for (int i = 0; i < 11; ++i)
+      {
+        CHECK_EQUAL(std::binary_search(std::begin(dataEQ), std::end(dataEQ), i),
+                    etl::binary_search(non_random_iterator<int>(std::begin(dataEQ)), non_random_iterator<int>(std::end(dataEQ)), i));
+
+        CHECK_EQUAL(std::binary_search(std::rbegin(dataEQ), std::rend(dataEQ), i, std::greater<int>()),
+                    etl::binary_search(std::rbegin(dataEQ), std::rend(dataEQ), i, std::greater<int>()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(branchless_search_pointer)
+    {
+      // Large enough for the prefetching loop.
+      std::vector<int> data;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        data.push_back((i / 3) * 2);
+      }
+
+      const size_t lengths[] = { 0U, 1U, 2U, 3U, 7U, 8U, 9U, 100U, 4097U, 20000U };
+
+      for (size_t l = 0U; l < ETL_ARRAY_SIZE(lengths); ++l)
+      {
+        const int* first = data.data();
+        const int* last  = data.data() + lengths[l];
+
+        for (int value = -1; value < 13400; value += 7)
+        {
+          CHECK_EQUAL(std::lower_bound(first, last, value) - first,   etl::lower_bound(first, last, value) - first);
+          CHECK_EQUAL(std::upper_bound(first, last, value) - first,   etl::upper_bound(first, last, value) - first);
+          CHECK_EQUAL(std::binary_search(first, last, value),         etl::binary_search(first, last, value));
+          CHECK_EQUAL(std::binary_search(first, last, value + 1),     etl::binary_search(first, last, value + 1));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(branchless_search_random_iterator_with_compare)
+    {
+      std::vector<int> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(999 - ((i / 2) * 2));
+      }
+
+      for (size_t length = 0U; length <= data.size(); length += 37U)
+      {
+        int* first = data.data();
+        int* last  = data.data() + length;
+
+        for (int value = -1; value < 1002; ++value)
+        {
+          int* lb1 = std::lower_bound(first, last, value, std::greater<int>());
+          int* ub1 = std::upper_bound(first, last, value, std::greater<int>());
+
+          CHECK_EQUAL(lb1, etl::lower_bound(first, last, value, std::greater<int>()));
+          CHECK_EQUAL(ub1, etl::upper_bound(first, last, value, std::greater<int>()));
+          CHECK_EQUAL(lb1, (int*)etl::lower_bound(random_iterator<int>(first), random_iterator<int>(last), value, std::greater<int>()));
+          CHECK_EQUAL(ub1, (int*)etl::upper_bound(random_iterator<int>(first), random_iterator<int>(last), value, std::greater<int>()));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(fill_non_char)
     {
@@ -1113,11 +1340,12 @@ namespace
         std::vector<int> data1(initial_data);
         std::vector<int> data2(initial_data);
 
-        std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
-        etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+        int* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        int* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
 
         bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
         CHECK(isEqual);
+        CHECK_EQUAL(result1 - data1.data(), result2 - data2.data());
       }
     }
 
@@ -1888,6 +2116,286 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(stable_sort_long)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        initial_data.push_back(NDC((i * 37) % 23, i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 3000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 100), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end());
+
+      // Full, partial, tiny and empty buffers.
+      const size_t buffer_sizes[] = { 1500U, 2000U, 300U, 1U, 0U };
+
+      for (size_t size : buffer_sizes)
+      {
+        std::vector<NDC> data2(initial_data);
+        std::vector<NDC> buffer(size, NDC(0, 0));
+        etl::span<NDC>   buffer_view;
+
+        if (size != 0U)
+        {
+          buffer_view = etl::span<NDC>(buffer.data(), buffer.size());
+        }
+
+        etl::stable_sort(data2.begin(), data2.end(), buffer_view);
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_buffer_greater)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 10), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> buffer(500U, NDC(0, 0));
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::stable_sort(data2.begin(), data2.end(), etl::span<NDC>(buffer.data(), buffer.size()), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_with_fixed_extent_buffer)
+    {
+      std::array<int, 100> data;
+      std::array<int, 50>  buffer;
+
+      std::iota(data.begin(), data.end(), 0);
+      std::shuffle(data.begin(), data.end(), urng);
+
+      etl::stable_sort(data.begin(), data.end(), etl::span<int, 50>(buffer));
+
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST(inplace_merge_default)
+    {
+      for (size_t middle = 0U; middle <= 40U; ++middle)
+      {
+        std::vector<NDC> initial_data;
+
+        for (int i = 0; i < 40; ++i)
+        {
+          initial_data.push_back(NDC((i * 7) % 11, i));
+        }
+
+        std::stable_sort(initial_data.begin(), initial_data.begin() + middle);
+        std::stable_sort(initial_data.begin() + middle, initial_data.end());
+
+        std::vector<NDC> data1(initial_data);
+        std::vector<NDC> data2(initial_data);
+
+        std::inplace_merge(data1.begin(), data1.begin() + middle, data1.end());
+        etl::inplace_merge(data2.begin(), data2.begin() + middle, data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(inplace_merge_greater)
+    {
+      std::vector<NDC> initial_data = { NDC(5, 1), NDC(3, 1), NDC(3, 2), NDC(1, 1), NDC(4, 1), NDC(3, 3), NDC(2, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::inplace_merge(data1.begin(), data1.begin() + 4, data1.end(), std::greater<NDC>());
+      etl::inplace_merge(data2.begin(), data2.begin() + 4, data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge)
+    {
+      std::vector<NDC> data1 = { NDC(1, 1), NDC(3, 1), NDC(3, 2), NDC(5, 1), NDC(7, 1) };
+      std::vector<NDC> data2 = { NDC(2, 2), NDC(3, 3), NDC(5, 2), NDC(8, 2) };
+
+      std::vector<NDC> expected;
+      std::vector<NDC> result;
+
+      std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+
+      CHECK_EQUAL(expected.size(), result.size());
+      CHECK(std::equal(expected.begin(), expected.end(), result.begin(), NDC::are_identical));
+    }
+
+    //*************************************************************************
+    TEST(merge_galloping)
+    {
+      std::uniform_int_distribution<int> run_length(1, 40);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        // Runs of values alternating between the two ranges, with some
+        // values repeated in both.
+        std::vector<NDC> data1;
+        std::vector<NDC> data2;
+
+        int  value = 0;
+        bool first = true;
+
+        while ((data1.size() + data2.size()) < 600)
+        {
+          const int length = run_length(urng);
+
+          for (int j = 0; j < length; ++j)
+          {
+            (first ? data1 : data2).push_back(NDC(value, first ? 1 : 2));
+
+            if ((j % 5) == 0)
+            {
+              (first ? data2 : data1).push_back(NDC(value, first ? 2 : 1));
+            }
+
+            value += j % 2;
+          }
+
+          first = !first;
+        }
+
+        std::vector<NDC> expected;
+        std::vector<NDC> result;
+
+        std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+        etl::merge_galloping(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+
+        CHECK_EQUAL(expected.size(), result.size());
+        CHECK(std::equal(expected.begin(), expected.end(), result.begin(), NDC::are_identical));
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_galloping_greater)
+    {
+      std::vector<int> data1 = { 20, 19, 18, 17, 16, 15, 14, 13, 12, 5, 4, 3 };
+      std::vector<int> data2 = { 11, 10, 9, 8, 7, 6, 5, 2, 1 };
+
+      std::vector<int> expected;
+      std::vector<int> result;
+
+      std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected), std::greater<int>());
+      etl::merge_galloping(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result), std::greater<int>());
+
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(set_union)
+    {
+      std::vector<int> data1 = { 1, 2, 2, 2, 4, 6, 6, 9 };
+      std::vector<int> data2 = { 0, 2, 2, 5, 6, 6, 6, 9, 10 };
+
+      std::vector<int> expected;
+      std::vector<int> result;
+
+      std::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(set_intersection)
+    {
+      std::vector<int> data1 = { 1, 2, 2, 2, 4, 6, 6, 9 };
+      std::vector<int> data2 = { 0, 2, 2, 5, 6, 6, 6, 9, 10 };
+
+      std::vector<int> expected;
+      std::vector<int> result;
+
+      std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_span)
+    {
+      std::uniform_int_distribution<int> distribution(0, 200);
+
+      for (int i = 0; i < 50; ++i)
+      {
+        std::vector<int> data1(100 + i);
+        std::vector<int> data2(150 - i);
+
+        std::generate(data1.begin(), data1.end(), [&]() { return distribution(urng); });
+        std::generate(data2.begin(), data2.end(), [&]() { return distribution(urng); });
+        std::sort(data1.begin(), data1.end());
+        std::sort(data2.begin(), data2.end());
+
+        std::vector<int> expected;
+        std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+
+        std::vector<int> output(expected.size());
+
+        int* end = etl::set_intersection(etl::span<const int>(data1.data(), data1.size()),
+                                         etl::span<const int>(data2.data(), data2.size()),
+                                         etl::span<int>(output.data(), output.size()));
+
+        CHECK_EQUAL(expected.size(), size_t(end - output.data()));
+        CHECK(expected == output);
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_span_output_full)
+    {
+      const uint16_t data1[] = { 1, 2, 3, 4, 5, 6 };
+      const uint16_t data2[] = { 2, 3, 4, 6 };
+
+      uint16_t output[2] = { 0, 0 };
+
+      uint16_t* end = etl::set_intersection(etl::span<const uint16_t>(data1), etl::span<const uint16_t>(data2), etl::span<uint16_t>(output));
+
+      CHECK(end == output + 2);
+      CHECK_EQUAL(2, output[0]);
+      CHECK_EQUAL(3, output[1]);
+    }
+
     //*************************************************************************
     TEST(shell_sort_default)
     {
@@ -1930,6 +2438,536 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(pdq_sort_default)
+    {
+      for (int size = 0; size < 300; ++size)
+      {
+        std::vector<int> data(size, 0);
+
+        // Values repeat, so that there are equal elements.
+        for (int i = 0; i < size; ++i)
+        {
+          data[i] = i % 50;
+        }
+
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::pdq_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_patterns)
+    {
+      const int Size = 10000;
+
+      std::vector<std::vector<int>> patterns;
+
+      std::vector<int> data(Size);
+
+      std::iota(data.begin(), data.end(), 0);
+      patterns.push_back(data);                          // Sorted
+
+      std::reverse(data.begin(), data.end());
+      patterns.push_back(data);                          // Reversed
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i] = (i < (Size / 2)) ? i : Size - i;       // Organ pipe
+      }
+      patterns.push_back(data);
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i] = i % 64;                                // Sawtooth
+      }
+      patterns.push_back(data);
+
+      std::fill(data.begin(), data.end(), 42);
+      patterns.push_back(data);                          // All equal
+
+      std::iota(data.begin(), data.end(), 0);
+      std::swap(data[10], data[Size - 10]);
+      patterns.push_back(data);                          // Nearly sorted
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i] = int(urng() % 4);                       // Few unique
+      }
+      patterns.push_back(data);
+
+      for (size_t p = 0; p < patterns.size(); ++p)
+      {
+        std::vector<int> data1 = patterns[p];
+        std::vector<int> data2 = patterns[p];
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_adversarial_comparisons)
+    {
+      // A comparison that counts calls, to check that the worst case stays O(n log n).
+      struct counting_less
+      {
+        bool operator()(int a, int b) const
+        {
+          ++count;
+          return a < b;
+        }
+
+        size_t& count;
+      };
+
+      const size_t Size = 100000;
+
+      std::vector<int> data(Size);
+
+      // Median of three killer.
+      for (size_t i = 0; i < (Size / 2); ++i)
+      {
+        data[i]              = int((i % 2 == 0) ? i + 1 : (Size / 2) + i + (i % 2));
+        data[(Size / 2) + i] = int(2 * (i + 1));
+      }
+
+      size_t count = 0U;
+      counting_less compare = { count };
+
+      etl::pdq_sort(data.begin(), data.end(), compare);
+
+      CHECK(std::is_sorted(data.begin(), data.end()));
+      CHECK(count < (4U * Size * 17U)); // 4 n log2(n)
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_non_default_constructible)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data1.insert(data1.end(), initial_data.begin(), initial_data.end());
+        data2.insert(data2.end(), initial_data.begin(), initial_data.end());
+      }
+
+      std::sort(data1.begin(), data1.end());
+      etl::pdq_sort(data2.begin(), data2.end());
+
+      CHECK(std::is_sorted(data2.begin(), data2.end()));
+      CHECK_EQUAL(data1.size(), data2.size());
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      std::vector<uint32_t> data(10000);
+      std::vector<uint32_t> scratch(data.size());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint32_t(urng());
+      }
+
+      std::vector<uint32_t> data1 = data;
+      std::vector<uint32_t> data2 = data;
+      std::vector<uint32_t> data3 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin());
+      etl::radix_sort<11>(data3.begin(), data3.end(), scratch.begin());
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      std::vector<int64_t> data64(5000);
+      std::vector<int8_t>  data8(5000);
+      std::vector<int64_t> scratch64(data64.size());
+      std::vector<int8_t>  scratch8(data8.size());
+
+      for (size_t i = 0U; i < data64.size(); ++i)
+      {
+        data64[i] = int64_t((uint64_t(urng()) << 32) | urng());
+        data8[i]  = int8_t(urng());
+      }
+
+      // Some keys that differ only in the sign bit.
+      data64[0] = INT64_MIN;
+      data64[1] = INT64_MAX;
+      data64[2] = -1;
+      data64[3] = 0;
+
+      std::vector<int64_t> data64_1 = data64;
+      std::vector<int8_t>  data8_1  = data8;
+
+      std::sort(data64_1.begin(), data64_1.end());
+      std::sort(data8_1.begin(), data8_1.end());
+      etl::radix_sort(data64.begin(), data64.end(), scratch64.begin());
+      etl::radix_sort(data8.begin(), data8.end(), scratch8.begin());
+
+      CHECK(data64_1 == data64);
+      CHECK(data8_1 == data8);
+    }
+
+    //*************************************************************************
+    struct Record
+    {
+      int32_t  timestamp;
+      uint32_t sequence;
+    };
+
+    struct RecordTimestamp
+    {
+      int32_t operator()(const Record& record) const
+      {
+        return record.timestamp;
+      }
+    };
+
+    bool RecordLess(const Record& lhs, const Record& rhs)
+    {
+      return lhs.timestamp < rhs.timestamp;
+    }
+
+    bool RecordEqual(const Record& lhs, const Record& rhs)
+    {
+      return (lhs.timestamp == rhs.timestamp) && (lhs.sequence == rhs.sequence);
+    }
+
+    TEST(radix_sort_key_extractor_is_stable)
+    {
+      std::vector<Record> data(5000);
+      std::vector<Record> scratch(data.size());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i].timestamp = int32_t(urng() % 1000U) - 500;
+        data[i].sequence  = uint32_t(i);
+      }
+
+      // Constant high digits are skipped.
+      std::vector<Record> data1 = data;
+      std::vector<Record> data2 = data;
+
+      std::stable_sort(data1.begin(), data1.end(), RecordLess);
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), RecordTimestamp());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), RecordEqual));
+
+      // An already sorted range and a range of one are unchanged.
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), RecordTimestamp());
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), RecordEqual));
+
+      etl::radix_sort(data2.begin(), data2.begin() + 1, scratch.begin(), RecordTimestamp());
+      CHECK(RecordEqual(data1[0], data2[0]));
+    }
+
+    //*************************************************************************
+    TEST(counting_sort)
+    {
+      std::vector<uint8_t> data(1000);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(urng() % 10U);
+      }
+
+      std::vector<uint8_t> data1 = data;
+      std::vector<uint8_t> data2 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::counting_sort<10>(data2.begin(), data2.end());
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(counting_sort_key_extractor_is_stable)
+    {
+      std::vector<Record> data(1000);
+      std::vector<Record> scratch(data.size());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i].timestamp = int32_t(urng() % 16U);
+        data[i].sequence  = uint32_t(i);
+      }
+
+      std::vector<Record> data1 = data;
+      std::vector<Record> data2 = data;
+
+      std::stable_sort(data1.begin(), data1.end(), RecordLess);
+      etl::counting_sort<16>(data2.begin(), data2.end(), scratch.begin(), RecordTimestamp());
+
+      CHECK(std::equal(data1.begin(), data1.end(), data2.begin(), RecordEqual));
+    }
+
+    //*************************************************************************
+    TEST(nth_element)
+    {
+      const size_t sizes[] = { 0U, 1U, 2U, 23U, 24U, 100U, 129U, 1000U, 10000U };
+
+      for (size_t s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); ++s)
+      {
+        const size_t size = sizes[s];
+
+        std::vector<int> initial_data(size);
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          initial_data[i] = int(urng() % 1000U);
+        }
+
+        std::vector<int> sorted = initial_data;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t n = 0U; n < size; n += 1U + (size / 7U))
+        {
+          std::vector<int> data = initial_data;
+          std::vector<int>::iterator nth = data.begin() + n;
+
+          etl::nth_element(data.begin(), nth, data.end());
+
+          CHECK_EQUAL(sorted[n], *nth);
+          CHECK(std::all_of(data.begin(), nth, [&](int i) { return i <= *nth; }));
+          CHECK(std::all_of(nth, data.end(), [&](int i) { return i >= *nth; }));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(nth_element_greater_and_patterns)
+    {
+      const int Size = 10000;
+
+      std::vector<std::vector<int>> patterns;
+
+      std::vector<int> data(Size);
+
+      std::iota(data.begin(), data.end(), 0);
+      patterns.push_back(data);                          // Sorted
+
+      std::reverse(data.begin(), data.end());
+      patterns.push_back(data);                          // Reversed
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i] = (i < (Size / 2)) ? i : Size - i;       // Organ pipe
+      }
+      patterns.push_back(data);
+
+      std::fill(data.begin(), data.end(), 42);
+      patterns.push_back(data);                          // All equal
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i] = int(urng() % 4);                       // Few unique
+      }
+      patterns.push_back(data);
+
+      const int nths[] = { 0, 1, Size / 2, (Size * 99) / 100, Size - 1 };
+
+      for (size_t p = 0; p < patterns.size(); ++p)
+      {
+        std::vector<int> sorted = patterns[p];
+        std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+        for (size_t n = 0U; n < (sizeof(nths) / sizeof(nths[0])); ++n)
+        {
+          std::vector<int> data1 = patterns[p];
+
+          etl::nth_element(data1.begin(), data1.begin() + nths[n], data1.end(), std::greater<int>());
+
+          CHECK_EQUAL(sorted[nths[n]], data1[nths[n]]);
+          CHECK(std::is_permutation(data1.begin(), data1.end(), patterns[p].begin()));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(nth_element_is_linear_for_equal_elements)
+    {
+      struct counting_less
+      {
+        bool operator()(int a, int b) const
+        {
+          ++count;
+          return a < b;
+        }
+
+        size_t& count;
+      };
+
+      const size_t Size = 100000U;
+
+      std::vector<int> data(Size, 7);
+
+      size_t count = 0U;
+      counting_less compare = { count };
+
+      etl::nth_element(data.begin(), data.begin() + (Size / 2U), data.end(), compare);
+
+      CHECK(count < (Size * 10U));
+    }
+
+    //*************************************************************************
+    TEST(partial_sort)
+    {
+      std::vector<int> initial_data(1000);
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        initial_data[i] = int(urng() % 500U);
+      }
+
+      std::vector<int> sorted = initial_data;
+      std::sort(sorted.begin(), sorted.end());
+
+      const size_t middles[] = { 0U, 1U, 10U, 500U, 999U, 1000U };
+
+      for (size_t m = 0U; m < (sizeof(middles) / sizeof(middles[0])); ++m)
+      {
+        std::vector<int> data = initial_data;
+
+        etl::partial_sort(data.begin(), data.begin() + middles[m], data.end());
+
+        CHECK(std::equal(sorted.begin(), sorted.begin() + middles[m], data.begin()));
+        CHECK(std::is_permutation(data.begin(), data.end(), initial_data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_greater)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 1000), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::partial_sort(data1.begin(), data1.begin() + 20, data1.end(), std::greater<NDC>());
+      etl::partial_sort(data2.begin(), data2.begin() + 20, data2.end(), std::greater<NDC>());
+
+      CHECK(std::equal(data1.begin(), data1.begin() + 20, data2.begin()));
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_copy)
+    {
+      std::list<int> input;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        input.push_back(int(urng() % 1000U));
+      }
+
+      std::vector<int> sorted(input.begin(), input.end());
+      std::sort(sorted.begin(), sorted.end());
+
+      std::vector<int> small(10);
+      std::vector<int>::iterator result = etl::partial_sort_copy(input.begin(), input.end(), small.begin(), small.end());
+
+      CHECK(result == small.end());
+      CHECK(std::equal(small.begin(), small.end(), sorted.begin()));
+
+      std::vector<int> large(150, -1);
+      result = etl::partial_sort_copy(input.begin(), input.end(), large.begin(), large.end());
+
+      CHECK(result == large.begin() + 100);
+      CHECK(std::equal(sorted.begin(), sorted.end(), large.begin()));
+      CHECK_EQUAL(-1, large[100]);
+
+      std::vector<int> empty;
+      result = etl::partial_sort_copy(input.begin(), input.end(), empty.begin(), empty.end());
+
+      CHECK(result == empty.end());
+
+      std::vector<int> greater(5);
+      etl::partial_sort_copy(input.begin(), input.end(), greater.begin(), greater.end(), std::greater<int>());
+
+      CHECK(std::equal(greater.begin(), greater.end(), sorted.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(select_k_smallest)
+    {
+      std::vector<int> initial_data(1000);
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        initial_data[i] = int(urng() % 10000U);
+      }
+
+      std::vector<int> sorted = initial_data;
+      std::sort(sorted.begin(), sorted.end());
+
+      std::vector<int> data = initial_data;
+      std::vector<int>::iterator end = etl::select_k_smallest(data.begin(), data.end(), 100U);
+
+      CHECK(end == data.begin() + 100);
+      std::sort(data.begin(), end);
+      CHECK(std::equal(sorted.begin(), sorted.begin() + 100, data.begin()));
+
+      data = initial_data;
+      end = etl::select_k_smallest(data.begin(), data.end(), 10U, std::greater<int>());
+
+      CHECK(end == data.begin() + 10);
+      std::sort(data.begin(), end, std::greater<int>());
+      CHECK(std::equal(sorted.rbegin(), sorted.rbegin() + 10, data.begin()));
+
+      data = initial_data;
+      end = etl::select_k_smallest(data.begin(), data.end(), 2000U);
+
+      CHECK(end == data.end());
+      CHECK(data == initial_data);
+
+      CHECK(etl::select_k_smallest(data.begin(), data.end(), 0U) == data.begin());
+    }
+
     //*************************************************************************
     TEST(insertion_sort_default)
     {
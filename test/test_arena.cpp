@@ -0,0 +1,222 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "etl/arena.h"
+#include "etl/vector.h"
+#include "etl/list.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+namespace
+{
+  SUITE(test_arena)
+  {
+    static const size_t SIZE = 256U;
+
+    //*************************************************************************
+    TEST(test_default_state)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      CHECK(arena.empty());
+      CHECK_EQUAL(0U, arena.size());
+      CHECK_EQUAL(SIZE, arena.capacity());
+      CHECK_EQUAL(SIZE, arena.available());
+      CHECK_EQUAL(0U, arena.max_size_used());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_bumps_and_aligns)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      char*     p1 = static_cast<char*>(arena.allocate(3U, 1U));
+      uint32_t* p2 = static_cast<uint32_t*>(arena.allocate(sizeof(uint32_t), alignof(uint32_t)));
+      char*     p3 = static_cast<char*>(arena.allocate(1U, 1U));
+      uint64_t* p4 = static_cast<uint64_t*>(arena.allocate(sizeof(uint64_t), 8U));
+
+      CHECK(p1 == buffer);
+      CHECK(reinterpret_cast<char*>(p2) == buffer + 4);
+      CHECK(p3 == buffer + 8);
+      CHECK(reinterpret_cast<char*>(p4) == buffer + 16);
+      CHECK_EQUAL(24U, arena.size());
+      CHECK(arena.is_owner_of(p4));
+
+      // Alignment is of the address, not the offset.
+      etl::arena odd(buffer + 1, SIZE - 1U);
+      void* p5 = odd.allocate(4U, 4U);
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p5) % 4U);
+      CHECK(p5 == buffer + 4);
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted)
+    {
+      alignas(8) char buffer[16];
+      etl::arena arena(buffer, sizeof(buffer));
+
+      CHECK(arena.allocate(12U, 1U) != nullptr);
+      CHECK(arena.allocate(8U, 1U) == nullptr);
+      CHECK(arena.allocate(4U, 8U) == nullptr); // Fits only without the padding.
+      CHECK(arena.allocate(4U, 4U) != nullptr);
+      CHECK(arena.allocate(1U, 1U) == nullptr);
+      CHECK_EQUAL(0U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      alignas(8) char buffer[16];
+      etl::arena arena(buffer, sizeof(buffer));
+      etl::fixed_sized_memory_block_allocator<32U, 8U, 1U> overflow;
+
+      arena.set_successor(overflow);
+
+      void* p1 = arena.allocate(16U, 8U);
+      void* p2 = arena.allocate(16U, 8U);
+
+      CHECK(arena.is_owner_of(p1));
+      CHECK(p2 != nullptr);
+      CHECK(!arena.is_owner_of(p2));
+      CHECK(overflow.is_owner_of(p2));
+
+      CHECK(arena.release(p2));
+      CHECK(arena.release(p1));
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      void* p1 = arena.allocate(8U, 8U);
+      void* p2 = arena.allocate(8U, 8U);
+
+      // Not the last block, so kept until the reset.
+      CHECK(arena.release(p1));
+      CHECK_EQUAL(16U, arena.size());
+
+      // The last block is reclaimed.
+      CHECK(arena.release(p2));
+      CHECK_EQUAL(8U, arena.size());
+      CHECK(arena.allocate(8U, 8U) == p2);
+
+      int on_stack;
+      CHECK(!arena.release(&on_stack));
+    }
+
+    //*************************************************************************
+    TEST(test_reset_and_rewind)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      arena.allocate(10U, 1U);
+      const size_t position = arena.position();
+
+      void* p = arena.allocate(20U, 1U);
+      arena.allocate(30U, 1U);
+      CHECK_EQUAL(60U, arena.size());
+
+      arena.rewind(position);
+      CHECK_EQUAL(10U, arena.size());
+      CHECK(arena.allocate(20U, 1U) == p);
+
+      arena.reset();
+      CHECK(arena.empty());
+      CHECK(arena.allocate(1U, 1U) == buffer);
+      CHECK_EQUAL(60U, arena.max_size_used());
+    }
+
+    //*************************************************************************
+    TEST(test_vector_ext)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      int* storage = arena.allocate_array<int>(10U);
+      CHECK(storage != nullptr);
+
+      etl::vector_ext<int> data(storage, 10U);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(9, data.back());
+      CHECK(arena.is_owner_of(&data[0]));
+
+      CHECK(arena.allocate_array<int>(SIZE) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_list_ext)
+    {
+      alignas(8) char buffer[SIZE];
+      etl::arena arena(buffer, SIZE);
+
+      typedef etl::list_ext<int> List;
+
+      etl::arena_pool<List::pool_type> pool(arena, 4U);
+      CHECK_EQUAL(4U, pool.max_size());
+
+      {
+        List data(pool);
+        data.push_back(1);
+        data.push_back(2);
+        data.push_front(0);
+
+        CHECK_EQUAL(3U, data.size());
+        CHECK_EQUAL(0, data.front());
+        CHECK_EQUAL(2, data.back());
+        CHECK(arena.is_owner_of(&data.front()));
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_arena_pool_too_large)
+    {
+      alignas(8) char buffer[16];
+      etl::arena arena(buffer, sizeof(buffer));
+
+      CHECK_THROW(etl::arena_pool<uint64_t> pool(arena, 4U), etl::arena_no_allocation);
+    }
+  };
+}
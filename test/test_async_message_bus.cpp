@@ -0,0 +1,382 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/async_message_bus.h"
+#include "etl/message_bus.h"
+#include "etl/message_router.h"
+#include "etl/atomic_fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+
+  constexpr etl::message_router_id_t RouterId1 = 1U;
+  constexpr etl::message_router_id_t RouterId2 = 2U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2>;
+
+  using Allocator = etl::atomic_fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                                   pool_message_parameters::max_alignment,
+                                                                   64>;
+
+  //*************************************************************************
+  struct Router1 : public etl::message_router<Router1, Message1, Message2>
+  {
+    Router1(etl::message_router_id_t id = RouterId1)
+      : message_router(id)
+      , count_message1(0)
+      , count_message2(0)
+      , last_i(-1)
+      , is_ordered(true)
+    {
+    }
+
+    void on_receive(const Message1& message)
+    {
+      ++count_message1;
+
+      if (message.i <= last_i)
+      {
+        is_ordered = false;
+      }
+
+      last_i = message.i;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count_message2;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int  count_message1;
+    int  count_message2;
+    int  last_i;
+    bool is_ordered;
+  };
+
+  //*************************************************************************
+  struct Router2 : public etl::message_router<Router2, Message1>
+  {
+    Router2()
+      : message_router(RouterId2)
+      , count_message1(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++count_message1;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int count_message1;
+  };
+
+  SUITE(test_async_message_bus)
+  {
+    //*************************************************************************
+    TEST(test_subscribe_unsubscribe)
+    {
+      etl::async_message_bus<2, 4> bus;
+
+      Router1 router1;
+      Router2 router2;
+      Router1 router3;
+
+      CHECK_EQUAL(0U, bus.size());
+      CHECK_EQUAL(2U, bus.max_size());
+
+      CHECK(bus.subscribe(router1));
+      CHECK(bus.subscribe(router2));
+      CHECK_EQUAL(2U, bus.size());
+
+      CHECK_THROW(bus.subscribe(router3), etl::async_message_bus_too_many_subscribers);
+
+      bus.unsubscribe(router1);
+      CHECK_EQUAL(1U, bus.size());
+
+      CHECK(bus.subscribe(router3));
+      CHECK_EQUAL(2U, bus.size());
+
+      bus.clear();
+      CHECK_EQUAL(0U, bus.size());
+    }
+
+    //*************************************************************************
+    TEST(test_broadcast_is_deferred)
+    {
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      etl::async_message_bus<2, 4> bus;
+
+      Router1 router1;
+      Router2 router2;
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      {
+        etl::shared_message message1(pool, Message1(1));
+        etl::shared_message message2(pool, Message2());
+
+        CHECK(bus.post(message1));
+        bus.receive(message2);
+
+        // One copy for each queue that holds it.
+        CHECK_EQUAL(3U, message1.get_reference_count());
+        CHECK_EQUAL(2U, message2.get_reference_count());
+      }
+
+      // Nothing is handled until the queues are processed.
+      CHECK_EQUAL(0, router1.count_message1);
+      CHECK_EQUAL(0, router2.count_message1);
+      CHECK_EQUAL(3U, bus.pending());
+      CHECK(!bus.empty());
+
+      CHECK_EQUAL(3U, bus.process());
+
+      CHECK_EQUAL(1, router1.count_message1);
+      CHECK_EQUAL(1, router1.count_message2);
+      CHECK_EQUAL(1, router2.count_message1);
+      CHECK_EQUAL(0U, bus.pending());
+      CHECK(bus.empty());
+
+      // All of the messages have been returned to the pool.
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        CHECK(allocator.allocate(pool_message_parameters::max_size, pool_message_parameters::max_alignment) != nullptr);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_addressed)
+    {
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      etl::async_message_bus<3, 4> bus;
+      etl::message_bus<1>          sub_bus;
+
+      Router1 router1;
+      Router2 router2;
+      Router1 router3(3U);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+      bus.subscribe(sub_bus);
+      sub_bus.subscribe(router3);
+
+      bus.post(RouterId2, etl::shared_message(pool, Message1(1)));
+      bus.post(3U, etl::shared_message(pool, Message1(2)));
+
+      // Router1 is not addressed, so only router 2 and the sub bus have messages.
+      CHECK_EQUAL(3U, bus.pending());
+      CHECK_EQUAL(3U, bus.process());
+
+      CHECK_EQUAL(0, router1.count_message1);
+      CHECK_EQUAL(1, router2.count_message1);
+      CHECK_EQUAL(1, router3.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_queue_full)
+    {
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      etl::async_message_bus<2, 2> bus;
+
+      Router1 router1;
+      Router2 router2;
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      CHECK(bus.post(etl::shared_message(pool, Message1(1))));
+      CHECK(bus.post(etl::shared_message(pool, Message2())));
+
+      // Router2's queue is still empty, but router1's is full.
+      CHECK(!bus.post(etl::shared_message(pool, Message1(2))));
+
+      CHECK_EQUAL(4U, bus.pending());
+      CHECK_EQUAL(4U, bus.process());
+
+      CHECK_EQUAL(1, router1.count_message1);
+      CHECK_EQUAL(1, router1.count_message2);
+      CHECK_EQUAL(2, router2.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_process_limits)
+    {
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      etl::async_message_bus<2, 8> bus;
+
+      Router1 router1;
+      Router2 router2;
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        bus.post(etl::shared_message(pool, Message1(i)));
+      }
+
+      // The queues are served in turn.
+      CHECK_EQUAL(3U, bus.process(3U));
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(1, router2.count_message1);
+
+      // Just one router's queue.
+      CHECK_EQUAL(3U, bus.process(router2));
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(4, router2.count_message1);
+
+      CHECK_EQUAL(2U, bus.process(router1, 5U));
+      CHECK_EQUAL(4, router1.count_message1);
+      CHECK(router1.is_ordered);
+
+      // Unsubscribing discards the queued messages.
+      bus.post(etl::shared_message(pool, Message1(4)));
+      bus.unsubscribe(router1);
+      CHECK_EQUAL(1U, bus.pending());
+      CHECK_EQUAL(0U, bus.process(router1));
+      CHECK_EQUAL(1U, bus.process());
+      CHECK_EQUAL(4, router1.count_message1);
+      CHECK_EQUAL(5, router2.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_message_not_shared)
+    {
+      etl::async_message_bus<1, 2> bus;
+
+      Router1 router1;
+      bus.subscribe(router1);
+
+      CHECK_THROW(bus.receive(Message2()), etl::async_message_bus_not_shared);
+      CHECK_THROW(bus.receive(RouterId1, Message2()), etl::async_message_bus_not_shared);
+    }
+
+    //*************************************************************************
+    TEST(test_producers_on_multiple_threads)
+    {
+      const size_t Threads    = 3U;
+      const int    Iterations = 5000;
+
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      etl::async_message_bus<1, 16> bus;
+
+      Router1 router1;
+      bus.subscribe(router1);
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&bus, &pool, Iterations]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            etl::shared_message message1(pool, Message1(i));
+
+            while (!bus.post(message1))
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      // The handlers only run on this thread.
+      while (router1.count_message1 < int(Threads * Iterations))
+      {
+        if (bus.process() == 0U)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(int(Threads * Iterations), router1.count_message1);
+      CHECK(bus.empty());
+
+      // All of the messages have been returned to the pool.
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        CHECK(allocator.allocate(pool_message_parameters::max_size, pool_message_parameters::max_alignment) != nullptr);
+      }
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,180 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/atomic_fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  using Allocator8  = etl::atomic_fixed_sized_memory_block_allocator<sizeof(int8_t),  alignof(int8_t),  4>;
+  using Allocator16 = etl::atomic_fixed_sized_memory_block_allocator<sizeof(int16_t), alignof(int16_t), 4>;
+  using Allocator32 = etl::atomic_fixed_sized_memory_block_allocator<sizeof(int32_t), alignof(int32_t), 4>;
+
+  constexpr etl::message_id_t MessageId1 = 1U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  SUITE(test_atomic_fixed_sized_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_allocator_no_successor_use_all_allocation)
+    {
+      Allocator16 allocator16;
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 == nullptr);
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(!allocator16.release(p5));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_too_large_or_misaligned)
+    {
+      Allocator16 allocator16;
+
+      CHECK(allocator16.allocate(sizeof(int32_t), alignof(int16_t)) == nullptr);
+      CHECK(allocator16.allocate(sizeof(int16_t), alignof(int32_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_different_block_sized_successors)
+    {
+      Allocator8  allocator8;
+      Allocator16 allocator16;
+      Allocator32 allocator32;
+
+      allocator8.set_successor(allocator16);
+      allocator16.set_successor(allocator32);
+
+      int8_t*  p1 = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator8
+      int16_t* p2 = static_cast<int16_t*>(allocator8.allocate(sizeof(int16_t), alignof(uint16_t))); // Take from allocator16
+      int32_t* p3 = static_cast<int32_t*>(allocator8.allocate(sizeof(int32_t), alignof(uint32_t))); // Take from allocator32
+      int64_t* p4 = static_cast<int64_t*>(allocator8.allocate(sizeof(int64_t), alignof(uint64_t))); // Unable to allocate
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 == nullptr);
+
+      CHECK(allocator8.is_owner_of(p1));
+      CHECK(allocator16.is_owner_of(p2));
+      CHECK(allocator32.is_owner_of(p3));
+
+      CHECK(allocator8.release(p1));
+      CHECK(allocator8.release(p2)); // Released by allocator16
+      CHECK(allocator8.release(p3)); // Released by allocator32
+    }
+
+    //*************************************************************************
+    TEST(test_shared_messages_on_multiple_threads)
+    {
+      const size_t Threads    = 4U;
+      const int    Iterations = 10000;
+
+      using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1>;
+
+      etl::atomic_fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                     pool_message_parameters::max_alignment,
+                                                     Threads> memory_allocator;
+
+      etl::atomic_counted_message_pool message_pool(memory_allocator);
+
+      std::vector<std::thread> threads;
+      bool                     errors[Threads] = { false };
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&message_pool, &errors, t, Iterations]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            etl::shared_message sm1(message_pool, Message1(i));
+            etl::shared_message sm2(sm1);
+
+            if ((sm2.get_reference_count() != 2) ||
+                (static_cast<const Message1&>(sm2.get_message()).i != i))
+            {
+              errors[t] = true;
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(!errors[t]);
+      }
+
+      // All of the blocks must have been returned.
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(memory_allocator.allocate(pool_message_parameters::max_size, pool_message_parameters::max_alignment) != nullptr);
+      }
+
+      CHECK(memory_allocator.allocate(pool_message_parameters::max_size, pool_message_parameters::max_alignment) == nullptr);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,395 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "etl/atomic_pool.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, int b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    std::string a;
+    int         b;
+  };
+
+  struct Item
+  {
+    uint32_t owner;
+    uint32_t count;
+  };
+
+  SUITE(test_atomic_pool)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::atomic_pool<uint32_t, 4> pool;
+
+      uint32_t* p1 = nullptr;
+      uint32_t* p2 = nullptr;
+      uint32_t* p3 = nullptr;
+      uint32_t* p4 = nullptr;
+
+      CHECK_NO_THROW(p1 = pool.allocate());
+      CHECK_NO_THROW(p2 = pool.allocate());
+      CHECK_NO_THROW(p3 = pool.allocate());
+      CHECK_NO_THROW(p4 = pool.allocate());
+
+      CHECK(p1 != p2);
+      CHECK(p1 != p3);
+      CHECK(p1 != p4);
+      CHECK(p2 != p3);
+      CHECK(p2 != p4);
+      CHECK(p3 != p4);
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_try_allocate)
+    {
+      etl::atomic_pool<uint32_t, 2> pool;
+
+      uint32_t* p1 = pool.try_allocate();
+      uint32_t* p2 = pool.try_allocate();
+      uint32_t* p3 = ETL_NULLPTR;
+
+      CHECK(p1 != ETL_NULLPTR);
+      CHECK(p2 != ETL_NULLPTR);
+      CHECK_NO_THROW(p3 = pool.try_allocate());
+      CHECK(p3 == ETL_NULLPTR);
+
+      pool.release(p1);
+
+      CHECK(pool.try_allocate() == p1);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::atomic_pool<uint32_t, 4> pool;
+
+      uint32_t* p1 = pool.allocate();
+      uint32_t* p2 = pool.allocate();
+      uint32_t* p3 = pool.allocate();
+      uint32_t* p4 = pool.allocate();
+
+      CHECK_NO_THROW(pool.release(p2));
+      CHECK_NO_THROW(pool.release(p3));
+      CHECK_NO_THROW(pool.release(p1));
+      CHECK_NO_THROW(pool.release(p4));
+
+      CHECK_EQUAL(4U, pool.available());
+
+      uint32_t not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::atomic_pool<uint32_t, 4> pool;
+
+      uint32_t* p1 = pool.allocate();
+      uint32_t* p2 = pool.allocate();
+      uint32_t* p3 = pool.allocate();
+      uint32_t* p4 = pool.allocate();
+
+      CHECK_EQUAL(0U, pool.available());
+
+      pool.release(p2);
+      pool.release(p3);
+
+      CHECK_EQUAL(2U, pool.available());
+
+      // The last released is the first reused.
+      uint32_t* p5 = pool.allocate();
+      uint32_t* p6 = pool.allocate();
+
+      CHECK(p5 == p3);
+      CHECK(p6 == p2);
+      CHECK(pool.full());
+
+      pool.release(p1);
+      pool.release(p4);
+      pool.release(p5);
+      pool.release(p6);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_size_available_empty_full)
+    {
+      etl::atomic_pool<uint32_t, 4> pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.capacity());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(4U, pool.available());
+      CHECK(pool.empty());
+      CHECK(!pool.full());
+
+      pool.allocate();
+      pool.allocate();
+
+      CHECK_EQUAL(2U, pool.size());
+      CHECK_EQUAL(2U, pool.available());
+      CHECK(!pool.empty());
+      CHECK(!pool.full());
+
+      pool.allocate();
+      pool.allocate();
+
+      CHECK_EQUAL(4U, pool.size());
+      CHECK_EQUAL(0U, pool.available());
+      CHECK(!pool.empty());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_is_in_pool)
+    {
+      etl::atomic_pool<uint32_t, 4> pool;
+      uint32_t not_in_pool;
+
+      uint32_t* p1 = pool.allocate();
+
+      CHECK(pool.is_in_pool(p1));
+      CHECK(!pool.is_in_pool(&not_in_pool));
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::atomic_pool<D2, 2> pool;
+
+      D2* p1 = pool.create("1", 1);
+      D2* p2 = pool.create("2", 2);
+
+      CHECK_EQUAL(std::string("1"), p1->a);
+      CHECK_EQUAL(1, p1->b);
+      CHECK_EQUAL(std::string("2"), p2->a);
+      CHECK_EQUAL(2, p2->b);
+      CHECK(pool.full());
+
+      pool.destroy(p1);
+      pool.destroy(p2);
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_generic_allocate)
+    {
+      etl::generic_atomic_pool<sizeof(uint64_t), etl::alignment_of<uint64_t>::value, 4> pool;
+
+      uint8_t*  p1 = pool.allocate<uint8_t>();
+      uint64_t* p2 = pool.allocate<uint64_t>();
+
+      CHECK(p1 != ETL_NULLPTR);
+      CHECK(p2 != ETL_NULLPTR);
+      CHECK_EQUAL(0U, (uintptr_t(p2) % etl::alignment_of<uint64_t>::value));
+      CHECK_EQUAL(2U, pool.size());
+
+      CHECK_THROW((pool.allocate<char[16]>()), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      etl::atomic_pool<Item, 8> pool;
+
+      Item* items[10];
+
+      CHECK_EQUAL(3U, pool.allocate_n(items, 3U));
+      CHECK_EQUAL(3U, pool.size());
+
+      // Only 5 left.
+      CHECK_EQUAL(5U, pool.allocate_n(items + 3, 7U));
+      CHECK(pool.full());
+      CHECK_EQUAL(0U, pool.allocate_n(items, 1U));
+
+      // All different.
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        CHECK(pool.is_in_pool(items[i]));
+
+        for (size_t j = i + 1U; j < 8U; ++j)
+        {
+          CHECK(items[i] != items[j]);
+        }
+      }
+
+      pool.release_n(items + 2, 4U);
+      CHECK_EQUAL(4U, pool.size());
+
+      // The released batch comes back in the same order.
+      Item* again[4];
+      CHECK_EQUAL(4U, pool.allocate_n(again, 4U));
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(again[i] == items[i + 2]);
+      }
+
+      pool.release_n(again, 4U);
+      pool.release_n(items, 2U);
+      pool.release_n(items + 6, 2U);
+      CHECK(pool.empty());
+
+      pool.release_n(items, 0U);
+      CHECK(pool.empty());
+
+      Item not_in_pool;
+      Item* bad[2] = { items[0], &not_in_pool };
+      CHECK_THROW(pool.release_n(bad, 2U), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads_batches)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 10000U;
+      const size_t Batch      = 3U;
+
+      etl::atomic_pool<Item, 16> pool;
+
+      std::vector<std::thread> threads;
+      bool                     errors[Threads] = { false };
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&pool, &errors, t, Iterations, Batch]()
+        {
+          Item* items[Batch];
+
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            const size_t n = pool.allocate_n(items, Batch);
+
+            for (size_t j = 0U; j < n; ++j)
+            {
+              items[j]->owner = uint32_t(t);
+              items[j]->count = uint32_t(i + j);
+            }
+
+            std::this_thread::yield();
+
+            for (size_t j = 0U; j < n; ++j)
+            {
+              if ((items[j]->owner != t) || (items[j]->count != (i + j)))
+              {
+                errors[t] = true;
+              }
+            }
+
+            pool.release_n(items, n);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(!errors[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 20000U;
+
+      etl::atomic_pool<Item, 8> pool;
+
+      std::vector<std::thread> threads;
+      bool                     errors[Threads] = { false };
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&pool, &errors, t, Iterations]()
+        {
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            Item* p_item = pool.allocate();
+
+            // No other thread may own the item while this one does.
+            p_item->owner = uint32_t(t);
+            p_item->count = uint32_t(i);
+
+            std::this_thread::yield();
+
+            if ((p_item->owner != t) || (p_item->count != i))
+            {
+              errors[t] = true;
+            }
+
+            pool.release(p_item);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(!errors[t]);
+      }
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(8U, pool.available());
+    }
+  };
+}
+
+#endif
@@ -1822,6 +1822,36 @@ namespace
 		  CHECK(!etl::is_even(1));
 		  CHECK(etl::is_even(2));
 	  }
+
+	  //*************************************************************************
+	  TEST(test_get_set_packed_bits)
+	  {
+		  uint8_t words[3] = { 0, 0, 0 };
+
+		  // Within a word.
+		  etl::set_packed_bits(words, 1U, 3U, uint8_t(0x05));
+		  CHECK_EQUAL(0x0AU, words[0]);
+		  CHECK_EQUAL(0x05U, etl::get_packed_bits(words, 1U, 3U));
+
+		  // Spanning two words.
+		  etl::set_packed_bits(words, 6U, 5U, uint8_t(0xFF)); // Extra bits ignored.
+		  CHECK_EQUAL(0xCAU, words[0]);
+		  CHECK_EQUAL(0x07U, words[1]);
+		  CHECK_EQUAL(0x1FU, etl::get_packed_bits(words, 6U, 5U));
+
+		  etl::set_packed_bits(words, 6U, 5U, uint8_t(0x12));
+		  CHECK_EQUAL(0x8AU, words[0]);
+		  CHECK_EQUAL(0x04U, words[1]);
+		  CHECK_EQUAL(0x12U, etl::get_packed_bits(words, 6U, 5U));
+		  CHECK_EQUAL(0x05U, etl::get_packed_bits(words, 1U, 3U));
+
+		  // A whole word, unaligned.
+		  etl::set_packed_bits(words, 12U, 8U, uint8_t(0xA5));
+		  CHECK_EQUAL(0x54U, words[1]);
+		  CHECK_EQUAL(0x0AU, words[2]);
+		  CHECK_EQUAL(0xA5U, etl::get_packed_bits(words, 12U, 8U));
+		  CHECK_EQUAL(0x12U, etl::get_packed_bits(words, 6U, 5U));
+	  }
   };
 }
 
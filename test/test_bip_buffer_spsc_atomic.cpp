@@ -0,0 +1,353 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/bip_buffer_spsc_atomic.h"
+
+#if ETL_HAS_ATOMIC && ETL_CPP11_SUPPORTED
+
+namespace
+{
+  typedef etl::bip_buffer_spsc_atomic<uint8_t, 10> Buffer;
+  typedef etl::ibip_buffer_spsc_atomic<uint8_t>    IBuffer;
+  typedef Buffer::span_type                        Span;
+
+  //***************************************************************************
+  void fill(Span span, uint8_t first)
+  {
+    for (size_t i = 0; i < span.size(); ++i)
+    {
+      span[i] = uint8_t(first + i);
+    }
+  }
+
+  //***************************************************************************
+  bool check(Span span, uint8_t first)
+  {
+    for (size_t i = 0; i < span.size(); ++i)
+    {
+      if (span[i] != uint8_t(first + i))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_bip_buffer_spsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Buffer buffer;
+
+      CHECK_EQUAL(10U, buffer.max_size());
+      CHECK_EQUAL(10U, buffer.capacity());
+      CHECK_EQUAL(0U, buffer.size());
+      CHECK_EQUAL(10U, buffer.available());
+      CHECK(buffer.empty());
+      CHECK(!buffer.full());
+      CHECK(buffer.read_reserve().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit_read)
+    {
+      Buffer buffer;
+      IBuffer& ibuffer = buffer;
+
+      Span reserve = ibuffer.write_reserve(4);
+      CHECK_EQUAL(4U, reserve.size());
+      fill(reserve, 1);
+
+      // Not visible until committed.
+      CHECK(ibuffer.empty());
+      CHECK(ibuffer.read_reserve().empty());
+
+      ibuffer.write_commit(reserve);
+      CHECK_EQUAL(4U, ibuffer.size());
+
+      reserve = ibuffer.write_reserve(3);
+      fill(reserve, 5);
+      ibuffer.write_commit(reserve);
+      CHECK_EQUAL(7U, ibuffer.size());
+
+      // Both records are read as one block.
+      Span read = ibuffer.read_reserve();
+      CHECK_EQUAL(7U, read.size());
+      CHECK(check(read, 1));
+
+      // Free the first record only.
+      ibuffer.read_commit(read.first(4));
+      CHECK_EQUAL(3U, ibuffer.size());
+
+      read = ibuffer.read_reserve();
+      CHECK_EQUAL(3U, read.size());
+      CHECK(check(read, 5));
+
+      ibuffer.read_commit(read);
+      CHECK(ibuffer.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_fills_buffer)
+    {
+      Buffer buffer;
+
+      Span reserve = buffer.write_reserve(10);
+      CHECK_EQUAL(10U, reserve.size());
+      fill(reserve, 0);
+      buffer.write_commit(reserve);
+
+      CHECK(buffer.full());
+      CHECK_EQUAL(0U, buffer.available());
+      CHECK(buffer.write_reserve(1).empty());
+      CHECK(buffer.write_reserve_max(10).empty());
+
+      Span read = buffer.read_reserve();
+      CHECK_EQUAL(10U, read.size());
+      CHECK(check(read, 0));
+      buffer.read_commit(read);
+
+      CHECK(buffer.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_wraps_without_splitting)
+    {
+      Buffer buffer;
+
+      Span reserve = buffer.write_reserve(8);
+      fill(reserve, 0);
+      buffer.write_commit(reserve);
+
+      buffer.read_commit(buffer.read_reserve(5));
+
+      // Only 2 free at the end, so the record goes to the start.
+      reserve = buffer.write_reserve(4);
+      CHECK_EQUAL(4U, reserve.size());
+      fill(reserve, 10);
+      buffer.write_commit(reserve);
+
+      CHECK_EQUAL(7U, buffer.size());
+
+      // The write index must not catch up with the read index.
+      CHECK(buffer.write_reserve(1).empty());
+
+      // The end of the first lap is read first.
+      Span read = buffer.read_reserve();
+      CHECK_EQUAL(3U, read.size());
+      CHECK(check(read, 5));
+      buffer.read_commit(read);
+
+      // The skipped end of the buffer is not read.
+      read = buffer.read_reserve();
+      CHECK_EQUAL(4U, read.size());
+      CHECK(check(read, 10));
+      buffer.read_commit(read);
+
+      CHECK(buffer.empty());
+
+      // Back at the end of the buffer.
+      reserve = buffer.write_reserve(6);
+      CHECK_EQUAL(6U, reserve.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_too_large)
+    {
+      Buffer buffer;
+
+      CHECK(buffer.write_reserve(11).empty());
+
+      Span reserve = buffer.write_reserve(8);
+      buffer.write_commit(reserve);
+      buffer.read_commit(buffer.read_reserve(3));
+
+      // 2 at the end and 2 at the start.
+      CHECK(buffer.write_reserve(3).empty());
+      CHECK_EQUAL(2U, buffer.write_reserve(2).size());
+      CHECK_EQUAL(2U, buffer.write_reserve_max(5).size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_max)
+    {
+      Buffer buffer;
+
+      Span reserve = buffer.write_reserve_max(4);
+      CHECK_EQUAL(4U, reserve.size());
+      buffer.write_commit(reserve);
+
+      reserve = buffer.write_reserve_max(20);
+      CHECK_EQUAL(6U, reserve.size());
+
+      // Commit only part of the reserve.
+      fill(reserve, 4);
+      buffer.write_commit(reserve.first(2));
+      CHECK_EQUAL(6U, buffer.size());
+
+      buffer.read_commit(buffer.read_reserve());
+
+      // 4 at the end, 5 at the start. The larger block is used.
+      reserve = buffer.write_reserve_max(20);
+      CHECK_EQUAL(5U, reserve.size());
+      fill(reserve, 20);
+      buffer.write_commit(reserve);
+
+      Span read = buffer.read_reserve();
+      CHECK_EQUAL(5U, read.size());
+      CHECK(check(read, 20));
+    }
+
+    //*************************************************************************
+    TEST(test_read_reserve_max)
+    {
+      Buffer buffer;
+
+      Span reserve = buffer.write_reserve(6);
+      fill(reserve, 0);
+      buffer.write_commit(reserve);
+
+      Span read = buffer.read_reserve(4);
+      CHECK_EQUAL(4U, read.size());
+      CHECK(check(read, 0));
+      buffer.read_commit(read);
+
+      read = buffer.read_reserve(4);
+      CHECK_EQUAL(2U, read.size());
+      CHECK(check(read, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_commit_invalid)
+    {
+      Buffer buffer;
+
+      Span reserve = buffer.write_reserve(4);
+
+      CHECK_THROW(buffer.write_commit(reserve.subspan(1)), etl::bip_buffer_reserve_invalid);
+
+      buffer.write_commit(reserve);
+
+      Span read = buffer.read_reserve();
+
+      CHECK_THROW(buffer.read_commit(read.subspan(1)), etl::bip_buffer_reserve_invalid);
+      CHECK_EQUAL(4U, buffer.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Buffer buffer;
+
+      buffer.write_commit(buffer.write_reserve(7));
+      buffer.read_commit(buffer.read_reserve(5));
+      buffer.write_commit(buffer.write_reserve(4));
+
+      CHECK_EQUAL(6U, buffer.size());
+
+      buffer.clear();
+
+      CHECK(buffer.empty());
+      CHECK(buffer.read_reserve().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_records_threads)
+    {
+      // Records of 1 to 7 bytes. The first byte is the length.
+      etl::bip_buffer_spsc_atomic<uint8_t, 32> buffer;
+
+      const int Count = 20000;
+
+      std::thread producer([&buffer]()
+      {
+        for (int i = 0; i < Count; ++i)
+        {
+          uint8_t length = uint8_t((i % 7) + 1);
+
+          Span reserve;
+
+          while ((reserve = buffer.write_reserve(length)).empty())
+          {
+            std::this_thread::yield();
+          }
+
+          reserve[0] = length;
+
+          for (size_t j = 1; j < length; ++j)
+          {
+            reserve[j] = uint8_t(i);
+          }
+
+          buffer.write_commit(reserve);
+        }
+      });
+
+      int  received = 0;
+      bool valid    = true;
+
+      while (received < Count)
+      {
+        Span read = buffer.read_reserve();
+
+        if (read.empty())
+        {
+          std::this_thread::yield();
+          continue;
+        }
+
+        // Read one record.
+        uint8_t length = read[0];
+        valid = valid && (length == uint8_t((received % 7) + 1)) && (length <= read.size());
+
+        for (size_t j = 1; valid && (j < length); ++j)
+        {
+          valid = (read[j] == uint8_t(received));
+        }
+
+        buffer.read_commit(read.first(length));
+        ++received;
+      }
+
+      producer.join();
+
+      CHECK(valid);
+      CHECK(buffer.empty());
+    }
+  };
+}
+
+#endif
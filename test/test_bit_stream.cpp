@@ -1067,5 +1067,156 @@ namespace
       CHECK(bit_stream.get(rd));
       CHECK_CLOSE(f, rd, 0.1f);
     }
+      //*************************************************************************
+    TEST(writer_matches_bit_stream)
+    {
+      std::array<unsigned char, 512> expected;
+      std::array<unsigned char, 512> actual;
+      expected.fill(0);
+      actual.fill(0);
+
+      etl::bit_stream       bit_stream(expected.data(), expected.size());
+      etl::bit_stream_writer writer(actual.data(), actual.size());
+
+      uint32_t state = 1U;
+
+      for (int i = 0; i < 150; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+        const uint_least8_t width = uint_least8_t(1U + ((state >> 24) % 32U));
+        const uint32_t value = state * 2654435761U;
+
+        CHECK(bit_stream.put(value, width));
+        CHECK(writer.write(value, width));
+      }
+
+      const uint64_t value64 = 0x123456789ABCDEF0ULL;
+      CHECK(bit_stream.put(value64, 47));
+      CHECK(writer.write(value64, 47));
+
+      writer.flush();
+
+      CHECK_EQUAL(bit_stream.bits(), writer.size_bits());
+      CHECK_EQUAL(bit_stream.size(), writer.size_bytes());
+      CHECK(std::equal(expected.begin(), expected.begin() + bit_stream.size(), actual.begin()));
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_round_trip)
+    {
+      std::array<unsigned char, 1024> buffer;
+      buffer.fill(0);
+
+      etl::bit_stream_writer writer(buffer.data(), buffer.size());
+
+      uint32_t state = 7U;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+        const uint_least8_t width = uint_least8_t(1U + ((state >> 24) % 64U));
+        const uint64_t value = (uint64_t(state) << 32) | (state * 2654435761U);
+
+        CHECK(writer.write(value, width));
+      }
+
+      CHECK(writer.write(true));
+      CHECK(writer.write(int16_t(-5), 5));
+      CHECK(writer.write(int64_t(-1234567890123LL)));
+
+      writer.flush();
+
+      etl::bit_stream_reader reader(buffer.data(), writer.size_bytes());
+
+      state = 7U;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+        const uint_least8_t width = uint_least8_t(1U + ((state >> 24) % 64U));
+        const uint64_t value = (uint64_t(state) << 32) | (state * 2654435761U);
+        const uint64_t mask  = (width == 64U) ? ~uint64_t(0U) : ((uint64_t(1U) << width) - 1U);
+
+        uint64_t result = 0U;
+        CHECK(reader.read(result, width));
+        CHECK_EQUAL(value & mask, result);
+      }
+
+      bool     b   = false;
+      int16_t  i16 = 0;
+      int64_t  i64 = 0;
+      CHECK(reader.read(b));
+      CHECK(b);
+      CHECK(reader.read(i16, 5));
+      CHECK_EQUAL(-5, i16);
+      CHECK(reader.read(i64));
+      CHECK_EQUAL(-1234567890123LL, i64);
+
+      CHECK_EQUAL(writer.size_bits(), reader.position_bits());
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_bytes)
+    {
+      std::array<unsigned char, 64> buffer;
+      buffer.fill(0);
+
+      unsigned char bytes[20];
+      std::iota(bytes, bytes + 20, 1);
+
+      etl::bit_stream_writer writer(buffer.data(), buffer.size());
+
+      // Aligned, then unaligned.
+      CHECK(writer.write(uint8_t(0xAB)));
+      CHECK(writer.write_bytes(bytes, 20));
+      CHECK(writer.write(uint8_t(0x5), 3));
+      CHECK(writer.write_bytes(bytes, 20));
+      writer.flush();
+
+      etl::bit_stream_reader reader(buffer.data(), writer.size_bytes());
+
+      unsigned char result[20];
+      uint8_t u8 = 0U;
+
+      CHECK(reader.read(u8));
+      CHECK_EQUAL(0xAB, u8);
+      CHECK(reader.read_bytes(result, 20));
+      CHECK(std::equal(bytes, bytes + 20, result));
+      CHECK(reader.read(u8, 3));
+      CHECK_EQUAL(0x5, u8);
+      CHECK(reader.read_bytes(result, 20));
+      CHECK(std::equal(bytes, bytes + 20, result));
+    }
+
+    //*************************************************************************
+    TEST(writer_reader_limits)
+    {
+      std::array<unsigned char, 3> buffer;
+      buffer.fill(0);
+
+      etl::bit_stream_writer writer(buffer.data(), buffer.size());
+
+      CHECK(writer.write(uint16_t(0x1234)));
+      CHECK(!writer.write(uint16_t(0x5678)));
+      CHECK(writer.write(uint8_t(0x1), 1));
+      writer.flush();
+      CHECK_EQUAL(0x80, buffer[2]);
+
+      // Carry on after a flush.
+      CHECK(writer.write(uint8_t(0x7F), 7));
+      CHECK_EQUAL(0U, writer.available_bits());
+      writer.flush();
+      CHECK_EQUAL(0xFF, buffer[2]);
+
+      etl::bit_stream_reader reader(buffer.data(), buffer.size());
+
+      uint32_t u32 = 0U;
+      CHECK(!reader.read(u32));
+      CHECK(reader.skip(16));
+      CHECK(reader.read(u32, 8));
+      CHECK_EQUAL(0xFFU, u32);
+      CHECK(reader.at_end());
+      CHECK(!reader.read(u32, 1));
+    }
   };
 }
@@ -31,13 +31,39 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <vector>
 
 #include "etl/bitset.h"
 
 namespace
 {
+#if ETL_HAS_CONSTEXPR_BITSET
+  // Constant initialised, so may be placed in ROM.
+  constexpr etl::bitset<70> rom_bits(0x8000000000000005ULL);
+
+  static_assert(rom_bits.size() == 70U, "Wrong size");
+  static_assert(rom_bits.test(0) && !rom_bits.test(1) && rom_bits.test(2) && rom_bits.test(63), "Wrong bits");
+  static_assert(!rom_bits[64], "Wrong bits");
+#endif
+
   SUITE(test_bitset)
   {
+#if ETL_HAS_CONSTEXPR_BITSET
+    //*************************************************************************
+    TEST(test_constexpr_constructor)
+    {
+      std::bitset<70> compare(0x8000000000000005ULL);
+
+      CHECK_EQUAL(compare.count(), rom_bits.count());
+      CHECK(std::is_trivially_destructible<etl::bitset<70>>::value);
+
+      static constexpr etl::bitset<70> copy(rom_bits);
+      static_assert(copy.test(63), "Wrong bits");
+
+      CHECK(copy == rom_bits);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_constructor)
     {
@@ -1064,32 +1090,181 @@ namespace
     TEST(test_span)
     {
       using span_t = etl::ibitset::span_type;
+      using element_t = span_t::value_type;
+
+      const size_t Bits = etl::integral_limits<element_t>::bits;
 
       etl::bitset<32> b(0x12345678);
 
       span_t s = b.span();
-      CHECK_EQUAL(0x78, s[0]);
-      CHECK_EQUAL(0x56, s[1]);
-      CHECK_EQUAL(0x34, s[2]);
-      CHECK_EQUAL(0x12, s[3]);
+      CHECK_EQUAL((32U + Bits - 1U) / Bits, s.size());
 
-      s[2] = 0x9A;
+      for (size_t i = 0U; i < s.size(); ++i)
+      {
+        CHECK_EQUAL(element_t((0x12345678ULL >> (i * Bits)) & etl::integral_limits<element_t>::max), s[i]);
+      }
+
+      s[0] ^= 0x0F;
       uint32_t value = b.value<uint32_t>();
-      CHECK_EQUAL(0x129A5678, value);
+      CHECK_EQUAL(0x12345677U, value);
     }
 
     //*************************************************************************
     TEST(test_const_span)
     {
       using span_t = etl::ibitset::const_span_type;
+      using element_t = std::remove_const<span_t::value_type>::type;
+
+      const size_t Bits = etl::integral_limits<element_t>::bits;
 
       const etl::bitset<32> b(0x12345678);
 
       span_t s = b.span();
-      CHECK_EQUAL(0x78, s[0]);
-      CHECK_EQUAL(0x56, s[1]);
-      CHECK_EQUAL(0x34, s[2]);
-      CHECK_EQUAL(0x12, s[3]);
+
+      for (size_t i = 0U; i < s.size(); ++i)
+      {
+        CHECK_EQUAL(element_t((0x12345678ULL >> (i * Bits)) & etl::integral_limits<element_t>::max), s[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_large_bitset)
+    {
+      etl::bitset<4096> data;
+      std::bitset<4096> compare;
+
+      for (size_t i = 0U; i < 4096U; i += (i % 7U) + (i / 300U) + 1U)
+      {
+        data.set(i);
+        compare.set(i);
+      }
+
+      CHECK_EQUAL(compare.count(), data.count());
+
+      for (int s = 0; s < 2; ++s)
+      {
+        const bool state = (s == 1);
+
+        for (size_t position = 0U; position <= 4096U; ++position)
+        {
+          size_t expected = position;
+
+          while ((expected < 4096U) && (compare.test(expected) != state))
+          {
+            ++expected;
+          }
+
+          if (expected == 4096U)
+          {
+            expected = etl::ibitset::npos;
+          }
+
+          CHECK_EQUAL(expected, data.find_next(state, position));
+        }
+      }
+
+      data.set();
+      CHECK_EQUAL(4096U, data.count());
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
+      CHECK_EQUAL(0U, data.find_first(true));
+    }
+
+    //*************************************************************************
+    struct collect_positions
+    {
+      collect_positions(std::vector<size_t>& positions_)
+        : positions(positions_)
+      {
+      }
+
+      void operator()(size_t position)
+      {
+        positions.push_back(position);
+      }
+
+      std::vector<size_t>& positions;
+    };
+
+    TEST(test_for_each_set_bit)
+    {
+      etl::bitset<1000> data;
+      std::vector<size_t> expected;
+
+      for (size_t i = 0U; i < 1000U; i += (i % 5U) + 1U)
+      {
+        data.set(i);
+        expected.push_back(i);
+      }
+
+      data.set(999);
+      expected.push_back(999);
+
+      std::vector<size_t> positions;
+      data.for_each_set_bit(collect_positions(positions));
+
+      CHECK_EQUAL(expected.size(), positions.size());
+      CHECK(expected == positions);
+
+      etl::bitset<1000> empty;
+      positions.clear();
+      empty.for_each_set_bit(collect_positions(positions));
+      CHECK(positions.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_and_count_and_intersects)
+    {
+      etl::bitset<1000> data1;
+      etl::bitset<1000> data2;
+      std::bitset<1000> compare1;
+      std::bitset<1000> compare2;
+
+      CHECK_EQUAL(0U, data1.and_count(data2));
+      CHECK(!data1.intersects(data2));
+
+      for (size_t i = 0U; i < 1000U; i += 3U)
+      {
+        data1.set(i);
+        compare1.set(i);
+      }
+
+      for (size_t i = 0U; i < 1000U; i += 5U)
+      {
+        data2.set(i + 1U);
+        compare2.set(i + 1U);
+      }
+
+      CHECK_EQUAL((compare1 & compare2).count(), data1.and_count(data2));
+      CHECK_EQUAL((compare1 & compare2).count(), data2.and_count(data1));
+      CHECK(data1.intersects(data2));
+
+      etl::bitset<1000> data3;
+      data3.set(998);
+      CHECK(!data1.intersects(data3));
+      CHECK_EQUAL(0U, data1.and_count(data3));
+
+      data3.set(999);
+      CHECK(data1.intersects(data3));
+      CHECK_EQUAL(1U, data1.and_count(data3));
+    }
+
+    //*************************************************************************
+    TEST(test_unused_top_bits_stay_clear)
+    {
+      etl::bitset<5> data("10101");
+
+      etl::bitset<5> inverted = ~data;
+      CHECK_EQUAL(2U, inverted.count());
+      CHECK_EQUAL(0x0AU, inverted.value<uint8_t>());
+      CHECK_EQUAL(etl::ibitset::npos, inverted.find_next(true, 4));
+
+      data <<= 2;
+      CHECK_EQUAL(2U, data.count());
+      CHECK_EQUAL(0x14U, data.value<uint8_t>());
+      CHECK(data == etl::bitset<5>("10100"));
+
+      data.set();
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
     }
   };
 }
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <vector>
+#include <iterator>
 #include <string.h>
 
 #include "etl/bloom_filter.h"
@@ -260,6 +261,268 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<256, 4, hash1_t, hash2_t> bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      size_t usage = bloom.usage();
+      CHECK(usage > 0);
+      CHECK(usage < 100);
+
+      // Each key sets at most K bits.
+      size_t count = bloom.count();
+      CHECK(count > 0);
+      CHECK(count <= (exist_text.size() * 4));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_width)
+    {
+      typedef etl::blocked_bloom_filter<256, 4, hash1_t, hash2_t> Bloom1;
+      typedef etl::blocked_bloom_filter<4096, 4, hash1_t, hash2_t> Bloom2;
+      typedef etl::blocked_bloom_filter<5000, 4, hash1_t, hash2_t> Bloom3;
+
+      CHECK_EQUAL(512U, Bloom1().width());
+      CHECK_EQUAL(1,    int(Bloom1::NUMBER_OF_BLOCKS));
+      CHECK_EQUAL(4096U, Bloom2().width());
+      CHECK_EQUAL(8,    int(Bloom2::NUMBER_OF_BLOCKS));
+      CHECK_EQUAL(8192U, Bloom3().width());
+      CHECK_EQUAL(16,   int(Bloom3::NUMBER_OF_BLOCKS));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_exists_range)
+    {
+      etl::blocked_bloom_filter<4096, 6, hash1_t, hash2_t> bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      std::vector<const char*> keys;
+
+      // More keys than one batch, mixing present and absent.
+      for (size_t i = 0; i < 3; ++i)
+      {
+        keys.insert(keys.end(), exist_text.begin(), exist_text.end());
+        keys.insert(keys.end(), not_exist_text.begin(), not_exist_text.end());
+      }
+
+      std::vector<bool> results;
+      bloom.exists(keys.begin(), keys.end(), std::back_inserter(results));
+
+      CHECK_EQUAL(keys.size(), results.size());
+
+      for (size_t i = 0; i < keys.size(); ++i)
+      {
+        CHECK_EQUAL(bloom.exists(keys[i]), bool(results[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_clear)
+    {
+      etl::blocked_bloom_filter<1024, 4, hash1_t, hash2_t> bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      bloom.clear();
+
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0U, bloom.count());
+
+      bool any_exist = false;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter)
+    {
+      etl::counting_bloom_filter<256, hash1_t, hash2_t, hash3_t> bloom;
+
+      CHECK_EQUAL(256U, bloom.width());
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Check for false negatives.
+      bool all_exist = true;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      size_t count = bloom.count();
+      CHECK(count > 0);
+      CHECK(count < 256);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter_remove)
+    {
+      etl::counting_bloom_filter<256, hash1_t, hash2_t, hash3_t> bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      // Remove the first half.
+      const size_t half = exist_text.size() / 2;
+
+      for (size_t i = 0; i < half; ++i)
+      {
+        bloom.remove(exist_text[i]);
+      }
+
+      // The remaining keys must still exist.
+      bool all_exist = true;
+
+      for (size_t i = half; i < exist_text.size(); ++i)
+      {
+        all_exist = all_exist && bloom.exists(exist_text[i]);
+      }
+
+      CHECK(all_exist);
+
+      // Removing the rest empties the filter.
+      for (size_t i = half; i < exist_text.size(); ++i)
+      {
+        bloom.remove(exist_text[i]);
+      }
+
+      CHECK_EQUAL(0U, bloom.count());
+
+      // Removing a key that does not exist does nothing.
+      bloom.add(exist_text[0]);
+      size_t count = bloom.count();
+      bloom.remove(not_exist_text[0]);
+      CHECK_EQUAL(count, bloom.count());
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter_saturation)
+    {
+      etl::counting_bloom_filter<64, hash1_t> bloom;
+
+      // Saturate the counter.
+      for (size_t i = 0; i < 20; ++i)
+      {
+        bloom.add(exist_text[0]);
+      }
+
+      // A saturated counter is never decremented.
+      for (size_t i = 0; i < 20; ++i)
+      {
+        bloom.remove(exist_text[0]);
+      }
+
+      CHECK(bloom.exists(exist_text[0]));
+
+      bloom.clear();
+      CHECK(!bloom.exists(exist_text[0]));
+      CHECK_EQUAL(0U, bloom.count());
+    }
+
+    //*************************************************************************
+    TEST(test_partitioned_bloom_filter)
+    {
+      etl::partitioned_bloom_filter<256, 3, hash1_t, hash2_t> bloom;
+
+      CHECK_EQUAL(256U, bloom.width());
+      CHECK_EQUAL(3U, bloom.number_of_partitions());
+
+      CHECK(!bloom.test_and_add(exist_text[0]));
+      CHECK(bloom.test_and_add(exist_text[0]));
+
+      bloom.advance();
+      bloom.add(exist_text[1]);
+
+      bloom.advance();
+      bloom.add(exist_text[2]);
+
+      // All three windows are still remembered.
+      CHECK(bloom.exists(exist_text[0]));
+      CHECK(bloom.exists(exist_text[1]));
+      CHECK(bloom.exists(exist_text[2]));
+
+      // The oldest window is forgotten.
+      bloom.advance();
+      CHECK(!bloom.exists(exist_text[0]));
+      CHECK(bloom.exists(exist_text[1]));
+      CHECK(bloom.exists(exist_text[2]));
+
+      bloom.advance();
+      CHECK(!bloom.exists(exist_text[1]));
+      CHECK(bloom.exists(exist_text[2]));
+
+      // Check for false positives. There should be none for this set.
+      bool any_exist = false;
+
+      for (size_t i = 0; i < not_exist_text.size(); ++i)
+      {
+        any_exist = any_exist || bloom.exists(not_exist_text[i]);
+      }
+
+      CHECK(!any_exist);
+
+      bloom.clear();
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK(!bloom.exists(exist_text[2]));
+    }
   };
 }
 
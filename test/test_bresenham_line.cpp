@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/bresenham_line.h"
 
 #include <vector>
+#include <algorithm>
+#include <cstdlib>
 
 namespace etl
 {
@@ -432,5 +434,99 @@ namespace
       CHECK(bl1 != bl4);
       CHECK(!(bl1 == bl4));
     }
+
+    //*************************************************************************
+    TEST(test_points_and_runs)
+    {
+      const Point ends[] = { Point{ 0, 0 }, Point{ 7, 2 }, Point{ -9, 4 }, Point{ 3, -11 }, Point{ -6, -6 },
+                             Point{ 12, 0 }, Point{ 0, -5 }, Point{ 10, 9 }, Point{ -1, 13 }, Point{ 2, 1 } };
+
+      for (const Point& first : ends)
+      {
+        for (const Point& last : ends)
+        {
+          // The iterators do not reach the end of 45 degree lines.
+          if ((first != last) && (std::abs(last.x - first.x) == std::abs(last.y - first.y)))
+          {
+            continue;
+          }
+
+          std::vector<Point> expected;
+
+          BresenhamLine line(first, last);
+
+          for (BresenhamLine::const_iterator itr = line.begin(); itr != line.end(); ++itr)
+          {
+            expected.push_back(*itr);
+          }
+
+          // Points
+          BresenhamLine batch(first, last);
+          std::vector<Point> points(batch.size() + 3U);
+
+          CHECK_EQUAL(expected.size(), batch.size());
+          CHECK_EQUAL(expected.size(), batch.points(etl::span<Point>(points.data(), points.size())));
+          CHECK(std::equal(expected.begin(), expected.end(), points.begin()));
+
+          // Stops when the output is full.
+          std::vector<Point> partial((expected.size() + 1U) / 2U);
+          CHECK_EQUAL(partial.size(), batch.points(etl::span<Point>(partial.data(), partial.size())));
+          CHECK(std::equal(partial.begin(), partial.end(), expected.begin()));
+
+          // Runs, which together make the same points.
+          std::vector<BresenhamLine::run> runs(batch.run_count() + 1U);
+          const size_t run_count = batch.runs(etl::span<BresenhamLine::run>(runs.data(), runs.size()));
+
+          CHECK_EQUAL(batch.run_count(), run_count);
+
+          const bool x_major = std::abs(last.x - first.x) >= std::abs(last.y - first.y);
+          std::vector<Point> from_runs;
+
+          for (size_t i = 0U; i < run_count; ++i)
+          {
+            for (size_t j = 0U; j < runs[i].length; ++j)
+            {
+              from_runs.push_back(x_major ? Point{ Value(runs[i].start.x + j), runs[i].start.y }
+                                          : Point{ runs[i].start.x, Value(runs[i].start.y + j) });
+            }
+          }
+
+          std::vector<Point> sorted_expected = expected;
+          auto compare = [](const Point& a, const Point& b) { return (a.x < b.x) || ((a.x == b.x) && (a.y < b.y)); };
+
+          std::sort(sorted_expected.begin(), sorted_expected.end(), compare);
+          std::sort(from_runs.begin(), from_runs.end(), compare);
+
+          CHECK(sorted_expected == from_runs);
+
+          // Stops when the output is full.
+          CHECK_EQUAL(1U, batch.runs(etl::span<BresenhamLine::run>(runs.data(), 1U)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_runs_of_horizontal_line)
+    {
+      BresenhamLine line(Point{ 10, 0 }, Point{ 0, 3 });
+
+      BresenhamLine::run runs[4];
+
+      CHECK_EQUAL(4U, line.run_count());
+      CHECK_EQUAL(4U, line.runs(etl::span<BresenhamLine::run>(runs)));
+
+      // Each run starts at its lowest x, although the line runs right to left.
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK_EQUAL(int(i), int(runs[i].start.y));
+        total += runs[i].length;
+      }
+
+      CHECK_EQUAL(11U, total);
+      CHECK_EQUAL(int(11 - runs[0].length), int(runs[0].start.x));
+      CHECK_EQUAL(0, int(runs[3].start.x));
+    }
   };
 }
@@ -0,0 +1,641 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/btree_map.h"
+
+namespace
+{
+  //*************************************************************************
+  // A key large enough that every node holds the minimum of four entries,
+  // so that small maps have several levels.
+  struct big_key
+  {
+    big_key()
+      : value(0)
+    {
+    }
+
+    big_key(int value_)
+      : value(value_)
+    {
+      std::fill_n(padding, sizeof(padding), char(value_));
+    }
+
+    friend bool operator <(const big_key& lhs, const big_key& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    friend bool operator ==(const big_key& lhs, const big_key& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int  value;
+    char padding[ETL_BTREE_NODE_SIZE];
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+
+  SUITE(test_btree_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::btree_map<std::string, NDC, SIZE> DataNDC;
+    typedef etl::ibtree_map<std::string, NDC>      IDataNDC;
+
+    typedef etl::btree_map<big_key, int, 1000>     DataBig;
+
+    NDC N0  = NDC("A");
+    NDC N1  = NDC("B");
+    NDC N2  = NDC("C");
+    NDC N3  = NDC("D");
+    NDC N4  = NDC("E");
+    NDC N5  = NDC("F");
+    NDC N6  = NDC("G");
+    NDC N7  = NDC("H");
+    NDC N8  = NDC("I");
+    NDC N9  = NDC("J");
+    NDC N10 = NDC("K");
+
+    std::string K[] = { "FF", "FG", "FH", "FI", "FJ", "FK", "FL", "FM", "FN", "FO", "FP" };
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+
+    //*************************************************************************
+    template <typename TMap>
+    bool Check_Contents(const TMap& data, const std::vector<ElementNDC>& compare)
+    {
+      std::map<std::string, NDC> sorted(compare.begin(), compare.end());
+
+      return (data.size() == sorted.size()) && std::equal(sorted.begin(), sorted.end(), data.begin());
+    }
+
+    //*************************************************************************
+    template <typename TMap, typename TCompare>
+    bool Check_Order(const TMap& data, const TCompare& compare)
+    {
+      if ((data.size() != compare.size()) ||
+          (size_t(std::distance(data.begin(), data.end())) != compare.size()) ||
+          (size_t(std::distance(data.rbegin(), data.rend())) != compare.size()))
+      {
+        return false;
+      }
+
+      typename TCompare::const_iterator other = compare.begin();
+
+      for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr, ++other)
+      {
+        if (!(itr->first == other->first) || !(itr->second == other->second))
+        {
+          return false;
+        }
+      }
+
+      typename TCompare::const_reverse_iterator rother = compare.rbegin();
+
+      for (typename TMap::const_reverse_iterator itr = data.rbegin(); itr != data.rend(); ++itr, ++rother)
+      {
+        if (!(itr->first == rother->first))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(K[5], N5), ElementNDC(K[1], N1), ElementNDC(K[8], N8), ElementNDC(K[3], N3), ElementNDC(K[0], N0),
+          ElementNDC(K[9], N9), ElementNDC(K[6], N6), ElementNDC(K[2], N2), ElementNDC(K[7], N7), ElementNDC(K[4], N4)
+        };
+
+        ElementNDC n2[] =
+        {
+          ElementNDC(K[5], N5), ElementNDC(K[1], N1), ElementNDC(K[8], N8), ElementNDC(K[3], N3), ElementNDC(K[0], N0),
+          ElementNDC(K[9], N9), ElementNDC(K[6], N6), ElementNDC(K[2], N2), ElementNDC(K[7], N7), ElementNDC(K[4], N4),
+          ElementNDC(K[10], N10)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_node_capacity)
+    {
+      typedef etl::private_btree::btree_nodes<ETL_OR_STD::pair<const int, int>, int> IntNodes;
+      typedef etl::private_btree::btree_nodes<big_key, big_key>                     BigNodes;
+
+      CHECK(IntNodes::Leaf_Capacity > 4U);
+      CHECK(IntNodes::Internal_Capacity > 4U);
+      CHECK(sizeof(IntNodes::leaf_node) <= ETL_BTREE_NODE_SIZE);
+      CHECK(sizeof(IntNodes::internal_node) <= ETL_BTREE_NODE_SIZE);
+
+      CHECK_EQUAL(4U, BigNodes::Leaf_Capacity);
+      CHECK_EQUAL(2U, BigNodes::Leaf_Minimum);
+      CHECK_EQUAL(4U, BigNodes::Internal_Capacity);
+      CHECK_EQUAL(1U, BigNodes::Internal_Minimum);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(0U, data.depth());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      DataNDC data = { ElementNDC(K[4], N4), ElementNDC(K[0], N0), ElementNDC(K[2], N2) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(K[0], data.begin()->first);
+      CHECK_EQUAL(N2, data.at(K[2]));
+      CHECK_EQUAL(K[4], data.rbegin()->first);
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(data1);
+
+      CHECK(data1 == data2);
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(std::move(data1));
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      data2 = data1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_self_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC& other = data;
+
+      data = other;
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      etl::btree_map<std::string, int, SIZE> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[K[i]] = i;
+      }
+
+      CHECK_EQUAL(3, data[K[3]]);
+
+      data[K[3]] = 10;
+
+      CHECK_EQUAL(10, data[K[3]]);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_THROW(data[K[10]], etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        CHECK_EQUAL(initial_data[i].second, data.at(initial_data[i].first));
+        CHECK_EQUAL(initial_data[i].second, cdata.at(initial_data[i].first));
+      }
+
+      CHECK_THROW(data.at(K[10]), etl::btree_map_out_of_range);
+      CHECK_THROW(cdata.at(K[10]), etl::btree_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC(K[0], N0));
+
+      CHECK(result.second);
+      CHECK_EQUAL(K[0], result.first->first);
+      CHECK_EQUAL(N0, result.first->second);
+
+      // Existing keys are not replaced.
+      result = data.insert(ElementNDC(K[0], N1));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N0, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      DataNDC::iterator itr = data.insert(data.begin(), ElementNDC(K[1], N1));
+
+      CHECK_EQUAL(K[1], itr->first);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(ElementNDC(K[10], N10)), etl::btree_map_full);
+
+      // Existing keys may still be found when full.
+      CHECK(!data.insert(ElementNDC(K[0], N10)).second);
+
+      CHECK_THROW(data.assign(excess_data.begin(), excess_data.end()), etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K[5]));
+      CHECK_EQUAL(0U, data.erase(K[5]));
+      CHECK_EQUAL(SIZE - 1, data.size());
+      CHECK(data.find(K[5]) == data.end());
+
+      std::vector<ElementNDC> compare(initial_data);
+      compare.erase(compare.begin());
+
+      CHECK(Check_Contents(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single_iterator)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.erase(data.find(K[2]));
+
+      CHECK_EQUAL(K[3], itr->first);
+      CHECK(data.find(K[2]) == data.end());
+      CHECK_EQUAL(SIZE - 1, data.size());
+
+      itr = data.erase(data.find(K[9]));
+
+      CHECK(itr == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.erase(data.find(K[3]), data.find(K[7]));
+
+      CHECK_EQUAL(K[7], itr->first);
+      CHECK_EQUAL(SIZE - 4, data.size());
+
+      for (size_t i = 3; i < 7; ++i)
+      {
+        CHECK(!data.contains(K[i]));
+      }
+
+      CHECK(data.erase(data.begin(), data.end()) == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterate_in_order)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Order(data, compare));
+
+      DataNDC::const_iterator itr = data.end();
+      --itr;
+
+      CHECK_EQUAL(K[9], itr->first);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_bounds)
+    {
+      etl::btree_map<int, int, 100> data;
+      const etl::btree_map<int, int, 100>& cdata = data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i * 2] = i;
+      }
+
+      for (int i = -1; i < 201; ++i)
+      {
+        int lower = (i < 0) ? 0 : ((i + 1) / 2) * 2;
+        int upper = (i < 0) ? 0 : ((i / 2) + 1) * 2;
+
+        if (lower < 200)
+        {
+          CHECK_EQUAL(lower, data.lower_bound(i)->first);
+          CHECK_EQUAL(lower, cdata.lower_bound(i)->first);
+        }
+        else
+        {
+          CHECK(data.lower_bound(i) == data.end());
+        }
+
+        if (upper < 200)
+        {
+          CHECK_EQUAL(upper, data.upper_bound(i)->first);
+          CHECK_EQUAL(upper, cdata.upper_bound(i)->first);
+        }
+        else
+        {
+          CHECK(data.upper_bound(i) == data.end());
+        }
+
+        ETL_OR_STD::pair<etl::btree_map<int, int, 100>::const_iterator, etl::btree_map<int, int, 100>::const_iterator> range = cdata.equal_range(i);
+
+        CHECK_EQUAL(((i >= 0) && (i < 200) && ((i % 2) == 0)) ? 1 : 0, std::distance(range.first, range.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(initial_data.rbegin(), initial_data.rend());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2.at(K[0]) = N10;
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+      CHECK(data2 > data1);
+      CHECK(data1 <= data2);
+      CHECK(data2 >= data1);
+    }
+
+    //*************************************************************************
+    TEST(test_deep_tree_sequential)
+    {
+      DataBig data;
+      std::map<big_key, int> compare;
+
+      // Ascending, then descending, inserts fill the nodes least well.
+      for (int i = 0; i < 500; ++i)
+      {
+        data[big_key(i)] = i;
+        compare[big_key(i)] = i;
+      }
+
+      for (int i = 999; i >= 500; --i)
+      {
+        data[big_key(i)] = i;
+        compare[big_key(i)] = i;
+      }
+
+      CHECK(data.full());
+      CHECK(data.depth() > 3U);
+      CHECK(Check_Order(data, compare));
+
+      // Erase from each end, and then the middle.
+      for (int i = 0; i < 250; ++i)
+      {
+        CHECK_EQUAL(1U, data.erase(big_key(i)));
+        CHECK_EQUAL(1U, data.erase(big_key(999 - i)));
+        compare.erase(big_key(i));
+        compare.erase(big_key(999 - i));
+      }
+
+      CHECK(Check_Order(data, compare));
+
+      while (!data.empty())
+      {
+        data.erase(data.begin());
+      }
+
+      CHECK_EQUAL(0U, data.depth());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_map)
+    {
+      DataBig data;
+      std::map<big_key, int> compare;
+
+      uint32_t state = 1U;
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+
+        int key   = int((state >> 8) % 2000U);
+        int value = int(state >> 16);
+
+        if ((state & 0x3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(big_key(key)), data.erase(big_key(key)));
+        }
+        else if (compare.size() < data.max_size())
+        {
+          CHECK_EQUAL(compare.insert(std::make_pair(big_key(key), value)).second, data.insert(std::make_pair(big_key(key), value)).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(big_key(key)), data.count(big_key(key)));
+        }
+
+        if ((i % 5000) == 0)
+        {
+          CHECK(Check_Order(data, compare));
+        }
+      }
+
+      CHECK(Check_Order(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_elements_destroyed)
+    {
+      {
+        etl::btree_map<int, std::string, 200> data;
+
+        for (int i = 0; i < 200; ++i)
+        {
+          data[i] = std::string(100, char('a' + (i % 26)));
+        }
+
+        for (int i = 0; i < 200; i += 3)
+        {
+          data.erase(i);
+        }
+
+        for (int i = 300; i < 367; ++i)
+        {
+          data[i] = std::string(100, 'z');
+        }
+
+        CHECK(data.full());
+        CHECK_EQUAL(std::string(100, 'b'), data[1]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::btree_map<std::string, int, SIZE> data;
+      data["1"] = 1;
+      data["3"] = 3;
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::btree_map<std::string, int, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(3 == data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK_EQUAL(std::string("3"), data.lower_bound("2")->first);
+      CHECK_EQUAL(std::string("5"), cdata.upper_bound("3")->first);
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == crange.second);
+      CHECK_EQUAL(std::string("5"), crange.first->first);
+    }
+  };
+}
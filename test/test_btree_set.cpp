@@ -0,0 +1,226 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "etl/btree_set.h"
+
+namespace
+{
+  //*************************************************************************
+  // A key large enough that every node holds the minimum of four entries,
+  // so that small sets have several levels.
+  struct big_key
+  {
+    big_key(int value_)
+      : value(value_)
+    {
+      std::fill_n(padding, sizeof(padding), char(value_));
+    }
+
+    friend bool operator <(const big_key& lhs, const big_key& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    friend bool operator ==(const big_key& lhs, const big_key& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int  value;
+    char padding[ETL_BTREE_NODE_SIZE];
+  };
+
+  SUITE(test_btree_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::btree_set<int, SIZE> DataInt;
+    typedef etl::ibtree_set<int>      IDataInt;
+
+    typedef etl::btree_set<big_key, 1000> DataBig;
+
+    //*************************************************************************
+    template <typename TSet, typename TCompare>
+    bool Check_Order(const TSet& data, const TCompare& compare)
+    {
+      return (data.size() == compare.size()) &&
+             (size_t(std::distance(data.begin(), data.end())) == compare.size()) &&
+             std::equal(compare.begin(), compare.end(), data.begin()) &&
+             std::equal(compare.rbegin(), compare.rend(), data.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_copy)
+    {
+      int initial[] = { 5, 1, 8, 3, 0, 9, 6, 2, 7, 4 };
+
+      DataInt data1(std::begin(initial), std::end(initial));
+      DataInt data2(data1);
+      DataInt data3;
+      IDataInt& idata3 = data3;
+
+      idata3 = data1;
+
+      std::set<int> compare(std::begin(initial), std::end(initial));
+
+      CHECK(data1.full());
+      CHECK(Check_Order(data1, compare));
+      CHECK(Check_Order(data2, compare));
+      CHECK(Check_Order(data3, compare));
+      CHECK(data1 == data2);
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { 4, 0, 2 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, *data.begin());
+      CHECK_EQUAL(4, *data.rbegin());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_insert_erase)
+    {
+      DataInt data;
+
+      CHECK(data.insert(3).second);
+      CHECK(!data.insert(3).second);
+      CHECK_EQUAL(1, *data.insert(data.begin(), 1));
+      CHECK_EQUAL(2U, data.size());
+
+      for (int i = 10; i < 18; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK_THROW(data.insert(20), etl::btree_set_full);
+      CHECK(!data.insert(10).second);
+
+      CHECK_EQUAL(1U, data.erase(10));
+      CHECK_EQUAL(0U, data.erase(10));
+      CHECK_EQUAL(11, *data.erase(data.find(3)));
+      CHECK_EQUAL(16, *data.erase(data.find(12), data.find(16)));
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      etl::btree_set<int, 100> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(i * 2);
+      }
+
+      CHECK_EQUAL(0, *data.lower_bound(-1));
+      CHECK_EQUAL(10, *data.lower_bound(9));
+      CHECK_EQUAL(10, *data.lower_bound(10));
+      CHECK_EQUAL(12, *data.upper_bound(10));
+      CHECK(data.lower_bound(199) == data.end());
+      CHECK(data.upper_bound(198) == data.end());
+      CHECK_EQUAL(1, std::distance(data.equal_range(20).first, data.equal_range(20).second));
+      CHECK_EQUAL(0, std::distance(data.equal_range(21).first, data.equal_range(21).second));
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_set)
+    {
+      DataBig data;
+      std::set<big_key> compare;
+
+      uint32_t state = 1U;
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+
+        int key = int((state >> 8) % 2000U);
+
+        if ((state & 0x3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(big_key(key)), data.erase(big_key(key)));
+        }
+        else if (compare.size() < data.max_size())
+        {
+          CHECK_EQUAL(compare.insert(big_key(key)).second, data.insert(big_key(key)).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(big_key(key)), data.count(big_key(key)));
+        }
+      }
+
+      CHECK(data.depth() > 3U);
+      CHECK(Check_Order(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::btree_set<std::string, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data.insert("1");
+      data.insert("3");
+      data.insert("5");
+
+      CHECK(data.find("3") != data.end());
+      CHECK(cdata.find("2") == cdata.end());
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+      CHECK_EQUAL(std::string("3"), *data.lower_bound("2"));
+      CHECK_EQUAL(std::string("5"), *cdata.upper_bound("3"));
+    }
+  };
+}
@@ -288,6 +288,150 @@ namespace
       CHECK(desc4.is_released());
     }
 
+    //*************************************************************************
+    TEST(test_allocate_burst)
+    {
+      BD bd(&buffers[0][0]);
+
+      BD::descriptor desc[N_BUFFERS + 1];
+
+      CHECK_EQUAL(3U, bd.allocate(desc, 3U));
+      CHECK(desc[0].data() == &buffers[0][0]);
+      CHECK(desc[1].data() == &buffers[1][0]);
+      CHECK(desc[2].data() == &buffers[2][0]);
+
+      // Only one left.
+      CHECK_EQUAL(1U, bd.allocate(&desc[3], 2U));
+      CHECK(desc[3].data() == &buffers[3][0]);
+      CHECK(!desc[4].is_valid());
+
+      // Releasing out of ring order does not free the next one in the ring.
+      desc[1].release();
+      CHECK_EQUAL(0U, bd.allocate(&desc[4], 1U));
+
+      desc[0].release();
+      CHECK_EQUAL(2U, bd.allocate(desc, N_BUFFERS));
+      CHECK(desc[0].data() == &buffers[0][0]);
+      CHECK(desc[1].data() == &buffers[1][0]);
+    }
+
+    //*************************************************************************
+    TEST(test_default_and_plain_flags)
+    {
+      etl::buffer_descriptors<char, BUFFER_SIZE, N_BUFFERS> bd_default(&buffers[0][0]);
+      etl::buffer_descriptors<char, BUFFER_SIZE, N_BUFFERS, bool> bd_plain(&buffers[0][0]);
+
+      for (size_t i = 0U; i < N_BUFFERS; ++i)
+      {
+        CHECK(bd_default.allocate().is_allocated());
+        CHECK(bd_plain.allocate().is_allocated());
+      }
+
+      CHECK(!bd_default.allocate().is_valid());
+      CHECK(!bd_plain.allocate().is_valid());
+
+      bd_default.clear();
+      bd_plain.clear();
+
+      CHECK(bd_default.allocate().data() == &buffers[0][0]);
+      CHECK(bd_plain.allocate().data() == &buffers[0][0]);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_allocators)
+    {
+      static const size_t N_THREADS    = 3U;
+      static const size_t N_PER_THREAD = 20000U;
+
+      static char mt_buffers[N_BUFFERS][BUFFER_SIZE];
+
+      BD bd(&mt_buffers[0][0]);
+
+      etl::queue_spsc_atomic<BD::descriptor, N_BUFFERS + 1> queues[N_THREADS];
+      std::atomic<size_t> owners[N_BUFFERS];
+      std::atomic<int>    errors(0);
+      std::atomic<size_t> producers_done(0U);
+
+      for (size_t i = 0U; i < N_BUFFERS; ++i)
+      {
+        owners[i] = 0U;
+      }
+
+      auto producer = [&](size_t id)
+      {
+        size_t count = 0U;
+
+        while (count < N_PER_THREAD)
+        {
+          BD::descriptor desc = bd.allocate();
+
+          if (desc.is_valid())
+          {
+            const size_t index = size_t(desc.data() - &mt_buffers[0][0]) / BUFFER_SIZE;
+
+            // Nobody else may own it.
+            if (owners[index].exchange(id + 1U) != 0U)
+            {
+              ++errors;
+            }
+
+            desc.data()[0] = char(id);
+            queues[id].push(desc);
+            ++count;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        ++producers_done;
+      };
+
+      auto consumer = [&]()
+      {
+        BD::descriptor desc;
+
+        while ((producers_done < N_THREADS) || !queues[0].empty() || !queues[1].empty() || !queues[2].empty())
+        {
+          bool idle = true;
+
+          for (size_t id = 0U; id < N_THREADS; ++id)
+          {
+            if (queues[id].pop(desc))
+            {
+              const size_t index = size_t(desc.data() - &mt_buffers[0][0]) / BUFFER_SIZE;
+
+              if ((owners[index].exchange(0U) != (id + 1U)) || (desc.data()[0] != char(id)))
+              {
+                ++errors;
+              }
+
+              desc.release();
+              idle = false;
+            }
+          }
+
+          if (idle)
+          {
+            std::this_thread::yield();
+          }
+        }
+      };
+
+      std::thread c(consumer);
+      std::thread p0(producer, 0U);
+      std::thread p1(producer, 1U);
+      std::thread p2(producer, 2U);
+
+      p0.join();
+      p1.join();
+      p2.join();
+      c.join();
+
+      CHECK_EQUAL(0, errors.load());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
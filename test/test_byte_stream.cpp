@@ -0,0 +1,215 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/byte_stream.h"
+
+#include <array>
+
+namespace
+{
+  SUITE(test_byte_stream)
+  {
+    //*************************************************************************
+    TEST(test_write_big_endian)
+    {
+      std::array<uint8_t, 16> storage;
+      storage.fill(0U);
+
+      etl::byte_stream_writer writer(etl::span<uint8_t>(storage.data(), storage.size()));
+
+      CHECK(writer.empty());
+      CHECK(writer.write(uint8_t(0x01U)));
+      CHECK(writer.write(uint16_t(0x0203U)));
+      CHECK(writer.write(uint32_t(0x04050607UL)));
+      CHECK(writer.write(int8_t(-1)));
+      CHECK_EQUAL(8U, writer.size_bytes());
+      CHECK_EQUAL(8U, writer.available_bytes());
+      CHECK_EQUAL(2U, writer.available<uint32_t>());
+
+      const uint8_t expected[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0xFF };
+      CHECK_ARRAY_EQUAL(expected, storage.data(), 8U);
+      CHECK_EQUAL(8U, writer.used_data().size());
+      CHECK_EQUAL(8U, writer.free_data().size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_little_endian)
+    {
+      std::array<uint8_t, 8> storage;
+      storage.fill(0U);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+
+      CHECK(writer.write(uint16_t(0x0102U)));
+      CHECK(writer.write(uint16_t(0x0304U), etl::endian::big));
+      CHECK(writer.write(int32_t(0x05060708L)));
+
+      const uint8_t expected[] = { 0x02, 0x01, 0x03, 0x04, 0x08, 0x07, 0x06, 0x05 };
+      CHECK_ARRAY_EQUAL(expected, storage.data(), 8U);
+      CHECK(writer.full());
+    }
+
+    //*************************************************************************
+    TEST(test_write_overflow)
+    {
+      std::array<uint8_t, 5> storage;
+      storage.fill(0U);
+
+      etl::byte_stream_writer writer(etl::span<uint8_t>(storage.data(), storage.size()));
+
+      CHECK(writer.write(uint32_t(0x01020304UL)));
+      CHECK(!writer.write(uint16_t(0x0506U)));
+      CHECK_EQUAL(4U, writer.size_bytes());
+      CHECK(writer.write(uint8_t(0x05U)));
+      CHECK(!writer.write(uint8_t(0x06U)));
+      CHECK(writer.full());
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_round_trip)
+    {
+      std::array<uint8_t, 64> storage;
+
+      etl::byte_stream_writer writer(etl::span<uint8_t>(storage.data(), storage.size()));
+
+      writer.write(int16_t(-1234));
+      writer.write(uint32_t(0xDEADBEEFUL));
+      writer.write(int64_t(-123456789012345LL));
+      writer.write(3.5f);
+      writer.write(-2.25);
+      writer.write(true);
+      writer.write('A');
+
+      etl::byte_stream_reader reader(writer.used_data());
+
+      CHECK_EQUAL(-1234, reader.read<int16_t>().value());
+      CHECK_EQUAL(0xDEADBEEFUL, reader.read<uint32_t>().value());
+      CHECK_EQUAL(-123456789012345LL, reader.read<int64_t>().value());
+      CHECK_EQUAL(3.5f, reader.read<float>().value());
+      CHECK_EQUAL(-2.25, reader.read<double>().value());
+      CHECK_EQUAL(true, reader.read<bool>().value());
+      CHECK_EQUAL('A', reader.read<char>().value());
+      CHECK(reader.empty());
+      CHECK(!reader.read<uint8_t>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_read_endianness)
+    {
+      const uint8_t data[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 };
+
+      etl::byte_stream_reader big(etl::span<const uint8_t>(data, sizeof(data)));
+      CHECK_EQUAL(0x0102U, big.read<uint16_t>().value());
+      CHECK_EQUAL(0x0403U, big.read<uint16_t>(etl::endian::little).value());
+      CHECK_EQUAL(0x0506U, big.read_unchecked<uint16_t>());
+
+      etl::byte_stream_reader little(data, sizeof(data), etl::endian::little);
+      CHECK_EQUAL(0x04030201UL, little.read<uint32_t>().value());
+      CHECK(!little.read<uint32_t>().has_value());
+      CHECK_EQUAL(2U, little.available_bytes());
+      CHECK_EQUAL(0x0605U, little.read<uint16_t>().value());
+    }
+
+    //*************************************************************************
+    TEST(test_read_unaligned)
+    {
+      const uint8_t data[] = { 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+
+      etl::byte_stream_reader reader(data, sizeof(data));
+
+      CHECK(reader.skip<uint8_t>(1U));
+      CHECK_EQUAL(0x1122334455667788ULL, reader.read<uint64_t>().value());
+    }
+
+    //*************************************************************************
+    TEST(test_read_span)
+    {
+      const uint8_t data[] = { 0x00, 0x03, 'a', 'b', 'c', 0x42 };
+
+      etl::byte_stream_reader reader(data, sizeof(data));
+
+      const uint16_t length = reader.read<uint16_t>().value();
+      etl::optional<etl::span<const uint8_t> > payload = reader.read_span(length);
+
+      CHECK(payload.has_value());
+      CHECK_EQUAL(3U, payload.value().size());
+      CHECK(payload.value().data() == &data[2]);
+      CHECK_EQUAL(0x42, reader.read<uint8_t>().value());
+      CHECK(!reader.read_span(1U).has_value());
+      CHECK(reader.read_span(0U).has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_batch_write_read)
+    {
+      const uint16_t values[] = { 0x0102U, 0x0304U, 0x0506U, 0x0708U };
+      std::array<uint8_t, 8> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size());
+
+      CHECK(writer.write(etl::span<const uint16_t>(values, 4U)));
+      CHECK(!writer.write(etl::span<const uint16_t>(values, 1U)));
+
+      const uint8_t expected[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      CHECK_ARRAY_EQUAL(expected, storage.data(), 8U);
+
+      uint16_t result[5] = { 0U, 0U, 0U, 0U, 0U };
+      etl::byte_stream_reader reader(writer.used_data());
+
+      CHECK(!reader.read(etl::span<uint16_t>(result, 5U)));
+      CHECK(reader.read(etl::span<uint16_t>(result, 4U)));
+      CHECK_ARRAY_EQUAL(values, result, 4U);
+
+      reader.restart(1U);
+      uint8_t bytes[3] = { 0U, 0U, 0U };
+      CHECK(reader.read(etl::span<uint8_t>(bytes, 3U)));
+      CHECK_ARRAY_EQUAL(&expected[1], bytes, 3U);
+    }
+
+    //*************************************************************************
+    TEST(test_native_endian)
+    {
+      std::array<uint8_t, 4> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::native);
+      writer.write(uint32_t(0x01020304UL));
+
+      uint32_t value;
+      memcpy(&value, storage.data(), sizeof(value));
+      CHECK_EQUAL(0x01020304UL, value);
+
+      writer.restart();
+      CHECK(writer.empty());
+      CHECK(writer.skip<uint16_t>(2U));
+      CHECK(!writer.skip<uint8_t>(1U));
+    }
+  };
+}
@@ -0,0 +1,412 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdlib>
+#include <functional>
+
+#include "etl/cache.h"
+
+namespace
+{
+  //***************************************************************************
+  /// A backing store that records its traffic.
+  //***************************************************************************
+  struct Store
+  {
+    bool read(const int& key, int& value)
+    {
+      ++reads;
+
+      std::map<int, int>::const_iterator itr = values.find(key);
+
+      if (itr == values.end())
+      {
+        return false;
+      }
+
+      value = itr->second;
+      return true;
+    }
+
+    void write(const int& key, const int& value)
+    {
+      values[key] = value;
+      written.push_back(std::make_pair(key, value));
+    }
+
+    std::map<int, int>               values;
+    std::vector<std::pair<int, int> > written;
+    int                              reads = 0;
+  };
+
+  typedef etl::icache<int, int>::read_function_t  ReadFunction;
+  typedef etl::icache<int, int>::write_function_t WriteFunction;
+
+  template <typename TCache>
+  void connect(TCache& cache, Store& store)
+  {
+    cache.set_read_function(ReadFunction::create<Store, &Store::read>(store));
+    cache.set_write_function(WriteFunction::create<Store, &Store::write>(store));
+  }
+
+  struct StringHash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::hash<std::string>()(text);
+    }
+  };
+
+  SUITE(test_cache)
+  {
+    static const size_t SIZE = 4;
+
+    typedef etl::lru_cache<int, int, SIZE>                     Lru;
+    typedef etl::clock_cache<int, int, SIZE>                   Clock;
+    typedef etl::lru_cache<std::string, int, SIZE, StringHash> LruString;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Lru   lru;
+      Clock clock;
+
+      CHECK(lru.empty());
+      CHECK(!lru.full());
+      CHECK_EQUAL(0U, lru.size());
+      CHECK_EQUAL(SIZE, lru.capacity());
+      CHECK_EQUAL(SIZE, lru.max_size());
+      CHECK(lru.is_write_through());
+
+      CHECK(clock.empty());
+      CHECK_EQUAL(SIZE, clock.capacity());
+
+      int value = 0;
+      CHECK(!lru.read(1, value));
+      CHECK(!clock.read(1, value));
+    }
+
+    //*************************************************************************
+    TEST(test_read_through)
+    {
+      Store store;
+      store.values[1] = 10;
+      store.values[2] = 20;
+
+      Lru cache;
+      connect(cache, store);
+
+      int value = 0;
+      CHECK(cache.read(1, value));
+      CHECK_EQUAL(10, value);
+      CHECK_EQUAL(1, store.reads);
+
+      // A hit does not go to the store.
+      CHECK(cache.read(1, value));
+      CHECK_EQUAL(10, value);
+      CHECK_EQUAL(1, store.reads);
+
+      // Not in the store either.
+      CHECK(!cache.read(3, value));
+      CHECK_EQUAL(2, store.reads);
+      CHECK(!cache.contains(3));
+      CHECK_EQUAL(1U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_lru_eviction_order)
+    {
+      Lru cache;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        cache.write(i, i * 10);
+      }
+
+      CHECK(cache.full());
+
+      // Use 0 so that 1 becomes the least recently used.
+      CHECK(cache.find(0) != nullptr);
+
+      cache.write(10, 100);
+      CHECK(cache.contains(0));
+      CHECK(!cache.contains(1));
+      CHECK(cache.contains(2));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(10));
+
+      // peek does not count as a use, so 2 is next.
+      CHECK_EQUAL(20, *cache.peek(2));
+      cache.write(11, 110);
+      CHECK(!cache.contains(2));
+
+      CHECK_EQUAL(SIZE, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clock_second_chance)
+    {
+      Clock cache;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        cache.write(i, i * 10);
+      }
+
+      // Reference 0 and 1; the hand skips them and takes 2.
+      CHECK(cache.find(0) != nullptr);
+      CHECK(cache.find(1) != nullptr);
+
+      cache.write(10, 100);
+      CHECK(cache.contains(0));
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(3));
+
+      // The sweep cleared the flags of 0 and 1, the hand is now at 3.
+      cache.write(11, 110);
+      CHECK(!cache.contains(3));
+
+      // Then 0, which lost its second chance.
+      cache.write(12, 120);
+      CHECK(!cache.contains(0));
+      CHECK(cache.contains(1));
+      CHECK(cache.contains(10));
+      CHECK(cache.contains(11));
+      CHECK(cache.contains(12));
+    }
+
+    //*************************************************************************
+    TEST(test_write_through)
+    {
+      Store store;
+      Lru cache;
+      connect(cache, store);
+
+      cache.write(1, 10);
+      cache.write(1, 11);
+
+      CHECK_EQUAL(2U, store.written.size());
+      CHECK_EQUAL(11, store.values[1]);
+      CHECK(!cache.is_dirty(1));
+    }
+
+    //*************************************************************************
+    TEST(test_write_back_and_flush)
+    {
+      Store store;
+      Lru cache;
+      connect(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, 10);
+      cache.write(2, 20);
+      cache.write(1, 11);
+
+      CHECK(store.written.empty());
+      CHECK(cache.is_dirty(1));
+      CHECK(cache.is_dirty(2));
+
+      cache.flush();
+
+      // One write per changed value, whatever the number of writes to the cache.
+      CHECK_EQUAL(2U, store.written.size());
+      CHECK_EQUAL(11, store.values[1]);
+      CHECK_EQUAL(20, store.values[2]);
+      CHECK(!cache.is_dirty(1));
+
+      cache.flush();
+      CHECK_EQUAL(2U, store.written.size());
+    }
+
+    //*************************************************************************
+    TEST(test_eviction_writes_back)
+    {
+      Store store;
+      Clock cache;
+      connect(cache, store);
+      cache.set_write_through(false);
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        cache.write(i, i * 10);
+      }
+
+      CHECK(store.written.empty());
+
+      cache.write(10, 100);
+
+      CHECK_EQUAL(1U, store.written.size());
+      CHECK_EQUAL(0, store.written[0].first);
+      CHECK_EQUAL(0, store.written[0].second);
+
+      // A clean value is evicted without a write.
+      int value;
+      store.values[20] = 200;
+      CHECK(cache.read(20, value));
+      CHECK_EQUAL(2U, store.written.size());
+
+      store.written.clear();
+      CHECK(cache.read(21, value) == false);
+      CHECK(store.written.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_and_clear)
+    {
+      Store store;
+      Lru cache;
+      connect(cache, store);
+      cache.set_write_through(false);
+
+      cache.write(1, 10);
+      cache.write(2, 20);
+      cache.write(3, 30);
+
+      CHECK(cache.erase(2));
+      CHECK(!cache.erase(2));
+      CHECK(!cache.contains(2));
+      CHECK_EQUAL(2U, cache.size());
+      CHECK_EQUAL(1U, store.written.size());
+      CHECK_EQUAL(20, store.values[2]);
+
+      cache.clear();
+      CHECK(cache.empty());
+      CHECK_EQUAL(3U, store.written.size());
+      CHECK_EQUAL(10, store.values[1]);
+      CHECK_EQUAL(30, store.values[3]);
+
+      // Usable after clear.
+      cache.write(4, 40);
+      CHECK_EQUAL(40, *cache.find(4));
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_flushes)
+    {
+      Store store;
+
+      {
+        Lru cache;
+        connect(cache, store);
+        cache.set_write_through(false);
+
+        cache.write(1, 10);
+        cache.write(2, 20);
+      }
+
+      CHECK_EQUAL(2U, store.written.size());
+      CHECK_EQUAL(10, store.values[1]);
+      CHECK_EQUAL(20, store.values[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      LruString cache;
+
+      cache.write("one", 1);
+      cache.write("two", 2);
+
+      CHECK_EQUAL(1, *cache.find("one"));
+      CHECK_EQUAL(2, *cache.find("two"));
+      CHECK(cache.find("three") == nullptr);
+
+      etl::icache<std::string, int>& icache = cache;
+      int value = 0;
+      CHECK(icache.read("two", value));
+      CHECK_EQUAL(2, value);
+    }
+
+    //*************************************************************************
+    template <typename TCache>
+    void churn(TCache& cache)
+    {
+      std::map<int, int> reference;
+      std::srand(1);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // Multiples of the index size, so that the probe runs are long.
+        const int key = (std::rand() % 40) * 32;
+
+        if ((std::rand() % 4) == 0)
+        {
+          CHECK_EQUAL(reference.erase(key) == 1U, cache.erase(key));
+        }
+        else
+        {
+          cache.write(key, i);
+          reference[key] = i;
+
+          // At most one value has been evicted.
+          size_t evicted = 0U;
+
+          for (std::map<int, int>::iterator itr = reference.begin(); itr != reference.end();)
+          {
+            if (!cache.contains(itr->first))
+            {
+              itr = reference.erase(itr);
+              ++evicted;
+            }
+            else
+            {
+              ++itr;
+            }
+          }
+
+          CHECK(evicted <= 1U);
+        }
+
+        CHECK_EQUAL(reference.size(), cache.size());
+
+        for (std::map<int, int>::const_iterator itr = reference.begin(); itr != reference.end(); ++itr)
+        {
+          CHECK_EQUAL(itr->second, *cache.peek(itr->first));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_index_under_churn)
+    {
+      etl::lru_cache<int, int, 13>   lru;
+      etl::clock_cache<int, int, 13> clock;
+
+      churn(lru);
+      churn(clock);
+    }
+  };
+}
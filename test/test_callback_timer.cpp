@@ -677,6 +677,44 @@ namespace
         CHECK(test_obj.called == 1);
     }
 
+    //*************************************************************************
+    TEST(callback_timer_time_to_next)
+    {
+      etl::callback_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      // Sleep until each expiry in turn, then pass on the elapsed time in one tick.
+      ticks = 0;
+
+      while (ticks < 100U)
+      {
+        const uint32_t elapsed = timer_controller.time_to_next();
+        ticks += elapsed;
+        timer_controller.tick(elapsed);
+      }
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 23, 46, 69, 92, 115 };
+
+      CHECK(test.tick_list == compare1);
+      CHECK(free_tick_list1 == compare2);
+      CHECK_EQUAL(23U, timer_controller.time_to_next());
+
+      timer_controller.stop(id2);
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
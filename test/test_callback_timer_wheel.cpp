@@ -0,0 +1,387 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_wheel.h"
+#include "etl/function.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  uint64_t ticks = 0;
+
+  //***************************************************************************
+  // Class callback via etl::function
+  //***************************************************************************
+  class Test
+  {
+  public:
+
+    void callback()
+    {
+      tick_list.push_back(ticks);
+    }
+
+    std::vector<uint64_t> tick_list;
+  };
+
+  Test test;
+  etl::function_imv<Test, test, &Test::callback> member_callback;
+
+  //***************************************************************************
+  // Free function callback via function pointer
+  //***************************************************************************
+  std::vector<uint64_t> free_tick_list;
+
+  void free_callback()
+  {
+    free_tick_list.push_back(ticks);
+  }
+
+  //***************************************************************************
+  // Records the id and time of each expiry, for many timers.
+  //***************************************************************************
+  struct Expiry
+  {
+    size_t   index;
+    uint64_t time;
+  };
+
+  std::vector<Expiry> expiries;
+
+  template <size_t Index>
+  void indexed_callback()
+  {
+    Expiry expiry = { Index, ticks };
+    expiries.push_back(expiry);
+  }
+
+  //***************************************************************************
+  template <typename TController>
+  void run(TController& controller, uint32_t step, uint64_t until)
+  {
+    while (ticks < until)
+    {
+      ticks += step;
+      controller.tick(step);
+    }
+  }
+
+  SUITE(test_callback_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(callback_timer_wheel_too_many_timers)
+    {
+      etl::callback_timer_wheel<2> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(member_callback, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(free_callback,   23, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id3 = timer_controller.register_timer(free_callback,   11, etl::timer::mode::SINGLE_SHOT);
+
+      CHECK(id1 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id2 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id3 == etl::timer_wheel::id::NO_TIMER);
+
+      CHECK(timer_controller.unregister_timer(id1));
+      id3 = timer_controller.register_timer(free_callback, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(id1, id3);
+
+      timer_controller.clear();
+      id1 = timer_controller.register_timer(free_callback, 11, etl::timer::mode::SINGLE_SHOT);
+      id2 = timer_controller.register_timer(free_callback, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK(id1 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id2 != etl::timer_wheel::id::NO_TIMER);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_one_shot)
+    {
+      etl::callback_timer_wheel<4> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(member_callback, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(free_callback,   11, etl::timer::mode::SINGLE_SHOT);
+
+      test.tick_list.clear();
+      free_tick_list.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      CHECK_EQUAL(2U, timer_controller.number_of_active_timers());
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 1U, 100U);
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 11 };
+
+      CHECK(test.tick_list == compare1);
+      CHECK(free_tick_list == compare2);
+      CHECK_EQUAL(0U, timer_controller.number_of_active_timers());
+
+      CHECK(timer_controller.unregister_timer(id1));
+      CHECK(!timer_controller.unregister_timer(id1));
+      CHECK(!timer_controller.start(id1));
+      CHECK(!timer_controller.stop(id1));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_repeating_bigger_step)
+    {
+      etl::callback_timer_wheel<3, 2> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(member_callback, 37, etl::timer::mode::REPEATING);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(free_callback,   11, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      CHECK(!timer_controller.is_running());
+      timer_controller.enable(true);
+      CHECK(timer_controller.is_running());
+
+      ticks = 0;
+      run(timer_controller, 5U, 100U);
+
+      std::vector<uint64_t> compare1 = { 40, 75 };
+      std::vector<uint64_t> compare2 = { 15, 25, 35, 45, 55, 70, 80, 90, 100 };
+
+      CHECK(test.tick_list == compare1);
+      CHECK(free_tick_list == compare2);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_immediate_stop_and_period)
+    {
+      etl::callback_timer_wheel<2> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(free_callback, 10, etl::timer::mode::REPEATING);
+
+      free_tick_list.clear();
+      timer_controller.enable(true);
+      timer_controller.start(id1, etl::timer::start::IMMEDIATE);
+
+      ticks = 0;
+      timer_controller.tick(0);
+      run(timer_controller, 1U, 25U);
+
+      CHECK(timer_controller.stop(id1));
+      run(timer_controller, 1U, 50U);
+
+      CHECK(timer_controller.set_period(id1, 5));
+      timer_controller.start(id1);
+      run(timer_controller, 1U, 60U);
+
+      std::vector<uint64_t> compare = { 0, 10, 20, 55, 60 };
+
+      CHECK(free_tick_list == compare);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_long_periods)
+    {
+      etl::callback_timer_wheel<4, 4> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(member_callback, 70000U, etl::timer::mode::REPEATING);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(free_callback,   4097U,  etl::timer::mode::SINGLE_SHOT);
+
+      test.tick_list.clear();
+      free_tick_list.clear();
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+
+      ticks = 0;
+      run(timer_controller, 3U, 210003U);
+
+      std::vector<uint64_t> compare1 = { 70002, 140001, 210000 };
+      std::vector<uint64_t> compare2 = { 4098 };
+
+      CHECK(test.tick_list == compare1);
+      CHECK(free_tick_list == compare2);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_time_wraps)
+    {
+      etl::callback_timer_wheel<1> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(free_callback, 100U, etl::timer::mode::REPEATING);
+
+      free_tick_list.clear();
+      timer_controller.enable(true);
+
+      // Move the time to just before the wrap.
+      timer_controller.tick(0xFFFFFFF0UL);
+
+      timer_controller.start(id1);
+
+      ticks = 0;
+      run(timer_controller, 1U, 300U);
+
+      std::vector<uint64_t> compare = { 100, 200, 300 };
+
+      CHECK(free_tick_list == compare);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_many_timers)
+    {
+      typedef etl::callback_timer_wheel<8, 3> Controller;
+
+      Controller timer_controller;
+
+      void (*callbacks[8])() = { indexed_callback<0>, indexed_callback<1>, indexed_callback<2>, indexed_callback<3>,
+                                 indexed_callback<4>, indexed_callback<5>, indexed_callback<6>, indexed_callback<7> };
+
+      const uint32_t periods[8] = { 1U, 7U, 8U, 63U, 64U, 65U, 511U, 4000U };
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        etl::timer_wheel::id::type id = timer_controller.register_timer(callbacks[i], periods[i], etl::timer::mode::REPEATING);
+        timer_controller.start(id);
+      }
+
+      expiries.clear();
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 1U, 12000U);
+
+      // Every timer has fired at each multiple of its period.
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        std::vector<uint64_t> times;
+
+        for (size_t e = 0U; e < expiries.size(); ++e)
+        {
+          if (expiries[e].index == i)
+          {
+            times.push_back(expiries[e].time);
+          }
+        }
+
+        CHECK_EQUAL(12000U / periods[i], times.size());
+
+        for (size_t t = 0U; t < times.size(); ++t)
+        {
+          CHECK_EQUAL(periods[i] * (t + 1U), times[t]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_time_to_next)
+    {
+      etl::callback_timer_wheel<2, 3> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(member_callback, 1000, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(free_callback,   23,   etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list.clear();
+
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+      CHECK(timer_controller.time_to_next() <= 1000U);
+
+      timer_controller.start(id2);
+      CHECK(timer_controller.time_to_next() <= 23U);
+
+      // Sleep until the next event each time, then pass on the elapsed time in one tick.
+      ticks = 0;
+
+      while (ticks < 1000U)
+      {
+        const uint32_t elapsed = timer_controller.time_to_next();
+        CHECK(elapsed != 0U);
+        ticks += elapsed;
+        timer_controller.tick(elapsed);
+      }
+
+      std::vector<uint64_t> compare1 = { 1000 };
+
+      CHECK(test.tick_list == compare1);
+      CHECK_EQUAL(1000U / 23U, free_tick_list.size());
+
+      timer_controller.stop(id2);
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_large_ticks)
+    {
+      typedef etl::callback_timer_wheel<8, 3> Controller;
+
+      Controller timer_controller;
+
+      void (*callbacks[8])() = { indexed_callback<0>, indexed_callback<1>, indexed_callback<2>, indexed_callback<3>,
+                                 indexed_callback<4>, indexed_callback<5>, indexed_callback<6>, indexed_callback<7> };
+
+      const uint32_t periods[8] = { 3U, 7U, 8U, 63U, 64U, 65U, 511U, 4000U };
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        etl::timer_wheel::id::type id = timer_controller.register_timer(callbacks[i], periods[i], etl::timer::mode::REPEATING);
+        timer_controller.start(id);
+      }
+
+      expiries.clear();
+      timer_controller.enable(true);
+
+      // A single tick covering many expiries fires each timer as often as a tick at a time would.
+      ticks = 0;
+      run(timer_controller, 1000U, 12000U);
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        size_t count = 0U;
+
+        for (size_t e = 0U; e < expiries.size(); ++e)
+        {
+          if (expiries[e].index == i)
+          {
+            ++count;
+          }
+        }
+
+        CHECK_EQUAL(12000U / periods[i], count);
+      }
+    }
+  };
+}
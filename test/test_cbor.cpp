@@ -0,0 +1,206 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/cbor.h"
+
+#include <string>
+#include <limits>
+#include <stdio.h>
+
+namespace
+{
+  //***********************************
+  std::string to_hex(const etl::cbor_writer& writer)
+  {
+    std::string text;
+
+    for (size_t i = 0U; i < writer.size(); ++i)
+    {
+      char digits[3];
+      snprintf(digits, sizeof(digits), "%02x", writer.data()[i]);
+      text += digits;
+    }
+
+    return text;
+  }
+
+  //***********************************
+  template <typename T>
+  std::string encode(T value)
+  {
+    uint8_t buffer[32];
+    etl::cbor_writer writer(buffer, sizeof(buffer));
+
+    writer.value(value);
+
+    return to_hex(writer);
+  }
+
+  // The examples are from RFC 8949, Appendix A.
+  SUITE(test_cbor)
+  {
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      CHECK_EQUAL("00",                 encode(0));
+      CHECK_EQUAL("01",                 encode(1));
+      CHECK_EQUAL("0a",                 encode(10));
+      CHECK_EQUAL("17",                 encode(23));
+      CHECK_EQUAL("1818",               encode(24));
+      CHECK_EQUAL("1819",               encode(25));
+      CHECK_EQUAL("1864",               encode(uint8_t(100)));
+      CHECK_EQUAL("1903e8",             encode(1000));
+      CHECK_EQUAL("1a000f4240",         encode(1000000L));
+      CHECK_EQUAL("1b000000e8d4a51000", encode(1000000000000LL));
+      CHECK_EQUAL("1bffffffffffffffff", encode(std::numeric_limits<uint64_t>::max()));
+      CHECK_EQUAL("20",                 encode(-1));
+      CHECK_EQUAL("29",                 encode(-10));
+      CHECK_EQUAL("3863",               encode(int8_t(-100)));
+      CHECK_EQUAL("3903e7",             encode(-1000));
+      CHECK_EQUAL("3b7fffffffffffffff", encode(std::numeric_limits<int64_t>::min()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      CHECK_EQUAL("f90000",             encode(0.0));
+      CHECK_EQUAL("f98000",             encode(-0.0));
+      CHECK_EQUAL("f93c00",             encode(1.0));
+      CHECK_EQUAL("fb3ff199999999999a", encode(1.1));
+      CHECK_EQUAL("f93e00",             encode(1.5));
+      CHECK_EQUAL("f97bff",             encode(65504.0));
+      CHECK_EQUAL("fa47c35000",         encode(100000.0));
+      CHECK_EQUAL("fa7f7fffff",         encode(3.4028234663852886e+38));
+      CHECK_EQUAL("fb7e37e43c8800759c", encode(1.0e+300));
+      CHECK_EQUAL("f90001",             encode(5.960464477539063e-8));
+      CHECK_EQUAL("f90400",             encode(0.00006103515625));
+      CHECK_EQUAL("f9c400",             encode(-4.0));
+      CHECK_EQUAL("fbc010666666666666", encode(-4.1));
+      CHECK_EQUAL("f97c00",             encode(std::numeric_limits<double>::infinity()));
+      CHECK_EQUAL("f97e00",             encode(std::numeric_limits<double>::quiet_NaN()));
+      CHECK_EQUAL("f9fc00",             encode(-std::numeric_limits<double>::infinity()));
+      CHECK_EQUAL("f93e00",             encode(1.5f));
+      CHECK_EQUAL("fa3f8ccccd",         encode(1.1f));
+      CHECK_EQUAL("fa33000000",         encode(2.98023223876953125e-8f)); // 2^-25, below the smallest half.
+      CHECK_EQUAL("f90003",             encode(1.788139343261719e-7f));   // 3 * 2^-24, a subnormal half.
+    }
+
+    //*************************************************************************
+    TEST(test_simple_values_and_strings)
+    {
+      CHECK_EQUAL("f4",         encode(false));
+      CHECK_EQUAL("f5",         encode(true));
+      CHECK_EQUAL("60",         encode(""));
+      CHECK_EQUAL("6161",       encode("a"));
+      CHECK_EQUAL("6449455446", encode("IETF"));
+      CHECK_EQUAL("62225c",     encode("\"\\"));
+      CHECK_EQUAL("62c3bc",     encode("\xc3\xbc"));
+      CHECK_EQUAL("6449455446", encode(etl::string_view("IETF")));
+
+      uint8_t buffer[32];
+      etl::cbor_writer writer(buffer, sizeof(buffer));
+
+      const uint8_t data[] = { 1, 2, 3, 4 };
+      writer.bytes(data, sizeof(data)).null().tag(1).value(1363896240);
+
+      CHECK_EQUAL("4401020304f6c11a514b67b0", to_hex(writer));
+    }
+
+    //*************************************************************************
+    TEST(test_containers)
+    {
+      uint8_t buffer[64];
+      etl::cbor_writer writer(etl::span<uint8_t>(buffer, sizeof(buffer)));
+
+      writer.begin_array(0U);
+      CHECK_EQUAL("80", to_hex(writer));
+
+      // [1, [2, 3], [4, 5]]
+      writer.restart();
+      writer.begin_array(3U).value(1)
+              .begin_array(2U).value(2).value(3)
+              .begin_array(2U).value(4).value(5);
+      CHECK_EQUAL("8301820203820405", to_hex(writer));
+
+      // {"a": 1, "b": [2, 3]}
+      writer.restart();
+      writer.begin_map(2U).member("a", 1)
+              .key("b").begin_array(2U).value(2).value(3);
+      CHECK_EQUAL("a26161016162820203", to_hex(writer));
+
+      // [_ 1, [2, 3], [_ 4, 5]]
+      writer.restart();
+      writer.begin_array().value(1)
+              .begin_array(2U).value(2).value(3)
+              .begin_array().value(4).value(5).end()
+            .end();
+      CHECK_EQUAL("9f018202039f0405ffff", to_hex(writer));
+
+      // {_ "a": 1, "b": [_ ]}
+      writer.restart();
+      writer.begin_map().member("a", 1).key("b").begin_array().end().end();
+      CHECK_EQUAL("bf61610161629fffff", to_hex(writer));
+
+      CHECK(!writer.has_error());
+      CHECK_EQUAL(9U, writer.used_data().size());
+      CHECK(writer.used_data().data() == buffer);
+    }
+
+    //*************************************************************************
+    TEST(test_overflow)
+    {
+      uint8_t buffer[8];
+      etl::cbor_writer writer(buffer, sizeof(buffer));
+
+      writer.begin_map(1U).member("key", 1000);
+      CHECK(!writer.has_error());
+      CHECK_EQUAL(8U, writer.size());
+
+      writer.value(1);
+      CHECK(writer.has_error());
+      CHECK_EQUAL(8U, writer.size());
+
+      // Nothing more is written.
+      writer.null();
+      CHECK_EQUAL(8U, writer.size());
+
+      // A head that does not fit in full is not partly written.
+      writer.restart();
+      writer.value("123456").value(1000);
+      CHECK(writer.has_error());
+      CHECK_EQUAL(7U, writer.size());
+
+      writer.restart();
+      CHECK(!writer.has_error());
+      CHECK_EQUAL(0U, writer.size());
+    }
+  };
+}
@@ -31,6 +31,8 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <list>
+#include <algorithm>
 #include <stdint.h>
 
 #include "etl/checksum.h"
@@ -181,6 +183,121 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    TEST(test_fletcher16)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8F0, int(etl::fletcher16(data1.begin(), data1.end())));
+      CHECK_EQUAL(0x2057, int(etl::fletcher16(data2.begin(), data2.end())));
+      CHECK_EQUAL(0x0627, int(etl::fletcher16(data3.begin(), data3.end())));
+
+      etl::fletcher16 fletcher16_calculator;
+
+      for (size_t i = 0; i < data3.size(); ++i)
+      {
+        fletcher16_calculator.add(data3[i]);
+      }
+
+      CHECK_EQUAL(0x0627, int(fletcher16_calculator.value()));
+    }
+
+    //*************************************************************************
+    TEST(test_adler32)
+    {
+      std::string data1("Wikipedia");
+      std::string data2("123456789");
+
+      CHECK_EQUAL(0x11E60398U, etl::adler32(data1.begin(), data1.end()).value());
+      CHECK_EQUAL(0x091E01DEU, etl::adler32(data2.begin(), data2.end()).value());
+
+      etl::adler32 adler32_calculator;
+
+      for (size_t i = 0; i < data1.size(); ++i)
+      {
+        adler32_calculator.add(data1[i]);
+      }
+
+      CHECK_EQUAL(0x11E60398U, adler32_calculator.value());
+    }
+
+    //*************************************************************************
+    // The block kernels must give the same result as adding one byte at a time,
+    // for all lengths around the block sizes and the deferred modulo limit.
+    //*************************************************************************
+    template <typename TChecksum>
+    bool check_block_kernels(const std::vector<uint8_t>& data)
+    {
+      const size_t lengths[] = { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 5551, 5552, 5553, 11105, 20000 };
+
+      for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+      {
+        const size_t length = lengths[l];
+
+        TChecksum expected;
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          expected.add(data[i]);
+        }
+
+        TChecksum from_pointer(data.data(), data.data() + length);
+        TChecksum from_iterator(data.begin(), data.begin() + length);
+        std::list<uint8_t> list_data(data.begin(), data.begin() + length);
+        TChecksum from_list(list_data.begin(), list_data.end());
+
+        // Start part way through, so the kernel begins from a non-initial state.
+        TChecksum split;
+        split.add(data.data(), data.data() + (length / 3));
+        split.add(data.data() + (length / 3), data.data() + length);
+
+        if ((expected.value() != from_pointer.value())  ||
+            (expected.value() != from_iterator.value()) ||
+            (expected.value() != from_list.value())     ||
+            (expected.value() != split.value()))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(test_block_kernels)
+    {
+      std::vector<uint8_t> data(20000);
+
+      // All bytes 0xFF gives the largest intermediate sums.
+      std::fill(data.begin(), data.end(), uint8_t(0xFF));
+
+      CHECK(check_block_kernels<etl::adler32>(data));
+      CHECK(check_block_kernels<etl::fletcher16>(data));
+      CHECK(check_block_kernels<etl::checksum<uint8_t> >(data));
+      CHECK(check_block_kernels<etl::checksum<uint32_t> >(data));
+      CHECK(check_block_kernels<etl::xor_checksum<uint8_t> >(data));
+      CHECK(check_block_kernels<etl::parity_checksum<uint8_t> >(data));
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131) ^ (i >> 7));
+      }
+
+      CHECK(check_block_kernels<etl::adler32>(data));
+      CHECK(check_block_kernels<etl::fletcher16>(data));
+      CHECK(check_block_kernels<etl::checksum<uint8_t> >(data));
+      CHECK(check_block_kernels<etl::checksum<uint16_t> >(data));
+      CHECK(check_block_kernels<etl::checksum<uint32_t> >(data));
+      CHECK(check_block_kernels<etl::checksum<uint64_t> >(data));
+      CHECK(check_block_kernels<etl::xor_checksum<uint8_t> >(data));
+      CHECK(check_block_kernels<etl::xor_checksum<uint32_t> >(data));
+      CHECK(check_block_kernels<etl::parity_checksum<uint8_t> >(data));
+      CHECK(check_block_kernels<etl::bsd_checksum<uint16_t> >(data));
+      CHECK(check_block_kernels<etl::xor_rotate_checksum<uint8_t> >(data));
+    }
   };
 }
 
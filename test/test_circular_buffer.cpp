@@ -387,6 +387,147 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(test_push_pointer_range_trivially_copyable)
+    {
+      using DataInt = etl::circular_buffer<int, SIZE>;
+
+      std::vector<int> input;
+
+      for (int i = 0; i < int(3 * SIZE); ++i)
+      {
+        input.push_back(i + 100);
+      }
+
+      // Every start position, initial size and range length, compared with pushing one at a time.
+      for (size_t offset = 0U; offset <= SIZE; ++offset)
+      {
+        for (size_t initial = 0U; initial <= SIZE; ++initial)
+        {
+          for (size_t length = 0U; length <= (2U * SIZE) + 1U; ++length)
+          {
+            DataInt data;
+            DataInt compare;
+
+            for (size_t i = 0U; i < offset; ++i)
+            {
+              data.push(0);
+              data.pop();
+              compare.push(0);
+              compare.pop();
+            }
+
+            for (size_t i = 0U; i < initial; ++i)
+            {
+              data.push(int(i));
+              compare.push(int(i));
+            }
+
+            const int* first = input.data();
+            const int* last  = input.data() + length;
+
+            data.push(first, last);
+            compare.push(input.begin(), input.begin() + length);
+
+            CHECK_EQUAL(compare.size(), data.size());
+            CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_pop_n_trivially_destructible)
+    {
+      using DataInt = etl::circular_buffer<int, SIZE>;
+
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE + 3U); ++i)
+      {
+        data.push(i);
+      }
+
+      data.pop(4);
+
+      CHECK_EQUAL(SIZE - 4U, data.size());
+      CHECK_EQUAL(7, data.front());
+      CHECK_EQUAL(int(SIZE + 2U), data.back());
+
+      data.pop(data.size());
+      CHECK(data.empty());
+
+      CHECK_THROW(data.pop(1), etl::circular_buffer_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_unchecked_access)
+    {
+      using DataInt = etl::circular_buffer<int, SIZE>;
+
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE + 3U); ++i)
+      {
+        data.push(i);
+      }
+
+      const DataInt& cdata = data;
+
+      CHECK_EQUAL(data.front(), data.front_unchecked());
+      CHECK_EQUAL(data.back(),  data.back_unchecked());
+      CHECK_EQUAL(data.front(), cdata.front_unchecked());
+      CHECK_EQUAL(data.back(),  cdata.back_unchecked());
+
+      data.pop_unchecked();
+      data.pop_unchecked();
+
+      CHECK_EQUAL(SIZE - 2U, data.size());
+      CHECK_EQUAL(5, data.front_unchecked());
+      CHECK_EQUAL(int(SIZE + 2U), data.back_unchecked());
+    }
+
+    //*************************************************************************
+    TEST(test_first_and_second_span)
+    {
+      using DataInt = etl::circular_buffer<int, SIZE>;
+
+      for (size_t offset = 0U; offset <= SIZE; ++offset)
+      {
+        for (size_t length = 0U; length <= SIZE; ++length)
+        {
+          DataInt data;
+
+          for (size_t i = 0U; i < offset; ++i)
+          {
+            data.push(0);
+            data.pop();
+          }
+
+          for (size_t i = 0U; i < length; ++i)
+          {
+            data.push(int(i));
+          }
+
+          DataInt::span_type first  = data.first_span();
+          DataInt::span_type second = data.second_span();
+
+          CHECK_EQUAL(length, first.size() + second.size());
+          CHECK((length == 0U) || !first.empty());
+          CHECK(std::equal(first.begin(), first.end(), data.begin()));
+          CHECK(std::equal(second.begin(), second.end(), data.begin() + first.size()));
+
+          const DataInt& const_data = data;
+          DataInt::const_span_type const_first  = const_data.first_span();
+          DataInt::const_span_type const_second = const_data.second_span();
+
+          CHECK(const_first.data() == first.data());
+          CHECK_EQUAL(first.size(), const_first.size());
+          CHECK_EQUAL(second.size(), const_second.size());
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_available)
     {
@@ -932,5 +1073,51 @@ namespace
 
       CHECK(data1 != data2);
     }
+
+    //*************************************************************************
+    TEST(test_small_memory_model)
+    {
+      typedef etl::circular_buffer<int, 200U, etl::memory_model::MEMORY_MODEL_SMALL> Small;
+      typedef etl::circular_buffer<int, 200U, etl::memory_model::MEMORY_MODEL_LARGE> Large;
+
+      CHECK((etl::is_same<uint_least8_t, Small::size_type>::value));
+      CHECK(sizeof(Small) < sizeof(Large));
+
+      Small data;
+      std::vector<int> expected;
+
+      // Wrap the indexes around several times.
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push(i);
+        expected.push_back(i);
+      }
+
+      expected.erase(expected.begin(), expected.end() - 200);
+
+      CHECK_EQUAL(200U, data.size());
+      CHECK(data.full());
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+      CHECK_EQUAL(expected.back(), data.back());
+      CHECK_EQUAL(200, std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(expected[150], *(data.begin() + 150));
+      CHECK_EQUAL(expected[150], data[150]);
+
+      int more[150];
+      for (int i = 0; i < 150; ++i)
+      {
+        more[i] = 1000 + i;
+        expected.push_back(1000 + i);
+      }
+
+      data.push(more, more + 150);
+      expected.erase(expected.begin(), expected.end() - 200);
+
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+
+      data.pop(199);
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(1149, data.front());
+    }
   };
 }
@@ -0,0 +1,300 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/cobs.h"
+#include "etl/bip_buffer_spsc_atomic.h"
+
+#include <vector>
+#include <random>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //***********************************
+  etl::span<const uint8_t> as_span(const Bytes& bytes)
+  {
+    return bytes.empty() ? etl::span<const uint8_t>() : etl::span<const uint8_t>(bytes.data(), bytes.size());
+  }
+
+  //***********************************
+  etl::span<uint8_t> as_span(Bytes& bytes)
+  {
+    return bytes.empty() ? etl::span<uint8_t>() : etl::span<uint8_t>(bytes.data(), bytes.size());
+  }
+
+  //***********************************
+  Bytes encode(const Bytes& input, bool add_delimiter = true)
+  {
+    Bytes output(etl::cobs_max_encoded_size(input.size()) + 1U);
+
+    const size_t size = etl::cobs_encode(as_span(input), as_span(output), add_delimiter);
+    output.resize(size);
+
+    return output;
+  }
+
+  //***********************************
+  Bytes make_run(uint8_t first, size_t length)
+  {
+    Bytes result;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      result.push_back(uint8_t(first + i));
+    }
+
+    return result;
+  }
+
+  SUITE(test_cobs)
+  {
+    //*************************************************************************
+    TEST(test_encode_known_values)
+    {
+      CHECK((Bytes{ 0x01, 0x01, 0x00 }) == encode(Bytes{ 0x00 }));
+      CHECK((Bytes{ 0x01, 0x01, 0x01, 0x00 }) == encode(Bytes{ 0x00, 0x00 }));
+      CHECK((Bytes{ 0x01, 0x02, 0x11, 0x01, 0x00 }) == encode(Bytes{ 0x00, 0x11, 0x00 }));
+      CHECK((Bytes{ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 }) == encode(Bytes{ 0x11, 0x22, 0x00, 0x33 }));
+      CHECK((Bytes{ 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 }) == encode(Bytes{ 0x11, 0x22, 0x33, 0x44 }));
+      CHECK((Bytes{ 0x01, 0x00 }) == encode(Bytes{}));
+      CHECK((Bytes{ 0x01 }) == encode(Bytes{}, false));
+
+      // 254 non-zero bytes.
+      Bytes input    = make_run(0x01, 254U);
+      Bytes expected = { 0xFF };
+      expected.insert(expected.end(), input.begin(), input.end());
+      expected.push_back(0x00);
+      CHECK(expected == encode(input));
+
+      // 255 non-zero bytes.
+      input    = make_run(0x01, 255U);
+      expected = { 0xFF };
+      expected.insert(expected.end(), input.begin(), input.begin() + 254);
+      expected.push_back(0x02);
+      expected.push_back(0xFF);
+      expected.push_back(0x00);
+      CHECK(expected == encode(input));
+
+      // A zero followed by 254 non-zero bytes.
+      input = { 0x00 };
+      Bytes run = make_run(0x01, 254U);
+      input.insert(input.end(), run.begin(), run.end());
+      expected = { 0x01, 0xFF };
+      expected.insert(expected.end(), run.begin(), run.end());
+      expected.push_back(0x00);
+      CHECK(expected == encode(input));
+
+      // 254 non-zero bytes followed by a zero.
+      input = make_run(0x01, 254U);
+      input.push_back(0x00);
+      expected = { 0xFF };
+      expected.insert(expected.end(), input.begin(), input.begin() + 254);
+      expected.push_back(0x01);
+      expected.push_back(0x01);
+      expected.push_back(0x00);
+      CHECK(expected == encode(input));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_random)
+    {
+      std::mt19937 generator(1);
+
+      for (size_t length = 0U; length < 1200U; length += 17U)
+      {
+        Bytes input(length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          input[i] = ((generator() % 4U) == 0U) ? 0U : uint8_t(generator());
+        }
+
+        const Bytes encoded = encode(input);
+        CHECK(encoded.size() <= etl::cobs_max_encoded_size(length) + 1U);
+        CHECK(std::count(encoded.begin(), encoded.end() - 1, 0) == 0);
+
+        Bytes output(length + 1U);
+        etl::cobs_decoder decoder(as_span(output));
+
+        CHECK_EQUAL(encoded.size(), decoder.decode(as_span(encoded)));
+        CHECK(decoder.is_complete());
+        CHECK(!decoder.has_error());
+        CHECK(Bytes(decoder.frame().begin(), decoder.frame().end()) == input);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_split_input)
+    {
+      Bytes input = make_run(0x01, 300U);
+      input[10]  = 0U;
+      input[11]  = 0U;
+      input[299] = 0U;
+
+      // Encode a byte at a time.
+      Bytes encoded(etl::cobs_max_encoded_size(input.size()) + 1U);
+      etl::cobs_encoder encoder(etl::span<uint8_t>(encoded.data(), encoded.size()));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        CHECK(encoder.add(etl::span<const uint8_t>(&input[i], 1U)));
+      }
+
+      encoded.resize(encoder.finish());
+      CHECK(encoded == encode(input));
+
+      // Decode a byte at a time.
+      Bytes output(input.size());
+      etl::cobs_decoder decoder(etl::span<uint8_t>(output.data(), output.size()));
+
+      for (size_t i = 0U; i < encoded.size(); ++i)
+      {
+        CHECK(!decoder.is_complete());
+        CHECK_EQUAL(1U, decoder.decode(etl::span<const uint8_t>(&encoded[i], 1U)));
+      }
+
+      CHECK(decoder.is_complete());
+      CHECK(!decoder.has_error());
+      CHECK(Bytes(decoder.frame().begin(), decoder.frame().end()) == input);
+    }
+
+    //*************************************************************************
+    TEST(test_stream_of_frames)
+    {
+      const Bytes frame1 = { 0x11, 0x00, 0x22 };
+      const Bytes frame2 = { 0x00 };
+      const Bytes frame3 = { 0x33, 0x44 };
+
+      Bytes stream = { 0x00, 0x00 }; // Leading delimiters are skipped.
+
+      for (const Bytes* frame : { &frame1, &frame2, &frame3 })
+      {
+        Bytes encoded = encode(*frame);
+        stream.insert(stream.end(), encoded.begin(), encoded.end());
+      }
+
+      uint8_t buffer[16];
+      etl::cobs_decoder decoder(etl::span<uint8_t>(buffer, sizeof(buffer)));
+
+      std::vector<Bytes> frames;
+      etl::span<const uint8_t> input(stream.data(), stream.size());
+
+      while (!input.empty())
+      {
+        input = input.subspan(decoder.decode(input));
+
+        if (decoder.is_complete())
+        {
+          frames.push_back(Bytes(decoder.frame().begin(), decoder.frame().end()));
+          decoder.next_frame();
+        }
+      }
+
+      CHECK_EQUAL(3U, frames.size());
+      CHECK(frame1 == frames[0]);
+      CHECK(frame2 == frames[1]);
+      CHECK(frame3 == frames[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      uint8_t buffer[4];
+
+      // The encoder runs out of room.
+      const Bytes input = { 0x11, 0x22, 0x33, 0x44 };
+      CHECK_EQUAL(0U, etl::cobs_encode(etl::span<const uint8_t>(input.data(), input.size()), etl::span<uint8_t>(buffer, sizeof(buffer))));
+      CHECK_EQUAL(5U, etl::cobs_encode(etl::span<const uint8_t>(input.data(), 3U), etl::span<uint8_t>(buffer, sizeof(buffer)), false) + 1U);
+
+      // The decoder runs out of room, then resynchronises on the next frame.
+      const Bytes stream = { 0x06, 0x11, 0x22, 0x33, 0x44, 0x55, 0x00, 0x02, 0x66, 0x00 };
+      etl::cobs_decoder decoder(etl::span<uint8_t>(buffer, sizeof(buffer)));
+
+      CHECK_EQUAL(7U, decoder.decode(etl::span<const uint8_t>(stream.data(), stream.size())));
+      CHECK(decoder.is_complete());
+      CHECK(decoder.has_error());
+
+      decoder.next_frame();
+      CHECK_EQUAL(3U, decoder.decode(etl::span<const uint8_t>(stream.data() + 7U, 3U)));
+      CHECK(decoder.is_complete());
+      CHECK(!decoder.has_error());
+      CHECK_EQUAL(1U, decoder.frame().size());
+      CHECK_EQUAL(0x66, decoder.frame()[0]);
+
+      // A delimiter part way through a block.
+      const Bytes truncated = { 0x04, 0x11, 0x00 };
+      decoder.next_frame();
+      CHECK_EQUAL(3U, decoder.decode(etl::span<const uint8_t>(truncated.data(), truncated.size())));
+      CHECK(decoder.is_complete());
+      CHECK(decoder.has_error());
+    }
+
+    //*************************************************************************
+    TEST(test_decode_from_bip_buffer)
+    {
+      etl::bip_buffer_spsc_atomic<uint8_t, 32> bip;
+
+      const Bytes frame1 = { 0x01, 0x00, 0x02, 0x03 };
+      const Bytes frame2 = { 0x04, 0x05 };
+
+      Bytes stream = encode(frame1);
+      Bytes second = encode(frame2);
+      stream.insert(stream.end(), second.begin(), second.end());
+
+      etl::span<uint8_t> reserve = bip.write_reserve(stream.size());
+      std::copy(stream.begin(), stream.end(), reserve.begin());
+      bip.write_commit(reserve);
+
+      uint8_t buffer[8];
+      etl::cobs_decoder decoder(etl::span<uint8_t>(buffer, sizeof(buffer)));
+      std::vector<Bytes> frames;
+
+      while (!bip.empty())
+      {
+        // Decode in place and release only what was consumed.
+        etl::span<uint8_t> readable = bip.read_reserve();
+        const size_t consumed = decoder.decode(etl::span<const uint8_t>(readable.data(), readable.size()));
+        bip.read_commit(readable.first(consumed));
+
+        if (decoder.is_complete())
+        {
+          frames.push_back(Bytes(decoder.frame().begin(), decoder.frame().end()));
+          decoder.next_frame();
+        }
+      }
+
+      CHECK_EQUAL(2U, frames.size());
+      CHECK(frame1 == frames[0]);
+      CHECK(frame2 == frames[1]);
+    }
+  };
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/compact_optional.h"
+
+namespace
+{
+  enum class Colour : uint8_t
+  {
+    Red,
+    Green,
+    Unknown = 0xFF
+  };
+
+  typedef etl::compact_optional<float>                                                 Float;
+  typedef etl::compact_optional<double>                                                Double;
+  typedef etl::compact_optional<int, etl::compact_optional_sentinel<int, -1> >         Int;
+  typedef etl::compact_optional<const char*>                                           Pointer;
+  typedef etl::compact_optional<Colour, etl::compact_optional_sentinel<Colour, Colour::Unknown> > Enum;
+
+  SUITE(test_compact_optional)
+  {
+    //*************************************************************************
+    TEST(test_size)
+    {
+      CHECK_EQUAL(sizeof(float),       sizeof(Float));
+      CHECK_EQUAL(sizeof(double),      sizeof(Double));
+      CHECK_EQUAL(sizeof(int),         sizeof(Int));
+      CHECK_EQUAL(sizeof(const char*), sizeof(Pointer));
+      CHECK_EQUAL(sizeof(Colour),      sizeof(Enum));
+
+      CHECK(sizeof(Float[100]) < sizeof(etl::optional<float>[100]));
+    }
+
+    //*************************************************************************
+    TEST(test_default_is_empty)
+    {
+      Float  f;
+      Int    i;
+      Pointer p;
+      Enum   e(etl::nullopt);
+
+      CHECK(!f.has_value());
+      CHECK(!bool(i));
+      CHECK(!p.has_value());
+      CHECK(!e.has_value());
+      CHECK(f == etl::nullopt);
+      CHECK(etl::nullopt == i);
+    }
+
+    //*************************************************************************
+    TEST(test_value)
+    {
+      Float f(1.5f);
+      Int   i(0);
+      const char* text = "text";
+      Pointer p(text);
+      Enum  e(Colour::Green);
+
+      CHECK(f.has_value());
+      CHECK_CLOSE(1.5f, f.value(), 0.001f);
+      CHECK_CLOSE(1.5f, *f, 0.001f);
+      CHECK(i.has_value());
+      CHECK_EQUAL(0, *i);
+      CHECK_EQUAL(text, p.value());
+      CHECK(e.value() == Colour::Green);
+
+      f = 2.5f;
+      CHECK_CLOSE(2.5f, f.value(), 0.001f);
+      CHECK(f != etl::nullopt);
+      CHECK(f == 2.5f);
+      CHECK(f != 3.5f);
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      Double d(1.0);
+      Int    i(5);
+
+      d.reset();
+      i = etl::nullopt;
+
+      CHECK(!d.has_value());
+      CHECK(!i.has_value());
+      CHECK_CLOSE(3.0, d.value_or(3.0), 0.001);
+      CHECK_EQUAL(7, i.value_or(7));
+
+      i.emplace(9);
+      CHECK_EQUAL(9, i.value_or(7));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_value_asserts)
+    {
+      Int i;
+
+      CHECK_THROW(i = -1, etl::optional_invalid);
+      CHECK_THROW(Float(etl::numeric_limits<float>::quiet_NaN()), etl::optional_invalid);
+      CHECK_THROW(i.value(), etl::optional_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_comparison)
+    {
+      Int empty;
+      Int one(1);
+      Int two(2);
+
+      CHECK(empty == Int());
+      CHECK(one != two);
+      CHECK(one == Int(1));
+      CHECK(empty < one);
+      CHECK(one < two);
+      CHECK(!(two < one));
+      CHECK(!(one < empty));
+    }
+
+    //*************************************************************************
+    TEST(test_swap)
+    {
+      Float a(1.0f);
+      Float b;
+
+      swap(a, b);
+
+      CHECK(!a.has_value());
+      CHECK_CLOSE(1.0f, b.value(), 0.001f);
+    }
+  };
+}
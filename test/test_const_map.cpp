@@ -0,0 +1,138 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <string>
+#include <utility>
+
+#include "etl/const_map.h"
+#include "etl/string_view.h"
+
+#if ETL_CPP14_SUPPORTED
+
+namespace
+{
+  enum class Register
+  {
+    Control = 0x10,
+    Status  = 0x14,
+    Data    = 0x18
+  };
+
+  typedef etl::const_map<int, const char*, 5> Names;
+
+  constexpr Names names({ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 40, "forty" }, { 7, "seven" } });
+
+  static_assert(names.contains(40), "Key not found");
+  static_assert(!names.contains(4), "Key found");
+  static_assert(names.find(7)->second[0] == 's', "Wrong element");
+  static_assert(names.count(2) == 1U, "Key not counted");
+
+  constexpr etl::const_map<Register, int, 3> registers({ { Register::Control, 0 }, { Register::Status, 1 }, { Register::Data, 2 } });
+
+  static_assert(registers.at(Register::Data) == 2, "Wrong element");
+
+  typedef etl::const_map<uint32_t, uint32_t, 1000U> Large;
+
+  constexpr uint32_t Large_Key(uint32_t i)
+  {
+    return i * 2654435761U;
+  }
+
+  template <size_t... Indexes>
+  constexpr Large make_large(std::index_sequence<Indexes...>)
+  {
+    return Large({ { Large_Key(uint32_t(Indexes)), uint32_t(Indexes) }... });
+  }
+
+  SUITE(test_const_map)
+  {
+    //*************************************************************************
+    TEST(test_constexpr_lookup)
+    {
+      CHECK_EQUAL(5U, names.size());
+      CHECK(!names.empty());
+      CHECK_EQUAL(std::string("three"), std::string(names.at(3)));
+      CHECK(names.find(5) == names.end());
+      CHECK_THROW(names.at(5), etl::const_map_out_of_range);
+      CHECK_EQUAL(1, registers.at(Register::Status));
+    }
+
+    //*************************************************************************
+    TEST(test_iteration_in_given_order)
+    {
+      const int expected[] = { 1, 2, 3, 40, 7 };
+
+      size_t i = 0U;
+
+      for (Names::const_iterator itr = names.begin(); itr != names.end(); ++itr)
+      {
+        CHECK_EQUAL(expected[i++], itr->first);
+      }
+
+      CHECK_EQUAL(5U, i);
+    }
+
+    //*************************************************************************
+    TEST(test_string_view_keys)
+    {
+      typedef etl::const_map<etl::string_view, int, 4> Commands;
+
+      static const Commands commands({ { etl::string_view("reset"), 0 }, { etl::string_view("start"), 1 }, { etl::string_view("stop"), 2 }, { etl::string_view("status"), 3 } });
+
+      CHECK_EQUAL(1, commands.at(etl::string_view("start")));
+      CHECK_EQUAL(3, commands.at(etl::string_view("status")));
+      CHECK(!commands.contains(etl::string_view("stat")));
+    }
+
+    //*************************************************************************
+    TEST(test_repeated_key)
+    {
+      typedef etl::const_map<int, int, 3> Data;
+
+      CHECK_THROW(Data({ { 1, 1 }, { 2, 2 }, { 1, 3 } }), etl::const_map_duplicate);
+    }
+
+    //*************************************************************************
+    TEST(test_large_constexpr_map)
+    {
+      constexpr Large large = make_large(std::make_index_sequence<Large::SIZE>());
+
+      static_assert(large.at(Large_Key(0U)) == 0U, "Wrong element");
+      static_assert(large.at(Large_Key(Large::SIZE - 1U)) == (Large::SIZE - 1U), "Wrong element");
+
+      for (uint32_t i = 0U; i < Large::SIZE; ++i)
+      {
+        CHECK_EQUAL(i, large.at(Large_Key(i)));
+        CHECK(!large.contains(Large_Key(i) + 1U));
+      }
+    }
+  };
+}
+
+#endif
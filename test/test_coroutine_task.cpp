@@ -0,0 +1,266 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/coroutine_task.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+
+#include "etl/scheduler.h"
+#include "etl/queue_spsc_atomic.h"
+
+#include <vector>
+
+#if defined(__GNUC__) && !defined(__clang__)
+  // GCC does not pair a coroutine promise's operator new and delete.
+  #pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+  typedef etl::coroutine_frame_pool<256, 4> FramePool;
+
+  typedef std::vector<int> Log;
+
+  //***************************************************************************
+  etl::coroutine counter(etl::ipool&, Log& log, int n)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      log.push_back(i);
+      co_await etl::coroutine_yield();
+    }
+  }
+
+  //***************************************************************************
+  etl::coroutine sleeper(etl::ipool&, Log& log, const volatile uint32_t& ticks)
+  {
+    log.push_back(1);
+    co_await etl::coroutine_delay(ticks, 10);
+    log.push_back(2);
+    co_await etl::coroutine_delay(ticks, 0);
+    log.push_back(3);
+  }
+
+  //***************************************************************************
+  etl::coroutine consumer(etl::ipool&, Log& log, etl::queue_spsc_atomic<int, 4>& queue)
+  {
+    for (;;)
+    {
+      int value = co_await etl::coroutine_pop(queue);
+
+      if (value < 0)
+      {
+        co_return;
+      }
+
+      log.push_back(value);
+    }
+  }
+
+  //***************************************************************************
+  struct SchedulerIdle
+  {
+    SchedulerIdle()
+      : p_scheduler(nullptr)
+      , max_calls(100)
+      , calls(0)
+    {
+    }
+
+    void idle_callback()
+    {
+      if (++calls == max_calls)
+      {
+        p_scheduler->exit_scheduler();
+      }
+    }
+
+    etl::ischeduler* p_scheduler;
+    int max_calls;
+    int calls;
+  };
+
+  SUITE(test_coroutine_task)
+  {
+    //*************************************************************************
+    TEST(test_frame_comes_from_pool)
+    {
+      FramePool pool;
+      Log log;
+
+      {
+        etl::coroutine co = counter(pool, log, 3);
+
+        CHECK(co.valid());
+        CHECK_EQUAL(1U, pool.size());
+        CHECK(log.empty()); // Starts suspended.
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocation_failure)
+    {
+      etl::coroutine_frame_pool<256, 1> pool;
+      Log log;
+
+      etl::coroutine co1 = counter(pool, log, 3);
+      etl::coroutine co2 = counter(pool, log, 3);
+
+      CHECK(co1.valid());
+      CHECK(!co2.valid());
+      CHECK(co2.done());
+      CHECK(!co2.ready());
+
+      etl::coroutine_frame_pool<1, 1> tiny_pool;
+      etl::coroutine co3 = counter(tiny_pool, log, 3);
+
+      CHECK(!co3.valid());
+      CHECK_EQUAL(0U, tiny_pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_yield)
+    {
+      FramePool pool;
+      Log log;
+
+      etl::coroutine_task task(0, counter(pool, log, 2));
+
+      CHECK_EQUAL(1U, task.task_request_work());
+      task.task_process_work();
+      CHECK_EQUAL(1U, log.size());
+      CHECK_EQUAL(1U, task.task_request_work());
+      task.task_process_work();
+      CHECK_EQUAL(2U, log.size());
+      CHECK(!task.done());
+      task.task_process_work();
+      CHECK(task.done());
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      task.task_process_work(); // Does nothing once done.
+      CHECK_EQUAL(2U, log.size());
+    }
+
+    //*************************************************************************
+    TEST(test_delay)
+    {
+      FramePool pool;
+      Log log;
+      volatile uint32_t ticks = 0xFFFFFFFAUL; // Wraps during the delay.
+
+      etl::coroutine_task task(0, sleeper(pool, log, ticks));
+
+      task.task_process_work();
+      CHECK_EQUAL(1U, log.size());
+
+      for (int i = 0; i < 9; ++i)
+      {
+        ticks = ticks + 1;
+        CHECK_EQUAL(0U, task.task_request_work());
+      }
+
+      ticks = ticks + 1;
+      CHECK_EQUAL(1U, task.task_request_work());
+
+      // A zero delay does not suspend.
+      task.task_process_work();
+      CHECK_EQUAL(3U, log.size());
+      CHECK(task.done());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_pop)
+    {
+      FramePool pool;
+      Log log;
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      queue.push(1);
+
+      etl::coroutine_task task(0, consumer(pool, log, queue));
+
+      task.task_process_work();
+      CHECK_EQUAL(1U, log.size());
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      queue.push(2);
+      CHECK_EQUAL(1U, task.task_request_work());
+      CHECK(queue.empty()); // Taken by the awaitable.
+      CHECK_EQUAL(1U, task.task_request_work());
+
+      task.task_process_work();
+      CHECK_EQUAL(2U, log.size());
+      CHECK_EQUAL(2, log[1]);
+
+      queue.push(-1);
+      task.task_process_work();
+      CHECK(task.done());
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler)
+    {
+      FramePool pool;
+      Log log1;
+      Log log2;
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      etl::coroutine_task task1(1, counter(pool, log1, 3));
+      etl::coroutine_task task2(0, consumer(pool, log2, queue));
+
+      etl::scheduler<etl::scheduler_policy_highest_priority, 2> s;
+      SchedulerIdle idle;
+      idle.p_scheduler = &s;
+      etl::function_mv<SchedulerIdle, &SchedulerIdle::idle_callback> idle_callback(idle);
+      s.set_idle_callback(idle_callback);
+
+      s.add_task(task1);
+      s.add_task(task2);
+
+      queue.push(10);
+      queue.push(20);
+      queue.push(-1);
+
+      s.set_scheduler_running(true);
+      s.start();
+
+      CHECK(task1.done());
+      CHECK(task2.done());
+      CHECK_EQUAL(3U, log1.size());
+      CHECK_EQUAL(2U, log2.size());
+      CHECK_EQUAL(10, log2[0]);
+      CHECK_EQUAL(20, log2[1]);
+    }
+  }
+}
+
+#endif
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/correlation.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -81,6 +82,24 @@ namespace
     0.0, -1.0, -2.0, -3.0, -4.0, -5.0, -6.0, -7.0, -8.0, -9.0
   };
 
+  //*********************************
+  // Pseudo random int16_t samples, starting with a run of the most negative
+  // value, whose squares are the largest the kernels see.
+  std::vector<int16_t> make_int16_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int16_t> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = (i < 24U) ? int16_t(-32768) : int16_t(seed >> 16);
+    }
+
+    samples[24] = 32767;
+
+    return samples;
+  }
+
   SUITE(test_correlation)
   {
     //*************************************************************************
@@ -280,5 +299,47 @@ namespace
       covariance_result = correlation3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_int16_block_correlation_matches_scalar)
+    {
+      std::vector<int16_t> samples1 = make_int16_samples(1027U, 1U);
+      std::vector<int16_t> samples2 = make_int16_samples(1027U, 2U);
+
+      etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> block(samples1.data(), samples1.data() + samples1.size(), samples2.data());
+      etl::correlation<etl::correlation_type::Sample, int16_t, int64_t> scalar;
+
+      for (size_t i = 0U; i < samples1.size(); ++i)
+      {
+        scalar.add(samples1[i], samples2[i]);
+      }
+
+      CHECK_EQUAL(scalar.count(), block.count());
+      CHECK_EQUAL(scalar.get_covariance(), block.get_covariance());
+      CHECK_EQUAL(scalar.get_correlation(), block.get_correlation());
+    }
+
+    //*************************************************************************
+    TEST(test_float_block_correlation_matches_double)
+    {
+      std::vector<float>  samples1(1001U);
+      std::vector<float>  samples2(1001U);
+      std::vector<double> samples1_d(1001U);
+      std::vector<double> samples2_d(1001U);
+
+      for (size_t i = 0U; i < samples1.size(); ++i)
+      {
+        samples1[i]   = float(i % 17U) * 0.25f;
+        samples2[i]   = float(i % 13U) * -0.5f + float(i % 17U);
+        samples1_d[i] = samples1[i];
+        samples2_d[i] = samples2[i];
+      }
+
+      etl::correlation<etl::correlation_type::Sample, float>  block(samples1.data(), samples1.data() + samples1.size(), samples2.data());
+      etl::correlation<etl::correlation_type::Sample, double> reference(samples1_d.begin(), samples1_d.end(), samples2_d.begin());
+
+      CHECK_CLOSE(reference.get_covariance(), block.get_covariance(), 1e-4);
+      CHECK_CLOSE(reference.get_correlation(), block.get_correlation(), 1e-4);
+    }
   };
 }
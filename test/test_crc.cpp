@@ -57,6 +57,28 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_crc_combine()
+  {
+    std::string data("The quick brown fox jumps over the lazy dog, 123456789");
+
+    const typename TCrc::value_type expected = TCrc(data.begin(), data.end()).value();
+
+    for (size_t split = 0UL; split <= data.size(); ++split)
+    {
+      typename TCrc::value_type crc1 = TCrc(data.begin(), data.begin() + split);
+      typename TCrc::value_type crc2 = TCrc(data.begin() + split, data.end());
+
+      if (etl::crc_combine<TCrc>(crc1, crc2, data.size() - split) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_crc)
   {
     //*************************************************************************
@@ -1253,6 +1275,66 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt_combine)
+    {
+      CHECK(check_crc_combine<etl::crc8_ccitt>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_rohc_combine)
+    {
+      CHECK(check_crc_combine<etl::crc8_rohc>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_combine)
+    {
+      CHECK(check_crc_combine<etl::crc16>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_ccitt_combine)
+    {
+      CHECK(check_crc_combine<etl::crc16_ccitt>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_x25_combine)
+    {
+      CHECK(check_crc_combine<etl::crc16_x25>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_combine)
+    {
+      CHECK(check_crc_combine<etl::crc32>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_combine)
+    {
+      CHECK(check_crc_combine<etl::crc32_c>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_bzip2_combine)
+    {
+      CHECK(check_crc_combine<etl::crc32_bzip2>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_posix_combine)
+    {
+      CHECK(check_crc_combine<etl::crc32_posix>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_combine)
+    {
+      CHECK(check_crc_combine<etl::crc64_ecma>());
+    }
   };
 }
 
@@ -258,6 +258,258 @@ namespace
       uint32_t crc3 = etl::crc32_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Table size 2048 (slice-by-8)
+    //*************************************************************************
+    TEST(test_crc32_2048)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t2048 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint8_t>  data3 = { 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 };
+
+      uint32_t crc1 = etl::crc32_t2048(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32_t2048((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint32_t crc3 = etl::crc32_t2048(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_2048_add_range_long)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 40UL; ++length)
+      {
+        etl::crc32_t256  expected(data.begin(), data.end() - length);
+        etl::crc32_t2048 crc(data.begin(), data.end() - length);
+
+        CHECK_EQUAL(expected.value(), crc.value());
+      }
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slice-by-16)
+    //*************************************************************************
+    TEST(test_crc32_4096)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      crc_calculator.add(data.begin(), data.end());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_via_iterator)
+    {
+      std::string data("123456789");
+
+      etl::crc32_t4096 crc_calculator;
+
+      std::copy(data.begin(), data.end(), crc_calculator.input());
+
+      uint32_t crc = crc_calculator.value();
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_endian)
+    {
+      std::vector<uint8_t>  data1 = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+      std::vector<uint32_t> data2 = { 0x04030201, 0x08070605 };
+      std::vector<uint8_t>  data3 = { 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01 };
+
+      uint32_t crc1 = etl::crc32_t4096(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32_t4096((uint8_t*)&data2[0], (uint8_t*)(&data2[0] + data2.size()));
+      CHECK_EQUAL(crc1, crc2);
+
+      uint32_t crc3 = etl::crc32_t4096(data3.rbegin(), data3.rend());
+      CHECK_EQUAL(crc1, crc3);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_4096_add_range_long)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 40UL; ++length)
+      {
+        etl::crc32_t256  expected(data.begin(), data.end() - length);
+        etl::crc32_t4096 crc(data.begin(), data.end() - length);
+
+        CHECK_EQUAL(expected.value(), crc.value());
+      }
+    }
+
+#if ETL_CRC32_HARDWARE_SUPPORTED
+    //*************************************************************************
+    // Hardware
+    //*************************************************************************
+    TEST(test_crc32_hardware)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_hardware(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_hardware_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_hardware crc_calculator;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_hardware_add_range_long)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 40UL; ++length)
+      {
+        etl::crc32_t256     expected(data.begin(), data.end() - length);
+        etl::crc32_hardware crc(data.begin(), data.end() - length);
+
+        CHECK_EQUAL(expected.value(), crc.value());
+      }
+    }
+#endif
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_crc32_constexpr)
+    {
+      constexpr char data[] = "123456789";
+
+      constexpr uint32_t crc4    = etl::crc32_t4(data, data + 9).value();
+      constexpr uint32_t crc16   = etl::crc32_t16(data, data + 9).value();
+      constexpr uint32_t crc256  = etl::crc32_t256(data, data + 9).value();
+      constexpr uint32_t crc2048 = etl::crc32_t2048(data, data + 9).value();
+      constexpr uint32_t crc4096 = etl::crc32_t4096(data, data + 9).value();
+
+      CHECK_EQUAL(0xCBF43926U, crc4);
+      CHECK_EQUAL(0xCBF43926U, crc16);
+      CHECK_EQUAL(0xCBF43926U, crc256);
+      CHECK_EQUAL(0xCBF43926U, crc2048);
+      CHECK_EQUAL(0xCBF43926U, crc4096);
+    }
+#endif
   };
 }
 
@@ -0,0 +1,269 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc_accelerator.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+
+namespace
+{
+  //***************************************************************************
+  // A pretend CRC-32 peripheral that calculates with the software policy.
+  // Background calculations complete after a number of polls.
+  //***************************************************************************
+  struct MockCrc32Peripheral
+  {
+    typedef etl::private_crc::crc32_parameters parameters_type;
+
+    static const size_t Minimum_Length = 4U;
+
+    static uint32_t calculate(uint32_t crc, const uint8_t* data, size_t length)
+    {
+      ++calculate_count;
+
+      return compute(crc, data, length);
+    }
+
+    static void begin(uint32_t crc, const uint8_t* data, size_t length)
+    {
+      ++begin_count;
+      polls          = 0;
+      register_value = compute(crc, data, length);
+    }
+
+    static bool is_complete()
+    {
+      return ++polls > Polls_To_Complete;
+    }
+
+    static uint32_t result()
+    {
+      return register_value;
+    }
+
+    static void clear()
+    {
+      calculate_count = 0;
+      begin_count     = 0;
+      polls           = 0;
+    }
+
+    static uint32_t compute(uint32_t crc, const uint8_t* data, size_t length)
+    {
+      etl::private_crc::crc_policy<parameters_type, 256U> policy;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        crc = policy.add(crc, data[i]);
+      }
+
+      return crc;
+    }
+
+    static const int Polls_To_Complete = 3;
+
+    static int      calculate_count;
+    static int      begin_count;
+    static int      polls;
+    static uint32_t register_value;
+  };
+
+  int      MockCrc32Peripheral::calculate_count = 0;
+  int      MockCrc32Peripheral::begin_count     = 0;
+  int      MockCrc32Peripheral::polls           = 0;
+  uint32_t MockCrc32Peripheral::register_value  = 0U;
+
+  typedef etl::crc_accelerated_type<etl::private_crc::crc32_parameters,   MockCrc32Peripheral> Crc32Accelerated;
+  typedef etl::crc_accelerated_type<etl::private_crc::crc32_c_parameters, MockCrc32Peripheral> Crc32CAccelerated;
+  typedef etl::crc_async<etl::private_crc::crc32_parameters,   MockCrc32Peripheral>            Crc32Async;
+  typedef etl::crc_async<etl::private_crc::crc32_c_parameters, MockCrc32Peripheral>            Crc32CAsync;
+
+  const std::string check("123456789");
+
+  SUITE(test_crc_accelerator)
+  {
+    //*************************************************************************
+    TEST(test_parameters_match)
+    {
+      CHECK((etl::private_crc::crc_parameters_match<etl::private_crc::crc32_parameters,       etl::private_crc::crc32_parameters>::value));
+      CHECK((etl::private_crc::crc_parameters_match<etl::private_crc::crc32_jamcrc_parameters, etl::private_crc::crc32_parameters>::value));
+      CHECK(!(etl::private_crc::crc_parameters_match<etl::private_crc::crc32_c_parameters,    etl::private_crc::crc32_parameters>::value));
+      CHECK(!(etl::private_crc::crc_parameters_match<etl::private_crc::crc32_bzip2_parameters, etl::private_crc::crc32_parameters>::value));
+      CHECK(!(etl::private_crc::crc_parameters_match<etl::private_crc::crc16_parameters,       etl::private_crc::crc32_parameters>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_accelerated_range)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      uint32_t crc = Crc32Accelerated(p, p + check.size());
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+      CHECK_EQUAL(1, MockCrc32Peripheral::calculate_count);
+    }
+
+    //*************************************************************************
+    TEST(test_accelerated_add_values_and_ranges)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      Crc32Accelerated crc;
+      crc.add(p[0]);
+      crc.add(p + 1, p + 3);  // Below the minimum length.
+      crc.add(p + 3, p + 9);
+
+      CHECK_EQUAL(0xCBF43926U, crc.value());
+      CHECK_EQUAL(1, MockCrc32Peripheral::calculate_count);
+    }
+
+    //*************************************************************************
+    TEST(test_accelerated_non_contiguous_range)
+    {
+      MockCrc32Peripheral::clear();
+
+      uint32_t crc = Crc32Accelerated(check.begin(), check.end());
+
+      CHECK_EQUAL(0xCBF43926U, crc);
+      CHECK_EQUAL(0, MockCrc32Peripheral::calculate_count);
+    }
+
+    //*************************************************************************
+    TEST(test_accelerated_parameters_do_not_match)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      uint32_t crc = Crc32CAccelerated(p, p + check.size());
+
+      CHECK_EQUAL(0xE3069283U, crc);
+      CHECK_EQUAL(0, MockCrc32Peripheral::calculate_count);
+    }
+
+    //*************************************************************************
+    TEST(test_accelerated_large_buffer)
+    {
+      MockCrc32Peripheral::clear();
+
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i * 7U);
+      }
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+      uint32_t crc      = Crc32Accelerated(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(expected, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_async)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      Crc32Async crc;
+
+      CHECK(crc.is_complete());
+      CHECK(crc.begin(etl::span<const uint8_t>(p, check.size())));
+      CHECK(!crc.is_complete());
+      CHECK(!crc.is_complete());
+      CHECK(!crc.is_complete());
+      CHECK(crc.is_complete());
+      CHECK_EQUAL(0xCBF43926U, crc.value());
+      CHECK_EQUAL(1, MockCrc32Peripheral::begin_count);
+    }
+
+    //*************************************************************************
+    TEST(test_async_value_waits)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      Crc32Async crc;
+
+      crc.begin(p, 2U);  // Below the minimum length.
+      CHECK(crc.is_complete());
+
+      CHECK(crc.begin(etl::span<const uint8_t>(p + 2U, 7U)));
+      CHECK_EQUAL(0xCBF43926U, crc.value());
+      CHECK(crc.is_complete());
+      CHECK_EQUAL(1, MockCrc32Peripheral::begin_count);
+    }
+
+    //*************************************************************************
+    TEST(test_async_successive_buffers_and_reset)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      Crc32Async crc;
+
+      crc.begin(etl::span<const uint8_t>(p, 4U));
+      crc.begin(etl::span<const uint8_t>(p + 4U, 5U));  // Waits for the first.
+      CHECK_EQUAL(0xCBF43926U, crc.value());
+      CHECK_EQUAL(2, MockCrc32Peripheral::begin_count);
+
+      crc.reset();
+      crc.begin(etl::span<const uint8_t>(p, check.size()));
+      CHECK_EQUAL(0xCBF43926U, crc.value());
+    }
+
+    //*************************************************************************
+    TEST(test_async_parameters_do_not_match)
+    {
+      MockCrc32Peripheral::clear();
+
+      const uint8_t* p = reinterpret_cast<const uint8_t*>(check.data());
+
+      Crc32CAsync crc;
+
+      CHECK(!crc.begin(etl::span<const uint8_t>(p, check.size())));
+      CHECK(crc.is_complete());
+      CHECK_EQUAL(0xE3069283U, crc.value());
+      CHECK_EQUAL(0, MockCrc32Peripheral::begin_count);
+    }
+  }
+}
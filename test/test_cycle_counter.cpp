@@ -0,0 +1,158 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <vector>
+
+#include "etl/cycle_counter.h"
+#include "etl/log_histogram.h"
+
+namespace
+{
+  //***************************************************************************
+  // A clock that only moves when told to.
+  //***************************************************************************
+  struct ManualClock
+  {
+    typedef uint32_t value_type;
+
+    static value_type now()
+    {
+      return time;
+    }
+
+    static value_type time;
+  };
+
+  ManualClock::value_type ManualClock::time = 0U;
+
+  //***************************************************************************
+  // Records the values it is given.
+  //***************************************************************************
+  struct Recorder
+  {
+    void operator ()(uint32_t value)
+    {
+      values.push_back(value);
+    }
+
+    std::vector<uint32_t> values;
+  };
+
+  //***************************************************************************
+  // Work that the compiler cannot remove.
+  //***************************************************************************
+  uint32_t busy_work()
+  {
+    volatile uint32_t sum = 0U;
+
+    for (uint32_t i = 0U; i < 10000U; ++i)
+    {
+      sum = sum + i;
+    }
+
+    return sum;
+  }
+
+  typedef etl::log_histogram<uint32_t, uint32_t, 5> Histogram;
+
+  SUITE(test_cycle_counter)
+  {
+#if ETL_HAS_CYCLE_COUNTER
+    //*************************************************************************
+    TEST(test_counter_counts_up)
+    {
+      etl::cycle_counter::enable();
+
+      const etl::cycle_counter::value_type start = etl::cycle_counter::now();
+
+      busy_work();
+
+      CHECK(etl::cycle_counter::elapsed(start) > 0U);
+    }
+
+    //*************************************************************************
+    TEST(test_scoped_timer_with_cycle_counter)
+    {
+      Histogram histogram;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        etl::scoped_timer<Histogram> timer(histogram);
+
+        busy_work();
+      }
+
+      CHECK_EQUAL(10U, histogram.count());
+      CHECK(histogram.value_at_quantile(0.5) > 0U);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_scoped_timer_passes_elapsed_to_sink)
+    {
+      Recorder recorder;
+
+      ManualClock::time = 0xFFFFFFF0UL;
+
+      {
+        etl::scoped_timer<Recorder, ManualClock> timer(recorder);
+
+        ManualClock::time += 5U;
+        CHECK_EQUAL(5U, timer.elapsed());
+
+        // Across the wrap.
+        ManualClock::time += 20U;
+        CHECK(recorder.values.empty());
+      }
+
+      CHECK_EQUAL(1U, recorder.values.size());
+      CHECK_EQUAL(25U, recorder.values[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_scoped_timer_into_histogram)
+    {
+      Histogram histogram;
+
+      for (uint32_t i = 1U; i <= 100U; ++i)
+      {
+        etl::scoped_timer<Histogram, ManualClock> timer(histogram);
+
+        ManualClock::time += i;
+      }
+
+      CHECK_EQUAL(100U, histogram.count());
+      CHECK_EQUAL(1U,   histogram.value_at_quantile(0.0));
+      CHECK_EQUAL(100U, histogram.value_at_quantile(1.0));
+    }
+  };
+}
@@ -329,5 +329,73 @@ namespace
       CHECK(!member2_called);
       CHECK(unhandled_called);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sparse_delegate_compile_time)
+    {
+      using SparseService = etl::sparse_delegate_service<3U, 1000U, 40000U>;
+
+      SparseService service;
+
+      CHECK_EQUAL(3U, SparseService::Number_Of_Ids);
+
+      service.register_delegate<1000U>(global_callback);
+      service.register_delegate<40000U>(test.callback);
+
+      service.call<1000U>();
+      CHECK_EQUAL(1000U, called_id);
+      CHECK(global_called);
+      CHECK(!member1_called);
+
+      service.call<40000U>();
+      CHECK_EQUAL(40000U, called_id);
+      CHECK(member1_called);
+
+      service.call<3U>();
+      CHECK(!unhandled_called);
+
+      service.register_unhandled_delegate(unhandled_callback);
+      service.call<3U>();
+      CHECK_EQUAL(3U, called_id);
+      CHECK(unhandled_called);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_sparse_delegate_run_time)
+    {
+      using SparseService = etl::sparse_delegate_service<3U, 1000U, 40000U, 65535U>;
+
+      SparseService service;
+
+      CHECK(SparseService::contains(3U));
+      CHECK(SparseService::contains(65535U));
+      CHECK(!SparseService::contains(0U));
+      CHECK(!SparseService::contains(1001U));
+      CHECK(!SparseService::contains(70000U));
+
+      service.register_delegate(3U,     global_callback);
+      service.register_delegate(65535U, member_callback);
+      service.register_delegate(1001U,  test.callback); // Not in the list; ignored.
+
+      service.call(3U);
+      CHECK_EQUAL(3U, called_id);
+      CHECK(global_called);
+
+      service.call(65535U);
+      CHECK_EQUAL(65535U, called_id);
+      CHECK(member2_called);
+
+      service.register_unhandled_delegate(unhandled_callback);
+
+      service.call(1001U);
+      CHECK_EQUAL(1001U, called_id);
+      CHECK(!member1_called);
+      CHECK(unhandled_called);
+
+      unhandled_called = false;
+      service.call(40000U);
+      CHECK_EQUAL(40000U, called_id);
+      CHECK(unhandled_called);
+    }
   };
 }
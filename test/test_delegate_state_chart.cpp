@@ -0,0 +1,283 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/delegate_state_chart.h"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  // Events
+  struct EventId
+  {
+    enum
+    {
+      START,
+      STOP,
+      EMERGENCY_STOP,
+      STOPPED,
+      SET_SPEED,
+      ABORT
+    };
+  };
+
+  //***************************************************************************
+  // States
+  struct StateId
+  {
+    enum
+    {
+      IDLE,
+      RUNNING,
+      WINDING_DOWN,
+      LOCKED,
+      NUMBER_OF_STATES
+    };
+  };
+
+  //***************************************************************************
+  // The record of what was called.
+  //***************************************************************************
+  struct Record
+  {
+    void clear()
+    {
+      calls.clear();
+      speed     = 0;
+      is_locked = false;
+    }
+
+    std::vector<std::string> calls;
+    int  speed     = 0;
+    bool is_locked = false;
+  };
+
+  Record record;
+
+  void on_start()                 { record.calls.push_back("on_start"); }
+  void on_stop()                  { record.calls.push_back("on_stop"); }
+  void on_stopped()               { record.calls.push_back("on_stopped"); }
+  void on_set_speed()             { record.calls.push_back("on_set_speed"); }
+  void on_abort()                 { record.calls.push_back("on_abort"); }
+  void on_enter_idle()            { record.calls.push_back("on_enter_idle"); }
+  void on_exit_idle()             { record.calls.push_back("on_exit_idle"); }
+  void on_enter_running()         { record.calls.push_back("on_enter_running"); }
+  void on_enter_winding_down()    { record.calls.push_back("on_enter_winding_down"); }
+  void on_enter_locked()          { record.calls.push_back("on_enter_locked"); }
+  bool not_locked()               { return !record.is_locked; }
+  void set_speed(int speed)       { record.speed = speed; record.calls.push_back("set_speed"); }
+
+  //***************************************************************************
+  // The tables for the parameterless state chart.
+  //***************************************************************************
+  typedef etl::delegate_state_chart<> Chart;
+  typedef etl::delegate<void()>       action_t;
+  typedef etl::delegate<bool()>       guard_t;
+
+  constexpr Chart::transition transition_table[] =
+  {
+    Chart::transition(StateId::IDLE,         EventId::START,          StateId::RUNNING,      action_t::create<on_start>(), guard_t::create<not_locked>()),
+    Chart::transition(StateId::RUNNING,      EventId::STOP,           StateId::WINDING_DOWN, action_t::create<on_stop>()),
+    Chart::transition(StateId::RUNNING,      EventId::SET_SPEED,      StateId::RUNNING,      action_t::create<on_set_speed>()),
+    Chart::transition(StateId::RUNNING,      EventId::EMERGENCY_STOP, StateId::IDLE),
+    Chart::transition(StateId::WINDING_DOWN, EventId::STOPPED,        StateId::IDLE,         action_t::create<on_stopped>()),
+    Chart::transition(                       EventId::ABORT,          StateId::LOCKED,       action_t::create<on_abort>())
+  };
+
+  constexpr Chart::state state_table[] =
+  {
+    Chart::state(StateId::IDLE,         Chart::state_action_t::create<on_enter_idle>(), Chart::state_action_t::create<on_exit_idle>()),
+    Chart::state(StateId::RUNNING,      Chart::state_action_t::create<on_enter_running>()),
+    Chart::state(StateId::WINDING_DOWN, Chart::state_action_t::create<on_enter_winding_down>()),
+    Chart::state(StateId::LOCKED,       Chart::state_action_t::create<on_enter_locked>())
+  };
+
+  //***************************************************************************
+  // The tables for the state chart with an event parameter.
+  //***************************************************************************
+  typedef etl::delegate_state_chart<int> ParameterChart;
+
+  constexpr ParameterChart::transition parameter_transition_table[] =
+  {
+    ParameterChart::transition(StateId::IDLE,    EventId::START,     StateId::RUNNING),
+    ParameterChart::transition(StateId::RUNNING, EventId::SET_SPEED, StateId::RUNNING, ParameterChart::action_t::create<set_speed>()),
+    ParameterChart::transition(StateId::RUNNING, EventId::STOP,      StateId::IDLE)
+  };
+
+  //***************************************************************************
+  void run_sequence(Chart& chart)
+  {
+    chart.start();
+    CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+    // Not handled in IDLE.
+    chart.process_event(EventId::STOP);
+    CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+    chart.process_event(EventId::START);
+    CHECK_EQUAL(StateId::RUNNING, chart.get_state_id());
+
+    // Self transition does not call entry or exit.
+    chart.process_event(EventId::SET_SPEED);
+    CHECK_EQUAL(StateId::RUNNING, chart.get_state_id());
+
+    chart.process_event(EventId::STOP);
+    CHECK_EQUAL(StateId::WINDING_DOWN, chart.get_state_id());
+
+    chart.process_event(EventId::STOPPED);
+    CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+    // Guard blocks the transition.
+    record.is_locked = true;
+    chart.process_event(EventId::START);
+    CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+
+    // From any state.
+    chart.process_event(EventId::ABORT);
+    CHECK_EQUAL(StateId::LOCKED, chart.get_state_id());
+
+    std::vector<std::string> expected =
+    {
+      "on_enter_idle",
+      "on_start", "on_exit_idle", "on_enter_running",
+      "on_set_speed",
+      "on_stop", "on_enter_winding_down",
+      "on_stopped", "on_enter_idle",
+      "on_abort", "on_exit_idle", "on_enter_locked"
+    };
+
+    CHECK(expected == record.calls);
+  }
+
+  SUITE(test_delegate_state_chart)
+  {
+    //*************************************************************************
+    TEST(test_constexpr_tables)
+    {
+      static_assert(transition_table[1].event_id == EventId::STOP, "Table is not constexpr");
+      static_assert(transition_table[5].from_any_state, "Table is not constexpr");
+      static_assert(state_table[3].state_id == StateId::LOCKED, "Table is not constexpr");
+
+      CHECK(transition_table[0].guard.is_valid());
+      CHECK(!transition_table[1].guard.is_valid());
+      CHECK(!transition_table[3].action.is_valid());
+      CHECK(!state_table[1].on_exit.is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart)
+    {
+      record.clear();
+
+      Chart chart(etl::begin(transition_table), etl::end(transition_table),
+                  etl::begin(state_table),      etl::end(state_table),
+                  StateId::IDLE);
+
+      CHECK(!chart.has_index());
+      run_sequence(chart);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_indexed)
+    {
+      record.clear();
+
+      Chart chart(etl::begin(transition_table), etl::end(transition_table),
+                  etl::begin(state_table),      etl::end(state_table),
+                  StateId::IDLE);
+
+      etl::state_chart_index<StateId::NUMBER_OF_STATES, EventId::ABORT + 1, ETL_ARRAY_SIZE(transition_table)> index;
+
+      CHECK(chart.set_index(index));
+      CHECK(chart.has_index());
+      run_sequence(chart);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_index_too_small)
+    {
+      record.clear();
+
+      Chart chart(etl::begin(transition_table), etl::end(transition_table),
+                  etl::begin(state_table),      etl::end(state_table),
+                  StateId::IDLE);
+
+      etl::state_chart_index<StateId::NUMBER_OF_STATES, EventId::ABORT, ETL_ARRAY_SIZE(transition_table)> index;
+
+      CHECK(!chart.set_index(index));
+      CHECK(!chart.has_index());
+      run_sequence(chart);
+    }
+
+    //*************************************************************************
+    TEST(test_not_started)
+    {
+      record.clear();
+
+      Chart chart(etl::begin(transition_table), etl::end(transition_table), StateId::IDLE);
+
+      chart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+      CHECK(record.calls.empty());
+
+      // No state table, so no entry or exit.
+      chart.start();
+      chart.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, chart.get_state_id());
+      CHECK_EQUAL(1U, record.calls.size());
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_with_parameter)
+    {
+      record.clear();
+
+      ParameterChart chart(etl::begin(parameter_transition_table), etl::end(parameter_transition_table), StateId::IDLE);
+
+      chart.start();
+      chart.process_event(EventId::SET_SPEED, 10);
+      CHECK_EQUAL(0, record.speed);
+
+      chart.process_event(EventId::START);
+      chart.process_event(EventId::SET_SPEED, 10);
+      CHECK_EQUAL(10, record.speed);
+
+      // Default parameter.
+      chart.process_event(EventId::SET_SPEED);
+      CHECK_EQUAL(0, record.speed);
+
+      chart.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::IDLE, chart.get_state_id());
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/delegate_timer_wheel.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  uint64_t ticks = 0;
+
+  //***************************************************************************
+  class Collector
+  {
+  public:
+
+    void callback()
+    {
+      tick_list.push_back(ticks);
+    }
+
+    void on_expired(etl::span<const etl::timer_wheel::id::type> ids)
+    {
+      batches.push_back(std::vector<etl::timer_wheel::id::type>(ids.begin(), ids.end()));
+      batch_ticks.push_back(ticks);
+    }
+
+    std::vector<uint64_t> tick_list;
+    std::vector<std::vector<etl::timer_wheel::id::type>> batches;
+    std::vector<uint64_t> batch_ticks;
+  };
+
+  //***************************************************************************
+  std::vector<uint64_t> free_tick_list;
+
+  void free_callback()
+  {
+    free_tick_list.push_back(ticks);
+  }
+
+  //***************************************************************************
+  template <typename TController>
+  void run(TController& controller, uint32_t step, uint64_t until)
+  {
+    while (ticks < until)
+    {
+      ticks += step;
+      controller.tick(step);
+    }
+  }
+
+  SUITE(test_delegate_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(delegate_timer_wheel_callbacks)
+    {
+      Collector collector;
+      etl::delegate_timer_wheel<3> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(etl::delegate<void()>::create<Collector, &Collector::callback>(collector), 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(etl::delegate<void()>::create<free_callback>(), 11, etl::timer::mode::REPEATING);
+      etl::timer_wheel::id::type id3 = timer_controller.register_timer(etl::delegate<void()>::create<free_callback>(), 11, etl::timer::mode::REPEATING);
+
+      CHECK(id1 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id2 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(timer_controller.unregister_timer(id3));
+
+      free_tick_list.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 1U, 50U);
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 11, 22, 33, 44 };
+
+      CHECK(collector.tick_list == compare1);
+      CHECK(free_tick_list == compare2);
+      CHECK_EQUAL(1U, timer_controller.number_of_active_timers());
+    }
+
+    //*************************************************************************
+    TEST(delegate_timer_wheel_batch_callback)
+    {
+      Collector collector;
+      etl::delegate_timer_wheel<4> timer_controller;
+
+      timer_controller.set_batch_callback(etl::idelegate_timer_wheel::batch_callback_type::create<Collector, &Collector::on_expired>(collector));
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(10, etl::timer::mode::REPEATING);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(10, etl::timer::mode::REPEATING);
+      etl::timer_wheel::id::type id3 = timer_controller.register_timer(15, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id4 = timer_controller.register_timer(etl::delegate<void()>::create<free_callback>(), 10, etl::timer::mode::SINGLE_SHOT);
+
+      free_tick_list.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.start(id3);
+      timer_controller.start(id4);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 1U, 20U);
+
+      // Timers with their own callback are not batched.
+      std::vector<uint64_t> compare_free = { 10 };
+      CHECK(free_tick_list == compare_free);
+
+      // One batch for each tick with batched expiries.
+      std::vector<uint64_t> compare_ticks = { 10, 15, 20 };
+      CHECK(collector.batch_ticks == compare_ticks);
+
+      CHECK_EQUAL(3U, collector.batches.size());
+      CHECK_EQUAL(2U, collector.batches[0].size());
+      CHECK(std::find(collector.batches[0].begin(), collector.batches[0].end(), id1) != collector.batches[0].end());
+      CHECK(std::find(collector.batches[0].begin(), collector.batches[0].end(), id2) != collector.batches[0].end());
+      CHECK_EQUAL(1U, collector.batches[1].size());
+      CHECK_EQUAL(id3, collector.batches[1][0]);
+      CHECK_EQUAL(2U, collector.batches[2].size());
+    }
+
+    //*************************************************************************
+    TEST(delegate_timer_wheel_no_batch_callback)
+    {
+      etl::delegate_timer_wheel<1> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(5, etl::timer::mode::REPEATING);
+
+      timer_controller.start(id1);
+      timer_controller.enable(true);
+
+      // Expiries without a callback are discarded.
+      ticks = 0;
+      run(timer_controller, 1U, 20U);
+
+      CHECK_EQUAL(5U, timer_controller.time_to_next());
+    }
+  };
+}
@@ -835,6 +835,91 @@ namespace
       CHECK(data.full());
     }
 
+    //*************************************************************************
+    struct append_segment
+    {
+      append_segment(std::vector<int>& values_, size_t& segments_)
+        : values(values_)
+        , segments(segments_)
+      {
+      }
+
+      void operator()(const int* first, const int* last)
+      {
+        values.insert(values.end(), first, last);
+        ++segments;
+      }
+
+      std::vector<int>& values;
+      size_t&           segments;
+    };
+
+    TEST(test_segmented_for_each)
+    {
+      // Every start position in the ring, for every size.
+      for (size_t offset = 0U; offset <= SIZE; ++offset)
+      {
+        for (size_t length = 0U; length <= SIZE; ++length)
+        {
+          DataInt data;
+
+          for (size_t i = 0U; i < offset; ++i)
+          {
+            data.push_back(0);
+            data.pop_front();
+          }
+
+          for (size_t i = 0U; i < length; ++i)
+          {
+            data.push_back(int(i));
+          }
+
+          std::vector<int> expected(data.begin(), data.end());
+          std::vector<int> values;
+          size_t           segments = 0U;
+
+          const DataInt& const_data = data;
+          const_data.segmented_for_each(append_segment(values, segments));
+
+          CHECK(expected == values);
+          CHECK(segments <= 2U);
+          CHECK((length == 0U) == (segments == 0U));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_segmented_for_each_modify)
+    {
+      DataInt data;
+
+      for (size_t i = 0U; i < 10U; ++i)
+      {
+        data.push_back(0);
+        data.pop_front();
+      }
+
+      data.assign(int_data1.begin(), int_data1.end());
+
+      struct add_one
+      {
+        void operator()(int* first, int* last)
+        {
+          while (first != last)
+          {
+            ++*first++;
+          }
+        }
+      };
+
+      data.segmented_for_each(add_one());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int_data1[i] + 1, data[i]);
+      }
+    }
+
     //*************************************************************************
     TEST(test_clear)
     {
@@ -1547,6 +1632,31 @@ namespace
       CHECK_EQUAL(size_t(0), data.size());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_unchecked)
+    {
+      Compare_Data compare_data;
+      DataNDC data;
+
+      compare_data.push_back(N1);
+      compare_data.push_back(N2);
+      compare_data.push_front(N0);
+      data.push_back_unchecked(N1);
+      data.push_back_unchecked(N2);
+      data.push_front_unchecked(N0);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+
+      compare_data.pop_front();
+      compare_data.pop_back();
+      data.pop_front_unchecked();
+      data.pop_back_unchecked();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+    }
+
     //*************************************************************************
     TEST(test_pop_back_exception)
     {
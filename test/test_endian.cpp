@@ -28,11 +28,71 @@ SOFTWARE.
 
 #include "unit_test_framework.h"
 #include <string>
+#include <vector>
 
 #include "etl/endianness.h"
 
 namespace 
-{		
+{
+  //***********************************
+  // Fills an array with values whose bytes are all different.
+  template <typename T>
+  std::vector<T> make_values(size_t count)
+  {
+    std::vector<T> values(count);
+    uint8_t        b = 1U;
+
+    for (size_t i = 0U; i < count; ++i)
+    {
+      uint8_t bytes[sizeof(T)];
+
+      for (size_t j = 0U; j < sizeof(T); ++j)
+      {
+        bytes[j] = b++;
+      }
+
+      memcpy(&values[i], bytes, sizeof(T));
+    }
+
+    return values;
+  }
+
+  //***********************************
+  // Checks every length up to 'max_count', in place, copying and misaligned.
+  template <typename T>
+  void check_reverse_bytes(size_t max_count)
+  {
+    for (size_t count = 0U; count <= max_count; ++count)
+    {
+      const std::vector<T> values = make_values<T>(count + 1U);
+
+      // In place.
+      std::vector<T> in_place(values);
+      etl::reverse_bytes(in_place.data(), count);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        CHECK_EQUAL(etl::reverse_bytes(values[i]), in_place[i]);
+      }
+
+      CHECK_EQUAL(values[count], in_place[count]);
+
+      // Copying, to a misaligned destination.
+      std::vector<uint8_t> buffer((count + 1U) * sizeof(T) + 1U, 0xAAU);
+      T* destination = reinterpret_cast<T*>(buffer.data() + 1U);
+      etl::reverse_bytes(values.data(), count, destination);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        T value;
+        memcpy(&value, buffer.data() + 1U + (i * sizeof(T)), sizeof(T));
+        CHECK_EQUAL(etl::reverse_bytes(values[i]), value);
+      }
+
+      CHECK_EQUAL(0xAAU, buffer[1U + (count * sizeof(T))]);
+    }
+  }
+
   SUITE(test_endian)
   {
     //*************************************************************************
@@ -45,5 +105,87 @@ namespace
       CHECK(etl::endianness::value() == etl::endian::little);
       CHECK(etl::endianness::value() != etl::endian::big);
     }
+
+    //*************************************************************************
+    TEST(test_reverse_bytes_array)
+    {
+      check_reverse_bytes<uint16_t>(70U);
+      check_reverse_bytes<int16_t>(20U);
+      check_reverse_bytes<uint32_t>(40U);
+      check_reverse_bytes<int32_t>(20U);
+      check_reverse_bytes<uint64_t>(20U);
+      check_reverse_bytes<int64_t>(10U);
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_bytes_float_array)
+    {
+      const float values[] = { 1.0f, -2.5f, 3.25f, 1.0e-20f, 6.0f };
+      float       swapped[5];
+
+      etl::reverse_bytes(values, 5U, swapped);
+      CHECK(memcmp(values, swapped, sizeof(values)) != 0);
+
+      etl::reverse_bytes(swapped, 5U);
+      CHECK(memcmp(values, swapped, sizeof(values)) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_bytes_bytes)
+    {
+      const uint8_t values[] = { 1, 2, 3 };
+      uint8_t       copied[3] = { 0, 0, 0 };
+
+      etl::reverse_bytes(values, 3U, copied);
+      CHECK(memcmp(values, copied, sizeof(values)) == 0);
+    }
+
+    //*************************************************************************
+    TEST(test_hton_ntoh_range)
+    {
+      const std::vector<uint32_t> values = make_values<uint32_t>(37U);
+
+      std::vector<uint32_t> network(values.size());
+      etl::hton_range(values.data(), values.size(), network.data());
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        CHECK_EQUAL(etl::hton(values[i]), network[i]);
+      }
+
+      etl::ntoh_range(network.data(), network.size());
+      CHECK(values == network);
+    }
+
+    //*************************************************************************
+    TEST(test_span_ranges)
+    {
+      std::vector<uint16_t> values = make_values<uint16_t>(33U);
+      const std::vector<uint16_t> original(values);
+
+      etl::reverse_bytes(etl::span<uint16_t>(values.data(), values.size()));
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        CHECK_EQUAL(etl::reverse_bytes(original[i]), values[i]);
+      }
+
+      // Copying converts as many as fit.
+      uint16_t host[20];
+      const size_t count = etl::ntoh_range(etl::span<const uint16_t>(values.data(), values.size()), etl::span<uint16_t>(host));
+      CHECK_EQUAL(20U, count);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        CHECK_EQUAL(original[i], host[i]);
+      }
+
+      etl::hton_range(etl::span<uint16_t>(host));
+      CHECK_EQUAL(values[19], host[19]);
+
+      uint16_t copied[40];
+      CHECK_EQUAL(33U, etl::reverse_bytes(etl::span<uint16_t>(values.data(), values.size()), etl::span<uint16_t>(copied)));
+      CHECK_EQUAL(original[32], copied[32]);
+    }
   };
 }
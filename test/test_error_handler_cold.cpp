@@ -0,0 +1,157 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// The asserts are checked in the cold mode, with both logging and exceptions.
+#define ETL_COLD_ASSERTS
+#define ETL_LOG_ERRORS
+
+#include "unit_test_framework.h"
+
+#include <string.h>
+
+#include "etl/error_handler.h"
+#include "etl/exception.h"
+
+namespace
+{
+  int errors_received;
+
+  //*****************************************************************************
+  // An exception.
+  //*****************************************************************************
+  class test_exception : public etl::exception
+  {
+  public:
+
+    test_exception(string_type file_name_, numeric_type line_number_)
+      : exception(ETL_ERROR_TEXT("test_exception", "123"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //*****************************************************************************
+  // Another exception, to instantiate a second failure function.
+  //*****************************************************************************
+  class other_exception : public etl::exception
+  {
+  public:
+
+    other_exception(string_type file_name_, numeric_type line_number_)
+      : exception(ETL_ERROR_TEXT("other_exception", "456"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //*****************************************************************************
+  void receive_error(const etl::exception&)
+  {
+    ++errors_received;
+  }
+
+  //*****************************************************************************
+  // Functions that check their arguments.
+  //*****************************************************************************
+  int checked(int value)
+  {
+    ETL_ASSERT(value >= 0, ETL_ERROR(test_exception));
+    ETL_ASSERT(value < 10, ETL_ERROR(other_exception));
+
+    return value;
+  }
+
+  int checked_return_value(int value)
+  {
+    ETL_ASSERT_AND_RETURN_VALUE(value >= 0, ETL_ERROR(test_exception), -1);
+
+    return value;
+  }
+
+  void always_fails()
+  {
+    ETL_ALWAYS_ASSERT(ETL_ERROR(other_exception));
+  }
+}
+
+namespace
+{
+  SUITE(test_error_handler_cold)
+  {
+    //*************************************************************************
+    TEST(test_assert_passes)
+    {
+      etl::error_handler::set_callback<receive_error>();
+      errors_received = 0;
+
+      CHECK_EQUAL(5, checked(5));
+      CHECK_EQUAL(5, checked_return_value(5));
+      CHECK_EQUAL(0, errors_received);
+    }
+
+    //*************************************************************************
+    TEST(test_assert_fails)
+    {
+      etl::error_handler::set_callback<receive_error>();
+      errors_received = 0;
+
+      CHECK_THROW(checked(-1), test_exception);
+      CHECK_EQUAL(1, errors_received);
+
+      CHECK_THROW(checked(10), other_exception);
+      CHECK_EQUAL(2, errors_received);
+
+      CHECK_THROW(checked_return_value(-1), test_exception);
+      CHECK_EQUAL(3, errors_received);
+    }
+
+    //*************************************************************************
+    TEST(test_always_assert)
+    {
+      etl::error_handler::set_callback<receive_error>();
+      errors_received = 0;
+
+      CHECK_THROW(always_fails(), other_exception);
+      CHECK_EQUAL(1, errors_received);
+    }
+
+    //*************************************************************************
+    TEST(test_exception_details_are_kept)
+    {
+      try
+      {
+        checked(-1);
+        CHECK(false);
+      }
+      catch (const etl::exception& e)
+      {
+        CHECK(strcmp(e.what(), "test_exception") == 0);
+        CHECK(strstr(e.file_name(), "test_error_handler_cold.cpp") != ETL_NULLPTR);
+        CHECK(e.line_number() != 0);
+      }
+    }
+  }
+}
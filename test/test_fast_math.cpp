@@ -0,0 +1,284 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fast_math.h"
+
+#include <cmath>
+
+namespace
+{
+  //*********************************
+  template <size_t Order>
+  double max_log2_error()
+  {
+    double worst = 0.0;
+
+    for (int i = 0; i < 100000; ++i)
+    {
+      const float x = std::ldexp(1.0f + (float(i) / 100000.0f), (i % 41) - 20);
+      worst = std::max(worst, std::fabs(double(etl::fast_log2<Order>(x)) - std::log2(double(x))));
+    }
+
+    return worst;
+  }
+
+  //*********************************
+  template <size_t Order>
+  double max_exp2_error()
+  {
+    double worst = 0.0;
+
+    for (int i = -100000; i < 100000; ++i)
+    {
+      const float  x        = float(i) / 2000.0f;
+      const double expected = std::exp2(double(x));
+      worst = std::max(worst, std::fabs(double(etl::fast_exp2<Order>(x)) - expected) / expected);
+    }
+
+    return worst;
+  }
+
+  SUITE(test_fast_math)
+  {
+    //*************************************************************************
+    TEST(test_isqrt)
+    {
+      for (uint32_t i = 0U; i <= 0xFFFFU; ++i)
+      {
+        const uint16_t root = etl::isqrt(uint16_t(i));
+
+        CHECK(uint32_t(root) * root <= i);
+        CHECK((uint32_t(root) + 1U) * (uint32_t(root) + 1U) > i);
+      }
+
+      CHECK_EQUAL(65535U, etl::isqrt(uint32_t(0xFFFFFFFFUL)));
+      CHECK_EQUAL(65535U, etl::isqrt(uint32_t(65536UL * 65536UL - 1UL)));
+      CHECK_EQUAL(46340U, etl::isqrt(uint32_t(2147483647UL)));
+      CHECK_EQUAL(0xFFFFFFFFULL, etl::isqrt(uint64_t(0xFFFFFFFFFFFFFFFFULL)));
+      CHECK_EQUAL(3037000499ULL, etl::isqrt(uint64_t(9223372036854775807ULL)));
+      CHECK_EQUAL(0U, etl::isqrt(uint8_t(0U)));
+      CHECK_EQUAL(15U, etl::isqrt(uint8_t(255U)));
+    }
+
+    //*************************************************************************
+    TEST(test_ilog2)
+    {
+      CHECK_EQUAL(0U, etl::ilog2(0U));
+      CHECK_EQUAL(0U, etl::ilog2(1U));
+      CHECK_EQUAL(1U, etl::ilog2(3U));
+      CHECK_EQUAL(7U, etl::ilog2(uint8_t(255U)));
+      CHECK_EQUAL(31U, etl::ilog2(uint32_t(0x80000000UL)));
+      CHECK_EQUAL(63U, etl::ilog2(uint64_t(0xFFFFFFFFFFFFFFFFULL)));
+
+      for (size_t i = 0U; i < 64U; ++i)
+      {
+        CHECK_EQUAL(i, etl::ilog2(uint64_t(1) << i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fast_inverse_sqrt)
+    {
+      double worst1 = 0.0;
+      double worst2 = 0.0;
+
+      for (int i = 1; i < 100000; ++i)
+      {
+        const float  x        = float(i) * 0.37f;
+        const double expected = 1.0 / std::sqrt(double(x));
+
+        worst1 = std::max(worst1, std::fabs(double(etl::fast_inverse_sqrt(x)) - expected) / expected);
+        worst2 = std::max(worst2, std::fabs(double(etl::fast_inverse_sqrt<2>(x)) - expected) / expected);
+      }
+
+      CHECK(worst1 < 1.8e-3);
+      CHECK(worst2 < 4.8e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_fast_log2)
+    {
+      CHECK(max_log2_error<2>() < 7.7e-3);
+      CHECK(max_log2_error<3>() < 8.9e-4);
+      CHECK(max_log2_error<4>() < 1.2e-4);
+      CHECK(max_log2_error<5>() < 1.7e-5);
+
+      // Exact at powers of two.
+      CHECK_EQUAL(0.0f, etl::fast_log2<3>(1.0f));
+      CHECK_EQUAL(10.0f, etl::fast_log2<3>(1024.0f));
+      CHECK_EQUAL(-3.0f, etl::fast_log2<3>(0.125f));
+    }
+
+    //*************************************************************************
+    TEST(test_fast_exp2)
+    {
+      CHECK(max_exp2_error<2>() < 2.8e-3);
+      CHECK(max_exp2_error<3>() < 1.1e-4);
+      CHECK(max_exp2_error<4>() < 3.5e-6);
+      CHECK(max_exp2_error<5>() < 3.0e-7); // Limited by float.
+
+      CHECK_EQUAL(1.0f, etl::fast_exp2<3>(0.0f));
+      CHECK_EQUAL(1024.0f, etl::fast_exp2<3>(10.0f));
+      CHECK_EQUAL(0.125f, etl::fast_exp2<3>(-3.0f));
+
+      // Limits.
+      CHECK(std::isfinite(etl::fast_exp2<3>(1000.0f)));
+      CHECK(etl::fast_exp2<3>(1000.0f) > 1e38f);
+      CHECK(etl::fast_exp2<3>(-1000.0f) > 0.0f);
+      CHECK(etl::fast_exp2<3>(-1000.0f) < 1e-37f);
+    }
+
+    //*************************************************************************
+    TEST(test_fast_log2_fixed_point)
+    {
+      typedef etl::fixed_point<15, 16, int32_t> fixed_t;
+
+      double worst = 0.0;
+
+      for (int i = 1; i < 100000; ++i)
+      {
+        const double x = double(i) * 0.0731;
+        const fixed_t result = etl::fast_log2<5>(fixed_t::from_floating(x));
+        worst = std::max(worst, std::fabs(result.to_floating<double>() - std::log2(fixed_t::from_floating(x).to_floating<double>())));
+      }
+
+      // The polynomial error plus rounding to 16 fractional bits.
+      CHECK(worst < (1.6e-5 + (1.0 / 65536.0)));
+
+      CHECK_EQUAL(3 * 65536, etl::fast_log2<3>(fixed_t::from_integer(8)).raw());
+      CHECK_EQUAL(-16 * 65536, etl::fast_log2<3>(fixed_t::from_raw(1)).raw());
+      CHECK(fixed_t::min() == etl::fast_log2<3>(fixed_t()));
+      CHECK(fixed_t::min() == etl::fast_log2<3>(fixed_t::from_integer(-1)));
+
+      // Q15 values are all below one.
+      const etl::q15_t half = etl::fast_log2<4>(etl::q15_t::from_floating(0.5));
+      CHECK(etl::q15_t::from_floating(-1.0) == half);
+      CHECK_CLOSE(std::log2(0.75), etl::fast_log2<4>(etl::q15_t::from_floating(0.75)).to_floating<double>(), 2e-4);
+    }
+
+    //*************************************************************************
+    TEST(test_fast_exp2_fixed_point)
+    {
+      typedef etl::fixed_point<15, 16, int32_t> fixed_t;
+
+      bool within = true;
+
+      for (int i = -16000; i < 14900; ++i)
+      {
+        const fixed_t x        = fixed_t::from_floating(double(i) / 1000.0);
+        const double  expected = std::exp2(x.to_floating<double>());
+        const double  actual   = etl::fast_exp2<5>(x).to_floating<double>();
+
+        // The polynomial error plus rounding to 16 fractional bits.
+        within = within && (std::fabs(actual - expected) <= ((expected * 1e-6) + (0.5 / 65536.0)));
+      }
+
+      CHECK(within);
+
+      CHECK_EQUAL(8 * 65536, etl::fast_exp2<3>(fixed_t::from_integer(3)).raw());
+      CHECK_EQUAL(32768, etl::fast_exp2<3>(fixed_t::from_integer(-1)).raw());
+      CHECK(fixed_t::max() == etl::fast_exp2<3>(fixed_t::from_integer(15)));
+      CHECK(fixed_t::max() == etl::fast_exp2<3>(fixed_t::from_integer(1000)));
+      CHECK_EQUAL(1, etl::fast_exp2<3>(fixed_t::from_integer(-17)).raw()); // Half an LSB rounds up.
+      CHECK_EQUAL(0, etl::fast_exp2<3>(fixed_t::from_integer(-18)).raw());
+      CHECK_EQUAL(0, etl::fast_exp2<3>(fixed_t::min()).raw());
+    }
+
+    //*************************************************************************
+    TEST(test_sine_table)
+    {
+      const etl::sine_table<8> table;
+
+      CHECK_EQUAL(256U, (etl::sine_table<8>::Size));
+      CHECK_EQUAL(0.0f, table[0]);
+      CHECK_EQUAL(1.0f, table[64]);
+      CHECK_EQUAL(-1.0f, table[192]);
+
+      double worst = 0.0;
+
+      for (int i = -20000; i < 20000; ++i)
+      {
+        const double x = double(i) * 0.0013;
+
+        worst = std::max(worst, std::fabs(double(table.sin(float(x))) - std::sin(double(float(x)))));
+        worst = std::max(worst, std::fabs(double(table.cos(x)) - std::cos(x)));
+      }
+
+      CHECK(worst < 7.6e-5);
+
+      CHECK_CLOSE(1.0f, table.sin_phase(0x40000000UL), 1e-7);
+      CHECK_CLOSE(0.0f, table.cos_phase(0x40000000UL), 1e-7);
+      CHECK_CLOSE(std::sin(0.1), table.sin_phase(uint32_t(0.1 / (2.0 * 3.14159265358979323846) * 4294967296.0)), 1e-4);
+
+      // Larger tables are more accurate.
+      const etl::sine_table<12, double> fine;
+      worst = 0.0;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const double x = double(i) * 0.001;
+        worst = std::max(worst, std::fabs(fine.sin(x) - std::sin(x)));
+      }
+
+      CHECK(worst < 3e-7);
+    }
+
+    //*************************************************************************
+    TEST(test_sine_table_fixed_point)
+    {
+      const etl::sine_table<10, etl::q15_t> table;
+
+      CHECK(etl::q15_t::max() == table[256]);
+      CHECK(etl::q15_t::min() == table[768]);
+
+      double worst = 0.0;
+
+      for (uint32_t phase = 0U; phase < 0xFFFF0000UL; phase += 0x10001U)
+      {
+        const double expected = std::sin(double(phase) * (2.0 * 3.14159265358979323846 / 4294967296.0));
+        worst = std::max(worst, std::fabs(table.sin_phase(phase).to_floating<double>() - expected));
+      }
+
+      CHECK(worst < 1e-4);
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_sine_table_constexpr)
+    {
+      static constexpr etl::sine_table<6> table;
+      constexpr float quarter = table.sin_phase(0x40000000UL);
+
+      CHECK_EQUAL(1.0f, quarter);
+    }
+#endif
+  };
+}
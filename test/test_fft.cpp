@@ -0,0 +1,395 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fft.h"
+
+#include <cmath>
+#include <string.h>
+
+namespace
+{
+  const double pi = 3.14159265358979323846;
+
+  //*********************************
+  // A test signal, with some structure and some noise.
+  double signal(size_t i)
+  {
+    const uint32_t noise = uint32_t(i * 2654435761UL) >> 20;
+
+    return (0.3 * std::sin(double(i) * 0.37)) + (0.2 * std::cos(double(i) * 1.9)) + ((double(noise) / 4096.0) - 0.5) * 0.4;
+  }
+
+  //*********************************
+  // The discrete Fourier transform of n interleaved complex values.
+  void dft(const double* input, double* output, size_t n)
+  {
+    for (size_t k = 0U; k < n; ++k)
+    {
+      double re = 0.0;
+      double im = 0.0;
+
+      for (size_t t = 0U; t < n; ++t)
+      {
+        const double angle = -2.0 * pi * double((k * t) % n) / double(n);
+
+        re += (input[2U * t] * std::cos(angle)) - (input[(2U * t) + 1U] * std::sin(angle));
+        im += (input[2U * t] * std::sin(angle)) + (input[(2U * t) + 1U] * std::cos(angle));
+      }
+
+      output[2U * k]        = re;
+      output[(2U * k) + 1U] = im;
+    }
+  }
+
+  //*********************************
+  template <size_t N, typename T>
+  double forward_error()
+  {
+    double input[2U * N];
+    double expected[2U * N];
+    T      data[2U * N];
+
+    for (size_t i = 0U; i < (2U * N); ++i)
+    {
+      input[i] = signal(i);
+      data[i]  = T(input[i]);
+    }
+
+    dft(input, expected, N);
+
+    const etl::fft<N, T> transform;
+    transform.forward(data);
+
+    double worst = 0.0;
+
+    for (size_t i = 0U; i < (2U * N); ++i)
+    {
+      worst = std::max(worst, std::fabs(double(data[i]) - expected[i]));
+    }
+
+    return worst;
+  }
+
+  //*********************************
+  template <size_t N, typename T>
+  double round_trip_error()
+  {
+    T data[2U * N];
+
+    for (size_t i = 0U; i < (2U * N); ++i)
+    {
+      data[i] = T(signal(i));
+    }
+
+    const etl::fft<N, T> transform;
+    transform.forward(data);
+    transform.inverse(data);
+
+    double worst = 0.0;
+
+    for (size_t i = 0U; i < (2U * N); ++i)
+    {
+      worst = std::max(worst, std::fabs(double(data[i]) - double(T(signal(i)))));
+    }
+
+    return worst;
+  }
+
+  //*********************************
+  template <size_t N, typename T>
+  double forward_real_error()
+  {
+    double input[2U * N];
+    double expected[2U * N];
+    T      data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      input[2U * i]        = signal(i);
+      input[(2U * i) + 1U] = 0.0;
+      data[i]              = T(input[2U * i]);
+    }
+
+    dft(input, expected, N);
+
+    // Bin N/2 is packed into the imaginary part of bin 0.
+    expected[1] = expected[N];
+
+    const etl::fft<N, T> transform;
+    transform.forward_real(data);
+
+    double worst = 0.0;
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      worst = std::max(worst, std::fabs(double(data[i]) - expected[i]));
+    }
+
+    return worst;
+  }
+
+  //*********************************
+  template <size_t N, typename T>
+  double real_round_trip_error()
+  {
+    T data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      data[i] = T(signal(i));
+    }
+
+    const etl::fft<N, T> transform;
+    transform.forward_real(data);
+    transform.inverse_real(data);
+
+    double worst = 0.0;
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      worst = std::max(worst, std::fabs(double(data[i]) - double(T(signal(i)))));
+    }
+
+    return worst;
+  }
+
+  SUITE(test_fft)
+  {
+    //*************************************************************************
+    TEST(test_forward)
+    {
+      // Even and odd powers of two, so with and without the radix 2 stage.
+      CHECK((forward_error<4U,    double>() < 1e-15));
+      CHECK((forward_error<8U,    double>() < 1e-15));
+      CHECK((forward_error<64U,   double>() < 1e-14));
+      CHECK((forward_error<128U,  double>() < 1e-13));
+      CHECK((forward_error<1024U, double>() < 1e-12));
+
+      CHECK((forward_error<4U,    float>() < 1e-6));
+      CHECK((forward_error<32U,   float>() < 1e-6));
+      CHECK((forward_error<256U,  float>() < 5e-6));
+      CHECK((forward_error<512U,  float>() < 1e-5));
+    }
+
+    //*************************************************************************
+    TEST(test_inverse)
+    {
+      CHECK((round_trip_error<4U,    double>() < 1e-15));
+      CHECK((round_trip_error<128U,  double>() < 1e-15));
+      CHECK((round_trip_error<1024U, double>() < 1e-15));
+      CHECK((round_trip_error<8U,    float>()  < 1e-7));
+      CHECK((round_trip_error<256U,  float>()  < 3e-7));
+    }
+
+    //*************************************************************************
+    TEST(test_forward_real)
+    {
+      CHECK((forward_real_error<4U,    double>() < 1e-15));
+      CHECK((forward_real_error<8U,    double>() < 1e-15));
+      CHECK((forward_real_error<64U,   double>() < 1e-14));
+      CHECK((forward_real_error<128U,  double>() < 1e-13));
+      CHECK((forward_real_error<1024U, double>() < 1e-12));
+      CHECK((forward_real_error<256U,  float>()  < 5e-6));
+    }
+
+    //*************************************************************************
+    TEST(test_inverse_real)
+    {
+      CHECK((real_round_trip_error<4U,    double>() < 1e-15));
+      CHECK((real_round_trip_error<8U,    double>() < 1e-15));
+      CHECK((real_round_trip_error<512U,  double>() < 1e-15));
+      CHECK((real_round_trip_error<1024U, double>() < 1e-15));
+      CHECK((real_round_trip_error<256U,  float>()  < 3e-7));
+    }
+
+    //*************************************************************************
+    TEST(test_tone)
+    {
+      const size_t N = 64U;
+
+      double data[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        data[i] = std::cos(2.0 * pi * 5.0 * double(i) / double(N));
+      }
+
+      const etl::fft<N, double> transform;
+      transform.forward_real(data);
+
+      for (size_t k = 1U; k < (N / 2U); ++k)
+      {
+        CHECK_CLOSE((k == 5U) ? double(N / 2U) : 0.0, data[2U * k], 1e-12);
+        CHECK_CLOSE(0.0, data[(2U * k) + 1U], 1e-12);
+      }
+
+      CHECK_CLOSE(0.0, data[0], 1e-12);
+      CHECK_CLOSE(0.0, data[1], 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point)
+    {
+      const size_t N = 256U;
+
+      double input[2U * N];
+      double expected[2U * N];
+
+      etl::q15_t data[2U * N];
+
+      for (size_t i = 0U; i < (2U * N); ++i)
+      {
+        data[i]  = etl::q15_t::from_floating(signal(i));
+        input[i] = data[i].to_floating<double>();
+      }
+
+      dft(input, expected, N);
+
+      const etl::fft<N, etl::q15_t> transform;
+      transform.forward(data);
+
+      // Scaled by 1/N, with rounding at each of the four stages.
+      double worst = 0.0;
+
+      for (size_t i = 0U; i < (2U * N); ++i)
+      {
+        worst = std::max(worst, std::fabs(data[i].to_floating<double>() - (expected[i] / double(N))));
+      }
+
+      CHECK(worst < (4.0 / 32768.0));
+
+      // The round trip divides by N.
+      transform.inverse(data);
+
+      worst = 0.0;
+
+      for (size_t i = 0U; i < (2U * N); ++i)
+      {
+        worst = std::max(worst, std::fabs(data[i].to_floating<double>() - (input[i] / double(N))));
+      }
+
+      CHECK(worst < (4.0 / 32768.0));
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_real)
+    {
+      const size_t N = 128U;
+
+      double input[2U * N];
+      double expected[2U * N];
+
+      etl::q15_t data[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        data[i]              = etl::q15_t::from_floating(signal(i));
+        input[2U * i]        = data[i].to_floating<double>();
+        input[(2U * i) + 1U] = 0.0;
+      }
+
+      dft(input, expected, N);
+      expected[1] = expected[N];
+
+      const etl::fft<N, etl::q15_t> transform;
+      transform.forward_real(data);
+
+      double worst = 0.0;
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        worst = std::max(worst, std::fabs(data[i].to_floating<double>() - (expected[i] / double(N))));
+      }
+
+      CHECK(worst < (4.0 / 32768.0));
+
+      // Full scale input does not overflow.
+      for (size_t i = 0U; i < N; ++i)
+      {
+        data[i] = etl::q15_t::max();
+      }
+
+      transform.forward_real(data);
+
+      CHECK_CLOSE(1.0, data[0].to_floating<double>(), 1e-3);
+      CHECK_CLOSE(0.0, data[1].to_floating<double>(), 1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_known_answer)
+    {
+      // Fixed point results are the same on every target.
+      const size_t N = 64U;
+
+      etl::q15_t data[2U * N];
+
+      for (size_t i = 0U; i < (2U * N); ++i)
+      {
+        data[i] = etl::q15_t::from_floating(signal(i));
+      }
+
+      const etl::fft<N, etl::q15_t> transform;
+      transform.forward(data);
+
+      uint32_t hash = 2166136261UL;
+
+      for (size_t i = 0U; i < (2U * N); ++i)
+      {
+        hash = (hash ^ uint16_t(data[i].raw())) * 16777619UL;
+      }
+
+      CHECK_EQUAL(2667904204UL, hash);
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr etl::fft<256U, float> constant;
+      const etl::fft<256U, float>            variable;
+
+      float a[512];
+      float b[512];
+
+      for (size_t i = 0U; i < 512U; ++i)
+      {
+        a[i] = float(signal(i));
+        b[i] = a[i];
+      }
+
+      constant.forward(a);
+      variable.forward(b);
+
+      CHECK(memcmp(a, b, sizeof(a)) == 0);
+    }
+#endif
+  };
+}
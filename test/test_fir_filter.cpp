@@ -0,0 +1,249 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fir_filter.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  //*********************************
+  std::vector<double> make_signal(size_t size)
+  {
+    std::vector<double> signal(size);
+    uint32_t seed = 1U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      signal[i] = (0.5 * std::sin(double(i) * 0.05)) + (double(seed >> 8) / double(1U << 25)) - 0.25;
+    }
+
+    return signal;
+  }
+
+  //*********************************
+  // Direct convolution.
+  template <size_t Taps>
+  double convolve(const std::vector<double>& signal, size_t n, const double (&h)[Taps])
+  {
+    double sum = 0.0;
+
+    for (size_t k = 0U; (k < Taps) && (k <= n); ++k)
+    {
+      sum += h[k] * signal[n - k];
+    }
+
+    return sum;
+  }
+
+  const double coefficients[7] = { 0.05, -0.1, 0.25, 0.6, 0.25, -0.1, 0.05 };
+
+  SUITE(test_fir_filter)
+  {
+    //*************************************************************************
+    TEST(test_impulse_response)
+    {
+      const float h[5] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+
+      etl::fir_filter<float, 5> filter(h);
+
+      CHECK_EQUAL(5U, (etl::fir_filter<float, 5>::Number_Of_Taps));
+      std::vector<float> output;
+      output.push_back(filter(1.0f));
+
+      for (size_t i = 1U; i < 7U; ++i)
+      {
+        output.push_back(filter(0.0f));
+      }
+
+      for (size_t i = 0U; i < 5U; ++i)
+      {
+        CHECK_EQUAL(h[i], output[i]);
+      }
+
+      CHECK_EQUAL(0.0f, output[5]);
+      CHECK_EQUAL(0.0f, output[6]);
+
+      // Default constructed filters output zero.
+      etl::fir_filter<float, 3> zero;
+      CHECK_EQUAL(0.0f, zero(10.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_matches_convolution)
+    {
+      const std::vector<double> signal = make_signal(1000U);
+
+      etl::fir_filter<double, 7> filter(coefficients);
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        const double output = filter.process(signal[i]);
+        CHECK_CLOSE(convolve(signal, i, coefficients), output, 1e-12);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_block_matches_single)
+    {
+      const std::vector<double> signal = make_signal(1000U);
+
+      etl::fir_filter<double, 7> single(coefficients);
+      etl::fir_filter<double, 7> block(coefficients);
+
+      std::vector<double> output(signal);
+
+      // In place, in uneven blocks.
+      std::vector<double>::iterator itr = output.begin();
+      itr = block.process(itr, itr + 3, itr);
+      itr = block.process(itr, itr + 500, itr);
+      itr = block.process(itr, output.end(), itr);
+      CHECK(itr == output.end());
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        const double expected = single(signal[i]);
+        CHECK_EQUAL(expected, output[i]);
+      }
+
+      // Longer than the line, so that the history is moved.
+      std::vector<double> long_signal = make_signal(100U);
+      std::vector<double> long_output(long_signal.size());
+      block.reset();
+      single.reset();
+      block.process(long_signal.begin(), long_signal.end(), long_output.begin());
+
+      for (size_t i = 0U; i < long_signal.size(); ++i)
+      {
+        const double expected = single(long_signal[i]);
+        CHECK_EQUAL(expected, long_output[i]);
+      }
+
+      // After a reset, the filter starts again.
+      block.reset();
+      single.reset();
+      const double expected = single(1.0);
+      CHECK_EQUAL(expected, block(1.0));
+      CHECK_EQUAL(coefficients[0], block.coefficient(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_float_block_matches_single)
+    {
+      const std::vector<double> signal = make_signal(1000U);
+
+      float h[33];
+
+      for (size_t i = 0U; i < 33U; ++i)
+      {
+        h[i] = float(std::sin(double(i) * 0.3) / 10.0);
+      }
+
+      etl::fir_filter<float, 33> single(h);
+      etl::fir_filter<float, 33> block(h);
+
+      std::vector<float> input(signal.begin(), signal.end());
+      std::vector<float> output(input.size());
+
+      block.process(input.begin(), input.end(), output.begin());
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        const float expected = single(input[i]);
+        CHECK_CLOSE(expected, output[i], 1e-6);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point)
+    {
+      typedef etl::q15_t fixed_t;
+
+      const std::vector<double> signal = make_signal(1000U);
+
+      fixed_t h[7];
+
+      for (size_t i = 0U; i < 7U; ++i)
+      {
+        h[i] = fixed_t::from_floating(coefficients[i]);
+      }
+
+      etl::fir_filter<fixed_t, 7> filter(h);
+
+      std::vector<int16_t> raw(signal.size());
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        raw[i] = fixed_t::from_floating(signal[i]).raw();
+      }
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        // The exact sum, rounded half away from zero once.
+        int64_t sum = 0;
+
+        for (size_t k = 0U; (k < 7U) && (k <= i); ++k)
+        {
+          sum += int64_t(h[k].raw()) * raw[i - k];
+        }
+
+        const int64_t magnitude = (sum < 0) ? -sum : sum;
+        const int64_t rounded   = (magnitude + 16384) >> 15;
+        const int64_t expected  = (sum < 0) ? -rounded : rounded;
+
+        const fixed_t output = filter(fixed_t::from_raw(raw[i]));
+        CHECK_EQUAL(expected, int64_t(output.raw()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_saturates)
+    {
+      typedef etl::q15_t fixed_t;
+
+      const fixed_t h[4] = { fixed_t::max(), fixed_t::max(), fixed_t::max(), fixed_t::max() };
+
+      etl::fir_filter<fixed_t, 4> filter(h);
+
+      filter(fixed_t::max());
+      filter(fixed_t::max());
+      const fixed_t high = filter(fixed_t::max());
+      CHECK(fixed_t::max() == high);
+
+      filter.reset();
+      filter(fixed_t::min());
+      const fixed_t low = filter(fixed_t::min());
+      CHECK(fixed_t::min() == low);
+    }
+  };
+}
@@ -0,0 +1,320 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_point.h"
+#include "etl/scaled_rounding.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  typedef etl::fixed_point_rounding rounding;
+
+  //*********************************
+  // Rounds x as the mode describes, using the floating point library.
+  double reference_round(rounding::enum_type mode, double x)
+  {
+    const double lower = std::floor(x);
+    const double upper = std::ceil(x);
+    const double away  = (x < 0.0) ? lower : upper;
+    const double zero  = (x < 0.0) ? upper : lower;
+
+    switch (mode)
+    {
+      case rounding::ceiling:   return upper;
+      case rounding::floor:     return lower;
+      case rounding::zero:      return zero;
+      case rounding::infinity:  return away;
+      default: break;
+    }
+
+    const double fraction = std::fabs(x - zero);
+
+    if (fraction > 0.5)
+    {
+      return away;
+    }
+    else if (fraction < 0.5)
+    {
+      return zero;
+    }
+
+    switch (mode)
+    {
+      case rounding::half_up:   return away;
+      case rounding::half_down: return zero;
+      case rounding::half_even: return (std::fmod(zero, 2.0) == 0.0) ? zero : away;
+      default:                  return (std::fmod(zero, 2.0) != 0.0) ? zero : away;
+    }
+  }
+
+  //*********************************
+  uint32_t next_random(uint32_t& seed)
+  {
+    seed = (seed * 1664525U) + 1013904223U;
+    return seed >> 8;
+  }
+
+  //*********************************
+  // Every product and quotient of a format matches the reference.
+  template <rounding::enum_type Mode>
+  void check_rounding()
+  {
+    typedef etl::fixed_point<3, 12, int16_t, Mode> fixed_t;
+
+    uint32_t seed = 1U;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      const fixed_t a = fixed_t::from_raw(int16_t(next_random(seed)));
+      const fixed_t b = fixed_t::from_raw(int16_t(next_random(seed) >> (next_random(seed) % 16U)));
+
+      const double product  = reference_round(Mode, (double(a.raw()) * double(b.raw())) / 4096.0);
+      const double expected = std::min(std::max(product, -32768.0), 32767.0);
+
+      CHECK_EQUAL(expected, double((a * b).raw()));
+
+      if (b.raw() != 0)
+      {
+        const double quotient = reference_round(Mode, (double(a.raw()) * 4096.0) / double(b.raw()));
+        const double expected_quotient = std::min(std::max(quotient, -32768.0), 32767.0);
+
+        CHECK_EQUAL(expected_quotient, double((a / b).raw()));
+      }
+
+      CHECK_EQUAL(reference_round(Mode, double(a.raw()) / 4096.0), double(a.to_integer()));
+
+      const double x = double(int32_t(next_random(seed)) - 8388608) / 1048576.0;
+      CHECK_EQUAL(reference_round(Mode, x * 4096.0), double(fixed_t::from_floating(x).raw()));
+    }
+  }
+
+  //*********************************
+  // The array functions match the scalar operators.
+  template <typename TFixed>
+  void check_arrays(uint32_t seed)
+  {
+    const size_t size = 1003U;
+
+    std::vector<TFixed> a(size);
+    std::vector<TFixed> b(size);
+    std::vector<TFixed> result(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      a[i] = TFixed::from_raw(typename TFixed::storage_type(next_random(seed) << 8));
+      b[i] = TFixed::from_raw(typename TFixed::storage_type(next_random(seed) << 8));
+    }
+
+    // Include the extremes.
+    a[0] = TFixed::min();
+    b[0] = TFixed::min();
+    a[1] = TFixed::max();
+    b[1] = TFixed::max();
+    a[2] = TFixed::min();
+    b[2] = TFixed::max();
+
+    // Products that are exactly half way, of both signs.
+    if (TFixed::Fraction_Bits != 0U)
+    {
+      for (size_t i = 8U; i < 24U; ++i)
+      {
+        const int half = 1 << (TFixed::Fraction_Bits - 1U);
+
+        a[i] = TFixed::from_raw(typename TFixed::storage_type((i < 16U) ? -int(i) : int(i)));
+        b[i] = TFixed::from_raw(typename TFixed::storage_type(half));
+      }
+    }
+
+    etl::fixed_point_add(&a[0], &b[0], &result[0], size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      CHECK(result[i] == (a[i] + b[i]));
+    }
+
+    etl::fixed_point_subtract(&a[0], &b[0], &result[0], size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      CHECK(result[i] == (a[i] - b[i]));
+    }
+
+    etl::fixed_point_multiply(&a[0], &b[0], &result[0], size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      CHECK(result[i] == (a[i] * b[i]));
+    }
+  }
+
+  SUITE(test_fixed_point)
+  {
+    //*************************************************************************
+    TEST(test_limits)
+    {
+      CHECK_EQUAL(32767,  etl::q15_t::max().raw());
+      CHECK_EQUAL(-32768, etl::q15_t::min().raw());
+      CHECK_EQUAL(1,      etl::q15_t::epsilon().raw());
+      CHECK_EQUAL(127,    etl::q7_t::max().raw());
+
+      // Storage wider than the format.
+      typedef etl::fixed_point<3, 4, int16_t> narrow_t;
+      CHECK_EQUAL(127,  narrow_t::max().raw());
+      CHECK_EQUAL(-128, narrow_t::min().raw());
+      CHECK_EQUAL(127,  narrow_t::from_raw(1000).raw());
+
+      typedef etl::fixed_point<4, 4> default_storage_t;
+      CHECK((etl::is_same<int16_t, default_storage_t::storage_type>::value));
+
+      typedef etl::fixed_point<4, 4, uint8_t> unsigned_t;
+      CHECK_EQUAL(255U, unsigned_t::max().raw());
+      CHECK_EQUAL(0U,   unsigned_t::min().raw());
+    }
+
+    //*************************************************************************
+    TEST(test_conversions)
+    {
+      CHECK_EQUAL(16384, etl::q15_t::from_floating(0.5).raw());
+      CHECK_EQUAL(-32768, etl::q15_t::from_floating(-1.0).raw());
+      CHECK_EQUAL(32767, etl::q15_t::from_floating(1.0).raw());
+      CHECK_EQUAL(-32768, etl::q15_t::from_floating(-5.0f).raw());
+      CHECK_EQUAL(0, etl::q15_t::from_floating(std::nan("")).raw());
+      CHECK_CLOSE(0.25, etl::q15_t::from_raw(8192).to_floating<double>(), 1e-12);
+
+      typedef etl::fixed_point<7, 8, int16_t> fixed_t;
+
+      CHECK_EQUAL(5 * 256, fixed_t::from_integer(5).raw());
+      CHECK_EQUAL(-5 * 256, fixed_t::from_integer(-5).raw());
+      CHECK_EQUAL(32767, fixed_t::from_integer(128).raw());
+      CHECK_EQUAL(-32768, fixed_t::from_integer(-129).raw());
+      CHECK_EQUAL(-128, fixed_t::from_integer(-128).to_integer());
+      CHECK_EQUAL(3, fixed_t::from_floating(2.5).to_integer());
+      CHECK_EQUAL(-3, fixed_t::from_floating(-2.5).to_integer());
+      CHECK_EQUAL(2, fixed_t::from_floating(2.49).to_integer());
+
+#if ETL_USING_64BIT_TYPES
+      CHECK_EQUAL(1073741824, etl::q31_t::from_floating(0.5).raw());
+      CHECK_CLOSE(-0.75, etl::q31_t::from_floating(-0.75).to_floating<double>(), 1e-9);
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_saturation)
+    {
+      const etl::q15_t half  = etl::q15_t::from_floating(0.5);
+      const etl::q15_t three = etl::q15_t::from_floating(0.75);
+      const etl::q15_t minus = etl::q15_t::from_floating(-0.75);
+      const etl::q15_t quarter = etl::q15_t::from_floating(0.25);
+
+      CHECK(etl::q15_t::max() == (half + three));
+      CHECK(etl::q15_t::min() == (minus - three));
+      CHECK(etl::q15_t::max() == (etl::q15_t::min() * etl::q15_t::min()));
+      CHECK(etl::q15_t::max() == -etl::q15_t::min());
+      CHECK(etl::q15_t::max() == (half / quarter));
+      CHECK(etl::q15_t::min() == (minus / quarter));
+      CHECK(half == (quarter / half));
+      CHECK(etl::q15_t::max() == (half / etl::q15_t()));
+      CHECK(etl::q15_t::min() == (minus / etl::q15_t()));
+      CHECK(etl::q15_t() == (etl::q15_t() / etl::q15_t()));
+      CHECK_EQUAL(-8192 * 3, (minus * (half + quarter) / three).raw());
+
+      typedef etl::fixed_point<4, 4, uint8_t> unsigned_t;
+      const unsigned_t one = unsigned_t::from_integer(1);
+      const unsigned_t two = unsigned_t::from_integer(2);
+
+      CHECK(unsigned_t() == (one - two));
+      CHECK(unsigned_t() == -one);
+      CHECK(one == (two - one));
+      CHECK(unsigned_t::max() == (unsigned_t::from_integer(10) + unsigned_t::from_integer(10)));
+
+      CHECK(half < three);
+      CHECK(minus < half);
+      CHECK(half >= quarter);
+      CHECK(half != quarter);
+    }
+
+    //*************************************************************************
+    TEST(test_rounding_modes)
+    {
+      check_rounding<rounding::ceiling>();
+      check_rounding<rounding::floor>();
+      check_rounding<rounding::zero>();
+      check_rounding<rounding::infinity>();
+      check_rounding<rounding::half_up>();
+      check_rounding<rounding::half_down>();
+      check_rounding<rounding::half_even>();
+      check_rounding<rounding::half_odd>();
+    }
+
+    //*************************************************************************
+    TEST(test_rounding_matches_scaled_rounding)
+    {
+      for (int32_t raw = -32768; raw <= 32767; ++raw)
+      {
+        const int16_t r = int16_t(raw);
+
+        CHECK_EQUAL(etl::round_half_up_unscaled<256>(raw),   int32_t((etl::fixed_point<7, 8, int16_t, rounding::half_up>::from_raw(r).to_integer())));
+        CHECK_EQUAL(etl::round_half_down_unscaled<256>(raw), int32_t((etl::fixed_point<7, 8, int16_t, rounding::half_down>::from_raw(r).to_integer())));
+        CHECK_EQUAL(etl::round_half_even_unscaled<256>(raw), int32_t((etl::fixed_point<7, 8, int16_t, rounding::half_even>::from_raw(r).to_integer())));
+        CHECK_EQUAL(etl::round_half_odd_unscaled<256>(raw),  int32_t((etl::fixed_point<7, 8, int16_t, rounding::half_odd>::from_raw(r).to_integer())));
+        CHECK_EQUAL(etl::round_zero_unscaled<256>(raw),      int32_t((etl::fixed_point<7, 8, int16_t, rounding::zero>::from_raw(r).to_integer())));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_arrays)
+    {
+      check_arrays<etl::q15_t>(1U);
+      check_arrays<etl::fixed_point<3, 12, int16_t> >(2U);
+      check_arrays<etl::fixed_point<0, 15, int16_t, rounding::floor> >(3U);
+      check_arrays<etl::fixed_point<0, 15, int16_t, rounding::half_even> >(4U);
+      check_arrays<etl::fixed_point<15, 0, int16_t> >(5U);
+      check_arrays<etl::q7_t>(6U);
+#if ETL_USING_64BIT_TYPES
+      check_arrays<etl::q31_t>(7U);
+#endif
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      constexpr etl::q15_t half    = etl::q15_t::from_raw(16384);
+      constexpr etl::q15_t product = half * half;
+      constexpr int16_t    raw     = product.raw();
+
+      CHECK_EQUAL(8192, raw);
+    }
+#endif
+  };
+}
@@ -220,5 +220,52 @@ namespace
       CHECK(allocator8.release(p10));
       CHECK(allocator8.release(p11));
     }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      Allocator8  allocator8;
+      Allocator16 allocator16;
+
+      allocator8.set_successor(allocator16);
+
+      void* p[6];
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        p[i] = allocator8.allocate(sizeof(int8_t), alignof(int8_t));
+      }
+
+      // Too large for allocator8, so passed on.
+      void* p16 = allocator8.allocate(sizeof(int16_t), alignof(int16_t));
+
+      etl::pool_statistics statistics8  = allocator8.statistics();
+      etl::pool_statistics statistics16 = allocator16.statistics();
+
+      CHECK_EQUAL(4U, statistics8.size);
+      CHECK_EQUAL(4U, statistics8.allocations);
+      CHECK_EQUAL(3U, statistics8.failures);
+      CHECK_EQUAL(3U, statistics16.size);
+      CHECK_EQUAL(0U, statistics16.failures);
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        allocator8.release(p[i]);
+      }
+
+      allocator8.release(p16);
+
+      statistics8  = allocator8.statistics();
+      statistics16 = allocator16.statistics();
+
+      CHECK_EQUAL(0U, statistics8.size);
+      CHECK_EQUAL(4U, statistics8.peak_size);
+      CHECK_EQUAL(4U, statistics8.releases);
+      CHECK_EQUAL(0U, statistics16.size);
+      CHECK_EQUAL(3U, statistics16.peak_size);
+      CHECK_EQUAL(3U, statistics16.releases);
+    }
+#endif
   }
 }
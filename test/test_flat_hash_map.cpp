@@ -0,0 +1,629 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+
+#include "data.h"
+
+#include "etl/flat_hash_map.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef void is_transparent;
+
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+
+    size_t operator ()(const char* text) const
+    {
+      return std::accumulate(text, text + std::char_traits<char>::length(text), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same hash, so every probe visits every group.
+  struct bad_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+
+  SUITE(test_flat_hash_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::flat_hash_map<std::string, NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iflat_hash_map<std::string, NDC, simple_hash>      IDataNDC;
+
+    typedef etl::flat_hash_map<int, int, 112>                       DataInt; // 7/8 of 128 slots.
+
+    NDC N0  = NDC("A");
+    NDC N1  = NDC("B");
+    NDC N2  = NDC("C");
+    NDC N3  = NDC("D");
+    NDC N4  = NDC("E");
+    NDC N5  = NDC("F");
+    NDC N6  = NDC("G");
+    NDC N7  = NDC("H");
+    NDC N8  = NDC("I");
+    NDC N9  = NDC("J");
+    NDC N10 = NDC("K");
+
+    std::string K[] = { "FF", "FG", "FH", "FI", "FJ", "FK", "FL", "FM", "FN", "FO", "FP" };
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+
+    //*************************************************************************
+    template <typename TMap>
+    bool Check_Contents(const TMap& data, const std::vector<ElementNDC>& compare)
+    {
+      if (data.size() != compare.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < compare.size(); ++i)
+      {
+        typename TMap::const_iterator itr = data.find(compare[i].first);
+
+        if ((itr == data.end()) || (itr->second != compare[i].second))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(K[0], N0), ElementNDC(K[1], N1), ElementNDC(K[2], N2), ElementNDC(K[3], N3), ElementNDC(K[4], N4),
+          ElementNDC(K[5], N5), ElementNDC(K[6], N6), ElementNDC(K[7], N7), ElementNDC(K[8], N8), ElementNDC(K[9], N9)
+        };
+
+        ElementNDC n2[] =
+        {
+          ElementNDC(K[0], N0), ElementNDC(K[1], N1), ElementNDC(K[2], N2), ElementNDC(K[3], N3), ElementNDC(K[4], N4),
+          ElementNDC(K[5], N5), ElementNDC(K[6], N6), ElementNDC(K[7], N7), ElementNDC(K[8], N8), ElementNDC(K[9], N9),
+          ElementNDC(K[10], N10)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_slot_count)
+    {
+      CHECK_EQUAL(size_t(etl::private_flat_hash::group::Width), (etl::flat_hash_map<int, int, 1>::SLOT_COUNT));
+      CHECK_EQUAL(16U, (etl::flat_hash_map<int, int, 14>::SLOT_COUNT));
+      CHECK_EQUAL(32U, (etl::flat_hash_map<int, int, 15>::SLOT_COUNT));
+      CHECK_EQUAL(1024U, (etl::flat_hash_map<int, int, 896>::SLOT_COUNT));
+      CHECK_EQUAL(2048U, (etl::flat_hash_map<int, int, 897>::SLOT_COUNT));
+      CHECK_EQUAL(131072U, (etl::flat_hash_map<int, int, 65536>::SLOT_COUNT));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+      CHECK(Check_Contents(data, initial_data));
+      CHECK_EQUAL(initial_data.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      DataNDC data = { ElementNDC(K[0], N0), ElementNDC(K[2], N2), ElementNDC(K[4], N4) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(N0, data.at(K[0]));
+      CHECK_EQUAL(N2, data.at(K[2]));
+      CHECK_EQUAL(N4, data.at(K[4]));
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(data1);
+
+      CHECK(data1 == data2);
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(std::move(data1));
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      data2 = data1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_self_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC& other = data;
+
+      data = other;
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      etl::flat_hash_map<std::string, int, SIZE, simple_hash> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[K[i]] = i;
+      }
+
+      CHECK_EQUAL(3, data[K[3]]);
+
+      data[K[3]] = 10;
+
+      CHECK_EQUAL(10, data[K[3]]);
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_THROW(data[K[10]], etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_inserts_default)
+    {
+      etl::flat_hash_map<std::string, int, SIZE, simple_hash> data;
+
+      data[K[0]] += 2;
+      data[K[0]] += 3;
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(5, data[K[0]]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        CHECK_EQUAL(initial_data[i].second, data.at(initial_data[i].first));
+        CHECK_EQUAL(initial_data[i].second, cdata.at(initial_data[i].first));
+      }
+
+      CHECK_THROW(data.at(K[10]), etl::flat_hash_map_out_of_range);
+      CHECK_THROW(cdata.at(K[10]), etl::flat_hash_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC(K[0], N0));
+
+      CHECK(result.second);
+      CHECK_EQUAL(K[0], result.first->first);
+      CHECK_EQUAL(N0, result.first->second);
+
+      // Existing keys are not replaced.
+      result = data.insert(ElementNDC(K[0], N1));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N0, result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(ElementNDC(K[10], N10)), etl::flat_hash_map_full);
+
+      // Existing keys may still be found when full.
+      CHECK(!data.insert(ElementNDC(K[0], N10)).second);
+
+      CHECK_THROW(data.assign(excess_data.begin(), excess_data.end()), etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K[5]));
+      CHECK_EQUAL(0U, data.erase(K[5]));
+      CHECK_EQUAL(SIZE - 1, data.size());
+      CHECK(data.find(K[5]) == data.end());
+
+      std::vector<ElementNDC> compare(initial_data);
+      compare.erase(compare.begin() + 5);
+
+      CHECK(Check_Contents(data, compare));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single_iterator)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.find(K[2]);
+      DataNDC::iterator next = itr;
+      ++next;
+
+      CHECK(data.erase(itr) == next);
+      CHECK(data.find(K[2]) == data.end());
+      CHECK_EQUAL(SIZE - 1, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator first = data.begin();
+      std::advance(first, 3);
+      DataNDC::iterator last = first;
+      std::advance(last, 4);
+
+      std::vector<std::string> erased;
+
+      for (DataNDC::iterator itr = first; itr != last; ++itr)
+      {
+        erased.push_back(itr->first);
+      }
+
+      CHECK(data.erase(first, last) == last);
+      CHECK_EQUAL(SIZE - 4, data.size());
+
+      for (size_t i = 0; i < erased.size(); ++i)
+      {
+        CHECK(!data.contains(erased[i]));
+      }
+
+      CHECK(data.erase(data.begin(), data.end()) == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_count_contains)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        CHECK(data.find(K[i]) != data.end());
+        CHECK(cdata.find(K[i]) != cdata.end());
+        CHECK_EQUAL(1U, data.count(K[i]));
+        CHECK(data.contains(K[i]));
+      }
+
+      CHECK(data.find(K[10]) == data.end());
+      CHECK(cdata.find(K[10]) == cdata.end());
+      CHECK_EQUAL(0U, data.count(K[10]));
+      CHECK(!data.contains(K[10]));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> result = data.equal_range(K[1]);
+
+      CHECK_EQUAL(K[1], result.first->first);
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+
+      result = data.equal_range(K[10]);
+
+      CHECK(result.first == data.end());
+      CHECK(result.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(initial_data.rbegin(), initial_data.rend());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2.at(K[0]) = N10;
+
+      CHECK(data1 != data2);
+
+      data2.erase(K[0]);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_unordered_map)
+    {
+      DataInt data;
+      std::unordered_map<int, int> compare;
+
+      uint32_t state = 1U;
+
+      // Lots of erases, so that the deleted slots have to be reclaimed.
+      for (int i = 0; i < 100000; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+
+        int key   = int((state >> 8) % 200U);
+        int value = int(state >> 16);
+
+        if ((state & 0x3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (compare.size() < data.max_size())
+        {
+          CHECK_EQUAL(compare.insert(std::make_pair(key, value)).second, data.insert(std::make_pair(key, value)).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+
+      for (DataInt::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        std::unordered_map<int, int>::const_iterator other = compare.find(itr->first);
+
+        CHECK(other != compare.end());
+        CHECK_EQUAL(other->second, itr->second);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bad_hash)
+    {
+      etl::flat_hash_map<int, int, 100, bad_hash> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i * 2;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 100; i += 2)
+      {
+        data.erase(i);
+      }
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(((i % 2) == 0) ? 0U : 1U, data.count(i));
+      }
+
+      for (int i = 100; i < 150; ++i)
+      {
+        data[i] = i * 2;
+      }
+
+      for (int i = 1; i < 150; ++i)
+      {
+        if ((i < 100) && ((i % 2) == 0))
+        {
+          CHECK(!data.contains(i));
+        }
+        else
+        {
+          CHECK_EQUAL(i * 2, data.at(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_elements_destroyed)
+    {
+      {
+        etl::flat_hash_map<int, std::string, 50> data;
+
+        for (int i = 0; i < 50; ++i)
+        {
+          data[i] = std::string(100, char('a' + (i % 26)));
+        }
+
+        for (int i = 0; i < 50; i += 3)
+        {
+          data.erase(i);
+        }
+
+        for (int i = 100; i < 117; ++i)
+        {
+          data[i] = std::string(100, 'z');
+        }
+
+        CHECK(data.full());
+        CHECK_EQUAL(std::string(100, 'b'), data[1]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::flat_hash_map<std::string, int, SIZE, simple_hash> data;
+      data["1"] = 1;
+      data["3"] = 3;
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::flat_hash_map<std::string, int, SIZE, transparent_hash, etl::equal_to<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(3 == data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
+  };
+}
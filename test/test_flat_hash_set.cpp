@@ -0,0 +1,240 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <unordered_set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+
+#include "etl/flat_hash_set.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  SUITE(test_flat_hash_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::flat_hash_set<std::string, SIZE, simple_hash> Data;
+    typedef etl::iflat_hash_set<std::string, simple_hash>      IData;
+
+    typedef etl::flat_hash_set<int, 112>                       DataInt; // 7/8 of 128 slots.
+
+    std::string K[] = { "FF", "FG", "FH", "FI", "FJ", "FK", "FL", "FM", "FN", "FO", "FP" };
+
+    std::vector<std::string> initial_data(K, K + SIZE);
+
+    //*************************************************************************
+    bool Check_Contents(const IData& data, const std::vector<std::string>& compare)
+    {
+      if (data.size() != compare.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < compare.size(); ++i)
+      {
+        if (!data.contains(compare[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Contents(data, initial_data));
+      CHECK_EQUAL(initial_data.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { K[0], K[2], K[4] };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.contains(K[0]));
+      CHECK(data.contains(K[2]));
+      CHECK(data.contains(K[4]));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_and_assign)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2(data1);
+      Data data3;
+
+      data3 = data1;
+
+      CHECK(data1 == data2);
+      CHECK(data1 == data3);
+      CHECK(Check_Contents(data3, initial_data));
+
+      Data data4(std::move(data1));
+
+      CHECK(Check_Contents(data4, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_insert)
+    {
+      Data data;
+
+      ETL_OR_STD::pair<Data::iterator, bool> result = data.insert(K[0]);
+
+      CHECK(result.second);
+      CHECK_EQUAL(K[0], *result.first);
+
+      result = data.insert(K[0]);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(1U, data.size());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+      CHECK_THROW(data.insert(K[10]), etl::flat_hash_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K[3]));
+      CHECK_EQUAL(0U, data.erase(K[3]));
+      CHECK(!data.contains(K[3]));
+
+      Data::iterator itr = data.find(K[4]);
+      Data::iterator next = itr;
+      ++next;
+
+      CHECK(data.erase(itr) == next);
+      CHECK_EQUAL(SIZE - 2, data.size());
+
+      CHECK(data.erase(data.begin(), data.end()) == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_equal_range)
+    {
+      const Data data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.find(K[1]) != data.end());
+      CHECK(data.find(K[10]) == data.end());
+      CHECK_EQUAL(1U, data.count(K[1]));
+      CHECK_EQUAL(0U, data.count(K[10]));
+      CHECK_EQUAL(1, std::distance(data.equal_range(K[1]).first, data.equal_range(K[1]).second));
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2(initial_data.rbegin(), initial_data.rend());
+
+      CHECK(data1 == data2);
+
+      data2.erase(K[0]);
+
+      CHECK(data1 != data2);
+
+      data2.insert(K[10]);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_unordered_set)
+    {
+      DataInt data;
+      std::unordered_set<int> compare;
+
+      uint32_t state = 1U;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+
+        int key = int((state >> 8) % 200U);
+
+        if ((state & 0x3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (compare.size() < data.max_size())
+        {
+          CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (DataInt::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(1U, compare.count(*itr));
+      }
+    }
+  };
+}
@@ -647,6 +647,47 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_range_unsorted_duplicates)
+    {
+      std::vector<ElementNDC> unsorted_data = { ElementNDC(7, N7), ElementNDC(2, N2), ElementNDC(9, N9), ElementNDC(2, N12),
+                                                ElementNDC(0, N0), ElementNDC(7, N17), ElementNDC(4, N4) };
+
+      Compare_DataNDC compare_data(unsorted_data.begin(), unsorted_data.end());
+
+      DataNDC data;
+
+      data.assign(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+      CHECK_EQUAL(N2, data.at(2));
+      CHECK_EQUAL(N7, data.at(7));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_sorted(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_value)
     {
@@ -804,6 +845,101 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merge)
+    {
+      std::vector<ElementNDC> existing_data = { ElementNDC(1, N1), ElementNDC(4, N4), ElementNDC(6, N6), ElementNDC(8, N8) };
+      std::vector<ElementNDC> new_data      = { ElementNDC(9, N9), ElementNDC(4, N14), ElementNDC(0, N0), ElementNDC(5, N5), ElementNDC(0, N10) };
+
+      Compare_DataNDC compare_data(existing_data.begin(), existing_data.end());
+      DataNDC data(existing_data.begin(), existing_data.end());
+
+      data.insert(new_data.begin(), new_data.end());
+      compare_data.insert(new_data.begin(), new_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+      CHECK_EQUAL(N0, data.at(0));
+      CHECK_EQUAL(N4, data.at(4));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique)
+    {
+      std::vector<ElementNDC> existing_data = { ElementNDC(1, N1), ElementNDC(4, N4), ElementNDC(6, N6), ElementNDC(8, N8) };
+      std::vector<ElementNDC> new_data      = { ElementNDC(0, N0), ElementNDC(2, N2), ElementNDC(4, N14), ElementNDC(5, N5), ElementNDC(9, N9) };
+
+      Compare_DataNDC compare_data(existing_data.begin(), existing_data.end());
+      DataNDC data(existing_data.begin(), existing_data.end());
+
+      data.insert_sorted_unique(new_data.begin(), new_data.end());
+      compare_data.insert(new_data.begin(), new_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+      CHECK_EQUAL(N4, data.at(4));
+
+      // All after the existing ones.
+      data.insert_sorted_unique(different_data.begin(), different_data.begin() + 1);
+      CHECK_EQUAL(N10, data.at(10));
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique_full)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // The repeated keys are dropped by the merge, making room for the rest.
+      data.insert_sorted_unique(initial_data.begin(), initial_data.end());
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.insert_sorted_unique(initial_data.begin(), initial_data.end());
+      CHECK_EQUAL(SIZE, data.size());
+
+      CHECK_THROW(data.insert_sorted_unique(excess_data.begin(), excess_data.end()), etl::flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_into)
+    {
+      typedef etl::flat_map<int, int, 100> Map;
+
+      Map destination;
+      Map source;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < 60; ++i)
+      {
+        destination.insert(std::make_pair(i * 2, i));
+        compare.insert(std::make_pair(i * 2, i));
+      }
+
+      // Some keys already in the destination, which keep their values.
+      for (int i = 50; i < 80; ++i)
+      {
+        source.insert(std::make_pair(i, -i));
+      }
+
+      etl::merge_into(destination, source);
+      compare.insert(source.begin(), source.end());
+
+      CHECK_EQUAL(compare.size(), destination.size());
+      CHECK(std::equal(destination.begin(), destination.end(), compare.begin()));
+      CHECK_EQUAL(26, destination[52]);
+      CHECK_EQUAL(-53, destination[53]);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -1261,5 +1397,55 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::flat_map<std::string, int, SIZE> data;
+      data["1"] = 1;
+      data["3"] = 3;
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::flat_map<std::string, int, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK_EQUAL(3, data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK(data.lower_bound("2") == data.find("3"));
+      CHECK(cdata.lower_bound("3") == cdata.find("3"));
+      CHECK(data.upper_bound("3") == data.find("5"));
+      CHECK(cdata.upper_bound("5") == cdata.end());
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK(range.second == data.find("5"));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.find("5"));
+      CHECK(crange.second == cdata.find("5"));
+    }
   };
 }
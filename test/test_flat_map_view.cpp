@@ -0,0 +1,269 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/flat_map_view.h"
+#include "etl/flat_map.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  struct Entry
+  {
+    uint32_t id;
+    uint16_t code;
+    uint16_t flags;
+  };
+
+  struct EntryCompare
+  {
+    bool operator ()(const Entry& lhs, const Entry& rhs) const
+    {
+      return lhs.id < rhs.id;
+    }
+  };
+
+  typedef etl::const_flat_map_view<uint32_t, uint32_t> Map;
+  typedef etl::sorted_array_view<int>                  Sorted;
+
+  //***********************************
+  // An image, as it would be stored in flash or in a file.
+  struct Image
+  {
+    Image()
+    {
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        const etl::pair<uint32_t, uint32_t> element(i * 3U, i * 10U);
+        memcpy(&buffer[i * 2U], &element, sizeof(element));
+      }
+    }
+
+    const void* data() const
+    {
+      return buffer;
+    }
+
+    size_t size() const
+    {
+      return sizeof(buffer);
+    }
+
+    uint32_t buffer[200];
+  };
+
+  SUITE(test_flat_map_view)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map    map;
+      Sorted sorted;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(0U, map.size());
+      CHECK(map.begin() == map.end());
+      CHECK(map.find(1U) == map.end());
+      CHECK(map.is_valid());
+
+      CHECK(sorted.empty());
+      CHECK(!sorted.contains(1));
+      CHECK(sorted.is_sorted());
+    }
+
+    //*************************************************************************
+    TEST(test_map_from_image)
+    {
+      const Image image;
+      const Map   map = Map::from_image(image.data(), image.size());
+
+      CHECK_EQUAL(100U, map.size());
+      CHECK(map.is_valid());
+      CHECK(static_cast<const void*>(map.data()) == image.data());
+
+      for (uint32_t key = 0U; key < 310U; ++key)
+      {
+        const bool present = ((key % 3U) == 0U) && (key < 300U);
+
+        CHECK_EQUAL(present, map.contains(key));
+        CHECK_EQUAL(present ? 1U : 0U, map.count(key));
+
+        if (present)
+        {
+          CHECK_EQUAL(key, map.find(key)->first);
+          CHECK_EQUAL((key / 3U) * 10U, map.at(key));
+          CHECK_EQUAL((key / 3U) * 10U, *map.find_mapped(key));
+          CHECK(map.equal_range(key).first == map.find(key));
+          CHECK(map.equal_range(key).second == map.find(key) + 1);
+        }
+        else
+        {
+          CHECK(map.find(key) == map.end());
+          CHECK(map.find_mapped(key) == ETL_NULLPTR);
+          CHECK_THROW(map.at(key), etl::flat_map_view_out_of_bounds);
+          CHECK(map.equal_range(key).first == map.equal_range(key).second);
+        }
+      }
+
+      CHECK_EQUAL(30U, map.lower_bound(28U)->first);
+      CHECK_EQUAL(30U, map.lower_bound(30U)->first);
+      CHECK_EQUAL(33U, map.upper_bound(30U)->first);
+      CHECK(map.lower_bound(298U) == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_map_matches_flat_map)
+    {
+      etl::flat_map<uint32_t, uint32_t, 100U> flat_map;
+      const Image image;
+      const Map   map = Map::from_image(image.data(), image.size());
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        flat_map.insert(etl::make_pair(i * 3U, i * 10U));
+      }
+
+      Map::const_iterator itr = map.begin();
+
+      for (etl::flat_map<uint32_t, uint32_t, 100U>::const_iterator f = flat_map.begin(); f != flat_map.end(); ++f, ++itr)
+      {
+        CHECK_EQUAL(f->first,  itr->first);
+        CHECK_EQUAL(f->second, itr->second);
+      }
+
+      CHECK(itr == map.end());
+      CHECK_EQUAL(map.rbegin()->first, 297U);
+    }
+
+    //*************************************************************************
+    TEST(test_map_from_array)
+    {
+      static const Map::value_type table[] =
+      {
+        Map::value_type(1U, 100U),
+        Map::value_type(5U, 500U),
+        Map::value_type(9U, 900U)
+      };
+
+      const Map map(table, ETL_OR_STD::size(table));
+
+      CHECK(map.is_valid());
+      CHECK_EQUAL(500U, map.at(5U));
+      CHECK(!map.contains(4U));
+
+      static const Map::value_type unsorted[] =
+      {
+        Map::value_type(1U, 100U),
+        Map::value_type(9U, 900U),
+        Map::value_type(5U, 500U)
+      };
+
+      CHECK(!Map(unsorted, 3U).is_valid());
+
+      static const Map::value_type duplicated[] =
+      {
+        Map::value_type(1U, 100U),
+        Map::value_type(5U, 500U),
+        Map::value_type(5U, 501U)
+      };
+
+      CHECK(!Map(duplicated, 3U).is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_bad_image)
+    {
+      const Image image;
+      const char* bytes = static_cast<const char*>(image.data());
+
+      // Misaligned.
+      CHECK_THROW(Map::from_image(bytes + 1, image.size() - 8U), etl::flat_map_view_bad_image);
+
+      // Not a whole number of elements.
+      CHECK_THROW(Map::from_image(bytes, image.size() - 4U), etl::flat_map_view_bad_image);
+      CHECK_THROW(Sorted::from_image(bytes, 6U), etl::flat_map_view_bad_image);
+
+      // Null.
+      CHECK_THROW(Map::from_image(ETL_NULLPTR, 8U), etl::flat_map_view_bad_image);
+      CHECK(Map::from_image(ETL_NULLPTR, 0U).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_sorted_array_view)
+    {
+      static const int data[] = { 1, 3, 3, 3, 7, 9, 9, 12 };
+
+      const Sorted sorted(data, ETL_OR_STD::size(data));
+
+      CHECK(sorted.is_sorted());
+      CHECK_EQUAL(8U, sorted.size());
+      CHECK_EQUAL(7, sorted[4]);
+      CHECK_EQUAL(3U, sorted.count(3));
+      CHECK_EQUAL(2U, sorted.count(9));
+      CHECK_EQUAL(0U, sorted.count(8));
+      CHECK(sorted.find(3) == data + 1);
+      CHECK(sorted.find(8) == sorted.end());
+      CHECK(sorted.lower_bound(8) == data + 5);
+      CHECK(sorted.upper_bound(3) == data + 4);
+      CHECK(sorted.equal_range(9).first  == data + 5);
+      CHECK(sorted.equal_range(9).second == data + 7);
+      CHECK(sorted.contains(12));
+      CHECK(!sorted.contains(13));
+      CHECK_EQUAL(12, *sorted.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_sorted_array_view_of_structs_from_image)
+    {
+      std::vector<Entry> entries;
+
+      for (uint32_t i = 0U; i < 50U; ++i)
+      {
+        const Entry entry = { i * 2U, uint16_t(i), 0U };
+        entries.push_back(entry);
+      }
+
+      typedef etl::sorted_array_view<Entry, EntryCompare> View;
+
+      const View view = View::from_image(entries.data(), entries.size() * sizeof(Entry));
+
+      CHECK_EQUAL(50U, view.size());
+      CHECK(view.is_sorted());
+
+      const Entry key = { 40U, 0U, 0U };
+      CHECK_EQUAL(20U, view.find(key)->code);
+
+      const Entry missing = { 41U, 0U, 0U };
+      CHECK(view.find(missing) == view.end());
+    }
+  };
+}
@@ -459,6 +459,44 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_range_unsorted_duplicates)
+    {
+      std::vector<NDC> unsorted_data = { N7, N2, N9, N2, N0, N7, N4 };
+
+      Compare_DataNDC compare_data(unsorted_data.begin(), unsorted_data.end());
+
+      DataNDC data;
+
+      data.assign(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_sorted(compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_value)
     {
@@ -565,6 +603,114 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merge)
+    {
+      std::vector<NDC> existing_data = { N1, N4, N6, N8 };
+      std::vector<NDC> new_data      = { N9, N4, N0, N5, N0 };
+
+      Compare_DataNDC compare_data(existing_data.begin(), existing_data.end());
+      DataNDC data(existing_data.begin(), existing_data.end());
+
+      data.insert(new_data.begin(), new_data.end());
+      compare_data.insert(new_data.begin(), new_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique)
+    {
+      std::vector<NDC> existing_data = { N1, N4, N6, N8 };
+      std::vector<NDC> new_data      = { N0, N2, N4, N5, N9 };
+
+      Compare_DataNDC compare_data(existing_data.begin(), existing_data.end());
+      DataNDC data(existing_data.begin(), existing_data.end());
+
+      data.insert_sorted_unique(new_data.begin(), new_data.end());
+      compare_data.insert(new_data.begin(), new_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(),
+                                data.end(),
+                                compare_data.begin());
+
+      CHECK(isEqual);
+
+      // All after the existing ones.
+      std::vector<NDC> later_data = { N10, N11 };
+
+      data.insert_sorted_unique(later_data.begin(), later_data.end());
+      CHECK_EQUAL(compare_data.size() + 2U, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_unique_full)
+    {
+      Compare_DataNDC sorted_data(initial_data.begin(), initial_data.end());
+      Compare_DataNDC sorted_excess_data(excess_data.begin(), excess_data.end());
+
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      // The repeated values are dropped by the merge, making room for the rest.
+      data.insert_sorted_unique(sorted_data.begin(), sorted_data.end());
+      CHECK_EQUAL(SIZE, data.size());
+
+      data.insert_sorted_unique(sorted_data.begin(), sorted_data.end());
+      CHECK_EQUAL(SIZE, data.size());
+
+      CHECK_THROW(data.insert_sorted_unique(sorted_excess_data.begin(), sorted_excess_data.end()), etl::flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_into)
+    {
+      typedef etl::flat_set<int, 300> Set;
+
+      Set destination;
+      Set source;
+      std::set<int> compare;
+
+      // Long runs of each set, with some values in both.
+      for (int i = 0; i < 200; ++i)
+      {
+        const int value = ((i / 20) * 40) + (i % 20) + (((i / 20) % 2) * 15);
+
+        if ((i % 3) != 0)
+        {
+          destination.insert(value);
+          compare.insert(value);
+        }
+        else
+        {
+          source.insert(value);
+        }
+      }
+
+      source.insert(*destination.begin());
+      source.insert(-5);
+      source.insert(1000);
+
+      etl::merge_into(destination, source);
+      compare.insert(source.begin(), source.end());
+
+      CHECK_EQUAL(compare.size(), destination.size());
+      CHECK(std::equal(destination.begin(), destination.end(), compare.begin()));
+
+      // Merging again changes nothing.
+      etl::merge_into(destination, source);
+      CHECK_EQUAL(compare.size(), destination.size());
+      CHECK(std::equal(destination.begin(), destination.end(), compare.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -951,5 +1097,55 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::flat_set<int, SIZE> data;
+      data.insert((1));
+      data.insert((3));
+
+      CHECK(data.contains((1)));
+      CHECK(data.contains((3)));
+      CHECK(!data.contains((2)));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::flat_set<std::string, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data.insert(std::string("1"));
+      data.insert(std::string("3"));
+      data.insert(std::string("5"));
+
+      CHECK(data.find("3") != data.end());
+      CHECK_EQUAL(std::string("3"), *data.find("3"));
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK(data.lower_bound("2") == data.find("3"));
+      CHECK(cdata.lower_bound("3") == cdata.find("3"));
+      CHECK(data.upper_bound("3") == data.find("5"));
+      CHECK(cdata.upper_bound("5") == cdata.end());
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK(range.second == data.find("5"));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.find("5"));
+      CHECK(crange.second == cdata.find("5"));
+    }
   };
 }
@@ -318,6 +318,20 @@ namespace
       uint64_t hash3 = etl::fnv_1a_64(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_fnv_1a_constexpr)
+    {
+      constexpr char data[] = "123456789";
+
+      constexpr uint32_t hash32 = etl::fnv_1a_32(data, data + 9).value();
+      constexpr uint64_t hash64 = etl::fnv_1a_64(data, data + 9).value();
+
+      CHECK_EQUAL(0xBB86B11CU, hash32);
+      CHECK_EQUAL(0x06D5573923C6CDFCU, hash64);
+    }
+#endif
   };
 }
 
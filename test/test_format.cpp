@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/format.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/wstring.h"
+#include "etl/to_string.h"
+#include "etl/format_spec.h"
+
+#if ETL_CPP17_SUPPORTED
+
+namespace
+{
+  typedef etl::string<100> String;
+
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_literal_text)
+    {
+      String str;
+
+      CHECK(String("") == etl::format_to(str, ""));
+      CHECK(String("Hello") == etl::format_to(str, "Hello"));
+      str.clear();
+      CHECK(String("Hello {World}") == etl::format_to(str, "Hello {{World}}"));
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      String str("Count=");
+
+      etl::format_to(str, "{}", 1);
+      etl::format_to(str, ",{}", 2);
+
+      CHECK(String("Count=1,2") == str);
+    }
+
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      String str;
+
+      CHECK(String("0 -1 255 -2147483648") == etl::format_to(str, "{} {} {} {}", 0, -1, uint8_t(255), INT32_MIN));
+      str.clear();
+      CHECK(String("18446744073709551615") == etl::format_to(str, "{}", UINT64_MAX));
+      str.clear();
+      CHECK(String("ff FF 0xff 0XFF") == etl::format_to(str, "{:x} {:X} {:#x} {:#X}", 255, 255, 255, 255));
+      str.clear();
+      CHECK(String("101 0b101 17 017") == etl::format_to(str, "{:b} {:#b} {:o} {:#o}", 5, 5, 15, 15));
+      str.clear();
+      CHECK(String("[   42][42   ][***42][42***]") == etl::format_to(str, "[{:5}][{:<5}][{:*>5}][{:*<5d}]", 42, 42, 42, 42));
+      str.clear();
+      CHECK(String("00042 -0042 0x002a 0b0101") == etl::format_to(str, "{:05} {:05} {:#06x} {:#06b}", 42, -42, 42, 5));
+    }
+
+    //*************************************************************************
+    TEST(test_characters_and_booleans)
+    {
+      String str;
+
+      CHECK(String("A 65 41 [A  ][  A]") == etl::format_to(str, "{} {:d} {:x} [{:3}][{:>3}]", 'A', 'A', 'A', 'A', 'A'));
+      str.clear();
+      CHECK(String("true false 1 [true ][ true]") == etl::format_to(str, "{} {:s} {:d} [{:5}][{:>5}]", true, false, true, true, true));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      String str;
+
+      CHECK(String("0.1 2.5 1e+21 0.1") == etl::format_to(str, "{} {} {} {}", 0.1, 2.5, 1e21, 0.1f));
+      str.clear();
+      CHECK(String("3.142 3.141593 2.50") == etl::format_to(str, "{:.3} {:f} {:.2f}", 3.14159265, 3.14159265, 2.5));
+      str.clear();
+      CHECK(String("[  1.5][1.5  ][001.5][-01.5]") == etl::format_to(str, "[{:5}][{:<5}][{:05}][{:05}]", 1.5, 1.5, 1.5, -1.5));
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      String str;
+
+      const char* p = "text";
+      etl::string<10> s("string");
+      etl::string_view view("view");
+
+      CHECK(String("literal text string view") == etl::format_to(str, "{} {} {} {}", "literal", p, s, view));
+      str.clear();
+      CHECK(String("[text  ][  text][str][vi]") == etl::format_to(str, "[{:6}][{:>6}][{:.3}][{:.2s}]", p, p, s, view));
+      str.clear();
+
+      const char* null = nullptr;
+      CHECK(String("[]") == etl::format_to(str, "[{}]", null));
+    }
+
+    //*************************************************************************
+    TEST(test_pointer)
+    {
+      String str;
+
+      int i = 0;
+      const int* p = &i;
+
+      etl::string<32> expected;
+      etl::to_string(reinterpret_cast<uintptr_t>(p), expected, etl::format_spec().hex().show_base(true));
+
+      CHECK(expected == etl::format_to(str, "{}", p));
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<10> str;
+
+      etl::format_to(str, "{} {}", 123456, "abcdefgh");
+
+      CHECK(etl::string<10>("123456 abc") == str);
+      CHECK(str.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_wide_strings)
+    {
+      etl::wstring<50> str;
+
+      CHECK(etl::wstring<50>(L"0x2a 'A' [text  ] 0.5") == etl::format_to(str, L"{:#x} '{}' [{:6}] {}", 42, L'A', L"text", 0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_constexpr_format_string)
+    {
+      static constexpr etl::format_string<int, const char*> fmt("{:04}:{}");
+
+      static_assert(fmt.valid(), "Format string parsed at compile time");
+
+      String str;
+      CHECK(String("0007:seven") == etl::format_to(str, fmt, 7, "seven"));
+    }
+
+#if !defined(__cpp_consteval)
+    //*************************************************************************
+    TEST(test_invalid_format_string)
+    {
+      // With consteval support these are compile errors.
+      String str;
+
+      CHECK_THROW(etl::format_to(str, "{} {}", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{}", 1, 2), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "}{}", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{:.2}", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{:x}", 1.0), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{:#}", "text"), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{:^5}", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{:256}", 1), etl::format_string_invalid);
+      CHECK_THROW(etl::format_to(str, "{0}", 1), etl::format_string_invalid);
+      CHECK(str.empty());
+    }
+#endif
+  }
+}
+
+#endif
@@ -1349,5 +1349,72 @@ namespace
       CHECK(data1 < data3);
       CHECK(data3 > data1);
     }
+
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::forward_list<int, 64> List;
+
+      List data;
+      std::list<int> compare;
+
+      // Churn the list so that its nodes are scattered around the pool.
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const size_t r = (seed >> 16) % 64U;
+
+        if (!data.empty() && ((r & 1U) != 0U || data.full()))
+        {
+          size_t index = r % compare.size();
+          std::list<int>::iterator citr = compare.begin();
+          std::advance(citr, index);
+          compare.erase(citr);
+
+          List::iterator itr = data.before_begin();
+          std::advance(itr, index);
+          data.erase_after(itr);
+        }
+        else
+        {
+          size_t index = r % (compare.size() + 1);
+          std::list<int>::iterator citr = compare.begin();
+          std::advance(citr, index);
+          compare.insert(citr, i);
+
+          List::iterator itr = data.before_begin();
+          std::advance(itr, index);
+          data.insert_after(itr, i);
+        }
+      }
+
+      CHECK(compare.size() > 2U);
+
+      data.compact();
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      List::const_iterator itr  = data.begin();
+      List::const_iterator next = itr;
+
+      while (++next != data.end())
+      {
+        CHECK(&*itr < &*next);
+        itr = next;
+      }
+
+      // Still usable.
+      data.push_front(-1);
+      compare.push_front(-1);
+      data.pop_front();
+      data.pop_front();
+      compare.pop_front();
+      compare.pop_front();
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
   };
 }
@@ -1924,5 +1924,50 @@ namespace
       CHECK(data1 < data3);
       CHECK(data3 > data1);
     }
+
+
+    //*************************************************************************
+    TEST(test_compact_shared_pool)
+    {
+      typedef etl::forward_list_ext<int>     List;
+      typedef etl::pool<List::pool_type, 32> IntPool;
+
+      IntPool pool;
+      List data0(pool);
+      List data1(pool);
+      std::list<int> compare0;
+      std::list<int> compare1;
+
+      // Interleave two lists in the pool, in reverse order.
+      for (int i = 0; i < 16; ++i)
+      {
+        data0.push_front(i);
+        compare0.push_front(i);
+        data1.push_front(100 + i);
+        compare1.push_front(100 + i);
+      }
+
+      data0.erase_after(std::next(data0.begin(), 2));
+      compare0.erase(std::next(compare0.begin(), 3));
+      data0.push_front(50);
+      compare0.push_front(50);
+
+      data0.compact();
+
+      CHECK_EQUAL(compare0.size(), data0.size());
+      CHECK(std::equal(data0.begin(), data0.end(), compare0.begin()));
+      CHECK(std::equal(data1.begin(), data1.end(), compare1.begin()));
+
+      List::const_iterator itr  = data0.begin();
+      List::const_iterator next = itr;
+
+      while (++next != data0.end())
+      {
+        CHECK(&*itr < &*next);
+        itr = next;
+      }
+
+      CHECK_EQUAL(compare0.size() + compare1.size(), pool.size());
+    }
   };
 }
@@ -331,6 +331,16 @@ namespace
 
   MotorControl motorControl;
 
+  //***************************************************************************
+  // A clock that ticks once each time it is read.
+  //***************************************************************************
+  uint32_t profiler_ticks;
+
+  uint32_t profiler_clock()
+  {
+    return profiler_ticks++;
+  }
+
   SUITE(test_fsm_states)
   {
     //*************************************************************************
@@ -578,6 +588,86 @@ namespace
       CHECK(motorControl.accepts(Unsupported()));
     }
 
+    //*************************************************************************
+    TEST(test_fsm_receive_batch)
+    {
+      motorControl.Initialise(stateList, etl::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.start(false);
+
+      Start    start;
+      SetSpeed set_speed(100);
+      Stop     stop;
+      Stopped  stopped;
+
+      const etl::imessage* const messages[] = { &start, &set_speed, &stop, &start, &stopped };
+
+      motorControl.receive_batch(etl::span<const etl::imessage* const>(messages));
+
+      // Idle -> Running -> WindingDown -> Idle -> Locked
+      CHECK_EQUAL(StateId::LOCKED, int(motorControl.get_state_id()));
+      CHECK_EQUAL(1, motorControl.setSpeedCount);
+      CHECK_EQUAL(100, motorControl.speed);
+      CHECK_EQUAL(1, motorControl.startCount);
+      CHECK_EQUAL(1, motorControl.stopCount);
+      CHECK_EQUAL(1, motorControl.stoppedCount);
+      CHECK_EQUAL(1, motorControl.unknownCount);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_profiler)
+    {
+      profiler_ticks = 0U;
+
+      etl::fsm_profiler<StateId::NUMBER_OF_STATES> profiler(profiler_clock); // Clock = 0
+
+      motorControl.Initialise(stateList, etl::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+
+      CHECK(!motorControl.has_hooks());
+      motorControl.set_hooks(profiler);
+      CHECK(motorControl.has_hooks());
+
+      motorControl.start(false);            // Clock = 1, Idle entered.
+      motorControl.receive(Start());        // Clock = 2, 3 Idle -> Running, 4
+      motorControl.receive(SetSpeed(100));  // Clock = 5, 6
+      motorControl.receive(Stop());         // Clock = 7, 8 Running -> WindingDown, 9
+
+      const etl::fsm_profiler<StateId::NUMBER_OF_STATES>::statistics& idle_statistics    = profiler.get_statistics(StateId::IDLE);
+      const etl::fsm_profiler<StateId::NUMBER_OF_STATES>::statistics& running_statistics = profiler.get_statistics(StateId::RUNNING);
+
+      CHECK_EQUAL(1U, idle_statistics.entries);
+      CHECK_EQUAL(1U, idle_statistics.messages);
+      CHECK_EQUAL(2U, idle_statistics.dwell_time);
+      CHECK_EQUAL(2U, idle_statistics.handling_time);
+      CHECK_EQUAL(2U, idle_statistics.max_handling_time);
+      CHECK_EQUAL(int(EventId::START), int(idle_statistics.max_message_id));
+
+      CHECK_EQUAL(1U, running_statistics.entries);
+      CHECK_EQUAL(2U, running_statistics.messages);
+      CHECK_EQUAL(5U, running_statistics.dwell_time);
+      CHECK_EQUAL(3U, running_statistics.handling_time);
+      CHECK_EQUAL(2U, running_statistics.max_handling_time);
+      CHECK_EQUAL(int(EventId::STOP), int(running_statistics.max_message_id));
+
+      CHECK_EQUAL(1U, profiler.get_statistics(StateId::WINDING_DOWN).entries);
+      CHECK_EQUAL(0U, profiler.get_statistics(StateId::WINDING_DOWN).dwell_time);
+      CHECK_EQUAL(2U, profiler.get_transitions());
+
+      motorControl.reset();                 // Clock = 10
+      CHECK_EQUAL(2U, profiler.get_transitions());
+      CHECK_EQUAL(2U, profiler.get_statistics(StateId::WINDING_DOWN).dwell_time);
+
+      motorControl.clear_hooks();
+      CHECK(!motorControl.has_hooks());
+
+      profiler.clear();
+      CHECK_EQUAL(0U, profiler.get_transitions());
+      CHECK_EQUAL(0U, profiler.get_statistics(StateId::IDLE).entries);
+    }
+
     //*************************************************************************
     TEST(test_fsm_no_states)
     {
@@ -616,5 +706,84 @@ namespace
 
       CHECK_THROW(mc.set_states(stateList, StateId::NUMBER_OF_STATES), etl::fsm_state_list_order_exception);
     }
+
+#if ETL_USING_VARIADIC_MESSAGES
+    //*************************************************************************
+    template <size_t Id>
+    struct ManyEvent : public etl::message<etl::message_id_t(100U + Id)>
+    {
+    };
+
+    struct ManyFsm : public etl::fsm
+    {
+      ManyFsm()
+        : fsm(MOTOR_CONTROL)
+        , handled(0)
+        , unknown(0)
+      {
+      }
+
+      int handled;
+      int unknown;
+    };
+
+    //*************************************************************************
+    struct ManyFirst : public etl::fsm_state<ManyFsm, ManyFirst, 0, ManyEvent<0>,  ManyEvent<1>,  ManyEvent<2>,  ManyEvent<3>,  ManyEvent<4>,
+                                                                    ManyEvent<5>,  ManyEvent<6>,  ManyEvent<7>,  ManyEvent<8>,  ManyEvent<9>,
+                                                                    ManyEvent<10>, ManyEvent<11>, ManyEvent<12>, ManyEvent<13>, ManyEvent<14>,
+                                                                    ManyEvent<15>, ManyEvent<16>, ManyEvent<17>, ManyEvent<18>, ManyEvent<19>>
+    {
+      template <typename TEvent>
+      etl::fsm_state_id_t on_event(const TEvent& event)
+      {
+        ++get_fsm_context().handled;
+        return (event.get_message_id() == 119) ? 1 : STATE_ID;
+      }
+
+      etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+      {
+        ++get_fsm_context().unknown;
+        return STATE_ID;
+      }
+    };
+
+    //*************************************************************************
+    struct ManySecond : public etl::fsm_state<ManyFsm, ManySecond, 1>
+    {
+      etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+      {
+        ++get_fsm_context().unknown;
+        return 0;
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_fsm_more_than_16_events)
+    {
+      ManyFirst  first;
+      ManySecond second;
+
+      etl::ifsm_state* states[] = { &first, &second };
+
+      ManyFsm many;
+      many.set_states(states, 2U);
+      many.start();
+
+      many.receive(ManyEvent<0>());
+      many.receive(ManyEvent<18>());
+      CHECK_EQUAL(2, many.handled);
+      CHECK_EQUAL(0, many.get_state_id());
+
+      many.receive(ManyEvent<19>());
+      CHECK_EQUAL(3, many.handled);
+      CHECK_EQUAL(1, many.get_state_id());
+
+      // The state with no events passes everything to on_event_unknown.
+      many.receive(ManyEvent<0>());
+      CHECK_EQUAL(3, many.handled);
+      CHECK_EQUAL(1, many.unknown);
+      CHECK_EQUAL(0, many.get_state_id());
+    }
+#endif
   };
 }
@@ -0,0 +1,400 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fsm_event_queue.h"
+#include "etl/hfsm.h"
+#include "etl/message_packet.h"
+
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  // Messages
+  //***************************************************************************
+  struct Connect : public etl::message<1>
+  {
+  };
+
+  struct Ack : public etl::message<2>
+  {
+  };
+
+  struct Send : public etl::message<3>
+  {
+    Send(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct Disconnect : public etl::message<4>
+  {
+  };
+
+  struct Chain : public etl::message<5>
+  {
+    Chain(int count_)
+      : count(count_)
+    {
+    }
+
+    int count;
+  };
+
+  struct Burst : public etl::message<6>
+  {
+  };
+
+  typedef etl::message_packet<Connect, Ack, Send, Disconnect, Chain, Burst> Packet;
+
+  enum
+  {
+    Disconnected_Id,
+    Connecting_Id,
+    Connected_Id,
+    Online_Id,
+    Number_Of_States
+  };
+
+  //***************************************************************************
+  // The FSM. TBase is etl::fsm or etl::hfsm.
+  //***************************************************************************
+  template <typename TBase>
+  class Link : public TBase
+  {
+  public:
+
+    Link()
+      : TBase(1)
+      , depth(0)
+      , max_depth(0)
+      , chain_count(0)
+    {
+    }
+
+    std::vector<int> sent;
+    int depth;
+    int max_depth;
+    int chain_count;
+  };
+
+  //***************************************************************************
+  template <typename TLink>
+  class Disconnected : public etl::fsm_state<TLink, Disconnected<TLink>, Disconnected_Id, Connect, Send, Chain, Burst>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Connect&)
+    {
+      // Acknowledged at once.
+      this->get_fsm_context().receive(Ack());
+
+      return Connecting_Id;
+    }
+
+    etl::fsm_state_id_t on_event(const Send& message)
+    {
+      this->get_fsm_context().defer_event(message);
+
+      return this->No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event(const Chain& message)
+    {
+      TLink& link = this->get_fsm_context();
+
+      ++link.chain_count;
+      ++link.depth;
+      link.max_depth = (link.depth > link.max_depth) ? link.depth : link.max_depth;
+
+      if (message.count != 0)
+      {
+        link.receive(Chain(message.count - 1));
+      }
+
+      --link.depth;
+
+      return this->No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event(const Burst&)
+    {
+      this->get_fsm_context().receive(Chain(0));
+      this->get_fsm_context().receive(Chain(0));
+      this->get_fsm_context().receive(Chain(0));
+
+      return this->No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return this->No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  template <typename TLink>
+  class Connecting : public etl::fsm_state<TLink, Connecting<TLink>, Connecting_Id, Ack, Send>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Ack&)
+    {
+      return Connected_Id;
+    }
+
+    etl::fsm_state_id_t on_event(const Send& message)
+    {
+      this->get_fsm_context().defer_event(message);
+
+      return this->No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return this->No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  template <typename TLink>
+  class Connected : public etl::fsm_state<TLink, Connected<TLink>, Connected_Id, Send, Disconnect>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Send& message)
+    {
+      this->get_fsm_context().sent.push_back(message.value);
+
+      return this->No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event(const Disconnect&)
+    {
+      return Disconnected_Id;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return this->No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  // The parent of Connecting and Connected in the HFSM.
+  //***************************************************************************
+  template <typename TLink>
+  class Online : public etl::fsm_state<TLink, Online<TLink>, Online_Id>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return this->No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  template <typename TBase>
+  struct Machine
+  {
+    typedef Link<TBase> link_t;
+
+    Machine()
+    {
+      states[Disconnected_Id] = &disconnected;
+      states[Connecting_Id]   = &connecting;
+      states[Connected_Id]    = &connected;
+      states[Online_Id]       = &online;
+
+      link.set_states(states, Number_Of_States);
+    }
+
+    link_t                     link;
+    Disconnected<link_t>       disconnected;
+    Connecting<link_t>         connecting;
+    Connected<link_t>          connected;
+    Online<link_t>             online;
+    etl::ifsm_state*           states[Number_Of_States];
+  };
+
+  typedef Machine<etl::fsm>  FsmMachine;
+  typedef Machine<etl::hfsm> HfsmMachine;
+
+  SUITE(test_fsm_event_queue)
+  {
+    //*************************************************************************
+    TEST(test_recursive_receive_without_queue)
+    {
+      FsmMachine machine;
+      machine.link.start();
+
+      machine.link.receive(Chain(20));
+
+      CHECK_EQUAL(21, machine.link.chain_count);
+      CHECK_EQUAL(21, machine.link.max_depth);
+    }
+
+    //*************************************************************************
+    TEST(test_recursive_receive_runs_to_completion)
+    {
+      FsmMachine machine;
+      etl::fsm_event_queue<Packet, 1> queue;
+
+      machine.link.set_event_queue(queue);
+      CHECK(machine.link.has_event_queue());
+      machine.link.start();
+
+      machine.link.receive(Chain(1000));
+
+      CHECK_EQUAL(1001, machine.link.chain_count);
+      CHECK_EQUAL(1, machine.link.max_depth);
+      CHECK(queue.empty());
+
+      // Still works after draining.
+      machine.link.receive(Chain(2));
+      CHECK_EQUAL(1004, machine.link.chain_count);
+
+      machine.link.clear_event_queue();
+      CHECK(!machine.link.has_event_queue());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_full)
+    {
+      FsmMachine machine;
+      etl::fsm_event_queue<Packet, 2> queue;
+
+      machine.link.set_event_queue(queue);
+      machine.link.start();
+
+      CHECK_THROW(machine.link.receive(Burst()), etl::fsm_event_queue_full);
+
+      // The FSM can still receive.
+      queue.clear();
+      machine.link.receive(Chain(3));
+      CHECK_EQUAL(4, machine.link.chain_count);
+    }
+
+    //*************************************************************************
+    TEST(test_deferred_events)
+    {
+      FsmMachine machine;
+      etl::fsm_event_queue<Packet, 4, 3> queue;
+
+      machine.link.set_event_queue(queue);
+      machine.link.start();
+
+      machine.link.receive(Send(1));
+      machine.link.receive(Send(2));
+      CHECK_EQUAL(2U, queue.deferred_size());
+      CHECK(machine.link.sent.empty());
+
+      // Connecting defers them again, then Ack connects and they are recalled in order.
+      machine.link.receive(Connect());
+      CHECK_EQUAL(Connected_Id, machine.link.get_state_id());
+      CHECK_EQUAL(0U, queue.deferred_size());
+      CHECK_EQUAL(2U, machine.link.sent.size());
+      CHECK_EQUAL(1, machine.link.sent[0]);
+      CHECK_EQUAL(2, machine.link.sent[1]);
+
+      machine.link.receive(Send(3));
+      CHECK_EQUAL(3U, machine.link.sent.size());
+      CHECK_EQUAL(3, machine.link.sent[2]);
+
+      // Full.
+      machine.link.receive(Disconnect());
+      machine.link.receive(Send(4));
+      machine.link.receive(Send(5));
+      machine.link.receive(Send(6));
+      CHECK_THROW(machine.link.receive(Send(7)), etl::fsm_event_queue_full);
+
+      // Reset clears the queue.
+      machine.link.reset();
+      CHECK_EQUAL(0U, queue.deferred_size());
+    }
+
+    //*************************************************************************
+    TEST(test_defer_without_queue)
+    {
+      FsmMachine machine;
+      machine.link.start();
+
+      CHECK_THROW(machine.link.receive(Send(1)), etl::fsm_no_event_queue);
+    }
+
+    //*************************************************************************
+    TEST(test_hfsm_deferred_events)
+    {
+      HfsmMachine machine;
+      etl::fsm_event_queue<Packet, 4> queue;
+
+      etl::ifsm_state* child_states[] = { &machine.connecting, &machine.connected };
+      machine.online.set_child_states(child_states, 2U);
+
+      machine.link.set_event_queue(queue);
+      machine.link.start();
+
+      machine.link.receive(Send(1));
+      machine.link.receive(Chain(50));
+      CHECK_EQUAL(1, machine.link.max_depth);
+
+      machine.link.receive(Connect());
+      CHECK_EQUAL(Connected_Id, machine.link.get_state_id());
+      CHECK_EQUAL(1U, machine.link.sent.size());
+      CHECK_EQUAL(1, machine.link.sent[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_hfsm_receive_batch)
+    {
+      HfsmMachine machine;
+
+      etl::ifsm_state* child_states[] = { &machine.connecting, &machine.connected };
+      machine.online.set_child_states(child_states, 2U);
+
+      machine.link.start();
+
+      Ack  ack;
+      Send send(5);
+      const etl::imessage* messages[] = { &ack, &send };
+
+      machine.link.receive(Connect()); // Connecting, with the Ack queued, but no queue.
+      machine.link.receive_batch(messages, 2U);
+
+      CHECK_EQUAL(Connected_Id, machine.link.get_state_id());
+      CHECK_EQUAL(1U, machine.link.sent.size());
+    }
+  }
+}
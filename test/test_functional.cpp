@@ -100,6 +100,27 @@ namespace
       CHECK((compare<etl::not_equal_to<int>>(2, 1)));
     }
 
+    //*************************************************************************
+    TEST(test_transparent_comparators)
+    {
+      CHECK((etl::less<>()(1, 2L)));
+      CHECK(!(etl::less_equal<>()(2L, 1)));
+      CHECK((etl::greater<>()(2, 1.5)));
+      CHECK((etl::greater_equal<>()(1.0, 1)));
+      CHECK((etl::equal_to<>()(1, 1L)));
+      CHECK((etl::not_equal_to<>()(1, 2L)));
+    }
+
+    //*************************************************************************
+    TEST(test_comparator_is_transparent)
+    {
+      CHECK(etl::comparator_is_transparent<etl::less<>>::value);
+      CHECK(etl::comparator_is_transparent<etl::equal_to<>>::value);
+      CHECK(!etl::comparator_is_transparent<etl::less<int>>::value);
+      CHECK(!etl::comparator_is_transparent<etl::equal_to<int>>::value);
+      CHECK(!etl::comparator_is_transparent<int>::value);
+    }
+
     //*************************************************************************
     TEST(test_bind1st)
     {
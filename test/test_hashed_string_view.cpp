@@ -0,0 +1,193 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/hashed_string_view.h"
+#include "etl/unordered_map.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  SUITE(test_hashed_string_view)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      const char* text = "Hello World";
+      etl::string<20> str(text);
+      etl::string_view view(text);
+
+      const size_t expected = etl::hash<etl::string_view>()(view);
+
+      etl::hashed_string_view hsv1(text);
+      etl::hashed_string_view hsv2(text, 11U);
+      etl::hashed_string_view hsv3(view);
+      etl::hashed_string_view hsv4(str);
+      etl::hashed_string_view hsv5(view, expected);
+
+      CHECK_EQUAL(expected, hsv1.get_hash());
+      CHECK_EQUAL(expected, hsv2.get_hash());
+      CHECK_EQUAL(expected, hsv3.get_hash());
+      CHECK_EQUAL(expected, hsv4.get_hash());
+      CHECK_EQUAL(expected, hsv5.get_hash());
+      CHECK_EQUAL(expected, etl::hash<etl::hashed_string_view>()(hsv1));
+
+      CHECK(hsv1.view() == view);
+      CHECK_EQUAL(11U, hsv1.size());
+      CHECK(!hsv1.empty());
+      CHECK(etl::hashed_string_view().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_comparison)
+    {
+      etl::string<20> str1("Hello");
+      etl::string<20> str2("Hello");
+      etl::string<20> str3("World");
+
+      etl::hashed_string_view hsv1(str1);
+      etl::hashed_string_view hsv2(str2);
+      etl::hashed_string_view hsv3(str3);
+
+      CHECK(hsv1 == hsv2);
+      CHECK(!(hsv1 != hsv2));
+      CHECK(hsv1 != hsv3);
+      CHECK(hsv1 < hsv3);
+      CHECK(!(hsv3 < hsv1));
+
+      // A mismatched hash is unequal without looking at the text.
+      etl::hashed_string_view wrong_hash(etl::string_view("Hello"), hsv1.get_hash() + 1U);
+      CHECK(hsv1 != wrong_hash);
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_key)
+    {
+      typedef etl::unordered_map<etl::hashed_string_view, int, 10, 10> Map;
+
+      Map map;
+
+      map[etl::hashed_string_view("temperature")] = 1;
+      map[etl::hashed_string_view("pressure")]    = 2;
+      map[etl::hashed_string_view("humidity")]    = 3;
+
+      const etl::hashed_string_view key("pressure");
+
+      Map::const_iterator itr = map.find(key);
+      CHECK(itr != map.end());
+      CHECK_EQUAL(2, itr->second);
+
+      CHECK(map.find(etl::hashed_string_view("altitude")) == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_interner)
+    {
+      etl::string_interner<4, 20> interner;
+
+      CHECK(interner.empty());
+      CHECK_EQUAL(4U, interner.max_size());
+      CHECK_EQUAL(20U, interner.max_characters());
+
+      etl::string<10> text("topic/a");
+
+      etl::hashed_string_view a1 = interner.intern(text);
+      etl::hashed_string_view b1 = interner.intern("topic/b");
+      etl::hashed_string_view a2 = interner.intern(etl::string_view("topic/a"));
+
+      // The text is copied, once.
+      CHECK(a1.data() != text.data());
+      CHECK(a1.data() == a2.data());
+      CHECK(a1 == a2);
+      CHECK(a1 != b1);
+      CHECK_EQUAL(2U, interner.size());
+      CHECK_EQUAL(14U, interner.characters());
+
+      text[6] = 'x';
+      CHECK(a1.view() == etl::string_view("topic/a"));
+
+      CHECK(interner.contains(etl::hashed_string_view("topic/b")));
+      CHECK(!interner.contains(etl::hashed_string_view("topic/c")));
+
+      interner.clear();
+      CHECK(interner.empty());
+      CHECK(!interner.contains(etl::hashed_string_view("topic/b")));
+    }
+
+    //*************************************************************************
+    TEST(test_interner_full)
+    {
+      etl::string_interner<2, 10> interner;
+
+      interner.intern("one");
+      interner.intern("two");
+
+      CHECK(interner.full());
+      CHECK_THROW(interner.intern("six"), etl::string_interner_full);
+
+      // Already interned text does not need room.
+      CHECK(interner.intern("one") == etl::hashed_string_view("one"));
+
+      etl::string_interner<4, 5> small;
+      small.intern("abc");
+      CHECK_THROW(small.intern("def"), etl::string_interner_full);
+    }
+
+    //*************************************************************************
+    TEST(test_interner_many_strings)
+    {
+      etl::string_interner<100, 500> interner;
+      etl::istring_interner& iinterner = interner;
+
+      char buffer[4] = { 'k', '0', '0', 0 };
+
+      for (int i = 0; i < 100; ++i)
+      {
+        buffer[1] = char('0' + (i / 10));
+        buffer[2] = char('0' + (i % 10));
+        iinterner.intern(buffer);
+      }
+
+      CHECK(interner.full());
+      CHECK_EQUAL(300U, interner.characters());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        buffer[1] = char('0' + (i / 10));
+        buffer[2] = char('0' + (i % 10));
+        CHECK(interner.contains(etl::hashed_string_view(buffer)));
+        CHECK(interner.intern(buffer).view() == etl::string_view(buffer));
+      }
+
+      CHECK_EQUAL(100U, interner.size());
+    }
+  }
+}
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "etl/queue.h"
 
 #include <iostream>
+#include <string>
 
 // This test implements the following state machine:
 //                +--------------------------------------------+
@@ -414,6 +415,136 @@ namespace
 
   MotorControl motorControl;
 
+  //***************************************************************************
+  // Records the calls to the FSM hooks.
+  //***************************************************************************
+  struct HookRecorder : public etl::ifsm_hooks
+  {
+    HookRecorder()
+      : begin_count(0)
+      , end_count(0)
+      , change_count(0)
+      , last_from(0)
+      , last_to(0)
+      , last_received_state(0)
+    {
+    }
+
+    void on_receive_begin(etl::fsm_state_id_t state_id, const etl::imessage&) override
+    {
+      ++begin_count;
+      last_received_state = state_id;
+    }
+
+    void on_receive_end(etl::fsm_state_id_t state_id, const etl::imessage&) override
+    {
+      ++end_count;
+      CHECK_EQUAL(int(last_received_state), int(state_id));
+    }
+
+    void on_state_change(etl::fsm_state_id_t from_state_id, etl::fsm_state_id_t to_state_id) override
+    {
+      ++change_count;
+      last_from = from_state_id;
+      last_to   = to_state_id;
+    }
+
+    int                 begin_count;
+    int                 end_count;
+    int                 change_count;
+    etl::fsm_state_id_t last_from;
+    etl::fsm_state_id_t last_to;
+    etl::fsm_state_id_t last_received_state;
+  };
+
+  //***************************************************************************
+  // A deeper hierarchy, for transitions across levels.
+  //
+  //   top
+  //    +-- a
+  //    |   +-- a1
+  //    |       +-- a1a
+  //    +-- b
+  //        +-- b1
+  //        +-- b2
+  //***************************************************************************
+  struct TreeId
+  {
+    enum
+    {
+      A1a,
+      A1,
+      A,
+      Top,
+      B,
+      B1,
+      B2,
+      Number_Of_States
+    };
+  };
+
+  //***********************************
+  class GoTo : public etl::message<EventId::Unsupported + 1>
+  {
+  public:
+
+    GoTo(etl::fsm_state_id_t target_)
+      : target(target_)
+    {
+    }
+
+    etl::fsm_state_id_t target;
+  };
+
+  //***********************************
+  // Records the states entered and exited, as "+id" and "-id".
+  //***********************************
+  class Tree : public etl::hfsm
+  {
+  public:
+
+    Tree()
+      : hfsm(HFsmId::Motor_Control + 1)
+    {
+    }
+
+    std::string log;
+  };
+
+  //***********************************
+  template <etl::fsm_state_id_t Id>
+  class Node : public etl::fsm_state<Tree, Node<Id>, Id, GoTo>
+  {
+  public:
+
+    //***********************************
+    etl::fsm_state_id_t on_event(const GoTo& event)
+    {
+      return event.target;
+    }
+
+    //***********************************
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return etl::ifsm_state::No_State_Change;
+    }
+
+    //***********************************
+    etl::fsm_state_id_t on_enter_state() override
+    {
+      this->get_fsm_context().log += '+';
+      this->get_fsm_context().log += char('0' + Id);
+      return etl::ifsm_state::No_State_Change;
+    }
+
+    //***********************************
+    void on_exit_state() override
+    {
+      this->get_fsm_context().log += '-';
+      this->get_fsm_context().log += char('0' + Id);
+    }
+  };
+
   SUITE(test_hfsm_states)
   {
     //*************************************************************************
@@ -645,6 +776,49 @@ namespace
       CHECK_EQUAL(1, motorControl.windUpStartCount);
     }
 
+    //*************************************************************************
+    TEST(test_hfsm_hooks)
+    {
+      HookRecorder recorder;
+
+      motorControl.Initialise(stateList, etl::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.set_hooks(recorder);
+
+      motorControl.start(false);
+      CHECK_EQUAL(1, recorder.change_count);
+      CHECK_EQUAL(int(etl::ifsm_state::No_State_Change), int(recorder.last_from));
+      CHECK_EQUAL(StateId::Idle, int(recorder.last_to));
+
+      // Idle -> Winding_Up, via Running.
+      motorControl.receive(Start());
+      CHECK_EQUAL(1, recorder.begin_count);
+      CHECK_EQUAL(1, recorder.end_count);
+      CHECK_EQUAL(2, recorder.change_count);
+      CHECK_EQUAL(StateId::Idle, int(recorder.last_from));
+      CHECK_EQUAL(StateId::Winding_Up, int(recorder.last_to));
+
+      // Not handled, so no state change.
+      motorControl.receive(Start());
+      CHECK_EQUAL(2, recorder.end_count);
+      CHECK_EQUAL(2, recorder.change_count);
+      CHECK_EQUAL(StateId::Winding_Up, int(recorder.last_received_state));
+
+      // Handled by the parent state, Running.
+      motorControl.receive(EStop());
+      CHECK_EQUAL(3, recorder.change_count);
+      CHECK_EQUAL(StateId::Winding_Up, int(recorder.last_from));
+      CHECK_EQUAL(StateId::Idle, int(recorder.last_to));
+
+      motorControl.reset();
+      CHECK_EQUAL(4, recorder.change_count);
+      CHECK_EQUAL(StateId::Idle, int(recorder.last_from));
+      CHECK_EQUAL(int(etl::ifsm_state::No_State_Change), int(recorder.last_to));
+
+      motorControl.clear_hooks();
+    }
+
     //*************************************************************************
     TEST(test_hfsm_emergency_stop_from_at_speed)
     {
@@ -791,5 +965,132 @@ namespace
 
       CHECK_THROW(mc.set_states(stateList, StateId::Number_Of_States), etl::fsm_state_list_order_exception);
     }
+
+    //*************************************************************************
+    TEST(test_hfsm_transitions_across_levels)
+    {
+      Node<TreeId::A1a> a1a;
+      Node<TreeId::A1>  a1;
+      Node<TreeId::A>   a;
+      Node<TreeId::Top> top;
+      Node<TreeId::B>   b;
+      Node<TreeId::B1>  b1;
+      Node<TreeId::B2>  b2;
+
+      etl::ifsm_state* treeList[TreeId::Number_Of_States] = { &a1a, &a1, &a, &top, &b, &b1, &b2 };
+
+      a1.add_child_state(a1a);
+      a.add_child_state(a1);
+      b.add_child_state(b1);
+      b.add_child_state(b2);
+      top.add_child_state(a);
+      top.add_child_state(b);
+
+      Tree tree;
+      tree.set_states(treeList, TreeId::Number_Of_States);
+      tree.start(false);
+
+      // Leaf to leaf, through the root.
+      tree.receive(GoTo(TreeId::B1));
+      CHECK_EQUAL(std::string("-0-1-2+4+5"), tree.log);
+      CHECK_EQUAL(int(TreeId::B1), int(tree.get_state_id()));
+
+      // Between siblings.
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::B2));
+      CHECK_EQUAL(std::string("-5+6"), tree.log);
+      CHECK_EQUAL(int(TreeId::B2), int(tree.get_state_id()));
+
+      // From a shallower leaf to a deeper one.
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::A1a));
+      CHECK_EQUAL(std::string("-6-4+2+1+0"), tree.log);
+      CHECK_EQUAL(int(TreeId::A1a), int(tree.get_state_id()));
+
+      // To a composite state, which enters its default child.
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::B));
+      CHECK_EQUAL(std::string("-0-1-2+4+5"), tree.log);
+      CHECK_EQUAL(int(TreeId::B1), int(tree.get_state_id()));
+    }
+
+    //*************************************************************************
+    TEST(test_hfsm_transitions_with_states_attached_after_set_states)
+    {
+      Node<TreeId::A1a> a1a;
+      Node<TreeId::A1>  a1;
+      Node<TreeId::A>   a;
+      Node<TreeId::Top> top;
+      Node<TreeId::B>   b;
+      Node<TreeId::B1>  b1;
+      Node<TreeId::B2>  b2;
+
+      etl::ifsm_state* treeList[TreeId::Number_Of_States] = { &a1a, &a1, &a, &top, &b, &b1, &b2 };
+
+      // 'a' and 'b2' are not yet attached, so their depths are recorded as roots.
+      a1.add_child_state(a1a);
+      a.add_child_state(a1);
+      b.add_child_state(b1);
+      top.add_child_state(b);
+
+      Tree tree;
+      tree.set_states(treeList, TreeId::Number_Of_States);
+
+      // A leaf may be attached without setting the states again.
+      b.add_child_state(b2);
+
+      // 'a' has children, so the states must be set again.
+      top.add_child_state(a);
+      tree.set_states(treeList, TreeId::Number_Of_States);
+
+      tree.start(false);
+
+      tree.receive(GoTo(TreeId::B2));
+      CHECK_EQUAL(std::string("-0-1-2+4+6"), tree.log);
+      CHECK_EQUAL(int(TreeId::B2), int(tree.get_state_id()));
+
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::A1a));
+      CHECK_EQUAL(std::string("-6-4+2+1+0"), tree.log);
+
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::B1));
+      CHECK_EQUAL(std::string("-0-1-2+4+5"), tree.log);
+    }
+
+    //*************************************************************************
+    TEST(test_hfsm_transitions_with_leaf_attached_after_set_states)
+    {
+      Node<TreeId::A1a> a1a;
+      Node<TreeId::A1>  a1;
+      Node<TreeId::A>   a;
+      Node<TreeId::Top> top;
+      Node<TreeId::B>   b;
+      Node<TreeId::B1>  b1;
+      Node<TreeId::B2>  b2;
+
+      etl::ifsm_state* treeList[TreeId::Number_Of_States] = { &a1a, &a1, &a, &top, &b, &b1, &b2 };
+
+      a1.add_child_state(a1a);
+      a.add_child_state(a1);
+      b.add_child_state(b1);
+      top.add_child_state(a);
+      top.add_child_state(b);
+
+      Tree tree;
+      tree.set_states(treeList, TreeId::Number_Of_States);
+      tree.start(false);
+
+      // Attached once running; its depth is found from its parent's.
+      b.add_child_state(b2);
+
+      tree.receive(GoTo(TreeId::B2));
+      CHECK_EQUAL(std::string("-0-1-2+4+6"), tree.log);
+      CHECK_EQUAL(int(TreeId::B2), int(tree.get_state_id()));
+
+      tree.log.clear();
+      tree.receive(GoTo(TreeId::A1a));
+      CHECK_EQUAL(std::string("-6-4+2+1+0"), tree.log);
+    }
   };
 }
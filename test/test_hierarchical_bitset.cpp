@@ -0,0 +1,251 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <bitset>
+#include <vector>
+
+#include "etl/hierarchical_bitset.h"
+
+namespace
+{
+  //***************************************************************************
+  // Checks every find_next result against a std::bitset.
+  //***************************************************************************
+  template <size_t N>
+  void check_find_next(const etl::hierarchical_bitset<N>& data, const std::bitset<N>& compare)
+  {
+    for (int s = 0; s < 2; ++s)
+    {
+      const bool state = (s == 1);
+
+      size_t expected = N;
+
+      for (size_t position = N + 1U; position-- > 0U;)
+      {
+        if ((position < N) && (compare.test(position) == state))
+        {
+          expected = position;
+        }
+
+        const size_t result = data.find_next(state, position);
+
+        CHECK_EQUAL((expected == N) ? size_t(etl::hierarchical_bitset<N>::npos) : expected, result);
+      }
+    }
+  }
+
+  //***************************************************************************
+  // Sets a pattern in both bitsets.
+  //***************************************************************************
+  template <size_t N>
+  void set_pattern(etl::hierarchical_bitset<N>& data, std::bitset<N>& compare, size_t seed)
+  {
+    uint32_t state = uint32_t(seed);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      state = (state * 1664525UL) + 1013904223UL;
+
+      // Long runs of each state, with some isolated bits.
+      const bool value = ((i / 97U) % 3U == 0U) ? ((state >> 28) == 0U) : ((state >> 28) != 0U);
+
+      data.set(i, value);
+      compare[i] = value;
+    }
+  }
+
+  SUITE(test_hierarchical_bitset)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::hierarchical_bitset<100> data;
+
+      CHECK_EQUAL(100U, data.size());
+      CHECK_EQUAL(0U, data.count());
+      CHECK(data.none());
+      CHECK(!data.any());
+      CHECK(!data.all());
+      CHECK_EQUAL(0U, data.find_first(false));
+      CHECK_EQUAL(size_t(etl::hierarchical_bitset<100>::npos), data.find_first(true));
+    }
+
+    //*************************************************************************
+    TEST(test_set_reset_test)
+    {
+      etl::hierarchical_bitset<200> data;
+
+      data.set(0);
+      data.set(63);
+      data.set(64);
+      data.set(199);
+      data.set(199);
+
+      CHECK_EQUAL(4U, data.count());
+      CHECK(data.test(0));
+      CHECK(data[63]);
+      CHECK(data.test(64));
+      CHECK(data.test(199));
+      CHECK(!data.test(1));
+
+      data.reset(63);
+      data.reset(63);
+      data.set(64, false);
+      data.flip(1);
+
+      CHECK_EQUAL(3U, data.count());
+      CHECK(!data.test(63));
+      CHECK(!data.test(64));
+      CHECK(data.test(1));
+
+      data.set();
+      CHECK(data.all());
+      CHECK_EQUAL(200U, data.count());
+      CHECK_EQUAL(size_t(etl::hierarchical_bitset<200>::npos), data.find_first(false));
+      CHECK_EQUAL(0U, data.find_first(true));
+
+      data.reset();
+      CHECK(data.none());
+      CHECK_EQUAL(size_t(etl::hierarchical_bitset<200>::npos), data.find_first(true));
+      CHECK_EQUAL(0U, data.find_first(false));
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_small)
+    {
+      etl::hierarchical_bitset<1> data1;
+      std::bitset<1>              compare1;
+      check_find_next(data1, compare1);
+      data1.set(0);
+      compare1.set(0);
+      check_find_next(data1, compare1);
+
+      etl::hierarchical_bitset<63> data63;
+      std::bitset<63>              compare63;
+      set_pattern(data63, compare63, 1U);
+      check_find_next(data63, compare63);
+
+      etl::hierarchical_bitset<64> data64;
+      std::bitset<64>              compare64;
+      set_pattern(data64, compare64, 2U);
+      check_find_next(data64, compare64);
+
+      etl::hierarchical_bitset<65> data65;
+      std::bitset<65>              compare65;
+      set_pattern(data65, compare65, 3U);
+      check_find_next(data65, compare65);
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_large)
+    {
+      etl::hierarchical_bitset<4097> data4097;
+      std::bitset<4097>              compare4097;
+      set_pattern(data4097, compare4097, 4U);
+      check_find_next(data4097, compare4097);
+      CHECK_EQUAL(compare4097.count(), data4097.count());
+
+      etl::hierarchical_bitset<65536 + 13> data;
+      std::bitset<65536 + 13>              compare;
+      set_pattern(data, compare, 5U);
+      check_find_next(data, compare);
+      CHECK_EQUAL(compare.count(), data.count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_sparse)
+    {
+      etl::hierarchical_bitset<65536 + 13> data;
+      std::bitset<65536 + 13>              compare;
+
+      // A single set bit near the end of a large bitset.
+      data.set(65540);
+      compare.set(65540);
+      check_find_next(data, compare);
+
+      // A single clear bit.
+      data.set();
+      compare.set();
+      data.reset(40000);
+      compare.reset(40000);
+      check_find_next(data, compare);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_and_free_slots)
+    {
+      const size_t N = 5000U;
+
+      etl::hierarchical_bitset<N> used;
+
+      // Allocate every slot.
+      for (size_t i = 0U; i < N; ++i)
+      {
+        size_t slot = used.find_first(false);
+
+        CHECK_EQUAL(i, slot);
+        used.set(slot);
+      }
+
+      CHECK(used.all());
+      CHECK_EQUAL(size_t(etl::hierarchical_bitset<N>::npos), used.find_first(false));
+
+      // Free some, then allocate them again, lowest first.
+      used.reset(4999);
+      used.reset(123);
+      used.reset(2048);
+
+      CHECK_EQUAL(123U, used.find_first(false));
+      used.set(123);
+      CHECK_EQUAL(2048U, used.find_first(false));
+      used.set(2048);
+      CHECK_EQUAL(4999U, used.find_first(false));
+      used.set(4999);
+      CHECK_EQUAL(size_t(etl::hierarchical_bitset<N>::npos), used.find_first(false));
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      etl::hierarchical_bitset<100> data1;
+      etl::hierarchical_bitset<100> data2;
+
+      data1.set(50);
+      CHECK(data1 != data2);
+
+      data2.set(50);
+      CHECK(data1 == data2);
+
+      etl::hierarchical_bitset<100> data3(data1);
+      CHECK(data3 == data1);
+    }
+  };
+}
@@ -35,6 +35,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <map>
+#include <limits>
 
 namespace
 {
@@ -376,5 +377,105 @@ namespace
       isEqual = std::equal(output2.begin(), output2.end(), histogram.begin());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_int_histogram_bulk_add)
+    {
+      // Enough samples for the partial histograms, with long runs of one bin.
+      std::array<int32_t, 1000> input;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = ((i % 100U) < 50U) ? 3 : int32_t((i * 7U) % 10U) - 4;
+      }
+
+      etl::histogram<int32_t, uint16_t, Size, Start> bulk;
+      etl::histogram<int32_t, uint16_t, Size, Start> single;
+      etl::histogram<int32_t, uint16_t, Size>        runtime(Start);
+
+      bulk.add(input.begin(), input.end());
+      runtime.add(input.begin(), input.end());
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        single.add(input[i]);
+      }
+
+      CHECK(std::equal(single.begin(), single.end(), bulk.begin()));
+      CHECK(std::equal(single.begin(), single.end(), runtime.begin()));
+      CHECK_EQUAL(input.size(), bulk.count());
+
+      // Too many bins for the partial histograms.
+      etl::histogram<int32_t, uint16_t, 1000U, 0> large1;
+      etl::histogram<int32_t, uint16_t, 1000U, 0> large2;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = int32_t((i * 37U) % 1000U);
+        large2.add(input[i]);
+      }
+
+      large1.add(input.begin(), input.end());
+
+      CHECK(std::equal(large2.begin(), large2.end(), large1.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_int_histogram_add_scaled)
+    {
+      etl::histogram<int32_t, uint16_t, 4U, 0> histogram1;
+      etl::histogram<int32_t, uint16_t, 4U>    histogram2(0);
+
+      histogram1.add_scaled(1.0,  1.0, 0.5); // Bin 0
+      histogram1.add_scaled(1.49, 1.0, 0.5); // Bin 0
+      histogram1.add_scaled(1.5,  1.0, 0.5); // Bin 1
+      histogram1.add_scaled(2.75, 1.0, 0.5); // Bin 3
+      histogram1.add_scaled(-5.0, 1.0, 0.5); // Below, bin 0
+      histogram1.add_scaled(9.0,  1.0, 0.5); // Above, bin 3
+
+      const std::array<uint16_t, 4U> expected1 = { 3, 1, 0, 2 };
+      CHECK(std::equal(expected1.begin(), expected1.end(), histogram1.begin()));
+
+      // Bulk, with enough samples for the partial histograms.
+      std::array<float, 100> input;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = (float(i) * 0.05f) - 0.5f;
+      }
+
+      histogram2.add_scaled(input.begin(), input.end(), 0.0f, 1.0f);
+
+      const std::array<uint16_t, 4U> expected2 = { 30, 20, 20, 30 };
+      CHECK(std::equal(expected2.begin(), expected2.end(), histogram2.begin()));
+
+      histogram2.add_scaled(std::numeric_limits<float>::quiet_NaN(), 0.0f, 1.0f);
+      CHECK_EQUAL(31, histogram2.begin()[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_int_histogram_merge)
+    {
+      IntOffsetminus4Histogram histogram1(input2.begin(), input2.begin() + 20);
+      IntOffsetminus4Histogram histogram2(input2.begin() + 20, input2.end());
+
+      histogram1.merge(histogram2);
+
+      CHECK(std::equal(output1.begin(), output1.end(), histogram1.begin()));
+      CHECK_EQUAL(55U, histogram1.count());
+    }
+
+    //*************************************************************************
+    TEST(test_string_histogram_merge)
+    {
+      StringHistogram histogram1(input3.begin(), input3.begin() + 20);
+      StringHistogram histogram2(input3.begin() + 20, input3.end());
+
+      histogram1.merge(histogram2);
+
+      CHECK_EQUAL(Size, histogram1.size());
+      CHECK(std::equal(output2.begin(), output2.end(), histogram1.begin()));
+      CHECK_EQUAL(55U, histogram1.count());
+    }
   };
 }
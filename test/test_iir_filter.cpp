@@ -0,0 +1,198 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/iir_filter.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  //*********************************
+  // A second order Butterworth low pass, at a tenth of the sample rate.
+  etl::biquad_coefficients<double> make_low_pass(double cutoff)
+  {
+    const double k    = std::tan(3.14159265358979323846 * cutoff);
+    const double norm = 1.0 / (1.0 + (std::sqrt(2.0) * k) + (k * k));
+
+    etl::biquad_coefficients<double> c;
+    c.b0 = k * k * norm;
+    c.b1 = 2.0 * c.b0;
+    c.b2 = c.b0;
+    c.a1 = 2.0 * ((k * k) - 1.0) * norm;
+    c.a2 = (1.0 - (std::sqrt(2.0) * k) + (k * k)) * norm;
+
+    return c;
+  }
+
+  //*********************************
+  std::vector<double> make_signal(size_t size)
+  {
+    std::vector<double> signal(size);
+    uint32_t seed = 1U;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      signal[i] = (0.4 * std::sin(double(i) * 0.02)) + (double(seed >> 8) / double(1U << 26)) - 0.125;
+    }
+
+    return signal;
+  }
+
+  //*********************************
+  // Direct form I for one section.
+  std::vector<double> reference(const std::vector<double>& x, const etl::biquad_coefficients<double>& c)
+  {
+    std::vector<double> y(x.size());
+
+    for (size_t n = 0U; n < x.size(); ++n)
+    {
+      const double x1 = (n >= 1U) ? x[n - 1U] : 0.0;
+      const double x2 = (n >= 2U) ? x[n - 2U] : 0.0;
+      const double y1 = (n >= 1U) ? y[n - 1U] : 0.0;
+      const double y2 = (n >= 2U) ? y[n - 2U] : 0.0;
+
+      y[n] = (c.b0 * x[n]) + (c.b1 * x1) + (c.b2 * x2) - (c.a1 * y1) - (c.a2 * y2);
+    }
+
+    return y;
+  }
+
+  SUITE(test_iir_filter)
+  {
+    //*************************************************************************
+    TEST(test_single_section)
+    {
+      const etl::biquad_coefficients<double> sections[1] = { make_low_pass(0.1) };
+
+      etl::iir_filter<double, 1> filter(sections);
+
+      const std::vector<double> signal   = make_signal(2000U);
+      const std::vector<double> expected = reference(signal, sections[0]);
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        const double output = filter(signal[i]);
+        CHECK_CLOSE(expected[i], output, 1e-12);
+      }
+
+      // Unity gain at DC.
+      filter.reset();
+      double dc = 0.0;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        dc = filter(1.0);
+      }
+
+      CHECK_CLOSE(1.0, dc, 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_cascade)
+    {
+      const etl::biquad_coefficients<double> sections[3] = { make_low_pass(0.1), make_low_pass(0.2), make_low_pass(0.05) };
+
+      etl::iir_filter<double, 3> filter(sections);
+
+      CHECK_EQUAL(3U, (etl::iir_filter<double, 3>::Number_Of_Sections));
+      CHECK_EQUAL(sections[1].a1, filter.section(1U).a1);
+
+      const std::vector<double> signal = make_signal(2000U);
+      const std::vector<double> expected = reference(reference(reference(signal, sections[0]), sections[1]), sections[2]);
+
+      std::vector<double> output(signal.size());
+      filter.process(signal.begin(), signal.begin() + 777, output.begin());
+      filter.process(signal.begin() + 777, signal.end(), output.begin() + 777);
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        CHECK_CLOSE(expected[i], output[i], 1e-12);
+      }
+
+      filter.reset();
+      const double first = filter(signal[0]);
+      CHECK_CLOSE(expected[0], first, 1e-15);
+    }
+
+    //*************************************************************************
+    TEST(test_float)
+    {
+      const etl::biquad_coefficients<double> c = make_low_pass(0.1);
+      const etl::biquad_coefficients<float>  sections[1] = { { float(c.b0), float(c.b1), float(c.b2), float(c.a1), float(c.a2) } };
+
+      etl::iir_filter<float, 1> filter(sections);
+
+      const std::vector<double> signal   = make_signal(2000U);
+      const std::vector<double> expected = reference(signal, c);
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        const float output = filter(float(signal[i]));
+        CHECK_CLOSE(expected[i], output, 1e-4);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point)
+    {
+      // Q15 samples, with coefficients in Q2.13, as a1 is almost -2.
+      typedef etl::q15_t                               sample_t;
+      typedef etl::fixed_point<2, 13, int16_t>         coefficient_t;
+
+      const etl::biquad_coefficients<double> c = make_low_pass(0.1);
+
+      const etl::biquad_coefficients<coefficient_t> sections[1] =
+      {
+        {
+          coefficient_t::from_floating(c.b0),
+          coefficient_t::from_floating(c.b1),
+          coefficient_t::from_floating(c.b2),
+          coefficient_t::from_floating(c.a1),
+          coefficient_t::from_floating(c.a2)
+        }
+      };
+
+      etl::iir_filter<sample_t, 1, coefficient_t> filter(sections);
+
+      const std::vector<double> signal   = make_signal(2000U);
+      const std::vector<double> expected = reference(signal, c);
+
+      for (size_t i = 0U; i < signal.size(); ++i)
+      {
+        const sample_t output = filter(sample_t::from_floating(signal[i]));
+
+        CHECK_CLOSE(expected[i], output.to_floating<double>(), 0.005);
+      }
+    }
+  };
+}
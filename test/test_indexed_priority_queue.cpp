@@ -0,0 +1,321 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "etl/indexed_priority_queue.h"
+
+namespace
+{
+  SUITE(test_indexed_priority_queue)
+  {
+    static const size_t SIZE = 16;
+
+    typedef etl::indexed_priority_queue<int, SIZE>                        Data;
+    typedef etl::iindexed_priority_queue<int>                             IData;
+    typedef etl::indexed_priority_queue<int, SIZE, etl::greater<int>, 4U> DataMin4;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(!data.contains(0U));
+      CHECK(!data.contains(SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_order)
+    {
+      Data data;
+      int values[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+
+      for (size_t i = 0U; i < std::size(values); ++i)
+      {
+        Data::handle_type handle = data.push(values[i]);
+        CHECK(data.contains(handle));
+        CHECK_EQUAL(values[i], data[handle]);
+      }
+
+      std::sort(std::begin(values), std::end(values), std::greater<int>());
+
+      for (size_t i = 0U; i < std::size(values); ++i)
+      {
+        CHECK_EQUAL(values[i], data.top());
+        CHECK_EQUAL(values[i], data.get(data.top_handle()));
+        data.pop();
+      }
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.push(int(i));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push(0), etl::indexed_priority_queue_full);
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      DataMin4 data;
+
+      DataMin4::handle_type h10 = data.push(10);
+      DataMin4::handle_type h20 = data.push(20);
+      DataMin4::handle_type h30 = data.push(30);
+
+      CHECK_EQUAL(h10, data.top_handle());
+
+      // Decrease key.
+      data.update(h30, 5);
+      CHECK_EQUAL(h30, data.top_handle());
+      CHECK_EQUAL(5, data.top());
+
+      // Increase key.
+      data.update(h30, 25);
+      CHECK_EQUAL(h10, data.top_handle());
+
+      data.pop();
+      CHECK_EQUAL(h20, data.top_handle());
+      data.pop();
+      CHECK_EQUAL(h30, data.top_handle());
+      CHECK_EQUAL(25, data.top());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data;
+
+      Data::handle_type h1 = data.push(1);
+      Data::handle_type h5 = data.push(5);
+      Data::handle_type h3 = data.push(3);
+
+      data.erase(h5);
+
+      CHECK(!data.contains(h5));
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(3, data.top());
+      CHECK_THROW(data.erase(h5), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(data.update(h5, 1), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(data.get(h5), etl::indexed_priority_queue_invalid_handle);
+
+      // The free handle is reused.
+      Data::handle_type h7 = data.push(7);
+      CHECK_EQUAL(h5, h7);
+      CHECK_EQUAL(7, data.top());
+
+      data.erase(h3);
+      data.erase(h7);
+      CHECK_EQUAL(h1, data.top_handle());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_multiset)
+    {
+      DataMin4 data;
+      std::multiset<int> compare;
+      std::vector<DataMin4::handle_type> handles;
+
+      unsigned int seed = 42U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const unsigned int r = seed >> 16;
+        const int value = int(r % 1000U);
+
+        switch (r % 4U)
+        {
+          case 0:
+          case 1:
+          {
+            if (!data.full())
+            {
+              handles.push_back(data.push(value));
+              compare.insert(value);
+            }
+            break;
+          }
+
+          case 2:
+          {
+            if (!handles.empty())
+            {
+              size_t index = (r / 4U) % handles.size();
+              compare.erase(compare.find(data[handles[index]]));
+              compare.insert(value);
+              data.update(handles[index], value);
+            }
+            break;
+          }
+
+          default:
+          {
+            if (!handles.empty())
+            {
+              size_t index = (r / 4U) % handles.size();
+              compare.erase(compare.find(data[handles[index]]));
+              data.erase(handles[index]);
+              handles.erase(handles.begin() + index);
+            }
+            break;
+          }
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+
+        if (!data.empty())
+        {
+          CHECK_EQUAL(*compare.begin(), data.top());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_dijkstra)
+    {
+      // A small graph as an adjacency matrix. -1 is no edge.
+      static const int N = 6;
+      const int graph[N][N] =
+      {
+        { -1,  7,  9, -1, -1, 14 },
+        {  7, -1, 10, 15, -1, -1 },
+        {  9, 10, -1, 11, -1,  2 },
+        { -1, 15, 11, -1,  6, -1 },
+        { -1, -1, -1,  6, -1,  9 },
+        { 14, -1,  2, -1,  9, -1 }
+      };
+
+      struct Node
+      {
+        int distance;
+        int vertex;
+
+        bool operator <(const Node& other) const
+        {
+          return distance < other.distance;
+        }
+      };
+
+      etl::indexed_priority_queue<Node, N, etl::greater<Node>, 4U> open;
+      size_t handle[N];
+      int    distance[N];
+
+      for (int v = 0; v < N; ++v)
+      {
+        distance[v] = (v == 0) ? 0 : 1000;
+        Node node = { distance[v], v };
+        handle[v] = open.push(node);
+      }
+
+      while (!open.empty())
+      {
+        Node current = open.top();
+        open.pop();
+
+        for (int v = 0; v < N; ++v)
+        {
+          if ((graph[current.vertex][v] >= 0) && open.contains(handle[v]))
+          {
+            int candidate = current.distance + graph[current.vertex][v];
+
+            if (candidate < distance[v])
+            {
+              distance[v] = candidate;
+              Node node = { candidate, v };
+              open.update(handle[v], node);
+            }
+          }
+        }
+      }
+
+      const int expected[N] = { 0, 7, 9, 20, 20, 11 };
+      CHECK(std::equal(std::begin(expected), std::end(expected), std::begin(distance)));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move_keep_handles)
+    {
+      etl::indexed_priority_queue<std::string, SIZE> data;
+
+      size_t ha = data.push(std::string("a"));
+      size_t hc = data.push(std::string("c"));
+      size_t hb = data.emplace(1U, 'b');
+
+      etl::indexed_priority_queue<std::string, SIZE> copy(data);
+      CHECK_EQUAL(3U, copy.size());
+      CHECK_EQUAL(std::string("b"), copy[hb]);
+      copy.update(ha, std::string("z"));
+      CHECK_EQUAL(ha, copy.top_handle());
+      CHECK_EQUAL(hc, data.top_handle());
+
+      etl::indexed_priority_queue<std::string, SIZE> moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(hc, moved.top_handle());
+
+      data = copy;
+      CHECK_EQUAL(ha, data.top_handle());
+      CHECK_EQUAL(std::string("z"), data.top());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      Data data;
+      IData& idata = data;
+
+      idata.push(3);
+      idata.push(4);
+
+      CHECK_EQUAL(4, idata.top());
+      idata.clear();
+      CHECK(data.empty());
+    }
+  };
+}
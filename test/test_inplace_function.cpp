@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/inplace_function.h"
+#include "etl/delegate.h"
+
+#include <string.h>
+#include <type_traits>
+
+namespace
+{
+  //*****************************************************************************
+  int free_add(int a, int b)
+  {
+    return a + b;
+  }
+
+  //*****************************************************************************
+  struct Accumulator
+  {
+    int operator()(int value)
+    {
+      total += value;
+      return total;
+    }
+
+    int total;
+  };
+
+  //*****************************************************************************
+  struct MoveableOnlyData
+  {
+    MoveableOnlyData() = default;
+    MoveableOnlyData(const MoveableOnlyData&) = delete;
+    MoveableOnlyData(MoveableOnlyData&&) = default;
+    int d;
+  };
+
+  typedef etl::inplace_function<int(int, int)> Function;
+
+  SUITE(test_inplace_function)
+  {
+    //*************************************************************************
+    TEST(test_default_is_empty)
+    {
+      Function f;
+
+      CHECK(!f.is_valid());
+      CHECK(!f);
+      CHECK_THROW(f(1, 2), etl::inplace_function_uninitialised);
+    }
+
+    //*************************************************************************
+    TEST(test_free_function)
+    {
+      Function f(free_add);
+
+      CHECK(f.is_valid());
+      CHECK_EQUAL(3, f(1, 2));
+
+      int (*null_function)(int, int) = nullptr;
+      f = null_function;
+      CHECK(!f.is_valid());
+
+      f = &free_add;
+      CHECK_EQUAL(7, f(3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_capturing_lambda)
+    {
+      int offset = 10;
+      int calls  = 0;
+
+      Function f([offset, &calls](int a, int b) { ++calls; return a + b + offset; });
+
+      CHECK_EQUAL(13, f(1, 2));
+      CHECK_EQUAL(1, calls);
+
+      // The capture is held by value.
+      offset = 0;
+      CHECK_EQUAL(13, f(1, 2));
+      CHECK_EQUAL(2, calls);
+    }
+
+    //*************************************************************************
+    TEST(test_mutable_functor_state_is_held_inplace)
+    {
+      etl::inplace_function<int(int), sizeof(int), alignof(int)> f(Accumulator{ 0 });
+
+      CHECK_EQUAL(1, f(1));
+      CHECK_EQUAL(3, f(2));
+
+      // The copy has its own state.
+      etl::inplace_function<int(int), sizeof(int), alignof(int)> g(f);
+      CHECK_EQUAL(13, g(10));
+      CHECK_EQUAL(6, f(3));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_and_clear)
+    {
+      Function f;
+
+      f = [](int a, int b) { return a * b; };
+      CHECK_EQUAL(12, f(3, 4));
+
+      f = [](int a, int b) { return a - b; };
+      CHECK_EQUAL(-1, f(3, 4));
+
+      f.clear();
+      CHECK(!f.is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_trivially_copyable)
+    {
+      CHECK(std::is_trivially_copyable<Function>::value);
+
+      int base = 100;
+      Function f([base](int a, int b) { return base + a + b; });
+
+      // Relocate with memcpy.
+      alignas(Function) unsigned char buffer[sizeof(Function)];
+      memcpy(buffer, &f, sizeof(Function));
+      f.clear();
+
+      Function& g = *reinterpret_cast<Function*>(buffer);
+      CHECK_EQUAL(103, g(1, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_holds_a_delegate)
+    {
+      auto lambda = [](int a, int b) { return a + (2 * b); };
+
+      etl::delegate<int(int, int)> d(lambda);
+
+      Function f(d);
+      CHECK_EQUAL(5, f(1, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_moveable_only_parameter)
+    {
+      etl::inplace_function<int(MoveableOnlyData&&)> f([](MoveableOnlyData&& data) { return data.d; });
+
+      MoveableOnlyData data;
+      data.d = 5;
+
+      CHECK_EQUAL(5, f(std::move(data)));
+    }
+
+    //*************************************************************************
+    TEST(test_void_return)
+    {
+      int result = 0;
+
+      etl::inplace_function<void(int)> f([&result](int value) { result = value; });
+
+      f(42);
+      CHECK_EQUAL(42, result);
+    }
+
+    //*************************************************************************
+    TEST(test_capacity)
+    {
+      CHECK_EQUAL(ETL_INPLACE_FUNCTION_DEFAULT_SIZE, Function::capacity());
+      CHECK_EQUAL(32U, (etl::inplace_function<void(), 32U>::capacity()));
+    }
+  };
+}
@@ -0,0 +1,337 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/interval_map.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace
+{
+  typedef etl::interval_map<int, char, 8>       Map;
+  typedef etl::interval_multimap<int, int, 64>  MultiMap;
+
+  //***************************************************************************
+  struct Collect
+  {
+    Collect(std::vector<int>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator()(const etl::interval<int>&, const int& value)
+    {
+      values.push_back(value);
+    }
+
+    std::vector<int>& values;
+  };
+
+  //***************************************************************************
+  struct Increment
+  {
+    void operator()(const etl::interval<int>&, int& value)
+    {
+      ++value;
+    }
+  };
+
+  SUITE(test_interval_map)
+  {
+    //*************************************************************************
+    TEST(test_interval_map_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK(!map.full());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(8U, map.max_size());
+      CHECK_EQUAL(8U, map.available());
+      CHECK(map.begin() == map.end());
+      CHECK(map.find(0) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_interval_map_insert_find)
+    {
+      Map map;
+
+      CHECK(map.insert(0x1000, 0x2000, 'a').second);
+      CHECK(map.insert(0x4000, 0x4100, 'c').second);
+      CHECK(map.insert(0x2000, 0x3000, 'b').second);
+
+      // Overlaps.
+      ETL_OR_STD::pair<Map::const_iterator, bool> result = map.insert(0x2FFF, 0x4001, 'x');
+      CHECK(!result.second);
+      CHECK_EQUAL('b', result.first->second);
+      CHECK(!map.insert(0x0000, 0x1001, 'x').second);
+      CHECK(!map.insert(0x1800, 0x1900, 'x').second);
+
+      CHECK_EQUAL(3U, map.size());
+
+      CHECK(map.find(0x0FFF) == nullptr);
+      CHECK_EQUAL('a', *map.find(0x1000));
+      CHECK_EQUAL('a', *map.find(0x1FFF));
+      CHECK_EQUAL('b', *map.find(0x2000));
+      CHECK(map.find(0x3000) == nullptr);
+      CHECK_EQUAL('c', *map.find(0x40FF));
+      CHECK(map.find(0x4100) == nullptr);
+
+      CHECK(map.contains(0x2ABC));
+      CHECK(!map.contains(0x3ABC));
+      CHECK(map.overlaps(0x3000, 0x4001));
+      CHECK(!map.overlaps(0x3000, 0x4000));
+
+      const Map& cmap = map;
+      CHECK(cmap.find_interval(0x1234)->first == etl::interval<int>(0x1000, 0x2000));
+      CHECK(cmap.find_interval(0x3456) == cmap.end());
+
+      // In order.
+      Map::const_iterator itr = map.begin();
+      CHECK_EQUAL('a', (itr++)->second);
+      CHECK_EQUAL('b', (itr++)->second);
+      CHECK_EQUAL('c', (itr++)->second);
+      CHECK(itr == map.end());
+
+      *map.find(0x1000) = 'z';
+      CHECK_EQUAL('z', *cmap.find(0x1000));
+    }
+
+    //*************************************************************************
+    TEST(test_interval_map_errors)
+    {
+      etl::interval_map<int, int, 2> map;
+
+      CHECK_THROW(map.insert(5, 5, 0), etl::interval_map_invalid_interval);
+      CHECK_THROW(map.insert(6, 5, 0), etl::interval_map_invalid_interval);
+
+      map.insert(0, 1, 0);
+      map.insert(1, 2, 1);
+      CHECK(map.full());
+      CHECK_THROW(map.insert(2, 3, 2), etl::interval_map_full);
+
+      // An overlapping insert is not an error when full.
+      CHECK(!map.insert(0, 3, 2).second);
+    }
+
+    //*************************************************************************
+    TEST(test_interval_map_erase_copy)
+    {
+      Map map;
+
+      map.insert(0,  10, 'a');
+      map.insert(10, 20, 'b');
+      map.insert(30, 40, 'c');
+
+      Map copy(map);
+
+      CHECK_EQUAL(1U, map.erase(15));
+      CHECK_EQUAL(0U, map.erase(15));
+      CHECK(map.find(15) == nullptr);
+
+      Map::const_iterator itr = map.erase(map.begin());
+      CHECK_EQUAL('c', itr->second);
+      CHECK_EQUAL(1U, map.size());
+
+      CHECK_EQUAL(3U, copy.size());
+      CHECK_EQUAL('b', *copy.find(15));
+
+      map = copy;
+      CHECK_EQUAL(3U, map.size());
+      CHECK_EQUAL('a', *map.find(5));
+
+      map.clear();
+      CHECK(map.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_interval_multimap_overlaps)
+    {
+      MultiMap map;
+
+      map.insert(0,  100, 1);
+      map.insert(10, 20,  2);
+      map.insert(15, 50,  3);
+      map.insert(40, 45,  4);
+      map.insert(60, 70,  5);
+      map.insert(10, 12,  6);
+
+      std::vector<int> values;
+      map.for_each_containing(16, Collect(values));
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(1, values[0]);
+      CHECK_EQUAL(2, values[1]);
+      CHECK_EQUAL(3, values[2]);
+
+      // Equal lows are kept in insertion order.
+      values.clear();
+      map.for_each_overlap(11, 12, Collect(values));
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(1, values[0]);
+      CHECK_EQUAL(2, values[1]);
+      CHECK_EQUAL(6, values[2]);
+
+      values.clear();
+      map.for_each_overlap(45, 61, Collect(values));
+      CHECK_EQUAL(3U, values.size());
+      CHECK_EQUAL(1, values[0]);
+      CHECK_EQUAL(3, values[1]);
+      CHECK_EQUAL(5, values[2]);
+
+      CHECK(map.contains(99));
+      CHECK(!map.contains(100));
+      CHECK(map.overlaps(99, 200));
+      CHECK(!map.overlaps(100, 200));
+      CHECK(!map.overlaps(50, 50));
+      CHECK_EQUAL(1, map.find_first_overlap(18, 19)->second);
+      CHECK(map.find_first_overlap(70, 100) == map.begin());
+      CHECK(map.find_first_overlap(100, 101) == map.end());
+
+      // Values may be modified.
+      map.for_each_containing(61, Increment());
+      values.clear();
+      map.for_each_overlap(60, 61, Collect(values));
+      CHECK_EQUAL(2, values[0]);
+      CHECK_EQUAL(6, values[1]);
+
+      CHECK_EQUAL(1U, map.erase(0, 100));
+      CHECK_EQUAL(0U, map.erase(0, 100));
+      CHECK(!map.contains(99));
+      CHECK_EQUAL(6, map.find_first_overlap(65, 200)->second);
+
+      CHECK_THROW(map.insert(1, 0, 0), etl::interval_map_invalid_interval);
+    }
+
+    //*************************************************************************
+    TEST(test_interval_multimap_random_against_reference)
+    {
+      MultiMap map;
+      std::vector<std::pair<std::pair<int, int>, int> > reference;
+
+      std::mt19937 generator(1);
+
+      for (int step = 0; step < 5000; ++step)
+      {
+        const int low  = int(generator() % 1000U);
+        const int high = low + 1 + int(generator() % ((generator() % 4U) == 0U ? 500U : 20U));
+
+        if (!map.full() && ((generator() % 3U) != 0U))
+        {
+          map.insert(low, high, step);
+          reference.push_back(std::make_pair(std::make_pair(low, high), step));
+        }
+        else if (!map.empty())
+        {
+          const size_t index = generator() % map.size();
+          MultiMap::const_iterator itr = map.begin() + index;
+
+          for (size_t i = 0U; i < reference.size(); ++i)
+          {
+            if (reference[i].second == itr->second)
+            {
+              reference.erase(reference.begin() + i);
+              break;
+            }
+          }
+
+          map.erase(itr);
+        }
+
+        CHECK_EQUAL(reference.size(), map.size());
+
+        const int query_low  = int(generator() % 1100U);
+        const int query_high = query_low + 1 + int(generator() % 50U);
+
+        std::vector<int> expected;
+
+        for (size_t i = 0U; i < reference.size(); ++i)
+        {
+          if ((reference[i].first.first < query_high) && (query_low < reference[i].first.second))
+          {
+            expected.push_back(reference[i].second);
+          }
+        }
+
+        std::vector<int> values;
+        map.for_each_overlap(query_low, query_high, Collect(values));
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(values.begin(), values.end());
+        CHECK(expected == values);
+        CHECK_EQUAL(!expected.empty(), map.overlaps(query_low, query_high));
+
+        expected.clear();
+        values.clear();
+
+        for (size_t i = 0U; i < reference.size(); ++i)
+        {
+          if ((reference[i].first.first <= query_low) && (query_low < reference[i].first.second))
+          {
+            expected.push_back(reference[i].second);
+          }
+        }
+
+        map.for_each_containing(query_low, Collect(values));
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(values.begin(), values.end());
+        CHECK(expected == values);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_interval_multimap_copy)
+    {
+      MultiMap map;
+
+      map.insert(0, 10, 1);
+      map.insert(5, 15, 2);
+
+      MultiMap copy(map);
+      MultiMap assigned;
+      assigned.insert(100, 200, 3);
+      assigned = map;
+
+      std::vector<int> values;
+      copy.for_each_containing(7, Collect(values));
+      CHECK_EQUAL(2U, values.size());
+
+      values.clear();
+      assigned.for_each_containing(12, Collect(values));
+      CHECK_EQUAL(1U, values.size());
+      CHECK_EQUAL(2, values[0]);
+      CHECK(!assigned.contains(150));
+    }
+  }
+}
@@ -0,0 +1,215 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/interval_set.h"
+
+#include <bitset>
+#include <random>
+
+namespace
+{
+  typedef etl::interval_set<int, 8> Set;
+
+  SUITE(test_interval_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK_EQUAL(8U, set.max_size());
+      CHECK(!set.contains(0));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_merges)
+    {
+      Set set;
+
+      set.insert(10, 20);
+      set.insert(30, 40);
+      set.insert(50, 60);
+      CHECK_EQUAL(3U, set.size());
+
+      // Touching intervals are merged.
+      set.insert(20, 25);
+      CHECK_EQUAL(3U, set.size());
+      CHECK(set.begin()->low == 10);
+      CHECK(set.begin()->high == 25);
+
+      // Spanning several intervals.
+      Set::const_iterator itr = set.insert(24, 55);
+      CHECK(*itr == etl::interval<int>(10, 60));
+      CHECK_EQUAL(1U, set.size());
+
+      // Inside an interval.
+      set.insert(12, 14);
+      CHECK_EQUAL(1U, set.size());
+
+      set.insert(0, 5);
+      CHECK_EQUAL(2U, set.size());
+      CHECK(*set.begin() == etl::interval<int>(0, 5));
+
+      CHECK(set.contains(0));
+      CHECK(set.contains(4));
+      CHECK(!set.contains(5));
+      CHECK(set.contains(10, 60));
+      CHECK(!set.contains(4, 11));
+      CHECK(set.overlaps(4, 11));
+      CHECK(!set.overlaps(5, 10));
+      CHECK(set.find(7) == set.end());
+      CHECK(*set.find(59) == etl::interval<int>(10, 60));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_trims_and_splits)
+    {
+      Set set;
+
+      set.insert(0, 100);
+
+      set.erase(40, 60);
+      CHECK_EQUAL(2U, set.size());
+      CHECK(*set.begin() == etl::interval<int>(0, 40));
+      CHECK(*(set.begin() + 1) == etl::interval<int>(60, 100));
+
+      set.erase(30, 70);
+      CHECK_EQUAL(2U, set.size());
+      CHECK(*set.begin() == etl::interval<int>(0, 30));
+      CHECK(*(set.begin() + 1) == etl::interval<int>(70, 100));
+
+      set.erase(-10, 10);
+      set.erase(90, 110);
+      CHECK(*set.begin() == etl::interval<int>(10, 30));
+      CHECK(*(set.begin() + 1) == etl::interval<int>(70, 90));
+
+      set.erase(0, 200);
+      CHECK(set.empty());
+
+      set.insert(0, 10);
+      set.insert(20, 30);
+      set.erase(set.begin());
+      CHECK_EQUAL(1U, set.size());
+      CHECK(!set.contains(5));
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::interval_set<int, 2> set;
+
+      CHECK_THROW(set.insert(1, 1), etl::interval_set_invalid_interval);
+      CHECK_THROW(set.erase(2, 1), etl::interval_set_invalid_interval);
+
+      set.insert(0, 10);
+      set.insert(20, 30);
+      CHECK_THROW(set.insert(40, 50), etl::interval_set_full);
+      CHECK_THROW(set.erase(4, 6), etl::interval_set_full);
+
+      // Merging and trimming need no space.
+      set.insert(5, 25);
+      CHECK_EQUAL(1U, set.size());
+      set.erase(0, 5);
+      CHECK_EQUAL(1U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Set set;
+      set.insert(0, 10);
+
+      Set copy(set);
+      Set assigned;
+      assigned.insert(50, 60);
+      assigned = set;
+
+      set.clear();
+
+      CHECK(copy.contains(5));
+      CHECK(assigned.contains(5));
+      CHECK(!assigned.contains(55));
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_reference)
+    {
+      const int Range = 256;
+
+      etl::interval_set<int, Range> set;
+      std::bitset<Range> reference;
+
+      std::mt19937 generator(7);
+
+      for (int step = 0; step < 5000; ++step)
+      {
+        const int low  = int(generator() % (Range - 1));
+        const int high = low + 1 + int(generator() % ((Range - low) < 20 ? (Range - low) : 20));
+
+        if ((generator() % 2U) == 0U)
+        {
+          set.insert(low, high);
+
+          for (int i = low; i < high; ++i)
+          {
+            reference.set(i);
+          }
+        }
+        else
+        {
+          set.erase(low, high);
+
+          for (int i = low; i < high; ++i)
+          {
+            reference.reset(i);
+          }
+        }
+
+        // The intervals are disjoint, ordered and not touching.
+        size_t runs = 0U;
+
+        for (int i = 0; i < Range; ++i)
+        {
+          CHECK_EQUAL(bool(reference[i]), set.contains(i));
+
+          if (reference[i] && ((i == 0) || !reference[i - 1]))
+          {
+            ++runs;
+          }
+        }
+
+        CHECK_EQUAL(runs, set.size());
+      }
+    }
+  }
+}
@@ -121,6 +121,23 @@ namespace
   typedef etl::intrusive_forward_list<ItemNDCNode, SecondLink> DataNDC1;
 
   typedef std::vector<ItemNDCNode> InitialDataNDC;
+
+  //***************************************************************************
+  // Nodes with 16 bit offset links, held in the same object as the list.
+  typedef etl::compact_forward_link<0, int16_t> CompactLink;
+
+  struct CompactNode : public CompactLink
+  {
+    int value;
+  };
+
+  typedef etl::intrusive_forward_list<CompactNode, CompactLink> CompactList;
+
+  struct CompactPool
+  {
+    CompactNode nodes[16];
+    CompactList list;
+  };
 }
 
 namespace
@@ -163,6 +180,38 @@ namespace
       }
     };
 
+    //*************************************************************************
+    TEST(test_compact_links)
+    {
+      CompactPool pool;
+      std::forward_list<int> compare;
+
+      CHECK_EQUAL(2U, sizeof(CompactLink));
+
+      for (int i = 0; i < 16; ++i)
+      {
+        pool.nodes[i].value = (i * 7) % 16;
+        pool.list.push_front(pool.nodes[i]);
+        compare.push_front(pool.nodes[i].value);
+      }
+
+      pool.list.erase_after(pool.list.begin());
+      compare.erase_after(compare.begin());
+
+      pool.list.reverse();
+      compare.reverse();
+
+      CHECK(std::equal(compare.begin(), compare.end(), pool.list.begin(),
+                       [](int lhs, const CompactNode& rhs) { return lhs == rhs.value; }));
+
+      pool.list.sort([](const CompactNode& lhs, const CompactNode& rhs) { return lhs.value < rhs.value; });
+      compare.sort();
+
+      CHECK_EQUAL(size_t(std::distance(compare.begin(), compare.end())), pool.list.size());
+      CHECK(std::equal(compare.begin(), compare.end(), pool.list.begin(),
+                       [](int lhs, const CompactNode& rhs) { return lhs == rhs.value; }));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_default_constructor)
     {
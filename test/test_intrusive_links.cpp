@@ -96,6 +96,29 @@ namespace
     int value;
   };
 
+  //*******************************************************
+  // Compact
+  //*******************************************************
+  typedef etl::compact_forward_link<0, int16_t>       CFLink0;
+  typedef etl::compact_bidirectional_link<1, int16_t> CBLink1;
+
+  struct CData : public CFLink0, public CBLink1
+  {
+    CData(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct CFar
+  {
+    CData first;
+    char  gap[40000];
+    CData second;
+  };
+
   SUITE(test_forward_list)
   {
     //*************************************************************************
@@ -373,6 +396,38 @@ namespace
       CHECK(data0.FLink0::etl_next == &data0);
     }
 
+    //*************************************************************************
+    TEST(test_compact_forward_link)
+    {
+      CData data[4] = { CData(0), CData(1), CData(2), CData(3) };
+
+      CHECK_EQUAL(2U, sizeof(CFLink0));
+
+      data[0].CFLink0::clear();
+      CHECK(!data[0].CFLink0::is_linked());
+
+      etl::link<CFLink0>(data[0], data[1]);
+      etl::link<CFLink0>(data[1], data[3]);
+      etl::link<CFLink0>(data[3], ETL_NULLPTR);
+      etl::link_splice<CFLink0>(data[1], data[2]);
+
+      CHECK(data[0].CFLink0::is_linked());
+
+      int expected = 0;
+      CFLink0* p = &data[0];
+
+      while (p != ETL_NULLPTR)
+      {
+        CHECK_EQUAL(expected++, static_cast<CData*>(p)->value);
+        p = p->etl_next;
+      }
+
+      CHECK_EQUAL(4, expected);
+
+      etl::unlink_after<CFLink0>(data[1]);
+      CHECK(data[1].CFLink0::etl_next == &data[3]);
+    }
+
     //*************************************************************************
     TEST(test_link_bidirectional_link)
     {
@@ -810,6 +865,55 @@ namespace
       CHECK(data0.BLink0::etl_next     == &data0);
     }
 
+    //*************************************************************************
+    TEST(test_compact_bidirectional_link)
+    {
+      CData data[4] = { CData(0), CData(1), CData(2), CData(3) };
+
+      CHECK_EQUAL(4U, sizeof(CBLink1));
+
+      data[0].CBLink1::clear();
+      data[3].CBLink1::clear();
+      etl::link<CBLink1>(data[0], data[1]);
+      etl::link<CBLink1>(data[1], data[3]);
+      etl::link_splice<CBLink1>(data[1], data[2]);
+
+      CHECK(data[2].CBLink1::etl_previous == &data[1]);
+      CHECK(data[2].CBLink1::etl_next == &data[3]);
+      CHECK(data[3].CBLink1::etl_previous == &data[2]);
+
+      etl::unlink<CBLink1>(data[2]);
+      CHECK(data[1].CBLink1::etl_next == &data[3]);
+      CHECK(data[3].CBLink1::etl_previous == &data[1]);
+
+      data[1].CBLink1::reverse();
+      CHECK(data[1].CBLink1::etl_next == &data[0]);
+      CHECK(data[1].CBLink1::etl_previous == &data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_compact_link_copy_points_to_same_link)
+    {
+      CData data[3] = { CData(0), CData(1), CData(2) };
+
+      etl::link<CFLink0>(data[0], data[2]);
+
+      // The copy is at a different address, but points at the same link.
+      data[1].CFLink0::etl_next = data[0].CFLink0::etl_next;
+      CHECK(data[1].CFLink0::etl_next == &data[2]);
+
+      CFLink0 copy(data[0]);
+      CHECK(copy.etl_next == &data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_compact_link_offset_out_of_range)
+    {
+      static CFar far;
+
+      CHECK_THROW(etl::link<CFLink0>(far.first, far.second), etl::link_offset_exception);
+    }
+
     //*************************************************************************
     TEST(test_tree_link)
     {
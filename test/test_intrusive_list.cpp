@@ -134,6 +134,23 @@ namespace
   typedef etl::intrusive_list<ItemNDCNode, SecondLink> DataNDC1;
 
   typedef std::vector<ItemNDCNode> InitialDataNDC;
+
+  //***************************************************************************
+  // Nodes with 16 bit offset links, held in the same object as the list.
+  typedef etl::compact_bidirectional_link<0, int16_t> CompactLink;
+
+  struct CompactNode : public CompactLink
+  {
+    int value;
+  };
+
+  typedef etl::intrusive_list<CompactNode, CompactLink> CompactList;
+
+  struct CompactPool
+  {
+    CompactNode nodes[16];
+    CompactList list;
+  };
 }
 
 namespace
@@ -174,6 +191,74 @@ namespace
       }
     };
 
+    //*************************************************************************
+    TEST(test_compact_links)
+    {
+      CompactPool pool;
+      std::list<int> compare;
+
+      CHECK_EQUAL(4U, sizeof(CompactLink));
+
+      for (int i = 0; i < 16; ++i)
+      {
+        pool.nodes[i].value = (i * 7) % 16;
+      }
+
+      for (int i = 0; i < 8; ++i)
+      {
+        pool.list.push_back(pool.nodes[i]);
+        compare.push_back(pool.nodes[i].value);
+      }
+
+      for (int i = 8; i < 16; ++i)
+      {
+        pool.list.push_front(pool.nodes[i]);
+        compare.push_front(pool.nodes[i].value);
+      }
+
+      CompactList::iterator itr = pool.list.begin();
+      std::advance(itr, 3);
+      pool.list.erase(itr);
+      std::list<int>::iterator citr = compare.begin();
+      std::advance(citr, 3);
+      compare.erase(citr);
+
+      CHECK_EQUAL(compare.size(), pool.list.size());
+
+      pool.list.reverse();
+      compare.reverse();
+
+      std::vector<int> result;
+      for (CompactList::const_iterator i = pool.list.begin(); i != pool.list.end(); ++i)
+      {
+        result.push_back(i->value);
+      }
+
+      CHECK(std::equal(compare.begin(), compare.end(), result.begin()));
+
+      struct Less
+      {
+        bool operator ()(const CompactNode& lhs, const CompactNode& rhs) const
+        {
+          return lhs.value < rhs.value;
+        }
+      };
+
+      pool.list.sort(Less());
+      compare.sort();
+
+      // Walk back from the end to check the previous links.
+      result.clear();
+      CompactList::iterator i = pool.list.end();
+      while (i != pool.list.begin())
+      {
+        --i;
+        result.push_back(i->value);
+      }
+
+      CHECK(std::equal(compare.rbegin(), compare.rend(), result.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_default_constructor)
     {
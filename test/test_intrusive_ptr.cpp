@@ -0,0 +1,329 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_ptr.h"
+#include "etl/reference_counted_object.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  struct Object : public etl::intrusive_reference_counted<Object>
+  {
+    Object(int value_ = 0)
+      : value(value_)
+      , released(0)
+    {
+    }
+
+    void release()
+    {
+      ++released;
+    }
+
+    int value;
+    int released;
+  };
+
+  //***************************************************************************
+  struct DerivedObject : public Object
+  {
+    DerivedObject(int value_)
+      : Object(value_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  struct AtomicObject : public etl::intrusive_reference_counted<AtomicObject, etl::atomic_int32_t>
+  {
+    AtomicObject()
+      : released(0)
+    {
+    }
+
+    void release()
+    {
+      ++released;
+    }
+
+    etl::atomic_int32_t released;
+  };
+
+  typedef etl::intrusive_ptr<Object> Ptr;
+
+  typedef etl::biased_counted_object<int>           BiasedObject;
+  typedef etl::reference_counter<etl::biased_counter> BiasedCounter;
+
+  SUITE(test_intrusive_ptr)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Ptr p;
+
+      CHECK(!p);
+      CHECK(p.get() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_construct_and_release)
+    {
+      Object object(1);
+
+      {
+        Ptr p(&object);
+
+        CHECK(bool(p));
+        CHECK_EQUAL(1, object.get_reference_count());
+        CHECK_EQUAL(1, p->value);
+        CHECK_EQUAL(1, (*p).value);
+        CHECK_EQUAL(0, object.released);
+      }
+
+      CHECK_EQUAL(0, object.get_reference_count());
+      CHECK_EQUAL(1, object.released);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Object object(1);
+
+      {
+        Ptr p1(&object);
+        Ptr p2(p1);
+        CHECK_EQUAL(2, object.get_reference_count());
+
+        Ptr p3(std::move(p1));
+        CHECK_EQUAL(2, object.get_reference_count());
+        CHECK(!p1);
+        CHECK(p2 == p3);
+
+        Ptr p4;
+        p4 = p2;
+        CHECK_EQUAL(3, object.get_reference_count());
+
+        p4 = std::move(p3);
+        CHECK_EQUAL(2, object.get_reference_count());
+        CHECK(!p3);
+      }
+
+      CHECK_EQUAL(0, object.get_reference_count());
+      CHECK_EQUAL(1, object.released);
+    }
+
+    //*************************************************************************
+    TEST(test_reset_and_assign)
+    {
+      Object object1(1);
+      Object object2(2);
+
+      Ptr p(&object1);
+      p.reset(&object2);
+      CHECK_EQUAL(1, object1.released);
+      CHECK_EQUAL(1, object2.get_reference_count());
+
+      p = &object1;
+      CHECK_EQUAL(1, object2.released);
+      CHECK_EQUAL(1, object1.get_reference_count());
+
+      p.reset();
+      CHECK(!p);
+      CHECK_EQUAL(2, object1.released);
+    }
+
+    //*************************************************************************
+    TEST(test_adopt_and_detach)
+    {
+      Object object(1);
+
+      intrusive_ptr_add_ref(&object);
+
+      {
+        Ptr p(&object, false);
+        CHECK_EQUAL(1, object.get_reference_count());
+
+        Object* p_object = p.detach();
+        CHECK(p_object == &object);
+        CHECK(!p);
+      }
+
+      CHECK_EQUAL(1, object.get_reference_count());
+      CHECK_EQUAL(0, object.released);
+
+      intrusive_ptr_release(&object);
+      CHECK_EQUAL(1, object.released);
+    }
+
+    //*************************************************************************
+    TEST(test_derived_and_comparisons)
+    {
+      DerivedObject object1(1);
+      Object        object2(2);
+
+      etl::intrusive_ptr<DerivedObject> pd(&object1);
+      Ptr p1(pd);
+      Ptr p2(&object2);
+
+      CHECK_EQUAL(2, object1.get_reference_count());
+      CHECK(p1 == pd);
+      CHECK(p1 != p2);
+      CHECK(p1 == &object1);
+      CHECK(&object2 == p2);
+      CHECK(p1 != &object2);
+      CHECK((p1 < p2) == (p1.get() < p2.get()));
+
+      swap(p1, p2);
+      CHECK(p1.get() == &object2);
+      CHECK(p2.get() == &object1);
+    }
+
+    //*************************************************************************
+    TEST(test_copied_object_does_not_copy_count)
+    {
+      Object object1(1);
+      Ptr p(&object1);
+
+      Object object2(object1);
+      CHECK_EQUAL(0, object2.get_reference_count());
+
+      object2 = object1;
+      CHECK_EQUAL(0, object2.get_reference_count());
+      CHECK_EQUAL(1, object1.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_atomic_counter_threads)
+    {
+      AtomicObject object;
+      etl::intrusive_ptr<AtomicObject> p(&object);
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.emplace_back([&p]()
+        {
+          for (int i = 0; i < 10000; ++i)
+          {
+            etl::intrusive_ptr<AtomicObject> copy(p);
+          }
+        });
+      }
+
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK_EQUAL(1, object.get_reference_count());
+      CHECK_EQUAL(0, object.released.load());
+
+      p.reset();
+      CHECK_EQUAL(1, object.released.load());
+    }
+
+    //*************************************************************************
+    TEST(test_biased_counter_owner)
+    {
+      BiasedObject object(1);
+      BiasedCounter& counter = static_cast<BiasedCounter&>(object.get_reference_counter());
+
+      counter.set_reference_count(1);
+      CHECK(counter.is_owner());
+      CHECK(!counter.is_shared());
+
+      counter.increment_reference_count();
+      counter.add_reference_count(2);
+      CHECK_EQUAL(4, counter.get_reference_count());
+      CHECK_EQUAL(3, counter.decrement_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_biased_counter_other_thread)
+    {
+      BiasedObject object(1);
+      BiasedCounter& counter = static_cast<BiasedCounter&>(object.get_reference_counter());
+
+      counter.set_reference_count(1);
+
+      bool is_owner = true;
+      std::thread thread([&]() { is_owner = counter.is_owner(); });
+      thread.join();
+
+      CHECK(!is_owner);
+      CHECK(counter.is_owner());
+    }
+
+    //*************************************************************************
+    TEST(test_biased_counter_shared)
+    {
+      BiasedObject object(1);
+      BiasedCounter& counter = static_cast<BiasedCounter&>(object.get_reference_counter());
+
+      counter.set_reference_count(1);
+      counter.add_reference_count(4);
+      counter.share();
+      CHECK(counter.is_shared());
+      CHECK_EQUAL(5, counter.get_reference_count());
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.emplace_back([&counter]()
+        {
+          for (int i = 0; i < 10000; ++i)
+          {
+            counter.increment_reference_count();
+          }
+
+          int32_t count = counter.decrement_reference_count();
+          (void)count;
+        });
+      }
+
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK_EQUAL(40001, counter.get_reference_count());
+
+      counter.set_reference_count(2);
+      CHECK(!counter.is_shared());
+      CHECK_EQUAL(2, counter.get_reference_count());
+    }
+  };
+}
@@ -0,0 +1,160 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include "etl/intrusive_queue_mpsc_atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::atomic_forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    int value;
+  };
+
+  typedef etl::intrusive_queue_mpsc_atomic<Data, link0> Queue;
+
+  SUITE(test_intrusive_queue_mpsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data[4];
+      Queue queue;
+
+      queue.push(data[0]);
+      queue.push(data[2]);
+      queue.push(data[1]);
+
+      CHECK(!queue.empty());
+
+      CHECK(queue.pop() == &data[0]);
+      CHECK(queue.pop() == &data[2]);
+
+      queue.push(data[3]);
+
+      CHECK(queue.pop() == &data[1]);
+      CHECK(queue.pop() == &data[3]);
+      CHECK(queue.pop() == nullptr);
+      CHECK(queue.empty());
+
+      // The objects may be pushed again.
+      queue.push(data[3]);
+      queue.push(data[0]);
+
+      CHECK(queue.pop() == &data[3]);
+      CHECK(queue.pop() == &data[0]);
+      CHECK(queue.pop() == nullptr);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      const int Producers = 4;
+      const int Count     = 20000; // Per producer.
+
+      std::vector<Data> data(Producers * Count);
+      Queue queue;
+
+      std::vector<std::thread> threads;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        threads.push_back(std::thread([&queue, &data, p, Count]()
+        {
+          for (int i = 0; i < Count; ++i)
+          {
+            Data& d = data[(p * Count) + i];
+            d.value = (p * Count) + i;
+            queue.push(d);
+          }
+        }));
+      }
+
+      int  popped = 0;
+      bool in_order = true;
+
+      int last[Producers];
+      std::fill(last, last + Producers, -1);
+
+      std::vector<bool> seen(Producers * Count, false);
+
+      while (popped < (Producers * Count))
+      {
+        Data* d = queue.pop();
+
+        if (d != nullptr)
+        {
+          ++popped;
+
+          // The values from each producer arrive in order.
+          int producer = d->value / Count;
+          in_order = in_order && (d->value > last[producer]);
+          last[producer] = d->value;
+
+          seen[d->value] = true;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(in_order);
+      CHECK(std::find(seen.begin(), seen.end(), false) == seen.end());
+      CHECK(queue.pop() == nullptr);
+      CHECK(queue.empty());
+    }
+  }
+}
+
+#endif
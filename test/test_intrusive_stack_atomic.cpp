@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#include "etl/intrusive_stack_atomic.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::atomic_forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    int value;
+  };
+
+  typedef etl::intrusive_stack_atomic<Data, link0> Stack;
+
+  SUITE(test_intrusive_stack_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Data data[4];
+      Stack stack(data, 4);
+
+      CHECK(stack.empty());
+      CHECK_EQUAL(4U, stack.max_size());
+      CHECK(stack.pop() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data[4];
+      Stack stack(data, 4);
+
+      stack.push(data[0]);
+      stack.push(data[2]);
+      stack.push(data[1]);
+
+      CHECK(!stack.empty());
+
+      CHECK(stack.pop() == &data[1]);
+      CHECK(stack.pop() == &data[2]);
+
+      stack.push(data[3]);
+
+      CHECK(stack.pop() == &data[3]);
+      CHECK(stack.pop() == &data[0]);
+      CHECK(stack.pop() == nullptr);
+      CHECK(stack.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_not_in_buffer)
+    {
+      Data data[4];
+      Data other;
+      Stack stack(data, 4);
+
+      CHECK(!stack.is_in_buffer(&other));
+      CHECK_THROW(stack.push(other), etl::intrusive_stack_atomic_not_in_buffer);
+      CHECK(stack.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads)
+    {
+      const int Threads = 4;
+      const int Count   = 20000; // Per thread.
+      const int Size    = 64;
+
+      Data data[Size];
+      Stack stack(data, Size);
+
+      for (int i = 0; i < Size; ++i)
+      {
+        data[i].value = 0;
+        stack.push(data[i]);
+      }
+
+      std::atomic<bool> ok(true);
+      std::vector<std::thread> threads;
+
+      // Each thread takes objects, marks them as its own, and puts them back.
+      // An object given to two threads at once is caught by the mark.
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&stack, &ok, t, Count]()
+        {
+          Data* taken[4];
+
+          for (int i = 0; i < Count; ++i)
+          {
+            int n = 0;
+
+            while (n < 4)
+            {
+              Data* p = stack.pop();
+
+              if (p == nullptr)
+              {
+                break;
+              }
+
+              if (p->value != 0)
+              {
+                ok = false;
+              }
+
+              p->value = t + 1;
+              taken[n++] = p;
+            }
+
+            while (n != 0)
+            {
+              Data* p = taken[--n];
+
+              if (p->value != (t + 1))
+              {
+                ok = false;
+              }
+
+              p->value = 0;
+              stack.push(*p);
+            }
+          }
+        }));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(ok.load());
+
+      // Every object is back on the stack, once.
+      std::vector<Data*> popped;
+
+      Data* p;
+
+      while ((p = stack.pop()) != nullptr)
+      {
+        popped.push_back(p);
+      }
+
+      std::sort(popped.begin(), popped.end());
+
+      CHECK_EQUAL(size_t(Size), popped.size());
+      CHECK(std::unique(popped.begin(), popped.end()) == popped.end());
+    }
+  }
+}
+
+#endif
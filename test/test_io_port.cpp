@@ -202,6 +202,81 @@ namespace
 
       CHECK_EQUAL(compare[0], iop_wos);
     }
+
+    //*************************************************************************
+    TEST(test_dynamic_io_port_bulk_read_write)
+    {
+      uint8_t memory_rw  = 0x12;
+      uint8_t memory_ro  = 0x34;
+      uint8_t memory_wo  = 0x00;
+      uint8_t memory_wos = 0x00;
+
+      etl::io_port_rw<uint8_t>  port_rw(&memory_rw);
+      etl::io_port_ro<uint8_t>  port_ro(&memory_ro);
+      etl::io_port_wo<uint8_t>  port_wo(&memory_wo);
+      etl::io_port_wos<uint8_t> port_wos(&memory_wos);
+
+      // Seven is not a multiple of the unrolling, so the remainder is used.
+      const uint8_t source[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      uint8_t       buffer[8];
+
+      // Read from RW IOP. The element after the count is left alone.
+      std::fill_n(buffer, 8, 0xFF);
+      port_rw.read(buffer, 7U);
+
+      for (size_t i = 0; i < 7U; ++i)
+      {
+        CHECK_EQUAL(0x12, buffer[i]);
+      }
+
+      CHECK_EQUAL(0xFF, buffer[7]);
+
+      // Read from RO IOP.
+      std::fill_n(buffer, 8, 0xFF);
+      port_ro.read(buffer, 7U);
+
+      for (size_t i = 0; i < 7U; ++i)
+      {
+        CHECK_EQUAL(0x34, buffer[i]);
+      }
+
+      CHECK_EQUAL(0xFF, buffer[7]);
+
+      // Write to RW, WO and WOS IOPs. The port is left with the last value.
+      port_rw.write(source, 7U);
+      CHECK_EQUAL(7, memory_rw);
+
+      port_wo.write(source, 7U);
+      CHECK_EQUAL(7, memory_wo);
+
+      port_wos.write(source, 7U);
+      CHECK_EQUAL(7, memory_wos);
+      CHECK_EQUAL(7, port_wos.read());
+
+      // Whole multiples of the unrolling.
+      port_wo.write(source, 8U);
+      CHECK_EQUAL(8, memory_wo);
+
+      port_wos.write(source, 4U);
+      CHECK_EQUAL(4, memory_wos);
+      CHECK_EQUAL(4, port_wos.read());
+
+      // A count of zero transfers nothing.
+      std::fill_n(buffer, 8, 0xFF);
+      port_rw.read(buffer, 0U);
+      port_ro.read(buffer, 0U);
+      CHECK_EQUAL(0xFF, buffer[0]);
+
+      port_rw.write(source, 0U);
+      CHECK_EQUAL(7, memory_rw);
+
+      port_wo.write(source, 0U);
+      CHECK_EQUAL(8, memory_wo);
+
+      port_wos.write(source, 0U);
+      CHECK_EQUAL(4, memory_wos);
+      CHECK_EQUAL(4, port_wos.read());
+    }
     
     TEST(compile)
     {
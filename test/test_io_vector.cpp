@@ -0,0 +1,163 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/io_vector.h"
+#include "etl/buffer_descriptors.h"
+#include "etl/crc32.h"
+#include "etl/checksum.h"
+
+#include <vector>
+
+namespace
+{
+  const uint8_t header[]  = { 0x7E, 0x01, 0x02 };
+  const uint8_t payload[] = { 'H', 'e', 'l', 'l', 'o' };
+  const uint8_t trailer[] = { 0x7F };
+
+  SUITE(test_io_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::io_vector<3> iov;
+
+      CHECK(iov.empty());
+      CHECK(!iov.full());
+      CHECK_EQUAL(0U, iov.size());
+      CHECK_EQUAL(3U, iov.max_size());
+      CHECK_EQUAL(0U, iov.size_bytes());
+      CHECK(iov.begin() == iov.end());
+    }
+
+    //*************************************************************************
+    TEST(test_append_chained)
+    {
+      etl::io_vector<3> iov;
+
+      iov.append(etl::span<const uint8_t>(header))
+         .append(payload, sizeof(payload))
+         .append(etl::span<const uint8_t>(trailer));
+
+      CHECK(iov.full());
+      CHECK_EQUAL(3U, iov.size());
+      CHECK_EQUAL(9U, iov.size_bytes());
+      CHECK(iov[0].data() == header);
+      CHECK(iov[1].data() == payload);
+      CHECK(iov[2].data() == trailer);
+
+      size_t total = 0U;
+
+      for (etl::io_vector<3>::const_iterator itr = iov.begin(); itr != iov.end(); ++itr)
+      {
+        total += itr->size();
+      }
+
+      CHECK_EQUAL(9U, total);
+
+      iov.clear();
+      CHECK(iov.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_append_full)
+    {
+      etl::io_vector<1> iov;
+
+      iov.push_back(etl::span<const uint8_t>(header));
+      CHECK_THROW(iov.push_back(etl::span<const uint8_t>(payload)), etl::io_vector_full);
+      CHECK_EQUAL(1U, iov.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_to)
+    {
+      etl::io_vector<3> iov;
+      iov.append(header, sizeof(header)).append(payload, sizeof(payload)).append(trailer, sizeof(trailer));
+
+      std::vector<uint8_t> expected;
+      expected.insert(expected.end(), header, header + sizeof(header));
+      expected.insert(expected.end(), payload, payload + sizeof(payload));
+      expected.insert(expected.end(), trailer, trailer + sizeof(trailer));
+
+      uint8_t buffer[16] = { 0 };
+      CHECK_EQUAL(9U, iov.copy_to(etl::span<uint8_t>(buffer)));
+      CHECK_ARRAY_EQUAL(expected.data(), buffer, 9U);
+
+      // Truncated.
+      uint8_t small[5] = { 0 };
+      CHECK_EQUAL(5U, iov.copy_to(small, sizeof(small)));
+      CHECK_ARRAY_EQUAL(expected.data(), small, 5U);
+    }
+
+    //*************************************************************************
+    TEST(test_append_descriptor)
+    {
+      typedef etl::buffer_descriptors<uint8_t, 8U, 2U> BD;
+
+      static uint8_t buffers[2][8];
+
+      BD bd(&buffers[0][0]);
+
+      BD::descriptor desc = bd.allocate();
+      memcpy(desc.data(), payload, sizeof(payload));
+
+      etl::io_vector<2> iov;
+      iov.append(header, sizeof(header)).append(desc, sizeof(payload));
+
+      CHECK(iov[1].data() == desc.data());
+      CHECK_EQUAL(sizeof(payload), iov[1].size());
+
+      CHECK_THROW(iov.clear(); iov.append(desc, 9U), etl::io_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_frame_check_sequence)
+    {
+      etl::io_vector<3> iov;
+      iov.append(header, sizeof(header)).append(payload, sizeof(payload)).append(trailer, sizeof(trailer));
+
+      uint8_t flat[9];
+      iov.copy_to(flat, sizeof(flat));
+
+      etl::crc32 crc_iov;
+      crc_iov.add(iov);
+
+      etl::crc32 crc_flat(flat, flat + sizeof(flat));
+      CHECK_EQUAL(crc_flat.value(), crc_iov.value());
+
+      etl::checksum<uint16_t> sum_iov;
+      sum_iov.add(iov);
+
+      etl::checksum<uint16_t> sum_flat(flat, flat + sizeof(flat));
+      CHECK_EQUAL(sum_flat.value(), sum_iov.value());
+    }
+  };
+}
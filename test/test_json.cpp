@@ -0,0 +1,322 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/json.h"
+#include "etl/to_arithmetic.h"
+
+#include <string>
+#include <limits>
+
+namespace
+{
+  //***********************************
+  std::string to_std(const etl::istring& text)
+  {
+    return std::string(text.data(), text.size());
+  }
+
+  //***********************************
+  // Tokenizes the text, returning one character per token.
+  std::string token_types(const char* json)
+  {
+    etl::json_tokenizer tokenizer(json);
+    std::string         types;
+
+    while (true)
+    {
+      const etl::json_token token = tokenizer.next();
+
+      switch (token.type)
+      {
+        case etl::json_token::Begin_Object: types += '{'; break;
+        case etl::json_token::End_Object:   types += '}'; break;
+        case etl::json_token::Begin_Array:  types += '['; break;
+        case etl::json_token::End_Array:    types += ']'; break;
+        case etl::json_token::Key:          types += 'k'; break;
+        case etl::json_token::String:       types += 's'; break;
+        case etl::json_token::Number:       types += 'n'; break;
+        case etl::json_token::True:         types += 't'; break;
+        case etl::json_token::False:        types += 'f'; break;
+        case etl::json_token::Null:         types += '0'; break;
+        case etl::json_token::End:          return types;
+        default:                            return types + '!';
+      }
+    }
+  }
+
+  SUITE(test_json)
+  {
+    //*************************************************************************
+    TEST(test_writer_object)
+    {
+      etl::string<256> text;
+      etl::json_writer writer(text);
+
+      writer.begin_object()
+              .member("id", 42)
+              .member("name", "sensor \"A\"")
+              .member("ok", true)
+              .key("values").begin_array().value(1.5).value(-0.25).value(1e21).null().end_array()
+              .key("nested").begin_object().end_object()
+              .member("big", std::numeric_limits<int64_t>::min())
+            .end_object();
+
+      CHECK(writer.is_complete());
+      CHECK(!writer.has_error());
+      CHECK_EQUAL("{\"id\":42,\"name\":\"sensor \\\"A\\\"\",\"ok\":true,\"values\":[1.5,-0.25,1e+21,null],\"nested\":{},\"big\":-9223372036854775808}",
+                  to_std(writer.str()));
+    }
+
+    //*************************************************************************
+    TEST(test_writer_values)
+    {
+      etl::string<64> text;
+      etl::json_writer writer(text);
+
+      writer.value("tab\there\nline\x01\\/");
+      CHECK_EQUAL("\"tab\\there\\nline\\u0001\\\\/\"", to_std(text));
+
+      writer.restart();
+      writer.begin_array().value(0.1f).value(std::numeric_limits<double>::quiet_NaN()).value(uint8_t(255)).value(false).end_array();
+      CHECK_EQUAL("[0.1,null,255,false]", to_std(text));
+
+      writer.restart();
+      writer.begin_array().raw_value("{\"pre\":1}").begin_array().end_array().end_array();
+      CHECK_EQUAL("[{\"pre\":1},[]]", to_std(text));
+      CHECK(writer.is_complete());
+    }
+
+    //*************************************************************************
+    TEST(test_writer_errors)
+    {
+      etl::string<64> text;
+      etl::json_writer writer(text);
+
+      // A value in an object without a key.
+      writer.begin_object().value(1);
+      CHECK(writer.has_error());
+
+      // A key in an array.
+      writer.restart();
+      writer.begin_array().key("a");
+      CHECK(writer.has_error());
+
+      // Mismatched close.
+      writer.restart();
+      writer.begin_array().end_object();
+      CHECK(writer.has_error());
+
+      // A key without a value.
+      writer.restart();
+      writer.begin_object().key("a").end_object();
+      CHECK(writer.has_error());
+
+      // Two top level values.
+      writer.restart();
+      writer.value(1).value(2);
+      CHECK(writer.has_error());
+
+      // Incomplete.
+      writer.restart();
+      writer.begin_array();
+      CHECK(!writer.has_error());
+      CHECK(!writer.is_complete());
+
+      // Too deep.
+      writer.restart();
+
+      for (size_t i = 0U; i <= etl::json_writer::Max_Depth; ++i)
+      {
+        writer.begin_array();
+      }
+
+      CHECK(writer.has_error());
+    }
+
+    //*************************************************************************
+    TEST(test_writer_overflow)
+    {
+      etl::string<17> text;
+      etl::json_writer writer(text);
+
+      writer.begin_object().member("temperature", 21);
+      CHECK(!writer.has_error());
+      CHECK_EQUAL("{\"temperature\":21", to_std(text));
+
+      writer.end_object();
+      CHECK(writer.has_error());
+      CHECK(!writer.is_complete());
+
+      // An escape that does not fit is not partly written.
+      writer.restart();
+      writer.value("123456789012345\n");
+      CHECK(writer.has_error());
+      CHECK_EQUAL("\"123456789012345", to_std(text));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer)
+    {
+      const char* json = " { \"id\" : 42, \"name\":\"a\\\"b\", \"list\" : [ 1.5e3, -0, true, false, null, {} ], \"e\":[] } ";
+
+      etl::json_tokenizer tokenizer(json);
+      etl::json_token     token;
+
+      token = tokenizer.next();
+      CHECK_EQUAL(etl::json_token::Begin_Object, token.type);
+
+      token = tokenizer.next();
+      CHECK_EQUAL(etl::json_token::Key, token.type);
+      CHECK(token.text == "id");
+      CHECK(!token.has_escapes);
+
+      token = tokenizer.next();
+      CHECK_EQUAL(etl::json_token::Number, token.type);
+      CHECK_EQUAL(42, etl::to_arithmetic<int>(token.text).value());
+
+      token = tokenizer.next();
+      CHECK(token.text == "name");
+
+      token = tokenizer.next();
+      CHECK_EQUAL(etl::json_token::String, token.type);
+      CHECK(token.text == "a\\\"b");
+      CHECK(token.has_escapes);
+
+      etl::string<8> unescaped;
+      CHECK(etl::json_unescape(token.text, unescaped));
+      CHECK_EQUAL("a\"b", to_std(unescaped));
+
+      token = tokenizer.next();
+      CHECK(token.text == "list");
+
+      token = tokenizer.next();
+      CHECK_EQUAL(etl::json_token::Begin_Array, token.type);
+      CHECK_EQUAL(2U, tokenizer.get_depth());
+
+      token = tokenizer.next();
+      CHECK(token.text == "1.5e3");
+      CHECK_CLOSE(1500.0, etl::to_arithmetic<double>(token.text).value(), 0.0);
+
+      CHECK_EQUAL("{knksk[nntf0{}]k[]}", token_types(json));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer_valid)
+    {
+      CHECK_EQUAL("n",            token_types("0"));
+      CHECK_EQUAL("n",            token_types("-12.5E-3"));
+      CHECK_EQUAL("s",            token_types("\"\\u00e9\\/\""));
+      CHECK_EQUAL("[[[]]]",       token_types("[[[]]]"));
+      CHECK_EQUAL("[n[n]{kn}]",   token_types("[1,[2],{\"a\":3}]"));
+      CHECK_EQUAL("{k{k[]}}",     token_types("{\"a\":{\"b\":[]}}"));
+      CHECK_EQUAL("t",            token_types("\ttrue\r\n"));
+    }
+
+    //*************************************************************************
+    TEST(test_tokenizer_invalid)
+    {
+      CHECK_EQUAL("!",     token_types(""));
+      CHECK_EQUAL("n!",    token_types("01"));
+      CHECK_EQUAL("!",     token_types("1."));
+      CHECK_EQUAL("!",     token_types("-"));
+      CHECK_EQUAL("!",     token_types("1e"));
+      CHECK_EQUAL("!",     token_types("+1"));
+      CHECK_EQUAL("!",     token_types("tru"));
+      CHECK_EQUAL("!",     token_types("\"abc"));
+      CHECK_EQUAL("!",     token_types("\"a\nb\""));
+      CHECK_EQUAL("!",     token_types("\"\\x\""));
+      CHECK_EQUAL("!",     token_types("\"\\u12g4\""));
+      CHECK_EQUAL("[n!",   token_types("[1,]"));
+      CHECK_EQUAL("[n!",   token_types("[1 2]"));
+      CHECK_EQUAL("[!",    token_types("[}"));
+      CHECK_EQUAL("{!",    token_types("{1:2}"));
+      CHECK_EQUAL("{k!",   token_types("{\"a\" 2}"));
+      CHECK_EQUAL("{kn!",  token_types("{\"a\":2,}"));
+      CHECK_EQUAL("{kn!",  token_types("{\"a\":2"));
+      CHECK_EQUAL("n!",    token_types("1 2"));
+      CHECK_EQUAL("[]!",   token_types("[]]"));
+
+      std::string deep(etl::json_tokenizer::Max_Depth + 1U, '[');
+      CHECK_EQUAL(std::string(etl::json_tokenizer::Max_Depth, '[') + '!', token_types(deep.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_unescape)
+    {
+      etl::string<32> text;
+
+      CHECK(etl::json_unescape("a\\tb\\n\\\\\\/\\u0041", text));
+      CHECK_EQUAL("a\tb\n\\/A", to_std(text));
+
+      text.clear();
+      CHECK(etl::json_unescape("\\u00e9\\u20ac\\ud83d\\ude00", text));
+      CHECK_EQUAL("\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80", to_std(text));
+
+      text.clear();
+      CHECK(!etl::json_unescape("\\ud83d", text));
+      CHECK(!etl::json_unescape("\\ude00", text));
+      CHECK(!etl::json_unescape("\\q", text));
+      CHECK(!etl::json_unescape("\\", text));
+
+      etl::string<2> small;
+      CHECK(!etl::json_unescape("abc", small));
+      small.clear();
+      CHECK(!etl::json_unescape("a\\u00e9", small));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      etl::string<128> text;
+      etl::json_writer writer(text);
+
+      writer.begin_object()
+              .member("text", "line\n\"quoted\" \xc3\xa9")
+              .member("pi", 3.141592653589793)
+            .end_object();
+
+      etl::json_tokenizer tokenizer(etl::string_view(text.data(), text.size()));
+
+      CHECK_EQUAL(etl::json_token::Begin_Object, tokenizer.next().type);
+      CHECK(tokenizer.next().text == "text");
+
+      etl::json_token token = tokenizer.next();
+      etl::string<32> unescaped;
+      CHECK(etl::json_unescape(token.text, unescaped));
+      CHECK_EQUAL("line\n\"quoted\" \xc3\xa9", to_std(unescaped));
+
+      CHECK(tokenizer.next().text == "pi");
+      CHECK_EQUAL(3.141592653589793, etl::to_arithmetic<double>(tokenizer.next().text).value());
+      CHECK_EQUAL(etl::json_token::End_Object, tokenizer.next().type);
+      CHECK_EQUAL(etl::json_token::End, tokenizer.next().type);
+    }
+  };
+}
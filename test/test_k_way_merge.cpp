@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/k_way_merge.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+
+#include "data.h"
+
+namespace
+{
+  typedef TestDataNDC<int> NDC;
+
+  SUITE(test_k_way_merge)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::k_way_merger<const int*, 4> merger;
+
+      CHECK(merger.empty());
+      CHECK_EQUAL(0U, merger.size());
+
+      const int data[] = { 1 };
+      merger.add_run(data, data);
+      merger.add_run(data, data);
+
+      CHECK(merger.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_single_run)
+    {
+      const int data[] = { 1, 2, 3, 5, 8 };
+
+      etl::k_way_merger<const int*, 1> merger;
+      merger.add_run(std::begin(data), std::end(data));
+
+      std::vector<int> result;
+      merger.merge(std::back_inserter(result));
+
+      CHECK(std::equal(std::begin(data), std::end(data), result.begin()));
+      CHECK(merger.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_merge_against_sort)
+    {
+      std::mt19937 generator(1);
+
+      for (size_t n_runs = 1; n_runs <= 16; ++n_runs)
+      {
+        std::vector<std::vector<NDC>> runs(n_runs);
+        std::vector<NDC> expected;
+
+        for (size_t run = 0; run < n_runs; ++run)
+        {
+          const size_t length = generator() % 50;
+
+          for (size_t i = 0; i < length; ++i)
+          {
+            runs[run].push_back(NDC(int(generator() % 100), int(run)));
+          }
+
+          std::sort(runs[run].begin(), runs[run].end());
+          expected.insert(expected.end(), runs[run].begin(), runs[run].end());
+        }
+
+        // Equal values are taken from the runs in order.
+        std::stable_sort(expected.begin(), expected.end());
+
+        std::vector<std::pair<std::vector<NDC>::const_iterator, std::vector<NDC>::const_iterator>> ranges;
+
+        for (size_t run = 0; run < n_runs; ++run)
+        {
+          ranges.push_back(std::make_pair(runs[run].cbegin(), runs[run].cend()));
+        }
+
+        std::vector<NDC> result;
+        etl::k_way_merge<16>(ranges.begin(), ranges.end(), std::back_inserter(result));
+
+        CHECK_EQUAL(expected.size(), result.size());
+        CHECK(std::equal(expected.begin(), expected.end(), result.begin(), NDC::are_identical));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_compare)
+    {
+      const int data1[] = { 9, 6, 3 };
+      const int data2[] = { 8, 5, 2 };
+      const int data3[] = { 7, 4, 1 };
+
+      std::pair<const int*, const int*> ranges[] = { std::make_pair(std::begin(data1), std::end(data1)),
+                                                     std::make_pair(std::begin(data2), std::end(data2)),
+                                                     std::make_pair(std::begin(data3), std::end(data3)) };
+
+      int result[9];
+      int* end = etl::k_way_merge<3>(std::begin(ranges), std::end(ranges), result, std::greater<int>());
+
+      const int expected[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+      CHECK(end == std::end(result));
+      CHECK(std::equal(std::begin(expected), std::end(expected), result));
+    }
+
+    //*************************************************************************
+    TEST(test_top_pop_and_refill)
+    {
+      // Streams that deliver their data in blocks.
+      const int stream0_block1[] = { 1, 4, 7 };
+      const int stream0_block2[] = { 10, 13 };
+      const int stream1_block1[] = { 2, 5, 8, 11 };
+      const int stream2_block1[] = { 3, 6 };
+      const int stream2_block2[] = { 9, 12 };
+
+      etl::k_way_merger<const int*, 3> merger;
+      merger.add_run(std::begin(stream0_block1), std::end(stream0_block1));
+      merger.add_run(std::begin(stream1_block1), std::end(stream1_block1));
+      merger.add_run(std::begin(stream2_block1), std::end(stream2_block1));
+
+      std::vector<int> result;
+
+      // Take values until a stream runs dry, then give it its next block.
+      while (!merger.empty())
+      {
+        const size_t run = merger.top_run();
+
+        result.push_back(merger.top());
+        merger.pop();
+
+        if (merger.exhausted(run))
+        {
+          if ((run == 0) && (result.back() == 7))
+          {
+            merger.refill(0, std::begin(stream0_block2), std::end(stream0_block2));
+          }
+          else if ((run == 2) && (result.back() == 6))
+          {
+            merger.refill(2, std::begin(stream2_block2), std::end(stream2_block2));
+          }
+        }
+      }
+
+      std::vector<int> expected = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      const int data[] = { 1, 2 };
+
+      etl::k_way_merger<const int*, 2> merger;
+      merger.add_run(std::begin(data), std::end(data));
+      merger.add_run(std::begin(data), std::end(data));
+
+      CHECK_THROW(merger.add_run(std::begin(data), std::end(data)), etl::k_way_merge_full);
+      CHECK_EQUAL(2U, merger.size());
+
+      merger.clear();
+      CHECK_EQUAL(0U, merger.size());
+      CHECK(merger.empty());
+    }
+  }
+}
@@ -2027,5 +2027,164 @@ namespace
       CHECK_EQUAL(3U, (*itr++).value); // 3
       CHECK_EQUAL(4U, (*itr++).value); // 4
     }
+
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::list<int, 64> List;
+
+      List data;
+      std::list<int> compare;
+
+      // Churn the list so that its nodes are scattered around the pool.
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const size_t r = (seed >> 16) % 64U;
+
+        if (!data.empty() && ((r & 1U) != 0U || data.full()))
+        {
+          List::iterator itr = data.begin();
+          std::list<int>::iterator citr = compare.begin();
+          std::advance(itr, r % data.size());
+          std::advance(citr, r % compare.size());
+          data.erase(itr);
+          compare.erase(citr);
+        }
+        else
+        {
+          List::iterator itr = data.begin();
+          std::list<int>::iterator citr = compare.begin();
+          std::advance(itr, r % (data.size() + 1));
+          std::advance(citr, r % (compare.size() + 1));
+          data.insert(itr, i);
+          compare.insert(citr, i);
+        }
+      }
+
+      CHECK(data.size() > 2U);
+
+      const size_t size = data.size();
+      data.compact();
+
+      CHECK_EQUAL(size, data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+      List::const_iterator itr  = data.begin();
+      List::const_iterator next = itr;
+
+      while (++next != data.end())
+      {
+        CHECK(&*itr < &*next);
+        itr = next;
+      }
+
+      // Still usable.
+      data.push_front(-1);
+      compare.push_front(-1);
+      data.pop_back();
+      compare.pop_back();
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_compact_move_only)
+    {
+      DataM data;
+
+      data.push_back(ItemM(1U));
+      data.push_back(ItemM(2U));
+      data.push_back(ItemM(3U));
+      data.push_back(ItemM(4U));
+      data.pop_front();
+      data.push_back(ItemM(5U));
+      data.pop_front();
+      data.push_back(ItemM(6U));
+      data.reverse();
+
+      data.compact();
+
+      DataM::const_iterator itr = data.begin();
+
+      CHECK_EQUAL(6U, (*itr++).value);
+      CHECK_EQUAL(5U, (*itr++).value);
+      CHECK_EQUAL(4U, (*itr++).value);
+      CHECK_EQUAL(3U, (*itr++).value);
+      CHECK(itr == data.end());
+
+      itr = data.begin();
+      DataM::const_iterator next = itr;
+
+      while (++next != data.end())
+      {
+        CHECK(&*itr < &*next);
+        itr = next;
+      }
+    }
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_extract_and_insert_node)
+    {
+      DataNDC data(sorted_data.begin(), sorted_data.begin() + 4);
+
+      const ItemNDC* p_item = &*std::next(data.begin());
+
+      DataNDC::node_type node = data.extract(std::next(data.begin()));
+
+      CHECK(bool(node));
+      CHECK_EQUAL(ItemNDC("1"), node.value());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(7U, data.available() + 1U);
+
+      // Back into the same list, so the node is relinked.
+      DataNDC::iterator itr = data.insert(data.end(), std::move(node));
+
+      CHECK(node.empty());
+      CHECK(p_item == &*itr);
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(ItemNDC("1"), data.back());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_node_from_another_list)
+    {
+      DataNDC  data0(sorted_data.begin(), sorted_data.begin() + 4);
+      DataNDC2 data1;
+
+      DataNDC::node_type node = data0.extract(data0.begin());
+
+      // Different pool, so the value is moved into a new node.
+      data1.insert(data1.begin(), std::move(node));
+
+      CHECK(node.empty());
+      CHECK_EQUAL(3U, data0.size());
+      CHECK_EQUAL(7U, data0.available());
+      CHECK_EQUAL(1U, data1.size());
+      CHECK_EQUAL(ItemNDC("0"), data1.front());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_node_handle_destroys_unclaimed_node)
+    {
+      int current_count = ItemNDC::get_instance_count();
+
+      DataNDC data(sorted_data.begin(), sorted_data.begin() + 4);
+
+      {
+        DataNDC::node_type node = data.extract(data.begin());
+        CHECK_EQUAL(int(current_count + 4), ItemNDC::get_instance_count());
+        CHECK_EQUAL(3U, data.size());
+      }
+
+      CHECK_EQUAL(int(current_count + 3), ItemNDC::get_instance_count());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(7U, data.available());
+
+      data.clear();
+      CHECK_EQUAL(current_count, ItemNDC::get_instance_count());
+    }
   };
 }
@@ -2167,5 +2167,136 @@ namespace
 
       CHECK_THROW(data0.merge(data1), etl::list_unsorted);
     }
+
+
+    //*************************************************************************
+    TEST(test_compact_shared_pool)
+    {
+      typedef etl::list_ext<int>                List;
+      typedef etl::pool<List::pool_type, 32>    IntPool;
+
+      IntPool pool;
+      List data0(pool);
+      List data1(pool);
+      std::list<int> compare0;
+      std::list<int> compare1;
+
+      // Interleave two lists in the pool, in reverse order.
+      for (int i = 0; i < 16; ++i)
+      {
+        data0.push_front(i);
+        compare0.push_front(i);
+        data1.push_front(100 + i);
+        compare1.push_front(100 + i);
+      }
+
+      data0.erase(std::next(data0.begin(), 3));
+      compare0.erase(std::next(compare0.begin(), 3));
+      data0.push_back(50);
+      compare0.push_back(50);
+
+      data0.compact();
+
+      CHECK_EQUAL(compare0.size(), data0.size());
+      CHECK(std::equal(data0.begin(), data0.end(), compare0.begin()));
+      CHECK(std::equal(data0.rbegin(), data0.rend(), compare0.rbegin()));
+      CHECK(std::equal(data1.begin(), data1.end(), compare1.begin()));
+
+      List::const_iterator itr  = data0.begin();
+      List::const_iterator next = itr;
+
+      while (++next != data0.end())
+      {
+        CHECK(&*itr < &*next);
+        itr = next;
+      }
+
+      CHECK_EQUAL(compare0.size() + compare1.size(), pool.size());
+    }
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_splice_relinks_nodes)
+    {
+      Pool pool;
+      DataNDC data0(sorted_data.begin(), sorted_data.begin() + 3, pool);
+      DataNDC data1(sorted_data.begin() + 3, sorted_data.end(), pool);
+
+      const ItemNDC* p_item = &*data1.begin();
+
+      data0.splice(data0.end(), data1, data1.begin());
+
+      CHECK_EQUAL(4U, data0.size());
+      CHECK_EQUAL(1U, data1.size());
+      CHECK_EQUAL(5U, pool.size());
+      CHECK(p_item == &data0.back());
+
+      data0.splice(data0.begin(), data1);
+
+      CHECK_EQUAL(5U, data0.size());
+      CHECK(data1.empty());
+      CHECK_EQUAL(5U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_merge_relinks_nodes)
+    {
+      Pool4 pool;
+      DataNDC data0(merge_data0.begin(), merge_data0.end(), pool);
+      DataNDC data1(merge_data1.begin(), merge_data1.end(), pool);
+
+      std::vector<const ItemNDC*> addresses;
+
+      for (DataNDC::const_iterator itr = data0.begin(); itr != data0.end(); ++itr)
+      {
+        addresses.push_back(&*itr);
+      }
+
+      for (DataNDC::const_iterator itr = data1.begin(); itr != data1.end(); ++itr)
+      {
+        addresses.push_back(&*itr);
+      }
+
+      CompareData compare0(merge_data0.begin(), merge_data0.end());
+      CompareData compare1(merge_data1.begin(), merge_data1.end());
+
+      data0.merge(data1);
+      compare0.merge(compare1);
+
+      CHECK_EQUAL(compare0.size(), data0.size());
+      CHECK(data1.empty());
+      CHECK(std::equal(data0.begin(), data0.end(), compare0.begin()));
+      CHECK(std::equal(data0.rbegin(), data0.rend(), compare0.rbegin()));
+
+      // Every element is still in the node it started in.
+      for (DataNDC::const_iterator itr = data0.begin(); itr != data0.end(); ++itr)
+      {
+        CHECK(std::find(addresses.begin(), addresses.end(), &*itr) != addresses.end());
+      }
+
+      CHECK_EQUAL(compare0.size(), pool.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_extract_insert_node_between_lists)
+    {
+      Pool pool;
+      DataNDC data0(sorted_data.begin(), sorted_data.begin() + 3, pool);
+      DataNDC data1(pool);
+
+      const ItemNDC* p_item = &*std::next(data0.begin());
+
+      DataNDC::node_type node = data0.extract(std::next(data0.begin()));
+
+      CHECK(!node.empty());
+      CHECK_EQUAL(ItemNDC("1"), node.value());
+      CHECK_EQUAL(2U, data0.size());
+      CHECK_EQUAL(3U, pool.size());
+
+      DataNDC::iterator itr = data1.insert(data1.end(), std::move(node));
+
+      CHECK(node.empty());
+      CHECK(p_item == &*itr);
+      CHECK_EQUAL(1U, data1.size());
+      CHECK_EQUAL(3U, pool.size());
+    }
   };
 }
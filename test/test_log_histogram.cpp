@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/log_histogram.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //*********************************
+  // Latency like values: mostly small, with a long tail.
+  std::vector<uint32_t> make_latencies(size_t size, uint32_t seed)
+  {
+    std::vector<uint32_t> values(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      const uint32_t r = seed >> 8;
+      values[i] = (r % 1000U) << ((r >> 10) % 12U);
+    }
+
+    return values;
+  }
+
+  //*********************************
+  uint32_t true_quantile(std::vector<uint32_t> values, double q)
+  {
+    std::sort(values.begin(), values.end());
+
+    size_t rank = size_t(q * double(values.size()));
+
+    if ((rank == 0U) || (double(rank) < (q * double(values.size()))))
+    {
+      ++rank;
+    }
+
+    return values[std::min(rank, values.size()) - 1U];
+  }
+
+  SUITE(test_log_histogram)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::log_histogram<uint32_t, uint32_t, 5U> histogram;
+
+      CHECK(histogram.empty());
+      CHECK_EQUAL(0U, histogram.count());
+      CHECK_EQUAL(0U, histogram.value_at_quantile(0.5));
+      CHECK_EQUAL(0U, histogram.min());
+      CHECK_EQUAL(0U, histogram.max());
+      CHECK_EQUAL(896U, histogram.size());
+      CHECK_EQUAL(896U, (etl::log_histogram<uint32_t, uint32_t, 5U>::Max_Size));
+    }
+
+    //*************************************************************************
+    TEST(test_buckets_cover_every_value)
+    {
+      typedef etl::log_histogram<uint16_t, uint32_t, 3U> histogram_t;
+
+      // Each value falls in the bucket whose bounds hold it, to within 1/8.
+      for (uint32_t value = 0U; value <= 0xFFFFU; ++value)
+      {
+        const size_t index = histogram_t::bucket_index(uint16_t(value));
+
+        CHECK(index < histogram_t::Max_Size);
+        CHECK(histogram_t::bucket_lowest(index) <= value);
+        CHECK(histogram_t::bucket_highest(index) >= value);
+        CHECK((histogram_t::bucket_highest(index) - histogram_t::bucket_lowest(index)) * 8U <= value);
+      }
+
+      // The buckets are contiguous, and the last ends at the largest value.
+      for (size_t i = 1U; i < histogram_t::Max_Size; ++i)
+      {
+        CHECK_EQUAL(histogram_t::bucket_highest(i - 1U) + 1U, size_t(histogram_t::bucket_lowest(i)));
+      }
+
+      CHECK_EQUAL(0xFFFFU, histogram_t::bucket_highest(histogram_t::Max_Size - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_buckets_64_bit)
+    {
+      typedef etl::log_histogram<uint64_t, uint32_t, 7U> histogram_t;
+
+      const uint64_t values[] = { 0U, 1U, 255U, 256U, 257U, 1000000U, 0x123456789ABCULL, 0xFFFFFFFFFFFFFFFFULL };
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(values); ++i)
+      {
+        const size_t index = histogram_t::bucket_index(values[i]);
+
+        CHECK(histogram_t::bucket_lowest(index) <= values[i]);
+        CHECK(histogram_t::bucket_highest(index) >= values[i]);
+      }
+
+      CHECK_EQUAL(histogram_t::Max_Size - 1U, histogram_t::bucket_index(0xFFFFFFFFFFFFFFFFULL));
+    }
+
+    //*************************************************************************
+    TEST(test_quantiles)
+    {
+      std::vector<uint32_t> values = make_latencies(20000U, 1U);
+
+      etl::log_histogram<uint32_t, uint32_t, 5U> histogram(values.begin(), values.end());
+
+      CHECK_EQUAL(values.size(), histogram.count());
+      CHECK_EQUAL(*std::min_element(values.begin(), values.end()), histogram.min());
+      CHECK_EQUAL(*std::max_element(values.begin(), values.end()), histogram.max());
+      CHECK_EQUAL(histogram.min(), histogram.value_at_quantile(0.0));
+      CHECK_EQUAL(histogram.max(), histogram.value_at_quantile(1.0));
+
+      const double quantiles[] = { 0.001, 0.25, 0.5, 0.9, 0.99, 0.999 };
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(quantiles); ++i)
+      {
+        const uint32_t expected = true_quantile(values, quantiles[i]);
+        const uint32_t actual   = histogram.value_at_quantile(quantiles[i]);
+
+        // Never below the true value, and above by no more than the bucket width.
+        CHECK(actual >= expected);
+        CHECK(double(actual - expected) <= (double(expected) / 32.0));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_and_weights)
+    {
+      std::vector<uint32_t> values = make_latencies(5000U, 2U);
+
+      etl::log_histogram<uint32_t, uint32_t, 5U> all(values.begin(), values.end());
+      etl::log_histogram<uint32_t, uint32_t, 5U> part1(values.begin(), values.begin() + 1000);
+      etl::log_histogram<uint32_t, uint32_t, 5U> part2(values.begin() + 1000, values.end());
+      etl::log_histogram<uint32_t, uint32_t, 5U> merged;
+
+      merged.merge(part2);
+      merged.merge(etl::log_histogram<uint32_t, uint32_t, 5U>());
+      merged.merge(part1);
+
+      CHECK_EQUAL(all.count(), merged.count());
+      CHECK_EQUAL(all.min(), merged.min());
+      CHECK_EQUAL(all.max(), merged.max());
+
+      for (size_t i = 0U; i < all.size(); ++i)
+      {
+        CHECK_EQUAL(all[i], merged[i]);
+      }
+
+      merged.merge(merged);
+      CHECK_EQUAL(2U * all.count(), merged.count());
+      CHECK_EQUAL(all.value_at_quantile(0.99), merged.value_at_quantile(0.99));
+
+      merged.clear();
+      merged.add(100U, 99U);
+      merged.add(5000U);
+      CHECK_EQUAL(100U, merged.count());
+      CHECK_EQUAL(merged.bucket_highest(merged.bucket_index(100U)), merged.value_at_quantile(0.99));
+      CHECK_EQUAL(5000U, merged.value_at_quantile(0.995));
+    }
+  };
+}
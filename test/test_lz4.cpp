@@ -0,0 +1,263 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/lz4.h"
+#include "etl/crc32.h"
+
+#include <vector>
+#include <string>
+#include <random>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //***********************************
+  etl::span<const uint8_t> as_span(const Bytes& bytes)
+  {
+    return bytes.empty() ? etl::span<const uint8_t>() : etl::span<const uint8_t>(bytes.data(), bytes.size());
+  }
+
+  //***********************************
+  Bytes make_log(size_t lines)
+  {
+    std::string text;
+    std::mt19937 generator(3);
+
+    for (size_t i = 0U; i < lines; ++i)
+    {
+      text += "[" + std::to_string(1000000U + (i * 250U)) + "] sensor ";
+      text += std::to_string(generator() % 8U);
+      text += ": temperature=" + std::to_string(20U + (generator() % 5U));
+      text += " humidity=" + std::to_string(40U + (generator() % 10U));
+      text += " status=OK\n";
+    }
+
+    return Bytes(text.begin(), text.end());
+  }
+
+  //***********************************
+  template <size_t HASH_BITS>
+  Bytes compress(const Bytes& input)
+  {
+    static etl::lz4_compressor<HASH_BITS> compressor;
+
+    Bytes output(etl::lz4_max_compressed_size(input.size()));
+
+    const size_t size = compressor.compress(as_span(input),
+                                            etl::span<uint8_t>(output.data(), output.size()));
+    output.resize(size);
+
+    return output;
+  }
+
+  //***********************************
+  Bytes decompress(const Bytes& input, size_t capacity)
+  {
+    Bytes output(capacity + 1U);
+
+    const size_t size = etl::lz4_decompress(as_span(input),
+                                            etl::span<uint8_t>(output.data(), output.size()));
+    output.resize(size);
+
+    return output;
+  }
+
+  SUITE(test_lz4)
+  {
+    //*************************************************************************
+    TEST(test_decompress_known_blocks)
+    {
+      // Literals only.
+      CHECK((Bytes{ 'a', 'b', 'c' }) == decompress(Bytes{ 0x30, 'a', 'b', 'c' }, 16U));
+
+      // 'a', then a match of 9 at offset 1, then 5 literals.
+      CHECK((Bytes{ 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'a', 'b', 'c', 'd', 'e', 'f' }) ==
+            decompress(Bytes{ 0x15, 'a', 0x01, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f' }, 32U));
+
+      // Extended literal and match lengths.
+      Bytes block = { 0xFF, 0x01 };
+      Bytes expected;
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        block.push_back(uint8_t('A' + i));
+        expected.push_back(uint8_t('A' + i));
+      }
+
+      block.push_back(0x10); // Offset 16.
+      block.push_back(0x00);
+      block.push_back(0xFF); // Match length 15 + 4 + 255 + 6.
+      block.push_back(0x06);
+      block.push_back(0x00); // Empty final literals.
+
+      for (size_t i = 0U; i < 280U; ++i)
+      {
+        expected.push_back(expected[i]);
+      }
+
+      CHECK(expected == decompress(block, 512U));
+
+      // No literals, into an empty output.
+      const uint8_t empty_block[] = { 0x00 };
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::span<const uint8_t>(empty_block, 1U), etl::span<uint8_t>()));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      std::mt19937 generator(4);
+
+      for (size_t length : { 0U, 1U, 12U, 13U, 17U, 100U, 1000U, 4096U, 70000U })
+      {
+        // Random, runs, and short repeats mixed.
+        Bytes input(length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const uint32_t r = (i / 64U) % 3U;
+          input[i] = (r == 0U) ? uint8_t(generator()) : (r == 1U) ? uint8_t(0x55U) : uint8_t("pattern"[i % 7U]);
+        }
+
+        const Bytes compressed8  = compress<8>(input);
+        const Bytes compressed16 = compress<16>(input);
+
+        CHECK(!compressed8.empty());
+        CHECK(!compressed16.empty());
+        CHECK(compressed8.size() <= etl::lz4_max_compressed_size(length));
+
+        CHECK(input == decompress(compressed8, length));
+        CHECK(input == decompress(compressed16, length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compression_ratio)
+    {
+      const Bytes input      = make_log(200U);
+      const Bytes compressed = compress<12>(input);
+
+      CHECK(input == decompress(compressed, input.size()));
+      CHECK(compressed.size() * 2U < input.size());
+
+      // A run compresses to almost nothing.
+      const Bytes run(10000U, uint8_t(0xAAU));
+      CHECK(compress<8>(run).size() < 64U);
+    }
+
+    //*************************************************************************
+    TEST(test_caller_hash_table)
+    {
+      const Bytes input = make_log(20U);
+      Bytes output(etl::lz4_max_compressed_size(input.size()));
+
+      uint32_t table[512];
+
+      const size_t size = etl::lz4_compress(etl::span<const uint8_t>(input.data(), input.size()),
+                                            etl::span<uint8_t>(output.data(), output.size()),
+                                            etl::span<uint32_t>(table));
+      CHECK(size != 0U);
+      output.resize(size);
+      CHECK(input == decompress(output, input.size()));
+
+      // Not a power of two.
+      CHECK_EQUAL(0U, etl::lz4_compress(etl::span<const uint8_t>(input.data(), input.size()),
+                                        etl::span<uint8_t>(output.data(), output.size()),
+                                        etl::span<uint32_t>(table, 500U)));
+    }
+
+    //*************************************************************************
+    TEST(test_output_too_small)
+    {
+      const Bytes input      = make_log(20U);
+      const Bytes compressed = compress<12>(input);
+
+      etl::lz4_compressor<10> compressor;
+      Bytes output(compressed.size() / 2U);
+
+      CHECK_EQUAL(0U, compressor.compress(etl::span<const uint8_t>(input.data(), input.size()),
+                                          etl::span<uint8_t>(output.data(), output.size())));
+
+      Bytes decompressed(input.size() - 1U);
+      CHECK_EQUAL(0U, etl::lz4_decompress(etl::span<const uint8_t>(compressed.data(), compressed.size()),
+                                          etl::span<uint8_t>(decompressed.data(), decompressed.size())));
+    }
+
+    //*************************************************************************
+    TEST(test_malformed)
+    {
+      // Offset of zero.
+      CHECK(decompress(Bytes{ 0x10, 'a', 0x00, 0x00 }, 16U).empty());
+
+      // Offset before the start of the output.
+      CHECK(decompress(Bytes{ 0x10, 'a', 0x02, 0x00 }, 16U).empty());
+
+      // Truncated literals.
+      CHECK(decompress(Bytes{ 0x30, 'a', 'b' }, 16U).empty());
+
+      // Truncated offset.
+      CHECK(decompress(Bytes{ 0x10, 'a', 0x01 }, 16U).empty());
+
+      // Truncated length.
+      CHECK(decompress(Bytes{ 0xF0, 0xFF }, 1024U).empty());
+
+      // Every truncation of a valid block fails cleanly, or decodes a prefix.
+      const Bytes input      = make_log(10U);
+      const Bytes compressed = compress<12>(input);
+
+      for (size_t i = 1U; i < compressed.size(); ++i)
+      {
+        const Bytes truncated(compressed.begin(), compressed.begin() + i);
+        const Bytes result = decompress(truncated, input.size());
+
+        CHECK(std::equal(result.begin(), result.end(), input.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_with_crc)
+    {
+      const Bytes input = make_log(50U);
+      Bytes frame       = compress<12>(input);
+
+      // Append a CRC to the compressed block, as a transport would.
+      const uint32_t crc = etl::crc32(frame.begin(), frame.end()).value();
+      frame.push_back(uint8_t(crc));
+      frame.push_back(uint8_t(crc >> 8));
+      frame.push_back(uint8_t(crc >> 16));
+      frame.push_back(uint8_t(crc >> 24));
+
+      const Bytes block(frame.begin(), frame.end() - 4);
+      CHECK_EQUAL(crc, etl::crc32(block.begin(), block.end()).value());
+      CHECK(input == decompress(block, input.size()));
+    }
+  };
+}
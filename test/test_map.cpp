@@ -1279,5 +1279,142 @@ namespace
             }
         }
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::map<std::string, int, MAX_SIZE> data;
+      data["1"] = 1;
+      data["3"] = 3;
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::map<std::string, int, MAX_SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK_EQUAL(3, data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK(data.lower_bound("2") == data.find("3"));
+      CHECK(cdata.lower_bound("3") == cdata.find("3"));
+      CHECK(data.upper_bound("3") == data.find("5"));
+      CHECK(cdata.upper_bound("5") == cdata.end());
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK(range.second == data.find("5"));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.find("5"));
+      CHECK(crange.second == cdata.find("5"));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::map<int, std::string, 4> Map;
+      Map data;
+
+      std::pair<Map::iterator, bool> result = data.emplace(1, "one");
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL(std::string("one"), result.first->second);
+
+      // The key is already present.
+      result = data.emplace(1, "uno");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("one"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      result = data.emplace(std::make_pair(2, std::string("two")));
+      CHECK(result.second);
+
+      Map::iterator itr = data.emplace_hint(data.end(), 3, "three");
+      CHECK_EQUAL(3, itr->first);
+      CHECK_EQUAL(std::string("three"), itr->second);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("two"), data[2]);
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::map<int, std::string, 4> Map;
+      Map data;
+
+      data.insert(std::make_pair(1, std::string("one")));
+      data.insert(std::make_pair(2, std::string("two")));
+
+      const std::pair<const int, std::string>* p_value = &*data.find(1);
+
+      Map::node_type node = data.extract(1);
+      CHECK(!node.empty());
+      CHECK_EQUAL(1, node.key());
+      CHECK_EQUAL(std::string("one"), node.mapped());
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.find(1) == data.end());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      // Back into the same map, so the node is relinked.
+      Map::insert_return_type result = data.insert(std::move(node));
+      CHECK(result.inserted);
+      CHECK(result.node.empty());
+      CHECK(node.empty());
+      CHECK(p_value == &*result.position);
+      CHECK_EQUAL(2U, data.size());
+
+      // A duplicate key hands the node back.
+      Map other;
+      other.insert(std::make_pair(2, std::string("deux")));
+      result = data.insert(other.extract(other.begin()));
+      CHECK(!result.inserted);
+      CHECK(!result.node.empty());
+      CHECK_EQUAL(std::string("deux"), result.node.mapped());
+      CHECK_EQUAL(std::string("two"), result.position->second);
+      CHECK(other.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::map<int, std::string, 4> data0;
+      etl::map<int, std::string, 6> data1;
+
+      data0.insert(std::make_pair(1, std::string("one")));
+      data0.insert(std::make_pair(2, std::string("two")));
+      data1.insert(std::make_pair(2, std::string("deux")));
+      data1.insert(std::make_pair(3, std::string("trois")));
+
+      data1.merge(data0);
+
+      CHECK_EQUAL(1U, data0.size());
+      CHECK_EQUAL(std::string("two"), data0.at(2));
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(std::string("one"), data1.at(1));
+      CHECK_EQUAL(std::string("deux"), data1.at(2));
+      CHECK_EQUAL(std::string("trois"), data1.at(3));
+    }
   };
 }
@@ -0,0 +1,296 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/mdspan.h"
+#include "etl/multi_array.h"
+
+namespace
+{
+  SUITE(test_mdspan)
+  {
+    //*************************************************************************
+    TEST(test_extents)
+    {
+      typedef etl::extents<size_t, 2, etl::dynamic_extent, 4> Extents;
+
+      CHECK_EQUAL(3U, Extents::rank());
+      CHECK_EQUAL(1U, Extents::rank_dynamic());
+      CHECK_EQUAL(2U, Extents::static_extent(0));
+      CHECK_EQUAL(etl::dynamic_extent, Extents::static_extent(1));
+
+      Extents dynamic_only(3);
+      CHECK_EQUAL(2U, dynamic_only.extent(0));
+      CHECK_EQUAL(3U, dynamic_only.extent(1));
+      CHECK_EQUAL(4U, dynamic_only.extent(2));
+      CHECK_EQUAL(24U, dynamic_only.size());
+
+      Extents all(2, 3, 4);
+      CHECK(all == dynamic_only);
+      CHECK(all != Extents(5));
+
+      CHECK_THROW(Extents(3, 3, 4), etl::mdspan_extent_mismatch);
+
+      etl::dextents<int, 2> dynamic(5, 6);
+      CHECK_EQUAL(2U, dynamic.rank_dynamic());
+      CHECK_EQUAL(30U, dynamic.size());
+    }
+
+    //*************************************************************************
+    TEST(test_layout_right)
+    {
+      int data[12];
+
+      for (int i = 0; i < 12; ++i)
+      {
+        data[i] = i;
+      }
+
+      etl::mdspan<int, etl::extents<size_t, 3, 4> > m(data);
+
+      CHECK_EQUAL(2U, m.rank());
+      CHECK_EQUAL(12U, m.size());
+      CHECK_EQUAL(4U, m.stride(0));
+      CHECK_EQUAL(1U, m.stride(1));
+      CHECK_EQUAL(0, m(0, 0));
+      CHECK_EQUAL(6, m(1, 2));
+      CHECK_EQUAL(11, m(2, 3));
+
+      m(2, 1) = 100;
+      CHECK_EQUAL(100, data[9]);
+    }
+
+    //*************************************************************************
+    TEST(test_layout_left_transpose)
+    {
+      int data[6] = { 0, 1, 2, 3, 4, 5 };
+
+      // 2 x 3, row major.
+      etl::mdspan<int, etl::dextents<size_t, 2> > m(data, 2, 3);
+
+      // The transpose, 3 x 2, is the same data column major.
+      etl::mdspan<int, etl::dextents<size_t, 2>, etl::layout_left> t(data, 3, 2);
+
+      CHECK_EQUAL(1U, t.stride(0));
+      CHECK_EQUAL(3U, t.stride(1));
+
+      for (size_t i = 0; i < 2; ++i)
+      {
+        for (size_t j = 0; j < 3; ++j)
+        {
+          CHECK_EQUAL(m(i, j), t(j, i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_layout_stride)
+    {
+      int data[20];
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data[i] = i;
+      }
+
+      // Every other column of a 4 x 5 matrix.
+      typedef etl::extents<int, 4, 3> Extents;
+      const int strides[] = { 5, 2 };
+
+      etl::layout_stride::mapping<Extents> mapping(Extents(), strides);
+      CHECK_EQUAL(20, mapping.required_span_size());
+      CHECK(!mapping.is_exhaustive());
+
+      etl::mdspan<int, Extents, etl::layout_stride> m(data, mapping);
+      CHECK_EQUAL(0,  m(0, 0));
+      CHECK_EQUAL(4,  m(0, 2));
+      CHECK_EQUAL(17, m(3, 1));
+
+      // A strided mapping from a row major one.
+      etl::layout_stride::mapping<Extents> from_right(etl::layout_right::mapping<Extents>{});
+      CHECK_EQUAL(3, from_right.stride(0));
+      CHECK_EQUAL(1, from_right.stride(1));
+      CHECK(from_right.is_exhaustive());
+    }
+
+    //*************************************************************************
+    TEST(test_from_span)
+    {
+      int data[12] = {};
+      etl::span<int> storage(data);
+
+      etl::mdspan<int, etl::dextents<size_t, 2> > m(storage, etl::dextents<size_t, 2>(3, 4));
+      m(1, 1) = 5;
+      CHECK_EQUAL(5, data[5]);
+
+      CHECK_THROW((etl::mdspan<int, etl::dextents<size_t, 2> >(storage, etl::dextents<size_t, 2>(4, 4))), etl::mdspan_out_of_range);
+
+      etl::mdspan<const int, etl::dextents<size_t, 2> > c(m);
+      CHECK_EQUAL(5, c(1, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_multi_array)
+    {
+      etl::multi_array<int, 2, 3, 4> a;
+
+      int value = 0;
+
+      for (size_t i = 0; i < 2; ++i)
+      {
+        for (size_t j = 0; j < 3; ++j)
+        {
+          for (size_t k = 0; k < 4; ++k)
+          {
+            a[i][j][k] = value++;
+          }
+        }
+      }
+
+      auto m = etl::make_mdspan(a);
+
+      CHECK_EQUAL(3U, m.rank());
+      CHECK_EQUAL(0U, m.rank_dynamic());
+      CHECK_EQUAL(2U, m.extent(0));
+      CHECK_EQUAL(3U, m.extent(1));
+      CHECK_EQUAL(4U, m.extent(2));
+
+      for (size_t i = 0; i < 2; ++i)
+      {
+        for (size_t j = 0; j < 3; ++j)
+        {
+          for (size_t k = 0; k < 4; ++k)
+          {
+            CHECK_EQUAL(a[i][j][k], m(i, j, k));
+          }
+        }
+      }
+
+      const etl::multi_array<int, 2, 3, 4>& ca = a;
+      etl::mdspan<const int, etl::extents<size_t, 2, 3, 4> > cm = etl::make_mdspan(ca);
+      CHECK_EQUAL(23, cm(1, 2, 3));
+    }
+
+    //*************************************************************************
+    TEST(test_submdspan_tile)
+    {
+      int data[6 * 8];
+
+      for (int i = 0; i < 48; ++i)
+      {
+        data[i] = i;
+      }
+
+      etl::mdspan<int, etl::extents<size_t, 6, 8> > image(data);
+
+      // A 2 x 3 tile at row 2, column 4.
+      auto tile = etl::submdspan(image, etl::pair<size_t, size_t>(2, 4), etl::pair<size_t, size_t>(4, 7));
+
+      CHECK_EQUAL(2U, tile.rank());
+      CHECK_EQUAL(2U, tile.extent(0));
+      CHECK_EQUAL(3U, tile.extent(1));
+      CHECK_EQUAL(8U, tile.stride(0));
+      CHECK_EQUAL(1U, tile.stride(1));
+      CHECK_EQUAL(20, tile(0, 0));
+      CHECK_EQUAL(30, tile(1, 2));
+
+      // Writes go to the image.
+      tile(1, 1) = -1;
+      CHECK_EQUAL(-1, image(3, 5));
+
+      CHECK_THROW(etl::submdspan(image, etl::pair<size_t, size_t>(5, 7), etl::full_extent), etl::mdspan_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_submdspan_rank_reduction)
+    {
+      int data[3 * 4];
+
+      for (int i = 0; i < 12; ++i)
+      {
+        data[i] = i;
+      }
+
+      etl::mdspan<int, etl::extents<size_t, 3, 4> > m(data);
+
+      // Row 1.
+      auto row = etl::submdspan(m, 1, etl::full_extent);
+      CHECK_EQUAL(1U, row.rank());
+      CHECK_EQUAL(4U, row.extent(0));
+      CHECK_EQUAL(4, row(0));
+      CHECK_EQUAL(7, row(3));
+
+      // Column 2.
+      auto column = etl::submdspan(m, etl::full_extent, 2);
+      CHECK_EQUAL(3U, column.extent(0));
+      CHECK_EQUAL(4U, column.stride(0));
+      CHECK_EQUAL(2,  column(0));
+      CHECK_EQUAL(10, column(2));
+
+      // One element.
+      auto element = etl::submdspan(m, 2, 3);
+      CHECK_EQUAL(0U, element.rank());
+      CHECK_EQUAL(11, element());
+    }
+
+    //*************************************************************************
+    TEST(test_submdspan_strided)
+    {
+      int data[4 * 6];
+
+      for (int i = 0; i < 24; ++i)
+      {
+        data[i] = i;
+      }
+
+      etl::mdspan<int, etl::extents<size_t, 4, 6> > m(data);
+
+      // Every other row and every third column.
+      etl::strided_slice<> rows    = { 0, 4, 2 };
+      etl::strided_slice<> columns = { 1, 5, 3 };
+
+      auto s = etl::submdspan(m, rows, columns);
+
+      CHECK_EQUAL(2U,  s.extent(0));
+      CHECK_EQUAL(2U,  s.extent(1));
+      CHECK_EQUAL(12U, s.stride(0));
+      CHECK_EQUAL(3U,  s.stride(1));
+      CHECK_EQUAL(1,   s(0, 0));
+      CHECK_EQUAL(4,   s(0, 1));
+      CHECK_EQUAL(13,  s(1, 0));
+      CHECK_EQUAL(16,  s(1, 1));
+
+      // A slice of a slice.
+      auto t = etl::submdspan(s, 1, etl::full_extent);
+      CHECK_EQUAL(13, t(0));
+      CHECK_EQUAL(16, t(1));
+    }
+  };
+}
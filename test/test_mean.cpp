@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/mean.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -51,6 +52,24 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Pseudo random int16_t samples, starting with a run of the most negative
+  // value, whose squares are the largest the kernels see.
+  std::vector<int16_t> make_int16_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int16_t> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = (i < 24U) ? int16_t(-32768) : int16_t(seed >> 16);
+    }
+
+    samples[24] = 32767;
+
+    return samples;
+  }
+
   SUITE(test_mean)
   {
     //*************************************************************************
@@ -112,5 +131,46 @@ namespace
       mean_result = mean1.get_mean();
       CHECK_CLOSE(4.5, mean_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_int16_block_mean_matches_scalar)
+    {
+      // An odd size, so that the kernel has a tail to finish.
+      std::vector<int16_t> samples = make_int16_samples(1027U, 1U);
+
+      const int16_t* first = samples.data();
+      const int16_t* last  = samples.data() + samples.size();
+
+      etl::mean<int16_t, int64_t> block(first, last);
+      etl::mean<int16_t, int64_t> scalar;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        scalar.add(samples[i]);
+      }
+
+      CHECK_EQUAL(scalar.count(), block.count());
+      CHECK_EQUAL(scalar.get_mean(), block.get_mean());
+
+      // Adding in pieces gives the same result.
+      etl::mean<int16_t, int64_t> pieces;
+      pieces.add(first, first + 5);
+      pieces.add(first + 5, first + 500);
+      pieces.add(first + 500, last);
+
+      CHECK_EQUAL(scalar.count(), pieces.count());
+      CHECK_EQUAL(scalar.get_mean(), pieces.get_mean());
+    }
+
+    //*************************************************************************
+    TEST(test_float_block_mean_accuracy)
+    {
+      // Added a sample at a time, a float sum of this many samples drifts well away from the true mean.
+      std::vector<float> samples(1000000U, 0.1f);
+
+      etl::mean<float> mean(samples.data(), samples.data() + samples.size());
+
+      CHECK_CLOSE(double(0.1f), mean.get_mean(), 1e-7);
+    }
   };
 }
@@ -609,6 +609,57 @@ namespace
       CHECK_EQUAL(0U, count);
     }
 
+    //*************************************************************************
+    TEST(test_uninitialized_default_construct_count_accumulates)
+    {
+      trivial_t* p = reinterpret_cast<trivial_t*>(buffer_trivial);
+
+      size_t count = 2U;
+      etl::uninitialized_default_construct(p, p + SIZE, count);
+      CHECK_EQUAL(SIZE + 2U, count);
+
+      etl::destroy(p, p + SIZE, count);
+      CHECK_EQUAL(2U, count);
+    }
+
+    //*************************************************************************
+    TEST(test_uninitialized_relocate_trivial)
+    {
+      trivial_t source[SIZE];
+      std::copy(test_data_trivial.begin(), test_data_trivial.end(), source);
+
+      trivial_t* p = reinterpret_cast<trivial_t*>(buffer_trivial);
+
+      trivial_t* p_end = etl::uninitialized_relocate(source, source + SIZE, p);
+      CHECK(p_end == p + SIZE);
+      CHECK(std::equal(test_data_trivial.begin(), test_data_trivial.end(), p));
+
+      std::fill(std::begin(buffer_trivial), std::end(buffer_trivial), 0);
+      p_end = etl::uninitialized_relocate_n(source, SIZE, p);
+      CHECK(p_end == p + SIZE);
+      CHECK(std::equal(test_data_trivial.begin(), test_data_trivial.end(), p));
+    }
+
+    //*************************************************************************
+    TEST(test_uninitialized_relocate_non_trivial)
+    {
+      char source_buffer[sizeof(non_trivial_t) * SIZE];
+      non_trivial_t* source = reinterpret_cast<non_trivial_t*>(source_buffer);
+      etl::uninitialized_copy(test_data_non_trivial.begin(), test_data_non_trivial.end(), source);
+
+      non_trivial_t* p = reinterpret_cast<non_trivial_t*>(buffer_non_trivial);
+
+      non_trivial_t* p_end = etl::uninitialized_relocate(source, source + SIZE, p);
+      CHECK(p_end == p + SIZE);
+      CHECK(std::equal(test_data_non_trivial.begin(), test_data_non_trivial.end(), p));
+
+      p_end = etl::uninitialized_relocate_n(p, SIZE, source);
+      CHECK(p_end == source + SIZE);
+      CHECK(std::equal(test_data_non_trivial.begin(), test_data_non_trivial.end(), source));
+
+      etl::destroy(source, source + SIZE);
+    }
+
     //*************************************************************************
     TEST(test_create_copy)
     {
@@ -818,6 +869,36 @@ namespace
       CHECK_EQUAL(0x5A, data[2].d2);
     }
 
+    //*************************************************************************
+    TEST(test_memory_set_unaligned_lengths)
+    {
+      char buffer[80];
+
+      for (size_t offset = 0U; offset < 9U; ++offset)
+      {
+        for (size_t length = 0U; length < 64U; ++length)
+        {
+          std::fill(std::begin(buffer), std::end(buffer), char(0x11));
+
+          etl::memory_set(buffer + offset, length, char(0xA5));
+
+          for (size_t i = 0U; i < sizeof(buffer); ++i)
+          {
+            const bool in_range = (i >= offset) && (i < (offset + length));
+            CHECK_EQUAL(in_range ? char(0xA5) : char(0x11), buffer[i]);
+          }
+
+          etl::memory_clear(buffer + offset, length);
+
+          for (size_t i = 0U; i < sizeof(buffer); ++i)
+          {
+            const bool in_range = (i >= offset) && (i < (offset + length));
+            CHECK_EQUAL(in_range ? char(0x00) : char(0x11), buffer[i]);
+          }
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_unique_ptr_default_construction)
     {
@@ -1125,5 +1206,30 @@ namespace
 
       CHECK_EQUAL(expected, alignment);
     }
+
+    //*************************************************************************
+    TEST(test_hardware_interference_size)
+    {
+#if ETL_CACHE_LINE_SIZE > 0
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), etl::hardware_destructive_interference_size);
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE), etl::hardware_constructive_interference_size);
+#else
+      CHECK_EQUAL(1U, etl::hardware_destructive_interference_size);
+      CHECK_EQUAL(1U, etl::hardware_constructive_interference_size);
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_prefetch)
+    {
+      int data[4] = { 1, 2, 3, 4 };
+
+      // Only hints, so they must not change anything.
+      etl::prefetch_read(data);
+      etl::prefetch_write(data + 2);
+
+      CHECK_EQUAL(1, data[0]);
+      CHECK_EQUAL(3, data[2]);
+    }
   };
 }
@@ -767,5 +767,219 @@ namespace
       CHECK_EQUAL(3, router4a.order);
       CHECK_EQUAL(4, router3.order);
     }
+
+    //*************************************************************************
+    TEST(message_bus_receive_batch)
+    {
+      etl::message_bus<3> bus1;
+      etl::message_bus<1> bus2;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA router3(ROUTER3);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+      bus1.subscribe(bus2);
+      bus2.subscribe(router3);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message4 message4(callback);
+
+      const etl::imessage* const messages[] = { &message1, &message3, &message4 };
+
+      call_order = 0;
+
+      bus1.receive_batch(messages, 3U);
+
+      // Each subscriber receives the whole batch before the next one.
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router3.order);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router1.message4_count);
+
+      // Message3 is not offered to router2.
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(1, router3.message1_count);
+      CHECK_EQUAL(1, router3.message3_count);
+      CHECK_EQUAL(1, router3.message4_count);
+
+      // The same with an index.
+      etl::message_bus_index<MESSAGE5, 3> index;
+      CHECK(bus1.set_index(index));
+
+      bus1.receive_batch(etl::span<const etl::imessage* const>(messages));
+
+      CHECK_EQUAL(2, router1.message3_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(2, router3.message4_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_broadcast_indexed)
+    {
+      etl::message_bus<4> bus1;
+      etl::message_bus<2> bus2;
+      etl::message_bus_index<MESSAGE4, 4> index;
+      etl::message_bus_index<8, 2>        index_too_small;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA router3(ROUTER3);
+
+      RouterA callback(ROUTER5);
+
+      CHECK(!bus1.set_index(index_too_small));
+      CHECK(!bus1.has_index());
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      CHECK(bus1.set_index(index));
+      CHECK(bus1.has_index());
+
+      // Subscribers change after the index is set.
+      bus1.subscribe(bus2);
+      bus2.subscribe(router3);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message4 message4(callback);
+
+      call_order = 0;
+
+      bus1.receive(message1);
+      bus1.receive(message3);
+      bus1.receive(message4); // Not indexed.
+
+      CHECK(index.test(MESSAGE1, 0U));
+      CHECK(index.test(MESSAGE1, 1U));
+      CHECK(index.test(MESSAGE3, 0U));
+      CHECK(!index.test(MESSAGE3, 1U));
+      CHECK(index.test(MESSAGE3, 2U));
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router3.order);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(1, router3.message1_count);
+      CHECK_EQUAL(1, router3.message3_count);
+      CHECK_EQUAL(1, router3.message4_count);
+
+      // Removing a subscriber rebuilds the index.
+      bus1.unsubscribe(router1);
+      bus1.receive(message3);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(2, router3.message3_count);
+      CHECK(!index.test(MESSAGE3, 0U));
+      CHECK(index.test(MESSAGE3, 1U));
+
+      // Addressed messages do not use the index.
+      bus1.receive(ROUTER2, message1);
+      CHECK_EQUAL(2, router2.message1_count);
+
+      bus1.clear_index();
+      CHECK(!bus1.has_index());
+
+      bus1.receive(message3);
+      CHECK_EQUAL(3, router3.message3_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_addressed_router_index)
+    {
+      etl::message_bus<5> bus1;
+      etl::message_bus<2> bus2;
+      etl::message_bus_router_index<>  index;
+      etl::message_bus_router_index<3> index_small;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterB router2b(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      CHECK(!bus1.has_router_index());
+
+      bus1.subscribe(router2);
+      bus1.subscribe(router1);
+
+      bus1.set_router_index(index);
+      CHECK(bus1.has_router_index());
+
+      // Subscribers change after the index is set.
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2b);
+      bus1.subscribe(router4);
+      bus2.subscribe(router3);
+
+      Message1 message1(callback);
+      Message2 message2(callback);
+
+      bus1.receive(ROUTER2, message1);
+      bus1.receive(ROUTER1, message1);
+      bus1.receive(ROUTER3, message2);
+      bus1.receive(ROUTER4, message2);
+
+      CHECK_EQUAL(0U, index.first(ROUTER1));
+      CHECK_EQUAL(1U, index.last(ROUTER1));
+      CHECK_EQUAL(1U, index.first(ROUTER2));
+      CHECK_EQUAL(3U, index.last(ROUTER2));
+      CHECK_EQUAL(index.first(ROUTER3), index.last(ROUTER3));
+      CHECK_EQUAL(4U, index.first_message_bus());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2b.message1_count);
+      CHECK_EQUAL(1, router3.message2_count);
+      CHECK_EQUAL(1, router4.message2_count);
+      CHECK_EQUAL(0, router4.message1_count);
+
+      // Removing a subscriber rebuilds the index.
+      bus1.unsubscribe(ROUTER2);
+      bus1.receive(ROUTER2, message1);
+      bus1.receive(ROUTER4, message1);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2b.message1_count);
+      CHECK_EQUAL(1, router4.message1_count);
+      CHECK_EQUAL(1U, index.first(ROUTER4));
+
+      // Ids outside the index are searched for.
+      bus1.set_router_index(index_small);
+      bus1.receive(ROUTER1, message2);
+      bus1.receive(ROUTER4, message2);
+      bus1.receive(ROUTER3, message1);
+
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(2, router4.message2_count);
+      CHECK_EQUAL(1, router3.message1_count);
+
+      bus1.clear_router_index();
+      CHECK(!bus1.has_router_index());
+
+      bus1.receive(ROUTER1, message1);
+      CHECK_EQUAL(2, router1.message1_count);
+    }
   };
 }
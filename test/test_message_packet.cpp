@@ -378,6 +378,71 @@ namespace
       CHECK_EQUAL(1, static_cast<Message1&>(packet2.get()).x);
     }
 
+    //*************************************************************************
+    TEST(message_packet_emplace)
+    {
+      Packet packet;
+
+      CHECK(!packet.is_valid());
+
+      Message1& message1 = packet.emplace<Message1>(1);
+
+      CHECK(packet.is_valid());
+      CHECK_EQUAL(MESSAGE1, packet.get().get_message_id());
+      CHECK(&message1 == &packet.get());
+      CHECK(!message1.moved);
+      CHECK(!message1.copied);
+      CHECK_EQUAL(1, message1.x);
+
+      // Replaces the current message.
+      Message3& message3 = packet.emplace<Message3>("3");
+
+      CHECK_EQUAL(MESSAGE3, packet.get().get_message_id());
+      CHECK(!message3.moved);
+      CHECK(!message3.copied);
+      CHECK_EQUAL("3", message3.x);
+
+      // The next line should result in a compile error.
+      //packet.emplace<Message4>();
+    }
+
+    //*************************************************************************
+    TEST(message_packet_assignment_from_message)
+    {
+      Message1 message1(1);
+      Message2 message2(2.2);
+
+      Packet packet;
+
+      packet = message1;
+
+      CHECK_EQUAL(MESSAGE1, packet.get().get_message_id());
+      CHECK(static_cast<Message1&>(packet.get()).copied);
+      CHECK_EQUAL(1, static_cast<Message1&>(packet.get()).x);
+
+      packet = std::move(message2);
+
+      CHECK_EQUAL(MESSAGE2, packet.get().get_message_id());
+      CHECK(static_cast<Message2&>(packet.get()).moved);
+      CHECK_EQUAL(2.2, static_cast<Message2&>(packet.get()).x);
+    }
+
+    //*************************************************************************
+    TEST(message_packet_storage)
+    {
+      constexpr size_t size      = Packet::storage_size();
+      constexpr size_t alignment = Packet::storage_alignment();
+
+      CHECK_EQUAL(size_t(Packet::SIZE), size);
+      CHECK_EQUAL(size_t(Packet::ALIGNMENT), alignment);
+      CHECK(size >= sizeof(Message1));
+      CHECK(size >= sizeof(Message2));
+      CHECK(size >= sizeof(Message3));
+      CHECK((alignment % alignof(Message1)) == 0U);
+      CHECK((alignment % alignof(Message2)) == 0U);
+      CHECK((alignment % alignof(Message3)) == 0U);
+    }
+
     //*************************************************************************
     TEST(message_packet_accepts)
     {
@@ -440,6 +440,40 @@ namespace
       CHECK(r2.accepts(message5.get_message_id()));
     }
 
+    //*************************************************************************
+    TEST(message_router_accepts_sparse_ids)
+    {
+      struct Sparse0   : public etl::message<0>   {};
+      struct Sparse31  : public etl::message<31>  {};
+      struct Sparse32  : public etl::message<32>  {};
+      struct Sparse200 : public etl::message<200> {};
+      struct Sparse255 : public etl::message<255> {};
+
+      struct SparseRouter : public etl::message_router<SparseRouter, Sparse0, Sparse31, Sparse32, Sparse200, Sparse255>
+      {
+        SparseRouter()
+          : message_router(ROUTER3)
+        {
+        }
+
+        void on_receive(const Sparse0&)   {}
+        void on_receive(const Sparse31&)  {}
+        void on_receive(const Sparse32&)  {}
+        void on_receive(const Sparse200&) {}
+        void on_receive(const Sparse255&) {}
+        void on_receive_unknown(const etl::imessage&) {}
+      };
+
+      SparseRouter router;
+
+      for (int id = 0; id <= 255; ++id)
+      {
+        const bool expected = (id == 0) || (id == 31) || (id == 32) || (id == 200) || (id == 255);
+
+        CHECK_EQUAL(expected, router.accepts(etl::message_id_t(id)));
+      }
+    }
+
     //*************************************************************************
     TEST(message_router_queue)
     {
@@ -576,5 +610,79 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+#if ETL_USING_VARIADIC_MESSAGES
+    //*************************************************************************
+    template <size_t Id>
+    struct Many : public etl::message<etl::message_id_t(100U + Id)>
+    {
+    };
+
+    //*************************************************************************
+    struct ManyRouter : public etl::message_router<ManyRouter, Many<0>,  Many<1>,  Many<2>,  Many<3>,  Many<4>,
+                                                               Many<5>,  Many<6>,  Many<7>,  Many<8>,  Many<9>,
+                                                               Many<10>, Many<11>, Many<12>, Many<13>, Many<14>,
+                                                               Many<15>, Many<16>, Many<17>, Many<18>, Many<19>>
+    {
+      ManyRouter()
+        : message_router(ROUTER3)
+        , total(0)
+        , last(0)
+        , unknown(0)
+      {
+      }
+
+      template <typename TMessage>
+      void on_receive(const TMessage& msg)
+      {
+        ++total;
+        last = msg.get_message_id();
+      }
+
+      void on_receive_unknown(const etl::imessage&)
+      {
+        ++unknown;
+      }
+
+      int total;
+      etl::message_id_t last;
+      int unknown;
+    };
+
+    //*************************************************************************
+    TEST(message_router_more_than_16_types)
+    {
+      ManyRouter router;
+
+      router.receive(Many<0>());
+      CHECK_EQUAL(1, router.total);
+      CHECK_EQUAL(100, router.last);
+
+      router.receive(Many<19>());
+      CHECK_EQUAL(2, router.total);
+      CHECK_EQUAL(119, router.last);
+
+      router.receive(message5);
+      CHECK_EQUAL(2, router.total);
+      CHECK_EQUAL(1, router.unknown);
+
+      for (int id = 0; id <= 255; ++id)
+      {
+        const bool expected = (id >= 100) && (id < 120);
+
+        CHECK_EQUAL(expected, router.accepts(etl::message_id_t(id)));
+      }
+
+      ManyRouter::message_packet packet(Many<17>{});
+      CHECK(packet.is_valid());
+      CHECK_EQUAL(117, packet.get().get_message_id());
+      CHECK(ManyRouter::message_packet::accepts(119));
+      CHECK(!ManyRouter::message_packet::accepts(120));
+
+      router.receive(packet.get());
+      CHECK_EQUAL(3, router.total);
+      CHECK_EQUAL(117, router.last);
+    }
+#endif
   };
 }
@@ -325,6 +325,53 @@ namespace
       CHECK(itr == end);
     }
 
+    //*************************************************************************
+    TEST(test_find_message_router_with_index)
+    {
+      etl::imessage_router* routers[] = { &router1, &router2, &router3, &router2b };
+      etl::message_router_registry<Registry_Size + 2U> registry(std::begin(routers), std::end(routers));
+      etl::message_router_registry<Registry_Size + 2U> registry2;
+      etl::message_router_registry_index<>             index;
+      etl::message_router_registry_index<ROUTER4>      index2;
+
+      CHECK(!registry.has_index());
+      registry.set_index(index);
+      CHECK(registry.has_index());
+
+      CHECK(&router1 == index.get(ROUTER1));
+      CHECK(&router2 == index.get(ROUTER2));
+      CHECK(&router3 == index.get(ROUTER3));
+      CHECK(nullptr  == index.get(ROUTER4));
+
+      registry.add(router4);
+      registry.add(router2c);
+
+      CHECK(&router1 == registry.find(ROUTER1));
+      CHECK(&router2 == registry.find(ROUTER2));
+      CHECK(&router3 == registry.find(ROUTER3));
+      CHECK(&router4 == registry.find(ROUTER4));
+      CHECK(nullptr  == registry.find(ROUTER5));
+      CHECK(registry.contains(ROUTER4));
+
+      registry.remove(ROUTER2);
+
+      CHECK(nullptr == registry.find(ROUTER2));
+      CHECK(nullptr == index.get(ROUTER2));
+
+      // Ids outside the index are searched for.
+      registry2.set_index(index2);
+      registry2 = registry;
+
+      CHECK(&router1 == index2.get(ROUTER1));
+      CHECK(&router1 == registry2.find(ROUTER1));
+      CHECK(&router4 == registry2.find(ROUTER4));
+      CHECK(nullptr  == registry2.find(ROUTER2));
+
+      registry.clear_index();
+      CHECK(!registry.has_index());
+      CHECK(&router3 == registry.find(ROUTER3));
+    }
+
     //*************************************************************************
     TEST(test_unregister_message_router)
     {
@@ -593,6 +593,43 @@ namespace
       CHECK_ARRAY_EQUAL(compare1.data(), router1.message1.data(), compare1.size());
     }
 
+    //*************************************************************************
+    TEST(message_timer_time_to_next)
+    {
+      etl::message_timer<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::REPEATING);
+
+      router1.clear();
+
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      // Sleep until each expiry in turn, then pass on the elapsed time in one tick.
+      ticks = 0;
+
+      while (ticks < 100U)
+      {
+        const uint32_t elapsed = timer_controller.time_to_next();
+        ticks += elapsed;
+        timer_controller.tick(elapsed);
+      }
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 23, 46, 69, 92, 115 };
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK_EQUAL(23U, timer_controller.time_to_next());
+
+      timer_controller.stop(id2);
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
 
@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/message_timer_wheel.h"
+
+#include <vector>
+
+namespace
+{
+  uint64_t ticks = 0;
+
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  Message1 message1;
+  Message2 message2;
+
+  //***************************************************************************
+  // Router that handles messages 1, 2
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router(etl::message_router_id_t id_)
+      : message_router(id_)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      message1.push_back(ticks);
+    }
+
+    void on_receive(const Message2&)
+    {
+      message2.push_back(ticks);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    void clear()
+    {
+      message1.clear();
+      message2.clear();
+    }
+
+    std::vector<uint64_t> message1;
+    std::vector<uint64_t> message2;
+  };
+
+  //***************************************************************************
+  class Bus : public etl::message_bus<2>
+  {
+  };
+
+  Router router1(ROUTER1);
+  Router router2(ROUTER2);
+
+  //***************************************************************************
+  template <typename TController>
+  void run(TController& controller, uint32_t step, uint64_t until)
+  {
+    while (ticks < until)
+    {
+      ticks += step;
+      controller.tick(step);
+    }
+  }
+
+  SUITE(test_message_timer_wheel)
+  {
+    //*************************************************************************
+    TEST(message_timer_wheel_too_many_timers)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(message2, router1, 23, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id3 = timer_controller.register_timer(message2, router1, 11, etl::timer::mode::SINGLE_SHOT);
+
+      CHECK(id1 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id2 != etl::timer_wheel::id::NO_TIMER);
+      CHECK(id3 == etl::timer_wheel::id::NO_TIMER);
+
+      CHECK(timer_controller.unregister_timer(id2));
+      id3 = timer_controller.register_timer(message2, router1, 11, etl::timer::mode::SINGLE_SHOT);
+      CHECK_EQUAL(id2, id3);
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_one_shot_and_repeating)
+    {
+      etl::message_timer_wheel<2> timer_controller;
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(message1, router1, 37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer_wheel::id::type id2 = timer_controller.register_timer(message2, router1, 11, etl::timer::mode::REPEATING);
+
+      router1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id2);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 1U, 50U);
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 11, 22, 33, 44 };
+
+      CHECK(router1.message1 == compare1);
+      CHECK(router1.message2 == compare2);
+      CHECK_EQUAL(1U, timer_controller.number_of_active_timers());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_bus_destination)
+    {
+      etl::message_timer_wheel<1, 3> timer_controller;
+
+      Bus bus;
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(message1, bus, 100, etl::timer::mode::REPEATING, ROUTER2);
+
+      router1.clear();
+      router2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.enable(true);
+
+      ticks = 0;
+      run(timer_controller, 7U, 350U);
+
+      std::vector<uint64_t> compare = { 105, 203, 301 };
+
+      CHECK(router1.message1.empty());
+      CHECK(router2.message1 == compare);
+    }
+  };
+}
@@ -0,0 +1,302 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/moving_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  //*********************************
+  std::vector<int> make_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = int((seed >> 16) % 2001U) - 1000;
+    }
+
+    return samples;
+  }
+
+  //*********************************
+  // The window of the last 'size' samples ending at 'end'.
+  template <typename T>
+  std::vector<T> window_of(const std::vector<T>& samples, size_t end, size_t size)
+  {
+    const size_t begin = (end > size) ? end - size : 0U;
+
+    return std::vector<T>(samples.begin() + begin, samples.begin() + end);
+  }
+
+  //*********************************
+  template <typename T>
+  double reference_mean(const std::vector<T>& window)
+  {
+    double sum = 0.0;
+
+    for (size_t i = 0U; i < window.size(); ++i)
+    {
+      sum += double(window[i]);
+    }
+
+    return sum / double(window.size());
+  }
+
+  //*********************************
+  template <typename T>
+  double reference_variance(const std::vector<T>& window, size_t adjustment)
+  {
+    if (window.size() <= adjustment)
+    {
+      return 0.0;
+    }
+
+    const double mean = reference_mean(window);
+    double m2 = 0.0;
+
+    for (size_t i = 0U; i < window.size(); ++i)
+    {
+      m2 += (double(window[i]) - mean) * (double(window[i]) - mean);
+    }
+
+    return m2 / double(window.size() - adjustment);
+  }
+
+  SUITE(test_moving_statistics)
+  {
+    //*************************************************************************
+    TEST(test_moving_mean_empty)
+    {
+      etl::moving_mean<int, 8U, int32_t> mean;
+
+      CHECK_EQUAL(0U, mean.count());
+      CHECK(!mean.full());
+      CHECK_EQUAL(0.0, mean.get_mean());
+      CHECK_EQUAL(8U, (etl::moving_mean<int, 8U, int32_t>::WINDOW_SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_moving_mean_integral)
+    {
+      std::vector<int> samples = make_samples(200U, 1U);
+
+      etl::moving_mean<int, 16U, int32_t> mean;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        mean.add(samples[i]);
+
+        std::vector<int> window = window_of(samples, i + 1U, 16U);
+
+        CHECK_EQUAL(window.size(), mean.count());
+        CHECK_EQUAL(window.size() == 16U, mean.full());
+        CHECK_EQUAL(reference_mean(window), mean.get_mean());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_moving_mean_float_does_not_drift)
+    {
+      // Large values enter and leave the window. Without the periodic
+      // recalculation the rounding errors they leave behind build up.
+      etl::moving_mean<float, 10U> mean;
+
+      for (size_t i = 0U; i < 100000U; ++i)
+      {
+        mean.add(((i % 7U) == 0U) ? 1.0e6f : 0.1f);
+      }
+
+      for (size_t i = 0U; i < 10U; ++i)
+      {
+        mean.add(0.1f);
+      }
+
+      CHECK_CLOSE(0.1, mean.get_mean(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_moving_mean_range_and_clear)
+    {
+      std::vector<int> samples = make_samples(50U, 2U);
+
+      etl::moving_mean<int, 10U, int32_t> mean(samples.begin(), samples.end());
+
+      CHECK_EQUAL(10U, mean.count());
+      CHECK_EQUAL(reference_mean(window_of(samples, 50U, 10U)), double(mean));
+
+      mean.clear();
+      CHECK_EQUAL(0U, mean.count());
+      CHECK_EQUAL(0.0, mean.get_mean());
+
+      mean(3);
+      mean(samples.begin(), samples.begin() + 1);
+      CHECK_EQUAL(2U, mean.count());
+      CHECK_EQUAL((3.0 + samples[0]) / 2.0, mean.get_mean());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_variance_sample)
+    {
+      std::vector<int> samples = make_samples(300U, 3U);
+
+      etl::moving_variance<etl::variance_type::Sample, int, 20U> variance;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        variance.add(samples[i]);
+
+        std::vector<int> window = window_of(samples, i + 1U, 20U);
+
+        CHECK_EQUAL(window.size(), variance.count());
+        CHECK_CLOSE(reference_mean(window), variance.get_mean(), 1e-9);
+        CHECK_CLOSE(reference_variance(window, 1U), variance.get_variance(), 1e-6);
+        CHECK_CLOSE(std::sqrt(reference_variance(window, 1U)), variance.get_standard_deviation(), 1e-6);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_moving_variance_population)
+    {
+      std::vector<int> samples = make_samples(100U, 4U);
+
+      etl::moving_variance<etl::variance_type::Population, int, 7U> variance;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        variance(samples[i]);
+
+        std::vector<int> window = window_of(samples, i + 1U, 7U);
+
+        CHECK_CLOSE(reference_variance(window, 0U), double(variance), 1e-6);
+      }
+
+      variance.clear();
+      CHECK_EQUAL(0U, variance.count());
+      CHECK_EQUAL(0.0, variance.get_variance());
+
+      variance.add(5);
+      CHECK_EQUAL(0.0, variance.get_variance());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_variance_float_offset)
+    {
+      // A large offset, where the sum of squares method loses every digit.
+      std::vector<float> samples(1000U);
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        samples[i] = 10000.0f + float(i % 5U);
+      }
+
+      etl::moving_variance<etl::variance_type::Population, float, 10U> variance(samples.begin(), samples.end());
+
+      CHECK_CLOSE(2.0, variance.get_variance(), 1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_moving_min_max)
+    {
+      std::vector<int> samples = make_samples(500U, 5U);
+
+      etl::moving_min<int, 13U> minimum;
+      etl::moving_max<int, 13U> maximum;
+
+      CHECK_EQUAL(0, minimum.get_min());
+      CHECK_EQUAL(0, maximum.get_max());
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        minimum.add(samples[i]);
+        maximum(samples[i]);
+
+        std::vector<int> window = window_of(samples, i + 1U, 13U);
+
+        CHECK_EQUAL(window.size(), minimum.count());
+        CHECK_EQUAL(window.size() == 13U, maximum.full());
+        CHECK_EQUAL(*std::min_element(window.begin(), window.end()), minimum.get_min());
+        CHECK_EQUAL(*std::max_element(window.begin(), window.end()), int(maximum));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_moving_min_max_monotonic_and_equal)
+    {
+      etl::moving_min<int, 4U> minimum;
+      etl::moving_max<int, 4U> maximum;
+
+      // Falling values: every new value is the minimum, the maximum leaves.
+      const int falling[] = { 9, 8, 7, 6, 5, 4, 3 };
+      minimum.add(falling, falling + 7);
+      maximum.add(falling, falling + 7);
+      CHECK_EQUAL(3, minimum.get_min());
+      CHECK_EQUAL(6, maximum.get_max());
+
+      // Equal values stay in the window until the last of them leaves.
+      minimum.clear();
+      const int equal[] = { 1, 1, 1, 1, 2, 2, 2 };
+      minimum.add(equal, equal + 7);
+      CHECK_EQUAL(1, minimum.get_min());
+      minimum.add(2);
+      CHECK_EQUAL(2, minimum.get_min());
+      CHECK_EQUAL(4U, minimum.count());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_window_of_one)
+    {
+      etl::moving_mean<int, 1U, int32_t>                        mean;
+      etl::moving_variance<etl::variance_type::Population, int, 1U> variance;
+      etl::moving_min<int, 1U>                                  minimum;
+      etl::moving_max<int, 1U>                                  maximum;
+
+      const int values[] = { 5, -3, 8 };
+
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        mean.add(values[i]);
+        variance.add(values[i]);
+        minimum.add(values[i]);
+        maximum.add(values[i]);
+
+        CHECK_EQUAL(double(values[i]), mean.get_mean());
+        CHECK_EQUAL(0.0, variance.get_variance());
+        CHECK_EQUAL(values[i], minimum.get_min());
+        CHECK_EQUAL(values[i], maximum.get_max());
+      }
+    }
+  };
+}
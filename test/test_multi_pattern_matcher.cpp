@@ -0,0 +1,269 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+
+#include "etl/multi_pattern_matcher.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/wstring.h"
+
+namespace
+{
+  typedef etl::multi_pattern_matcher<char, 64> Matcher;
+
+  //***************************************************************************
+  // Leftmost, then longest, by brute force.
+  etl::pattern_match reference_find(const std::string& text, const std::vector<std::string>& patterns, size_t position)
+  {
+    for (size_t start = position; start < text.size(); ++start)
+    {
+      size_t best_length = 0U;
+      size_t best_index  = 0U;
+
+      for (size_t i = 0U; i < patterns.size(); ++i)
+      {
+        if ((text.compare(start, patterns[i].size(), patterns[i]) == 0) && (patterns[i].size() > best_length))
+        {
+          best_length = patterns[i].size();
+          best_index  = i;
+        }
+      }
+
+      if (best_length != 0U)
+      {
+        return etl::pattern_match(start, best_length, best_index);
+      }
+    }
+
+    return etl::pattern_match();
+  }
+
+  SUITE(test_multi_pattern_matcher)
+  {
+    //*************************************************************************
+    TEST(test_add)
+    {
+      Matcher matcher;
+
+      CHECK(matcher.empty());
+      CHECK_EQUAL(1U, matcher.states());
+      CHECK_EQUAL(64U, matcher.max_states());
+
+      CHECK_EQUAL(0U, matcher.add("he"));
+      CHECK_EQUAL(1U, matcher.add(etl::string_view("she")));
+      CHECK_EQUAL(2U, matcher.add(etl::string<10>("hers")));
+      CHECK_EQUAL(0U, matcher.add("he", 2U));
+
+      CHECK_EQUAL(3U, matcher.size());
+      CHECK_EQUAL(8U, matcher.states());
+      CHECK(!matcher.is_built());
+
+      matcher.build();
+      CHECK(matcher.is_built());
+
+      matcher.clear();
+      CHECK(matcher.empty());
+      CHECK_EQUAL(1U, matcher.states());
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      Matcher matcher;
+
+      matcher.add("he");
+      matcher.add("she");
+      matcher.add("his");
+      matcher.add("hers");
+      matcher.build();
+
+      etl::string_view text("ushers and this");
+
+      etl::pattern_match match = matcher.find(text);
+      CHECK(match.found());
+      CHECK_EQUAL(1U, match.position);
+      CHECK_EQUAL(3U, match.length);
+      CHECK_EQUAL(1U, match.index);
+
+      // "he" and "hers" start at 2. The longer wins.
+      match = etl::find_any(text, matcher, 2U);
+      CHECK_EQUAL(2U, match.position);
+      CHECK_EQUAL(4U, match.length);
+      CHECK_EQUAL(3U, match.index);
+
+      match = etl::find_any(text, matcher, 3U);
+      CHECK_EQUAL(12U, match.position);
+      CHECK_EQUAL(2U, match.index);
+
+      match = etl::find_any(text, matcher, 13U);
+      CHECK(!match.found());
+      CHECK_EQUAL(etl::pattern_match::npos, match.position);
+    }
+
+    //*************************************************************************
+    TEST(test_find_against_reference)
+    {
+      std::vector<std::string> patterns;
+      patterns.push_back("ab");
+      patterns.push_back("abc");
+      patterns.push_back("bca");
+      patterns.push_back("c");
+      patterns.push_back("aab");
+      patterns.push_back("bbbb");
+      patterns.push_back("cab");
+
+      Matcher matcher;
+
+      for (size_t i = 0U; i < patterns.size(); ++i)
+      {
+        CHECK_EQUAL(i, matcher.add(patterns[i].c_str()));
+      }
+
+      matcher.build();
+
+      uint32_t seed = 12345U;
+
+      for (int test = 0; test < 200; ++test)
+      {
+        std::string text;
+
+        for (int i = 0; i < 40; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          text.push_back(char('a' + ((seed >> 16) % 4U)));
+        }
+
+        for (size_t position = 0U; position <= text.size(); position += 7U)
+        {
+          etl::pattern_match expected = reference_find(text, patterns, position);
+          etl::pattern_match actual   = matcher.find(text.data(), text.size(), position);
+
+          CHECK_EQUAL(expected.position, actual.position);
+          CHECK_EQUAL(expected.length,   actual.length);
+          CHECK_EQUAL(expected.index,    actual.index);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_replace_strings)
+    {
+      Matcher matcher;
+
+      matcher.add("&");
+      matcher.add("<");
+      matcher.add(">");
+      matcher.add("\"");
+      matcher.build();
+
+      const char* replacements[] = { "&amp;", "&lt;", "&gt;", "&quot;" };
+
+      etl::string<100> text("<a href=\"x\">Fish & Chips</a>");
+
+      etl::replace_strings(text, matcher, replacements);
+
+      // The '&' of the inserted text is not replaced again.
+      CHECK(etl::string<100>("&lt;a href=&quot;x&quot;&gt;Fish &amp; Chips&lt;/a&gt;") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_replace_strings_shorter_and_overlapping)
+    {
+      Matcher matcher;
+
+      matcher.add("abc");
+      matcher.add("bcd");
+      matcher.add("abcd");
+      matcher.build();
+
+      const char* replacements[] = { "1", "2", "" };
+
+      etl::string<50> text("xabcdxbcdxabcabc");
+
+      etl::replace_strings(text, matcher, replacements);
+
+      CHECK(etl::string<50>("xx2x11") == text);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::multi_pattern_matcher<char, 6> matcher;
+
+      CHECK_EQUAL(0U, matcher.add("abc"));
+      CHECK_EQUAL(1U, matcher.add("abde"));
+      CHECK_EQUAL(6U, matcher.states());
+
+      CHECK_THROW(matcher.add("x"), etl::multi_pattern_matcher_full);
+
+      // Prefixes of existing patterns need no more states.
+      CHECK_EQUAL(2U, matcher.add("ab"));
+      CHECK_EQUAL(6U, matcher.states());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      Matcher matcher;
+
+      CHECK_THROW(matcher.add(""), etl::multi_pattern_matcher_empty_pattern);
+
+      matcher.add("abc");
+      CHECK_THROW(matcher.find(etl::string_view("abc")), etl::multi_pattern_matcher_not_built);
+
+      matcher.build();
+      CHECK(matcher.find(etl::string_view("abc")).found());
+
+      matcher.add("def");
+      CHECK_THROW(matcher.find(etl::string_view("abc")), etl::multi_pattern_matcher_not_built);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      etl::multi_pattern_matcher<wchar_t, 20> matcher;
+
+      matcher.add(L"cat");
+      matcher.add(L"dog");
+      matcher.build();
+
+      const wchar_t* replacements[] = { L"dog", L"cat" };
+
+      etl::wstring<50> text(L"The cat chased the dog.");
+
+      etl::replace_strings(text, matcher, replacements);
+
+      CHECK(etl::wstring<50>(L"The dog chased the cat.") == text);
+    }
+  }
+}
@@ -36,6 +36,8 @@ SOFTWARE.
 #include <forward_list>
 #include <array>
 #include <functional>
+#include <vector>
+#include <utility>
 
 namespace
 {
@@ -426,5 +428,58 @@ namespace
 
       outer.detach_all();
     }
+
+    //*************************************************************************
+    TEST(run_passes_of_the_inner_loop)
+    {
+      StepperOuter stepper(2);
+      Outer        rows(0, 3);
+      Outer        columns(10, 20, stepper);
+
+      rows.append(columns);
+
+      // The columns of one pass.
+      int values[8];
+      const size_t count = columns.values(etl::span<int>(values));
+
+      CHECK_EQUAL(5U, count);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        CHECK_EQUAL(int(10 + (2 * i)), values[i]);
+      }
+
+      // Stops when the output is full.
+      CHECK_EQUAL(2U, columns.values(etl::span<int>(values, 2U)));
+
+      // A pass at a time gives the same as an element at a time.
+      std::vector<std::pair<int, int>> expected;
+      std::vector<std::pair<int, int>> actual;
+
+      for (rows.start(); !rows.completed(); rows.next())
+      {
+        expected.push_back(std::make_pair(rows.value(), columns.value()));
+      }
+
+      for (rows.start(); !rows.completed(); rows.next_pass())
+      {
+        CHECK_EQUAL(10, columns.value());
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          actual.push_back(std::make_pair(rows.value(), values[i]));
+        }
+      }
+
+      CHECK(expected == actual);
+
+      // The innermost range on its own makes one pass.
+      columns.start();
+      CHECK(!columns.completed());
+      columns.next_pass();
+      CHECK(columns.completed());
+
+      rows.detach_all();
+    }
   };
 }
@@ -1244,5 +1244,72 @@ namespace
 
       CHECK(pass);
     }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::multimap<int, std::string, 4> Map;
+      Map data;
+
+      Map::iterator itr = data.emplace(1, "one");
+      CHECK_EQUAL(1, itr->first);
+      CHECK_EQUAL(std::string("one"), itr->second);
+
+      itr = data.emplace(1, "uno");
+      CHECK_EQUAL(std::string("uno"), itr->second);
+
+      itr = data.emplace_hint(data.begin(), 0, "zero");
+      CHECK_EQUAL(0, itr->first);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK_EQUAL(std::string("zero"), data.begin()->second);
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::multimap<int, std::string, 4> Map;
+      Map data;
+
+      data.insert(std::make_pair(1, std::string("one")));
+      data.insert(std::make_pair(1, std::string("uno")));
+      data.insert(std::make_pair(2, std::string("two")));
+
+      Map::node_type node = data.extract(2);
+      CHECK_EQUAL(2, node.key());
+      CHECK_EQUAL(std::string("two"), node.mapped());
+      CHECK_EQUAL(2U, data.size());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      Map::iterator itr = data.insert(std::move(node));
+      CHECK(node.empty());
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(3U, data.size());
+
+      node = data.extract(1);
+      CHECK_EQUAL(1U, data.count(1));
+      itr = data.insert(data.cend(), std::move(node));
+      CHECK_EQUAL(2U, data.count(1));
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::multimap<int, std::string, 4> data0;
+      etl::multimap<int, std::string, 6> data1;
+
+      data0.insert(std::make_pair(1, std::string("one")));
+      data0.insert(std::make_pair(2, std::string("two")));
+      data1.insert(std::make_pair(2, std::string("deux")));
+
+      data1.merge(data0);
+
+      CHECK(data0.empty());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(1U, data1.count(1));
+      CHECK_EQUAL(2U, data1.count(2));
+    }
   };
 }
@@ -1250,5 +1250,65 @@ namespace
 
       CHECK(pass);
     }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::multiset<std::string, 4> Set;
+      Set data;
+
+      Set::iterator itr = data.emplace(3U, 'b');
+      CHECK_EQUAL(std::string("bbb"), *itr);
+
+      itr = data.emplace("bbb");
+      CHECK_EQUAL(std::string("bbb"), *itr);
+
+      itr = data.emplace_hint(data.end(), 2U, 'a');
+      CHECK_EQUAL(std::string("aa"), *itr);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count("bbb"));
+      CHECK_EQUAL(std::string("aa"), *data.begin());
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::multiset<int, 4> Set;
+      Set data;
+
+      data.insert(1);
+      data.insert(1);
+      data.insert(2);
+
+      Set::node_type node = data.extract(1);
+      CHECK_EQUAL(1, node.value());
+      CHECK_EQUAL(1U, data.count(1));
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      Set::iterator itr = data.insert(std::move(node));
+      CHECK(node.empty());
+      CHECK_EQUAL(1, *itr);
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::multiset<int, 4> data0;
+      etl::multiset<int, 6> data1;
+
+      data0.insert(1);
+      data0.insert(2);
+      data1.insert(2);
+
+      data1.merge(data0);
+
+      CHECK(data0.empty());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(2U, data1.count(2));
+    }
   };
 }
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <list>
 #include <stdint.h>
 
 #include "etl/murmur3.h"
@@ -110,6 +111,120 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_high_bytes)
+    {
+      std::vector<char> data;
+
+      for (size_t i = 0UL; i < 259UL; ++i)
+      {
+        data.push_back(char(255U - i));
+      }
+
+      uint32_t hash = etl::murmur3<uint32_t>(data.begin(), data.end());
+
+      uint32_t compare;
+      MurmurHash3_x86_32(&*data.begin(), data.size(), 0, &compare);
+
+      CHECK_EQUAL(compare, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_after_partial_block)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      for (size_t split = 0UL; split < 8UL; ++split)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        for (size_t i = 0UL; i < split; ++i)
+        {
+          murmur3_32_calculator.add(data[i]);
+        }
+
+        murmur3_32_calculator.add(data.begin() + split, data.end());
+
+        uint32_t hash = murmur3_32_calculator.value();
+
+        uint32_t compare;
+        MurmurHash3_x86_32(data.c_str(), data.size(), 0, &compare);
+
+        CHECK_EQUAL(compare, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_ranges_of_different_lengths)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.c_str(), data.size(), 0, &compare);
+
+      for (size_t length = 1UL; length < 10UL; ++length)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        std::string::const_iterator itr = data.begin();
+        size_t next_length = length;
+
+        // Ranges of length, length + 1, ... up to the end of the data.
+        while (itr != data.end())
+        {
+          const size_t remaining = size_t(data.end() - itr);
+          const size_t n = (next_length < remaining) ? next_length : remaining;
+
+          murmur3_32_calculator.add(itr, itr + n);
+          itr += n;
+          ++next_length;
+        }
+
+        CHECK_EQUAL(compare, murmur3_32_calculator.value());
+      }
+
+      // 1, 2 and 4 bytes.
+      const uint8_t bytes[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+      etl::murmur3<uint32_t> murmur3_32_calculator;
+      murmur3_32_calculator.add(bytes,     bytes + 1);
+      murmur3_32_calculator.add(bytes + 1, bytes + 3);
+      murmur3_32_calculator.add(bytes + 3, bytes + 7);
+
+      MurmurHash3_x86_32(bytes, sizeof(bytes), 0, &compare);
+
+      CHECK_EQUAL(compare, murmur3_32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_non_random_access)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+      std::list<char> data_list(data.begin(), data.end());
+
+      uint32_t hash = etl::murmur3<uint32_t>(data_list.begin(), data_list.end());
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.c_str(), data.size(), 0, &compare);
+
+      CHECK_EQUAL(compare, hash);
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_murmur3_32_constexpr)
+    {
+      constexpr char data[] = "123456789";
+
+      constexpr uint32_t hash = etl::murmur3<uint32_t>(data, data + 9).value();
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data, 9, 0, &compare);
+
+      CHECK_EQUAL(compare, hash);
+    }
+#endif
   };
 }
 
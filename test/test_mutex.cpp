@@ -0,0 +1,212 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/mutex.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  const size_t Threads    = 4U;
+  const int    Iterations = 20000;
+
+  //***************************************************************************
+  /// Increments an unguarded counter from several threads under the lock.
+  //***************************************************************************
+  template <typename TMutex>
+  int count_under_lock(TMutex& mutex)
+  {
+    int counter = 0;
+
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0U; t < Threads; ++t)
+    {
+      threads.push_back(std::thread([&mutex, &counter]()
+      {
+        for (int i = 0; i < Iterations; ++i)
+        {
+          mutex.lock();
+          ++counter;
+          mutex.unlock();
+        }
+      }));
+    }
+
+    for (size_t t = 0U; t < Threads; ++t)
+    {
+      threads[t].join();
+    }
+
+    return counter;
+  }
+
+  SUITE(test_mutex)
+  {
+    //*************************************************************************
+    TEST(test_spin_mutex_try_lock)
+    {
+      etl::spin_mutex mutex;
+
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      mutex.lock();
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_spin_mutex_multiple_threads)
+    {
+      etl::spin_mutex mutex;
+
+      CHECK_EQUAL(int(Threads) * Iterations, count_under_lock(mutex));
+    }
+
+    //*************************************************************************
+    TEST(test_ticket_mutex_try_lock)
+    {
+      etl::ticket_mutex mutex;
+
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      mutex.lock();
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_ticket_mutex_multiple_threads)
+    {
+      etl::ticket_mutex mutex;
+
+      CHECK_EQUAL(int(Threads) * Iterations, count_under_lock(mutex));
+    }
+
+    //*************************************************************************
+    TEST(test_shared_mutex_try_lock)
+    {
+      etl::shared_mutex mutex;
+
+      // Readers share.
+      CHECK(mutex.try_lock_shared());
+      CHECK(mutex.try_lock_shared());
+      CHECK(!mutex.try_lock());
+      mutex.unlock_shared();
+      CHECK(!mutex.try_lock());
+      mutex.unlock_shared();
+
+      // Writers exclude everyone.
+      CHECK(mutex.try_lock());
+      CHECK(!mutex.try_lock());
+      CHECK(!mutex.try_lock_shared());
+      mutex.unlock();
+
+      mutex.lock_shared();
+      mutex.unlock_shared();
+      mutex.lock();
+      mutex.unlock();
+      CHECK(mutex.try_lock_shared());
+      mutex.unlock_shared();
+    }
+
+    //*************************************************************************
+    TEST(test_shared_mutex_multiple_threads)
+    {
+      etl::shared_mutex mutex;
+
+      CHECK_EQUAL(int(Threads) * Iterations, count_under_lock(mutex));
+    }
+
+    //*************************************************************************
+    TEST(test_shared_mutex_readers_and_writers)
+    {
+      etl::shared_mutex mutex;
+
+      // The writers keep the two values equal. The readers must never see them differ.
+      int a = 0;
+      int b = 0;
+
+      std::vector<std::thread> threads;
+      bool                     errors[Threads] = { false };
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&mutex, &a, &b, &errors, t]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            if ((t == 0U) || ((i % 16) == 0))
+            {
+              mutex.lock();
+              ++a;
+              ++b;
+              mutex.unlock();
+            }
+            else
+            {
+              mutex.lock_shared();
+              if (a != b)
+              {
+                errors[t] = true;
+              }
+              mutex.unlock_shared();
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(!errors[t]);
+      }
+
+      CHECK_EQUAL(a, b);
+    }
+  };
+}
+
+#endif
@@ -482,6 +482,125 @@ namespace
       observable.clear_observers();
       CHECK_EQUAL(size_t(0), observable.number_of_observers());
     }
+
+    //*************************************************************************
+    struct DelegateObserver
+    {
+      DelegateObserver()
+        : total(0)
+        , count(0)
+      {
+      }
+
+      void notification(int n)
+      {
+        total += n;
+        ++count;
+      }
+
+      int total;
+      int count;
+    };
+
+    //*************************************************************************
+    TEST(test_delegate_observable)
+    {
+      typedef etl::delegate_observable<int, 2> Observable;
+
+      class Sensor : public Observable
+      {
+      };
+
+      Sensor sensor;
+
+      DelegateObserver observer1;
+      DelegateObserver observer2;
+      DelegateObserver observer3;
+
+      Observable::delegate_type delegate1 = Observable::delegate_type::create<DelegateObserver, &DelegateObserver::notification>(observer1);
+      Observable::delegate_type delegate2 = Observable::delegate_type::create<DelegateObserver, &DelegateObserver::notification>(observer2);
+      Observable::delegate_type delegate3 = Observable::delegate_type::create<DelegateObserver, &DelegateObserver::notification>(observer3);
+
+      sensor.add_observer(delegate1);
+      sensor.add_observer(delegate2);
+      sensor.add_observer(delegate1);
+      CHECK_EQUAL(size_t(2), sensor.number_of_observers());
+
+      CHECK_THROW(sensor.add_observer(delegate3), etl::observer_list_full);
+
+      sensor.notify_observers(3);
+      sensor.notify_observers(4);
+
+      CHECK_EQUAL(7, observer1.total);
+      CHECK_EQUAL(2, observer1.count);
+      CHECK_EQUAL(7, observer2.total);
+      CHECK_EQUAL(2, observer2.count);
+      CHECK_EQUAL(0, observer3.count);
+
+      CHECK(sensor.remove_observer(delegate1));
+      CHECK(!sensor.remove_observer(delegate1));
+      CHECK_EQUAL(size_t(1), sensor.number_of_observers());
+
+      sensor.notify_observers(5);
+      CHECK_EQUAL(7,  observer1.total);
+      CHECK_EQUAL(12, observer2.total);
+
+      sensor.clear_observers();
+      CHECK_EQUAL(size_t(0), sensor.number_of_observers());
+
+      sensor.notify_observers(6);
+      CHECK_EQUAL(12, observer2.total);
+    }
+
+    //*************************************************************************
+    struct StaticObserver1
+    {
+      StaticObserver1()
+        : data1_count(0)
+        , data2_count(0)
+      {
+      }
+
+      void notification(const Notification1&) { ++data1_count; }
+      void notification(const Notification2&) { ++data2_count; }
+
+      int data1_count;
+      int data2_count;
+    };
+
+    struct StaticObserver2 : public DelegateObserver
+    {
+      void notification(const Notification1&) { ++count; }
+    };
+
+    //*************************************************************************
+    TEST(test_static_observable)
+    {
+      StaticObserver1 observer1a;
+      StaticObserver1 observer1b;
+      StaticObserver2 observer2;
+
+      etl::static_observable<StaticObserver1, StaticObserver2, StaticObserver1> observable(observer1a, observer2, observer1b);
+
+      CHECK_EQUAL(size_t(3), observable.number_of_observers());
+
+      observable.notify_observers(Notification1());
+      observable.notify_observers(Notification1());
+
+      CHECK_EQUAL(2, observer1a.data1_count);
+      CHECK_EQUAL(0, observer1a.data2_count);
+      CHECK_EQUAL(2, observer1b.data1_count);
+      CHECK_EQUAL(2, observer2.count);
+
+      etl::static_observable<StaticObserver1> observable1(observer1a);
+
+      CHECK_EQUAL(size_t(1), observable1.number_of_observers());
+
+      observable1.notify_observers(Notification2());
+
+      CHECK_EQUAL(2, observer1a.data1_count);
+      CHECK_EQUAL(1, observer1a.data2_count);
+      CHECK_EQUAL(0, observer1b.data2_count);
+    }
   }
 }
-
@@ -0,0 +1,220 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/packed_array.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  SUITE(test_packed_array)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      CHECK_EQUAL(1U,   (etl::packed_array<3, 21>::Words));
+      CHECK_EQUAL(2U,   (etl::packed_array<3, 22>::Words));
+      CHECK_EQUAL(16U,  (etl::packed_array<12, 85>::Words));
+      CHECK_EQUAL(79U,  (etl::packed_array<5, 1000>::Words));
+      CHECK_EQUAL(1000U, (etl::packed_array<5, 1000>().size()));
+
+      CHECK((etl::is_same<uint8_t,  etl::packed_array<5,  1>::value_type>::value));
+      CHECK((etl::is_same<uint16_t, etl::packed_array<12, 1>::value_type>::value));
+      CHECK((etl::is_same<uint32_t, etl::packed_array<17, 1>::value_type>::value));
+
+      CHECK(sizeof(etl::packed_array<5, 1000>) < (1000U * sizeof(uint8_t)));
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::packed_array<5, 100> data;
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(0U, data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fill_constructor)
+    {
+      etl::packed_array<3, 50> data(6U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(6U, data[i]);
+      }
+
+      // Unused bits in the last word are clear.
+      CHECK_EQUAL(0U, data.data()[data.data_size() - 1U] >> ((3U * 50U) % etl::packed_array<3, 50>::Word_Bits));
+    }
+
+    //*************************************************************************
+    template <size_t VBits, size_t VSize>
+    void check_get_set()
+    {
+      typedef etl::packed_array<VBits, VSize> Array;
+
+      Array data;
+      std::vector<uint32_t> compare(VSize);
+
+      const uint32_t mask = uint32_t(etl::max_value_for_nbits<VBits>::value);
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        compare[i] = uint32_t((i * 2654435761U) >> 7) & mask;
+        data[i] = typename Array::value_type(compare[i]);
+      }
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        CHECK_EQUAL(compare[i], uint32_t(data[i]));
+        CHECK_EQUAL(compare[i], uint32_t(data.get(i)));
+      }
+
+      // Overwrite every other element.
+      for (size_t i = 0U; i < VSize; i += 2U)
+      {
+        compare[i] = mask - compare[i];
+        data.set(i, typename Array::value_type(compare[i]));
+      }
+
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        CHECK_EQUAL(compare[i], uint32_t(data[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_get_set)
+    {
+      check_get_set<1, 130>();
+      check_get_set<3, 200>();
+      check_get_set<5, 200>();
+      check_get_set<12, 200>();
+      check_get_set<17, 100>();
+      check_get_set<31, 100>();
+      check_get_set<32, 100>();
+    }
+
+    //*************************************************************************
+    TEST(test_set_ignores_extra_bits)
+    {
+      etl::packed_array<5, 3> data;
+
+      data[1] = 0xFFU;
+
+      CHECK_EQUAL(0U,    data[0]);
+      CHECK_EQUAL(0x1FU, data[1]);
+      CHECK_EQUAL(0U,    data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_reference)
+    {
+      etl::packed_array<12, 4> data;
+
+      data[0] = 0x123U;
+      data[3] = data[0];
+
+      const etl::packed_array<12, 4>& cdata = data;
+
+      CHECK_EQUAL(0x123U, cdata[3]);
+      CHECK_EQUAL(0x123U, data.front());
+      CHECK_EQUAL(0x123U, cdata.back());
+
+      data.back() = 0x456U;
+      CHECK_EQUAL(0x456U, data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_unpack_pack)
+    {
+      etl::packed_array<12, 10> data;
+
+      const uint16_t input[] = { 1, 2, 4000, 4095, 5, 6, 7, 8, 9, 10 };
+
+      CHECK_EQUAL(10U, data.pack(input, 10U));
+
+      uint32_t output[10];
+
+      CHECK_EQUAL(10U, data.unpack(output, 10U));
+
+      for (size_t i = 0U; i < 10U; ++i)
+      {
+        CHECK_EQUAL(input[i], output[i]);
+      }
+
+      // From a position, limited by the size.
+      uint32_t part[8] = { 0 };
+
+      CHECK_EQUAL(3U, data.unpack(part, 8U, 7U));
+      CHECK_EQUAL(8U,  part[0]);
+      CHECK_EQUAL(10U, part[2]);
+      CHECK_EQUAL(0U,  data.unpack(part, 8U, 10U));
+
+      CHECK_EQUAL(2U, data.pack(input, 5U, 8U));
+      CHECK_EQUAL(1U, data[8]);
+      CHECK_EQUAL(2U, data[9]);
+    }
+
+    //*************************************************************************
+    TEST(test_unpack_pack_span)
+    {
+      etl::packed_array<5, 6> data;
+
+      uint32_t input[]  = { 31, 0, 17, 3, 8, 30 };
+      uint32_t output[6];
+
+      CHECK_EQUAL(6U, data.pack(etl::span<const uint32_t>(input, 6U)));
+      CHECK_EQUAL(6U, data.unpack(etl::span<uint32_t>(output, 6U)));
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        CHECK_EQUAL(input[i], output[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      etl::packed_array<3, 30> data1(5U);
+      etl::packed_array<3, 30> data2(5U);
+
+      CHECK(data1 == data2);
+
+      data2[29] = 4U;
+      CHECK(data1 != data2);
+    }
+  }
+}
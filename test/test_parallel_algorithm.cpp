@@ -0,0 +1,320 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/parallel_algorithm.h"
+#include "etl/vector.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <random>
+#include <atomic>
+#include <string>
+
+namespace
+{
+#if ETL_HAS_THREAD_EXECUTOR
+  typedef etl::thread_executor<8> ThreadExecutor;
+#else
+  class ThreadExecutor : public etl::sequential_executor
+  {
+  public:
+
+    explicit ThreadExecutor(size_t)
+    {
+    }
+  };
+#endif
+
+  //***************************************************************************
+  // Records how many tasks it was asked to run.
+  //***************************************************************************
+  class CountingExecutor : public etl::iexecutor
+  {
+  public:
+
+    CountingExecutor()
+      : n_runs(0U)
+      , n_tasks(0U)
+    {
+    }
+
+    size_t concurrency() const override
+    {
+      return 4U;
+    }
+
+    void run(size_t n_tasks_, task_type task) override
+    {
+      ++n_runs;
+      n_tasks += n_tasks_;
+
+      // Run backwards, to show that the order does not matter.
+      for (size_t i = n_tasks_; i != 0U; --i)
+      {
+        task(i - 1U);
+      }
+    }
+
+    size_t n_runs;
+    size_t n_tasks;
+  };
+
+  std::vector<int> make_data(size_t size, uint32_t seed)
+  {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+
+    std::vector<int> data(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      data[i] = distribution(generator);
+    }
+
+    return data;
+  }
+
+  SUITE(test_parallel_algorithm)
+  {
+#if ETL_HAS_THREAD_EXECUTOR
+    //*************************************************************************
+    TEST(test_thread_executor_runs_each_task_once)
+    {
+      ThreadExecutor executor(4U);
+
+      CHECK_EQUAL(4U, executor.concurrency());
+
+      for (size_t run = 0U; run < 100U; ++run)
+      {
+        const size_t n_tasks = 1U + (run % 37U);
+        std::vector<std::atomic<int>> counts(n_tasks);
+
+        auto task = [&](size_t i) { ++counts[i]; };
+
+        executor.run(n_tasks, etl::iexecutor::task_type(task));
+
+        for (size_t i = 0U; i < n_tasks; ++i)
+        {
+          CHECK_EQUAL(1, counts[i].load());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_thread_executor_thread_count_is_clamped)
+    {
+      ThreadExecutor none(0U);
+      ThreadExecutor many(100U);
+
+      CHECK_EQUAL(1U, none.concurrency());
+      CHECK_EQUAL(8U, many.concurrency());
+
+      int sum = 0;
+      auto task = [&](size_t i) { sum += int(i); };
+
+      none.run(10U, etl::iexecutor::task_type(task));
+
+      CHECK_EQUAL(45, sum);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_for_each)
+    {
+      ThreadExecutor executor(4U);
+
+      std::vector<int> data = make_data(100000U, 1U);
+      std::vector<int> expected(data);
+
+      std::for_each(expected.begin(), expected.end(), [](int& i) { i = (i * 3) + 1; });
+      etl::parallel::for_each(executor, data.begin(), data.end(), [](int& i) { i = (i * 3) + 1; });
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_small_and_empty_ranges)
+    {
+      CountingExecutor executor;
+
+      int data[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::parallel::for_each(executor, data, data, [](int& i) { i = -1; });
+      CHECK_EQUAL(0U, executor.n_tasks);
+      CHECK_EQUAL(0, data[0]);
+
+      etl::parallel::for_each(executor, data, data + 10, [](int& i) { i *= 2; });
+      CHECK_EQUAL(1U, executor.n_tasks);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(i * 2, data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_is_split_into_cache_sized_chunks)
+    {
+      CountingExecutor executor;
+
+      const size_t chunk = ETL_PARALLEL_CHUNK_BYTES / sizeof(int);
+
+      std::vector<int> data((chunk * 5U) + 1U, 1);
+
+      etl::parallel::for_each(executor, data.begin(), data.end(), [](int& i) { ++i; });
+
+      CHECK_EQUAL(6U, executor.n_tasks);
+      CHECK(std::all_of(data.begin(), data.end(), [](int i) { return i == 2; }));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_unary)
+    {
+      ThreadExecutor executor(4U);
+
+      std::vector<int>    data = make_data(100000U, 2U);
+      std::vector<double> expected(data.size());
+      std::vector<double> output(data.size());
+
+      auto operation = [](int i) { return double(i) * 0.5; };
+
+      std::transform(data.begin(), data.end(), expected.begin(), operation);
+      std::vector<double>::iterator result = etl::parallel::transform(executor, data.begin(), data.end(), output.begin(), operation);
+
+      CHECK(result == output.end());
+      CHECK(expected == output);
+    }
+
+    //*************************************************************************
+    TEST(test_transform_binary)
+    {
+      ThreadExecutor executor(4U);
+
+      std::vector<int> data1 = make_data(100000U, 3U);
+      std::vector<int> data2 = make_data(100000U, 4U);
+      std::vector<int> expected(data1.size());
+      etl::vector<int, 100000U> output(data1.size());
+
+      std::transform(data1.begin(), data1.end(), data2.begin(), expected.begin(), std::minus<int>());
+      etl::parallel::transform(executor, data1.begin(), data1.end(), data2.begin(), output.begin(), std::minus<int>());
+
+      CHECK(std::equal(expected.begin(), expected.end(), output.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_reduce)
+    {
+      ThreadExecutor executor(4U);
+
+      std::vector<int> data = make_data(1000000U, 5U);
+
+      long long expected = std::accumulate(data.begin(), data.end(), 10LL);
+
+      CHECK_EQUAL(expected, etl::parallel::reduce(executor, data.begin(), data.end(), 10LL));
+      CHECK_EQUAL(expected - 10LL, etl::parallel::reduce(executor, data.begin(), data.end(), 0LL, std::plus<long long>()));
+      CHECK_EQUAL(int(expected - 10LL), etl::parallel::reduce(executor, data.begin(), data.end()));
+      CHECK_EQUAL(10LL, etl::parallel::reduce(executor, data.begin(), data.begin(), 10LL));
+    }
+
+    //*************************************************************************
+    TEST(test_reduce_combines_partial_results_in_order)
+    {
+      CountingExecutor executor;
+
+      // Concatenation is associative but not commutative.
+      std::vector<std::string> data(ETL_PARALLEL_CHUNK_BYTES);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = std::string(1U, char('a' + (i % 26U)));
+      }
+
+      std::string expected = std::accumulate(data.begin(), data.end(), std::string(">"));
+      std::string result   = etl::parallel::reduce(executor, data.begin(), data.end(), std::string(">"));
+
+      CHECK(executor.n_tasks > 1U);
+      CHECK(executor.n_tasks <= ETL_PARALLEL_MAX_REDUCE_BLOCKS);
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(test_sort)
+    {
+      ThreadExecutor executor(4U);
+
+      for (size_t size : { size_t(0U), size_t(10U), size_t(4097U), size_t(100000U), size_t(1000003U) })
+      {
+        std::vector<int> data     = make_data(size, uint32_t(size));
+        std::vector<int> expected = data;
+
+        std::sort(expected.begin(), expected.end());
+        etl::parallel::sort(executor, data.begin(), data.end());
+
+        CHECK(expected == data);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_sort_greater)
+    {
+      CountingExecutor executor;
+
+      std::vector<int> data     = make_data(100000U, 6U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      etl::parallel::sort(executor, data.begin(), data.end(), std::greater<int>());
+
+      // Four parts sorted, then two merge rounds.
+      CHECK_EQUAL(3U, executor.n_runs);
+      CHECK_EQUAL(4U + 2U + 1U, executor.n_tasks);
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_sequential_executor)
+    {
+      etl::sequential_executor executor;
+
+      std::vector<int> data     = make_data(50000U, 7U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end());
+      etl::parallel::sort(executor, data.begin(), data.end());
+
+      CHECK_EQUAL(1U, executor.concurrency());
+      CHECK(expected == data);
+      CHECK_EQUAL(std::accumulate(data.begin(), data.end(), 0LL), etl::parallel::reduce(executor, data.begin(), data.end(), 0LL));
+    }
+  }
+}
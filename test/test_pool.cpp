@@ -381,6 +381,39 @@ namespace
       CHECK_NO_THROW(p3 = pool.allocate<double>());
       CHECK_NO_THROW(p4 = pool.allocate<Test_Data>());
     }
+
+    //*************************************************************************
+    TEST(test_allocate_release_unchecked)
+    {
+      etl::pool<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate_unchecked();
+      Test_Data* p2 = pool.allocate_unchecked();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate_unchecked();
+
+      CHECK(pool.full());
+      CHECK(pool.is_in_pool(p1));
+      CHECK(pool.is_in_pool(p2));
+      CHECK(pool.is_in_pool(p4));
+      CHECK(p1 != p2);
+      CHECK(p2 != p4);
+
+      pool.release_unchecked(p2);
+      pool.release(p3);
+      CHECK_EQUAL(2U, pool.size());
+
+      // Released items are reused, most recent first.
+      CHECK(p3 == pool.allocate_unchecked());
+      CHECK(p2 == pool.allocate_unchecked());
+      CHECK(pool.full());
+
+      etl::generic_pool<sizeof(uint32_t), etl::alignment_of<uint32_t>::value, 1> gpool;
+      uint32_t* pg = gpool.allocate_unchecked<uint32_t>();
+      CHECK(gpool.is_in_pool(pg));
+      gpool.release_unchecked(pg);
+      CHECK(gpool.empty());
+    }
   };
 
   //*************************************************************************
@@ -449,6 +482,187 @@ namespace
     int* i = pool.allocate();
     pool.release(i);
   }
+
+  //*************************************************************************
+  TEST(test_allocate_n_release_n)
+  {
+    etl::pool<int, 8> pool;
+
+    int* items[8];
+
+    // All from the unused items.
+    CHECK_EQUAL(5U, pool.allocate_n(items, 5U));
+    CHECK_EQUAL(5U, pool.size());
+    CHECK_EQUAL(3U, pool.available());
+
+    std::set<int*> unique(items, items + 5);
+    CHECK_EQUAL(5U, unique.size());
+
+    for (size_t i = 0U; i < 5U; ++i)
+    {
+      CHECK(pool.is_in_pool(items[i]));
+      *items[i] = int(i);
+    }
+
+    // Release a segment from the middle.
+    pool.release_n(items + 1, 3U);
+    CHECK_EQUAL(2U, pool.size());
+    CHECK_EQUAL(0, *items[0]);
+    CHECK_EQUAL(4, *items[4]);
+
+    // Mixed released and unused items.
+    int* more[8];
+    CHECK_EQUAL(6U, pool.allocate_n(more, 6U));
+    CHECK_EQUAL(8U, pool.size());
+    CHECK(pool.full());
+
+    unique.clear();
+    unique.insert(items[0]);
+    unique.insert(items[4]);
+    unique.insert(more, more + 6);
+    CHECK_EQUAL(8U, unique.size());
+
+    for (std::set<int*>::const_iterator itr = unique.begin(); itr != unique.end(); ++itr)
+    {
+      CHECK(pool.is_in_pool(*itr));
+    }
+
+    // Nothing left.
+    CHECK_EQUAL(0U, pool.allocate_n(more, 1U));
+
+    pool.release_n(more, 6U);
+    pool.release(items[0]);
+    pool.release(items[4]);
+    CHECK(pool.empty());
+
+    // Single allocations see the released segments.
+    unique.clear();
+    for (size_t i = 0U; i < 8U; ++i)
+    {
+      unique.insert(pool.allocate());
+    }
+
+    CHECK_EQUAL(8U, unique.size());
+    CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_partial)
+  {
+    etl::pool<int, 4> pool;
+
+    int* p1 = pool.allocate();
+    int* p2 = pool.allocate();
+    pool.release(p1);
+
+    int* items[6];
+    CHECK_EQUAL(3U, pool.allocate_n(items, 6U));
+    CHECK(pool.full());
+    CHECK(items[0] == p1);
+    CHECK(items[1] != p2);
+    CHECK(items[2] != p2);
+
+    pool.release_n(items, 3U);
+    pool.release(p2);
+    CHECK(pool.empty());
+
+    CHECK_EQUAL(4U, pool.allocate_n(items, 4U));
+    CHECK(pool.full());
+    CHECK_EQUAL(0U, pool.allocate_n(items, 0U));
+
+    pool.release_n(items, 0U);
+    CHECK(pool.full());
+  }
+
+  //*************************************************************************
+  TEST(test_release_n_not_in_pool)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[2];
+    pool.allocate_n(items, 2U);
+
+    etl::pool<int, 4> other_pool;
+    int* invalid[2] = { items[0], other_pool.allocate() };
+
+    CHECK_THROW(pool.release_n(invalid, 2U), etl::pool_object_not_in_pool);
+    CHECK_EQUAL(2U, pool.size());
+  }
+
+  //*************************************************************************
+  TEST(test_generic_allocate_n)
+  {
+    etl::generic_pool<sizeof(double), etl::alignment_of<double>::value, 4> pool;
+
+    double* items[4];
+    CHECK_EQUAL(4U, pool.allocate_n(items, 4U));
+    CHECK(pool.full());
+
+    pool.release_n(items, 4U);
+    CHECK(pool.empty());
+  }
+
+#if defined(ETL_POOL_STATISTICS)
+  //*************************************************************************
+  TEST(test_statistics)
+  {
+    etl::pool<int, 3> pool;
+
+    int* p1 = pool.allocate();
+    int* p2 = pool.allocate();
+    pool.release(p1);
+    int* p3 = pool.allocate();
+    int* p4 = pool.allocate();
+
+    CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+    etl::pool_statistics statistics = pool.statistics();
+    CHECK_EQUAL(3U, statistics.size);
+    CHECK_EQUAL(3U, statistics.peak_size);
+    CHECK_EQUAL(4U, statistics.allocations);
+    CHECK_EQUAL(1U, statistics.releases);
+    CHECK_EQUAL(1U, statistics.failures);
+
+    pool.release(p2);
+    pool.release(p3);
+    pool.reset_statistics();
+
+    statistics = pool.statistics();
+    CHECK_EQUAL(1U, statistics.size);
+    CHECK_EQUAL(1U, statistics.peak_size);
+    CHECK_EQUAL(0U, statistics.allocations);
+    CHECK_EQUAL(0U, statistics.releases);
+    CHECK_EQUAL(0U, statistics.failures);
+
+    pool.release(p4);
+    pool.allocate();
+    pool.allocate();
+    pool.release_all();
+
+    statistics = pool.statistics();
+    CHECK_EQUAL(0U, statistics.size);
+    CHECK_EQUAL(2U, statistics.peak_size);
+    CHECK_EQUAL(2U, statistics.allocations);
+    CHECK_EQUAL(3U, statistics.releases);
+  }
+
+  //*************************************************************************
+  TEST(test_statistics_allocate_n)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[6];
+    CHECK_EQUAL(4U, pool.allocate_n(items, 6U));
+    pool.release_n(items, 3U);
+
+    etl::pool_statistics statistics = pool.statistics();
+    CHECK_EQUAL(1U, statistics.size);
+    CHECK_EQUAL(4U, statistics.peak_size);
+    CHECK_EQUAL(4U, statistics.allocations);
+    CHECK_EQUAL(3U, statistics.releases);
+    CHECK_EQUAL(1U, statistics.failures);
+  }
+#endif
 }
 
 #if defined(ETL_COMPILER_GCC)
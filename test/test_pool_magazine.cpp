@@ -0,0 +1,245 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "etl/pool_magazine.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Item
+  {
+    uint32_t owner;
+    uint32_t count;
+  };
+
+  struct D2
+  {
+    D2(const std::string& a_, int b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    std::string a;
+    int         b;
+  };
+
+  typedef etl::atomic_pool<Item, 16> Pool;
+  typedef etl::pool_magazine<4>      Magazine;
+
+  SUITE(test_pool_magazine)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(4U, Magazine::CAPACITY);
+      CHECK_EQUAL(2U, Magazine::BATCH);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_refills_in_batches)
+    {
+      Pool pool;
+      Magazine magazine(pool);
+
+      CHECK(magazine.empty());
+
+      Item* p1 = magazine.allocate<Item>();
+
+      // A batch was taken from the shared pool and one handed out.
+      CHECK_EQUAL(Magazine::BATCH, pool.size());
+      CHECK_EQUAL(Magazine::BATCH - 1U, magazine.size());
+
+      Item* p2 = magazine.allocate<Item>();
+      CHECK_EQUAL(Magazine::BATCH, pool.size());
+      CHECK(magazine.empty());
+
+      Item* p3 = magazine.allocate<Item>();
+      CHECK_EQUAL(2U * Magazine::BATCH, pool.size());
+
+      CHECK(p1 != p2);
+      CHECK(p2 != p3);
+      CHECK(pool.is_in_pool(p1));
+
+      magazine.release(p1);
+      magazine.release(p2);
+      magazine.release(p3);
+    }
+
+    //*************************************************************************
+    TEST(test_release_drains_in_batches)
+    {
+      Pool pool;
+      Magazine magazine(pool);
+
+      Item* items[6];
+      CHECK_EQUAL(6U, pool.allocate_n(items, 6U));
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        magazine.release(items[i]);
+      }
+
+      // Cached, not returned.
+      CHECK(magazine.full());
+      CHECK_EQUAL(6U, pool.size());
+
+      // Full, so the oldest batch goes back to the shared pool.
+      magazine.release(items[4]);
+      CHECK_EQUAL(3U, magazine.size());
+      CHECK_EQUAL(4U, pool.size());
+
+      // The most recently released item is reused first.
+      CHECK(magazine.allocate<Item>() == items[4]);
+      CHECK(magazine.allocate<Item>() == items[3]);
+
+      magazine.release(items[3]);
+      magazine.release(items[4]);
+      magazine.release(items[5]);
+
+      magazine.flush();
+      CHECK(magazine.empty());
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_flushes)
+    {
+      Pool pool;
+
+      {
+        Magazine magazine(pool);
+        magazine.release(magazine.allocate<Item>());
+        CHECK(!pool.empty());
+      }
+
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted)
+    {
+      etl::atomic_pool<Item, 3> pool;
+      Magazine magazine(pool);
+
+      Item* p1 = magazine.try_allocate<Item>();
+      Item* p2 = magazine.try_allocate<Item>();
+      Item* p3 = magazine.try_allocate<Item>();
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(magazine.try_allocate<Item>() == nullptr);
+      CHECK_THROW(magazine.allocate<Item>(), etl::pool_no_allocation);
+
+      // Too large for the pool.
+      CHECK(magazine.try_allocate<double[4]>() == nullptr);
+
+      Item not_in_pool;
+      CHECK_THROW(magazine.release(&not_in_pool), etl::pool_object_not_in_pool);
+
+      magazine.release(p1);
+      magazine.release(p2);
+      magazine.release(p3);
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::atomic_pool<D2, 4> pool;
+      etl::pool_magazine<2> magazine(pool);
+
+      D2* p = magazine.create<D2>("two", 2);
+      CHECK_EQUAL(std::string("two"), p->a);
+      CHECK_EQUAL(2, p->b);
+
+      magazine.destroy(p);
+      magazine.flush();
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_magazine_per_thread)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 20000U;
+
+      Pool pool;
+
+      std::vector<std::thread> threads;
+      bool                     errors[Threads] = { false };
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&pool, &errors, t, Iterations]()
+        {
+          Magazine magazine(pool);
+
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            Item* p_item = magazine.allocate<Item>();
+
+            p_item->owner = uint32_t(t);
+            p_item->count = uint32_t(i);
+
+            std::this_thread::yield();
+
+            if ((p_item->owner != t) || (p_item->count != i))
+            {
+              errors[t] = true;
+            }
+
+            magazine.release(p_item);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK(!errors[t]);
+      }
+
+      CHECK(pool.empty());
+    }
+  };
+}
+
+#endif
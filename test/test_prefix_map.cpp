@@ -0,0 +1,262 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/prefix_map.h"
+#include "etl/string_view.h"
+
+#include <map>
+#include <random>
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace
+{
+  uint32_t ip(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+  {
+    return (a << 24) | (b << 16) | (c << 8) | d;
+  }
+
+  typedef etl::prefix_map<uint32_t, int, 16>             Routes;
+  typedef etl::prefix_map<etl::string_view, int, 16>     Topics;
+
+  //***************************************************************************
+  struct Collect
+  {
+    Collect(std::vector<int>& values_)
+      : values(values_)
+    {
+    }
+
+    void operator()(int value)
+    {
+      values.push_back(value);
+    }
+
+    std::vector<int>& values;
+  };
+
+  //***************************************************************************
+  // The longest matching prefix, by checking every entry.
+  //***************************************************************************
+  int reference_match(const std::map<std::pair<size_t, uint16_t>, int>& entries, uint16_t key)
+  {
+    int    result = -1;
+    size_t best   = 0U;
+
+    for (std::map<std::pair<size_t, uint16_t>, int>::const_iterator itr = entries.begin(); itr != entries.end(); ++itr)
+    {
+      const size_t length = itr->first.first;
+      const uint16_t mask = (length == 0U) ? uint16_t(0U) : uint16_t(0xFFFFU << (16U - length));
+
+      if (((key & mask) == itr->first.second) && ((result == -1) || (length > best)))
+      {
+        result = itr->second;
+        best   = length;
+      }
+    }
+
+    return result;
+  }
+
+  SUITE(test_prefix_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Routes routes;
+
+      CHECK(routes.empty());
+      CHECK(!routes.full());
+      CHECK_EQUAL(0U,  routes.size());
+      CHECK_EQUAL(16U, routes.max_size());
+      CHECK_EQUAL(16U, routes.available());
+      CHECK(routes.longest_prefix_match(ip(10, 0, 0, 1)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_integer_longest_prefix_match)
+    {
+      Routes routes;
+
+      CHECK(routes.insert(0U,                   0U,  0)); // Default route.
+      CHECK(routes.insert(ip(10, 0, 0, 0),      8U,  1));
+      CHECK(routes.insert(ip(10, 1, 0, 0),      16U, 2));
+      CHECK(routes.insert(ip(10, 1, 2, 0),      24U, 3));
+      CHECK(routes.insert(ip(192, 168, 0, 0),   16U, 4));
+      CHECK(routes.insert(ip(192, 168, 1, 7),        5));
+      CHECK(!routes.insert(ip(10, 1, 0, 0),     16U, 6)); // Already there.
+
+      CHECK_EQUAL(6U, routes.size());
+
+      CHECK_EQUAL(3, *routes.longest_prefix_match(ip(10, 1, 2, 3)));
+      CHECK_EQUAL(2, *routes.longest_prefix_match(ip(10, 1, 3, 3)));
+      CHECK_EQUAL(1, *routes.longest_prefix_match(ip(10, 2, 2, 3)));
+      CHECK_EQUAL(0, *routes.longest_prefix_match(ip(11, 1, 2, 3)));
+      CHECK_EQUAL(4, *routes.longest_prefix_match(ip(192, 168, 1, 6)));
+      CHECK_EQUAL(5, *routes.longest_prefix_match(ip(192, 168, 1, 7)));
+
+      CHECK_EQUAL(2, *routes.find(ip(10, 1, 0, 0), 16U));
+      CHECK(routes.find(ip(10, 1, 0, 0), 12U) == nullptr);
+      CHECK(routes.find(ip(10, 1, 0, 0)) == nullptr);
+      CHECK(routes.contains(ip(192, 168, 1, 7)));
+      CHECK(routes.contains(ip(10, 1, 99, 99), 8U));
+
+      // Erasing an entry with two children leaves a branch.
+      CHECK_EQUAL(1U, routes.erase(ip(10, 1, 0, 0), 16U));
+      CHECK_EQUAL(0U, routes.erase(ip(10, 1, 0, 0), 16U));
+      CHECK_EQUAL(1, *routes.longest_prefix_match(ip(10, 1, 3, 3)));
+      CHECK_EQUAL(3, *routes.longest_prefix_match(ip(10, 1, 2, 3)));
+
+      CHECK_EQUAL(1U, routes.erase(0U, 0U));
+      CHECK(routes.longest_prefix_match(ip(11, 1, 2, 3)) == nullptr);
+
+      CHECK_EQUAL(4U, routes.size());
+
+      routes.clear();
+      CHECK(routes.empty());
+      CHECK(routes.longest_prefix_match(ip(10, 1, 2, 3)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_string_prefixes)
+    {
+      Topics topics;
+
+      CHECK(topics.insert(etl::string_view("sensor/"),              1));
+      CHECK(topics.insert(etl::string_view("sensor/temperature/"),  2));
+      CHECK(topics.insert(etl::string_view("sensor/temperature/3"), 3));
+      CHECK(topics.insert(etl::string_view("motor/"),               4));
+
+      CHECK_EQUAL(2, *topics.longest_prefix_match(etl::string_view("sensor/temperature/1")));
+      CHECK_EQUAL(3, *topics.longest_prefix_match(etl::string_view("sensor/temperature/3")));
+      CHECK_EQUAL(1, *topics.longest_prefix_match(etl::string_view("sensor/humidity/1")));
+      CHECK_EQUAL(4, *topics.longest_prefix_match(etl::string_view("motor/left")));
+      CHECK(topics.longest_prefix_match(etl::string_view("sensor")) == nullptr);
+      CHECK(topics.longest_prefix_match(etl::string_view("light/1")) == nullptr);
+
+      std::vector<int> matches;
+      topics.for_each_match(etl::string_view("sensor/temperature/3"), Collect(matches));
+
+      CHECK_EQUAL(3U, matches.size());
+      CHECK_EQUAL(1, matches[0]);
+      CHECK_EQUAL(2, matches[1]);
+      CHECK_EQUAL(3, matches[2]);
+
+      // Prefix lengths are in bits.
+      CHECK(topics.find(etl::string_view("motor/left"), 6U * 8U) != nullptr);
+      CHECK_THROW(topics.find(etl::string_view("motor"), 6U * 8U), etl::prefix_map_out_of_bounds);
+
+      CHECK_EQUAL(1U, topics.erase(etl::string_view("sensor/temperature/")));
+      CHECK_EQUAL(1, *topics.longest_prefix_match(etl::string_view("sensor/temperature/1")));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::prefix_map<uint8_t, int, 4> map;
+
+      CHECK(map.insert(0x10U, 1));
+      CHECK(map.insert(0x20U, 2));
+      CHECK(map.insert(0x30U, 3));
+      CHECK(map.insert(0x40U, 4));
+      CHECK(map.full());
+
+      CHECK_THROW(map.insert(0x50U, 5), etl::prefix_map_full);
+      CHECK_THROW(map.insert(0x00U, 0U, 5), etl::prefix_map_full);
+
+      // Existing keys are not an error.
+      CHECK(!map.insert(0x10U, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Routes routes;
+
+      routes.insert(ip(10, 0, 0, 0),    8U,  1);
+      routes.insert(ip(10, 1, 0, 0),    16U, 2);
+      routes.insert(ip(172, 16, 0, 0),  12U, 3);
+
+      Routes copy(routes);
+      Routes assigned;
+      assigned.insert(ip(1, 2, 3, 4), 9);
+      assigned = routes;
+
+      CHECK_EQUAL(3U, copy.size());
+      CHECK_EQUAL(3U, assigned.size());
+      CHECK_EQUAL(2, *copy.longest_prefix_match(ip(10, 1, 5, 5)));
+      CHECK_EQUAL(3, *assigned.longest_prefix_match(ip(172, 17, 5, 5)));
+      CHECK(assigned.find(ip(1, 2, 3, 4)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_reference)
+    {
+      const size_t Size = 64U;
+
+      etl::prefix_map<uint16_t, int, Size> map;
+      std::map<std::pair<size_t, uint16_t>, int> reference;
+
+      std::mt19937 generator(12345);
+
+      for (int step = 0; step < 20000; ++step)
+      {
+        const size_t   length = generator() % 17U;
+        const uint16_t mask   = (length == 0U) ? uint16_t(0U) : uint16_t(0xFFFFU << (16U - length));
+        const uint16_t key    = uint16_t(generator()) & mask;
+        const std::pair<size_t, uint16_t> id(length, key);
+
+        if (((generator() % 3U) != 0U) && (reference.size() < Size))
+        {
+          const bool inserted = map.insert(key, length, step);
+          CHECK_EQUAL(reference.count(id) == 0U, inserted);
+
+          if (inserted)
+          {
+            reference[id] = step;
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(reference.erase(id), map.erase(key, length));
+        }
+
+        CHECK_EQUAL(reference.size(), map.size());
+
+        const uint16_t query = uint16_t(generator());
+        const int*     p_match = map.longest_prefix_match(query);
+
+        CHECK_EQUAL(reference_match(reference, query), (p_match == nullptr) ? -1 : *p_match);
+      }
+    }
+  }
+}
@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <queue>
+#include <algorithm>
 
 #include "etl/priority_queue.h"
 #include <functional>
@@ -633,5 +634,69 @@ namespace
         priority_queue2.pop();
       }
     }
+
+    //*************************************************************************
+    template <size_t ARITY>
+    void check_d_ary_against_std()
+    {
+      etl::priority_queue<int, 256, etl::vector<int, 256>, etl::less<int>, ARITY> priority_queue;
+      std::priority_queue<int> compare_priority_queue;
+
+      unsigned int seed = 12345U;
+
+      for (int round = 0; round < 4; ++round)
+      {
+        while (!priority_queue.full())
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          int value = int((seed >> 16) % 100U);
+
+          priority_queue.push(value);
+          compare_priority_queue.push(value);
+        }
+
+        while (priority_queue.size() > 64U)
+        {
+          CHECK_EQUAL(compare_priority_queue.top(), priority_queue.top());
+          priority_queue.pop();
+          compare_priority_queue.pop();
+        }
+      }
+
+      while (!priority_queue.empty())
+      {
+        CHECK_EQUAL(compare_priority_queue.top(), priority_queue.top());
+        priority_queue.pop();
+        compare_priority_queue.pop();
+      }
+
+      CHECK(compare_priority_queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_d_ary_heap)
+    {
+      check_d_ary_against_std<3U>();
+      check_d_ary_against_std<4U>();
+      check_d_ary_against_std<8U>();
+    }
+
+    //*************************************************************************
+    TEST(test_d_ary_heap_assign)
+    {
+      int data[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0, 9, 1 };
+
+      etl::priority_queue<int, 12U, etl::vector<int, 12U>, etl::less<int>, 4U> priority_queue(std::begin(data), std::end(data));
+
+      std::sort(std::begin(data), std::end(data), std::greater<int>());
+
+      for (size_t i = 0U; i < std::size(data); ++i)
+      {
+        CHECK_EQUAL(data[i], priority_queue.top());
+        priority_queue.pop();
+      }
+
+      CHECK(priority_queue.empty());
+    }
   };
 }
@@ -501,6 +501,57 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_move_assignment)
+    {
+      etl::queue<ItemM, 4> queue;
+
+      queue.push(ItemM(1));
+      queue.push(ItemM(2));
+      queue.push(ItemM(3));
+
+      etl::queue<ItemM, 4> queue2;
+
+      // These should be overwritten.
+      queue2.push(ItemM(5));
+
+      queue2 = std::move(queue);
+
+      CHECK_EQUAL(3U, queue2.size());
+      CHECK_EQUAL(1, queue2.front().value);
+      queue2.pop();
+      CHECK_EQUAL(2, queue2.front().value);
+      queue2.pop();
+      CHECK_EQUAL(3, queue2.front().value);
+    }
+
+    //*************************************************************************
+    TEST(test_move_assignment_interface_different_capacity)
+    {
+      etl::queue<ItemM, 3> queue1;
+
+      // Wrap the source so that the read index passes the end of its buffer.
+      queue1.push(ItemM(0));
+      queue1.pop();
+      queue1.push(ItemM(1));
+      queue1.push(ItemM(2));
+      queue1.push(ItemM(3));
+
+      etl::queue<ItemM, 6> queue2;
+
+      etl::iqueue<ItemM>& iqueue1 = queue1;
+      etl::iqueue<ItemM>& iqueue2 = queue2;
+
+      iqueue2 = std::move(iqueue1);
+
+      CHECK_EQUAL(3U, queue2.size());
+      CHECK_EQUAL(1, queue2.front().value);
+      queue2.pop();
+      CHECK_EQUAL(2, queue2.front().value);
+      queue2.pop();
+      CHECK_EQUAL(3, queue2.front().value);
+    }
+
     //*************************************************************************
     TEST(test_assignment_interface)
     {
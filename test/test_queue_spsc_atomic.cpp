@@ -351,6 +351,179 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_wrap_around)
+    {
+      // Repeatedly fills and empties the queue from different start positions.
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int round = 0; round < 10; ++round)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+        CHECK_EQUAL(next_pop + 4, next_push);
+
+        // Leave some in the queue to move the start position.
+        for (int i = 0; i < (round % 4) + 1; ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_burst)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[]  = { 1, 2, 3, 4, 5, 6 };
+      int output[] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(input + 4, input + 6));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3));
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK(queue.empty());
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+      CHECK_EQUAL(0U, queue.push(input, input));
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_peek_release)
+    {
+      etl::queue_spsc_atomic<Data, 2> queue;
+
+      CHECK(queue.try_peek() == ETL_NULLPTR);
+
+      Data* p_data = queue.try_reserve();
+      CHECK(p_data != ETL_NULLPTR);
+
+      // Not visible until committed.
+      CHECK(queue.empty());
+      CHECK(queue.try_peek() == ETL_NULLPTR);
+
+      p_data->a = 1;
+      p_data->b = 2;
+      queue.commit();
+
+      CHECK_EQUAL(1U, queue.size());
+
+      p_data = queue.try_reserve();
+      CHECK(p_data != ETL_NULLPTR);
+      *p_data = Data(3, 4, 5, 6);
+      queue.commit();
+
+      CHECK(queue.full());
+      CHECK(queue.try_reserve() == ETL_NULLPTR);
+
+      const Data* p_front = queue.try_peek();
+      CHECK(p_front != ETL_NULLPTR);
+      CHECK_EQUAL(1, p_front->a);
+      CHECK_EQUAL(2, p_front->b);
+
+      // Peeking again gives the same value.
+      CHECK(p_front == queue.try_peek());
+
+      queue.release();
+      CHECK_EQUAL(1U, queue.size());
+
+      p_front = queue.try_peek();
+      CHECK(p_front != ETL_NULLPTR);
+      CHECK(Data(3, 4, 5, 6) == *p_front);
+
+      queue.release();
+      CHECK(queue.empty());
+      CHECK(queue.try_peek() == ETL_NULLPTR);
+
+      // The reserved slot wraps around the end of the buffer.
+      p_data = queue.try_reserve();
+      CHECK(p_data != ETL_NULLPTR);
+      p_data->a = 7;
+      queue.commit();
+
+      Data data;
+      CHECK(queue.pop(data));
+      CHECK_EQUAL(7, data.a);
+    }
+
+    //*************************************************************************
+    TEST(test_producer_consumer_threads)
+    {
+      etl::queue_spsc_atomic<int, 16> queue;
+
+      const int Count = 100000;
+
+      std::thread producer([&queue]()
+      {
+        for (int i = 0; i < Count; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < Count)
+      {
+        int value;
+
+        if (queue.pop(value))
+        {
+          in_order = in_order && (value == expected);
+          ++expected;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
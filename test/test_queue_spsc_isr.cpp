@@ -540,6 +540,48 @@ namespace
       CHECK(!Access::called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_burst)
+    {
+      Access::clear();
+
+      etl::queue_spsc_isr<int, 4, Access> queue;
+
+      int input[]  = { 1, 2, 3, 4, 5, 6 };
+      int output[] = { 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+      CHECK(queue.full_from_isr());
+      CHECK_EQUAL(0U, queue.push(input + 4, input + 6));
+
+      Access::clear();
+
+      CHECK_EQUAL(3U, queue.pop_from_isr(output, 3));
+      CHECK(!Access::called_lock);
+      CHECK(!Access::called_unlock);
+      CHECK_EQUAL(1U, queue.size_from_isr());
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push_from_isr(input + 4, input + 6));
+      CHECK(!Access::called_lock);
+      CHECK_EQUAL(3U, queue.size_from_isr());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6));
+      CHECK(Access::called_lock);
+      CHECK(Access::called_unlock);
+      CHECK(queue.empty_from_isr());
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+
+      CHECK_EQUAL(0U, queue.pop(output, 6));
+    }
+
     //*************************************************************************
     TEST(test_full)
     {
@@ -0,0 +1,305 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_waitable.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+#if ETL_HAS_ATOMIC && ETL_HAS_SEMAPHORE && ETL_HAS_MUTEX
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_ = 0, int b_ = 0)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int a;
+    int b;
+  };
+
+  typedef etl::queue_waitable<etl::queue_spsc_atomic<int, 4> > SpscQueue;
+  typedef etl::queue_waitable<etl::queue_mpmc_mutex<int, 4> >  MpmcQueue;
+
+  SUITE(test_queue_waitable)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      SpscQueue queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK(queue.empty());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.full());
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      int value;
+
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(1, value);
+
+      CHECK(queue.pop_wait(value, 0));
+      CHECK_EQUAL(2, value);
+
+      queue.pop_wait(value);
+      CHECK_EQUAL(3, value);
+
+      CHECK(queue.pop());
+      CHECK(!queue.pop());
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      etl::queue_waitable<etl::queue_spsc_atomic<Data, 4> > queue;
+
+      CHECK(queue.emplace(1, 2));
+
+      Data data;
+      CHECK(queue.pop_wait(data, 0));
+      CHECK_EQUAL(1, data.a);
+      CHECK_EQUAL(2, data.b);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      MpmcQueue queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_timeout)
+    {
+      SpscQueue queue;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      int value;
+      CHECK(!queue.pop_wait(value, 20));
+
+      CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_timeout_covers_stolen_wake_ups)
+    {
+      MpmcQueue queue;
+
+      std::atomic<bool> done(false);
+      bool result = true;
+      std::chrono::steady_clock::duration waited;
+
+      std::thread consumer([&]()
+      {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        int value;
+        result = queue.pop_wait(value, 50);
+        waited = std::chrono::steady_clock::now() - start;
+        done   = true;
+      });
+
+      // Wake the consumer, then take the value before it can, until it gives up.
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+      while (!done && ((std::chrono::steady_clock::now() - start) < std::chrono::milliseconds(1000)))
+      {
+        int value;
+        queue.push(1);
+        queue.pop(value);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+
+      consumer.join();
+
+      // The consumer may have won a race for a value, otherwise it must have timed out on time.
+      CHECK(result || (waited < std::chrono::milliseconds(400)));
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_woken_by_push)
+    {
+      SpscQueue queue;
+
+      std::thread producer([&queue]()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(42);
+      });
+
+      int value = 0;
+      CHECK(queue.pop_wait(value, 10000));
+      CHECK_EQUAL(42, value);
+
+      producer.join();
+    }
+
+    //*************************************************************************
+    TEST(test_spsc_threads)
+    {
+      SpscQueue queue;
+
+      const int Count = 20000;
+
+      std::thread producer([&queue]()
+      {
+        for (int i = 0; i < Count; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      bool in_order = true;
+
+      for (int i = 0; i < Count; ++i)
+      {
+        int value;
+        queue.pop_wait(value);
+        in_order = in_order && (value == i);
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_mpmc_threads)
+    {
+      MpmcQueue queue;
+
+      const int Count = 10000; // Per producer.
+
+      std::atomic<int> popped(0);
+      std::vector<int> seen[2];
+
+      std::thread producer1([&queue]()
+      {
+        for (int i = 0; i < Count; ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      std::thread producer2([&queue]()
+      {
+        for (int i = Count; i < (2 * Count); ++i)
+        {
+          while (!queue.push(i))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      std::thread consumer1([&queue, &popped, &seen]()
+      {
+        while (popped.load() < (2 * Count))
+        {
+          int value;
+
+          if (queue.pop_wait(value, 10))
+          {
+            ++popped;
+            seen[0].push_back(value);
+          }
+        }
+      });
+
+      std::thread consumer2([&queue, &popped, &seen]()
+      {
+        while (popped.load() < (2 * Count))
+        {
+          int value;
+
+          if (queue.pop_wait(value, 10))
+          {
+            ++popped;
+            seen[1].push_back(value);
+          }
+        }
+      });
+
+      producer1.join();
+      producer2.join();
+      consumer1.join();
+      consumer2.join();
+
+      std::vector<int> all(seen[0]);
+      all.insert(all.end(), seen[1].begin(), seen[1].end());
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(2 * Count), all.size());
+
+      bool all_present = true;
+
+      for (size_t i = 0; i < all.size(); ++i)
+      {
+        all_present = all_present && (all[i] == int(i));
+      }
+
+      CHECK(all_present);
+    }
+  };
+}
+
+#endif
@@ -359,6 +359,179 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_random_xoshiro128_sequence)
+    {
+      const uint32_t expected[] = { 0xBE01A273UL, 0xE86DF75FUL, 0x10223812UL, 0xAFD709CAUL, 0xCB8DBE4DUL };
+
+      etl::random_xoshiro128 r(1U);
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(expected); ++i)
+      {
+        CHECK_EQUAL(expected[i], r());
+      }
+
+      // generate() gives the same sequence.
+      etl::random_xoshiro128 r1(1234U);
+      etl::random_xoshiro128 r2(1234U);
+
+      std::vector<uint32_t> out(1001);
+      r1.generate(out.begin(), out.end());
+
+      for (size_t i = 0U; i < out.size(); ++i)
+      {
+        CHECK_EQUAL(r2(), out[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro128_range)
+    {
+      etl::random_xoshiro128 r(1U);
+
+      uint32_t low  = 1234;
+      uint32_t high = 9876;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+
+      // Every value is equally likely.
+      int counts[6] = { 0, 0, 0, 0, 0, 0 };
+
+      for (int i = 0; i < 60000; ++i)
+      {
+        ++counts[r.range(10U, 15U) - 10U];
+      }
+
+      for (int i = 0; i < 6; ++i)
+      {
+        CHECK(counts[i] > 9500);
+        CHECK(counts[i] < 10500);
+      }
+
+      // The full range.
+      etl::random_xoshiro128 r1(5U);
+      etl::random_xoshiro128 r2(5U);
+
+      CHECK_EQUAL(r2(), r1.range(0U, 0xFFFFFFFFUL));
+      CHECK_EQUAL(7U, r1.range(7U, 7U));
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro128_uniform)
+    {
+      etl::random_xoshiro128 r(1U);
+
+      double sum_f = 0.0;
+      double sum_d = 0.0;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const float  f = r.uniform_float();
+        const double d = r.uniform_double();
+
+        CHECK(f >= 0.0f);
+        CHECK(f < 1.0f);
+        CHECK(d >= 0.0);
+        CHECK(d < 1.0);
+
+        sum_f += f;
+        sum_d += d;
+      }
+
+      CHECK_CLOSE(0.5, sum_f / 100000.0, 0.005);
+      CHECK_CLOSE(0.5, sum_d / 100000.0, 0.005);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_random_xoshiro256_sequence)
+    {
+      const uint64_t expected[] = { 0xCFC5D07F6F03C29BULL, 0xBF424132963FE08DULL, 0x19A37D5757AAF520ULL };
+
+      etl::random_xoshiro256 r(1U);
+
+      for (size_t i = 0U; i < ETL_ARRAY_SIZE(expected); ++i)
+      {
+        CHECK_EQUAL(expected[i], r.next_uint64());
+      }
+
+      // generate() uses both halves of each 64 bit number.
+      etl::random_xoshiro256 r1(1234U);
+      etl::random_xoshiro256 r2(1234U);
+
+      std::vector<uint32_t> out(1001);
+      r1.generate(out.begin(), out.end());
+
+      for (size_t i = 0U; i < out.size(); i += 2U)
+      {
+        const uint64_t n = r2.next_uint64();
+
+        CHECK_EQUAL(uint32_t(n >> 32), out[i]);
+
+        if ((i + 1U) < out.size())
+        {
+          CHECK_EQUAL(uint32_t(n), out[i + 1U]);
+        }
+      }
+
+      etl::random_xoshiro256 r3(1U);
+      CHECK_EQUAL(uint32_t(expected[0] >> 32), r3());
+    }
+
+    //*************************************************************************
+    TEST(test_random_xoshiro256_range)
+    {
+      etl::random_xoshiro256 r(1U);
+
+      uint32_t low  = 1234;
+      uint32_t high = 9876;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+
+      int counts[6] = { 0, 0, 0, 0, 0, 0 };
+
+      for (int i = 0; i < 60000; ++i)
+      {
+        ++counts[r.range(10U, 15U) - 10U];
+      }
+
+      for (int i = 0; i < 6; ++i)
+      {
+        CHECK(counts[i] > 9500);
+        CHECK(counts[i] < 10500);
+      }
+
+      double sum = 0.0;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const double d = r.uniform_double();
+        const float  f = r.uniform_float();
+
+        CHECK(d >= 0.0);
+        CHECK(d < 1.0);
+        CHECK(f >= 0.0f);
+        CHECK(f < 1.0f);
+
+        sum += d;
+      }
+
+      CHECK_CLOSE(0.5, sum / 100000.0, 0.005);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_random_hash_sequence)
     {
@@ -773,5 +773,59 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      typedef etl::reference_flat_map<std::string, int, SIZE> Container;
+
+      Container data;
+      Container::value_type values[] = { Container::value_type("1", 1), Container::value_type("3", 3) };
+      data.insert(values[0]);
+      data.insert(values[1]);
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::reference_flat_map<std::string, int, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      Transparent::value_type values[] = { Transparent::value_type("1", 1), Transparent::value_type("3", 3), Transparent::value_type("5", 5) };
+      data.insert(values[0]);
+      data.insert(values[1]);
+      data.insert(values[2]);
+
+      CHECK(data.find("3") != data.end());
+      CHECK_EQUAL(3, data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK(data.lower_bound("2") == data.find("3"));
+      CHECK(cdata.lower_bound("3") == cdata.find("3"));
+      CHECK(data.upper_bound("3") == data.find("5"));
+      CHECK(cdata.upper_bound("5") == cdata.end());
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK(range.second == data.find("5"));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.find("5"));
+      CHECK(crange.second == cdata.find("5"));
+    }
   };
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/rms.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -47,6 +48,24 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, -8.0, -7.0, -6.0, -5.0, -4.0, -3.0, -2.0, -1.0
   };
 
+  //*********************************
+  // Pseudo random int16_t samples, starting with a run of the most negative
+  // value, whose squares are the largest the kernels see.
+  std::vector<int16_t> make_int16_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int16_t> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = (i < 24U) ? int16_t(-32768) : int16_t(seed >> 16);
+    }
+
+    samples[24] = 32767;
+
+    return samples;
+  }
+
   SUITE(test_rms)
   {
     //*************************************************************************
@@ -66,5 +85,35 @@ namespace
 
       CHECK_CLOSE(5.21, result, 0.05);
     }
+
+    //*************************************************************************
+    TEST(test_int16_block_rms_matches_scalar)
+    {
+      // An odd size, so that the kernel has a tail to finish.
+      std::vector<int16_t> samples = make_int16_samples(1027U, 1U);
+
+      const int16_t* first = samples.data();
+      const int16_t* last  = samples.data() + samples.size();
+
+      etl::rms<int16_t, int64_t> block(first, last);
+      etl::rms<int16_t, int64_t> scalar;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        scalar.add(samples[i]);
+      }
+
+      CHECK_EQUAL(scalar.count(), block.count());
+      CHECK_EQUAL(scalar.get_rms(), block.get_rms());
+
+      // Adding in pieces gives the same result.
+      etl::rms<int16_t, int64_t> pieces;
+      pieces.add(first, first + 5);
+      pieces.add(first + 5, first + 500);
+      pieces.add(first + 500, last);
+
+      CHECK_EQUAL(scalar.count(), pieces.count());
+      CHECK_EQUAL(scalar.get_rms(), pieces.get_rms());
+    }
   };
 }
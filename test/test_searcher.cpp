@@ -0,0 +1,305 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/searcher.h"
+#include "etl/span.h"
+
+#include <vector>
+#include <string>
+#include <list>
+#include <algorithm>
+#include <random>
+
+namespace
+{
+  std::mt19937 urng(12345U);
+
+  //***************************************************************************
+  // Random text from a small alphabet, so that partial matches are common.
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_text(size_t size, size_t alphabet)
+  {
+    std::vector<T> text(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      text[i] = T('a' + (urng() % alphabet));
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  // A character that counts the comparisons made.
+  //***************************************************************************
+  struct Counted
+  {
+    explicit Counted(char c_)
+      : c(c_)
+    {
+    }
+
+    friend bool operator ==(const Counted& lhs, const Counted& rhs)
+    {
+      ++comparisons;
+      return lhs.c == rhs.c;
+    }
+
+    friend bool operator <(const Counted& lhs, const Counted& rhs)
+    {
+      ++comparisons;
+      return lhs.c < rhs.c;
+    }
+
+    char c;
+
+    static size_t comparisons;
+  };
+
+  size_t Counted::comparisons = 0U;
+
+  //***************************************************************************
+  // Checks a searcher against std::search, for random and periodic patterns.
+  //***************************************************************************
+  template <typename TSearcherFactory>
+  bool agrees_with_std_search(TSearcherFactory factory)
+  {
+    for (size_t alphabet = 1U; alphabet <= 4U; ++alphabet)
+    {
+      std::vector<char> text = make_text<char>(2000U, alphabet);
+
+      for (size_t length = 1U; length <= 40U; ++length)
+      {
+        std::vector<char> pattern;
+
+        switch (length % 3U)
+        {
+          case 0U:
+          {
+            // Taken from the text, so that it is found.
+            const size_t start = urng() % (text.size() - length);
+            pattern.assign(text.begin() + start, text.begin() + start + length);
+            break;
+          }
+
+          case 1U:
+          {
+            pattern = make_text<char>(length, alphabet);
+            break;
+          }
+
+          default:
+          {
+            // Periodic.
+            for (size_t i = 0U; i < length; ++i)
+            {
+              pattern.push_back(char('a' + ((i % 3U) % alphabet)));
+            }
+            break;
+          }
+        }
+
+        std::vector<char>::const_iterator expected = std::search(text.cbegin(), text.cend(), pattern.begin(), pattern.end());
+
+        typename TSearcherFactory::searcher_type searcher = factory(pattern.begin(), pattern.end());
+        std::pair<std::vector<char>::const_iterator, std::vector<char>::const_iterator> result = searcher(text.cbegin(), text.cend());
+
+        if ((result.first != expected) ||
+            ((expected != text.cend()) && (result.second != (expected + std::ptrdiff_t(length)))) ||
+            ((expected == text.cend()) && (result.second != text.cend())))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  struct BmhFactory
+  {
+    typedef etl::boyer_moore_horspool_searcher<std::vector<char>::iterator> searcher_type;
+
+    searcher_type operator()(std::vector<char>::iterator first, std::vector<char>::iterator last) const
+    {
+      return etl::make_boyer_moore_horspool_searcher(first, last);
+    }
+  };
+
+  struct TwoWayFactory
+  {
+    typedef etl::two_way_searcher<std::vector<char>::iterator> searcher_type;
+
+    searcher_type operator()(std::vector<char>::iterator first, std::vector<char>::iterator last) const
+    {
+      return etl::make_two_way_searcher(first, last);
+    }
+  };
+
+  struct DefaultFactory
+  {
+    typedef etl::default_searcher<std::vector<char>::iterator> searcher_type;
+
+    searcher_type operator()(std::vector<char>::iterator first, std::vector<char>::iterator last) const
+    {
+      return etl::make_default_searcher(first, last);
+    }
+  };
+
+  SUITE(test_searcher)
+  {
+    //*************************************************************************
+    TEST(test_default_searcher)
+    {
+      CHECK(agrees_with_std_search(DefaultFactory()));
+    }
+
+    //*************************************************************************
+    TEST(test_default_searcher_forward_iterators)
+    {
+      std::list<int> data   = { 1, 2, 3, 4, 5, 3, 4, 6 };
+      std::list<int> needle = { 3, 4, 6 };
+
+      etl::default_searcher<std::list<int>::iterator> searcher(needle.begin(), needle.end());
+
+      std::pair<std::list<int>::iterator, std::list<int>::iterator> result = searcher(data.begin(), data.end());
+
+      CHECK_EQUAL(5, std::distance(data.begin(), result.first));
+      CHECK(result.second == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_searcher)
+    {
+      CHECK(agrees_with_std_search(BmhFactory()));
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_searcher_long_pattern)
+    {
+      // Longer than the largest skip that the table holds.
+      std::vector<char> text    = make_text<char>(5000U, 3U);
+      std::vector<char> pattern(text.begin() + 4000, text.begin() + 4300);
+
+      etl::boyer_moore_horspool_searcher<std::vector<char>::iterator> searcher(pattern.begin(), pattern.end());
+
+      CHECK(std::search(text.begin(), text.end(), pattern.begin(), pattern.end()) == searcher(text.begin(), text.end()).first);
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_searcher_wide_elements)
+    {
+      // 0x0161 and 0x0261 share their low byte with 'a'.
+      std::vector<char16_t> text    = { u'a', 0x0161, 0x0261, u'b', 0x0161, u'a', u'b', 0x0261, u'c', 0x0161, u'a', u'b', 0x0261 };
+      std::vector<char16_t> pattern = { 0x0161, u'a', u'b', 0x0261 };
+
+      etl::boyer_moore_horspool_searcher<std::vector<char16_t>::iterator> searcher(pattern.begin(), pattern.end());
+
+      CHECK(std::search(text.begin(), text.end(), pattern.begin(), pattern.end()) == searcher(text.begin(), text.end()).first);
+      CHECK_EQUAL(4, std::distance(text.begin(), searcher(text.begin(), text.end()).first));
+    }
+
+    //*************************************************************************
+    TEST(test_boyer_moore_horspool_searcher_byte_span)
+    {
+      uint8_t buffer[64];
+
+      for (size_t i = 0U; i < sizeof(buffer); ++i)
+      {
+        buffer[i] = uint8_t(i);
+      }
+
+      const uint8_t delimiter[] = { 0x7E, 0x81, 0x84 };
+      buffer[50] = 0x7E;
+      buffer[51] = 0x81;
+      buffer[52] = 0x84;
+
+      etl::span<const uint8_t> received(buffer, sizeof(buffer));
+      etl::boyer_moore_horspool_searcher<const uint8_t*> searcher(delimiter, delimiter + 3);
+
+      etl::span<const uint8_t>::iterator result = etl::search(received.begin(), received.end(), searcher);
+
+      CHECK_EQUAL(50, std::distance(received.begin(), result));
+    }
+
+    //*************************************************************************
+    TEST(test_two_way_searcher)
+    {
+      CHECK(agrees_with_std_search(TwoWayFactory()));
+    }
+
+    //*************************************************************************
+    TEST(test_two_way_searcher_is_linear)
+    {
+      // The worst case for a naive search.
+      std::vector<Counted> text(20000U, Counted('a'));
+      std::vector<Counted> pattern(1000U, Counted('a'));
+      pattern.push_back(Counted('b'));
+      text.insert(text.end(), pattern.begin(), pattern.end());
+
+      etl::two_way_searcher<std::vector<Counted>::iterator> searcher(pattern.begin(), pattern.end());
+
+      Counted::comparisons = 0U;
+
+      std::pair<std::vector<Counted>::iterator, std::vector<Counted>::iterator> result = searcher(text.begin(), text.end());
+
+      CHECK_EQUAL(20000, std::distance(text.begin(), result.first));
+      CHECK(result.second == text.end());
+      CHECK(Counted::comparisons < (2U * text.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_empty_pattern_and_range)
+    {
+      std::string text("abc");
+      std::string empty;
+
+      etl::boyer_moore_horspool_searcher<std::string::iterator> bmh(empty.begin(), empty.end());
+      etl::two_way_searcher<std::string::iterator>              two_way(empty.begin(), empty.end());
+
+      CHECK(bmh(text.begin(), text.end()).first == text.begin());
+      CHECK(bmh(text.begin(), text.end()).second == text.begin());
+      CHECK(two_way(text.begin(), text.end()).first == text.begin());
+      CHECK(two_way(text.begin(), text.end()).second == text.begin());
+
+      std::string pattern("abcd");
+
+      etl::boyer_moore_horspool_searcher<std::string::iterator> bmh2(pattern.begin(), pattern.end());
+      etl::two_way_searcher<std::string::iterator>              two_way2(pattern.begin(), pattern.end());
+
+      CHECK(bmh2(text.begin(), text.end()).first == text.end());
+      CHECK(two_way2(text.begin(), text.end()).first == text.end());
+      CHECK(bmh2(empty.begin(), empty.end()).first == empty.end());
+      CHECK(two_way2(empty.begin(), empty.end()).first == empty.end());
+    }
+  }
+}
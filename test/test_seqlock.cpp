@@ -0,0 +1,172 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "etl/seqlock.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Snapshot
+  {
+    uint32_t a;
+    uint32_t b;
+    uint16_t c;
+    uint8_t  d;
+  };
+
+  SUITE(test_seqlock)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::seqlock<Snapshot> lock;
+
+      Snapshot s = lock.read();
+
+      CHECK_EQUAL(0U, s.a);
+      CHECK_EQUAL(0U, s.b);
+      CHECK_EQUAL(0U, s.c);
+      CHECK_EQUAL(0U, s.d);
+      CHECK_EQUAL(0U, lock.get_sequence());
+    }
+
+    //*************************************************************************
+    TEST(test_value_constructor)
+    {
+      Snapshot initial = { 1U, 2U, 3U, 4U };
+      etl::seqlock<Snapshot> lock(initial);
+
+      Snapshot s = lock.read();
+
+      CHECK_EQUAL(1U, s.a);
+      CHECK_EQUAL(2U, s.b);
+      CHECK_EQUAL(3U, s.c);
+      CHECK_EQUAL(4U, s.d);
+    }
+
+    //*************************************************************************
+    TEST(test_write_read)
+    {
+      etl::seqlock<Snapshot> lock;
+
+      Snapshot value = { 5U, 6U, 7U, 8U };
+      lock.write(value);
+
+      CHECK_EQUAL(2U, lock.get_sequence());
+
+      Snapshot s;
+      CHECK(lock.try_read(s));
+      CHECK_EQUAL(5U, s.a);
+      CHECK_EQUAL(6U, s.b);
+      CHECK_EQUAL(7U, s.c);
+      CHECK_EQUAL(8U, s.d);
+
+      value.a = 9U;
+      lock.write(value);
+
+      CHECK_EQUAL(4U, lock.get_sequence());
+      CHECK_EQUAL(9U, lock.read().a);
+    }
+
+    //*************************************************************************
+    TEST(test_scalar)
+    {
+      etl::seqlock<double> lock(1.5);
+
+      CHECK_EQUAL(1.5, lock.read());
+
+      lock.write(2.5);
+
+      CHECK_EQUAL(2.5, lock.read());
+    }
+
+    //*************************************************************************
+    TEST(test_one_writer_many_readers)
+    {
+      const size_t   Readers = 3U;
+      const uint32_t Writes  = 50000U;
+
+      etl::seqlock<Snapshot> lock;
+
+      std::atomic<bool>        done(false);
+      std::vector<std::thread> readers;
+      bool                     errors[Readers] = { false };
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers.push_back(std::thread([&lock, &done, &errors, r]()
+        {
+          uint32_t last = 0U;
+
+          while (!done.load())
+          {
+            Snapshot s = lock.read();
+
+            // Every field is written with the same value, so a torn read would differ.
+            if ((s.a != s.b) || (uint16_t(s.a) != s.c) || (uint8_t(s.a) != s.d) || (s.a < last))
+            {
+              errors[r] = true;
+            }
+
+            last = s.a;
+          }
+        }));
+      }
+
+      for (uint32_t i = 1U; i <= Writes; ++i)
+      {
+        Snapshot s = { i, i, uint16_t(i), uint8_t(i) };
+        lock.write(s);
+      }
+
+      done.store(true);
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        readers[r].join();
+      }
+
+      for (size_t r = 0U; r < Readers; ++r)
+      {
+        CHECK(!errors[r]);
+      }
+
+      CHECK_EQUAL(Writes, lock.read().a);
+      CHECK_EQUAL(2U * Writes, lock.get_sequence());
+    }
+  };
+}
+
+#endif
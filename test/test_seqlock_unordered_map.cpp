@@ -0,0 +1,281 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "etl/seqlock_unordered_map.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //***************************************************************************
+  // Both halves are always written with the same value.
+  struct Pair
+  {
+    uint32_t a;
+    uint32_t b;
+  };
+}
+
+#if ETL_NOT_USING_STL
+namespace etl
+{
+  // Without the STL, only fundamental and pointer types are recognised.
+  template <>
+  struct is_trivially_copyable<Pair> : etl::true_type
+  {
+  };
+}
+#endif
+
+namespace
+{
+  SUITE(test_seqlock_unordered_map)
+  {
+    static const size_t SIZE = 16;
+
+    typedef etl::seqlock_unordered_map<int, int, SIZE> Data;
+    typedef etl::iseqlock_unordered_map<int, int>      IData;
+
+    //*************************************************************************
+    // Maps every key to the same probe sequence.
+    struct collide_hash
+    {
+      size_t operator ()(int) const
+      {
+        return 3U;
+      }
+    };
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(32U, size_t(Data::TABLE_SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Data data;
+      IData& idata = data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(idata.insert(i * 7, i));
+      }
+
+      CHECK(data.full());
+      CHECK(!data.insert(0, 100));
+      CHECK_THROW(data.insert(1000, 1), etl::seqlock_unordered_map_full);
+
+      int mapped = -1;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(data.find(i * 7, mapped));
+        CHECK_EQUAL(i, mapped);
+        CHECK(data.contains(i * 7));
+      }
+
+      CHECK(!data.find(1, mapped));
+      CHECK(!data.contains(1));
+
+      CHECK_EQUAL(1U, data.erase(14));
+      CHECK_EQUAL(0U, data.erase(14));
+      CHECK(!data.contains(14));
+      CHECK_EQUAL(SIZE - 1U, data.size());
+
+      CHECK(!data.insert_or_assign(7, 70));
+      CHECK(data.insert_or_assign(14, 140));
+      CHECK(data.find(7, mapped));
+      CHECK_EQUAL(70, mapped);
+      CHECK(data.find(14, mapped));
+      CHECK_EQUAL(140, mapped);
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK(!data.contains(7));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_in_collision_chain)
+    {
+      typedef etl::seqlock_unordered_map<int, int, SIZE, collide_hash> Collide;
+
+      Collide data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.insert(i, i * 10);
+        compare[i] = i * 10;
+      }
+
+      // Erase from the start, middle and end of the chain.
+      const int erased[] = { 0, 5, 9, 3 };
+
+      for (size_t e = 0U; e < 4U; ++e)
+      {
+        data.erase(erased[e]);
+        compare.erase(erased[e]);
+
+        for (int i = 0; i < 10; ++i)
+        {
+          int mapped = -1;
+          bool found = data.find(i, mapped);
+
+          CHECK_EQUAL(compare.count(i) == 1U, found);
+
+          if (found)
+          {
+            CHECK_EQUAL(compare[i], mapped);
+          }
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_wraps_around_table)
+    {
+      struct end_hash
+      {
+        size_t operator ()(int key) const
+        {
+          // Keys 0 to 3 start at the last slot, the rest at the first.
+          return (key < 4) ? 31U : 0U;
+        }
+      };
+
+      etl::seqlock_unordered_map<int, int, SIZE, end_hash> data;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data.insert(i, i);
+      }
+
+      data.erase(0);
+      data.erase(4);
+
+      int mapped = -1;
+
+      for (int i = 1; i < 6; ++i)
+      {
+        CHECK_EQUAL(i != 4, data.find(i, mapped));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_readers)
+    {
+      // All keys collide, so erasing shifts the slots that the readers are probing.
+      typedef etl::seqlock_unordered_map<int, Pair, SIZE, collide_hash> Concurrent;
+
+      Concurrent data;
+
+      for (int i = 0; i < int(SIZE / 2U); ++i)
+      {
+        Pair value = { 0U, 0U };
+        data.insert(i, value);
+      }
+
+      etl::atomic<bool> done(false);
+      etl::atomic<int>  torn(0);
+      etl::atomic<int>  missing(0);
+
+      std::vector<std::thread> readers;
+
+      for (int r = 0; r < 4; ++r)
+      {
+        readers.push_back(std::thread([&]()
+        {
+          while (!done.load())
+          {
+            for (int i = 0; i < int(SIZE); ++i)
+            {
+              Pair value = {};
+
+              if (data.find(i, value))
+              {
+                if (value.a != value.b)
+                {
+                  ++torn;
+                }
+              }
+              else if (i < int(SIZE / 2U))
+              {
+                // These keys are never erased.
+                ++missing;
+              }
+            }
+          }
+        }));
+      }
+
+      // The writer changes values and adds and removes keys.
+      for (uint32_t n = 1U; n < 200000U; ++n)
+      {
+        Pair value = { n, n };
+        data.insert_or_assign(int(n % (SIZE / 2U)), value);
+
+        int extra = int(SIZE / 2U + (n % (SIZE / 2U)));
+
+        if (!data.insert(extra, value))
+        {
+          data.erase(extra);
+        }
+      }
+
+      done.store(true);
+
+      for (size_t r = 0U; r < readers.size(); ++r)
+      {
+        readers[r].join();
+      }
+
+      CHECK_EQUAL(0, torn.load());
+      CHECK_EQUAL(0, missing.load());
+    }
+  };
+}
+
+#endif
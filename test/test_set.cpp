@@ -1197,5 +1197,131 @@ namespace
             }
         }
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::set<int, MAX_SIZE> data;
+      data.insert((1));
+      data.insert((3));
+
+      CHECK(data.contains((1)));
+      CHECK(data.contains((3)));
+      CHECK(!data.contains((2)));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::set<std::string, MAX_SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data.insert(std::string("1"));
+      data.insert(std::string("3"));
+      data.insert(std::string("5"));
+
+      CHECK(data.find("3") != data.end());
+      CHECK_EQUAL(std::string("3"), *data.find("3"));
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      CHECK(data.lower_bound("2") == data.find("3"));
+      CHECK(cdata.lower_bound("3") == cdata.find("3"));
+      CHECK(data.upper_bound("3") == data.find("5"));
+      CHECK(cdata.upper_bound("5") == cdata.end());
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK(range.second == data.find("5"));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.find("5"));
+      CHECK(crange.second == cdata.find("5"));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::set<std::string, 4> Set;
+      Set data;
+
+      std::pair<Set::iterator, bool> result = data.emplace(3U, 'b');
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("bbb"), *result.first);
+
+      // The key is already present.
+      result = data.emplace("bbb");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("bbb"), *result.first);
+      CHECK_EQUAL(1U, data.size());
+
+      Set::iterator itr = data.emplace_hint(data.end(), 2U, 'a');
+      CHECK_EQUAL(std::string("aa"), *itr);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("aa"), *data.begin());
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::set<int, 4> Set;
+      Set data;
+
+      data.insert(1);
+      data.insert(2);
+
+      const int* p_value = &*data.find(1);
+
+      Set::node_type node = data.extract(data.find(1));
+      CHECK(bool(node));
+      CHECK_EQUAL(1, node.value());
+      CHECK_EQUAL(1U, data.size());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      // Back into the same set, so the node is relinked.
+      Set::insert_return_type result = data.insert(std::move(node));
+      CHECK(result.inserted);
+      CHECK(node.empty());
+      CHECK(p_value == &*result.position);
+      CHECK_EQUAL(2U, data.size());
+
+      // A duplicate key leaves the node in the handle.
+      Set other;
+      other.insert(2);
+      node = other.extract(2);
+      Set::iterator itr = data.insert(data.cend(), std::move(node));
+      CHECK(!node.empty());
+      CHECK_EQUAL(2, *itr);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::set<int, 4> data0;
+      etl::set<int, 6> data1;
+
+      data0.insert(1);
+      data0.insert(2);
+      data1.insert(2);
+      data1.insert(3);
+
+      data1.merge(data0);
+
+      CHECK_EQUAL(1U, data0.size());
+      CHECK(data0.find(2) != data0.end());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK(data1.find(1) != data1.end());
+    }
   };
 }
@@ -249,5 +249,82 @@ namespace
       CHECK_EQUAL(0, router2.count_message2);
       CHECK_EQUAL(0, router2.count_unknown_message);
     }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_pool_statistics)
+    {
+      message_pool.reset_statistics();
+
+      {
+        etl::shared_message sm1(message_pool, Message1(1));
+        etl::shared_message sm2(message_pool, Message2());
+        etl::shared_message sm3(sm1);
+
+        etl::pool_statistics statistics = message_pool.statistics();
+        CHECK_EQUAL(2U, statistics.size);
+        CHECK_EQUAL(2U, statistics.allocations);
+        CHECK_EQUAL(0U, statistics.releases);
+      }
+
+      etl::pool_statistics statistics = message_pool.statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(2U, statistics.peak_size);
+      CHECK_EQUAL(2U, statistics.releases);
+      CHECK_EQUAL(0U, statistics.failures);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_acquire_and_adopt)
+    {
+      etl::shared_message sm1(message_pool, Message1(1));
+
+      sm1.acquire(2U);
+      CHECK_EQUAL(3, sm1.get_reference_count());
+
+      {
+        etl::shared_message sm2(etl::shared_message::adopt_reference_t(), sm1);
+        etl::shared_message sm3(etl::shared_message::adopt_reference_t(), sm1);
+
+        CHECK_EQUAL(3, sm2.get_reference_count());
+        CHECK_EQUAL(3, sm3.get_reference_count());
+      }
+
+      CHECK_EQUAL(1, sm1.get_reference_count());
+
+      sm1.acquire(0U);
+      CHECK_EQUAL(1, sm1.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_send_to_routers_indexed)
+    {
+      etl::message_bus_index<3U, 2U> index;
+
+      bus.clear();
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+      CHECK(bus.set_index(index));
+      router1.clear();
+      router2.clear();
+
+      etl::shared_message sm1(message_pool, Message1(1));
+      etl::shared_message sm2(message_pool, Message2());
+      etl::shared_message sm4(sm1);
+
+      bus.receive(sm1);
+      bus.receive(sm2);
+      bus.receive(sm4);
+
+      CHECK_EQUAL(2, sm1.get_reference_count());
+      CHECK_EQUAL(1, sm2.get_reference_count());
+      CHECK_EQUAL(2, router1.count_message1);
+      CHECK_EQUAL(1, router1.count_message2);
+      CHECK_EQUAL(2, router2.count_message1);
+      CHECK_EQUAL(0, router2.count_unknown_message);
+
+      bus.clear_index();
+    }
   }
 }
@@ -0,0 +1,202 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "etl/slab_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/message.h"
+
+namespace
+{
+  // Classes of 8, 16, 32 and 64 bytes, with 4 blocks each.
+  using Allocator = etl::slab_allocator<8U, 64U, alignof(uint64_t), 4U>;
+
+  //*************************************************************************
+  struct Small : public etl::message<1U>
+  {
+    char data[2];
+  };
+
+  //*************************************************************************
+  struct Large : public etl::message<2U>
+  {
+    char data[100];
+  };
+
+  SUITE(test_slab_allocator)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(8U,  Allocator::Min_Block_Size);
+      CHECK_EQUAL(64U, Allocator::Max_Block_Size);
+      CHECK_EQUAL(4U,  Allocator::Blocks_Per_Class);
+      CHECK_EQUAL(4U,  Allocator::Number_Of_Classes);
+
+      CHECK_EQUAL(1U, (etl::slab_allocator<16U, 16U, 8U, 1U>::Number_Of_Classes));
+    }
+
+    //*************************************************************************
+    TEST(test_size_class)
+    {
+      CHECK_EQUAL(0U, Allocator::size_class(0U));
+      CHECK_EQUAL(0U, Allocator::size_class(1U));
+      CHECK_EQUAL(0U, Allocator::size_class(8U));
+      CHECK_EQUAL(1U, Allocator::size_class(9U));
+      CHECK_EQUAL(1U, Allocator::size_class(16U));
+      CHECK_EQUAL(2U, Allocator::size_class(17U));
+      CHECK_EQUAL(2U, Allocator::size_class(32U));
+      CHECK_EQUAL(3U, Allocator::size_class(33U));
+      CHECK_EQUAL(3U, Allocator::size_class(64U));
+      CHECK_EQUAL(Allocator::Number_Of_Classes, Allocator::size_class(65U));
+
+      for (size_t size = 1U; size <= Allocator::Max_Block_Size; ++size)
+      {
+        const size_t index = Allocator::size_class(size);
+
+        // The smallest class that fits.
+        CHECK(size <= Allocator::class_block_size(index));
+        CHECK((index == 0U) || (size > Allocator::class_block_size(index - 1U)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_from_size_class)
+    {
+      Allocator allocator;
+
+      void* p8  = allocator.allocate(5U,  1U);
+      void* p16 = allocator.allocate(12U, 4U);
+      void* p32 = allocator.allocate(32U, 8U);
+      void* p64 = allocator.allocate(40U, 8U);
+
+      CHECK_EQUAL(0U, allocator.owner_class_of(p8));
+      CHECK_EQUAL(1U, allocator.owner_class_of(p16));
+      CHECK_EQUAL(2U, allocator.owner_class_of(p32));
+      CHECK_EQUAL(3U, allocator.owner_class_of(p64));
+
+      CHECK(allocator.release(p8));
+      CHECK(allocator.release(p16));
+      CHECK(allocator.release(p32));
+      CHECK(allocator.release(p64));
+
+      int on_stack;
+      CHECK_EQUAL(Allocator::Number_Of_Classes, allocator.owner_class_of(&on_stack));
+      CHECK(!allocator.release(&on_stack));
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted_class_uses_larger_class)
+    {
+      Allocator allocator;
+      std::vector<void*> blocks;
+
+      // Fill the 8 byte class.
+      for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+      {
+        blocks.push_back(allocator.allocate(8U, 8U));
+        CHECK_EQUAL(0U, allocator.owner_class_of(blocks.back()));
+      }
+
+      // Then the next class up.
+      void* p = allocator.allocate(8U, 8U);
+      CHECK_EQUAL(1U, allocator.owner_class_of(p));
+
+      // A released block is reused by its own class.
+      CHECK(allocator.release(blocks[2]));
+      void* q = allocator.allocate(8U, 8U);
+      CHECK(q == blocks[2]);
+
+      // Use up every class.
+      size_t count = Allocator::Blocks_Per_Class + 1U;
+
+      while (allocator.allocate(1U, 1U) != nullptr)
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(Allocator::Blocks_Per_Class * Allocator::Number_Of_Classes, count);
+    }
+
+    //*************************************************************************
+    TEST(test_unsupported_requests)
+    {
+      Allocator allocator;
+
+      CHECK(allocator.allocate(65U, 1U) == nullptr);
+      CHECK(allocator.allocate(8U, 2U * alignof(uint64_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Allocator allocator;
+      etl::fixed_sized_memory_block_allocator<128U, alignof(uint64_t), 1U> large_allocator;
+
+      allocator.set_successor(large_allocator);
+
+      void* p = allocator.allocate(100U, 8U);
+      CHECK(p != nullptr);
+      CHECK_EQUAL(Allocator::Number_Of_Classes, allocator.owner_class_of(p));
+      CHECK(large_allocator.is_owner_of(p));
+
+      CHECK(allocator.release(p));
+      CHECK(allocator.allocate(100U, 8U) == p);
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool)
+    {
+      using MessageAllocator = etl::slab_allocator<16U, 256U, alignof(max_align_t), 2U>;
+
+      MessageAllocator allocator;
+      etl::reference_counted_message_pool<void> pool(allocator);
+
+      etl::ireference_counted_message* small = pool.allocate<Small>();
+      etl::ireference_counted_message* large = pool.allocate<Large>();
+
+      CHECK(small != nullptr);
+      CHECK(large != nullptr);
+
+      // Each message comes from the smallest class that fits it.
+      CHECK_EQUAL(MessageAllocator::size_class(sizeof(etl::reference_counted_message<Small, void>)), allocator.owner_class_of(small));
+      CHECK_EQUAL(MessageAllocator::size_class(sizeof(etl::reference_counted_message<Large, void>)), allocator.owner_class_of(large));
+      CHECK(allocator.owner_class_of(small) < allocator.owner_class_of(large));
+
+      pool.release(*small);
+      pool.release(*large);
+    }
+  };
+}
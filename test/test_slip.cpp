@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/slip.h"
+
+#include <vector>
+#include <random>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  const uint8_t END     = 0xC0;
+  const uint8_t ESC     = 0xDB;
+  const uint8_t ESC_END = 0xDC;
+  const uint8_t ESC_ESC = 0xDD;
+
+  //***********************************
+  Bytes encode(const Bytes& input)
+  {
+    Bytes output(etl::slip_max_encoded_size(input.size()));
+
+    const size_t size = etl::slip_encode(input.empty() ? etl::span<const uint8_t>() : etl::span<const uint8_t>(input.data(), input.size()),
+                                         etl::span<uint8_t>(output.data(), output.size()));
+    output.resize(size);
+
+    return output;
+  }
+
+  //***********************************
+  std::vector<Bytes> decode_all(const Bytes& stream, size_t chunk_size, size_t buffer_size = 64U)
+  {
+    Bytes buffer(buffer_size);
+    etl::slip_decoder decoder(etl::span<uint8_t>(buffer.data(), buffer.size()));
+
+    std::vector<Bytes> frames;
+
+    for (size_t i = 0U; i < stream.size(); i += chunk_size)
+    {
+      etl::span<const uint8_t> input(stream.data() + i, std::min(chunk_size, stream.size() - i));
+
+      while (!input.empty())
+      {
+        input = input.subspan(decoder.decode(input));
+
+        if (decoder.is_complete())
+        {
+          if (!decoder.has_error())
+          {
+            frames.push_back(Bytes(decoder.frame().begin(), decoder.frame().end()));
+          }
+
+          decoder.next_frame();
+        }
+      }
+    }
+
+    return frames;
+  }
+
+  SUITE(test_slip)
+  {
+    //*************************************************************************
+    TEST(test_encode_known_values)
+    {
+      CHECK((Bytes{ 0x01, 0x02, END }) == encode(Bytes{ 0x01, 0x02 }));
+      CHECK((Bytes{ ESC, ESC_END, END }) == encode(Bytes{ END }));
+      CHECK((Bytes{ ESC, ESC_ESC, END }) == encode(Bytes{ ESC }));
+      CHECK((Bytes{ 0x01, ESC, ESC_ESC, ESC, ESC_END, 0x02, END }) == encode(Bytes{ 0x01, ESC, END, 0x02 }));
+      CHECK((Bytes{ END }) == encode(Bytes{}));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_random)
+    {
+      std::mt19937 generator(2);
+
+      for (size_t length = 1U; length < 600U; length += 13U)
+      {
+        Bytes input(length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          const uint32_t r = generator() % 8U;
+          input[i] = (r == 0U) ? END : (r == 1U) ? ESC : uint8_t(generator());
+        }
+
+        const Bytes encoded = encode(input);
+        CHECK(std::count(encoded.begin(), encoded.end() - 1, END) == 0);
+
+        for (size_t chunk_size : { size_t(1U), size_t(7U), encoded.size() })
+        {
+          std::vector<Bytes> frames = decode_all(encoded, chunk_size, 600U);
+          CHECK_EQUAL(1U, frames.size());
+          CHECK(frames[0] == input);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_split_encoder_input)
+    {
+      const Bytes input = { 0x01, END, ESC, 0x02, END, 0x03 };
+
+      Bytes encoded(etl::slip_max_encoded_size(input.size()));
+      etl::slip_encoder encoder(etl::span<uint8_t>(encoded.data(), encoded.size()));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        CHECK(encoder.add(etl::span<const uint8_t>(&input[i], 1U)));
+      }
+
+      encoded.resize(encoder.finish());
+      CHECK(encoded == encode(input));
+    }
+
+    //*************************************************************************
+    TEST(test_stream_of_frames)
+    {
+      const Bytes frame1 = { 0x11, END, 0x22 };
+      const Bytes frame2 = { ESC };
+      const Bytes frame3 = { 0x33, 0x44 };
+
+      Bytes stream = { END, END }; // Leading ENDs are skipped.
+
+      for (const Bytes* frame : { &frame1, &frame2, &frame3 })
+      {
+        Bytes encoded = encode(*frame);
+        stream.insert(stream.end(), encoded.begin(), encoded.end());
+      }
+
+      // An escape sequence split across buffers.
+      std::vector<Bytes> frames = decode_all(stream, 3U);
+
+      CHECK_EQUAL(3U, frames.size());
+      CHECK(frame1 == frames[0]);
+      CHECK(frame2 == frames[1]);
+      CHECK(frame3 == frames[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      uint8_t buffer[3];
+
+      // The encoder runs out of room.
+      const Bytes input = { 0x11, 0x22, END };
+      CHECK_EQUAL(0U, etl::slip_encode(etl::span<const uint8_t>(input.data(), input.size()), etl::span<uint8_t>(buffer, sizeof(buffer))));
+      CHECK_EQUAL(3U, etl::slip_encode(etl::span<const uint8_t>(input.data(), 2U), etl::span<uint8_t>(buffer, sizeof(buffer))));
+
+      // Bad escape sequence.
+      const Bytes bad_escape = { 0x11, ESC, 0x22, END };
+      etl::slip_decoder decoder(etl::span<uint8_t>(buffer, sizeof(buffer)));
+      CHECK_EQUAL(4U, decoder.decode(etl::span<const uint8_t>(bad_escape.data(), bad_escape.size())));
+      CHECK(decoder.is_complete());
+      CHECK(decoder.has_error());
+
+      // ESC then END.
+      const Bytes escape_end = { 0x11, ESC, END };
+      decoder.next_frame();
+      CHECK_EQUAL(3U, decoder.decode(etl::span<const uint8_t>(escape_end.data(), escape_end.size())));
+      CHECK(decoder.is_complete());
+      CHECK(decoder.has_error());
+
+      // The decoder runs out of room, then carries on with the next frame.
+      const Bytes stream = { 0x01, 0x02, 0x03, 0x04, END, 0x05, END };
+      std::vector<Bytes> frames = decode_all(stream, stream.size(), 3U);
+      CHECK_EQUAL(1U, frames.size());
+      CHECK((Bytes{ 0x05 }) == frames[0]);
+    }
+  };
+}
@@ -0,0 +1,290 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/slot_map.h"
+
+namespace
+{
+  SUITE(test_slot_map)
+  {
+    static const size_t SIZE = 8;
+
+    typedef etl::slot_map<int, SIZE>         Data;
+    typedef etl::islot_map<int>              IData;
+    typedef etl::slot_map<std::string, SIZE> DataString;
+    typedef etl::slot_map_key                Key;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(!data.contains(Key()));
+      CHECK(data.find(Key()) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_lookup)
+    {
+      Data data;
+      Key keys[SIZE];
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        keys[i] = data.insert(int(i * 10U));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(99), etl::slot_map_full);
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        CHECK(data.contains(keys[i]));
+        CHECK_EQUAL(int(i * 10U), data[keys[i]]);
+        CHECK_EQUAL(int(i * 10U), data.at(keys[i]));
+        CHECK_EQUAL(int(i * 10U), *data.find(keys[i]));
+      }
+
+      // The elements are densely packed.
+      CHECK_EQUAL(SIZE, size_t(data.end() - data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_keeps_other_keys_valid)
+    {
+      Data data;
+      Key keys[SIZE];
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        keys[i] = data.insert(int(i));
+      }
+
+      CHECK_EQUAL(1U, data.erase(keys[2]));
+      CHECK_EQUAL(1U, data.erase(keys[0]));
+      CHECK_EQUAL(0U, data.erase(keys[0]));
+
+      CHECK_EQUAL(SIZE - 2U, data.size());
+      CHECK(!data.contains(keys[0]));
+      CHECK(!data.contains(keys[2]));
+      CHECK(data.find(keys[2]) == data.end());
+      CHECK_THROW(data.at(keys[2]), etl::slot_map_invalid_key);
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        if ((i != 0U) && (i != 2U))
+        {
+          CHECK(data.contains(keys[i]));
+          CHECK_EQUAL(int(i), data[keys[i]]);
+        }
+      }
+
+      // The slots are reused, but the old keys stay invalid.
+      Key k1 = data.insert(100);
+      Key k2 = data.insert(200);
+
+      CHECK(k1 != keys[0]);
+      CHECK(k1 != keys[2]);
+      CHECK(!data.contains(keys[0]));
+      CHECK(!data.contains(keys[2]));
+      CHECK_EQUAL(100, data[k1]);
+      CHECK_EQUAL(200, data[k2]);
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_and_key_of)
+    {
+      Data data;
+      std::vector<Key> keys;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        keys.push_back(data.insert(i));
+      }
+
+      data.erase(keys[1]);
+      data.erase(keys[5]);
+
+      int sum = 0;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        sum += *itr;
+
+        Key key = data.key_of(itr);
+        CHECK(data.find(key) == itr);
+      }
+
+      CHECK_EQUAL(0 + 2 + 3 + 4 + 6 + 7, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.insert(i);
+      }
+
+      // Erase the odd values while iterating.
+      Data::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if ((*itr % 2) == 1)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      std::vector<int> result(data.begin(), data.end());
+      std::sort(result.begin(), result.end());
+
+      std::vector<int> expected = { 0, 2, 4, 6 };
+      CHECK(result == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_and_non_trivial)
+    {
+      DataString data;
+
+      Key a = data.emplace(3U, 'a');
+      Key b = data.insert(std::string("bb"));
+      Key c = data.emplace("ccc");
+
+      CHECK_EQUAL(std::string("aaa"), data[a]);
+
+      data.erase(a);
+
+      CHECK_EQUAL(std::string("bb"), data[b]);
+      CHECK_EQUAL(std::string("ccc"), data[c]);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_invalidates_keys)
+    {
+      Data data;
+
+      Key k1 = data.insert(1);
+      Key k2 = data.insert(2);
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(!data.contains(k1));
+      CHECK(!data.contains(k2));
+
+      Key k3 = data.insert(3);
+      CHECK(k3 != k1);
+      CHECK(k3 != k2);
+      CHECK_EQUAL(3, data[k3]);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move_keep_keys)
+    {
+      DataString data;
+
+      Key a = data.insert(std::string("a"));
+      Key b = data.insert(std::string("b"));
+      Key c = data.insert(std::string("c"));
+      data.erase(b);
+
+      DataString copy(data);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(std::string("a"), copy[a]);
+      CHECK_EQUAL(std::string("c"), copy[c]);
+      CHECK(!copy.contains(b));
+
+      DataString assigned;
+      assigned.insert(std::string("x"));
+      assigned = data;
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL(std::string("c"), assigned[c]);
+
+      DataString moved(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(std::string("a"), moved[a]);
+      CHECK_EQUAL(std::string("c"), moved[c]);
+
+      // New keys from the copy don't collide with the erased key.
+      Key d = copy.insert(std::string("d"));
+      CHECK(d != b);
+      CHECK(!copy.contains(b));
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      Data data;
+      IData& idata = data;
+
+      Key k = idata.insert(42);
+
+      CHECK_EQUAL(42, idata[k]);
+      CHECK_EQUAL(1U, idata.size());
+      CHECK_EQUAL(SIZE, idata.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_key_value_round_trip)
+    {
+      Data data;
+
+      Key k = data.insert(7);
+      Key copy(k.value());
+
+      CHECK(copy == k);
+      CHECK_EQUAL(k.index(), copy.index());
+      CHECK_EQUAL(k.generation(), copy.generation());
+      CHECK_EQUAL(7, data[copy]);
+    }
+  };
+}
@@ -0,0 +1,309 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/small_vector.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+namespace
+{
+  SUITE(test_small_vector)
+  {
+    static const size_t INLINE_SIZE = 4;
+    static const size_t SPILL_SIZE  = 32;
+
+    typedef etl::small_vector<int, INLINE_SIZE>         DataInt;
+    typedef etl::small_vector<std::string, INLINE_SIZE> DataString;
+    typedef etl::ismall_vector<std::string>             IDataString;
+
+    typedef etl::fixed_sized_memory_block_allocator<sizeof(std::string) * SPILL_SIZE, alignof(std::string), 2> AllocatorString;
+    typedef etl::fixed_sized_memory_block_allocator<sizeof(int) * SPILL_SIZE, alignof(int), 2>                 AllocatorInt;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK(!data.is_spilled());
+      CHECK_EQUAL(INLINE_SIZE, data.capacity());
+      CHECK_EQUAL(INLINE_SIZE, data.inline_capacity());
+      CHECK_EQUAL(INLINE_SIZE, data.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_no_allocator_is_fixed_size)
+    {
+      DataInt data;
+
+      for (size_t i = 0U; i < INLINE_SIZE; ++i)
+      {
+        data.push_back(int(i));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(99), etl::small_vector_full);
+      CHECK_EQUAL(INLINE_SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill)
+    {
+      AllocatorString allocator;
+      DataString data(allocator, SPILL_SIZE);
+      std::vector<std::string> compare;
+
+      CHECK_EQUAL(SPILL_SIZE, data.max_size());
+
+      for (size_t i = 0U; i < INLINE_SIZE; ++i)
+      {
+        data.push_back(std::to_string(i));
+        compare.push_back(std::to_string(i));
+      }
+
+      CHECK(!data.is_spilled());
+
+      data.push_back("spill");
+      compare.push_back("spill");
+
+      CHECK(data.is_spilled());
+      CHECK(allocator.is_owner_of(data.data()));
+      CHECK_EQUAL(SPILL_SIZE, data.capacity());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin(), compare.end()));
+
+      while (!data.full())
+      {
+        data.emplace_back(3U, 'x');
+        compare.emplace_back(3U, 'x');
+      }
+
+      CHECK_EQUAL(SPILL_SIZE, data.size());
+      CHECK_THROW(data.push_back("too many"), etl::small_vector_full);
+      CHECK(std::equal(data.begin(), data.end(), compare.begin(), compare.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_element_of_itself_while_spilling)
+    {
+      AllocatorString allocator;
+      DataString data(allocator, SPILL_SIZE);
+
+      data.push_back("a long string that is not held in the small string buffer");
+      data.push_back("1");
+      data.push_back("2");
+      data.push_back("3");
+
+      data.push_back(data[0]);
+
+      CHECK(data.is_spilled());
+      CHECK_EQUAL(data[0], data[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_allocation_failure)
+    {
+      AllocatorInt allocator;
+      DataInt data1(allocator, SPILL_SIZE);
+      DataInt data2(allocator, SPILL_SIZE);
+      DataInt data3(allocator, SPILL_SIZE);
+
+      data1.reserve(INLINE_SIZE + 1);
+      data2.reserve(INLINE_SIZE + 1);
+
+      CHECK(data1.is_spilled());
+      CHECK(data2.is_spilled());
+
+      data3.assign(INLINE_SIZE, 1);
+      CHECK_THROW(data3.push_back(2), etl::small_vector_no_allocation);
+      CHECK_EQUAL(INLINE_SIZE, data3.size());
+      CHECK(!data3.is_spilled());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_and_shrink_to_fit_release_the_block)
+    {
+      AllocatorInt allocator;
+      DataInt data1(allocator, SPILL_SIZE);
+
+      {
+        DataInt data2(allocator, SPILL_SIZE);
+        DataInt data3(allocator, SPILL_SIZE);
+        data2.resize(10U, 2);
+        data3.resize(10U, 3);
+      }
+
+      data1.resize(10U, 1);
+      CHECK(data1.is_spilled());
+
+      data1.resize(INLINE_SIZE);
+      data1.shrink_to_fit();
+
+      CHECK(!data1.is_spilled());
+      CHECK_EQUAL(INLINE_SIZE, data1.capacity());
+      CHECK_EQUAL(INLINE_SIZE, data1.size());
+      CHECK(std::count(data1.begin(), data1.end(), 1) == int(INLINE_SIZE));
+
+      DataInt data4(allocator, SPILL_SIZE);
+      DataInt data5(allocator, SPILL_SIZE);
+      data4.reserve(SPILL_SIZE);
+      data5.reserve(SPILL_SIZE);
+      CHECK(data4.is_spilled());
+      CHECK(data5.is_spilled());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase)
+    {
+      AllocatorString allocator;
+      DataString data(allocator, SPILL_SIZE);
+      std::vector<std::string> compare;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        const size_t position = (size_t(i) * 7U) % (compare.size() + 1U);
+        data.insert(data.begin() + position, std::to_string(i));
+        compare.insert(compare.begin() + position, std::to_string(i));
+      }
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin(), compare.end()));
+
+      data.erase(data.begin() + 3);
+      compare.erase(compare.begin() + 3);
+      data.erase(data.begin() + 2, data.begin() + 8);
+      compare.erase(compare.begin() + 2, compare.begin() + 8);
+      data.erase(data.end() - 1);
+      compare.erase(compare.end() - 1);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin(), compare.end()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin(), compare.rend()));
+      CHECK_EQUAL(compare.front(), data.front());
+      CHECK_EQUAL(compare.back(), data.back());
+      CHECK_EQUAL(compare[5], data.at(5));
+      CHECK_THROW(data.at(data.size()), etl::small_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      AllocatorString allocator;
+      DataString data1(allocator, SPILL_SIZE);
+
+      data1.assign(10U, std::string("ten"));
+
+      DataString data2(data1);
+
+      CHECK(data2.is_spilled());
+      CHECK(data1.data() != data2.data());
+      CHECK(data1 == data2);
+
+      DataString data3;
+      data3.push_back("one");
+      CHECK_THROW(data3 = data1, etl::small_vector_full);
+
+      data3.clear();
+      data3.push_back("zero");
+      data2 = data3;
+      CHECK_EQUAL(1U, data2.size());
+      CHECK(data2 == data3);
+      CHECK(data2 != data1);
+      CHECK(data2 > data1);
+      CHECK(data1 < data2);
+      CHECK(data1 <= data2);
+      CHECK(data2 >= data1);
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      AllocatorString allocator;
+      DataString data1(allocator, SPILL_SIZE);
+
+      data1.assign(10U, std::string("ten"));
+      const std::string* p_data = data1.data();
+
+      DataString data2(std::move(data1));
+
+      CHECK(data2.is_spilled());
+      CHECK_EQUAL(p_data, data2.data());
+      CHECK_EQUAL(10U, data2.size());
+      CHECK(data1.empty());
+      CHECK(!data1.is_spilled());
+
+      DataString data3(allocator, SPILL_SIZE);
+      data3.push_back("one");
+      data3 = std::move(data2);
+
+      CHECK_EQUAL(p_data, data3.data());
+      CHECK_EQUAL(10U, data3.size());
+      CHECK(data2.empty());
+
+      // Different allocator, so the elements are moved.
+      AllocatorString allocator2;
+      DataString data4(allocator2, SPILL_SIZE);
+      data4 = std::move(data3);
+
+      CHECK(data4.data() != p_data);
+      CHECK(allocator2.is_owner_of(data4.data()));
+      CHECK_EQUAL(10U, data4.size());
+      CHECK(std::count(data4.begin(), data4.end(), std::string("ten")) == 10);
+      CHECK(data3.empty());
+      CHECK(!data3.is_spilled());
+    }
+
+    //*************************************************************************
+    TEST(test_interface_reference)
+    {
+      AllocatorString allocator;
+      DataString data(allocator, SPILL_SIZE);
+
+      IDataString& idata = data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        idata.push_back(std::to_string(i));
+      }
+
+      idata.pop_back();
+
+      CHECK_EQUAL(7U, data.size());
+      CHECK_EQUAL(std::string("6"), data.back());
+      CHECK(data.is_spilled());
+
+      idata.clear();
+      CHECK(data.empty());
+      CHECK(data.is_spilled());
+    }
+  };
+}
@@ -0,0 +1,189 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/sort_network.h"
+
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <functional>
+#include <stdint.h>
+
+namespace
+{
+  //***************************************************************************
+  // By the 0-1 principle, a network sorts everything if it sorts every
+  // sequence of zeros and ones.
+  //***************************************************************************
+  template <size_t N>
+  bool sorts_all_zero_one_inputs()
+  {
+    for (uint32_t bits = 0U; bits < (uint32_t(1U) << N); ++bits)
+    {
+      etl::array<uint8_t, N> values;
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        values[i] = uint8_t((bits >> i) & 1U);
+      }
+
+      etl::sort_network(values);
+
+      if (!std::is_sorted(values.begin(), values.end()))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <size_t N>
+  bool sorts_random_inputs()
+  {
+    std::mt19937 generator(N);
+    std::uniform_int_distribution<int> distribution(-50, 50);
+
+    for (int test = 0; test < 1000; ++test)
+    {
+      int values[N];
+      std::vector<int> compare(N);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        values[i]  = distribution(generator);
+        compare[i] = values[i];
+      }
+
+      etl::sort_network<N>(values);
+      std::sort(compare.begin(), compare.end());
+
+      if (!std::equal(compare.begin(), compare.end(), values))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+#if ETL_CPP14_SUPPORTED
+  //***************************************************************************
+  constexpr int sorted_at(size_t index)
+  {
+    etl::array<int, 5> values = { 5, 3, 4, 1, 2 };
+
+    etl::sort_network(values);
+
+    return values[index];
+  }
+#endif
+
+  SUITE(test_sort_network)
+  {
+    //*************************************************************************
+    TEST(test_zero_one_principle)
+    {
+      CHECK(sorts_all_zero_one_inputs<0>());
+      CHECK(sorts_all_zero_one_inputs<1>());
+      CHECK(sorts_all_zero_one_inputs<2>());
+      CHECK(sorts_all_zero_one_inputs<3>());
+      CHECK(sorts_all_zero_one_inputs<4>());
+      CHECK(sorts_all_zero_one_inputs<5>());
+      CHECK(sorts_all_zero_one_inputs<6>());
+      CHECK(sorts_all_zero_one_inputs<7>());
+      CHECK(sorts_all_zero_one_inputs<8>());
+      CHECK(sorts_all_zero_one_inputs<9>());
+      CHECK(sorts_all_zero_one_inputs<10>());
+      CHECK(sorts_all_zero_one_inputs<11>());
+      CHECK(sorts_all_zero_one_inputs<12>());
+      CHECK(sorts_all_zero_one_inputs<13>());
+      CHECK(sorts_all_zero_one_inputs<14>());
+      CHECK(sorts_all_zero_one_inputs<15>());
+      CHECK(sorts_all_zero_one_inputs<16>());
+    }
+
+    //*************************************************************************
+    TEST(test_random)
+    {
+      CHECK(sorts_random_inputs<17>());
+      CHECK(sorts_random_inputs<19>());
+      CHECK(sorts_random_inputs<20>());
+      CHECK(sorts_random_inputs<24>());
+      CHECK(sorts_random_inputs<25>());
+      CHECK(sorts_random_inputs<31>());
+      CHECK(sorts_random_inputs<32>());
+    }
+
+    //*************************************************************************
+    TEST(test_compare)
+    {
+      etl::array<int, 9> values = { 3, 8, 1, 9, 4, 7, 2, 6, 5 };
+
+      etl::sort_network(values, std::greater<int>());
+
+      const int expected[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+      CHECK_ARRAY_EQUAL(expected, values.data(), 9);
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static_assert(sorted_at(0) == 1, "Not sorted at compile time");
+      static_assert(sorted_at(4) == 5, "Not sorted at compile time");
+
+      constexpr int median = etl::median(etl::array<int, 5>{ 9, 1, 7, 3, 5 });
+      static_assert(median == 5, "Median not found at compile time");
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_median)
+    {
+      const etl::array<int, 5> samples5 = { 12, 50, 11, 13, 10 };
+      const etl::array<int, 9> samples9 = { 7, 100, 3, 5, 4, 9, 8, 6, -100 };
+      const etl::array<int, 4> samples4 = { 4, 1, 3, 2 };
+
+      CHECK_EQUAL(12, etl::median(samples5));
+      CHECK_EQUAL(6,  etl::median(samples9));
+      CHECK_EQUAL(2,  etl::median(samples4));
+
+      // The samples are not changed.
+      CHECK_EQUAL(12, samples5[0]);
+
+      const double values[] = { 2.5, -1.0, 0.5 };
+      CHECK_EQUAL(0.5, etl::median<3>(values));
+    }
+  }
+}
@@ -0,0 +1,262 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "etl/split_flat_map.h"
+
+namespace
+{
+  SUITE(test_split_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::split_flat_map<int, std::string, SIZE> DataInt;
+    typedef etl::isplit_flat_map<int, std::string>      IDataInt;
+
+    typedef DataInt::value_type Element;
+
+    //*************************************************************************
+    template <typename TMap, typename TCompare>
+    bool Check_Order(const TMap& data, const TCompare& compare)
+    {
+      if ((data.size() != compare.size()) || (size_t(std::distance(data.begin(), data.end())) != compare.size()))
+      {
+        return false;
+      }
+
+      typename TMap::const_iterator itr = data.begin();
+
+      for (typename TCompare::const_iterator c = compare.begin(); c != compare.end(); ++c, ++itr)
+      {
+        if ((itr->first != c->first) || (itr->second != c->second))
+        {
+          return false;
+        }
+      }
+
+      typename TMap::const_reverse_iterator ritr = data.rbegin();
+
+      return (compare.empty() || ((*ritr).first == compare.rbegin()->first));
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_copy)
+    {
+      std::vector<Element> initial;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        int key = (i * 7) % int(SIZE);
+        initial.push_back(Element(key, std::to_string(key)));
+      }
+
+      DataInt data1(initial.begin(), initial.end());
+      DataInt data2(data1);
+      DataInt data3;
+      IDataInt& idata3 = data3;
+
+      idata3 = data1;
+
+      std::map<int, std::string> compare(initial.begin(), initial.end());
+
+      CHECK(data1.full());
+      CHECK(Check_Order(data1, compare));
+      CHECK(Check_Order(data2, compare));
+      CHECK(Check_Order(data3, compare));
+      CHECK(data1 == data2);
+
+      DataInt data4(std::move(data2));
+
+      CHECK(data2.empty());
+      CHECK(data1 == data4);
+      CHECK(data1 != data2);
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { Element(4, "4"), Element(0, "0"), Element(2, "2"), Element(4, "X") };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, data.begin()->first);
+      CHECK_EQUAL(std::string("4"), (*data.rbegin()).second);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      DataInt data;
+      const DataInt& cdata = data;
+
+      data[3] = "3";
+      data[1] = "1";
+      data[3] = "three";
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("three"), cdata.at(3));
+      CHECK_THROW(cdata.at(2), etl::split_flat_map_out_of_range);
+
+      data.at(1) = "one";
+      CHECK_EQUAL(std::string("one"), data.find(1)->second);
+
+      data.begin()->second = "ONE";
+      CHECK_EQUAL(std::string("ONE"), data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_emplace_erase)
+    {
+      DataInt data;
+
+      CHECK(data.insert(Element(3, "3")).second);
+      CHECK(!data.insert(Element(3, "X")).second);
+      CHECK_EQUAL(1, data.insert(data.begin(), Element(1, "1"))->first);
+      CHECK(data.emplace(2, "2").second);
+      CHECK(!data.emplace(2, "X").second);
+      CHECK_EQUAL(std::string("2"), data[2]);
+
+      for (int i = 10; i < 17; ++i)
+      {
+        data.insert(Element(i, std::to_string(i)));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(Element(20, "20")), etl::split_flat_map_full);
+      CHECK(!data.insert(Element(10, "10")).second);
+
+      CHECK_EQUAL(1U, data.erase(10));
+      CHECK_EQUAL(0U, data.erase(10));
+
+      data.erase(data.find(3));
+      data.erase(data.find(12), data.find(16));
+
+      std::map<int, std::string> compare;
+      compare[1] = "1";
+      compare[2] = "2";
+      compare[11] = "11";
+      compare[16] = "16";
+
+      CHECK(Check_Order(data, compare));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_keys_are_contiguous)
+    {
+      etl::split_flat_map<int, int, 100> data;
+
+      for (int i = 99; i >= 0; --i)
+      {
+        data[i] = i * 10;
+      }
+
+      const int* keys = data.keys();
+      const int* values = data.values();
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(i, keys[i]);
+        CHECK_EQUAL(i * 10, values[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_map)
+    {
+      etl::split_flat_map<int, int, 200> data;
+      std::map<int, int> compare;
+
+      uint32_t state = 1U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        state = (state * 1664525U) + 1013904223U;
+
+        int key = int((state >> 8) % 300U);
+
+        if ((state & 0x3U) == 0U)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (compare.size() < data.max_size())
+        {
+          CHECK_EQUAL(compare.insert(std::make_pair(key, i)).second, data.insert(std::make_pair(key, i)).second);
+        }
+
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        CHECK_EQUAL(compare.count(key + 1), data.count(key + 1));
+      }
+
+      CHECK(Check_Order(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::split_flat_map<std::string, int, SIZE, etl::less<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(cdata.find("2") == cdata.end());
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+      CHECK_EQUAL(3, data.lower_bound("2")->second);
+      CHECK_EQUAL(5, cdata.upper_bound("3")->second);
+    }
+  };
+}
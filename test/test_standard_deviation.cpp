@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/standard_deviation.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -51,6 +52,24 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Pseudo random int16_t samples, starting with a run of the most negative
+  // value, whose squares are the largest the kernels see.
+  std::vector<int16_t> make_int16_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int16_t> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = (i < 24U) ? int16_t(-32768) : int16_t(seed >> 16);
+    }
+
+    samples[24] = 32767;
+
+    return samples;
+  }
+
   SUITE(test_standard_deviation)
   {
     //*************************************************************************
@@ -160,5 +179,35 @@ namespace
       variance_result = standard_deviation.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_int16_block_standard_deviation_matches_scalar)
+    {
+      // An odd size, so that the kernel has a tail to finish.
+      std::vector<int16_t> samples = make_int16_samples(1027U, 1U);
+
+      const int16_t* first = samples.data();
+      const int16_t* last  = samples.data() + samples.size();
+
+      etl::standard_deviation<etl::standard_deviation_type::Sample, int16_t, int64_t> block(first, last);
+      etl::standard_deviation<etl::standard_deviation_type::Sample, int16_t, int64_t> scalar;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        scalar.add(samples[i]);
+      }
+
+      CHECK_EQUAL(scalar.count(), block.count());
+      CHECK_EQUAL(scalar.get_standard_deviation(), block.get_standard_deviation());
+
+      // Adding in pieces gives the same result.
+      etl::standard_deviation<etl::standard_deviation_type::Sample, int16_t, int64_t> pieces;
+      pieces.add(first, first + 5);
+      pieces.add(first + 5, first + 500);
+      pieces.add(first + 500, last);
+
+      CHECK_EQUAL(scalar.count(), pieces.count());
+      CHECK_EQUAL(scalar.get_standard_deviation(), pieces.get_standard_deviation());
+    }
   };
 }
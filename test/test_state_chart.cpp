@@ -462,5 +462,83 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_state_chart_indexed)
+    {
+      etl::state_chart_index<StateId::NUMBER_OF_STATES, EventId::ABORT + 1, 7> index;
+
+      MotorControl mc;
+      mc.ClearStatistics();
+
+      CHECK(!mc.has_index());
+      CHECK(mc.set_index(index));
+      CHECK(mc.has_index());
+
+      mc.start();
+      CHECK_EQUAL(true, mc.entered_idle);
+
+      // Unhandled events.
+      mc.process_event(EventId::STOP);
+      mc.process_event(EventId::STOPPED);
+      CHECK_EQUAL(StateId::IDLE, int(mc.get_state_id()));
+
+      // The first guard fails, so the second transition is taken.
+      mc.guard = false;
+      mc.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, int(mc.get_state_id()));
+      CHECK_EQUAL(0, mc.startCount);
+      CHECK_EQUAL(1, mc.null);
+
+      // The first guard passes.
+      mc.guard = true;
+      mc.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(mc.get_state_id()));
+      CHECK_EQUAL(1, mc.startCount);
+      CHECK_EQUAL(true, mc.isLampOn);
+
+      mc.process_event(EventId::SET_SPEED);
+      CHECK_EQUAL(StateId::RUNNING, int(mc.get_state_id()));
+      CHECK_EQUAL(1, mc.setSpeedCount);
+      CHECK_EQUAL(100, mc.speed);
+
+      mc.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::WINDING_DOWN, int(mc.get_state_id()));
+      CHECK_EQUAL(1, mc.windingDown);
+
+      // From any state.
+      mc.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, int(mc.get_state_id()));
+      CHECK_EQUAL(0, mc.windingDown);
+      CHECK_EQUAL(false, mc.isLampOn);
+
+      // Ids that are out of range are ignored.
+      mc.process_event(-1);
+      mc.process_event(EventId::ABORT + 1);
+      CHECK_EQUAL(StateId::IDLE, int(mc.get_state_id()));
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_index_too_small)
+    {
+      etl::state_chart_index<StateId::NUMBER_OF_STATES, EventId::ABORT, 7> too_few_events;
+      etl::state_chart_index<StateId::NUMBER_OF_STATES, EventId::ABORT + 1, 6> too_few_transitions;
+
+      MotorControl mc;
+      mc.ClearStatistics();
+
+      CHECK(!mc.set_index(too_few_events));
+      CHECK(!mc.has_index());
+      CHECK(!mc.set_index(too_few_transitions));
+      CHECK(!mc.has_index());
+
+      // The tables are still searched.
+      mc.start();
+      mc.guard = true;
+      mc.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(mc.get_state_id()));
+      mc.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, int(mc.get_state_id()));
+    }
   };
 }
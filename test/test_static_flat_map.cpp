@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "etl/static_flat_map.h"
+
+namespace
+{
+  SUITE(test_static_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::static_flat_map<int, std::string, SIZE> DataInt;
+    typedef etl::istatic_flat_map<int, std::string>      IDataInt;
+
+    typedef std::pair<int, std::string> Element;
+
+    //*************************************************************************
+    template <typename TMap, typename TCompare>
+    bool Check_Order(const TMap& data, const TCompare& compare)
+    {
+      return (data.size() == compare.size()) &&
+             (size_t(std::distance(data.begin(), data.end())) == compare.size()) &&
+             std::equal(compare.begin(), compare.end(), data.begin()) &&
+             std::equal(compare.rbegin(), compare.rend(), data.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_copy)
+    {
+      std::vector<Element> initial;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        int key = (i * 7) % int(SIZE);
+        initial.push_back(Element(key, std::to_string(key)));
+      }
+
+      DataInt data1(initial.begin(), initial.end());
+      DataInt data2(data1);
+      DataInt data3;
+
+      data3 = data1;
+
+      std::map<int, std::string> compare(initial.begin(), initial.end());
+
+      CHECK(data1.full());
+      CHECK(Check_Order(data1, compare));
+      CHECK(Check_Order(data2, compare));
+      CHECK(Check_Order(data3, compare));
+      CHECK(data1 == data2);
+
+      DataInt data4(std::move(data2));
+
+      CHECK(data2.empty());
+      CHECK(data1 == data4);
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { Element(4, "4"), Element(0, "0"), Element(2, "2"), Element(4, "X") };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, data.begin()->first);
+      CHECK_EQUAL(std::string("4"), data.rbegin()->second);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Element initial[] = { Element(1, "1"), Element(3, "3") };
+
+      DataInt data(std::begin(initial), std::end(initial));
+      const DataInt& cdata = data;
+
+      CHECK_EQUAL(std::string("3"), cdata.at(3));
+      CHECK_THROW(cdata.at(2), etl::static_flat_map_out_of_range);
+
+      data.at(1) = "one";
+      CHECK_EQUAL(std::string("one"), data.find(1)->second);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_full)
+    {
+      std::vector<Element> initial(SIZE + 1, Element(0, ""));
+
+      DataInt data;
+      IDataInt& idata = data;
+
+      CHECK_THROW(idata.assign(initial.begin(), initial.end()), etl::static_flat_map_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_map)
+    {
+      etl::static_flat_map<int, int, 100> data;
+
+      uint32_t state = 1U;
+
+      for (size_t size = 0U; size <= data.max_size(); ++size)
+      {
+        std::vector<std::pair<int, int> > initial;
+        std::map<int, int> compare;
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          state = (state * 1664525U) + 1013904223U;
+
+          int key = int((state >> 8) % 150U);
+
+          initial.push_back(std::make_pair(key, int(i)));
+          compare.insert(std::make_pair(key, int(i)));
+        }
+
+        data.assign(initial.begin(), initial.end());
+
+        CHECK(Check_Order(data, compare));
+
+        for (int key = -1; key <= 150; ++key)
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+
+          if (compare.count(key) != 0U)
+          {
+            CHECK_EQUAL(compare[key], data.at(key));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::static_flat_map<std::string, int, SIZE, etl::less<>> Transparent;
+
+      std::pair<std::string, int> initial[] = { std::make_pair("5", 5), std::make_pair("1", 1), std::make_pair("3", 3) };
+
+      Transparent data(std::begin(initial), std::end(initial));
+      const Transparent& cdata = data;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(cdata.find("2") == cdata.end());
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+      CHECK_EQUAL(3, data.lower_bound("2")->second);
+      CHECK_EQUAL(5, cdata.upper_bound("3")->second);
+    }
+  };
+}
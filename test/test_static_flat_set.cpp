@@ -0,0 +1,164 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "etl/static_flat_set.h"
+
+namespace
+{
+  SUITE(test_static_flat_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::static_flat_set<int, SIZE> DataInt;
+    typedef etl::istatic_flat_set<int>      IDataInt;
+
+    //*************************************************************************
+    template <typename TSet, typename TCompare>
+    bool Check_Order(const TSet& data, const TCompare& compare)
+    {
+      return (data.size() == compare.size()) &&
+             (size_t(std::distance(data.begin(), data.end())) == compare.size()) &&
+             std::equal(compare.begin(), compare.end(), data.begin()) &&
+             std::equal(compare.rbegin(), compare.rend(), data.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range_and_copy)
+    {
+      int initial[] = { 5, 1, 8, 3, 0, 9, 6, 2, 7, 4 };
+
+      DataInt data1(std::begin(initial), std::end(initial));
+      DataInt data2(data1);
+      DataInt data3;
+
+      data3 = data1;
+
+      std::set<int> compare(std::begin(initial), std::end(initial));
+
+      CHECK(data1.full());
+      CHECK(Check_Order(data1, compare));
+      CHECK(Check_Order(data2, compare));
+      CHECK(Check_Order(data3, compare));
+      CHECK(data1 == data2);
+    }
+
+#if ETL_USING_STL
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { 4, 0, 2, 4, 0 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, *data.begin());
+      CHECK_EQUAL(4, *data.rbegin());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_assign_full)
+    {
+      int initial[SIZE + 1] = { 0 };
+
+      DataInt data;
+      IDataInt& idata = data;
+
+      CHECK_THROW(idata.assign(std::begin(initial), std::end(initial)), etl::static_flat_set_full);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_set)
+    {
+      etl::static_flat_set<int, 100> data;
+
+      uint32_t state = 1U;
+
+      for (size_t size = 0U; size <= data.max_size(); ++size)
+      {
+        std::vector<int> initial;
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          state = (state * 1664525U) + 1013904223U;
+          initial.push_back(int((state >> 8) % 150U));
+        }
+
+        data.assign(initial.begin(), initial.end());
+
+        std::set<int> compare(initial.begin(), initial.end());
+
+        CHECK(Check_Order(data, compare));
+
+        for (int key = -1; key <= 150; ++key)
+        {
+          CHECK_EQUAL(compare.count(key), data.count(key));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::static_flat_set<std::string, SIZE, etl::less<>> Transparent;
+
+      const char* initial[] = { "5", "1", "3" };
+
+      Transparent data(std::begin(initial), std::end(initial));
+      const Transparent& cdata = data;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(cdata.find("2") == cdata.end());
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+      CHECK_EQUAL(std::string("3"), *data.lower_bound("2"));
+      CHECK_EQUAL(std::string("5"), *cdata.upper_bound("3"));
+    }
+  };
+}
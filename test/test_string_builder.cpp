@@ -0,0 +1,211 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <string>
+
+#include "etl/string_builder.h"
+#include "etl/generic_pool.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/wstring.h"
+
+namespace
+{
+  // Each item holds the chunk header and 48 characters.
+  typedef etl::generic_pool<48U + (2U * sizeof(void*)), etl::alignment_of<void*>::value, 4U> Pool;
+
+  //***************************************************************************
+  std::string to_std(const etl::string_builder& builder)
+  {
+    etl::span<const char> segments[10];
+
+    size_t n = builder.get_segments(segments);
+
+    std::string result;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      result.append(segments[i].data(), segments[i].size());
+    }
+
+    return result;
+  }
+
+  SUITE(test_string_builder)
+  {
+    //*************************************************************************
+    TEST(test_default)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      CHECK(builder.empty());
+      CHECK_EQUAL(0U, builder.size());
+      CHECK_EQUAL(0U, builder.number_of_segments());
+      CHECK_EQUAL(48U, builder.chunk_size());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_append_across_chunks)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      std::string expected;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        builder.append("{\"key\":");
+        builder += etl::string<4>("1234");
+        builder += etl::string_view(",\"x\"");
+        builder += '}';
+
+        expected += "{\"key\":1234,\"x\"}";
+      }
+
+      CHECK_EQUAL(expected.size(), builder.size());
+      CHECK_EQUAL(4U, builder.number_of_segments());
+      CHECK_EQUAL(4U, pool.size());
+      CHECK(!builder.is_truncated());
+      CHECK_EQUAL(expected, to_std(builder));
+
+      etl::span<const char> segments[4];
+      builder.get_segments(segments);
+      CHECK_EQUAL(48U, segments[0].size());
+      CHECK_EQUAL(expected.size() - (3U * 48U), segments[3].size());
+    }
+
+    //*************************************************************************
+    TEST(test_append_repeated_characters)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      builder.push_back('[').append(100U, '-').push_back(']');
+
+      CHECK_EQUAL(std::string("[") + std::string(100U, '-') + "]", to_std(builder));
+      CHECK_EQUAL(3U, builder.number_of_segments());
+    }
+
+    //*************************************************************************
+    TEST(test_truncation_when_pool_is_exhausted)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      builder.append(200U, 'x');
+
+      CHECK_EQUAL(4U * 48U, builder.size());
+      CHECK(builder.is_truncated());
+      CHECK(pool.full());
+
+      builder.clear();
+
+      CHECK(builder.empty());
+      CHECK(!builder.is_truncated());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_chunks_returned_on_destruction)
+    {
+      Pool pool;
+
+      {
+        etl::string_builder builder(pool);
+        builder.append(60U, 'x');
+        CHECK_EQUAL(2U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_get_segments_limited_by_span)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      builder.append(120U, 'x');
+
+      etl::span<const char> segments[2];
+      CHECK_EQUAL(2U, builder.get_segments(segments));
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Pool pool;
+      etl::string_builder builder(pool);
+
+      std::string expected;
+
+      for (char c = 'a'; c <= 'z'; ++c)
+      {
+        builder.append(5U, c);
+        expected.append(5U, c);
+      }
+
+      char buffer[200];
+
+      CHECK_EQUAL(expected.size(), builder.copy(buffer, sizeof(buffer)));
+      CHECK_EQUAL(expected, std::string(buffer, expected.size()));
+
+      CHECK_EQUAL(20U, builder.copy(buffer, 20U, 40U));
+      CHECK_EQUAL(expected.substr(40U, 20U), std::string(buffer, 20U));
+
+      CHECK_EQUAL(10U, builder.copy(buffer, 20U, expected.size() - 10U));
+
+      etl::string<50> str;
+      builder.copy_to(str);
+      CHECK_EQUAL(expected.substr(0U, 50U), std::string(str.c_str()));
+      CHECK(str.is_truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      Pool pool;
+      etl::wstring_builder builder(pool);
+
+      builder.append(L"Wide ");
+      builder.append(20U, L'w');
+
+      CHECK_EQUAL(48U / sizeof(wchar_t), builder.chunk_size());
+      CHECK_EQUAL(25U, builder.size());
+
+      etl::wstring<30> str;
+      builder.copy_to(str);
+      CHECK(etl::wstring<30>(L"Wide wwwwwwwwwwwwwwwwwwww") == str);
+    }
+  }
+}
@@ -3155,6 +3155,31 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_pattern_in_repetitive_text)
+    {
+      // A common first character switches the search to Boyer-Moore-Horspool.
+      std::string compare_haystack;
+
+      for (size_t i = 0U; i < 2000U; ++i)
+      {
+        compare_haystack += value_t('a' + ((i * 7U) % 3U));
+      }
+
+      compare_haystack += STR("abcabcXabc");
+      compare_haystack += STR("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+
+      etl::string<2100> haystack(compare_haystack.c_str());
+
+      const value_t* needles[] = { STR("abcabcX"), STR("abcabcXabc"), STR("aaaaaaaaaaaaaaaaa"), STR("abacabX"), STR("cbacbacbacbacbacbacbacbacbacbacbaccbacba") };
+
+      for (size_t i = 0U; i < (sizeof(needles) / sizeof(needles[0])); ++i)
+      {
+        CHECK_EQUAL(compare_haystack.find(needles[i]), haystack.find(needles[i]));
+        CHECK_EQUAL(compare_haystack.find(needles[i], 100U), haystack.find(needles[i], 100U));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_rfind_string)
     {
@@ -3504,6 +3529,48 @@ namespace
       CHECK(compares_agree(compare_result, result));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_search_and_compare_long_text)
+    {
+      // Long enough to use the block kernels, with matches in and across blocks.
+      const value_t* ptext = STR("GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: */*\r\n\xE9\r\n");
+
+      Compare_Text compare_text(ptext);
+      etl::string<100> text(ptext);
+
+      for (size_t position = 0; position <= compare_text.size() + 1; ++position)
+      {
+        CHECK_EQUAL(compare_text.find(STR('\r'), position), text.find(STR('\r'), position));
+        CHECK_EQUAL(compare_text.find(STR('\xE9'), position), text.find(STR('\xE9'), position));
+        CHECK_EQUAL(compare_text.find(STR("\r\n"), position), text.find(STR("\r\n"), position));
+        CHECK_EQUAL(compare_text.find(STR("example.com"), position), text.find(STR("example.com"), position));
+        CHECK_EQUAL(compare_text.find(STR("missing")), text.find(STR("missing")));
+        CHECK_EQUAL(compare_text.find_first_of(STR(":\r\n"), position), text.find_first_of(STR(":\r\n"), position));
+        CHECK_EQUAL(compare_text.find_first_of(STR("\xE9*"), position), text.find_first_of(STR("\xE9*"), position));
+        CHECK_EQUAL(compare_text.find_first_not_of(STR("ETGH /"), position), text.find_first_not_of(STR("ETGH /"), position));
+      }
+
+      // Differences in each position of the text.
+      for (size_t i = 0; i < compare_text.size(); ++i)
+      {
+        // std::string compares as unsigned char.
+        if ((compare_text[i] & 0x80) != 0)
+        {
+          continue;
+        }
+
+        Compare_Text compare_other(compare_text);
+        etl::string<100> other(text);
+
+        compare_other[i] = STR('A');
+        other[i]         = STR('A');
+
+        CHECK(compares_agree(compare_text.compare(compare_other), text.compare(other)));
+        CHECK(compares_agree(compare_other.compare(compare_text), other.compare(text)));
+        CHECK(compares_agree(compare_text.compare(0, i, compare_other), text.compare(0, i, other)));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_first_of_string_position)
     {
@@ -4047,7 +4114,7 @@ namespace
       // Test with actual string type.
       Text text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
@@ -214,6 +214,20 @@ namespace
       CHECK_EQUAL(String(STR("0x1e240")), ss.str());
     }
 
+    //*************************************************************************
+    TEST(test_custom_inline_format_shortest)
+    {
+      String str;
+      Stream ss(str);
+
+      ss << etl::setprecision(3) << etl::shortest << 0.1 << STR(" ") << 2.0f / 3.0f;
+      CHECK_EQUAL(String(STR("0.1 0.6666667")), ss.str());
+
+      ss.str().clear();
+      ss << etl::noshortest << 0.1;
+      CHECK_EQUAL(String(STR("0.100")), ss.str());
+    }
+
     //*************************************************************************
     TEST(test_custom_multi_inline_format)
     {
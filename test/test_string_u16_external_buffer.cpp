@@ -4394,7 +4394,7 @@ namespace
       TextBuffer buffer;
       Text text(STR("ABCDEFHIJKL"), buffer.data(), buffer.size());
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::private_hash::generic_block_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
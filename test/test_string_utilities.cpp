@@ -1076,6 +1076,99 @@ namespace
       CHECK_EQUAL(0U, tokens.size());
     }
 
+    //*************************************************************************
+    TEST(test_split_view_keep_empty_tokens)
+    {
+      String text(STR(",,,The,cat,sat,,on,the,mat,,,"));
+      StringView textview(text.data(), text.size());
+
+      etl::split_view<StringView> tokens(textview, STR(","));
+
+      Vector expected;
+      etl::optional<StringView> token;
+
+      while ((token = etl::get_token(text, STR(","), token, false)))
+      {
+        expected.emplace_back(token.value());
+      }
+
+      Vector result;
+
+      for (etl::split_view<StringView>::const_iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+      {
+        result.emplace_back(*itr);
+      }
+
+      CHECK_EQUAL(13U, tokens.size());
+      CHECK_EQUAL(expected.size(), result.size());
+      CHECK(expected == result);
+      CHECK(!tokens.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_ignore_empty_tokens)
+    {
+      String text(STR(" The cat.sat,, on\tthe mat. "));
+      StringView textview(text.data(), text.size());
+
+      etl::split_view<StringView> tokens(textview, StringView(STR(" .,\t")), true);
+
+      Vector expected;
+      expected.emplace_back(STR("The"));
+      expected.emplace_back(STR("cat"));
+      expected.emplace_back(STR("sat"));
+      expected.emplace_back(STR("on"));
+      expected.emplace_back(STR("the"));
+      expected.emplace_back(STR("mat"));
+
+      Vector result;
+
+      for (StringView token : tokens)
+      {
+        result.emplace_back(token);
+      }
+
+      CHECK_EQUAL(6U, tokens.size());
+      CHECK(expected == result);
+
+      // The tokens refer to the input.
+      CHECK((*tokens.begin()).data() == text.data() + 1);
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_no_tokens)
+    {
+      String text(STR(" .,  ,. "));
+      StringView textview(text.data(), text.size());
+
+      etl::split_view<StringView> ignore_empty(textview, STR(" .,"), true);
+      CHECK(ignore_empty.empty());
+      CHECK_EQUAL(0U, ignore_empty.size());
+      CHECK(ignore_empty.begin() == ignore_empty.end());
+
+      etl::split_view<StringView> keep_empty(textview, STR(" .,"));
+      CHECK_EQUAL(9U, keep_empty.size());
+      CHECK_EQUAL(9, std::distance(keep_empty.begin(), keep_empty.end()));
+
+      StringView empty_view;
+      etl::split_view<StringView> none(empty_view, STR(","));
+      CHECK(none.empty());
+      CHECK_EQUAL(0U, none.size());
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_no_delimiters)
+    {
+      String text(STR("The cat"));
+      StringView textview(text.data(), text.size());
+
+      etl::split_view<StringView> tokens(textview, STR(","), true);
+
+      CHECK_EQUAL(1U, tokens.size());
+      CHECK(textview == *tokens.begin());
+      CHECK(++tokens.begin() == tokens.end());
+    }
+
     //*************************************************************************
     TEST(test_pad_left)
     {
@@ -1651,5 +1744,111 @@ namespace
 
       CHECK(text == expected);
     }
+
+    //*************************************************************************
+    TEST(test_case_conversion_all_characters)
+    {
+      // Long enough to use the block conversions, and includes every 8 bit value.
+      etl::string<300> upper;
+      etl::string<300> lower;
+      etl::string<300> expected_upper;
+      etl::string<300> expected_lower;
+
+      for (int i = 1; i < 256; ++i)
+      {
+        const Char c = Char(i);
+
+        upper.push_back(c);
+        lower.push_back(c);
+        expected_upper.push_back(((i >= 'a') && (i <= 'z')) ? Char(i - 32) : c);
+        expected_lower.push_back(((i >= 'A') && (i <= 'Z')) ? Char(i + 32) : c);
+      }
+
+      etl::to_upper_case(upper);
+      etl::to_lower_case(lower);
+
+      CHECK(expected_upper == upper);
+      CHECK(expected_lower == lower);
+
+      etl::string<300> sentence(STR("hELLO, THIS IS A LONGER SENTENCE, OVER SIXTEEN CHARACTERS."));
+      etl::to_sentence_case(sentence);
+      CHECK(etl::string<300>(STR("Hello, this is a longer sentence, over sixteen characters.")) == sentence);
+
+      String empty;
+      etl::to_sentence_case(empty);
+      CHECK(empty.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_replace_characters_long_text)
+    {
+      etl::string<300> text(STR("path/to/a/file name/with spaces/and/more/directories/than/sixteen"));
+      etl::string<300> expected(STR("path\\to\\a\\file_name\\with_spaces\\and\\more\\directories\\than\\sixteen"));
+
+      etl::pair<Char, Char> lookup[] =
+      {
+        { STR('/'), STR('\\') },
+        { STR(' '), STR('_') }
+      };
+
+      etl::replace_characters(text, etl::begin(lookup), etl::end(lookup));
+
+      CHECK(expected == text);
+    }
+
+    //*************************************************************************
+    TEST(test_compare_case_insensitive)
+    {
+      StringView a(STR("Content-Type: application/json"));
+      StringView b(STR("content-type: APPLICATION/JSON"));
+      StringView c(STR("content-type: application/jsoo"));
+      StringView d(STR("content-type"));
+
+      CHECK_EQUAL(0, etl::compare_case_insensitive(a, b));
+      CHECK(etl::compare_case_insensitive(a, c) < 0);
+      CHECK(etl::compare_case_insensitive(c, a) > 0);
+      CHECK(etl::compare_case_insensitive(d, a) < 0);
+      CHECK(etl::compare_case_insensitive(a, d) > 0);
+      CHECK_EQUAL(0, etl::compare_case_insensitive(StringView(), StringView()));
+
+      CHECK(etl::equal_case_insensitive(a, b));
+      CHECK(!etl::equal_case_insensitive(a, c));
+      CHECK(!etl::equal_case_insensitive(a, d));
+
+      // '@' and '`' are not letters.
+      CHECK(!etl::equal_case_insensitive(StringView(STR("@")), StringView(STR("`"))));
+    }
+
+    //*************************************************************************
+    TEST(test_find_case_insensitive)
+    {
+      StringView text(STR("Accept: text/html, Application/XHTML+xml, application/xml"));
+
+      CHECK_EQUAL(19U, etl::find_case_insensitive(text, StringView(STR("application/xhtml"))));
+      CHECK_EQUAL(42U, etl::find_case_insensitive(text, StringView(STR("APPLICATION/XML"))));
+      CHECK_EQUAL(42U, etl::find_case_insensitive(text, StringView(STR("application")), 20U));
+      CHECK_EQUAL(0U,  etl::find_case_insensitive(text, StringView(STR("ACCEPT"))));
+      CHECK_EQUAL(5U,  etl::find_case_insensitive(text, StringView(), 5U));
+      CHECK_EQUAL(StringView::npos, etl::find_case_insensitive(text, StringView(STR("image/png"))));
+      CHECK_EQUAL(StringView::npos, etl::find_case_insensitive(text, StringView(STR("xml")), text.size()));
+      CHECK_EQUAL(StringView::npos, etl::find_case_insensitive(text, StringView(STR("a")), text.size() + 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_case_insensitive_hash)
+    {
+      etl::case_insensitive_hash<StringView> hash;
+      etl::case_insensitive_equal_to<StringView> equal;
+
+      StringView a(STR("X-Forwarded-For-A-Rather-Long-Header-Name-Over-Sixty-Four-Characters-Long"));
+      StringView b(STR("x-forwarded-for-a-rather-long-header-name-over-sixty-four-characters-long"));
+      StringView c(STR("X-Forwarded-Host"));
+
+      CHECK_EQUAL(hash(a), hash(b));
+      CHECK(hash(a) != hash(c));
+      CHECK(equal(a, b));
+      CHECK(!equal(a, c));
+      CHECK_EQUAL(hash(StringView()), hash(StringView(STR(""))));
+    }
   };
 }
@@ -710,6 +710,30 @@ namespace
       CHECK(View::npos == view.find_first_of(s5, 2, 3));
     }
 
+    //*************************************************************************
+    TEST(test_find_and_compare_long_text)
+    {
+      const std::string long_text = "Content-Type: text/plain; charset=utf-8\r\nContent-Length: 42\r\n";
+      View view(long_text.data(), long_text.size());
+
+      for (size_t position = 0; position <= long_text.size() + 1; ++position)
+      {
+        CHECK_EQUAL(long_text.find("\r\n", position), view.find("\r\n", position));
+        CHECK_EQUAL(long_text.find("Length", position), view.find("Length", position));
+        CHECK_EQUAL(long_text.find_first_of(";:\r", position), view.find_first_of(";:\r", position));
+        CHECK_EQUAL(long_text.find_first_not_of("Contet-ypx ", position), view.find_first_not_of("Contet-ypx ", position));
+      }
+
+      std::string other = long_text;
+      other[long_text.size() - 3] = '0';
+
+      CHECK(view.compare(View(other.data(), other.size())) > 0);
+      CHECK(View(other.data(), other.size()).compare(view) < 0);
+      CHECK(View(other.data(), other.size()) < view);
+      CHECK(view.compare(View(long_text.data(), long_text.size() - 1)) > 0);
+      CHECK_EQUAL(0, view.compare(View(long_text.data(), long_text.size())));
+    }
+
     //*************************************************************************
     TEST(test_find_last_of)
     {
@@ -0,0 +1,199 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <functional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/striped_unordered_set.h"
+
+#if ETL_HAS_MUTEX
+
+namespace
+{
+  SUITE(test_striped_unordered_set)
+  {
+    static const size_t SIZE = 32;
+
+    typedef etl::striped_unordered_set<int, SIZE, SIZE / 2> Data;
+    typedef etl::istriped_unordered_set<int>                IData;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(SIZE / 2, data.bucket_count());
+      CHECK_EQUAL(8U, data.stripe_count());
+
+      etl::striped_unordered_set<int, 4, 2> small;
+      CHECK_EQUAL(2U, small.stripe_count());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_contains_erase)
+    {
+      Data data;
+      IData& idata = data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(idata.insert(i * 3));
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(!data.insert(0));
+      CHECK_THROW(data.insert(1), etl::striped_unordered_set_full);
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(data.contains(i * 3));
+        CHECK_EQUAL(1U, data.count(i * 3));
+        CHECK(!data.contains(i * 3 + 1));
+      }
+
+      CHECK_EQUAL(1U, data.erase(6));
+      CHECK_EQUAL(0U, data.erase(6));
+      CHECK(!data.contains(6));
+      CHECK_EQUAL(SIZE - 1U, data.size());
+      CHECK(data.insert(1));
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK(!data.contains(1));
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_keys)
+    {
+      etl::striped_unordered_set<std::string, 8, 4, 4, std::hash<std::string>> data;
+
+      CHECK(data.insert("one"));
+      CHECK(data.insert("two"));
+      CHECK(!data.insert("one"));
+      CHECK(data.contains("two"));
+      CHECK_EQUAL(1U, data.erase("one"));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    struct Collector
+    {
+      void operator ()(int key)
+      {
+        keys.insert(key);
+      }
+
+      std::set<int> keys;
+    };
+
+    TEST(test_for_each)
+    {
+      Data data;
+      std::set<int> compare;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(i * 5);
+        compare.insert(i * 5);
+      }
+
+      Collector collector = data.for_each(Collector());
+
+      CHECK(collector.keys == compare);
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_writers)
+    {
+      typedef etl::striped_unordered_set<int, 1024, 256> Concurrent;
+
+      Concurrent data;
+
+      const int Threads       = 4;
+      const int KeysPerThread = 200;
+      const int Rounds        = 20;
+
+      std::vector<std::thread> writers;
+
+      // Each thread repeatedly inserts and erases its own keys, and inserts a set of shared keys.
+      for (int t = 0; t < Threads; ++t)
+      {
+        writers.push_back(std::thread([&data, t]()
+        {
+          for (int round = 0; round < Rounds; ++round)
+          {
+            for (int k = 0; k < KeysPerThread; ++k)
+            {
+              data.insert((t * KeysPerThread) + k);
+              data.insert(100000 + k);
+            }
+
+            if (round != (Rounds - 1))
+            {
+              for (int k = 0; k < KeysPerThread; ++k)
+              {
+                data.erase((t * KeysPerThread) + k);
+              }
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < writers.size(); ++t)
+      {
+        writers[t].join();
+      }
+
+      CHECK_EQUAL(size_t((Threads + 1) * KeysPerThread), data.size());
+
+      for (int k = 0; k < Threads * KeysPerThread; ++k)
+      {
+        CHECK(data.contains(k));
+      }
+
+      for (int k = 0; k < KeysPerThread; ++k)
+      {
+        CHECK(data.contains(100000 + k));
+      }
+    }
+  };
+}
+
+#endif
@@ -127,6 +127,7 @@ public:
     if (workIndex == addAtIndex)
     {
       pTaskToAddTo->work.push_back(workToAdd);
+      pTaskToAddTo->set_task_ready();
     }
   }
 
@@ -161,10 +162,95 @@ Task task3(3, work3, common);
 
 etl::task* taskList[] = { &task1, &task2, &task3 };
 
+//*****************************************************************************
+// A task with a list of jobs, each with a deadline and a run time.
+//*****************************************************************************
+const uint32_t No_Deadline = 0U;
+
+struct Job
+{
+  uint32_t deadline;
+  uint32_t run_time;
+};
+
+uint32_t deadline_clock_ticks = 0U;
+
+uint32_t DeadlineClock()
+{
+  return deadline_clock_ticks;
+}
+
+class DeadlineTask : public etl::task
+{
+public:
+
+  DeadlineTask(etl::task_priority_t priority_, const std::string& name_, const std::vector<Job>& jobs_, WorkList_t& done_)
+    : task(priority_)
+    , name(name_)
+    , jobs(jobs_)
+    , index(0)
+    , done(done_)
+  {
+  }
+
+  uint32_t task_request_work() const ETL_OVERRIDE
+  {
+    return uint32_t(jobs.size() - index);
+  }
+
+  void task_process_work() ETL_OVERRIDE
+  {
+    done.push_back(name);
+    deadline_clock_ticks += jobs[index].run_time;
+    ++index;
+  }
+
+  bool task_deadline(uint32_t& deadline) const ETL_OVERRIDE
+  {
+    if ((index == jobs.size()) || (jobs[index].deadline == No_Deadline))
+    {
+      return false;
+    }
+
+    deadline = jobs[index].deadline;
+    return true;
+  }
+
+private:
+
+  std::string      name;
+  std::vector<Job> jobs;
+  size_t           index;
+  WorkList_t&      done;
+};
+
+//*****************************************************************************
+struct OverrunLog
+{
+  void Overrun(const etl::deadline_overrun& overrun)
+  {
+    tasks.push_back(&overrun.task);
+    lateness.push_back(overrun.lateness());
+  }
+
+  std::vector<const etl::task*> tasks;
+  std::vector<uint32_t>         lateness;
+};
+
+// Each read of the clock advances it by one tick.
+uint32_t test_clock_ticks = 0U;
+
+uint32_t TestClock()
+{
+  return test_clock_ticks++;
+}
+
 typedef etl::scheduler<etl::scheduler_policy_sequential_single,   sizeof(etl::array_size(taskList))> SchedulerSequentialSingle;
 typedef etl::scheduler<etl::scheduler_policy_sequential_multiple, sizeof(etl::array_size(taskList))> SchedulerSequentialMultiple;
 typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
 typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
+typedef etl::scheduler<etl::scheduler_policy_ready_bitmap,        sizeof(etl::array_size(taskList))> SchedulerReadyBitmap;
+typedef etl::scheduler<etl::scheduler_policy_earliest_deadline,   4U>                                 SchedulerEarliestDeadline;
 
 namespace
 {
@@ -287,5 +373,200 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap)
+    {
+      SchedulerReadyBitmap s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, etl::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      // The same order as highest priority.
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_bitmap_signalled_work)
+    {
+      SchedulerReadyBitmap s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      // Work given to another task is signalled by the task that gives it.
+      task2.WorkToAdd(2, "T3W3", task3);
+      task3.WorkToAdd(1, "T1W4", task1);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(taskList, etl::size(taskList));
+      s.start();
+
+      WorkList_t expected = { "T3W1", "T3W2", "T2W1", "T2W2", "T3W3", "T2W3", "T2W4", "T1W1", "T1W2", "T1W3", "T1W4" };
+
+      CHECK(expected == common.workList);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_earliest_deadline)
+    {
+      WorkList_t done;
+
+      // The clock starts near the top of its range, so deadlines wrap.
+      const uint32_t t0 = 0xFFFFFFF0UL;
+      deadline_clock_ticks = t0;
+
+      DeadlineTask taskA(3, "A", { { t0 + 30, 5 }, { t0 + 60, 5 } }, done);
+      DeadlineTask taskB(2, "B", { { t0 + 10, 5 }, { t0 + 40, 5 } }, done);
+      DeadlineTask taskC(1, "C", { { t0 + 20, 5 } }, done);
+      DeadlineTask taskD(4, "D", { { No_Deadline, 1 }, { No_Deadline, 1 } }, done);
+
+      SchedulerEarliestDeadline s;
+      Common deadline_common;
+      deadline_common.pScheduler = &s;
+
+      s.get_scheduler_policy().set_deadline_clock(DeadlineClock);
+      s.set_idle_callback(deadline_common.idle_callback);
+      s.add_task(taskA);
+      s.add_task(taskB);
+      s.add_task(taskC);
+      s.add_task(taskD);
+      s.start();
+
+      // Deadline order first, although D has the highest priority.
+      WorkList_t expected = { "B", "C", "A", "B", "A", "D", "D" };
+      CHECK(expected == done);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_earliest_deadline_overrun)
+    {
+      WorkList_t done;
+
+      deadline_clock_ticks = 0U;
+
+      DeadlineTask taskA(1, "A", { { 10, 8 }, { 12, 3 } }, done);
+      DeadlineTask taskB(2, "B", { { 9, 4 } }, done);
+
+      SchedulerEarliestDeadline s;
+      Common deadline_common;
+      deadline_common.pScheduler = &s;
+      OverrunLog log;
+      etl::function_mp<OverrunLog, const etl::deadline_overrun&, &OverrunLog::Overrun> overrun_callback(log);
+
+      s.get_scheduler_policy().set_deadline_clock(DeadlineClock);
+      s.get_scheduler_policy().set_overrun_callback(overrun_callback);
+      s.set_idle_callback(deadline_common.idle_callback);
+      s.add_task(taskA);
+      s.add_task(taskB);
+      s.start();
+
+      // B finishes at 4, A at 12 (2 late), then A at 15 (3 late).
+      WorkList_t expected = { "B", "A", "A" };
+      CHECK(expected == done);
+
+      CHECK_EQUAL(2U, log.tasks.size());
+      CHECK(log.tasks[0] == &taskA);
+      CHECK_EQUAL(2U, log.lateness[0]);
+      CHECK(log.tasks[1] == &taskA);
+      CHECK_EQUAL(3U, log.lateness[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_statistics)
+    {
+      SchedulerHighestPriority s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(taskList, etl::size(taskList));
+      s.set_statistics_clock(TestClock);
+      s.start();
+
+      // Iterated in priority order.
+      etl::ischeduler::statistics_iterator itr = s.statistics_begin();
+      CHECK_EQUAL(3, std::distance(s.statistics_begin(), s.statistics_end()));
+      CHECK(itr[0].p_task == &task3);
+      CHECK(itr[1].p_task == &task2);
+      CHECK(itr[2].p_task == &task1);
+
+      const etl::task_statistics& stats1 = *s.get_statistics(task1);
+      const etl::task_statistics& stats2 = *s.get_statistics(task2);
+      const etl::task_statistics& stats3 = *s.get_statistics(task3);
+
+      CHECK_EQUAL(3U, stats1.invocations);
+      CHECK_EQUAL(4U, stats2.invocations);
+      CHECK_EQUAL(2U, stats3.invocations);
+
+      // The clock advances one tick between the start and end of each call.
+      CHECK_EQUAL(3U, stats1.total_time);
+      CHECK_EQUAL(1U, stats1.max_time);
+      CHECK_EQUAL(1U, stats1.average_time());
+
+      // Task 3 is asked before every call: 2, 1, then 0 for each of the remaining 8 passes.
+      CHECK_EQUAL(10U, stats3.work_requests);
+      CHECK_EQUAL(3U, stats3.total_work);
+      CHECK_EQUAL(0U, stats3.average_work());
+
+      // Task 1 is asked 3 times with work and once when idle.
+      CHECK_EQUAL(4U, stats1.work_requests);
+      CHECK_EQUAL(6U, stats1.total_work);
+      CHECK_EQUAL(1U, stats1.average_work());
+
+      CHECK(s.get_statistics(task1) != nullptr);
+
+      s.clear_statistics();
+      CHECK_EQUAL(0U, stats1.invocations);
+      CHECK_EQUAL(0U, stats2.total_work);
+      CHECK(task1.get_task_statistics() != nullptr);
+
+      s.set_statistics_clock(nullptr);
+      CHECK(task1.get_task_statistics() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_statistics_disabled)
+    {
+      SchedulerHighestPriority s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task_list(taskList, etl::size(taskList));
+      s.start();
+
+      CHECK(task1.get_task_statistics() == nullptr);
+      CHECK_EQUAL(0U, s.get_statistics(task1)->invocations);
+      CHECK_EQUAL(0U, s.get_statistics(task1)->work_requests);
+    }
   };
 }
@@ -0,0 +1,195 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/tdigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+  //*********************************
+  // Latency like values: log normal-ish, with a long tail.
+  std::vector<double> make_values(size_t size, uint32_t seed)
+  {
+    std::vector<double> values(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      double sum = 0.0;
+
+      for (int j = 0; j < 4; ++j)
+      {
+        seed = (seed * 1664525U) + 1013904223U;
+        sum += double(seed >> 8) / double(1U << 24);
+      }
+
+      values[i] = std::exp(2.0 * sum);
+    }
+
+    return values;
+  }
+
+  //*********************************
+  // The fraction of the values below x.
+  double rank_of(const std::vector<double>& sorted, double x)
+  {
+    return double(std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / double(sorted.size());
+  }
+
+  typedef etl::tdigest<double, 100U> digest_t;
+
+  SUITE(test_tdigest)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      digest_t digest;
+
+      CHECK(digest.empty());
+      CHECK_EQUAL(0U, digest.count());
+      CHECK_EQUAL(0U, digest.centroid_count());
+      CHECK_EQUAL(0.0, digest.quantile(0.5));
+    }
+
+    //*************************************************************************
+    TEST(test_single_value)
+    {
+      digest_t digest;
+      digest.add(42.0);
+
+      CHECK_EQUAL(1U, digest.count());
+      CHECK_EQUAL(42.0, digest.quantile(0.0));
+      CHECK_EQUAL(42.0, digest.quantile(0.5));
+      CHECK_EQUAL(42.0, digest.quantile(1.0));
+    }
+
+    //*************************************************************************
+    TEST(test_quantiles)
+    {
+      std::vector<double> values = make_values(100000U, 1U);
+
+      digest_t digest(values.begin(), values.end());
+
+      std::vector<double> sorted(values);
+      std::sort(sorted.begin(), sorted.end());
+
+      CHECK_EQUAL(values.size(), digest.count());
+      CHECK(digest.centroid_count() <= 100U);
+      CHECK_EQUAL(sorted.front(), digest.min());
+      CHECK_EQUAL(sorted.back(), digest.max());
+      CHECK_EQUAL(sorted.front(), digest.quantile(0.0));
+      CHECK_EQUAL(sorted.back(), digest.quantile(1.0));
+
+      // The error in rank is smallest at the tails.
+      CHECK_CLOSE(0.5,   rank_of(sorted, digest.quantile(0.5)),   0.01);
+      CHECK_CLOSE(0.9,   rank_of(sorted, digest.quantile(0.9)),   0.005);
+      CHECK_CLOSE(0.99,  rank_of(sorted, digest.quantile(0.99)),  0.001);
+      CHECK_CLOSE(0.999, rank_of(sorted, digest.quantile(0.999)), 0.0003);
+      CHECK_CLOSE(0.001, rank_of(sorted, digest.quantile(0.001)), 0.0003);
+
+      // Centroids are in order.
+      for (size_t i = 1U; i < digest.centroid_count(); ++i)
+      {
+        CHECK(digest.get_centroid(i - 1U).mean <= digest.get_centroid(i).mean);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      std::vector<double> values = make_values(40000U, 2U);
+
+      std::vector<double> sorted(values);
+      std::sort(sorted.begin(), sorted.end());
+
+      // As if each quarter had been gathered on a different thread.
+      digest_t parts[4];
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        parts[i % 4U].add(values[i]);
+      }
+
+      digest_t merged;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        merged.merge(parts[i]);
+      }
+
+      merged.merge(digest_t());
+
+      CHECK_EQUAL(values.size(), merged.count());
+      CHECK(merged.centroid_count() <= 100U);
+      CHECK_EQUAL(sorted.front(), merged.min());
+      CHECK_EQUAL(sorted.back(), merged.max());
+      CHECK_CLOSE(0.5,  rank_of(sorted, merged.quantile(0.5)),  0.01);
+      CHECK_CLOSE(0.99, rank_of(sorted, merged.quantile(0.99)), 0.002);
+
+      const double median = merged.quantile(0.5);
+      merged.merge(merged);
+      CHECK_EQUAL(2U * values.size(), merged.count());
+      CHECK_CLOSE(median, merged.quantile(0.5), median * 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_weights_nan_and_clear)
+    {
+      etl::tdigest<float, 20U, 5U> digest;
+
+      digest.add(1.0f, 99U);
+      digest.add(100.0f);
+      digest.add(std::nanf(""));
+      digest.add(50.0f, 0U);
+
+      CHECK_EQUAL(100U, digest.count());
+      CHECK_EQUAL(1.0f, digest.min());
+      CHECK_EQUAL(100.0f, digest.max());
+      CHECK_EQUAL(1.0f, digest.quantile(0.25));
+      CHECK_EQUAL(100.0f, digest.quantile(1.0));
+
+      digest.clear();
+      CHECK(digest.empty());
+      CHECK_EQUAL(0.0f, digest.quantile(0.5));
+
+      // Many more values than the buffer or centroids hold.
+      for (int i = 0; i < 1000; ++i)
+      {
+        digest.add(float(i));
+      }
+
+      CHECK(digest.centroid_count() <= 20U);
+      CHECK_CLOSE(500.0f, digest.quantile(0.5), 30.0f);
+    }
+  };
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/timer_command_queue.h"
+#include "etl/callback_timer.h"
+#include "etl/callback_timer_wheel.h"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+namespace
+{
+  uint64_t ticks = 0;
+
+  std::vector<uint64_t> tick_list1;
+  std::vector<uint64_t> tick_list2;
+
+  void callback1()
+  {
+    tick_list1.push_back(ticks);
+  }
+
+  void callback2()
+  {
+    tick_list2.push_back(ticks);
+  }
+
+  std::atomic<uint32_t> thread_calls(0);
+
+  void thread_callback()
+  {
+    ++thread_calls;
+  }
+
+  SUITE(test_timer_command_queue)
+  {
+    //*************************************************************************
+    TEST(test_commands_applied_on_tick)
+    {
+      etl::callback_timer<2> timer_controller;
+      etl::timer_command_queue<etl::callback_timer<2>, 4> commands(timer_controller);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(callback2, 15, etl::timer::mode::SINGLE_SHOT);
+
+      tick_list1.clear();
+      tick_list2.clear();
+      timer_controller.enable(true);
+
+      CHECK(commands.start(id1));
+      CHECK(commands.start(id2));
+      CHECK(!commands.empty());
+
+      // Nothing happens until the commands are applied.
+      CHECK_EQUAL(uint32_t(etl::timer::state::INACTIVE), timer_controller.time_to_next());
+
+      ticks = 0;
+
+      while (ticks < 35U)
+      {
+        ++ticks;
+        commands.tick(1U);
+
+        if (ticks == 20U)
+        {
+          CHECK(commands.stop(id1));
+        }
+      }
+
+      CHECK(commands.empty());
+
+      std::vector<uint64_t> compare1 = { 10, 20 };
+      std::vector<uint64_t> compare2 = { 15 };
+
+      CHECK(tick_list1 == compare1);
+      CHECK(tick_list2 == compare2);
+    }
+
+    //*************************************************************************
+    TEST(test_commands_applied_in_order)
+    {
+      typedef etl::callback_timer_wheel<2> Controller;
+
+      Controller timer_controller;
+      etl::timer_command_queue<Controller, 8> commands(timer_controller);
+
+      etl::timer_wheel::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::SINGLE_SHOT);
+
+      tick_list1.clear();
+      timer_controller.enable(true);
+
+      CHECK(commands.start(id1));
+      CHECK(commands.stop(id1));
+      CHECK(commands.start(id1, etl::timer::start::IMMEDIATE));
+
+      ticks = 0;
+      commands.tick(0U);
+
+      std::vector<uint64_t> compare1 = { 0 };
+
+      CHECK(tick_list1 == compare1);
+    }
+
+    //*************************************************************************
+    TEST(test_queue_full)
+    {
+      etl::callback_timer<1> timer_controller;
+      etl::timer_command_queue<etl::callback_timer<1>, 2> commands(timer_controller);
+
+      etl::timer::id::type id1 = timer_controller.register_timer(callback1, 10, etl::timer::mode::SINGLE_SHOT);
+
+      CHECK(commands.start(id1));
+      CHECK(commands.stop(id1));
+      CHECK(!commands.start(id1));
+
+      commands.clear();
+      CHECK(commands.empty());
+      CHECK(commands.start(id1));
+    }
+
+    //*************************************************************************
+    TEST(test_start_from_another_thread)
+    {
+      typedef etl::callback_timer_wheel<16> Controller;
+
+      Controller timer_controller;
+      etl::timer_command_queue<Controller, 64> commands(timer_controller);
+
+      for (int i = 0; i < 16; ++i)
+      {
+        timer_controller.register_timer(thread_callback, 1, etl::timer::mode::SINGLE_SHOT);
+      }
+
+      thread_calls = 0;
+      timer_controller.enable(true);
+
+      std::atomic<bool> done(false);
+      const uint32_t Starts = 10000U;
+
+      std::thread producer([&]()
+      {
+        for (uint32_t i = 0U; i < Starts; ++i)
+        {
+          while (!commands.start(etl::timer_wheel::id::type(i % 16U)))
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        done = true;
+      });
+
+      while (!done || !commands.empty() || (timer_controller.number_of_active_timers() != 0U))
+      {
+        commands.tick(1U);
+      }
+
+      producer.join();
+
+      // Every start was applied, although a restart of a running timer replaces it.
+      CHECK(thread_calls > 0U);
+      CHECK(thread_calls <= Starts);
+      CHECK_EQUAL(0U, timer_controller.number_of_active_timers());
+    }
+  };
+}
@@ -0,0 +1,196 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmath>
+
+#include "etl/to_arithmetic.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/wstring.h"
+
+namespace
+{
+  typedef etl::to_arithmetic_status Status;
+
+  SUITE(test_to_arithmetic)
+  {
+    //*************************************************************************
+    TEST(test_decimal_integers)
+    {
+      CHECK_EQUAL(0,      etl::to_arithmetic<int>(etl::string_view("0")).value());
+      CHECK_EQUAL(123,    etl::to_arithmetic<int>(etl::string_view("123")).value());
+      CHECK_EQUAL(123,    etl::to_arithmetic<int>(etl::string_view("+123")).value());
+      CHECK_EQUAL(-123,   etl::to_arithmetic<int>(etl::string_view("-123")).value());
+      CHECK_EQUAL(123U,   etl::to_arithmetic<unsigned>(etl::string_view("000123")).value());
+      CHECK_EQUAL(12,     etl::to_arithmetic<int>("123", 2).value());
+
+      CHECK_EQUAL(INT8_MAX,   etl::to_arithmetic<int8_t>(etl::string_view("127")).value());
+      CHECK_EQUAL(INT8_MIN,   etl::to_arithmetic<int8_t>(etl::string_view("-128")).value());
+      CHECK_EQUAL(UINT8_MAX,  etl::to_arithmetic<uint8_t>(etl::string_view("255")).value());
+      CHECK_EQUAL(INT64_MAX,  etl::to_arithmetic<int64_t>(etl::string_view("9223372036854775807")).value());
+      CHECK_EQUAL(INT64_MIN,  etl::to_arithmetic<int64_t>(etl::string_view("-9223372036854775808")).value());
+      CHECK_EQUAL(UINT64_MAX, etl::to_arithmetic<uint64_t>(etl::string_view("18446744073709551615")).value());
+    }
+
+    //*************************************************************************
+    TEST(test_radix)
+    {
+      CHECK_EQUAL(5,      etl::to_arithmetic<int>(etl::string_view("101"), etl::radix::binary).value());
+      CHECK_EQUAL(-83,    etl::to_arithmetic<int>(etl::string_view("-123"), etl::radix::octal).value());
+      CHECK_EQUAL(0xBEEF, etl::to_arithmetic<int>(etl::string_view("BeeF"), etl::radix::hex).value());
+      CHECK_EQUAL(35,     etl::to_arithmetic<int>(etl::string_view("z"), 36).value());
+
+      CHECK_EQUAL(Status::Invalid_Radix, etl::to_arithmetic<int>(etl::string_view("1"), 1).error());
+      CHECK_EQUAL(Status::Invalid_Radix, etl::to_arithmetic<int>(etl::string_view("1"), 37).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<int>(etl::string_view("102"), etl::radix::binary).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<int>(etl::string_view("0x10"), etl::radix::hex).error());
+    }
+
+    //*************************************************************************
+    TEST(test_integer_errors)
+    {
+      CHECK_EQUAL(Status::Invalid_Format,     etl::to_arithmetic<int>(etl::string_view("")).error());
+      CHECK_EQUAL(Status::Invalid_Format,     etl::to_arithmetic<int>(etl::string_view("-")).error());
+      CHECK_EQUAL(Status::Invalid_Format,     etl::to_arithmetic<int>(etl::string_view(" 1")).error());
+      CHECK_EQUAL(Status::Invalid_Format,     etl::to_arithmetic<int>(etl::string_view("1 ")).error());
+      CHECK_EQUAL(Status::Invalid_Format,     etl::to_arithmetic<int>(etl::string_view("1.0")).error());
+      CHECK_EQUAL(Status::Signed_To_Unsigned, etl::to_arithmetic<unsigned>(etl::string_view("-1")).error());
+      CHECK_EQUAL(Status::Overflow,           etl::to_arithmetic<int8_t>(etl::string_view("128")).error());
+      CHECK_EQUAL(Status::Overflow,           etl::to_arithmetic<int8_t>(etl::string_view("-129")).error());
+      CHECK_EQUAL(Status::Overflow,           etl::to_arithmetic<uint8_t>(etl::string_view("256")).error());
+      CHECK_EQUAL(Status::Overflow,           etl::to_arithmetic<uint64_t>(etl::string_view("18446744073709551616")).error());
+
+      // A format error is reported in preference to an overflow.
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<uint8_t>(etl::string_view("1000x")).error());
+
+      etl::to_arithmetic_result<int> result = etl::to_arithmetic<int>(etl::string_view("x"));
+      CHECK(!result);
+      CHECK(!result.has_value());
+      CHECK_EQUAL(42, result.value_or(42));
+      CHECK_THROW(result.value(), etl::to_arithmetic_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      etl::string<10>  text("-1234");
+      etl::wstring<10> wtext(L"ff");
+
+      CHECK_EQUAL(-1234, etl::to_arithmetic<int>(text).value());
+      CHECK_EQUAL(255,   etl::to_arithmetic<int>(wtext, etl::radix::hex).value());
+      CHECK_EQUAL(12,    etl::to_arithmetic<int>(text.data() + 1, 2).value());
+      CHECK_CLOSE(1.5,   etl::to_arithmetic<double>(etl::wstring_view(L"1.5")).value(), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      CHECK_EQUAL(0.0,        etl::to_arithmetic<double>(etl::string_view("0")).value());
+      CHECK_EQUAL(1.0,        etl::to_arithmetic<double>(etl::string_view("1")).value());
+      CHECK_EQUAL(-1.5,       etl::to_arithmetic<double>(etl::string_view("-1.5")).value());
+      CHECK_EQUAL(0.5,        etl::to_arithmetic<double>(etl::string_view(".5")).value());
+      CHECK_EQUAL(5.0,        etl::to_arithmetic<double>(etl::string_view("5.")).value());
+      CHECK_EQUAL(0.1,        etl::to_arithmetic<double>(etl::string_view("0.1")).value());
+      CHECK_EQUAL(1.25e-10,   etl::to_arithmetic<double>(etl::string_view("1.25e-10")).value());
+      CHECK_EQUAL(1.25e10,    etl::to_arithmetic<double>(etl::string_view("125E+8")).value());
+      CHECK_EQUAL(0.1f,       etl::to_arithmetic<float>(etl::string_view("0.1")).value());
+      CHECK_EQUAL(3.4028235e38f, etl::to_arithmetic<float>(etl::string_view("3.4028235e38")).value());
+      CHECK_EQUAL(1.7976931348623157e308, etl::to_arithmetic<double>(etl::string_view("1.7976931348623157e308")).value());
+      CHECK_EQUAL(4.9406564584124654e-324, etl::to_arithmetic<double>(etl::string_view("4.9406564584124654e-324")).value());
+      CHECK_EQUAL((long double)0.1, etl::to_arithmetic<long double>(etl::string_view("0.1")).value());
+
+      // Underflow gives zero.
+      CHECK_EQUAL(0.0, etl::to_arithmetic<double>(etl::string_view("1e-400")).value());
+
+      // More than 19 significant digits.
+      CHECK_EQUAL(0.1, etl::to_arithmetic<double>(etl::string_view("0.1000000000000000000000001")).value());
+      CHECK_EQUAL(1e30, etl::to_arithmetic<double>(etl::string_view("1000000000000000000000000000000")).value());
+
+      CHECK(std::isinf(etl::to_arithmetic<double>(etl::string_view("inf")).value()));
+      CHECK(etl::to_arithmetic<double>(etl::string_view("-Infinity")).value() < 0.0);
+      CHECK(std::isnan(etl::to_arithmetic<float>(etl::string_view("nan")).value()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_errors)
+    {
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view(".")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("e5")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("1e")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("1e+")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("1.2.3")).error());
+      CHECK_EQUAL(Status::Invalid_Format, etl::to_arithmetic<double>(etl::string_view("infinit")).error());
+      CHECK_EQUAL(Status::Overflow,       etl::to_arithmetic<double>(etl::string_view("1e309")).error());
+      CHECK_EQUAL(Status::Overflow,       etl::to_arithmetic<float>(etl::string_view("-3.5e38")).error());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_matches_strtod)
+    {
+      char text[40];
+      uint64_t seed = 0x0123456789ABCDEFULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+
+        if (std::isnan(d) || std::isinf(d))
+        {
+          continue;
+        }
+
+        // Random digits and exponent as well as exact round trips.
+        snprintf(text, sizeof(text), "%.17g", d);
+        CHECK_EQUAL(strtod(text, ETL_NULLPTR), etl::to_arithmetic<double>(etl::string_view(text)).value());
+
+        snprintf(text, sizeof(text), "%.*e", int(seed % 19U), d);
+        CHECK_EQUAL(strtod(text, ETL_NULLPTR), etl::to_arithmetic<double>(etl::string_view(text)).value());
+
+        const float f = strtof(text, ETL_NULLPTR);
+
+        if (std::isinf(f))
+        {
+          CHECK_EQUAL(Status::Overflow, etl::to_arithmetic<float>(etl::string_view(text)).error());
+        }
+        else
+        {
+          CHECK_EQUAL(f, etl::to_arithmetic<float>(etl::string_view(text)).value());
+        }
+      }
+    }
+  }
+}
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <stdlib.h>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
@@ -253,6 +254,41 @@ namespace
       CHECK(etl::string<17>(STR("1e240")) ==              etl::to_string(123456, str, Format().hex()));
     }
 
+    //*************************************************************************
+    TEST(test_integral_limits_and_prefixes)
+    {
+      etl::string<72> str;
+
+      CHECK(etl::string<72>(STR("-9223372036854775808")) == etl::to_string(int64_t(-9223372036854775807ll - 1), str));
+      CHECK(etl::string<72>(STR("18446744073709551615")) == etl::to_string(uint64_t(18446744073709551615ull), str));
+      CHECK(etl::string<72>(STR("-2147483648")) ==          etl::to_string(int32_t(-2147483647ll - 1), str));
+      CHECK(etl::string<72>(STR("-99")) ==                  etl::to_string(int32_t(-99), str));
+      CHECK(etl::string<72>(STR("100")) ==                  etl::to_string(int32_t(100), str));
+      CHECK(etl::string<72>(STR("10000")) ==                etl::to_string(int32_t(10000), str));
+
+      CHECK(etl::string<72>(STR("0XFFFFFFFFFFFFFFFF")) == etl::to_string(uint64_t(18446744073709551615ull), str, Format().hex().upper_case(true).show_base(true)));
+      CHECK(etl::string<72>(STR("0b1111111111111111111111111111111111111111111111111111111111111111")) == etl::to_string(uint64_t(18446744073709551615ull), str, Format().binary().show_base(true)));
+      CHECK(etl::string<72>(STR("01777777777777777777777")) == etl::to_string(uint64_t(18446744073709551615ull), str, Format().octal().show_base(true)));
+      CHECK(etl::string<72>(STR("0")) ==                  etl::to_string(uint32_t(0), str, Format().hex().show_base(true)));
+
+      // Not a power of two.
+      CHECK(etl::string<72>(STR("3w5e11264sgsf")) == etl::to_string(uint64_t(18446744073709551615ull), str, Format().base(36)));
+      CHECK(etl::string<72>(STR("1A")) ==            etl::to_string(uint32_t(22), str, Format().base(12).upper_case(true)));
+    }
+
+    //*************************************************************************
+    TEST(test_integral_truncated)
+    {
+      etl::string<6> str(STR("ab"));
+
+      // The most significant digits are kept.
+      etl::to_string(int32_t(-123456), str, Format(), true);
+      CHECK(etl::string<6>(STR("ab-123")) == str);
+#if ETL_STRING_TRUNCATION_CHECKS_ENABLED
+      CHECK(str.is_truncated());
+#endif
+    }
+
     //*************************************************************************
     TEST(test_floating_point_no_append)
     {
@@ -318,6 +354,73 @@ namespace
       CHECK(etl::string<20>(STR("20.0")) ==    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<30> str;
+
+      CHECK(etl::string<30>(STR("0")) == etl::to_string(0.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1")) == etl::to_string(1.0, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("-1.5")) == etl::to_string(-1.5, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.1")) == etl::to_string(0.1, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("0.30000000000000004")) == etl::to_string(0.1 + 0.2, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("123.456")) == etl::to_string(123.456, str, Format().shortest(true).precision(2)));
+      CHECK(etl::string<30>(STR("0.000001")) == etl::to_string(0.000001, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1e-7")) == etl::to_string(0.0000001, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("100000000000000000000")) == etl::to_string(1e20, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1e+21")) == etl::to_string(1e21, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("1.2345E+300")) == etl::to_string(1.2345e300, str, Format().shortest(true).upper_case(true)));
+      CHECK(etl::string<30>(STR("1.7976931348623157e+308")) == etl::to_string(1.7976931348623157e308, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("5e-324")) == etl::to_string(5e-324, str, Format().shortest(true)));
+
+      // Floats use the float precision.
+      CHECK(etl::string<30>(STR("0.1")) == etl::to_string(0.1f, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("3.4028235e+38")) == etl::to_string(3.4028235e38f, str, Format().shortest(true)));
+      CHECK(etl::string<30>(STR("16777216")) == etl::to_string(16777216.0f, str, Format().shortest(true)));
+
+      // Alignment still applies.
+      CHECK(etl::string<30>(STR("   -0.25")) == etl::to_string(-0.25, str, Format().shortest(true).width(8).right()));
+      CHECK(etl::string<30>(STR("-0.25   ")) == etl::to_string(-0.25, str, Format().shortest(true).width(8).left()));
+
+      str.assign(STR("Result "));
+      CHECK(etl::string<30>(STR("Result 2.5")) == etl::to_string(2.5, str, Format().shortest(true), true));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<30> str;
+      uint64_t seed = 0x0123456789ABCDEFULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        double d;
+        memcpy(&d, &seed, sizeof(d));
+
+        if (isnan(d) || isinf(d))
+        {
+          continue;
+        }
+
+        etl::to_string(d, str, Format().shortest(true));
+        CHECK_EQUAL(d, strtod(str.c_str(), ETL_NULLPTR));
+
+        float f;
+        uint32_t bits = uint32_t(seed >> 32);
+        memcpy(&f, &bits, sizeof(f));
+
+        if (isnan(f) || isinf(f))
+        {
+          continue;
+        }
+
+        etl::to_string(f, str, Format().shortest(true));
+        CHECK_EQUAL(f, strtof(str.c_str(), ETL_NULLPTR));
+      }
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
@@ -0,0 +1,475 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <stdint.h>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "etl/trace.h"
+#include "etl/message_router.h"
+#include "etl/fsm.h"
+#include "etl/scheduler.h"
+#include "etl/callback_timer.h"
+#include "etl/pool.h"
+
+namespace
+{
+  typedef etl::trace_buffer<8> Buffer;
+
+  //***************************************************************************
+  // Reads all of the records in a buffer.
+  //***************************************************************************
+  template <size_t VSize>
+  std::vector<etl::trace_record> read_all(const etl::trace_buffer<VSize>& buffer)
+  {
+    std::vector<etl::trace_record> records(VSize);
+
+    records.resize(buffer.read(records.data(), records.size()));
+
+    return records;
+  }
+
+  //***************************************************************************
+  // Reads the records in the global buffer that have a particular event id.
+  //***************************************************************************
+  std::vector<etl::trace_record> read_global(uint16_t event)
+  {
+    std::vector<etl::trace_record> records = read_all(etl::get_trace_buffer());
+    std::vector<etl::trace_record> result;
+
+    for (size_t i = 0U; i < records.size(); ++i)
+    {
+      if (records[i].event == event)
+      {
+        result.push_back(records[i]);
+      }
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  // Message router.
+  //***************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+  };
+
+  struct Message2 : public etl::message<2>
+  {
+  };
+
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(7)
+    {
+    }
+
+    void on_receive(const Message1&) {}
+    void on_receive(const Message2&) {}
+    void on_receive_unknown(const etl::imessage&) {}
+  };
+
+  //***************************************************************************
+  // FSM.
+  //***************************************************************************
+  class Machine : public etl::fsm
+  {
+  public:
+
+    Machine()
+      : fsm(3)
+    {
+    }
+  };
+
+  class Idle : public etl::fsm_state<Machine, Idle, 0, Message1>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Message1&)
+    {
+      return 1;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  class Running : public etl::fsm_state<Machine, Running, 1, Message2>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Message2&)
+    {
+      return 0;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  // Scheduler.
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority, etl::ischeduler& scheduler_)
+      : task(priority)
+      , scheduler(scheduler_)
+      , work(1U)
+    {
+    }
+
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return work;
+    }
+
+    void task_process_work() ETL_OVERRIDE
+    {
+      work = 0U;
+      scheduler.exit_scheduler();
+    }
+
+  private:
+
+    etl::ischeduler& scheduler;
+    uint32_t         work;
+  };
+
+  void timer_callback()
+  {
+  }
+
+  SUITE(test_trace)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Buffer buffer;
+
+      CHECK(buffer.empty());
+      CHECK_EQUAL(0U, buffer.size());
+      CHECK_EQUAL(8U, buffer.capacity());
+      CHECK_EQUAL(8U, Buffer::SIZE);
+      CHECK_EQUAL(0U, buffer.total());
+      CHECK(read_all(buffer).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_read)
+    {
+      Buffer buffer;
+
+      buffer.write(100U, 1U, 10U, 20U);
+      buffer.write(200U, 2U, 30U, 40U);
+
+      CHECK(!buffer.empty());
+      CHECK_EQUAL(2U, buffer.size());
+      CHECK_EQUAL(2U, buffer.total());
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(2U, records.size());
+
+      CHECK_EQUAL(100U, records[0].timestamp);
+      CHECK_EQUAL(1U,   records[0].event);
+      CHECK_EQUAL(0U,   records[0].sequence);
+      CHECK_EQUAL(10U,  records[0].arg1);
+      CHECK_EQUAL(20U,  records[0].arg2);
+
+      CHECK_EQUAL(200U, records[1].timestamp);
+      CHECK_EQUAL(2U,   records[1].event);
+      CHECK_EQUAL(1U,   records[1].sequence);
+      CHECK_EQUAL(30U,  records[1].arg1);
+      CHECK_EQUAL(40U,  records[1].arg2);
+    }
+
+    //*************************************************************************
+    TEST(test_overwrite_oldest)
+    {
+      Buffer buffer;
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        buffer.write(i, uint16_t(i), i * 2U, i * 3U);
+      }
+
+      CHECK_EQUAL(8U, buffer.size());
+      CHECK_EQUAL(20U, buffer.total());
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(8U, records.size());
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(i + 12U, records[i].timestamp);
+        CHECK_EQUAL(i + 12U, records[i].sequence);
+        CHECK_EQUAL((i + 12U) * 3U, records[i].arg2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_read_most_recent)
+    {
+      Buffer buffer;
+
+      for (uint32_t i = 0U; i < 6U; ++i)
+      {
+        buffer.write(i, 0U, 0U, 0U);
+      }
+
+      etl::trace_record records[3];
+
+      CHECK_EQUAL(3U, buffer.read(records, 3U));
+      CHECK_EQUAL(3U, records[0].timestamp);
+      CHECK_EQUAL(4U, records[1].timestamp);
+      CHECK_EQUAL(5U, records[2].timestamp);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Buffer buffer;
+
+      buffer.write(1U, 1U, 1U, 1U);
+      buffer.write(2U, 2U, 2U, 2U);
+      buffer.clear();
+
+      CHECK(buffer.empty());
+      CHECK(read_all(buffer).empty());
+
+      buffer.write(3U, 3U, 3U, 3U);
+
+      std::vector<etl::trace_record> records = read_all(buffer);
+
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(3U, records[0].timestamp);
+      CHECK_EQUAL(2U, records[0].sequence);
+      CHECK_EQUAL(3U, buffer.total());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_writers)
+    {
+      typedef etl::trace_buffer<1024> LargeBuffer;
+
+      static LargeBuffer buffer;
+      std::atomic<bool>  stop(false);
+      size_t             bad = 0U;
+
+      // Each writer tags its records with its id, and repeats the sequence in
+      // the arguments, so that a torn record can be spotted.
+      auto writer = [&](uint16_t id)
+      {
+        for (uint32_t i = 0U; i < 20000U; ++i)
+        {
+          buffer.write(i, id, i, ~i);
+
+          if ((i % 64U) == 0U)
+          {
+            std::this_thread::yield();
+          }
+        }
+      };
+
+      std::thread reader([&]
+      {
+        std::vector<etl::trace_record> records(buffer.capacity());
+
+        while (!stop.load())
+        {
+          const size_t n = buffer.read(records.data(), records.size());
+
+          for (size_t i = 0U; i < n; ++i)
+          {
+            if ((records[i].arg1 != records[i].timestamp) || (records[i].arg2 != ~records[i].timestamp))
+            {
+              ++bad;
+            }
+          }
+
+          std::this_thread::yield();
+        }
+      });
+
+      std::thread writer1(writer, uint16_t(1U));
+      std::thread writer2(writer, uint16_t(2U));
+
+      writer1.join();
+      writer2.join();
+      stop.store(true);
+      reader.join();
+
+      CHECK_EQUAL(0U, bad);
+      CHECK_EQUAL(40000U, buffer.total());
+      CHECK_EQUAL(buffer.capacity(), read_all(buffer).size());
+    }
+
+    //*************************************************************************
+    TEST(test_global_trace)
+    {
+      etl::get_trace_buffer().clear();
+
+      ETL_TRACE_EVENT(123, 4, 5)
+      etl::trace(124U, 6U, 7U);
+
+      std::vector<etl::trace_record> records = read_all(etl::get_trace_buffer());
+
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(123U, records[0].event);
+      CHECK_EQUAL(4U,   records[0].arg1);
+      CHECK_EQUAL(5U,   records[0].arg2);
+      CHECK_EQUAL(124U, records[1].event);
+      CHECK_EQUAL(6U,   records[1].arg1);
+      CHECK_EQUAL(7U,   records[1].arg2);
+    }
+
+    //*************************************************************************
+    TEST(test_message_router_hook)
+    {
+      Router router;
+
+      etl::get_trace_buffer().clear();
+
+      router.receive(Message2());
+      router.receive(Message1());
+
+      std::vector<etl::trace_record> records = read_global(etl::trace_event::Message_Router_Receive);
+
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(7U, records[0].arg1);
+      CHECK_EQUAL(2U, records[0].arg2);
+      CHECK_EQUAL(7U, records[1].arg1);
+      CHECK_EQUAL(1U, records[1].arg2);
+    }
+
+    //*************************************************************************
+    TEST(test_fsm_hook)
+    {
+      Machine machine;
+      Idle    idle;
+      Running running;
+
+      etl::ifsm_state* states[] = { &idle, &running };
+
+      machine.set_states(states, 2U);
+
+      etl::get_trace_buffer().clear();
+
+      machine.start(false);
+      machine.receive(Message1());
+      machine.receive(Message2());
+
+      std::vector<etl::trace_record> records = read_global(etl::trace_event::Fsm_State_Change);
+
+      CHECK_EQUAL(3U, records.size());
+      CHECK_EQUAL(etl::ifsm_state::No_State_Change, records[0].arg1);
+      CHECK_EQUAL(0U, records[0].arg2);
+      CHECK_EQUAL(0U, records[1].arg1);
+      CHECK_EQUAL(1U, records[1].arg2);
+      CHECK_EQUAL(1U, records[2].arg1);
+      CHECK_EQUAL(0U, records[2].arg2);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler_hook)
+    {
+      etl::scheduler<etl::scheduler_policy_sequential_single, 1> scheduler;
+      Task task(5U, scheduler);
+
+      scheduler.add_task(task);
+
+      etl::get_trace_buffer().clear();
+
+      scheduler.start();
+
+      std::vector<etl::trace_record> begin = read_global(etl::trace_event::Scheduler_Task_Begin);
+      std::vector<etl::trace_record> end   = read_global(etl::trace_event::Scheduler_Task_End);
+
+      CHECK_EQUAL(1U, begin.size());
+      CHECK_EQUAL(1U, end.size());
+      CHECK_EQUAL(5U, begin[0].arg1);
+      CHECK_EQUAL(5U, end[0].arg1);
+      CHECK(begin[0].sequence < end[0].sequence);
+    }
+
+    //*************************************************************************
+    TEST(test_callback_timer_hook)
+    {
+      etl::callback_timer<2> timers;
+
+      etl::timer::id::type id = timers.register_timer(timer_callback, 10U, etl::timer::mode::REPEATING);
+
+      timers.start(id);
+      timers.enable(true);
+
+      etl::get_trace_buffer().clear();
+
+      timers.tick(25U);
+
+      std::vector<etl::trace_record> records = read_global(etl::trace_event::Callback_Timer_Expired);
+
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(id, records[0].arg1);
+      CHECK_EQUAL(10U, records[0].arg2);
+    }
+
+    //*************************************************************************
+    TEST(test_pool_hook)
+    {
+      etl::pool<uint32_t, 1> pool;
+
+      pool.allocate();
+
+      etl::get_trace_buffer().clear();
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+      std::vector<etl::trace_record> records = read_global(etl::trace_event::Pool_Allocation_Failed);
+
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(1U, records[0].arg2);
+    }
+  };
+}
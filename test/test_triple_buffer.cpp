@@ -0,0 +1,275 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <atomic>
+
+#include "etl/triple_buffer.h"
+#include "etl/buffer_descriptors.h"
+#include "etl/array.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::array<uint32_t, 64> Frame;
+
+  //***********************************
+  void fill_frame(Frame& frame, uint32_t sequence)
+  {
+    frame.fill(sequence);
+  }
+
+  //***********************************
+  bool is_consistent(const Frame& frame)
+  {
+    for (size_t i = 1U; i < frame.size(); ++i)
+    {
+      if (frame[i] != frame[0])
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_triple_buffer)
+  {
+    //*************************************************************************
+    TEST(test_construct)
+    {
+      etl::triple_buffer<int> tb(5);
+
+      CHECK(!tb.has_new_data());
+      CHECK(!tb.update());
+      CHECK_EQUAL(5, tb.read_buffer());
+      CHECK_EQUAL(5, tb.write_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_publish_and_update)
+    {
+      etl::triple_buffer<int> tb(0);
+
+      tb.write_buffer() = 1;
+      CHECK(!tb.publish());
+      CHECK(tb.has_new_data());
+
+      // Not taken yet.
+      CHECK_EQUAL(0, tb.read_buffer());
+
+      CHECK(tb.update());
+      CHECK_EQUAL(1, tb.read_buffer());
+      CHECK(!tb.has_new_data());
+      CHECK(!tb.update());
+      CHECK_EQUAL(1, tb.read_buffer());
+
+      // The write buffer is never the read buffer.
+      tb.write_buffer() = 2;
+      CHECK_EQUAL(1, tb.read_buffer());
+      tb.publish();
+      CHECK(tb.update());
+      CHECK_EQUAL(2, tb.read_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_latest_value_wins)
+    {
+      etl::triple_buffer<int> tb(0);
+
+      tb.write_buffer() = 1;
+      CHECK(!tb.publish());
+
+      tb.write_buffer() = 2;
+      CHECK(tb.publish());
+
+      // The unread buffer is given back to the producer.
+      CHECK_EQUAL(1, tb.write_buffer());
+
+      tb.write_buffer() = 3;
+      CHECK(tb.publish());
+
+      CHECK(tb.update());
+      CHECK_EQUAL(3, tb.read_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_frames_in_place)
+    {
+      etl::triple_buffer<Frame> tb;
+
+      fill_frame(tb.write_buffer(), 42U);
+      const uint32_t* p = tb.write_buffer().data();
+      tb.publish();
+
+      CHECK(tb.update());
+      CHECK(tb.read_buffer().data() == p);
+      CHECK_EQUAL(42U, tb.read_buffer()[63]);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      etl::triple_buffer<Frame> tb;
+      fill_frame(tb.read_buffer(), 0U);
+
+      const uint32_t Frames = 100000U;
+
+      std::atomic<bool> done(false);
+      int      errors = 0;
+      uint32_t last   = 0U;
+
+      std::thread consumer([&]()
+      {
+        while (!done.load() || tb.has_new_data())
+        {
+          if (tb.update())
+          {
+            const Frame& frame = tb.read_buffer();
+
+            if (!is_consistent(frame) || (frame[0] <= last))
+            {
+              ++errors;
+            }
+
+            last = frame[0];
+          }
+        }
+      });
+
+      for (uint32_t i = 1U; i <= Frames; ++i)
+      {
+        fill_frame(tb.write_buffer(), i);
+        tb.publish();
+      }
+
+      done.store(true);
+      consumer.join();
+
+      CHECK_EQUAL(0, errors);
+      CHECK_EQUAL(Frames, last);
+    }
+
+    //*************************************************************************
+    TEST(test_with_buffer_descriptors)
+    {
+      typedef etl::buffer_descriptors<char, 16U, 4U> BD;
+
+      char buffers[BD::N_BUFFERS * BD::BUFFER_SIZE];
+      BD bd(buffers);
+
+      etl::triple_buffer<BD::descriptor> tb;
+
+      // Producer, such as a DMA complete interrupt.
+      for (char c = 'a'; c < 'd'; ++c)
+      {
+        BD::descriptor desc = bd.allocate(c);
+        CHECK(desc.is_valid());
+
+        tb.write_buffer() = desc;
+
+        if (tb.publish())
+        {
+          // An unread frame was displaced.
+          tb.write_buffer().release();
+        }
+      }
+
+      // Consumer.
+      CHECK(tb.update());
+      BD::descriptor desc = tb.read_buffer();
+      CHECK(desc.is_valid());
+      CHECK_EQUAL('c', desc.data()[0]);
+      CHECK_EQUAL('c', desc.data()[15]);
+      desc.release();
+
+      // 'a' and 'b' were displaced and released, 'c' was consumed.
+      BD::descriptor descs[BD::N_BUFFERS];
+      CHECK_EQUAL(BD::N_BUFFERS, bd.allocate(descs, BD::N_BUFFERS));
+    }
+  }
+
+  SUITE(test_double_buffer)
+  {
+    //*************************************************************************
+    TEST(test_construct)
+    {
+      etl::double_buffer<int> db(5);
+
+      CHECK(!db.has_new_data());
+      CHECK(!db.update());
+      CHECK_EQUAL(5, db.read_buffer());
+      CHECK_EQUAL(5, db.write_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_swap_and_update)
+    {
+      etl::double_buffer<int> db(0);
+
+      int* p0 = &db.read_buffer();
+      int* p1 = &db.write_buffer();
+      CHECK(p0 != p1);
+
+      db.write_buffer() = 1;
+      CHECK(!db.swap());
+      CHECK(&db.write_buffer() == p0);
+      CHECK(db.has_new_data());
+
+      CHECK(db.update());
+      CHECK(&db.read_buffer() == p1);
+      CHECK_EQUAL(1, db.read_buffer());
+      CHECK(!db.update());
+
+      db.write_buffer() = 2;
+      CHECK(!db.swap());
+      CHECK(db.update());
+      CHECK_EQUAL(2, db.read_buffer());
+    }
+
+    //*************************************************************************
+    TEST(test_overrun)
+    {
+      etl::double_buffer<int> db(0);
+
+      db.write_buffer() = 1;
+      CHECK(!db.swap());
+      db.write_buffer() = 2;
+      CHECK(db.swap());
+
+      CHECK(db.update());
+      CHECK_EQUAL(2, db.read_buffer());
+    }
+  }
+}
+
+#endif
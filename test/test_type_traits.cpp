@@ -29,7 +29,10 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include "etl/type_traits.h"
+#include "etl/array.h"
+#include "etl/utility.h"
 #include <type_traits>
+#include <string>
 
 namespace
 {
@@ -871,4 +874,15 @@ namespace
     CHECK((etl::are_all_same<int, int, int, int, int>::value == true));
     CHECK((etl::are_all_same<int, int, int, char, int>::value == false));
   }
+
+  //*************************************************************************
+  TEST(test_is_trivially_relocatable)
+  {
+    CHECK(etl::is_trivially_relocatable<int>::value);
+    CHECK(etl::is_trivially_relocatable<int*>::value);
+    CHECK((etl::is_trivially_relocatable<etl::array<int, 4> >::value));
+    CHECK((etl::is_trivially_relocatable<etl::pair<int, char> >::value));
+    CHECK(!etl::is_trivially_relocatable<std::string>::value);
+    CHECK(!(etl::is_trivially_relocatable<etl::pair<int, std::string> >::value));
+  }
 }
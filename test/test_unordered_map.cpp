@@ -43,6 +43,7 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_map.h"
+#include "etl/histogram.h"
 #include "etl/hash.h"
 
 namespace
@@ -56,6 +57,50 @@ namespace
     }
   };
 
+  //*************************************************************************
+  // Counts the calls to the hasher and the key comparisons.
+  struct counting_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      ++calls;
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+
+    static int calls;
+  };
+
+  int counting_hash::calls = 0;
+
+  struct counting_equal
+  {
+    bool operator ()(const std::string& lhs, const std::string& rhs) const
+    {
+      ++calls;
+      return lhs == rhs;
+    }
+
+    static int calls;
+  };
+
+  int counting_equal::calls = 0;
+
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef void is_transparent;
+
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+
+    size_t operator ()(const char* text) const
+    {
+      return std::accumulate(text, text + std::char_traits<char>::length(text), 0);
+    }
+  };
+
   //*************************************************************************
   template <typename T1, typename T2>
   bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
@@ -876,5 +921,326 @@ namespace
       CHECK_EQUAL('c', map[2]);
       CHECK_EQUAL('d', map[3]);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::unordered_map<std::string, int, SIZE, SIZE, simple_hash> data;
+      data["1"] = 1;
+      data["3"] = 3;
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_map<std::string, int, SIZE, SIZE, transparent_hash, etl::equal_to<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data["1"] = 1;
+      data["3"] = 3;
+      data["5"] = 5;
+
+      CHECK(data.find("3") != data.end());
+      CHECK(3 == data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_cached_hash)
+    {
+      typedef etl::unordered_map<std::string, int, SIZE, SIZE / 2, etl::cached_hash<simple_hash>> Cached;
+
+      CHECK(etl::is_cached_hash<Cached::hasher>::value);
+      CHECK(!etl::is_cached_hash<simple_hash>::value);
+
+      Cached data;
+
+      data["ab"] = 1;
+      data["ba"] = 2; // Same hash as "ab".
+      data.insert(ETL_OR_STD::make_pair(std::string("c"), 3));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.at("ab"));
+      CHECK_EQUAL(2, data.at("ba"));
+      CHECK_EQUAL(3, data.find("c")->second);
+      CHECK(data.find("d") == data.end());
+
+      CHECK_EQUAL(0U, data.erase("d"));
+      CHECK_EQUAL(1U, data.erase("ab"));
+      CHECK(!data.contains("ab"));
+      CHECK(data.contains("ba"));
+    }
+
+    //*************************************************************************
+    TEST(test_cached_hash_compares_keys_with_equal_hashes_only)
+    {
+      // One bucket, so every key collides.
+      typedef etl::unordered_map<std::string, int, SIZE, 1, etl::cached_hash<counting_hash>, counting_equal> Cached;
+      typedef etl::unordered_map<std::string, int, SIZE, 1, counting_hash, counting_equal>                   Uncached;
+
+      Cached   cached;
+      Uncached uncached;
+
+      const char* keys[] = { "a", "b", "c", "d", "e", "f" };
+
+      for (size_t i = 0; i < 6U; ++i)
+      {
+        cached[keys[i]]   = int(i);
+        uncached[keys[i]] = int(i);
+      }
+
+      counting_equal::calls = 0;
+      CHECK_EQUAL(0, cached.find("a")->second);
+      CHECK_EQUAL(1, counting_equal::calls);
+
+      counting_equal::calls = 0;
+      CHECK_EQUAL(0, uncached.find("a")->second);
+      CHECK_EQUAL(6, counting_equal::calls);
+
+      counting_equal::calls = 0;
+      CHECK(cached.find("g") == cached.end());
+      CHECK_EQUAL(0, counting_equal::calls);
+    }
+
+    //*************************************************************************
+    TEST(test_cached_hash_copy_reuses_hashes)
+    {
+      typedef etl::unordered_map<std::string, int, SIZE, SIZE / 2, etl::cached_hash<counting_hash>> Cached;
+
+      Cached data;
+      data["1"] = 1;
+      data["2"] = 2;
+      data["3"] = 3;
+
+      counting_hash::calls = 0;
+
+      Cached copy(data);
+      Cached assigned;
+      assigned = data;
+
+      CHECK_EQUAL(0, counting_hash::calls);
+      CHECK(copy == data);
+      CHECK(assigned == data);
+
+      counting_hash::calls = 0;
+
+      Cached moved(etl::move(copy));
+
+      CHECK_EQUAL(0, counting_hash::calls);
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(2, moved["2"]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_batch_find_batch)
+    {
+      // More than one batch of keys.
+      typedef etl::unordered_map<int, int, 64, 16> Batched;
+
+      std::vector<ETL_OR_STD::pair<int, int>> values;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        values.push_back(ETL_OR_STD::make_pair(i * 3, i));
+      }
+
+      values.push_back(ETL_OR_STD::make_pair(0, 100)); // Duplicate key.
+
+      Batched data;
+      data.insert_batch(values.begin(), values.end());
+
+      CHECK_EQUAL(40U, data.size());
+      CHECK_EQUAL(0, data[0]);
+
+      std::vector<int> keys;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        keys.push_back(i * 3 + (i % 2)); // Every other key is missing.
+      }
+
+      std::vector<Batched::iterator> results(keys.size());
+      CHECK(data.find_batch(keys.begin(), keys.end(), results.begin()) == results.end());
+
+      const Batched& cdata = data;
+      std::vector<Batched::const_iterator> cresults(keys.size());
+      CHECK(cdata.find_batch(keys.begin(), keys.end(), cresults.begin()) == cresults.end());
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        CHECK(results[i] == data.find(keys[i]));
+        CHECK(cresults[i] == cdata.find(keys[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_map<int, int, 10, 4, identity_hash> Data;
+
+      Data data;
+
+      etl::unordered_statistics statistics = data.statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.bucket_count);
+      CHECK_EQUAL(0U, statistics.used_buckets);
+      CHECK_EQUAL(0U, statistics.max_chain_length);
+      CHECK_CLOSE(0.0, statistics.bytes_per_element, 0.01);
+
+      // Buckets of 3, 2, 1 and 0 elements.
+      const int keys[] = { 0, 4, 8, 1, 5, 2 };
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        data.insert(ETL_OR_STD::make_pair(keys[i], int(i)));
+      }
+
+      statistics = data.statistics();
+      CHECK_EQUAL(6U, statistics.size);
+      CHECK_EQUAL(3U, statistics.used_buckets);
+      CHECK_EQUAL(3U, statistics.max_chain_length);
+      CHECK_CLOSE(2.0, statistics.mean_chain_length, 0.01);
+      CHECK_CLOSE(data.load_factor(), statistics.load_factor, 0.01);
+      CHECK_EQUAL(4U * statistics.node_size, statistics.bytes_reserved - statistics.bytes_used);
+      CHECK_CLOSE(statistics.bytes_used / 6.0, statistics.bytes_per_element, 0.01);
+
+      // The bucket of 3 is counted in the last bin.
+      etl::histogram<size_t, int, 3, 0> histogram;
+      data.bucket_histogram(histogram);
+
+      CHECK_EQUAL(1, histogram[0]);
+      CHECK_EQUAL(1, histogram[1]);
+      CHECK_EQUAL(2, histogram[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::unordered_map<int, std::string, 4> Map;
+      Map data;
+
+      std::pair<Map::iterator, bool> result = data.emplace(1, "one");
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL(std::string("one"), result.first->second);
+
+      // The key is already present.
+      result = data.emplace(1, "uno");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("one"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      // Into the same bucket as 1.
+      result = data.emplace(5, "five");
+      CHECK(result.second);
+
+      Map::iterator itr = data.emplace_hint(data.end(), 2, "two");
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("five"), data.at(5));
+      CHECK_EQUAL(std::string("two"), data.at(2));
+      CHECK_EQUAL(std::string("one"), data.at(1));
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::unordered_map<int, std::string, 4> Map;
+      Map data;
+
+      data.insert(std::make_pair(1, std::string("one")));
+      data.insert(std::make_pair(2, std::string("two")));
+
+      const std::pair<const int, std::string>* p_value = &*data.find(1);
+
+      Map::node_type node = data.extract(1);
+      CHECK(!node.empty());
+      CHECK_EQUAL(1, node.key());
+      CHECK_EQUAL(std::string("one"), node.mapped());
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.find(1) == data.end());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      // Back into the same unordered_map, so the node is relinked.
+      Map::insert_return_type result = data.insert(std::move(node));
+      CHECK(result.inserted);
+      CHECK(result.node.empty());
+      CHECK(node.empty());
+      CHECK(p_value == &*result.position);
+      CHECK_EQUAL(2U, data.size());
+
+      // A duplicate key hands the node back.
+      Map other;
+      other.insert(std::make_pair(2, std::string("deux")));
+      result = data.insert(other.extract(other.begin()));
+      CHECK(!result.inserted);
+      CHECK(!result.node.empty());
+      CHECK_EQUAL(std::string("deux"), result.node.mapped());
+      CHECK_EQUAL(std::string("two"), result.position->second);
+      CHECK(other.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::unordered_map<int, std::string, 4> data0;
+      etl::unordered_map<int, std::string, 6> data1;
+
+      data0.insert(std::make_pair(1, std::string("one")));
+      data0.insert(std::make_pair(2, std::string("two")));
+      data1.insert(std::make_pair(2, std::string("deux")));
+      data1.insert(std::make_pair(3, std::string("trois")));
+
+      data1.merge(data0);
+
+      CHECK_EQUAL(1U, data0.size());
+      CHECK_EQUAL(std::string("two"), data0.at(2));
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(std::string("one"), data1.at(1));
+      CHECK_EQUAL(std::string("deux"), data1.at(2));
+      CHECK_EQUAL(std::string("trois"), data1.at(3));
+
+      // A node held by a handle is not counted, but still uses the pool.
+      {
+        etl::unordered_map<int, std::string, 6>::node_type node = data1.extract(data1.begin());
+        CHECK_EQUAL(2U, data1.size());
+        CHECK_EQUAL(3U, data1.available());
+        data1.clear();
+        CHECK(data1.empty());
+      }
+
+      CHECK_EQUAL(6U, data1.available());
+    }
   };
 }
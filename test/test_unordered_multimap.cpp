@@ -41,6 +41,7 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_multimap.h"
+#include "etl/histogram.h"
 
 namespace etl
 {
@@ -66,6 +67,22 @@ namespace
     }
   };
 
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef void is_transparent;
+
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+
+    size_t operator ()(const char* text) const
+    {
+      return std::accumulate(text, text + std::char_traits<char>::length(text), 0);
+    }
+  };
+
   //*************************************************************************
   template <typename T1, typename T2>
   bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
@@ -804,5 +821,288 @@ namespace
       CHECK_EQUAL("map[2] = c", s[0]);
       CHECK_EQUAL("map[3] = d", s[1]);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::unordered_multimap<std::string, int, SIZE, SIZE, simple_hash> data;
+      data.insert(ETL_OR_STD::make_pair(std::string("1"), 1));
+      data.insert(ETL_OR_STD::make_pair(std::string("3"), 3));
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_multimap<std::string, int, SIZE, SIZE, transparent_hash, etl::equal_to<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data.insert(ETL_OR_STD::make_pair(std::string("1"), 1));
+      data.insert(ETL_OR_STD::make_pair(std::string("3"), 3));
+      data.insert(ETL_OR_STD::make_pair(std::string("5"), 5));
+      data.insert(ETL_OR_STD::make_pair(std::string("1"), 10));
+
+      CHECK(data.find("3") != data.end());
+      CHECK(3 == data.find("3")->second);
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(2U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_cached_hash)
+    {
+      typedef etl::unordered_multimap<std::string, int, SIZE, SIZE / 2, etl::cached_hash<simple_hash>> Cached;
+
+      Cached data;
+
+      data.insert(ETL_OR_STD::make_pair(std::string("ab"), 1));
+      data.insert(ETL_OR_STD::make_pair(std::string("ba"), 2)); // Same hash as "ab".
+      data.insert(ETL_OR_STD::make_pair(std::string("ab"), 3));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(std::string("ab")));
+      CHECK_EQUAL(1U, data.count(std::string("ba")));
+      CHECK_EQUAL(2, data.find(std::string("ba"))->second);
+
+      Cached copy(data);
+      CHECK_EQUAL(2U, copy.count(std::string("ab")));
+
+      CHECK_EQUAL(2U, data.erase(std::string("ab")));
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.contains(std::string("ba")));
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_multimap<int, int, 10, 4, identity_hash> Data;
+
+      Data data;
+
+      etl::unordered_statistics statistics = data.statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.bucket_count);
+      CHECK_EQUAL(0U, statistics.used_buckets);
+      CHECK_EQUAL(0U, statistics.max_chain_length);
+      CHECK_CLOSE(0.0, statistics.bytes_per_element, 0.01);
+
+      // Buckets of 3, 2, 1 and 0 elements.
+      const int keys[] = { 0, 4, 8, 1, 5, 2 };
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        data.insert(ETL_OR_STD::make_pair(keys[i], int(i)));
+      }
+
+      statistics = data.statistics();
+      CHECK_EQUAL(6U, statistics.size);
+      CHECK_EQUAL(3U, statistics.used_buckets);
+      CHECK_EQUAL(3U, statistics.max_chain_length);
+      CHECK_CLOSE(2.0, statistics.mean_chain_length, 0.01);
+      CHECK_CLOSE(data.load_factor(), statistics.load_factor, 0.01);
+      CHECK_EQUAL(4U * statistics.node_size, statistics.bytes_reserved - statistics.bytes_used);
+      CHECK_CLOSE(statistics.bytes_used / 6.0, statistics.bytes_per_element, 0.01);
+
+      // The bucket of 3 is counted in the last bin.
+      etl::histogram<size_t, int, 3, 0> histogram;
+      data.bucket_histogram(histogram);
+
+      CHECK_EQUAL(1, histogram[0]);
+      CHECK_EQUAL(1, histogram[1]);
+      CHECK_EQUAL(2, histogram[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_equal_keys_grouped_in_shared_bucket)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_multimap<int, int, 64, 4, identity_hash> Data;
+
+      Data data;
+
+      // Keys 1, 5 and 9 share a bucket. Their values are inserted interleaved.
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(ETL_OR_STD::make_pair(1, i));
+        data.insert(ETL_OR_STD::make_pair(5, 100 + i));
+
+        if (i < 10)
+        {
+          data.insert(ETL_OR_STD::make_pair(9, 200 + i));
+        }
+      }
+
+      CHECK_EQUAL(20U, data.count(1));
+      CHECK_EQUAL(20U, data.count(5));
+      CHECK_EQUAL(10U, data.count(9));
+      CHECK_EQUAL(0U,  data.count(13));
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(5);
+      CHECK_EQUAL(20, std::distance(range.first, range.second));
+
+      for (Data::iterator itr = range.first; itr != range.second; ++itr)
+      {
+        CHECK_EQUAL(5, itr->first);
+      }
+
+      range = data.equal_range(13);
+      CHECK(range.first == data.end());
+      CHECK(range.second == data.end());
+
+      CHECK_EQUAL(20U, data.erase(5));
+      CHECK_EQUAL(0U,  data.count(5));
+      CHECK_EQUAL(20U, data.count(1));
+      CHECK_EQUAL(10U, data.count(9));
+
+      // Erasing part of a group leaves the rest together.
+      Data::iterator itr = data.find(1);
+      itr = data.erase(itr);
+      ++itr;
+      data.erase(itr);
+
+      const Data& cdata = data;
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(1);
+      CHECK_EQUAL(18, std::distance(crange.first, crange.second));
+      CHECK_EQUAL(18U, cdata.count(1));
+
+      for (Data::const_iterator citr = crange.first; citr != crange.second; ++citr)
+      {
+        CHECK_EQUAL(1, citr->first);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range_uses_key_equal)
+    {
+      struct modulo_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key % 100);
+        }
+      };
+
+      struct modulo_equal
+      {
+        bool operator ()(int lhs, int rhs) const
+        {
+          return (lhs % 100) == (rhs % 100);
+        }
+      };
+
+      typedef etl::unordered_multimap<int, int, 8, 4, modulo_hash, modulo_equal> Data;
+
+      Data data;
+
+      data.insert(ETL_OR_STD::make_pair(5,   0));
+      data.insert(ETL_OR_STD::make_pair(105, 1));
+      data.insert(ETL_OR_STD::make_pair(205, 2));
+      data.insert(ETL_OR_STD::make_pair(6,   3));
+
+      CHECK_EQUAL(3U, data.count(5));
+      CHECK_EQUAL(3, std::distance(data.equal_range(305).first, data.equal_range(305).second));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::unordered_multimap<int, std::string, 4> Map;
+      Map data;
+
+      Map::iterator itr = data.emplace(1, "one");
+      CHECK_EQUAL(1, itr->first);
+      CHECK_EQUAL(std::string("one"), itr->second);
+
+      itr = data.emplace(1, "uno");
+      CHECK_EQUAL(std::string("uno"), itr->second);
+
+      itr = data.emplace_hint(data.end(), 2, "two");
+      CHECK_EQUAL(2, itr->first);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK_EQUAL(1U, data.count(2));
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::unordered_multimap<int, std::string, 4> Map;
+      Map data;
+
+      data.insert(std::make_pair(1, std::string("one")));
+      data.insert(std::make_pair(1, std::string("uno")));
+      data.insert(std::make_pair(2, std::string("two")));
+
+      Map::node_type node = data.extract(2);
+      CHECK_EQUAL(2, node.key());
+      CHECK_EQUAL(std::string("two"), node.mapped());
+      CHECK_EQUAL(2U, data.size());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      Map::iterator itr = data.insert(std::move(node));
+      CHECK(node.empty());
+      CHECK_EQUAL(2, itr->first);
+      CHECK_EQUAL(3U, data.size());
+
+      node = data.extract(1);
+      CHECK_EQUAL(1U, data.count(1));
+      itr = data.insert(data.cend(), std::move(node));
+      CHECK_EQUAL(2U, data.count(1));
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::unordered_multimap<int, std::string, 4> data0;
+      etl::unordered_multimap<int, std::string, 6> data1;
+
+      data0.insert(std::make_pair(1, std::string("one")));
+      data0.insert(std::make_pair(2, std::string("two")));
+      data1.insert(std::make_pair(2, std::string("deux")));
+
+      data1.merge(data0);
+
+      CHECK(data0.empty());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(1U, data1.count(1));
+      CHECK_EQUAL(2U, data1.count(2));
+    }
   };
 }
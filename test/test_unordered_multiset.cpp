@@ -40,6 +40,7 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_multiset.h"
+#include "etl/histogram.h"
 #include "etl/checksum.h"
 
 namespace
@@ -706,5 +707,235 @@ namespace
       data.assign(initial_data.begin(), initial_data.end());
       CHECK_CLOSE(2.0, data.load_factor(), 0.01);
     }
+
+    //*************************************************************************
+    TEST(test_cached_hash)
+    {
+      typedef etl::unordered_multiset<NDC, SIZE, SIZE / 2, etl::cached_hash<simple_hash>> Cached;
+
+      Cached data;
+
+      data.insert(N0);
+      data.insert(N1);
+      data.insert(N0);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(N0));
+      CHECK_EQUAL(1U, data.count(N1));
+      CHECK(data.find(N2) == data.end());
+
+      Cached copy(data);
+      CHECK_EQUAL(2U, copy.count(N0));
+
+      CHECK_EQUAL(2U, data.erase(N0));
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.contains(N1));
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_multiset<int, 10, 4, identity_hash> Data;
+
+      Data data;
+
+      etl::unordered_statistics statistics = data.statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.bucket_count);
+      CHECK_EQUAL(0U, statistics.used_buckets);
+      CHECK_EQUAL(0U, statistics.max_chain_length);
+      CHECK_CLOSE(0.0, statistics.bytes_per_element, 0.01);
+
+      // Buckets of 3, 2, 1 and 0 elements.
+      const int keys[] = { 0, 4, 8, 1, 5, 2 };
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        data.insert(keys[i]);
+      }
+
+      statistics = data.statistics();
+      CHECK_EQUAL(6U, statistics.size);
+      CHECK_EQUAL(3U, statistics.used_buckets);
+      CHECK_EQUAL(3U, statistics.max_chain_length);
+      CHECK_CLOSE(2.0, statistics.mean_chain_length, 0.01);
+      CHECK_CLOSE(data.load_factor(), statistics.load_factor, 0.01);
+      CHECK_EQUAL(4U * statistics.node_size, statistics.bytes_reserved - statistics.bytes_used);
+      CHECK_CLOSE(statistics.bytes_used / 6.0, statistics.bytes_per_element, 0.01);
+
+      // The bucket of 3 is counted in the last bin.
+      etl::histogram<size_t, int, 3, 0> histogram;
+      data.bucket_histogram(histogram);
+
+      CHECK_EQUAL(1, histogram[0]);
+      CHECK_EQUAL(1, histogram[1]);
+      CHECK_EQUAL(2, histogram[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_equal_keys_grouped_in_shared_bucket)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_multiset<int, 64, 4, identity_hash> Data;
+
+      Data data;
+
+      // Keys 1, 5 and 9 share a bucket. They are inserted interleaved.
+      for (int i = 0; i < 20; ++i)
+      {
+        data.insert(1);
+        data.insert(5);
+
+        if (i < 10)
+        {
+          data.insert(9);
+        }
+      }
+
+      CHECK_EQUAL(20U, data.count(1));
+      CHECK_EQUAL(20U, data.count(5));
+      CHECK_EQUAL(10U, data.count(9));
+      CHECK_EQUAL(0U,  data.count(13));
+
+      ETL_OR_STD::pair<Data::iterator, Data::iterator> range = data.equal_range(5);
+      CHECK_EQUAL(20, std::distance(range.first, range.second));
+
+      for (Data::iterator itr = range.first; itr != range.second; ++itr)
+      {
+        CHECK_EQUAL(5, *itr);
+      }
+
+      range = data.equal_range(13);
+      CHECK(range.first == data.end());
+      CHECK(range.second == data.end());
+
+      CHECK_EQUAL(20U, data.erase(5));
+      CHECK_EQUAL(0U,  data.count(5));
+      CHECK_EQUAL(20U, data.count(1));
+      CHECK_EQUAL(10U, data.count(9));
+
+      // Erasing part of a group leaves the rest together.
+      Data::iterator itr = data.find(1);
+      itr = data.erase(itr);
+      ++itr;
+      data.erase(itr);
+
+      const Data& cdata = data;
+      ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> crange = cdata.equal_range(1);
+      CHECK_EQUAL(18, std::distance(crange.first, crange.second));
+      CHECK_EQUAL(18U, cdata.count(1));
+
+      for (Data::const_iterator citr = crange.first; citr != crange.second; ++citr)
+      {
+        CHECK_EQUAL(1, *citr);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range_uses_key_equal)
+    {
+      struct modulo_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key % 100);
+        }
+      };
+
+      struct modulo_equal
+      {
+        bool operator ()(int lhs, int rhs) const
+        {
+          return (lhs % 100) == (rhs % 100);
+        }
+      };
+
+      typedef etl::unordered_multiset<int, 8, 4, modulo_hash, modulo_equal> Data;
+
+      Data data;
+
+      data.insert(5);
+      data.insert(105);
+      data.insert(205);
+      data.insert(6);
+
+      CHECK_EQUAL(3U, data.count(5));
+      CHECK_EQUAL(3, std::distance(data.equal_range(305).first, data.equal_range(305).second));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::unordered_multiset<int, 4> Set;
+      Set data;
+
+      std::pair<Set::iterator, bool> result = data.emplace(1);
+      CHECK(result.second);
+      CHECK_EQUAL(1, *result.first);
+
+      result = data.emplace(1);
+      CHECK(result.second);
+
+      Set::iterator itr = data.emplace_hint(data.end(), 5);
+      CHECK_EQUAL(5, *itr);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2U, data.count(1));
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::unordered_multiset<int, 4> Set;
+      Set data;
+
+      data.insert(1);
+      data.insert(1);
+      data.insert(2);
+
+      Set::node_type node = data.extract(1);
+      CHECK_EQUAL(1, node.value());
+      CHECK_EQUAL(1U, data.count(1));
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      Set::iterator itr = data.insert(std::move(node));
+      CHECK(node.empty());
+      CHECK_EQUAL(1, *itr);
+      CHECK_EQUAL(2U, data.count(1));
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::unordered_multiset<int, 4> data0;
+      etl::unordered_multiset<int, 6> data1;
+
+      data0.insert(1);
+      data0.insert(2);
+      data1.insert(2);
+
+      data1.merge(data0);
+
+      CHECK(data0.empty());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(2U, data1.count(2));
+    }
   };
 }
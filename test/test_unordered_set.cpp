@@ -39,6 +39,7 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_set.h"
+#include "etl/histogram.h"
 #include "etl/checksum.h"
 #include "etl/hash.h"
 
@@ -87,6 +88,22 @@ namespace
       }
     };
 
+    //*************************************************************************
+    struct transparent_hash
+    {
+      typedef void is_transparent;
+
+      size_t operator ()(const std::string& text) const
+      {
+        return std::accumulate(text.begin(), text.end(), 0);
+      }
+
+      size_t operator ()(const char* text) const
+      {
+        return std::accumulate(text, text + std::char_traits<char>::length(text), 0);
+      }
+    };
+
     using DataM = etl::unordered_set<ItemM, SIZE, SIZE, simple_hash>;
 
     typedef etl::unordered_set<DC,  SIZE, SIZE / 2, simple_hash> DataDC;
@@ -652,5 +669,251 @@ namespace
       CHECK_EQUAL("set = 2", s[0]);
       CHECK_EQUAL("set = 3", s[1]);
     }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      etl::unordered_set<std::string, SIZE, SIZE, transparent_hash> data;
+      data.insert(std::string("1"));
+      data.insert(std::string("3"));
+
+      CHECK(data.contains(std::string("1")));
+      CHECK(data.contains(std::string("3")));
+      CHECK(!data.contains(std::string("2")));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_set<std::string, SIZE, SIZE, transparent_hash, etl::equal_to<>> Transparent;
+
+      Transparent data;
+      const Transparent& cdata = data;
+
+      data.insert(std::string("1"));
+      data.insert(std::string("3"));
+      data.insert(std::string("5"));
+
+      CHECK(data.find("3") != data.end());
+      CHECK(std::string("3") == *data.find("3"));
+      CHECK(cdata.find("3") == cdata.find(std::string("3")));
+      CHECK(data.find("2") == data.end());
+      CHECK(cdata.find("2") == cdata.end());
+
+      CHECK_EQUAL(1U, data.count("1"));
+      CHECK_EQUAL(0U, cdata.count("2"));
+
+      CHECK(data.contains("5"));
+      CHECK(!cdata.contains("4"));
+
+      ETL_OR_STD::pair<Transparent::iterator, Transparent::iterator> range = data.equal_range("3");
+      CHECK(range.first == data.find("3"));
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+
+      ETL_OR_STD::pair<Transparent::const_iterator, Transparent::const_iterator> crange = cdata.equal_range("4");
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_cached_hash)
+    {
+      typedef etl::unordered_set<std::string, SIZE, SIZE / 2, etl::cached_hash<transparent_hash>> Cached;
+
+      Cached data;
+
+      data.insert(std::string("ab"));
+      data.insert(std::string("ba")); // Same hash as "ab".
+      data.insert(std::string("c"));
+      data.insert(std::string("c"));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.contains("ab"));
+      CHECK(data.contains("ba"));
+      CHECK(!data.contains("d"));
+
+      Cached copy(data);
+      CHECK(copy == data);
+
+      CHECK_EQUAL(1U, data.erase(std::string("ab")));
+      CHECK(!data.contains("ab"));
+      CHECK(data.contains("ba"));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_batch_find_batch)
+    {
+      // More than one batch of keys.
+      typedef etl::unordered_set<int, 64, 16> Batched;
+
+      std::vector<int> values;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        values.push_back(i * 3);
+      }
+
+      values.push_back(0); // Duplicate key.
+
+      Batched data;
+      data.insert_batch(values.begin(), values.end());
+
+      CHECK_EQUAL(40U, data.size());
+
+      std::vector<int> keys;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        keys.push_back(i * 3 + (i % 2)); // Every other key is missing.
+      }
+
+      std::vector<Batched::iterator> results(keys.size());
+      CHECK(data.find_batch(keys.begin(), keys.end(), results.begin()) == results.end());
+
+      const Batched& cdata = data;
+      std::vector<Batched::const_iterator> cresults(keys.size());
+      CHECK(cdata.find_batch(keys.begin(), keys.end(), cresults.begin()) == cresults.end());
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        CHECK(results[i] == data.find(keys[i]));
+        CHECK(cresults[i] == cdata.find(keys[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      typedef etl::unordered_set<int, 10, 4, identity_hash> Data;
+
+      Data data;
+
+      etl::unordered_statistics statistics = data.statistics();
+      CHECK_EQUAL(0U, statistics.size);
+      CHECK_EQUAL(4U, statistics.bucket_count);
+      CHECK_EQUAL(0U, statistics.used_buckets);
+      CHECK_EQUAL(0U, statistics.max_chain_length);
+      CHECK_CLOSE(0.0, statistics.bytes_per_element, 0.01);
+
+      // Buckets of 3, 2, 1 and 0 elements.
+      const int keys[] = { 0, 4, 8, 1, 5, 2 };
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        data.insert(keys[i]);
+      }
+
+      statistics = data.statistics();
+      CHECK_EQUAL(6U, statistics.size);
+      CHECK_EQUAL(3U, statistics.used_buckets);
+      CHECK_EQUAL(3U, statistics.max_chain_length);
+      CHECK_CLOSE(2.0, statistics.mean_chain_length, 0.01);
+      CHECK_CLOSE(data.load_factor(), statistics.load_factor, 0.01);
+      CHECK_EQUAL(4U * statistics.node_size, statistics.bytes_reserved - statistics.bytes_used);
+      CHECK_CLOSE(statistics.bytes_used / 6.0, statistics.bytes_per_element, 0.01);
+
+      // The bucket of 3 is counted in the last bin.
+      etl::histogram<size_t, int, 3, 0> histogram;
+      data.bucket_histogram(histogram);
+
+      CHECK_EQUAL(1, histogram[0]);
+      CHECK_EQUAL(1, histogram[1]);
+      CHECK_EQUAL(2, histogram[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      typedef etl::unordered_set<int, 4> Set;
+      Set data;
+
+      std::pair<Set::iterator, bool> result = data.emplace(1);
+      CHECK(result.second);
+      CHECK_EQUAL(1, *result.first);
+
+      // The key is already present.
+      result = data.emplace(1);
+      CHECK(!result.second);
+      CHECK_EQUAL(1, *result.first);
+      CHECK_EQUAL(1U, data.size());
+
+      Set::iterator itr = data.emplace_hint(data.end(), 5);
+      CHECK_EQUAL(5, *itr);
+      CHECK_EQUAL(2U, data.size());
+      CHECK(data.find(5) != data.end());
+    }
+    //*************************************************************************
+    TEST(test_extract_and_insert_node)
+    {
+      typedef etl::unordered_set<int, 4> Set;
+      Set data;
+
+      data.insert(1);
+      data.insert(2);
+
+      const int* p_value = &*data.find(1);
+
+      Set::node_type node = data.extract(data.find(1));
+      CHECK(bool(node));
+      CHECK_EQUAL(1, node.value());
+      CHECK_EQUAL(1U, data.size());
+
+      // An empty handle for a missing key.
+      CHECK(data.extract(3).empty());
+
+      // Back into the same unordered_set, so the node is relinked.
+      Set::insert_return_type result = data.insert(std::move(node));
+      CHECK(result.inserted);
+      CHECK(node.empty());
+      CHECK(p_value == &*result.position);
+      CHECK_EQUAL(2U, data.size());
+
+      // A duplicate key leaves the node in the handle.
+      Set other;
+      other.insert(2);
+      node = other.extract(2);
+      Set::iterator itr = data.insert(data.cend(), std::move(node));
+      CHECK(!node.empty());
+      CHECK_EQUAL(2, *itr);
+      CHECK_EQUAL(2U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::unordered_set<int, 4> data0;
+      etl::unordered_set<int, 6> data1;
+
+      data0.insert(1);
+      data0.insert(2);
+      data1.insert(2);
+      data1.insert(3);
+
+      data1.merge(data0);
+
+      CHECK_EQUAL(1U, data0.size());
+      CHECK(data0.find(2) != data0.end());
+      CHECK_EQUAL(3U, data1.size());
+      CHECK(data1.find(1) != data1.end());
+
+      // A node held by a handle is not counted, but still uses the pool.
+      {
+        etl::unordered_set<int, 6>::node_type node = data1.extract(data1.begin());
+        CHECK_EQUAL(2U, data1.size());
+        CHECK_EQUAL(3U, data1.available());
+        data1.clear();
+        CHECK(data1.empty());
+      }
+
+      CHECK_EQUAL(6U, data1.available());
+    }
   };
 }
@@ -0,0 +1,298 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/utf8.h"
+#include "etl/string.h"
+#include "etl/wstring.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+#include "etl/string_view.h"
+
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  // Reference encoder.
+  std::string encode(uint32_t c)
+  {
+    std::string s;
+
+    if (c < 0x80U)
+    {
+      s += char(c);
+    }
+    else if (c < 0x800U)
+    {
+      s += char(0xC0U | (c >> 6));
+      s += char(0x80U | (c & 0x3FU));
+    }
+    else if (c < 0x10000U)
+    {
+      s += char(0xE0U | (c >> 12));
+      s += char(0x80U | ((c >> 6) & 0x3FU));
+      s += char(0x80U | (c & 0x3FU));
+    }
+    else
+    {
+      s += char(0xF0U | (c >> 18));
+      s += char(0x80U | ((c >> 12) & 0x3FU));
+      s += char(0x80U | ((c >> 6) & 0x3FU));
+      s += char(0x80U | (c & 0x3FU));
+    }
+
+    return s;
+  }
+
+  SUITE(test_utf8)
+  {
+    //*************************************************************************
+    TEST(test_is_valid_utf8)
+    {
+      CHECK(etl::is_valid_utf8(etl::string_view("")));
+      CHECK(etl::is_valid_utf8(etl::string_view("Hello World, this is a long run of ASCII text")));
+      CHECK(etl::is_valid_utf8(etl::string_view("\xC2\x80 \xDF\xBF \xE0\xA0\x80 \xED\x9F\xBF \xEE\x80\x80 \xEF\xBF\xBF \xF0\x90\x80\x80 \xF4\x8F\xBF\xBF")));
+
+      CHECK(!etl::is_valid_utf8(etl::string_view("\x80")));                  // Lone continuation
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xC0\xAF")));              // Overlong
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xC1\xBF")));              // Overlong
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xE0\x9F\xBF")));          // Overlong
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xF0\x8F\xBF\xBF")));      // Overlong
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xED\xA0\x80")));          // Surrogate
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xF4\x90\x80\x80")));      // Above U+10FFFF
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xF5\x80\x80\x80")));      // Invalid lead byte
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xFF")));                  // Invalid lead byte
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xE2\x82")));              // Incomplete
+      CHECK(!etl::is_valid_utf8(etl::string_view("\xE2\x28\xA1")));          // Bad continuation
+    }
+
+    //*************************************************************************
+    TEST(test_validate_utf8_reports_offset)
+    {
+      // The error is after a run of more than 16 ASCII characters.
+      etl::string_view text("0123456789ABCDEFGHIJ\xC3\xA9xyz\xE2\x82");
+
+      etl::utf_result result = etl::validate_utf8(text);
+
+      CHECK(result.status == etl::utf_status::Incomplete_Sequence);
+      CHECK_EQUAL(25U, result.read);
+
+      result = etl::validate_utf8(etl::string_view("0123456789ABCDEFGHIJ\xC0\x80"));
+
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(20U, result.read);
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf16)
+    {
+      etl::u16string<40> out;
+
+      etl::utf_result result = etl::utf8_to_utf16(etl::string_view("Hello \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 World, and more ASCII"), out);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(37U, result.read);
+      CHECK_EQUAL(32U, result.written);
+      CHECK(out == etl::u16string<40>(u"Hello é€\U0001F600 World, and more ASCII"));
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf32)
+    {
+      etl::u32string<40> out(U">");
+
+      etl::utf_result result = etl::utf8_to_utf32(etl::string_view("Hello \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 World, and more ASCII"), out);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(31U, result.written);
+      CHECK(out == etl::u32string<40>(U">Hello é€\U0001F600 World, and more ASCII"));
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf16_stops_on_error)
+    {
+      etl::u16string<40> out;
+
+      etl::utf_result result = etl::utf8_to_utf16(etl::string_view("abc\xC3\xA9\xED\xA0\x80xyz"), out);
+
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(5U, result.read);
+      CHECK_EQUAL(4U, result.written);
+      CHECK(out == etl::u16string<40>(u"abcé"));
+
+      // Resume with the rest of an incomplete sequence.
+      out.clear();
+      result = etl::utf8_to_utf16(etl::string_view("abc\xF0\x9F"), out);
+
+      CHECK(result.status == etl::utf_status::Incomplete_Sequence);
+      CHECK_EQUAL(3U, result.read);
+
+      result = etl::utf8_to_utf16(etl::string_view("\xF0\x9F\x98\x80"), out);
+
+      CHECK(result.ok());
+      CHECK(out == etl::u16string<40>(u"abc\U0001F600"));
+    }
+
+    //*************************************************************************
+    TEST(test_output_full)
+    {
+      // A surrogate pair is never split.
+      etl::u16string<4> out16;
+
+      etl::utf_result result = etl::utf8_to_utf16(etl::string_view("abc\xF0\x9F\x98\x80"), out16);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(3U, result.read);
+      CHECK_EQUAL(3U, out16.size());
+
+      // A multi-byte character is never split.
+      etl::string<5> out8;
+
+      result = etl::utf16_to_utf8(etl::u16string_view(u"abc€"), out8);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(3U, result.read);
+      CHECK(out8 == etl::string<5>("abc"));
+
+      // A long ASCII run is cut at the capacity.
+      etl::u32string<10> out32;
+
+      result = etl::utf8_to_utf32(etl::string_view("0123456789ABCDEFGHIJ"), out32);
+
+      CHECK(result.status == etl::utf_status::Output_Full);
+      CHECK_EQUAL(10U, result.read);
+      CHECK(out32 == etl::u32string<10>(U"0123456789"));
+    }
+
+    //*************************************************************************
+    TEST(test_utf16_to_utf8)
+    {
+      etl::string<60> out;
+
+      etl::utf_result result = etl::utf16_to_utf8(etl::u16string_view(u"Hello é€\U0001F600 World, and more ASCII"), out);
+
+      CHECK(result.ok());
+      CHECK_EQUAL(32U, result.read);
+      CHECK(out == etl::string<60>("Hello \xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 World, and more ASCII"));
+
+      const char16_t lone_low[]  = { u'a', char16_t(0xDC00), u'b' };
+      const char16_t lone_high[] = { u'a', char16_t(0xD800), u'b' };
+      const char16_t truncated[] = { u'a', char16_t(0xD800) };
+
+      out.clear();
+      result = etl::utf16_to_utf8(etl::u16string_view(lone_low, 3U), out);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      out.clear();
+      result = etl::utf16_to_utf8(etl::u16string_view(lone_high, 3U), out);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      out.clear();
+      result = etl::utf16_to_utf8(etl::u16string_view(truncated, 2U), out);
+      CHECK(result.status == etl::utf_status::Incomplete_Sequence);
+      CHECK_EQUAL(1U, result.read);
+      CHECK(out == etl::string<60>("a"));
+    }
+
+    //*************************************************************************
+    TEST(test_utf32_to_utf8)
+    {
+      etl::string<60> out;
+
+      etl::utf_result result = etl::utf32_to_utf8(etl::u32string_view(U"é€\U0001F600\U0010FFFF"), out);
+
+      CHECK(result.ok());
+      CHECK(out == etl::string<60>("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF"));
+
+      const char32_t invalid[] = { U'a', char32_t(0xD800), char32_t(0x110000) };
+
+      out.clear();
+      result = etl::utf32_to_utf8(etl::u32string_view(invalid, 3U), out);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+      CHECK_EQUAL(1U, result.read);
+
+      result = etl::utf32_to_utf8(etl::u32string_view(invalid + 2, 1U), out);
+      CHECK(result.status == etl::utf_status::Invalid_Sequence);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_round_trip)
+    {
+      etl::wstring<20> wide;
+      etl::string<40>  narrow;
+
+      CHECK(etl::utf8_to_wide(etl::string_view("x\xC3\xA9\xF0\x9F\x98\x80y"), wide).ok());
+      CHECK(etl::wide_to_utf8(etl::wstring_view(wide), narrow).ok());
+      CHECK(narrow == etl::string<40>("x\xC3\xA9\xF0\x9F\x98\x80y"));
+    }
+
+    //*************************************************************************
+    TEST(test_all_code_points_round_trip)
+    {
+      for (uint32_t base = 0U; base < 0x110000U; base += 0x100U)
+      {
+        if ((base >= 0xD800U) && (base < 0xE000U))
+        {
+          continue;
+        }
+
+        std::string text;
+
+        for (uint32_t c = base; c < (base + 0x100U); ++c)
+        {
+          text += encode(c);
+        }
+
+        etl::string_view view(text.data(), text.size());
+        CHECK(etl::is_valid_utf8(view));
+
+        etl::u16string<512> utf16;
+        etl::u32string<256> utf32;
+        CHECK(etl::utf8_to_utf16(view, utf16).ok());
+        CHECK(etl::utf8_to_utf32(view, utf32).ok());
+
+        CHECK_EQUAL(256U, utf32.size());
+        CHECK_EQUAL(base, uint32_t(utf32.front()));
+        CHECK_EQUAL(base + 0xFFU, uint32_t(utf32.back()));
+
+        etl::string<1024> from16;
+        etl::string<1024> from32;
+        CHECK(etl::utf16_to_utf8(etl::u16string_view(utf16), from16).ok());
+        CHECK(etl::utf32_to_utf8(etl::u32string_view(utf32), from32).ok());
+
+        CHECK(std::string(from16.data(), from16.size()) == text);
+        CHECK(std::string(from32.data(), from32.size()) == text);
+      }
+    }
+  }
+}
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/variance.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -51,6 +52,24 @@ namespace
     0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0
   };
 
+  //*********************************
+  // Pseudo random int16_t samples, starting with a run of the most negative
+  // value, whose squares are the largest the kernels see.
+  std::vector<int16_t> make_int16_samples(size_t size, uint32_t seed)
+  {
+    std::vector<int16_t> samples(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      samples[i] = (i < 24U) ? int16_t(-32768) : int16_t(seed >> 16);
+    }
+
+    samples[24] = 32767;
+
+    return samples;
+  }
+
   SUITE(test_variance)
   {
     //*************************************************************************
@@ -142,5 +161,111 @@ namespace
       variance_result = variance1.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_int16_block_variance_matches_scalar)
+    {
+      // An odd size, so that the kernel has a tail to finish.
+      std::vector<int16_t> samples = make_int16_samples(1027U, 1U);
+
+      const int16_t* first = samples.data();
+      const int16_t* last  = samples.data() + samples.size();
+
+      etl::variance<etl::variance_type::Sample, int16_t, int64_t> block(first, last);
+      etl::variance<etl::variance_type::Sample, int16_t, int64_t> scalar;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        scalar.add(samples[i]);
+      }
+
+      CHECK_EQUAL(scalar.count(), block.count());
+      CHECK_EQUAL(scalar.get_variance(), block.get_variance());
+
+      // Adding in pieces gives the same result.
+      etl::variance<etl::variance_type::Sample, int16_t, int64_t> pieces;
+      pieces.add(first, first + 5);
+      pieces.add(first + 5, first + 500);
+      pieces.add(first + 500, last);
+
+      CHECK_EQUAL(scalar.count(), pieces.count());
+      CHECK_EQUAL(scalar.get_variance(), pieces.get_variance());
+    }
+
+    //*************************************************************************
+    TEST(test_float_block_variance_accuracy)
+    {
+      std::vector<float> samples(1000000U);
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        samples[i] = ((i % 2U) == 0U) ? 0.1f : -0.1f;
+      }
+
+      etl::variance<etl::variance_type::Population, float> variance(samples.data(), samples.data() + samples.size());
+
+      CHECK_CLOSE(double(0.1f) * double(0.1f), variance.get_variance(), 1e-8);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_matches_variance)
+    {
+      etl::variance<etl::variance_type::Sample, double>         variance(input_d.begin(), input_d.end());
+      etl::welford_variance<etl::variance_type::Sample, double> welford(input_d.begin(), input_d.end());
+
+      CHECK_EQUAL(variance.count(), welford.count());
+      CHECK_CLOSE(variance.get_variance(), welford.get_variance(), 1e-12);
+      CHECK_CLOSE(4.5, welford.get_mean(), 1e-12);
+
+      etl::welford_variance<etl::variance_type::Population, char> welford_c(input_c.begin(), input_c.end());
+      CHECK_CLOSE(8.25, double(welford_c), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_large_offset)
+    {
+      // The sum of squares method cancels away every significant digit.
+      std::vector<double> samples;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        samples.push_back(1.0e9 + double(i % 10U));
+      }
+
+      etl::welford_variance<etl::variance_type::Population, double> welford(samples.begin(), samples.end());
+
+      CHECK_CLOSE(8.25, welford.get_variance(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_merge)
+    {
+      std::vector<int16_t> samples = make_int16_samples(1000U, 7U);
+
+      typedef etl::welford_variance<etl::variance_type::Sample, int16_t> welford_t;
+
+      welford_t all(samples.begin(), samples.end());
+      welford_t part1(samples.begin(),       samples.begin() + 10);
+      welford_t part2(samples.begin() + 10,  samples.begin() + 600);
+      welford_t part3(samples.begin() + 600, samples.end());
+
+      welford_t merged;
+      merged.merge(part1);
+      merged.merge(part2);
+      merged.merge(welford_t());
+      merged.merge(part3);
+
+      CHECK_EQUAL(all.count(), merged.count());
+      CHECK_CLOSE(all.get_mean(), merged.get_mean(), 1e-9);
+      CHECK_CLOSE(all.get_variance(), merged.get_variance(), 1e-6 * all.get_variance());
+
+      merged.clear();
+      CHECK_EQUAL(0U, merged.count());
+      CHECK_EQUAL(0.0, merged.get_variance());
+
+      // A single value has no sample variance.
+      merged.add(5);
+      CHECK_EQUAL(0.0, merged.get_variance());
+    }
   };
 }
@@ -790,5 +790,52 @@ namespace
       CHECK(variant.is_type<D4>());
       CHECK_EQUAL(D4("1", "2", "3", "4"), variant.get<D4>());
     }
+
+    //*************************************************************************
+    TEST(test_accept_reader)
+    {
+      class reader : public test_variant_3a::reader
+      {
+      public:
+
+        reader() : c(' '), s(""), i(0)
+        {
+        }
+
+        void read(char c_) override
+        {
+          c = c_;
+        }
+
+        void read(int i_) override
+        {
+          i = i_;
+        }
+
+        void read(const std::string& s_) override
+        {
+          s = s_;
+        }
+
+        char c;
+        std::string s;
+        int i;
+      };
+
+      test_variant_3a variant;
+      reader reader;
+
+      variant = 'a';
+      variant.accept(reader);
+      CHECK_EQUAL('a', reader.c);
+
+      variant = std::string("Some Text");
+      variant.accept(reader);
+      CHECK_EQUAL(std::string("Some Text"), reader.s);
+
+      variant = 1;
+      variant.accept(reader);
+      CHECK_EQUAL(1, reader.i);
+    }
   };
 }
@@ -310,5 +310,26 @@ namespace
       p = variant_pool2.create<Derived1>();
       CHECK_THROW(variant_pool1.destroy(p), etl::pool_object_not_in_pool);
     }
+
+#if defined(ETL_POOL_STATISTICS)
+    //*************************************************************************
+    TEST(test_statistics)
+    {
+      Factory variant_pool;
+
+      Base* p1 = variant_pool.create<Derived1>();
+      Base* p2 = variant_pool.create<Derived2>();
+      variant_pool.destroy(p1);
+
+      etl::pool_statistics statistics = variant_pool.statistics();
+      CHECK_EQUAL(1U, statistics.size);
+      CHECK_EQUAL(2U, statistics.peak_size);
+      CHECK_EQUAL(2U, statistics.allocations);
+      CHECK_EQUAL(1U, statistics.releases);
+      CHECK_EQUAL(0U, statistics.failures);
+
+      variant_pool.destroy(p2);
+    }
+#endif
   };
 }
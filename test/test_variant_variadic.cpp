@@ -0,0 +1,565 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/variant.h"
+#include "etl/message.h"
+
+#include <string>
+#include <ostream>
+
+// Built in its own test target, which defines ETL_USE_VARIADIC_VARIANT.
+#if ETL_USING_VARIADIC_VARIANT
+
+namespace
+{
+  //***************************************************************************
+  // Counts live instances, to check construction and destruction.
+  struct Counted
+  {
+    Counted(int value_ = 0)
+      : value(value_)
+    {
+      ++count;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++count;
+    }
+
+    Counted(Counted&& other)
+      : value(other.value)
+    {
+      other.value = -1;
+      ++count;
+    }
+
+    Counted& operator =(const Counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    Counted& operator =(Counted&& other)
+    {
+      value = other.value;
+      other.value = -1;
+      return *this;
+    }
+
+    ~Counted()
+    {
+      --count;
+    }
+
+    friend bool operator ==(const Counted& lhs, const Counted& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    friend bool operator <(const Counted& lhs, const Counted& rhs)
+    {
+      return lhs.value < rhs.value;
+    }
+
+    int value;
+
+    static int count;
+  };
+
+  int Counted::count = 0;
+
+  //***************************************************************************
+  struct Throwing
+  {
+    Throwing()
+    {
+    }
+
+    Throwing(int)
+    {
+      throw 1;
+    }
+  };
+
+  //***************************************************************************
+  struct Visitor
+  {
+    int operator()(int i) const
+    {
+      return i;
+    }
+
+    int operator()(const std::string& s) const
+    {
+      return int(s.size());
+    }
+
+    int operator()(const Counted& c) const
+    {
+      return c.value * 10;
+    }
+  };
+
+  //***************************************************************************
+  struct Mutator
+  {
+    void operator()(int& i)
+    {
+      i += 1;
+      ++calls;
+    }
+
+    void operator()(std::string& s)
+    {
+      s += "!";
+      ++calls;
+    }
+
+    void operator()(Counted& c)
+    {
+      c.value += 100;
+      ++calls;
+    }
+
+    int calls = 0;
+  };
+
+  //***************************************************************************
+  struct Mover
+  {
+    std::string operator()(int&& i)
+    {
+      return std::to_string(i);
+    }
+
+    std::string operator()(std::string&& s)
+    {
+      return etl::move(s);
+    }
+
+    std::string operator()(Counted&&)
+    {
+      return "counted";
+    }
+  };
+
+  //***************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct Message2 : public etl::message<2>
+  {
+    Message2(const std::string& text_)
+      : text(text_)
+    {
+    }
+
+    std::string text;
+  };
+
+  //***************************************************************************
+  struct MessageHandler
+  {
+    void operator()(const Message1& msg)
+    {
+      total += msg.value;
+    }
+
+    void operator()(const Message2& msg)
+    {
+      text += msg.text;
+    }
+
+    int total = 0;
+    std::string text;
+  };
+
+  typedef etl::variant<int, std::string, Counted> Variant;
+  typedef etl::variant<char, short, int, long, float, double> Trivial;
+  typedef etl::variant<char, int, std::string> Readable;
+
+  SUITE(test_variant_variadic)
+  {
+    //*************************************************************************
+    TEST(test_default_constructs_first_type)
+    {
+      Variant v;
+
+      CHECK_EQUAL(0U, v.index());
+      CHECK(v.is_valid());
+      CHECK(etl::holds_alternative<int>(v));
+      CHECK_EQUAL(0, etl::get<int>(v));
+      CHECK_EQUAL(3U, etl::variant_size<Variant>::value);
+      CHECK((etl::is_same<std::string, etl::variant_alternative_t<1, Variant> >::value));
+    }
+
+    //*************************************************************************
+    TEST(test_construct_and_get)
+    {
+      Variant v1(42);
+      Variant v2(std::string("hello"));
+      Variant v3(Counted(7));
+
+      CHECK_EQUAL(0U, v1.index());
+      CHECK_EQUAL(1U, v2.index());
+      CHECK_EQUAL(2U, v3.index());
+
+      CHECK_EQUAL(42, etl::get<0>(v1));
+      CHECK_EQUAL(std::string("hello"), etl::get<std::string>(v2));
+      CHECK_EQUAL(7, etl::get<Counted>(v3).value);
+
+      CHECK(etl::get_if<int>(&v1) != ETL_NULLPTR);
+      CHECK(etl::get_if<std::string>(&v1) == ETL_NULLPTR);
+      CHECK(etl::get_if<1>(&v2) != ETL_NULLPTR);
+      CHECK(etl::get_if<2>(&v2) == ETL_NULLPTR);
+
+      const Variant& cv = v2;
+      CHECK_EQUAL(5U, etl::get<1>(cv).size());
+      CHECK(etl::get_if<std::string>(&cv) != ETL_NULLPTR);
+
+      CHECK_THROW(etl::get<std::string>(v1), etl::variant_incorrect_type_exception);
+      CHECK_THROW(etl::get<0>(v2), etl::variant_incorrect_type_exception);
+    }
+
+    //*************************************************************************
+    TEST(test_lifetime)
+    {
+      Counted::count = 0;
+
+      {
+        Variant v(Counted(1));
+        CHECK_EQUAL(1, Counted::count);
+
+        Variant v2(v);
+        CHECK_EQUAL(2, Counted::count);
+
+        v = 5;
+        CHECK_EQUAL(1, Counted::count);
+
+        v = v2;
+        CHECK_EQUAL(2, Counted::count);
+        CHECK_EQUAL(1, etl::get<Counted>(v).value);
+
+        Variant v3(etl::move(v2));
+        CHECK_EQUAL(3, Counted::count);
+        CHECK_EQUAL(-1, etl::get<Counted>(v2).value);
+
+        v2.emplace<std::string>("text");
+        CHECK_EQUAL(2, Counted::count);
+
+        v3.emplace<2>(9);
+        CHECK_EQUAL(2, Counted::count);
+        CHECK_EQUAL(9, etl::get<2>(v3).value);
+      }
+
+      CHECK_EQUAL(0, Counted::count);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment)
+    {
+      Variant v1(std::string("abc"));
+      Variant v2(1);
+
+      v2 = v1;
+      CHECK_EQUAL(std::string("abc"), etl::get<std::string>(v2));
+
+      v2 = std::string("def");
+      CHECK_EQUAL(std::string("def"), etl::get<std::string>(v2));
+
+      v1 = etl::move(v2);
+      CHECK_EQUAL(std::string("def"), etl::get<std::string>(v1));
+
+      v1 = Counted(3);
+      CHECK(v1.is_type<Counted>());
+      CHECK(!v1.is_same_type(v2));
+    }
+
+    //*************************************************************************
+    TEST(test_visit)
+    {
+      Variant v1(3);
+      Variant v2(std::string("four"));
+      Variant v3(Counted(5));
+
+      CHECK_EQUAL(3,  etl::visit(Visitor(), v1));
+      CHECK_EQUAL(4,  etl::visit(Visitor(), v2));
+      CHECK_EQUAL(50, etl::visit(Visitor(), v3));
+
+      const Variant& cv = v2;
+      CHECK_EQUAL(4, etl::visit(Visitor(), cv));
+
+      Mutator mutator;
+      etl::visit(mutator, v1);
+      etl::visit(mutator, v2);
+      etl::visit(mutator, v3);
+
+      CHECK_EQUAL(3, mutator.calls);
+      CHECK_EQUAL(4, etl::get<int>(v1));
+      CHECK_EQUAL(std::string("four!"), etl::get<std::string>(v2));
+      CHECK_EQUAL(105, etl::get<Counted>(v3).value);
+
+      CHECK_EQUAL(std::string("four!"), etl::visit(Mover(), etl::move(v2)));
+      CHECK_EQUAL(std::string("4"), etl::visit(Mover(), etl::move(v1)));
+
+      long result = etl::visit<long>(Visitor(), v3);
+      CHECK_EQUAL(1050L, result);
+    }
+
+    //*************************************************************************
+    TEST(test_visit_lambda)
+    {
+      Trivial v(2.5);
+
+      double d = etl::visit([](auto value) { return double(value) * 2.0; }, v);
+      CHECK_CLOSE(5.0, d, 0.001);
+
+      v = 'a';
+      d = etl::visit([](auto value) { return double(value); }, v);
+      CHECK_CLOSE(97.0, d, 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_trivially_copyable)
+    {
+      Trivial v1(short(12));
+      Trivial v2(v1);
+
+      CHECK_EQUAL(1U, v2.index());
+      CHECK_EQUAL(12, etl::get<short>(v2));
+
+      v1 = 1.5f;
+      v2 = v1;
+      CHECK_EQUAL(4U, v2.index());
+      CHECK_CLOSE(1.5f, etl::get<float>(v2), 0.001f);
+
+      Trivial v3(etl::move(v2));
+      CHECK_CLOSE(1.5f, etl::get<float>(v3), 0.001f);
+    }
+
+    //*************************************************************************
+    TEST(test_valueless_by_exception)
+    {
+      etl::variant<int, Throwing> v(1);
+
+      CHECK_THROW(v.emplace<Throwing>(1), int);
+      CHECK(v.valueless_by_exception());
+      CHECK_EQUAL(etl::variant_npos, v.index());
+      CHECK_THROW(etl::visit([](const auto&) { return 0; }, v), etl::variant_incorrect_type_exception);
+
+      etl::variant<int, Throwing> v2(v);
+      CHECK(v2.valueless_by_exception());
+
+      v = 2;
+      CHECK_EQUAL(2, etl::get<int>(v));
+    }
+
+    //*************************************************************************
+    TEST(test_comparison)
+    {
+      Variant a(1);
+      Variant b(2);
+      Variant c(std::string("a"));
+
+      CHECK(a == a);
+      CHECK(a != b);
+      CHECK(a < b);
+      CHECK(b < c);
+      CHECK(c > a);
+      CHECK(a <= a);
+      CHECK(c >= b);
+      CHECK(!(c < a));
+    }
+
+    //*************************************************************************
+    TEST(test_swap)
+    {
+      Variant a(1);
+      Variant b(std::string("b"));
+
+      swap(a, b);
+
+      CHECK_EQUAL(std::string("b"), etl::get<std::string>(a));
+      CHECK_EQUAL(1, etl::get<int>(b));
+    }
+
+    //*************************************************************************
+    TEST(test_monostate)
+    {
+      etl::variant<etl::monostate, int> v;
+
+      CHECK(etl::holds_alternative<etl::monostate>(v));
+
+      v = 3;
+      CHECK(!etl::holds_alternative<etl::monostate>(v));
+      CHECK(v != (etl::variant<etl::monostate, int>()));
+    }
+
+    //*************************************************************************
+    TEST(test_more_than_eight_types)
+    {
+      typedef etl::variant<char, signed char, unsigned char, short, unsigned short, int, unsigned int, long, unsigned long, float, double> Large;
+
+      Large v(3.0);
+
+      CHECK_EQUAL(10U, v.index());
+      CHECK_EQUAL(11U, etl::variant_size<Large>::value);
+      CHECK_CLOSE(3.0, etl::get<double>(v), 0.001);
+      CHECK_CLOSE(3.0, etl::visit([](auto value) { return double(value); }, v), 0.001);
+
+      v = 'x';
+      CHECK_CLOSE(120.0, etl::visit([](auto value) { return double(value); }, v), 0.001);
+
+      v = 2.5f;
+      CHECK_CLOSE(2.5, etl::visit([](auto value) { return double(value); }, v), 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_message_storage)
+    {
+      typedef etl::variant<Message1, Message2> Packet;
+
+      Packet p1(Message1(5));
+      Packet p2(Message2("text"));
+
+      CHECK_EQUAL(1, p1.upcast<etl::imessage>().get_message_id());
+      CHECK_EQUAL(2, p2.upcast<etl::imessage>().get_message_id());
+
+      const Packet& cp = p2;
+      CHECK_EQUAL(2, cp.upcast<etl::imessage>().get_message_id());
+
+      MessageHandler handler;
+      etl::visit(handler, p1);
+      etl::visit(handler, p2);
+
+      CHECK_EQUAL(5, handler.total);
+      CHECK_EQUAL(std::string("text"), handler.text);
+
+      p1 = p2;
+      CHECK_EQUAL(2, p1.upcast<etl::imessage>().get_message_id());
+    }
+
+    //*************************************************************************
+    TEST(test_member_get)
+    {
+      Readable variant;
+
+      variant = 1;
+      CHECK(variant.is_type<int>());
+      CHECK_EQUAL(1, variant.get<int>());
+
+      variant.get<int>() = 2;
+      CHECK_EQUAL(2, variant.get<int>());
+
+      variant = std::string("Some Text");
+      const Readable cvariant(variant);
+      CHECK_EQUAL(std::string("Some Text"), cvariant.get<std::string>());
+
+      char c;
+      CHECK_THROW(c = variant.get<char>(), etl::variant_incorrect_type_exception);
+      (void)c;
+    }
+
+    //*************************************************************************
+    TEST(test_is_supported_type)
+    {
+      CHECK(Readable::is_supported_type<char>());
+      CHECK(Readable::is_supported_type<int>());
+      CHECK(Readable::is_supported_type<std::string>());
+      CHECK(!Readable::is_supported_type<short>());
+    }
+
+    //*************************************************************************
+    TEST(test_call_and_accept_reader)
+    {
+      class reader : public Readable::reader
+      {
+      public:
+
+        reader() : c(' '), s(""), i(0)
+        {
+        }
+
+        void read(char c_) override
+        {
+          c = c_;
+        }
+
+        void read(int i_) override
+        {
+          i = i_;
+        }
+
+        void read(const std::string& s_) override
+        {
+          s = s_;
+        }
+
+        char c;
+        std::string s;
+        int i;
+      };
+
+      Readable variant;
+      reader reader;
+
+      variant = 'a';
+      variant.call(reader);
+      CHECK_EQUAL('a', reader.c);
+
+      variant = std::string("Some Text");
+      variant.accept(reader);
+      CHECK_EQUAL(std::string("Some Text"), reader.s);
+
+      variant = 1;
+      variant.call(reader);
+      CHECK_EQUAL(1, reader.i);
+
+      variant.clear();
+      CHECK(!variant.is_valid());
+
+      reader.i = 0;
+      variant.call(reader);
+      CHECK_EQUAL(0, reader.i);
+    }
+  };
+}
+
+#endif
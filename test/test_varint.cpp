@@ -0,0 +1,215 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/varint.h"
+#include "etl/byte_stream.h"
+
+#include <vector>
+#include <limits>
+
+namespace
+{
+  SUITE(test_varint)
+  {
+    //*************************************************************************
+    TEST(test_zigzag)
+    {
+      CHECK_EQUAL(0U, etl::zigzag_encode(int32_t(0)));
+      CHECK_EQUAL(1U, etl::zigzag_encode(int32_t(-1)));
+      CHECK_EQUAL(2U, etl::zigzag_encode(int32_t(1)));
+      CHECK_EQUAL(3U, etl::zigzag_encode(int32_t(-2)));
+      CHECK_EQUAL(0xFFFFFFFEUL, etl::zigzag_encode(std::numeric_limits<int32_t>::max()));
+      CHECK_EQUAL(0xFFFFFFFFUL, etl::zigzag_encode(std::numeric_limits<int32_t>::min()));
+      CHECK_EQUAL(255U, etl::zigzag_encode(int8_t(-128)));
+
+      CHECK_EQUAL(0, etl::zigzag_decode(uint32_t(0U)));
+      CHECK_EQUAL(-1, etl::zigzag_decode(uint32_t(1U)));
+      CHECK_EQUAL(1, etl::zigzag_decode(uint32_t(2U)));
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(), etl::zigzag_decode(uint32_t(0xFFFFFFFFUL)));
+      CHECK_EQUAL(-128, etl::zigzag_decode(uint8_t(255U)));
+    }
+
+    //*************************************************************************
+    TEST(test_encode_known_values)
+    {
+      uint8_t buffer[10];
+
+      CHECK_EQUAL(1U, etl::varint_encode(uint32_t(1U), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0x01, buffer[0]);
+
+      CHECK_EQUAL(2U, etl::varint_encode(uint32_t(300U), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0xAC, buffer[0]);
+      CHECK_EQUAL(0x02, buffer[1]);
+
+      CHECK_EQUAL(5U, etl::varint_encode(uint32_t(0xFFFFFFFFUL), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0x0F, buffer[4]);
+
+      CHECK_EQUAL(10U, etl::varint_encode(uint64_t(0xFFFFFFFFFFFFFFFFULL), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0x01, buffer[9]);
+
+      CHECK_EQUAL(1U, etl::varint_encode(int32_t(-1), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0x01, buffer[0]);
+
+      CHECK_EQUAL(2U, etl::varint_size(uint16_t(300U)));
+      CHECK_EQUAL(5U, etl::varint_max_size<uint32_t>::value);
+      CHECK_EQUAL(10U, etl::varint_max_size<int64_t>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_encode_no_room)
+    {
+      uint8_t buffer[2] = { 0U, 0U };
+
+      CHECK_EQUAL(0U, etl::varint_encode(uint32_t(1U << 14), buffer, sizeof(buffer)));
+      CHECK_EQUAL(2U, etl::varint_encode(uint32_t((1U << 14) - 1U), buffer, sizeof(buffer)));
+      CHECK_EQUAL(0U, etl::varint_encode(uint32_t(0U), buffer, 0U));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      const int64_t values[] = { 0, 1, -1, 63, -64, 64, 127, 128, 8191, -8192, 16384,
+                                 std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+
+      for (size_t i = 0U; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        uint8_t buffer[10];
+        const size_t size = etl::varint_encode(values[i], buffer, sizeof(buffer));
+        CHECK_EQUAL(etl::varint_size(values[i]), size);
+
+        int64_t result = 0;
+        CHECK_EQUAL(size, etl::varint_decode(buffer, size, result));
+        CHECK_EQUAL(values[i], result);
+
+        uint64_t uvalue = uint64_t(values[i]);
+        uint64_t uresult = 0U;
+        const size_t usize = etl::varint_encode(uvalue, buffer, sizeof(buffer));
+        CHECK_EQUAL(usize, etl::varint_decode(buffer, usize, uresult));
+        CHECK_EQUAL(uvalue, uresult);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_decode_errors)
+    {
+      uint32_t value = 123U;
+
+      // Truncated.
+      const uint8_t truncated[] = { 0x80, 0x80 };
+      CHECK_EQUAL(0U, etl::varint_decode(truncated, sizeof(truncated), value));
+      CHECK_EQUAL(0U, etl::varint_decode(truncated, 0U, value));
+
+      // Too long for the type.
+      const uint8_t too_long[] = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 };
+      CHECK_EQUAL(0U, etl::varint_decode(too_long, sizeof(too_long), value));
+
+      // Too large for the type.
+      const uint8_t too_large[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F };
+      CHECK_EQUAL(0U, etl::varint_decode(too_large, sizeof(too_large), value));
+      CHECK_EQUAL(123U, value);
+
+      uint8_t small = 0U;
+      const uint8_t two_bytes[] = { 0xFF, 0x01 };
+      CHECK_EQUAL(2U, etl::varint_decode(two_bytes, sizeof(two_bytes), small));
+      CHECK_EQUAL(255U, small);
+
+      const uint8_t over_255[] = { 0x80, 0x02 };
+      CHECK_EQUAL(0U, etl::varint_decode(over_255, sizeof(over_255), small));
+    }
+
+    //*************************************************************************
+    TEST(test_batch)
+    {
+      std::vector<int32_t> values;
+
+      for (int32_t i = -2000; i < 2000; i += 7)
+      {
+        values.push_back(i * i * ((i & 1) ? -1 : 1));
+      }
+
+      std::vector<uint8_t> buffer(values.size() * etl::varint_max_size<int32_t>::value);
+
+      const size_t size = etl::varint_encode(values.data(), values.size(), buffer.data(), buffer.size());
+      CHECK(size != 0U);
+
+      std::vector<int32_t> result(values.size());
+      CHECK_EQUAL(size, etl::varint_decode(buffer.data(), size, result.data(), result.size()));
+      CHECK(values == result);
+
+      // One value too many.
+      std::vector<int32_t> extra(values.size() + 1U);
+      CHECK_EQUAL(0U, etl::varint_decode(buffer.data(), size, extra.data(), extra.size()));
+
+      // Not enough room.
+      CHECK_EQUAL(0U, etl::varint_encode(values.data(), values.size(), buffer.data(), size - 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_span)
+    {
+      uint8_t buffer[16];
+      const uint16_t values[] = { 1U, 300U, 65535U };
+
+      const size_t size = etl::varint_encode(etl::span<const uint16_t>(values), etl::span<uint8_t>(buffer));
+      CHECK_EQUAL(6U, size);
+
+      uint16_t result[3];
+      CHECK_EQUAL(size, etl::varint_decode(etl::span<const uint8_t>(buffer, size), etl::span<uint16_t>(result)));
+      CHECK_ARRAY_EQUAL(values, result, 3U);
+
+      uint16_t single = 0U;
+      CHECK_EQUAL(1U, etl::varint_encode(uint16_t(5U), etl::span<uint8_t>(buffer)));
+      CHECK_EQUAL(1U, etl::varint_decode(etl::span<const uint8_t>(buffer, 1U), single));
+      CHECK_EQUAL(5U, single);
+    }
+
+    //*************************************************************************
+    TEST(test_byte_stream)
+    {
+      uint8_t buffer[8];
+
+      etl::byte_stream_writer writer(buffer, sizeof(buffer));
+
+      CHECK(writer.write_varint(int32_t(-3)));
+      CHECK(writer.write_varint(uint32_t(300U)));
+      CHECK(writer.write(uint8_t(0xAAU)));
+      CHECK(writer.write_varint(uint32_t(0xFFFFFFFFUL)) == false);
+      CHECK_EQUAL(4U, writer.size_bytes());
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes());
+
+      CHECK_EQUAL(-3, reader.read_varint<int32_t>().value());
+      CHECK_EQUAL(300U, reader.read_varint<uint32_t>().value());
+      CHECK_EQUAL(0xAAU, reader.read<uint8_t>().value());
+      CHECK(!reader.read_varint<uint32_t>().has_value());
+    }
+  };
+}
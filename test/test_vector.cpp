@@ -692,6 +692,30 @@ namespace
       CHECK_THROW(data.push_back(SIZE), etl::vector_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_push_back_pop_back_unchecked)
+    {
+      Compare_Data compare_data;
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        compare_data.push_back(i);
+        data.push_back_unchecked(i);
+      }
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      compare_data.pop_back();
+      compare_data.pop_back();
+      data.pop_back_unchecked();
+      data.pop_back_unchecked();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_pop_back)
     {
@@ -36,6 +36,56 @@
 #include "etl/vector.h"
 #include "data.h"
 
+namespace
+{
+  //***************************************************************************
+  // A type with user defined copy and destruction that is safe to relocate.
+  struct Relocatable
+  {
+    Relocatable(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    Relocatable(const Relocatable& other)
+      : value(other.value)
+    {
+      ++copies;
+    }
+
+    Relocatable& operator =(const Relocatable& other)
+    {
+      value = other.value;
+      ++copies;
+      return *this;
+    }
+
+    ~Relocatable()
+    {
+      ++destructions;
+    }
+
+    friend bool operator ==(const Relocatable& lhs, const Relocatable& rhs)
+    {
+      return lhs.value == rhs.value;
+    }
+
+    int value;
+
+    static int copies;
+    static int destructions;
+  };
+
+  int Relocatable::copies       = 0;
+  int Relocatable::destructions = 0;
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type {};
+}
+
 namespace
 {
   SUITE(test_vector_non_trivial)
@@ -209,6 +259,107 @@ namespace
       CHECK(data2 != data);
     }
 
+    //*************************************************************************
+    TEST(test_trivially_relocatable_insert_erase)
+    {
+      typedef etl::vector<Relocatable, SIZE> DataR;
+
+      std::vector<Relocatable> compare;
+      DataR data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        compare.push_back(Relocatable(i));
+        data.push_back(Relocatable(i));
+      }
+
+      // Only the new element is copied, the tail is relocated.
+      Relocatable::copies       = 0;
+      Relocatable::destructions = 0;
+      data.insert(data.begin() + 1, Relocatable(10));
+      CHECK_EQUAL(1, Relocatable::copies);
+      CHECK_EQUAL(1, Relocatable::destructions);
+      compare.insert(compare.begin() + 1, Relocatable(10));
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      CHECK_EQUAL(compare.size(), data.size());
+
+      Relocatable::copies = 0;
+      data.emplace(data.begin() + 2, 20);
+      CHECK_EQUAL(0, Relocatable::copies);
+      compare.emplace(compare.begin() + 2, 20);
+
+      const Relocatable r(30);
+      Relocatable::copies = 0;
+      data.insert(data.begin(), 2U, r);
+      CHECK_EQUAL(2, Relocatable::copies);
+      compare.insert(compare.begin(), 2U, r);
+
+      const Relocatable range[] = { Relocatable(40), Relocatable(41) };
+      Relocatable::copies = 0;
+      data.insert(data.begin() + 3, range, range + 2);
+      CHECK_EQUAL(2, Relocatable::copies);
+      compare.insert(compare.begin() + 3, range, range + 2);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      // Erasing destroys only the erased elements.
+      Relocatable::copies       = 0;
+      Relocatable::destructions = 0;
+      data.erase(data.begin() + 1);
+      CHECK_EQUAL(0, Relocatable::copies);
+      CHECK_EQUAL(1, Relocatable::destructions);
+      compare.erase(compare.begin() + 1);
+
+      Relocatable::copies       = 0;
+      Relocatable::destructions = 0;
+      data.erase(data.begin() + 2, data.begin() + 5);
+      CHECK_EQUAL(0, Relocatable::copies);
+      CHECK_EQUAL(3, Relocatable::destructions);
+      compare.erase(compare.begin() + 2, compare.begin() + 5);
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_trivially_relocatable_move_assignment)
+    {
+      typedef etl::vector<Relocatable, SIZE> DataR;
+
+      DataR data1;
+      DataR data2;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data1.push_back(Relocatable(i));
+      }
+
+      data2.push_back(Relocatable(99));
+
+      Relocatable::copies       = 0;
+      Relocatable::destructions = 0;
+      data2 = etl::move(data1);
+      CHECK_EQUAL(0, Relocatable::copies);
+      CHECK_EQUAL(1, Relocatable::destructions);
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(5U, data2.size());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(i, data2[i].value);
+      }
+
+      Relocatable::destructions = 0;
+      DataR data3(etl::move(data2));
+      CHECK_EQUAL(0, Relocatable::copies);
+      CHECK_EQUAL(0, Relocatable::destructions);
+      CHECK(data2.empty());
+      CHECK_EQUAL(5U, data3.size());
+      CHECK_EQUAL(4, data3.back().value);
+    }
+
     //*************************************************************************
     TEST(test_move_constructor)
     {
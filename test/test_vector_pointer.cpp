@@ -1087,6 +1087,30 @@ namespace
       CHECK(is_equal);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_push_back_pop_back_unchecked)
+    {
+      Compare_Data compare_data;
+      Data data;
+      CData cdata;
+
+      for (size_t i = 0UL; i < initial_data.size(); ++i)
+      {
+        compare_data.push_back(initial_data[i]);
+        data.push_back_unchecked(initial_data[i]);
+        cdata.push_back_unchecked(initial_data[i]);
+      }
+
+      compare_data.pop_back();
+      data.pop_back_unchecked();
+      cdata.pop_back_unchecked();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK_EQUAL(compare_data.size(), cdata.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(std::equal(cdata.begin(), cdata.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_pop_back_exception)
     {
@@ -0,0 +1,274 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "etl/work_stealing_deque.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::work_stealing_deque<int, 4> Deque;
+  typedef etl::iwork_stealing_deque<int>   IDeque;
+
+  SUITE(test_work_stealing_deque)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Deque deque;
+
+      CHECK_EQUAL(4U, deque.max_size());
+      CHECK_EQUAL(4U, deque.capacity());
+      CHECK_EQUAL(0U, deque.size());
+      CHECK(deque.empty());
+      CHECK(!deque.full());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_lifo)
+    {
+      Deque deque;
+      IDeque& ideque = deque;
+
+      CHECK(ideque.push(1));
+      CHECK(ideque.push(2));
+      CHECK(ideque.push(3));
+      CHECK_EQUAL(3U, ideque.size());
+
+      int value;
+
+      CHECK(ideque.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(ideque.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK(ideque.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK(!ideque.pop(value));
+      CHECK(ideque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_steal_fifo)
+    {
+      Deque deque;
+
+      deque.push(1);
+      deque.push(2);
+      deque.push(3);
+
+      int value;
+
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(1, value);
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(2, value);
+
+      // The owner and the thieves share the last value.
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(3, value);
+
+      CHECK(!deque.steal(value));
+      CHECK(!deque.pop(value));
+      CHECK(deque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Deque deque;
+
+      CHECK(deque.push(1));
+      CHECK(deque.push(2));
+      CHECK(deque.push(3));
+      CHECK(deque.push(4));
+      CHECK(deque.full());
+      CHECK(!deque.push(5));
+
+      int value;
+
+      // Stealing frees a slot at the top.
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(1, value);
+      CHECK(deque.push(5));
+      CHECK(!deque.push(6));
+
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(5, value);
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(2, value);
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      Deque deque;
+
+      int next_push  = 0;
+      int next_steal = 0;
+
+      for (int round = 0; round < 20; ++round)
+      {
+        while (deque.push(next_push))
+        {
+          ++next_push;
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+          int value;
+          CHECK(deque.steal(value));
+          CHECK_EQUAL(next_steal, value);
+          ++next_steal;
+        }
+      }
+
+      int value;
+
+      while (deque.steal(value))
+      {
+        CHECK_EQUAL(next_steal, value);
+        ++next_steal;
+      }
+
+      CHECK_EQUAL(next_push, next_steal);
+    }
+
+    //*************************************************************************
+    TEST(test_pointers)
+    {
+      etl::work_stealing_deque<int*, 2> deque;
+
+      int a = 1;
+      int b = 2;
+
+      deque.push(&a);
+      deque.push(&b);
+
+      int* p = nullptr;
+
+      CHECK(deque.steal(p));
+      CHECK(p == &a);
+      CHECK(deque.pop(p));
+      CHECK(p == &b);
+    }
+
+    //*************************************************************************
+    TEST(test_owner_and_thieves_threads)
+    {
+      etl::work_stealing_deque<int, 64> deque;
+
+      const int Count   = 50000;
+      const int Thieves = 3;
+
+      std::vector<std::atomic<int> > taken(Count);
+
+      for (int i = 0; i < Count; ++i)
+      {
+        taken[i] = 0;
+      }
+
+      std::atomic<bool> done(false);
+      std::vector<std::thread> thieves;
+
+      for (int t = 0; t < Thieves; ++t)
+      {
+        thieves.push_back(std::thread([&deque, &taken, &done]()
+        {
+          while (!done.load())
+          {
+            int value;
+
+            if (deque.steal(value))
+            {
+              ++taken[value];
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      // The owner pushes every value and pops some of them itself.
+      for (int i = 0; i < Count; ++i)
+      {
+        while (!deque.push(i))
+        {
+          int value;
+
+          if (deque.pop(value))
+          {
+            ++taken[value];
+          }
+        }
+
+        if ((i % 3) == 0)
+        {
+          int value;
+
+          if (deque.pop(value))
+          {
+            ++taken[value];
+          }
+        }
+      }
+
+      int value;
+
+      while (deque.pop(value))
+      {
+        ++taken[value];
+      }
+
+      done.store(true);
+
+      for (size_t t = 0; t < thieves.size(); ++t)
+      {
+        thieves[t].join();
+      }
+
+      bool all_once = true;
+
+      for (int i = 0; i < Count; ++i)
+      {
+        all_once = all_once && (taken[i].load() == 1);
+      }
+
+      CHECK(all_once);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,279 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/work_stealing_scheduler.h"
+
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+
+namespace
+{
+  typedef std::vector<std::string> WorkList_t;
+
+  //***************************************************************************
+  // Records the work it does, in a shared list.
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority_, const std::string& name_, size_t n_work_, WorkList_t& done_)
+      : task(priority_)
+      , name(name_)
+      , n_work(n_work_)
+      , done(done_)
+      , task_added(false)
+    {
+    }
+
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return uint32_t(n_work);
+    }
+
+    void task_process_work() ETL_OVERRIDE
+    {
+      --n_work;
+      done.push_back(name);
+    }
+
+    void on_task_added() ETL_OVERRIDE
+    {
+      task_added = true;
+    }
+
+    std::string name;
+    size_t      n_work;
+    WorkList_t& done;
+    bool        task_added;
+  };
+
+  //***************************************************************************
+  // Counts the work done on each worker, and checks it is never run twice at once.
+  //***************************************************************************
+  class CountingTask : public etl::task
+  {
+  public:
+
+    CountingTask(etl::task_priority_t priority_, uint32_t n_work_)
+      : task(priority_)
+      , n_work(n_work_)
+      , running(false)
+      , overlapped(false)
+    {
+    }
+
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return n_work.load();
+    }
+
+    void task_process_work() ETL_OVERRIDE
+    {
+      if (running.exchange(true))
+      {
+        overlapped = true;
+      }
+
+      --n_work;
+      ++done;
+
+      running = false;
+    }
+
+    std::atomic<uint32_t> n_work;
+    std::atomic<uint32_t> done{0};
+    std::atomic<bool>     running;
+    std::atomic<bool>     overlapped;
+  };
+
+  SUITE(test_work_stealing_scheduler)
+  {
+    //*************************************************************************
+    TEST(test_priority_order_on_one_worker)
+    {
+      WorkList_t done;
+
+      Task task1(1, "T1", 2, done);
+      Task task2(2, "T2", 2, done);
+      Task task3(3, "T3", 1, done);
+
+      etl::work_stealing_scheduler<3, 1> s;
+
+      s.add_task(task1);
+      s.add_task(task2);
+      s.add_task(task3);
+
+      CHECK(task1.task_added);
+      CHECK_EQUAL(3U, s.size());
+
+      while (s.process(0U))
+      {
+      }
+
+      WorkList_t expected = { "T3", "T2", "T1", "T2", "T1" };
+
+      CHECK(expected == done);
+    }
+
+    //*************************************************************************
+    TEST(test_pinned_tasks_are_not_stolen)
+    {
+      WorkList_t done;
+
+      Task task1(1, "T1", 2, done);
+      Task task2(2, "T2", 1, done);
+
+      etl::work_stealing_scheduler<2, 2> s;
+
+      s.add_task(task1, 0U);
+      s.add_task(task2, 0U);
+
+      // Worker 1 has nothing, and cannot take the pinned tasks.
+      CHECK(!s.process(1U));
+
+      CHECK(s.process(0U));
+      CHECK(s.process(0U));
+      CHECK(s.process(0U));
+      CHECK(!s.process(0U));
+
+      WorkList_t expected = { "T2", "T1", "T1" };
+
+      CHECK(expected == done);
+    }
+
+    //*************************************************************************
+    TEST(test_idle_worker_steals)
+    {
+      WorkList_t done;
+
+      Task task1(1, "T1", 1, done);
+      Task task2(2, "T2", 1, done);
+      Task task3(3, "T3", 1, done);
+      Task task4(0, "T4", 0, done);
+
+      etl::work_stealing_scheduler<4, 2> s;
+
+      // Both stealable tasks go to worker 1, as worker 0 has two pinned tasks.
+      s.add_task(task3, 0U);
+      s.add_task(task4, 0U);
+      s.add_task(task1);
+      s.add_task(task2);
+
+      // Worker 1 queues its ready tasks and runs the highest priority.
+      CHECK(s.process(1U));
+
+      // Worker 0 runs its pinned task, then steals the queued task.
+      CHECK(s.process(0U));
+      CHECK(s.process(0U));
+
+      CHECK(!s.process(0U));
+      CHECK(!s.process(1U));
+
+      WorkList_t expected = { "T2", "T3", "T1" };
+
+      CHECK(expected == done);
+    }
+
+    //*************************************************************************
+    TEST(test_mixed_pinned_and_stealable_priority)
+    {
+      WorkList_t done;
+
+      Task task1(1, "T1", 1, done);
+      Task task2(2, "T2", 1, done);
+      Task task3(3, "T3", 1, done);
+
+      etl::work_stealing_scheduler<3, 1> s;
+
+      s.add_task(task1);
+      s.add_task(task2, 0U);
+      s.add_task(task3);
+
+      while (s.process(0U))
+      {
+      }
+
+      WorkList_t expected = { "T3", "T2", "T1" };
+
+      CHECK(expected == done);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      const size_t Workers = 4U;
+
+      etl::work_stealing_scheduler<8, Workers> s;
+
+      std::vector<CountingTask*> tasks;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        tasks.push_back(new CountingTask(etl::task_priority_t(i), 2000U));
+
+        // One pinned task for each worker.
+        s.add_task(*tasks.back(), (i < Workers) ? i : s.ANY_WORKER);
+      }
+
+      std::atomic<size_t> remaining(8U * 2000U);
+
+      std::vector<std::thread> threads;
+
+      for (size_t w = 0U; w < Workers; ++w)
+      {
+        threads.push_back(std::thread([&s, &remaining, w]()
+        {
+          while (remaining.load() != 0U)
+          {
+            if (s.process(w))
+            {
+              --remaining;
+            }
+          }
+        }));
+      }
+
+      for (size_t w = 0U; w < Workers; ++w)
+      {
+        threads[w].join();
+      }
+
+      for (size_t i = 0U; i < tasks.size(); ++i)
+      {
+        CHECK_EQUAL(2000U, tasks[i]->done.load());
+        CHECK(!tasks[i]->overlapped);
+        delete tasks[i];
+      }
+    }
+  };
+}
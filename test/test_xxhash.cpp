@@ -0,0 +1,230 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2022 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <list>
+#include <stdint.h>
+
+#include "etl/xxhash.h"
+
+namespace
+{
+  const std::string empty_text;
+  const std::string short_text("abc");
+  const std::string long_text("Nobody inspects the spammish repetition");
+
+  SUITE(test_xxhash)
+  {
+    //*************************************************************************
+    TEST(test_xxhash32_constructor)
+    {
+      CHECK_EQUAL(0x02CC5D05UL, etl::xxhash32(empty_text.begin(), empty_text.end()).value());
+      CHECK_EQUAL(0x32D153FFUL, etl::xxhash32(short_text.begin(), short_text.end()).value());
+      CHECK_EQUAL(0xE2293B2FUL, etl::xxhash32(long_text.begin(), long_text.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_values)
+    {
+      etl::xxhash32 xxhash32_calculator;
+
+      for (size_t i = 0UL; i < long_text.size(); ++i)
+      {
+        xxhash32_calculator.add(long_text[i]);
+      }
+
+      uint32_t hash = xxhash32_calculator;
+
+      CHECK_EQUAL(0xE2293B2FUL, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_range)
+    {
+      etl::xxhash32 xxhash32_calculator;
+
+      xxhash32_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(0xE2293B2FUL, xxhash32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_range_in_pieces)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 259UL; ++i)
+      {
+        data.push_back(uint8_t(i * 7));
+      }
+
+      uint32_t compare = etl::xxhash32(data.begin(), data.end());
+
+      // Split points that straddle the stripe boundaries.
+      for (size_t split = 0UL; split <= data.size(); split += 5UL)
+      {
+        etl::xxhash32 xxhash32_calculator;
+
+        xxhash32_calculator.add(data.begin(), data.begin() + split);
+        xxhash32_calculator.add(data.begin() + split, data.end());
+
+        CHECK_EQUAL(compare, xxhash32_calculator.value());
+      }
+
+      // Non random access iterators.
+      std::list<uint8_t> list_data(data.begin(), data.end());
+
+      CHECK_EQUAL(compare, etl::xxhash32(list_data.begin(), list_data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_seed)
+    {
+      uint32_t hash1 = etl::xxhash32(long_text.begin(), long_text.end(), 0UL);
+      uint32_t hash2 = etl::xxhash32(long_text.begin(), long_text.end(), 1UL);
+
+      CHECK(hash1 != hash2);
+
+      etl::xxhash32 xxhash32_calculator(1UL);
+      xxhash32_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(hash2, xxhash32_calculator.value());
+
+      xxhash32_calculator.reset();
+      xxhash32_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(hash2, xxhash32_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash32_add_after_finalise)
+    {
+      etl::xxhash32 xxhash32_calculator(short_text.begin(), short_text.end());
+
+      xxhash32_calculator.value();
+
+      CHECK_THROW(xxhash32_calculator.add(0), etl::hash_finalised);
+      CHECK_THROW(xxhash32_calculator.add(short_text.begin(), short_text.end()), etl::hash_finalised);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_constructor)
+    {
+      CHECK_EQUAL(0xEF46DB3751D8E999ULL, etl::xxhash64(empty_text.begin(), empty_text.end()).value());
+      CHECK_EQUAL(0x44BC2CF5AD770999ULL, etl::xxhash64(short_text.begin(), short_text.end()).value());
+      CHECK_EQUAL(0xFBCEA83C8A378BF1ULL, etl::xxhash64(long_text.begin(), long_text.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_values)
+    {
+      etl::xxhash64 xxhash64_calculator;
+
+      for (size_t i = 0UL; i < long_text.size(); ++i)
+      {
+        xxhash64_calculator.add(long_text[i]);
+      }
+
+      uint64_t hash = xxhash64_calculator;
+
+      CHECK_EQUAL(0xFBCEA83C8A378BF1ULL, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range)
+    {
+      etl::xxhash64 xxhash64_calculator;
+
+      xxhash64_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(0xFBCEA83C8A378BF1ULL, xxhash64_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_range_in_pieces)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0UL; i < 259UL; ++i)
+      {
+        data.push_back(uint8_t(i * 7));
+      }
+
+      uint64_t compare = etl::xxhash64(data.begin(), data.end());
+
+      // Split points that straddle the stripe boundaries.
+      for (size_t split = 0UL; split <= data.size(); split += 5UL)
+      {
+        etl::xxhash64 xxhash64_calculator;
+
+        xxhash64_calculator.add(data.begin(), data.begin() + split);
+        xxhash64_calculator.add(data.begin() + split, data.end());
+
+        CHECK_EQUAL(compare, xxhash64_calculator.value());
+      }
+
+      // Non random access iterators.
+      std::list<uint8_t> list_data(data.begin(), data.end());
+
+      CHECK_EQUAL(compare, etl::xxhash64(list_data.begin(), list_data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_seed)
+    {
+      uint64_t hash1 = etl::xxhash64(long_text.begin(), long_text.end(), 0ULL);
+      uint64_t hash2 = etl::xxhash64(long_text.begin(), long_text.end(), 1ULL);
+
+      CHECK(hash1 != hash2);
+
+      etl::xxhash64 xxhash64_calculator(1ULL);
+      xxhash64_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(hash2, xxhash64_calculator.value());
+
+      xxhash64_calculator.reset();
+      xxhash64_calculator.add(long_text.begin(), long_text.end());
+
+      CHECK_EQUAL(hash2, xxhash64_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_xxhash64_add_after_finalise)
+    {
+      etl::xxhash64 xxhash64_calculator(short_text.begin(), short_text.end());
+
+      xxhash64_calculator.value();
+
+      CHECK_THROW(xxhash64_calculator.add(0), etl::hash_finalised);
+      CHECK_THROW(xxhash64_calculator.add(short_text.begin(), short_text.end()), etl::hash_finalised);
+    }
+  };
+}